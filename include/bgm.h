@@ -0,0 +1,30 @@
+#ifndef SIMPLELIGHT_BGM_INCLUDED
+#define SIMPLELIGHT_BGM_INCLUDED
+
+#include <gba_base.h>
+
+// Background music for the browser, built with make BGM=1 (-DBGM_STREAM).
+// The tracks in /SYSTEM/BGM play in directory order and loop:
+//  - .pcm: 8 bit signed mono samples at 18157 Hz
+//  - .adp: IMA ADPCM mono at 18157 Hz in 512 byte blocks, each starting
+//    with a 4 byte header (first sample, step index, 0), i.e. the data
+//    chunk of an IMA ADPCM .wav
+// Direct Sound A is fed by DMA1 at the rate of timer 0. The SD reads and
+// the decoding happen in Bgm_service, a slice per browser pass; anything
+// that keeps the browser loop from running only makes the music go quiet.
+#define BGM_DIR "/SYSTEM/BGM"
+
+//first track, nothing when the folder has none
+void Bgm_start(void);
+//sound off and the track closed, before a game is started
+void Bgm_stop(void);
+//nested: loads and flash writes hold the music, the last resume restarts it
+void Bgm_pause(void);
+void Bgm_resume(void);
+//one refill slice, in the browser loop
+void Bgm_service(void);
+//timer 3 ticks of 64 cycles to read and decode one second of audio, and
+//to run the VBlank handler for one second; 0 without a track
+u32 Bgm_bench(u32 *ticks_irq);
+
+#endif /* SIMPLELIGHT_BGM_INCLUDED */
@@ -0,0 +1,14 @@
+#ifndef SIMPLELIGHT_CRC32_INCLUDED
+#define SIMPLELIGHT_CRC32_INCLUDED
+
+#include <gba_base.h>
+
+// CRC-32 (zlib/No-Intro polynomial), slicing-by-8: eight 1KB tables in
+// EWRAM built on first use, the loop is ARM code in IWRAM and reads a
+// word at a time, so cart space (ROM, PSRAM, NOR) can be hashed directly.
+// Crc32_update continues a finished value: crc = Crc32_update(crc, ...)
+// starting from 0.
+u32 Crc32_update(u32 crc, const void *buf, u32 size);
+u32 crc32(unsigned char *buf, u32 size);
+
+#endif /* SIMPLELIGHT_CRC32_INCLUDED */
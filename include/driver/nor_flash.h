@@ -4,9 +4,13 @@
 //---------------------------------------------------------------
 void Chip_Reset();
 void Block_Erase(u32 blockAdd);
+void Block_Erase_start(u32 blockAdd);
+void Block_Erase_wait(u32 blockAdd);
+void PPB_Erase(void);
 void Chip_Erase();
 void FormatNor();
 void WriteFlash(u32 address,u8 *buffer,u32 size);
-void IWRAM_CODE WriteFlash_with32word(u32 address,u8 *buffer,u32 size);
+void WriteFlash_with32word(u32 address,u8 *buffer,u32 size);
 u32 Loadfile2NOR(TCHAR *filename, u32 NORaddress,u32 have_patch);
+u32 Writefile2NOR(TCHAR *filename, u32 NORaddress,u32 have_patch,u32 *ticks);
 u32 GetFileListFromNor(void);
\ No newline at end of file
@@ -1,4789 +1,2889 @@
-/*
-  This file was autogenerated by raw2c.
-Visit http://www.devkitpro.org
-*/
+/* Generated by tools/lz77/bin2lzh.py, do not edit manually */
 
 #ifndef SIMPLELIGHT_EMULATOR_GOOMBA_INCLUDED
 #define SIMPLELIGHT_EMULATOR_GOOMBA_INCLUDED
+
+/* LZ77 (BIOS type 0x10) of goomba.gba, 76400 -> 46048 bytes */
 const long int goomba_gba_size = 76400;
-const unsigned char goomba_gba[76400] = {
-	0x2e, 0x00, 0x00, 0xea, 0x24, 0xff, 0xae, 0x51, 0x69, 0x9a, 0xa2, 0x21, 0x3d, 0x84, 0x82, 0x0a, 
-	0x84, 0xe4, 0x09, 0xad, 0x11, 0x24, 0x8b, 0x98, 0xc0, 0x81, 0x7f, 0x21, 0xa3, 0x52, 0xbe, 0x19, 
-	0x93, 0x09, 0xce, 0x20, 0x10, 0x46, 0x4a, 0x4a, 0xf8, 0x27, 0x31, 0xec, 0x58, 0xc7, 0xe8, 0x33, 
-	0x82, 0xe3, 0xce, 0xbf, 0x85, 0xf4, 0xdf, 0x94, 0xce, 0x4b, 0x09, 0xc1, 0x94, 0x56, 0x8a, 0xc0, 
-	0x13, 0x72, 0xa7, 0xfc, 0x9f, 0x84, 0x4d, 0x73, 0xa3, 0xca, 0x9a, 0x61, 0x58, 0x97, 0xa3, 0x27, 
-	0xfc, 0x03, 0x98, 0x76, 0x23, 0x1d, 0xc7, 0x61, 0x03, 0x04, 0xae, 0x56, 0xbf, 0x38, 0x84, 0x00, 
-	0x40, 0xa7, 0x0e, 0xfd, 0xff, 0x52, 0xfe, 0x03, 0x6f, 0x95, 0x30, 0xf1, 0x97, 0xfb, 0xc0, 0x85, 
-	0x60, 0xd6, 0x80, 0x25, 0xa9, 0x63, 0xbe, 0x03, 0x01, 0x4e, 0x38, 0xe2, 0xf9, 0xa2, 0x34, 0xff, 
-	0xbb, 0x3e, 0x03, 0x44, 0x78, 0x00, 0x90, 0xcb, 0x88, 0x11, 0x3a, 0x94, 0x65, 0xc0, 0x7c, 0x63, 
-	0x87, 0xf0, 0x3c, 0xaf, 0xd6, 0x25, 0xe4, 0x8b, 0x38, 0x0a, 0xac, 0x72, 0x21, 0xd4, 0xf8, 0x07, 
-	0x47, 0x4f, 0x4f, 0x4d, 0x42, 0x41, 0x20, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x47, 0x4d, 0x42, 0x43, 
-	0x30, 0x31, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 
-	0x06, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0x03, 0xa0, 0xe3, 0x08, 0x02, 0x80, 0xe5, 0x12, 0x00, 0xa0, 0xe3, 0x00, 0xf0, 0x29, 0xe1, 
-	0xb8, 0xd0, 0x9f, 0xe5, 0x1f, 0x00, 0xa0, 0xe3, 0x00, 0xf0, 0x29, 0xe1, 0xb0, 0xd0, 0x9f, 0xe5, 
-	0x01, 0x00, 0x8f, 0xe2, 0x10, 0xff, 0x2f, 0xe1, 0x00, 0x27, 0x2b, 0x48, 0x40, 0x01, 0x0d, 0xd2, 
-	0x78, 0x46, 0x40, 0x01, 0x0a, 0xd3, 0x01, 0x27, 0x02, 0x22, 0x12, 0x06, 0x27, 0x4b, 0x9b, 0x1a, 
-	0x16, 0x1c, 0x91, 0x00, 0x00, 0xf0, 0x3a, 0xf8, 0x25, 0x48, 0x87, 0x46, 0x25, 0x49, 0x26, 0x4a, 
-	0x26, 0x4c, 0x00, 0xf0, 0x32, 0xf8, 0x26, 0x49, 0x26, 0x4a, 0x27, 0x4c, 0x00, 0xf0, 0x2d, 0xf8, 
-	0x26, 0x4a, 0x27, 0x49, 0x53, 0x1a, 0x02, 0xd0, 0x26, 0x4a, 0x00, 0xf0, 0x27, 0xf8, 0x26, 0x49, 
-	0x26, 0x4a, 0x27, 0x4c, 0x00, 0xf0, 0x21, 0xf8, 0x26, 0x48, 0x27, 0x49, 0x09, 0x1a, 0x00, 0xf0, 
-	0x12, 0xf8, 0x26, 0x48, 0x26, 0x49, 0x09, 0x1a, 0x00, 0xf0, 0x0d, 0xf8, 0x25, 0x49, 0x26, 0x48, 
-	0x08, 0x60, 0x26, 0x4b, 0x00, 0xf0, 0x10, 0xf8, 0x25, 0x48, 0x07, 0x60, 0x00, 0x20, 0x00, 0x21, 
-	0x24, 0x4b, 0x00, 0xf0, 0x09, 0xf8, 0x03, 0x22, 0x89, 0x18, 0x91, 0x43, 0x03, 0xd0, 0x00, 0x22, 
-	0x04, 0xc0, 0x04, 0x39, 0xfc, 0xd1, 0x70, 0x47, 0x18, 0x47, 0xa3, 0x1a, 0x03, 0x20, 0x1b, 0x18, 
-	0x83, 0x43, 0x03, 0xd0, 0x01, 0xc9, 0x01, 0xc2, 0x04, 0x3b, 0xfb, 0xd1, 0x70, 0x47, 0xc0, 0x46, 
-	0xa0, 0x7f, 0x00, 0x03, 0x40, 0x7f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0xc4, 0x00, 0x00, 0x02, 
-	0x0b, 0x01, 0x00, 0x08, 0x88, 0x21, 0x01, 0x08, 0x40, 0x78, 0x00, 0x03, 0x4c, 0x78, 0x00, 0x03, 
-	0x48, 0xa9, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x40, 0x78, 0x00, 0x03, 0x94, 0x21, 0x01, 0x08, 
-	0x94, 0x21, 0x01, 0x08, 0xa0, 0x7d, 0x00, 0x03, 0x94, 0x21, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 
-	0x04, 0x00, 0x00, 0x02, 0x4c, 0x78, 0x00, 0x03, 0xa0, 0x7d, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 
-	0xc4, 0x00, 0x00, 0x02, 0x80, 0x7d, 0x00, 0x03, 0x00, 0x00, 0x04, 0x02, 0x55, 0x8f, 0x00, 0x08, 
-	0x4c, 0x00, 0x00, 0x02, 0x85, 0x91, 0x00, 0x08, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 
-	0x9e, 0x46, 0x70, 0x47, 0x00, 0x00, 0x00, 0x00, 0x14, 0x4b, 0x02, 0x68, 0x70, 0xb5, 0x14, 0x4c, 
-	0x9a, 0x42, 0x17, 0xd1, 0x81, 0x22, 0x03, 0x00, 0x21, 0x00, 0xd2, 0x00, 0x08, 0x33, 0x85, 0x18, 
-	0x04, 0xcb, 0x82, 0x18, 0x04, 0xc1, 0xab, 0x42, 0xfa, 0xd1, 0x84, 0x22, 0x25, 0x68, 0x0d, 0x4e, 
-	0x29, 0x00, 0x30, 0x00, 0xd2, 0x01, 0x09, 0xf0, 0xd3, 0xf8, 0x28, 0x00, 0x26, 0x60, 0x70, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x80, 0x22, 0x23, 0x00, 0xd2, 0x03, 0x82, 0x18, 0x80, 0x21, 0xc9, 0x01, 
-	0x01, 0xc3, 0x40, 0x18, 0x90, 0x42, 0xf9, 0xd1, 0xe7, 0xe7, 0xc0, 0x46, 0x54, 0x52, 0x49, 0x4d, 
-	0x18, 0x92, 0x02, 0x02, 0x00, 0xfe, 0x00, 0x06, 0x70, 0x47, 0xc0, 0x46, 0x70, 0xb5, 0x10, 0x4c, 
-	0x21, 0x68, 0x17, 0x29, 0x18, 0xdc, 0x0f, 0x26, 0x45, 0x88, 0x0e, 0x4a, 0xcb, 0x00, 0x9d, 0x52, 
-	0xd2, 0x18, 0x0d, 0x4b, 0x05, 0x88, 0x1b, 0x68, 0xed, 0x1a, 0xeb, 0x17, 0x33, 0x40, 0x5b, 0x19, 
-	0x0a, 0x4d, 0x2e, 0x78, 0xc0, 0x25, 0x6d, 0x00, 0x75, 0x43, 0x1b, 0x11, 0x5b, 0x19, 0x53, 0x80, 
-	0x43, 0x68, 0x01, 0x31, 0x53, 0x60, 0x21, 0x60, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x4c, 0x78, 0x00, 0x03, 0x18, 0x96, 0x02, 0x02, 0x04, 0x00, 0x00, 0x02, 0x5b, 0x56, 0x00, 0x03, 
-	0x02, 0x00, 0x01, 0x00, 0x00, 0x23, 0x70, 0xb5, 0x35, 0x32, 0x45, 0x31, 0xff, 0x32, 0xff, 0x31, 
-	0x14, 0x78, 0x01, 0x32, 0x1b, 0x19, 0x8a, 0x42, 0xfa, 0xd1, 0x38, 0x22, 0xff, 0x32, 0x86, 0x5c, 
-	0x00, 0x22, 0x89, 0x25, 0x10, 0x00, 0x1b, 0x06, 0x0c, 0x49, 0x1b, 0x0e, 0x6d, 0x00, 0x0c, 0x78, 
-	0x00, 0x2c, 0x06, 0xd1, 0x01, 0x30, 0x02, 0x32, 0x02, 0x31, 0xaa, 0x42, 0xf7, 0xd1, 0x00, 0x20, 
-	0x05, 0xe0, 0xa3, 0x42, 0xf7, 0xd1, 0x4c, 0x78, 0x00, 0x2c, 0x03, 0xd1, 0x31, 0x30, 0x70, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0xa6, 0x42, 0xee, 0xd1, 0xf8, 0xe7, 0xc0, 0x46, 0x78, 0x94, 0x00, 0x08, 
-	0x70, 0xb5, 0x80, 0x24, 0x80, 0x23, 0x01, 0x00, 0x96, 0x22, 0xc0, 0x20, 0xe4, 0x04, 0x23, 0x60, 
-	0x52, 0x02, 0xc0, 0x04, 0x09, 0xf0, 0x54, 0xf8, 0x09, 0xf0, 0x66, 0xf8, 0x00, 0x22, 0x0f, 0x4b, 
-	0x1a, 0x80, 0x0f, 0x4b, 0x23, 0x60, 0x10, 0x24, 0x20, 0x00, 0x01, 0xf0, 0x69, 0xfa, 0x09, 0xf0, 
-	0x5b, 0xf8, 0x01, 0x3c, 0xf8, 0xd2, 0x96, 0x24, 0x01, 0x25, 0x03, 0x26, 0x09, 0xf0, 0x54, 0xf8, 
-	0x08, 0x4b, 0x1a, 0x88, 0x08, 0x4b, 0x9a, 0x42, 0x02, 0xd1, 0x08, 0x4b, 0x1d, 0x70, 0x5e, 0x70, 
-	0x01, 0x3c, 0x00, 0x2c, 0xf2, 0xd1, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x0c, 0x00, 0x00, 0x04, 
-	0x03, 0x04, 0x00, 0x00, 0x30, 0x01, 0x00, 0x04, 0x0f, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 
-	0x70, 0xb5, 0x0d, 0x4a, 0x03, 0x00, 0x50, 0x68, 0x12, 0x7a, 0x00, 0x2a, 0x06, 0xd1, 0xa4, 0x21, 
-	0x80, 0x24, 0x0a, 0x4a, 0x49, 0x00, 0x24, 0x02, 0x01, 0x3b, 0x02, 0xd2, 0x70, 0xbc, 0x02, 0xbc, 
-	0x08, 0x47, 0x05, 0x68, 0x95, 0x42, 0x02, 0xd1, 0x45, 0x68, 0x40, 0x19, 0xf4, 0xe7, 0x26, 0x00, 
-	0x45, 0x5c, 0xae, 0x40, 0x35, 0x00, 0xf8, 0xe7, 0x08, 0x00, 0x00, 0x02, 0x54, 0x52, 0x49, 0x4d, 
-	0x10, 0xb5, 0xff, 0xf7, 0xdd, 0xff, 0x04, 0x4b, 0x02, 0x68, 0x9a, 0x42, 0x01, 0xd1, 0x83, 0x68, 
-	0xc0, 0x18, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x54, 0x52, 0x49, 0x4d, 0x01, 0x00, 0x70, 0xb5, 
-	0x0f, 0x4c, 0x35, 0x31, 0x05, 0x00, 0x10, 0x22, 0x20, 0x00, 0xff, 0x31, 0x08, 0xf0, 0x44, 0xff, 
-	0x44, 0x22, 0x00, 0x23, 0xff, 0x32, 0xaa, 0x5c, 0x23, 0x74, 0x7f, 0x2a, 0x0c, 0xd9, 0xe3, 0x73, 
-	0x0b, 0x33, 0xe2, 0x5c, 0x00, 0x2a, 0x07, 0xd0, 0x01, 0x33, 0x0f, 0x2b, 0xf9, 0xd1, 0x00, 0x23, 
-	0xe3, 0x72, 0x23, 0x73, 0x63, 0x73, 0xa3, 0x73, 0x20, 0x00, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0x9c, 0x00, 0x00, 0x02, 0x26, 0x4b, 0xf7, 0xb5, 0xdc, 0x68, 0x07, 0x00, 0x14, 0x2c, 0x25, 0xdd, 
-	0x26, 0x00, 0x14, 0x3e, 0x38, 0x00, 0x70, 0x43, 0x61, 0x1e, 0xc0, 0x00, 0x08, 0xf0, 0x56, 0xff, 
-	0x07, 0x23, 0xc5, 0x17, 0x1d, 0x40, 0x2d, 0x18, 0x15, 0x24, 0xed, 0x10, 0xae, 0x42, 0x00, 0xdc, 
-	0x01, 0x3c, 0x1c, 0x4a, 0x1c, 0x4b, 0x10, 0x40, 0x04, 0xd5, 0x08, 0x22, 0x01, 0x38, 0x52, 0x42, 
-	0x10, 0x43, 0x01, 0x30, 0x18, 0x60, 0x00, 0x23, 0x01, 0x93, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0x26, 
-	0xa6, 0x42, 0x10, 0xdb, 0x00, 0x20, 0xfe, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x14, 0x23, 0x1b, 0x1b, 
-	0xe2, 0x07, 0x04, 0xd5, 0x04, 0x22, 0x10, 0x4b, 0x1a, 0x60, 0x15, 0x23, 0x1b, 0x1b, 0x5b, 0x10, 
-	0x00, 0x25, 0x01, 0x93, 0xe9, 0xe7, 0xa8, 0x19, 0xff, 0xf7, 0x92, 0xff, 0xff, 0xf7, 0x9e, 0xff, 
-	0x07, 0x4b, 0xdb, 0x68, 0x01, 0x00, 0x01, 0x2b, 0x08, 0xdd, 0x7a, 0x1b, 0x92, 0x1b, 0x53, 0x42, 
-	0x5a, 0x41, 0x01, 0x9b, 0x98, 0x19, 0x10, 0x23, 0x01, 0xf0, 0x18, 0xf9, 0x01, 0x36, 0xd7, 0xe7, 
-	0x08, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x80, 0x54, 0x00, 0x00, 0x02, 0x11, 0x4b, 0x1a, 0x68, 
-	0x11, 0x4b, 0x10, 0x00, 0x19, 0x69, 0x1a, 0x61, 0xf0, 0x23, 0x88, 0x43, 0x0f, 0x49, 0x1a, 0x40, 
-	0x0b, 0x68, 0x93, 0x42, 0x11, 0xd1, 0x4b, 0x68, 0x01, 0x33, 0x4b, 0x60, 0x18, 0x2b, 0x0f, 0xdd, 
-	0x03, 0x21, 0x0b, 0x40, 0x59, 0x42, 0x4b, 0x41, 0x5b, 0x42, 0x1a, 0x40, 0x00, 0x21, 0x08, 0x4b, 
-	0x19, 0x60, 0x0b, 0x23, 0x18, 0x40, 0x10, 0x43, 0x70, 0x47, 0x00, 0x23, 0x0c, 0xc1, 0xf5, 0xe7, 
-	0x00, 0x22, 0xf3, 0xe7, 0x44, 0x56, 0x00, 0x03, 0x08, 0x00, 0x00, 0x02, 0x5c, 0x78, 0x00, 0x03, 
-	0x48, 0x56, 0x00, 0x03, 0xf0, 0xb5, 0x03, 0x20, 0x85, 0xb0, 0x01, 0xf0, 0x37, 0xf8, 0x80, 0x23, 
-	0x55, 0x4f, 0x5b, 0x00, 0x10, 0x20, 0x3b, 0x60, 0x01, 0xf0, 0x64, 0xf9, 0x03, 0x20, 0x01, 0xf0, 
-	0x2d, 0xf8, 0x01, 0xf0, 0x6b, 0xf8, 0x00, 0x20, 0x02, 0xf0, 0x5c, 0xfa, 0x4f, 0x4d, 0x2b, 0x7a, 
-	0x00, 0x2b, 0x16, 0xd0, 0x4e, 0x4b, 0x19, 0x68, 0xc0, 0x23, 0x9b, 0x00, 0x00, 0x20, 0x19, 0x40, 
-	0x08, 0xf0, 0x1e, 0xff, 0x4b, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x01, 0xd0, 0x02, 0xf0, 0x6c, 0xfd, 
-	0x00, 0x20, 0x01, 0xf0, 0x47, 0xf9, 0x01, 0xf0, 0x61, 0xf8, 0x05, 0xb0, 0xf0, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xeb, 0x68, 0x01, 0x93, 0x44, 0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x43, 0x4a, 0x2b, 0x61, 
-	0x13, 0x60, 0x01, 0x9b, 0x6c, 0x69, 0x03, 0x92, 0x01, 0x2b, 0x1a, 0xdd, 0x20, 0x00, 0xff, 0xf7, 
-	0x41, 0xff, 0x3b, 0x4b, 0x19, 0x68, 0xc0, 0x23, 0x9b, 0x00, 0x19, 0x40, 0x01, 0x43, 0x20, 0x00, 
-	0x08, 0xf0, 0xf6, 0xfe, 0xe0, 0x26, 0x3e, 0x60, 0x20, 0x3e, 0x00, 0xf0, 0x53, 0xff, 0x33, 0x00, 
-	0x20, 0x33, 0xf8, 0xd1, 0x08, 0xf0, 0x18, 0xff, 0x07, 0x20, 0x01, 0xf0, 0x1b, 0xf9, 0x02, 0x94, 
-	0x02, 0xe0, 0x01, 0x23, 0x5b, 0x42, 0x02, 0x93, 0xff, 0xf7, 0x78, 0xff, 0x10, 0x23, 0x06, 0x00, 
-	0x18, 0x42, 0x04, 0xd0, 0x01, 0x9b, 0x0a, 0x34, 0xa3, 0x42, 0x00, 0xdc, 0x5c, 0x1e, 0x20, 0x23, 
-	0x1e, 0x42, 0x03, 0xd0, 0x0a, 0x3c, 0xe3, 0x43, 0xdb, 0x17, 0x1c, 0x40, 0x73, 0x06, 0x02, 0xd5, 
-	0x01, 0x9b, 0xe4, 0x18, 0x01, 0x3c, 0x33, 0x06, 0xdb, 0x0f, 0xe4, 0x18, 0x20, 0x00, 0x01, 0x99, 
-	0x08, 0xf0, 0xd2, 0xfe, 0x02, 0x9b, 0x0c, 0x00, 0x69, 0x61, 0x8b, 0x42, 0x0b, 0xd0, 0x08, 0x00, 
-	0xff, 0xf7, 0x00, 0xff, 0x1a, 0x4b, 0x19, 0x68, 0xc0, 0x23, 0x9b, 0x00, 0x19, 0x40, 0x01, 0x43, 
-	0x20, 0x00, 0x08, 0xf0, 0xb5, 0xfe, 0x00, 0x20, 0x08, 0xf0, 0x96, 0xfe, 0x01, 0x9b, 0x01, 0x2b, 
-	0x02, 0xdd, 0x0b, 0x23, 0x1e, 0x42, 0xc2, 0xd0, 0x01, 0x24, 0x08, 0x25, 0x28, 0x1b, 0x01, 0xf0, 
-	0xd9, 0xf8, 0x63, 0x01, 0x3b, 0x60, 0x01, 0x34, 0x00, 0xf0, 0xf4, 0xfe, 0x00, 0x20, 0x08, 0xf0, 
-	0x83, 0xfe, 0x00, 0xf0, 0xb7, 0xfe, 0x09, 0x2c, 0xf0, 0xd1, 0x03, 0x20, 0x00, 0xf0, 0x96, 0xff, 
-	0x02, 0x34, 0x03, 0x9b, 0x1b, 0x68, 0x23, 0x42, 0x00, 0xd1, 0x73, 0xe7, 0x00, 0x20, 0x03, 0x9b, 
-	0x18, 0x60, 0x08, 0xf0, 0x71, 0xfe, 0xf4, 0xe7, 0xa8, 0x56, 0x00, 0x03, 0x08, 0x00, 0x00, 0x02, 
-	0x28, 0x57, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04, 0x44, 0x56, 0x00, 0x03, 
-	0x10, 0xb5, 0x04, 0x4b, 0x9d, 0x46, 0xff, 0xf7, 0x3d, 0xff, 0x01, 0x20, 0x08, 0xf0, 0x5c, 0xfe, 
-	0xfe, 0xe7, 0xc0, 0x46, 0x40, 0x7f, 0x00, 0x03, 0xf8, 0x22, 0x7b, 0x4b, 0x18, 0x68, 0x43, 0x0e, 
-	0x5b, 0x06, 0x12, 0x06, 0x9a, 0x18, 0x51, 0x42, 0x4a, 0x41, 0xf0, 0xb5, 0x77, 0x4d, 0x2a, 0x72, 
-	0x80, 0x22, 0x89, 0xb0, 0x12, 0x05, 0x93, 0x42, 0x15, 0xd1, 0x75, 0x4b, 0x5a, 0x78, 0x01, 0x33, 
-	0x00, 0x2a, 0xfb, 0xd1, 0x5a, 0x78, 0x01, 0x33, 0x00, 0x2a, 0xfb, 0xd1, 0x19, 0x00, 0x01, 0x3b, 
-	0x1a, 0x78, 0x2f, 0x2a, 0xfa, 0xd1, 0x68, 0x60, 0x28, 0x00, 0x01, 0x23, 0x18, 0x30, 0x0f, 0x3a, 
-	0xeb, 0x60, 0x08, 0xf0, 0x65, 0xfe, 0x01, 0x23, 0x6a, 0x4a, 0x13, 0x80, 0x12, 0x88, 0x1a, 0x42, 
-	0x02, 0xd0, 0x2a, 0x00, 0x38, 0x32, 0x13, 0x70, 0x08, 0xf0, 0x0e, 0xfe, 0x66, 0x4b, 0x67, 0x4e, 
-	0x68, 0x70, 0x33, 0x60, 0x08, 0xf0, 0xf0, 0xfd, 0x00, 0x22, 0x65, 0x4b, 0x1a, 0x60, 0x2b, 0x7a, 
-	0x93, 0x42, 0x2b, 0xd1, 0x68, 0x68, 0x63, 0x4f, 0x02, 0x68, 0x03, 0x00, 0xba, 0x42, 0x01, 0xd1, 
-	0x83, 0x68, 0xc3, 0x18, 0xfc, 0x33, 0x9b, 0x68, 0x5f, 0x4a, 0x93, 0x42, 0x73, 0xd0, 0x96, 0x23, 
-	0x5b, 0x02, 0xc3, 0x18, 0x6b, 0x60, 0x01, 0x23, 0x07, 0x93, 0x01, 0x24, 0x6b, 0x68, 0x64, 0x42, 
-	0x1a, 0x68, 0xba, 0x42, 0x6a, 0xd1, 0x59, 0x68, 0x8c, 0x46, 0x9a, 0x68, 0x9a, 0x18, 0xfc, 0x32, 
-	0x92, 0x68, 0x55, 0x49, 0x63, 0x44, 0x01, 0x34, 0x8a, 0x42, 0xf1, 0xd0, 0xec, 0x60, 0x00, 0x2c, 
-	0x65, 0xd0, 0x07, 0x9b, 0x00, 0x2b, 0x01, 0xd0, 0xff, 0xf7, 0xc2, 0xfd, 0x80, 0x23, 0xdb, 0x04, 
-	0x1a, 0x68, 0x80, 0x2a, 0x01, 0xd1, 0x00, 0x22, 0x1a, 0x60, 0xa0, 0x25, 0xff, 0x22, 0x00, 0x24, 
-	0x4a, 0x4b, 0xed, 0x04, 0x2b, 0x80, 0x4a, 0x4b, 0x1a, 0x80, 0x4a, 0x4a, 0x23, 0x04, 0x1b, 0x0c, 
-	0x13, 0x80, 0x01, 0x34, 0x08, 0xf0, 0x20, 0xfe, 0x11, 0x2c, 0xf6, 0xd1, 0x80, 0x23, 0x00, 0x24, 
-	0xc0, 0x22, 0xc0, 0x20, 0xdb, 0x04, 0x21, 0x00, 0x2c, 0x80, 0x52, 0x02, 0x1c, 0x60, 0xc0, 0x04, 
-	0x08, 0xf0, 0xe0, 0xfd, 0x03, 0x23, 0x40, 0x48, 0x40, 0x4a, 0x12, 0x1a, 0x01, 0x3a, 0x1a, 0x43, 
-	0x3f, 0x49, 0x01, 0x32, 0x08, 0xf0, 0x10, 0xfe, 0x08, 0xf0, 0xa2, 0xfd, 0x04, 0x22, 0x3d, 0x4b, 
-	0x02, 0x21, 0x33, 0x60, 0x3c, 0x48, 0x13, 0x00, 0x05, 0x92, 0x04, 0x92, 0x03, 0x92, 0x02, 0x92, 
-	0x01, 0x92, 0x00, 0x92, 0x00, 0xf0, 0xb2, 0xf9, 0x21, 0x00, 0x38, 0x48, 0x04, 0x00, 0x4c, 0x43, 
-	0x37, 0x4a, 0x38, 0x4d, 0x4b, 0x01, 0x9a, 0x18, 0x5b, 0x19, 0x10, 0xc2, 0x9a, 0x42, 0xfc, 0xd1, 
-	0x01, 0x31, 0x10, 0x29, 0xf2, 0xd1, 0x00, 0xf0, 0x2f, 0xfe, 0x00, 0xf0, 0x39, 0xfe, 0x01, 0xf0, 
-	0x6f, 0xff, 0xff, 0xf7, 0x35, 0xff, 0x00, 0x20, 0x07, 0x90, 0x8e, 0xe7, 0xa4, 0x22, 0x80, 0x21, 
-	0x52, 0x00, 0x9a, 0x5c, 0x09, 0x02, 0x91, 0x40, 0x1a, 0x00, 0x8c, 0x46, 0x8f, 0xe7, 0x01, 0x26, 
-	0xee, 0x60, 0x00, 0xf0, 0x33, 0xfe, 0x03, 0x20, 0x00, 0xf0, 0xa0, 0xfe, 0x26, 0x4b, 0x1c, 0x60, 
-	0x00, 0xf0, 0x0a, 0xfe, 0x22, 0x00, 0x20, 0x00, 0x24, 0x49, 0x00, 0xf0, 0xa3, 0xff, 0x22, 0x00, 
-	0x30, 0x00, 0x23, 0x49, 0x00, 0xf0, 0x9e, 0xff, 0x22, 0x00, 0x02, 0x20, 0x21, 0x49, 0x00, 0xf0, 
-	0x99, 0xff, 0x22, 0x00, 0x03, 0x20, 0x20, 0x49, 0x00, 0xf0, 0x94, 0xff, 0x22, 0x00, 0x04, 0x20, 
-	0x1e, 0x49, 0x00, 0xf0, 0x8f, 0xff, 0x22, 0x00, 0x13, 0x20, 0x1d, 0x49, 0x00, 0xf0, 0x8a, 0xff, 
-	0x08, 0xf0, 0xaa, 0xfd, 0xfc, 0xe7, 0xc0, 0x46, 0xfc, 0xfb, 0x03, 0x02, 0x08, 0x00, 0x00, 0x02, 
-	0x08, 0xfc, 0x03, 0x02, 0xc8, 0x00, 0x00, 0x08, 0x88, 0x2d, 0x00, 0x03, 0x8c, 0x2d, 0x00, 0x03, 
-	0x60, 0x00, 0x00, 0x02, 0x54, 0x52, 0x49, 0x4d, 0xce, 0xed, 0x66, 0x66, 0xff, 0x7f, 0x00, 0x00, 
-	0x50, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x04, 0x00, 0xf0, 0x00, 0x06, 0xd0, 0xf8, 0x00, 0x06, 
-	0x98, 0x21, 0x01, 0x08, 0x9c, 0x2d, 0x00, 0x03, 0x70, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 
-	0x00, 0xc0, 0x00, 0x06, 0x20, 0xc0, 0x00, 0x06, 0xa8, 0x56, 0x00, 0x03, 0x58, 0x9a, 0x00, 0x08, 
-	0x67, 0x9a, 0x00, 0x08, 0x78, 0x9a, 0x00, 0x08, 0x94, 0x9a, 0x00, 0x08, 0xac, 0x9a, 0x00, 0x08, 
-	0xc7, 0x9a, 0x00, 0x08, 0x70, 0x47, 0x70, 0xb5, 0x05, 0x00, 0x48, 0x1e, 0x40, 0x19, 0x0c, 0x00, 
-	0x08, 0xf0, 0x1e, 0xfd, 0x60, 0x43, 0x40, 0x1b, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x43, 0x1e, 
-	0x98, 0x41, 0x70, 0x47, 0x00, 0x48, 0x70, 0x47, 0x8a, 0x95, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 
-	0x70, 0x10, 0x00, 0x00, 0x00, 0x48, 0x70, 0x47, 0xd9, 0x9a, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 
-	0xde, 0x9a, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 0xd9, 0x9a, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 
-	0xde, 0x9a, 0x00, 0x08, 0xf0, 0xb5, 0x04, 0x04, 0x05, 0x0c, 0x0e, 0x00, 0x01, 0x20, 0x91, 0xb0, 
-	0x24, 0x0c, 0x00, 0x29, 0x03, 0xd0, 0x00, 0x2a, 0x05, 0xd1, 0x28, 0x04, 0x20, 0x43, 0x11, 0xb0, 
-	0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x48, 0x4b, 0x11, 0x00, 0x9a, 0x42, 0x00, 0xd9, 0x19, 0x00, 
-	0x50, 0x1a, 0x0b, 0x00, 0x0e, 0x90, 0x0f, 0x2a, 0x72, 0xd9, 0x32, 0x00, 0x73, 0x18, 0x0f, 0x93, 
-	0x13, 0x78, 0x1b, 0x19, 0x00, 0x93, 0x00, 0x98, 0x53, 0x78, 0x1b, 0x18, 0x01, 0x93, 0x01, 0x98, 
-	0x93, 0x78, 0x1b, 0x18, 0x02, 0x93, 0x02, 0x98, 0xd3, 0x78, 0x1b, 0x18, 0x03, 0x93, 0x03, 0x98, 
-	0x13, 0x79, 0x1b, 0x18, 0x04, 0x93, 0x04, 0x98, 0x53, 0x79, 0x1b, 0x18, 0x05, 0x93, 0x05, 0x98, 
-	0x93, 0x79, 0x1b, 0x18, 0x06, 0x93, 0x06, 0x98, 0xd3, 0x79, 0x1b, 0x18, 0x07, 0x93, 0x07, 0x98, 
-	0x13, 0x7a, 0x1b, 0x18, 0x08, 0x93, 0x08, 0x98, 0x53, 0x7a, 0x1b, 0x18, 0x09, 0x93, 0x09, 0x98, 
-	0x93, 0x7a, 0x1b, 0x18, 0x0a, 0x93, 0xd3, 0x7a, 0x0a, 0x98, 0x84, 0x46, 0x9c, 0x44, 0x63, 0x46, 
-	0x17, 0x7b, 0x0b, 0x93, 0xff, 0x18, 0x53, 0x7b, 0x90, 0x7b, 0xdb, 0x19, 0x0c, 0x93, 0xc3, 0x18, 
-	0x01, 0x98, 0x84, 0x46, 0xd4, 0x7b, 0x0d, 0x93, 0xe4, 0x18, 0x00, 0x9b, 0x02, 0x98, 0x63, 0x44, 
-	0x1b, 0x18, 0x03, 0x98, 0x1b, 0x18, 0x04, 0x98, 0x1b, 0x18, 0x05, 0x98, 0x1b, 0x18, 0x06, 0x98, 
-	0x1b, 0x18, 0x07, 0x98, 0x1b, 0x18, 0x08, 0x98, 0x1b, 0x18, 0x09, 0x98, 0x1b, 0x18, 0x0a, 0x98, 
-	0x1b, 0x18, 0x0b, 0x98, 0x1b, 0x18, 0x0c, 0x98, 0xdb, 0x19, 0x1b, 0x18, 0x0d, 0x98, 0x1b, 0x18, 
-	0x1b, 0x19, 0xed, 0x18, 0x0f, 0x9b, 0x10, 0x32, 0x9b, 0x1a, 0x0f, 0x2b, 0xa0, 0xdc, 0x08, 0x00, 
-	0x10, 0x38, 0x10, 0x23, 0x02, 0x09, 0x0f, 0x29, 0x01, 0xdd, 0x53, 0x1c, 0x1b, 0x01, 0xf6, 0x18, 
-	0x00, 0x23, 0x0f, 0x29, 0x01, 0xdd, 0x12, 0x01, 0x53, 0x42, 0x1b, 0x18, 0x00, 0x2b, 0x07, 0xd0, 
-	0x32, 0x00, 0xf6, 0x18, 0x11, 0x78, 0x01, 0x32, 0x64, 0x18, 0x2d, 0x19, 0x96, 0x42, 0xf9, 0xd1, 
-	0x20, 0x00, 0x06, 0x49, 0x08, 0xf0, 0xa2, 0xfc, 0x28, 0x00, 0x0c, 0x00, 0x03, 0x49, 0x08, 0xf0, 
-	0x9d, 0xfc, 0x0e, 0x9a, 0x0d, 0x00, 0x66, 0xe7, 0xb0, 0x15, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 
-	0x10, 0xb5, 0x08, 0xf0, 0x73, 0xfa, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x10, 0xb5, 0x08, 0xf0, 
-	0x87, 0xfc, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x10, 0xb5, 0x08, 0xf0, 0x8b, 0xfa, 0x10, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x10, 0xb5, 0x08, 0xf0, 0xe5, 0xfa, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0x03, 0x22, 0x21, 0x4b, 0x52, 0x42, 0x30, 0xb5, 0x1a, 0x60, 0x01, 0x32, 0x5a, 0x60, 0x01, 0x32, 
-	0x9a, 0x60, 0x00, 0x23, 0x91, 0xb0, 0x01, 0xaa, 0x9b, 0x54, 0x01, 0x33, 0x10, 0x2b, 0xfb, 0xd1, 
-	0x00, 0x23, 0x00, 0x93, 0x03, 0x2b, 0x05, 0xd9, 0x01, 0x20, 0x40, 0x42, 0x11, 0xb0, 0x30, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x05, 0xaa, 0xd4, 0x18, 0x13, 0x00, 0x22, 0x00, 0x28, 0x33, 0x10, 0xc2, 
-	0x9a, 0x42, 0xfc, 0xd1, 0x20, 0x1d, 0x05, 0x00, 0x20, 0x22, 0x00, 0x21, 0x08, 0xf0, 0xba, 0xfa, 
-	0x23, 0x68, 0x21, 0x00, 0x1b, 0x1b, 0x5a, 0x42, 0x53, 0x41, 0x28, 0x00, 0x24, 0x31, 0x04, 0xc8, 
-	0x55, 0x42, 0x6a, 0x41, 0x13, 0x40, 0x81, 0x42, 0xf9, 0xd1, 0x62, 0x6a, 0x12, 0x1b, 0x51, 0x42, 
-	0x4a, 0x41, 0x13, 0x42, 0xd8, 0xd0, 0x02, 0x9b, 0x03, 0x98, 0x5a, 0x1e, 0x93, 0x41, 0x42, 0x1e, 
-	0x90, 0x41, 0x18, 0x40, 0x01, 0x38, 0xd1, 0xe7, 0x64, 0x78, 0x00, 0x03, 0xf8, 0xb5, 0x01, 0x25, 
-	0x04, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x1d, 0x4b, 0x06, 0x9f, 0x07, 0x9e, 0xdd, 0x60, 0x00, 0x2c, 
-	0x30, 0xd0, 0x4b, 0x1c, 0x01, 0xd0, 0x02, 0x29, 0x2c, 0xd1, 0x43, 0x1c, 0x01, 0xd0, 0x04, 0x28, 
-	0x28, 0xd1, 0x53, 0x1c, 0x01, 0xd0, 0x04, 0x2a, 0x24, 0xd1, 0x7b, 0x1c, 0x01, 0xd0, 0x04, 0x2f, 
-	0x20, 0xd1, 0x73, 0x1c, 0x01, 0xd0, 0x04, 0x2e, 0x1c, 0xd1, 0x08, 0x9b, 0x01, 0x33, 0x02, 0xd0, 
-	0x08, 0x9b, 0x04, 0x2b, 0x16, 0xd1, 0x09, 0x9b, 0x01, 0x33, 0x02, 0xd0, 0x09, 0x9b, 0x04, 0x2b, 
-	0x10, 0xd1, 0x0a, 0x9b, 0x01, 0x33, 0x02, 0xd0, 0x0a, 0x9b, 0x04, 0x2b, 0x0a, 0xd1, 0x0b, 0x9b, 
-	0x01, 0x33, 0x02, 0xd0, 0x0b, 0x9b, 0x04, 0x2b, 0x04, 0xd1, 0xff, 0xf7, 0x81, 0xff, 0xf8, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x01, 0x20, 0x40, 0x42, 0xf9, 0xe7, 0xc0, 0x46, 0x64, 0x78, 0x00, 0x03, 
-	0xf0, 0xb5, 0x8b, 0xb0, 0x94, 0x46, 0x00, 0x90, 0x02, 0x91, 0x09, 0x93, 0x0d, 0x29, 0x11, 0xd8, 
-	0x00, 0x29, 0x00, 0xd0, 0x48, 0xe1, 0x13, 0x00, 0x11, 0x22, 0x00, 0x20, 0x1a, 0x70, 0x62, 0x46, 
-	0x58, 0x70, 0x98, 0x70, 0x03, 0x33, 0x9b, 0x1a, 0x09, 0x9a, 0x13, 0x60, 0x0b, 0xb0, 0xf0, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x00, 0x9a, 0x02, 0x9b, 0xd3, 0x18, 0x03, 0x93, 0x02, 0x9b, 0x0d, 0x3b, 
-	0xd3, 0x18, 0x05, 0x93, 0x13, 0x00, 0x01, 0x93, 0x63, 0x46, 0x04, 0x32, 0xd1, 0x78, 0x04, 0x91, 
-	0x91, 0x78, 0x06, 0x91, 0x51, 0x78, 0x07, 0x91, 0x11, 0x78, 0x08, 0x91, 0x04, 0x99, 0x88, 0x01, 
-	0x06, 0x99, 0x48, 0x40, 0x07, 0x99, 0x40, 0x01, 0x48, 0x40, 0x08, 0x99, 0x40, 0x01, 0x48, 0x40, 
-	0x21, 0x21, 0x41, 0x43, 0x48, 0x09, 0x10, 0x9d, 0x81, 0x04, 0x8c, 0x0c, 0x09, 0x0c, 0x49, 0x59, 
-	0x00, 0x9d, 0xa9, 0x42, 0x40, 0xd3, 0x57, 0x1a, 0x96, 0x4d, 0x7e, 0x1e, 0xae, 0x42, 0x3b, 0xd8, 
-	0x80, 0x25, 0x2d, 0x01, 0xaf, 0x42, 0x1a, 0xd9, 0xcd, 0x78, 0x04, 0x9e, 0xb5, 0x42, 0x16, 0xd0, 
-	0x91, 0x4c, 0x40, 0x05, 0x40, 0x0d, 0x44, 0x40, 0x10, 0x98, 0xa1, 0x00, 0x09, 0x58, 0x00, 0x9e, 
-	0x8e, 0x42, 0x29, 0xd8, 0x57, 0x1a, 0x8b, 0x4d, 0x78, 0x1e, 0xa8, 0x42, 0x24, 0xd8, 0x80, 0x20, 
-	0x00, 0x01, 0x87, 0x42, 0x03, 0xd9, 0xc8, 0x78, 0x04, 0x9d, 0xa8, 0x42, 0x1c, 0xd1, 0x08, 0x78, 
-	0x08, 0x9d, 0xa8, 0x42, 0x18, 0xd1, 0x48, 0x78, 0x07, 0x9d, 0xa8, 0x42, 0x14, 0xd1, 0x88, 0x78, 
-	0x06, 0x9d, 0xa8, 0x42, 0x10, 0xd1, 0x10, 0x98, 0xa4, 0x00, 0x22, 0x50, 0x01, 0x98, 0x10, 0x1a, 
-	0x00, 0x28, 0x21, 0xdd, 0x03, 0x28, 0x10, 0xdc, 0x9e, 0x1e, 0x34, 0x78, 0x04, 0x43, 0x34, 0x70, 
-	0x11, 0xe0, 0x01, 0x90, 0x02, 0x00, 0xa1, 0xe7, 0x10, 0x99, 0xa4, 0x00, 0x62, 0x50, 0x50, 0x1c, 
-	0x05, 0x9a, 0x82, 0x42, 0xf6, 0xd8, 0x01, 0x98, 0x2a, 0xe0, 0x5e, 0x1c, 0x12, 0x28, 0x4a, 0xd8, 
-	0xc4, 0x1e, 0x1c, 0x70, 0x33, 0x00, 0x00, 0x24, 0x01, 0x9d, 0x2e, 0x5d, 0x1e, 0x55, 0x01, 0x34, 
-	0xa0, 0x42, 0xf9, 0xd1, 0x01, 0x92, 0x1b, 0x18, 0xcc, 0x78, 0xd0, 0x78, 0x84, 0x42, 0x47, 0xd0, 
-	0x10, 0x1d, 0x80, 0x21, 0x01, 0x9a, 0x01, 0x38, 0x82, 0x1a, 0x12, 0x06, 0x12, 0x0e, 0x09, 0x01, 
-	0x8f, 0x42, 0x71, 0xd8, 0x1c, 0x26, 0x01, 0x3f, 0x01, 0x3a, 0xbc, 0x00, 0x52, 0x01, 0x34, 0x40, 
-	0x22, 0x43, 0xf9, 0x08, 0x1a, 0x70, 0x59, 0x70, 0x02, 0x33, 0x05, 0x9a, 0x82, 0x42, 0xc8, 0xd8, 
-	0x62, 0x46, 0x09, 0x99, 0x9a, 0x1a, 0x0a, 0x60, 0x03, 0x9a, 0x03, 0x99, 0x12, 0x1a, 0x81, 0x42, 
-	0x00, 0xd1, 0x49, 0xe7, 0x02, 0x99, 0x00, 0x98, 0x89, 0x1a, 0x41, 0x18, 0x00, 0x91, 0x59, 0x1c, 
-	0x9c, 0x45, 0x00, 0xd0, 0x8b, 0xe0, 0xee, 0x2a, 0x00, 0xd9, 0x95, 0xe0, 0x11, 0x00, 0x11, 0x31, 
-	0x19, 0x70, 0x01, 0x33, 0x00, 0x21, 0x00, 0x98, 0x40, 0x5c, 0x58, 0x54, 0x01, 0x31, 0x8a, 0x42, 
-	0xf9, 0xd1, 0x9b, 0x18, 0x30, 0xe7, 0x00, 0x25, 0x04, 0x00, 0x1d, 0x70, 0x33, 0x00, 0x12, 0x3c, 
-	0x1e, 0x00, 0x01, 0x33, 0xff, 0x2c, 0x9a, 0xd9, 0x00, 0x25, 0xff, 0x3c, 0x35, 0x70, 0xf7, 0xe7, 
-	0x0c, 0x79, 0x10, 0x79, 0x84, 0x42, 0x01, 0xd0, 0x50, 0x1d, 0xb2, 0xe7, 0x4c, 0x79, 0x50, 0x79, 
-	0x84, 0x42, 0x01, 0xd0, 0x90, 0x1d, 0xac, 0xe7, 0x8c, 0x79, 0x90, 0x79, 0x84, 0x42, 0x01, 0xd0, 
-	0xd0, 0x1d, 0xa6, 0xe7, 0xcc, 0x79, 0xd0, 0x79, 0x84, 0x42, 0x02, 0xd0, 0x08, 0x32, 0x10, 0x00, 
-	0x9f, 0xe7, 0x10, 0x00, 0x0c, 0x7a, 0x12, 0x7a, 0x09, 0x30, 0x94, 0x42, 0x99, 0xd1, 0x09, 0x31, 
-	0x03, 0x9a, 0x82, 0x42, 0x03, 0xd9, 0x0c, 0x78, 0x02, 0x78, 0x94, 0x42, 0x28, 0xd0, 0x80, 0x24, 
-	0x01, 0x9a, 0x59, 0x1c, 0x82, 0x1a, 0xe4, 0x01, 0xa7, 0x42, 0x28, 0xd8, 0x20, 0x26, 0x7c, 0x1e, 
-	0x21, 0x2a, 0x20, 0xd8, 0x02, 0x3a, 0x18, 0xe0, 0x80, 0x24, 0x02, 0x3a, 0x12, 0x06, 0x12, 0x0e, 
-	0x59, 0x1c, 0xe4, 0x01, 0xa7, 0x42, 0x09, 0xd8, 0x20, 0x26, 0x16, 0x43, 0x1e, 0x70, 0x7c, 0x1e, 
-	0xa3, 0x00, 0xa4, 0x09, 0x0b, 0x70, 0x4c, 0x70, 0x8b, 0x1c, 0x86, 0xe7, 0x23, 0x4c, 0x3c, 0x19, 
-	0x08, 0x27, 0xe6, 0x0a, 0x3e, 0x40, 0x16, 0x43, 0x10, 0x22, 0x32, 0x43, 0x1a, 0x70, 0xef, 0xe7, 
-	0x01, 0x31, 0x01, 0x30, 0xcc, 0xe7, 0x21, 0x3a, 0x1e, 0x70, 0x00, 0x26, 0x0f, 0xe0, 0x08, 0x26, 
-	0x1a, 0x4c, 0x3c, 0x19, 0xe7, 0x0a, 0x37, 0x40, 0xb6, 0x19, 0x09, 0x2a, 0x02, 0xd8, 0x02, 0x3a, 
-	0x3a, 0x43, 0xea, 0xe7, 0x09, 0x3a, 0x3e, 0x43, 0xee, 0xe7, 0x1e, 0x70, 0xff, 0x3a, 0x0b, 0x00, 
-	0x01, 0x31, 0xff, 0x2a, 0xf9, 0xd8, 0xe1, 0xe7, 0x63, 0x46, 0x02, 0x9a, 0x76, 0xe7, 0x03, 0x2a, 
-	0x04, 0xd8, 0x98, 0x1e, 0x01, 0x78, 0x11, 0x43, 0x01, 0x70, 0x73, 0xe7, 0x12, 0x2a, 0x03, 0xd8, 
-	0xd0, 0x1e, 0x18, 0x70, 0x0b, 0x00, 0x6d, 0xe7, 0x00, 0x24, 0x10, 0x00, 0x1c, 0x70, 0x0b, 0x00, 
-	0x12, 0x38, 0x19, 0x00, 0x01, 0x33, 0xff, 0x28, 0x01, 0xd8, 0x08, 0x70, 0x62, 0xe7, 0x0c, 0x70, 
-	0xff, 0x38, 0xf6, 0xe7, 0xfe, 0xbf, 0x00, 0x00, 0x1f, 0x20, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 
-	0xf7, 0xb5, 0x00, 0x90, 0x00, 0x20, 0x01, 0x91, 0x18, 0x60, 0x00, 0x99, 0x09, 0x78, 0x11, 0x29, 
-	0x0d, 0xd9, 0x00, 0x9c, 0x11, 0x39, 0x16, 0x00, 0x65, 0x1c, 0x03, 0x29, 0x38, 0xdd, 0x2c, 0x5c, 
-	0x14, 0x54, 0x01, 0x30, 0x81, 0x42, 0xfa, 0xd1, 0x6d, 0x18, 0x50, 0x18, 0x16, 0xe0, 0x10, 0x00, 
-	0x00, 0x9d, 0x29, 0x78, 0x6c, 0x1c, 0x0f, 0x29, 0x59, 0xd8, 0x00, 0x29, 0x4f, 0xd0, 0x25, 0x78, 
-	0x05, 0x70, 0x65, 0x78, 0x45, 0x70, 0xa5, 0x78, 0x85, 0x70, 0x03, 0x25, 0x03, 0x31, 0x66, 0x5d, 
-	0x46, 0x55, 0x01, 0x35, 0xa9, 0x42, 0xfa, 0xd1, 0x65, 0x18, 0x40, 0x18, 0x29, 0x78, 0x6c, 0x78, 
-	0x0f, 0x29, 0x43, 0xd8, 0xa4, 0x00, 0x89, 0x08, 0x09, 0x19, 0x53, 0x4c, 0x41, 0x1a, 0x09, 0x19, 
-	0x0c, 0x78, 0x04, 0x70, 0x4c, 0x78, 0x44, 0x70, 0x89, 0x78, 0x02, 0x35, 0x81, 0x70, 0x03, 0x30, 
-	0xa9, 0x1e, 0x0e, 0x78, 0x03, 0x24, 0x31, 0x00, 0x21, 0x40, 0x26, 0x42, 0xd1, 0xd0, 0x06, 0x00, 
-	0x00, 0x20, 0x2c, 0x5c, 0x07, 0x00, 0x34, 0x54, 0x01, 0x30, 0x81, 0x42, 0xf9, 0xd1, 0xe8, 0x19, 
-	0x84, 0x46, 0x64, 0x46, 0x70, 0x18, 0x69, 0x5c, 0x02, 0x34, 0x3f, 0x29, 0x56, 0xd9, 0xcf, 0x06, 
-	0x7f, 0x0f, 0xff, 0x43, 0x65, 0x1c, 0x24, 0x78, 0xe4, 0x00, 0x3f, 0x1b, 0x4e, 0x09, 0xc7, 0x19, 
-	0x01, 0x3e, 0x39, 0x78, 0x01, 0x70, 0x79, 0x78, 0x41, 0x70, 0x02, 0x21, 0x02, 0x36, 0x7c, 0x5c, 
-	0x44, 0x54, 0x01, 0x31, 0x8e, 0x42, 0xfa, 0xd1, 0x80, 0x19, 0xd1, 0xe7, 0xff, 0x31, 0x25, 0x78, 
-	0x01, 0x34, 0x00, 0x2d, 0xfa, 0xd0, 0x0f, 0x35, 0x49, 0x19, 0xa8, 0xe7, 0x6c, 0x1c, 0x3f, 0x29, 
-	0xdd, 0xd8, 0x1f, 0x29, 0x34, 0xd8, 0x80, 0x25, 0xce, 0x02, 0xed, 0x01, 0x2e, 0x40, 0xb4, 0x46, 
-	0x07, 0x25, 0x0e, 0x00, 0x2e, 0x40, 0x29, 0x42, 0x0b, 0xd1, 0x26, 0x02, 0xa6, 0x1b, 0x21, 0x78, 
-	0x27, 0x00, 0x01, 0x34, 0x00, 0x29, 0xfa, 0xd0, 0xff, 0x25, 0x7d, 0x43, 0x07, 0x31, 0xae, 0x19, 
-	0x8e, 0x19, 0x21, 0x78, 0x65, 0x78, 0x89, 0x08, 0xad, 0x01, 0x49, 0x19, 0x61, 0x44, 0xa5, 0x1c, 
-	0x22, 0x4c, 0x41, 0x1a, 0x0f, 0x19, 0x81, 0x42, 0xc3, 0xd1, 0x01, 0x9c, 0xa4, 0x46, 0x00, 0x99, 
-	0x80, 0x1a, 0x61, 0x44, 0x18, 0x60, 0x00, 0x20, 0xa9, 0x42, 0x04, 0xd0, 0x08, 0x20, 0xa9, 0x42, 
-	0x00, 0xd8, 0x04, 0x20, 0x40, 0x42, 0xfe, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x1f, 0x29, 0x19, 0xd9, 
-	0x1f, 0x25, 0x0e, 0x00, 0x2e, 0x40, 0x29, 0x42, 0x0b, 0xd1, 0x21, 0x02, 0x61, 0x1a, 0x26, 0x78, 
-	0x27, 0x00, 0x01, 0x34, 0x00, 0x2e, 0xfa, 0xd0, 0xff, 0x25, 0x7d, 0x43, 0x1f, 0x36, 0x6d, 0x18, 
-	0x76, 0x19, 0x27, 0x78, 0x61, 0x78, 0xbf, 0x08, 0x89, 0x01, 0x7f, 0x18, 0xff, 0x43, 0xa5, 0x1c, 
-	0xc7, 0x19, 0x96, 0xe7, 0x0f, 0x29, 0xae, 0xd8, 0x64, 0x46, 0xe5, 0x1c, 0xa4, 0x78, 0x89, 0x08, 
-	0xa4, 0x00, 0x61, 0x18, 0xc9, 0x43, 0x44, 0x18, 0x41, 0x5c, 0x01, 0x70, 0x61, 0x78, 0x03, 0x37, 
-	0x41, 0x70, 0xf0, 0x19, 0x64, 0xe7, 0xc0, 0x46, 0xff, 0xf7, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 
-	0x9c, 0x46, 0xf0, 0xb5, 0x1e, 0x68, 0x85, 0xb0, 0x93, 0x19, 0x64, 0x46, 0x01, 0x93, 0x00, 0x23, 
-	0x23, 0x60, 0x04, 0x78, 0x45, 0x18, 0x11, 0x2c, 0x00, 0xd8, 0xff, 0xe0, 0x27, 0x00, 0x11, 0x3f, 
-	0x01, 0x30, 0x03, 0x2f, 0x00, 0xdc, 0xf7, 0xe0, 0xbe, 0x42, 0x00, 0xd2, 0x29, 0xe1, 0x01, 0x39, 
-	0x10, 0x3c, 0xa1, 0x42, 0x00, 0xd2, 0x22, 0xe1, 0xc1, 0x5c, 0xd1, 0x54, 0x01, 0x33, 0x9f, 0x42, 
-	0xfa, 0xd1, 0xd3, 0x19, 0xc4, 0x19, 0x21, 0x78, 0x0f, 0x29, 0x3d, 0xd8, 0xa0, 0x1c, 0x64, 0x78, 
-	0x89, 0x08, 0xa4, 0x00, 0x61, 0x18, 0x8f, 0x4c, 0x59, 0x1a, 0x09, 0x19, 0x8a, 0x42, 0x00, 0xd9, 
-	0x14, 0xe1, 0x01, 0x9c, 0xe4, 0x1a, 0x02, 0x2c, 0x00, 0xd8, 0x7b, 0xe0, 0x0c, 0x78, 0x1c, 0x70, 
-	0x4c, 0x78, 0x5c, 0x70, 0x89, 0x78, 0x99, 0x70, 0x03, 0x33, 0x81, 0x1e, 0x0c, 0x78, 0x03, 0x21, 
-	0x27, 0x00, 0x0f, 0x40, 0x0c, 0x42, 0x00, 0xd1, 0xc9, 0xe0, 0x01, 0x99, 0xc9, 0x1a, 0xb9, 0x42, 
-	0x68, 0xd3, 0x7c, 0x1c, 0x29, 0x1a, 0xa1, 0x42, 0x00, 0xd2, 0x71, 0xe0, 0x00, 0x21, 0x44, 0x5c, 
-	0x03, 0x91, 0x5c, 0x54, 0x01, 0x31, 0x8f, 0x42, 0xf9, 0xd1, 0x03, 0x99, 0x41, 0x18, 0x8c, 0x1c, 
-	0xde, 0x19, 0x02, 0x91, 0xc7, 0x5d, 0xa5, 0x42, 0x3e, 0xd8, 0x33, 0x00, 0x07, 0x20, 0x9b, 0x1a, 
-	0x40, 0x42, 0x33, 0xe0, 0xff, 0x31, 0xb4, 0xe0, 0x01, 0x34, 0x3f, 0x29, 0x38, 0xd8, 0x1f, 0x29, 
-	0x4e, 0xd8, 0x80, 0x20, 0xce, 0x02, 0xc0, 0x01, 0x06, 0x40, 0x0f, 0x00, 0x07, 0x20, 0x02, 0x96, 
-	0x07, 0x40, 0x01, 0x42, 0x10, 0xd1, 0x21, 0x00, 0xa5, 0x42, 0x49, 0xd0, 0x0f, 0x78, 0x0e, 0x00, 
-	0x01, 0x31, 0x00, 0x2f, 0x00, 0xd1, 0x75, 0xe0, 0xff, 0x20, 0x46, 0x43, 0x20, 0x02, 0x20, 0x1a, 
-	0x0c, 0x00, 0x30, 0x18, 0x07, 0x37, 0x3f, 0x18, 0x21, 0x78, 0x60, 0x78, 0x89, 0x08, 0x80, 0x01, 
-	0x09, 0x18, 0x02, 0x98, 0x09, 0x18, 0xa0, 0x1c, 0x5f, 0x4c, 0x59, 0x1a, 0x0e, 0x19, 0x8b, 0x42, 
-	0x48, 0xd1, 0x9b, 0x1a, 0x85, 0x42, 0x00, 0xd0, 0xa5, 0xe0, 0x00, 0x20, 0x62, 0x46, 0x13, 0x60, 
-	0x05, 0xb0, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x39, 0x00, 0x3f, 0x2f, 0x15, 0xd9, 0x33, 0x00, 
-	0xce, 0x06, 0x76, 0x0f, 0xf6, 0x43, 0x60, 0x1c, 0x24, 0x78, 0xe4, 0x00, 0x36, 0x1b, 0x49, 0x09, 
-	0x9e, 0x19, 0x4f, 0x1e, 0xb2, 0x42, 0x00, 0xd9, 0x98, 0xe0, 0x01, 0x9c, 0x01, 0x31, 0xe4, 0x1a, 
-	0x8c, 0x42, 0x2e, 0xd2, 0x05, 0x20, 0x9b, 0x1a, 0xaa, 0xe7, 0x1f, 0x2f, 0x36, 0xd9, 0x33, 0x00, 
-	0x1f, 0x20, 0x0f, 0x00, 0x07, 0x40, 0x01, 0x42, 0x14, 0xd1, 0x21, 0x00, 0xa5, 0x42, 0x04, 0xd1, 
-	0x9b, 0x1a, 0x04, 0x20, 0x9c, 0xe7, 0x8d, 0x42, 0xfa, 0xd0, 0x0f, 0x78, 0x08, 0x00, 0x01, 0x31, 
-	0x00, 0x2f, 0xf8, 0xd0, 0xff, 0x26, 0x70, 0x43, 0x26, 0x02, 0xa6, 0x1b, 0x0c, 0x00, 0x80, 0x19, 
-	0x1f, 0x37, 0x3f, 0x18, 0x26, 0x78, 0x61, 0x78, 0xb6, 0x08, 0x89, 0x01, 0x76, 0x18, 0xf6, 0x43, 
-	0xa0, 0x1c, 0x9e, 0x19, 0x96, 0x42, 0x69, 0xd3, 0x01, 0x99, 0xbc, 0x1c, 0xc9, 0x1a, 0xa1, 0x42, 
-	0xd0, 0xd3, 0x31, 0x78, 0x19, 0x70, 0x71, 0x78, 0x59, 0x70, 0x02, 0x21, 0x02, 0x37, 0x74, 0x5c, 
-	0x5c, 0x54, 0x01, 0x31, 0x8f, 0x42, 0xfa, 0xd1, 0xdb, 0x19, 0x4e, 0xe7, 0x0f, 0x2f, 0x05, 0xd9, 
-	0x33, 0x00, 0x76, 0xe7, 0x8d, 0x42, 0x00, 0xd0, 0x80, 0xe7, 0xc9, 0xe7, 0x02, 0x99, 0xc8, 0x1c, 
-	0x89, 0x78, 0xbf, 0x08, 0x89, 0x00, 0xc9, 0x19, 0xc9, 0x43, 0x71, 0x18, 0x8a, 0x42, 0x44, 0xd8, 
-	0x01, 0x9c, 0xa4, 0x1b, 0x01, 0x2c, 0x3e, 0xd9, 0x0c, 0x78, 0x34, 0x70, 0x03, 0x9c, 0x49, 0x78, 
-	0x03, 0x34, 0x71, 0x70, 0x1b, 0x19, 0x30, 0xe7, 0x13, 0x00, 0x36, 0xe7, 0x13, 0x00, 0xa8, 0x42, 
-	0x00, 0xd3, 0x4b, 0xe7, 0x01, 0x78, 0x44, 0x1c, 0x0f, 0x29, 0x00, 0xd9, 0x4d, 0xe7, 0x00, 0x29, 
-	0x08, 0xd1, 0xa5, 0x42, 0xa4, 0xd0, 0x20, 0x78, 0x01, 0x34, 0x00, 0x28, 0x00, 0xd1, 0x41, 0xe7, 
-	0x0f, 0x30, 0x09, 0x18, 0x01, 0x98, 0xce, 0x1c, 0xc0, 0x1a, 0xb0, 0x42, 0x8a, 0xd3, 0x0f, 0x1d, 
-	0x28, 0x1b, 0xb8, 0x42, 0x94, 0xd3, 0x20, 0x78, 0x18, 0x70, 0x60, 0x78, 0x58, 0x70, 0xa0, 0x78, 
-	0x98, 0x70, 0x03, 0x20, 0x27, 0x5c, 0x1f, 0x54, 0x01, 0x30, 0x86, 0x42, 0xfa, 0xd1, 0x03, 0x31, 
-	0x5b, 0x18, 0x64, 0x18, 0xe7, 0xe6, 0x85, 0x42, 0x83, 0xd9, 0x08, 0x20, 0x20, 0xe7, 0x13, 0x00, 
-	0x7e, 0xe7, 0x13, 0x00, 0x6e, 0xe7, 0x33, 0x00, 0x6c, 0xe7, 0x33, 0x00, 0x06, 0x20, 0x9b, 0x1a, 
-	0x16, 0xe7, 0xc0, 0x46, 0xff, 0xf7, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x03, 0x00, 0x2a, 0x38, 
-	0x2a, 0x2b, 0x07, 0xdc, 0x04, 0x4a, 0x20, 0x2b, 0x00, 0xda, 0x20, 0x23, 0xd3, 0x18, 0x20, 0x3b, 
-	0x18, 0x78, 0x2a, 0x38, 0x70, 0x47, 0xc0, 0x46, 0x8f, 0x95, 0x00, 0x08, 0xf7, 0xb5, 0x1d, 0x28, 
-	0x2c, 0xdc, 0x7f, 0x27, 0x17, 0x4a, 0x43, 0x00, 0x9e, 0x18, 0x17, 0x4a, 0x17, 0x4d, 0x9b, 0x18, 
-	0x01, 0x93, 0x45, 0x19, 0x2c, 0x78, 0x20, 0x00, 0x33, 0x88, 0x38, 0x40, 0x00, 0x93, 0xff, 0xf7, 
-	0xdd, 0xff, 0xa0, 0x23, 0xe4, 0x09, 0xdb, 0x01, 0x00, 0x9a, 0x24, 0x03, 0xc0, 0x18, 0x24, 0x18, 
-	0x24, 0x04, 0x2a, 0x32, 0x24, 0x0c, 0x3a, 0x40, 0x2a, 0x2a, 0x00, 0xd1, 0x0a, 0x3a, 0x0c, 0x49, 
-	0x8c, 0x46, 0x80, 0x21, 0x00, 0x9b, 0x63, 0x44, 0x5b, 0x11, 0x0b, 0x40, 0x9b, 0x18, 0x2b, 0x70, 
-	0x01, 0x9b, 0x34, 0x80, 0x40, 0x36, 0x1e, 0x35, 0xb3, 0x42, 0xdb, 0xd1, 0xf7, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0xc0, 0x4a, 0x00, 0x06, 0x00, 0x50, 0x00, 0x06, 0x10, 0x9a, 0x02, 0x02, 
-	0x00, 0xb0, 0xff, 0xff, 0xf7, 0xb5, 0x19, 0x4b, 0x1a, 0x68, 0x01, 0x93, 0x07, 0x23, 0x3f, 0x26, 
-	0xd4, 0x17, 0x17, 0x4f, 0x1c, 0x40, 0xa4, 0x18, 0x3a, 0x68, 0xd5, 0x17, 0x1d, 0x40, 0xad, 0x18, 
-	0xe4, 0x10, 0xed, 0x10, 0x34, 0x40, 0x35, 0x40, 0xac, 0x42, 0x05, 0xd1, 0x3b, 0x68, 0x01, 0x9a, 
-	0x13, 0x60, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x2b, 0x1b, 0x33, 0x40, 0x20, 0x2b, 0x0c, 0xd9, 
-	0x01, 0x3c, 0x01, 0x3d, 0x34, 0x40, 0x35, 0x40, 0xac, 0x42, 0xef, 0xd0, 0x1f, 0x20, 0x20, 0x40, 
-	0x01, 0x3c, 0xff, 0xf7, 0x9b, 0xff, 0x34, 0x40, 0xf6, 0xe7, 0x1f, 0x20, 0x20, 0x40, 0x01, 0x34, 
-	0xff, 0xf7, 0x94, 0xff, 0x34, 0x40, 0xa5, 0x42, 0xf7, 0xd1, 0xdf, 0xe7, 0x50, 0x00, 0x00, 0x02, 
-	0xa8, 0x56, 0x00, 0x03, 0x10, 0xb5, 0x05, 0x4b, 0x5b, 0x68, 0x05, 0x4a, 0x58, 0x33, 0x13, 0x60, 
-	0x07, 0xf0, 0xae, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0x50, 0x00, 0x00, 0x02, 
-	0xac, 0x56, 0x00, 0x03, 0x10, 0xb5, 0xff, 0xf7, 0xed, 0xff, 0x07, 0xf0, 0xc5, 0xff, 0xff, 0xf7, 
-	0xb1, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0xb5, 0xff, 0xf7, 0xe3, 0xff, 0xff, 0xf7, 
-	0xa9, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0xb5, 0x03, 0x48, 0x03, 0x49, 0x07, 0xf0, 
-	0x43, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x24, 0xa2, 0x00, 0x08, 0x00, 0x40, 0x00, 0x06, 
-	0x10, 0xb5, 0x40, 0x22, 0x03, 0x49, 0x04, 0x48, 0x07, 0xf0, 0xae, 0xff, 0x10, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0xe0, 0xa8, 0x00, 0x08, 0xa0, 0x00, 0x00, 0x05, 0x00, 0x21, 0x0e, 0x4b, 
-	0x10, 0xb5, 0x19, 0x70, 0x80, 0x23, 0x87, 0x20, 0xdb, 0x04, 0x1a, 0x68, 0x82, 0x43, 0x1a, 0x60, 
-	0x80, 0x22, 0x18, 0x68, 0xd2, 0x00, 0x02, 0x43, 0x1a, 0x60, 0x08, 0x4b, 0x08, 0x4a, 0x1a, 0x80, 
-	0x58, 0x22, 0x08, 0x4b, 0x1a, 0x80, 0x08, 0x4b, 0x19, 0x80, 0xff, 0xf7, 0xcd, 0xff, 0xff, 0xf7, 
-	0xd7, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x96, 0x56, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x04, 
-	0x04, 0x09, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0x04, 0x02, 0x4b, 0x1b, 0x88, 
-	0xdb, 0x43, 0x02, 0x4a, 0x93, 0x60, 0x70, 0x47, 0x30, 0x01, 0x00, 0x04, 0x50, 0x00, 0x00, 0x02, 
-	0xf7, 0xb5, 0x1b, 0x4f, 0x06, 0x00, 0xfc, 0x68, 0x07, 0xf0, 0x66, 0xff, 0x19, 0x4b, 0xbd, 0x68, 
-	0x1b, 0x88, 0x1d, 0x43, 0x01, 0x93, 0xdb, 0x43, 0xed, 0x43, 0xbb, 0x60, 0x00, 0x2e, 0x22, 0xd0, 
-	0x6b, 0x06, 0x05, 0xd5, 0xa0, 0x19, 0x31, 0x00, 0x01, 0x38, 0x07, 0xf0, 0x35, 0xff, 0x0c, 0x00, 
-	0x2b, 0x06, 0x04, 0xd5, 0x60, 0x1c, 0x31, 0x00, 0x07, 0xf0, 0x2e, 0xff, 0x0c, 0x00, 0xeb, 0x06, 
-	0x03, 0xd5, 0x0a, 0x34, 0xa6, 0x42, 0x00, 0xdc, 0x74, 0x1e, 0xab, 0x06, 0x03, 0xd5, 0x0a, 0x3c, 
-	0xe3, 0x43, 0xdb, 0x17, 0x1c, 0x40, 0xc0, 0x23, 0x01, 0x9a, 0x9b, 0x00, 0x1a, 0x42, 0x01, 0xd0, 
-	0x05, 0x4b, 0x1d, 0x40, 0xfc, 0x60, 0x28, 0x00, 0xfe, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 
-	0x50, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04, 0xff, 0xfc, 0xff, 0xff, 0x10, 0xb5, 0x03, 0x07, 
-	0x0b, 0xd4, 0xc3, 0x07, 0x03, 0xd5, 0x15, 0x4b, 0x1b, 0x68, 0xdb, 0x05, 0x05, 0xd5, 0x83, 0x07, 
-	0x09, 0xd5, 0x12, 0x4b, 0x1b, 0x68, 0xdb, 0x05, 0x05, 0xd5, 0x11, 0x4b, 0x11, 0x49, 0x12, 0x4a, 
-	0x02, 0xc3, 0x93, 0x42, 0xfc, 0xd1, 0x43, 0x07, 0x0b, 0xd4, 0xc3, 0x07, 0x03, 0xd5, 0x0b, 0x4b, 
-	0x1b, 0x68, 0xdb, 0x05, 0x05, 0xd4, 0x80, 0x07, 0x08, 0xd5, 0x08, 0x4b, 0x1b, 0x68, 0xdb, 0x05, 
-	0x04, 0xd4, 0x0a, 0x48, 0x0a, 0x4a, 0x0b, 0x49, 0x07, 0xf0, 0xd4, 0xfe, 0x00, 0x22, 0x0a, 0x4b, 
-	0x5a, 0x60, 0xff, 0xf7, 0x41, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xa8, 0x56, 0x00, 0x03, 
-	0xc0, 0x4a, 0x00, 0x06, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x06, 0x10, 0x9a, 0x02, 0x02, 
-	0x76, 0x02, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x50, 0x00, 0x00, 0x02, 0x01, 0x23, 0x10, 0xb5, 
-	0x05, 0x4a, 0x11, 0x78, 0x0b, 0x43, 0x13, 0x70, 0xff, 0xf7, 0x2e, 0xff, 0xff, 0xf7, 0x24, 0xff, 
-	0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0x93, 0x56, 0x00, 0x03, 0x01, 0x21, 0x10, 0xb5, 
-	0x04, 0x4a, 0x13, 0x78, 0x8b, 0x43, 0x13, 0x70, 0xff, 0xf7, 0x16, 0xff, 0x10, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0x93, 0x56, 0x00, 0x03, 0xf7, 0xb5, 0x00, 0x24, 0x08, 0x27, 0x05, 0x00, 
-	0xff, 0xf7, 0xdc, 0xff, 0x0c, 0x4e, 0x33, 0x68, 0x01, 0x93, 0x01, 0x2d, 0x0d, 0xd1, 0x0b, 0x4b, 
-	0x1c, 0x70, 0x01, 0x9a, 0x63, 0x01, 0x9b, 0x18, 0x01, 0x34, 0x33, 0x60, 0xff, 0xf7, 0xf2, 0xfe, 
-	0x09, 0x2c, 0xf2, 0xd1, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x02, 0x2d, 0xf1, 0xd1, 0x03, 0x4b, 
-	0x3a, 0x1b, 0x1a, 0x70, 0xed, 0xe7, 0xc0, 0x46, 0xa8, 0x56, 0x00, 0x03, 0x96, 0x56, 0x00, 0x03, 
-	0xf7, 0xb5, 0x00, 0x24, 0x08, 0x27, 0x05, 0x00, 0xff, 0xf7, 0xb8, 0xff, 0x0d, 0x4e, 0x33, 0x68, 
-	0x01, 0x93, 0x01, 0x2d, 0x10, 0xd1, 0x0c, 0x4b, 0x1c, 0x70, 0x01, 0x9a, 0x63, 0x01, 0xd3, 0x1a, 
-	0x01, 0x34, 0x33, 0x60, 0xff, 0xf7, 0xce, 0xfe, 0x09, 0x2c, 0xf2, 0xd1, 0x04, 0x20, 0xff, 0xf7, 
-	0x65, 0xff, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x02, 0x2d, 0xee, 0xd1, 0x02, 0x4b, 0x3a, 0x1b, 
-	0x1a, 0x70, 0xea, 0xe7, 0xa8, 0x56, 0x00, 0x03, 0x96, 0x56, 0x00, 0x03, 0xf7, 0xb5, 0x00, 0x91, 
-	0x80, 0x21, 0x1f, 0x24, 0x01, 0x93, 0x2c, 0x4b, 0x1b, 0x68, 0x49, 0x00, 0x0b, 0x40, 0xa0, 0x42, 
-	0x1a, 0xdd, 0x00, 0x2b, 0x1a, 0xd1, 0x20, 0x40, 0x1e, 0x24, 0x20, 0x25, 0x23, 0x00, 0x43, 0x43, 
-	0x00, 0x2a, 0x01, 0xd0, 0x80, 0x22, 0x8a, 0x35, 0x44, 0x43, 0x24, 0x49, 0x01, 0x33, 0x65, 0x54, 
-	0x5b, 0x18, 0x00, 0x21, 0x00, 0x98, 0x40, 0x5c, 0x1f, 0x28, 0x36, 0xd8, 0x20, 0x22, 0x1d, 0x29, 
-	0x30, 0xd0, 0x1a, 0x70, 0x01, 0x31, 0xfa, 0xe7, 0x00, 0x2b, 0xe4, 0xd1, 0x1c, 0x4b, 0x04, 0x40, 
-	0xa4, 0x01, 0xe4, 0x18, 0xa0, 0x23, 0x16, 0x07, 0xdb, 0x05, 0xf6, 0x18, 0x36, 0x0c, 0x00, 0x2a, 
-	0x08, 0xdb, 0x00, 0x23, 0x9a, 0x42, 0x03, 0xd0, 0x33, 0x00, 0x55, 0x33, 0x1b, 0x04, 0x1b, 0x0c, 
-	0x23, 0x80, 0x02, 0x34, 0x00, 0x25, 0x04, 0xe0, 0xff, 0xf7, 0xe8, 0xfd, 0x30, 0x18, 0xe0, 0x53, 
-	0x01, 0x35, 0x00, 0x9b, 0x58, 0x5d, 0x6f, 0x00, 0x1f, 0x28, 0x04, 0xd9, 0x1d, 0x2d, 0x02, 0xd0, 
-	0x01, 0x9b, 0x9d, 0x42, 0xf0, 0xdb, 0x1d, 0x22, 0x52, 0x1b, 0x00, 0x21, 0x52, 0x00, 0xe0, 0x19, 
-	0x07, 0xf0, 0x88, 0xfc, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x1d, 0x29, 0xfa, 0xd0, 0x80, 0x18, 
-	0x18, 0x70, 0x01, 0x31, 0x01, 0x33, 0xbd, 0xe7, 0xa8, 0x56, 0x00, 0x03, 0x10, 0x9a, 0x02, 0x02, 
-	0xc0, 0x4a, 0x00, 0x06, 0x10, 0xb5, 0x1d, 0x23, 0xff, 0xf7, 0x98, 0xff, 0x10, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0x1f, 0x23, 0x18, 0x40, 0x06, 0x4b, 0x1b, 0x68, 0x10, 0xb5, 0xdb, 0x05, 0x01, 0xd5, 
-	0x20, 0x23, 0x18, 0x43, 0xff, 0xf7, 0xee, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0xa8, 0x56, 0x00, 0x03, 0x1f, 0x23, 0x18, 0x40, 0x05, 0x4b, 0x1b, 0x68, 0x10, 0xb5, 0xdb, 0x05, 
-	0x01, 0xd4, 0x20, 0x23, 0x18, 0x43, 0xff, 0xf7, 0xdd, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0xa8, 0x56, 0x00, 0x03, 0x01, 0x4b, 0x18, 0x70, 0x70, 0x47, 0xc0, 0x46, 0x96, 0x56, 0x00, 0x03, 
-	0x80, 0x22, 0x02, 0x4b, 0x52, 0x42, 0x02, 0x43, 0x1a, 0x70, 0x70, 0x47, 0x96, 0x56, 0x00, 0x03, 
-	0x70, 0xb5, 0xff, 0xf7, 0x73, 0xfe, 0x0b, 0x25, 0x01, 0x20, 0xff, 0xf7, 0x79, 0xfe, 0x04, 0x00, 
-	0x07, 0xf0, 0xe2, 0xfd, 0x2c, 0x42, 0xf7, 0xd0, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x70, 0xb5, 0x34, 0x4b, 0x34, 0x4c, 0x98, 0x88, 0x22, 0x68, 0x1a, 0x60, 0x04, 0x28, 0x3f, 0xd8, 
-	0x07, 0xf0, 0x06, 0xfa, 0x03, 0x35, 0x40, 0x47, 0x56, 0x00, 0xde, 0x88, 0x11, 0x04, 0x09, 0x0c, 
-	0x10, 0x0c, 0x86, 0x42, 0x25, 0xd1, 0x1d, 0x89, 0x03, 0x2d, 0x15, 0xd8, 0x58, 0x89, 0x00, 0x04, 
-	0x30, 0x43, 0xc0, 0x43, 0x90, 0x42, 0x01, 0xd1, 0x01, 0x35, 0x1d, 0x81, 0x1a, 0x89, 0x03, 0x2a, 
-	0x1a, 0xd8, 0x26, 0x48, 0x52, 0x00, 0x12, 0x5a, 0xc9, 0x43, 0x09, 0x04, 0x09, 0x0c, 0x5a, 0x81, 
-	0xd9, 0x80, 0x13, 0x04, 0x0b, 0x43, 0x05, 0xe0, 0x21, 0x4a, 0x91, 0x42, 0xee, 0xd1, 0x01, 0x22, 
-	0x9a, 0x80, 0x20, 0x4b, 0x23, 0x60, 0x80, 0x23, 0x1f, 0x4a, 0x11, 0x88, 0x0b, 0x43, 0x13, 0x80, 
-	0x2d, 0xe0, 0x00, 0x22, 0x1a, 0x81, 0xe1, 0xe7, 0x80, 0x22, 0x12, 0x02, 0xe4, 0xe7, 0x19, 0x49, 
-	0x8a, 0x42, 0x03, 0xd1, 0x02, 0x22, 0x9a, 0x80, 0x18, 0x4b, 0xeb, 0xe7, 0x04, 0x22, 0x9a, 0x80, 
-	0x00, 0x23, 0xe7, 0xe7, 0x15, 0x49, 0x8a, 0x42, 0xf8, 0xd1, 0x03, 0x22, 0x9a, 0x80, 0x14, 0x4b, 
-	0xe0, 0xe7, 0x14, 0x49, 0x8a, 0x42, 0xf1, 0xd1, 0xda, 0x68, 0x00, 0x2a, 0x01, 0xd0, 0x02, 0x22, 
-	0x1a, 0x61, 0x1a, 0x69, 0x00, 0x2a, 0xf2, 0xd0, 0x01, 0x3a, 0x1a, 0x61, 0x0e, 0x4b, 0xd1, 0xe7, 
-	0x00, 0x22, 0x1a, 0x60, 0xda, 0x60, 0x9a, 0x80, 0x1a, 0x81, 0x5a, 0x81, 0xda, 0x80, 0x70, 0xbc, 
-	0x01, 0xbc, 0x00, 0x47, 0x60, 0x00, 0x00, 0x02, 0x20, 0x01, 0x00, 0x04, 0x9a, 0x95, 0x00, 0x08, 
-	0x02, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x28, 0x01, 0x00, 0x04, 0x13, 0x00, 0x00, 0x20, 
-	0x04, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x30, 0x26, 0x00, 0x00, 0x40, 0x0e, 0x4b, 0x0f, 0x4a, 
-	0x1b, 0x68, 0x93, 0x42, 0x16, 0xd0, 0x0e, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x12, 0xd0, 0x00, 0x22, 
-	0x0c, 0x4b, 0x1a, 0x80, 0x0c, 0x4b, 0x0d, 0x4a, 0x1a, 0x80, 0x80, 0x22, 0x19, 0x88, 0xd2, 0x01, 
-	0x0a, 0x43, 0x01, 0x21, 0x1a, 0x80, 0x1a, 0x88, 0x8a, 0x43, 0x1a, 0x80, 0x80, 0x22, 0x19, 0x88, 
-	0x0a, 0x43, 0x1a, 0x80, 0x70, 0x47, 0xc0, 0x46, 0x60, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x30, 
-	0x08, 0x00, 0x00, 0x02, 0x34, 0x01, 0x00, 0x04, 0x28, 0x01, 0x00, 0x04, 0x08, 0x10, 0x00, 0x00, 
-	0x01, 0x23, 0x03, 0x60, 0x04, 0x20, 0x70, 0x47, 0x00, 0x20, 0x70, 0x47, 0x02, 0x00, 0x00, 0x20, 
-	0x04, 0x29, 0x03, 0xd1, 0x02, 0x4b, 0x12, 0x68, 0x1a, 0x60, 0x01, 0x30, 0x70, 0x47, 0xc0, 0x46, 
-	0x74, 0x00, 0x00, 0x02, 0x00, 0x20, 0x70, 0x47, 0x10, 0xb5, 0x80, 0x24, 0xa4, 0x01, 0x22, 0x00, 
-	0x03, 0x49, 0x07, 0xf0, 0x21, 0xfd, 0x20, 0x00, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 
-	0xa8, 0x57, 0x00, 0x03, 0x10, 0xb5, 0x2c, 0x22, 0x03, 0x49, 0x07, 0xf0, 0x15, 0xfd, 0x2c, 0x20, 
-	0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0xec, 0x56, 0x00, 0x03, 0x10, 0xb5, 0x04, 0x4b, 
-	0xa0, 0x22, 0x19, 0x68, 0x07, 0xf0, 0x08, 0xfd, 0xa0, 0x20, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0xd4, 0x56, 0x00, 0x03, 0x08, 0x4b, 0x0a, 0x00, 0xc9, 0x18, 0x08, 0x4b, 0x10, 0xb5, 0x04, 0x00, 
-	0x00, 0x20, 0x19, 0x42, 0x05, 0xd1, 0x06, 0x4b, 0x21, 0x00, 0x18, 0x00, 0x07, 0xf0, 0xf4, 0xfc, 
-	0x01, 0x20, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 
-	0x00, 0x40, 0x03, 0x02, 0x10, 0xb5, 0x08, 0x4b, 0x1a, 0x78, 0x00, 0x23, 0x9a, 0x42, 0x06, 0xd0, 
-	0xc0, 0x22, 0x06, 0x49, 0xd2, 0x01, 0x07, 0xf0, 0xdf, 0xfc, 0xc0, 0x23, 0xdb, 0x01, 0x18, 0x00, 
-	0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0x0d, 0x56, 0x00, 0x03, 0x00, 0xe0, 0x02, 0x02, 
-	0x10, 0xb5, 0x0a, 0x4b, 0x1b, 0x78, 0x80, 0x22, 0x09, 0x49, 0x00, 0x2b, 0x07, 0xd1, 0x92, 0x01, 
-	0x07, 0xf0, 0xca, 0xfc, 0x80, 0x20, 0x80, 0x01, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xd2, 0x01, 
-	0x07, 0xf0, 0xc2, 0xfc, 0x80, 0x20, 0xc0, 0x01, 0xf6, 0xe7, 0xc0, 0x46, 0x0d, 0x56, 0x00, 0x03, 
-	0x00, 0x40, 0x03, 0x02, 0x10, 0xb5, 0x07, 0x4b, 0x1a, 0x78, 0x00, 0x23, 0x9a, 0x42, 0x04, 0xd0, 
-	0x80, 0x22, 0x05, 0x49, 0x07, 0xf0, 0xb0, 0xfc, 0x80, 0x23, 0x18, 0x00, 0x10, 0xbc, 0x02, 0xbc, 
-	0x08, 0x47, 0xc0, 0x46, 0x0d, 0x56, 0x00, 0x03, 0x7c, 0x78, 0x00, 0x03, 0x80, 0x23, 0x10, 0xb5, 
-	0x0a, 0x00, 0x04, 0x00, 0x9b, 0x01, 0x00, 0x20, 0x99, 0x42, 0x05, 0xd1, 0x04, 0x4b, 0x21, 0x00, 
-	0x18, 0x00, 0x07, 0xf0, 0x99, 0xfc, 0x01, 0x20, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 
-	0xa8, 0x57, 0x00, 0x03, 0xc0, 0x23, 0x10, 0xb5, 0x0a, 0x00, 0x04, 0x00, 0xdb, 0x01, 0x00, 0x20, 
-	0x99, 0x42, 0x05, 0xd1, 0x04, 0x4b, 0x21, 0x00, 0x18, 0x00, 0x07, 0xf0, 0x85, 0xfc, 0x01, 0x20, 
-	0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0x00, 0xe0, 0x02, 0x02, 0x10, 0xb5, 0x0a, 0x00, 
-	0x04, 0x00, 0x00, 0x20, 0x2c, 0x29, 0x05, 0xd1, 0x04, 0x4b, 0x21, 0x00, 0x18, 0x00, 0x07, 0xf0, 
-	0x73, 0xfc, 0x01, 0x20, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0xec, 0x56, 0x00, 0x03, 
-	0x10, 0xb5, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x20, 0x80, 0x29, 0x05, 0xd1, 0x04, 0x4b, 0x21, 0x00, 
-	0x18, 0x00, 0x07, 0xf0, 0x61, 0xfc, 0x01, 0x20, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 
-	0x7c, 0x78, 0x00, 0x03, 0x70, 0xb5, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x20, 0xa0, 0x29, 0x12, 0xd1, 
-	0x0a, 0x4b, 0x0a, 0x00, 0x18, 0x68, 0x29, 0x00, 0x07, 0xf0, 0x4e, 0xfc, 0x08, 0x4b, 0x22, 0x00, 
-	0x18, 0x68, 0x29, 0x00, 0x07, 0xf0, 0x48, 0xfc, 0x06, 0x4b, 0x22, 0x00, 0x18, 0x68, 0x29, 0x00, 
-	0x07, 0xf0, 0x42, 0xfc, 0x01, 0x20, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xd4, 0x56, 0x00, 0x03, 
-	0xd0, 0x56, 0x00, 0x03, 0x64, 0x56, 0x00, 0x03, 0x00, 0x20, 0x70, 0x47, 0x00, 0x20, 0x70, 0x47, 
-	0xf8, 0xb5, 0x04, 0x00, 0x45, 0x18, 0xac, 0x42, 0x03, 0xd3, 0x07, 0xf0, 0xcd, 0xfb, 0x00, 0x20, 
-	0x14, 0xe0, 0x03, 0x23, 0x20, 0x00, 0x61, 0x68, 0x27, 0x68, 0x4c, 0x1e, 0x1c, 0x43, 0x08, 0x30, 
-	0x01, 0x34, 0x04, 0x19, 0xa5, 0x42, 0x16, 0xd3, 0x00, 0x23, 0x0c, 0x4a, 0x16, 0x68, 0xb7, 0x42, 
-	0x07, 0xd0, 0x01, 0x33, 0x04, 0x32, 0x0b, 0x2b, 0xf8, 0xd1, 0x02, 0x20, 0xf8, 0xbc, 0x02, 0xbc, 
-	0x08, 0x47, 0x06, 0x4a, 0x9b, 0x00, 0xd6, 0x18, 0xf3, 0x6a, 0x00, 0xf0, 0x25, 0xf8, 0x00, 0x28, 
-	0xd9, 0xd1, 0x03, 0x20, 0xf2, 0xe7, 0x01, 0x20, 0xf0, 0xe7, 0xc0, 0x46, 0xa4, 0x95, 0x00, 0x08, 
-	0xf8, 0xb5, 0x06, 0x00, 0x04, 0x00, 0x00, 0x25, 0x20, 0x00, 0x0a, 0x4b, 0x5f, 0x59, 0x58, 0x33, 
-	0xeb, 0x58, 0x08, 0x30, 0x00, 0xf0, 0x10, 0xf8, 0x00, 0x28, 0x03, 0xdd, 0x60, 0x60, 0x08, 0x30, 
-	0x27, 0x60, 0x24, 0x18, 0x04, 0x35, 0x2c, 0x2d, 0xee, 0xd1, 0xa0, 0x1b, 0xf8, 0xbc, 0x02, 0xbc, 
-	0x08, 0x47, 0xc0, 0x46, 0xa4, 0x95, 0x00, 0x08, 0x18, 0x47, 0xc0, 0x46, 0x02, 0x00, 0xf0, 0xb5, 
-	0x03, 0x00, 0x03, 0x27, 0x85, 0xb0, 0x10, 0x32, 0x02, 0x92, 0x65, 0x4d, 0x44, 0x1a, 0x02, 0x9a, 
-	0x9a, 0x42, 0x07, 0xd8, 0x63, 0x4b, 0x1b, 0x68, 0x00, 0x2b, 0x01, 0xd0, 0x07, 0xf0, 0xda, 0xfb, 
-	0x00, 0x20, 0x3c, 0xe0, 0x1a, 0x78, 0xaa, 0x5c, 0x0f, 0x26, 0x10, 0x00, 0x30, 0x40, 0x01, 0x90, 
-	0x04, 0x38, 0x0b, 0x28, 0x49, 0xd8, 0x06, 0xf0, 0xe9, 0xff, 0x06, 0x06, 0x36, 0x36, 0x48, 0xed, 
-	0x48, 0x48, 0x48, 0x48, 0x48, 0xed, 0x01, 0x20, 0x5e, 0x1c, 0x76, 0x1a, 0xb4, 0x46, 0x18, 0x56, 
-	0x84, 0x44, 0x64, 0x45, 0x39, 0xdb, 0x06, 0x00, 0x12, 0x36, 0x36, 0xdb, 0x02, 0x30, 0x52, 0x49, 
-	0x1a, 0x18, 0xc8, 0x68, 0x00, 0x0c, 0x0e, 0x69, 0x03, 0x90, 0x88, 0x68, 0x00, 0x21, 0x00, 0x0c, 
-	0x02, 0x90, 0x36, 0x0c, 0x93, 0x42, 0x2c, 0xd8, 0x01, 0x29, 0xcb, 0xd0, 0x01, 0x9a, 0x04, 0x3a, 
-	0x58, 0x1c, 0x01, 0x2a, 0x00, 0xd8, 0x98, 0x1c, 0x01, 0x24, 0x00, 0x21, 0x01, 0x9b, 0x06, 0x3b, 
-	0x1b, 0x06, 0x1b, 0x0e, 0x9c, 0x42, 0x49, 0x41, 0x07, 0xf0, 0x72, 0xfb, 0x20, 0x00, 0x05, 0xb0, 
-	0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x5e, 0x78, 0xb4, 0x46, 0x98, 0x78, 0x00, 0x02, 0x60, 0x44, 
-	0x84, 0x42, 0x0a, 0xdb, 0x5e, 0x1a, 0xb4, 0x46, 0x02, 0x26, 0xb4, 0x44, 0x66, 0x46, 0x80, 0x1b, 
-	0x06, 0x00, 0x12, 0x36, 0x01, 0xdb, 0x03, 0x30, 0xc9, 0xe7, 0x12, 0x09, 0x3a, 0x40, 0x9b, 0x18, 
-	0x9d, 0xe7, 0x33, 0x48, 0x14, 0x78, 0x07, 0x5d, 0x03, 0x24, 0x38, 0x09, 0x20, 0x40, 0x04, 0x1c, 
-	0x00, 0x28, 0x00, 0xd1, 0x01, 0x24, 0x0f, 0x20, 0x24, 0x06, 0x24, 0x0e, 0x38, 0x40, 0xbd, 0x09, 
-	0x7f, 0x2f, 0x00, 0xd9, 0x8e, 0xe7, 0x01, 0x38, 0x0e, 0x28, 0x3e, 0xd8, 0x06, 0xf0, 0x9a, 0xff, 
-	0x0f, 0x00, 0x3d, 0x00, 0x21, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x3d, 0x00, 
-	0x8a, 0xff, 0x2d, 0x00, 0x41, 0x00, 0x45, 0x00, 0x43, 0x00, 0x33, 0x00, 0x8a, 0xff, 0xff, 0x27, 
-	0x50, 0x78, 0x3f, 0x02, 0xc0, 0x19, 0x01, 0x2d, 0x00, 0xd1, 0x02, 0x21, 0x80, 0x25, 0x28, 0x42, 
-	0x17, 0xd1, 0xc0, 0x27, 0x05, 0x06, 0x2d, 0x0e, 0x38, 0x42, 0x28, 0xd1, 0x00, 0x2d, 0x10, 0xd0, 
-	0x68, 0xe7, 0x90, 0x78, 0x57, 0x78, 0x00, 0x02, 0xc0, 0x19, 0x01, 0x2d, 0x00, 0xd1, 0x02, 0x21, 
-	0xff, 0x25, 0x2d, 0x02, 0xa8, 0x42, 0xe9, 0xda, 0x03, 0xe0, 0x01, 0x2d, 0x0f, 0xd0, 0x01, 0x20, 
-	0x01, 0x43, 0x12, 0x19, 0x86, 0xe7, 0x50, 0x78, 0x07, 0x00, 0x40, 0x3f, 0x3f, 0x2f, 0x00, 0xd9, 
-	0x50, 0xe7, 0x07, 0x27, 0x38, 0x40, 0x06, 0x28, 0x07, 0xd0, 0x01, 0x2d, 0xf1, 0xd1, 0x02, 0x21, 
-	0xef, 0xe7, 0x02, 0x98, 0xe1, 0xe7, 0x03, 0x98, 0xdf, 0xe7, 0x30, 0x00, 0xdd, 0xe7, 0x41, 0x3d, 
-	0x15, 0x2d, 0xe6, 0xd8, 0x05, 0x48, 0xe8, 0x40, 0xc0, 0x07, 0xe2, 0xd5, 0x3a, 0xe7, 0xc0, 0x46, 
-	0x28, 0x96, 0x00, 0x08, 0x24, 0x51, 0x00, 0x03, 0xe8, 0x55, 0x00, 0x03, 0x09, 0x00, 0x30, 0x00, 
-	0x09, 0x4b, 0x18, 0x68, 0x80, 0x23, 0x9b, 0x01, 0xc3, 0x18, 0x01, 0x22, 0x10, 0xb5, 0x83, 0x42, 
-	0x00, 0xdb, 0x06, 0x4a, 0xe0, 0x23, 0x1b, 0x05, 0x00, 0x21, 0x01, 0x3a, 0xc0, 0x18, 0x07, 0xf0, 
-	0x49, 0xf9, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x01, 0x20, 0x00, 0x00, 
-	0xf7, 0xb5, 0xe0, 0x21, 0x30, 0x4b, 0x31, 0x4a, 0x09, 0x05, 0x0c, 0x78, 0x1b, 0x78, 0x10, 0x78, 
-	0x2f, 0x4a, 0x1b, 0x02, 0x12, 0x78, 0x1b, 0x19, 0x00, 0x04, 0x1b, 0x18, 0x2d, 0x48, 0x12, 0x06, 
-	0x9b, 0x18, 0x02, 0x78, 0x94, 0x46, 0x2c, 0x4f, 0x3a, 0x78, 0x2c, 0x4e, 0x00, 0x92, 0x2c, 0x4d, 
-	0x34, 0x78, 0x2a, 0x78, 0x01, 0x92, 0x00, 0x9a, 0x12, 0x02, 0x24, 0x04, 0x62, 0x44, 0x12, 0x19, 
-	0x01, 0x9c, 0x24, 0x06, 0x12, 0x19, 0x27, 0x4c, 0x93, 0x42, 0x38, 0xd1, 0x26, 0x4a, 0x9a, 0x18, 
-	0x01, 0x2a, 0x1d, 0xd8, 0x01, 0x22, 0x5a, 0x40, 0x12, 0x06, 0x12, 0x0e, 0x0a, 0x70, 0x00, 0x78, 
-	0x3a, 0x78, 0x36, 0x78, 0x12, 0x02, 0x29, 0x78, 0x12, 0x18, 0x36, 0x04, 0x92, 0x19, 0x09, 0x06, 
-	0x52, 0x18, 0x93, 0x42, 0x09, 0xd0, 0xc0, 0x23, 0xdb, 0x01, 0x23, 0x60, 0xe0, 0x23, 0xd8, 0x22, 
-	0x1b, 0x05, 0x1a, 0x70, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xe0, 0x23, 0x1b, 0x02, 0xf4, 0xe7, 
-	0x0b, 0x78, 0xdb, 0x43, 0x1b, 0x06, 0x1b, 0x0e, 0x0b, 0x70, 0x02, 0x78, 0x0b, 0x78, 0x9a, 0x42, 
-	0x0a, 0xd1, 0xc0, 0x23, 0xdb, 0x01, 0xe0, 0x22, 0x23, 0x60, 0x12, 0x05, 0x13, 0x78, 0xdb, 0x43, 
-	0x1b, 0x06, 0x1b, 0x0e, 0x13, 0x70, 0xe5, 0xe7, 0xe0, 0x23, 0x1b, 0x02, 0xf3, 0xe7, 0xe0, 0x23, 
-	0x1b, 0x02, 0x23, 0x60, 0xde, 0xe7, 0xc0, 0x46, 0x01, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x0e, 
-	0x03, 0x00, 0x00, 0x0e, 0x00, 0x80, 0x00, 0x0e, 0x01, 0x80, 0x00, 0x0e, 0x02, 0x80, 0x00, 0x0e, 
-	0x03, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x28, 0xce, 0x58, 0xa8, 0x11, 0x4b, 0x1a, 0x68, 
-	0x70, 0xb5, 0x00, 0x2a, 0x04, 0xd1, 0x10, 0x49, 0x09, 0x68, 0x19, 0x60, 0x0a, 0x70, 0x5a, 0x60, 
-	0x1c, 0x68, 0x0e, 0x4d, 0x23, 0x68, 0xab, 0x42, 0x10, 0xd0, 0xff, 0xf7, 0x79, 0xff, 0xe0, 0x21, 
-	0x0b, 0x4b, 0x20, 0x00, 0x1a, 0x68, 0x09, 0x05, 0x07, 0xf0, 0xd2, 0xf9, 0x23, 0x68, 0x09, 0x4a, 
-	0x9b, 0x18, 0x01, 0x2b, 0x02, 0xd9, 0x00, 0x23, 0x25, 0x60, 0x63, 0x60, 0x70, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0x78, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x02, 0xd8, 0x31, 0xa7, 0x57, 
-	0x00, 0x00, 0x00, 0x02, 0x28, 0xce, 0x58, 0xa8, 0x70, 0xb5, 0x10, 0x4a, 0x55, 0x68, 0x6a, 0x1e, 
-	0x12, 0x78, 0x0f, 0x4c, 0x54, 0x43, 0x80, 0x22, 0x00, 0x20, 0x0e, 0x4b, 0x1b, 0x68, 0xd2, 0x01, 
-	0x9e, 0x18, 0x9d, 0x42, 0x10, 0xd9, 0x5a, 0x78, 0x19, 0x78, 0x12, 0x02, 0x0a, 0x43, 0x99, 0x78, 
-	0x09, 0x04, 0x11, 0x43, 0xda, 0x78, 0x12, 0x06, 0x0a, 0x43, 0x80, 0x18, 0x80, 0x33, 0x9e, 0x42, 
-	0xef, 0xd1, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x00, 0x19, 0xf7, 0xe7, 0x18, 0x92, 0x02, 0x02, 
-	0x01, 0x01, 0x01, 0x01, 0x20, 0x57, 0x00, 0x03, 0x80, 0x22, 0xd2, 0x01, 0x03, 0x00, 0x10, 0xb5, 
-	0x84, 0x18, 0x00, 0x20, 0x5a, 0x78, 0x19, 0x78, 0x12, 0x02, 0x0a, 0x43, 0x99, 0x78, 0x09, 0x04, 
-	0x11, 0x43, 0xda, 0x78, 0x12, 0x06, 0x0a, 0x43, 0x80, 0x33, 0x80, 0x18, 0x9c, 0x42, 0xf1, 0xd1, 
-	0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x70, 0xb5, 0xfe, 0xf7, 0xca, 0xf9, 0x13, 0x4b, 0x02, 0x68, 
-	0x9a, 0x42, 0x20, 0xd1, 0xc3, 0x68, 0xc3, 0x18, 0x59, 0x1e, 0x09, 0x78, 0x10, 0x4d, 0x82, 0x68, 
-	0x4d, 0x43, 0x80, 0x21, 0x82, 0x18, 0x00, 0x20, 0xc9, 0x01, 0x56, 0x18, 0x93, 0x42, 0x10, 0xd9, 
-	0x51, 0x78, 0x14, 0x78, 0x09, 0x02, 0x21, 0x43, 0x94, 0x78, 0x24, 0x04, 0x0c, 0x43, 0xd1, 0x78, 
-	0x09, 0x06, 0x21, 0x43, 0x40, 0x18, 0x80, 0x32, 0x96, 0x42, 0xef, 0xd1, 0x70, 0xbc, 0x02, 0xbc, 
-	0x08, 0x47, 0x40, 0x19, 0xf7, 0xe7, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xe7, 0x54, 0x52, 0x49, 0x4d, 
-	0x01, 0x01, 0x01, 0x01, 0x10, 0xb5, 0x04, 0x20, 0xff, 0xf7, 0xa8, 0xfa, 0x00, 0x22, 0x09, 0x20, 
-	0x0b, 0x49, 0xff, 0xf7, 0xc7, 0xfb, 0x00, 0x22, 0x0a, 0x20, 0x0a, 0x49, 0xff, 0xf7, 0xc2, 0xfb, 
-	0x00, 0x20, 0xff, 0xf7, 0xf9, 0xfa, 0x5a, 0x24, 0x01, 0x3c, 0x07, 0xf0, 0xc5, 0xf9, 0x00, 0x2c, 
-	0xfa, 0xd1, 0x20, 0x00, 0xff, 0xf7, 0x14, 0xfb, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0xea, 0x9a, 0x00, 0x08, 0x06, 0x9b, 0x00, 0x08, 0x70, 0xb5, 0x0d, 0x00, 0x0a, 0x21, 0x06, 0x00, 
-	0x07, 0xf0, 0x2c, 0xf9, 0x03, 0x00, 0x30, 0x33, 0x04, 0x00, 0x2b, 0x70, 0x30, 0x00, 0x0a, 0x21, 
-	0x07, 0xf0, 0x8a, 0xf9, 0x30, 0x31, 0x20, 0x00, 0x69, 0x70, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0xf8, 0xb5, 0x05, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x26, 0x0a, 0x21, 0x07, 0x00, 0x01, 0x36, 
-	0x07, 0xf0, 0x4e, 0xf9, 0x09, 0x2f, 0xf8, 0xd8, 0x00, 0x23, 0xad, 0x19, 0x2b, 0x70, 0x6e, 0x1e, 
-	0x20, 0x00, 0x0a, 0x21, 0x07, 0xf0, 0x82, 0xf9, 0x01, 0x3e, 0x30, 0x31, 0x20, 0x00, 0x71, 0x70, 
-	0x0a, 0x21, 0x07, 0xf0, 0x3d, 0xf9, 0x27, 0x00, 0x04, 0x00, 0x09, 0x2f, 0xf0, 0xd8, 0x28, 0x00, 
-	0xf8, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x70, 0xb5, 0x0d, 0x00, 0x04, 0x00, 0x07, 0xf0, 0x8c, 0xf8, 
-	0x29, 0x00, 0x20, 0x18, 0xff, 0xf7, 0xd4, 0xff, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xf7, 0xb5, 
-	0x0d, 0x00, 0x04, 0x00, 0x1a, 0x49, 0x16, 0x00, 0x01, 0x93, 0x07, 0xf0, 0x75, 0xf8, 0x28, 0x00, 
-	0x18, 0x49, 0x07, 0xf0, 0xe3, 0xf8, 0x21, 0x00, 0xff, 0xf7, 0xae, 0xff, 0xe1, 0x21, 0x28, 0x00, 
-	0x09, 0x01, 0x07, 0xf0, 0xdb, 0xf8, 0x3c, 0x21, 0x07, 0xf0, 0x3e, 0xf9, 0xe7, 0x1c, 0x08, 0x00, 
-	0x39, 0x00, 0xff, 0xf7, 0xa1, 0xff, 0x28, 0x00, 0x3c, 0x21, 0x07, 0xf0, 0xcf, 0xf8, 0x3c, 0x21, 
-	0x07, 0xf0, 0x32, 0xf9, 0xa7, 0x1d, 0x08, 0x00, 0x39, 0x00, 0xff, 0xf7, 0x95, 0xff, 0x20, 0x00, 
-	0x31, 0x00, 0x0b, 0x30, 0xff, 0xf7, 0xa4, 0xff, 0x04, 0x00, 0x07, 0x49, 0x07, 0xf0, 0x24, 0xf8, 
-	0x01, 0x99, 0xe0, 0x1d, 0xff, 0xf7, 0x9c, 0xff, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x1e, 0x9b, 0x00, 0x08, 0xc0, 0x4b, 0x03, 0x00, 0x2a, 0x9b, 0x00, 0x08, 0xf0, 0xb5, 0x65, 0x4e, 
-	0x8b, 0xb0, 0x09, 0x93, 0x33, 0x68, 0x15, 0x00, 0x01, 0x90, 0x05, 0x91, 0x00, 0x2b, 0x01, 0xd1, 
-	0xff, 0xf7, 0xb4, 0xfe, 0x60, 0x4b, 0x1b, 0x68, 0x00, 0x93, 0x01, 0x9b, 0x02, 0x3b, 0x5a, 0x42, 
-	0x5a, 0x41, 0x2c, 0x68, 0x37, 0x68, 0x03, 0x92, 0x05, 0x9b, 0x00, 0x9a, 0x1b, 0x68, 0x04, 0x37, 
-	0x12, 0x1b, 0x0b, 0x2a, 0x09, 0xdd, 0x0f, 0x2b, 0x07, 0xdd, 0x1a, 0x00, 0x00, 0x9c, 0x0e, 0x3a, 
-	0x0b, 0x3c, 0xa2, 0x42, 0x01, 0xdc, 0x0f, 0x3b, 0x1c, 0x00, 0x00, 0x9b, 0x1b, 0x1b, 0x02, 0x2b, 
-	0x04, 0xdc, 0x00, 0x9b, 0xdc, 0x1e, 0xe3, 0x43, 0xdb, 0x17, 0x1c, 0x40, 0x02, 0x20, 0x2c, 0x60, 
-	0x03, 0x1b, 0x04, 0x93, 0xff, 0xf7, 0xd2, 0xf9, 0x08, 0x23, 0x00, 0x25, 0x02, 0x93, 0x3e, 0x88, 
-	0x00, 0x2e, 0x3a, 0xd1, 0x49, 0x4b, 0x02, 0x9a, 0x1b, 0x68, 0x9b, 0x1a, 0x03, 0x93, 0x00, 0x9b, 
-	0x9d, 0x42, 0x58, 0xd0, 0x46, 0x4f, 0x03, 0x9b, 0x07, 0x9a, 0x06, 0x99, 0x38, 0x00, 0xff, 0xf7, 
-	0x76, 0xff, 0x32, 0x00, 0x39, 0x00, 0x32, 0x20, 0xff, 0xf7, 0xc4, 0xfa, 0x00, 0x2d, 0x04, 0xd0, 
-	0x00, 0x22, 0x33, 0x20, 0x3f, 0x49, 0xff, 0xf7, 0xbd, 0xfa, 0x01, 0x9b, 0x01, 0x2b, 0x4b, 0xd1, 
-	0x04, 0x9b, 0xeb, 0x18, 0x10, 0x2b, 0x08, 0xdc, 0x00, 0x9b, 0x28, 0x1b, 0xea, 0x1a, 0x53, 0x42, 
-	0x5a, 0x41, 0x39, 0x49, 0x22, 0x30, 0xff, 0xf7, 0xad, 0xfa, 0x00, 0x22, 0x20, 0x20, 0x37, 0x49, 
-	0xff, 0xf7, 0xa8, 0xfa, 0x01, 0x35, 0x05, 0x9b, 0x02, 0x9a, 0x1d, 0x60, 0x08, 0x98, 0x2d, 0x4b, 
-	0xda, 0x60, 0x0b, 0xb0, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x7b, 0x88, 0x03, 0x9a, 0x93, 0x42, 
-	0x04, 0xd0, 0x01, 0x9a, 0x03, 0x2a, 0x19, 0xd1, 0x02, 0x2b, 0x17, 0xd0, 0x04, 0x9b, 0xeb, 0x18, 
-	0x02, 0x3b, 0x0e, 0x2b, 0x0a, 0xd8, 0x00, 0x9b, 0xea, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x22, 0x23, 
-	0x39, 0x00, 0x18, 0x1b, 0x40, 0x19, 0x10, 0x31, 0xff, 0xf7, 0x84, 0xfa, 0x00, 0x9b, 0x9d, 0x42, 
-	0x03, 0xd1, 0xbb, 0x68, 0x07, 0x96, 0x06, 0x93, 0x08, 0x97, 0x01, 0x35, 0x02, 0x9b, 0x9b, 0x19, 
-	0x02, 0x93, 0xbf, 0x19, 0x9b, 0xe7, 0x17, 0x4b, 0x99, 0x68, 0x00, 0x29, 0xae, 0xd0, 0x0a, 0x88, 
-	0x17, 0x4f, 0x03, 0x9b, 0x89, 0x68, 0xa1, 0xe7, 0x01, 0x9b, 0x19, 0x49, 0x00, 0x2b, 0x1f, 0xd0, 
-	0x01, 0x9b, 0x18, 0x49, 0x02, 0x2b, 0x1b, 0xd0, 0x01, 0x9b, 0x03, 0x2b, 0xbb, 0xd1, 0x09, 0x9b, 
-	0x03, 0x9a, 0x9e, 0x1a, 0x00, 0x2e, 0x12, 0xdd, 0x0d, 0x4c, 0x13, 0x49, 0x20, 0x00, 0x06, 0xf0, 
-	0x83, 0xff, 0x31, 0x00, 0x20, 0x00, 0xff, 0xf7, 0xf6, 0xfe, 0x10, 0x49, 0x20, 0x00, 0x06, 0xf0, 
-	0x53, 0xff, 0x00, 0x22, 0x21, 0x00, 0x20, 0x20, 0xff, 0xf7, 0x4c, 0xfa, 0xa3, 0xe7, 0x0c, 0x49, 
-	0x00, 0x22, 0xf8, 0xe7, 0x78, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 
-	0x9c, 0x00, 0x00, 0x02, 0x32, 0x9b, 0x00, 0x08, 0x48, 0x9b, 0x00, 0x08, 0x4e, 0x9b, 0x00, 0x08, 
-	0x5a, 0x9b, 0x00, 0x08, 0x66, 0x9b, 0x00, 0x08, 0x72, 0x9b, 0x00, 0x08, 0x82, 0x9b, 0x00, 0x08, 
-	0x89, 0x9b, 0x00, 0x08, 0xf7, 0xb5, 0x15, 0x00, 0x00, 0x90, 0x01, 0x91, 0xff, 0xf7, 0xd6, 0xfd, 
-	0x00, 0x20, 0x01, 0x00, 0x06, 0x00, 0x0c, 0x4f, 0x3a, 0x68, 0x13, 0x1d, 0x92, 0x88, 0x00, 0x2a, 
-	0x03, 0xd1, 0xf9, 0x60, 0xfe, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x5c, 0x88, 0xa4, 0x46, 0x01, 0x9c, 
-	0xa4, 0x45, 0x05, 0xd1, 0x00, 0x9c, 0xa6, 0x42, 0x01, 0xd1, 0x01, 0x20, 0x2b, 0x60, 0x01, 0x36, 
-	0x9b, 0x18, 0x89, 0x18, 0x1a, 0x88, 0xea, 0xe7, 0x78, 0x00, 0x00, 0x02, 0xf0, 0xb5, 0x2d, 0x4e, 
-	0x33, 0x68, 0x04, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x85, 0xb0, 0x00, 0x2b, 0x01, 0xd1, 0xff, 0xf7, 
-	0xad, 0xfd, 0xb3, 0x68, 0x39, 0x00, 0x20, 0x00, 0x03, 0xaa, 0x00, 0x93, 0xff, 0xf7, 0xca, 0xff, 
-	0x01, 0x00, 0x00, 0x2d, 0x43, 0xd1, 0x00, 0x9b, 0x00, 0x2b, 0x00, 0xd0, 0x1d, 0x88, 0xf2, 0x68, 
-	0x33, 0x68, 0x04, 0x32, 0x9a, 0x18, 0x17, 0x00, 0x00, 0x29, 0x01, 0xd0, 0x03, 0x9f, 0x39, 0x88, 
-	0x1d, 0x48, 0x01, 0x90, 0x00, 0x68, 0x84, 0x46, 0x6c, 0x1a, 0x14, 0x19, 0xe3, 0x1a, 0x08, 0x33, 
-	0x00, 0x20, 0x63, 0x45, 0x27, 0xd8, 0x79, 0x18, 0x52, 0x1a, 0x82, 0x42, 0x04, 0xdd, 0x78, 0x19, 
-	0x81, 0x42, 0x01, 0xd0, 0x06, 0xf0, 0xee, 0xfd, 0x00, 0x2d, 0x04, 0xd0, 0x2a, 0x00, 0x38, 0x00, 
-	0x00, 0x99, 0x06, 0xf0, 0xf9, 0xff, 0x01, 0x23, 0x00, 0x25, 0xe0, 0x20, 0x31, 0x68, 0x5b, 0x42, 
-	0x62, 0x1a, 0x25, 0x60, 0x63, 0x60, 0xf2, 0x60, 0x00, 0x05, 0x08, 0x32, 0x06, 0xf0, 0x58, 0xff, 
-	0x01, 0x9b, 0x1a, 0x68, 0xf0, 0x68, 0x09, 0x4b, 0x08, 0x3a, 0x12, 0x1a, 0x29, 0x00, 0xc0, 0x18, 
-	0x06, 0xf0, 0x58, 0xff, 0x01, 0x20, 0x05, 0xb0, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x00, 0x25, 
-	0xbd, 0xe7, 0xc0, 0x46, 0x78, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x0e, 
-	0xf7, 0xb5, 0x00, 0x24, 0x01, 0x94, 0xff, 0xf7, 0x51, 0xfd, 0x1c, 0x4e, 0x23, 0x00, 0x69, 0x46, 
-	0x02, 0x20, 0x01, 0xaa, 0x34, 0x60, 0xff, 0xf7, 0x89, 0xfe, 0x00, 0x9b, 0xa3, 0x42, 0x29, 0xd0, 
-	0x20, 0x00, 0xff, 0xf7, 0xe9, 0xf8, 0xf4, 0x27, 0x00, 0x9d, 0x28, 0x00, 0xff, 0xf7, 0x48, 0xf8, 
-	0x04, 0x23, 0x04, 0x00, 0x18, 0x42, 0x0a, 0xd0, 0x01, 0x22, 0x30, 0x68, 0x11, 0x00, 0xff, 0xf7, 
-	0x7d, 0xff, 0x33, 0x68, 0x6a, 0x1e, 0x9a, 0x42, 0x01, 0xd1, 0x02, 0x3d, 0x35, 0x60, 0x3c, 0x42, 
-	0x05, 0xd0, 0x00, 0x23, 0x69, 0x46, 0x02, 0x20, 0x01, 0xaa, 0xff, 0xf7, 0x67, 0xfe, 0x00, 0x9b, 
-	0x00, 0x2b, 0x02, 0xd0, 0x06, 0x4b, 0x1c, 0x42, 0xde, 0xd0, 0x01, 0xf0, 0xb9, 0xf8, 0x00, 0x20, 
-	0xff, 0xf7, 0xe6, 0xf8, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0x5c, 0x00, 0x00, 0x02, 
-	0x02, 0x03, 0x00, 0x00, 0xf0, 0xb5, 0x00, 0x24, 0x23, 0x4e, 0x33, 0x68, 0x85, 0xb0, 0x00, 0x90, 
-	0x01, 0x93, 0x34, 0x60, 0xfe, 0xf7, 0xc0, 0xff, 0x03, 0x94, 0xff, 0xf7, 0x07, 0xfd, 0x1f, 0x4b, 
-	0x03, 0x20, 0x1c, 0x60, 0x03, 0xaa, 0x00, 0x9b, 0x02, 0xa9, 0xff, 0xf7, 0x3f, 0xfe, 0x02, 0x9b, 
-	0xa3, 0x42, 0x2c, 0xd0, 0x20, 0x00, 0xff, 0xf7, 0x9f, 0xf8, 0x02, 0x9d, 0x28, 0x00, 0xfe, 0xf7, 
-	0xff, 0xff, 0x04, 0x23, 0x04, 0x00, 0x18, 0x42, 0x0c, 0xd0, 0x01, 0x22, 0x13, 0x4f, 0x52, 0x42, 
-	0x01, 0x21, 0x38, 0x68, 0xff, 0xf7, 0x32, 0xff, 0x3b, 0x68, 0x6a, 0x1e, 0x9a, 0x42, 0x01, 0xd1, 
-	0x02, 0x3d, 0x3d, 0x60, 0xf4, 0x23, 0x1c, 0x42, 0x05, 0xd0, 0x03, 0x20, 0x00, 0x9b, 0x03, 0xaa, 
-	0x02, 0xa9, 0xff, 0xf7, 0x1b, 0xfe, 0x0a, 0x4b, 0x1c, 0x42, 0xde, 0xd0, 0xff, 0xf7, 0xd6, 0xfc, 
-	0x00, 0x20, 0xff, 0xf7, 0x9d, 0xf8, 0x01, 0x9b, 0x33, 0x60, 0xfe, 0xf7, 0x85, 0xff, 0x05, 0xb0, 
-	0xf0, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0xa8, 0x56, 0x00, 0x03, 0x5c, 0x00, 0x00, 0x02, 
-	0x02, 0x03, 0x00, 0x00, 0xf7, 0xb5, 0x15, 0x4d, 0x2b, 0x68, 0x14, 0x00, 0x00, 0x90, 0x01, 0x91, 
-	0x00, 0x2b, 0x01, 0xd1, 0xff, 0xf7, 0xba, 0xfc, 0xff, 0xf7, 0xb8, 0xfc, 0x01, 0x20, 0x40, 0x42, 
-	0x08, 0x21, 0x07, 0x00, 0x2a, 0x68, 0x13, 0x1d, 0x92, 0x88, 0x00, 0x2a, 0x03, 0xd1, 0xe9, 0x60, 
-	0xfe, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x5e, 0x88, 0xb4, 0x46, 0x01, 0x9e, 0xb4, 0x45, 0x09, 0xd1, 
-	0xde, 0x68, 0xb4, 0x46, 0x00, 0x9e, 0x01, 0x37, 0xb4, 0x45, 0x03, 0xd1, 0x00, 0x2c, 0x00, 0xd0, 
-	0x23, 0x60, 0x38, 0x00, 0x9b, 0x18, 0x89, 0x18, 0x1a, 0x88, 0xe6, 0xe7, 0x78, 0x00, 0x00, 0x02, 
-	0x02, 0x4b, 0x18, 0x68, 0x80, 0x23, 0x1b, 0x05, 0x18, 0x40, 0x70, 0x47, 0x0c, 0x00, 0x00, 0x02, 
-	0x70, 0xb5, 0x05, 0x00, 0x00, 0x24, 0x08, 0x4b, 0x1b, 0x68, 0xa3, 0x42, 0x05, 0xdc, 0x01, 0x24, 
-	0x64, 0x42, 0x20, 0x00, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x20, 0x00, 0xff, 0xf7, 0xeb, 0xfc, 
-	0xa8, 0x42, 0xf6, 0xd0, 0x01, 0x34, 0xee, 0xe7, 0x14, 0x00, 0x00, 0x02, 0x73, 0xb5, 0x27, 0x4c, 
-	0x23, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0xff, 0xf7, 0x71, 0xfc, 0x25, 0x4b, 0x1b, 0x68, 0x1b, 0x01, 
-	0x38, 0xd5, 0xe0, 0x22, 0x23, 0x68, 0x12, 0x02, 0x9b, 0x18, 0x02, 0x21, 0x00, 0x20, 0x01, 0xaa, 
-	0x23, 0x61, 0xa3, 0x60, 0xff, 0xf7, 0x9e, 0xff, 0x05, 0x1e, 0x06, 0xda, 0x30, 0x22, 0x20, 0x69, 
-	0x1c, 0x49, 0x06, 0xf0, 0xbd, 0xfe, 0xa3, 0x68, 0x01, 0x93, 0x1b, 0x4b, 0x01, 0x99, 0x1b, 0x68, 
-	0x4b, 0x71, 0x1a, 0x4b, 0x18, 0x78, 0x03, 0x23, 0x18, 0x40, 0x19, 0x4b, 0x1a, 0x78, 0x0c, 0x23, 
-	0x10, 0x26, 0x92, 0x00, 0x1a, 0x40, 0x17, 0x4b, 0x1b, 0x78, 0x1b, 0x01, 0x33, 0x40, 0x1a, 0x43, 
-	0x15, 0x4b, 0x1b, 0x78, 0x02, 0x43, 0x5b, 0x01, 0x13, 0x43, 0x8b, 0x71, 0x63, 0x69, 0x8b, 0x60, 
-	0x00, 0x2d, 0x0a, 0xda, 0x00, 0x21, 0x02, 0x22, 0x08, 0x00, 0xff, 0xf7, 0x7f, 0xfe, 0x00, 0x23, 
-	0x23, 0x61, 0xa3, 0x60, 0x73, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xe0, 0x23, 0x20, 0x68, 0x1b, 0x05, 
-	0x08, 0x1a, 0x30, 0x22, 0xc0, 0x18, 0x06, 0xf0, 0x13, 0xfe, 0xf0, 0xe7, 0x78, 0x00, 0x00, 0x02, 
-	0x0c, 0x00, 0x00, 0x02, 0x28, 0x97, 0x00, 0x08, 0xd8, 0x56, 0x00, 0x03, 0x9b, 0x00, 0x00, 0x02, 
-	0x3e, 0x56, 0x00, 0x03, 0x9a, 0x00, 0x00, 0x02, 0x95, 0x56, 0x00, 0x03, 0x10, 0xb5, 0xff, 0xf7, 
-	0x43, 0xfc, 0x03, 0x4b, 0x58, 0x61, 0xff, 0xf7, 0x99, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0x78, 0x00, 0x00, 0x02, 0x00, 0x22, 0x10, 0xb5, 0x04, 0x4b, 0x5a, 0x61, 0xff, 0xf7, 0x8e, 0xff, 
-	0xff, 0xf7, 0x76, 0xfb, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0x78, 0x00, 0x00, 0x02, 
-	0x13, 0x4b, 0x1b, 0x68, 0x13, 0xb5, 0x1b, 0x01, 0x1e, 0xd5, 0x02, 0x21, 0x00, 0x20, 0x01, 0xaa, 
-	0xff, 0xf7, 0x30, 0xff, 0x00, 0x28, 0x17, 0xdb, 0x01, 0x9a, 0x0e, 0x4b, 0x51, 0x79, 0x19, 0x60, 
-	0x93, 0x79, 0x03, 0x24, 0x18, 0x00, 0x0c, 0x49, 0x20, 0x40, 0x08, 0x70, 0x0b, 0x49, 0x98, 0x10, 
-	0x20, 0x40, 0x08, 0x70, 0x0a, 0x49, 0xd8, 0x06, 0xc0, 0x0f, 0x08, 0x70, 0x09, 0x49, 0x5b, 0x11, 
-	0x0b, 0x70, 0x92, 0x68, 0x08, 0x4b, 0x5a, 0x61, 0x13, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x0c, 0x00, 0x00, 0x02, 0xd8, 0x56, 0x00, 0x03, 0x9b, 0x00, 0x00, 0x02, 0x3e, 0x56, 0x00, 0x03, 
-	0x9a, 0x00, 0x00, 0x02, 0x95, 0x56, 0x00, 0x03, 0x78, 0x00, 0x00, 0x02, 0x70, 0xb5, 0x20, 0x4d, 
-	0x20, 0x4c, 0x2b, 0x68, 0x26, 0x00, 0xa3, 0x42, 0x2a, 0xd0, 0xdb, 0x46, 0x1e, 0x4b, 0x18, 0x68, 
-	0xfd, 0xf7, 0x32, 0xfd, 0xc4, 0x22, 0x00, 0x21, 0x1c, 0x48, 0x06, 0xf0, 0xfb, 0xfd, 0xc0, 0x22, 
-	0x00, 0x21, 0x1b, 0x48, 0x06, 0xf0, 0xf6, 0xfd, 0xc0, 0x22, 0x00, 0x21, 0x19, 0x48, 0x06, 0xf0, 
-	0xf1, 0xfd, 0xc0, 0x22, 0x00, 0x21, 0x18, 0x48, 0x06, 0xf0, 0xec, 0xfd, 0x80, 0x22, 0x00, 0x21, 
-	0x16, 0x48, 0x06, 0xf0, 0xe7, 0xfd, 0x01, 0x21, 0x40, 0x22, 0x15, 0x48, 0x49, 0x42, 0x06, 0xf0, 
-	0xe1, 0xfd, 0x01, 0x21, 0x30, 0x22, 0x13, 0x48, 0x49, 0x42, 0x06, 0xf0, 0xdb, 0xfd, 0x2c, 0x60, 
-	0x11, 0x4d, 0x2b, 0x68, 0xb3, 0x42, 0x07, 0xd0, 0xdb, 0x46, 0x9e, 0x22, 0x0f, 0x48, 0x10, 0x49, 
-	0x92, 0x00, 0x06, 0xf0, 0xcf, 0xfd, 0x2c, 0x60, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x14, 0x92, 0x02, 0x02, 0xef, 0xbe, 0xad, 0xde, 0x20, 0x57, 0x00, 0x03, 0x18, 0x96, 0x02, 0x02, 
-	0x9c, 0x97, 0x02, 0x02, 0xdc, 0x96, 0x02, 0x02, 0x5c, 0x98, 0x02, 0x02, 0x1c, 0x99, 0x02, 0x02, 
-	0x9c, 0x99, 0x02, 0x02, 0xdc, 0x99, 0x02, 0x02, 0x0c, 0x9a, 0x02, 0x02, 0x10, 0x9a, 0x02, 0x02, 
-	0x20, 0x20, 0x20, 0x20, 0xf0, 0xb5, 0x1c, 0x00, 0x27, 0x00, 0x85, 0xb0, 0x0a, 0x9b, 0x05, 0x00, 
-	0x0e, 0x00, 0x10, 0x00, 0x30, 0x37, 0x00, 0x2b, 0x23, 0xd1, 0x01, 0x00, 0x2a, 0x00, 0x38, 0x00, 
-	0x06, 0xf0, 0xbe, 0xfd, 0x03, 0x95, 0x03, 0x22, 0x03, 0x9b, 0x33, 0x33, 0x93, 0x43, 0x23, 0x80, 
-	0x15, 0x4b, 0x65, 0x60, 0x1b, 0x68, 0x15, 0x4d, 0xa3, 0x60, 0x66, 0x80, 0x28, 0x68, 0xff, 0xf7, 
-	0xba, 0xfb, 0x13, 0x4b, 0x1b, 0x78, 0xe0, 0x60, 0x10, 0x34, 0x00, 0x2b, 0x10, 0xd0, 0x20, 0x00, 
-	0x10, 0x49, 0x06, 0xf0, 0xc1, 0xfc, 0xff, 0xf7, 0x79, 0xff, 0x05, 0xb0, 0xf0, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0x00, 0x93, 0x3a, 0x00, 0x29, 0x00, 0x03, 0xab, 0xfe, 0xf7, 0xa9, 0xf9, 0xda, 0xe7, 
-	0x28, 0x68, 0xfd, 0xf7, 0x8d, 0xfd, 0x01, 0x00, 0x35, 0x31, 0x0f, 0x22, 0x20, 0x00, 0xff, 0x31, 
-	0x06, 0xf0, 0xe2, 0xfc, 0xe7, 0xe7, 0xc0, 0x46, 0x1c, 0x56, 0x00, 0x03, 0x24, 0x57, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x73, 0xb5, 0x1d, 0x4b, 0x1b, 0x78, 0x04, 0x00, 
-	0x01, 0x2b, 0x32, 0xd0, 0x02, 0x3b, 0x1b, 0x06, 0x00, 0x26, 0x1b, 0x0e, 0x03, 0x2b, 0x03, 0xd8, 
-	0x18, 0x4a, 0x5b, 0x00, 0xd2, 0x18, 0x16, 0x8e, 0x17, 0x4b, 0x9c, 0x42, 0x02, 0xd0, 0xdb, 0x46, 
-	0x80, 0x26, 0xb6, 0x01, 0x15, 0x4d, 0x2b, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0xff, 0xf7, 0x06, 0xfb, 
-	0xe0, 0x22, 0xf0, 0x21, 0x2b, 0x68, 0x49, 0x02, 0x12, 0x02, 0x9a, 0x18, 0x5b, 0x18, 0x2b, 0x61, 
-	0xab, 0x60, 0x6a, 0x60, 0x30, 0x00, 0x00, 0x92, 0x01, 0x21, 0x22, 0x00, 0xff, 0xf7, 0x8a, 0xff, 
-	0x80, 0x20, 0x01, 0x22, 0x00, 0x21, 0x40, 0x02, 0xff, 0xf7, 0x38, 0xfd, 0x00, 0x23, 0x6b, 0x60, 
-	0x2b, 0x61, 0xab, 0x60, 0x76, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x80, 0x26, 0xb6, 0x01, 0xd3, 0xe7, 
-	0x35, 0x57, 0x00, 0x03, 0x28, 0x97, 0x00, 0x08, 0x00, 0x80, 0x03, 0x02, 0x78, 0x00, 0x00, 0x02, 
-	0x26, 0x4b, 0x1a, 0x68, 0x80, 0x23, 0x70, 0xb5, 0x14, 0x00, 0x1b, 0x05, 0x86, 0xb0, 0x1c, 0x40, 
-	0x1a, 0x42, 0x2a, 0xd0, 0x22, 0x4b, 0x9c, 0x69, 0x00, 0x2c, 0x3d, 0xd1, 0x02, 0x26, 0x21, 0x4b, 
-	0x1b, 0x78, 0x33, 0x42, 0x21, 0xd0, 0xff, 0xf7, 0xf7, 0xfa, 0x05, 0x00, 0x31, 0x00, 0x03, 0xaa, 
-	0x20, 0x00, 0xff, 0xf7, 0xff, 0xfd, 0x28, 0x00, 0x01, 0x21, 0x04, 0xaa, 0xff, 0xf7, 0xfa, 0xfd, 
-	0x19, 0x4d, 0x00, 0x28, 0x16, 0xdb, 0x04, 0x98, 0x01, 0x88, 0x2a, 0x00, 0x00, 0x94, 0x30, 0x39, 
-	0x30, 0x30, 0x05, 0xab, 0x05, 0x91, 0xfe, 0xf7, 0x9b, 0xfa, 0x01, 0x34, 0x13, 0x4b, 0x1b, 0x78, 
-	0x03, 0x3b, 0x01, 0x2b, 0x0b, 0xd8, 0xff, 0xf7, 0x9d, 0xfe, 0x20, 0x00, 0x06, 0xb0, 0x70, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0x28, 0x00, 0xff, 0xf7, 0x7f, 0xff, 0x34, 0x00, 0xee, 0xe7, 0x0c, 0x4b, 
-	0x18, 0x68, 0xe0, 0x23, 0x80, 0x22, 0x1b, 0x05, 0x29, 0x00, 0xc0, 0x18, 0x92, 0x01, 0x06, 0xf0, 
-	0x7f, 0xfc, 0xff, 0xf7, 0x7b, 0xfe, 0xe8, 0xe7, 0x00, 0x24, 0xe6, 0xe7, 0x0c, 0x00, 0x00, 0x02, 
-	0x78, 0x00, 0x00, 0x02, 0x34, 0x57, 0x00, 0x03, 0x00, 0x80, 0x03, 0x02, 0x35, 0x57, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x02, 0xf0, 0xb5, 0x7b, 0x4b, 0x1b, 0x68, 0x8b, 0xb0, 0x04, 0x90, 0x00, 0x2b, 
-	0x01, 0xd1, 0xff, 0xf7, 0x7b, 0xfa, 0x00, 0x23, 0x03, 0x93, 0x04, 0x9b, 0x00, 0x25, 0x01, 0x2b, 
-	0x06, 0xd1, 0x75, 0x4b, 0x1b, 0x68, 0x1d, 0x1e, 0x02, 0xd0, 0xff, 0xf7, 0x9d, 0xfa, 0x05, 0x00, 
-	0x80, 0x22, 0x72, 0x4b, 0x1b, 0x68, 0x12, 0x05, 0x13, 0x42, 0x00, 0xd1, 0xb8, 0xe0, 0xe0, 0x22, 
-	0x6c, 0x4c, 0x23, 0x68, 0x12, 0x02, 0x9a, 0x18, 0x62, 0x60, 0xf0, 0x22, 0x52, 0x02, 0x9b, 0x18, 
-	0x23, 0x61, 0xa3, 0x60, 0x04, 0x9b, 0x01, 0x2b, 0x45, 0xd1, 0x69, 0x4b, 0x1f, 0x78, 0x03, 0x2f, 
-	0x00, 0xd0, 0x86, 0xe0, 0x28, 0x00, 0x04, 0x99, 0x08, 0xaa, 0xff, 0xf7, 0x8b, 0xfd, 0x05, 0x90, 
-	0x00, 0x28, 0x00, 0xda, 0x98, 0xe0, 0x26, 0x69, 0x30, 0x22, 0x30, 0x00, 0x08, 0x99, 0x06, 0xf0, 
-	0xa7, 0xfc, 0x32, 0x00, 0x80, 0x26, 0x63, 0x68, 0x36, 0x02, 0x31, 0x00, 0x00, 0x93, 0x30, 0x32, 
-	0x09, 0xab, 0x5c, 0x48, 0xfe, 0xf7, 0xac, 0xf8, 0x00, 0x21, 0x09, 0x9b, 0x61, 0x60, 0x33, 0x33, 
-	0xa4, 0x68, 0xbb, 0x43, 0xe5, 0x60, 0x23, 0x80, 0x66, 0x60, 0x04, 0x9a, 0x05, 0x98, 0x08, 0x94, 
-	0xff, 0xf7, 0x74, 0xfc, 0x05, 0x00, 0xff, 0xf7, 0x61, 0xfe, 0x00, 0x2d, 0x00, 0xd0, 0x73, 0xe0, 
-	0xff, 0xf7, 0xc0, 0xfa, 0x03, 0x9b, 0x00, 0x2b, 0x05, 0xd1, 0x20, 0x88, 0xff, 0xf7, 0x0a, 0xfd, 
-	0x04, 0x9b, 0x03, 0x93, 0xa5, 0xe7, 0x00, 0x20, 0x46, 0x4b, 0x18, 0x61, 0x98, 0x60, 0x0b, 0xb0, 
-	0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x02, 0x21, 0x00, 0x20, 0x07, 0xaa, 0xff, 0xf7, 0x4a, 0xfd, 
-	0x06, 0x00, 0x00, 0x2e, 0x58, 0xdb, 0x07, 0x9f, 0xb8, 0x68, 0x00, 0x28, 0x54, 0xd0, 0x01, 0x21, 
-	0x08, 0xaa, 0xff, 0xf7, 0x3f, 0xfd, 0x05, 0x1e, 0x54, 0xdb, 0x26, 0x69, 0x30, 0x22, 0x08, 0x99, 
-	0x30, 0x00, 0x06, 0xf0, 0x5d, 0xfc, 0x3c, 0x4b, 0x18, 0x68, 0xe0, 0x23, 0x32, 0x00, 0x80, 0x21, 
-	0x1b, 0x05, 0xc0, 0x18, 0x63, 0x68, 0x30, 0x32, 0x00, 0x93, 0x89, 0x01, 0x09, 0xab, 0xfe, 0xf7, 
-	0x5f, 0xf8, 0x03, 0x22, 0x09, 0x9b, 0xa4, 0x68, 0x33, 0x33, 0x93, 0x43, 0x23, 0x80, 0xbb, 0x68, 
-	0xe3, 0x60, 0x80, 0x23, 0x9b, 0x01, 0x28, 0x00, 0x00, 0x21, 0x63, 0x60, 0x02, 0x3a, 0x08, 0x94, 
-	0xff, 0xf7, 0x24, 0xfc, 0x05, 0x00, 0xff, 0xf7, 0x11, 0xfe, 0x00, 0x2d, 0x1d, 0xd1, 0xff, 0xf7, 
-	0x71, 0xfa, 0x03, 0x9b, 0x00, 0x2b, 0xb6, 0xd1, 0x20, 0x88, 0xff, 0xf7, 0xbb, 0xfc, 0x01, 0x23, 
-	0x52, 0xe7, 0x02, 0x21, 0x00, 0x20, 0x07, 0xaa, 0xff, 0xf7, 0x04, 0xfd, 0x63, 0x69, 0x06, 0x00, 
-	0xab, 0x42, 0xb6, 0xd1, 0x20, 0x4b, 0x18, 0x68, 0xe0, 0x23, 0x80, 0x22, 0x1b, 0x05, 0x1d, 0x49, 
-	0xc0, 0x18, 0x92, 0x01, 0x06, 0xf0, 0xa4, 0xfb, 0xab, 0xe7, 0x02, 0x21, 0x00, 0x20, 0x07, 0xaa, 
-	0xff, 0xf7, 0xf0, 0xfc, 0xff, 0xf7, 0xa6, 0xfd, 0x00, 0x22, 0x12, 0x4b, 0x1a, 0x61, 0x9a, 0x60, 
-	0x01, 0x20, 0x94, 0xe7, 0x00, 0x23, 0xb8, 0x68, 0x23, 0x61, 0xa3, 0x60, 0xff, 0xf7, 0x18, 0xfd, 
-	0x00, 0x28, 0xf1, 0xdb, 0x11, 0x4d, 0x10, 0x4b, 0x2e, 0x68, 0x28, 0x60, 0x18, 0x68, 0xe0, 0x23, 
-	0x1b, 0x05, 0xc0, 0x18, 0xff, 0xf7, 0x78, 0xfe, 0x2e, 0x60, 0x00, 0x28, 0xe2, 0xd1, 0xff, 0xf7, 
-	0x31, 0xfa, 0x03, 0x9b, 0x00, 0x2b, 0x00, 0xd0, 0x75, 0xe7, 0xa3, 0x68, 0x08, 0x93, 0x18, 0x88, 
-	0xbb, 0xe7, 0xc0, 0x46, 0x78, 0x00, 0x00, 0x02, 0x20, 0x57, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x02, 
-	0x35, 0x57, 0x00, 0x03, 0x00, 0x80, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x24, 0x57, 0x00, 0x03, 
-	0x37, 0xb5, 0x02, 0x25, 0x1d, 0x4b, 0x1b, 0x78, 0x2b, 0x42, 0x2d, 0xd0, 0xff, 0xf7, 0xa4, 0xf9, 
-	0x29, 0x00, 0x04, 0x00, 0x01, 0xaa, 0x00, 0x20, 0xff, 0xf7, 0xac, 0xfc, 0x00, 0x28, 0x06, 0xdb, 
-	0x01, 0x9b, 0x9b, 0x68, 0x9c, 0x42, 0x02, 0xd0, 0x00, 0x20, 0xff, 0xf7, 0xe3, 0xfe, 0x14, 0x4d, 
-	0x2b, 0x78, 0x02, 0x2b, 0x1b, 0xd8, 0x13, 0x4b, 0x18, 0x68, 0xe0, 0x23, 0x80, 0x22, 0x1b, 0x05, 
-	0x11, 0x49, 0xc0, 0x18, 0x92, 0x01, 0x06, 0xf0, 0x43, 0xfb, 0x01, 0x21, 0x20, 0x00, 0x01, 0xaa, 
-	0xff, 0xf7, 0x90, 0xfc, 0x00, 0x28, 0x02, 0xda, 0x0b, 0x48, 0xff, 0xf7, 0x2d, 0xfe, 0x2b, 0x78, 
-	0x02, 0x2b, 0x07, 0xd8, 0xff, 0xf7, 0x32, 0xfd, 0x37, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xff, 0xf7, 
-	0x39, 0xfd, 0xea, 0xe7, 0x01, 0x20, 0xff, 0xf7, 0xbd, 0xfe, 0xf5, 0xe7, 0x34, 0x57, 0x00, 0x03, 
-	0x35, 0x57, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x02, 0x00, 0x23, 0xf0, 0xb5, 
-	0x47, 0x4c, 0x23, 0x60, 0x47, 0x4b, 0x1f, 0x68, 0x80, 0x23, 0x5b, 0x02, 0xfd, 0x18, 0x87, 0xb0, 
-	0x28, 0x00, 0x67, 0x60, 0xe5, 0x61, 0xfe, 0xf7, 0xa3, 0xff, 0x02, 0x90, 0x00, 0x28, 0x0b, 0xd1, 
-	0xe0, 0x61, 0x20, 0x61, 0xa0, 0x60, 0x60, 0x60, 0xff, 0xf7, 0x58, 0xfd, 0x02, 0x9d, 0x28, 0x00, 
-	0x07, 0xb0, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xe6, 0x69, 0x02, 0x9b, 0xf6, 0x18, 0x33, 0x00, 
-	0x38, 0x33, 0x03, 0x93, 0x26, 0x61, 0xa6, 0x60, 0x28, 0x00, 0x03, 0x9a, 0x02, 0x99, 0x04, 0xab, 
-	0x00, 0x97, 0xfd, 0xf7, 0x7d, 0xff, 0x03, 0x23, 0x04, 0x9d, 0x01, 0x3d, 0x1d, 0x43, 0x6b, 0x1c, 
-	0x73, 0x63, 0x02, 0x9b, 0x33, 0x63, 0x2e, 0x00, 0x03, 0x9b, 0x21, 0x69, 0x09, 0x36, 0x9a, 0x19, 
-	0x52, 0x1a, 0xe0, 0x69, 0x06, 0xf0, 0x78, 0xfb, 0x00, 0x21, 0xe2, 0x69, 0xe1, 0x61, 0x2a, 0x49, 
-	0x23, 0x69, 0xa2, 0x60, 0x22, 0x61, 0x0c, 0x78, 0x39, 0x35, 0x00, 0x2c, 0x1e, 0xd0, 0x03, 0x3c, 
-	0x61, 0x1e, 0x8c, 0x41, 0x25, 0x49, 0x64, 0x42, 0x0c, 0x40, 0x80, 0x21, 0x9b, 0x1a, 0xf6, 0x1a, 
-	0x03, 0x9b, 0x09, 0x02, 0x9e, 0x19, 0x64, 0x18, 0x32, 0x00, 0x21, 0x00, 0x05, 0xab, 0x20, 0x48, 
-	0x00, 0x97, 0xfd, 0xf7, 0x4d, 0xff, 0x03, 0x22, 0x05, 0x9b, 0x01, 0x3b, 0x13, 0x43, 0x59, 0x1c, 
-	0x32, 0x1f, 0x08, 0x3e, 0x11, 0x60, 0x09, 0x33, 0x34, 0x60, 0x5d, 0x19, 0x00, 0x23, 0x14, 0x4f, 
-	0xbe, 0x68, 0x73, 0x80, 0x02, 0x9b, 0x1c, 0x19, 0x16, 0x4b, 0x1b, 0x68, 0x35, 0x80, 0xb3, 0x60, 
-	0x74, 0x60, 0xff, 0xf7, 0xf1, 0xf8, 0x14, 0x4b, 0x1b, 0x78, 0xf0, 0x60, 0x10, 0x36, 0x00, 0x2b, 
-	0x09, 0xd0, 0x30, 0x00, 0x11, 0x49, 0x06, 0xf0, 0x37, 0xfa, 0x00, 0x23, 0xfb, 0x61, 0x7b, 0x60, 
-	0xff, 0xf7, 0xec, 0xfc, 0x93, 0xe7, 0x0e, 0x4b, 0x18, 0x68, 0xfd, 0xf7, 0x09, 0xfb, 0x01, 0x00, 
-	0x35, 0x31, 0x0f, 0x22, 0x30, 0x00, 0xff, 0x31, 0x06, 0xf0, 0x5e, 0xfa, 0xed, 0xe7, 0xc0, 0x46, 
-	0x78, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x02, 0x35, 0x57, 0x00, 0x03, 0x00, 0xa0, 0xff, 0xff, 
-	0x00, 0x80, 0x03, 0x02, 0x1c, 0x56, 0x00, 0x03, 0x10, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 
-	0x24, 0x57, 0x00, 0x03, 0xf7, 0xb5, 0x00, 0x24, 0x01, 0x94, 0xff, 0xf7, 0x57, 0xff, 0x20, 0x4b, 
-	0x01, 0x38, 0x98, 0x42, 0x04, 0xd9, 0xff, 0xf7, 0x25, 0xf9, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0xff, 0xf7, 0x84, 0xf8, 0x1b, 0x4d, 0x23, 0x00, 0x69, 0x46, 0x01, 0xaa, 0x01, 0x20, 0x2c, 0x60, 
-	0xff, 0xf7, 0xbc, 0xf9, 0x20, 0x00, 0xfe, 0xf7, 0x1f, 0xfc, 0x01, 0x26, 0x04, 0x27, 0x00, 0x98, 
-	0xfe, 0xf7, 0x7e, 0xfb, 0x04, 0x00, 0x30, 0x42, 0x08, 0xd0, 0x00, 0x22, 0x28, 0x68, 0x11, 0x00, 
-	0xff, 0xf7, 0xb4, 0xfa, 0x00, 0x28, 0x01, 0xd1, 0xff, 0xf7, 0x04, 0xf9, 0x3c, 0x42, 0x04, 0xd0, 
-	0x00, 0x22, 0x31, 0x00, 0x28, 0x68, 0xff, 0xf7, 0xa9, 0xfa, 0xf4, 0x23, 0x1c, 0x42, 0x05, 0xd0, 
-	0x00, 0x23, 0x69, 0x46, 0x30, 0x00, 0x01, 0xaa, 0xff, 0xf7, 0x98, 0xf9, 0x06, 0x4b, 0x1c, 0x42, 
-	0xdd, 0xd0, 0x00, 0xf0, 0xed, 0xfb, 0x00, 0x20, 0xfe, 0xf7, 0x1a, 0xfc, 0xc5, 0xe7, 0xc0, 0x46, 
-	0xbe, 0xdf, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x21, 0x4b, 0x1b, 0x68, 
-	0x13, 0xb5, 0x1b, 0x01, 0x21, 0xd5, 0x00, 0x24, 0x80, 0x22, 0x1f, 0x4b, 0x1c, 0x60, 0x1f, 0x4b, 
-	0x52, 0x00, 0x03, 0x20, 0x1a, 0x60, 0xfe, 0xf7, 0x81, 0xfb, 0xfe, 0xf7, 0xbf, 0xfb, 0xfe, 0xf7, 
-	0xeb, 0xfa, 0x22, 0x00, 0x09, 0x20, 0x1a, 0x49, 0xfe, 0xf7, 0x9c, 0xfc, 0x01, 0x20, 0xfe, 0xf7, 
-	0xd3, 0xfb, 0xff, 0xf7, 0xf3, 0xfe, 0xa0, 0x42, 0x02, 0xd0, 0x16, 0x4b, 0x98, 0x42, 0x07, 0xdd, 
-	0xff, 0xf7, 0xc0, 0xf8, 0x02, 0x20, 0xfe, 0xf7, 0xeb, 0xfb, 0x13, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0xff, 0xf7, 0x4a, 0xf8, 0x21, 0x00, 0x01, 0xaa, 0xff, 0xf7, 0x54, 0xfb, 0x00, 0x28, 0x01, 0xda, 
-	0x80, 0x20, 0x40, 0x02, 0x00, 0x22, 0x11, 0x00, 0xff, 0xf7, 0x58, 0xfa, 0x00, 0x28, 0x01, 0xd1, 
-	0xff, 0xf7, 0xa8, 0xf8, 0x02, 0x20, 0xfe, 0xf7, 0xd3, 0xfb, 0x03, 0x20, 0xfe, 0xf7, 0x4e, 0xfb, 
-	0xe3, 0xe7, 0xc0, 0x46, 0x0c, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x02, 0xa8, 0x56, 0x00, 0x03, 
-	0xa2, 0x9b, 0x00, 0x08, 0xbf, 0xdf, 0x00, 0x00, 0xf0, 0xb5, 0x44, 0x4c, 0x23, 0x68, 0x89, 0xb0, 
-	0x0f, 0x00, 0x02, 0x90, 0x00, 0x2b, 0x01, 0xd1, 0xfe, 0xf7, 0xf0, 0xff, 0x40, 0x4b, 0x02, 0x9a, 
-	0x1b, 0x68, 0x93, 0x42, 0x0e, 0xd0, 0x01, 0x23, 0x00, 0x26, 0x3e, 0x4d, 0xa3, 0x61, 0x2b, 0x78, 
-	0x03, 0x93, 0x3d, 0x4b, 0x10, 0x00, 0x19, 0x68, 0x2e, 0x70, 0x06, 0xf0, 0x29, 0xfa, 0x03, 0x9b, 
-	0xa6, 0x61, 0x2b, 0x70, 0x38, 0x00, 0x3b, 0x6b, 0x04, 0x93, 0x38, 0x4b, 0x7c, 0x6b, 0x19, 0x78, 
-	0x38, 0x30, 0x3a, 0x88, 0x05, 0x19, 0x00, 0x29, 0x11, 0xd1, 0x23, 0x00, 0x38, 0x33, 0x93, 0x42, 
-	0x08, 0xd1, 0x80, 0x23, 0x04, 0x9a, 0x5b, 0x02, 0x9a, 0x42, 0x03, 0xd8, 0x02, 0x91, 0x03, 0x91, 
-	0x9c, 0x42, 0x1f, 0xd9, 0x00, 0x20, 0x09, 0xb0, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x2b, 0x68, 
-	0x02, 0x93, 0x6b, 0x68, 0x03, 0x93, 0x23, 0x00, 0x03, 0x99, 0x40, 0x33, 0x5b, 0x18, 0x93, 0x42, 
-	0xf0, 0xd1, 0x80, 0x23, 0x04, 0x9a, 0x5b, 0x02, 0x9a, 0x42, 0xeb, 0xd8, 0x9c, 0x42, 0xe9, 0xd8, 
-	0x80, 0x23, 0x02, 0x9a, 0x1b, 0x02, 0x9a, 0x42, 0xe4, 0xd8, 0x89, 0x23, 0x1b, 0x02, 0x99, 0x42, 
-	0xe0, 0xd8, 0x08, 0x35, 0x04, 0x9b, 0x02, 0x9a, 0x23, 0x43, 0x13, 0x43, 0x03, 0x9a, 0x13, 0x43, 
-	0x19, 0x00, 0x03, 0x22, 0x11, 0x40, 0x05, 0x91, 0x13, 0x42, 0xd3, 0xd1, 0xe0, 0x23, 0x13, 0x4e, 
-	0x32, 0x68, 0x1b, 0x02, 0xd2, 0x18, 0xf2, 0x61, 0x06, 0xab, 0x00, 0x91, 0x21, 0x00, 0x06, 0x94, 
-	0xfd, 0xf7, 0x76, 0xff, 0x02, 0x9b, 0x00, 0x2b, 0x08, 0xd0, 0x05, 0x9b, 0x28, 0x00, 0x00, 0x93, 
-	0x0f, 0x4a, 0x03, 0x99, 0x07, 0xab, 0x07, 0x94, 0xfd, 0xf7, 0x6a, 0xff, 0x04, 0x99, 0xf0, 0x69, 
-	0xfe, 0xf7, 0xc6, 0xfd, 0x00, 0x23, 0xf3, 0x61, 0x98, 0x42, 0xb3, 0xd1, 0x09, 0x4b, 0xba, 0x68, 
-	0x1a, 0x60, 0xff, 0xf7, 0xf5, 0xfd, 0x38, 0x88, 0xad, 0xe7, 0xc0, 0x46, 0x78, 0x00, 0x00, 0x02, 
-	0x24, 0x57, 0x00, 0x03, 0x4d, 0x57, 0x00, 0x03, 0x28, 0x57, 0x00, 0x03, 0x35, 0x57, 0x00, 0x03, 
-	0x00, 0x80, 0x03, 0x02, 0x1c, 0x56, 0x00, 0x03, 0x0a, 0x4b, 0x1b, 0x68, 0x07, 0xb5, 0x1b, 0x01, 
-	0x0c, 0xd5, 0xfe, 0xf7, 0x89, 0xff, 0x00, 0x21, 0x01, 0xaa, 0xff, 0xf7, 0x93, 0xfa, 0x00, 0x28, 
-	0x04, 0xdb, 0x05, 0x4b, 0x01, 0x99, 0x18, 0x68, 0xff, 0xf7, 0x56, 0xff, 0x03, 0xb0, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0x0c, 0x00, 0x00, 0x02, 0x24, 0x57, 0x00, 0x03, 0xf0, 0xb5, 0x00, 0x24, 
-	0x85, 0xb0, 0x02, 0x94, 0xfe, 0xf7, 0x42, 0xff, 0x32, 0x4f, 0x23, 0x00, 0x20, 0x00, 0x02, 0xaa, 
-	0x03, 0xa9, 0x3c, 0x60, 0xff, 0xf7, 0x7a, 0xf8, 0x03, 0x9b, 0x05, 0x00, 0xa3, 0x42, 0x47, 0xd0, 
-	0x20, 0x00, 0xfe, 0xf7, 0xd9, 0xfa, 0x03, 0x9e, 0x30, 0x00, 0xfe, 0xf7, 0x39, 0xfa, 0x01, 0x22, 
-	0x01, 0x23, 0x04, 0x00, 0x02, 0x40, 0x18, 0x42, 0x3e, 0xd0, 0x00, 0x26, 0xeb, 0x68, 0x01, 0x93, 
-	0x30, 0x00, 0xfe, 0xf7, 0x90, 0xff, 0x01, 0x9b, 0x98, 0x42, 0x05, 0xd1, 0x30, 0x00, 0x29, 0x00, 
-	0x80, 0x26, 0xff, 0xf7, 0x21, 0xff, 0xb6, 0x01, 0x1f, 0x4b, 0x1b, 0x68, 0x01, 0x36, 0xb3, 0x42, 
-	0xee, 0xdc, 0x80, 0x23, 0x9b, 0x01, 0x9e, 0x42, 0x0d, 0xda, 0x02, 0x20, 0xfe, 0xf7, 0x56, 0xfa, 
-	0x00, 0x22, 0x29, 0x20, 0x19, 0x49, 0xfe, 0xf7, 0x5d, 0xfb, 0x3c, 0x26, 0x01, 0x3e, 0x06, 0xf0, 
-	0x7b, 0xf9, 0x00, 0x2e, 0xfa, 0xd1, 0xf4, 0x23, 0x1c, 0x42, 0x06, 0xd0, 0x00, 0x23, 0x02, 0xaa, 
-	0x18, 0x00, 0x03, 0xa9, 0xff, 0xf7, 0x3a, 0xf8, 0x05, 0x00, 0x03, 0x9b, 0x00, 0x2b, 0x02, 0xd0, 
-	0x0f, 0x4b, 0x1c, 0x42, 0xbf, 0xd0, 0x00, 0xf0, 0x8b, 0xfa, 0x00, 0x20, 0xfe, 0xf7, 0xb8, 0xfa, 
-	0x05, 0xb0, 0xf0, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x04, 0x23, 0x18, 0x42, 0xe3, 0xd0, 0x01, 0x21, 
-	0x38, 0x68, 0xff, 0xf7, 0x2b, 0xf9, 0x3b, 0x68, 0x72, 0x1e, 0x9a, 0x42, 0xdb, 0xd1, 0x02, 0x3e, 
-	0x3e, 0x60, 0xd8, 0xe7, 0x5c, 0x00, 0x00, 0x02, 0x14, 0x00, 0x00, 0x02, 0xb7, 0x9b, 0x00, 0x08, 
-	0x03, 0x03, 0x00, 0x00, 0x10, 0xb5, 0x0f, 0x48, 0x0f, 0x49, 0x03, 0x78, 0x0a, 0x68, 0x0f, 0x4c, 
-	0x01, 0x33, 0x1b, 0x06, 0x1b, 0x0e, 0x14, 0x43, 0x03, 0x70, 0x0c, 0x60, 0x01, 0x2b, 0x07, 0xd1, 
-	0x9a, 0x43, 0x80, 0x23, 0x5b, 0x02, 0x13, 0x43, 0x0b, 0x60, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0x02, 0x2b, 0x03, 0xd1, 0x06, 0x4b, 0x1a, 0x40, 0x01, 0x23, 0xf4, 0xe7, 0x00, 0x23, 0x03, 0x70, 
-	0xf3, 0xe7, 0xc0, 0x46, 0x98, 0x00, 0x00, 0x02, 0x10, 0x3d, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 
-	0xff, 0xff, 0xfe, 0xff, 0x10, 0xb5, 0x0f, 0x48, 0x0f, 0x49, 0x43, 0x78, 0x0a, 0x68, 0x0f, 0x4c, 
-	0x01, 0x33, 0x1b, 0x06, 0x1b, 0x0e, 0x14, 0x43, 0x43, 0x70, 0x0c, 0x60, 0x01, 0x2b, 0x08, 0xd1, 
-	0x01, 0x33, 0x9a, 0x43, 0x80, 0x23, 0x9b, 0x02, 0x13, 0x43, 0x0b, 0x60, 0x10, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0x02, 0x2b, 0x02, 0xd1, 0x06, 0x48, 0x02, 0x40, 0xf5, 0xe7, 0x00, 0x23, 0x43, 0x70, 
-	0xf4, 0xe7, 0xc0, 0x46, 0x98, 0x00, 0x00, 0x02, 0x10, 0x3d, 0x00, 0x03, 0x02, 0x00, 0x02, 0x00, 
-	0xff, 0xff, 0xfd, 0xff, 0x04, 0x4a, 0x13, 0x78, 0x01, 0x33, 0x1b, 0x06, 0x1b, 0x0e, 0x02, 0x2b, 
-	0x00, 0xd9, 0x00, 0x23, 0x13, 0x70, 0x70, 0x47, 0x3f, 0x56, 0x00, 0x03, 0x01, 0x23, 0x02, 0x4a, 
-	0x11, 0x78, 0x8b, 0x43, 0x13, 0x70, 0x70, 0x47, 0x00, 0x3c, 0x00, 0x03, 0x80, 0x23, 0x03, 0x4a, 
-	0x11, 0x68, 0xdb, 0x00, 0x4b, 0x40, 0x13, 0x60, 0x70, 0x47, 0xc0, 0x46, 0x10, 0x3d, 0x00, 0x03, 
-	0x01, 0x23, 0x02, 0x4a, 0x91, 0x78, 0x8b, 0x43, 0x93, 0x70, 0x70, 0x47, 0x98, 0x00, 0x00, 0x02, 
-	0x03, 0x21, 0x03, 0x4a, 0x13, 0x78, 0x01, 0x33, 0x0b, 0x40, 0x13, 0x70, 0x70, 0x47, 0xc0, 0x46, 
-	0x3e, 0x56, 0x00, 0x03, 0x02, 0x4a, 0x13, 0x78, 0x59, 0x42, 0x4b, 0x41, 0x13, 0x70, 0x70, 0x47, 
-	0x3d, 0x56, 0x00, 0x03, 0x03, 0x21, 0x03, 0x4a, 0x13, 0x78, 0x01, 0x33, 0x0b, 0x40, 0x13, 0x70, 
-	0x70, 0x47, 0xc0, 0x46, 0x94, 0x56, 0x00, 0x03, 0x02, 0x4a, 0x13, 0x78, 0x59, 0x42, 0x4b, 0x41, 
-	0x13, 0x70, 0x70, 0x47, 0x4d, 0x57, 0x00, 0x03, 0x10, 0xb5, 0x08, 0x4a, 0x13, 0x78, 0x01, 0x33, 
-	0x1b, 0x06, 0x1b, 0x0e, 0x04, 0x2b, 0x00, 0xd9, 0x00, 0x23, 0x13, 0x70, 0x01, 0x22, 0x04, 0x4b, 
-	0x1a, 0x70, 0x06, 0xf0, 0x2d, 0xf8, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x95, 0x56, 0x00, 0x03, 
-	0x4c, 0x57, 0x00, 0x03, 0x10, 0xb5, 0xff, 0xf7, 0xa9, 0xf9, 0x01, 0x20, 0xfe, 0xf7, 0xc4, 0xf9, 
-	0xfd, 0xf7, 0xe6, 0xf9, 0x10, 0xb5, 0x07, 0x4c, 0x20, 0x78, 0x03, 0x21, 0x01, 0x30, 0x06, 0xf0, 
-	0x6b, 0xf8, 0x00, 0x29, 0x00, 0xd1, 0x01, 0x31, 0x21, 0x70, 0x06, 0xf0, 0x45, 0xf8, 0x10, 0xbc, 
-	0x01, 0xbc, 0x00, 0x47, 0x3c, 0x56, 0x00, 0x03, 0x10, 0xb5, 0x07, 0x4a, 0x13, 0x78, 0x01, 0x33, 
-	0x1b, 0x06, 0x1b, 0x0e, 0x03, 0x2b, 0x00, 0xd9, 0x00, 0x23, 0x13, 0x70, 0x06, 0xf0, 0x5c, 0xf8, 
-	0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0xea, 0x56, 0x00, 0x03, 0x0f, 0x4a, 0xd3, 0x78, 
-	0x01, 0x33, 0x1b, 0x06, 0x1b, 0x0e, 0xd3, 0x70, 0x01, 0x2b, 0x03, 0xd1, 0x0c, 0x4b, 0x0d, 0x4a, 
-	0x1a, 0x60, 0x70, 0x47, 0x02, 0x2b, 0x02, 0xd1, 0x09, 0x4b, 0x0b, 0x4a, 0xf8, 0xe7, 0x03, 0x2b, 
-	0x03, 0xd1, 0xfe, 0x22, 0x06, 0x4b, 0xd2, 0x05, 0xf2, 0xe7, 0x03, 0x2b, 0xf1, 0xd9, 0x04, 0x4b, 
-	0x06, 0x49, 0x19, 0x60, 0x00, 0x23, 0xd3, 0x70, 0xeb, 0xe7, 0xc0, 0x46, 0x98, 0x00, 0x00, 0x02, 
-	0x60, 0x57, 0x00, 0x03, 0xa0, 0x8c, 0x00, 0x00, 0xe0, 0xa5, 0x01, 0x00, 0x50, 0x46, 0x00, 0x00, 
-	0x00, 0x20, 0x70, 0x47, 0x70, 0x47, 0x70, 0xb5, 0x04, 0x00, 0x07, 0x48, 0x16, 0x00, 0x07, 0x4d, 
-	0x81, 0x42, 0x01, 0xd0, 0x05, 0xf0, 0x40, 0xff, 0x31, 0x00, 0x28, 0x1d, 0x05, 0xf0, 0x14, 0xff, 
-	0x20, 0x00, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x9c, 0x00, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 
-	0x10, 0xb5, 0x04, 0x00, 0x09, 0x4b, 0x1a, 0x68, 0x12, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x08, 0x4b, 
-	0x58, 0x6a, 0xc3, 0x0f, 0x1b, 0x18, 0x20, 0x00, 0x5b, 0x10, 0x0a, 0x30, 0xc0, 0x1a, 0x05, 0x49, 
-	0xfe, 0xf7, 0xf8, 0xf9, 0x60, 0x1c, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x5c, 0x00, 0x00, 0x02, 
-	0x98, 0x00, 0x00, 0x02, 0x9c, 0x00, 0x00, 0x02, 0x10, 0xb5, 0xff, 0xf7, 0xcc, 0xff, 0xff, 0xf7, 
-	0xdf, 0xff, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x10, 0xb5, 0x04, 0x00, 0x06, 0x4b, 0x1a, 0x68, 
-	0x12, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x05, 0x49, 0x25, 0x30, 0xfe, 0xf7, 0xdb, 0xf9, 0x60, 0x1c, 
-	0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0x5c, 0x00, 0x00, 0x02, 0x9c, 0x00, 0x00, 0x02, 
-	0x10, 0xb5, 0xff, 0xf7, 0xb0, 0xff, 0xff, 0xf7, 0xe7, 0xff, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0x70, 0xb5, 0x01, 0x25, 0x02, 0x20, 0xfe, 0xf7, 0xb9, 0xf8, 0x00, 0x22, 0x20, 0x20, 0x24, 0x49, 
-	0xfe, 0xf7, 0xc0, 0xf9, 0x23, 0x4b, 0x1b, 0x78, 0x23, 0x4c, 0x9b, 0x00, 0x1a, 0x59, 0x23, 0x49, 
-	0x00, 0x20, 0xff, 0xf7, 0xe5, 0xff, 0x22, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 0xe3, 0x18, 0xda, 0x68, 
-	0x20, 0x49, 0xff, 0xf7, 0xdd, 0xff, 0x20, 0x4e, 0xf3, 0x78, 0x9b, 0x00, 0xe3, 0x18, 0x9a, 0x69, 
-	0x1e, 0x49, 0xff, 0xf7, 0xd5, 0xff, 0x1e, 0x4b, 0x1b, 0x68, 0x9b, 0x0a, 0x2b, 0x40, 0x9b, 0x00, 
-	0xe3, 0x18, 0xda, 0x68, 0x1b, 0x49, 0xff, 0xf7, 0xcb, 0xff, 0xb3, 0x78, 0x2b, 0x40, 0x9b, 0x00, 
-	0xe3, 0x18, 0xda, 0x68, 0x18, 0x49, 0xff, 0xf7, 0xc3, 0xff, 0x18, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 
-	0xe3, 0x18, 0x9a, 0x6a, 0x16, 0x49, 0xff, 0xf7, 0xbb, 0xff, 0x16, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 
-	0xe3, 0x18, 0xda, 0x68, 0x14, 0x49, 0xff, 0xf7, 0xb3, 0xff, 0x14, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 
-	0xe4, 0x18, 0x13, 0x49, 0xe2, 0x68, 0xff, 0xf7, 0xab, 0xff, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0xcd, 0x9b, 0x00, 0x08, 0x3f, 0x56, 0x00, 0x03, 0x60, 0x97, 0x00, 0x08, 0xe3, 0x9b, 0x00, 0x08, 
-	0x00, 0x3c, 0x00, 0x03, 0xeb, 0x9b, 0x00, 0x08, 0x98, 0x00, 0x00, 0x02, 0xf7, 0x9b, 0x00, 0x08, 
-	0x10, 0x3d, 0x00, 0x03, 0x03, 0x9c, 0x00, 0x08, 0x0e, 0x9c, 0x00, 0x08, 0x3e, 0x56, 0x00, 0x03, 
-	0x1f, 0x9c, 0x00, 0x08, 0x4d, 0x57, 0x00, 0x03, 0x2a, 0x9c, 0x00, 0x08, 0x3d, 0x56, 0x00, 0x03, 
-	0x3c, 0x9c, 0x00, 0x08, 0x10, 0xb5, 0x02, 0x20, 0xfe, 0xf7, 0x48, 0xf8, 0x00, 0x22, 0x20, 0x20, 
-	0x0f, 0x49, 0xfe, 0xf7, 0x4f, 0xf9, 0x0f, 0x4a, 0x12, 0x68, 0x0f, 0x4b, 0x92, 0x00, 0xd2, 0x58, 
-	0x0e, 0x49, 0x00, 0x20, 0xff, 0xf7, 0x74, 0xff, 0x0d, 0x4b, 0x1b, 0x78, 0x0d, 0x4c, 0x9b, 0x00, 
-	0xe3, 0x18, 0x9a, 0x6b, 0x0c, 0x49, 0xff, 0xf7, 0x6b, 0xff, 0x0c, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 
-	0xe4, 0x18, 0x0b, 0x49, 0xe2, 0x6c, 0xff, 0xf7, 0x63, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0x4e, 0x9c, 0x00, 0x08, 0xd8, 0x56, 0x00, 0x03, 0x18, 0x98, 0x00, 0x08, 0x65, 0x9c, 0x00, 0x08, 
-	0x95, 0x56, 0x00, 0x03, 0x60, 0x97, 0x00, 0x08, 0x6f, 0x9c, 0x00, 0x08, 0x94, 0x56, 0x00, 0x03, 
-	0x77, 0x9c, 0x00, 0x08, 0x10, 0xb5, 0x02, 0x20, 0xfe, 0xf7, 0x10, 0xf8, 0x00, 0x22, 0x20, 0x20, 
-	0x0d, 0x49, 0xfe, 0xf7, 0x17, 0xf9, 0x0d, 0x4b, 0x1b, 0x78, 0x01, 0x3b, 0x5a, 0x42, 0x53, 0x41, 
-	0x0b, 0x4c, 0x9b, 0x00, 0xe3, 0x18, 0xda, 0x6d, 0x0a, 0x49, 0x00, 0x20, 0xff, 0xf7, 0x38, 0xff, 
-	0x09, 0x4b, 0x1b, 0x78, 0x9b, 0x00, 0xe4, 0x18, 0x08, 0x49, 0x62, 0x6e, 0xff, 0xf7, 0x30, 0xff, 
-	0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 0x8c, 0x9c, 0x00, 0x08, 0x3c, 0x56, 0x00, 0x03, 
-	0x60, 0x97, 0x00, 0x08, 0xa0, 0x9c, 0x00, 0x08, 0xea, 0x56, 0x00, 0x03, 0xaf, 0x9c, 0x00, 0x08, 
-	0x10, 0xb5, 0x04, 0x00, 0x09, 0x4b, 0x1a, 0x68, 0x12, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x08, 0x4b, 
-	0x58, 0x6a, 0xc3, 0x0f, 0x1b, 0x18, 0x20, 0x00, 0x5b, 0x10, 0x0a, 0x30, 0xc0, 0x1a, 0xfe, 0xf7, 
-	0xe1, 0xf8, 0x60, 0x1c, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0xc0, 0x46, 0x5c, 0x00, 0x00, 0x02, 
-	0x98, 0x00, 0x00, 0x02, 0x10, 0xb5, 0x04, 0x00, 0x05, 0x4b, 0x1a, 0x68, 0x12, 0x1a, 0x53, 0x42, 
-	0x5a, 0x41, 0x25, 0x30, 0xfe, 0xf7, 0xce, 0xf8, 0x60, 0x1c, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0x5c, 0x00, 0x00, 0x02, 0x70, 0xb5, 0x04, 0x00, 0x15, 0x00, 0x88, 0x42, 0x01, 0xd0, 0x05, 0xf0, 
-	0xeb, 0xfd, 0x29, 0x00, 0x20, 0x00, 0x05, 0xf0, 0xbf, 0xfd, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 
-	0xf7, 0xb5, 0x2a, 0x4e, 0x33, 0x68, 0x01, 0x20, 0x01, 0x93, 0xfd, 0xf7, 0xa7, 0xff, 0x28, 0x4d, 
-	0xab, 0x6a, 0x5a, 0x1c, 0x3c, 0xd0, 0x33, 0x60, 0x26, 0x4b, 0x1b, 0x78, 0x26, 0x4c, 0x9b, 0x00, 
-	0xe3, 0x18, 0x2f, 0x1d, 0x5a, 0x6f, 0x38, 0x00, 0x24, 0x49, 0xff, 0xf7, 0xdb, 0xff, 0x00, 0x22, 
-	0x39, 0x00, 0x12, 0x20, 0xfe, 0xf7, 0x9e, 0xf8, 0x00, 0x22, 0x13, 0x20, 0x20, 0x49, 0xfe, 0xf7, 
-	0x99, 0xf8, 0x6b, 0x78, 0x9b, 0x00, 0xe3, 0x18, 0xda, 0x68, 0x1e, 0x49, 0x00, 0x20, 0xff, 0xf7, 
-	0xa3, 0xfe, 0x2b, 0x78, 0x9b, 0x00, 0xe4, 0x18, 0xe2, 0x68, 0x1b, 0x49, 0xff, 0xf7, 0x9c, 0xfe, 
-	0x1a, 0x49, 0xff, 0xf7, 0x95, 0xff, 0x1a, 0x49, 0xff, 0xf7, 0x92, 0xff, 0x19, 0x49, 0xff, 0xf7, 
-	0x8f, 0xff, 0x6b, 0x6a, 0x18, 0x4c, 0x08, 0x2b, 0x0d, 0xd1, 0x21, 0x00, 0xff, 0xf7, 0x88, 0xff, 
-	0x16, 0x49, 0xff, 0xf7, 0x85, 0xff, 0x16, 0x49, 0xff, 0xf7, 0x82, 0xff, 0x01, 0x9b, 0x33, 0x60, 
-	0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x13, 0x49, 0xff, 0xf7, 0x7a, 0xff, 0x12, 0x49, 0xff, 0xf7, 
-	0x77, 0xff, 0x12, 0x49, 0xff, 0xf7, 0x74, 0xff, 0xe7, 0xe7, 0xc0, 0x46, 0x5c, 0x00, 0x00, 0x02, 
-	0x98, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x60, 0x97, 0x00, 0x08, 0xc3, 0x9c, 0x00, 0x08, 
-	0xdb, 0x9c, 0x00, 0x08, 0xf3, 0x9c, 0x00, 0x08, 0x00, 0x9d, 0x00, 0x08, 0x0d, 0x9d, 0x00, 0x08, 
-	0x17, 0x9d, 0x00, 0x08, 0x28, 0x9d, 0x00, 0x08, 0x36, 0x9d, 0x00, 0x08, 0x64, 0x9d, 0x00, 0x08, 
-	0x6c, 0x9d, 0x00, 0x08, 0x3c, 0x9d, 0x00, 0x08, 0x49, 0x9d, 0x00, 0x08, 0x56, 0x9d, 0x00, 0x08, 
-	0xf0, 0xb5, 0x00, 0x24, 0x20, 0x4e, 0x83, 0x00, 0x20, 0x4d, 0xf3, 0x18, 0x9b, 0x68, 0x85, 0xb0, 
-	0x2c, 0x60, 0x02, 0x93, 0x01, 0x90, 0x00, 0xf0, 0xf9, 0xf9, 0x20, 0x00, 0xfd, 0xf7, 0x84, 0xff, 
-	0x1b, 0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x1b, 0x4a, 0x13, 0x60, 0x01, 0x9b, 0xf3, 0x18, 0x1b, 0x7f, 
-	0x03, 0x93, 0x03, 0x98, 0xfd, 0xf7, 0xdc, 0xfe, 0x01, 0x23, 0x04, 0x00, 0x18, 0x42, 0x09, 0xd0, 
-	0x01, 0x9b, 0x9b, 0x00, 0x2f, 0x68, 0xf3, 0x18, 0x5b, 0x6a, 0xba, 0x00, 0xd3, 0x58, 0x00, 0xf0, 
-	0xdd, 0xf9, 0x2f, 0x60, 0x10, 0x4b, 0x1c, 0x42, 0x02, 0xd0, 0x02, 0x9b, 0x00, 0xf0, 0xd6, 0xf9, 
-	0x0e, 0x4f, 0x3c, 0x42, 0xe5, 0xd0, 0xff, 0xf7, 0x53, 0xff, 0x00, 0x20, 0xfd, 0xf7, 0x80, 0xff, 
-	0x3c, 0x42, 0x03, 0xd1, 0x05, 0xb0, 0xf0, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x05, 0xf0, 0x24, 0xfe, 
-	0x03, 0x4b, 0x1c, 0x88, 0xe4, 0x43, 0xf3, 0xe7, 0xe0, 0x97, 0x00, 0x08, 0x5c, 0x00, 0x00, 0x02, 
-	0x30, 0x01, 0x00, 0x04, 0x58, 0x00, 0x00, 0x02, 0xf1, 0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 
-	0x10, 0xb5, 0x02, 0x20, 0xff, 0xf7, 0xac, 0xff, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0xb5, 
-	0x00, 0x20, 0xfe, 0xf7, 0x0f, 0xf8, 0x03, 0x20, 0xff, 0xf7, 0xa2, 0xff, 0x08, 0x20, 0xfe, 0xf7, 
-	0x09, 0xf8, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0xb5, 0x04, 0x20, 0xff, 0xf7, 0x98, 0xff, 
-	0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x70, 0xb5, 0x16, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 0x25, 0xd0, 
-	0x15, 0x4c, 0x16, 0x49, 0x20, 0x00, 0x16, 0x4d, 0x05, 0xf0, 0xf6, 0xfc, 0x05, 0xf0, 0xa8, 0xfd, 
-	0x82, 0x06, 0x92, 0x0f, 0x30, 0x32, 0x01, 0x00, 0x2a, 0x76, 0x0f, 0x22, 0x11, 0x40, 0x30, 0x31, 
-	0x69, 0x76, 0x01, 0x13, 0x11, 0x40, 0x30, 0x31, 0xe9, 0x76, 0x01, 0x12, 0x11, 0x40, 0x30, 0x31, 
-	0x29, 0x77, 0x01, 0x15, 0x00, 0x14, 0x11, 0x40, 0x10, 0x40, 0x00, 0x22, 0x30, 0x31, 0x30, 0x30, 
-	0xa9, 0x77, 0xe8, 0x77, 0x21, 0x00, 0x10, 0x00, 0xfd, 0xf7, 0xac, 0xff, 0x70, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0xc0, 0x46, 0x40, 0x00, 0x00, 0x02, 0x9c, 0x00, 0x00, 0x02, 0x71, 0x9d, 0x00, 0x08, 
-	0x98, 0x00, 0x00, 0x02, 0x4e, 0x4b, 0xf7, 0xb5, 0x1d, 0x68, 0x80, 0x23, 0x01, 0x24, 0x00, 0x26, 
-	0x4c, 0x4f, 0x1b, 0x05, 0x9d, 0x42, 0xad, 0x41, 0xbe, 0x62, 0xfd, 0xf7, 0xc7, 0xfe, 0x21, 0x00, 
-	0x49, 0x4b, 0x1b, 0x68, 0x1a, 0x0c, 0x91, 0x43, 0x0a, 0x00, 0x21, 0x00, 0xa2, 0x40, 0x99, 0x43, 
-	0x0a, 0x43, 0x21, 0x00, 0x3a, 0x70, 0x5a, 0x0c, 0x91, 0x43, 0xe3, 0x40, 0x0a, 0x00, 0x21, 0x00, 
-	0x99, 0x43, 0x0b, 0x00, 0xa2, 0x40, 0x13, 0x43, 0x7b, 0x70, 0x40, 0x4b, 0x6d, 0x42, 0x5b, 0x19, 
-	0x1b, 0x7f, 0x3f, 0x4a, 0x7b, 0x62, 0x3f, 0x4b, 0x1e, 0x60, 0x13, 0x88, 0x00, 0x93, 0x16, 0x80, 
-	0x3d, 0x4a, 0x13, 0x88, 0x01, 0x93, 0x3d, 0x4b, 0x16, 0x80, 0x1e, 0x60, 0xbe, 0x62, 0xff, 0xf7, 
-	0xaf, 0xfe, 0x20, 0x00, 0xfd, 0xf7, 0xdc, 0xfe, 0x20, 0x00, 0xff, 0xf7, 0x8b, 0xf8, 0x04, 0x00, 
-	0xb0, 0x42, 0x05, 0xd1, 0xff, 0xf7, 0xa4, 0xfe, 0x35, 0x4b, 0x1c, 0x60, 0xfd, 0xf7, 0xbc, 0xfd, 
-	0x34, 0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x34, 0x4a, 0x13, 0x60, 0xff, 0xf7, 0x7c, 0xff, 0x29, 0x4e, 
-	0x70, 0x6a, 0xfd, 0xf7, 0x05, 0xfe, 0x01, 0x23, 0x2c, 0x4f, 0x3a, 0x68, 0x04, 0x00, 0xb2, 0x62, 
-	0x18, 0x42, 0x16, 0xd0, 0x25, 0x4b, 0xa9, 0x00, 0x5b, 0x18, 0x5b, 0x6a, 0x92, 0x00, 0xd3, 0x58, 
-	0x00, 0xf0, 0x04, 0xf9, 0x80, 0x22, 0xb3, 0x6a, 0x3b, 0x60, 0x1d, 0x4b, 0x1b, 0x68, 0x12, 0x05, 
-	0x93, 0x42, 0x9b, 0x41, 0x5b, 0x42, 0xab, 0x42, 0x03, 0xd0, 0x00, 0x23, 0x01, 0x25, 0x3b, 0x60, 
-	0xb3, 0x62, 0xf1, 0x23, 0x1c, 0x42, 0x01, 0xd0, 0xff, 0xf7, 0x72, 0xfe, 0x1f, 0x4b, 0x1c, 0x42, 
-	0xd3, 0xd0, 0x1f, 0x4b, 0x1b, 0x68, 0x00, 0x2b, 0x01, 0xd1, 0xfe, 0xf7, 0xf1, 0xff, 0xfe, 0xf7, 
-	0x55, 0xfe, 0x02, 0x20, 0xfd, 0xf7, 0x70, 0xfe, 0x02, 0x25, 0x2c, 0x42, 0x11, 0xd1, 0x00, 0x9a, 
-	0x0f, 0x4b, 0x1a, 0x80, 0x01, 0x9a, 0x10, 0x4b, 0x03, 0x20, 0x1a, 0x80, 0xfd, 0xf7, 0x06, 0xfe, 
-	0xfd, 0xf7, 0x54, 0xfe, 0x01, 0x22, 0x07, 0x4b, 0x52, 0x42, 0x9a, 0x62, 0xf7, 0xbc, 0x01, 0xbc, 
-	0x00, 0x47, 0x05, 0xf0, 0x29, 0xfd, 0x0b, 0x4b, 0x1c, 0x88, 0xe4, 0x43, 0xe5, 0xe7, 0xc0, 0x46, 
-	0x0c, 0x00, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 0x10, 0x3d, 0x00, 0x03, 0xe0, 0x97, 0x00, 0x08, 
-	0x80, 0x00, 0x00, 0x04, 0x40, 0x56, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x5c, 0x00, 0x00, 0x02, 
-	0xa8, 0x56, 0x00, 0x03, 0x30, 0x01, 0x00, 0x04, 0x58, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 
-	0x8c, 0x00, 0x00, 0x02, 0x10, 0xb5, 0x07, 0x24, 0x20, 0x00, 0xfd, 0xf7, 0x0b, 0xff, 0x05, 0xf0, 
-	0x03, 0xfd, 0x01, 0x3c, 0xf8, 0xd2, 0x00, 0x24, 0x20, 0x00, 0x01, 0x34, 0xfd, 0xf7, 0x08, 0xff, 
-	0x05, 0xf0, 0xfa, 0xfc, 0x11, 0x2c, 0xf7, 0xd1, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0xb5, 
-	0xfe, 0xf7, 0x04, 0xfe, 0xff, 0xf7, 0xe6, 0xff, 0x80, 0x23, 0x80, 0x22, 0xdb, 0x04, 0x1a, 0x60, 
-	0x00, 0x23, 0x05, 0x4a, 0x13, 0x80, 0x05, 0x4a, 0x13, 0x80, 0x05, 0x4a, 0x13, 0x80, 0x05, 0xf0, 
-	0x87, 0xfc, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x04, 
-	0x50, 0x00, 0x00, 0x04, 0x10, 0xb5, 0xff, 0xf7, 0xcd, 0xff, 0x05, 0xf0, 0xad, 0xfc, 0x07, 0x20, 
-	0xfd, 0xf7, 0xd8, 0xfe, 0x05, 0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x9b, 0x05, 0x02, 0xd1, 0x10, 0xbc, 
-	0x01, 0xbc, 0x00, 0x47, 0x05, 0xf0, 0xc8, 0xfc, 0xf4, 0xe7, 0xc0, 0x46, 0x30, 0x01, 0x00, 0x04, 
-	0x70, 0xb5, 0x14, 0x4e, 0x14, 0x4b, 0x32, 0x68, 0x1a, 0x60, 0x05, 0xf0, 0x51, 0xfc, 0x05, 0xf0, 
-	0x6b, 0xfc, 0x05, 0xf0, 0x45, 0xfc, 0x02, 0x20, 0xfd, 0xf7, 0x88, 0xfd, 0x34, 0x68, 0x0a, 0x3c, 
-	0x4a, 0x2c, 0x12, 0xdd, 0x4a, 0x24, 0x20, 0x25, 0x32, 0x68, 0x12, 0x1b, 0x53, 0x42, 0x5a, 0x41, 
-	0x0a, 0x4b, 0xa1, 0x00, 0x28, 0x00, 0x59, 0x58, 0x01, 0x35, 0xfd, 0xf7, 0x83, 0xfe, 0x01, 0x34, 
-	0x34, 0x2d, 0xf1, 0xd1, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xe3, 0x43, 0xdb, 0x17, 0x1c, 0x40, 
-	0xe9, 0xe7, 0xc0, 0x46, 0x5c, 0x00, 0x00, 0x02, 0xd8, 0x56, 0x00, 0x03, 0x18, 0x98, 0x00, 0x08, 
-	0x70, 0xb5, 0x00, 0x20, 0xfd, 0xf7, 0x96, 0xfe, 0x12, 0x4a, 0x13, 0x4b, 0x12, 0x68, 0x13, 0x4d, 
-	0x1a, 0x60, 0xff, 0xf7, 0xc5, 0xff, 0x2b, 0x88, 0xdb, 0x43, 0xf0, 0x26, 0x10, 0x4a, 0x13, 0x60, 
-	0x5e, 0x20, 0xfd, 0xf7, 0x15, 0xfd, 0x04, 0x00, 0x30, 0x42, 0x01, 0xd0, 0xff, 0xf7, 0xb8, 0xff, 
-	0x0c, 0x4b, 0x1c, 0x42, 0xf4, 0xd0, 0x0c, 0x4b, 0x1c, 0x42, 0x05, 0xd1, 0x08, 0x20, 0xfd, 0xf7, 
-	0x79, 0xfe, 0x70, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x05, 0xf0, 0x6e, 0xfc, 0x2c, 0x88, 0xe4, 0x43, 
-	0xf1, 0xe7, 0xc0, 0x46, 0xd8, 0x56, 0x00, 0x03, 0x5c, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04, 
-	0x58, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x18, 0x47, 0xc0, 0x46, 
-	0xf1, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe3, 0x0f, 0xe0, 0xa0, 0x11, 0x10, 0xf0, 0x9f, 0x15, 
-	0x01, 0x90, 0x89, 0xe2, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x7c, 0x46, 0x00, 0x08, 0x02, 0x01, 0x13, 0xe3, 0x0f, 0x00, 0x00, 0x1a, 
-	0x04, 0x02, 0xa0, 0xe1, 0x06, 0x02, 0x90, 0xe2, 0x03, 0x02, 0xb0, 0x31, 0x06, 0x44, 0x94, 0x22, 
-	0x02, 0x32, 0x83, 0x23, 0x06, 0x02, 0x94, 0xe2, 0x83, 0x01, 0xb0, 0x31, 0x06, 0x42, 0x94, 0x22, 
-	0x02, 0x32, 0x83, 0x23, 0x05, 0x32, 0xc3, 0xe3, 0xff, 0x04, 0x14, 0xe3, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x02, 0x13, 0xe3, 0x06, 0x44, 0x44, 0x12, 0x02, 0x02, 0x13, 0xe3, 0x06, 0x42, 0x44, 0x12, 
-	0xf3, 0xff, 0xff, 0xea, 0x01, 0xb8, 0x4b, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0x0c, 0xa0, 0xe1, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0xff, 0x00, 0x0c, 0xe2, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x03, 0x31, 0xa0, 0xe3, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x58, 0x05, 0xe2, 0x00, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x04, 0xa0, 0xe1, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 0x20, 0x54, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x60, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x04, 0xa0, 0xe1, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x64, 0x06, 0xe2, 0x20, 0x64, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x78, 0x07, 0xe2, 0x00, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x04, 0xa0, 0xe1, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x0c, 0xa0, 0xe1, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x00, 0x90, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x04, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0x20, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x04, 0x40, 0x94, 0xe0, 
-	0x02, 0x32, 0x83, 0x23, 0x01, 0x44, 0x94, 0x23, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x0c, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x58, 0x05, 0xe2, 0x00, 0x5c, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x05, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x08, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 0x00, 0x58, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x0c, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x6c, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x06, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x08, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x64, 0x06, 0xe2, 0x00, 0x68, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x0c, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x78, 0x07, 0xe2, 0x00, 0x7c, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x07, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa0, 0x08, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x74, 0x07, 0xe2, 0x00, 0x78, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x30, 0xa0, 0xe3, 
-	0xa0, 0x00, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x00, 0x90, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 
-	0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa4, 0x4c, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x40, 0x94, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0x04, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x0c, 0xa0, 0xe1, 0x02, 0x02, 0x13, 0xe3, 
-	0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0x20, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0x02, 0x45, 0x84, 0x13, 0x04, 0x40, 0x94, 0xe0, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 
-	0x60, 0x00, 0xa0, 0xe1, 0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x58, 0x05, 0xe2, 0x00, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x23, 0x3f, 0xb0, 0xe1, 0x60, 0x00, 0xa0, 0xe1, 0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 
-	0xff, 0x04, 0x10, 0xe2, 0x01, 0x31, 0x83, 0x03, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x60, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x07, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 0x60, 0x00, 0xa0, 0xe1, 0x02, 0x05, 0x10, 0xe3, 
-	0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 0x01, 0x31, 0x83, 0x03, 0xff, 0x78, 0x07, 0xe2, 
-	0x00, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x0c, 0xa0, 0xe1, 0x23, 0x3f, 0xb0, 0xe1, 0x60, 0x00, 0xa0, 0xe1, 
-	0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0x20, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x23, 0x3f, 0xb0, 0xe1, 0x64, 0x40, 0xa0, 0xe1, 0x02, 0x05, 0x14, 0xe3, 
-	0x02, 0x32, 0x83, 0x13, 0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 
-	0x80, 0x00, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x58, 0x05, 0xe2, 
-	0x00, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 0x80, 0x00, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x60, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 
-	0x80, 0x00, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x78, 0x07, 0xe2, 
-	0x00, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x80, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0x20, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xc5, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0xff, 0x58, 0x05, 0xe2, 0x00, 0x5c, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x04, 0xa0, 0xe1, 0xc0, 0x0c, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x54, 0x05, 0xe2, 
-	0x00, 0x58, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xc6, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0xff, 0x68, 0x06, 0xe2, 0x00, 0x6c, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x04, 0xa0, 0xe1, 0xc0, 0x0c, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x64, 0x06, 0xe2, 
-	0x00, 0x68, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xc7, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0xff, 0x78, 0x07, 0xe2, 0x00, 0x7c, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x04, 0xa0, 0xe1, 0xc0, 0x0c, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x00, 0x00, 0xe2, 0xff, 0x74, 0x07, 0xe2, 
-	0x00, 0x78, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x0c, 0xa0, 0xe1, 0xc0, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x60, 0x0e, 0xa0, 0xe1, 0x00, 0x0c, 0x80, 0xe1, 
-	0xff, 0x04, 0x10, 0xe2, 0x00, 0x30, 0x0f, 0xe1, 0x01, 0x31, 0x03, 0xe2, 0xff, 0x58, 0x05, 0xe2, 
-	0x00, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x05, 0xe2, 0xff, 0x54, 0x05, 0xe2, 0x60, 0x0a, 0xa0, 0xe1, 
-	0x00, 0x0c, 0x90, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x01, 0x31, 0x03, 0xe2, 0x20, 0x54, 0x85, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x06, 0xe2, 0x60, 0x0e, 0xa0, 0xe1, 0x00, 0x0c, 0x80, 0xe1, 0xff, 0x04, 0x10, 0xe2, 
-	0x00, 0x30, 0x0f, 0xe1, 0x01, 0x31, 0x03, 0xe2, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x60, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x08, 0x06, 0xe2, 0xff, 0x64, 0x06, 0xe2, 0x60, 0x0a, 0xa0, 0xe1, 0x00, 0x0c, 0x90, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x01, 0x31, 0x03, 0xe2, 0x20, 0x64, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 
-	0x60, 0x0e, 0xa0, 0xe1, 0x00, 0x0c, 0x80, 0xe1, 0xff, 0x04, 0x10, 0xe2, 0x00, 0x30, 0x0f, 0xe1, 
-	0x01, 0x31, 0x03, 0xe2, 0xff, 0x78, 0x07, 0xe2, 0x00, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x07, 0xe2, 
-	0xff, 0x74, 0x07, 0xe2, 0x60, 0x0a, 0xa0, 0xe1, 0x00, 0x0c, 0x90, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 
-	0x01, 0x31, 0x03, 0xe2, 0x20, 0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x60, 0x02, 0xa0, 0xe1, 0x00, 0x0c, 0x80, 0xe1, 
-	0x20, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x01, 0x31, 0x03, 0xe2, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x06, 0xe2, 
-	0xa0, 0x08, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x64, 0x06, 0xe2, 
-	0x00, 0x68, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x07, 0xe2, 0xa0, 0x08, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x74, 0x07, 0xe2, 0x00, 0x78, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0xa0, 0x00, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x02, 0x32, 0x03, 0xe2, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x16, 0xe1, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x50, 0xc5, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x10, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x50, 0xc5, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x10, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x11, 0x60, 0xc6, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x70, 0xc7, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x10, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x70, 0xc7, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x40, 0xc4, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x14, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x60, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x14, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x14, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x40, 0x84, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x54, 0x2d, 0xe9, 0x0c, 0xaa, 0x9f, 0xe5, 
-	0x05, 0x00, 0x00, 0xeb, 0x00, 0x54, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0xf1, 0x04, 0xda, 0xe5, 
-	0x7f, 0x00, 0xc0, 0xe3, 0x80, 0x00, 0x30, 0xe2, 0xf1, 0x04, 0xca, 0xe5, 0x72, 0x0d, 0xa0, 0xe3, 
-	0xcc, 0x04, 0x8a, 0xe5, 0xc8, 0x04, 0x8a, 0xe5, 0x33, 0x0d, 0xa0, 0xe3, 0xd0, 0x04, 0x8a, 0xe5, 
-	0xdc, 0xc9, 0x9f, 0xe5, 0xa0, 0x00, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0xd4, 0xc9, 0x9f, 0xe5, 
-	0x98, 0x00, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0xb4, 0x00, 0x9f, 0xe5, 0xc8, 0xc9, 0x9f, 0xe5, 
-	0x00, 0x00, 0x8c, 0xe5, 0x98, 0x00, 0x9f, 0xe5, 0xc0, 0xc9, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 
-	0x94, 0x00, 0x9f, 0xe5, 0xb8, 0xc9, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0x68, 0x00, 0x9f, 0xe5, 
-	0xf1, 0x04, 0xda, 0xe5, 0x80, 0x00, 0x10, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 0xd4, 0x04, 0xda, 0xe5, 
-	0x02, 0x00, 0x10, 0xe3, 0x39, 0x0c, 0xa0, 0xe3, 0xcc, 0x04, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0x01, 
-	0xc8, 0x04, 0x8a, 0xe5, 0x66, 0x0d, 0xa0, 0xe3, 0xd0, 0x04, 0x8a, 0xe5, 0x70, 0xc9, 0x9f, 0xe5, 
-	0x3c, 0x00, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0x68, 0xc9, 0x9f, 0xe5, 0x34, 0x00, 0x9f, 0xe5, 
-	0x00, 0x00, 0x8c, 0xe5, 0x4c, 0x00, 0x9f, 0xe5, 0x5c, 0xc9, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 
-	0x30, 0x00, 0x9f, 0xe5, 0x54, 0xc9, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0x2c, 0x00, 0x9f, 0xe5, 
-	0x4c, 0xc9, 0x9f, 0xe5, 0x00, 0x00, 0x8c, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x33, 0x0d, 0x58, 0xe3, 
-	0x5e, 0x0d, 0x58, 0xe3, 0x66, 0x0d, 0x58, 0xe3, 0x2f, 0x0c, 0x58, 0xe3, 0x33, 0x8d, 0x88, 0xe2, 
-	0x66, 0x8d, 0x88, 0xe2, 0x80, 0x80, 0x98, 0xe2, 0x01, 0x8c, 0x98, 0xe2, 0x80, 0x00, 0x40, 0xe2, 
-	0x01, 0x0c, 0x40, 0xe2, 0x33, 0x2d, 0x58, 0xe2, 0x66, 0x2d, 0x58, 0xe2, 0x01, 0x19, 0x41, 0xe2, 
-	0x01, 0x19, 0x81, 0xe2, 0x04, 0xe0, 0x2d, 0xe5, 0xca, 0x08, 0x00, 0xeb, 0x5f, 0x09, 0x00, 0xeb, 
-	0x75, 0x04, 0x00, 0xeb, 0x1c, 0x0a, 0x00, 0xeb, 0x0f, 0xe0, 0xa0, 0xe1, 0xf4, 0xf8, 0x9f, 0xe5, 
-	0xf4, 0x08, 0x9f, 0xe5, 0x00, 0x00, 0x90, 0xe5, 0x0e, 0x0a, 0x50, 0xe3, 0x34, 0x00, 0x1f, 0x05, 
-	0x3c, 0x00, 0x1f, 0x15, 0xe4, 0x18, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x10, 0x06, 0x8a, 0xe5, 0x18, 0x06, 0x8a, 0xe5, 0x20, 0x06, 0x8a, 0xe5, 0x28, 0x00, 0x00, 0xeb, 
-	0x2b, 0x01, 0x00, 0xeb, 0xa5, 0x04, 0xda, 0xe5, 0x00, 0x00, 0x50, 0xe3, 0x01, 0x44, 0xa0, 0x03, 
-	0x13, 0x58, 0xa0, 0x03, 0x11, 0x44, 0xa0, 0x13, 0x13, 0x58, 0xa0, 0x13, 0xd5, 0x04, 0xda, 0x15, 
-	0x00, 0x00, 0xb0, 0x11, 0xa8, 0x58, 0x9f, 0x15, 0x36, 0x67, 0xa0, 0xe3, 0xa4, 0x78, 0x9f, 0xe5, 
-	0x07, 0x32, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3, 0x0f, 0xe0, 0xa0, 0xe1, 0x98, 0xf8, 0x9f, 0xe5, 
-	0x00, 0x10, 0xa0, 0xe3, 0xa2, 0x14, 0xca, 0xe5, 0xa1, 0x14, 0xca, 0xe5, 0xa8, 0x14, 0x8a, 0xe5, 
-	0xac, 0x14, 0x8a, 0xe5, 0xb0, 0x14, 0x8a, 0xe5, 0xb4, 0x14, 0x8a, 0xe5, 0x7c, 0xb8, 0x9f, 0xe5, 
-	0x02, 0x80, 0xa0, 0xe3, 0x01, 0x9c, 0xa0, 0xe3, 0x0f, 0x1a, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 
-	0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0x12, 0x0d, 0x8a, 0xe2, 
-	0xf8, 0x0b, 0x80, 0xe8, 0x04, 0xf0, 0x9d, 0xe4, 0x01, 0x00, 0x10, 0xe3, 0xf8, 0x4f, 0x2d, 0x09, 
-	0x18, 0xa8, 0x9f, 0xe5, 0xfc, 0x05, 0xca, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 0xd7, 0x14, 0xca, 0xe5, 
-	0x3c, 0xf8, 0x9f, 0xe5, 0x04, 0xa8, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0x44, 0x00, 0x0a, 0xe5, 
-	0x48, 0x00, 0x4a, 0xe5, 0x47, 0x00, 0x4a, 0xe5, 0x28, 0x28, 0x9f, 0xe5, 0x54, 0x00, 0x9f, 0xe5, 
-	0x00, 0x00, 0x82, 0xe5, 0x20, 0x08, 0x9f, 0xe5, 0x60, 0x00, 0x8a, 0xe5, 0x1c, 0x08, 0x9f, 0xe5, 
-	0x80, 0x00, 0x8a, 0xe5, 0x18, 0x08, 0x9f, 0xe5, 0xa0, 0x00, 0x8a, 0xe5, 0x14, 0x08, 0x9f, 0xe5, 
-	0xc0, 0x00, 0x8a, 0xe5, 0x10, 0x08, 0x9f, 0xe5, 0xe0, 0x00, 0x8a, 0xe5, 0x0c, 0x08, 0x9f, 0xe5, 
-	0x08, 0x03, 0x8a, 0xe5, 0x08, 0x08, 0x9f, 0xe5, 0x0c, 0x03, 0x8a, 0xe5, 0x04, 0x08, 0x9f, 0xe5, 
-	0x28, 0x03, 0x8a, 0xe5, 0x00, 0x08, 0x9f, 0xe5, 0x48, 0x03, 0x8a, 0xe5, 0xfc, 0x07, 0x9f, 0xe5, 
-	0x68, 0x03, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0xe1, 
-	0x0b, 0xb0, 0xa0, 0xe1, 0x00, 0x00, 0x51, 0xe3, 0x00, 0x10, 0xa0, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 
-	0xdb, 0xff, 0xff, 0xeb, 0xa4, 0xe0, 0x8f, 0xe2, 0x1c, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x51, 0xe5, 
-	0xd1, 0x20, 0x51, 0xe1, 0x02, 0xc0, 0x81, 0xe0, 0x44, 0xc0, 0x0a, 0xe5, 0xff, 0x20, 0x02, 0xe2, 
-	0x01, 0x2c, 0x62, 0xe2, 0x09, 0x00, 0x52, 0xe3, 0x09, 0x00, 0x00, 0xca, 0x00, 0x10, 0xdc, 0xe5, 
-	0xfa, 0x00, 0x51, 0xe3, 0x06, 0x00, 0x00, 0x1a, 0x01, 0x10, 0xdc, 0xe5, 0x02, 0xc0, 0xdc, 0xe5, 
-	0x0c, 0x14, 0x81, 0xe1, 0xbc, 0x14, 0x4a, 0xe1, 0x68, 0x17, 0x9f, 0xe5, 0x68, 0xc0, 0x1f, 0xe5, 
-	0x00, 0xc0, 0x81, 0xe5, 0x18, 0x00, 0x50, 0xe3, 0x16, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x50, 0xe3, 
-	0x19, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x50, 0xe3, 0x1c, 0x00, 0x00, 0x0a, 0x30, 0x00, 0x50, 0xe3, 
-	0x1f, 0x00, 0x00, 0x0a, 0x38, 0x00, 0x50, 0xe3, 0x22, 0x00, 0x00, 0x0a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x44, 0x10, 0x0a, 0xe5, 0x01, 0x00, 0x51, 0xe5, 0xc2, 0x00, 0x50, 0xe3, 0x25, 0x00, 0x00, 0x0a, 
-	0xc3, 0x00, 0x50, 0xe3, 0x20, 0x00, 0x00, 0x0a, 0xca, 0x00, 0x50, 0xe3, 0x24, 0x00, 0x00, 0x0a, 
-	0xd2, 0x00, 0x50, 0xe3, 0x25, 0x00, 0x00, 0x0a, 0xda, 0x00, 0x50, 0xe3, 0x26, 0x00, 0x00, 0x0a, 
-	0x00, 0x40, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0x24, 0x07, 0x9f, 0xe5, 0x00, 0x20, 0xc0, 0xe5, 
-	0x20, 0x07, 0x9f, 0xe5, 0x60, 0x00, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x18, 0x07, 0x9f, 0xe5, 
-	0x00, 0x20, 0xc0, 0xe5, 0x14, 0x07, 0x9f, 0xe5, 0x80, 0x00, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x0c, 0x07, 0x9f, 0xe5, 0x00, 0x20, 0xc0, 0xe5, 0x08, 0x07, 0x9f, 0xe5, 0xa0, 0x00, 0x8a, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x07, 0x9f, 0xe5, 0x00, 0x20, 0xc0, 0xe5, 0xfc, 0x06, 0x9f, 0xe5, 
-	0xc0, 0x00, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf4, 0x06, 0x9f, 0xe5, 0x00, 0x20, 0xc0, 0xe5, 
-	0xf0, 0x06, 0x9f, 0xe5, 0xe0, 0x00, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xe8, 0x06, 0x9f, 0xe5, 
-	0x0c, 0x03, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xe0, 0x06, 0x9f, 0xe5, 0x08, 0x03, 0x8a, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xd8, 0x06, 0x9f, 0xe5, 0x28, 0x03, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xd0, 0x06, 0x9f, 0xe5, 0x48, 0x03, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xc8, 0x06, 0x9f, 0xe5, 
-	0x68, 0x03, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xb8, 0x04, 0x9a, 0xe5, 0xbc, 0x16, 0x9f, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x89, 0x48, 0xe2, 0xbc, 0x04, 0x8a, 0xe5, 
-	0xac, 0x16, 0x9f, 0xe5, 0xb8, 0x14, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x89, 0x88, 0xe2, 
-	0xbc, 0x04, 0x9a, 0xe5, 0xb8, 0x04, 0x8a, 0xe5, 0x98, 0xf6, 0x9f, 0xe5, 0x08, 0x00, 0x10, 0xe3, 
-	0x58, 0x20, 0xa0, 0x13, 0x08, 0x10, 0xc1, 0x13, 0x8c, 0xf6, 0x9f, 0x15, 0x10, 0x00, 0x10, 0xe3, 
-	0x60, 0x20, 0xa0, 0x13, 0x10, 0x10, 0xc1, 0x13, 0x7c, 0xf6, 0x9f, 0x15, 0x1f, 0x10, 0x01, 0xe2, 
-	0x40, 0x20, 0xa0, 0xe3, 0x70, 0xf6, 0x9f, 0xe5, 0x70, 0x16, 0x9f, 0xe5, 0x00, 0x00, 0x91, 0xe5, 
-	0x01, 0x00, 0x80, 0xe2, 0x03, 0xf0, 0x28, 0xe1, 0xff, 0x30, 0xa0, 0xe3, 0x20, 0xcc, 0x03, 0xe0, 
-	0xc0, 0xc0, 0xac, 0xe2, 0x0c, 0x2c, 0xb0, 0xe1, 0x20, 0xc8, 0x03, 0xe0, 0x45, 0xc0, 0xac, 0xe2, 
-	0x0c, 0xcc, 0xb0, 0xe1, 0x2c, 0x24, 0x82, 0xe1, 0x20, 0xc4, 0x03, 0xe0, 0xa5, 0xc0, 0xac, 0xe2, 
-	0x0c, 0xcc, 0xb0, 0xe1, 0x2c, 0x28, 0x82, 0xe1, 0x00, 0xc0, 0x03, 0xe0, 0x55, 0xc0, 0xac, 0xe2, 
-	0x0c, 0xcc, 0xb0, 0xe1, 0x2c, 0x0c, 0x82, 0xe1, 0x24, 0x26, 0x9f, 0xe5, 0x02, 0x00, 0x20, 0xe0, 
-	0x00, 0x00, 0x81, 0xe5, 0x00, 0x04, 0x20, 0xe0, 0x00, 0x08, 0x20, 0xe0, 0x00, 0x4c, 0xb0, 0xe1, 
-	0x01, 0x31, 0xa0, 0x03, 0x00, 0x30, 0xa0, 0x13, 0x02, 0x90, 0x89, 0xe2, 0x5f, 0x8d, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xf4, 0xc5, 0x9f, 0xe5, 
-	0x9c, 0x02, 0x9c, 0xe5, 0x20, 0x04, 0xa0, 0xe1, 0xa0, 0x22, 0xdc, 0xe5, 0x02, 0x0c, 0x80, 0xe1, 
-	0x80, 0x40, 0xa0, 0xe1, 0x80, 0x18, 0xa0, 0xe1, 0x3f, 0x23, 0x04, 0xe2, 0xa1, 0x17, 0x82, 0xe0, 
-	0xff, 0x28, 0x00, 0xe2, 0x02, 0x10, 0x81, 0xe0, 0xff, 0x28, 0x04, 0xe2, 0x02, 0x00, 0x81, 0xe0, 
-	0x57, 0x00, 0x80, 0xe2, 0x13, 0x0c, 0x80, 0xe2, 0xbc, 0x1f, 0xdc, 0xe1, 0x01, 0x00, 0x90, 0xe0, 
-	0x01, 0x10, 0x81, 0xe2, 0xbc, 0x1f, 0xcc, 0xe1, 0x00, 0x44, 0xa0, 0xe1, 0xff, 0x44, 0x04, 0xe2, 
-	0x02, 0x90, 0x89, 0xe2, 0x9a, 0x8d, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x11, 0x90, 0x89, 0xe2, 0xa5, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x08, 0xa0, 0xe1, 0x26, 0x18, 0xa0, 0xe1, 
-	0x04, 0xe0, 0x8f, 0xe2, 0x70, 0xc5, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 0x00, 0x58, 0xa0, 0xe1, 
-	0x00, 0x78, 0xa0, 0xe1, 0x01, 0x68, 0xa0, 0xe1, 0x00, 0x40, 0xa0, 0xe3, 0x01, 0x31, 0xa0, 0xe3, 
-	0x58, 0x05, 0x9f, 0xe5, 0x00, 0x80, 0x48, 0xe0, 0x54, 0xf5, 0x9f, 0xe5, 0x11, 0x2d, 0x8a, 0xe2, 
-	0x0f, 0x02, 0x06, 0xe2, 0x0f, 0x12, 0x07, 0xe2, 0x20, 0x0d, 0x92, 0xe7, 0x21, 0x1d, 0x92, 0xe7, 
-	0x26, 0x08, 0x80, 0xe0, 0x27, 0x18, 0x81, 0xe0, 0x25, 0xcc, 0xa0, 0xe1, 0x25, 0x28, 0xa0, 0xe1, 
-	0xff, 0x20, 0x02, 0xe2, 0x01, 0x00, 0x52, 0xe3, 0x11, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x5c, 0xe3, 
-	0x13, 0x00, 0x00, 0x0a, 0x78, 0x00, 0x2d, 0xe9, 0x00, 0x30, 0xa0, 0xe1, 0x01, 0x40, 0xa0, 0xe1, 
-	0x02, 0x50, 0xa0, 0xe1, 0x0c, 0x60, 0xa0, 0xe1, 0x06, 0x20, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x00, 0xf5, 0x9f, 0xe5, 0x20, 0x30, 0x83, 0xe2, 0x03, 0x00, 0xa0, 0xe1, 0x20, 0x40, 0x84, 0xe2, 
-	0x04, 0x10, 0xa0, 0xe1, 0x01, 0x50, 0x55, 0xe2, 0xf6, 0xff, 0xff, 0xca, 0x78, 0x00, 0xbd, 0xe8, 
-	0xdc, 0xf4, 0x9f, 0xe5, 0x0c, 0x20, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 0xd4, 0xf4, 0x9f, 0xe5, 
-	0xcc, 0xf4, 0x9f, 0xe5, 0x82, 0x22, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 0xc4, 0xf4, 0x9f, 0xe5, 
-	0xbc, 0xf4, 0x9f, 0xe5, 0xf8, 0x4b, 0x2d, 0xe9, 0xf0, 0xa3, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x45, 0x00, 0x4a, 0xe5, 0x82, 0x05, 0xca, 0xe5, 0x73, 0x06, 0x00, 0xeb, 0x00, 0x00, 0xa0, 0xe3, 
-	0xa4, 0x14, 0x9f, 0xe5, 0x00, 0x00, 0xc1, 0xe5, 0xb3, 0xcf, 0x8f, 0xe2, 0x9c, 0x14, 0x9f, 0xe5, 
-	0x0a, 0x20, 0xa0, 0xe3, 0x01, 0x00, 0xdc, 0xe4, 0x00, 0x11, 0x8a, 0xe7, 0x01, 0x20, 0x52, 0xe2, 
-	0xfb, 0xff, 0xff, 0xca, 0x2f, 0x00, 0x00, 0xeb, 0x00, 0xf1, 0x9f, 0x57, 0xa8, 0x00, 0x00, 0xea, 
-	0xd0, 0x4e, 0x00, 0x08, 0xd0, 0x4e, 0x00, 0x08, 0xd0, 0x4e, 0x00, 0x08, 0xd0, 0x4e, 0x00, 0x08, 
-	0xd0, 0x4e, 0x00, 0x08, 0x74, 0x4f, 0x00, 0x08, 0x10, 0x4e, 0x00, 0x08, 0x28, 0x4e, 0x00, 0x08, 
-	0x00, 0x4e, 0x00, 0x08, 0xf8, 0x4d, 0x00, 0x08, 0x74, 0x4f, 0x00, 0x08, 0xc0, 0x4e, 0x00, 0x08, 
-	0x54, 0x4e, 0x00, 0x08, 0x53, 0x48, 0x41, 0x4e, 0x54, 0x41, 0x45, 0x00, 0x57, 0x45, 0x4e, 0x44, 
-	0x59, 0x00, 0x53, 0x50, 0x4f, 0x4f, 0x4b, 0x45, 0x44, 0x00, 0x42, 0x45, 0x54, 0x52, 0x41, 0x59, 
-	0x41, 0x4c, 0x00, 0x5a, 0x41, 0x50, 0x50, 0x45, 0x44, 0x00, 0x58, 0x54, 0x52, 0x45, 0x4d, 0x45, 
-	0x53, 0x50, 0x4f, 0x52, 0x54, 0x42, 0x58, 0x47, 0x45, 0x00, 0x44, 0x57, 0x20, 0x33, 0x00, 0x44, 
-	0x52, 0x59, 0x4d, 0x4f, 0x55, 0x54, 0x48, 0x00, 0x41, 0x4c, 0x49, 0x43, 0x45, 0x00, 0x4d, 0x45, 
-	0x47, 0x41, 0x4d, 0x41, 0x4e, 0x58, 0x32, 0x53, 0x45, 0x42, 0x32, 0x58, 0x45, 0x00, 0x42, 0x41, 
-	0x4c, 0x4c, 0x4f, 0x4f, 0x4e, 0x20, 0x47, 0x42, 0x00, 0x43, 0x4f, 0x4e, 0x4b, 0x45, 0x52, 0x20, 
-	0x43, 0x47, 0x42, 0x00, 0x42, 0x49, 0x4f, 0x4e, 0x49, 0x43, 0x2d, 0x43, 0x4f, 0x4d, 0x4d, 0x41, 
-	0x56, 0x34, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x14, 0x9a, 0xe5, 0x4d, 0x1f, 0x81, 0xe2, 
-	0x94, 0xc0, 0x4f, 0xe2, 0x00, 0x00, 0xa0, 0xe3, 0x00, 0x20, 0xa0, 0xe3, 0x02, 0x30, 0xd1, 0xe7, 
-	0x02, 0x40, 0xdc, 0xe7, 0x04, 0x00, 0x53, 0xe1, 0x06, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x53, 0xe3, 
-	0x02, 0x00, 0x00, 0x0a, 0x01, 0x20, 0x82, 0xe2, 0x0f, 0x00, 0x52, 0xe3, 0xf6, 0xff, 0xff, 0xba, 
-	0x00, 0x00, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x40, 0xdc, 0xe7, 0x01, 0x20, 0x82, 0xe2, 
-	0x00, 0x00, 0x54, 0xe3, 0xfb, 0xff, 0xff, 0x1a, 0x02, 0xc0, 0x8c, 0xe0, 0x00, 0x40, 0xdc, 0xe5, 
-	0x00, 0x00, 0x54, 0xe3, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x80, 0xe2, 0xe9, 0xff, 0xff, 0xea, 
-	0x00, 0x00, 0xf0, 0xe3, 0x1e, 0xff, 0x2f, 0xe1, 0x03, 0x00, 0xa0, 0xe3, 0x00, 0x00, 0x00, 0xea, 
-	0x01, 0x00, 0xa0, 0xe3, 0x82, 0x05, 0xca, 0xe5, 0x17, 0x06, 0x00, 0xeb, 0x58, 0x00, 0x00, 0xea, 
-	0xeb, 0x00, 0xa0, 0xe3, 0x38, 0x13, 0x9f, 0xe5, 0x82, 0x00, 0x00, 0xeb, 0x34, 0x13, 0x9f, 0xe5, 
-	0x00, 0x11, 0x8a, 0xe7, 0x52, 0x00, 0x00, 0xea, 0xeb, 0x00, 0xa0, 0xe3, 0x28, 0x13, 0x9f, 0xe5, 
-	0x7c, 0x00, 0x00, 0xeb, 0x24, 0x13, 0x9f, 0xe5, 0x00, 0x11, 0x8a, 0xe7, 0xd3, 0x00, 0xa0, 0xe3, 
-	0x1c, 0x13, 0x9f, 0xe5, 0x77, 0x00, 0x00, 0xeb, 0x18, 0x13, 0x9f, 0xe5, 0x00, 0x11, 0x8a, 0xe7, 
-	0x47, 0x00, 0x00, 0xea, 0xec, 0x00, 0xa0, 0xe3, 0x0c, 0x13, 0x9f, 0xe5, 0x71, 0x00, 0x00, 0xeb, 
-	0x08, 0x13, 0x9f, 0xe5, 0x00, 0x11, 0x8a, 0xe7, 0x40, 0x10, 0x8f, 0xe2, 0x40, 0x04, 0x9a, 0xe5, 
-	0x10, 0x20, 0xa0, 0xe3, 0x0f, 0xe0, 0xa0, 0xe1, 0xc8, 0xf2, 0x9f, 0xe5, 0x40, 0x04, 0x9a, 0xe5, 
-	0x03, 0x0c, 0x80, 0xe2, 0xd8, 0x00, 0x80, 0xe2, 0x03, 0x10, 0xa0, 0xe3, 0x00, 0x10, 0x80, 0xe5, 
-	0x04, 0x10, 0x10, 0xe5, 0xff, 0x14, 0xc1, 0xe3, 0xcd, 0x14, 0x81, 0xe3, 0x04, 0x10, 0x00, 0xe5, 
-	0x04, 0x10, 0x90, 0xe5, 0xff, 0x10, 0xc1, 0xe3, 0x04, 0x10, 0x80, 0xe5, 0x30, 0x00, 0x00, 0xea, 
-	0xc3, 0x13, 0x38, 0xfa, 0x4a, 0xc1, 0xa7, 0x20, 0x05, 0xfb, 0x76, 0x00, 0x18, 0xf5, 0xc9, 0x00, 
-	0x45, 0x00, 0x5a, 0xe5, 0x01, 0x00, 0x80, 0xe3, 0x45, 0x00, 0x4a, 0xe5, 0x28, 0x00, 0x00, 0xea, 
-	0x00, 0xb0, 0xa0, 0xe1, 0x00, 0x00, 0x50, 0xe3, 0x7e, 0x10, 0xa0, 0x03, 0x7b, 0x10, 0xa0, 0x13, 
-	0x8c, 0x22, 0x9f, 0xe5, 0x00, 0x10, 0xc2, 0xe5, 0x04, 0x00, 0x50, 0xe3, 0x04, 0x10, 0xa0, 0xe3, 
-	0x05, 0x10, 0xa0, 0x13, 0x7c, 0x22, 0x9f, 0xe5, 0x00, 0x10, 0xc2, 0xe5, 0x11, 0xce, 0x8f, 0xe2, 
-	0x00, 0xc1, 0x8c, 0xe0, 0xb2, 0x10, 0xdc, 0xe0, 0x6c, 0x22, 0x9f, 0xe5, 0x00, 0x10, 0x82, 0xe5, 
-	0xb2, 0x10, 0xdc, 0xe0, 0x64, 0x22, 0x9f, 0xe5, 0x02, 0x10, 0x81, 0xe0, 0x60, 0x22, 0x9f, 0xe5, 
-	0x00, 0x10, 0x82, 0xe5, 0x02, 0x10, 0xa0, 0xe3, 0x1c, 0x22, 0x9f, 0xe5, 0x00, 0x10, 0xc2, 0xe5, 
-	0x44, 0x30, 0x8f, 0xe2, 0x4c, 0x40, 0x8f, 0xe2, 0x70, 0x50, 0x8f, 0xe2, 0x14, 0x10, 0xa0, 0xe3, 
-	0x90, 0x51, 0x25, 0xe0, 0x0a, 0x60, 0xa0, 0xe3, 0x01, 0x00, 0xd3, 0xe4, 0x04, 0x10, 0x94, 0xe4, 
-	0x00, 0x11, 0x8a, 0xe7, 0xb2, 0x10, 0xd5, 0xe0, 0x01, 0x10, 0xb0, 0xe1, 0x31, 0x00, 0x00, 0x1b, 
-	0x01, 0x60, 0x56, 0xe2, 0xf7, 0xff, 0xff, 0xca, 0x04, 0x00, 0x5b, 0xe3, 0x14, 0x12, 0x9f, 0x05, 
-	0xac, 0x13, 0x8a, 0x05, 0xf8, 0x4b, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0xfc, 0xeb, 0xec, 0xfd, 
-	0xe3, 0xe4, 0xdb, 0xdd, 0xd3, 0xf4, 0x00, 0x00, 0x60, 0x2a, 0x00, 0x03, 0xb4, 0x29, 0x00, 0x03, 
-	0xf0, 0x29, 0x00, 0x03, 0x28, 0x2b, 0x00, 0x03, 0xa4, 0x2b, 0x00, 0x03, 0xe4, 0x2b, 0x00, 0x03, 
-	0x24, 0x2c, 0x00, 0x03, 0x58, 0x2c, 0x00, 0x03, 0xb8, 0x2c, 0x00, 0x03, 0x68, 0x2b, 0x00, 0x03, 
-	0x40, 0x05, 0x55, 0x08, 0x33, 0x1e, 0x14, 0x13, 0x1e, 0x13, 0x34, 0x13, 0x42, 0x13, 0x62, 0x13, 
-	0x78, 0x13, 0x83, 0x13, 0x40, 0x05, 0x9c, 0x08, 0x2e, 0x1e, 0x73, 0x13, 0x7d, 0x13, 0x93, 0x13, 
-	0xa1, 0x13, 0xc1, 0x13, 0xd7, 0x13, 0xe2, 0x13, 0x40, 0x05, 0x9c, 0x08, 0x2e, 0x1e, 0x73, 0x13, 
-	0x7d, 0x13, 0x93, 0x13, 0xa1, 0x13, 0xc1, 0x13, 0xd7, 0x13, 0xe2, 0x13, 0x40, 0x05, 0x4b, 0x08, 
-	0x70, 0x1c, 0xd2, 0x11, 0xdc, 0x11, 0xf2, 0x11, 0x00, 0x12, 0x20, 0x12, 0x36, 0x12, 0x41, 0x12, 
-	0x40, 0x04, 0x22, 0x08, 0x07, 0x1e, 0xc8, 0x13, 0xd2, 0x13, 0xe8, 0x13, 0x00, 0x00, 0x13, 0x14, 
-	0x29, 0x14, 0x34, 0x14, 0xc0, 0xc4, 0x81, 0xc3, 0xc0, 0xc4, 0x78, 0xc3, 0xc0, 0xc4, 0x78, 0xc3, 
-	0xc0, 0xc3, 0x76, 0xc2, 0x60, 0xc4, 0x74, 0xc2, 0x40, 0x24, 0x9a, 0xe5, 0x01, 0x10, 0x82, 0xe0, 
-	0x01, 0x00, 0x11, 0xe3, 0x01, 0x10, 0xc1, 0xe3, 0xb0, 0x20, 0xd1, 0xe1, 0x03, 0x00, 0x00, 0x1a, 
-	0xff, 0x20, 0xc2, 0xe3, 0x00, 0x20, 0x82, 0xe1, 0xb0, 0x20, 0xc1, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xff, 0x2c, 0xc2, 0xe3, 0x00, 0x24, 0x82, 0xe1, 0xb0, 0x20, 0xc1, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x02, 0xca, 0x4c, 0xe2, 0x01, 0x0a, 0x1c, 0xe3, 0xd3, 0x10, 0x00, 0x0a, 0x18, 0xf1, 0x9f, 0xe5, 
-	0x02, 0xca, 0x4c, 0xe2, 0x01, 0x0a, 0x1c, 0xe3, 0xc0, 0x10, 0x00, 0x0a, 0x0c, 0xf1, 0x9f, 0xe5, 
-	0x68, 0x51, 0x00, 0x03, 0x04, 0x50, 0x00, 0x03, 0x10, 0x50, 0x00, 0x03, 0xd8, 0x37, 0x00, 0x03, 
-	0xe0, 0x4b, 0x00, 0x03, 0xfc, 0x4b, 0x00, 0x03, 0x8c, 0x46, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 
-	0x00, 0x45, 0x00, 0x03, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x4d, 0x01, 0x50, 0x42, 0x00, 0x03, 
-	0x00, 0x00, 0xfe, 0xff, 0xdc, 0xf5, 0x00, 0x06, 0xe4, 0x04, 0x00, 0x03, 0x4c, 0x03, 0x00, 0x03, 
-	0x90, 0x04, 0x00, 0x03, 0xec, 0x05, 0x00, 0x03, 0x2c, 0x07, 0x00, 0x03, 0xa4, 0x08, 0x00, 0x03, 
-	0xa0, 0x1a, 0x00, 0x03, 0xd4, 0x1a, 0x00, 0x03, 0x48, 0x1c, 0x00, 0x03, 0x60, 0x1d, 0x00, 0x03, 
-	0x28, 0x1e, 0x00, 0x03, 0x6c, 0x03, 0x00, 0x03, 0x64, 0x03, 0x00, 0x03, 0xc0, 0x04, 0x00, 0x03, 
-	0xb0, 0x04, 0x00, 0x03, 0x1c, 0x06, 0x00, 0x03, 0x0c, 0x06, 0x00, 0x03, 0x5c, 0x07, 0x00, 0x03, 
-	0x4c, 0x07, 0x00, 0x03, 0xd4, 0x08, 0x00, 0x03, 0xc4, 0x08, 0x00, 0x03, 0xc8, 0x1a, 0x00, 0x03, 
-	0xbc, 0x1a, 0x00, 0x03, 0x64, 0x1c, 0x00, 0x03, 0x7c, 0x1d, 0x00, 0x03, 0x44, 0x1e, 0x00, 0x03, 
-	0xb0, 0x4d, 0x00, 0x03, 0x7c, 0x4a, 0x00, 0x08, 0xd8, 0x4d, 0x00, 0x03, 0x28, 0x4e, 0x00, 0x03, 
-	0x1c, 0x5a, 0x00, 0x03, 0xca, 0xfe, 0xba, 0xbe, 0xa8, 0x57, 0x00, 0x03, 0x04, 0x8f, 0x00, 0x08, 
-	0x40, 0xac, 0x00, 0x00, 0x04, 0x1c, 0x00, 0x03, 0x38, 0x46, 0x00, 0x03, 0xeb, 0x56, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0xfd, 0x01, 0x00, 0x00, 0x3c, 0x4b, 0x00, 0x08, 0xd2, 0x33, 0x00, 0x00, 
-	0xa4, 0x4b, 0x00, 0x08, 0x4a, 0x31, 0x00, 0x00, 0xb8, 0x4b, 0x00, 0x08, 0x0e, 0x39, 0x00, 0x00, 
-	0xec, 0x4b, 0x00, 0x08, 0x68, 0x2b, 0x00, 0x03, 0xc0, 0x2a, 0x00, 0x03, 0x04, 0x00, 0x00, 0x02, 
-	0xa8, 0x97, 0xff, 0x02, 0xb0, 0x29, 0x00, 0x03, 0xb8, 0x4a, 0x00, 0x08, 0xf0, 0x44, 0x00, 0x03, 
-	0x24, 0x45, 0x00, 0x03, 0x00, 0xf0, 0x1f, 0xe5, 0x00, 0xf0, 0x1f, 0xe5, 0x30, 0x45, 0x00, 0x03, 
-	0xa4, 0x45, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x55, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 
-	0xe4, 0x55, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0xe4, 0x55, 0x00, 0x08, 0x03, 0x00, 0x00, 0x00, 
-	0xe4, 0x55, 0x00, 0x08, 0x05, 0x00, 0x00, 0x00, 0x54, 0x56, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 
-	0x54, 0x56, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0xd0, 0x55, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 
-	0xd0, 0x55, 0x00, 0x08, 0x0b, 0x00, 0x00, 0x00, 0xe4, 0x57, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x00, 
-	0xe4, 0x57, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x00, 0xe4, 0x57, 0x00, 0x08, 0x0f, 0x00, 0x00, 0x00, 
-	0x80, 0x56, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x80, 0x56, 0x00, 0x08, 0x11, 0x00, 0x00, 0x00, 
-	0x80, 0x56, 0x00, 0x08, 0x12, 0x00, 0x00, 0x00, 0x80, 0x56, 0x00, 0x08, 0x13, 0x00, 0x00, 0x00, 
-	0x80, 0x56, 0x00, 0x08, 0x15, 0x00, 0x00, 0x00, 0xe4, 0x57, 0x00, 0x08, 0x16, 0x00, 0x00, 0x00, 
-	0xe4, 0x57, 0x00, 0x08, 0x17, 0x00, 0x00, 0x00, 0xe4, 0x57, 0x00, 0x08, 0x19, 0x00, 0x00, 0x00, 
-	0x58, 0x57, 0x00, 0x08, 0x1a, 0x00, 0x00, 0x00, 0x58, 0x57, 0x00, 0x08, 0x1b, 0x00, 0x00, 0x00, 
-	0x58, 0x57, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x57, 0x00, 0x08, 0x1d, 0x00, 0x00, 0x00, 
-	0x58, 0x57, 0x00, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x58, 0x57, 0x00, 0x08, 0x22, 0x00, 0x00, 0x00, 
-	0x78, 0x57, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x00, 0xc4, 0x57, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00, 
-	0xa4, 0x57, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x55, 0x00, 0x08, 0x00, 0x00, 0x01, 0x03, 
-	0x00, 0x01, 0x03, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x04, 0x07, 0x00, 0x01, 0x03, 
-	0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x08, 0x09, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 
-	0xc0, 0x15, 0x9a, 0xe5, 0xbc, 0x05, 0x9a, 0xe5, 0xf3, 0x4f, 0x2d, 0xe9, 0x40, 0xa5, 0x9f, 0xe5, 
-	0x02, 0x10, 0xa0, 0xe3, 0x02, 0x00, 0x00, 0xea, 0xf3, 0x4f, 0x2d, 0xe9, 0x30, 0xa5, 0x9f, 0xe5, 
-	0x00, 0x10, 0xa0, 0xe3, 0xe6, 0x15, 0xca, 0xe5, 0x04, 0xe0, 0x8f, 0xe2, 0x24, 0xc5, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0x04, 0xe0, 0x8f, 0xe2, 0x1c, 0xc5, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 
-	0x00, 0x30, 0xa0, 0xe1, 0xb8, 0x35, 0x8a, 0xe5, 0x03, 0x00, 0xbd, 0xe8, 0xbc, 0x05, 0x8a, 0xe5, 
-	0xc0, 0x15, 0x8a, 0xe5, 0x46, 0x11, 0xd3, 0xe5, 0x03, 0x00, 0x51, 0xe3, 0x4b, 0x11, 0xd3, 0x05, 
-	0x33, 0x00, 0x51, 0x03, 0x01, 0x50, 0xa0, 0x03, 0x00, 0x50, 0xa0, 0x13, 0x43, 0x11, 0xd3, 0xe5, 
-	0x80, 0x00, 0x51, 0xe3, 0xc0, 0x00, 0x51, 0x13, 0x01, 0x40, 0xa0, 0x03, 0x00, 0x40, 0xa0, 0x13, 
-	0x01, 0x00, 0x55, 0xe3, 0x01, 0x00, 0x54, 0x03, 0x0c, 0x00, 0x00, 0x1a, 0xe5, 0x05, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe3, 0x09, 0x00, 0x00, 0x1a, 0xe6, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 
-	0x06, 0x00, 0x00, 0x1a, 0xd6, 0x04, 0xda, 0xe5, 0x02, 0x00, 0x50, 0xe3, 0x03, 0x00, 0x00, 0x1a, 
-	0x01, 0x00, 0xa0, 0xe3, 0xe6, 0x05, 0xca, 0xe5, 0x00, 0x40, 0xa0, 0xe3, 0x09, 0x00, 0x00, 0xea, 
-	0xd6, 0x04, 0xda, 0xe5, 0x00, 0x00, 0x50, 0xe3, 0x00, 0x40, 0xa0, 0x03, 0x00, 0x50, 0xa0, 0x03, 
-	0x01, 0x00, 0x50, 0xe3, 0x01, 0x00, 0x55, 0x03, 0x00, 0x40, 0xa0, 0x03, 0x02, 0x00, 0x50, 0xe3, 
-	0x01, 0x00, 0x54, 0x03, 0x00, 0x50, 0xa0, 0x03, 0xa5, 0x44, 0xca, 0xe5, 0xa6, 0x54, 0xca, 0xe5, 
-	0x02, 0x29, 0xa0, 0xe3, 0x48, 0x11, 0xd3, 0xe5, 0x12, 0x11, 0xa0, 0xe1, 0x01, 0x10, 0x41, 0xe2, 
-	0xc4, 0x15, 0x8a, 0xe5, 0x47, 0x01, 0xd3, 0xe5, 0x05, 0x00, 0x50, 0xe3, 0x06, 0x00, 0x50, 0x13, 
-	0x05, 0x00, 0xa0, 0x03, 0x49, 0x01, 0xd3, 0x15, 0xcd, 0x05, 0xca, 0x15, 0x61, 0x1f, 0x8f, 0xe2, 
-	0x00, 0x01, 0x91, 0xe7, 0xc8, 0x05, 0x8a, 0xe5, 0xff, 0x5f, 0x2d, 0xe9, 0x04, 0xe0, 0x8f, 0xe2, 
-	0x28, 0xc4, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 0xff, 0x5f, 0xbd, 0xe8, 0x00, 0x00, 0xa0, 0xe3, 
-	0x84, 0x05, 0x8a, 0xe5, 0x01, 0x00, 0xa0, 0xe3, 0x88, 0x05, 0x8a, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x08, 0xf4, 0x9f, 0xe5, 0x01, 0x00, 0xa0, 0xe3, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x00, 0xf4, 0x9f, 0xe5, 0x47, 0x01, 0xd3, 0xe5, 0xff, 0x00, 0x50, 0xe3, 0x03, 0x00, 0xa0, 0x03, 
-	0x67, 0x1f, 0x4f, 0xe2, 0x00, 0x00, 0xd1, 0xe7, 0xe6, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x51, 0xe3, 
-	0x02, 0x00, 0xc0, 0x03, 0xcc, 0x05, 0xca, 0xe5, 0xdc, 0x13, 0x9f, 0xe5, 0x01, 0x00, 0x10, 0xe3, 
-	0xd8, 0x13, 0x9f, 0x15, 0x02, 0x00, 0x10, 0xe3, 0x04, 0x00, 0x00, 0x0a, 0x02, 0x03, 0x13, 0xe3, 
-	0x02, 0x00, 0x00, 0x0a, 0xcd, 0x05, 0xda, 0xe5, 0x03, 0x00, 0x50, 0xe3, 0xc0, 0x13, 0x9f, 0x15, 
-	0xb0, 0x15, 0x8a, 0xe5, 0xbc, 0x03, 0x9f, 0xe5, 0xc0, 0x04, 0x8a, 0xe5, 0xe0, 0x10, 0xa0, 0xe3, 
-	0x07, 0x04, 0xa0, 0xe3, 0x01, 0x2b, 0xa0, 0xe3, 0x45, 0xff, 0xff, 0xeb, 0x00, 0x10, 0xa0, 0xe3, 
-	0xa4, 0x03, 0x9f, 0xe5, 0x82, 0x2d, 0xa0, 0xe3, 0x41, 0xff, 0xff, 0xeb, 0x9c, 0x03, 0x9f, 0xe5, 
-	0x02, 0x29, 0xa0, 0xe3, 0x3e, 0xff, 0xff, 0xeb, 0x94, 0x03, 0x9f, 0xe5, 0x20, 0x20, 0xa0, 0xe3, 
-	0x3b, 0xff, 0xff, 0xeb, 0x8c, 0x03, 0x9f, 0xe5, 0x8c, 0x13, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 
-	0xb0, 0x15, 0x9a, 0xe5, 0x28, 0x14, 0x8a, 0xe5, 0x2c, 0x14, 0x8a, 0xe5, 0x7c, 0x13, 0x9f, 0xe5, 
-	0x60, 0x14, 0x8a, 0xe5, 0x64, 0x14, 0x8a, 0xe5, 0x74, 0x13, 0x9f, 0xe5, 0x68, 0x14, 0x8a, 0xe5, 
-	0x6c, 0x14, 0x8a, 0xe5, 0x6c, 0x13, 0x9f, 0xe5, 0x70, 0x14, 0x8a, 0xe5, 0x74, 0x14, 0x8a, 0xe5, 
-	0x64, 0x13, 0x9f, 0xe5, 0x78, 0x14, 0x8a, 0xe5, 0x7c, 0x14, 0x8a, 0xe5, 0x00, 0x90, 0xa0, 0xe3, 
-	0xc4, 0x94, 0x8a, 0xe5, 0x47, 0x01, 0xd3, 0xe5, 0xd7, 0x1f, 0x4f, 0xe2, 0x08, 0x20, 0x91, 0xe4, 
-	0x00, 0x00, 0x32, 0xe1, 0x00, 0x00, 0x00, 0x0a, 0xfb, 0xff, 0xff, 0x5a, 0x2c, 0xe0, 0x8f, 0xe2, 
-	0x01, 0x5b, 0x8a, 0xe2, 0x04, 0x00, 0x11, 0xe5, 0x1e, 0x00, 0xb0, 0xe8, 0x04, 0x10, 0x85, 0xe4, 
-	0x04, 0x10, 0x85, 0xe4, 0x04, 0x20, 0x85, 0xe4, 0x04, 0x20, 0x85, 0xe4, 0x04, 0x30, 0x85, 0xe4, 
-	0x04, 0x30, 0x85, 0xe4, 0x04, 0x40, 0x85, 0xe4, 0x04, 0x40, 0x85, 0xe4, 0x00, 0xf0, 0xa0, 0xe1, 
-	0x8f, 0xfc, 0xff, 0xeb, 0x04, 0x03, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x10, 0xff, 0x2f, 0xe1, 
-	0xf0, 0x4f, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 
-	0xff, 0x1f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 
-	0x1c, 0x20, 0x8f, 0xe2, 0xb4, 0x25, 0x8a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 0x01, 0x00, 0x93, 0xe7, 
-	0x01, 0x00, 0x82, 0xe7, 0x04, 0x10, 0x81, 0xe2, 0x02, 0x0c, 0x51, 0xe3, 0xfa, 0xff, 0xff, 0x1a, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xb4, 0x05, 0x9a, 0xe5, 0x40, 0x04, 0x8a, 0xe5, 0x44, 0x04, 0x8a, 0xe5, 
-	0xac, 0xf2, 0x9f, 0xe5, 0xc4, 0x15, 0x9a, 0xe5, 0x21, 0x07, 0x00, 0xe0, 0x84, 0x05, 0x8a, 0xe5, 
-	0xa0, 0x12, 0x9f, 0xe5, 0x00, 0x01, 0x91, 0xe7, 0x00, 0x00, 0x50, 0xe2, 0x40, 0x04, 0x8a, 0xe5, 
-	0x44, 0x04, 0x8a, 0xe5, 0x48, 0x04, 0x8a, 0xe5, 0x4c, 0x04, 0x8a, 0xe5, 0x80, 0xf2, 0x9f, 0xe5, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xa0, 0x46, 0x00, 0x03, 0xe0, 0x46, 0x00, 0x03, 0x04, 0x56, 0x00, 0x08, 
-	0x10, 0x56, 0x00, 0x08, 0x20, 0x02, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x03, 0x00, 0x00, 0xe2, 0x95, 0x05, 0xca, 0xe5, 0x93, 0x05, 0xda, 0xe5, 
-	0x93, 0x05, 0xca, 0xe5, 0x01, 0x00, 0x10, 0xe3, 0x95, 0x05, 0xda, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 
-	0x91, 0x05, 0xca, 0x05, 0x91, 0x15, 0xca, 0x15, 0x94, 0x15, 0xca, 0x05, 0x94, 0x05, 0xca, 0x15, 
-	0x90, 0x05, 0xda, 0xe5, 0x91, 0x15, 0xda, 0xe5, 0x81, 0x02, 0x80, 0xe1, 0x04, 0xe0, 0x2d, 0xe5, 
-	0x1f, 0x00, 0x10, 0xe3, 0x01, 0x00, 0x80, 0x02, 0x78, 0x0f, 0x00, 0xeb, 0x04, 0xe0, 0x9d, 0xe4, 
-	0x40, 0x0f, 0x00, 0xea, 0x74, 0x56, 0x00, 0x08, 0x00, 0x47, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0xb0, 0x01, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x0c, 0x1c, 0xe3, 0xdc, 0xf1, 0x9f, 0x05, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0xa0, 0x46, 0x00, 0x03, 0xac, 0x50, 0x00, 0x03, 0xcc, 0x56, 0x00, 0x08, 0xa0, 0x56, 0x00, 0x08, 
-	0x84, 0x01, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x93, 0x15, 0xda, 0xe5, 0x93, 0x05, 0xca, 0xe5, 0x00, 0x10, 0x21, 0xe0, 0x00, 0x10, 0x01, 0xe0, 
-	0x01, 0x00, 0x51, 0xe3, 0x0e, 0xf0, 0xa0, 0x11, 0x08, 0x40, 0x2d, 0xe9, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x98, 0xf1, 0x9f, 0xe5, 0x08, 0x40, 0xbd, 0xe8, 0x0e, 0xf0, 0xa0, 0xe1, 0x94, 0x05, 0xca, 0xe5, 
-	0x08, 0x00, 0x10, 0xe3, 0x1f, 0x0f, 0x00, 0x0a, 0x3c, 0x11, 0x9f, 0xe5, 0x28, 0x14, 0x8a, 0xe5, 
-	0x2c, 0x14, 0x8a, 0xe5, 0x78, 0x11, 0x9f, 0xe5, 0x08, 0x00, 0x50, 0xe3, 0x28, 0x10, 0x8f, 0x02, 
-	0x09, 0x00, 0x50, 0xe3, 0x28, 0x10, 0x8f, 0x02, 0x0a, 0x00, 0x50, 0xe3, 0x28, 0x10, 0x8f, 0x02, 
-	0x0b, 0x00, 0x50, 0xe3, 0x2c, 0x10, 0x8f, 0x02, 0x0c, 0x00, 0x50, 0xe3, 0x2c, 0x10, 0x8f, 0x02, 
-	0x2c, 0x10, 0x0a, 0xe5, 0x30, 0x10, 0x0a, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xae, 0x05, 0xda, 0xe5, 
-	0x07, 0x00, 0x00, 0xea, 0xad, 0x05, 0xda, 0xe5, 0x05, 0x00, 0x00, 0xea, 0xac, 0x05, 0xda, 0xe5, 
-	0x3f, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xea, 0xaa, 0x05, 0xda, 0xe5, 0x00, 0x00, 0x00, 0xea, 
-	0x00, 0x00, 0xa0, 0xe3, 0x0f, 0x10, 0x00, 0xe2, 0x20, 0x02, 0xa0, 0xe1, 0x00, 0x01, 0x80, 0xe0, 
-	0x80, 0x00, 0x81, 0xe0, 0x0e, 0xf0, 0xa0, 0xe1, 0xa0, 0x46, 0x00, 0x03, 0x14, 0x47, 0x00, 0x03, 
-	0x2c, 0x47, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0xac, 0x00, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 
-	0x2c, 0x04, 0x8a, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x90, 0x44, 0x00, 0x03, 0x40, 0x47, 0x00, 0x03, 
-	0x8c, 0x57, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x0e, 0xf0, 0xa0, 0xe1, 0x94, 0x05, 0xca, 0xe5, 
-	0x09, 0x00, 0x50, 0xe3, 0x0a, 0x00, 0xa0, 0x43, 0x00, 0x00, 0xa0, 0x53, 0x92, 0x05, 0xca, 0xe5, 
-	0xec, 0x0e, 0x00, 0xea, 0xa0, 0x46, 0x00, 0x03, 0x50, 0x47, 0x00, 0x03, 0x04, 0x56, 0x00, 0x08, 
-	0x10, 0x56, 0x00, 0x08, 0x60, 0x00, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xa0, 0x46, 0x00, 0x03, 0xac, 0x50, 0x00, 0x03, 0x2c, 0x47, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x40, 0x00, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xa0, 0x46, 0x00, 0x03, 0xac, 0x50, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x20, 0x00, 0x9f, 0xe5, 0x28, 0x04, 0x8a, 0xe5, 0x2c, 0x04, 0x8a, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x68, 0x51, 0x00, 0x03, 0xb1, 0x03, 0x00, 0x08, 0x29, 0x02, 0x00, 0x08, 
-	0x89, 0x02, 0x00, 0x08, 0xa4, 0x55, 0x00, 0x08, 0xac, 0x50, 0x00, 0x03, 0x98, 0x44, 0x00, 0x03, 
-	0x08, 0x45, 0x00, 0x03, 0xfc, 0x44, 0x00, 0x03, 0x34, 0x4c, 0x00, 0x03, 0xa8, 0x57, 0x00, 0x03, 
-	0x00, 0x80, 0x03, 0x02, 0xf8, 0x56, 0x00, 0x03, 0xbc, 0x42, 0x00, 0x03, 0x2c, 0x40, 0x00, 0x03, 
-	0x00, 0xc0, 0x02, 0x02, 0x00, 0xe0, 0x02, 0x02, 0xa8, 0x97, 0xff, 0x02, 0x28, 0x78, 0xff, 0x02, 
-	0x81, 0x29, 0x00, 0x08, 0xd4, 0x50, 0x00, 0x03, 0x18, 0x92, 0x02, 0x02, 0xa0, 0x46, 0x00, 0x03, 
-	0xa8, 0x69, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x00, 0x04, 0x2d, 0xe9, 0xd8, 0xab, 0x9f, 0xe5, 
-	0x44, 0x15, 0x9a, 0xe5, 0x40, 0x05, 0x9a, 0xe5, 0x00, 0x04, 0xa0, 0xe1, 0xff, 0x04, 0xc0, 0xe3, 
-	0x01, 0x0c, 0x80, 0xe1, 0x2b, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x80, 0xe1, 0x48, 0x05, 0x8a, 0xe5, 
-	0x00, 0x04, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0xb0, 0x1b, 0x9f, 0xe5, 0xb0, 0x2b, 0x9f, 0xe5, 
-	0x00, 0x20, 0x81, 0xe5, 0x01, 0x13, 0xa0, 0xe3, 0x08, 0x00, 0xa0, 0xe3, 0xb4, 0x00, 0xc1, 0xe1, 
-	0x02, 0x2c, 0x81, 0xe2, 0x00, 0x00, 0xe0, 0xe3, 0xb2, 0x00, 0xc2, 0xe1, 0x94, 0x0b, 0x9f, 0xe5, 
-	0xb0, 0x00, 0xc2, 0xe1, 0x01, 0x00, 0xa0, 0xe3, 0xb8, 0x00, 0xc2, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x0e, 0xc0, 0xa0, 0xe1, 0x0b, 0x00, 0x00, 0xeb, 0x00, 0x10, 0xa0, 0xe3, 0x05, 0x04, 0xa0, 0xe3, 
-	0x80, 0x20, 0xa0, 0xe3, 0x2a, 0xfe, 0xff, 0xeb, 0x6c, 0x1b, 0x9f, 0xe5, 0x6c, 0x0b, 0x9f, 0xe5, 
-	0x12, 0x2e, 0xa0, 0xe3, 0x26, 0xfe, 0xff, 0xeb, 0x64, 0x0b, 0x9f, 0xe5, 0x12, 0x2e, 0xa0, 0xe3, 
-	0x23, 0xfe, 0xff, 0xeb, 0x1c, 0xff, 0x2f, 0xe1, 0xff, 0x10, 0xe0, 0xe3, 0x54, 0x2b, 0x9f, 0xe5, 
-	0x00, 0x00, 0xa0, 0xe3, 0x01, 0x00, 0x11, 0xe3, 0x01, 0x02, 0x80, 0x13, 0x02, 0x00, 0x11, 0xe3, 
-	0x01, 0x04, 0x80, 0x13, 0x04, 0x00, 0x11, 0xe3, 0x01, 0x06, 0x80, 0x13, 0x08, 0x00, 0x11, 0xe3, 
-	0x01, 0x08, 0x80, 0x13, 0x10, 0x00, 0x11, 0xe3, 0x01, 0x0a, 0x80, 0x13, 0x20, 0x00, 0x11, 0xe3, 
-	0x01, 0x0c, 0x80, 0x13, 0x40, 0x00, 0x11, 0xe3, 0x10, 0x00, 0x80, 0x13, 0x80, 0x00, 0x11, 0xe3, 
-	0x01, 0x00, 0x80, 0x13, 0x04, 0x00, 0x82, 0xe4, 0x01, 0x10, 0x91, 0xe2, 0xeb, 0xff, 0xff, 0x1a, 
-	0x04, 0x0b, 0x9f, 0xe5, 0x04, 0x00, 0x82, 0xe4, 0x1e, 0xff, 0x2f, 0xe1, 0x08, 0x50, 0x2d, 0xe9, 
-	0xa5, 0x04, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x08, 0x00, 0x00, 0x1a, 0x40, 0x04, 0x9a, 0xe5, 
-	0x04, 0xe0, 0x8f, 0xe2, 0xe4, 0xca, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0x50, 0xe3, 
-	0x01, 0x00, 0xa0, 0x03, 0xd8, 0x1a, 0x9f, 0xe5, 0x00, 0x00, 0xc1, 0xe5, 0x74, 0x00, 0x00, 0xeb, 
-	0x00, 0x10, 0xa0, 0xe3, 0xcc, 0x0a, 0x9f, 0xe5, 0x30, 0x20, 0xa0, 0xe3, 0xf8, 0xfd, 0xff, 0xeb, 
-	0xc4, 0x0a, 0x9f, 0xe5, 0x40, 0x20, 0xa0, 0xe3, 0xf5, 0xfd, 0xff, 0xeb, 0xbc, 0x0a, 0x9f, 0xe5, 
-	0x80, 0x20, 0xa0, 0xe3, 0xf2, 0xfd, 0xff, 0xeb, 0xb4, 0x0a, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 
-	0xef, 0xfd, 0xff, 0xeb, 0xac, 0x0a, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 0xec, 0xfd, 0xff, 0xeb, 
-	0xa4, 0x0a, 0x9f, 0xe5, 0x84, 0x20, 0xa0, 0xe3, 0xe9, 0xfd, 0xff, 0xeb, 0x9c, 0x0a, 0x9f, 0xe5, 
-	0x01, 0x29, 0xa0, 0xe3, 0xe6, 0xfd, 0xff, 0xeb, 0x06, 0x04, 0xa0, 0xe3, 0x01, 0x29, 0xa0, 0xe3, 
-	0xe3, 0xfd, 0xff, 0xeb, 0x88, 0x0a, 0x9f, 0xe5, 0x01, 0x29, 0xa0, 0xe3, 0xe0, 0xfd, 0xff, 0xeb, 
-	0x80, 0x0a, 0x9f, 0xe5, 0x01, 0x29, 0xa0, 0xe3, 0xdd, 0xfd, 0xff, 0xeb, 0x78, 0x0a, 0x9f, 0xe5, 
-	0x03, 0x2a, 0xa0, 0xe3, 0xda, 0xfd, 0xff, 0xeb, 0xc8, 0x10, 0xa0, 0xe3, 0x6c, 0x0a, 0x9f, 0xe5, 
-	0xa0, 0x20, 0xa0, 0xe3, 0xd6, 0xfd, 0xff, 0xeb, 0x64, 0x0a, 0x9f, 0xe5, 0xa0, 0x20, 0xa0, 0xe3, 
-	0xd3, 0xfd, 0xff, 0xeb, 0x5c, 0x0a, 0x9f, 0xe5, 0xa0, 0x20, 0xa0, 0xe3, 0xd0, 0xfd, 0xff, 0xeb, 
-	0x00, 0x00, 0xa0, 0xe3, 0x0f, 0xe0, 0xa0, 0xe1, 0x4c, 0xfa, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x48, 0x1a, 0x9f, 0xe5, 0x00, 0x00, 0xc1, 0xe5, 0x0c, 0x00, 0x41, 0xe5, 0xe6, 0x04, 0xca, 0xe5, 
-	0xe7, 0x04, 0xca, 0xe5, 0xee, 0x04, 0xca, 0xe5, 0xef, 0x04, 0xca, 0xe5, 0xe9, 0x04, 0xca, 0xe5, 
-	0xf3, 0x04, 0xca, 0xe5, 0xf0, 0x04, 0xca, 0xe5, 0xf2, 0x04, 0xca, 0xe5, 0xf1, 0x04, 0xca, 0xe5, 
-	0xf4, 0x04, 0x8a, 0xe5, 0x91, 0x00, 0xa0, 0xe3, 0xe4, 0x04, 0xca, 0xe5, 0x02, 0x80, 0x88, 0xe3, 
-	0x01, 0x13, 0xa0, 0xe3, 0x08, 0x0a, 0x9f, 0xe5, 0xb2, 0x04, 0xc1, 0xe1, 0x04, 0x0a, 0x9f, 0xe5, 
-	0xb6, 0x04, 0xc1, 0xe1, 0x2e, 0x00, 0x00, 0xeb, 0xfc, 0x00, 0xa0, 0xe3, 0xeb, 0x04, 0xca, 0xe5, 
-	0xff, 0x00, 0xa0, 0xe3, 0xec, 0x04, 0xca, 0xe5, 0xed, 0x04, 0xca, 0xe5, 0x0d, 0x00, 0x00, 0xeb, 
-	0xff, 0x00, 0xa0, 0xe3, 0x2a, 0x05, 0xca, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xd8, 0xf9, 0x9f, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0xd4, 0xf9, 0x9f, 0xe5, 0x01, 0x00, 0x00, 0xeb, 0x08, 0x50, 0xbd, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x10, 0xa0, 0xe3, 0x00, 0x40, 0xa0, 0xe3, 
-	0xb0, 0x10, 0xd2, 0xe1, 0xa7, 0x41, 0x9c, 0xe7, 0x04, 0xe0, 0x2d, 0xe5, 0x9c, 0x19, 0x9f, 0xe5, 
-	0x00, 0x00, 0xd1, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xa4, 0xf9, 0x9f, 0xe5, 0xe9, 0x04, 0xda, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x9c, 0xf9, 0x9f, 0xe5, 0x00, 0x00, 0x00, 0xeb, 0x04, 0xf0, 0x9d, 0xe4, 
-	0x04, 0xe0, 0x2d, 0xe5, 0xeb, 0x04, 0xda, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x88, 0xf9, 0x9f, 0xe5, 
-	0xec, 0x04, 0xda, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x80, 0xf9, 0x9f, 0xe5, 0xed, 0x04, 0xda, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x78, 0xf9, 0x9f, 0xe5, 0x01, 0x00, 0x00, 0xeb, 0x04, 0xe0, 0x9d, 0xe4, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x6c, 0x19, 0x9f, 0xe5, 0x6c, 0x09, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 
-	0x68, 0xf9, 0x9f, 0xe5, 0xf0, 0x44, 0x2d, 0xe9, 0xcc, 0xa8, 0x9f, 0xe5, 0x60, 0x79, 0x9f, 0xe5, 
-	0x70, 0x15, 0x9a, 0xe5, 0x81, 0x10, 0x81, 0xe0, 0x01, 0x72, 0x87, 0xe0, 0x54, 0x69, 0x9f, 0xe5, 
-	0x10, 0x40, 0xa0, 0xe3, 0x01, 0x00, 0xd7, 0xe4, 0xa0, 0x01, 0xa0, 0xe1, 0x00, 0x50, 0xa0, 0xe1, 
-	0x01, 0x00, 0xd7, 0xe4, 0xa0, 0x01, 0xa0, 0xe1, 0x80, 0x52, 0x85, 0xe1, 0x01, 0x00, 0xd7, 0xe4, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x00, 0x55, 0x85, 0xe1, 0xb2, 0x50, 0xc6, 0xe0, 0x01, 0x40, 0x54, 0xe2, 
-	0xf3, 0xff, 0xff, 0x5a, 0xf0, 0x44, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0x18, 0xf9, 0x9f, 0xe5, 
-	0x18, 0x29, 0x9f, 0xe5, 0x01, 0x00, 0xd2, 0xe5, 0x01, 0x00, 0x50, 0xe2, 0x3b, 0x00, 0xa0, 0x43, 
-	0x01, 0x00, 0xc2, 0xe5, 0x1e, 0xff, 0x2f, 0x51, 0x04, 0xe0, 0x2d, 0xe5, 0x00, 0x19, 0x9f, 0xe5, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x11, 0xff, 0x2f, 0xe1, 0x04, 0xe0, 0x9d, 0xe4, 0xec, 0x28, 0x9f, 0xe5, 
-	0x00, 0x00, 0xd2, 0xe5, 0x01, 0x00, 0x10, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 0xe4, 0x08, 0x9f, 0xe5, 
-	0x00, 0x00, 0x90, 0xe5, 0x00, 0x00, 0x50, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 0xd8, 0x04, 0x9a, 0xe5, 
-	0x00, 0x00, 0x50, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 0x00, 0x10, 0xa0, 0xe3, 0xd8, 0x14, 0x8a, 0xe5, 
-	0x64, 0x10, 0xa0, 0xe3, 0x00, 0x00, 0x06, 0xef, 0x30, 0x00, 0x80, 0xe2, 0x03, 0x00, 0x42, 0xe5, 
-	0x01, 0x00, 0xa0, 0xe1, 0x0a, 0x10, 0xa0, 0xe3, 0x00, 0x00, 0x06, 0xef, 0x30, 0x00, 0x80, 0xe2, 
-	0x02, 0x00, 0x42, 0xe5, 0x30, 0x10, 0x81, 0xe2, 0x01, 0x10, 0x42, 0xe5, 0x98, 0x08, 0x9f, 0xe5, 
-	0x98, 0x28, 0x9f, 0xe5, 0x01, 0x10, 0xd0, 0xe4, 0x2a, 0x10, 0x51, 0xe2, 0x00, 0x10, 0xa0, 0xb3, 
-	0x05, 0x1a, 0x81, 0xe3, 0xb2, 0x10, 0xc2, 0xe0, 0x0f, 0x00, 0x12, 0xe3, 0xf8, 0xff, 0xff, 0x1a, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 0x02, 0x00, 0x00, 0xeb, 
-	0x14, 0x00, 0x00, 0xeb, 0x26, 0x00, 0x00, 0xeb, 0x00, 0x80, 0xbd, 0xe8, 0x00, 0x40, 0x2d, 0xe9, 
-	0xeb, 0x04, 0xda, 0xe5, 0x2c, 0x28, 0x9f, 0xe5, 0x38, 0xc8, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x4c, 0xf8, 0x9f, 0xe5, 0x4c, 0x28, 0x9f, 0xe5, 0x4c, 0xc8, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x3c, 0xf8, 0x9f, 0xe5, 0x44, 0x28, 0x9f, 0xe5, 0x44, 0xc8, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x2c, 0xf8, 0x9f, 0xe5, 0x3c, 0x28, 0x9f, 0xe5, 0x3c, 0xc8, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x1c, 0xf8, 0x9f, 0xe5, 0x00, 0x80, 0xbd, 0xe8, 0x00, 0x40, 0x2d, 0xe9, 0xec, 0x04, 0xda, 0xe5, 
-	0x28, 0x28, 0x9f, 0xe5, 0xec, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x00, 0xf8, 0x9f, 0xe5, 
-	0x1c, 0x28, 0x9f, 0xe5, 0x00, 0xc8, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xf0, 0xf7, 0x9f, 0xe5, 
-	0x10, 0x28, 0x9f, 0xe5, 0xf8, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xe0, 0xf7, 0x9f, 0xe5, 
-	0x04, 0x28, 0x9f, 0xe5, 0xf0, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xd0, 0xf7, 0x9f, 0xe5, 
-	0x00, 0x80, 0xbd, 0xe8, 0x00, 0x40, 0x2d, 0xe9, 0xed, 0x04, 0xda, 0xe5, 0xec, 0x27, 0x9f, 0xe5, 
-	0xa0, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xb4, 0xf7, 0x9f, 0xe5, 0xe0, 0x27, 0x9f, 0xe5, 
-	0xb4, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xa4, 0xf7, 0x9f, 0xe5, 0xd4, 0x27, 0x9f, 0xe5, 
-	0xac, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x94, 0xf7, 0x9f, 0xe5, 0xc8, 0x27, 0x9f, 0xe5, 
-	0xa4, 0xc7, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x84, 0xf7, 0x9f, 0xe5, 0x00, 0x80, 0xbd, 0xe8, 
-	0x18, 0x40, 0x2d, 0xe9, 0x66, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x18, 0x00, 0x00, 0x1b, 
-	0xe0, 0x06, 0x9f, 0xe5, 0x00, 0x10, 0x90, 0xe5, 0x18, 0x20, 0x90, 0xe5, 0x02, 0x10, 0x91, 0xe1, 
-	0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xa0, 0xe3, 0xd4, 0x16, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 
-	0xd0, 0x16, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0x80, 0x07, 0x9f, 0xe5, 0xc8, 0x36, 0x9f, 0xe5, 
-	0x7c, 0x47, 0x9f, 0xe5, 0x04, 0x20, 0x93, 0xe4, 0x04, 0x20, 0x84, 0xe4, 0x02, 0x28, 0xb0, 0xe1, 
-	0x03, 0x00, 0x00, 0x0a, 0x22, 0x28, 0xa0, 0xe1, 0x04, 0x10, 0x93, 0xe4, 0x53, 0x0d, 0x00, 0xeb, 
-	0xf7, 0xff, 0xff, 0xea, 0x01, 0x00, 0xa0, 0xe3, 0x65, 0x05, 0xca, 0xe5, 0x66, 0x05, 0xca, 0xe5, 
-	0x18, 0x80, 0xbd, 0xe8, 0xf8, 0x4f, 0x2d, 0xe9, 0x0f, 0xe0, 0xa0, 0xe1, 0x44, 0xf7, 0x9f, 0xe5, 
-	0xf8, 0x8f, 0xbd, 0xe8, 0x53, 0x4e, 0x8a, 0xe2, 0x0f, 0x00, 0x94, 0xe8, 0x1f, 0x40, 0x2d, 0xe9, 
-	0x4c, 0x15, 0x9a, 0xe5, 0x01, 0x10, 0x81, 0xe3, 0x0f, 0xe0, 0xa0, 0xe1, 0x28, 0xf7, 0x9f, 0xe5, 
-	0x01, 0x23, 0xa0, 0xe3, 0x60, 0x15, 0x9a, 0xe5, 0xf8, 0x01, 0x91, 0xe8, 0x30, 0x15, 0x9a, 0xe5, 
-	0x01, 0x40, 0xc4, 0xe1, 0x34, 0x15, 0x9a, 0xe5, 0x01, 0x40, 0x84, 0xe1, 0x4c, 0x15, 0x9a, 0xe5, 
-	0x02, 0x10, 0x11, 0xe2, 0x44, 0x05, 0x9a, 0xe5, 0x40, 0x85, 0x9a, 0xe5, 0x00, 0x88, 0x88, 0xe1, 
-	0x08, 0x70, 0xa0, 0x11, 0x3c, 0x85, 0x9a, 0x15, 0x01, 0x10, 0x81, 0xe3, 0x02, 0x00, 0x51, 0xe3, 
-	0xe8, 0x06, 0x9f, 0xd5, 0x03, 0x00, 0x51, 0xe3, 0xe4, 0x06, 0x9f, 0x05, 0x48, 0x00, 0x82, 0xe5, 
-	0x08, 0x10, 0x82, 0xe2, 0xf8, 0x01, 0x81, 0xe8, 0x00, 0x00, 0xa0, 0xe3, 0xb0, 0x04, 0xc2, 0xe1, 
-	0x58, 0x15, 0x9a, 0xe5, 0xb0, 0x00, 0xd1, 0xe1, 0x02, 0x0a, 0xc0, 0xe3, 0xb0, 0x00, 0xc2, 0xe1, 
-	0xc0, 0x06, 0x9f, 0xe5, 0xb4, 0x00, 0xc2, 0xe1, 0x1f, 0x40, 0xbd, 0xe8, 0x0f, 0x00, 0x84, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x53, 0x2e, 0x8a, 0xe2, 0xf0, 0x00, 0x92, 0xe8, 0xff, 0x04, 0x14, 0xe3, 
-	0x1e, 0xff, 0x2f, 0x01, 0x60, 0x15, 0x9a, 0xe5, 0x90, 0x20, 0xa0, 0xe3, 0xff, 0x0c, 0x14, 0xe3, 
-	0x94, 0xf6, 0x9f, 0x05, 0x04, 0x50, 0x81, 0xe5, 0x10, 0x60, 0x81, 0xe5, 0x14, 0x70, 0x81, 0xe5, 
-	0x18, 0x10, 0x81, 0xe2, 0x01, 0x20, 0x52, 0xe2, 0xf9, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x07, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x12, 0xe3, 0xdf, 0x20, 0xa0, 0x03, 0xbf, 0x20, 0xa0, 0x13, 
-	0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x5c, 0xe3, 0x04, 0x20, 0xc2, 0x03, 0x01, 0x00, 0x5c, 0xe3, 
-	0x08, 0x20, 0xc2, 0x03, 0x54, 0xf6, 0x9f, 0xe5, 0x53, 0xce, 0x8a, 0xe2, 0x0f, 0x00, 0x9c, 0xe8, 
-	0x0f, 0x40, 0x2d, 0xe9, 0x4c, 0x15, 0x9a, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x28, 0xf6, 0x9f, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x38, 0xf6, 0x9f, 0xe5, 0x0f, 0x40, 0xbd, 0xe8, 0x0f, 0x00, 0x8c, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x2c, 0x26, 0x9f, 0xe5, 0x80, 0x12, 0x92, 0xe7, 0x00, 0x10, 0x82, 0xe5, 
-	0x04, 0x20, 0x82, 0xe2, 0x80, 0x12, 0x92, 0xe7, 0x00, 0x10, 0x82, 0xe5, 0x18, 0x26, 0x9f, 0xe5, 
-	0x00, 0x13, 0x92, 0xe7, 0x00, 0x10, 0x82, 0xe5, 0x04, 0x20, 0x82, 0xe2, 0x00, 0x13, 0x92, 0xe7, 
-	0x00, 0x10, 0x82, 0xe5, 0x1c, 0x20, 0x82, 0xe2, 0x00, 0x13, 0x92, 0xe7, 0x00, 0x10, 0x82, 0xe5, 
-	0x04, 0x20, 0x82, 0xe2, 0x00, 0x13, 0x92, 0xe7, 0x00, 0x10, 0x82, 0xe5, 0xec, 0xf5, 0x9f, 0xe5, 
-	0xa5, 0x04, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x00, 0x00, 0xe0, 0xe3, 0x05, 0x00, 0x00, 0x1a, 
-	0x04, 0x20, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3, 0x04, 0x00, 0x52, 0xe3, 0x44, 0x05, 0x9f, 0x05, 
-	0xb0, 0x00, 0xd0, 0x01, 0x00, 0x08, 0x80, 0x01, 0x00, 0x10, 0xa0, 0xe1, 0x10, 0x20, 0xa0, 0xe3, 
-	0xbc, 0xf5, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0xe4, 0x05, 0xca, 0xe5, 0x00, 0x40, 0x2d, 0xe9, 
-	0xb0, 0x45, 0x9f, 0xe5, 0xb0, 0x55, 0x9f, 0xe5, 0x40, 0x90, 0xa0, 0xe3, 0x2d, 0x15, 0xda, 0xe5, 
-	0x01, 0x10, 0xb0, 0xe1, 0x04, 0x00, 0x00, 0x0a, 0x0f, 0xe0, 0xa0, 0xe1, 0x9c, 0xf5, 0x9f, 0xe5, 
-	0x01, 0x90, 0x59, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 0x00, 0x80, 0xbd, 0xe8, 0x04, 0x00, 0x95, 0xe4, 
-	0x04, 0x00, 0x84, 0xe4, 0x02, 0x90, 0x59, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 0x00, 0x80, 0xbd, 0xe8, 
-	0x03, 0x00, 0xa0, 0xe3, 0x64, 0x05, 0xca, 0xe5, 0xfc, 0x04, 0x9a, 0xe5, 0x6c, 0x25, 0x9a, 0xe5, 
-	0xfc, 0x24, 0x8a, 0xe5, 0x6c, 0x05, 0x8a, 0xe5, 0x03, 0x50, 0x2d, 0xe9, 0x74, 0xff, 0xff, 0xeb, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x58, 0xf5, 0x9f, 0xe5, 0x02, 0x00, 0xa0, 0xe3, 0x66, 0x05, 0xca, 0xe5, 
-	0x03, 0x50, 0xbd, 0xe8, 0x4c, 0xf5, 0x9f, 0xe5, 0x01, 0x03, 0xa0, 0xe3, 0x00, 0x12, 0xd0, 0xe5, 
-	0x01, 0x10, 0x81, 0xe3, 0x00, 0x12, 0xc0, 0xe5, 0x08, 0x12, 0xc0, 0xe5, 0x00, 0x00, 0x0f, 0xe1, 
-	0x80, 0x00, 0xc0, 0xe3, 0x00, 0xf0, 0x29, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x0e, 0xc0, 0xa0, 0xe1, 
-	0xf4, 0xff, 0xff, 0xeb, 0x0c, 0xe0, 0xa0, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 0x01, 0x10, 0xa0, 0xe3, 
-	0x00, 0x00, 0x04, 0xef, 0x01, 0x13, 0xa0, 0xe3, 0x08, 0x00, 0x51, 0xe5, 0x01, 0x00, 0xc0, 0xe3, 
-	0x08, 0x00, 0x41, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x10, 0x2d, 0xe9, 0x02, 0x00, 0x59, 0xe5, 
-	0x01, 0x10, 0x59, 0xe5, 0xf0, 0x00, 0x50, 0xe3, 0x41, 0x00, 0x51, 0x03, 0x05, 0x00, 0x00, 0x0a, 
-	0xcb, 0x00, 0x50, 0xe3, 0x4e, 0x00, 0x51, 0x03, 0x3d, 0x00, 0x00, 0x0a, 0xa6, 0x00, 0x51, 0xe3, 
-	0x41, 0x00, 0x00, 0x0a, 0x51, 0x00, 0x00, 0xea, 0x00, 0x00, 0xd9, 0xe5, 0x01, 0x10, 0xd9, 0xe5, 
-	0x02, 0x20, 0xd9, 0xe5, 0x03, 0xc0, 0xd9, 0xe5, 0xe6, 0x00, 0x50, 0xe3, 0x05, 0x00, 0x00, 0x0a, 
-	0xcb, 0x00, 0x50, 0xe3, 0x4f, 0x00, 0x51, 0x03, 0x25, 0x00, 0x00, 0x0a, 0xa1, 0x00, 0x50, 0xe3, 
-	0x2c, 0x00, 0x00, 0x0a, 0x45, 0x00, 0x00, 0xea, 0x20, 0x00, 0x52, 0xe3, 0xfa, 0x00, 0x5c, 0x03, 
-	0x0b, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x52, 0xe3, 0xfa, 0x00, 0x5c, 0x03, 0x0d, 0x00, 0x00, 0x0a, 
-	0x03, 0x00, 0x51, 0xe3, 0xfe, 0x00, 0x52, 0x03, 0x01, 0x00, 0x5c, 0x03, 0x0c, 0x00, 0x00, 0x0a, 
-	0x03, 0x00, 0x51, 0xe3, 0x3d, 0x00, 0x52, 0x03, 0xc8, 0x00, 0x5c, 0x03, 0x0e, 0x00, 0x00, 0x0a, 
-	0x36, 0x00, 0x00, 0xea, 0x02, 0x00, 0x51, 0xe3, 0x28, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x51, 0xe3, 
-	0x22, 0x00, 0x00, 0x0a, 0x31, 0x00, 0x00, 0xea, 0x03, 0x00, 0x51, 0xe3, 0x2d, 0x00, 0x00, 0x0a, 
-	0x2e, 0x00, 0x00, 0xea, 0x04, 0x10, 0xd9, 0xe5, 0x05, 0x20, 0xd9, 0xe5, 0x20, 0x00, 0x51, 0xe3, 
-	0xf8, 0x00, 0x52, 0x03, 0x21, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x00, 0xea, 0x04, 0x10, 0xd9, 0xe5, 
-	0x05, 0x20, 0xd9, 0xe5, 0x18, 0x00, 0x51, 0xe3, 0xf8, 0x00, 0x52, 0x03, 0x1d, 0x00, 0x00, 0x0a, 
-	0x22, 0x00, 0x00, 0xea, 0x20, 0x00, 0x52, 0xe3, 0xfa, 0x00, 0x5c, 0x03, 0x13, 0x00, 0x00, 0x0a, 
-	0x04, 0x00, 0xd9, 0xe5, 0x4f, 0x00, 0x52, 0xe3, 0x18, 0x00, 0x5c, 0x03, 0xf9, 0x00, 0x50, 0x03, 
-	0x10, 0x00, 0x00, 0x0a, 0x19, 0x00, 0x00, 0xea, 0x20, 0x00, 0x51, 0xe3, 0xfb, 0x00, 0x52, 0x03, 
-	0x12, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xd9, 0xe5, 0x01, 0x10, 0xd9, 0xe5, 0x20, 0x00, 0x50, 0xe3, 
-	0xfc, 0x00, 0x51, 0x03, 0x03, 0x00, 0x00, 0x0a, 0x10, 0x00, 0x00, 0xea, 0x0f, 0x00, 0x00, 0xea, 
-	0xc4, 0xc3, 0x9f, 0xe5, 0x0e, 0x00, 0x00, 0xea, 0xc0, 0xc3, 0x9f, 0xe5, 0x0c, 0x00, 0x00, 0xea, 
-	0xbc, 0xc3, 0x9f, 0xe5, 0x0a, 0x00, 0x00, 0xea, 0xb8, 0xc3, 0x9f, 0xe5, 0x08, 0x00, 0x00, 0xea, 
-	0xb4, 0xc3, 0x9f, 0xe5, 0x06, 0x00, 0x00, 0xea, 0xb0, 0xc3, 0x9f, 0xe5, 0x04, 0x00, 0x00, 0xea, 
-	0xac, 0xc3, 0x9f, 0xe5, 0x02, 0x00, 0x00, 0xea, 0xa8, 0xc3, 0x9f, 0xe5, 0x00, 0x00, 0x00, 0xea, 
-	0xa4, 0xc3, 0x9f, 0xe5, 0x20, 0x06, 0x9a, 0xe5, 0x28, 0x06, 0x8a, 0xe5, 0x24, 0x06, 0x9a, 0xe5, 
-	0x2c, 0x06, 0x8a, 0xe5, 0x18, 0x06, 0x9a, 0xe5, 0x20, 0x06, 0x8a, 0xe5, 0x1c, 0x06, 0x9a, 0xe5, 
-	0x24, 0x06, 0x8a, 0xe5, 0x10, 0x06, 0x9a, 0xe5, 0x18, 0x06, 0x8a, 0xe5, 0x14, 0x06, 0x9a, 0xe5, 
-	0x1c, 0x06, 0x8a, 0xe5, 0x10, 0x96, 0x8a, 0xe5, 0x14, 0xc6, 0x8a, 0xe5, 0x0c, 0x10, 0xa0, 0xe1, 
-	0x01, 0x10, 0xbd, 0xe8, 0x11, 0xff, 0x2f, 0xe1, 0x02, 0x10, 0x59, 0xe5, 0x01, 0x20, 0x59, 0xe5, 
-	0xf0, 0x00, 0x51, 0xe3, 0x44, 0x00, 0x52, 0x03, 0x02, 0x00, 0x00, 0x0a, 0xbe, 0x00, 0x52, 0xe3, 
-	0x3d, 0x00, 0x00, 0x0a, 0x44, 0x00, 0x00, 0xea, 0x00, 0x10, 0xd9, 0xe5, 0x02, 0x20, 0xd9, 0xe5, 
-	0xfe, 0x00, 0x51, 0xe3, 0x09, 0x00, 0x00, 0x0a, 0x01, 0x20, 0xd9, 0xe5, 0xb8, 0x00, 0x51, 0xe3, 
-	0x11, 0x00, 0x00, 0x0a, 0xb9, 0x00, 0x51, 0xe3, 0x18, 0x00, 0x00, 0x0a, 0xba, 0x00, 0x51, 0xe3, 
-	0x1f, 0x00, 0x00, 0x0a, 0xbb, 0x00, 0x51, 0xe3, 0x26, 0x00, 0x00, 0x0a, 0x36, 0x00, 0x00, 0xea, 
-	0x03, 0x10, 0xd9, 0xe5, 0xfa, 0x00, 0x51, 0xe3, 0x33, 0x00, 0x00, 0x1a, 0xfc, 0x12, 0x9f, 0xe5, 
-	0x20, 0x00, 0x52, 0xe3, 0xf8, 0x12, 0x9f, 0x05, 0x38, 0x00, 0x52, 0xe3, 0xf4, 0x12, 0x9f, 0x05, 
-	0x30, 0x00, 0x52, 0xe3, 0xf0, 0x12, 0x9f, 0x05, 0x2c, 0x00, 0x00, 0xea, 0x02, 0x10, 0xd9, 0xe5, 
-	0xfb, 0x00, 0x51, 0xe3, 0x28, 0x00, 0x00, 0x1a, 0xd0, 0x12, 0x9f, 0xe5, 0x20, 0x00, 0x52, 0xe3, 
-	0xd8, 0x12, 0x9f, 0x05, 0x38, 0x00, 0x52, 0xe3, 0xd4, 0x12, 0x9f, 0x05, 0x23, 0x00, 0x00, 0xea, 
-	0x02, 0x10, 0xd9, 0xe5, 0xfb, 0x00, 0x51, 0xe3, 0x1f, 0x00, 0x00, 0x1a, 0xac, 0x12, 0x9f, 0xe5, 
-	0x20, 0x00, 0x52, 0xe3, 0xbc, 0x12, 0x9f, 0x05, 0x38, 0x00, 0x52, 0xe3, 0xb8, 0x12, 0x9f, 0x05, 
-	0x1a, 0x00, 0x00, 0xea, 0x02, 0x10, 0xd9, 0xe5, 0xfb, 0x00, 0x51, 0xe3, 0x16, 0x00, 0x00, 0x1a, 
-	0x88, 0x12, 0x9f, 0xe5, 0x20, 0x00, 0x52, 0xe3, 0xa0, 0x12, 0x9f, 0x05, 0x38, 0x00, 0x52, 0xe3, 
-	0x9c, 0x12, 0x9f, 0x05, 0x11, 0x00, 0x00, 0xea, 0x02, 0x10, 0xd9, 0xe5, 0xfb, 0x00, 0x51, 0xe3, 
-	0x0d, 0x00, 0x00, 0x1a, 0x64, 0x12, 0x9f, 0xe5, 0x20, 0x00, 0x52, 0xe3, 0x84, 0x12, 0x9f, 0x05, 
-	0x38, 0x00, 0x52, 0xe3, 0x80, 0x12, 0x9f, 0x05, 0x08, 0x00, 0x00, 0xea, 0x01, 0x10, 0xd9, 0xe5, 
-	0xfd, 0x00, 0x51, 0xe3, 0x04, 0x00, 0x00, 0x1a, 0x40, 0x12, 0x9f, 0xe5, 0x00, 0x20, 0xd9, 0xe5, 
-	0x20, 0x00, 0x52, 0xe3, 0x64, 0x12, 0x9f, 0x05, 0x00, 0x00, 0x00, 0xea, 0x2c, 0x12, 0x9f, 0xe5, 
-	0x30, 0x26, 0x9a, 0xe5, 0x38, 0x26, 0x8a, 0xe5, 0x34, 0x26, 0x9a, 0xe5, 0x3c, 0x26, 0x8a, 0xe5, 
-	0x30, 0x96, 0x8a, 0xe5, 0x34, 0x16, 0x8a, 0xe5, 0x11, 0xff, 0x2f, 0xe1, 0x40, 0x00, 0x12, 0xe3, 
-	0x1e, 0xff, 0x2f, 0x01, 0x04, 0x00, 0x10, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0xa2, 0x04, 0xda, 0xe5, 
-	0x02, 0x00, 0x80, 0xe3, 0xa2, 0x04, 0xca, 0xe5, 0x24, 0xf2, 0x9f, 0xe5, 0xeb, 0x04, 0xca, 0xe5, 
-	0xa5, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0xa6, 0x14, 0xda, 0xe5, 
-	0x00, 0x00, 0x51, 0xe3, 0x30, 0xfe, 0xff, 0x1a, 0xf8, 0x20, 0x9f, 0xe5, 0x04, 0xc1, 0x9f, 0xe5, 
-	0x04, 0xe0, 0x2d, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x14, 0xf1, 0x9f, 0xe5, 0x04, 0xe0, 0x9d, 0xe4, 
-	0x10, 0x21, 0x9f, 0xe5, 0x18, 0xc1, 0x9f, 0xe5, 0x04, 0xf1, 0x9f, 0xe5, 0xec, 0x04, 0xca, 0xe5, 
-	0xa5, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0xa6, 0x14, 0xda, 0xe5, 
-	0x00, 0x00, 0x51, 0xe3, 0x33, 0xfe, 0xff, 0x1a, 0x00, 0x21, 0x9f, 0xe5, 0xf0, 0xc0, 0x9f, 0xe5, 
-	0xdc, 0xf0, 0x9f, 0xe5, 0xed, 0x04, 0xca, 0xe5, 0xa5, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 
-	0x1e, 0xff, 0x2f, 0x11, 0xa6, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 0x3c, 0xfe, 0xff, 0x1a, 
-	0xe8, 0x20, 0x9f, 0xe5, 0xd0, 0xc0, 0x9f, 0xe5, 0xb4, 0xf0, 0x9f, 0xe5, 0x68, 0x51, 0x00, 0x03, 
-	0xfc, 0x7f, 0x00, 0x03, 0xf8, 0x2c, 0x00, 0x03, 0x85, 0x10, 0x00, 0x00, 0x40, 0x5f, 0x40, 0x5f, 
-	0x48, 0xac, 0x02, 0x02, 0x88, 0x9c, 0x02, 0x02, 0x7c, 0x79, 0x00, 0x03, 0xef, 0xbe, 0xad, 0xde, 
-	0xe1, 0x02, 0x00, 0x08, 0xd8, 0x56, 0x00, 0x03, 0xdc, 0x99, 0x02, 0x02, 0x9c, 0x99, 0x02, 0x02, 
-	0x5c, 0x98, 0x02, 0x02, 0x9c, 0x97, 0x02, 0x02, 0xdc, 0x96, 0x02, 0x02, 0x18, 0x96, 0x02, 0x02, 
-	0x00, 0x40, 0x03, 0x02, 0x00, 0x80, 0x00, 0x06, 0x00, 0x40, 0x01, 0x06, 0x00, 0x50, 0x00, 0x06, 
-	0x48, 0xbd, 0x02, 0x02, 0xa8, 0xbc, 0x02, 0x02, 0x08, 0xbc, 0x02, 0x02, 0x6c, 0x3a, 0x00, 0x03, 
-	0x00, 0x50, 0x00, 0x03, 0xc8, 0x28, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00, 0x64, 0xf6, 0x00, 0x06, 
-	0xbc, 0x31, 0x00, 0x03, 0xcc, 0x4f, 0x00, 0x03, 0x54, 0x50, 0x00, 0x03, 0xbc, 0x63, 0x00, 0x08, 
-	0xfc, 0x63, 0x00, 0x08, 0x24, 0x64, 0x00, 0x08, 0x7c, 0x78, 0x00, 0x03, 0xfc, 0x78, 0x00, 0x03, 
-	0xa4, 0x45, 0x00, 0x03, 0xa0, 0x76, 0x00, 0x08, 0xc0, 0xdf, 0x02, 0x02, 0xc8, 0x33, 0x00, 0x03, 
-	0x00, 0x3c, 0x00, 0x03, 0x6d, 0x19, 0x00, 0x08, 0xa8, 0x56, 0x00, 0x03, 0xf8, 0x3b, 0x00, 0x03, 
-	0xc0, 0x4a, 0x00, 0x06, 0xe4, 0x39, 0x00, 0x03, 0x84, 0x78, 0x00, 0x03, 0xc8, 0xdf, 0x02, 0x02, 
-	0x8c, 0x78, 0x00, 0x03, 0xd0, 0xdf, 0x02, 0x02, 0x94, 0x78, 0x00, 0x03, 0xd8, 0xdf, 0x02, 0x02, 
-	0xbc, 0x78, 0x00, 0x03, 0xcc, 0x78, 0x00, 0x03, 0xdc, 0x78, 0x00, 0x03, 0xec, 0x78, 0x00, 0x03, 
-	0xc4, 0x78, 0x00, 0x03, 0xd4, 0x78, 0x00, 0x03, 0xe4, 0x78, 0x00, 0x03, 0xf4, 0x78, 0x00, 0x03, 
-	0x00, 0xe2, 0x00, 0x06, 0x1c, 0x99, 0x02, 0x02, 0x50, 0x48, 0x00, 0x03, 0xc4, 0x31, 0x00, 0x03, 
-	0xfa, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0xec, 0xff, 0x28, 0x07, 0x00, 0x00, 0x44, 0x31, 0x00, 0x03, 
-	0xac, 0x31, 0x00, 0x03, 0xa4, 0x5e, 0x00, 0x08, 0x00, 0x01, 0x00, 0x05, 0x00, 0x02, 0x00, 0x05, 
-	0x5c, 0x34, 0x00, 0x03, 0x9c, 0x34, 0x00, 0x03, 0x20, 0x00, 0x00, 0x05, 0x80, 0xef, 0x00, 0x06, 
-	0xb0, 0x34, 0x00, 0x03, 0xa4, 0x47, 0x00, 0x03, 0x88, 0x35, 0x00, 0x03, 0x00, 0x38, 0x00, 0x03, 
-	0xbc, 0x37, 0x00, 0x03, 0xcc, 0x37, 0x00, 0x03, 0xc4, 0x37, 0x00, 0x03, 0x24, 0x38, 0x00, 0x03, 
-	0x1c, 0x38, 0x00, 0x03, 0x38, 0x38, 0x00, 0x03, 0x54, 0x38, 0x00, 0x03, 0xb8, 0x37, 0x00, 0x03, 
-	0x8c, 0x39, 0x00, 0x03, 0x20, 0x39, 0x00, 0x03, 0x00, 0x39, 0x00, 0x03, 0x10, 0x39, 0x00, 0x03, 
-	0x70, 0x39, 0x00, 0x03, 0x48, 0x39, 0x00, 0x03, 0x64, 0x39, 0x00, 0x03, 0x3c, 0x39, 0x00, 0x03, 
-	0x84, 0x39, 0x00, 0x03, 0x5c, 0x39, 0x00, 0x03, 0x78, 0x39, 0x00, 0x03, 0x50, 0x39, 0x00, 0x03, 
-	0x34, 0x39, 0x00, 0x03, 0x1c, 0x4c, 0x00, 0x03, 0xe7, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0xe6, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x0e, 0xf0, 0xa0, 0xe1, 0xeb, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xec, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xed, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xef, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xee, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xf0, 0x04, 0xda, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x14, 0xda, 0xe5, 
-	0x3f, 0x10, 0x01, 0xe2, 0xa8, 0x00, 0x9f, 0xe5, 0x01, 0x00, 0xd0, 0xe7, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xf2, 0x04, 0xda, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf2, 0x14, 0xda, 0xe5, 0x3f, 0x10, 0x01, 0xe2, 
-	0x90, 0x00, 0x9f, 0xe5, 0x01, 0x00, 0xd0, 0xe7, 0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x04, 0xca, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf2, 0x04, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x18, 0x44, 0x2d, 0xe9, 
-	0x74, 0xa0, 0x9f, 0xe5, 0x82, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x38, 0x10, 0x8f, 0x12, 
-	0x00, 0x41, 0x91, 0x17, 0x01, 0x00, 0xa0, 0x13, 0x3c, 0x30, 0x8f, 0xe2, 0x00, 0x21, 0xb3, 0xe7, 
-	0x58, 0x10, 0x9f, 0xe5, 0x00, 0x20, 0x81, 0xe5, 0x06, 0x1c, 0x8a, 0xe2, 0x00, 0x10, 0x81, 0xe2, 
-	0x08, 0x20, 0xb3, 0xe5, 0x00, 0x20, 0x81, 0xe5, 0x00, 0x40, 0x82, 0x15, 0x08, 0x20, 0xb3, 0xe5, 
-	0x04, 0x20, 0x81, 0xe5, 0x00, 0x40, 0x82, 0x15, 0x18, 0x44, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x00, 0x80, 0x48, 0xe2, 0x02, 0x8c, 0x48, 0xe2, 0x0f, 0x8c, 0x48, 0xe2, 0xdc, 0x38, 0x00, 0x03, 
-	0x90, 0x39, 0x00, 0x03, 0x00, 0x50, 0x00, 0x03, 0xfc, 0x4f, 0x00, 0x03, 0xf4, 0x4f, 0x00, 0x03, 
-	0xf0, 0x4f, 0x00, 0x03, 0x7c, 0x78, 0x00, 0x03, 0xbc, 0x78, 0x00, 0x03, 0x68, 0x51, 0x00, 0x03, 
-	0xb0, 0x3e, 0x00, 0x03, 0x0b, 0xb0, 0xa0, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xff, 0xef, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0x12, 0xef, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 
-	0x01, 0x10, 0xa0, 0xe3, 0x00, 0x00, 0x04, 0xef, 0x1e, 0xff, 0x2f, 0xe1, 0x6c, 0x00, 0x9f, 0xe5, 
-	0x00, 0xc0, 0xa0, 0xe3, 0x00, 0x00, 0x0d, 0xef, 0x64, 0x10, 0x9f, 0xe5, 0x01, 0x00, 0x50, 0xe1, 
-	0x01, 0xc0, 0xa0, 0x03, 0x5c, 0x10, 0x9f, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x02, 0xc0, 0xa0, 0x03, 
-	0x54, 0x10, 0x9f, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x04, 0xc0, 0xa0, 0x03, 0x0c, 0x00, 0xa0, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x10, 0xff, 0x2f, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3, 
-	0xba, 0x0b, 0xc1, 0xe1, 0xb6, 0x0c, 0xc1, 0xe1, 0xb2, 0x0d, 0xc1, 0xe1, 0xbe, 0x0d, 0xc1, 0xe1, 
-	0x02, 0x1c, 0x81, 0xe2, 0x08, 0x00, 0x81, 0xe5, 0x20, 0x00, 0x9f, 0xe5, 0x20, 0x10, 0x9f, 0xe5, 
-	0x20, 0x20, 0x9f, 0xe5, 0x01, 0x20, 0x42, 0xe0, 0x00, 0xe0, 0xa0, 0xe1, 0x81, 0xfa, 0xff, 0xea, 
-	0x6e, 0x7a, 0xb0, 0x5a, 0x7e, 0x68, 0xbe, 0xab, 0x7f, 0x18, 0xae, 0xba, 0x80, 0x18, 0xae, 0xba, 
-	0x00, 0x40, 0x03, 0x02, 0xac, 0x67, 0x00, 0x08, 0x68, 0x69, 0x00, 0x08, 0xcc, 0x20, 0x8f, 0xe2, 
-	0x5e, 0x3f, 0x8f, 0xe2, 0x00, 0x40, 0xa0, 0xe3, 0x00, 0x50, 0xa0, 0xe3, 0x9c, 0x11, 0x9f, 0xe5, 
-	0x27, 0x00, 0x00, 0xeb, 0x1c, 0x10, 0xa0, 0xe3, 0x1f, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xa0, 0xe3, 
-	0x8c, 0x11, 0x9f, 0xe5, 0xb0, 0x00, 0xc1, 0xe1, 0x08, 0x00, 0xa0, 0xe3, 0x00, 0x00, 0x01, 0xef, 
-	0x00, 0x00, 0x00, 0xef, 0x04, 0x40, 0xb0, 0xe1, 0x07, 0x00, 0x00, 0x1a, 0x04, 0xc0, 0x92, 0xe4, 
-	0x0c, 0xc0, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x08, 0x5c, 0xe3, 0x1e, 0xff, 0x2f, 0xc1, 
-	0x01, 0x40, 0x4c, 0xe2, 0x04, 0xc0, 0x92, 0xe4, 0x1e, 0xff, 0x2f, 0xe1, 0x04, 0xc0, 0x12, 0xe5, 
-	0x01, 0x40, 0x44, 0xe2, 0x1e, 0xff, 0x2f, 0xe1, 0x05, 0x50, 0xb0, 0xe1, 0x07, 0x00, 0x00, 0x1a, 
-	0xb2, 0x00, 0xd3, 0xe0, 0x00, 0x00, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x02, 0x0c, 0x50, 0xe3, 
-	0x1e, 0xff, 0x2f, 0xc1, 0x01, 0x50, 0x40, 0xe2, 0xb2, 0x00, 0xd3, 0xe0, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xb2, 0x00, 0x53, 0xe1, 0x01, 0x50, 0x45, 0xe2, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 
-	0xe3, 0xff, 0xff, 0xeb, 0xb0, 0x00, 0xdc, 0xe1, 0x01, 0x10, 0x51, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 
-	0x00, 0x80, 0xbd, 0xe8, 0x00, 0x40, 0x2d, 0xe9, 0xdd, 0xff, 0xff, 0xeb, 0xe9, 0xff, 0xff, 0xeb, 
-	0xb0, 0x00, 0xcc, 0xe1, 0x01, 0x10, 0x51, 0xe2, 0xfa, 0xff, 0xff, 0x1a, 0x00, 0x80, 0xbd, 0xe8, 
-	0x00, 0x00, 0xfe, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x08, 
-	0x00, 0x00, 0x88, 0x09, 0x00, 0x00, 0xfc, 0x09, 0x04, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x09, 
-	0xa8, 0xec, 0x30, 0x09, 0xe9, 0x03, 0x00, 0x00, 0x8a, 0x46, 0x02, 0x08, 0xa8, 0xec, 0x30, 0x09, 
-	0x8a, 0x46, 0x02, 0x08, 0x00, 0xa8, 0xec, 0x08, 0xa0, 0x68, 0x02, 0x08, 0xf4, 0x01, 0x00, 0x00, 
-	0x8a, 0x46, 0x02, 0x08, 0xa8, 0xec, 0x30, 0x09, 0x2e, 0x59, 0x6b, 0x09, 0x02, 0x00, 0xe0, 0x08, 
-	0x0e, 0x00, 0x00, 0x08, 0xfc, 0x1f, 0x80, 0x08, 0x4a, 0x10, 0x00, 0x08, 0x12, 0x06, 0x80, 0x08, 
-	0x00, 0x00, 0x00, 0x08, 0x66, 0x1b, 0x80, 0x08, 0x08, 0x00, 0x80, 0x08, 0x0e, 0x08, 0x00, 0x08, 
-	0x00, 0x00, 0x00, 0x08, 0xe4, 0x01, 0x00, 0x08, 0xe4, 0x01, 0x00, 0x08, 0x88, 0x01, 0x00, 0x08, 
-	0x88, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0xff, 0x09, 0x03, 0x00, 0x00, 0x00, 
-	0xec, 0xff, 0xff, 0x09, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x09, 0x03, 0x00, 0x00, 0x00, 
-	0x4a, 0xff, 0xff, 0x09, 0x00, 0x00, 0x20, 0x09, 0xf0, 0xff, 0xff, 0x09, 0xe8, 0xff, 0xff, 0x09, 
-	0x00, 0xd2, 0x00, 0x15, 0x00, 0xd2, 0x00, 0x15, 0x00, 0x80, 0x00, 0x15, 0x5a, 0xa5, 0x5a, 0xa5, 
-	0x00, 0x00, 0x00, 0x00, 0x54, 0x53, 0xf4, 0x01, 0x34, 0x12, 0x54, 0x53, 0xf4, 0x01, 0x78, 0x56, 
-	0x54, 0x53, 0x54, 0x53, 0x78, 0x56, 0x34, 0x12, 0xf4, 0x01, 0xcd, 0xab, 0x54, 0x53, 0x00, 0x00, 
-	0xee, 0x05, 0x00, 0x00, 0xfa, 0x7f, 0x00, 0x03, 0x01, 0x33, 0xa0, 0xe3, 0x38, 0x11, 0x9f, 0xe5, 
-	0x38, 0x01, 0x9f, 0xe5, 0xb1, 0x00, 0x83, 0xe1, 0xb0, 0x18, 0xd3, 0xe1, 0xb0, 0x38, 0xc3, 0xe1, 
-	0xb0, 0x00, 0xd3, 0xe1, 0x80, 0x00, 0x80, 0xe3, 0xb0, 0x00, 0xc3, 0xe1, 0x00, 0x00, 0x03, 0xef, 
-	0xb0, 0x00, 0xd3, 0xe1, 0x80, 0x00, 0xc0, 0xe3, 0xb0, 0x00, 0xc3, 0xe1, 0xb0, 0x18, 0xc3, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x11, 0xff, 0x2f, 0xe1, 0x04, 0x31, 0x9f, 0xe5, 0x01, 0x10, 0xa0, 0xe3, 
-	0xb4, 0x10, 0xc3, 0xe1, 0x07, 0x10, 0xa0, 0xe3, 0xb2, 0x10, 0xc3, 0xe1, 0x01, 0x10, 0xa0, 0xe3, 
-	0xb0, 0x10, 0xc3, 0xe1, 0x05, 0x10, 0xa0, 0xe3, 0xb0, 0x10, 0xc3, 0xe1, 0x65, 0x20, 0xa0, 0xe3, 
-	0x08, 0xc0, 0xa0, 0xe3, 0x02, 0x10, 0xa0, 0xe3, 0x22, 0x13, 0x01, 0xe0, 0x04, 0x10, 0x81, 0xe3, 
-	0xb0, 0x10, 0xc3, 0xe1, 0x22, 0x13, 0xa0, 0xe1, 0x05, 0x10, 0x81, 0xe3, 0xb0, 0x10, 0xc3, 0xe1, 
-	0x82, 0x20, 0xa0, 0xe1, 0x01, 0xc0, 0x5c, 0xe2, 0xf5, 0xff, 0xff, 0x1a, 0x05, 0x10, 0xa0, 0xe3, 
-	0xb2, 0x10, 0xc3, 0xe1, 0x00, 0x20, 0xa0, 0xe3, 0x20, 0xc0, 0xa0, 0xe3, 0x04, 0x10, 0xa0, 0xe3, 
-	0xb0, 0x10, 0xc3, 0xe1, 0x05, 0x10, 0xa0, 0xe3, 0xb0, 0x10, 0xc3, 0xe1, 0xb0, 0x10, 0xd3, 0xe1, 
-	0x02, 0x10, 0x01, 0xe2, 0xa2, 0x20, 0xa0, 0xe1, 0x01, 0x2f, 0x82, 0xe1, 0x01, 0xc0, 0x5c, 0xe2, 
-	0xf5, 0xff, 0xff, 0x1a, 0x00, 0x00, 0xa0, 0xe3, 0x18, 0xc0, 0xa0, 0xe3, 0x04, 0x10, 0xa0, 0xe3, 
-	0xb0, 0x10, 0xc3, 0xe1, 0x05, 0x10, 0xa0, 0xe3, 0xb0, 0x10, 0xc3, 0xe1, 0xb0, 0x10, 0xd3, 0xe1, 
-	0x02, 0x10, 0x01, 0xe2, 0xa0, 0x00, 0xa0, 0xe1, 0x01, 0x0b, 0x80, 0xe1, 0x01, 0xc0, 0x5c, 0xe2, 
-	0xf5, 0xff, 0xff, 0x1a, 0xa8, 0x25, 0x8a, 0xe5, 0xac, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x0b, 0x00, 0x00, 0xda, 0x01, 0x60, 0xa0, 0xe3, 0x04, 0x40, 0x90, 0xe4, 0x04, 0x50, 0x91, 0xe4, 
-	0x05, 0x40, 0x34, 0xe0, 0x04, 0x50, 0x00, 0x15, 0x06, 0xc0, 0x8c, 0x11, 0x86, 0x60, 0xa0, 0xe1, 
-	0x04, 0x20, 0x52, 0xe2, 0xf7, 0xff, 0xff, 0xca, 0x00, 0x40, 0xd3, 0xe5, 0x04, 0xc0, 0x8c, 0xe1, 
-	0x01, 0xc0, 0xc3, 0xe4, 0xf0, 0x0f, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 0x32, 0x01, 0x00, 0x00, 
-	0x0c, 0xc0, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x08, 0x00, 0x00, 0xa0, 0xe3, 0xd0, 0x05, 0x8a, 0xe5, 
-	0xd4, 0x05, 0x8a, 0xe5, 0xb2, 0x04, 0xca, 0xe5, 0xac, 0x04, 0x8a, 0xe5, 0xb0, 0x04, 0x8a, 0xe5, 
-	0xa6, 0x04, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0xd8, 0x01, 0x9f, 0x05, 0xd8, 0x01, 0x9f, 0x15, 
-	0xd8, 0x11, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0xd4, 0x01, 0x9f, 0x05, 0xd4, 0x01, 0x9f, 0x15, 
-	0xd4, 0x11, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0xd0, 0x11, 0x9f, 0xe5, 0xa5, 0x04, 0xda, 0xe5, 
-	0x00, 0x00, 0xb0, 0xe1, 0x0e, 0x00, 0x00, 0x1a, 0xc4, 0x01, 0x9f, 0xe5, 0x34, 0x01, 0x81, 0xe5, 
-	0x3c, 0x01, 0x81, 0xe5, 0x44, 0x01, 0x81, 0xe5, 0x48, 0x01, 0x81, 0xe5, 0x4c, 0x01, 0x81, 0xe5, 
-	0x50, 0x01, 0x81, 0xe5, 0x54, 0x01, 0x81, 0xe5, 0x58, 0x01, 0x81, 0xe5, 0xa0, 0x01, 0x81, 0xe5, 
-	0xa4, 0x01, 0x81, 0xe5, 0xa8, 0x01, 0x81, 0xe5, 0xac, 0x01, 0x81, 0xe5, 0xc0, 0x01, 0x81, 0xe5, 
-	0x19, 0x00, 0x00, 0xea, 0x8c, 0x01, 0x9f, 0xe5, 0x34, 0x01, 0x81, 0xe5, 0x88, 0x01, 0x9f, 0xe5, 
-	0x3c, 0x01, 0x81, 0xe5, 0x84, 0x01, 0x9f, 0xe5, 0x44, 0x01, 0x81, 0xe5, 0x80, 0x01, 0x9f, 0xe5, 
-	0x48, 0x01, 0x81, 0xe5, 0x7c, 0x01, 0x9f, 0xe5, 0x4c, 0x01, 0x81, 0xe5, 0x78, 0x01, 0x9f, 0xe5, 
-	0x50, 0x01, 0x81, 0xe5, 0x74, 0x01, 0x9f, 0xe5, 0x54, 0x01, 0x81, 0xe5, 0x70, 0x01, 0x9f, 0xe5, 
-	0x58, 0x01, 0x81, 0xe5, 0x6c, 0x01, 0x9f, 0xe5, 0xa0, 0x01, 0x81, 0xe5, 0x68, 0x01, 0x9f, 0xe5, 
-	0xa4, 0x01, 0x81, 0xe5, 0x64, 0x01, 0x9f, 0xe5, 0xa8, 0x01, 0x81, 0xe5, 0x60, 0x01, 0x9f, 0xe5, 
-	0xac, 0x01, 0x81, 0xe5, 0x5c, 0x01, 0x9f, 0xe5, 0xc0, 0x01, 0x81, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xb2, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x00, 0x00, 0xa0, 0xe3, 0xa8, 0x04, 0x8a, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xaf, 0x04, 0xca, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xb0, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xb1, 0x04, 0xca, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xa2, 0x04, 0xca, 0xe5, 0x1c, 0xf1, 0x9f, 0xe5, 0x01, 0x00, 0x50, 0xe3, 
-	0x00, 0x00, 0xa0, 0xe3, 0x6a, 0xfa, 0xff, 0x0a, 0x0e, 0xf0, 0xa0, 0xe1, 0xff, 0x00, 0xa0, 0xe3, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xb2, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xab, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xaf, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xb0, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xb1, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xa2, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xf5, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xf4, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xf7, 0x04, 0xda, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xf6, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x2f, 0x05, 0xda, 0xe5, 
-	0x01, 0x00, 0x40, 0xe2, 0x0e, 0xf0, 0xa0, 0xe1, 0xf5, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x0f, 0x00, 0xc0, 0xe3, 0xf4, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xe0, 0x00, 0xc0, 0xe3, 
-	0x80, 0x00, 0x80, 0xe3, 0xf7, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x0f, 0x00, 0xc0, 0xe3, 
-	0xf6, 0x04, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xf1, 0x04, 0xda, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xf1, 0x14, 0xda, 0xe5, 0x7f, 0x10, 0xc1, 0xe3, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x80, 0xe1, 
-	0xf1, 0x04, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xbc, 0x42, 0x00, 0x03, 0xc0, 0x70, 0x00, 0x08, 
-	0x2c, 0x40, 0x00, 0x03, 0xf8, 0x42, 0x00, 0x03, 0xec, 0x42, 0x00, 0x03, 0xa0, 0x3d, 0x00, 0x03, 
-	0x2c, 0x40, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0xa0, 0x6c, 0x00, 0x08, 0x6c, 0x3a, 0x00, 0x03, 
-	0x68, 0x6c, 0x00, 0x08, 0x70, 0x6c, 0x00, 0x08, 0x7c, 0x6c, 0x00, 0x08, 0x8c, 0x6c, 0x00, 0x08, 
-	0x30, 0x43, 0x00, 0x03, 0xbc, 0x6b, 0x00, 0x08, 0x5c, 0x66, 0x00, 0x08, 0x5c, 0x3b, 0x00, 0x03, 
-	0x64, 0x66, 0x00, 0x08, 0x84, 0x3b, 0x00, 0x03, 0x50, 0x42, 0x00, 0x03, 0x1c, 0x4c, 0x00, 0x03, 
-	0x01, 0x13, 0xa0, 0xe3, 0x94, 0x02, 0x9f, 0xe5, 0x80, 0x00, 0x81, 0xe5, 0xf1, 0x00, 0xa0, 0xe3, 
-	0xb4, 0x08, 0xc1, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 0xb0, 0x06, 0xc1, 0xe1, 0xb2, 0x06, 0xc1, 0xe1, 
-	0xb4, 0x06, 0xc1, 0xe1, 0xb8, 0x06, 0xc1, 0xe1, 0xbc, 0x06, 0xc1, 0xe1, 0xb0, 0x07, 0xc1, 0xe1, 
-	0xb2, 0x07, 0xc1, 0xe1, 0xb4, 0x07, 0xc1, 0xe1, 0xb8, 0x07, 0xc1, 0xe1, 0xbc, 0x07, 0xc1, 0xe1, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x60, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0xc3, 0xa0, 0xe3, 0x62, 0x00, 0xcc, 0xe5, 0x74, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0xc3, 0xa0, 0xe3, 0x63, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x64, 0x00, 0xcc, 0xe5, 0x75, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x65, 0x00, 0xcc, 0xe5, 0x76, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x68, 0x00, 0xcc, 0xe5, 0x77, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x69, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x6c, 0x00, 0xcc, 0xe5, 
-	0x78, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x6d, 0x00, 0xcc, 0xe5, 
-	0x79, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x80, 0x00, 0x00, 0xe2, 
-	0xa0, 0x00, 0x80, 0xe1, 0x70, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x72, 0x00, 0xcc, 0xe5, 0x7a, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x60, 0x00, 0x00, 0xe2, 0x73, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x74, 0x00, 0xcc, 0xe5, 0x7b, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x75, 0x00, 0xcc, 0xe5, 0x7c, 0x05, 0xca, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x60, 0x20, 0x82, 0xe2, 0x02, 0x00, 0xc1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x78, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x79, 0x00, 0xcc, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x7c, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0xc3, 0xa0, 0xe3, 0x7d, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 
-	0x80, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x81, 0x00, 0xcc, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0xc3, 0xa0, 0xe3, 0x84, 0x00, 0xcc, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x60, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x62, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x63, 0x00, 0xd1, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x64, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x65, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x68, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x69, 0x00, 0xd1, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x6c, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x6d, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x70, 0x00, 0xd1, 0xe5, 0x80, 0x00, 0x00, 0xe2, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x72, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x73, 0x00, 0xd1, 0xe5, 
-	0x60, 0x00, 0x00, 0xe2, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x74, 0x00, 0xd1, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x75, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x60, 0x20, 0x82, 0xe2, 0x02, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x78, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x79, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x7c, 0x00, 0xd1, 0xe5, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x7d, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x01, 0x13, 0xa0, 0xe3, 0x80, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 
-	0x81, 0x00, 0xd1, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0x01, 0x13, 0xa0, 0xe3, 0x84, 0x00, 0xd1, 0xe5, 
-	0x70, 0x20, 0xd1, 0xe5, 0x80, 0x00, 0x12, 0xe3, 0x04, 0x00, 0xc0, 0x03, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x77, 0xf3, 0x02, 0x00, 0xe8, 0x05, 0x9a, 0xe5, 0xb4, 0x14, 0x9a, 0xe5, 0x06, 0x00, 0x80, 0xe2, 
-	0x00, 0x00, 0x51, 0xe1, 0x0d, 0x00, 0x00, 0xaa, 0x01, 0x10, 0xd9, 0xe5, 0x01, 0x10, 0xb0, 0xe1, 
-	0x78, 0xf6, 0x9f, 0x05, 0x01, 0x00, 0x59, 0xe5, 0x02, 0x20, 0x59, 0xe5, 0x02, 0x00, 0x90, 0xe1, 
-	0x68, 0xf6, 0x9f, 0x15, 0x0b, 0x00, 0x51, 0xe3, 0x01, 0x58, 0xa0, 0x03, 0x1b, 0x00, 0x51, 0xe3, 
-	0x01, 0x68, 0xa0, 0x03, 0x2b, 0x00, 0x51, 0xe3, 0x01, 0x78, 0xa0, 0x03, 0x4c, 0xf6, 0x9f, 0xe5, 
-	0x48, 0x06, 0x9f, 0xe5, 0x00, 0x00, 0x8a, 0xe5, 0x10, 0xff, 0x2f, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 
-	0x38, 0x06, 0x9f, 0xe5, 0x00, 0x00, 0x8a, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0xd8, 0x05, 0x8a, 0xe5, 
-	0xdc, 0x05, 0x8a, 0xe5, 0xe0, 0x05, 0x8a, 0xe5, 0xe4, 0x05, 0xca, 0xe5, 0xe7, 0x05, 0xca, 0xe5, 
-	0xe8, 0x05, 0x8a, 0xe5, 0x00, 0x00, 0xe0, 0xe3, 0xd4, 0x05, 0xca, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 
-	0x0c, 0x06, 0x9f, 0xe5, 0x01, 0x2a, 0xa0, 0xe3, 0x51, 0xf8, 0xff, 0xeb, 0x04, 0x06, 0x9f, 0xe5, 
-	0x01, 0x2a, 0xa0, 0xe3, 0x4e, 0xf8, 0xff, 0xeb, 0xfc, 0x05, 0x9f, 0xe5, 0x5a, 0x2f, 0xa0, 0xe3, 
-	0x4b, 0xf8, 0xff, 0xeb, 0xe6, 0x05, 0xda, 0xe5, 0x02, 0x00, 0x50, 0xe3, 0x09, 0x00, 0x00, 0x0a, 
-	0x00, 0x10, 0xa0, 0xe3, 0xe4, 0x05, 0x9f, 0xe5, 0x02, 0x2b, 0xa0, 0xe3, 0x44, 0xf8, 0xff, 0xeb, 
-	0xdc, 0x05, 0x9f, 0xe5, 0x02, 0x2a, 0xa0, 0xe3, 0x41, 0xf8, 0xff, 0xeb, 0x2b, 0x15, 0xda, 0xe5, 
-	0x02, 0x10, 0xc1, 0xe3, 0x2b, 0x15, 0xca, 0xe5, 0xc4, 0x08, 0x00, 0xeb, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xc0, 0xf5, 0x9f, 0xe5, 0xff, 0x00, 0xa0, 0xe3, 0xec, 0x05, 0x8a, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 
-	0xb4, 0x05, 0x9f, 0xe5, 0x70, 0x20, 0xa0, 0xe3, 0x35, 0xf8, 0xff, 0xeb, 0x00, 0x80, 0xbd, 0xe8, 
-	0x30, 0x00, 0x00, 0xe2, 0xe1, 0x25, 0xda, 0xe5, 0xf0, 0x15, 0xda, 0xe5, 0x10, 0x00, 0x50, 0xe3, 
-	0x02, 0x10, 0x81, 0x03, 0x20, 0x00, 0x50, 0xe3, 0x01, 0x10, 0x81, 0x03, 0x00, 0x00, 0x50, 0xe3, 
-	0x00, 0x10, 0xa0, 0x03, 0x30, 0x00, 0x50, 0xe3, 0x03, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x51, 0xe3, 
-	0x04, 0x10, 0xc1, 0x13, 0x00, 0x10, 0xa0, 0x03, 0x01, 0x20, 0x82, 0x02, 0xf0, 0x15, 0xca, 0xe5, 
-	0xe2, 0x15, 0xda, 0xe5, 0x01, 0x20, 0x02, 0xe0, 0xe1, 0x25, 0xca, 0xe5, 0x05, 0x1c, 0x8a, 0xe2, 
-	0xd0, 0x10, 0x81, 0xe2, 0x02, 0x10, 0xd1, 0xe7, 0x30, 0x00, 0x50, 0xe3, 0xc0, 0x00, 0x80, 0xe3, 
-	0x0f, 0x00, 0x80, 0x03, 0x02, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x0a, 0x10, 0x00, 0x10, 0xe3, 
-	0x21, 0x02, 0x80, 0x01, 0x0f, 0x10, 0x01, 0xe2, 0x20, 0x00, 0x10, 0xe3, 0x01, 0x00, 0x80, 0x01, 
-	0x0f, 0x00, 0x20, 0xe2, 0xd4, 0x15, 0xda, 0xe5, 0xd4, 0x05, 0xca, 0xe5, 0x30, 0x00, 0x10, 0xe2, 
-	0x30, 0x10, 0x01, 0xe2, 0x35, 0x00, 0x00, 0x0a, 0x30, 0x00, 0x50, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x30, 0x00, 0x51, 0xe3, 0x2a, 0x00, 0x00, 0x1a, 
-	0x20, 0x00, 0x10, 0xe3, 0xf0, 0xc4, 0x9f, 0xe5, 0xd8, 0x05, 0x9a, 0xe5, 0xdc, 0x15, 0x9a, 0xe5, 
-	0x00, 0x20, 0x9c, 0xe7, 0x01, 0x20, 0xc2, 0x11, 0x01, 0x20, 0x82, 0x01, 0x00, 0x20, 0x8c, 0xe7, 
-	0x01, 0x10, 0xb0, 0xe1, 0x0c, 0x00, 0x00, 0x0a, 0x01, 0x10, 0x91, 0xe0, 0x01, 0x10, 0x81, 0x22, 
-	0xdc, 0x15, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0x31, 0x04, 0x00, 0x80, 0xe2, 0xd8, 0x05, 0x8a, 0xe5, 
-	0x0f, 0x00, 0x10, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0x00, 0x10, 0xa0, 0xe3, 0xdc, 0x15, 0x8a, 0xe5, 
-	0x02, 0x20, 0xa0, 0xe3, 0xe0, 0x25, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xe0, 0x25, 0xda, 0xe5, 
-	0x02, 0x00, 0x52, 0xe3, 0x10, 0x00, 0x00, 0x1a, 0xd4, 0x25, 0xda, 0xe5, 0x10, 0x00, 0x12, 0xe3, 
-	0x0d, 0x00, 0x00, 0x1a, 0x0f, 0x00, 0x10, 0xe3, 0x0a, 0x00, 0x00, 0x1a, 0x10, 0x00, 0x50, 0xe3, 
-	0x08, 0x00, 0x00, 0xba, 0x00, 0x20, 0xdc, 0xe5, 0x07, 0x10, 0x02, 0xe2, 0x01, 0x12, 0xa0, 0xe1, 
-	0x01, 0x00, 0x50, 0xe1, 0x04, 0x00, 0x00, 0xca, 0x15, 0x00, 0x00, 0x0a, 0x03, 0x20, 0xa0, 0xe3, 
-	0xe0, 0x25, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x0b, 0xb0, 0xa0, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 
-	0xd8, 0x05, 0x8a, 0xe5, 0xdc, 0x05, 0x8a, 0xe5, 0xe0, 0x05, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xe0, 0x25, 0xda, 0xe5, 0x03, 0x00, 0x52, 0xe3, 0x05, 0x00, 0x00, 0x0a, 0x01, 0x00, 0xa0, 0xe3, 
-	0xe0, 0x05, 0xca, 0xe5, 0xdc, 0x05, 0x8a, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0xd8, 0x05, 0x8a, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x00, 0xa0, 0xe3, 0xe0, 0x05, 0xca, 0xe5, 0xdc, 0x05, 0x8a, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 0xd8, 0x05, 0x8a, 0xe5, 0xdc, 0x05, 0x8a, 0xe5, 
-	0xe0, 0x05, 0xca, 0xe5, 0xf0, 0x05, 0xca, 0xe5, 0xb3, 0x0f, 0x4f, 0xe2, 0x00, 0x00, 0x8a, 0xe5, 
-	0xb4, 0x04, 0x9a, 0xe5, 0xe8, 0x05, 0x8a, 0xe5, 0xf8, 0x00, 0x02, 0xe2, 0xa0, 0xf0, 0x9f, 0xe7, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x2c, 0x73, 0x00, 0x08, 0x98, 0x73, 0x00, 0x08, 0xa8, 0x73, 0x00, 0x08, 
-	0xa0, 0x73, 0x00, 0x08, 0xb4, 0x73, 0x00, 0x08, 0xb4, 0x73, 0x00, 0x08, 0xb4, 0x73, 0x00, 0x08, 
-	0xb4, 0x73, 0x00, 0x08, 0xb4, 0x73, 0x00, 0x08, 0xb4, 0x73, 0x00, 0x08, 0xb8, 0x73, 0x00, 0x08, 
-	0x28, 0x74, 0x00, 0x08, 0x8c, 0x74, 0x00, 0x08, 0x8c, 0x74, 0x00, 0x08, 0x8c, 0x74, 0x00, 0x08, 
-	0x8c, 0x74, 0x00, 0x08, 0x8c, 0x74, 0x00, 0x08, 0x14, 0x73, 0x00, 0x08, 0x8c, 0x74, 0x00, 0x08, 
-	0x90, 0x74, 0x00, 0x08, 0xdc, 0x74, 0x00, 0x08, 0x0c, 0x75, 0x00, 0x08, 0x14, 0x75, 0x00, 0x08, 
-	0x78, 0x75, 0x00, 0x08, 0x88, 0x75, 0x00, 0x08, 0x90, 0x72, 0x00, 0x08, 0x90, 0x72, 0x00, 0x08, 
-	0x90, 0x72, 0x00, 0x08, 0x90, 0x72, 0x00, 0x08, 0x90, 0x72, 0x00, 0x08, 0x90, 0x72, 0x00, 0x08, 
-	0x90, 0x72, 0x00, 0x08, 0x01, 0x00, 0xdc, 0xe5, 0x03, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x50, 0xe3, 
-	0x03, 0x00, 0xa0, 0x03, 0xe2, 0x05, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x3c, 0x23, 0x9f, 0xe5, 
-	0x02, 0x00, 0xa0, 0xe3, 0x01, 0x00, 0x2d, 0xe9, 0x34, 0x13, 0x9f, 0xe5, 0x01, 0x00, 0xfc, 0xe5, 
-	0x00, 0x00, 0xc1, 0xe5, 0x08, 0x00, 0xc1, 0xe5, 0x10, 0x00, 0xc1, 0xe5, 0x18, 0x00, 0xc1, 0xe5, 
-	0x01, 0x00, 0xfc, 0xe5, 0x01, 0x00, 0xc1, 0xe5, 0x09, 0x00, 0xc1, 0xe5, 0x11, 0x00, 0xc1, 0xe5, 
-	0x19, 0x00, 0xc1, 0xe5, 0x06, 0x10, 0xa0, 0xe3, 0x01, 0x00, 0xfc, 0xe5, 0x01, 0x00, 0xc2, 0xe4, 
-	0x01, 0x10, 0x51, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 0x01, 0x00, 0xbd, 0xe8, 0x00, 0x20, 0x82, 0xe0, 
-	0x06, 0x10, 0xa0, 0xe3, 0x01, 0x00, 0xfc, 0xe5, 0x01, 0x00, 0xc2, 0xe4, 0x01, 0x10, 0x51, 0xe2, 
-	0xfb, 0xff, 0xff, 0x1a, 0x3b, 0xfa, 0xff, 0xea, 0xd8, 0x22, 0x9f, 0xe5, 0xe3, 0xff, 0xff, 0xea, 
-	0xd4, 0x22, 0x9f, 0xe5, 0xe1, 0xff, 0xff, 0xea, 0xc0, 0x22, 0x9f, 0xe5, 0x12, 0x00, 0xa0, 0xe3, 
-	0xdf, 0xff, 0xff, 0xea, 0x1e, 0xff, 0x2f, 0xe1, 0x18, 0x40, 0x2d, 0xe9, 0xb0, 0x22, 0x9f, 0xe5, 
-	0x8c, 0x32, 0x9f, 0xe5, 0x04, 0x40, 0xa0, 0xe3, 0x01, 0x00, 0xfc, 0xe5, 0x01, 0x10, 0xfc, 0xe5, 
-	0x01, 0x04, 0x80, 0xe1, 0xfe, 0x0c, 0xc0, 0xe3, 0x80, 0x11, 0x83, 0xe0, 0x04, 0x00, 0x91, 0xe4, 
-	0x04, 0x00, 0x82, 0xe4, 0x04, 0x00, 0x91, 0xe4, 0x04, 0x00, 0x82, 0xe4, 0x01, 0x40, 0x54, 0xe2, 
-	0xf4, 0xff, 0xff, 0x1a, 0xb0, 0x02, 0x52, 0xe1, 0xb8, 0x01, 0x42, 0xe1, 0xb0, 0x01, 0x42, 0xe1, 
-	0xb8, 0x00, 0x42, 0xe1, 0x01, 0x00, 0xfc, 0xe5, 0x40, 0x00, 0x10, 0xe3, 0x00, 0x10, 0xa0, 0x13, 
-	0xe3, 0x15, 0xca, 0x15, 0x80, 0x00, 0x10, 0xe3, 0x3f, 0x00, 0x00, 0x12, 0x41, 0x00, 0x00, 0x1b, 
-	0x18, 0xfa, 0xff, 0xeb, 0x18, 0x80, 0xbd, 0xe8, 0x24, 0x12, 0x9f, 0xe5, 0x01, 0x2a, 0xa0, 0xe3, 
-	0xf8, 0x40, 0x2d, 0xe9, 0x14, 0x70, 0xa0, 0xe3, 0xe4, 0x34, 0xda, 0xe5, 0x08, 0x00, 0x13, 0xe3, 
-	0x38, 0x42, 0x9f, 0xe5, 0x38, 0x52, 0x9f, 0x05, 0x38, 0x52, 0x9f, 0x15, 0x01, 0x00, 0xd5, 0xe4, 
-	0x80, 0x00, 0x10, 0xe3, 0x10, 0x00, 0x13, 0x03, 0x01, 0x0c, 0x80, 0x02, 0x00, 0xc2, 0x84, 0xe0, 
-	0x10, 0x60, 0xa0, 0xe3, 0x04, 0x00, 0x9c, 0xe4, 0x04, 0x00, 0x81, 0xe4, 0x04, 0x60, 0x56, 0xe2, 
-	0xfb, 0xff, 0xff, 0x1a, 0x01, 0x70, 0x57, 0xe2, 0x14, 0x70, 0xa0, 0x03, 0x0c, 0x50, 0x85, 0x02, 
-	0x10, 0x20, 0x52, 0xe2, 0xf0, 0xff, 0xff, 0xca, 0xf8, 0x80, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x00, 0x40, 0x2d, 0xe9, 0x01, 0x00, 0xdc, 0xe5, 0x01, 0x00, 0x00, 0xe2, 0xe7, 0x15, 0xda, 0xe5, 
-	0x01, 0x20, 0xa0, 0xe3, 0x12, 0x10, 0x81, 0xe1, 0xe7, 0x15, 0xca, 0xe5, 0x07, 0x00, 0x51, 0xe3, 
-	0x00, 0x10, 0xa0, 0x03, 0xb4, 0x14, 0x9a, 0x15, 0xff, 0x10, 0x81, 0x12, 0xec, 0x15, 0x8a, 0xe5, 
-	0xc4, 0x11, 0x9f, 0xe5, 0x00, 0x16, 0x81, 0xe0, 0x01, 0x00, 0x2d, 0xe9, 0xd6, 0xff, 0xff, 0xeb, 
-	0x01, 0x00, 0xbd, 0xe8, 0x2c, 0x00, 0x00, 0xeb, 0x00, 0x80, 0xbd, 0xe8, 0x00, 0x40, 0x2d, 0xe9, 
-	0xe7, 0x15, 0xda, 0xe5, 0x04, 0x10, 0x81, 0xe3, 0xe7, 0x15, 0xca, 0xe5, 0x03, 0x00, 0x11, 0xe3, 
-	0x00, 0x10, 0xa0, 0x13, 0xec, 0x15, 0x8a, 0x15, 0x90, 0x11, 0x9f, 0xe5, 0x22, 0x2d, 0xa0, 0xe3, 
-	0xca, 0xff, 0xff, 0xeb, 0x39, 0x00, 0x00, 0xeb, 0x00, 0x80, 0xbd, 0xe8, 0x44, 0x11, 0x9f, 0xe5, 
-	0xc5, 0xff, 0xff, 0xea, 0x01, 0x00, 0xfc, 0xe5, 0x40, 0x00, 0x10, 0xe3, 0x00, 0x10, 0xa0, 0x13, 
-	0xe3, 0x15, 0xca, 0x15, 0x3f, 0x00, 0x00, 0xe2, 0x18, 0x40, 0x2d, 0xe9, 0x5a, 0x10, 0xa0, 0xe3, 
-	0x20, 0x31, 0x9f, 0xe5, 0x90, 0x31, 0x22, 0xe0, 0x1c, 0x31, 0x9f, 0xe5, 0x5a, 0x40, 0xa0, 0xe3, 
-	0x01, 0x00, 0xd2, 0xe4, 0x20, 0x13, 0xa0, 0xe1, 0x01, 0x10, 0xc3, 0xe4, 0x20, 0x12, 0xa0, 0xe1, 
-	0xfc, 0x10, 0xc1, 0xe3, 0x01, 0x10, 0xc3, 0xe4, 0x20, 0x11, 0xa0, 0xe1, 0xfc, 0x10, 0xc1, 0xe3, 
-	0x01, 0x10, 0xc3, 0xe4, 0xfc, 0x10, 0xc0, 0xe3, 0x01, 0x10, 0xc3, 0xe4, 0x01, 0x40, 0x54, 0xe2, 
-	0xf2, 0xff, 0xff, 0x1a, 0x18, 0x80, 0xbd, 0xe8, 0x01, 0x00, 0xfc, 0xe5, 0x03, 0x00, 0x00, 0xe2, 
-	0xe3, 0x05, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0xf8, 0x40, 0x2d, 0xe9, 
-	0x80, 0x70, 0xa0, 0xe3, 0xc8, 0x60, 0x9f, 0xe5, 0x00, 0x66, 0x86, 0xe0, 0xe8, 0x50, 0x9f, 0xe5, 
-	0x00, 0x56, 0x85, 0xe0, 0xe8, 0x40, 0x9f, 0xe5, 0x01, 0x00, 0xd5, 0xe4, 0x01, 0x10, 0xd5, 0xe4, 
-	0x0e, 0x20, 0xd5, 0xe5, 0x0f, 0x30, 0xd5, 0xe5, 0x00, 0x01, 0x94, 0xe7, 0x01, 0x11, 0x94, 0xe7, 
-	0x02, 0x21, 0x94, 0xe7, 0x03, 0x31, 0x94, 0xe7, 0x81, 0x00, 0x80, 0xe1, 0x02, 0x01, 0x80, 0xe1, 
-	0x83, 0x01, 0x80, 0xe1, 0x04, 0x00, 0x86, 0xe4, 0x1f, 0x00, 0x16, 0xe3, 0xf1, 0xff, 0xff, 0x1a, 
-	0x10, 0x50, 0x85, 0xe2, 0x01, 0x70, 0x57, 0xe2, 0xee, 0xff, 0xff, 0x1a, 0xf8, 0x80, 0xbd, 0xe8, 
-	0xf8, 0x40, 0x2d, 0xe9, 0x0e, 0x7d, 0xa0, 0xe3, 0x98, 0x60, 0x9f, 0xe5, 0x98, 0x50, 0x9f, 0xe5, 
-	0xb2, 0x00, 0x75, 0xe1, 0xff, 0x10, 0x00, 0xe2, 0x10, 0x10, 0x81, 0xe2, 0x20, 0x27, 0xa0, 0xe1, 
-	0x02, 0x15, 0x81, 0xe1, 0x20, 0x25, 0xa0, 0xe1, 0x03, 0x20, 0x02, 0xe2, 0x01, 0x20, 0x82, 0xe2, 
-	0x02, 0x16, 0x81, 0xe1, 0xb2, 0x10, 0x66, 0xe1, 0x01, 0x70, 0x57, 0xe2, 0xf3, 0xff, 0xff, 0x1a, 
-	0x01, 0x00, 0xa0, 0xe3, 0xe4, 0x05, 0xca, 0xe5, 0x2b, 0x05, 0xda, 0xe5, 0x02, 0x00, 0x80, 0xe3, 
-	0x2b, 0x05, 0xca, 0xe5, 0x59, 0x07, 0x00, 0xeb, 0xf8, 0x40, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x10, 0x00, 0x00, 0x03, 0xc0, 0xcf, 0x02, 0x02, 0xc0, 0xbf, 0x02, 0x02, 0xe8, 0xbd, 0x02, 0x02, 
-	0x00, 0xe8, 0x00, 0x06, 0x00, 0xc2, 0x00, 0x06, 0xbc, 0x31, 0x00, 0x03, 0x50, 0xbf, 0x02, 0x02, 
-	0xc2, 0xdf, 0x02, 0x02, 0xc0, 0xdf, 0x02, 0x02, 0xd2, 0xdf, 0x02, 0x02, 0xca, 0xdf, 0x02, 0x02, 
-	0x00, 0x40, 0x03, 0x02, 0x00, 0x58, 0x03, 0x02, 0x00, 0x5c, 0x03, 0x02, 0x20, 0xc2, 0x00, 0x06, 
-	0x80, 0xe7, 0x00, 0x06, 0x7c, 0x79, 0x00, 0x03, 0x00, 0xef, 0x00, 0x06, 0x80, 0xee, 0x00, 0x06, 
-	0xaf, 0xcb, 0x46, 0x79, 0xaa, 0x6d, 0x22, 0x6f, 0x5f, 0x08, 0x29, 0x55, 0xaf, 0xcb, 0x46, 0x79, 
-	0xaa, 0x6d, 0x22, 0x6f, 0x5f, 0x08, 0x29, 0x55, 0xaf, 0xcb, 0x46, 0x79, 0xaa, 0x6d, 0x22, 0x6f, 
-	0x5f, 0x08, 0x29, 0x55, 0xaf, 0xcb, 0x46, 0x79, 0xaa, 0x6d, 0x22, 0x6f, 0x5f, 0x08, 0x29, 0x55, 
-	0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaa, 
-	0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 
-	0x55, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaa, 
-	0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xef, 0xef, 0xff, 0x5a, 0x8c, 0xe7, 0x18, 0x4a, 
-	0x9c, 0x00, 0x00, 0x00, 0xff, 0xef, 0xef, 0xef, 0x5a, 0x63, 0xad, 0x10, 0x18, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xe7, 0xef, 0xd6, 0xc6, 
-	0xde, 0x8c, 0x6b, 0x84, 0x29, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xef, 0x5a, 0x63, 0xad, 0x10, 
-	0x18, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0x8c, 0xe7, 0x18, 0x4a, 0x9c, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xa0, 0x67, 0xd7, 0x67, 0x8c, 0x55, 0x20, 0x46, 0x15, 0x07, 0xff, 0xff, 0xad, 0x80, 
-	0x80, 0xb7, 0x25, 0x29, 0x59, 0x00, 0x00, 0x00, 0xff, 0xb0, 0x7f, 0x5a, 0x8c, 0xe7, 0x18, 0x4a, 
-	0x9c, 0x00, 0x00, 0x00, 0xff, 0xef, 0xef, 0xef, 0x5a, 0x63, 0xad, 0x10, 0x18, 0x00, 0x00, 0x00, 
-	0xdf, 0xdf, 0x7f, 0x00, 0x5f, 0xaf, 0x1f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x00, 0x80, 
-	0xff, 0xff, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x00, 0xff, 0x00, 0x00, 0x3f, 0x37, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x31, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 
-	0xce, 0x73, 0x8c, 0x4a, 0x08, 0x21, 0x21, 0x9c, 0xff, 0xff, 0xde, 0xef, 0xc6, 0x73, 0xff, 0x63, 
-	0x52, 0x00, 0x00, 0x29, 0xff, 0xff, 0xff, 0xe7, 0xa5, 0xa5, 0x7b, 0x29, 0x29, 0x42, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xf7, 0xef, 0x75, 0x29, 0x6b, 0xbd, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 
-	0xce, 0x73, 0x8c, 0x4a, 0x08, 0x21, 0x21, 0x9c, 0xff, 0xff, 0xde, 0xef, 0xc6, 0x73, 0xff, 0x63, 
-	0x52, 0x00, 0x00, 0x29, 0xff, 0xff, 0xff, 0xe7, 0xa5, 0xa5, 0x7b, 0x29, 0x29, 0x42, 0x00, 0x00, 
-	0xa5, 0xd6, 0xff, 0xe7, 0xef, 0xff, 0xde, 0x8c, 0x10, 0x5a, 0x10, 0x00, 0xff, 0xff, 0xff, 0xf7, 
-	0xce, 0x73, 0x8c, 0x4a, 0x08, 0x21, 0x21, 0x9c, 0xff, 0xc6, 0xc6, 0xff, 0x6b, 0x6b, 0xff, 0x00, 
-	0x00, 0x63, 0x00, 0x00, 0xff, 0xff, 0xff, 0xef, 0x42, 0xef, 0x7b, 0x29, 0x29, 0x42, 0x00, 0x00, 
-	0xff, 0xf7, 0xef, 0xc8, 0x90, 0x88, 0x84, 0x50, 0x44, 0x42, 0x10, 0x00, 0xff, 0xff, 0xff, 0xa5, 
-	0xa5, 0xff, 0x52, 0x52, 0xbd, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xc6, 0x52, 0x52, 
-	0x8c, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xad, 0xb5, 0xbd, 0x5a, 0x6b, 0x7b, 0x08, 0x21, 0x42, 
-	0xff, 0xff, 0xff, 0xa5, 0xad, 0xbd, 0x52, 0x5a, 0x7b, 0x00, 0x10, 0x39, 0xff, 0xff, 0xff, 0xa5, 
-	0xad, 0xbd, 0x52, 0x5a, 0x7b, 0x00, 0x10, 0x39, 0xff, 0xff, 0xff, 0xa5, 0xad, 0xbd, 0x52, 0x5a, 
-	0x7b, 0x00, 0x10, 0x39, 0xff, 0xff, 0xff, 0xad, 0xb5, 0xbd, 0x5a, 0x6b, 0x7b, 0x08, 0x21, 0x42, 
-	0xef, 0xf7, 0xff, 0xce, 0xb5, 0xad, 0xc6, 0x21, 0x29, 0x39, 0x00, 0x00, 0xff, 0xff, 0xff, 0x94, 
-	0xce, 0xf7, 0x10, 0x39, 0xff, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xad, 0x84, 0x5a, 0x39, 
-	0x00, 0x00, 0x00, 0x00, 0xef, 0xef, 0xef, 0xad, 0xa5, 0x9c, 0x6b, 0x5a, 0x5a, 0x42, 0x10, 0x08, 
-	0xd6, 0xd6, 0xe7, 0x8c, 0xa5, 0xb5, 0x42, 0x52, 0x6b, 0x00, 0x10, 0x18, 0xff, 0xff, 0xff, 0xa5, 
-	0xa5, 0xd6, 0x52, 0x52, 0xad, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x84, 0xff, 0x52, 
-	0x42, 0x5a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xce, 0xf7, 0xde, 0x9c, 0xf7, 0xb5, 0x6b, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x21, 0x42, 0xff, 0x00, 0x10, 0x52, 0xff, 0xff, 0xff, 0xaa, 
-	0xaa, 0xd6, 0x55, 0x55, 0xad, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x84, 0xff, 0x52, 
-	0x42, 0x8c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xce, 0x8c, 0xf7, 0x9c, 0x5a, 0x84, 0x52, 0x00, 
-	0xff, 0xff, 0x83, 0xff, 0xa5, 0x3e, 0x73, 0x42, 0x00, 0x33, 0x09, 0x00, 0xcc, 0xcc, 0xff, 0x77, 
-	0x78, 0xff, 0x23, 0x35, 0xc1, 0x05, 0x0a, 0x5a, 0xff, 0xbd, 0xc4, 0xf1, 0x4d, 0x60, 0x9f, 0x12, 
-	0x29, 0x20, 0x00, 0x00, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 
-	0xe2, 0xff, 0xd1, 0xa9, 0xff, 0x89, 0x51, 0xa2, 0x48, 0x04, 0x25, 0x03, 0xff, 0xb4, 0xb4, 0xff, 
-	0x47, 0x47, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xb0, 0xd6, 0xc3, 0x4d, 0xa3, 0x5b, 
-	0x11, 0x6a, 0x00, 0x00, 0xf7, 0xff, 0x63, 0xc6, 0xce, 0x42, 0x73, 0x7b, 0x21, 0x00, 0x00, 0x00, 
-	0xf3, 0xff, 0x33, 0xc1, 0xce, 0x22, 0x6f, 0x7b, 0x11, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x33, 0xc1, 
-	0xce, 0x22, 0x6f, 0x7b, 0x11, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x33, 0xc1, 0xce, 0x22, 0x6f, 0x7b, 
-	0x11, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x33, 0xc1, 0xce, 0x22, 0x6f, 0x7b, 0x11, 0x00, 0x00, 0x00, 
-	0xf8, 0xe8, 0xc8, 0xd8, 0x90, 0x48, 0xa8, 0x28, 0x20, 0x30, 0x18, 0x50, 0xf8, 0xe8, 0xc8, 0xd8, 
-	0x90, 0x48, 0xa8, 0x28, 0x20, 0x30, 0x18, 0x50, 0xf8, 0xe8, 0xc8, 0xd8, 0x90, 0x48, 0xa8, 0x28, 
-	0x20, 0x30, 0x18, 0x50, 0xf8, 0xe8, 0xc8, 0xd8, 0x90, 0x48, 0xa8, 0x28, 0x20, 0x30, 0x18, 0x50, 
-	0xd8, 0xd8, 0xc0, 0xc8, 0xb0, 0x70, 0xb0, 0x50, 0x10, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xc0, 0xc8, 
-	0xb0, 0x70, 0xb0, 0x50, 0x10, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xc0, 0xc8, 0xb0, 0x70, 0xb0, 0x50, 
-	0x10, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xc0, 0xc8, 0xb0, 0x70, 0xb0, 0x50, 0x10, 0x00, 0x00, 0x00, 
-	0xf8, 0xc0, 0xf8, 0xe8, 0x98, 0x50, 0x98, 0x38, 0x60, 0x38, 0x38, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 
-	0x98, 0x50, 0x98, 0x38, 0x60, 0x38, 0x38, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 0x98, 0x50, 0x98, 0x38, 
-	0x60, 0x38, 0x38, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 0x98, 0x50, 0x98, 0x38, 0x60, 0x38, 0x38, 0x98, 
-	0xf8, 0xf8, 0xa8, 0xc0, 0x80, 0x48, 0xf8, 0x00, 0x00, 0x50, 0x18, 0x00, 0xf8, 0xf8, 0xa8, 0xc0, 
-	0x80, 0x48, 0xf8, 0x00, 0x00, 0x50, 0x18, 0x00, 0xf8, 0xf8, 0xa8, 0xc0, 0x80, 0x48, 0xf8, 0x00, 
-	0x00, 0x50, 0x18, 0x00, 0xf8, 0xf8, 0xa8, 0xc0, 0x80, 0x48, 0xf8, 0x00, 0x00, 0x50, 0x18, 0x00, 
-	0xf8, 0xd8, 0xb0, 0x78, 0xc0, 0x78, 0x68, 0x88, 0x40, 0x58, 0x38, 0x20, 0xf8, 0xd8, 0xb0, 0x78, 
-	0xc0, 0x78, 0x68, 0x88, 0x40, 0x58, 0x38, 0x20, 0xf8, 0xd8, 0xb0, 0x78, 0xc0, 0x78, 0x68, 0x88, 
-	0x40, 0x58, 0x38, 0x20, 0xf8, 0xd8, 0xb0, 0x78, 0xc0, 0x78, 0x68, 0x88, 0x40, 0x58, 0x38, 0x20, 
-	0xd8, 0xe8, 0xf8, 0xe0, 0x88, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x40, 0x10, 0xd8, 0xe8, 0xf8, 0xe0, 
-	0x88, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x40, 0x10, 0xd8, 0xe8, 0xf8, 0xe0, 0x88, 0x50, 0xa8, 0x00, 
-	0x00, 0x00, 0x40, 0x10, 0xd8, 0xe8, 0xf8, 0xe0, 0x88, 0x50, 0xa8, 0x00, 0x00, 0x00, 0x40, 0x10, 
-	0x00, 0x00, 0x50, 0x00, 0xa0, 0xe8, 0x78, 0x78, 0x00, 0xf8, 0xf8, 0x58, 0x00, 0x00, 0x50, 0x00, 
-	0xa0, 0xe8, 0x78, 0x78, 0x00, 0xf8, 0xf8, 0x58, 0x00, 0x00, 0x50, 0x00, 0xa0, 0xe8, 0x78, 0x78, 
-	0x00, 0xf8, 0xf8, 0x58, 0x00, 0x00, 0x50, 0x00, 0xa0, 0xe8, 0x78, 0x78, 0x00, 0xf8, 0xf8, 0x58, 
-	0xf8, 0xe8, 0xe0, 0xf8, 0xb8, 0x88, 0x80, 0x40, 0x00, 0x30, 0x18, 0x00, 0xf8, 0xe8, 0xe0, 0xf8, 
-	0xb8, 0x88, 0x80, 0x40, 0x00, 0x30, 0x18, 0x00, 0xf8, 0xe8, 0xe0, 0xf8, 0xb8, 0x88, 0x80, 0x40, 
-	0x00, 0x30, 0x18, 0x00, 0xf8, 0xe8, 0xe0, 0xf8, 0xb8, 0x88, 0x80, 0x40, 0x00, 0x30, 0x18, 0x00, 
-	0xf0, 0xc8, 0xa0, 0xc0, 0x88, 0x48, 0x28, 0x78, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc8, 0xa0, 0xc0, 
-	0x88, 0x48, 0x28, 0x78, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc8, 0xa0, 0xc0, 0x88, 0x48, 0x28, 0x78, 
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xc8, 0xa0, 0xc0, 0x88, 0x48, 0x28, 0x78, 0x00, 0x00, 0x00, 0x00, 
-	0xf8, 0xf8, 0xf8, 0xf8, 0xe8, 0x50, 0xf8, 0x30, 0x00, 0x50, 0x00, 0x58, 0xf8, 0xf8, 0xf8, 0xf8, 
-	0xe8, 0x50, 0xf8, 0x30, 0x00, 0x50, 0x00, 0x58, 0xf8, 0xf8, 0xf8, 0xf8, 0xe8, 0x50, 0xf8, 0x30, 
-	0x00, 0x50, 0x00, 0x58, 0xf8, 0xf8, 0xf8, 0xf8, 0xe8, 0x50, 0xf8, 0x30, 0x00, 0x50, 0x00, 0x58, 
-	0xf8, 0xc0, 0xf8, 0xe8, 0x88, 0x88, 0x78, 0x30, 0xe8, 0x28, 0x28, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 
-	0x88, 0x88, 0x78, 0x30, 0xe8, 0x28, 0x28, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 0x88, 0x88, 0x78, 0x30, 
-	0xe8, 0x28, 0x28, 0x98, 0xf8, 0xc0, 0xf8, 0xe8, 0x88, 0x88, 0x78, 0x30, 0xe8, 0x28, 0x28, 0x98, 
-	0xf8, 0xf8, 0xa0, 0x00, 0xf8, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0x50, 0xf8, 0xf8, 0xa0, 0x00, 
-	0xf8, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0x50, 0xf8, 0xf8, 0xa0, 0x00, 0xf8, 0x00, 0xf8, 0x30, 
-	0x00, 0x00, 0x00, 0x50, 0xf8, 0xf8, 0xa0, 0x00, 0xf8, 0x00, 0xf8, 0x30, 0x00, 0x00, 0x00, 0x50, 
-	0xf8, 0xc8, 0x80, 0x90, 0xb0, 0xe0, 0x28, 0x10, 0x60, 0x10, 0x08, 0x10, 0xf8, 0xc8, 0x80, 0x90, 
-	0xb0, 0xe0, 0x28, 0x10, 0x60, 0x10, 0x08, 0x10, 0xf8, 0xc8, 0x80, 0x90, 0xb0, 0xe0, 0x28, 0x10, 
-	0x60, 0x10, 0x08, 0x10, 0xf8, 0xc8, 0x80, 0x90, 0xb0, 0xe0, 0x28, 0x10, 0x60, 0x10, 0x08, 0x10, 
-	0xd0, 0xf8, 0xf8, 0xf8, 0x90, 0x50, 0xa0, 0x00, 0x00, 0x18, 0x00, 0x00, 0xd0, 0xf8, 0xf8, 0xf8, 
-	0x90, 0x50, 0xa0, 0x00, 0x00, 0x18, 0x00, 0x00, 0xd0, 0xf8, 0xf8, 0xf8, 0x90, 0x50, 0xa0, 0x00, 
-	0x00, 0x18, 0x00, 0x00, 0xd0, 0xf8, 0xf8, 0xf8, 0x90, 0x50, 0xa0, 0x00, 0x00, 0x18, 0x00, 0x00, 
-	0x68, 0xb8, 0x38, 0xe0, 0x50, 0x40, 0xe0, 0xb8, 0x80, 0x00, 0x18, 0x00, 0x68, 0xb8, 0x38, 0xe0, 
-	0x50, 0x40, 0xe0, 0xb8, 0x80, 0x00, 0x18, 0x00, 0x68, 0xb8, 0x38, 0xe0, 0x50, 0x40, 0xe0, 0xb8, 
-	0x80, 0x00, 0x18, 0x00, 0x68, 0xb8, 0x38, 0xe0, 0x50, 0x40, 0xe0, 0xb8, 0x80, 0x00, 0x18, 0x00, 
-	0xf8, 0xf8, 0xf8, 0xb8, 0xb8, 0xb8, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xb8, 
-	0xb8, 0xb8, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xb8, 0xb8, 0xb8, 0x70, 0x70, 
-	0x70, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xb8, 0xb8, 0xb8, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 
-	0xf8, 0xd0, 0x98, 0x70, 0xc0, 0xc0, 0xf8, 0x60, 0x28, 0x30, 0x48, 0x60, 0xf8, 0xd0, 0x98, 0x70, 
-	0xc0, 0xc0, 0xf8, 0x60, 0x28, 0x30, 0x48, 0x60, 0xf8, 0xd0, 0x98, 0x70, 0xc0, 0xc0, 0xf8, 0x60, 
-	0x28, 0x30, 0x48, 0x60, 0xf8, 0xd0, 0x98, 0x70, 0xc0, 0xc0, 0xf8, 0x60, 0x28, 0x30, 0x48, 0x60, 
-	0xd8, 0xd8, 0xc0, 0xe0, 0x80, 0x20, 0x00, 0x50, 0x00, 0x00, 0x10, 0x10, 0xd8, 0xd8, 0xc0, 0xe0, 
-	0x80, 0x20, 0x00, 0x50, 0x00, 0x00, 0x10, 0x10, 0xd8, 0xd8, 0xc0, 0xe0, 0x80, 0x20, 0x00, 0x50, 
-	0x00, 0x00, 0x10, 0x10, 0xd8, 0xd8, 0xc0, 0xe0, 0x80, 0x20, 0x00, 0x50, 0x00, 0x00, 0x10, 0x10, 
-	0xe0, 0xa8, 0xc8, 0xf8, 0xf8, 0x78, 0x00, 0xb8, 0xf8, 0x20, 0x20, 0x58, 0xe0, 0xa8, 0xc8, 0xf8, 
-	0xf8, 0x78, 0x00, 0xb8, 0xf8, 0x20, 0x20, 0x58, 0xe0, 0xa8, 0xc8, 0xf8, 0xf8, 0x78, 0x00, 0xb8, 
-	0xf8, 0x20, 0x20, 0x58, 0xe0, 0xa8, 0xc8, 0xf8, 0xf8, 0x78, 0x00, 0xb8, 0xf8, 0x20, 0x20, 0x58, 
-	0xf0, 0xf8, 0xb8, 0xe0, 0xa8, 0x78, 0x08, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xb8, 0xe0, 
-	0xa8, 0x78, 0x08, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xb8, 0xe0, 0xa8, 0x78, 0x08, 0xc8, 
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xb8, 0xe0, 0xa8, 0x78, 0x08, 0xc8, 0x00, 0x00, 0x00, 0x00, 
-	0xf8, 0xf8, 0xc0, 0xe0, 0xb0, 0x68, 0xb0, 0x78, 0x20, 0x50, 0x48, 0x70, 0xf8, 0xf8, 0xc0, 0xe0, 
-	0xb0, 0x68, 0xb0, 0x78, 0x20, 0x50, 0x48, 0x70, 0xf8, 0xf8, 0xc0, 0xe0, 0xb0, 0x68, 0xb0, 0x78, 
-	0x20, 0x50, 0x48, 0x70, 0xf8, 0xf8, 0xc0, 0xe0, 0xb0, 0x68, 0xb0, 0x78, 0x20, 0x50, 0x48, 0x70, 
-	0x78, 0x78, 0xc8, 0xf8, 0x68, 0xf8, 0xf8, 0xd0, 0x00, 0x40, 0x40, 0x40, 0x78, 0x78, 0xc8, 0xf8, 
-	0x68, 0xf8, 0xf8, 0xd0, 0x00, 0x40, 0x40, 0x40, 0x78, 0x78, 0xc8, 0xf8, 0x68, 0xf8, 0xf8, 0xd0, 
-	0x00, 0x40, 0x40, 0x40, 0x78, 0x78, 0xc8, 0xf8, 0x68, 0xf8, 0xf8, 0xd0, 0x00, 0x40, 0x40, 0x40, 
-	0x60, 0xd8, 0x50, 0xf8, 0xf8, 0xf8, 0xc8, 0x30, 0x38, 0x38, 0x00, 0x00, 0x60, 0xd8, 0x50, 0xf8, 
-	0xf8, 0xf8, 0xc8, 0x30, 0x38, 0x38, 0x00, 0x00, 0x60, 0xd8, 0x50, 0xf8, 0xf8, 0xf8, 0xc8, 0x30, 
-	0x38, 0x38, 0x00, 0x00, 0x60, 0xd8, 0x50, 0xf8, 0xf8, 0xf8, 0xc8, 0x30, 0x38, 0x38, 0x00, 0x00, 
-	0xe0, 0xf8, 0xa0, 0x78, 0xc8, 0x38, 0x48, 0x88, 0x18, 0x08, 0x18, 0x00, 0xe0, 0xf8, 0xa0, 0x78, 
-	0xc8, 0x38, 0x48, 0x88, 0x18, 0x08, 0x18, 0x00, 0xe0, 0xf8, 0xa0, 0x78, 0xc8, 0x38, 0x48, 0x88, 
-	0x18, 0x08, 0x18, 0x00, 0xe0, 0xf8, 0xa0, 0x78, 0xc8, 0x38, 0x48, 0x88, 0x18, 0x08, 0x18, 0x00, 
-	0xf0, 0xa8, 0x68, 0x78, 0xa8, 0xf8, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x78, 0xf0, 0xa8, 0x68, 0x78, 
-	0xa8, 0xf8, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x78, 0xf0, 0xa8, 0x68, 0x78, 0xa8, 0xf8, 0xd0, 0x00, 
-	0xd0, 0x00, 0x00, 0x78, 0xf0, 0xa8, 0x68, 0x78, 0xa8, 0xf8, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x78, 
-	0xf0, 0xe8, 0xf0, 0xe8, 0xa0, 0x60, 0x40, 0x78, 0x38, 0x18, 0x08, 0x08, 0xf0, 0xe8, 0xf0, 0xe8, 
-	0xa0, 0x60, 0x40, 0x78, 0x38, 0x18, 0x08, 0x08, 0xf0, 0xe8, 0xf0, 0xe8, 0xa0, 0x60, 0x40, 0x78, 
-	0x38, 0x18, 0x08, 0x08, 0xf0, 0xe8, 0xf0, 0xe8, 0xa0, 0x60, 0x40, 0x78, 0x38, 0x18, 0x08, 0x08, 
-	0xf8, 0xe0, 0xe0, 0xd8, 0xa0, 0xd0, 0x98, 0xa0, 0xe0, 0x08, 0x00, 0x00, 0xf8, 0xe0, 0xe0, 0xd8, 
-	0xa0, 0xd0, 0x98, 0xa0, 0xe0, 0x08, 0x00, 0x00, 0xf8, 0xe0, 0xe0, 0xd8, 0xa0, 0xd0, 0x98, 0xa0, 
-	0xe0, 0x08, 0x00, 0x00, 0xf8, 0xe0, 0xe0, 0xd8, 0xa0, 0xd0, 0x98, 0xa0, 0xe0, 0x08, 0x00, 0x00, 
-	0xf8, 0xf8, 0xb8, 0x90, 0xc8, 0xc8, 0x48, 0x68, 0x78, 0x08, 0x20, 0x48, 0xf8, 0xf8, 0xb8, 0x90, 
-	0xc8, 0xc8, 0x48, 0x68, 0x78, 0x08, 0x20, 0x48, 0xf8, 0xf8, 0xb8, 0x90, 0xc8, 0xc8, 0x48, 0x68, 
-	0x78, 0x08, 0x20, 0x48, 0xf8, 0xf8, 0xb8, 0x90, 0xc8, 0xc8, 0x48, 0x68, 0x78, 0x08, 0x20, 0x48, 
-	0xf8, 0xd8, 0xa8, 0xe0, 0xa8, 0x78, 0x78, 0x58, 0x88, 0x00, 0x20, 0x30, 0xf8, 0xd8, 0xa8, 0xe0, 
-	0xa8, 0x78, 0x78, 0x58, 0x88, 0x00, 0x20, 0x30, 0xf8, 0xd8, 0xa8, 0xe0, 0xa8, 0x78, 0x78, 0x58, 
-	0x88, 0x00, 0x20, 0x30, 0xf8, 0xd8, 0xa8, 0xe0, 0xa8, 0x78, 0x78, 0x58, 0x88, 0x00, 0x20, 0x30, 
-	0xb8, 0xd0, 0xd0, 0xd8, 0x80, 0xd8, 0x80, 0x00, 0xa0, 0x38, 0x00, 0x00, 0xb8, 0xd0, 0xd0, 0xd8, 
-	0x80, 0xd8, 0x80, 0x00, 0xa0, 0x38, 0x00, 0x00, 0xb8, 0xd0, 0xd0, 0xd8, 0x80, 0xd8, 0x80, 0x00, 
-	0xa0, 0x38, 0x00, 0x00, 0xb8, 0xd0, 0xd0, 0xd8, 0x80, 0xd8, 0x80, 0x00, 0xa0, 0x38, 0x00, 0x00, 
-	0xb0, 0xe0, 0x18, 0xb8, 0x20, 0x58, 0x28, 0x10, 0x00, 0x00, 0x80, 0x60, 0xb0, 0xe0, 0x18, 0xb8, 
-	0x20, 0x58, 0x28, 0x10, 0x00, 0x00, 0x80, 0x60, 0xb0, 0xe0, 0x18, 0xb8, 0x20, 0x58, 0x28, 0x10, 
-	0x00, 0x00, 0x80, 0x60, 0xb0, 0xe0, 0x18, 0xb8, 0x20, 0x58, 0x28, 0x10, 0x00, 0x00, 0x80, 0x60, 
-	0xf8, 0xf8, 0xc8, 0xb8, 0xc0, 0x58, 0x80, 0x88, 0x40, 0x40, 0x50, 0x28, 0xf8, 0xf8, 0xc8, 0xb8, 
-	0xc0, 0x58, 0x80, 0x88, 0x40, 0x40, 0x50, 0x28, 0xf8, 0xf8, 0xc8, 0xb8, 0xc0, 0x58, 0x80, 0x88, 
-	0x40, 0x40, 0x50, 0x28, 0xf8, 0xf8, 0xc8, 0xb8, 0xc0, 0x58, 0x80, 0x88, 0x40, 0x40, 0x50, 0x28, 
-	0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xa5, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x9c, 0xff, 0xff, 
-	0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x63, 
-	0x00, 0x00, 0x00, 0x00, 0xa5, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0xff, 0xde, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-	0x84, 0x84, 0xff, 0xde, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0xff, 0xde, 
-	0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0xff, 0xde, 0x00, 0xff, 0xff, 0xff, 
-	0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0x52, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa5, 
-	0xa5, 0xa5, 0x52, 0x52, 0x52, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 
-	0x52, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5, 0x52, 0x52, 0x52, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x9c, 0x63, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xce, 0x00, 0x9c, 0x63, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x9c, 0x63, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x9c, 0x63, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xad, 0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 
-	0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x94, 0x42, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 
-	0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 
-	0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 
-	0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 
-	0x8c, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 0x00, 0x4a, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xad, 0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 
-	0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x94, 0x42, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x94, 0x42, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x00, 0xb5, 0x73, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x00, 0xb5, 0x73, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x52, 0xff, 0x00, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x52, 
-	0xff, 0x00, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xa5, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x9c, 0xff, 0xff, 
-	0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xff, 0x63, 0x52, 0xd6, 0x00, 0x00, 0x63, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0x63, 0x52, 0xd6, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0xb5, 0xb5, 0xff, 0xff, 0xff, 0x94, 0xad, 0x5a, 0x42, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xff, 0xff, 
-	0xff, 0x94, 0xad, 0x5a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 
-	0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 
-	0x00, 0x4a, 0x00, 0x00, 0xff, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 0x00, 0x4a, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 
-	0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x52, 0xff, 0x00, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x52, 
-	0xff, 0x00, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x52, 0xff, 0x00, 0xff, 0x42, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0x9c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0xff, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0xad, 0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 
-	0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x94, 0x42, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0x9c, 0x94, 0xb5, 0xff, 0x63, 0x94, 0x73, 0x00, 0x3a, 0x3a, 0xff, 0xff, 0x9c, 0x94, 
-	0xb5, 0xff, 0x63, 0x94, 0x73, 0x00, 0x3a, 0x3a, 0xff, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 
-	0x00, 0x4a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0x6b, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x52, 0x4a, 0x00, 0x00, 0x00, 0x6b, 0xff, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0x52, 0x4a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xa5, 
-	0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 
-	0x52, 0xde, 0x00, 0xff, 0x84, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x52, 0xde, 0x00, 0xff, 
-	0x84, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xa5, 
-	0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 
-	0xa5, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x9c, 0xff, 0xff, 
-	0xff, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0xff, 0x63, 0x52, 0xd6, 0x00, 0x00, 0x63, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x84, 0xff, 
-	0xff, 0xff, 0xce, 0x63, 0xef, 0xef, 0x9c, 0x84, 0x31, 0x5a, 0x5a, 0x5a, 0xff, 0xff, 0xce, 0x63, 
-	0xef, 0xef, 0x9c, 0x84, 0x31, 0x5a, 0x5a, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x73, 0x00, 0x94, 0x42, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 
-	0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x84, 0xff, 0xff, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 
-	0x00, 0x4a, 0x00, 0x00, 0xff, 0xff, 0xff, 0x5a, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0xff, 0xff, 0x8c, 0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x8c, 
-	0x8c, 0xde, 0x52, 0x52, 0x8c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 
-	0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0x84, 0x84, 0x94, 0x3a, 0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x31, 0x84, 
-	0x00, 0x00, 0x4a, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-	0xad, 0x63, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 
-	0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x63, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0xad, 0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xad, 
-	0xad, 0x84, 0x42, 0x73, 0x7b, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xad, 0x63, 0x84, 0x31, 
-	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xff, 0xff, 0xff, 0x7b, 0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x7b, 
-	0xff, 0x31, 0x00, 0x63, 0xc5, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x84, 0x84, 0x94, 0x3a, 
-	0x3a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x63, 0xa5, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 
-	0xf8, 0x4f, 0x2d, 0xe9, 0x00, 0xc0, 0xa0, 0xe1, 0xa0, 0xa3, 0x9f, 0xe5, 0x12, 0x2d, 0x8a, 0xe2, 
-	0xf8, 0x0b, 0x92, 0xe8, 0x0a, 0x02, 0x03, 0xe2, 0x05, 0x12, 0x03, 0xe2, 0xa1, 0x1b, 0xa0, 0xe1, 
-	0xa0, 0x0c, 0x81, 0xe1, 0x24, 0x08, 0x80, 0xe1, 0xb2, 0x00, 0xcc, 0xe0, 0x25, 0x08, 0xa0, 0xe1, 
-	0xb2, 0x00, 0xcc, 0xe0, 0x26, 0x08, 0xa0, 0xe1, 0xb2, 0x00, 0xcc, 0xe0, 0x27, 0x08, 0xa0, 0xe1, 
-	0xb2, 0x00, 0xcc, 0xe0, 0x2b, 0x08, 0xa0, 0xe1, 0xb2, 0x00, 0xcc, 0xe0, 0xc4, 0x04, 0x9a, 0xe5, 
-	0x00, 0x00, 0x49, 0xe0, 0xb2, 0x00, 0xcc, 0xe0, 0x04, 0x80, 0x8c, 0xe4, 0xf8, 0x4f, 0xbd, 0xe8, 
-	0x10, 0x00, 0xa0, 0xe3, 0x1e, 0xff, 0x2f, 0xe1, 0xf8, 0x4f, 0x2d, 0xe9, 0x00, 0xc0, 0xa0, 0xe1, 
-	0x38, 0xa3, 0x9f, 0xe5, 0x12, 0x2d, 0x8a, 0xe2, 0xf8, 0x0b, 0x92, 0xe8, 0x01, 0x00, 0xdc, 0xe4, 
-	0xa0, 0x30, 0x00, 0xe2, 0x50, 0x00, 0x00, 0xe2, 0x80, 0x0c, 0xa0, 0xe1, 0x83, 0x3b, 0x80, 0xe1, 
-	0x01, 0x00, 0xdc, 0xe4, 0x00, 0x4c, 0xa0, 0xe1, 0xb2, 0x00, 0xdc, 0xe0, 0x00, 0x58, 0xa0, 0xe1, 
-	0xb2, 0x00, 0xdc, 0xe0, 0x00, 0x68, 0xa0, 0xe1, 0xb2, 0x00, 0xdc, 0xe0, 0x00, 0x78, 0xa0, 0xe1, 
-	0xb2, 0x00, 0xdc, 0xe0, 0x00, 0xb8, 0xa0, 0xe1, 0xb2, 0x00, 0xdc, 0xe0, 0x00, 0x90, 0xa0, 0xe1, 
-	0x04, 0x80, 0x9c, 0xe4, 0xf8, 0x0b, 0x82, 0xe8, 0xf8, 0x4f, 0xbd, 0xe8, 0x01, 0x00, 0xa0, 0xe3, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf8, 0x4f, 0x2d, 0xe9, 0xd0, 0xa2, 0x9f, 0xe5, 0x94, 0x84, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe1, 0x80, 0x20, 0xa0, 0xe3, 0x00, 0x10, 0xa0, 0xe3, 0x18, 0xf2, 0xff, 0xeb, 
-	0x00, 0x40, 0xa0, 0xe3, 0x00, 0x00, 0xa0, 0xe3, 0x04, 0x20, 0xa0, 0xe1, 0xb4, 0x02, 0x00, 0xeb, 
-	0x04, 0x00, 0xc3, 0xe7, 0x01, 0x40, 0x84, 0xe2, 0x01, 0x0c, 0x54, 0xe3, 0xf8, 0xff, 0xff, 0xba, 
-	0x74, 0x05, 0xda, 0xe5, 0x11, 0x00, 0xc3, 0xe5, 0x75, 0x05, 0xda, 0xe5, 0x13, 0x00, 0xc3, 0xe5, 
-	0x76, 0x05, 0xda, 0xe5, 0x14, 0x00, 0xc3, 0xe5, 0x77, 0x05, 0xda, 0xe5, 0x16, 0x00, 0xc3, 0xe5, 
-	0x78, 0x05, 0xda, 0xe5, 0x18, 0x00, 0xc3, 0xe5, 0x79, 0x05, 0xda, 0xe5, 0x19, 0x00, 0xc3, 0xe5, 
-	0x7a, 0x05, 0xda, 0xe5, 0x1b, 0x00, 0xc3, 0xe5, 0x7b, 0x05, 0xda, 0xe5, 0x1d, 0x00, 0xc3, 0xe5, 
-	0x7c, 0x05, 0xda, 0xe5, 0x1e, 0x00, 0xc3, 0xe5, 0xf8, 0x4f, 0xbd, 0xe8, 0x01, 0x0c, 0xa0, 0xe3, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf8, 0x4f, 0x2d, 0xe9, 0x40, 0xa2, 0x9f, 0xe5, 0x94, 0x84, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe1, 0x00, 0x00, 0xd3, 0xe5, 0xd4, 0x05, 0xca, 0xe5, 0x02, 0x00, 0xd3, 0xe5, 
-	0xb2, 0x04, 0xca, 0xe5, 0x04, 0x00, 0xd3, 0xe5, 0xab, 0x04, 0xca, 0xe5, 0x05, 0x00, 0xa0, 0xe3, 
-	0x05, 0x00, 0xd3, 0xe5, 0xaf, 0x04, 0xca, 0xe5, 0x06, 0x00, 0xd3, 0xe5, 0xb0, 0x04, 0xca, 0xe5, 
-	0x07, 0x00, 0xd3, 0xe5, 0xb1, 0x04, 0xca, 0xe5, 0x0f, 0x00, 0xd3, 0xe5, 0xa2, 0x04, 0xca, 0xe5, 
-	0x10, 0x40, 0xa0, 0xe3, 0x04, 0x00, 0xd3, 0xe7, 0x04, 0x20, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xec, 0xf1, 0x9f, 0xe5, 0x01, 0x40, 0x84, 0xe2, 0x40, 0x00, 0x54, 0xe3, 0xf8, 0xff, 0xff, 0xba, 
-	0x40, 0x00, 0xd3, 0xe5, 0xe4, 0x04, 0xca, 0xe5, 0x00, 0x10, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xd0, 0xf1, 0x9f, 0xe5, 0x41, 0x00, 0xd3, 0xe5, 0xcc, 0x11, 0x9f, 0xe5, 0x00, 0x00, 0xc1, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0xc4, 0xf1, 0x9f, 0xe5, 0x42, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xbc, 0xf1, 0x9f, 0xe5, 0x43, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xb4, 0xf1, 0x9f, 0xe5, 
-	0x45, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xac, 0xf1, 0x9f, 0xe5, 0x47, 0x00, 0xd3, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0xa4, 0xf1, 0x9f, 0xe5, 0x48, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x9c, 0xf1, 0x9f, 0xe5, 0x49, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x94, 0xf1, 0x9f, 0xe5, 
-	0x4a, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x8c, 0xf1, 0x9f, 0xe5, 0x4b, 0x00, 0xd3, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x84, 0xf1, 0x9f, 0xe5, 0x4d, 0x00, 0xd3, 0xe5, 0xf1, 0x04, 0xca, 0xe5, 
-	0xf9, 0xee, 0xff, 0xeb, 0x4f, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x70, 0xf1, 0x9f, 0xe5, 
-	0x51, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x68, 0xf1, 0x9f, 0xe5, 0x52, 0x00, 0xd3, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x60, 0xf1, 0x9f, 0xe5, 0x53, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x58, 0xf1, 0x9f, 0xe5, 0x54, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x50, 0xf1, 0x9f, 0xe5, 
-	0x68, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x48, 0xf1, 0x9f, 0xe5, 0x6a, 0x00, 0xd3, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x40, 0xf1, 0x9f, 0xe5, 0x70, 0x00, 0xd3, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x38, 0xf1, 0x9f, 0xe5, 0x80, 0x40, 0xa0, 0xe3, 0x04, 0x00, 0xd3, 0xe7, 0x04, 0x20, 0xa0, 0xe1, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0xd8, 0xf0, 0x9f, 0xe5, 0x01, 0x40, 0x84, 0xe2, 0x01, 0x0c, 0x54, 0xe3, 
-	0xf8, 0xff, 0xff, 0xba, 0xf8, 0x4f, 0xbd, 0xe8, 0x01, 0x00, 0xa0, 0xe3, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xf8, 0x4f, 0x2d, 0xe9, 0xb4, 0xa0, 0x9f, 0xe5, 0x12, 0x2d, 0x8a, 0xe2, 0xf8, 0x0b, 0x92, 0xe8, 
-	0x00, 0x00, 0xa0, 0xe3, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x10, 0xe0, 0xe3, 0xf0, 0x00, 0x9f, 0xe5, 
-	0x30, 0x20, 0xa0, 0xe3, 0x8e, 0xf1, 0xff, 0xeb, 0xe8, 0x00, 0x9f, 0xe5, 0x40, 0x20, 0xa0, 0xe3, 
-	0x8b, 0xf1, 0xff, 0xeb, 0x00, 0x10, 0xa0, 0xe3, 0xdc, 0x00, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 
-	0x87, 0xf1, 0xff, 0xeb, 0xd4, 0x00, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 0x84, 0xf1, 0xff, 0xeb, 
-	0xcc, 0x00, 0x9f, 0xe5, 0x80, 0x20, 0xa0, 0xe3, 0x81, 0xf1, 0xff, 0xeb, 0xc4, 0x00, 0x9f, 0xe5, 
-	0x84, 0x20, 0xa0, 0xe3, 0x7e, 0xf1, 0xff, 0xeb, 0x84, 0x05, 0x9a, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xb4, 0xf0, 0x9f, 0xe5, 0x88, 0x05, 0x9a, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0xac, 0xf0, 0x9f, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0xa8, 0xf0, 0x9f, 0xe5, 0x12, 0x2d, 0x8a, 0xe2, 0xf8, 0x0b, 0x82, 0xe8, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x9c, 0xf0, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x98, 0xf0, 0x9f, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x94, 0xf0, 0x9f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x90, 0xf0, 0x9f, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x8c, 0xf0, 0x9f, 0xe5, 0xf8, 0x4f, 0xbd, 0xe8, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x68, 0x51, 0x00, 0x03, 0x20, 0x40, 0x00, 0x03, 0x70, 0x37, 0x00, 0x03, 0x00, 0x50, 0x00, 0x03, 
-	0xcc, 0x4f, 0x00, 0x03, 0x90, 0x38, 0x00, 0x03, 0xb4, 0x38, 0x00, 0x03, 0x54, 0x50, 0x00, 0x03, 
-	0xbc, 0x63, 0x00, 0x08, 0xfc, 0x63, 0x00, 0x08, 0x24, 0x64, 0x00, 0x08, 0x54, 0x3a, 0x00, 0x03, 
-	0xc0, 0x3a, 0x00, 0x03, 0x6c, 0x3a, 0x00, 0x03, 0x68, 0x6c, 0x00, 0x08, 0x70, 0x6c, 0x00, 0x08, 
-	0x7c, 0x6c, 0x00, 0x08, 0x8c, 0x6c, 0x00, 0x08, 0x5c, 0x66, 0x00, 0x08, 0x64, 0x66, 0x00, 0x08, 
-	0x50, 0x42, 0x00, 0x03, 0xdc, 0x99, 0x02, 0x02, 0x9c, 0x99, 0x02, 0x02, 0x5c, 0x98, 0x02, 0x02, 
-	0x9c, 0x97, 0x02, 0x02, 0xdc, 0x96, 0x02, 0x02, 0x18, 0x96, 0x02, 0x02, 0xa4, 0x55, 0x00, 0x08, 
-	0xac, 0x50, 0x00, 0x03, 0x9c, 0x46, 0x00, 0x03, 0x64, 0x5b, 0x00, 0x08, 0xcc, 0x5b, 0x00, 0x08, 
-	0x90, 0x35, 0x00, 0x03, 0x80, 0x47, 0x00, 0x03, 0xa8, 0x32, 0x00, 0x03, 0x02, 0xb4, 0x71, 0x46, 
-	0x49, 0x08, 0x49, 0x00, 0x09, 0x56, 0x49, 0x00, 0x8e, 0x44, 0x02, 0xbc, 0x70, 0x47, 0xc0, 0x46, 
-	0x02, 0xb4, 0x71, 0x46, 0x49, 0x08, 0x49, 0x00, 0x09, 0x5c, 0x49, 0x00, 0x8e, 0x44, 0x02, 0xbc, 
-	0x70, 0x47, 0xc0, 0x46, 0x03, 0xb4, 0x71, 0x46, 0x49, 0x08, 0x40, 0x00, 0x49, 0x00, 0x09, 0x5e, 
-	0x49, 0x00, 0x8e, 0x44, 0x03, 0xbc, 0x70, 0x47, 0x01, 0x20, 0x51, 0xe2, 0x1e, 0xff, 0x2f, 0x01, 
-	0x36, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x50, 0xe1, 0x22, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x11, 0xe1, 
-	0x23, 0x00, 0x00, 0x0a, 0x0e, 0x02, 0x11, 0xe3, 0x81, 0x11, 0xa0, 0x01, 0x08, 0x30, 0xa0, 0x03, 
-	0x01, 0x30, 0xa0, 0x13, 0x01, 0x02, 0x51, 0xe3, 0x00, 0x00, 0x51, 0x31, 0x01, 0x12, 0xa0, 0x31, 
-	0x03, 0x32, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x02, 0x01, 0x51, 0xe3, 0x00, 0x00, 0x51, 0x31, 
-	0x81, 0x10, 0xa0, 0x31, 0x83, 0x30, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x00, 0x20, 0xa0, 0xe3, 
-	0x01, 0x00, 0x50, 0xe1, 0x01, 0x00, 0x40, 0x20, 0x03, 0x20, 0x82, 0x21, 0xa1, 0x00, 0x50, 0xe1, 
-	0xa1, 0x00, 0x40, 0x20, 0xa3, 0x20, 0x82, 0x21, 0x21, 0x01, 0x50, 0xe1, 0x21, 0x01, 0x40, 0x20, 
-	0x23, 0x21, 0x82, 0x21, 0xa1, 0x01, 0x50, 0xe1, 0xa1, 0x01, 0x40, 0x20, 0xa3, 0x21, 0x82, 0x21, 
-	0x00, 0x00, 0x50, 0xe3, 0x23, 0x32, 0xb0, 0x11, 0x21, 0x12, 0xa0, 0x11, 0xef, 0xff, 0xff, 0x1a, 
-	0x02, 0x00, 0xa0, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x00, 0xa0, 0x03, 0x00, 0x00, 0xa0, 0x13, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x08, 0x51, 0xe3, 0x21, 0x18, 0xa0, 0x21, 0x10, 0x20, 0xa0, 0x23, 
-	0x00, 0x20, 0xa0, 0x33, 0x01, 0x0c, 0x51, 0xe3, 0x21, 0x14, 0xa0, 0x21, 0x08, 0x20, 0x82, 0x22, 
-	0x10, 0x00, 0x51, 0xe3, 0x21, 0x12, 0xa0, 0x21, 0x04, 0x20, 0x82, 0x22, 0x04, 0x00, 0x51, 0xe3, 
-	0x03, 0x20, 0x82, 0x82, 0xa1, 0x20, 0x82, 0x90, 0x30, 0x02, 0xa0, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x1f, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0xe1, 0x00, 0x00, 0x50, 0xe3, 0x00, 0x00, 0xe0, 0x13, 
-	0x99, 0x01, 0x00, 0xea, 0x00, 0x00, 0x51, 0xe3, 0xf8, 0xff, 0xff, 0x0a, 0x03, 0x40, 0x2d, 0xe9, 
-	0xbc, 0xff, 0xff, 0xeb, 0x06, 0x40, 0xbd, 0xe8, 0x92, 0x00, 0x03, 0xe0, 0x03, 0x10, 0x41, 0xe0, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0x51, 0xe3, 0x43, 0x00, 0x00, 0x0a, 0x01, 0xc0, 0x20, 0xe0, 
-	0x00, 0x10, 0x61, 0x42, 0x01, 0x20, 0x51, 0xe2, 0x27, 0x00, 0x00, 0x0a, 0x00, 0x30, 0xb0, 0xe1, 
-	0x00, 0x30, 0x60, 0x42, 0x01, 0x00, 0x53, 0xe1, 0x26, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x11, 0xe1, 
-	0x28, 0x00, 0x00, 0x0a, 0x0e, 0x02, 0x11, 0xe3, 0x81, 0x11, 0xa0, 0x01, 0x08, 0x20, 0xa0, 0x03, 
-	0x01, 0x20, 0xa0, 0x13, 0x01, 0x02, 0x51, 0xe3, 0x03, 0x00, 0x51, 0x31, 0x01, 0x12, 0xa0, 0x31, 
-	0x02, 0x22, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x02, 0x01, 0x51, 0xe3, 0x03, 0x00, 0x51, 0x31, 
-	0x81, 0x10, 0xa0, 0x31, 0x82, 0x20, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x00, 0x00, 0xa0, 0xe3, 
-	0x01, 0x00, 0x53, 0xe1, 0x01, 0x30, 0x43, 0x20, 0x02, 0x00, 0x80, 0x21, 0xa1, 0x00, 0x53, 0xe1, 
-	0xa1, 0x30, 0x43, 0x20, 0xa2, 0x00, 0x80, 0x21, 0x21, 0x01, 0x53, 0xe1, 0x21, 0x31, 0x43, 0x20, 
-	0x22, 0x01, 0x80, 0x21, 0xa1, 0x01, 0x53, 0xe1, 0xa1, 0x31, 0x43, 0x20, 0xa2, 0x01, 0x80, 0x21, 
-	0x00, 0x00, 0x53, 0xe3, 0x22, 0x22, 0xb0, 0x11, 0x21, 0x12, 0xa0, 0x11, 0xef, 0xff, 0xff, 0x1a, 
-	0x00, 0x00, 0x5c, 0xe3, 0x00, 0x00, 0x60, 0x42, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0x3c, 0xe1, 
-	0x00, 0x00, 0x60, 0x42, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0x33, 0xcc, 0x0f, 0xa0, 0x01, 
-	0x01, 0x00, 0x80, 0x03, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x08, 0x51, 0xe3, 0x21, 0x18, 0xa0, 0x21, 
-	0x10, 0x20, 0xa0, 0x23, 0x00, 0x20, 0xa0, 0x33, 0x01, 0x0c, 0x51, 0xe3, 0x21, 0x14, 0xa0, 0x21, 
-	0x08, 0x20, 0x82, 0x22, 0x10, 0x00, 0x51, 0xe3, 0x21, 0x12, 0xa0, 0x21, 0x04, 0x20, 0x82, 0x22, 
-	0x04, 0x00, 0x51, 0xe3, 0x03, 0x20, 0x82, 0x82, 0xa1, 0x20, 0x82, 0x90, 0x00, 0x00, 0x5c, 0xe3, 
-	0x33, 0x02, 0xa0, 0xe1, 0x00, 0x00, 0x60, 0x42, 0x1e, 0xff, 0x2f, 0xe1, 0x1f, 0xff, 0x2f, 0xe1, 
-	0x00, 0x00, 0xa0, 0xe1, 0x00, 0x00, 0x50, 0xe3, 0x02, 0x01, 0xe0, 0xc3, 0x02, 0x01, 0xa0, 0xb3, 
-	0x45, 0x01, 0x00, 0xea, 0x00, 0x00, 0x51, 0xe3, 0xf7, 0xff, 0xff, 0x0a, 0x03, 0x40, 0x2d, 0xe9, 
-	0xb1, 0xff, 0xff, 0xeb, 0x06, 0x40, 0xbd, 0xe8, 0x92, 0x00, 0x03, 0xe0, 0x03, 0x10, 0x41, 0xe0, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x70, 0x47, 0xc0, 0x46, 0x10, 0xb5, 0x07, 0x4c, 0x23, 0x78, 0x00, 0x2b, 
-	0x07, 0xd1, 0x06, 0x4b, 0x00, 0x2b, 0x02, 0xd0, 0x05, 0x48, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 
-	0x23, 0x70, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x74, 0x78, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-	0x44, 0xa9, 0x00, 0x08, 0x70, 0xb5, 0x0f, 0x4b, 0x0f, 0x4d, 0x5e, 0x1b, 0xb6, 0x10, 0xab, 0x42, 
-	0x06, 0xd0, 0x00, 0x24, 0x08, 0xcd, 0x01, 0x34, 0x00, 0xf0, 0x1c, 0xf8, 0xa6, 0x42, 0xf9, 0xd8, 
-	0xf7, 0xf7, 0x52, 0xf9, 0x09, 0x4b, 0x0a, 0x4d, 0x5e, 0x1b, 0xb6, 0x10, 0xab, 0x42, 0x06, 0xd0, 
-	0x00, 0x24, 0x08, 0xcd, 0x01, 0x34, 0x00, 0xf0, 0x0d, 0xf8, 0xa6, 0x42, 0xf9, 0xd8, 0x70, 0xbc, 
-	0x01, 0xbc, 0x00, 0x47, 0x44, 0x78, 0x00, 0x03, 0x44, 0x78, 0x00, 0x03, 0x48, 0x78, 0x00, 0x03, 
-	0x44, 0x78, 0x00, 0x03, 0x18, 0x47, 0xc0, 0x46, 0x05, 0x4b, 0x10, 0xb5, 0x00, 0x2b, 0x03, 0xd0, 
-	0x04, 0x49, 0x05, 0x48, 0x00, 0xe0, 0x00, 0xbf, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xc0, 0x46, 
-	0x00, 0x00, 0x00, 0x00, 0x88, 0x7d, 0x00, 0x03, 0x44, 0xa9, 0x00, 0x08, 0x30, 0xb5, 0x03, 0x2a, 
-	0x19, 0xd9, 0x03, 0x00, 0x0b, 0x43, 0x55, 0x1e, 0x9b, 0x07, 0x10, 0xd0, 0x00, 0x23, 0x03, 0xe0, 
-	0x5a, 0x1c, 0x9d, 0x42, 0x12, 0xd0, 0x13, 0x00, 0xc2, 0x5c, 0xcc, 0x5c, 0xa2, 0x42, 0xf7, 0xd0, 
-	0x10, 0x1b, 0x0c, 0xe0, 0x04, 0x3a, 0x04, 0x30, 0x04, 0x31, 0x03, 0x2a, 0x03, 0xd9, 0x04, 0x68, 
-	0x0b, 0x68, 0x9c, 0x42, 0xf6, 0xd0, 0x55, 0x1e, 0x00, 0x2a, 0xe7, 0xd1, 0x00, 0x20, 0x30, 0xbc, 
-	0x02, 0xbc, 0x08, 0x47, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x88, 0x42, 0x0e, 0xd9, 0x8b, 0x18, 
-	0x98, 0x42, 0x0b, 0xd2, 0x53, 0x1e, 0x00, 0x2a, 0x03, 0xd0, 0xca, 0x5c, 0xc2, 0x54, 0x01, 0x3b, 
-	0xfb, 0xd2, 0x80, 0xbc, 0xb8, 0x46, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x05, 0x00, 0x0f, 0x2a, 
-	0x0a, 0xd8, 0x56, 0x1e, 0x00, 0x2a, 0xf4, 0xd0, 0x00, 0x23, 0xcc, 0x5c, 0x1a, 0x00, 0xec, 0x54, 
-	0x01, 0x33, 0x96, 0x42, 0xf9, 0xd1, 0xec, 0xe7, 0x03, 0x24, 0x03, 0x00, 0x26, 0x00, 0x0b, 0x43, 
-	0x1e, 0x40, 0x1c, 0x42, 0x31, 0xd1, 0x15, 0x00, 0x10, 0x3d, 0x2d, 0x09, 0xa8, 0x46, 0x2d, 0x01, 
-	0xac, 0x46, 0x03, 0x00, 0x0c, 0x00, 0x84, 0x44, 0x27, 0x68, 0x1f, 0x60, 0x67, 0x68, 0x5f, 0x60, 
-	0xa7, 0x68, 0x9f, 0x60, 0xe7, 0x68, 0x1d, 0x00, 0xdf, 0x60, 0x10, 0x34, 0x10, 0x33, 0x65, 0x45, 
-	0xf2, 0xd1, 0x45, 0x46, 0x0f, 0x23, 0x0c, 0x24, 0x01, 0x35, 0x2d, 0x01, 0x49, 0x19, 0x13, 0x40, 
-	0x45, 0x19, 0x14, 0x42, 0x13, 0xd0, 0x8c, 0x59, 0xac, 0x51, 0x04, 0x36, 0x9c, 0x1b, 0x03, 0x2c, 
-	0xf9, 0xd8, 0x04, 0x3b, 0x9b, 0x08, 0x01, 0x33, 0x9b, 0x00, 0xed, 0x18, 0xc9, 0x18, 0x03, 0x23, 
-	0x1a, 0x40, 0x56, 0x1e, 0x00, 0x2a, 0xbf, 0xd1, 0xb3, 0xe7, 0x56, 0x1e, 0xbc, 0xe7, 0x1a, 0x00, 
-	0xb7, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0x05, 0x00, 0x83, 0x07, 0x4d, 0xd0, 0x54, 0x1e, 0x00, 0x2a, 
-	0x47, 0xd0, 0x0a, 0x06, 0x03, 0x00, 0x03, 0x26, 0x12, 0x0e, 0x02, 0xe0, 0x01, 0x35, 0x01, 0x3c, 
-	0x3f, 0xd3, 0x01, 0x33, 0x2a, 0x70, 0x33, 0x42, 0xf8, 0xd1, 0x03, 0x2c, 0x30, 0xd9, 0xff, 0x22, 
-	0x0a, 0x40, 0x15, 0x02, 0xad, 0x18, 0x2a, 0x04, 0xad, 0x18, 0x0f, 0x2c, 0x37, 0xd9, 0x27, 0x00, 
-	0x10, 0x3f, 0x3f, 0x09, 0x3e, 0x01, 0xb4, 0x46, 0x1e, 0x00, 0x1a, 0x00, 0x10, 0x36, 0x66, 0x44, 
-	0x15, 0x60, 0x55, 0x60, 0x95, 0x60, 0xd5, 0x60, 0x10, 0x32, 0x96, 0x42, 0xf8, 0xd1, 0x01, 0x37, 
-	0x3f, 0x01, 0xdb, 0x19, 0x0f, 0x27, 0x0c, 0x22, 0x27, 0x40, 0x22, 0x40, 0x3c, 0x00, 0x00, 0x2a, 
-	0x0e, 0xd0, 0x3e, 0x1f, 0xb6, 0x08, 0xb4, 0x00, 0xa4, 0x46, 0x1a, 0x00, 0x1c, 0x1d, 0x64, 0x44, 
-	0x20, 0xc2, 0xa2, 0x42, 0xfc, 0xd1, 0x03, 0x24, 0x01, 0x36, 0xb6, 0x00, 0x9b, 0x19, 0x3c, 0x40, 
-	0x00, 0x2c, 0x06, 0xd0, 0x09, 0x06, 0x09, 0x0e, 0x1c, 0x19, 0x19, 0x70, 0x01, 0x33, 0x9c, 0x42, 
-	0xfb, 0xd1, 0xf0, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x03, 0x00, 0x14, 0x00, 0xbd, 0xe7, 0x27, 0x00, 
-	0xdf, 0xe7, 0xc0, 0x46, 0x70, 0xb5, 0x10, 0x4b, 0x10, 0x4d, 0x11, 0x4c, 0x5b, 0x1b, 0x23, 0x64, 
-	0x80, 0x23, 0x10, 0x49, 0xe5, 0x63, 0x61, 0x60, 0x1b, 0x05, 0x99, 0x42, 0x04, 0xd2, 0x63, 0x6c, 
-	0x00, 0x2b, 0x08, 0xd0, 0x0c, 0x4b, 0x63, 0x60, 0x0c, 0x4b, 0x0d, 0x4a, 0x1a, 0x60, 0x0d, 0x4b, 
-	0x1a, 0x60, 0xf7, 0xf7, 0x99, 0xfa, 0x81, 0x22, 0x92, 0x04, 0x28, 0x00, 0x52, 0x1a, 0x00, 0xf0, 
-	0x1f, 0xf9, 0x65, 0x60, 0xf0, 0xe7, 0xc0, 0x46, 0x14, 0x92, 0x02, 0x02, 0xc4, 0x00, 0x00, 0x02, 
-	0x08, 0x00, 0x00, 0x02, 0x70, 0x2a, 0x01, 0x08, 0x70, 0x2a, 0x01, 0x0e, 0x14, 0x92, 0x02, 0x02, 
-	0xef, 0xbe, 0xad, 0xde, 0x0c, 0x9a, 0x02, 0x02, 0x70, 0xb5, 0x04, 0x00, 0x83, 0x07, 0x16, 0xd1, 
-	0x02, 0x68, 0x0f, 0x4b, 0x0f, 0x4d, 0xd3, 0x18, 0x93, 0x43, 0x2b, 0x42, 0x0f, 0xd1, 0x42, 0x68, 
-	0x0b, 0x4b, 0xd3, 0x18, 0x93, 0x43, 0x04, 0x30, 0x2b, 0x42, 0x08, 0xd1, 0x42, 0x68, 0x08, 0x4b, 
-	0xd3, 0x18, 0x93, 0x43, 0x04, 0x30, 0x2b, 0x42, 0xf1, 0xd0, 0x00, 0xe0, 0x01, 0x30, 0x03, 0x78, 
-	0x00, 0x2b, 0xfb, 0xd1, 0x00, 0xf0, 0x08, 0xf8, 0x20, 0x00, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 
-	0xff, 0xfe, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x0a, 0x78, 0x01, 0x31, 0x1a, 0x70, 
-	0x01, 0x33, 0x00, 0x2a, 0xf9, 0xd1, 0x70, 0x47, 0x10, 0xb5, 0x83, 0x07, 0x0c, 0xd0, 0x03, 0x00, 
-	0x03, 0x21, 0x02, 0xe0, 0x01, 0x33, 0x0b, 0x42, 0x07, 0xd0, 0x1a, 0x78, 0x00, 0x2a, 0xf9, 0xd1, 
-	0x18, 0x1a, 0x10, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x03, 0x00, 0x19, 0x68, 0x0c, 0x4a, 0x0d, 0x4c, 
-	0x8a, 0x18, 0x8a, 0x43, 0x22, 0x42, 0x0f, 0xd1, 0x59, 0x68, 0x09, 0x4a, 0x8a, 0x18, 0x8a, 0x43, 
-	0x04, 0x33, 0x22, 0x42, 0x08, 0xd1, 0x59, 0x68, 0x05, 0x4a, 0x8a, 0x18, 0x8a, 0x43, 0x04, 0x33, 
-	0x22, 0x42, 0xf1, 0xd0, 0x00, 0xe0, 0x01, 0x33, 0x1a, 0x78, 0x00, 0x2a, 0xfb, 0xd1, 0xdf, 0xe7, 
-	0xff, 0xfe, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x70, 0xb5, 0x04, 0x00, 0x03, 0x23, 0x0c, 0x43, 
-	0x06, 0x00, 0x23, 0x42, 0x01, 0xd1, 0x93, 0x42, 0x17, 0xd3, 0x33, 0x00, 0x00, 0x24, 0x06, 0xe0, 
-	0x0d, 0x5d, 0x01, 0x3a, 0x35, 0x55, 0x01, 0x33, 0x01, 0x34, 0x00, 0x2d, 0x04, 0xd0, 0x00, 0x2a, 
-	0xf6, 0xd1, 0x70, 0xbc, 0x02, 0xbc, 0x08, 0x47, 0x00, 0x21, 0x9c, 0x18, 0x00, 0x2a, 0xf8, 0xd0, 
-	0x19, 0x70, 0x01, 0x33, 0xa3, 0x42, 0xfb, 0xd1, 0xf3, 0xe7, 0x07, 0x4d, 0x04, 0xe0, 0x04, 0x3a, 
-	0x10, 0xc6, 0x04, 0x31, 0x03, 0x2a, 0xe0, 0xd9, 0x0c, 0x68, 0x04, 0x4b, 0xe3, 0x18, 0xa3, 0x43, 
-	0x2b, 0x42, 0xf4, 0xd0, 0xd9, 0xe7, 0xc0, 0x46, 0x80, 0x80, 0x80, 0x80, 0xff, 0xfe, 0xfe, 0xfe, 
-	0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 0x14, 0x46, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 
-	0xab, 0xfe, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 0x28, 0x46, 0x00, 0x03, 
-	0x04, 0xf0, 0x1f, 0xe5, 0x40, 0x46, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0x55, 0xf1, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x20, 0xf2, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0xec, 0xf4, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x06, 0xf2, 0xff, 0xea, 0x04, 0xf0, 0x1f, 0xe5, 0x9c, 0x46, 0x00, 0x03, 
-	0x78, 0x47, 0xfd, 0xe7, 0x59, 0xf1, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0xea, 0xf4, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0xf7, 0xf4, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0xeb, 0xfd, 0xff, 0xea, 
-	0x04, 0xf0, 0x1f, 0xe5, 0x14, 0x45, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0xe7, 0xf1, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x47, 0xfe, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0x2d, 0xed, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x7f, 0xf5, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0xad, 0xec, 0xff, 0xea, 
-	0x00, 0xc0, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 0xa9, 0x14, 0x00, 0x08, 0x04, 0xf0, 0x1f, 0xe5, 
-	0xe4, 0x44, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 0x30, 0x45, 0x00, 0x03, 
-	0x78, 0x47, 0xfd, 0xe7, 0xbb, 0xef, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0x61, 0xf5, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x1f, 0xf1, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0xc4, 0xfe, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x3d, 0xed, 0xff, 0xea, 0x78, 0x47, 0xfd, 0xe7, 0x9a, 0xf4, 0xff, 0xea, 
-	0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 0x38, 0x46, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 
-	0x67, 0xfe, 0xff, 0xea, 0x04, 0xf0, 0x1f, 0xe5, 0x94, 0x3d, 0x00, 0x03, 0x00, 0xc0, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0x25, 0x8f, 0x00, 0x08, 0x78, 0x47, 0xfd, 0xe7, 0xb6, 0xf4, 0xff, 0xea, 
-	0x04, 0xf0, 0x1f, 0xe5, 0xac, 0x50, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 
-	0xa4, 0x45, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0x09, 0xed, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 
-	0x9e, 0x46, 0x70, 0x47, 0x00, 0xfe, 0x00, 0x06, 0x71, 0x00, 0xff, 0x00, 0x00, 0x00, 0x15, 0x00, 
-	0xdb, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x35, 0x00, 0x67, 0x00, 
-	0x75, 0x00, 0x92, 0x00, 0x99, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x28, 0x41, 0xa5, 0x41, 0xe8, 0x00, 
-	0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x61, 0x45, 
-	0x00, 0x00, 0xd3, 0x52, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x3c, 0x00, 
-	0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xb3, 0x55, 0x00, 0x00, 0x34, 0x00, 0x66, 0x45, 0xf4, 0x20, 
-	0x00, 0x00, 0x3d, 0x00, 0x6a, 0x49, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
-	0x46, 0x45, 0x00, 0x00, 0x0d, 0x45, 0x00, 0x00, 0xbf, 0x20, 0x00, 0x00, 0x28, 0x46, 0x4b, 0x00, 
-	0x90, 0x00, 0x9a, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x39, 0x00, 0x43, 0x00, 0x97, 0x00, 0x00, 0x00, 
-	0xa5, 0x52, 0x00, 0x00, 0x18, 0x49, 0x3f, 0x00, 0x66, 0x4c, 0xc6, 0x20, 0x00, 0x00, 0x95, 0x00, 
-	0xb3, 0x52, 0x00, 0x00, 0x3e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x0d, 0x52, 0x69, 0x00, 0xf2, 0x00, 
-	0x00, 0x00, 0x59, 0x00, 0xc6, 0x41, 0x00, 0x00, 0x86, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xbf, 0x43, 
-	0xce, 0x00, 0xd1, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x27, 0x42, 0x49, 0x00, 
-	0x5c, 0x00, 0xb3, 0x42, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x18, 0x4b, 
-	0x6a, 0x4b, 0x6b, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x4e, 0x61, 0x41, 
-	0x8b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x29, 0x00, 0x52, 0x00, 0x5d, 0x00, 0x68, 0x00, 
-	0x6d, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xa2, 0x00, 0xf7, 0x00, 0x00, 0x00, 
-	0x46, 0x52, 0x00, 0x00, 0xd3, 0x49, 0x00, 0x00, 0xf4, 0x2d, 0x31, 0x2e, 0x30, 0x37, 0x00, 0x2a, 
-	0x7c, 0x3b, 0x40, 0x5c, 0x7e, 0x5e, 0x60, 0x7b, 0x7d, 0x7f, 0x4e, 0x49, 0x4e, 0x54, 0x45, 0x4e, 
-	0x44, 0x4f, 0x00, 0xff, 0x56, 0x45, 0x52, 0x53, 0x52, 0x41, 0x4d, 0x20, 0x52, 0x41, 0x4d, 0x32, 
-	0x56, 0x52, 0x41, 0x4d, 0x49, 0x4f, 0x20, 0x20, 0x52, 0x45, 0x47, 0x53, 0x4d, 0x41, 0x50, 0x52, 
-	0x50, 0x41, 0x4c, 0x20, 0x45, 0x4d, 0x55, 0x20, 0x4f, 0x41, 0x4d, 0x20, 0x53, 0x47, 0x42, 0x20, 
-	0xcd, 0x19, 0x00, 0x08, 0xed, 0x1a, 0x00, 0x08, 0x15, 0x1b, 0x00, 0x08, 0x35, 0x1a, 0x00, 0x08, 
-	0xa4, 0x89, 0x00, 0x08, 0xa8, 0x88, 0x00, 0x08, 0x3d, 0x1b, 0x00, 0x08, 0x61, 0x1b, 0x00, 0x08, 
-	0xe5, 0x19, 0x00, 0x08, 0x85, 0x1b, 0x00, 0x08, 0xc9, 0x1b, 0x00, 0x08, 0xc1, 0x19, 0x00, 0x08, 
-	0xe9, 0x19, 0x00, 0x08, 0x65, 0x1a, 0x00, 0x08, 0x91, 0x1a, 0x00, 0x08, 0x14, 0x89, 0x00, 0x08, 
-	0x40, 0x88, 0x00, 0x08, 0x05, 0x1a, 0x00, 0x08, 0xc5, 0x1a, 0x00, 0x08, 0xc9, 0x19, 0x00, 0x08, 
-	0x1d, 0x1a, 0x00, 0x08, 0xcd, 0x1b, 0x00, 0x08, 0x10, 0x32, 0x9b, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 
-	0x9f, 0x1f, 0x5b, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 0x1f, 0x32, 0x9d, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 
-	0x25, 0x1f, 0x5d, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 0x24, 0x32, 0x9f, 0x1f, 0x1f, 0x1f, 0x22, 0x1f, 
-	0x24, 0x1f, 0x5f, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 0x24, 0x3f, 0x9f, 0x1f, 0xdc, 0xdf, 0xac, 0x10, 
-	0x24, 0x1f, 0x5f, 0x1f, 0x1f, 0x1f, 0x62, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 
-	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 
-	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x1a, 0x1a, 0x1a, 0x1a, 0x10, 0x1a, 0x1a, 0x1a, 
-	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x10, 0x1a, 0x1a, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x1f, 0x9c, 
-	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x50, 0x10, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 
-	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x50, 
-	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1c, 0x10, 
-	0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x50, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1c, 0x10, 
-	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x18, 0x1f, 0x26, 0x27, 0x2f, 0x1f, 0x1a, 0x1f, 
-	0x18, 0x19, 0x26, 0x2e, 0x2f, 0x2f, 0x2a, 0x1f, 0x18, 0x1f, 0x26, 0x1f, 0x2f, 0x1f, 0x1a, 0x1f, 
-	0x18, 0x19, 0x26, 0x1f, 0x2f, 0x1f, 0x2a, 0x1f, 0xa1, 0x1f, 0x9b, 0x1f, 0x1f, 0x1f, 0x2a, 0x1f, 
-	0x3f, 0x1f, 0xb3, 0x1f, 0x1f, 0x1f, 0x2a, 0x1f, 0x21, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x2a, 0x1f, 
-	0x3f, 0x1f, 0x73, 0x10, 0x1f, 0x1f, 0x22, 0x1f, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x46, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x80, 0x00, 0x02, 
-	0x13, 0xa2, 0x00, 0x08, 0x90, 0x9d, 0x00, 0x08, 0x16, 0xa2, 0x00, 0x08, 0x90, 0x9d, 0x00, 0x08, 
-	0x13, 0xa2, 0x00, 0x08, 0x1d, 0xa2, 0x00, 0x08, 0x02, 0xa2, 0x00, 0x08, 0x07, 0xa2, 0x00, 0x08, 
-	0x0d, 0xa2, 0x00, 0x08, 0x90, 0x9d, 0x00, 0x08, 0xd9, 0x9d, 0x00, 0x08, 0xb4, 0x9d, 0x00, 0x08, 
-	0xc8, 0x9d, 0x00, 0x08, 0xdc, 0x9d, 0x00, 0x08, 0xa2, 0xa1, 0x00, 0x08, 0xa1, 0xa1, 0x00, 0x08, 
-	0xfe, 0xa1, 0x00, 0x08, 0xfd, 0xa1, 0x00, 0x08, 0xfc, 0xa1, 0x00, 0x08, 0xe8, 0x9a, 0x00, 0x08, 
-	0xfd, 0x9d, 0x00, 0x08, 0x50, 0xa1, 0x00, 0x08, 0x8e, 0x9d, 0x00, 0x08, 0xa4, 0x9d, 0x00, 0x08, 
-	0xa9, 0x9d, 0x00, 0x08, 0x90, 0x9d, 0x00, 0x08, 0x94, 0x9d, 0x00, 0x08, 0x98, 0x9d, 0x00, 0x08, 
-	0x9f, 0x9d, 0x00, 0x08, 0xe6, 0xa1, 0x00, 0x08, 0xeb, 0xa1, 0x00, 0x08, 0xf0, 0xa1, 0x00, 0x08, 
-	0xf4, 0xa1, 0x00, 0x08, 0xf8, 0xa1, 0x00, 0x08, 0x71, 0x36, 0x00, 0x08, 0x71, 0x36, 0x00, 0x08, 
-	0x51, 0x34, 0x00, 0x08, 0x35, 0x35, 0x00, 0x08, 0xa5, 0x35, 0x00, 0x08, 0x0b, 0x08, 0x08, 0x03, 
-	0x02, 0x00, 0x00, 0x00, 0xe8, 0x99, 0x00, 0x08, 0x14, 0x9a, 0x00, 0x08, 0xc8, 0x99, 0x00, 0x08, 
-	0xbc, 0x99, 0x00, 0x08, 0xb4, 0x99, 0x00, 0x08, 0xe4, 0x9d, 0x00, 0x08, 0xed, 0x9d, 0x00, 0x08, 
-	0xf7, 0x9d, 0x00, 0x08, 0xff, 0x9d, 0x00, 0x08, 0x07, 0x9e, 0x00, 0x08, 0x0e, 0x9e, 0x00, 0x08, 
-	0x16, 0x9e, 0x00, 0x08, 0x27, 0x9e, 0x00, 0x08, 0x3a, 0x9e, 0x00, 0x08, 0x46, 0x9e, 0x00, 0x08, 
-	0x4d, 0x9e, 0x00, 0x08, 0x6a, 0x9e, 0x00, 0x08, 0x7a, 0x9e, 0x00, 0x08, 0x90, 0x9e, 0x00, 0x08, 
-	0x9a, 0x9e, 0x00, 0x08, 0xa0, 0x9e, 0x00, 0x08, 0xb1, 0x9e, 0x00, 0x08, 0xb8, 0x9e, 0x00, 0x08, 
-	0xbf, 0x9e, 0x00, 0x08, 0xc6, 0x9e, 0x00, 0x08, 0xcd, 0x9e, 0x00, 0x08, 0xd4, 0x9e, 0x00, 0x08, 
-	0xdb, 0x9e, 0x00, 0x08, 0xe2, 0x9e, 0x00, 0x08, 0xe9, 0x9e, 0x00, 0x08, 0xf0, 0x9e, 0x00, 0x08, 
-	0xf7, 0x9e, 0x00, 0x08, 0xfe, 0x9e, 0x00, 0x08, 0x05, 0x9f, 0x00, 0x08, 0x0c, 0x9f, 0x00, 0x08, 
-	0x13, 0x9f, 0x00, 0x08, 0x1a, 0x9f, 0x00, 0x08, 0x21, 0x9f, 0x00, 0x08, 0x28, 0x9f, 0x00, 0x08, 
-	0x2f, 0x9f, 0x00, 0x08, 0x36, 0x9f, 0x00, 0x08, 0x3d, 0x9f, 0x00, 0x08, 0x44, 0x9f, 0x00, 0x08, 
-	0x4b, 0x9f, 0x00, 0x08, 0x52, 0x9f, 0x00, 0x08, 0x59, 0x9f, 0x00, 0x08, 0x60, 0x9f, 0x00, 0x08, 
-	0x67, 0x9f, 0x00, 0x08, 0x6e, 0x9f, 0x00, 0x08, 0x75, 0x9f, 0x00, 0x08, 0x7c, 0x9f, 0x00, 0x08, 
-	0x83, 0x9f, 0x00, 0x08, 0x8a, 0x9f, 0x00, 0x08, 0x91, 0x9f, 0x00, 0x08, 0x3a, 0x9e, 0x00, 0x08, 
-	0x98, 0x9f, 0x00, 0x08, 0x9f, 0x9f, 0x00, 0x08, 0xa8, 0x9f, 0x00, 0x08, 0xb8, 0x9f, 0x00, 0x08, 
-	0xc7, 0x9f, 0x00, 0x08, 0xc9, 0x9f, 0x00, 0x08, 0xd7, 0x9f, 0x00, 0x08, 0xe5, 0x9f, 0x00, 0x08, 
-	0xf2, 0x9f, 0x00, 0x08, 0x10, 0xa0, 0x00, 0x08, 0x1c, 0xa0, 0x00, 0x08, 0x90, 0x9e, 0x00, 0x08, 
-	0x2a, 0xa0, 0x00, 0x08, 0x34, 0xa0, 0x00, 0x08, 0x3f, 0xa0, 0x00, 0x08, 0x56, 0xa0, 0x00, 0x08, 
-	0x5c, 0xa0, 0x00, 0x08, 0x68, 0xa0, 0x00, 0x08, 0x7d, 0xa0, 0x00, 0x08, 0x8e, 0xa0, 0x00, 0x08, 
-	0x9f, 0xa0, 0x00, 0x08, 0xaa, 0xa0, 0x00, 0x08, 0xaf, 0xa0, 0x00, 0x08, 0xbb, 0xa0, 0x00, 0x08, 
-	0xc7, 0xa0, 0x00, 0x08, 0xd3, 0xa0, 0x00, 0x08, 0xe1, 0xa0, 0x00, 0x08, 0xf0, 0xa0, 0x00, 0x08, 
-	0xf4, 0xa0, 0x00, 0x08, 0xa0, 0x9e, 0x00, 0x08, 0xff, 0xa0, 0x00, 0x08, 0x06, 0xa1, 0x00, 0x08, 
-	0x0f, 0xa1, 0x00, 0x08, 0x22, 0xa1, 0x00, 0x08, 0x35, 0xa1, 0x00, 0x08, 0x3f, 0xa1, 0x00, 0x08, 
-	0x52, 0xa1, 0x00, 0x08, 0x62, 0xa1, 0x00, 0x08, 0x6f, 0xa1, 0x00, 0x08, 0x78, 0xa1, 0x00, 0x08, 
-	0x8f, 0xa1, 0x00, 0x08, 0x99, 0xa1, 0x00, 0x08, 0xa4, 0xa1, 0x00, 0x08, 0xb2, 0xa1, 0x00, 0x08, 
-	0xbe, 0xa1, 0x00, 0x08, 0xc4, 0xa1, 0x00, 0x08, 0xed, 0x9f, 0x00, 0x08, 0xc9, 0xa1, 0x00, 0x08, 
-	0xce, 0xa1, 0x00, 0x08, 0xd5, 0xa1, 0x00, 0x08, 0xd1, 0xa1, 0x00, 0x08, 0xd8, 0xa1, 0x00, 0x08, 
-	0xdf, 0xa1, 0x00, 0x08, 0x05, 0x33, 0x00, 0x08, 0x29, 0x33, 0x00, 0x08, 0x01, 0x3b, 0x00, 0x08, 
-	0xc9, 0x32, 0x00, 0x08, 0xa5, 0x32, 0x00, 0x08, 0x35, 0x32, 0x00, 0x08, 0x4d, 0x32, 0x00, 0x08, 
-	0x4d, 0x33, 0x00, 0x08, 0x5d, 0x32, 0x00, 0x08, 0x71, 0x32, 0x00, 0x08, 0x81, 0x32, 0x00, 0x08, 
-	0xb9, 0x32, 0x00, 0x08, 0x95, 0x32, 0x00, 0x08, 0xe5, 0x31, 0x00, 0x08, 0x95, 0x31, 0x00, 0x08, 
-	0x0f, 0x38, 0x00, 0x08, 0x01, 0x38, 0x00, 0x08, 0x29, 0x38, 0x00, 0x08, 0x15, 0x2e, 0x00, 0x08, 
-	0xad, 0x30, 0x00, 0x08, 0x91, 0x24, 0x00, 0x08, 0x75, 0x3a, 0x00, 0x08, 0xf5, 0x32, 0x00, 0x08, 
-	0x3f, 0x3a, 0x00, 0x08, 0xe5, 0x31, 0x00, 0x08, 0x95, 0x31, 0x00, 0x08, 0x0f, 0x38, 0x00, 0x08, 
-	0x01, 0x38, 0x00, 0x08, 0x29, 0x38, 0x00, 0x08, 0x75, 0x3a, 0x00, 0x08, 0xf5, 0x32, 0x00, 0x08, 
-	0x3f, 0x3a, 0x00, 0x08, 0x3d, 0x40, 0x0b, 0x40, 0x10, 0x40, 0x26, 0x40, 0x35, 0x40, 0x03, 0x40, 
-	0x06, 0x40, 0x14, 0x40, 0x0e, 0x40, 0x0d, 0x40, 0x25, 0x40, 0x12, 0x40, 0x28, 0x40, 0x02, 0x40, 
-	0x18, 0x40, 0x09, 0x40, 0x0a, 0x40, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x52, 0x4f, 0x4d, 0x53, 0x20, 
-	0x66, 0x6f, 0x75, 0x6e, 0x64, 0x21, 0x00, 0x55, 0x73, 0x65, 0x20, 0x47, 0x6f, 0x6f, 0x6d, 0x62, 
-	0x61, 0x20, 0x46, 0x72, 0x6f, 0x6e, 0x74, 0x00, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 
-	0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x52, 
-	0x4f, 0x4d, 0x2c, 0x00, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x50, 0x6f, 0x67, 0x6f, 0x73, 
-	0x68, 0x65, 0x6c, 0x6c, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x00, 0x73, 0x75, 0x70, 0x70, 
-	0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x63, 0x61, 0x72, 0x74, 
-	0x72, 0x69, 0x64, 0x67, 0x65, 0x2e, 0x00, 0x47, 0x6f, 0x6f, 0x6d, 0x62, 0x61, 0x20, 0x43, 0x6f, 
-	0x6c, 0x6f, 0x72, 0x20, 0x76, 0x30, 0x2e, 0x35, 0x00, 0x31, 0x2e, 0x30, 0x37, 0x00, 0x4f, 0x63, 
-	0x74, 0x20, 0x31, 0x38, 0x20, 0x32, 0x30, 0x30, 0x30, 0x00, 0x20, 0x20, 0x57, 0x72, 0x69, 0x74, 
-	0x65, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x21, 0x20, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 
-	0x66, 0x75, 0x6c, 0x6c, 0x2e, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x6c, 0x65, 0x74, 
-	0x65, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x73, 0x61, 0x76, 0x65, 0x73, 0x2e, 0x00, 0x30, 0x30, 
-	0x3a, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x20, 0x2d, 0x20, 0x00, 0x2c, 0x20, 0x66, 0x72, 0x65, 0x65, 
-	0x20, 0x00, 0x50, 0x75, 0x73, 0x68, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x74, 0x6f, 
-	0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x3c, 0x4e, 0x45, 0x57, 0x3e, 0x00, 0x53, 0x61, 
-	0x76, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3a, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x20, 0x73, 
-	0x74, 0x61, 0x74, 0x65, 0x3a, 0x00, 0x45, 0x72, 0x61, 0x73, 0x65, 0x20, 0x53, 0x52, 0x41, 0x4d, 
-	0x3a, 0x00, 0x50, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x75, 0x70, 
-	0x20, 0x00, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x00, 0x57, 0x65, 0x20, 0x6e, 0x6f, 0x77, 0x20, 
-	0x68, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x73, 0x70, 0x61, 0x63, 
-	0x65, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x61, 0x76, 
-	0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x4f, 
-	0x4d, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x00, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 
-	0x67, 0x73, 0x00, 0x56, 0x53, 0x79, 0x6e, 0x63, 0x3a, 0x20, 0x00, 0x46, 0x50, 0x53, 0x2d, 0x4d, 
-	0x65, 0x74, 0x65, 0x72, 0x3a, 0x20, 0x00, 0x41, 0x75, 0x74, 0x6f, 0x73, 0x6c, 0x65, 0x65, 0x70, 
-	0x3a, 0x20, 0x00, 0x53, 0x77, 0x61, 0x70, 0x20, 0x41, 0x2d, 0x42, 0x3a, 0x20, 0x00, 0x41, 0x75, 
-	0x74, 0x6f, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3a, 0x20, 0x00, 0x47, 
-	0x61, 0x6d, 0x65, 0x20, 0x42, 0x6f, 0x79, 0x3a, 0x20, 0x00, 0x41, 0x75, 0x74, 0x6f, 0x20, 0x53, 
-	0x47, 0x42, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x00, 0x49, 0x64, 0x65, 0x6e, 
-	0x74, 0x69, 0x66, 0x79, 0x20, 0x61, 0x73, 0x20, 0x47, 0x42, 0x41, 0x3a, 0x20, 0x00, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x53, 0x65, 0x74, 0x74, 
-	0x69, 0x6e, 0x67, 0x73, 0x00, 0x50, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x3a, 0x20, 0x00, 0x47, 
-	0x61, 0x6d, 0x6d, 0x61, 0x3a, 0x20, 0x00, 0x53, 0x47, 0x42, 0x20, 0x50, 0x61, 0x6c, 0x65, 0x74, 
-	0x74, 0x65, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x3a, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x48, 0x61, 0x63, 0x6b, 0x73, 0x00, 
-	0x44, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3a, 0x20, 0x00, 0x4c, 
-	0x43, 0x44, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x68, 0x61, 0x63, 0x6b, 
-	0x3a, 0x20, 0x00, 0x4a, 0x61, 0x67, 0x6f, 0x6f, 0x6d, 0x62, 0x61, 0x20, 0x43, 0x6f, 0x6c, 0x6f, 
-	0x72, 0x20, 0x76, 0x30, 0x2e, 0x35, 0x20, 0x6f, 0x6e, 0x20, 0x00, 0x42, 0x79, 0x20, 0x46, 0x6c, 
-	0x75, 0x42, 0x42, 0x61, 0x2c, 0x20, 0x44, 0x77, 0x65, 0x64, 0x69, 0x74, 0x2c, 0x20, 0x4a, 0x61, 
-	0x67, 0x61, 0x00, 0x42, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x66, 0x69, 0x72, 0x65, 0x3a, 0x20, 0x00, 
-	0x41, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x66, 0x69, 0x72, 0x65, 0x3a, 0x20, 0x00, 0x44, 0x69, 0x73, 
-	0x70, 0x6c, 0x61, 0x79, 0x2d, 0x3e, 0x00, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 
-	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2d, 0x3e, 0x00, 0x53, 0x70, 0x65, 0x65, 0x64, 0x20, 0x48, 0x61, 
-	0x63, 0x6b, 0x73, 0x2d, 0x3e, 0x00, 0x53, 0x6c, 0x65, 0x65, 0x70, 0x00, 0x53, 0x61, 0x76, 0x65, 
-	0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x3e, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x20, 0x53, 0x74, 
-	0x61, 0x74, 0x65, 0x2d, 0x3e, 0x00, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x20, 0x53, 0x52, 0x41, 
-	0x4d, 0x2d, 0x3e, 0x00, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x45, 0x78, 0x69, 0x74, 
-	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x00, 0x33, 0x00, 
-	0x4f, 0x46, 0x46, 0x00, 0x4c, 0x6f, 0x77, 0x00, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x00, 0x48, 
-	0x69, 0x67, 0x68, 0x00, 0x46, 0x75, 0x6c, 0x6c, 0x00, 0x48, 0x61, 0x6c, 0x66, 0x20, 0x73, 0x70, 
-	0x65, 0x65, 0x64, 0x00, 0x50, 0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x53, 0x47, 0x42, 0x20, 0x6f, 
-	0x76, 0x65, 0x72, 0x20, 0x47, 0x42, 0x43, 0x00, 0x50, 0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x47, 
-	0x42, 0x43, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x53, 0x47, 0x42, 0x00, 0x47, 0x42, 0x43, 0x2b, 
-	0x53, 0x47, 0x42, 0x00, 0x50, 0x65, 0x61, 0x20, 0x53, 0x6f, 0x75, 0x70, 0x00, 0x47, 0x72, 0x61, 
-	0x79, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x00, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x20, 0x31, 0x00, 0x4d, 
-	0x75, 0x6c, 0x74, 0x69, 0x20, 0x32, 0x00, 0x5a, 0x65, 0x6c, 0x64, 0x61, 0x2e, 0x00, 0x4d, 0x65, 
-	0x74, 0x72, 0x6f, 0x69, 0x64, 0x00, 0x41, 0x64, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x65, 0x20, 
-	0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x41, 0x64, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x65, 
-	0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x32, 0x00, 0x42, 0x61, 0x6c, 0x6c, 0x6f, 0x6f, 
-	0x6e, 0x20, 0x4b, 0x69, 0x64, 0x00, 0x42, 0x61, 0x74, 0x6d, 0x61, 0x6e, 0x00, 0x42, 0x61, 0x74, 
-	0x6d, 0x61, 0x6e, 0x20, 0x2d, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x66, 0x20, 
-	0x74, 0x68, 0x65, 0x20, 0x4a, 0x6f, 0x6b, 0x65, 0x72, 0x00, 0x42, 0x69, 0x6f, 0x6e, 0x69, 0x63, 
-	0x20, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x6f, 0x00, 0x43, 0x61, 0x73, 0x74, 0x6c, 0x65, 
-	0x76, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x41, 0x64, 0x76, 0x65, 0x6e, 0x74, 0x75, 0x72, 0x65, 0x00, 
-	0x44, 0x72, 0x2e, 0x20, 0x4d, 0x61, 0x72, 0x69, 0x6f, 0x00, 0x4b, 0x69, 0x72, 0x62, 0x79, 0x00, 
-	0x44, 0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x20, 0x4b, 0x6f, 0x6e, 0x67, 0x20, 0x4c, 0x61, 0x6e, 0x64, 
-	0x00, 0x59, 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 0x41, 0x00, 0x53, 
-	0x47, 0x42, 0x20, 0x31, 0x42, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 0x43, 0x00, 0x53, 0x47, 0x42, 
-	0x20, 0x31, 0x44, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 0x45, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 
-	0x46, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 0x47, 0x00, 0x53, 0x47, 0x42, 0x20, 0x31, 0x48, 0x00, 
-	0x53, 0x47, 0x42, 0x20, 0x32, 0x41, 0x00, 0x53, 0x47, 0x42, 0x20, 0x32, 0x42, 0x00, 0x53, 0x47, 
-	0x42, 0x20, 0x32, 0x43, 0x00, 0x53, 0x47, 0x42, 0x20, 0x32, 0x44, 0x00, 0x53, 0x47, 0x42, 0x20, 
-	0x32, 0x45, 0x00, 0x53, 0x47, 0x42, 0x20, 0x32, 0x46, 0x00, 0x53, 0x47, 0x42, 0x20, 0x32, 0x47, 
-	0x00, 0x53, 0x47, 0x42, 0x20, 0x32, 0x48, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 0x41, 0x00, 0x53, 
-	0x47, 0x42, 0x20, 0x33, 0x42, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 0x43, 0x00, 0x53, 0x47, 0x42, 
-	0x20, 0x33, 0x44, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 0x45, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 
-	0x46, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 0x47, 0x00, 0x53, 0x47, 0x42, 0x20, 0x33, 0x48, 0x00, 
-	0x53, 0x47, 0x42, 0x20, 0x34, 0x41, 0x00, 0x53, 0x47, 0x42, 0x20, 0x34, 0x42, 0x00, 0x53, 0x47, 
-	0x42, 0x20, 0x34, 0x43, 0x00, 0x53, 0x47, 0x42, 0x20, 0x34, 0x44, 0x00, 0x53, 0x47, 0x42, 0x20, 
-	0x34, 0x45, 0x00, 0x53, 0x47, 0x42, 0x20, 0x34, 0x46, 0x00, 0x53, 0x47, 0x42, 0x20, 0x34, 0x47, 
-	0x00, 0x53, 0x47, 0x42, 0x20, 0x34, 0x48, 0x00, 0x54, 0x65, 0x74, 0x72, 0x69, 0x73, 0x00, 0x41, 
-	0x6c, 0x6c, 0x65, 0x79, 0x77, 0x61, 0x79, 0x00, 0x4d, 0x61, 0x72, 0x69, 0x6f, 0x27, 0x73, 0x20, 
-	0x50, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x00, 0x53, 0x70, 0x61, 0x63, 0x65, 0x20, 0x49, 0x6e, 
-	0x76, 0x61, 0x64, 0x65, 0x72, 0x73, 0x00, 0x58, 0x00, 0x50, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 
-	0x43, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x00, 0x52, 0x61, 0x64, 0x61, 0x72, 0x20, 0x4d, 0x69, 0x73, 
-	0x73, 0x69, 0x6f, 0x6e, 0x00, 0x50, 0x6f, 0x6b, 0x65, 0x6d, 0x6f, 0x6e, 0x20, 0x42, 0x6c, 0x75, 
-	0x65, 0x00, 0x4b, 0x61, 0x65, 0x72, 0x75, 0x20, 0x6e, 0x6f, 0x20, 0x54, 0x61, 0x6d, 0x65, 0x20, 
-	0x6e, 0x69, 0x20, 0x4b, 0x61, 0x6e, 0x65, 0x20, 0x77, 0x61, 0x20, 0x4e, 0x61, 0x72, 0x75, 0x00, 
-	0x50, 0x6f, 0x6b, 0x65, 0x6d, 0x6f, 0x6e, 0x20, 0x52, 0x65, 0x64, 0x00, 0x50, 0x6f, 0x6b, 0x65, 
-	0x6d, 0x6f, 0x6e, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x00, 0x50, 0x69, 0x6e, 0x6f, 0x63, 0x63, 
-	0x68, 0x69, 0x6f, 0x00, 0x4d, 0x6f, 0x6c, 0x65, 0x20, 0x4d, 0x61, 0x6e, 0x69, 0x61, 0x00, 0x47, 
-	0x61, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x57, 0x61, 0x74, 0x63, 0x68, 0x20, 0x47, 0x61, 
-	0x6c, 0x6c, 0x65, 0x72, 0x79, 0x00, 0x59, 0x6f, 0x73, 0x68, 0x69, 0x00, 0x44, 0x6f, 0x6e, 0x6b, 
-	0x65, 0x79, 0x20, 0x4b, 0x6f, 0x6e, 0x67, 0x00, 0x4b, 0x69, 0x72, 0x62, 0x79, 0x27, 0x73, 0x20, 
-	0x50, 0x69, 0x6e, 0x62, 0x61, 0x6c, 0x6c, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x53, 0x75, 0x70, 
-	0x65, 0x72, 0x20, 0x4d, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x50, 0x6f, 
-	0x63, 0x6b, 0x65, 0x74, 0x20, 0x42, 0x6f, 0x6d, 0x62, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x00, 0x4b, 
-	0x69, 0x64, 0x20, 0x49, 0x63, 0x61, 0x72, 0x75, 0x73, 0x00, 0x47, 0x6f, 0x6c, 0x66, 0x00, 0x44, 
-	0x79, 0x6e, 0x61, 0x62, 0x6c, 0x61, 0x73, 0x74, 0x65, 0x72, 0x00, 0x42, 0x61, 0x74, 0x74, 0x6c, 
-	0x65, 0x74, 0x6f, 0x61, 0x64, 0x73, 0x00, 0x57, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x42, 0x6c, 0x61, 
-	0x73, 0x74, 0x00, 0x54, 0x65, 0x74, 0x72, 0x69, 0x73, 0x20, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 
-	0x00, 0x59, 0x6f, 0x73, 0x68, 0x69, 0x27, 0x73, 0x20, 0x43, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x00, 
-	0x51, 0x69, 0x78, 0x00, 0x57, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x00, 0x53, 
-	0x6f, 0x63, 0x63, 0x65, 0x72, 0x00, 0x42, 0x61, 0x73, 0x65, 0x62, 0x61, 0x6c, 0x6c, 0x00, 0x4b, 
-	0x69, 0x72, 0x62, 0x79, 0x27, 0x73, 0x20, 0x44, 0x72, 0x65, 0x61, 0x6d, 0x20, 0x4c, 0x61, 0x6e, 
-	0x64, 0x00, 0x53, 0x75, 0x70, 0x65, 0x72, 0x20, 0x4d, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x4c, 0x61, 
-	0x6e, 0x64, 0x20, 0x32, 0x00, 0x57, 0x61, 0x76, 0x65, 0x20, 0x52, 0x61, 0x63, 0x65, 0x00, 0x44, 
-	0x6f, 0x6e, 0x6b, 0x65, 0x79, 0x20, 0x4b, 0x6f, 0x6e, 0x67, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x20, 
-	0x32, 0x00, 0x4b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x49, 0x6e, 0x73, 0x74, 0x69, 0x6e, 0x63, 
-	0x74, 0x00, 0x4d, 0x79, 0x73, 0x74, 0x69, 0x63, 0x20, 0x51, 0x75, 0x65, 0x73, 0x74, 0x00, 0x4d, 
-	0x65, 0x67, 0x61, 0x20, 0x4d, 0x61, 0x6e, 0x00, 0x5a, 0x65, 0x6c, 0x64, 0x61, 0x20, 0x4c, 0x69, 
-	0x6e, 0x6b, 0x27, 0x73, 0x20, 0x41, 0x77, 0x61, 0x6b, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x00, 0x53, 
-	0x74, 0x61, 0x72, 0x20, 0x57, 0x61, 0x72, 0x73, 0x00, 0x4d, 0x65, 0x74, 0x72, 0x6f, 0x69, 0x64, 
-	0x20, 0x49, 0x49, 0x00, 0x57, 0x61, 0x72, 0x69, 0x6f, 0x20, 0x4c, 0x61, 0x6e, 0x64, 0x20, 0x49, 
-	0x49, 0x00, 0x50, 0x61, 0x63, 0x2d, 0x69, 0x6e, 0x2d, 0x54, 0x69, 0x6d, 0x65, 0x00, 0x42, 0x6c, 
-	0x61, 0x63, 0x6b, 0x00, 0x47, 0x72, 0x65, 0x79, 0x00, 0x4e, 0x6f, 0x6e, 0x65, 0x00, 0x31, 0x50, 
-	0x00, 0x4c, 0x69, 0x6e, 0x6b, 0x32, 0x50, 0x00, 0x4c, 0x69, 0x6e, 0x6b, 0x33, 0x50, 0x00, 0x4c, 
-	0x69, 0x6e, 0x6b, 0x34, 0x50, 0x00, 0x43, 0x72, 0x61, 0x70, 0x00, 0x50, 0x72, 0x6f, 0x74, 0x00, 
-	0x47, 0x42, 0x41, 0x00, 0x47, 0x42, 0x50, 0x00, 0x4e, 0x44, 0x53, 0x00, 0x49, 0x49, 0x49, 0x49, 
-	0x49, 0x00, 0x35, 0x6d, 0x69, 0x6e, 0x00, 0x31, 0x30, 0x6d, 0x69, 0x6e, 0x00, 0x33, 0x30, 0x6d, 
-	0x69, 0x6e, 0x00, 0x4f, 0x4e, 0x00, 0x53, 0x4c, 0x4f, 0x57, 0x4d, 0x4f, 0x00, 0x77, 0x69, 0x74, 
-	0x68, 0x20, 0x52, 0x00, 0x10, 0xc0, 0x0a, 0x00, 0x30, 0x00, 0x00, 0xf0, 0x01, 0xa0, 0x01, 0x60, 
-	0x01, 0x00, 0x00, 0x40, 0x80, 0x30, 0x03, 0x77, 0x77, 0x77, 0x14, 0x11, 0x61, 0x0d, 0x11, 0x11, 
-	0x00, 0x50, 0x00, 0x0f, 0x10, 0x03, 0x10, 0x00, 0x03, 0x82, 0xa0, 0x2b, 0x26, 0x00, 0x00, 0x70, 
-	0x27, 0x00, 0x17, 0x15, 0xb7, 0x00, 0x1f, 0x13, 0xe0, 0x1f, 0x20, 0x3f, 0x11, 0x00, 0x3f, 0xf0, 
-	0x66, 0xb0, 0x01, 0x4d, 0x50, 0x00, 0x3f, 0x40, 0x14, 0x00, 0x3f, 0x20, 0x2a, 0x88, 0x00, 0x7c, 
-	0x40, 0x38, 0x00, 0x06, 0x23, 0x00, 0x70, 0x37, 0x01, 0x00, 0x00, 0x66, 0x13, 0x00, 0x50, 0x35, 
-	0x01, 0x00, 0x55, 0x80, 0x50, 0x5e, 0x88, 0x18, 0x00, 0x80, 0x11, 0x88, 0x01, 0x00, 0x88, 0x01, 
-	0x81, 0x18, 0x77, 0x01, 0x70, 0x17, 0x00, 0x66, 0x01, 0x60, 0x16, 0x51, 0x15, 0x50, 0x14, 0x30, 
-	0x10, 0x55, 0x00, 0x24, 0x10, 0x6a, 0x60, 0x18, 0x00, 0x00, 0x52, 0x86, 0x00, 0x03, 0x80, 0x00, 
-	0x03, 0x70, 0x17, 0x00, 0x0f, 0x16, 0xe0, 0x30, 0x5f, 0x10, 0x03, 0x00, 0x5f, 0x80, 0x88, 0x68, 
-	0x00, 0x48, 0x10, 0x11, 0x84, 0x16, 0x00, 0x09, 0x16, 0x00, 0x40, 0x47, 0x01, 0x12, 0x40, 0x46, 
-	0x12, 0x01, 0x54, 0x13, 0x00, 0x5f, 0x10, 0x55, 0x55, 0x15, 0x10, 0xab, 0x80, 0x88, 0x88, 0x16, 
-	0x08, 0x10, 0x21, 0x68, 0x01, 0x20, 0x3f, 0x77, 0x77, 0x01, 0x00, 0x00, 0x10, 0x62, 0x12, 0x35, 
-	0x00, 0x53, 0x14, 0x01, 0x51, 0x55, 0x45, 0x12, 0x10, 0x11, 0x11, 0x00, 0x81, 0x60, 0x88, 0x00, 
-	0x1b, 0x00, 0x03, 0x48, 0x88, 0x01, 0x70, 0x13, 0x02, 0x77, 0x01, 0x36, 0x01, 0x66, 0x01, 0x30, 
-	0x3b, 0x55, 0x80, 0x00, 0x7c, 0x11, 0x01, 0x86, 0x88, 0x88, 0x01, 0x86, 0xa0, 0x00, 0x27, 0x88, 
-	0x00, 0x67, 0x47, 0x12, 0x73, 0x14, 0x11, 0x88, 0x00, 0x9f, 0x35, 0x00, 0x50, 0x70, 0x3f, 0x86, 
-	0x88, 0x01, 0x10, 0x80, 0x48, 0x11, 0x00, 0x06, 0x68, 0x00, 0x77, 0x13, 0x00, 0x72, 0x14, 0x46, 
-	0x01, 0x40, 0x16, 0x54, 0x03, 0x02, 0x50, 0x14, 0x41, 0x55, 0x45, 0x11, 0x10, 0x1f, 0x88, 0x02, 
-	0x88, 0x88, 0x18, 0x11, 0x11, 0x82, 0x00, 0x7c, 0x88, 0x1d, 0x14, 0x00, 0x40, 0x00, 0xff, 0x11, 
-	0x63, 0x80, 0xbf, 0x60, 0x00, 0x37, 0x00, 0x86, 0x14, 0x82, 0x06, 0x86, 0x02, 0x80, 0x16, 0x00, 
-	0x40, 0x77, 0x47, 0x11, 0x66, 0x12, 0x61, 0x06, 0x01, 0x55, 0x03, 0x50, 0x15, 0x51, 0x55, 0x55, 
-	0x20, 0x3f, 0x80, 0x50, 0x1f, 0x68, 0x01, 0x60, 0x18, 0x74, 0x13, 0x70, 0x00, 0x17, 0x40, 0x66, 
-	0x66, 0x14, 0x00, 0x31, 0x55, 0x07, 0x13, 0x50, 0x55, 0x24, 0x01, 0x00, 0x1f, 0x31, 0x6f, 0x10, 
-	0xdb, 0xfe, 0x11, 0x17, 0x11, 0x6f, 0x10, 0x07, 0x71, 0x7b, 0x00, 0x1a, 0x00, 0x9f, 0x00, 0x03, 
-	0x60, 0x38, 0x16, 0x66, 0x11, 0x4f, 0xc1, 0xf0, 0x21, 0x9e, 0x02, 0x00, 0x80, 0x30, 0x48, 0x01, 
-	0x10, 0x9e, 0x11, 0x9e, 0x10, 0x66, 0x02, 0x00, 0x17, 0x00, 0x51, 0x25, 0x00, 0x3f, 0x55, 0x00, 
-	0x08, 0x70, 0x2f, 0x00, 0xc7, 0x59, 0x16, 0x11, 0x4f, 0x66, 0x00, 0x7f, 0x92, 0x03, 0x80, 0x28, 
-	0x00, 0x2a, 0x90, 0x00, 0x42, 0x00, 0x81, 0x10, 0x08, 0x77, 0x02, 0x00, 0x60, 0x69, 0x36, 0x21, 
-	0xdc, 0x11, 0xe3, 0x20, 0x10, 0x25, 0x88, 0x88, 0x00, 0x5e, 0x08, 0x81, 0x08, 0x80, 0x18, 0x00, 
-	0xa4, 0x11, 0x77, 0x13, 0xae, 0x20, 0x1f, 0x00, 0x00, 0x18, 0x50, 0x00, 0x63, 0x10, 0x07, 0x10, 
-	0x01, 0x18, 0x20, 0x80, 0x01, 0x01, 0xa7, 0x18, 0x10, 0x17, 0x71, 0x11, 0x04, 0x00, 0x16, 0x60, 
-	0x01, 0x50, 0x01, 0x7f, 0x10, 0x15, 0x00, 0x51, 0x11, 0x00, 0x11, 0x10, 0x01, 0x40, 0x88, 0x00, 
-	0x48, 0x01, 0x80, 0x46, 0x86, 0x01, 0x80, 0x14, 0x01, 0x84, 0x02, 0x74, 0x02, 0x72, 0x14, 0x64, 
-	0x00, 0x7f, 0x00, 0x55, 0x11, 0x51, 0x15, 0x45, 0x01, 0x40, 0x15, 0x6e, 0x11, 0x01, 0x01, 0x11, 
-	0x97, 0x88, 0x01, 0xff, 0x10, 0xe5, 0x02, 0x9f, 0x12, 0x00, 0x66, 0x11, 0x61, 0x16, 0x55, 0x01, 
-	0x52, 0x14, 0x70, 0x55, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x3f, 0x88, 0x02, 0x84, 0x28, 0x0e, 0x41, 
-	0x28, 0x88, 0x12, 0x00, 0x9d, 0x00, 0x79, 0x10, 0xde, 0x53, 0x01, 0x15, 0x30, 0x25, 0x31, 0x55, 
-	0x55, 0x13, 0x31, 0x9f, 0x02, 0x46, 0x00, 0x88, 0x21, 0x88, 0x04, 0x92, 0x7f, 0x55, 0x01, 0x21, 
-	0x55, 0x13, 0x55, 0x55, 0x34, 0x01, 0x10, 0xe6, 0xb8, 0x11, 0xbf, 0x88, 0x00, 0x08, 0x02, 0x21, 
-	0x02, 0x3e, 0x47, 0x01, 0x66, 0xb7, 0x00, 0x33, 0x55, 0x00, 0x0b, 0x02, 0x23, 0x05, 0x11, 0x07, 
-	0xf0, 0x1f, 0x40, 0x1f, 0xe0, 0x10, 0xe5, 0x00, 0x03, 0xb0, 0x7f, 0x77, 0x17, 0x66, 0x02, 0x61, 
-	0x07, 0x16, 0x53, 0x15, 0x50, 0x15, 0x60, 0x7f, 0x21, 0x9d, 0x30, 0x03, 0xa0, 0x00, 0xbf, 0x17, 
-	0x30, 0xbf, 0x50, 0x15, 0x55, 0x01, 0x40, 0xfc, 0x02, 0x6b, 0x12, 0xe0, 0x42, 0xfb, 0xd2, 0xff, 
-	0x61, 0xe3, 0x03, 0x40, 0x00, 0x84, 0xcc, 0x60, 0x20, 0x20, 0xbf, 0x04, 0x54, 0x12, 0x9f, 0x32, 
-	0x7f, 0x01, 0x80, 0x81, 0x00, 0xdb, 0x68, 0x01, 0x88, 0x81, 0x16, 0x00, 0x00, 0x9e, 0x00, 0x00, 
-	0x66, 0x61, 0x24, 0x00, 0x55, 0x11, 0x45, 0x07, 0x02, 0x44, 0x01, 0x51, 0x24, 0x21, 0x3f, 0x33, 
-	0x01, 0x20, 0x03, 0xf0, 0x21, 0x1f, 0x40, 0xbb, 0x00, 0xdf, 0x21, 0xe7, 0x48, 0x01, 0x40, 0x18, 
-	0x00, 0x88, 0x14, 0x84, 0x18, 0x88, 0x68, 0x88, 0x18, 0x00, 0x77, 0x74, 0x74, 0x17, 0x46, 0x62, 
-	0x42, 0x16, 0x1c, 0x45, 0x11, 0x41, 0x11, 0x7f, 0x20, 0x9f, 0x01, 0xdd, 0x18, 0x88, 0x95, 0x01, 
-	0xdd, 0x88, 0x86, 0x00, 0xbf, 0x42, 0x10, 0xbf, 0x64, 0x00, 0xbf, 0x40, 0x51, 0x40, 0xbf, 0x00, 
-	0x11, 0x62, 0x88, 0x68, 0x02, 0x18, 0x86, 0x12, 0x82, 0x01, 0x9f, 0x71, 0x5f, 0x54, 0x12, 0x52, 
-	0x30, 0x14, 0x42, 0x43, 0x3f, 0x01, 0x3f, 0x04, 0x88, 0x11, 0x81, 0xb0, 0x50, 0xff, 0x13, 0xd1, 
-	0x3f, 0xe0, 0x3f, 0x51, 0x62, 0x14, 0x54, 0x01, 0x12, 0x55, 0x12, 0x42, 0x55, 0x24, 0x15, 0xf0, 
-	0x3f, 0xa6, 0x10, 0x3f, 0x64, 0x00, 0x3f, 0x51, 0x14, 0x01, 0x43, 0x20, 0x9f, 0x84, 0x88, 0x02, 
-	0x7f, 0x88, 0x12, 0x41, 0x00, 0x1f, 0x00, 0x11, 0x73, 0x00, 0x77, 0x77, 0x03, 0x10, 0x11, 0x62, 
-	0x16, 0x45, 0xcf, 0x33, 0x5f, 0x41, 0xff, 0x88, 0x68, 0x00, 0x3e, 0x31, 0x67, 0xf4, 0x5f, 0x01, 
-	0x17, 0x73, 0x60, 0x22, 0x5b, 0x20, 0x5f, 0x50, 0xbf, 0x13, 0x53, 0x13, 0xdf, 0x20, 0xbf, 0x58, 
-	0x48, 0x03, 0x97, 0x68, 0x00, 0x1b, 0x12, 0xa1, 0x71, 0x14, 0x77, 0x85, 0x03, 0xfd, 0x36, 0x01, 
-	0x10, 0x55, 0x00, 0x3b, 0x54, 0x04, 0xe0, 0xe0, 0x00, 0xc0, 0x13, 0xb7, 0x20, 0x03, 0x81, 0x60, 
-	0x18, 0x47, 0x47, 0x08, 0x47, 0x17, 0x66, 0x26, 0x01, 0x1f, 0x12, 0x41, 0x15, 0x08, 0x25, 0x01, 
-	0x10, 0x14, 0x14, 0x60, 0x68, 0x00, 0x00, 0x01, 0x68, 0x81, 0x06, 0x80, 0x16, 0x10, 0x68, 0x04, 
-	0xa3, 0x48, 0x71, 0x01, 0xd3, 0x46, 0x46, 0x14, 0x5d, 0x04, 0x45, 0x01, 0x14, 0x10, 0x45, 0x12, 
-	0x00, 0x1f, 0x86, 0x01, 0xd8, 0x61, 0x08, 0x00, 0x00, 0x48, 0x10, 0x86, 0x84, 0x14, 0x00, 0x71, 
-	0xe8, 0x14, 0x3f, 0xc0, 0x9f, 0x23, 0x97, 0x68, 0x14, 0xfe, 0x01, 0x00, 0x47, 0x86, 0x04, 0x4f, 
-	0x14, 0x01, 0x00, 0x45, 0x00, 0x58, 0x54, 0xff, 0x00, 0x52, 0x88, 0x00, 0x57, 0x68, 0x20, 0x88, 
-	0x00, 0x00, 0x01, 0xff, 0x00, 0x5f, 0x46, 0x00, 0x03, 0x45, 0x11, 0x60, 0x00, 0x04, 0x14, 0x0f, 
-	0x06, 0x17, 0x03, 0x7b, 0x00, 0x00, 0x48, 0x81, 0x41, 0x18, 0x70, 0x74, 0x12, 0x00, 0x11, 0x00, 
-	0x62, 0x64, 0x00, 0x35, 0x51, 0x31, 0x8d, 0x11, 0x1f, 0x12, 0x10, 0x51, 0x00, 0x1f, 0x10, 0x3f, 
-	0x11, 0x10, 0x3c, 0xd0, 0xc0, 0x40, 0x50, 0x3f, 0x48, 0x00, 0xa0, 0x80, 0x14, 0x00, 0x20, 0x80, 
-	0x05, 0x03, 0x70, 0x73, 0x01, 0x27, 0x36, 0x01, 0x46, 0x00, 0x13, 0x15, 0x00, 0x54, 0x01, 0x51, 
-	0x45, 0x13, 0x0f, 0x25, 0x10, 0x11, 0x01, 0xf6, 0x2b, 0x40, 0x01, 0x52, 0x5f, 0x24, 0x7b, 0x7c, 
-	0x00, 0x00, 0x03, 0x00, 0x43, 0xe6, 0x8f, 0xa4, 0xa6, 0x01, 0x29, 0x10, 0x81, 0x41, 0x04, 0x03, 
-	0x64, 0x14, 0x60, 0x14, 0x61, 0x14, 0x00, 0x40, 0x46, 0x15, 0x00, 0xff, 0x11, 0x80, 0x08, 0x43, 
-	0x1e, 0x00, 0xc3, 0x70, 0x10, 0x17, 0x41, 0x07, 0x01, 0x1e, 0x16, 0x50, 0x15, 0x30, 0x50, 0x15, 
-	0x04, 0x43, 0x13, 0xa4, 0xef, 0x86, 0x88, 0x02, 0x40, 0x10, 0x28, 0x31, 0x18, 0x01, 0xe2, 0x11, 
-	0x40, 0x26, 0x00, 0x1c, 0x16, 0x10, 0x54, 0x50, 0x1f, 0x43, 0x5c, 0x03, 0xc7, 0x70, 0x14, 0x15, 
-	0x71, 0x17, 0x60, 0x01, 0xdf, 0x50, 0x02, 0x1f, 0x20, 0x10, 0x5f, 0x80, 0x96, 0xeb, 0x87, 0x78, 
-	0x00, 0x40, 0x18, 0x11, 0x14, 0x53, 0x70, 0x03, 0xa3, 0x40, 0x01, 0x71, 0x20, 0x54, 0x02, 0xa1, 
-	0x10, 0x3f, 0x19, 0x20, 0x86, 0x16, 0x06, 0xa3, 0x36, 0x67, 0x71, 0x17, 0x01, 0x80, 0xc0, 0xb1, 
-	0x9f, 0x80, 0xbf, 0x01, 0x80, 0x13, 0x81, 0x14, 0x70, 0x00, 0x03, 0x70, 0x17, 0x10, 0x66, 0x66, 
-	0x16, 0x00, 0x26, 0x11, 0x51, 0x00, 0xc3, 0x45, 0x13, 0x63, 0xde, 0x30, 0xbf, 0x17, 0xae, 0x30, 
-	0xbf, 0x00, 0x04, 0x21, 0x00, 0x02, 0xdf, 0x05, 0x20, 0x10, 0x1c, 0x20, 0xfe, 0x02, 0x09, 0x12, 
-	0x9b, 0xf2, 0x9f, 0x30, 0x3c, 0xf0, 0x1f, 0x00, 0x03, 0x06, 0x6e, 0x55, 0x40, 0x12, 0x84, 0x3e, 
-	0x80, 0x16, 0x70, 0x17, 0x47, 0x11, 0x14, 0x60, 0x66, 0x14, 0x04, 0x5d, 0x45, 0x00, 0x22, 0x51, 
-	0x04, 0x4e, 0x10, 0x04, 0x21, 0x00, 0x88, 0x00, 0x2f, 0xf4, 0x5f, 0xe0, 0xbf, 0x80, 0x02, 0x84, 
-	0x82, 0x02, 0x80, 0x48, 0x48, 0x01, 0x23, 0x17, 0x00, 0x17, 0x60, 0x14, 0x16, 0x16, 0x50, 0x14, 
-	0x15, 0xd9, 0x13, 0x7f, 0x76, 0x07, 0x86, 0x14, 0x09, 0x02, 0x43, 0x14, 0x10, 0x00, 0x1f, 0xb0, 
-	0x00, 0xc3, 0x14, 0x40, 0xbf, 0x71, 0x7f, 0x00, 0x40, 0x38, 0x31, 0x47, 0x17, 0x00, 0x62, 0x17, 
-	0x40, 0x36, 0x91, 0x7f, 0x40, 0x3f, 0x03, 0xc7, 0x20, 0x80, 0x18, 0x11, 0x9f, 0x30, 0x17, 0x60, 
-	0x66, 0x66, 0x3d, 0x13, 0x50, 0x05, 0xdd, 0x10, 0x82, 0x50, 0x01, 0x05, 0x47, 0x18, 0x01, 0x3f, 
-	0x5d, 0x18, 0x11, 0x3f, 0x30, 0x31, 0x3f, 0x40, 0xa4, 0x40, 0x01, 0x68, 0x05, 0x03, 0x1f, 0x88, 
-	0x38, 0x11, 0x13, 0x03, 0x62, 0xe3, 0x96, 0xee, 0x07, 0xa7, 0x01, 0xbf, 0x00, 0x01, 0x00, 0x74, 
-	0x77, 0x03, 0x00, 0x10, 0x61, 0x7d, 0x16, 0x12, 0x1f, 0x37, 0xff, 0x37, 0x3f, 0x26, 0x7f, 0x51, 
-	0xbf, 0x40, 0x00, 0x56, 0x1e, 0x20, 0x54, 0x05, 0x00, 0x40, 0x70, 0xdf, 0x03, 0xe3, 0x10, 0x03, 
-	0x70, 0x8b, 0x04, 0x03, 0x60, 0x04, 0x60, 0x08, 0x9f, 0x45, 0x10, 0xbf, 0xa0, 0x1f, 0x02, 0x60, 
-	0x04, 0x80, 0x14, 0x30, 0x16, 0x06, 0xe3, 0x25, 0x0d, 0x46, 0x11, 0x00, 0x53, 0x07, 0x00, 0x91, 
-	0x3f, 0x15, 0x06, 0xe5, 0x00, 0x16, 0x18, 0x18, 0x60, 0x17, 0x17, 0x17, 0x30, 0x03, 0x36, 0x36, 
-	0x16, 0x10, 0x53, 0x53, 0x01, 0x1d, 0x80, 0xff, 0x94, 0x00, 0x3b, 0x10, 0x38, 0x03, 0x44, 0x71, 
-	0x03, 0xc0, 0x46, 0x36, 0xb8, 0x09, 0x7e, 0x51, 0x04, 0xab, 0x70, 0x40, 0x60, 0x7f, 0x04, 0x70, 
-	0x16, 0x85, 0x02, 0x3f, 0x14, 0x00, 0x11, 0x54, 0x08, 0x03, 0x34, 0x70, 0x1f, 0xbe, 0x12, 0x7f, 
-	0x11, 0x13, 0x84, 0x10, 0x3f, 0x09, 0xe2, 0x17, 0x43, 0x53, 0x5f, 0x78, 0xfe, 0x03, 0x5b, 0xa3, 
-	0xbe, 0x17, 0xe3, 0x20, 0x9f, 0x39, 0x17, 0x09, 0x3a, 0x20, 0x03, 0x70, 0xe6, 0x19, 0x94, 0x17, 
-	0x9b, 0x86, 0x5f, 0x88, 0x04, 0x07, 0xdb, 0x02, 0x17, 0x80, 0xf6, 0x12, 0x5f, 0x00, 0x23, 0x01, 
-	0xdc, 0x12, 0x5b, 0x00, 0x24, 0x9d, 0x61, 0x3e, 0x28, 0x2d, 0x60, 0x16, 0x00, 0xbf, 0x11, 0x14, 
-	0x9f, 0x00, 0x43, 0x35, 0x09, 0xc1, 0x0c, 0x13, 0x40, 0x14, 0x20, 0x26, 0xbf, 0x00, 0x62, 0x81, 
-	0x81, 0x0c, 0x02, 0x10, 0x68, 0x28, 0x04, 0xdf, 0x00, 0x33, 0x46, 0x26, 0x06, 0x00, 0x50, 0x52, 
-	0x51, 0x02, 0x24, 0x5b, 0x43, 0xef, 0x00, 0x00, 0x51, 0x02, 0x24, 0x5b, 0x80, 0x43, 0xef, 0x00, 
-	0x00, 0x58, 0x00, 0x00, 0xef, 0x3d, 0x52, 0x4a, 0xd6, 0x5a, 0x39, 0x67, 0x9c, 0x73, 0xde, 0x7b, 
-	0xff, 0x7f, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x58, 0x00, 0x00, 0xea, 0x3d, 0x4c, 0x4a, 0xcf, 0x5a, 0x31, 0x67, 0x92, 0x73, 0xd4, 0x7b, 
-	0xf7, 0x7f, 0xfc, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x3d, 0x40, 0x0b, 0x40, 0x10, 0x40, 0x26, 0x40, 0x35, 0x40, 0x03, 0x40, 0x06, 0x40, 0x14, 0x40, 
-	0x0e, 0x40, 0x0d, 0x40, 0x25, 0x40, 0x12, 0x40, 0x28, 0x40, 0x02, 0x40, 0x18, 0x40, 0x09, 0x40, 
-	0x0a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x01, 0x10, 0xd9, 0xe4, 
-	0x01, 0x04, 0x80, 0xe1, 0x00, 0x58, 0xa0, 0xe1, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x24, 0x0c, 0xa0, 0xe1, 0x25, 0xc8, 0xa0, 0xe1, 
-	0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x58, 0x85, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x54, 0x85, 0xe2, 0xff, 0x04, 0x15, 0xe3, 
-	0x01, 0x31, 0x83, 0x03, 0x0f, 0x04, 0x15, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x15, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x01, 0x54, 0x45, 0xe2, 
-	0xff, 0x04, 0x15, 0xe3, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0xff, 0x58, 0x05, 0xe2, 
-	0x00, 0x5c, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x04, 0x40, 0x94, 0xe0, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x44, 0x84, 0x23, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0xc0, 0xd9, 0xe4, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0xc4, 0x8c, 0xe1, 
-	0x2b, 0x08, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0xc0, 0x8c, 0xe2, 0x2b, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x05, 0x8d, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x31, 0x03, 0xe2, 
-	0x05, 0x10, 0x27, 0xe0, 0x05, 0x70, 0x97, 0xe0, 0x07, 0x10, 0x21, 0xe0, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x02, 0x11, 0xe3, 0x01, 0x32, 0x83, 0x13, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x58, 0x45, 0xe2, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x05, 0x04, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x04, 0x90, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0x0f, 0x04, 0x10, 0xe3, 0x01, 0x32, 0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 0x20, 0x54, 0x85, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x05, 0x04, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x10, 0xe3, 
-	0x01, 0x32, 0x83, 0x03, 0x01, 0x04, 0x50, 0xe2, 0x01, 0x31, 0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 
-	0x20, 0x54, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0xff, 0x54, 0x05, 0xe2, 0x00, 0x58, 0x85, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe3, 0xa4, 0x4c, 0xb0, 0xe1, 0x02, 0x32, 0x83, 0x23, 0x80, 0x40, 0x84, 0x23, 
-	0x04, 0x4c, 0xa0, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x01, 0x10, 0xd9, 0xe4, 0x01, 0x04, 0x80, 0xe1, 
-	0x00, 0x68, 0xa0, 0xe1, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x24, 0x0c, 0xa0, 0xe1, 0x26, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x68, 0x86, 0xe2, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x02, 0x32, 0x03, 0xe2, 0x01, 0x64, 0x86, 0xe2, 0xff, 0x04, 0x16, 0xe3, 0x01, 0x31, 0x83, 0x03, 
-	0x0f, 0x04, 0x16, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x0f, 0x04, 0x16, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x01, 0x64, 0x46, 0xe2, 0xff, 0x04, 0x16, 0xe3, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x6c, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x02, 0x02, 0x13, 0xe3, 0x00, 0x30, 0xa0, 0xe3, 0x02, 0x45, 0x84, 0x13, 0x04, 0x40, 0x94, 0xe0, 
-	0x02, 0x32, 0x83, 0x23, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xd1, 0x00, 0xd9, 0xe0, 0x00, 0x90, 0x89, 0xe0, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xd1, 0x00, 0xd9, 0xe0, 
-	0x00, 0x90, 0x89, 0xe0, 0x04, 0x00, 0x70, 0xe3, 0x58, 0x00, 0x00, 0x0b, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x31, 0x03, 0xe2, 
-	0x06, 0x10, 0x27, 0xe0, 0x06, 0x70, 0x97, 0xe0, 0x07, 0x10, 0x21, 0xe0, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x02, 0x11, 0xe3, 0x01, 0x32, 0x83, 0x13, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x26, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x68, 0x46, 0xe2, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x06, 0x04, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x04, 0x90, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0x0f, 0x04, 0x10, 0xe3, 0x01, 0x32, 0x83, 0x03, 0xff, 0x64, 0x06, 0xe2, 0x20, 0x64, 0x86, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x06, 0x04, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x10, 0xe3, 
-	0x01, 0x32, 0x83, 0x03, 0x01, 0x04, 0x50, 0xe2, 0x01, 0x31, 0x83, 0x03, 0xff, 0x64, 0x06, 0xe2, 
-	0x20, 0x64, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0xff, 0x64, 0x06, 0xe2, 0x00, 0x68, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x03, 0xf0, 0x28, 0xe1, 0x00, 0x30, 0xa0, 0xe3, 0x64, 0x40, 0xa0, 0xe1, 0x02, 0x05, 0x14, 0xe3, 
-	0x02, 0x32, 0x83, 0x13, 0x02, 0x45, 0xc4, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 
-	0x00, 0x90, 0x89, 0x00, 0x40, 0x80, 0x48, 0x02, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 
-	0xf8, 0xff, 0xff, 0x1a, 0x00, 0x90, 0x89, 0xe0, 0x04, 0x00, 0x70, 0xe3, 0x03, 0x00, 0x00, 0x0b, 
-	0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x44, 0x10, 0x1a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 0x09, 0x00, 0x00, 0x0a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x00, 0x20, 0xd9, 0xe5, 0xfa, 0x00, 0x52, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0x01, 0x10, 0xd9, 0xe5, 
-	0x02, 0x20, 0xd9, 0xe5, 0x02, 0x14, 0x81, 0xe1, 0xbc, 0xc4, 0x5a, 0xe1, 0x0c, 0x00, 0x51, 0xe1, 
-	0x1e, 0xff, 0x2f, 0x11, 0x0f, 0x80, 0x08, 0xe2, 0x01, 0x10, 0xa0, 0xe3, 0x48, 0x10, 0x4a, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x00, 0xd9, 0xe4, 0x01, 0x10, 0xd9, 0xe4, 0x01, 0x04, 0x80, 0xe1, 
-	0x00, 0x78, 0xa0, 0xe1, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x24, 0x0c, 0xa0, 0xe1, 0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x01, 0x78, 0x87, 0xe2, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x78, 0x87, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x74, 0x87, 0xe2, 0xff, 0x04, 0x17, 0xe3, 
-	0x01, 0x31, 0x83, 0x03, 0x0f, 0x04, 0x17, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x17, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x01, 0x74, 0x47, 0xe2, 
-	0xff, 0x04, 0x17, 0xe3, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0xff, 0x78, 0x07, 0xe2, 
-	0x00, 0x7c, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 0x00, 0x90, 0x89, 0x10, 
-	0x40, 0x80, 0x48, 0x12, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 0xa1, 0xff, 0xff, 0x0a, 
-	0x00, 0x90, 0x89, 0xe0, 0x04, 0x00, 0x70, 0xe3, 0xac, 0xff, 0xff, 0x0b, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x31, 0x03, 0xe2, 
-	0x07, 0x70, 0x97, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x02, 0x17, 0xe3, 0x01, 0x32, 0x83, 0x13, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x01, 0x78, 0x87, 0xe2, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x78, 0x47, 0xe2, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x04, 0xa0, 0xe1, 
-	0x02, 0x32, 0x03, 0xe2, 0x01, 0x04, 0x90, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x0f, 0x04, 0x10, 0xe3, 
-	0x01, 0x32, 0x83, 0x03, 0xff, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x04, 0xa0, 0xe1, 
-	0x02, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x10, 0xe3, 0x01, 0x32, 0x83, 0x03, 
-	0x01, 0x04, 0x50, 0xe2, 0x01, 0x31, 0x83, 0x03, 0xff, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x00, 0xd9, 0xe4, 0xff, 0x74, 0x07, 0xe2, 0x00, 0x78, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x44, 0x24, 0xe2, 
-	0x09, 0x32, 0x83, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 0x00, 0x90, 0x89, 0x00, 
-	0x40, 0x80, 0x48, 0x02, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0xd1, 0x00, 0xd9, 0xe0, 0x51, 0xff, 0xff, 0x1a, 
-	0x00, 0x90, 0x89, 0xe0, 0x04, 0x00, 0x70, 0xe3, 0x5c, 0xff, 0xff, 0x0b, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 
-	0x01, 0x10, 0xd9, 0xe4, 0x01, 0x04, 0x80, 0xe1, 0x00, 0xb8, 0xa0, 0xe1, 0x01, 0x8c, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x24, 0x0c, 0xa0, 0xe1, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x78, 0x47, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0xb8, 0x8b, 0xe2, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x02, 0x32, 0x03, 0xe2, 
-	0x01, 0x00, 0x80, 0xe2, 0xff, 0x00, 0x10, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x0f, 0x00, 0x10, 0xe3, 
-	0x01, 0x32, 0x83, 0x03, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x02, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x0f, 0x00, 0x10, 0xe3, 
-	0x01, 0x32, 0x83, 0x03, 0x01, 0x00, 0x50, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x31, 0x03, 0xe2, 0x02, 0x32, 0x83, 0xe3, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 
-	0xd1, 0x00, 0xd9, 0xe0, 0x00, 0x90, 0x89, 0x10, 0x40, 0x80, 0x48, 0x12, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 
-	0xd1, 0x00, 0xd9, 0xe0, 0xf3, 0xfe, 0xff, 0x0a, 0x00, 0x90, 0x89, 0xe0, 0x04, 0x00, 0x70, 0xe3, 
-	0xfe, 0xfe, 0xff, 0x0b, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x31, 0x03, 0xe2, 0x0b, 0x10, 0x27, 0xe0, 0x0b, 0x70, 0x97, 0xe0, 
-	0x07, 0x10, 0x21, 0xe0, 0x02, 0x32, 0x83, 0x23, 0x01, 0x02, 0x11, 0xe3, 0x01, 0x32, 0x83, 0x13, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x01, 0x78, 0x47, 0xe2, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x44, 0x94, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0x0f, 0x04, 0x14, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x0f, 0x04, 0x14, 0xe3, 0x01, 0x32, 0x83, 0x03, 0x01, 0x44, 0x54, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x32, 0x03, 0xe2, 
-	0x02, 0x32, 0x23, 0xe2, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x58, 0x05, 0xe2, 0x05, 0x54, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x58, 0x05, 0xe2, 
-	0xff, 0x04, 0x06, 0xe2, 0x00, 0x50, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x58, 0x05, 0xe2, 0x06, 0x54, 0x85, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x58, 0x05, 0xe2, 0xff, 0x04, 0x07, 0xe2, 0x00, 0x50, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x58, 0x05, 0xe2, 
-	0x07, 0x54, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x58, 0x05, 0xe2, 0x00, 0x5c, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x58, 0x05, 0xe2, 
-	0x04, 0x50, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x54, 0x05, 0xe2, 0x25, 0x54, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x54, 0x05, 0xe2, 
-	0x26, 0x54, 0x85, 0xe1, 0xff, 0x5c, 0xc5, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x54, 0x05, 0xe2, 0xff, 0x08, 0x06, 0xe2, 
-	0x00, 0x50, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x54, 0x05, 0xe2, 0x27, 0x54, 0x85, 0xe1, 0xff, 0x5c, 0xc5, 0xe3, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x54, 0x05, 0xe2, 0xff, 0x08, 0x07, 0xe2, 0x00, 0x50, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x54, 0x05, 0xe2, 
-	0x00, 0x58, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x54, 0x05, 0xe2, 0x24, 0x54, 0x85, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x68, 0x06, 0xe2, 
-	0xff, 0x04, 0x05, 0xe2, 0x00, 0x60, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x68, 0x06, 0xe2, 0x05, 0x64, 0x86, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x68, 0x06, 0xe2, 0x06, 0x64, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x68, 0x06, 0xe2, 0xff, 0x04, 0x07, 0xe2, 
-	0x00, 0x60, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x68, 0x06, 0xe2, 0x07, 0x64, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x68, 0x06, 0xe2, 
-	0x00, 0x6c, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x68, 0x06, 0xe2, 0x04, 0x60, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 
-	0x25, 0x64, 0x86, 0xe1, 0xff, 0x6c, 0xc6, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 0xff, 0x08, 0x05, 0xe2, 
-	0x00, 0x60, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 0x26, 0x64, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 
-	0x27, 0x64, 0x86, 0xe1, 0xff, 0x6c, 0xc6, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 0xff, 0x08, 0x07, 0xe2, 
-	0x00, 0x60, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x64, 0x06, 0xe2, 0x00, 0x68, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x64, 0x06, 0xe2, 
-	0x24, 0x64, 0x86, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x78, 0x07, 0xe2, 0xff, 0x04, 0x05, 0xe2, 0x00, 0x70, 0x87, 0xe1, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x78, 0x07, 0xe2, 0x05, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x78, 0x07, 0xe2, 0xff, 0x04, 0x06, 0xe2, 
-	0x00, 0x70, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x78, 0x07, 0xe2, 0x06, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x78, 0x07, 0xe2, 
-	0x07, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x78, 0x07, 0xe2, 0x00, 0x7c, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x78, 0x07, 0xe2, 
-	0x04, 0x70, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x74, 0x07, 0xe2, 0x25, 0x74, 0x87, 0xe1, 0xff, 0x7c, 0xc7, 0xe3, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x74, 0x07, 0xe2, 0xff, 0x08, 0x05, 0xe2, 0x00, 0x70, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x74, 0x07, 0xe2, 
-	0x26, 0x74, 0x87, 0xe1, 0xff, 0x7c, 0xc7, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x74, 0x07, 0xe2, 0xff, 0x08, 0x06, 0xe2, 
-	0x00, 0x70, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x74, 0x07, 0xe2, 0x27, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0xff, 0x74, 0x07, 0xe2, 
-	0x00, 0x78, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x74, 0x07, 0xe2, 0x24, 0x74, 0x87, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x0c, 0xa0, 0xe1, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x08, 0xa0, 0xe1, 0xff, 0x00, 0x00, 0xe2, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x26, 0x0c, 0xa0, 0xe1, 0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x26, 0x08, 0xa0, 0xe1, 0xff, 0x00, 0x00, 0xe2, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xa1, 0x04, 0xda, 0xe5, 0xa2, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe0, 
-	0x05, 0x00, 0x00, 0x1a, 0x01, 0x90, 0x49, 0xe2, 0x0f, 0x80, 0x08, 0xe2, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x40, 0x80, 0x48, 0xe2, 
-	0xa8, 0x0f, 0x00, 0xea, 0x24, 0x0c, 0xa0, 0xe1, 0x27, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 
-	0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x44, 0x05, 0xe2, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x05, 0x44, 0xa0, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x44, 0x06, 0xe2, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x44, 0xa0, 0xe1, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x44, 0x07, 0xe2, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x07, 0x44, 0xa0, 0xe1, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x00, 0x10, 0x24, 0xe0, 
-	0x00, 0x40, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x14, 0x24, 0xe0, 0x05, 0x44, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x14, 0x24, 0xe0, 0x06, 0x44, 0x94, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x07, 0xe2, 0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x14, 0x24, 0xe0, 
-	0x07, 0x44, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x1c, 0x24, 0xe0, 0x00, 0x4c, 0x94, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x04, 0x40, 0x94, 0xe0, 
-	0x01, 0x32, 0x04, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x0c, 0xa0, 0xe1, 
-	0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x25, 0x08, 0xa0, 0xe1, 0xff, 0x00, 0x00, 0xe2, 0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 
-	0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x26, 0x0c, 0xa0, 0xe1, 0x03, 0xf0, 0x28, 0xe1, 
-	0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x26, 0x08, 0xa0, 0xe1, 
-	0xff, 0x00, 0x00, 0xe2, 0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 
-	0x60, 0x44, 0xb4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0x0c, 0xa0, 0xe1, 0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 
-	0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0x08, 0xa0, 0xe1, 0xff, 0x00, 0x00, 0xe2, 
-	0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x03, 0xf0, 0x28, 0xe1, 0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x03, 0xf0, 0x28, 0xe1, 0x02, 0x45, 0x84, 0x23, 0x04, 0x40, 0x94, 0xe0, 0x01, 0x32, 0x04, 0xe2, 
-	0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x00, 0x10, 0x24, 0xe0, 
-	0x00, 0x40, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x14, 0x24, 0xe0, 0x05, 0x44, 0x54, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0x54, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x14, 0x24, 0xe0, 0x06, 0x44, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x07, 0xe2, 0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x07, 0x14, 0x24, 0xe0, 0x07, 0x44, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x1c, 0x24, 0xe0, 
-	0x00, 0x4c, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x40, 0xa0, 0xe3, 0x03, 0x31, 0xa0, 0xe3, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x05, 0xe2, 0x02, 0x32, 0x23, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 0x00, 0x10, 0x24, 0xe0, 
-	0x00, 0x40, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x23, 0xe2, 
-	0x23, 0x3f, 0xb0, 0xe1, 0x05, 0x14, 0x24, 0xe0, 0x05, 0x44, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 0x02, 0x32, 0x23, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 
-	0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x02, 0x32, 0x23, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 0x06, 0x14, 0x24, 0xe0, 0x06, 0x44, 0xd4, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 
-	0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 0x02, 0x32, 0x23, 0xe2, 
-	0x23, 0x3f, 0xb0, 0xe1, 0x00, 0x10, 0x24, 0xe0, 0x00, 0x40, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x32, 0x23, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 0x07, 0x14, 0x24, 0xe0, 
-	0x07, 0x44, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x02, 0x32, 0x23, 0xe2, 
-	0x23, 0x3f, 0xb0, 0xe1, 0x00, 0x1c, 0x24, 0xe0, 0x00, 0x4c, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x23, 0x3f, 0xb0, 0xe1, 0x00, 0x40, 0xa0, 0x33, 0xff, 0x44, 0xa0, 0x23, 
-	0x03, 0x31, 0xa0, 0x33, 0x0b, 0x32, 0xa0, 0x23, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 0x05, 0x40, 0x14, 0xe0, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 0x05, 0x44, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x32, 0xa0, 0xe3, 0x06, 0x40, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 
-	0x06, 0x44, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 0x07, 0x40, 0x14, 0xe0, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 0x07, 0x44, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x01, 0x32, 0xa0, 0xe3, 0x00, 0x4c, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x32, 0xa0, 0xe3, 
-	0x04, 0x40, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x00, 0x30, 0xa0, 0xe3, 
-	0x00, 0x40, 0x34, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x05, 0x44, 0x34, 0xe0, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x40, 0x34, 0xe0, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x06, 0x44, 0x34, 0xe0, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x07, 0xe2, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x40, 0x34, 0xe0, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe3, 0x07, 0x44, 0x34, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x30, 0xa0, 0xe3, 
-	0x00, 0x4c, 0x34, 0xe0, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x40, 0xa0, 0xe3, 0x01, 0x31, 0xa0, 0xe3, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x04, 0x05, 0xe2, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x40, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe3, 0x05, 0x44, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x00, 0x30, 0xa0, 0xe3, 0x00, 0x40, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 
-	0x06, 0x44, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 0x00, 0x30, 0xa0, 0xe3, 
-	0x00, 0x40, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x00, 0x30, 0xa0, 0xe3, 0x07, 0x44, 0x94, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x4c, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x00, 0x30, 0xa0, 0xe3, 0x04, 0x40, 0x94, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 
-	0x00, 0x10, 0x24, 0xe0, 0x00, 0x00, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x14, 0x24, 0xe0, 
-	0x05, 0x04, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 0x00, 0x10, 0x24, 0xe0, 
-	0x00, 0x00, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x14, 0x24, 0xe0, 0x06, 0x04, 0x54, 0xe0, 
-	0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 0x00, 0x10, 0x24, 0xe0, 0x00, 0x00, 0x54, 0xe0, 
-	0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 
-	0x01, 0x31, 0x83, 0x03, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x14, 0x24, 0xe0, 0x07, 0x04, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 
-	0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x00, 0x1c, 0x24, 0xe0, 0x00, 0x0c, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 
-	0x68, 0x00, 0x00, 0x0a, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 
-	0x2b, 0x58, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 
-	0x00, 0x54, 0x85, 0xe1, 0x05, 0x58, 0xa0, 0xe1, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0x0a, 0x00, 0x00, 0x0a, 
-	0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 0xf8, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xea, 
-	0x44, 0x10, 0x1a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 0x0b, 0x00, 0x00, 0x0b, 0x01, 0x00, 0xd9, 0xe4, 
-	0x00, 0x10, 0xd9, 0xe5, 0x01, 0x94, 0x80, 0xe1, 0x0f, 0x1a, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 
-	0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0x01, 0x8c, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x80, 0x08, 0xe2, 
-	0x01, 0x10, 0xa0, 0xe3, 0x48, 0x10, 0x4a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x01, 0x13, 0xe3, 
-	0x5b, 0x00, 0x00, 0x0a, 0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x08, 0xa0, 0xe1, 0x02, 0xb8, 0x5b, 0xe2, 
-	0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x2d, 0x92, 0xe7, 0x2b, 0x08, 0xc2, 0x47, 
-	0x01, 0xc8, 0x9b, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0x2c, 0x08, 0xc2, 0x47, 0x06, 0x02, 0x11, 0x43, 
-	0xf8, 0x07, 0x00, 0x0b, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x1c, 0x24, 0xe0, 0x00, 0x4c, 0x94, 0xe0, 
-	0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x38, 0x10, 0x00, 0xe2, 0xc4, 0x04, 0x9a, 0xe5, 0x00, 0x00, 0x49, 0xe0, 0x01, 0x90, 0xa0, 0xe1, 
-	0x02, 0xb8, 0x5b, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0xcd, 0x92, 0xe7, 
-	0x2b, 0x08, 0xcc, 0x47, 0x01, 0x18, 0x9b, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0x21, 0x08, 0xcc, 0x47, 
-	0x0f, 0x1a, 0x09, 0xe2, 0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 
-	0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x01, 0x13, 0xe3, 0x03, 0x00, 0x00, 0x1a, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x40, 0x80, 0x48, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 
-	0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 0x2b, 0x98, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 
-	0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x00, 0x94, 0x89, 0xe1, 0x0f, 0x1a, 0x09, 0xe2, 
-	0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 
-	0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x01, 0x13, 0xe3, 0xa0, 0xff, 0xff, 0x1a, 0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x01, 0x13, 0xe3, 
-	0x8e, 0xff, 0xff, 0x0a, 0x95, 0xff, 0xff, 0xea, 0x01, 0x01, 0x13, 0xe3, 0x04, 0x00, 0x00, 0x1a, 
-	0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x10, 0xd9, 0xe4, 0x01, 0x20, 0xd9, 0xe4, 0xc4, 0x04, 0x9a, 0xe5, 
-	0x00, 0x00, 0x49, 0xe0, 0x02, 0x94, 0x81, 0xe1, 0x02, 0xb8, 0x5b, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 
-	0x11, 0x2d, 0x8a, 0xe2, 0x21, 0xcd, 0x92, 0xe7, 0x2b, 0x08, 0xcc, 0x47, 0x01, 0x18, 0x9b, 0xe2, 
-	0x20, 0x04, 0xa0, 0xe1, 0x21, 0x08, 0xcc, 0x47, 0x0f, 0x1a, 0x09, 0xe2, 0x21, 0x05, 0x92, 0xe7, 
-	0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0x06, 0x8d, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x03, 0xf0, 0x28, 0xe1, 
-	0x01, 0x0c, 0x40, 0x22, 0x60, 0x14, 0x24, 0xe0, 0x60, 0x44, 0xb4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 
-	0x01, 0x32, 0x03, 0xe2, 0x02, 0x32, 0x83, 0x23, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 
-	0xb8, 0xff, 0xff, 0x0a, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 
-	0x2b, 0x68, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 
-	0x00, 0x64, 0x86, 0xe1, 0x06, 0x68, 0xa0, 0xe1, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0x5a, 0xff, 0xff, 0x0a, 
-	0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0x48, 0xff, 0xff, 0x1a, 0x4f, 0xff, 0xff, 0xea, 
-	0x02, 0x02, 0x13, 0xe3, 0xbe, 0xff, 0xff, 0x0a, 0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x26, 0x08, 0xa0, 0xe1, 
-	0x02, 0xb8, 0x5b, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x2d, 0x92, 0xe7, 
-	0x2b, 0x08, 0xc2, 0x47, 0x01, 0xc8, 0x9b, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0x2c, 0x08, 0xc2, 0x47, 
-	0x06, 0x02, 0x11, 0x43, 0x5b, 0x07, 0x00, 0x0b, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x1c, 0x24, 0xe0, 
-	0x00, 0x4c, 0x54, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 0x79, 0xff, 0xff, 0x1a, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x02, 0x02, 0x13, 0xe3, 0x28, 0xff, 0xff, 0x1a, 0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x02, 0x02, 0x13, 0xe3, 
-	0x16, 0xff, 0xff, 0x0a, 0x1d, 0xff, 0xff, 0xea, 0x02, 0x02, 0x13, 0xe3, 0x8c, 0xff, 0xff, 0x1a, 
-	0x02, 0x90, 0x89, 0xe2, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x02, 0x32, 0x23, 0xe2, 0x23, 0x3f, 0xb0, 0xe1, 
-	0x00, 0x1c, 0x24, 0xe0, 0x00, 0x4c, 0xd4, 0xe0, 0x04, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 
-	0x02, 0x31, 0x83, 0xe3, 0x02, 0x32, 0x83, 0x33, 0xff, 0x44, 0x14, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 0x2b, 0x78, 0xd1, 0xe7, 
-	0x01, 0xb8, 0x8b, 0xe2, 0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x00, 0x74, 0x87, 0xe1, 
-	0x07, 0x78, 0xa0, 0xe1, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0x08, 0xa0, 0xe1, 0x02, 0xb8, 0x5b, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 
-	0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x2d, 0x92, 0xe7, 0x2b, 0x08, 0xc2, 0x47, 0x01, 0xc8, 0x9b, 0xe2, 
-	0x20, 0x04, 0xa0, 0xe1, 0x2c, 0x08, 0xc2, 0x47, 0x06, 0x02, 0x11, 0x43, 0x0d, 0x07, 0x00, 0x0b, 
-	0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x01, 0x00, 0xd9, 0xe4, 0x01, 0x32, 0xa0, 0xe3, 0x00, 0x4c, 0x14, 0xe0, 0x01, 0x31, 0x83, 0x03, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xd1, 0x00, 0xd9, 0xe0, 0x0b, 0x24, 0xa0, 0xe1, 0x00, 0x1c, 0x22, 0xe0, 0x00, 0x2c, 0x92, 0xe0, 
-	0x02, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x00, 0xb8, 0x8b, 0xe0, 0x02, 0x32, 0x83, 0x23, 
-	0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0x1e, 0xa0, 0xe1, 0x11, 0x2d, 0x8a, 0xe2, 0x01, 0x01, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 
-	0x27, 0x98, 0x80, 0xe0, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0xc0, 0xd9, 0xe4, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0xc4, 0x8c, 0xe1, 
-	0x24, 0x0c, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x4c, 0x34, 0xe0, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 
-	0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x2b, 0x48, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 
-	0x04, 0x4c, 0xa0, 0xe1, 0xa0, 0x30, 0x00, 0xe2, 0x50, 0x00, 0x00, 0xe2, 0x80, 0x0c, 0xa0, 0xe1, 
-	0x83, 0x3b, 0x80, 0xe1, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x80, 0xc8, 0xe3, 0x40, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x0a, 0x02, 0x03, 0xe2, 0x05, 0x12, 0x03, 0xe2, 
-	0xa1, 0x1b, 0xa0, 0xe1, 0xa0, 0x0c, 0x81, 0xe1, 0x24, 0x08, 0x80, 0xe1, 0x02, 0xb8, 0x5b, 0xe2, 
-	0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x2d, 0x92, 0xe7, 0x2b, 0x08, 0xc2, 0x47, 
-	0x01, 0xc8, 0x9b, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0x2c, 0x08, 0xc2, 0x47, 0x06, 0x02, 0x11, 0x43, 
-	0xb4, 0x06, 0x00, 0x0b, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x30, 0xa0, 0xe3, 0x00, 0x4c, 0x94, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xd1, 0x00, 0xd9, 0xe0, 0x0b, 0x24, 0xa0, 0xe1, 0x00, 0x1c, 0x22, 0xe0, 
-	0x00, 0x2c, 0x92, 0xe0, 0x02, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x00, 0x78, 0x8b, 0xe0, 
-	0x02, 0x32, 0x83, 0x23, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0xb0, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0xc0, 0xd9, 0xe4, 0x01, 0x00, 0xd9, 0xe4, 
-	0x00, 0xc4, 0x8c, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x00, 0x4c, 0xa0, 0xe1, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x1d, 0x92, 0xe7, 
-	0x2b, 0x98, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 0x2b, 0x08, 0xd1, 0xe7, 0x01, 0xb8, 0x8b, 0xe2, 
-	0x00, 0x94, 0x89, 0xe1, 0x0f, 0x1a, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x05, 0x92, 0xe7, 
-	0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0xc0, 0x80, 0x48, 0xe2, 0x01, 0x80, 0x88, 0xe3, 
-	0x40, 0x80, 0x48, 0xe2, 0x21, 0x0b, 0x00, 0xea, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x1c, 0x24, 0xe0, 
-	0x00, 0x0c, 0x54, 0xe0, 0x00, 0x30, 0x21, 0xe0, 0x01, 0x32, 0x03, 0xe2, 0x02, 0x31, 0x83, 0xe3, 
-	0x02, 0x32, 0x83, 0x33, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0xf1, 0x9f, 0xe7, 
-	0x00, 0x00, 0x00, 0x00, 0x6c, 0x3c, 0x00, 0x08, 0x9c, 0x3c, 0x00, 0x08, 0xcc, 0x3c, 0x00, 0x08, 
-	0xfc, 0x3c, 0x00, 0x08, 0x2c, 0x3d, 0x00, 0x08, 0x5c, 0x3d, 0x00, 0x08, 0x8c, 0x3d, 0x00, 0x08, 
-	0xd8, 0x3d, 0x00, 0x08, 0xfc, 0x3d, 0x00, 0x08, 0x2c, 0x3e, 0x00, 0x08, 0x5c, 0x3e, 0x00, 0x08, 
-	0x8c, 0x3e, 0x00, 0x08, 0xbc, 0x3e, 0x00, 0x08, 0xec, 0x3e, 0x00, 0x08, 0x1c, 0x3f, 0x00, 0x08, 
-	0x60, 0x3f, 0x00, 0x08, 0x8c, 0x27, 0x00, 0x03, 0xbc, 0x27, 0x00, 0x03, 0x24, 0x26, 0x00, 0x03, 
-	0x54, 0x26, 0x00, 0x03, 0x84, 0x26, 0x00, 0x03, 0xd0, 0xf3, 0x00, 0x06, 0x88, 0x3f, 0x00, 0x08, 
-	0xd4, 0x3f, 0x00, 0x08, 0xf8, 0x3f, 0x00, 0x08, 0x00, 0xf4, 0x00, 0x06, 0x2c, 0x40, 0x00, 0x08, 
-	0xec, 0x27, 0x00, 0x03, 0x60, 0x40, 0x00, 0x08, 0x20, 0x28, 0x00, 0x03, 0x94, 0x40, 0x00, 0x08, 
-	0xe4, 0x40, 0x00, 0x08, 0x0c, 0x41, 0x00, 0x08, 0x54, 0x28, 0x00, 0x03, 0x34, 0x41, 0x00, 0x08, 
-	0xb4, 0x26, 0x00, 0x03, 0x5c, 0x41, 0x00, 0x08, 0xd8, 0x26, 0x00, 0x03, 0x84, 0x41, 0x00, 0x08, 
-	0xfc, 0x26, 0x00, 0x03, 0xc4, 0x41, 0x00, 0x08, 0xe8, 0x41, 0x00, 0x08, 0x14, 0x42, 0x00, 0x08, 
-	0x38, 0x42, 0x00, 0x08, 0x64, 0x42, 0x00, 0x08, 0x88, 0x42, 0x00, 0x08, 0xb4, 0x42, 0x00, 0x08, 
-	0x78, 0x28, 0x00, 0x03, 0xf4, 0x42, 0x00, 0x08, 0x24, 0x43, 0x00, 0x08, 0x50, 0x43, 0x00, 0x08, 
-	0x80, 0x43, 0x00, 0x08, 0xac, 0x43, 0x00, 0x08, 0xdc, 0x43, 0x00, 0x08, 0x08, 0x44, 0x00, 0x08, 
-	0x18, 0x27, 0x00, 0x03, 0x98, 0x28, 0x00, 0x03, 0x3c, 0x27, 0x00, 0x03, 0x34, 0xf4, 0x00, 0x06, 
-	0x4c, 0x44, 0x00, 0x08, 0x58, 0xf4, 0x00, 0x06, 0x74, 0x44, 0x00, 0x08, 0x9c, 0x44, 0x00, 0x08, 
-	0xbc, 0x28, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0xf4, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0xdc, 0x28, 0x00, 0x03, 0x7c, 0xf4, 0x00, 0x06, 0xd8, 0x44, 0x00, 0x08, 
-	0xa4, 0xf4, 0x00, 0x06, 0x04, 0x29, 0x00, 0x03, 0x64, 0x27, 0x00, 0x03, 0x8c, 0x25, 0x00, 0x03, 
-	0xcc, 0x25, 0x00, 0x03, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0x00, 0x45, 0x00, 0x08, 0x1c, 0x45, 0x00, 0x08, 0x2c, 0x29, 0x00, 0x03, 
-	0x38, 0x45, 0x00, 0x08, 0x54, 0x45, 0x00, 0x08, 0x70, 0x45, 0x00, 0x08, 0x48, 0x29, 0x00, 0x03, 
-	0x8c, 0x45, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0xa8, 0x45, 0x00, 0x08, 0xc8, 0x45, 0x00, 0x08, 0x90, 0x29, 0x00, 0x03, 
-	0xe8, 0x45, 0x00, 0x08, 0x08, 0x46, 0x00, 0x08, 0x28, 0x46, 0x00, 0x08, 0xcc, 0xf4, 0x00, 0x06, 
-	0x48, 0x46, 0x00, 0x08, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x28, 0xa0, 0xe1, 0x01, 0x00, 0x59, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x12, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 
-	0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x14, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 
-	0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x02, 0x32, 0x03, 0xe2, 
-	0x01, 0x32, 0x83, 0xe3, 0x40, 0x00, 0x10, 0xe3, 0x01, 0x31, 0x83, 0x03, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x06, 0xe2, 
-	0x02, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x60, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x04, 0xa0, 0xe1, 
-	0x02, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x64, 0x06, 0xe2, 0x20, 0x64, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x07, 0xe2, 
-	0x02, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x78, 0x07, 0xe2, 0x00, 0x70, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x86, 0x04, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x64, 0x06, 0xe2, 0x20, 0x64, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x87, 0x04, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x74, 0x07, 0xe2, 
-	0x20, 0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x84, 0x40, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x64, 0x4e, 0xa0, 0xe1, 0x04, 0x4c, 0x84, 0xe1, 0xff, 0x44, 0x14, 0xe2, 0x00, 0x30, 0x0f, 0xe1, 
-	0x01, 0x31, 0x03, 0xe2, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x08, 0x05, 0xe2, 0xa0, 0x08, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 
-	0x06, 0x32, 0x03, 0xe2, 0xff, 0x54, 0x05, 0xe2, 0x00, 0x58, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x17, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x04, 0x05, 0xe2, 0x02, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 
-	0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x58, 0x05, 0xe2, 
-	0x00, 0x50, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x04, 0xa0, 0xe1, 0x02, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 
-	0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x54, 0x05, 0xe2, 
-	0x20, 0x54, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x06, 0x04, 0xa0, 0xe1, 0x23, 0x3f, 0xb0, 0xe1, 0x60, 0x00, 0xa0, 0xe1, 
-	0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 0x01, 0x31, 0x83, 0x03, 
-	0xff, 0x64, 0x06, 0xe2, 0x20, 0x64, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x07, 0x04, 0xa0, 0xe1, 0x23, 0x3f, 0xb0, 0xe1, 
-	0x60, 0x00, 0xa0, 0xe1, 0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x85, 0x04, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x54, 0x05, 0xe2, 0x20, 0x54, 0x85, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xc4, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0x00, 0x4c, 0xa0, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xa5, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x58, 0x05, 0xe2, 
-	0x00, 0x5c, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0xa4, 0x4c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0x04, 0x4c, 0xa0, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 
-	0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x15, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x17, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x11, 0x60, 0xc6, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 
-	0x00, 0x28, 0xa0, 0xe1, 0x01, 0x00, 0x59, 0xe5, 0x01, 0x10, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x11, 0x20, 0xc2, 0xe1, 0x22, 0x08, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 
-	0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x14, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 
-	0x07, 0x00, 0x00, 0xe2, 0x11, 0x60, 0x86, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x29, 0x5b, 0x00, 0x03, 0x0c, 0xc0, 0x1f, 0xe5, 
-	0x00, 0x10, 0xdc, 0xe5, 0x01, 0x00, 0xdc, 0xe5, 0x00, 0x14, 0x81, 0xe1, 0x01, 0x22, 0x81, 0xe0, 
-	0x93, 0x20, 0x82, 0xe2, 0x00, 0x20, 0xcc, 0xe5, 0x53, 0x2c, 0x82, 0xe2, 0x22, 0x24, 0xa0, 0xe1, 
-	0x01, 0x20, 0xcc, 0xe5, 0x02, 0x90, 0x89, 0xe2, 0x11, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x0f, 0x12, 0x07, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 
-	0x21, 0x1d, 0x92, 0xe7, 0x27, 0x18, 0x81, 0xe0, 0x26, 0x08, 0xa0, 0xe1, 0x06, 0xcc, 0x8a, 0xe2, 
-	0x08, 0xc0, 0x8c, 0xe2, 0xb0, 0x20, 0xdc, 0xe1, 0x02, 0x00, 0x50, 0xe1, 0x0d, 0x00, 0x00, 0x1a, 
-	0x04, 0x20, 0x9c, 0xe5, 0x02, 0x00, 0x51, 0xe1, 0x0a, 0x00, 0x00, 0x1a, 0x20, 0x20, 0x80, 0xe2, 
-	0xb0, 0x20, 0xcc, 0xe1, 0x20, 0x20, 0x81, 0xe2, 0x04, 0x20, 0x8c, 0xe5, 0x02, 0x76, 0x87, 0xe2, 
-	0x02, 0x66, 0x86, 0xe2, 0x5f, 0x90, 0x89, 0xe2, 0xa1, 0x8d, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x04, 0xe0, 0x8f, 0xe2, 0x94, 0xc2, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0xf4, 0xff, 0xff, 0xea, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 
-	0x21, 0x1d, 0x92, 0xe7, 0x2b, 0x18, 0x81, 0xe0, 0x00, 0xc0, 0xd1, 0xe5, 0x01, 0x00, 0xd1, 0xe5, 
-	0x00, 0x04, 0x8c, 0xe1, 0x0f, 0xca, 0x00, 0xe2, 0x2c, 0xc5, 0x92, 0xe7, 0x00, 0xc0, 0x8c, 0xe0, 
-	0x01, 0xe0, 0xdc, 0xe4, 0x01, 0x20, 0xdc, 0xe4, 0x40, 0xe8, 0xca, 0xe5, 0x41, 0x28, 0xca, 0xe5, 
-	0x02, 0x24, 0x8e, 0xe1, 0x01, 0xe0, 0xdc, 0xe4, 0x02, 0x78, 0xa0, 0xe1, 0x03, 0x00, 0x80, 0xe2, 
-	0x00, 0x00, 0xc1, 0xe5, 0x20, 0x04, 0xa0, 0xe1, 0x01, 0x00, 0xc1, 0xe5, 0x99, 0xcd, 0x8a, 0xe2, 
-	0x11, 0x00, 0xdc, 0xe5, 0x01, 0x00, 0x41, 0xe5, 0x05, 0x00, 0xa0, 0xe3, 0x03, 0x00, 0x41, 0xe5, 
-	0x64, 0x00, 0xa0, 0xe3, 0x04, 0x00, 0x41, 0xe5, 0x01, 0xb7, 0x4b, 0xe2, 0x0a, 0x02, 0x03, 0xe2, 
-	0x05, 0xc2, 0x03, 0xe2, 0xac, 0xcb, 0xa0, 0xe1, 0xa0, 0x0c, 0x8c, 0xe1, 0x02, 0x00, 0x41, 0xe5, 
-	0x0e, 0x00, 0xa0, 0xe1, 0x24, 0x64, 0xa0, 0xe1, 0x00, 0x6c, 0x86, 0xe1, 0x99, 0xcd, 0x8a, 0xe2, 
-	0x11, 0x00, 0xcc, 0xe5, 0x6a, 0x09, 0x00, 0xeb, 0x27, 0x98, 0xa0, 0xe1, 0x0f, 0x1a, 0x09, 0xe2, 
-	0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 
-	0x0e, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x70, 0x14, 0x9a, 0xe5, 0x02, 0xb8, 0x5b, 0xe2, 0x26, 0x08, 0xa0, 0xe1, 0x2b, 0x08, 0xe1, 0x47, 
-	0x20, 0x04, 0xa0, 0xe1, 0x01, 0x00, 0xc1, 0x45, 0x74, 0x14, 0x9a, 0xe5, 0x25, 0x08, 0xd1, 0xe7, 
-	0xff, 0x00, 0x50, 0xe3, 0x01, 0x31, 0xa0, 0x03, 0x02, 0x32, 0xa0, 0x13, 0x07, 0x90, 0x89, 0xe2, 
-	0x0e, 0x8d, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x7e, 0x58, 0x85, 0xe2, 0x70, 0x14, 0x9a, 0xe5, 0x2b, 0x08, 0xf1, 0xe7, 0x01, 0x20, 0xd1, 0xe5, 
-	0x01, 0x00, 0x50, 0xe2, 0x02, 0xb8, 0x8b, 0xe2, 0x00, 0x68, 0xa0, 0xe1, 0x02, 0x6c, 0x86, 0xe1, 
-	0x01, 0x31, 0xa0, 0x03, 0x00, 0x30, 0xa0, 0x13, 0x08, 0x90, 0x89, 0xe2, 0x0b, 0x8d, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x74, 0x14, 0x9a, 0xe5, 
-	0x25, 0x18, 0x81, 0xe0, 0x17, 0x00, 0xd1, 0xe5, 0x01, 0x00, 0x40, 0xe2, 0x17, 0x00, 0xc1, 0xe5, 
-	0x16, 0x10, 0xd1, 0xe5, 0x80, 0x00, 0x51, 0xe3, 0x01, 0x00, 0x40, 0xb2, 0x80, 0x00, 0x10, 0xe3, 
-	0x01, 0x31, 0xa0, 0x03, 0x00, 0x30, 0xa0, 0x13, 0x13, 0x90, 0x89, 0xe2, 0x07, 0x8c, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x74, 0x14, 0x9a, 0xe5, 
-	0x25, 0x18, 0x81, 0xe0, 0x04, 0x00, 0xd1, 0xe5, 0x97, 0x2d, 0x8a, 0xe2, 0x91, 0x00, 0xc2, 0xe5, 
-	0x90, 0x05, 0xca, 0xe5, 0x02, 0x60, 0xd1, 0xe5, 0x03, 0x20, 0xd1, 0xe5, 0x02, 0x24, 0x86, 0xe1, 
-	0x02, 0x68, 0xa0, 0xe1, 0x26, 0x09, 0x00, 0xeb, 0x0d, 0x90, 0x89, 0xe2, 0x15, 0x8d, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x50, 0x14, 0x9a, 0xe5, 
-	0x26, 0x18, 0x81, 0xe0, 0x01, 0x68, 0x86, 0xe2, 0x00, 0x00, 0xd1, 0xe5, 0x06, 0x0c, 0x80, 0xe3, 
-	0x40, 0x14, 0x9a, 0xe5, 0x00, 0x00, 0xf1, 0xe7, 0x01, 0x10, 0xd1, 0xe5, 0x01, 0x04, 0x80, 0xe1, 
-	0x00, 0x78, 0xa0, 0xe1, 0x00, 0x4c, 0xa0, 0xe1, 0x03, 0x8c, 0x48, 0xe2, 0x98, 0xf0, 0x9f, 0xe5, 
-	0x50, 0xc4, 0x9a, 0xe5, 0x26, 0x08, 0xfc, 0xe7, 0x01, 0x10, 0xdc, 0xe5, 0x01, 0x04, 0x80, 0xe1, 
-	0x02, 0x68, 0x86, 0xe2, 0x74, 0xc4, 0x9a, 0xe5, 0x25, 0xc8, 0x8c, 0xe0, 0x17, 0x20, 0xdc, 0xe5, 
-	0x16, 0x10, 0xdc, 0xe5, 0x02, 0x14, 0x81, 0xe1, 0x01, 0x00, 0x80, 0xe0, 0x16, 0x00, 0xcc, 0xe5, 
-	0x20, 0x14, 0xa0, 0xe1, 0x17, 0x10, 0xcc, 0xe5, 0x80, 0x00, 0x10, 0xe3, 0x01, 0x0c, 0x40, 0x02, 
-	0x02, 0x09, 0x10, 0xe3, 0x01, 0x31, 0xa0, 0x03, 0x00, 0x30, 0xa0, 0x13, 0x13, 0x90, 0x89, 0xe2, 
-	0x02, 0x8b, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x74, 0x14, 0x9a, 0xe5, 0x25, 0x18, 0x81, 0xe0, 0x26, 0x08, 0xa0, 0xe1, 0x02, 0x00, 0xe1, 0xe5, 
-	0x20, 0x04, 0xa0, 0xe1, 0x01, 0x00, 0xc1, 0xe5, 0x97, 0x2d, 0x8a, 0xe2, 0x91, 0x00, 0xd2, 0xe5, 
-	0x02, 0x00, 0xc1, 0xe5, 0x0a, 0x90, 0x89, 0xe2, 0x01, 0x8b, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x95, 0xf0, 0x00, 0x06, 0x68, 0x1f, 0x00, 0x03, 
-	0x01, 0x23, 0xa0, 0xe3, 0x01, 0x33, 0xa0, 0xe3, 0x00, 0x12, 0xb2, 0xe5, 0x21, 0x18, 0x01, 0xe0, 
-	0xb8, 0x00, 0x53, 0xe1, 0x01, 0x00, 0x80, 0xe1, 0xb8, 0x00, 0x43, 0xe1, 0x80, 0x00, 0x11, 0xe2, 
-	0xb2, 0x00, 0xc2, 0x11, 0x6c, 0xc0, 0x9f, 0x15, 0x1c, 0xff, 0x2f, 0x11, 0x40, 0xc0, 0x8f, 0xe2, 
-	0x01, 0x00, 0x11, 0xe2, 0x58, 0xc0, 0x9f, 0x15, 0x03, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x11, 0xe2, 
-	0x54, 0xc0, 0x9f, 0x15, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0xa0, 0x01, 0xb2, 0x00, 0xc2, 0xe1, 
-	0x00, 0x30, 0x4f, 0xe1, 0x08, 0x40, 0x2d, 0xe9, 0x00, 0x30, 0x0f, 0xe1, 0x9f, 0x30, 0xc3, 0xe3, 
-	0x1f, 0x30, 0x83, 0xe3, 0x03, 0xf0, 0x29, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x1c, 0xff, 0x2f, 0xe1, 0x00, 0x40, 0xbd, 0xe8, 0x00, 0x30, 0x0f, 0xe1, 0x9f, 0x30, 0xc3, 0xe3, 
-	0x92, 0x30, 0x83, 0xe3, 0x03, 0xf0, 0x29, 0xe1, 0x01, 0x40, 0xbd, 0xe8, 0x00, 0xf0, 0x69, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x88, 0x2d, 0x00, 0x03, 0x71, 0x18, 0x00, 0x08, 0xbc, 0x36, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x00, 0xf0, 0x5f, 0x2d, 0xe9, 0x64, 0xa0, 0x9f, 0xe5, 0x64, 0x00, 0x9f, 0xe5, 
-	0x00, 0x00, 0x5d, 0xe1, 0x04, 0x00, 0x00, 0xda, 0x5c, 0x10, 0x9f, 0xe5, 0x00, 0x00, 0x90, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x02, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0xea, 0x0b, 0xb0, 0xa0, 0xe1, 
-	0x02, 0x00, 0x00, 0xea, 0x0b, 0xb0, 0xa0, 0xe1, 0x0f, 0xe0, 0xa0, 0xe1, 0x3c, 0xf0, 0x9f, 0xe5, 
-	0x01, 0x00, 0xa0, 0xe3, 0x67, 0x05, 0xca, 0xe5, 0x1f, 0x01, 0x00, 0xeb, 0xe9, 0x01, 0x00, 0xeb, 
-	0x95, 0x06, 0x00, 0xeb, 0x5c, 0x06, 0x00, 0xeb, 0x0f, 0xe0, 0xa0, 0xe1, 0x20, 0xf0, 0x9f, 0xe5, 
-	0x20, 0x00, 0x9f, 0xe5, 0x70, 0x00, 0x0f, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 0x18, 0xf0, 0x9f, 0xe5, 
-	0xf0, 0x9f, 0xbd, 0xe8, 0x68, 0x51, 0x00, 0x03, 0x7c, 0x7d, 0x00, 0x03, 0xef, 0xbe, 0xad, 0xde, 
-	0x08, 0x59, 0x00, 0x08, 0x04, 0x5e, 0x00, 0x08, 0xbc, 0x36, 0x00, 0x03, 0xd0, 0x5b, 0x00, 0x08, 
-	0xe4, 0x04, 0xda, 0xe5, 0x20, 0x00, 0x10, 0xe3, 0x42, 0x00, 0x00, 0x0a, 0xd0, 0x04, 0x9a, 0xe5, 
-	0x00, 0x00, 0x58, 0xe1, 0xe8, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x80, 0x42, 0x90, 0x00, 0x50, 0xe3, 
-	0x00, 0x00, 0xa0, 0xa3, 0xef, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x39, 0x00, 0x00, 0xba, 
-	0xee, 0x14, 0xda, 0xe5, 0xa6, 0x00, 0x51, 0xe3, 0x36, 0x00, 0x00, 0xca, 0x07, 0x00, 0x51, 0xe3, 
-	0x5a, 0x00, 0x00, 0xda, 0x02, 0x00, 0xa0, 0xe3, 0x2a, 0x05, 0xca, 0xe5, 0xe4, 0x04, 0xda, 0xe5, 
-	0xb8, 0x12, 0x9f, 0xe5, 0x02, 0x00, 0x10, 0xe3, 0x01, 0x1a, 0xc1, 0x03, 0x80, 0x00, 0x10, 0xe3, 
-	0x03, 0x1a, 0xc1, 0x03, 0x01, 0x18, 0x81, 0xe1, 0x14, 0x15, 0x8a, 0xe5, 0xa0, 0x12, 0x9f, 0xe5, 
-	0x10, 0x00, 0x10, 0xe3, 0x08, 0x10, 0x81, 0x03, 0x01, 0x18, 0x81, 0xe1, 0x08, 0x00, 0x10, 0xe3, 
-	0x03, 0x1c, 0x81, 0x12, 0x40, 0x00, 0x10, 0xe3, 0x03, 0x14, 0x81, 0x12, 0x01, 0x18, 0x81, 0xe3, 
-	0x01, 0x00, 0x10, 0xe3, 0x04, 0x00, 0x00, 0x1a, 0xa5, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe3, 
-	0x03, 0x10, 0x81, 0x03, 0x01, 0x1c, 0x81, 0x12, 0x08, 0x10, 0x81, 0x13, 0x04, 0x15, 0x8a, 0xe5, 
-	0x01, 0x1c, 0x81, 0xe2, 0x01, 0x14, 0x81, 0xe2, 0x08, 0x10, 0x81, 0xe3, 0x02, 0x17, 0x81, 0xe3, 
-	0x08, 0x15, 0x8a, 0xe5, 0x20, 0x15, 0x9a, 0xe5, 0xee, 0x04, 0xda, 0xe5, 0x00, 0x00, 0x60, 0xe2, 
-	0x21, 0x00, 0x40, 0xe2, 0x00, 0x08, 0xa0, 0xe1, 0x20, 0x18, 0x81, 0xe1, 0x10, 0x15, 0x8a, 0xe5, 
-	0x00, 0x00, 0x60, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0xc8, 0x00, 0x80, 0xe3, 0x00, 0x08, 0x80, 0xe1, 
-	0x18, 0x05, 0x8a, 0xe5, 0xe7, 0x04, 0xda, 0xe5, 0x08, 0x00, 0x40, 0xe2, 0x00, 0x18, 0xa0, 0xe1, 
-	0xe6, 0x04, 0xda, 0xe5, 0x28, 0x00, 0x40, 0xe2, 0x00, 0x08, 0xa0, 0xe1, 0x20, 0x18, 0x81, 0xe1, 
-	0x0c, 0x15, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xa0, 0xe3, 0x2a, 0x05, 0xca, 0xe5, 
-	0xe4, 0x04, 0xda, 0xe5, 0xec, 0x11, 0x9f, 0xe5, 0x02, 0x00, 0x10, 0xe3, 0x01, 0x1a, 0xc1, 0x03, 
-	0x01, 0x18, 0x81, 0xe1, 0x14, 0x15, 0x8a, 0xe5, 0xd4, 0x11, 0x9f, 0xe5, 0x10, 0x00, 0x10, 0xe3, 
-	0x08, 0x10, 0x81, 0x03, 0x08, 0x00, 0x10, 0xe3, 0x03, 0x1c, 0x81, 0x12, 0x01, 0x18, 0x81, 0xe1, 
-	0x01, 0x14, 0x81, 0xe2, 0x01, 0x18, 0x81, 0xe3, 0x02, 0x17, 0x81, 0xe3, 0x01, 0x00, 0x10, 0xe3, 
-	0x05, 0x00, 0x00, 0x1a, 0xa5, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe3, 0x01, 0x1c, 0x81, 0x12, 
-	0x08, 0x10, 0x81, 0x13, 0x01, 0x10, 0x81, 0xe3, 0x00, 0x00, 0xb0, 0xe3, 0x04, 0x15, 0x8a, 0xe5, 
-	0x02, 0x1c, 0x81, 0x12, 0x01, 0x10, 0x41, 0x12, 0x08, 0x15, 0x8a, 0xe5, 0xe7, 0x04, 0xda, 0xe5, 
-	0x08, 0x00, 0x40, 0xe2, 0x00, 0x18, 0xa0, 0xe1, 0xe6, 0x04, 0xda, 0xe5, 0x28, 0x00, 0x40, 0xe2, 
-	0x00, 0x08, 0xa0, 0xe1, 0x20, 0x18, 0x81, 0xe1, 0x0c, 0x15, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x01, 0x00, 0xa0, 0xe3, 0x2a, 0x05, 0xca, 0xe5, 0xe4, 0x04, 0xda, 0xe5, 0x54, 0x11, 0x9f, 0xe5, 
-	0x02, 0x00, 0x10, 0xe3, 0x01, 0x1a, 0xc1, 0x03, 0x01, 0x18, 0x81, 0xe1, 0x14, 0x15, 0x8a, 0xe5, 
-	0x3c, 0x11, 0x9f, 0xe5, 0x10, 0x00, 0x10, 0xe3, 0x08, 0x10, 0x81, 0x03, 0x40, 0x00, 0x10, 0xe3, 
-	0x03, 0x1c, 0x81, 0x12, 0x01, 0x18, 0x81, 0xe1, 0x01, 0x14, 0x81, 0xe2, 0x01, 0x18, 0x81, 0xe3, 
-	0x02, 0x17, 0x81, 0xe3, 0x01, 0x00, 0x10, 0xe3, 0x02, 0x00, 0x00, 0x1a, 0xa5, 0x04, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe3, 0x01, 0x10, 0x81, 0x03, 0x04, 0x15, 0x8a, 0xe5, 0x02, 0x1c, 0x81, 0x12, 
-	0x01, 0x10, 0x41, 0x12, 0x08, 0x15, 0x8a, 0xe5, 0x20, 0x15, 0x9a, 0xe5, 0xee, 0x04, 0xda, 0xe5, 
-	0x00, 0x00, 0x60, 0xe2, 0x21, 0x00, 0x40, 0xe2, 0x00, 0x08, 0xa0, 0xe1, 0x20, 0x18, 0x81, 0xe1, 
-	0x0c, 0x15, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf8, 0x41, 0x2d, 0xe9, 0x05, 0xcc, 0x8a, 0xe2, 
-	0x3e, 0x00, 0x9c, 0xe8, 0x04, 0x60, 0xa0, 0xe1, 0x05, 0x70, 0xa0, 0xe1, 0x30, 0x85, 0x9a, 0xe5, 
-	0xff, 0x04, 0x18, 0xe3, 0x05, 0x00, 0x00, 0x0a, 0x08, 0x30, 0xc3, 0xe1, 0x34, 0x85, 0x9a, 0xe5, 
-	0x08, 0x30, 0x83, 0xe1, 0xff, 0x0c, 0x18, 0xe3, 0x38, 0x65, 0x9a, 0x15, 0x3c, 0x75, 0x9a, 0xe5, 
-	0x00, 0x80, 0xa0, 0xe1, 0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 0x08, 0x00, 0x00, 0x0a, 
-	0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 0x05, 0x00, 0x00, 0x0a, 0xfc, 0x00, 0xa1, 0xe8, 
-	0x01, 0x00, 0x50, 0xe2, 0x02, 0x00, 0x00, 0x0a, 0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 
-	0xf3, 0xff, 0xff, 0x1a, 0x00, 0x15, 0x8a, 0xe5, 0x05, 0xcc, 0x8a, 0xe2, 0x14, 0xc0, 0x8c, 0xe2, 
-	0x1c, 0x25, 0x9a, 0xe5, 0x12, 0x4e, 0x82, 0xe2, 0x05, 0x00, 0x00, 0xeb, 0x1c, 0x25, 0x8a, 0xe5, 
-	0x04, 0x20, 0xa0, 0xe1, 0x05, 0xcc, 0x8a, 0xe2, 0x18, 0xc0, 0x8c, 0xe2, 0x00, 0x00, 0x00, 0xeb, 
-	0xf8, 0x81, 0xbd, 0xe8, 0x88, 0x00, 0xa0, 0xe1, 0x02, 0x00, 0x12, 0xe3, 0x00, 0x10, 0xbc, 0x15, 
-	0xb2, 0x10, 0xc2, 0x10, 0x02, 0x00, 0x40, 0x12, 0x01, 0x13, 0xa0, 0xe3, 0xd4, 0xc0, 0x81, 0xe5, 
-	0x02, 0xc0, 0x80, 0xe2, 0x2c, 0xc1, 0xb0, 0xe1, 0xd8, 0x20, 0x81, 0x15, 0x85, 0xc4, 0x8c, 0x13, 
-	0xdc, 0xc0, 0x81, 0x15, 0xff, 0xc4, 0xcc, 0x13, 0x00, 0x20, 0x82, 0xe0, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x40, 0x7f, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x40, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x91, 0xe5, 
-	0x04, 0x00, 0xc0, 0xe1, 0x05, 0x00, 0x80, 0xe1, 0x04, 0x00, 0x81, 0xe5, 0x14, 0x70, 0x81, 0xe5, 
-	0x18, 0x10, 0x81, 0xe2, 0x01, 0x20, 0x52, 0xe2, 0xf7, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x4c, 0x15, 0x9a, 0xe5, 0x48, 0x05, 0x9a, 0xe5, 0x4c, 0x05, 0x8a, 0xe5, 0x03, 0xc0, 0x00, 0xe2, 
-	0x02, 0x00, 0x5c, 0xe3, 0x80, 0x2a, 0x9f, 0xd5, 0x03, 0x00, 0x5c, 0xe3, 0x7c, 0x2a, 0x9f, 0x05, 
-	0x00, 0x00, 0x5c, 0xe3, 0x78, 0x2a, 0x9f, 0x05, 0x01, 0x33, 0xa0, 0xe3, 0x48, 0x20, 0x83, 0xe5, 
-	0x2e, 0x25, 0xda, 0xe5, 0xb4, 0x25, 0xc3, 0xe1, 0x1f, 0x00, 0x12, 0xe3, 0x00, 0x20, 0xa0, 0x03, 
-	0x60, 0xfa, 0x9f, 0x15, 0x50, 0x20, 0x83, 0xe5, 0x00, 0x00, 0x51, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 
-	0x54, 0xfa, 0x9f, 0xe5, 0x48, 0x15, 0x9a, 0xe5, 0x50, 0x15, 0x8a, 0xe5, 0x03, 0x00, 0x01, 0xe2, 
-	0x01, 0x00, 0x50, 0xe3, 0x07, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x50, 0xe3, 0x0f, 0x00, 0x00, 0x0a, 
-	0x03, 0x00, 0x50, 0xe3, 0x14, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xa0, 0xe3, 0x30, 0x05, 0x8a, 0xe5, 
-	0x34, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x20, 0x0a, 0x9f, 0xe5, 0x30, 0x05, 0x8a, 0xe5, 
-	0x1c, 0x0a, 0x9f, 0xe5, 0x34, 0x05, 0x8a, 0xe5, 0x21, 0x04, 0xa0, 0xe1, 0xff, 0x08, 0xc0, 0xe3, 
-	0x21, 0x1c, 0xa0, 0xe1, 0x01, 0x08, 0x80, 0xe1, 0x3c, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xf8, 0x09, 0x9f, 0xe5, 0x30, 0x05, 0x8a, 0xe5, 0xf8, 0x09, 0x9f, 0xe5, 0x34, 0x05, 0x8a, 0xe5, 
-	0xf4, 0x09, 0x9f, 0xe5, 0x3c, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x00, 0xe0, 0xe3, 
-	0x30, 0x05, 0x8a, 0xe5, 0xe4, 0x09, 0x9f, 0xe5, 0x34, 0x05, 0x8a, 0xe5, 0xd8, 0x09, 0x9f, 0xe5, 
-	0x3c, 0x05, 0x8a, 0xe5, 0x21, 0x04, 0xa0, 0xe1, 0xff, 0x08, 0xc0, 0xe3, 0x21, 0x1c, 0xa0, 0xe1, 
-	0x01, 0x08, 0x80, 0xe1, 0x38, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x44, 0x2d, 0xe9, 
-	0x01, 0x13, 0xa0, 0xe3, 0xb8, 0x09, 0x9f, 0xe5, 0xb2, 0x04, 0xc1, 0xe1, 0xb4, 0x09, 0x9f, 0xe5, 
-	0x44, 0x00, 0x81, 0xe5, 0xb9, 0xff, 0xff, 0xeb, 0x81, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 
-	0x4e, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x84, 0xbd, 0xe8, 0x81, 0x05, 0xda, 0xe5, 
-	0xe3, 0x15, 0xda, 0xe5, 0x01, 0x10, 0x21, 0xe2, 0x01, 0x00, 0x10, 0xe0, 0x1e, 0xff, 0x2f, 0x01, 
-	0x84, 0x59, 0x9f, 0xe5, 0x84, 0x69, 0x9f, 0xe5, 0x84, 0x79, 0x9f, 0xe5, 0x84, 0x89, 0x9f, 0xe5, 
-	0x84, 0x99, 0x9f, 0xe5, 0x00, 0x40, 0x2d, 0xe9, 0x80, 0xc9, 0x9f, 0xe5, 0x80, 0x19, 0x9f, 0xe5, 
-	0x1c, 0x10, 0x8f, 0xe5, 0x7c, 0xb9, 0x9f, 0xe5, 0x06, 0x00, 0x00, 0xeb, 0x78, 0xc9, 0x9f, 0xe5, 
-	0x78, 0x19, 0x9f, 0xe5, 0x08, 0x10, 0x8f, 0xe5, 0x74, 0xb9, 0x9f, 0xe5, 0x01, 0x00, 0x00, 0xeb, 
-	0x00, 0x80, 0xbd, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x1f, 0xe5, 0x07, 0x2c, 0x0b, 0xe2, 
-	0x22, 0xa3, 0x91, 0xe7, 0x00, 0x00, 0xa0, 0xe3, 0x22, 0x03, 0x81, 0xe7, 0x0a, 0xa0, 0xb0, 0xe1, 
-	0x04, 0x00, 0x00, 0x1a, 0x01, 0xbc, 0x8b, 0xe2, 0x80, 0xc0, 0x8c, 0xe2, 0x1f, 0x0d, 0x1b, 0xe3, 
-	0xf5, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 0xaa, 0xa0, 0xb0, 0xe1, 0x03, 0x00, 0x00, 0x2a, 
-	0x1e, 0x00, 0x00, 0x0a, 0x04, 0xc0, 0x8c, 0xe2, 0x08, 0xb0, 0x8b, 0xe2, 0xf9, 0xff, 0xff, 0xea, 
-	0xa7, 0x41, 0x9c, 0xe7, 0x04, 0x30, 0x9c, 0xe4, 0xff, 0x2c, 0x03, 0xe2, 0xff, 0x00, 0x03, 0xe2, 
-	0x02, 0x04, 0x80, 0xe1, 0xff, 0x2c, 0x04, 0xe2, 0xff, 0x10, 0x04, 0xe2, 0x02, 0x14, 0x81, 0xe1, 
-	0x05, 0x20, 0x01, 0xe0, 0x82, 0x02, 0x80, 0xe1, 0x06, 0x20, 0x01, 0xe0, 0x87, 0x21, 0x82, 0xe0, 
-	0x02, 0x06, 0x80, 0xe1, 0x08, 0x20, 0x82, 0xe0, 0x04, 0x00, 0x8b, 0xe4, 0xfc, 0x27, 0x8b, 0xe5, 
-	0x80, 0x00, 0x11, 0xe3, 0x09, 0x00, 0xc0, 0x01, 0x02, 0x0c, 0x80, 0x03, 0x02, 0x05, 0x11, 0xe3, 
-	0x09, 0x08, 0xc0, 0x01, 0x02, 0x04, 0x80, 0x03, 0xfc, 0x0f, 0x8b, 0xe5, 0x04, 0x00, 0x1b, 0xe3, 
-	0x23, 0x38, 0xa0, 0x11, 0x24, 0x48, 0xa0, 0x11, 0xe6, 0xff, 0xff, 0x1a, 0xdd, 0xff, 0xff, 0xea, 
-	0xfe, 0x00, 0x1b, 0xe2, 0x80, 0x10, 0xa0, 0x13, 0xa0, 0x10, 0x41, 0x10, 0x81, 0xb0, 0x8b, 0x10, 
-	0x01, 0xc0, 0x8c, 0x10, 0x1f, 0x0d, 0x1b, 0xe3, 0xca, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xff, 0x47, 0x2d, 0xe9, 0x8c, 0xa8, 0x9f, 0xe5, 0xe4, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 
-	0x0f, 0xe0, 0xa0, 0x11, 0x80, 0xf8, 0x9f, 0x15, 0x80, 0x48, 0x9f, 0xe5, 0xe3, 0x25, 0xda, 0xe5, 
-	0x02, 0x00, 0x52, 0xe3, 0x78, 0xf8, 0x9f, 0xa5, 0x29, 0x25, 0xda, 0xe5, 0x80, 0x00, 0x12, 0xe3, 
-	0x70, 0xf8, 0x9f, 0x05, 0x70, 0x58, 0x9f, 0xe5, 0x10, 0x80, 0xa0, 0xe3, 0x2d, 0x15, 0xda, 0xe5, 
-	0x01, 0x10, 0xb0, 0xe1, 0x07, 0x00, 0x00, 0x0a, 0x04, 0x90, 0xa0, 0xe3, 0x25, 0x00, 0x00, 0xeb, 
-	0x01, 0x90, 0x59, 0xe2, 0xfc, 0xff, 0xff, 0x1a, 0x18, 0x40, 0x84, 0xe2, 0x01, 0x80, 0x58, 0xe2, 
-	0xf8, 0xff, 0xff, 0x1a, 0x04, 0x00, 0x00, 0xea, 0x03, 0x00, 0xb5, 0xe8, 0x03, 0x00, 0x84, 0xe8, 
-	0x20, 0x40, 0x84, 0xe2, 0x01, 0x80, 0x58, 0xe2, 0xfa, 0xff, 0xff, 0x1a, 0xa6, 0x04, 0xda, 0xe5, 
-	0x00, 0x00, 0xb0, 0xe1, 0x02, 0x00, 0x00, 0x0a, 0x2c, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 
-	0x18, 0xf8, 0x9f, 0x15, 0x4c, 0x05, 0xda, 0xe5, 0x02, 0x00, 0x10, 0xe3, 0x05, 0x04, 0xa0, 0xe3, 
-	0xf8, 0x17, 0x9f, 0xe5, 0xb0, 0x30, 0xd1, 0x11, 0x00, 0x30, 0xa0, 0x03, 0xb0, 0x30, 0xc0, 0xe1, 
-	0xfc, 0x07, 0x9f, 0xe5, 0xe4, 0x17, 0x9f, 0xe5, 0x08, 0x20, 0xa0, 0xe3, 0xb0, 0x32, 0xd1, 0xe0, 
-	0xb2, 0x30, 0xc0, 0xe0, 0x01, 0x20, 0x52, 0xe2, 0xfb, 0xff, 0xff, 0x1a, 0xff, 0x47, 0xbd, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x03, 0x00, 0x84, 0xe8, 0x20, 0x40, 0x84, 0xe2, 0x01, 0x20, 0x52, 0xe2, 
-	0xfb, 0xff, 0xff, 0x1a, 0xe4, 0xff, 0xff, 0xea, 0x00, 0x40, 0x2d, 0xe9, 0xb2, 0x60, 0xd5, 0xe0, 
-	0x1f, 0x00, 0x16, 0xe2, 0x01, 0x00, 0x80, 0x12, 0x80, 0x01, 0xa0, 0xe1, 0x01, 0x00, 0x40, 0x12, 
-	0x0e, 0x00, 0x00, 0xeb, 0x00, 0x70, 0xa0, 0xe1, 0x3e, 0x0e, 0x16, 0xe2, 0x20, 0x00, 0x80, 0x12, 
-	0x20, 0x01, 0xa0, 0xe1, 0x01, 0x00, 0x40, 0x12, 0x08, 0x00, 0x00, 0xeb, 0x80, 0x72, 0x87, 0xe1, 
-	0x1f, 0x0b, 0x16, 0xe2, 0x19, 0x0e, 0x80, 0x12, 0xa0, 0x03, 0xa0, 0xe1, 0x01, 0x00, 0x40, 0x12, 
-	0x02, 0x00, 0x00, 0xeb, 0x00, 0x75, 0x87, 0xe1, 0xb2, 0x70, 0xc4, 0xe0, 0x00, 0x80, 0xbd, 0xe8, 
-	0x01, 0x2c, 0x60, 0xe2, 0x92, 0x02, 0x03, 0xe0, 0x01, 0x28, 0x73, 0xe2, 0x04, 0x30, 0x61, 0xe2, 
-	0x00, 0x04, 0x80, 0xe1, 0x91, 0x02, 0x02, 0xe0, 0x93, 0x20, 0x20, 0xe0, 0xa0, 0x06, 0xa0, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x10, 0x00, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x11, 0x92, 0xe7, 
-	0x00, 0x14, 0x81, 0xe0, 0x00, 0x00, 0xd9, 0xe5, 0x3e, 0x00, 0x50, 0xe3, 0x05, 0x00, 0xd9, 0x05, 
-	0xc9, 0x00, 0x50, 0x03, 0x02, 0x00, 0xd9, 0x05, 0x3d, 0x00, 0x50, 0x03, 0x01, 0x00, 0x00, 0x1a, 
-	0xa3, 0x8d, 0x48, 0xe2, 0x24, 0xe3, 0x9a, 0xe5, 0xe8, 0x04, 0xda, 0xe5, 0x02, 0x00, 0x18, 0xe3, 
-	0x00, 0x00, 0xa0, 0x03, 0x90, 0x00, 0x50, 0xe3, 0x00, 0x00, 0xa0, 0xa3, 0x64, 0x00, 0x50, 0xe3, 
-	0x00, 0xf7, 0x9f, 0xa5, 0x01, 0x00, 0xa0, 0xe3, 0x64, 0x05, 0xca, 0xe5, 0x6c, 0x05, 0x9a, 0xe5, 
-	0xa0, 0x20, 0xa0, 0xe3, 0x04, 0x04, 0x00, 0xea, 0x68, 0xc5, 0x9a, 0xe5, 0xa0, 0x90, 0x8c, 0xe2, 
-	0x07, 0x24, 0xa0, 0xe3, 0xa5, 0x54, 0xda, 0xe5, 0x29, 0x05, 0xda, 0xe5, 0x04, 0x00, 0x10, 0xe3, 
-	0x20, 0x00, 0x00, 0x1a, 0x04, 0x30, 0x9c, 0xe4, 0xff, 0x00, 0x13, 0xe2, 0x1a, 0x00, 0x00, 0x0a, 
-	0x9f, 0x00, 0x50, 0xe3, 0x18, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x40, 0xe2, 0xff, 0x00, 0x00, 0xe2, 
-	0xff, 0x1c, 0x03, 0xe2, 0x02, 0x1a, 0x81, 0xe2, 0x01, 0x04, 0x80, 0xe1, 0x06, 0x12, 0x03, 0xe2, 
-	0xa1, 0x00, 0x80, 0xe1, 0x04, 0x00, 0x82, 0xe4, 0x02, 0x1b, 0xa0, 0xe3, 0x02, 0x01, 0x13, 0xe3, 
-	0x01, 0x1b, 0x81, 0x13, 0x00, 0x00, 0x55, 0xe3, 0x02, 0x03, 0x03, 0x12, 0xa0, 0x19, 0x81, 0x11, 
-	0x07, 0x04, 0x03, 0x12, 0x20, 0x16, 0x81, 0x11, 0x01, 0x02, 0x03, 0x02, 0x20, 0x18, 0x81, 0x01, 
-	0xff, 0x08, 0x03, 0xe2, 0x20, 0x18, 0x81, 0xe1, 0x02, 0x1c, 0x81, 0xe2, 0xb4, 0x10, 0xc2, 0xe0, 
-	0x09, 0x00, 0x5c, 0xe1, 0xe2, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 0x2a, 0x0e, 0xa0, 0xe3, 
-	0x08, 0x00, 0x82, 0xe4, 0xf9, 0xff, 0xff, 0xea, 0x04, 0x30, 0x9c, 0xe4, 0xff, 0x00, 0x13, 0xe2, 
-	0x1c, 0x00, 0x00, 0x0a, 0x9f, 0x00, 0x50, 0xe3, 0x1a, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x40, 0xe2, 
-	0xff, 0x00, 0x00, 0xe2, 0xff, 0x1c, 0x03, 0xe2, 0x02, 0x1a, 0x81, 0xe2, 0x01, 0x04, 0x80, 0xe1, 
-	0x06, 0x12, 0x03, 0xe2, 0xa1, 0x00, 0x80, 0xe1, 0x02, 0x09, 0x80, 0xe3, 0x04, 0x00, 0x82, 0xe4, 
-	0x02, 0x1b, 0xa0, 0xe3, 0x02, 0x01, 0x13, 0xe3, 0x01, 0x1b, 0x81, 0x13, 0x00, 0x00, 0x55, 0xe3, 
-	0x02, 0x03, 0x03, 0x12, 0xa0, 0x19, 0x81, 0x11, 0x07, 0x04, 0x03, 0x12, 0x20, 0x16, 0x81, 0x11, 
-	0x01, 0x02, 0x03, 0x02, 0x20, 0x18, 0x81, 0x01, 0xff, 0x08, 0x03, 0xe2, 0x20, 0x18, 0x81, 0xe1, 
-	0x01, 0x10, 0xc1, 0xe3, 0x02, 0x1c, 0x81, 0xe2, 0xb4, 0x10, 0xc2, 0xe0, 0x09, 0x00, 0x5c, 0xe1, 
-	0xe0, 0xff, 0xff, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 0x2a, 0x0e, 0xa0, 0xe3, 0x08, 0x00, 0x82, 0xe4, 
-	0xf9, 0xff, 0xff, 0xea, 0x0a, 0xc0, 0xa0, 0xe1, 0x98, 0xa5, 0x9f, 0xe5, 0xb8, 0x05, 0x9f, 0xe5, 
-	0x60, 0x15, 0x9a, 0xe5, 0xb4, 0x25, 0x9f, 0xe5, 0xb4, 0x35, 0x9f, 0xe5, 0x0e, 0x00, 0xa0, 0xe8, 
-	0x58, 0x15, 0x9a, 0xe5, 0x01, 0x23, 0xa0, 0xe3, 0xa8, 0x35, 0x9f, 0xe5, 0x0e, 0x00, 0xa0, 0xe8, 
-	0x12, 0x1e, 0x81, 0xe2, 0xa0, 0x25, 0x9f, 0xe5, 0x98, 0x35, 0x9f, 0xe5, 0x0e, 0x00, 0xa0, 0xe8, 
-	0x38, 0x00, 0x8f, 0xe2, 0x70, 0x09, 0x0f, 0xe5, 0x01, 0x23, 0xa0, 0xe3, 0x8c, 0x05, 0x9f, 0xe5, 
-	0xb4, 0x00, 0xc2, 0xe1, 0x4c, 0x05, 0x9a, 0xe5, 0x03, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x50, 0xe3, 
-	0xe4, 0x14, 0x9f, 0xd5, 0x03, 0x00, 0x50, 0xe3, 0xe0, 0x14, 0x9f, 0x05, 0x00, 0x00, 0x50, 0xe3, 
-	0xdc, 0x14, 0x9f, 0x05, 0x48, 0x10, 0x82, 0xe5, 0x0c, 0xa0, 0xa0, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x01, 0x23, 0xa0, 0xe3, 0xba, 0x2b, 0xc2, 0xe1, 0xb6, 0x2c, 0xc2, 0xe1, 0xb2, 0x2d, 0xc2, 0xe1, 
-	0x4c, 0x05, 0x9f, 0xe5, 0xc0, 0x09, 0x0f, 0xe5, 0x08, 0x00, 0xa0, 0xe3, 0xb4, 0x00, 0xc2, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xe4, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xe4, 0x14, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x80, 0x00, 0x10, 0xe3, 0x02, 0x80, 0x88, 0x13, 
-	0x02, 0x80, 0xc8, 0x03, 0x00, 0x20, 0x21, 0xe0, 0x00, 0x20, 0x02, 0xe0, 0x80, 0x00, 0x12, 0xe3, 
-	0x04, 0x00, 0x00, 0x0a, 0x0c, 0x25, 0x9f, 0xe5, 0xb8, 0x24, 0x8a, 0xe5, 0x00, 0x20, 0xa0, 0xe3, 
-	0xe8, 0x24, 0xca, 0xe5, 0x0f, 0x80, 0x08, 0xe2, 0x01, 0x40, 0x2d, 0xe9, 0xb5, 0x05, 0x00, 0xeb, 
-	0x00, 0x00, 0x9d, 0xe5, 0xe4, 0x04, 0xca, 0xe5, 0x9c, 0xfd, 0xff, 0xeb, 0x01, 0x80, 0xbd, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xe0, 0x14, 0x9f, 0xe5, 0x02, 0x00, 0x00, 0xea, 0xdc, 0x14, 0x9f, 0xe5, 
-	0x00, 0x00, 0x00, 0xea, 0x82, 0x1a, 0xa0, 0xe3, 0x02, 0x00, 0x10, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 
-	0x33, 0x2d, 0x58, 0xe2, 0x1e, 0xff, 0x2f, 0xb1, 0xff, 0xc8, 0xc1, 0xe3, 0x42, 0x23, 0xa0, 0xe1, 
-	0x92, 0x0c, 0x0c, 0xe0, 0x4c, 0xc8, 0xa0, 0xe1, 0x21, 0x18, 0xa0, 0xe1, 0x91, 0x0c, 0x0c, 0xe0, 
-	0x0c, 0x83, 0x48, 0xe0, 0x1e, 0xff, 0x2f, 0xe1, 0x82, 0x1a, 0xa0, 0xe3, 0x03, 0x20, 0x10, 0xe2, 
-	0x1e, 0xff, 0x2f, 0x01, 0x01, 0x00, 0x52, 0xe3, 0xf0, 0xff, 0xff, 0x1a, 0x12, 0x00, 0x00, 0xea, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x88, 0x14, 0x9f, 0xe5, 0x00, 0x00, 0x00, 0xea, 0x82, 0x1a, 0xa0, 0xe3, 
-	0x03, 0x20, 0x00, 0xe2, 0x01, 0x00, 0x52, 0xe3, 0x0b, 0x00, 0x00, 0x1a, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x70, 0x14, 0x9f, 0xe5, 0xff, 0x28, 0x05, 0xe2, 0x03, 0x08, 0x52, 0xe3, 0xee, 0xff, 0xff, 0x0a, 
-	0x02, 0x08, 0x52, 0xe3, 0xdf, 0xff, 0xff, 0x0a, 0x1e, 0xff, 0x2f, 0xe1, 0x82, 0x1a, 0xa0, 0xe3, 
-	0x03, 0x20, 0x10, 0xe2, 0x00, 0x00, 0x00, 0x0a, 0x1e, 0xff, 0x2f, 0xe1, 0xff, 0x28, 0xc1, 0xe3, 
-	0x48, 0xc3, 0xa0, 0xe1, 0x9c, 0x02, 0x02, 0xe0, 0x42, 0x28, 0xa0, 0xe1, 0x21, 0x18, 0xa0, 0xe1, 
-	0x91, 0x02, 0x02, 0xe0, 0x02, 0x83, 0x48, 0xe0, 0x1e, 0xff, 0x2f, 0xe1, 0xe7, 0x14, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x40, 0x2d, 0xe9, 0x79, 0x05, 0x00, 0xeb, 
-	0x00, 0x00, 0x9d, 0xe5, 0xe7, 0x04, 0xca, 0xe5, 0x01, 0x40, 0xbd, 0xe8, 0x07, 0x00, 0x00, 0xea, 
-	0xe6, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x40, 0x2d, 0xe9, 
-	0x70, 0x05, 0x00, 0xeb, 0x00, 0x00, 0x9d, 0xe5, 0xe6, 0x04, 0xca, 0xe5, 0x01, 0x40, 0xbd, 0xe8, 
-	0x2a, 0x05, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe3, 0xb7, 0xfd, 0xff, 0xba, 0x84, 0xfd, 0xff, 0xca, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x00, 0x18, 0xe2, 0xe8, 0x04, 0xda, 0x15, 0x30, 0x16, 0x9a, 0xe5, 
-	0x01, 0x00, 0x59, 0xe1, 0x34, 0xf6, 0x9a, 0x05, 0x38, 0x16, 0x9a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 
-	0x3c, 0xf6, 0x9a, 0x05, 0xb0, 0xf3, 0x9f, 0xe5, 0x01, 0x10, 0xd9, 0xe5, 0x01, 0x00, 0x50, 0xe1, 
-	0x0f, 0x80, 0x08, 0xb2, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x10, 0xd9, 0xe5, 0x01, 0x00, 0x50, 0xe1, 
-	0x0f, 0x80, 0x08, 0xa2, 0x1e, 0xff, 0x2f, 0xe1, 0x01, 0x10, 0xd9, 0xe5, 0x01, 0x00, 0x50, 0xe1, 
-	0x0f, 0x80, 0x08, 0x12, 0x01, 0x00, 0x80, 0x12, 0x1e, 0xff, 0x2f, 0xe1, 0x24, 0x1c, 0xa0, 0xe1, 
-	0xf9, 0xff, 0xff, 0xea, 0x25, 0x18, 0xa0, 0xe1, 0xff, 0x10, 0x01, 0xe2, 0xee, 0xff, 0xff, 0xea, 
-	0x25, 0x1c, 0xa0, 0xe1, 0xec, 0xff, 0xff, 0xea, 0x26, 0x18, 0xa0, 0xe1, 0xff, 0x10, 0x01, 0xe2, 
-	0xe9, 0xff, 0xff, 0xea, 0x26, 0x1c, 0xa0, 0xe1, 0xe7, 0xff, 0xff, 0xea, 0x25, 0x18, 0xa0, 0xe1, 
-	0xff, 0x10, 0x01, 0xe2, 0xec, 0xff, 0xff, 0xea, 0x25, 0x1c, 0xa0, 0xe1, 0xea, 0xff, 0xff, 0xea, 
-	0x26, 0x18, 0xa0, 0xe1, 0xff, 0x10, 0x01, 0xe2, 0xe7, 0xff, 0xff, 0xea, 0x26, 0x1c, 0xa0, 0xe1, 
-	0xe5, 0xff, 0xff, 0xea, 0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x00, 0x18, 0xe2, 0xe8, 0x04, 0xda, 0x15, 
-	0x00, 0x10, 0xd9, 0xe5, 0xfe, 0x00, 0x51, 0xe3, 0x08, 0x00, 0x00, 0x1a, 0x01, 0x10, 0xd9, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x05, 0x00, 0x00, 0x0a, 0x01, 0x10, 0xa0, 0xe3, 0x01, 0x10, 0x81, 0xe2, 
-	0x10, 0x10, 0x4f, 0xe5, 0x02, 0x00, 0x51, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 0x0f, 0x80, 0x08, 0xe2, 
-	0x00, 0x10, 0xa0, 0xe3, 0x24, 0x10, 0x4f, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xeb, 0x14, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0xd0, 0xf2, 0x9f, 0xe5, 0x03, 0x10, 0x00, 0xe2, 
-	0x81, 0x10, 0x8c, 0xe0, 0xb0, 0x10, 0xd1, 0xe1, 0xb0, 0x10, 0xc2, 0xe1, 0x0c, 0x10, 0x00, 0xe2, 
-	0xa1, 0x10, 0x8c, 0xe0, 0xb0, 0x10, 0xd1, 0xe1, 0xb2, 0x10, 0xc2, 0xe1, 0x30, 0x10, 0x00, 0xe2, 
-	0xa1, 0x11, 0x8c, 0xe0, 0xb0, 0x10, 0xd1, 0xe1, 0xb4, 0x10, 0xc2, 0xe1, 0xc0, 0x10, 0x00, 0xe2, 
-	0xa1, 0x12, 0x8c, 0xe0, 0xb0, 0x10, 0xd1, 0xe1, 0xb6, 0x10, 0xc2, 0xe1, 0x1e, 0xff, 0x2f, 0xe1, 
-	0xec, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x80, 0xf2, 0x9f, 0xe5, 
-	0xed, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x74, 0xf2, 0x9f, 0xe5, 
-	0xef, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x40, 0x2d, 0xe9, 
-	0x08, 0x05, 0x00, 0xeb, 0x00, 0x00, 0x9d, 0xe5, 0xef, 0x04, 0xca, 0xe5, 0xef, 0xfc, 0xff, 0xeb, 
-	0x01, 0x80, 0xbd, 0xe8, 0xa5, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 0x00, 0x00, 0xa0, 0x03, 
-	0x01, 0x00, 0x10, 0xe2, 0xf3, 0x04, 0xca, 0xe5, 0x3c, 0xc2, 0x9f, 0xe5, 0x80, 0xc6, 0x8c, 0x10, 
-	0x60, 0xc4, 0x8a, 0xe5, 0x64, 0xc4, 0x8a, 0xe5, 0x30, 0xc2, 0x9f, 0xe5, 0x18, 0xc0, 0x8c, 0x12, 
-	0xf8, 0xc4, 0x8a, 0xe5, 0xff, 0x00, 0xa0, 0xe3, 0x40, 0x00, 0xcf, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0xf3, 0x04, 0xda, 0xe5, 0xfe, 0x00, 0x80, 0xe3, 0x0e, 0xf0, 0xa0, 0xe1, 0xee, 0x14, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x01, 0x40, 0x2d, 0xe9, 0xed, 0x04, 0x00, 0xeb, 
-	0x00, 0x00, 0x9d, 0xe5, 0xee, 0x04, 0xca, 0xe5, 0xd4, 0xfc, 0xff, 0xeb, 0x01, 0x80, 0xbd, 0xe8, 
-	0x60, 0x24, 0x9a, 0xe5, 0x0c, 0x00, 0xc2, 0xe7, 0xac, 0x12, 0xa0, 0xe1, 0xff, 0x10, 0x01, 0xe2, 
-	0xff, 0x00, 0x31, 0xe3, 0x1e, 0xff, 0x2f, 0x01, 0x10, 0x10, 0x4f, 0xe5, 0xf8, 0xc4, 0x9a, 0xe5, 
-	0xa1, 0x01, 0xfc, 0xe7, 0x07, 0x10, 0x01, 0xe2, 0x01, 0x20, 0xa0, 0xe3, 0x12, 0x01, 0x80, 0xe1, 
-	0x00, 0x00, 0xcc, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x60, 0x24, 0x9a, 0xe5, 0x0c, 0x00, 0xc2, 0xe7, 
-	0x26, 0x1b, 0x5c, 0xe2, 0xef, 0xff, 0xff, 0x4a, 0x24, 0x21, 0x9f, 0xe5, 0xa1, 0x02, 0xf2, 0xe7, 
-	0x21, 0x11, 0xa0, 0xe1, 0x07, 0x10, 0x01, 0xe2, 0x01, 0xc0, 0xa0, 0xe3, 0x1c, 0x01, 0x80, 0xe1, 
-	0x00, 0x00, 0xc2, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0x2c, 0xc8, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 
-	0x26, 0x1b, 0x5c, 0xe2, 0xe3, 0xff, 0xff, 0x4a, 0x02, 0x0a, 0x51, 0xe3, 0xf1, 0xff, 0xff, 0x4a, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x14, 0xda, 0xe5, 0x3f, 0x20, 0x01, 0xe2, 0x60, 0xc1, 0x9f, 0xe5, 
-	0x02, 0x00, 0xcc, 0xe7, 0x80, 0x00, 0x11, 0xe3, 0x01, 0x10, 0x81, 0x12, 0x3f, 0x10, 0x01, 0x12, 
-	0x80, 0x10, 0x81, 0x13, 0xf0, 0x14, 0xca, 0x15, 0x1e, 0xff, 0x2f, 0xe1, 0xf2, 0x14, 0xda, 0xe5, 
-	0x3f, 0x20, 0x01, 0xe2, 0x3c, 0xc1, 0x9f, 0xe5, 0x02, 0x00, 0xcc, 0xe7, 0x80, 0x00, 0x11, 0xe3, 
-	0x01, 0x10, 0x81, 0x12, 0x3f, 0x10, 0x01, 0x12, 0x80, 0x10, 0x81, 0x13, 0xf2, 0x14, 0xca, 0x15, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x07, 0x50, 0x2d, 0xe9, 0x6c, 0x15, 0x9a, 0xe5, 0x68, 0x05, 0x9a, 0xe5, 
-	0xa0, 0x20, 0xa0, 0xe3, 0x78, 0x02, 0x00, 0xeb, 0x07, 0x90, 0xbd, 0xe8, 0xfe, 0x0c, 0x5c, 0xe3, 
-	0x18, 0x0f, 0x00, 0x4a, 0x6c, 0x15, 0x9a, 0xe5, 0x02, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0xfe, 0x0c, 0x5c, 0xe3, 0x15, 0x0f, 0x00, 0x4a, 0x02, 0x10, 0xa0, 0xe3, 0x64, 0x15, 0xca, 0xe5, 
-	0x6c, 0x15, 0x9a, 0xe5, 0xa0, 0x00, 0x52, 0xe3, 0x02, 0x00, 0xc1, 0xb7, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x46, 0x50, 0x53, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xe8, 0xff, 
-	0xfe, 0xff, 0xec, 0xff, 0xfa, 0xff, 0xe0, 0xff, 0xe0, 0x5e, 0x00, 0x08, 0x08, 0x5f, 0x00, 0x08, 
-	0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x0c, 0x1d, 0x08, 0x00, 0x20, 0x00, 
-	0x04, 0x09, 0x0c, 0x1d, 0xc8, 0x28, 0x00, 0x00, 0x98, 0x08, 0x98, 0x08, 0x68, 0x00, 0x68, 0x00, 
-	0x07, 0x00, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x72, 0x00, 0x72, 0xff, 0xfd, 0x00, 0x00, 
-	0x00, 0x58, 0x03, 0x02, 0x9c, 0x99, 0x02, 0x02, 0x00, 0x50, 0x00, 0x06, 0x00, 0x5c, 0x03, 0x02, 
-	0xbc, 0x99, 0x02, 0x02, 0x00, 0x68, 0x00, 0x06, 0x68, 0x51, 0x00, 0x03, 0xb4, 0x5f, 0x00, 0x08, 
-	0x00, 0x01, 0x00, 0x05, 0x94, 0x5f, 0x00, 0x08, 0x80, 0x5f, 0x00, 0x08, 0xfc, 0x78, 0x00, 0x03, 
-	0x34, 0x5f, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x05, 0x00, 0x60, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x04, 
-	0x08, 0x00, 0x00, 0x04, 0x06, 0x00, 0x60, 0xa6, 0x01, 0x00, 0x60, 0xa2, 0x40, 0x00, 0x00, 0x04, 
-	0x28, 0x97, 0x00, 0x00, 0x88, 0x2d, 0x00, 0x03, 0xf0, 0x4b, 0x00, 0x03, 0xab, 0x2a, 0x06, 0x00, 
-	0x9a, 0x19, 0x0a, 0x00, 0x46, 0x17, 0x0b, 0x00, 0x93, 0x24, 0x07, 0x00, 0x48, 0x62, 0x00, 0x08, 
-	0xbc, 0x63, 0x00, 0x08, 0xfc, 0x63, 0x00, 0x08, 0x24, 0x64, 0x00, 0x08, 0x00, 0xc0, 0x02, 0x02, 
-	0xdc, 0x99, 0x02, 0x02, 0x7c, 0x78, 0x00, 0x03, 0xbc, 0x78, 0x00, 0x03, 0xb4, 0x14, 0x9a, 0xe5, 
-	0x21, 0x01, 0xb0, 0xe1, 0xe0, 0x14, 0x9a, 0xe5, 0xf0, 0x00, 0x01, 0xe2, 0x24, 0x20, 0x9f, 0xe5, 
-	0x02, 0x10, 0x01, 0x20, 0xa1, 0xc4, 0xb0, 0x21, 0x22, 0x18, 0x01, 0x20, 0x0f, 0x10, 0x01, 0xe2, 
-	0x01, 0x0b, 0x12, 0xe3, 0x10, 0xc0, 0x8f, 0x12, 0x01, 0x10, 0xdc, 0x17, 0x00, 0x00, 0x81, 0xe1, 
-	0xd0, 0x05, 0x8a, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xff, 0x01, 0xff, 0x40, 0x00, 0x02, 0x01, 0x03, 
-	0x04, 0x06, 0x05, 0x07, 0x08, 0x0a, 0x09, 0x0b, 0x0c, 0xe0, 0xd0, 0x0f, 0x01, 0x20, 0xd9, 0xe4, 
-	0x10, 0xe0, 0x8f, 0xe2, 0x80, 0x00, 0x12, 0xe3, 0x68, 0x10, 0x8f, 0xe2, 0x02, 0xf1, 0x91, 0x07, 
-	0x97, 0x1d, 0x8a, 0xe2, 0x02, 0x00, 0xd1, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 0xc0, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x25, 0x28, 0xa0, 0xe1, 
-	0xff, 0x20, 0x02, 0xe2, 0x10, 0xe0, 0x8f, 0xe2, 0x80, 0x00, 0x12, 0xe3, 0x34, 0x10, 0x8f, 0xe2, 
-	0x02, 0xf1, 0x91, 0x07, 0x97, 0x1d, 0x8a, 0xe2, 0x02, 0x00, 0xd1, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xff, 0x20, 0x0c, 0xe2, 0xff, 0x0c, 0x5c, 0xe3, 0x8b, 0xff, 0xff, 0x4a, 0x80, 0x00, 0x12, 0xe3, 
-	0x02, 0xf1, 0x9f, 0x07, 0x28, 0x01, 0x00, 0xea, 0xf8, 0x42, 0x00, 0x03, 0xfc, 0x6b, 0x00, 0x08, 
-	0x04, 0x6c, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x14, 0x6c, 0x00, 0x08, 0x1c, 0x6c, 0x00, 0x08, 
-	0x24, 0x6c, 0x00, 0x08, 0x2c, 0x6c, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x34, 0x6c, 0x00, 0x08, 0x90, 0x6e, 0x00, 0x08, 0x9c, 0x6e, 0x00, 0x08, 
-	0xa8, 0x6e, 0x00, 0x08, 0xb4, 0x6e, 0x00, 0x08, 0xc0, 0x6e, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 
-	0xcc, 0x6e, 0x00, 0x08, 0xd8, 0x6e, 0x00, 0x08, 0xe4, 0x6e, 0x00, 0x08, 0xf0, 0x6e, 0x00, 0x08, 
-	0xfc, 0x6e, 0x00, 0x08, 0x0c, 0x6f, 0x00, 0x08, 0x18, 0x6f, 0x00, 0x08, 0x28, 0x6f, 0x00, 0x08, 
-	0x34, 0x6f, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x50, 0x6f, 0x00, 0x08, 0x5c, 0x6f, 0x00, 0x08, 
-	0x68, 0x6f, 0x00, 0x08, 0x74, 0x6f, 0x00, 0x08, 0x80, 0x6f, 0x00, 0x08, 0x8c, 0x6f, 0x00, 0x08, 
-	0x98, 0x6f, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 
-	0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 
-	0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 
-	0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 
-	0x40, 0x6f, 0x00, 0x08, 0x40, 0x6f, 0x00, 0x08, 0x5c, 0x37, 0x00, 0x03, 0x00, 0x50, 0x00, 0x03, 
-	0xe8, 0x65, 0x00, 0x08, 0xf0, 0x65, 0x00, 0x08, 0xdc, 0x38, 0x00, 0x03, 0x4c, 0x50, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0xfc, 0x65, 0x00, 0x08, 0x04, 0x66, 0x00, 0x08, 0x0c, 0x66, 0x00, 0x08, 
-	0x14, 0x66, 0x00, 0x08, 0x1c, 0x66, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x98, 0x6c, 0x00, 0x08, 
-	0x90, 0x44, 0x00, 0x03, 0xa8, 0x3a, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x3c, 0x6c, 0x00, 0x08, 
-	0x44, 0x6c, 0x00, 0x08, 0x4c, 0x6c, 0x00, 0x08, 0x54, 0x6c, 0x00, 0x08, 0x5c, 0x6c, 0x00, 0x08, 
-	0x0c, 0x6c, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x24, 0x66, 0x00, 0x08, 0x2c, 0x66, 0x00, 0x08, 
-	0x40, 0x66, 0x00, 0x08, 0x48, 0x66, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0xb0, 0x42, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x01, 0x20, 0xd9, 0xe4, 0x24, 0x0c, 0xa0, 0xe1, 
-	0x18, 0xe0, 0x8f, 0xe2, 0x80, 0x00, 0x12, 0xe3, 0x74, 0x10, 0x8f, 0xe2, 0x02, 0xf1, 0x91, 0x07, 
-	0x97, 0x1d, 0x8a, 0xe2, 0x02, 0x00, 0xc1, 0xe7, 0xff, 0x00, 0x52, 0xe3, 0x9c, 0x00, 0x00, 0x0a, 
-	0xc0, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x25, 0x28, 0xa0, 0xe1, 0xff, 0x20, 0x02, 0xe2, 0x24, 0x0c, 0xa0, 0xe1, 0x18, 0xe0, 0x8f, 0xe2, 
-	0x80, 0x00, 0x12, 0xe3, 0x38, 0x10, 0x8f, 0xe2, 0x02, 0xf1, 0x91, 0x07, 0x97, 0x1d, 0x8a, 0xe2, 
-	0x02, 0x00, 0xc1, 0xe7, 0xff, 0x00, 0x52, 0xe3, 0x8d, 0x00, 0x00, 0x0a, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xff, 0x20, 0x0c, 0xe2, 
-	0xff, 0x0c, 0x5c, 0xe3, 0xed, 0xfe, 0xff, 0x4a, 0x80, 0x00, 0x12, 0xe3, 0x02, 0xf1, 0x9f, 0x07, 
-	0x7f, 0x00, 0x00, 0xea, 0xbc, 0x42, 0x00, 0x03, 0xb0, 0x6b, 0x00, 0x08, 0xb4, 0x6b, 0x00, 0x08, 
-	0x90, 0x44, 0x00, 0x03, 0xc0, 0x6b, 0x00, 0x08, 0xcc, 0x6b, 0x00, 0x08, 0xd4, 0x6b, 0x00, 0x08, 
-	0xdc, 0x6b, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0xe4, 0x6b, 0x00, 0x08, 0x54, 0x6d, 0x00, 0x08, 0x60, 0x6d, 0x00, 0x08, 0x70, 0x6d, 0x00, 0x08, 
-	0x7c, 0x6d, 0x00, 0x08, 0x8c, 0x6d, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 0x9c, 0x6d, 0x00, 0x08, 
-	0xac, 0x6d, 0x00, 0x08, 0xb8, 0x6d, 0x00, 0x08, 0xc8, 0x6d, 0x00, 0x08, 0xd8, 0x6d, 0x00, 0x08, 
-	0xec, 0x6d, 0x00, 0x08, 0xfc, 0x6d, 0x00, 0x08, 0x0c, 0x6e, 0x00, 0x08, 0x1c, 0x6e, 0x00, 0x08, 
-	0x90, 0x44, 0x00, 0x03, 0x3c, 0x6e, 0x00, 0x08, 0x48, 0x6e, 0x00, 0x08, 0x54, 0x6e, 0x00, 0x08, 
-	0x60, 0x6e, 0x00, 0x08, 0x6c, 0x6e, 0x00, 0x08, 0x78, 0x6e, 0x00, 0x08, 0x84, 0x6e, 0x00, 0x08, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 
-	0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 
-	0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 
-	0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 0x2c, 0x6e, 0x00, 0x08, 
-	0x2c, 0x6e, 0x00, 0x08, 0x64, 0x37, 0x00, 0x03, 0xcc, 0x4f, 0x00, 0x03, 0x84, 0x38, 0x00, 0x03, 
-	0xa8, 0x38, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x54, 0x50, 0x00, 0x03, 0x2c, 0x35, 0x00, 0x03, 
-	0xd4, 0x39, 0x00, 0x03, 0x28, 0x3a, 0x00, 0x03, 0x38, 0x3a, 0x00, 0x03, 0x48, 0x3a, 0x00, 0x03, 
-	0xb4, 0x3a, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0xa0, 0x6c, 0x00, 0x08, 0x90, 0x44, 0x00, 0x03, 
-	0x6c, 0x3a, 0x00, 0x03, 0xec, 0x6b, 0x00, 0x08, 0x68, 0x6c, 0x00, 0x08, 0x70, 0x6c, 0x00, 0x08, 
-	0x7c, 0x6c, 0x00, 0x08, 0x8c, 0x6c, 0x00, 0x08, 0x30, 0x43, 0x00, 0x03, 0xbc, 0x6b, 0x00, 0x08, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x5c, 0x66, 0x00, 0x08, 0x5c, 0x3b, 0x00, 0x03, 0x64, 0x66, 0x00, 0x08, 
-	0x84, 0x3b, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x50, 0x42, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x97, 0x1d, 0x8a, 0xe2, 0x02, 0x00, 0xc1, 0xe7, 0xff, 0x00, 0x52, 0xe3, 
-	0x1e, 0xff, 0x2f, 0x11, 0xa1, 0x04, 0xca, 0xe5, 0x75, 0x02, 0x00, 0xea, 0x97, 0x1d, 0x8a, 0xe2, 
-	0x02, 0x00, 0xd1, 0xe7, 0x1e, 0xff, 0x2f, 0xe1, 0xa4, 0x04, 0xca, 0xe5, 0x07, 0x00, 0x00, 0xe2, 
-	0x02, 0x00, 0x50, 0xe3, 0x0d, 0x00, 0x00, 0xaa, 0x70, 0x14, 0x9a, 0xe5, 0x74, 0x14, 0x8a, 0xe5, 
-	0x04, 0x12, 0x9f, 0xe5, 0x34, 0x14, 0x8a, 0xe5, 0xc4, 0x14, 0x9a, 0xe5, 0x01, 0x90, 0x49, 0xe0, 
-	0x01, 0x00, 0x2d, 0xe9, 0x0f, 0x1a, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x05, 0x92, 0xe7, 
-	0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0x01, 0x00, 0xbd, 0xe8, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0xd8, 0x11, 0x9f, 0xe5, 0x00, 0x16, 0x81, 0xe0, 0x74, 0x14, 0x8a, 0xe5, 0xd0, 0x11, 0x9f, 0xe5, 
-	0x34, 0x14, 0x8a, 0xe5, 0xef, 0xff, 0xff, 0xea, 0xa4, 0x04, 0xda, 0xe5, 0xf8, 0x00, 0x80, 0xe3, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0xcf, 0x00, 0x80, 0xe3, 0x00, 0x20, 0xa0, 0xe3, 0xd0, 0x15, 0xda, 0xe5, 
-	0x10, 0x00, 0x10, 0xe3, 0x21, 0x22, 0x82, 0x01, 0x20, 0x00, 0x10, 0xe3, 0x01, 0x20, 0x82, 0x01, 
-	0x0f, 0x20, 0x02, 0xe2, 0x00, 0x20, 0x22, 0xe0, 0xd4, 0x15, 0xda, 0xe5, 0xd4, 0x25, 0xca, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x15, 0xda, 0xe5, 0x04, 0x10, 0x81, 0xe3, 0xf0, 0x15, 0xca, 0xe5, 
-	0xd4, 0x05, 0xda, 0xe5, 0x00, 0x10, 0xd9, 0xe5, 0xf0, 0x00, 0x51, 0xe3, 0x1e, 0xff, 0x2f, 0x11, 
-	0x09, 0x20, 0xa0, 0xe1, 0x01, 0x10, 0xd9, 0x05, 0x00, 0x00, 0x51, 0x03, 0x02, 0x10, 0xf9, 0x05, 
-	0xf0, 0x00, 0x51, 0xe3, 0xfa, 0xff, 0xff, 0x0a, 0x02, 0x20, 0x59, 0xe0, 0xa2, 0x20, 0x82, 0xe0, 
-	0x02, 0x83, 0x48, 0xe0, 0x0e, 0xf0, 0xa0, 0xe1, 0x80, 0x00, 0x10, 0xe3, 0x80, 0x00, 0xc0, 0xe3, 
-	0x1c, 0x00, 0x00, 0x1a, 0xea, 0x14, 0xda, 0xe5, 0x00, 0x00, 0x51, 0xe3, 0x0c, 0x00, 0x00, 0x0a, 
-	0xff, 0x5f, 0x2d, 0xe9, 0xea, 0x04, 0xda, 0xe5, 0x2f, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x40, 0xe0, 
-	0x00, 0x02, 0xb0, 0xe1, 0x04, 0xe0, 0x8f, 0x12, 0x18, 0xc1, 0x9f, 0x15, 0x1c, 0xff, 0x2f, 0x11, 
-	0xff, 0x5f, 0xbd, 0xe8, 0x10, 0x11, 0x9f, 0xe5, 0x00, 0x20, 0xa0, 0xe3, 0x00, 0x20, 0xc1, 0xe5, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xc8, 0x14, 0x9a, 0xe5, 0x39, 0x0c, 0x51, 0xe3, 0x01, 0x10, 0x80, 0xe2, 
-	0x81, 0x10, 0xa0, 0x01, 0x81, 0x13, 0xa0, 0xe1, 0x01, 0x80, 0x48, 0xe0, 0xff, 0x5f, 0x2d, 0xe9, 
-	0x01, 0x00, 0x80, 0xe2, 0x00, 0x02, 0xa0, 0xe1, 0x04, 0xe0, 0x8f, 0xe2, 0xd4, 0xc0, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0xff, 0x9f, 0xbd, 0xe8, 0x83, 0x15, 0xda, 0xe5, 0x02, 0x00, 0x51, 0xe3, 
-	0xef, 0xff, 0xff, 0x0a, 0x01, 0x00, 0x80, 0xe2, 0xc0, 0x10, 0x9f, 0xe5, 0xb8, 0x20, 0x9f, 0xe5, 
-	0x00, 0x00, 0xc1, 0xe5, 0x00, 0x00, 0xc2, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf0, 0x0f, 0x2d, 0xe9, 
-	0x00, 0xc0, 0xa0, 0xe3, 0x20, 0x20, 0x52, 0xe2, 0x1f, 0x00, 0x00, 0x4a, 0xf0, 0x00, 0xb0, 0xe8, 
-	0x00, 0x0f, 0xb1, 0xe8, 0x08, 0x40, 0x34, 0xe0, 0x10, 0x80, 0x00, 0x15, 0x01, 0xc0, 0x8c, 0x13, 
-	0x09, 0x50, 0x35, 0xe0, 0x0c, 0x90, 0x00, 0x15, 0x02, 0xc0, 0x8c, 0x13, 0x0a, 0x60, 0x36, 0xe0, 
-	0x08, 0xa0, 0x00, 0x15, 0x04, 0xc0, 0x8c, 0x13, 0x0b, 0x70, 0x37, 0xe0, 0x04, 0xb0, 0x00, 0x15, 
-	0x08, 0xc0, 0x8c, 0x13, 0xf0, 0x00, 0xb0, 0xe8, 0x00, 0x0f, 0xb1, 0xe8, 0x08, 0x40, 0x34, 0xe0, 
-	0x10, 0x80, 0x00, 0x15, 0x10, 0xc0, 0x8c, 0x13, 0x09, 0x50, 0x35, 0xe0, 0x0c, 0x90, 0x00, 0x15, 
-	0x20, 0xc0, 0x8c, 0x13, 0x0a, 0x60, 0x36, 0xe0, 0x08, 0xa0, 0x00, 0x15, 0x40, 0xc0, 0x8c, 0x13, 
-	0x0b, 0x70, 0x37, 0xe0, 0x04, 0xb0, 0x00, 0x15, 0x80, 0xc0, 0x8c, 0x13, 0x00, 0x40, 0xd3, 0xe5, 
-	0x04, 0xc0, 0x8c, 0xe1, 0x01, 0xc0, 0xc3, 0xe4, 0xdc, 0xff, 0xff, 0xea, 0x20, 0x20, 0x92, 0xe2, 
-	0xf0, 0x0f, 0xbd, 0xd8, 0x1e, 0xff, 0x2f, 0xd1, 0x14, 0xf0, 0x9f, 0xe5, 0x14, 0x45, 0x00, 0x03, 
-	0x00, 0xf0, 0x01, 0x02, 0x24, 0x45, 0x00, 0x03, 0x05, 0xf1, 0x00, 0x06, 0x52, 0x56, 0x00, 0x03, 
-	0x97, 0x56, 0x00, 0x03, 0x70, 0x6a, 0x00, 0x08, 0xff, 0x00, 0xa0, 0xe3, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x40, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x48, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x50, 0x14, 0x9a, 0xe5, 
-	0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x58, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x60, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 
-	0x68, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x70, 0x14, 0x9a, 0xe5, 
-	0x0c, 0x00, 0xd1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x74, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xd1, 0xe7, 
-	0x0e, 0xf0, 0xa0, 0xe1, 0x0e, 0x14, 0x8c, 0xe3, 0x01, 0x19, 0x81, 0xe2, 0x00, 0x00, 0xc1, 0xe5, 
-	0x68, 0x14, 0x9a, 0xe5, 0x0c, 0x00, 0xc1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0xb9, 0x1c, 0x4a, 0xe2, 
-	0xc0, 0x10, 0x41, 0xe2, 0x0c, 0x00, 0xc1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x74, 0x14, 0x9a, 0xe5, 
-	0x0c, 0x00, 0xc1, 0xe7, 0x0e, 0xf0, 0xa0, 0xe1, 0x20, 0x20, 0x52, 0xe2, 0x14, 0x00, 0x00, 0xba, 
-	0xf8, 0x03, 0x2d, 0xe9, 0x01, 0x30, 0xa0, 0xe1, 0x01, 0x40, 0xa0, 0xe1, 0x01, 0x50, 0xa0, 0xe1, 
-	0x01, 0x60, 0xa0, 0xe1, 0x01, 0x70, 0xa0, 0xe1, 0x01, 0x80, 0xa0, 0xe1, 0x01, 0x90, 0xa0, 0xe1, 
-	0xfa, 0x03, 0xa0, 0xe8, 0x20, 0x20, 0x52, 0xe2, 0x08, 0x00, 0x00, 0xba, 0xfa, 0x03, 0xa0, 0xe8, 
-	0x20, 0x20, 0x52, 0xe2, 0x05, 0x00, 0x00, 0xba, 0xfa, 0x03, 0xa0, 0xe8, 0x20, 0x20, 0x52, 0xe2, 
-	0x02, 0x00, 0x00, 0xba, 0xfa, 0x03, 0xa0, 0xe8, 0x20, 0x20, 0x52, 0xe2, 0xf3, 0xff, 0xff, 0xaa, 
-	0xf8, 0x03, 0xbd, 0xe8, 0x20, 0x20, 0x92, 0xe2, 0x1e, 0xff, 0x2f, 0xd1, 0x04, 0x10, 0x80, 0xe4, 
-	0x04, 0x20, 0x52, 0xe2, 0xfc, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0xe1, 0x20, 0x20, 0x52, 0xe2, 
-	0x11, 0x00, 0x00, 0xba, 0xf8, 0x07, 0x2d, 0xe9, 0xf8, 0x07, 0xb1, 0xe8, 0xf8, 0x07, 0xa0, 0xe8, 
-	0x20, 0x20, 0x52, 0xe2, 0x0b, 0x00, 0x00, 0xba, 0xf8, 0x07, 0xb1, 0xe8, 0xf8, 0x07, 0xa0, 0xe8, 
-	0x20, 0x20, 0x52, 0xe2, 0x07, 0x00, 0x00, 0xba, 0xf8, 0x07, 0xb1, 0xe8, 0xf8, 0x07, 0xa0, 0xe8, 
-	0x20, 0x20, 0x52, 0xe2, 0x03, 0x00, 0x00, 0xba, 0xf8, 0x07, 0xb1, 0xe8, 0xf8, 0x07, 0xa0, 0xe8, 
-	0x20, 0x20, 0x52, 0xe2, 0xef, 0xff, 0xff, 0xaa, 0xf8, 0x07, 0xbd, 0xe8, 0x20, 0x20, 0x92, 0xe2, 
-	0x1e, 0xff, 0x2f, 0xd1, 0x04, 0x20, 0x52, 0xe2, 0x04, 0xc0, 0x91, 0xa4, 0x04, 0xc0, 0x80, 0xa4, 
-	0xfb, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0x01, 0x04, 0x20, 0x82, 0xe2, 0x01, 0xc0, 0xd1, 0xe4, 
-	0x01, 0xc0, 0xc0, 0xe4, 0x01, 0x20, 0x52, 0xe2, 0xfb, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x01, 0x10, 0xc0, 0xe4, 0x01, 0x20, 0x52, 0xe2, 0xfc, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x03, 0xc0, 0x10, 0xe2, 0xf4, 0xff, 0xff, 0x1a, 0x03, 0xc0, 0x11, 0xe2, 0xd6, 0xff, 0xff, 0x0a, 
-	0x18, 0x40, 0x2d, 0xe9, 0x8c, 0xc1, 0xa0, 0xe1, 0x20, 0xe0, 0x6c, 0xe2, 0x03, 0x10, 0xc1, 0xe3, 
-	0x04, 0x30, 0x91, 0xe4, 0x33, 0x3c, 0xa0, 0xe1, 0x04, 0x20, 0x52, 0xe2, 0x04, 0x40, 0x91, 0xe4, 
-	0x14, 0x3e, 0x83, 0xe1, 0x04, 0x30, 0x80, 0xa4, 0x34, 0x3c, 0xa0, 0xa1, 0xf9, 0xff, 0xff, 0xca, 
-	0x18, 0x40, 0xbd, 0x08, 0x1e, 0xff, 0x2f, 0x01, 0x04, 0x20, 0x82, 0xe2, 0x01, 0x30, 0xc0, 0xe4, 
-	0x23, 0x34, 0xa0, 0xe1, 0x01, 0x20, 0x52, 0xe2, 0xfb, 0xff, 0xff, 0xca, 0x18, 0x40, 0xbd, 0xe8, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x92, 0x05, 0xda, 0xe5, 0x92, 0x05, 0xca, 0xe5, 0x0f, 0x00, 0x00, 0xe2, 
-	0x0a, 0x00, 0x50, 0xe3, 0x87, 0x1f, 0x4f, 0x12, 0x00, 0x00, 0xa0, 0xe1, 0xb0, 0x15, 0x9a, 0x05, 
-	0x28, 0x14, 0x8a, 0xe5, 0x2c, 0x14, 0x8a, 0xe5, 0x8e, 0x1f, 0x4f, 0x12, 0x00, 0x00, 0xa0, 0xe1, 
-	0x7e, 0x1f, 0x4f, 0x02, 0x00, 0x00, 0xa0, 0xe1, 0x2c, 0x10, 0x0a, 0xe5, 0x30, 0x10, 0x0a, 0xe5, 
-	0x94, 0x05, 0xda, 0xe5, 0x84, 0x02, 0x00, 0xea, 0x1f, 0x00, 0x10, 0xe2, 0x01, 0x00, 0xa0, 0x03, 
-	0x90, 0x05, 0xca, 0xe5, 0x91, 0x15, 0xda, 0xe5, 0x81, 0x02, 0x80, 0xe1, 0x1f, 0x00, 0x10, 0xe3, 
-	0x01, 0x00, 0x80, 0x02, 0x6a, 0x02, 0x00, 0xea, 0x01, 0x0c, 0x1c, 0xe3, 0x0e, 0xf0, 0xa0, 0x01, 
-	0x0f, 0x00, 0x10, 0xe2, 0x01, 0x00, 0xa0, 0x03, 0x65, 0x02, 0x00, 0xea, 0x01, 0x0a, 0x1c, 0xe3, 
-	0x01, 0x00, 0x00, 0x12, 0x91, 0x05, 0xca, 0x15, 0x90, 0x05, 0xca, 0x05, 0x90, 0x05, 0x9a, 0xe5, 
-	0x5f, 0x02, 0x00, 0xea, 0x94, 0x05, 0xca, 0xe5, 0x08, 0x00, 0x00, 0xe2, 0x24, 0x10, 0x9f, 0xe5, 
-	0x00, 0x00, 0x81, 0xe5, 0xd6, 0xff, 0xff, 0xea, 0x7f, 0x00, 0x10, 0xe2, 0x01, 0x00, 0xa0, 0x03, 
-	0x90, 0x05, 0xca, 0xe5, 0x56, 0x02, 0x00, 0xea, 0x3f, 0x00, 0x10, 0xe2, 0x01, 0x00, 0xa0, 0x03, 
-	0x90, 0x05, 0xca, 0xe5, 0x52, 0x02, 0x00, 0xea, 0x6c, 0x00, 0x00, 0x02, 0xe3, 0x05, 0xda, 0xe5, 
-	0x01, 0x00, 0x20, 0xe2, 0x65, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe0, 0x1e, 0xff, 0x2f, 0x01, 
-	0x00, 0x00, 0xa0, 0xe3, 0x65, 0x05, 0xca, 0xe5, 0x00, 0x44, 0x2d, 0xe9, 0xcc, 0x92, 0x9f, 0xe5, 
-	0x47, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x0a, 0x6f, 0x00, 0x00, 0xeb, 0x54, 0x00, 0x00, 0xeb, 
-	0xfc, 0xff, 0xff, 0x1a, 0x3e, 0x00, 0x00, 0xeb, 0x00, 0x84, 0xbd, 0xe8, 0xf8, 0x4f, 0x2d, 0xe9, 
-	0xac, 0x52, 0x9f, 0xe5, 0x7c, 0x60, 0x85, 0xe2, 0xa8, 0x72, 0x9f, 0xe5, 0x00, 0x40, 0xa0, 0xe3, 
-	0x3b, 0x00, 0x00, 0xeb, 0x13, 0x00, 0x00, 0x0a, 0x22, 0x32, 0x84, 0xe0, 0x60, 0x00, 0x53, 0xe3, 
-	0x15, 0x00, 0x00, 0xca, 0x06, 0x00, 0x55, 0xe1, 0x12, 0x00, 0x00, 0xaa, 0xb2, 0x20, 0xc5, 0xe0, 
-	0xb2, 0xc0, 0xc5, 0xe0, 0x06, 0x0d, 0x5c, 0xe2, 0x0c, 0x00, 0xa0, 0x41, 0x78, 0x12, 0x9f, 0xe5, 
-	0x00, 0x12, 0x81, 0xe0, 0x02, 0x1a, 0x81, 0x52, 0x04, 0x02, 0x87, 0xe0, 0x03, 0x40, 0xa0, 0xe1, 
-	0x22, 0x32, 0x8c, 0xe0, 0x68, 0xff, 0xff, 0xeb, 0x03, 0xc0, 0xa0, 0xe1, 0x00, 0x20, 0xa0, 0xe3, 
-	0x37, 0x00, 0x00, 0xeb, 0xeb, 0xff, 0xff, 0x1a, 0x00, 0x10, 0xa0, 0xe3, 0x00, 0x10, 0x85, 0xe5, 
-	0x1f, 0x00, 0x00, 0xeb, 0xf8, 0x8f, 0xbd, 0xe8, 0x0b, 0xb0, 0xa0, 0xe1, 0xf8, 0x4f, 0xbd, 0xe8, 
-	0x2c, 0x02, 0x9f, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 0x00, 0x10, 0x80, 0xe5, 0x01, 0x00, 0xa0, 0xe3, 
-	0x65, 0x05, 0xca, 0xe5, 0x1e, 0xff, 0x2f, 0xe1, 0xf5, 0xff, 0xff, 0xea, 0x66, 0x05, 0xda, 0xe5, 
-	0x00, 0x00, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0x01, 0x00, 0x00, 0xa0, 0xe3, 0x66, 0x05, 0xca, 0xe5, 
-	0x00, 0x44, 0x2d, 0xe9, 0xff, 0x80, 0xa0, 0xe3, 0xf4, 0xb1, 0x9f, 0xe5, 0xf4, 0x11, 0x9f, 0xe5, 
-	0xe8, 0x91, 0x9f, 0xe5, 0xb2, 0x20, 0xdb, 0xe0, 0xb2, 0xc0, 0xdb, 0xe0, 0x02, 0x20, 0xb0, 0xe1, 
-	0x03, 0x00, 0x00, 0x0a, 0x18, 0xe0, 0x4f, 0xe2, 0x06, 0x0d, 0x5c, 0xe2, 0x0c, 0x00, 0xa0, 0x41, 
-	0x37, 0x00, 0x00, 0xea, 0x00, 0x00, 0xa0, 0xe3, 0xc4, 0x11, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 
-	0x00, 0x84, 0xbd, 0xe8, 0xc4, 0x01, 0x9f, 0xe5, 0x00, 0x10, 0xa0, 0xe3, 0x30, 0x20, 0xa0, 0xe3, 
-	0x20, 0xff, 0xff, 0xea, 0xff, 0x80, 0xa0, 0xe3, 0xb4, 0x11, 0x9f, 0xe5, 0x00, 0x80, 0xc1, 0xe5, 
-	0x00, 0x20, 0xa0, 0xe3, 0x00, 0xc0, 0xa0, 0xe3, 0xa0, 0x01, 0x9f, 0xe5, 0x2c, 0xb3, 0xa0, 0xe1, 
-	0x0b, 0x01, 0x80, 0xe0, 0x04, 0xb0, 0x90, 0xe4, 0x0b, 0xb0, 0xb0, 0xe1, 0x04, 0x00, 0x00, 0x1a, 
-	0x40, 0xc0, 0x8c, 0xe2, 0x03, 0x0c, 0x5c, 0xe3, 0xf9, 0xff, 0xff, 0xba, 0x02, 0x20, 0xb0, 0xe1, 
-	0x1e, 0xff, 0x2f, 0xe1, 0xab, 0xb0, 0xb0, 0xe1, 0x02, 0x00, 0x00, 0x2a, 0x10, 0x00, 0x00, 0x0a, 
-	0x02, 0xc0, 0x8c, 0xe2, 0xfa, 0xff, 0xff, 0xea, 0x20, 0x20, 0x82, 0x22, 0xab, 0xb0, 0xb0, 0xe1, 
-	0xfc, 0xff, 0xff, 0x2a, 0x8b, 0xb0, 0xb0, 0xe1, 0x1e, 0xff, 0x2f, 0x11, 0x22, 0x12, 0x8c, 0xe0, 
-	0x3f, 0x00, 0x11, 0xe3, 0xf0, 0xff, 0xff, 0x1a, 0x40, 0x00, 0x11, 0xe3, 0xee, 0xff, 0xff, 0x0a, 
-	0x38, 0x01, 0x9f, 0xe5, 0x21, 0x12, 0xf0, 0xe7, 0x01, 0x00, 0x11, 0xe3, 0xea, 0xff, 0xff, 0x0a, 
-	0xe3, 0xff, 0xff, 0xea, 0x3f, 0x00, 0x1c, 0xe2, 0x40, 0x00, 0x60, 0x12, 0x00, 0xc0, 0x8c, 0x10, 
-	0x03, 0x0c, 0x5c, 0xe3, 0xdb, 0xff, 0xff, 0xba, 0x1e, 0xff, 0x2f, 0xe1, 0x06, 0x0d, 0x5c, 0xe2, 
-	0x0c, 0x00, 0xa0, 0x41, 0x22, 0xc2, 0x8c, 0xe0, 0xfc, 0x10, 0x9f, 0xe5, 0x00, 0x12, 0x81, 0xe0, 
-	0x02, 0x1a, 0x81, 0x52, 0x06, 0x34, 0xa0, 0xe3, 0x02, 0x3a, 0x83, 0x52, 0x80, 0x32, 0x83, 0xe0, 
-	0x80, 0x00, 0x50, 0xe3, 0x11, 0x00, 0x00, 0xba, 0x01, 0x0c, 0x50, 0xe3, 0x20, 0x00, 0x00, 0xba, 
-	0x06, 0x3a, 0x83, 0xe2, 0x04, 0x40, 0x91, 0xe4, 0x04, 0x50, 0x18, 0xe0, 0x05, 0x51, 0x99, 0x17, 
-	0x24, 0x74, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 0x87, 0x60, 0x85, 0xe1, 0x24, 0x58, 0x18, 0xe0, 
-	0x05, 0x51, 0x99, 0x17, 0x24, 0x7c, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 0x87, 0x70, 0x85, 0xe1, 
-	0xc0, 0x00, 0xa3, 0xe8, 0x04, 0x20, 0x52, 0xe2, 0xf1, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x05, 0x09, 0x83, 0xe2, 0x04, 0x40, 0x91, 0xe4, 0x04, 0x50, 0x18, 0xe0, 0x05, 0x51, 0x99, 0x17, 
-	0x24, 0x74, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 0x87, 0x60, 0x85, 0xe1, 0x24, 0x58, 0x18, 0xe0, 
-	0x05, 0x51, 0x99, 0x17, 0x24, 0x7c, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 0x87, 0x70, 0x85, 0xe1, 
-	0xc0, 0x00, 0xa3, 0xe8, 0xc0, 0x00, 0xa0, 0xe8, 0x04, 0x20, 0x52, 0xe2, 0xf0, 0xff, 0xff, 0xca, 
-	0x1e, 0xff, 0x2f, 0xe1, 0x02, 0x09, 0x83, 0xe2, 0x05, 0xa9, 0x83, 0xe2, 0x04, 0x40, 0x91, 0xe4, 
-	0x04, 0x50, 0x18, 0xe0, 0x05, 0x51, 0x99, 0x17, 0x24, 0x74, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 
-	0x87, 0x60, 0x85, 0xe1, 0x24, 0x58, 0x18, 0xe0, 0x05, 0x51, 0x99, 0x17, 0x24, 0x7c, 0x18, 0xe0, 
-	0x07, 0x71, 0x99, 0x17, 0x87, 0x70, 0x85, 0xe1, 0xc0, 0x00, 0xa3, 0xe8, 0xc0, 0x00, 0xa0, 0xe8, 
-	0xc0, 0x00, 0xaa, 0xe8, 0x04, 0x20, 0x52, 0xe2, 0xef, 0xff, 0xff, 0xca, 0x1e, 0xff, 0x2f, 0xe1, 
-	0x7c, 0x79, 0x00, 0x03, 0x1c, 0x99, 0x02, 0x02, 0x00, 0xe2, 0x00, 0x06, 0x00, 0x40, 0x03, 0x02, 
-	0xdc, 0x99, 0x02, 0x02, 0xe8, 0x3a, 0x00, 0x03, 0xc8, 0x04, 0x9a, 0xe5, 0x00, 0x80, 0x88, 0xe0, 
-	0xe8, 0x14, 0xda, 0xe5, 0x01, 0x10, 0x81, 0xe2, 0xe8, 0x14, 0xca, 0xe5, 0x4b, 0x00, 0x51, 0xe3, 
-	0xc0, 0xf4, 0x9a, 0x45, 0xe4, 0x04, 0xda, 0xe5, 0x28, 0x05, 0xca, 0xe5, 0xe3, 0x05, 0xda, 0xe5, 
-	0x00, 0x00, 0xb0, 0xe1, 0x0f, 0xe0, 0xa0, 0x01, 0xd4, 0xf5, 0x9f, 0x05, 0x04, 0xc0, 0x8f, 0xe2, 
-	0xb8, 0xc4, 0x8a, 0xe5, 0xc0, 0xf4, 0x9a, 0xe5, 0xc8, 0x04, 0x9a, 0xe5, 0x00, 0x80, 0x88, 0xe0, 
-	0xe8, 0x14, 0xda, 0xe5, 0x01, 0x10, 0x81, 0xe2, 0xe8, 0x14, 0xca, 0xe5, 0x8f, 0x00, 0x51, 0xe3, 
-	0xc0, 0xf4, 0x9a, 0x45, 0x04, 0xc0, 0x8f, 0xe2, 0xb8, 0xc4, 0x8a, 0xe5, 0xc0, 0xf4, 0x9a, 0xe5, 
-	0x48, 0x00, 0x5a, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x0d, 0x00, 0x00, 0x1a, 0x47, 0x00, 0x5a, 0xe5, 
-	0x01, 0x00, 0x90, 0xe2, 0x47, 0x00, 0x4a, 0xe5, 0x08, 0x00, 0x50, 0xe3, 0x0b, 0x00, 0x00, 0xba, 
-	0x08, 0x00, 0x2d, 0xe9, 0x12, 0x0d, 0x8a, 0xe2, 0xf8, 0x0b, 0x80, 0xe8, 0x09, 0x00, 0xa0, 0xe1, 
-	0xc4, 0x14, 0x9a, 0xe5, 0x04, 0xe0, 0x8f, 0xe2, 0x68, 0xc5, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 
-	0x08, 0x00, 0xbd, 0xe8, 0x00, 0x00, 0xa0, 0xe3, 0x47, 0x00, 0x4a, 0xe5, 0x48, 0x00, 0x4a, 0xe5, 
-	0xd4, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe3, 0x0f, 0xe0, 0xa0, 0x11, 0x48, 0xf5, 0x9f, 0x15, 
-	0x3a, 0x0b, 0x00, 0xeb, 0xd8, 0x04, 0x9a, 0xe5, 0x01, 0x00, 0x80, 0xe2, 0xd8, 0x04, 0x8a, 0xe5, 
-	0x02, 0x00, 0x18, 0xe3, 0x0e, 0x00, 0x00, 0x0a, 0x06, 0x1c, 0x8a, 0xe2, 0x04, 0x10, 0x81, 0xe2, 
-	0x00, 0x00, 0x91, 0xe5, 0x24, 0x15, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0x94, 0x10, 0x8f, 0xe2, 
-	0x04, 0x1c, 0x81, 0xe2, 0x00, 0x00, 0xd1, 0xe5, 0x7c, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x80, 0xe3, 
-	0x00, 0x00, 0xc1, 0xe5, 0x0c, 0x00, 0x41, 0xe5, 0xa2, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x80, 0xe3, 
-	0xa2, 0x04, 0xca, 0xe5, 0x06, 0x0d, 0xa0, 0xe3, 0x00, 0x80, 0x88, 0xe0, 0x90, 0x10, 0xa0, 0xe3, 
-	0xe8, 0x14, 0xca, 0xe5, 0x04, 0xc0, 0x8f, 0xe2, 0xb8, 0xc4, 0x8a, 0xe5, 0x15, 0xed, 0xff, 0xea, 
-	0xc8, 0x04, 0x9a, 0xe5, 0x06, 0x0d, 0x40, 0xe2, 0x00, 0x80, 0x88, 0xe0, 0x04, 0xc0, 0x8f, 0xe2, 
-	0xb8, 0xc4, 0x8a, 0xe5, 0xc0, 0xf4, 0x9a, 0xe5, 0xc8, 0x04, 0x9a, 0xe5, 0x00, 0x80, 0x88, 0xe0, 
-	0xe8, 0x14, 0xda, 0xe5, 0x01, 0x10, 0x81, 0xe2, 0xe8, 0x14, 0xca, 0xe5, 0x99, 0x00, 0x51, 0xe3, 
-	0xc0, 0xf4, 0x9a, 0x45, 0x00, 0x80, 0x48, 0xe0, 0x01, 0x8c, 0x98, 0xe2, 0x04, 0xc0, 0x8f, 0xe2, 
-	0xb8, 0xc4, 0x8a, 0xe5, 0xc0, 0xf4, 0x9a, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0xe8, 0x04, 0xca, 0xe5, 
-	0xc8, 0x04, 0x9a, 0xe5, 0x01, 0x0c, 0x40, 0xe2, 0x00, 0x80, 0x88, 0xe0, 0x80, 0xc4, 0x9f, 0xe5, 
-	0xb8, 0xc4, 0x8a, 0xe5, 0xb4, 0x04, 0x9a, 0xe5, 0x01, 0x00, 0x80, 0xe2, 0xb4, 0x04, 0x8a, 0xe5, 
-	0xc0, 0xf4, 0x9a, 0xe5, 0xa1, 0x04, 0xda, 0xe5, 0xa2, 0x14, 0xda, 0xe5, 0x00, 0x10, 0x11, 0xe0, 
-	0x01, 0x00, 0x18, 0x13, 0x1e, 0xff, 0x2f, 0x01, 0x58, 0xf4, 0x9f, 0xe5, 0xea, 0x14, 0xda, 0xe5, 
-	0x00, 0x00, 0x51, 0xe3, 0x11, 0x00, 0x00, 0x0a, 0x4c, 0x14, 0x9f, 0xe5, 0x00, 0x20, 0xd1, 0xe5, 
-	0x01, 0x20, 0x42, 0xe2, 0x00, 0x20, 0xc1, 0xe5, 0x00, 0x00, 0x52, 0xe3, 0x0b, 0x00, 0x00, 0x1a, 
-	0xff, 0x5f, 0x2d, 0xe9, 0xea, 0x04, 0xda, 0xe5, 0x00, 0x02, 0xa0, 0xe1, 0x04, 0xe0, 0x8f, 0xe2, 
-	0x28, 0xc4, 0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0xe1, 0xff, 0x5f, 0xbd, 0xe8, 0x00, 0x20, 0xa0, 0xe3, 
-	0x14, 0x14, 0x9f, 0xe5, 0x00, 0x20, 0xc1, 0xe5, 0x14, 0x14, 0x9f, 0xe5, 0x00, 0x20, 0xc1, 0xe5, 
-	0x02, 0x00, 0x18, 0xe3, 0x14, 0x00, 0x00, 0x0a, 0xe8, 0x14, 0xda, 0xe5, 0xe9, 0x04, 0xda, 0xe5, 
-	0x01, 0x00, 0x50, 0xe1, 0xd7, 0x1f, 0x8f, 0xe2, 0x00, 0x00, 0xa0, 0xe1, 0x00, 0x00, 0xd1, 0xe5, 
-	0x04, 0x20, 0x80, 0x03, 0x04, 0x20, 0xc0, 0x13, 0x00, 0x00, 0x52, 0xe1, 0x00, 0x20, 0xc1, 0x15, 
-	0x0c, 0x20, 0x41, 0x15, 0x04, 0x00, 0x12, 0x13, 0x40, 0x00, 0x12, 0x13, 0x03, 0x00, 0x00, 0x1a, 
-	0x01, 0x00, 0x12, 0xe3, 0x04, 0x00, 0x00, 0x1a, 0x28, 0x00, 0x12, 0xe3, 0x02, 0x00, 0x00, 0x0a, 
-	0xa2, 0x04, 0xda, 0xe5, 0x02, 0x00, 0x80, 0xe3, 0xa2, 0x04, 0xca, 0xe5, 0xcc, 0x24, 0x9a, 0xe5, 
-	0xa8, 0x04, 0x9a, 0xe5, 0x02, 0x06, 0x80, 0xe0, 0xa8, 0x04, 0x8a, 0xe5, 0xb1, 0x14, 0xda, 0xe5, 
-	0x04, 0x00, 0x11, 0xe3, 0x0c, 0x00, 0x00, 0x0a, 0x03, 0x10, 0x11, 0xe2, 0x04, 0x10, 0xa0, 0x03, 
-	0x12, 0x00, 0xa0, 0xe3, 0x81, 0x10, 0x40, 0xe0, 0xac, 0x04, 0x9a, 0xe5, 0x12, 0x01, 0x90, 0xe0, 
-	0x04, 0x00, 0x00, 0x3a, 0xa2, 0x04, 0xda, 0xe5, 0x04, 0x00, 0x80, 0xe3, 0xa2, 0x04, 0xca, 0xe5, 
-	0xb0, 0x04, 0xda, 0xe5, 0x00, 0x0c, 0xa0, 0xe1, 0xac, 0x04, 0x8a, 0xe5, 0xb2, 0x14, 0xda, 0xe5, 
-	0x81, 0x10, 0x01, 0xe2, 0x81, 0x00, 0x51, 0xe3, 0xa2, 0x14, 0xda, 0x05, 0x08, 0x10, 0x81, 0x03, 
-	0xa2, 0x14, 0xca, 0x05, 0xb2, 0x04, 0xda, 0x05, 0x7f, 0x00, 0x00, 0x02, 0xb2, 0x04, 0xca, 0x05, 
-	0x01, 0x00, 0x18, 0xe3, 0xa7, 0xec, 0xff, 0x0a, 0xa1, 0x04, 0xda, 0xe5, 0xa2, 0x14, 0xda, 0xe5, 
-	0x01, 0x00, 0x10, 0xe0, 0xa3, 0xec, 0xff, 0x0a, 0x00, 0x20, 0xd9, 0xe5, 0x76, 0x00, 0x52, 0xe3, 
-	0x1c, 0x00, 0x00, 0x0a, 0xc8, 0xc4, 0x9a, 0xe5, 0x80, 0xc0, 0x4c, 0xe2, 0x0c, 0xc0, 0x58, 0xe0, 
-	0x19, 0x00, 0x00, 0x4a, 0x0c, 0x80, 0xa0, 0xe1, 0x68, 0x02, 0xdf, 0xe5, 0x02, 0x00, 0x80, 0xe3, 
-	0x60, 0x02, 0xcf, 0xe5, 0xb8, 0x04, 0x9a, 0xe5, 0xbc, 0x04, 0x8a, 0xe5, 0x04, 0x00, 0x8f, 0xe2, 
-	0xb8, 0x04, 0x8a, 0xe5, 0x93, 0xec, 0xff, 0xea, 0x48, 0x02, 0xdf, 0xe5, 0x02, 0x00, 0xc0, 0xe3, 
-	0x40, 0x02, 0xcf, 0xe5, 0xc8, 0x04, 0x9a, 0xe5, 0x80, 0x00, 0x80, 0xe2, 0x00, 0x80, 0x88, 0xe0, 
-	0xbc, 0x04, 0x9a, 0xe5, 0xb8, 0x04, 0x8a, 0xe5, 0x01, 0x00, 0x18, 0xe3, 0x89, 0xec, 0xff, 0x0a, 
-	0xa1, 0x04, 0xda, 0xe5, 0xa2, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe0, 0x85, 0xec, 0xff, 0x0a, 
-	0x00, 0x20, 0xd9, 0xe5, 0x76, 0x00, 0x52, 0xe3, 0x01, 0x90, 0x89, 0x02, 0x01, 0x80, 0xc8, 0xe3, 
-	0x01, 0x00, 0x10, 0xe3, 0x40, 0x20, 0xa0, 0x13, 0x01, 0x10, 0xc1, 0x13, 0x07, 0x00, 0x00, 0x1a, 
-	0x02, 0x00, 0x10, 0xe3, 0x48, 0x20, 0xa0, 0x13, 0x02, 0x10, 0xc1, 0x13, 0x03, 0x00, 0x00, 0x1a, 
-	0x04, 0x00, 0x10, 0xe3, 0x50, 0x20, 0xa0, 0x13, 0x04, 0x10, 0xc1, 0x13, 0x74, 0xf2, 0x9f, 0x05, 
-	0xa2, 0x14, 0xca, 0xe5, 0xc4, 0x04, 0x9a, 0xe5, 0x00, 0x00, 0x49, 0xe0, 0x02, 0x90, 0xa0, 0xe1, 
-	0x02, 0xb8, 0x5b, 0xe2, 0x0f, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0xcd, 0x92, 0xe7, 
-	0x2b, 0x08, 0xcc, 0x47, 0x01, 0x18, 0x9b, 0xe2, 0x20, 0x04, 0xa0, 0xe1, 0x21, 0x08, 0xcc, 0x47, 
-	0x0f, 0x1a, 0x09, 0xe2, 0x21, 0x05, 0x92, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 
-	0x06, 0x8d, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x90, 0x20, 0xa0, 0xe3, 0x0c, 0x00, 0x00, 0xea, 0xe8, 0x24, 0xda, 0xe5, 0x74, 0x01, 0xdf, 0xe5, 
-	0x01, 0x00, 0x10, 0xe3, 0x00, 0x20, 0xa0, 0x13, 0x07, 0x00, 0x00, 0x1a, 0xd0, 0x04, 0x9a, 0xe5, 
-	0x00, 0x00, 0x58, 0xe1, 0x02, 0x00, 0x00, 0x5a, 0x01, 0x20, 0x82, 0x42, 0x91, 0x00, 0x52, 0xe3, 
-	0x00, 0x00, 0x00, 0xea, 0x90, 0x00, 0x52, 0xe3, 0x00, 0x20, 0xa0, 0xa3, 0x24, 0x15, 0xda, 0xe5, 
-	0x01, 0x00, 0x52, 0xe0, 0x1e, 0xff, 0x2f, 0x01, 0xec, 0xff, 0xff, 0xda, 0xef, 0xc4, 0xda, 0xe5, 
-	0x0c, 0x00, 0x51, 0xe1, 0x14, 0x00, 0x00, 0xaa, 0x0c, 0x00, 0x52, 0xe1, 0x12, 0x00, 0x00, 0xba, 
-	0xe4, 0x14, 0xda, 0xe5, 0x20, 0x00, 0x11, 0xe3, 0x0f, 0x00, 0x00, 0x0a, 0xee, 0x14, 0xda, 0xe5, 
-	0xa6, 0x00, 0x51, 0xe3, 0x0c, 0x00, 0x00, 0xca, 0x24, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x4c, 0xe0, 
-	0x04, 0x50, 0x2d, 0xe9, 0x08, 0x00, 0x00, 0xeb, 0xee, 0x14, 0xda, 0xe5, 0x07, 0x00, 0x51, 0xe3, 
-	0x01, 0x00, 0x00, 0xca, 0x31, 0xf8, 0xff, 0xeb, 0x00, 0x00, 0x50, 0xe1, 0xd4, 0xf7, 0xff, 0xcb, 
-	0x04, 0x50, 0xbd, 0xe8, 0x0c, 0x00, 0x52, 0xe0, 0x1e, 0xff, 0x2f, 0x01, 0x24, 0x25, 0xca, 0xe5, 
-	0x2a, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x51, 0xe3, 0x4a, 0xf8, 0xff, 0xca, 0x20, 0xc5, 0x9a, 0xb5, 
-	0x00, 0xc8, 0x4c, 0xb0, 0x20, 0xc5, 0x8a, 0xb5, 0xf8, 0x41, 0x2d, 0xe9, 0x05, 0xcc, 0x8a, 0xe2, 
-	0x1e, 0x00, 0x9c, 0xe8, 0x04, 0x50, 0xa0, 0xe1, 0x04, 0x60, 0xa0, 0xe1, 0x04, 0x70, 0xa0, 0xe1, 
-	0x30, 0x85, 0x9a, 0xe5, 0xff, 0x04, 0x18, 0xe3, 0x05, 0x00, 0x00, 0x0a, 0x08, 0x30, 0xc3, 0xe1, 
-	0x34, 0x85, 0x9a, 0xe5, 0x08, 0x30, 0x83, 0xe1, 0xff, 0x0c, 0x18, 0xe3, 0x38, 0x65, 0x9a, 0x15, 
-	0x3c, 0x75, 0x9a, 0xe5, 0x00, 0x80, 0xa0, 0xe1, 0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 
-	0x08, 0x00, 0x00, 0x0a, 0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 0x05, 0x00, 0x00, 0x0a, 
-	0xfc, 0x00, 0xa1, 0xe8, 0x01, 0x00, 0x50, 0xe2, 0x02, 0x00, 0x00, 0x0a, 0xfc, 0x00, 0xa1, 0xe8, 
-	0x01, 0x00, 0x50, 0xe2, 0xf3, 0xff, 0xff, 0x1a, 0x00, 0x15, 0x8a, 0xe5, 0x05, 0xcc, 0x8a, 0xe2, 
-	0x14, 0xc0, 0x8c, 0xe2, 0x1c, 0x25, 0x9a, 0xe5, 0x4d, 0xf8, 0xff, 0xeb, 0x1c, 0x25, 0x8a, 0xe5, 
-	0xf8, 0x81, 0xbd, 0xe8, 0x2c, 0x10, 0xdf, 0xe5, 0x07, 0x20, 0x01, 0xe2, 0x78, 0x00, 0x00, 0xe2, 
-	0x02, 0x20, 0x80, 0xe1, 0x01, 0x00, 0x32, 0xe0, 0x1e, 0xff, 0x2f, 0x01, 0x14, 0x20, 0xcf, 0xe5, 
-	0x04, 0x20, 0xcf, 0xe5, 0x19, 0x00, 0x00, 0xea, 0x15, 0x8e, 0x48, 0xe2, 0x01, 0x00, 0xa0, 0xe3, 
-	0x06, 0x00, 0x00, 0xea, 0x15, 0x8e, 0x48, 0xe2, 0x01, 0x00, 0xa0, 0xe3, 0x33, 0x0d, 0x58, 0xe3, 
-	0x02, 0x00, 0x00, 0xba, 0x03, 0x00, 0x80, 0xe3, 0x5e, 0x0d, 0x58, 0xe3, 0x01, 0x00, 0xc0, 0xa3, 
-	0x10, 0x16, 0x9a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 0x14, 0xf6, 0x9a, 0x05, 0x18, 0x16, 0x9a, 0xe5, 
-	0x01, 0x00, 0x59, 0xe1, 0x1c, 0xf6, 0x9a, 0x05, 0x20, 0x16, 0x9a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 
-	0x24, 0xf6, 0x9a, 0x05, 0x28, 0x16, 0x9a, 0xe5, 0x01, 0x00, 0x59, 0xe1, 0x2c, 0xf6, 0x9a, 0x05, 
-	0x54, 0xf0, 0x9f, 0xe5, 0xe9, 0x04, 0xda, 0xe5, 0x0e, 0xf0, 0xa0, 0xe1, 0xe9, 0x04, 0xca, 0xe5, 
-	0xe8, 0x14, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe1, 0x68, 0x00, 0x5f, 0xe5, 0x04, 0x20, 0x80, 0x03, 
-	0x04, 0x20, 0xc0, 0x13, 0x74, 0x20, 0x4f, 0xe5, 0x84, 0x20, 0x4f, 0xe5, 0x1e, 0xff, 0x2f, 0x11, 
-	0x28, 0xf0, 0x9f, 0xe5, 0x64, 0x5b, 0x00, 0x08, 0x6d, 0x1c, 0x00, 0x08, 0x8c, 0x46, 0x00, 0x08, 
-	0xa4, 0x3e, 0x00, 0x03, 0x18, 0xf5, 0x00, 0x06, 0x58, 0x4a, 0x00, 0x08, 0x97, 0x56, 0x00, 0x03, 
-	0x05, 0xf1, 0x00, 0x06, 0x52, 0x56, 0x00, 0x03, 0x8c, 0x4a, 0x00, 0x08, 0x88, 0x60, 0x00, 0x08, 
-	0x9c, 0x63, 0x00, 0x08, 0xc4, 0x15, 0x9a, 0xe5, 0x21, 0x07, 0x00, 0xe0, 0x88, 0x05, 0x8a, 0xe5, 
-	0x54, 0x10, 0x9f, 0xe5, 0x00, 0x01, 0x91, 0xe7, 0x01, 0x09, 0x50, 0xe2, 0x50, 0x04, 0x8a, 0xe5, 
-	0x54, 0x04, 0x8a, 0xe5, 0x58, 0x04, 0x8a, 0xe5, 0x5c, 0x04, 0x8a, 0xe5, 0xc4, 0x14, 0x9a, 0xe5, 
-	0x01, 0x90, 0x49, 0xe0, 0x0f, 0x1a, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 0x21, 0x05, 0x92, 0xe7, 
-	0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0xe0, 0x0e, 0xf0, 0xa0, 0xe1, 0x8c, 0x05, 0x8a, 0xe5, 
-	0x18, 0x10, 0x9f, 0xe5, 0xc8, 0x25, 0x9a, 0xe5, 0x80, 0x06, 0x02, 0xe0, 0x00, 0x00, 0x81, 0xe0, 
-	0x68, 0x04, 0x8a, 0xe5, 0x6c, 0x04, 0x8a, 0xe5, 0xef, 0xff, 0xff, 0xea, 0x18, 0x92, 0x02, 0x02, 
-	0x00, 0xe0, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x88, 0x3d, 0x00, 0x03, 0x88, 0x3d, 0x00, 0x03, 0xf0, 0x44, 0x00, 0x03, 0xe4, 0x44, 0x00, 0x03, 
-	0xd8, 0x44, 0x00, 0x03, 0xd8, 0x44, 0x00, 0x03, 0xcc, 0x44, 0x00, 0x03, 0xcc, 0x44, 0x00, 0x03, 
-	0xc0, 0x44, 0x00, 0x03, 0xc0, 0x44, 0x00, 0x03, 0xb4, 0x44, 0x00, 0x03, 0xb4, 0x44, 0x00, 0x03, 
-	0xa8, 0x44, 0x00, 0x03, 0xa8, 0x44, 0x00, 0x03, 0x9c, 0x44, 0x00, 0x03, 0x9c, 0x44, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x68, 0x00, 0x00, 0x03, 
-	0x7c, 0x00, 0x00, 0x03, 0xa4, 0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x03, 
-	0x0c, 0x01, 0x00, 0x03, 0x54, 0x01, 0x00, 0x03, 0x80, 0x01, 0x00, 0x03, 0xa4, 0x01, 0x00, 0x03, 
-	0xb8, 0x01, 0x00, 0x03, 0xe8, 0x01, 0x00, 0x03, 0x1c, 0x02, 0x00, 0x03, 0x38, 0x02, 0x00, 0x03, 
-	0x70, 0x3b, 0x00, 0x08, 0x5c, 0x02, 0x00, 0x03, 0x7c, 0x02, 0x00, 0x03, 0xa4, 0x02, 0x00, 0x03, 
-	0xb8, 0x02, 0x00, 0x03, 0xe0, 0x02, 0x00, 0x03, 0x0c, 0x03, 0x00, 0x03, 0x28, 0x03, 0x00, 0x03, 
-	0x4c, 0x03, 0x00, 0x03, 0x84, 0x03, 0x00, 0x03, 0xb0, 0x03, 0x00, 0x03, 0xd4, 0x03, 0x00, 0x03, 
-	0xe8, 0x03, 0x00, 0x03, 0x18, 0x04, 0x00, 0x03, 0x4c, 0x04, 0x00, 0x03, 0x68, 0x04, 0x00, 0x03, 
-	0x90, 0x04, 0x00, 0x03, 0x1c, 0x05, 0x00, 0x03, 0x3c, 0x05, 0x00, 0x03, 0x68, 0x05, 0x00, 0x03, 
-	0x7c, 0x05, 0x00, 0x03, 0xa4, 0x05, 0x00, 0x03, 0xd0, 0x05, 0x00, 0x03, 0x98, 0x3b, 0x00, 0x08, 
-	0xec, 0x05, 0x00, 0x03, 0x34, 0x06, 0x00, 0x03, 0x58, 0x06, 0x00, 0x03, 0x80, 0x06, 0x00, 0x03, 
-	0x94, 0x06, 0x00, 0x03, 0xc4, 0x06, 0x00, 0x03, 0xf8, 0x06, 0x00, 0x03, 0x14, 0x07, 0x00, 0x03, 
-	0x2c, 0x07, 0x00, 0x03, 0x74, 0x07, 0x00, 0x03, 0x94, 0x07, 0x00, 0x03, 0xc0, 0x07, 0x00, 0x03, 
-	0xd4, 0x07, 0x00, 0x03, 0x1c, 0x08, 0x00, 0x03, 0x64, 0x08, 0x00, 0x03, 0x8c, 0x08, 0x00, 0x03, 
-	0xa4, 0x08, 0x00, 0x03, 0xec, 0x08, 0x00, 0x03, 0x18, 0x09, 0x00, 0x03, 0xf4, 0x3b, 0x00, 0x08, 
-	0x40, 0x09, 0x00, 0x03, 0x64, 0x09, 0x00, 0x03, 0x8c, 0x09, 0x00, 0x03, 0xa4, 0x09, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0xbc, 0x09, 0x00, 0x03, 0xd4, 0x09, 0x00, 0x03, 0xf0, 0x09, 0x00, 0x03, 
-	0x08, 0x0a, 0x00, 0x03, 0x24, 0x0a, 0x00, 0x03, 0x3c, 0x0a, 0x00, 0x03, 0x64, 0x0a, 0x00, 0x03, 
-	0x7c, 0x0a, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x94, 0x0a, 0x00, 0x03, 0xb0, 0x0a, 0x00, 0x03, 
-	0xcc, 0x0a, 0x00, 0x03, 0xe8, 0x0a, 0x00, 0x03, 0x04, 0x0b, 0x00, 0x03, 0x2c, 0x0b, 0x00, 0x03, 
-	0x44, 0x0b, 0x00, 0x03, 0x60, 0x0b, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x78, 0x0b, 0x00, 0x03, 
-	0x90, 0x0b, 0x00, 0x03, 0xac, 0x0b, 0x00, 0x03, 0xc4, 0x0b, 0x00, 0x03, 0xec, 0x0b, 0x00, 0x03, 
-	0x04, 0x0c, 0x00, 0x03, 0x20, 0x0c, 0x00, 0x03, 0x3c, 0x0c, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0x54, 0x0c, 0x00, 0x03, 0x70, 0x0c, 0x00, 0x03, 0x8c, 0x0c, 0x00, 0x03, 0xb4, 0x0c, 0x00, 0x03, 
-	0xcc, 0x0c, 0x00, 0x03, 0xe8, 0x0c, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x03, 0x1c, 0x0d, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0x34, 0x0d, 0x00, 0x03, 0x4c, 0x0d, 0x00, 0x03, 0x74, 0x0d, 0x00, 0x03, 
-	0x8c, 0x0d, 0x00, 0x03, 0xa8, 0x0d, 0x00, 0x03, 0xc4, 0x0d, 0x00, 0x03, 0xe0, 0x0d, 0x00, 0x03, 
-	0xfc, 0x0d, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x14, 0x0e, 0x00, 0x03, 0x3c, 0x0e, 0x00, 0x03, 
-	0x54, 0x0e, 0x00, 0x03, 0x7c, 0x0e, 0x00, 0x03, 0xa8, 0x0e, 0x00, 0x03, 0xd0, 0x0e, 0x00, 0x03, 
-	0x08, 0x3c, 0x00, 0x08, 0x30, 0x3c, 0x00, 0x08, 0xfc, 0x0e, 0x00, 0x03, 0x2c, 0x0f, 0x00, 0x03, 
-	0x54, 0x0f, 0x00, 0x03, 0x68, 0x0f, 0x00, 0x03, 0x7c, 0x0f, 0x00, 0x03, 0x90, 0x0f, 0x00, 0x03, 
-	0xa4, 0x0f, 0x00, 0x03, 0xb8, 0x0f, 0x00, 0x03, 0xcc, 0x0f, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0xf0, 0x0f, 0x00, 0x03, 0x1c, 0x10, 0x00, 0x03, 0x44, 0x10, 0x00, 0x03, 0x70, 0x10, 0x00, 0x03, 
-	0x98, 0x10, 0x00, 0x03, 0xc4, 0x10, 0x00, 0x03, 0xec, 0x10, 0x00, 0x03, 0x24, 0x11, 0x00, 0x03, 
-	0x44, 0x11, 0x00, 0x03, 0x78, 0x11, 0x00, 0x03, 0xb0, 0x11, 0x00, 0x03, 0xe4, 0x11, 0x00, 0x03, 
-	0x1c, 0x12, 0x00, 0x03, 0x50, 0x12, 0x00, 0x03, 0x88, 0x12, 0x00, 0x03, 0xc8, 0x12, 0x00, 0x03, 
-	0xf0, 0x12, 0x00, 0x03, 0x20, 0x13, 0x00, 0x03, 0x4c, 0x13, 0x00, 0x03, 0x7c, 0x13, 0x00, 0x03, 
-	0xa8, 0x13, 0x00, 0x03, 0xd8, 0x13, 0x00, 0x03, 0x04, 0x14, 0x00, 0x03, 0x40, 0x14, 0x00, 0x03, 
-	0x58, 0x14, 0x00, 0x03, 0x94, 0x14, 0x00, 0x03, 0xcc, 0x14, 0x00, 0x03, 0x08, 0x15, 0x00, 0x03, 
-	0x40, 0x15, 0x00, 0x03, 0x7c, 0x15, 0x00, 0x03, 0xb4, 0x15, 0x00, 0x03, 0xfc, 0x15, 0x00, 0x03, 
-	0x20, 0x16, 0x00, 0x03, 0x3c, 0x16, 0x00, 0x03, 0x58, 0x16, 0x00, 0x03, 0x74, 0x16, 0x00, 0x03, 
-	0x90, 0x16, 0x00, 0x03, 0xac, 0x16, 0x00, 0x03, 0xc8, 0x16, 0x00, 0x03, 0xf4, 0x16, 0x00, 0x03, 
-	0x10, 0x17, 0x00, 0x03, 0x30, 0x17, 0x00, 0x03, 0x4c, 0x17, 0x00, 0x03, 0x6c, 0x17, 0x00, 0x03, 
-	0x88, 0x17, 0x00, 0x03, 0xa8, 0x17, 0x00, 0x03, 0xc4, 0x17, 0x00, 0x03, 0xf0, 0x17, 0x00, 0x03, 
-	0x08, 0x18, 0x00, 0x03, 0x28, 0x18, 0x00, 0x03, 0x44, 0x18, 0x00, 0x03, 0x64, 0x18, 0x00, 0x03, 
-	0x80, 0x18, 0x00, 0x03, 0xa0, 0x18, 0x00, 0x03, 0xbc, 0x18, 0x00, 0x03, 0xe8, 0x18, 0x00, 0x03, 
-	0x04, 0x19, 0x00, 0x03, 0x34, 0x19, 0x00, 0x03, 0x60, 0x19, 0x00, 0x03, 0x90, 0x19, 0x00, 0x03, 
-	0xbc, 0x19, 0x00, 0x03, 0xec, 0x19, 0x00, 0x03, 0x18, 0x1a, 0x00, 0x03, 0x58, 0x3c, 0x00, 0x08, 
-	0x54, 0x1a, 0x00, 0x03, 0x6c, 0x1a, 0x00, 0x03, 0xa0, 0x1a, 0x00, 0x03, 0xd4, 0x1a, 0x00, 0x03, 
-	0x14, 0x1b, 0x00, 0x03, 0x30, 0x1b, 0x00, 0x03, 0x6c, 0x1b, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0xe8, 0x1b, 0x00, 0x03, 0x04, 0x1c, 0x00, 0x03, 0x48, 0x1c, 0x00, 0x03, 0x80, 0x21, 0x00, 0x03, 
-	0x70, 0x1c, 0x00, 0x03, 0x8c, 0x1c, 0x00, 0x03, 0xe0, 0x1c, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x14, 0x1d, 0x00, 0x03, 0x2c, 0x1d, 0x00, 0x03, 0x60, 0x1d, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0x88, 0x1d, 0x00, 0x03, 0xa4, 0x1d, 0x00, 0x03, 0xe0, 0x1d, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x10, 0x1e, 0x00, 0x03, 0x0c, 0x21, 0x00, 0x03, 0x28, 0x1e, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0x50, 0x1e, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x6c, 0x1e, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0xa0, 0x3f, 0x00, 0x03, 0xa8, 0x1e, 0x00, 0x03, 0xd8, 0x3f, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0xdc, 0x1e, 0x00, 0x03, 0x18, 0x1f, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x38, 0x1f, 0x00, 0x03, 0x68, 0x1f, 0x00, 0x03, 0x8c, 0x1f, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0xbc, 0x1f, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x24, 0x3d, 0x00, 0x03, 0xdc, 0x1f, 0x00, 0x03, 0x54, 0x3d, 0x00, 0x03, 0x1c, 0x20, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0x30, 0x20, 0x00, 0x03, 0x7c, 0x20, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x9c, 0x20, 0x00, 0x03, 0xcc, 0x20, 0x00, 0x03, 0xe0, 0x20, 0x00, 0x03, 0x44, 0x21, 0x00, 0x03, 
-	0x10, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 0x50, 0x21, 0x00, 0x03, 0x98, 0x1b, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 0x90, 0x44, 0x00, 0x03, 
-	0xd8, 0x3a, 0x00, 0x03, 0x10, 0x3b, 0x00, 0x03, 0x08, 0x45, 0x00, 0x03, 0x08, 0x45, 0x00, 0x03, 
-	0x14, 0x45, 0x00, 0x03, 0x24, 0x45, 0x00, 0x03, 0x14, 0x40, 0x00, 0x03, 0x14, 0x40, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x99, 0x02, 0x02, 0x08, 0xbc, 0x02, 0x02, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x48, 0xac, 0x02, 0x02, 0x88, 0x9c, 0x02, 0x02, 0x88, 0xae, 0x02, 0x02, 
-	0xc8, 0x9e, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbd, 0x02, 0x02, 0xa8, 0xbc, 0x02, 0x02, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x50, 0x46, 0x00, 0x00, 0x50, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x50, 0x00, 0x03, 0xf4, 0x4f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x04, 0xf0, 0x1f, 0xe5, 0x8c, 0xf6, 0x00, 0x06, 0x04, 0xf0, 0x1f, 0xe5, 0x60, 0x50, 0x00, 0x08, 
-	0x04, 0xf0, 0x1f, 0xe5, 0x70, 0x50, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x8f, 0x00, 0x08, 
-	0x29, 0x8f, 0x00, 0x08, 0x00, 0xe0, 0x00, 0x00, 0xf8, 0xb5, 0x98, 0x23, 0x1b, 0x02, 0x98, 0x42, 
-	0x28, 0xda, 0x3f, 0x26, 0x1f, 0x4b, 0xc0, 0x18, 0x1f, 0x4b, 0x05, 0x11, 0x1c, 0x68, 0xc3, 0x17, 
-	0x42, 0x18, 0x33, 0x40, 0xe9, 0x0f, 0x5b, 0x19, 0x49, 0x19, 0x01, 0x25, 0x1f, 0x27, 0x6d, 0x42, 
-	0x28, 0x00, 0x0f, 0x32, 0x12, 0x11, 0x49, 0x10, 0x01, 0x32, 0x39, 0x40, 0x88, 0x40, 0xd1, 0x17, 
-	0x31, 0x40, 0xd6, 0x0f, 0x89, 0x18, 0xb2, 0x18, 0x52, 0x10, 0x3a, 0x40, 0x95, 0x40, 0x9b, 0x11, 
-	0x9a, 0x00, 0xa6, 0x18, 0xed, 0x43, 0x37, 0x68, 0x89, 0x11, 0x8b, 0x42, 0x05, 0xd1, 0x28, 0x40, 
-	0x38, 0x43, 0x30, 0x60, 0xf8, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x38, 0x43, 0x30, 0x60, 0x00, 0x26, 
-	0x8b, 0x42, 0x02, 0xda, 0xc9, 0x1a, 0x01, 0x39, 0x8e, 0x00, 0x17, 0x1d, 0x32, 0x00, 0xf6, 0x19, 
-	0xe0, 0x19, 0xff, 0x21, 0xa4, 0x19, 0x00, 0xf0, 0x0f, 0xfc, 0x23, 0x68, 0x2b, 0x43, 0x23, 0x60, 
-	0xe8, 0xe7, 0xc0, 0x46, 0x00, 0x80, 0xff, 0xff, 0x60, 0x56, 0x00, 0x03, 0xf7, 0xb5, 0x17, 0x4a, 
-	0x53, 0x68, 0x01, 0x93, 0x16, 0x4b, 0x95, 0x68, 0x1b, 0x68, 0x9c, 0x46, 0x00, 0x2d, 0x0d, 0xd1, 
-	0x14, 0x4b, 0xd5, 0x60, 0x1d, 0x80, 0x14, 0x4b, 0x51, 0x60, 0x20, 0x31, 0x19, 0x60, 0x10, 0x4b, 
-	0x90, 0x60, 0x20, 0x30, 0x18, 0x60, 0xf7, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0xd3, 0x68, 0x17, 0x2b, 
-	0x11, 0xdc, 0x67, 0x46, 0x0b, 0x4e, 0xdc, 0x00, 0xa5, 0x53, 0x34, 0x19, 0x7d, 0x1b, 0x65, 0x80, 
-	0x01, 0x9d, 0x01, 0x33, 0x65, 0x60, 0xd3, 0x60, 0x00, 0x28, 0xe4, 0xd1, 0x18, 0x2b, 0xe2, 0xd0, 
-	0xdb, 0x00, 0x98, 0x53, 0xdf, 0xe7, 0xdb, 0x46, 0xdd, 0xe7, 0xc0, 0x46, 0x4c, 0x78, 0x00, 0x03, 
-	0x70, 0x57, 0x00, 0x03, 0x5c, 0x98, 0x02, 0x02, 0x74, 0x57, 0x00, 0x03, 0xf0, 0xb5, 0x06, 0x00, 
-	0x8b, 0xb0, 0x00, 0x2e, 0x03, 0xdc, 0x0b, 0xb0, 0xf0, 0xbc, 0x01, 0xbc, 0x00, 0x47, 0x80, 0x21, 
-	0x9f, 0x4b, 0x1b, 0x88, 0xf0, 0x18, 0x42, 0x1e, 0x09, 0x02, 0x8b, 0x42, 0x00, 0xda, 0x8b, 0xe0, 
-	0xf0, 0x21, 0x09, 0x02, 0x0a, 0x40, 0x19, 0x0b, 0x09, 0x03, 0x00, 0x24, 0x05, 0x94, 0x8a, 0x42, 
-	0x02, 0xd0, 0x81, 0x1a, 0x05, 0x91, 0xd6, 0x1a, 0xf8, 0x20, 0x96, 0x4a, 0x15, 0x88, 0x71, 0x19, 
-	0x00, 0x02, 0x4a, 0x1e, 0x02, 0x40, 0xe8, 0x0a, 0xc0, 0x02, 0x82, 0x42, 0x04, 0xd0, 0x05, 0x98, 
-	0x89, 0x1a, 0x41, 0x18, 0x05, 0x91, 0x56, 0x1b, 0x8f, 0x4a, 0x90, 0x48, 0x19, 0x13, 0x89, 0x00, 
-	0x89, 0x58, 0x00, 0x78, 0xc9, 0x18, 0x02, 0x28, 0x00, 0xd0, 0xf5, 0xe0, 0x28, 0x13, 0x80, 0x00, 
-	0x80, 0x58, 0x80, 0x22, 0x40, 0x19, 0x12, 0x02, 0x95, 0x42, 0x00, 0xd0, 0xf3, 0xe0, 0x88, 0x4c, 
-	0x22, 0x68, 0x9a, 0x42, 0x00, 0xd0, 0xfb, 0xe0, 0x00, 0x21, 0x08, 0x00, 0xff, 0xf7, 0x7e, 0xff, 
-	0x84, 0x4b, 0x85, 0x4a, 0x1b, 0x78, 0x01, 0x92, 0x00, 0x2b, 0x01, 0xd1, 0x83, 0x4b, 0x01, 0x93, 
-	0x01, 0x9b, 0x20, 0x68, 0x1c, 0x00, 0xc0, 0x34, 0x19, 0x88, 0x00, 0x29, 0x07, 0xd0, 0x5a, 0x88, 
-	0x52, 0x18, 0x81, 0x42, 0x46, 0xd2, 0xdb, 0x46, 0x00, 0x23, 0x01, 0x9a, 0x13, 0x80, 0x00, 0x23, 
-	0x7b, 0x4f, 0x04, 0x93, 0x04, 0x9b, 0xdb, 0x00, 0xfb, 0x5a, 0x00, 0x2b, 0x04, 0xd0, 0x04, 0x9b, 
-	0x01, 0x33, 0x04, 0x93, 0x18, 0x2b, 0xf5, 0xd1, 0x00, 0x25, 0x01, 0x9a, 0xeb, 0x00, 0xd3, 0x5a, 
-	0x00, 0x2b, 0x02, 0xd0, 0x01, 0x35, 0x18, 0x2d, 0xf7, 0xd1, 0x00, 0x22, 0x71, 0x4b, 0x06, 0x92, 
-	0x1a, 0x60, 0x02, 0x92, 0x06, 0x9b, 0x04, 0x9a, 0x93, 0x42, 0x28, 0xd1, 0x17, 0x2d, 0x03, 0xdc, 
-	0x00, 0x23, 0x01, 0x9a, 0xed, 0x00, 0xab, 0x52, 0x6a, 0x4b, 0x1b, 0x68, 0x17, 0x2b, 0x03, 0xdc, 
-	0x00, 0x21, 0x69, 0x4a, 0xdb, 0x00, 0x99, 0x52, 0x5d, 0x49, 0x33, 0x04, 0x0a, 0x88, 0x1b, 0x0c, 
-	0x9a, 0x18, 0x0a, 0x80, 0x5b, 0x4a, 0x11, 0x88, 0x5b, 0x18, 0xdb, 0x04, 0x63, 0x49, 0xdb, 0x0c, 
-	0x0b, 0x43, 0x13, 0x80, 0x05, 0x9e, 0x64, 0xe7, 0xc0, 0x24, 0x99, 0x0b, 0x24, 0x02, 0x89, 0x03, 
-	0x22, 0x40, 0x72, 0xe7, 0x08, 0x33, 0xa3, 0x42, 0xb9, 0xd0, 0x10, 0x00, 0xac, 0xe7, 0x02, 0x9b, 
-	0xdc, 0x00, 0x01, 0x9b, 0x1c, 0x19, 0x02, 0x9b, 0x08, 0x93, 0x9d, 0x42, 0x05, 0xdc, 0x3b, 0x00, 
-	0x01, 0x35, 0x03, 0xcb, 0x03, 0xc4, 0x38, 0x00, 0x4d, 0xe0, 0x22, 0x68, 0x3b, 0x68, 0x9a, 0x42, 
-	0x0f, 0xd1, 0x7b, 0x68, 0x62, 0x68, 0x9a, 0x42, 0x03, 0xd0, 0x20, 0x00, 0x63, 0x60, 0x00, 0xf0, 
-	0xfb, 0xfa, 0x02, 0x9b, 0x01, 0x33, 0x02, 0x93, 0x06, 0x9b, 0x01, 0x33, 0x06, 0x93, 0x08, 0x37, 
-	0xb0, 0xe7, 0x3a, 0x88, 0x7b, 0x88, 0x9b, 0x18, 0x9c, 0x46, 0x02, 0x98, 0x21, 0x88, 0x63, 0x88, 
-	0x01, 0x30, 0x03, 0x90, 0x5b, 0x18, 0x8c, 0x45, 0x30, 0xdd, 0x93, 0x42, 0x50, 0xdd, 0x08, 0x9b, 
-	0xdb, 0x00, 0x09, 0x93, 0x09, 0x99, 0x01, 0x9b, 0x59, 0x18, 0x03, 0x00, 0x02, 0x90, 0x07, 0x93, 
-	0x07, 0x9b, 0xab, 0x42, 0x38, 0xdb, 0x07, 0x9a, 0x08, 0x9b, 0xd3, 0x1a, 0x5a, 0x1e, 0x07, 0x92, 
-	0x01, 0x2b, 0x13, 0xd0, 0x03, 0x9b, 0xea, 0x1a, 0x07, 0x9b, 0xd2, 0x1a, 0x00, 0x2a, 0x0b, 0xdd, 
-	0x9c, 0x46, 0x03, 0x99, 0x09, 0x98, 0x01, 0x9b, 0x61, 0x44, 0xc9, 0x00, 0x08, 0x30, 0xd2, 0x00, 
-	0x59, 0x18, 0x18, 0x18, 0x00, 0xf0, 0xc8, 0xfa, 0x07, 0x9b, 0xed, 0x1a, 0x23, 0x00, 0x3a, 0x00, 
-	0x03, 0xca, 0x03, 0xc3, 0x20, 0x00, 0x00, 0xf0, 0xb7, 0xfa, 0xbd, 0xe7, 0x93, 0x42, 0x1f, 0xdd, 
-	0x02, 0x9b, 0xea, 0x1a, 0x03, 0x9b, 0xd8, 0x00, 0x01, 0x9b, 0x21, 0x00, 0xd2, 0x00, 0x18, 0x18, 
-	0x00, 0xf0, 0xb2, 0xfa, 0x23, 0x00, 0x3a, 0x00, 0x03, 0xca, 0x03, 0xc3, 0x20, 0x00, 0x00, 0xf0, 
-	0xa3, 0xfa, 0x01, 0x35, 0x03, 0x9b, 0xa6, 0xe7, 0x0b, 0x89, 0x08, 0x00, 0x9c, 0x45, 0xc2, 0xdd, 
-	0x40, 0x89, 0xc0, 0x18, 0x08, 0x31, 0x82, 0x42, 0xbd, 0xda, 0x07, 0x9b, 0x01, 0x33, 0xb6, 0xe7, 
-	0x03, 0x9b, 0x08, 0x34, 0x02, 0x93, 0x7e, 0xe7, 0x01, 0x28, 0x00, 0xd1, 0x5c, 0xe7, 0x2b, 0x13, 
-	0x9b, 0x00, 0x98, 0x58, 0x40, 0x19, 0x98, 0x23, 0x1b, 0x02, 0x9d, 0x42, 0x08, 0xdb, 0x14, 0x4b, 
-	0x14, 0x4a, 0xeb, 0x18, 0x5b, 0x11, 0x9b, 0x18, 0x32, 0x00, 0x00, 0xf0, 0x9b, 0xfa, 0x4b, 0xe7, 
-	0x32, 0x00, 0x00, 0xf0, 0x91, 0xfa, 0x31, 0x00, 0x28, 0x00, 0xff, 0xf7, 0x35, 0xfe, 0x43, 0xe7, 
-	0x5c, 0x56, 0x00, 0x03, 0x5e, 0x56, 0x00, 0x03, 0xa8, 0x55, 0x00, 0x03, 0xeb, 0x56, 0x00, 0x03, 
-	0x04, 0x00, 0x00, 0x02, 0x5b, 0x56, 0x00, 0x03, 0xdc, 0x96, 0x02, 0x02, 0x9c, 0x97, 0x02, 0x02, 
-	0x5c, 0x98, 0x02, 0x02, 0x4c, 0x78, 0x00, 0x03, 0x18, 0x96, 0x02, 0x02, 0x00, 0x80, 0xff, 0xff, 
-	0x00, 0x68, 0xff, 0xff, 0x9c, 0x99, 0x02, 0x02, 0x07, 0x04, 0xa0, 0xe1, 0x02, 0x02, 0x13, 0xe3, 
-	0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0xe0, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 
-	0xff, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
-	0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x05, 0x04, 0xa0, 0xe1, 0x23, 0x3f, 0xb0, 0xe1, 
-	0x60, 0x00, 0xa0, 0xe1, 0x02, 0x05, 0x10, 0xe3, 0x02, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 
-	0x01, 0x31, 0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 0x20, 0x54, 0x85, 0xe1, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0xa6, 0x0c, 0xb0, 0xe1, 
-	0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x68, 0x06, 0xe2, 0x00, 0x6c, 0x86, 0xe1, 
-	0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0xa7, 0x0c, 0xb0, 0xe1, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x32, 0x03, 0xe2, 0xff, 0x78, 0x07, 0xe2, 
-	0x00, 0x7c, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 
-	0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x15, 0xe1, 0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 
-	0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x01, 0x1c, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x02, 0x32, 0x03, 0xe2, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x16, 0xe1, 
-	0x01, 0x31, 0x83, 0x03, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
-	0xb8, 0xf4, 0x9a, 0xe5, 0x27, 0xc8, 0xa0, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 0xe0, 0x8f, 0xe2, 
-	0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x28, 0xa0, 0xe1, 0x01, 0x00, 0x59, 0xe5, 0x01, 0x18, 0xa0, 0xe3, 
-	0xa0, 0x01, 0xa0, 0xe1, 0x07, 0x00, 0x00, 0xe2, 0x11, 0x20, 0x82, 0xe1, 0x22, 0x08, 0xa0, 0xe1, 
-	0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0xe2, 0x00, 0xe0, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 
-	0x01, 0x8c, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 
-	0x12, 0x2d, 0x8a, 0xe2, 0xf8, 0x0b, 0x82, 0xe8, 0xe6, 0x05, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe3, 
-	0x05, 0x00, 0x00, 0x1a, 0xb4, 0x04, 0x9a, 0xe5, 0xec, 0x15, 0x9a, 0xe5, 0x01, 0x00, 0x50, 0xe1, 
-	0x01, 0x00, 0x00, 0xba, 0x0f, 0xe0, 0xa0, 0xe1, 0xe8, 0xf2, 0x9f, 0xe5, 0xe8, 0x12, 0x9f, 0xe5, 
-	0xb0, 0x00, 0xd1, 0xe1, 0xff, 0x00, 0x20, 0xe2, 0x03, 0x0c, 0x20, 0xe2, 0xdc, 0x14, 0x9a, 0xe5, 
-	0x00, 0x10, 0x21, 0xe0, 0x00, 0x10, 0x01, 0xe0, 0xdc, 0x04, 0x8a, 0xe5, 0xfc, 0x25, 0xda, 0xe5, 
-	0x00, 0x00, 0x52, 0xe3, 0xf8, 0x4f, 0xbd, 0x08, 0x1e, 0xff, 0x2f, 0x01, 0x60, 0xe0, 0x8f, 0xe2, 
-	0x03, 0x0c, 0x11, 0xe3, 0x01, 0x0c, 0x10, 0x13, 0x02, 0x0c, 0x10, 0x13, 0xac, 0x12, 0x9f, 0x15, 
-	0x11, 0xff, 0x2f, 0x11, 0x03, 0x3c, 0x10, 0xe2, 0x03, 0x3c, 0x33, 0x12, 0x0c, 0x00, 0xc0, 0x13, 
-	0xe0, 0x04, 0x8a, 0xe5, 0x0e, 0x00, 0x00, 0x0a, 0x02, 0x0c, 0x10, 0xe3, 0x08, 0x00, 0x11, 0x13, 
-	0xd7, 0x24, 0xda, 0xe5, 0x01, 0x20, 0x82, 0x12, 0x03, 0x00, 0x52, 0xe3, 0x00, 0x20, 0xa0, 0x03, 
-	0xd7, 0x24, 0xca, 0xe5, 0x01, 0x0c, 0x10, 0xe3, 0x08, 0x00, 0x11, 0x13, 0x70, 0x12, 0x9f, 0x15, 
-	0x11, 0xff, 0x2f, 0x11, 0x01, 0x0c, 0x10, 0xe3, 0x04, 0x00, 0x11, 0x13, 0x64, 0x12, 0x9f, 0x15, 
-	0x11, 0xff, 0x2f, 0x11, 0x0f, 0xe0, 0xa0, 0xe1, 0x5c, 0xf2, 0x9f, 0xe5, 0xdc, 0x04, 0x9a, 0xe5, 
-	0xf4, 0x25, 0x9a, 0xe5, 0x00, 0x00, 0x50, 0xe3, 0xf8, 0x25, 0x9a, 0x15, 0x01, 0x20, 0x52, 0xe2, 
-	0xf4, 0x25, 0x8a, 0xe5, 0x0f, 0xe0, 0xa0, 0x01, 0x40, 0xf2, 0x9f, 0x05, 0x00, 0x10, 0xa0, 0xe3, 
-	0xe8, 0x14, 0xca, 0xe5, 0xd4, 0x04, 0x9a, 0xe5, 0x01, 0x00, 0x10, 0xe3, 0x0f, 0xe0, 0xa0, 0x11, 
-	0x2c, 0xf2, 0x9f, 0x15, 0x12, 0x0d, 0x8a, 0xe2, 0xf8, 0x0b, 0x90, 0xe8, 0x24, 0x12, 0x9f, 0xe5, 
-	0x00, 0x00, 0xd1, 0xe5, 0x7c, 0x20, 0x00, 0xe2, 0x02, 0x00, 0x50, 0xe1, 0x00, 0x20, 0xc1, 0x15, 
-	0x0c, 0x20, 0x41, 0x15, 0xc8, 0x04, 0x9a, 0xe5, 0x00, 0x80, 0x88, 0xe0, 0x08, 0x02, 0x9f, 0xe5, 
-	0xb8, 0x04, 0x8a, 0xe5, 0x06, 0x1c, 0x8a, 0xe2, 0x00, 0x10, 0x81, 0xe2, 0x00, 0x00, 0x91, 0xe5, 
-	0xf8, 0x11, 0x9f, 0xe5, 0x00, 0x00, 0x81, 0xe5, 0xc0, 0xf4, 0x9a, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x24, 0x05, 0xca, 0xe5, 0x5c, 0x05, 0x9a, 0xe5, 0x00, 0x05, 0x8a, 0xe5, 0x54, 0x05, 0x9a, 0xe5, 
-	0x1c, 0x05, 0x8a, 0xe5, 0x07, 0x00, 0xe0, 0xe3, 0x00, 0x08, 0xa0, 0xe1, 0x20, 0x05, 0x8a, 0xe5, 
-	0xcc, 0xf1, 0x9f, 0xe5, 0xff, 0x5f, 0x2d, 0xe9, 0x0f, 0xe0, 0xa0, 0xe1, 0xc4, 0xf1, 0x9f, 0xe5, 
-	0x01, 0x03, 0xa0, 0xe3, 0x00, 0x12, 0xd0, 0xe5, 0x01, 0x10, 0xc1, 0xe3, 0x00, 0x12, 0xc0, 0xe5, 
-	0x08, 0x10, 0x50, 0xe5, 0x01, 0x10, 0xc1, 0xe3, 0x08, 0x10, 0x40, 0xe5, 0xe3, 0x05, 0xda, 0xe5, 
-	0x00, 0x00, 0xb0, 0xe1, 0x4c, 0x00, 0x00, 0x1a, 0x50, 0x05, 0x9a, 0xe5, 0x4c, 0x05, 0x8a, 0xe5, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x90, 0xf1, 0x9f, 0xe5, 0xe4, 0x04, 0xda, 0xe5, 0x80, 0x00, 0x10, 0xe3, 
-	0x28, 0x05, 0xca, 0x05, 0x28, 0x05, 0xda, 0x15, 0x29, 0x05, 0xca, 0xe5, 0x5c, 0x05, 0x9a, 0xe5, 
-	0x60, 0x15, 0x9a, 0xe5, 0x5c, 0x15, 0x8a, 0xe5, 0x60, 0x05, 0x8a, 0xe5, 0x54, 0x05, 0x9a, 0xe5, 
-	0x58, 0x15, 0x9a, 0xe5, 0x54, 0x15, 0x8a, 0xe5, 0x58, 0x05, 0x8a, 0xe5, 0x01, 0x00, 0xa0, 0xe3, 
-	0x81, 0x05, 0xca, 0xe5, 0x64, 0x05, 0xda, 0xe5, 0x00, 0x00, 0xb0, 0xe1, 0x11, 0x00, 0x00, 0x0a, 
-	0x02, 0x00, 0x50, 0xe3, 0x0b, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x50, 0xe3, 0x04, 0x00, 0x00, 0x0a, 
-	0x6c, 0x05, 0x9a, 0xe5, 0x68, 0x15, 0x9a, 0xe5, 0x6c, 0x15, 0x8a, 0xe5, 0x68, 0x05, 0x8a, 0xe5, 
-	0x06, 0x00, 0x00, 0xea, 0xfc, 0x04, 0x9a, 0xe5, 0x68, 0x15, 0x9a, 0xe5, 0xfc, 0x14, 0x8a, 0xe5, 
-	0x68, 0x05, 0x8a, 0xe5, 0x01, 0x00, 0x00, 0xea, 0x0f, 0xe0, 0xa0, 0xe1, 0x0c, 0xf1, 0x9f, 0xe5, 
-	0x00, 0x00, 0xa0, 0xe3, 0x64, 0x05, 0xca, 0xe5, 0xd7, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x50, 0xe3, 
-	0x67, 0x05, 0xda, 0x15, 0x00, 0x00, 0xb0, 0xe1, 0x16, 0x00, 0x00, 0x0a, 0x83, 0x05, 0xda, 0xe5, 
-	0x02, 0x00, 0x50, 0xe3, 0x02, 0x00, 0x00, 0x1a, 0x0f, 0xe0, 0xa0, 0xe1, 0xe0, 0xf0, 0x9f, 0xe5, 
-	0x0d, 0x00, 0x00, 0xea, 0x02, 0x00, 0x18, 0xe3, 0x01, 0x00, 0xa0, 0x03, 0x65, 0x05, 0xca, 0x05, 
-	0x19, 0x00, 0x00, 0x0a, 0x66, 0x05, 0xda, 0xe5, 0x02, 0x00, 0x50, 0xe3, 0x04, 0x00, 0x00, 0x0a, 
-	0x00, 0x00, 0xb0, 0xe1, 0x0f, 0xe0, 0xa0, 0x11, 0xb8, 0xf0, 0x9f, 0x15, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0xb4, 0xf0, 0x9f, 0xe5, 0x01, 0x00, 0xa0, 0xe3, 0x66, 0x05, 0xca, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 
-	0x67, 0x05, 0xca, 0xe5, 0x0c, 0x00, 0x00, 0xea, 0x66, 0x05, 0xda, 0xe5, 0x02, 0x00, 0x50, 0xe3, 
-	0x01, 0x00, 0xa0, 0xe3, 0x66, 0x05, 0xca, 0x05, 0x65, 0x05, 0xca, 0x15, 0x83, 0x05, 0xda, 0xe5, 
-	0x02, 0x00, 0x50, 0xe3, 0x0f, 0xe0, 0xa0, 0x01, 0x74, 0xf0, 0x9f, 0x05, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x78, 0xf0, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0x67, 0x05, 0xca, 0xe5, 0x0f, 0xe0, 0xa0, 0xe1, 
-	0x6c, 0xf0, 0x9f, 0xe5, 0xd7, 0x04, 0xda, 0xe5, 0x02, 0x00, 0x50, 0xe3, 0x03, 0x00, 0x00, 0x1a, 
-	0x0f, 0xe0, 0xa0, 0xe1, 0x54, 0xf0, 0x9f, 0xe5, 0x00, 0x00, 0xa0, 0xe3, 0x67, 0x05, 0xca, 0xe5, 
-	0x02, 0xda, 0x7f, 0xeb, 0xff, 0x9f, 0xbd, 0xe8, 0xb0, 0x52, 0x00, 0x08, 0x30, 0x01, 0x00, 0x04, 
-	0xa5, 0x38, 0x00, 0x08, 0x79, 0x30, 0x00, 0x08, 0xad, 0x2e, 0x00, 0x08, 0xd4, 0x3c, 0x00, 0x03, 
-	0x68, 0x69, 0x00, 0x08, 0x8c, 0x46, 0x00, 0x08, 0x00, 0x50, 0x00, 0x03, 0x70, 0x4a, 0x00, 0x03, 
-	0xa4, 0x3e, 0x00, 0x03, 0x28, 0x2e, 0x00, 0x03, 0x78, 0x4e, 0x00, 0x03, 0xbc, 0x31, 0x00, 0x03, 
-	0xac, 0x3b, 0x00, 0x03, 0x80, 0x5d, 0x00, 0x08, 0xf4, 0x5d, 0x00, 0x08, 0xa4, 0x47, 0x00, 0x03, 
-	0x5c, 0x60, 0x00, 0x08, 0x64, 0xf6, 0x00, 0x06, 0x78, 0x47, 0xfd, 0xe7, 0x00, 0xc0, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0x8d, 0x02, 0x00, 0x08, 0x78, 0x47, 0xfd, 0xe7, 0x00, 0xc0, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0x15, 0x90, 0x00, 0x08, 0x78, 0x47, 0xfd, 0xe7, 0x00, 0xc0, 0x9f, 0xe5, 
-	0x1c, 0xff, 0x2f, 0xe1, 0xd5, 0x90, 0x00, 0x08, 0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 
-	0xa4, 0x45, 0x00, 0x03, 0x78, 0x47, 0xfd, 0xe7, 0x04, 0xf0, 0x1f, 0xe5, 0xd4, 0x43, 0x00, 0x03, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x6b, 0x41, 0x52, 0x4d, 0x00, 0x00, 0x00
-	
+const unsigned char goomba_gba_lz[46048] __attribute__((aligned(4))) = {
+	0x10, 0x70, 0x2a, 0x01, 0x00, 0x2e, 0x00, 0x00, 0xea, 0x24, 0xff, 0xae, 0x51, 0x00, 0x69, 0x9a, 
+	0xa2, 0x21, 0x3d, 0x84, 0x82, 0x0a, 0x00, 0x84, 0xe4, 0x09, 0xad, 0x11, 0x24, 0x8b, 0x98, 0x00, 
+	0xc0, 0x81, 0x7f, 0x21, 0xa3, 0x52, 0xbe, 0x19, 0x00, 0x93, 0x09, 0xce, 0x20, 0x10, 0x46, 0x4a, 
+	0x4a, 0x00, 0xf8, 0x27, 0x31, 0xec, 0x58, 0xc7, 0xe8, 0x33, 0x00, 0x82, 0xe3, 0xce, 0xbf, 0x85, 
+	0xf4, 0xdf, 0x94, 0x00, 0xce, 0x4b, 0x09, 0xc1, 0x94, 0x56, 0x8a, 0xc0, 0x00, 0x13, 0x72, 0xa7, 
+	0xfc, 0x9f, 0x84, 0x4d, 0x73, 0x00, 0xa3, 0xca, 0x9a, 0x61, 0x58, 0x97, 0xa3, 0x27, 0x00, 0xfc, 
+	0x03, 0x98, 0x76, 0x23, 0x1d, 0xc7, 0x61, 0x00, 0x03, 0x04, 0xae, 0x56, 0xbf, 0x38, 0x84, 0x00, 
+	0x00, 0x40, 0xa7, 0x0e, 0xfd, 0xff, 0x52, 0xfe, 0x03, 0x00, 0x6f, 0x95, 0x30, 0xf1, 0x97, 0xfb, 
+	0xc0, 0x85, 0x00, 0x60, 0xd6, 0x80, 0x25, 0xa9, 0x63, 0xbe, 0x03, 0x00, 0x01, 0x4e, 0x38, 0xe2, 
+	0xf9, 0xa2, 0x34, 0xff, 0x00, 0xbb, 0x3e, 0x03, 0x44, 0x78, 0x00, 0x90, 0xcb, 0x00, 0x88, 0x11, 
+	0x3a, 0x94, 0x65, 0xc0, 0x7c, 0x63, 0x00, 0x87, 0xf0, 0x3c, 0xaf, 0xd6, 0x25, 0xe4, 0x8b, 0x00, 
+	0x38, 0x0a, 0xac, 0x72, 0x21, 0xd4, 0xf8, 0x07, 0x00, 0x47, 0x4f, 0x4f, 0x4d, 0x42, 0x41, 0x20, 
+	0x43, 0x00, 0x4f, 0x4c, 0x4f, 0x52, 0x47, 0x4d, 0x42, 0x43, 0x04, 0x30, 0x31, 0x96, 0x00, 0x00, 
+	0x50, 0x01, 0x83, 0x00, 0x38, 0x00, 0x06, 0x00, 0xbf, 0x70, 0x10, 0xf0, 0x01, 0x01, 0x03, 0xa0, 
+	0x00, 0xe3, 0x08, 0x02, 0x80, 0xe5, 0x12, 0x00, 0xa0, 0x00, 0xe3, 0x00, 0xf0, 0x29, 0xe1, 0xb8, 
+	0xd0, 0x9f, 0x28, 0xe5, 0x1f, 0x40, 0x0b, 0xb0, 0x00, 0x0b, 0x01, 0x00, 0x8f, 0x00, 0xe2, 0x10, 
+	0xff, 0x2f, 0xe1, 0x00, 0x27, 0x2b, 0x00, 0x48, 0x40, 0x01, 0x0d, 0xd2, 0x78, 0x46, 0x40, 0x00, 
+	0x01, 0x0a, 0xd3, 0x01, 0x27, 0x02, 0x22, 0x12, 0x00, 0x06, 0x27, 0x4b, 0x9b, 0x1a, 0x16, 0x1c, 
+	0x91, 0x00, 0x00, 0x00, 0xf0, 0x3a, 0xf8, 0x25, 0x48, 0x87, 0x00, 0x46, 0x25, 0x49, 0x26, 0x4a, 
+	0x26, 0x4c, 0x00, 0x0a, 0xf0, 0x32, 0xf8, 0x26, 0x00, 0x09, 0x27, 0x00, 0x09, 0x2d, 0x40, 0xf8, 
+	0x00, 0x07, 0x49, 0x53, 0x1a, 0x02, 0xd0, 0x26, 0x08, 0x4a, 0x00, 0xf0, 0x27, 0x60, 0x17, 0x21, 
+	0xf8, 0x26, 0x00, 0x48, 0x27, 0x49, 0x09, 0x1a, 0x00, 0xf0, 0x12, 0xa4, 0x00, 0x09, 0x26, 0x20, 
+	0x09, 0x0d, 0xf8, 0x00, 0x3f, 0x48, 0x08, 0x02, 0x60, 0x26, 0x4b, 0x00, 0xf0, 0x10, 0x00, 0x4f, 
+	0x07, 0x02, 0x60, 0x00, 0x20, 0x00, 0x21, 0x24, 0x00, 0x0d, 0x09, 0x00, 0xf8, 0x03, 0x22, 0x89, 
+	0x18, 0x91, 0x43, 0x03, 0x00, 0xd0, 0x00, 0x22, 0x04, 0xc0, 0x04, 0x39, 0xfc, 0x00, 0xd1, 0x70, 
+	0x47, 0x18, 0x47, 0xa3, 0x1a, 0x03, 0x08, 0x20, 0x1b, 0x18, 0x83, 0x00, 0x15, 0x01, 0xc9, 0x01, 
+	0x08, 0xc2, 0x04, 0x3b, 0xfb, 0x00, 0x15, 0xc0, 0x46, 0xa0, 0x0c, 0x7f, 0x00, 0x03, 0x40, 0x00, 
+	0x03, 0x00, 0xda, 0x08, 0xc4, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x00, 0x08, 0x88, 0x00, 0x21, 
+	0x01, 0x08, 0x40, 0x78, 0x00, 0x03, 0x4c, 0x85, 0x00, 0x03, 0x48, 0xa9, 0x00, 0x08, 0x00, 0x1b, 
+	0x03, 0x10, 0x0f, 0x66, 0x94, 0x00, 0x17, 0x10, 0x03, 0xa0, 0x7d, 0x30, 0x0b, 0x00, 0x17, 0x02, 
+	0x7d, 0x04, 0x00, 0x03, 0x10, 0x27, 0x10, 0x13, 0x10, 0x0b, 0x10, 0x43, 0x80, 0x00, 0x0b, 0x00, 
+	0x00, 0x00, 0x04, 0x02, 0x55, 0x8f, 0x00, 0x08, 0x40, 0x4c, 0x00, 0x0f, 0x85, 0x91, 0x00, 0x08, 
+	0xf8, 0xb5, 0x00, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x20, 0x70, 0x47, 0x11, 0x47, 
+	0x14, 0x4b, 0x02, 0x68, 0x70, 0x00, 0xb5, 0x14, 0x4c, 0x9a, 0x42, 0x17, 0xd1, 0x81, 0x00, 0x22, 
+	0x03, 0x00, 0x21, 0x00, 0xd2, 0x00, 0x08, 0x00, 0x33, 0x85, 0x18, 0x04, 0xcb, 0x82, 0x18, 0x04, 
+	0x00, 0xc1, 0xab, 0x42, 0xfa, 0xd1, 0x84, 0x22, 0x25, 0x00, 0x68, 0x0d, 0x4e, 0x29, 0x00, 0x30, 
+	0x00, 0xd2, 0x00, 0x01, 0x09, 0xf0, 0xd3, 0xf8, 0x28, 0x00, 0x26, 0x00, 0x60, 0x70, 0xbc, 0x02, 
+	0xbc, 0x08, 0x47, 0x80, 0x00, 0x22, 0x23, 0x00, 0xd2, 0x03, 0x82, 0x18, 0x80, 0x00, 0x21, 0xc9, 
+	0x01, 0x01, 0xc3, 0x40, 0x18, 0x90, 0x00, 0x42, 0xf9, 0xd1, 0xe7, 0xe7, 0xc0, 0x46, 0x54, 0x00, 
+	0x52, 0x49, 0x4d, 0x18, 0x92, 0x02, 0x02, 0x00, 0x10, 0xfe, 0x00, 0x06, 0x10, 0xdb, 0x70, 0xb5, 
+	0x10, 0x4c, 0x00, 0x21, 0x68, 0x17, 0x29, 0x18, 0xdc, 0x0f, 0x26, 0x00, 0x45, 0x88, 0x0e, 0x4a, 
+	0xcb, 0x00, 0x9d, 0x52, 0x00, 0xd2, 0x18, 0x0d, 0x4b, 0x05, 0x88, 0x1b, 0x68, 0x00, 0xed, 0x1a, 
+	0xeb, 0x17, 0x33, 0x40, 0x5b, 0x19, 0x00, 0x0a, 0x4d, 0x2e, 0x78, 0xc0, 0x25, 0x6d, 0x00, 0x00, 
+	0x75, 0x43, 0x1b, 0x11, 0x5b, 0x19, 0x53, 0x80, 0x01, 0x43, 0x68, 0x01, 0x31, 0x53, 0x60, 0x21, 
+	0x00, 0x69, 0x18, 0x01, 0xbc, 0x00, 0x00, 0x43, 0x10, 0xdb, 0x18, 0x96, 0x02, 0x80, 0x20, 0xe7, 
+	0x5b, 0x56, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x70, 0xb5, 0x35, 0x32, 0x45, 
+	0x00, 0x31, 0xff, 0x32, 0xff, 0x31, 0x14, 0x78, 0x01, 0x08, 0x32, 0x1b, 0x19, 0x8a, 0x00, 0xaf, 
+	0x38, 0x22, 0xff, 0x00, 0x32, 0x86, 0x5c, 0x00, 0x22, 0x89, 0x25, 0x10, 0x00, 0x00, 0x1b, 0x06, 
+	0x0c, 0x49, 0x1b, 0x0e, 0x6d, 0x00, 0x00, 0x0c, 0x78, 0x00, 0x2c, 0x06, 0xd1, 0x01, 0x00, 0x30, 
+	0x02, 0x32, 0x02, 0x31, 0xaa, 0x42, 0xf7, 0x03, 0xd1, 0x00, 0x20, 0x05, 0xe0, 0xa3, 0x00, 0x07, 
+	0x00, 0x55, 0x04, 0x2c, 0x03, 0xd1, 0x31, 0x30, 0x30, 0xcf, 0xa6, 0x42, 0x10, 0xee, 0xd1, 0xf8, 
+	0x00, 0xbf, 0x78, 0x94, 0x00, 0x08, 0x00, 0x70, 0xb5, 0x80, 0x24, 0x80, 0x23, 0x01, 0x00, 0x00, 
+	0x96, 0x22, 0xc0, 0x20, 0xe4, 0x04, 0x23, 0x60, 0x00, 0x52, 0x02, 0xc0, 0x04, 0x09, 0xf0, 0x54, 
+	0xf8, 0x00, 0x09, 0xf0, 0x66, 0xf8, 0x00, 0x22, 0x0f, 0x4b, 0x00, 0x1a, 0x80, 0x0f, 0x4b, 0x23, 
+	0x60, 0x10, 0x24, 0x00, 0x20, 0x00, 0x01, 0xf0, 0x69, 0xfa, 0x09, 0xf0, 0x00, 0x5b, 0xf8, 0x01, 
+	0x3c, 0xf8, 0xd2, 0x96, 0x24, 0x08, 0x01, 0x25, 0x03, 0x26, 0x10, 0x27, 0x08, 0x4b, 0x1a, 0x00, 
+	0x88, 0x08, 0x4b, 0x9a, 0x42, 0x02, 0xd1, 0x08, 0x00, 0x4b, 0x1d, 0x70, 0x5e, 0x70, 0x01, 0x3c, 
+	0x00, 0x16, 0x2c, 0xf2, 0xd1, 0x30, 0xcd, 0x0c, 0x01, 0x94, 0x11, 0xa4, 0x30, 0x0c, 0x01, 0x00, 
+	0x04, 0x0f, 0x01, 0xa1, 0x01, 0xc0, 0x02, 0x70, 0x00, 0xb5, 0x0d, 0x4a, 0x03, 0x00, 0x50, 0x68, 
+	0x12, 0x00, 0x7a, 0x00, 0x2a, 0x06, 0xd1, 0xa4, 0x21, 0x80, 0x00, 0x24, 0x0a, 0x4a, 0x49, 0x00, 
+	0x24, 0x02, 0x01, 0x11, 0x3b, 0x02, 0xd2, 0x30, 0x9d, 0x05, 0x68, 0x95, 0x00, 0x4d, 0x00, 0x45, 
+	0x68, 0x40, 0x19, 0xf4, 0xe7, 0x26, 0x00, 0x00, 0x45, 0x5c, 0xae, 0x40, 0x35, 0x00, 0xf8, 0xe7, 
+	0xc0, 0x10, 0x3b, 0x11, 0x6f, 0x10, 0xb5, 0xff, 0xf7, 0xdd, 0xff, 0x40, 0x04, 0x01, 0xcd, 0x9a, 
+	0x42, 0x01, 0xd1, 0x83, 0x68, 0x18, 0xc0, 0x18, 0x10, 0x20, 0x35, 0x10, 0x1b, 0x01, 0x00, 0x70, 
+	0x00, 0xb5, 0x0f, 0x4c, 0x35, 0x31, 0x05, 0x00, 0x10, 0x00, 0x22, 0x20, 0x00, 0xff, 0x31, 0x08, 
+	0xf0, 0x44, 0x00, 0xff, 0x44, 0x22, 0x00, 0x23, 0xff, 0x32, 0xaa, 0x00, 0x5c, 0x23, 0x74, 0x7f, 
+	0x2a, 0x0c, 0xd9, 0xe3, 0x00, 0x73, 0x0b, 0x33, 0xe2, 0x5c, 0x00, 0x2a, 0x07, 0x00, 0xd0, 0x01, 
+	0x33, 0x0f, 0x2b, 0xf9, 0xd1, 0x00, 0x00, 0x23, 0xe3, 0x72, 0x23, 0x73, 0x63, 0x73, 0xa3, 0x14, 
+	0x73, 0x20, 0x00, 0x30, 0x7d, 0x9c, 0x00, 0x67, 0x26, 0x4b, 0x00, 0xf7, 0xb5, 0xdc, 0x68, 0x07, 
+	0x00, 0x14, 0x2c, 0x00, 0x25, 0xdd, 0x26, 0x00, 0x14, 0x3e, 0x38, 0x00, 0x00, 0x70, 0x43, 0x61, 
+	0x1e, 0xc0, 0x00, 0x08, 0xf0, 0x00, 0x56, 0xff, 0x07, 0x23, 0xc5, 0x17, 0x1d, 0x40, 0x00, 0x2d, 
+	0x18, 0x15, 0x24, 0xed, 0x10, 0xae, 0x42, 0x00, 0x00, 0xdc, 0x01, 0x3c, 0x1c, 0x4a, 0x1c, 0x4b, 
+	0x00, 0x10, 0x40, 0x04, 0xd5, 0x08, 0x22, 0x01, 0x38, 0x00, 0x52, 0x42, 0x10, 0x43, 0x01, 0x30, 
+	0x18, 0x60, 0x00, 0x00, 0x23, 0x01, 0x93, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0x00, 0x26, 0xa6, 0x42, 
+	0x10, 0xdb, 0x00, 0x20, 0x40, 0xfe, 0x20, 0x5b, 0x14, 0x23, 0x1b, 0x1b, 0xe2, 0x07, 0x00, 0x04, 
+	0xd5, 0x04, 0x22, 0x10, 0x4b, 0x1a, 0x60, 0x40, 0x15, 0x00, 0x0d, 0x5b, 0x10, 0x00, 0x25, 0x01, 
+	0x93, 0x00, 0xe9, 0xe7, 0xa8, 0x19, 0xff, 0xf7, 0x92, 0xff, 0x00, 0xff, 0xf7, 0x9e, 0xff, 0x07, 
+	0x4b, 0xdb, 0x68, 0x00, 0x01, 0x00, 0x01, 0x2b, 0x08, 0xdd, 0x7a, 0x1b, 0x00, 0x92, 0x1b, 0x53, 
+	0x42, 0x5a, 0x41, 0x01, 0x9b, 0x00, 0x98, 0x19, 0x10, 0x23, 0x01, 0xf0, 0x18, 0xf9, 0x10, 0x01, 
+	0x36, 0xd7, 0x21, 0x07, 0x07, 0x00, 0x00, 0x80, 0x40, 0x54, 0x00, 0x07, 0x11, 0x4b, 0x1a, 0x68, 
+	0x11, 0x4b, 0x00, 0x10, 0x00, 0x19, 0x69, 0x1a, 0x61, 0xf0, 0x23, 0x00, 0x88, 0x43, 0x0f, 0x49, 
+	0x1a, 0x40, 0x0b, 0x68, 0x00, 0x93, 0x42, 0x11, 0xd1, 0x4b, 0x68, 0x01, 0x33, 0x00, 0x4b, 0x60, 
+	0x18, 0x2b, 0x0f, 0xdd, 0x03, 0x21, 0x00, 0x0b, 0x40, 0x59, 0x42, 0x4b, 0x41, 0x5b, 0x42, 0x00, 
+	0x1a, 0x40, 0x00, 0x21, 0x08, 0x4b, 0x19, 0x60, 0x02, 0x0b, 0x23, 0x18, 0x40, 0x10, 0x43, 0x03, 
+	0x15, 0x23, 0x00, 0x0c, 0xc1, 0xf5, 0xe7, 0x00, 0x22, 0xf3, 0xe7, 0x6c, 0x44, 0x02, 0x67, 0x10, 
+	0x57, 0x5c, 0x13, 0x7f, 0x00, 0x0b, 0xf0, 0xb5, 0x00, 0x03, 0x20, 0x85, 0xb0, 0x01, 0xf0, 0x37, 
+	0xf8, 0x00, 0x80, 0x23, 0x55, 0x4f, 0x5b, 0x00, 0x10, 0x20, 0x00, 0x3b, 0x60, 0x01, 0xf0, 0x64, 
+	0xf9, 0x03, 0x20, 0x40, 0x01, 0x04, 0x31, 0x01, 0xf0, 0x6b, 0xf8, 0x00, 0x20, 0x00, 0x02, 0xf0, 
+	0x5c, 0xfa, 0x4f, 0x4d, 0x2b, 0x7a, 0x00, 0x00, 0x2b, 0x16, 0xd0, 0x4e, 0x4b, 0x19, 0x68, 0x00, 
+	0xc0, 0x23, 0x9b, 0x00, 0x00, 0x20, 0x19, 0x40, 0x00, 0x08, 0xf0, 0x1e, 0xff, 0x4b, 0x4b, 0x1b, 
+	0x78, 0x00, 0x00, 0x2b, 0x01, 0xd0, 0x02, 0xf0, 0x6c, 0xfd, 0x40, 0x00, 0x00, 0x33, 0x47, 0xf9, 
+	0x01, 0xf0, 0x61, 0xf8, 0x10, 0x05, 0xb0, 0xf0, 0x22, 0x15, 0xeb, 0x68, 0x01, 0x93, 0x00, 0x44, 
+	0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x43, 0x4a, 0x00, 0x2b, 0x61, 0x13, 0x60, 0x01, 0x9b, 0x6c, 0x69, 
+	0x02, 0x03, 0x92, 0x01, 0x2b, 0x1a, 0xdd, 0x01, 0xb3, 0xf7, 0x10, 0x41, 0xff, 0x3b, 0x40, 0x4d, 
+	0x19, 0x40, 0x01, 0x43, 0x40, 0x20, 0x01, 0x73, 0xf6, 0xfe, 0xe0, 0x26, 0x3e, 0x60, 0x00, 0x20, 
+	0x3e, 0x00, 0xf0, 0x53, 0xff, 0x33, 0x00, 0x00, 0x20, 0x33, 0xf8, 0xd1, 0x08, 0xf0, 0x18, 0xff, 
+	0x40, 0x07, 0x00, 0x57, 0x1b, 0xf9, 0x02, 0x94, 0x02, 0xe0, 0x00, 0x01, 0x23, 0x5b, 0x42, 0x02, 
+	0x93, 0xff, 0xf7, 0x00, 0x78, 0xff, 0x10, 0x23, 0x06, 0x00, 0x18, 0x42, 0x01, 0x04, 0xd0, 0x01, 
+	0x9b, 0x0a, 0x34, 0xa3, 0x01, 0x9b, 0x00, 0x5c, 0x1e, 0x20, 0x23, 0x1e, 0x42, 0x03, 0xd0, 0x00, 
+	0x0a, 0x3c, 0xe3, 0x43, 0xdb, 0x17, 0x1c, 0x40, 0x00, 0x73, 0x06, 0x02, 0xd5, 0x01, 0x9b, 0xe4, 
+	0x18, 0x00, 0x01, 0x3c, 0x33, 0x06, 0xdb, 0x0f, 0xe4, 0x18, 0x80, 0x02, 0xd3, 0x99, 0x08, 0xf0, 
+	0xd2, 0xfe, 0x02, 0x9b, 0x00, 0x0c, 0x00, 0x69, 0x61, 0x8b, 0x42, 0x0b, 0xd0, 0x44, 0x08, 0x00, 
+	0x81, 0x00, 0xff, 0x1a, 0xc0, 0x81, 0xb5, 0xfe, 0x00, 0x00, 0x20, 0x08, 0xf0, 0x96, 0xfe, 0x01, 
+	0x9b, 0x04, 0x01, 0x2b, 0x02, 0xdd, 0x0b, 0x00, 0x53, 0xc2, 0xd0, 0x00, 0x01, 0x24, 0x08, 0x25, 
+	0x28, 0x1b, 0x01, 0xf0, 0x08, 0xd9, 0xf8, 0x63, 0x01, 0x01, 0x1d, 0x34, 0x00, 0xf0, 0x40, 0xf4, 
+	0x20, 0x25, 0x83, 0xfe, 0x00, 0xf0, 0xb7, 0xfe, 0x00, 0x09, 0x2c, 0xf0, 0xd1, 0x03, 0x20, 0x00, 
+	0xf0, 0x00, 0x96, 0xff, 0x02, 0x34, 0x03, 0x9b, 0x1b, 0x68, 0x00, 0x23, 0x42, 0x00, 0xd1, 0x73, 
+	0xe7, 0x00, 0x20, 0x00, 0x03, 0x9b, 0x18, 0x60, 0x08, 0xf0, 0x71, 0xfe, 0x10, 0xf4, 0xe7, 0xa8, 
+	0x41, 0x73, 0x28, 0x57, 0x00, 0x03, 0x70, 0x9a, 0x00, 0x07, 0x13, 0x23, 0x11, 0x87, 0x10, 0xb5, 
+	0x04, 0x4b, 0x01, 0x9d, 0x46, 0xff, 0xf7, 0x3d, 0xff, 0x01, 0x00, 0x4d, 0x18, 0x5c, 0xfe, 0xfe, 
+	0x03, 0xa7, 0x15, 0x2f, 0xf8, 0x22, 0x7b, 0x00, 0x4b, 0x18, 0x68, 0x43, 0x0e, 0x5b, 0x06, 0x12, 
+	0x00, 0x06, 0x9a, 0x18, 0x51, 0x42, 0x4a, 0x41, 0xf0, 0x00, 0xb5, 0x77, 0x4d, 0x2a, 0x72, 0x80, 
+	0x22, 0x89, 0x00, 0xb0, 0x12, 0x05, 0x93, 0x42, 0x15, 0xd1, 0x75, 0x00, 0x4b, 0x5a, 0x78, 0x01, 
+	0x33, 0x00, 0x2a, 0xfb, 0x40, 0xd1, 0x50, 0x07, 0x19, 0x00, 0x01, 0x3b, 0x1a, 0x78, 0x00, 0x2f, 
+	0x2a, 0xfa, 0xd1, 0x68, 0x60, 0x28, 0x00, 0x01, 0x01, 0x23, 0x18, 0x30, 0x0f, 0x3a, 0xeb, 0x00, 
+	0x7f, 0x00, 0x65, 0xfe, 0x01, 0x23, 0x6a, 0x4a, 0x13, 0x80, 0x00, 0x12, 0x88, 0x1a, 0x42, 0x02, 
+	0xd0, 0x2a, 0x00, 0x00, 0x38, 0x32, 0x13, 0x70, 0x08, 0xf0, 0x0e, 0xfe, 0x01, 0x66, 0x4b, 0x67, 
+	0x4e, 0x68, 0x70, 0x33, 0x00, 0x21, 0x04, 0xf0, 0xfd, 0x00, 0x22, 0x65, 0x02, 0xa3, 0x2b, 0x7a, 
+	0x00, 0x93, 0x42, 0x2b, 0xd1, 0x68, 0x68, 0x63, 0x4f, 0x04, 0x02, 0x68, 0x03, 0x00, 0xba, 0x23, 
+	0x71, 0xc3, 0x18, 0x00, 0xfc, 0x33, 0x9b, 0x68, 0x5f, 0x4a, 0x93, 0x42, 0x00, 0x73, 0xd0, 0x96, 
+	0x23, 0x5b, 0x02, 0xc3, 0x18, 0x00, 0x6b, 0x60, 0x01, 0x23, 0x07, 0x93, 0x01, 0x24, 0x00, 0x6b, 
+	0x68, 0x64, 0x42, 0x1a, 0x68, 0xba, 0x42, 0x00, 0x6a, 0xd1, 0x59, 0x68, 0x8c, 0x46, 0x9a, 0x68, 
+	0x00, 0x9a, 0x18, 0xfc, 0x32, 0x92, 0x68, 0x55, 0x49, 0x00, 0x63, 0x44, 0x01, 0x34, 0x8a, 0x42, 
+	0xf1, 0xd0, 0x00, 0xec, 0x60, 0x00, 0x2c, 0x65, 0xd0, 0x07, 0x9b, 0x80, 0x12, 0x1b, 0xff, 0xf7, 
+	0xc2, 0xfd, 0x80, 0x23, 0xdb, 0x00, 0x04, 0x1a, 0x68, 0x80, 0x2a, 0x01, 0xd1, 0x00, 0x00, 0x22, 
+	0x1a, 0x60, 0xa0, 0x25, 0xff, 0x22, 0x00, 0x00, 0x24, 0x4a, 0x4b, 0xed, 0x04, 0x2b, 0x80, 0x4a, 
+	0x80, 0x04, 0x77, 0x4a, 0x4a, 0x23, 0x04, 0x1b, 0x0c, 0x13, 0x00, 0x80, 0x01, 0x34, 0x08, 0xf0, 
+	0x20, 0xfe, 0x11, 0x00, 0x2c, 0xf6, 0xd1, 0x80, 0x23, 0x00, 0x24, 0xc0, 0x80, 0x04, 0xa7, 0xdb, 
+	0x04, 0x21, 0x00, 0x2c, 0x80, 0x52, 0x00, 0x02, 0x1c, 0x60, 0xc0, 0x04, 0x08, 0xf0, 0xe0, 0x00, 
+	0xfd, 0x03, 0x23, 0x40, 0x48, 0x40, 0x4a, 0x12, 0x00, 0x1a, 0x01, 0x3a, 0x1a, 0x43, 0x3f, 0x49, 
+	0x01, 0x00, 0x32, 0x08, 0xf0, 0x10, 0xfe, 0x08, 0xf0, 0xa2, 0x00, 0xfd, 0x04, 0x22, 0x3d, 0x4b, 
+	0x02, 0x21, 0x33, 0x00, 0x60, 0x3c, 0x48, 0x13, 0x00, 0x05, 0x92, 0x04, 0x00, 0x92, 0x03, 0x92, 
+	0x02, 0x92, 0x01, 0x92, 0x00, 0x00, 0x92, 0x00, 0xf0, 0xb2, 0xf9, 0x21, 0x00, 0x38, 0x00, 0x48, 
+	0x04, 0x00, 0x4c, 0x43, 0x37, 0x4a, 0x38, 0x00, 0x4d, 0x4b, 0x01, 0x9a, 0x18, 0x5b, 0x19, 0x10, 
+	0x00, 0xc2, 0x9a, 0x42, 0xfc, 0xd1, 0x01, 0x31, 0x10, 0x02, 0x29, 0xf2, 0xd1, 0x00, 0xf0, 0x2f, 
+	0x01, 0xc7, 0x39, 0x08, 0xfe, 0x01, 0xf0, 0x6f, 0x03, 0x95, 0x35, 0xff, 0x00, 0x00, 0x20, 0x07, 
+	0x90, 0x8e, 0xe7, 0xa4, 0x22, 0x80, 0x00, 0x21, 0x52, 0x00, 0x9a, 0x5c, 0x09, 0x02, 0x91, 0x00, 
+	0x40, 0x1a, 0x00, 0x8c, 0x46, 0x8f, 0xe7, 0x01, 0x01, 0x26, 0xee, 0x60, 0x00, 0xf0, 0x33, 0xfe, 
+	0x11, 0xeb, 0x04, 0xa0, 0xfe, 0x26, 0x4b, 0x1c, 0x00, 0x0d, 0x0a, 0xfe, 0x41, 0x22, 0x07, 0x18, 
+	0x24, 0x49, 0x00, 0xf0, 0xa3, 0x00, 0xd0, 0x14, 0x30, 0x00, 0x23, 0x00, 0x09, 0x9e, 0x00, 0x09, 
+	0x02, 0x20, 0x51, 0x21, 0x00, 0x09, 0x99, 0x00, 0x09, 0x03, 0x20, 0x20, 0x00, 0x09, 0x45, 0x94, 
+	0x00, 0x09, 0x04, 0x20, 0x1e, 0x00, 0x09, 0x8f, 0x00, 0x09, 0x10, 0x13, 0x20, 0x1d, 0x00, 0x09, 
+	0x8a, 0xff, 0x08, 0xf0, 0x10, 0xaa, 0xfd, 0xfc, 0x01, 0xf3, 0xfc, 0xfb, 0x03, 0x02, 0x82, 0x12, 
+	0x1f, 0x08, 0xfc, 0x03, 0x02, 0xc8, 0x05, 0x3a, 0x88, 0x0a, 0x2d, 0x00, 0x03, 0x8c, 0x00, 0x03, 
+	0x60, 0x45, 0x07, 0xce, 0x00, 0xed, 0x66, 0x66, 0xff, 0x7f, 0x00, 0x00, 0x50, 0xc0, 0x05, 0x63, 
+	0x04, 0x0b, 0x04, 0x00, 0xf0, 0x00, 0x06, 0xd0, 0x0a, 0xf8, 0x00, 0x06, 0x98, 0x07, 0x27, 0x9c, 
+	0x00, 0x27, 0x70, 0x00, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x0c, 0xc0, 0x00, 0x06, 
+	0x20, 0x00, 0x03, 0x12, 0x6f, 0x58, 0x9a, 0x15, 0x00, 0x08, 0x67, 0x00, 0x03, 0x78, 0x00, 0x03, 
+	0x94, 0x00, 0x03, 0x50, 0xac, 0x00, 0x03, 0xc7, 0x00, 0x03, 0x70, 0x47, 0x70, 0xb5, 0x01, 0x05, 
+	0x00, 0x48, 0x1e, 0x40, 0x19, 0x0c, 0x02, 0xed, 0x02, 0x1e, 0xfd, 0x60, 0x43, 0x40, 0x1b, 0x35, 
+	0x0d, 0x43, 0x10, 0x1e, 0x98, 0x41, 0x04, 0x29, 0x48, 0x70, 0x47, 0x8a, 0x7b, 0x95, 0x05, 0xbe, 
+	0x00, 0x07, 0x10, 0x57, 0x10, 0x07, 0xd9, 0x00, 0x37, 0x10, 0x07, 0x60, 0xde, 0x40, 0x07, 0x90, 
+	0x0f, 0xf0, 0xb5, 0x04, 0x04, 0x05, 0x00, 0x0c, 0x0e, 0x00, 0x01, 0x20, 0x91, 0xb0, 0x24, 0x10, 
+	0x0c, 0x00, 0x29, 0x08, 0x17, 0x2a, 0x05, 0xd1, 0x28, 0x0c, 0x04, 0x20, 0x43, 0x11, 0x04, 0x03, 
+	0x10, 0x57, 0x48, 0x4b, 0x00, 0x11, 0x00, 0x9a, 0x42, 0x00, 0xd9, 0x19, 0x00, 0x00, 0x50, 0x1a, 
+	0x0b, 0x00, 0x0e, 0x90, 0x0f, 0x2a, 0x00, 0x72, 0xd9, 0x32, 0x00, 0x73, 0x18, 0x0f, 0x93, 0x00, 
+	0x13, 0x78, 0x1b, 0x19, 0x00, 0x93, 0x00, 0x98, 0x00, 0x53, 0x78, 0x1b, 0x18, 0x01, 0x93, 0x01, 
+	0x98, 0x41, 0x93, 0x00, 0x07, 0x02, 0x93, 0x02, 0x98, 0xd3, 0x00, 0x07, 0x00, 0x03, 0x93, 0x03, 
+	0x98, 0x13, 0x79, 0x1b, 0x18, 0x04, 0x04, 0x93, 0x04, 0x98, 0x53, 0x00, 0x07, 0x05, 0x93, 0x10, 
+	0x05, 0x98, 0x93, 0x00, 0x07, 0x06, 0x93, 0x06, 0x98, 0x40, 0xd3, 0x00, 0x07, 0x07, 0x93, 0x07, 
+	0x98, 0x13, 0x7a, 0x01, 0x1b, 0x18, 0x08, 0x93, 0x08, 0x98, 0x53, 0x00, 0x07, 0x04, 0x09, 0x93, 
+	0x09, 0x98, 0x93, 0x00, 0x07, 0x0a, 0x93, 0x00, 0xd3, 0x7a, 0x0a, 0x98, 0x84, 0x46, 0x9c, 0x44, 
+	0x00, 0x63, 0x46, 0x17, 0x7b, 0x0b, 0x93, 0xff, 0x18, 0x00, 0x53, 0x7b, 0x90, 0x7b, 0xdb, 0x19, 
+	0x0c, 0x93, 0x10, 0xc3, 0x18, 0x01, 0x00, 0x17, 0xd4, 0x7b, 0x0d, 0x93, 0x00, 0xe4, 0x18, 0x00, 
+	0x9b, 0x02, 0x98, 0x63, 0x44, 0xb5, 0x00, 0x65, 0x98, 0x00, 0x61, 0x00, 0x03, 0x05, 0x00, 0x03, 
+	0x06, 0x00, 0x03, 0x55, 0x07, 0x00, 0x03, 0x08, 0x00, 0x03, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x03, 
+	0x40, 0x0b, 0x00, 0x03, 0x0c, 0x98, 0xdb, 0x19, 0x1b, 0x18, 0x40, 0x0d, 0x00, 0x09, 0x1b, 0x19, 
+	0xed, 0x18, 0x0f, 0x9b, 0x00, 0x10, 0x32, 0x9b, 0x1a, 0x0f, 0x2b, 0xa0, 0xdc, 0x00, 0x08, 0x00, 
+	0x10, 0x38, 0x10, 0x23, 0x02, 0x09, 0x00, 0x0f, 0x29, 0x01, 0xdd, 0x53, 0x1c, 0x1b, 0x01, 0x08, 
+	0xf6, 0x18, 0x00, 0x23, 0x10, 0x0b, 0x12, 0x01, 0x53, 0x00, 0x42, 0x1b, 0x18, 0x00, 0x2b, 0x07, 
+	0xd0, 0x32, 0x08, 0x00, 0xf6, 0x18, 0x11, 0x07, 0xc3, 0x64, 0x18, 0x2d, 0x21, 0x19, 0x96, 0x08, 
+	0x47, 0x20, 0x00, 0x06, 0x49, 0x02, 0xab, 0x02, 0xfc, 0x28, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x09, 
+	0x9d, 0x00, 0xfc, 0x0e, 0x9a, 0x0d, 0x00, 0x66, 0xe7, 0xb0, 0x00, 0x15, 0x00, 0x00, 0xf1, 0xff, 
+	0x00, 0x00, 0x10, 0x06, 0xb5, 0x08, 0xf0, 0x73, 0xfa, 0x36, 0xe3, 0x10, 0x0b, 0x87, 0x54, 0xfc, 
+	0x70, 0x0b, 0x8b, 0x80, 0x17, 0xe5, 0x40, 0x0b, 0x03, 0x22, 0x00, 0x21, 0x4b, 0x52, 0x42, 0x30, 
+	0xb5, 0x1a, 0x60, 0x14, 0x01, 0x32, 0x5a, 0x00, 0x03, 0x9a, 0x06, 0x8b, 0x91, 0xb0, 0x00, 0x01, 
+	0xaa, 0x9b, 0x54, 0x01, 0x33, 0x10, 0x2b, 0x40, 0xfb, 0x06, 0xf1, 0x00, 0x93, 0x03, 0x2b, 0x05, 
+	0xd9, 0x01, 0x01, 0x20, 0x40, 0x42, 0x11, 0xb0, 0x30, 0x37, 0x71, 0x00, 0xaa, 0xd4, 0x18, 0x13, 
+	0x00, 0x22, 0x00, 0x28, 0x40, 0x33, 0x33, 0x03, 0x20, 0x1d, 0x05, 0x00, 0x20, 0x22, 0x80, 0x06, 
+	0x2d, 0xf0, 0xba, 0xfa, 0x23, 0x68, 0x21, 0x00, 0x00, 0x1b, 0x1b, 0x5a, 0x42, 0x53, 0x41, 0x28, 
+	0x00, 0x00, 0x24, 0x31, 0x04, 0xc8, 0x55, 0x42, 0x6a, 0x41, 0x10, 0x13, 0x40, 0x81, 0x00, 0xb9, 
+	0x62, 0x6a, 0x12, 0x1b, 0x80, 0x14, 0x87, 0x13, 0x42, 0xd8, 0xd0, 0x02, 0x9b, 0x03, 0x00, 0x98, 
+	0x5a, 0x1e, 0x93, 0x41, 0x42, 0x1e, 0x90, 0x00, 0x41, 0x18, 0x40, 0x01, 0x38, 0xd1, 0xe7, 0x64, 
+	0x80, 0x06, 0x4b, 0xf8, 0xb5, 0x01, 0x25, 0x04, 0x00, 0x10, 0x00, 0x00, 0x1a, 0x00, 0x1d, 0x4b, 
+	0x06, 0x9f, 0x07, 0x21, 0x9e, 0xdd, 0x03, 0xff, 0x30, 0xd0, 0x4b, 0x1c, 0x06, 0x19, 0x08, 0x29, 
+	0x2c, 0xd1, 0x43, 0x00, 0x07, 0x04, 0x28, 0x28, 0x21, 0xd1, 0x53, 0x10, 0x07, 0x2a, 0x24, 0xd1, 
+	0x7b, 0x10, 0x07, 0x08, 0x2f, 0x20, 0xd1, 0x73, 0x10, 0x07, 0x2e, 0x1c, 0xd1, 0x00, 0x08, 0x9b, 
+	0x01, 0x33, 0x02, 0xd0, 0x08, 0x9b, 0x05, 0x04, 0x2b, 0x16, 0xd1, 0x09, 0x20, 0x0b, 0x09, 0x00, 
+	0x0b, 0x14, 0x10, 0xd1, 0x0a, 0x20, 0x0b, 0x0a, 0x00, 0x0b, 0x0a, 0xd1, 0x50, 0x0b, 0x20, 0x0b, 
+	0x0b, 0x00, 0x0b, 0x04, 0xd1, 0xff, 0xf7, 0x1b, 0x81, 0xff, 0xf8, 0x20, 0xcf, 0x10, 0xdb, 0xf9, 
+	0x03, 0x43, 0x10, 0x83, 0x00, 0xf0, 0xb5, 0x8b, 0xb0, 0x94, 0x46, 0x00, 0x90, 0x00, 0x02, 0x91, 
+	0x09, 0x93, 0x0d, 0x29, 0x11, 0xd8, 0x00, 0x00, 0x29, 0x00, 0xd0, 0x48, 0xe1, 0x13, 0x00, 0x40, 
+	0x11, 0x03, 0xa4, 0x1a, 0x70, 0x62, 0x46, 0x58, 0x70, 0x00, 0x98, 0x70, 0x03, 0x33, 0x9b, 0x1a, 
+	0x09, 0x9a, 0x10, 0x13, 0x60, 0x0b, 0x42, 0x9d, 0x00, 0x9a, 0x02, 0x9b, 0x41, 0xd3, 0x02, 0x6d, 
+	0x02, 0x9b, 0x0d, 0x3b, 0xd3, 0x02, 0x65, 0x00, 0x13, 0x00, 0x01, 0x93, 0x63, 0x46, 0x04, 0x32, 
+	0x00, 0xd1, 0x78, 0x04, 0x91, 0x91, 0x78, 0x06, 0x91, 0x00, 0x51, 0x78, 0x07, 0x91, 0x11, 0x78, 
+	0x08, 0x91, 0x00, 0x04, 0x99, 0x88, 0x01, 0x06, 0x99, 0x48, 0x40, 0x01, 0x07, 0x99, 0x40, 0x01, 
+	0x48, 0x40, 0x08, 0x20, 0x05, 0x00, 0x21, 0x21, 0x41, 0x43, 0x48, 0x09, 0x10, 0x9d, 0x00, 0x81, 
+	0x04, 0x8c, 0x0c, 0x09, 0x0c, 0x49, 0x59, 0x00, 0x00, 0x9d, 0xa9, 0x42, 0x40, 0xd3, 0x57, 0x1a, 
+	0x00, 0x96, 0x4d, 0x7e, 0x1e, 0xae, 0x42, 0x3b, 0xd8, 0x00, 0x80, 0x25, 0x2d, 0x01, 0xaf, 0x42, 
+	0x1a, 0xd9, 0x00, 0xcd, 0x78, 0x04, 0x9e, 0xb5, 0x42, 0x16, 0xd0, 0x00, 0x91, 0x4c, 0x40, 0x05, 
+	0x40, 0x0d, 0x44, 0x40, 0x00, 0x10, 0x98, 0xa1, 0x00, 0x09, 0x58, 0x00, 0x9e, 0x00, 0x8e, 0x42, 
+	0x29, 0xd8, 0x57, 0x1a, 0x8b, 0x4d, 0x01, 0x78, 0x1e, 0xa8, 0x42, 0x24, 0xd8, 0x80, 0x06, 0xa2, 
+	0x00, 0x87, 0x42, 0x03, 0xd9, 0xc8, 0x78, 0x04, 0x9d, 0x24, 0xa8, 0x42, 0x01, 0x13, 0x78, 0x08, 
+	0x00, 0x07, 0x18, 0xd1, 0x10, 0x48, 0x78, 0x07, 0x00, 0x07, 0x14, 0xd1, 0x88, 0x78, 0x40, 0x06, 
+	0x00, 0x07, 0x10, 0xd1, 0x10, 0x98, 0xa4, 0x00, 0x00, 0x22, 0x50, 0x01, 0x98, 0x10, 0x1a, 0x00, 
+	0x28, 0x00, 0x21, 0xdd, 0x03, 0x28, 0x10, 0xdc, 0x9e, 0x1e, 0x00, 0x34, 0x78, 0x04, 0x43, 0x34, 
+	0x70, 0x11, 0xe0, 0x00, 0x01, 0x90, 0x02, 0x00, 0xa1, 0xe7, 0x10, 0x99, 0x00, 0xa4, 0x00, 0x62, 
+	0x50, 0x50, 0x1c, 0x05, 0x9a, 0x00, 0x82, 0x42, 0xf6, 0xd8, 0x01, 0x98, 0x2a, 0xe0, 0x00, 0x5e, 
+	0x1c, 0x12, 0x28, 0x4a, 0xd8, 0xc4, 0x1e, 0x00, 0x1c, 0x70, 0x33, 0x00, 0x00, 0x24, 0x01, 0x9d, 
+	0x01, 0x2e, 0x5d, 0x1e, 0x55, 0x01, 0x34, 0xa0, 0x01, 0xd9, 0x00, 0x01, 0x92, 0x1b, 0x18, 0xcc, 
+	0x78, 0xd0, 0x78, 0x00, 0x84, 0x42, 0x47, 0xd0, 0x10, 0x1d, 0x80, 0x21, 0x00, 0x01, 0x9a, 0x01, 
+	0x38, 0x82, 0x1a, 0x12, 0x06, 0x00, 0x12, 0x0e, 0x09, 0x01, 0x8f, 0x42, 0x71, 0xd8, 0x00, 0x1c, 
+	0x26, 0x01, 0x3f, 0x01, 0x3a, 0xbc, 0x00, 0x00, 0x52, 0x01, 0x34, 0x40, 0x22, 0x43, 0xf9, 0x08, 
+	0x02, 0x1a, 0x70, 0x59, 0x70, 0x02, 0x33, 0x10, 0x59, 0xc8, 0x00, 0xd8, 0x62, 0x46, 0x09, 0x99, 
+	0x9a, 0x1a, 0x0a, 0x00, 0x60, 0x03, 0x9a, 0x03, 0x99, 0x12, 0x1a, 0x81, 0x80, 0x06, 0xf7, 0x49, 
+	0xe7, 0x02, 0x99, 0x00, 0x98, 0x89, 0x00, 0x1a, 0x41, 0x18, 0x00, 0x91, 0x59, 0x1c, 0x9c, 0x00, 
+	0x45, 0x00, 0xd0, 0x8b, 0xe0, 0xee, 0x2a, 0x00, 0x00, 0xd9, 0x95, 0xe0, 0x11, 0x00, 0x11, 0x31, 
+	0x19, 0x40, 0x70, 0x06, 0xab, 0x21, 0x00, 0x98, 0x40, 0x5c, 0x58, 0x08, 0x54, 0x01, 0x31, 0x8a, 
+	0x00, 0x7d, 0x9b, 0x18, 0x30, 0x28, 0xe7, 0x00, 0x02, 0x37, 0x1d, 0x00, 0x97, 0x12, 0x3c, 0x1e, 
+	0x00, 0x00, 0x01, 0x33, 0xff, 0x2c, 0x9a, 0xd9, 0x00, 0x00, 0x25, 0xff, 0x3c, 0x35, 0x70, 0xf7, 
+	0xe7, 0x0c, 0x00, 0x79, 0x10, 0x79, 0x84, 0x42, 0x01, 0xd0, 0x50, 0x02, 0x1d, 0xb2, 0xe7, 0x4c, 
+	0x79, 0x50, 0x20, 0x0b, 0x90, 0x02, 0x1d, 0xac, 0xe7, 0x8c, 0x79, 0x90, 0x20, 0x0b, 0xd0, 0x03, 
+	0x1d, 0xa6, 0xe7, 0xcc, 0x79, 0xd0, 0x00, 0x0b, 0x02, 0x3b, 0x00, 0x32, 0x10, 0x00, 0x9f, 0xe7, 
+	0x10, 0x00, 0x0c, 0x00, 0x7a, 0x12, 0x7a, 0x09, 0x30, 0x94, 0x42, 0x99, 0x08, 0xd1, 0x09, 0x31, 
+	0x03, 0x00, 0xa5, 0x03, 0xd9, 0x0c, 0x00, 0x78, 0x02, 0x78, 0x94, 0x42, 0x28, 0xd0, 0x80, 0x00, 
+	0x24, 0x01, 0x9a, 0x59, 0x1c, 0x82, 0x1a, 0xe4, 0x00, 0x01, 0xa7, 0x42, 0x28, 0xd8, 0x20, 0x26, 
+	0x7c, 0x00, 0x1e, 0x21, 0x2a, 0x20, 0xd8, 0x02, 0x3a, 0x18, 0x04, 0xe0, 0x80, 0x24, 0x02, 0x3a, 
+	0x10, 0xf1, 0x59, 0x1c, 0xa0, 0x10, 0x1b, 0x09, 0x00, 0x1b, 0x16, 0x43, 0x1e, 0x70, 0x7c, 0x00, 
+	0x1e, 0xa3, 0x00, 0xa4, 0x09, 0x0b, 0x70, 0x4c, 0x00, 0x70, 0x8b, 0x1c, 0x86, 0xe7, 0x23, 0x4c, 
+	0x3c, 0x00, 0x19, 0x08, 0x27, 0xe6, 0x0a, 0x3e, 0x40, 0x16, 0x00, 0x43, 0x10, 0x22, 0x32, 0x43, 
+	0x1a, 0x70, 0xef, 0x00, 0xe7, 0x01, 0x31, 0x01, 0x30, 0xcc, 0xe7, 0x21, 0x00, 0x3a, 0x1e, 0x70, 
+	0x00, 0x26, 0x0f, 0xe0, 0x08, 0x20, 0x26, 0x1a, 0x00, 0x23, 0xe7, 0x0a, 0x37, 0x40, 0xb6, 0x08, 
+	0x19, 0x09, 0x2a, 0x02, 0x00, 0x59, 0x3a, 0x43, 0xea, 0x00, 0xe7, 0x09, 0x3a, 0x3e, 0x43, 0xee, 
+	0xe7, 0x1e, 0x00, 0x70, 0xff, 0x3a, 0x0b, 0x00, 0x01, 0x31, 0xff, 0x00, 0x2a, 0xf9, 0xd8, 0xe1, 
+	0xe7, 0x63, 0x46, 0x02, 0x00, 0x9a, 0x76, 0xe7, 0x03, 0x2a, 0x04, 0xd8, 0x98, 0x00, 0x1e, 0x01, 
+	0x78, 0x11, 0x43, 0x01, 0x70, 0x73, 0x00, 0xe7, 0x12, 0x2a, 0x03, 0xd8, 0xd0, 0x1e, 0x18, 0x00, 
+	0x70, 0x0b, 0x00, 0x6d, 0xe7, 0x00, 0x24, 0x10, 0x24, 0x00, 0x1c, 0x00, 0x09, 0x12, 0x38, 0x07, 
+	0xd5, 0x33, 0xff, 0x00, 0x28, 0x01, 0xd8, 0x08, 0x70, 0x62, 0xe7, 0x0c, 0x00, 0x70, 0xff, 0x38, 
+	0xf6, 0xe7, 0xfe, 0xbf, 0x00, 0x14, 0x00, 0x1f, 0x20, 0x05, 0x97, 0xc0, 0x06, 0xac, 0xb5, 0x00, 
+	0x50, 0x90, 0x09, 0x73, 0x91, 0x0a, 0x83, 0x99, 0x09, 0x78, 0x11, 0x00, 0x29, 0x0d, 0xd9, 0x00, 
+	0x9c, 0x11, 0x39, 0x16, 0x00, 0x00, 0x65, 0x1c, 0x03, 0x29, 0x38, 0xdd, 0x2c, 0x02, 0x5c, 0x14, 
+	0x54, 0x01, 0x30, 0x81, 0x0c, 0x3d, 0x6d, 0x04, 0x18, 0x50, 0x18, 0x16, 0xe0, 0x05, 0xcc, 0x9d, 
+	0x29, 0x02, 0x78, 0x6c, 0x1c, 0x0f, 0x29, 0x59, 0x03, 0x19, 0x4f, 0x00, 0xd0, 0x25, 0x78, 0x05, 
+	0x70, 0x65, 0x78, 0x45, 0x00, 0x70, 0xa5, 0x78, 0x85, 0x70, 0x03, 0x25, 0x03, 0x00, 0x31, 0x66, 
+	0x5d, 0x46, 0x55, 0x01, 0x35, 0xa9, 0x84, 0x00, 0x2f, 0x65, 0x18, 0x40, 0x18, 0x00, 0x29, 0x78, 
+	0x0f, 0x00, 0x29, 0x43, 0xd8, 0xa4, 0x00, 0x89, 0x08, 0x09, 0x00, 0x19, 0x53, 0x4c, 0x41, 0x1a, 
+	0x09, 0x19, 0x0c, 0x00, 0x78, 0x04, 0x70, 0x4c, 0x78, 0x44, 0x70, 0x89, 0x00, 0x78, 0x02, 0x35, 
+	0x81, 0x70, 0x03, 0x30, 0xa9, 0x00, 0x1e, 0x0e, 0x78, 0x03, 0x24, 0x31, 0x00, 0x21, 0x04, 0x40, 
+	0x26, 0x42, 0xd1, 0xd0, 0x0e, 0xdd, 0x20, 0x2c, 0x08, 0x5c, 0x07, 0x00, 0x34, 0x20, 0x75, 0xf9, 
+	0xd1, 0xe8, 0x00, 0x19, 0x84, 0x46, 0x64, 0x46, 0x70, 0x18, 0x69, 0x00, 0x5c, 0x02, 0x34, 0x3f, 
+	0x29, 0x56, 0xd9, 0xcf, 0x00, 0x06, 0x7f, 0x0f, 0xff, 0x43, 0x65, 0x1c, 0x24, 0x00, 0x78, 0xe4, 
+	0x00, 0x3f, 0x1b, 0x4e, 0x09, 0xc7, 0x00, 0x19, 0x01, 0x3e, 0x39, 0x78, 0x01, 0x70, 0x79, 0x00, 
+	0x78, 0x41, 0x70, 0x02, 0x21, 0x02, 0x36, 0x7c, 0x28, 0x5c, 0x44, 0x02, 0x15, 0x8e, 0x00, 0x7f, 
+	0x80, 0x19, 0xd1, 0x04, 0xe7, 0xff, 0x31, 0x25, 0x78, 0x09, 0x69, 0x2d, 0xfa, 0x00, 0xd0, 0x0f, 
+	0x35, 0x49, 0x19, 0xa8, 0xe7, 0x6c, 0x00, 0x1c, 0x3f, 0x29, 0xdd, 0xd8, 0x1f, 0x29, 0x34, 0x80, 
+	0x03, 0x55, 0xce, 0x02, 0xed, 0x01, 0x2e, 0x40, 0xb4, 0x00, 0x46, 0x07, 0x25, 0x0e, 0x00, 0x2e, 
+	0x40, 0x29, 0x00, 0x42, 0x0b, 0xd1, 0x26, 0x02, 0xa6, 0x1b, 0x21, 0x10, 0x78, 0x27, 0x00, 0x00, 
+	0x31, 0x29, 0xfa, 0xd0, 0xff, 0x00, 0x25, 0x7d, 0x43, 0x07, 0x31, 0xae, 0x19, 0x8e, 0x00, 0x19, 
+	0x21, 0x78, 0x65, 0x78, 0x89, 0x08, 0xad, 0x00, 0x01, 0x49, 0x19, 0x61, 0x44, 0xa5, 0x1c, 0x22, 
+	0x80, 0x00, 0xc5, 0x0f, 0x19, 0x81, 0x42, 0xc3, 0xd1, 0x01, 0x00, 0x9c, 0xa4, 0x46, 0x00, 0x99, 
+	0x80, 0x1a, 0x61, 0x4a, 0x44, 0x01, 0x3b, 0x20, 0xa9, 0x0a, 0x47, 0x08, 0x00, 0x05, 0x00, 0x30, 
+	0xd8, 0x04, 0x04, 0x4d, 0x3b, 0xbf, 0x1f, 0x29, 0x19, 0xd9, 0x41, 0x1f, 0x60, 0x5f, 0x21, 0x02, 
+	0x61, 0x1a, 0x26, 0x30, 0x5f, 0x40, 0x2e, 0x30, 0x5f, 0x1f, 0x36, 0x6d, 0x18, 0x76, 0x19, 0x00, 
+	0x27, 0x78, 0x61, 0x78, 0xbf, 0x08, 0x89, 0x01, 0x00, 0x7f, 0x18, 0xff, 0x43, 0xa5, 0x1c, 0xc7, 
+	0x19, 0x00, 0x96, 0xe7, 0x0f, 0x29, 0xae, 0xd8, 0x64, 0x46, 0x10, 0xe5, 0x1c, 0xa4, 0x00, 0x77, 
+	0xa4, 0x00, 0x61, 0x18, 0x00, 0xc9, 0x43, 0x44, 0x18, 0x41, 0x5c, 0x01, 0x70, 0x00, 0x61, 0x78, 
+	0x03, 0x37, 0x41, 0x70, 0xf0, 0x19, 0x42, 0x64, 0x04, 0xab, 0xff, 0xf7, 0xff, 0xff, 0x11, 0xbf, 
+	0x9c, 0x00, 0x46, 0xf0, 0xb5, 0x1e, 0x68, 0x85, 0xb0, 0x93, 0x10, 0x19, 0x64, 0x46, 0x0c, 0x43, 
+	0x23, 0x23, 0x60, 0x04, 0x00, 0x78, 0x45, 0x18, 0x11, 0x2c, 0x00, 0xd8, 0xff, 0x00, 0xe0, 0x27, 
+	0x00, 0x11, 0x3f, 0x01, 0x30, 0x03, 0x00, 0x2f, 0x00, 0xdc, 0xf7, 0xe0, 0xbe, 0x42, 0x00, 0x00, 
+	0xd2, 0x29, 0xe1, 0x01, 0x39, 0x10, 0x3c, 0xa1, 0x82, 0x00, 0x09, 0x22, 0xe1, 0xc1, 0x5c, 0xd1, 
+	0x05, 0xe1, 0x9f, 0x88, 0x01, 0x29, 0xd3, 0x19, 0xc4, 0x00, 0xe3, 0x0f, 0x29, 0x3d, 0x08, 0xd8, 
+	0xa0, 0x1c, 0x64, 0x40, 0x71, 0x8f, 0x4c, 0x59, 0xa0, 0x01, 0xab, 0x8a, 0x07, 0x71, 0x14, 0xe1, 
+	0x01, 0x9c, 0xe4, 0x20, 0x1a, 0x02, 0x00, 0x4f, 0x7b, 0xe0, 0x0c, 0x78, 0x1c, 0xa8, 0x01, 0xbb, 
+	0x5c, 0x01, 0xbb, 0x99, 0x05, 0x03, 0x81, 0x1e, 0x0c, 0x00, 0x78, 0x03, 0x21, 0x27, 0x00, 0x0f, 
+	0x40, 0x0c, 0x80, 0x03, 0xb5, 0xc9, 0xe0, 0x01, 0x99, 0xc9, 0x1a, 0xb9, 0x01, 0x42, 0x68, 0xd3, 
+	0x7c, 0x1c, 0x29, 0x1a, 0x10, 0x63, 0x00, 0x71, 0xe0, 0x00, 0x21, 0x44, 0x5c, 0x03, 0x91, 0x50, 
+	0x5c, 0x01, 0x91, 0x8f, 0x01, 0xcb, 0x03, 0x99, 0x41, 0x18, 0x00, 0x8c, 0x1c, 0xde, 0x19, 0x02, 
+	0x91, 0xc7, 0x5d, 0x00, 0xa5, 0x42, 0x3e, 0xd8, 0x33, 0x00, 0x07, 0x20, 0x00, 0x9b, 0x1a, 0x40, 
+	0x42, 0x33, 0xe0, 0xff, 0x31, 0x15, 0xb4, 0xe0, 0x01, 0x01, 0xdf, 0x38, 0x01, 0x9b, 0x4e, 0x04, 
+	0xc3, 0x01, 0xce, 0x02, 0xc0, 0x01, 0x06, 0x40, 0x0f, 0x00, 0x1f, 0x04, 0x02, 0x96, 0x07, 0x40, 
+	0x01, 0x04, 0xaf, 0x21, 0x00, 0x02, 0xa5, 0x42, 0x49, 0xd0, 0x0f, 0x78, 0x08, 0x23, 0x31, 0x00, 
+	0x00, 0x2f, 0x00, 0xd1, 0x75, 0xe0, 0xff, 0x20, 0x00, 0x46, 0x43, 0x20, 0x02, 0x20, 0x1a, 0x0c, 
+	0x00, 0x00, 0x30, 0x18, 0x07, 0x37, 0x3f, 0x18, 0x21, 0x78, 0x40, 0x60, 0x00, 0xbb, 0x80, 0x01, 
+	0x09, 0x18, 0x02, 0x98, 0x04, 0x09, 0x18, 0xa0, 0x1c, 0x5f, 0x00, 0xc1, 0x0e, 0x19, 0x00, 0x8b, 
+	0x42, 0x48, 0xd1, 0x9b, 0x1a, 0x85, 0x42, 0x00, 0x00, 0xd0, 0xa5, 0xe0, 0x00, 0x20, 0x62, 0x46, 
+	0x30, 0x13, 0x60, 0x1c, 0x55, 0x11, 0x9b, 0x39, 0x00, 0x3f, 0x2f, 0x00, 0x15, 0xd9, 0x33, 0x00, 
+	0xce, 0x06, 0x76, 0x0f, 0x10, 0xf6, 0x43, 0x60, 0x22, 0x51, 0x36, 0x1b, 0x49, 0x09, 0x04, 0x9e, 
+	0x19, 0x4f, 0x1e, 0xb2, 0x00, 0xf7, 0x98, 0xe0, 0x00, 0x01, 0x9c, 0x01, 0x31, 0xe4, 0x1a, 0x8c, 
+	0x42, 0x10, 0x2e, 0xd2, 0x05, 0x00, 0xa7, 0xaa, 0xe7, 0x1f, 0x2f, 0x4d, 0x36, 0x00, 0x2f, 0x1f, 
+	0x20, 0x00, 0x97, 0x00, 0x93, 0x14, 0x20, 0x93, 0x40, 0x04, 0x00, 0x5d, 0x04, 0x20, 0x9c, 0xe7, 
+	0x8d, 0x42, 0x90, 0x02, 0x63, 0x78, 0x08, 0x20, 0x9d, 0xf8, 0xd0, 0xff, 0x26, 0x20, 0x70, 0x43, 
+	0x12, 0x4d, 0x0c, 0x00, 0x80, 0x19, 0x1f, 0xa8, 0x00, 0x9b, 0x26, 0x01, 0xe1, 0xb6, 0x01, 0xe1, 
+	0x76, 0x18, 0xf6, 0x08, 0x43, 0xa0, 0x1c, 0x9e, 0x07, 0xc7, 0x69, 0xd3, 0x01, 0x08, 0x99, 0xbc, 
+	0x1c, 0xc9, 0x01, 0x27, 0xd0, 0xd3, 0x31, 0x04, 0x78, 0x19, 0x70, 0x71, 0x78, 0x05, 0x11, 0x21, 
+	0x02, 0x10, 0x37, 0x74, 0x5c, 0x31, 0x2d, 0xfa, 0xd1, 0xdb, 0x19, 0x05, 0x4e, 0xe7, 0x0f, 0x2f, 
+	0x05, 0x00, 0x71, 0x76, 0x00, 0x5d, 0x04, 0x00, 0xd0, 0x80, 0xe7, 0xc9, 0x05, 0x17, 0xc8, 0x1c, 
+	0x40, 0x89, 0x12, 0x2b, 0x00, 0xc9, 0x19, 0xc9, 0x43, 0x71, 0x04, 0x18, 0x8a, 0x42, 0x44, 0xd8, 
+	0x02, 0x85, 0x1b, 0x01, 0x20, 0x2c, 0x3e, 0x04, 0xa1, 0x34, 0x70, 0x03, 0x9c, 0x49, 0x00, 0x78, 
+	0x03, 0x34, 0x71, 0x70, 0x1b, 0x19, 0x30, 0x08, 0xe7, 0x13, 0x00, 0x36, 0x00, 0x03, 0xa8, 0x42, 
+	0x00, 0x02, 0xd3, 0x4b, 0xe7, 0x01, 0x78, 0x44, 0x03, 0xb1, 0x00, 0x00, 0xd9, 0x4d, 0xe7, 0x00, 
+	0x29, 0x08, 0xd1, 0xa5, 0x08, 0x42, 0xa4, 0xd0, 0x20, 0x13, 0x17, 0x28, 0x00, 0xd1, 0x04, 0x41, 
+	0xe7, 0x0f, 0x30, 0x09, 0x08, 0xd3, 0xce, 0x1c, 0x00, 0xc0, 0x1a, 0xb0, 0x42, 0x8a, 0xd3, 0x0f, 
+	0x1d, 0x00, 0x28, 0x1b, 0xb8, 0x42, 0x94, 0xd3, 0x20, 0x78, 0x00, 0x18, 0x70, 0x60, 0x78, 0x58, 
+	0x70, 0xa0, 0x78, 0x85, 0x06, 0xed, 0x20, 0x27, 0x5c, 0x1f, 0x03, 0x8f, 0x86, 0x00, 0x95, 0x00, 
+	0x03, 0x31, 0x5b, 0x18, 0x64, 0x18, 0xe7, 0xe6, 0x01, 0x85, 0x42, 0x83, 0xd9, 0x08, 0x20, 0x20, 
+	0x00, 0x61, 0x41, 0x7e, 0x00, 0x03, 0x6e, 0xe7, 0x33, 0x00, 0x6c, 0x00, 0x03, 0x50, 0x06, 0x01, 
+	0x27, 0x16, 0x82, 0x9b, 0x03, 0x00, 0x2a, 0x38, 0x00, 0x2a, 0x2b, 0x07, 0xdc, 0x04, 0x4a, 0x20, 
+	0x2b, 0x00, 0x00, 0xda, 0x20, 0x23, 0xd3, 0x18, 0x20, 0x3b, 0x00, 0x18, 0x78, 0x2a, 0x38, 0x70, 
+	0x47, 0xc0, 0x46, 0x40, 0x8f, 0x0a, 0x1f, 0xf7, 0xb5, 0x1d, 0x28, 0x2c, 0xdc, 0x00, 0x7f, 0x27, 
+	0x17, 0x4a, 0x43, 0x00, 0x9e, 0x18, 0x04, 0x17, 0x4a, 0x17, 0x4d, 0x9b, 0x09, 0xc3, 0x45, 0x19, 
+	0x00, 0x2c, 0x78, 0x20, 0x00, 0x33, 0x88, 0x38, 0x40, 0x40, 0x00, 0x0d, 0xa5, 0xdd, 0xff, 0xa0, 
+	0x23, 0xe4, 0x09, 0x00, 0xdb, 0x01, 0x00, 0x9a, 0x24, 0x03, 0xc0, 0x18, 0x00, 0x24, 0x18, 0x24, 
+	0x04, 0x2a, 0x32, 0x24, 0x0c, 0x00, 0x3a, 0x40, 0x2a, 0x2a, 0x00, 0xd1, 0x0a, 0x3a, 0x00, 0x0c, 
+	0x49, 0x8c, 0x46, 0x80, 0x21, 0x00, 0x9b, 0x00, 0x63, 0x44, 0x5b, 0x11, 0x0b, 0x40, 0x9b, 0x18, 
+	0x00, 0x2b, 0x70, 0x01, 0x9b, 0x34, 0x80, 0x40, 0x36, 0x01, 0x1e, 0x35, 0xb3, 0x42, 0xdb, 0xd1, 
+	0xf7, 0x2e, 0x3f, 0x02, 0xc0, 0x46, 0xc0, 0x4a, 0x00, 0x06, 0x0a, 0xf8, 0x06, 0x02, 0x10, 0x9a, 
+	0x02, 0x02, 0x00, 0xb0, 0x14, 0xf3, 0x19, 0x80, 0x0f, 0x09, 0x01, 0x93, 0x07, 0x23, 0x3f, 0x26, 
+	0xd4, 0x00, 0x17, 0x17, 0x4f, 0x1c, 0x40, 0xa4, 0x18, 0x3a, 0x20, 0x68, 0xd5, 0x0f, 0xa7, 0xad, 
+	0x18, 0xe4, 0x10, 0xed, 0x00, 0x10, 0x34, 0x40, 0x35, 0x40, 0xac, 0x42, 0x05, 0x0c, 0xd1, 0x3b, 
+	0x68, 0x01, 0x07, 0xe5, 0x30, 0x45, 0x2b, 0x1b, 0x00, 0x33, 0x40, 0x20, 0x2b, 0x0c, 0xd9, 0x01, 
+	0x3c, 0x20, 0x01, 0x3d, 0x30, 0x1f, 0xef, 0xd0, 0x1f, 0x20, 0x20, 0x00, 0x40, 0x01, 0x3c, 0xff, 
+	0xf7, 0x9b, 0xff, 0x34, 0x10, 0x40, 0xf6, 0xe7, 0x20, 0x0d, 0x34, 0xff, 0xf7, 0x94, 0x81, 0x00, 
+	0x0d, 0xa5, 0x42, 0xf7, 0xd1, 0xdf, 0xe7, 0x0b, 0x6b, 0x40, 0x02, 0x1b, 0x47, 0x10, 0xb5, 0x05, 
+	0x4b, 0x5b, 0x68, 0x00, 0x05, 0x4a, 0x58, 0x33, 0x13, 0x60, 0x07, 0xf0, 0x1a, 0xae, 0xff, 0x10, 
+	0x40, 0x97, 0x10, 0x1f, 0xac, 0x20, 0x1f, 0xff, 0x02, 0xf7, 0xed, 0xff, 0x07, 0xf0, 0xc5, 0x00, 
+	0x9a, 0xb1, 0xd4, 0x40, 0x1d, 0x10, 0x13, 0xe3, 0x00, 0x0f, 0xa9, 0x60, 0x0f, 0x03, 0x48, 0x04, 
+	0x03, 0x49, 0x07, 0xf0, 0x43, 0x40, 0x0f, 0x24, 0xa2, 0xa0, 0x0b, 0x3f, 0x40, 0x00, 0xd3, 0xb5, 
+	0x40, 0x22, 0x03, 0x49, 0x20, 0x04, 0x48, 0x90, 0x57, 0xe0, 0xa8, 0x00, 0x08, 0xa0, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x21, 0x0e, 0x4b, 0x10, 0x02, 0xb5, 0x19, 0x70, 0x80, 0x23, 0x87, 0x0d, 0x03, 
+	0x1a, 0x00, 0x68, 0x82, 0x43, 0x1a, 0x60, 0x80, 0x22, 0x18, 0x08, 0x68, 0xd2, 0x00, 0x02, 0x00, 
+	0x09, 0x08, 0x4b, 0x08, 0x03, 0x4a, 0x1a, 0x80, 0x58, 0x22, 0x08, 0x0d, 0x3b, 0x0f, 0xe7, 0x0a, 
+	0x80, 0xff, 0xf7, 0xcd, 0x00, 0x6f, 0xd7, 0x40, 0x45, 0x96, 0xa2, 0x00, 0x97, 0x0c, 0x0c, 0x27, 
+	0x04, 0x09, 0x00, 0x09, 0x8f, 0x00, 0x28, 0x04, 0x18, 0x00, 0x03, 0x02, 0x2f, 0x85, 0x02, 0x4a, 
+	0x93, 0x18, 0x60, 0x70, 0x47, 0x1e, 0x7f, 0x10, 0xbf, 0xf7, 0xb5, 0x1b, 0x00, 0x4f, 0x06, 0x00, 
+	0xfc, 0x68, 0x07, 0xf0, 0x66, 0x00, 0xff, 0x19, 0x4b, 0xbd, 0x68, 0x1b, 0x88, 0x1d, 0x00, 0x43, 
+	0x01, 0x93, 0xdb, 0x43, 0xed, 0x43, 0xbb, 0x00, 0x60, 0x00, 0x2e, 0x22, 0xd0, 0x6b, 0x06, 0x05, 
+	0x00, 0xd5, 0xa0, 0x19, 0x31, 0x00, 0x01, 0x38, 0x07, 0x00, 0xf0, 0x35, 0xff, 0x0c, 0x00, 0x2b, 
+	0x06, 0x04, 0x00, 0xd5, 0x60, 0x1c, 0x31, 0x00, 0x07, 0xf0, 0x2e, 0x80, 0x00, 0x0d, 0xeb, 0x06, 
+	0x03, 0xd5, 0x0a, 0x34, 0xa6, 0x8c, 0x0f, 0x7b, 0x74, 0x1e, 0xab, 0x10, 0x0b, 0x4f, 0x79, 0xc0, 
+	0x23, 0x04, 0x01, 0x9a, 0x9b, 0x00, 0x1a, 0x07, 0x9f, 0x05, 0x4b, 0x1e, 0x1d, 0x40, 0xfc, 0x0e, 
+	0x8d, 0x35, 0x51, 0x31, 0x33, 0x10, 0x7b, 0xff, 0x10, 0xfc, 0xff, 0xff, 0x01, 0x13, 0x07, 0x0b, 
+	0xd4, 0xc3, 0x00, 0x07, 0x03, 0xd5, 0x15, 0x4b, 0x1b, 0x68, 0xdb, 0x00, 0x05, 0x05, 0xd5, 0x83, 
+	0x07, 0x09, 0xd5, 0x12, 0x80, 0x40, 0x0b, 0x11, 0x4b, 0x11, 0x49, 0x12, 0x4a, 0x02, 0x2a, 0xc3, 
+	0x93, 0x0a, 0xa1, 0x43, 0x40, 0x27, 0x0b, 0x30, 0x1b, 0xd4, 0x04, 0x80, 0x07, 0x08, 0xd5, 0x08, 
+	0x20, 0x0b, 0x04, 0xd4, 0x04, 0x0a, 0x48, 0x0a, 0x4a, 0x0b, 0x01, 0x59, 0xd4, 0xfe, 0x00, 0x00, 
+	0x22, 0x0a, 0x4b, 0x5a, 0x60, 0xff, 0xf7, 0x7c, 0x41, 0x41, 0x03, 0x11, 0xbb, 0x42, 0x3b, 0x10, 
+	0x01, 0x22, 0x3f, 0x76, 0x02, 0x89, 0x06, 0xa2, 0x20, 0x20, 0x20, 0x10, 0x87, 0x01, 0x23, 0x01, 
+	0xd9, 0x00, 0x4a, 0x11, 0x78, 0x0b, 0x43, 0x13, 0x70, 0xff, 0x2a, 0xf7, 0x2e, 0x01, 0x3d, 0x24, 
+	0x61, 0x83, 0x93, 0x00, 0x3b, 0x01, 0x42, 0x21, 0x0f, 0x9d, 0x4a, 0x13, 0x78, 0x8b, 0x20, 0x1f, 
+	0x16, 0xc0, 0xa0, 0x1b, 0x07, 0x77, 0x24, 0x08, 0x27, 0x05, 0x00, 0xff, 0x02, 0xf7, 0xdc, 0xff, 
+	0x0c, 0x4e, 0x33, 0x02, 0x8d, 0x01, 0x00, 0x2d, 0x0d, 0xd1, 0x0b, 0x4b, 0x1c, 0x70, 0x01, 0x12, 
+	0x9a, 0x63, 0x01, 0x03, 0x07, 0x34, 0x33, 0x00, 0x89, 0xf2, 0x08, 0xfe, 0x09, 0x2c, 0xf2, 0x42, 
+	0xc7, 0x02, 0x2d, 0xf1, 0x00, 0xd1, 0x03, 0x4b, 0x3a, 0x1b, 0x1a, 0x70, 0xed, 0xf1, 0x03, 0x63, 
+	0x10, 0x9b, 0x11, 0xa3, 0x70, 0x47, 0xb8, 0xff, 0x0d, 0x40, 0x47, 0x12, 0x10, 0xd1, 0x0c, 0x40, 
+	0x47, 0xd3, 0x1a, 0x30, 0x47, 0xce, 0x81, 0x20, 0x47, 0x04, 0x20, 0xff, 0xf7, 0x65, 0xff, 0x50, 
+	0x4d, 0x12, 0xee, 0xd1, 0x02, 0x20, 0x4d, 0xea, 0xe7, 0x80, 0x4b, 0x91, 0x01, 0x80, 0x21, 0x1f, 
+	0x24, 0x01, 0x93, 0x2c, 0x01, 0x1b, 0x00, 0x49, 0x00, 0x0b, 0x40, 0xa0, 0x42, 0x1a, 0xdd, 0x00, 
+	0x00, 0x2b, 0x1a, 0xd1, 0x20, 0x40, 0x1e, 0x24, 0x00, 0x20, 0x25, 0x23, 0x00, 0x43, 0x43, 0x00, 
+	0x2a, 0x00, 0x01, 0xd0, 0x80, 0x22, 0x8a, 0x35, 0x44, 0x43, 0x00, 0x24, 0x49, 0x01, 0x33, 0x65, 
+	0x54, 0x5b, 0x18, 0x80, 0x39, 0x8d, 0x1f, 0x28, 0x36, 0xd8, 0x20, 0x22, 0x1d, 0x00, 0x29, 0x30, 
+	0xd0, 0x1a, 0x70, 0x01, 0x31, 0xfa, 0x00, 0xe7, 0x00, 0x2b, 0xe4, 0xd1, 0x1c, 0x4b, 0x04, 0x00, 
+	0x40, 0xa4, 0x01, 0xe4, 0x18, 0xa0, 0x23, 0x16, 0x00, 0x07, 0xdb, 0x05, 0xf6, 0x18, 0x36, 0x0c, 
+	0x00, 0x00, 0x2a, 0x08, 0xdb, 0x00, 0x23, 0x9a, 0x42, 0x03, 0x02, 0xd0, 0x33, 0x00, 0x55, 0x33, 
+	0x1b, 0x0f, 0xaf, 0x23, 0x10, 0x80, 0x02, 0x34, 0x09, 0xbd, 0xe0, 0xff, 0xf7, 0xe8, 0x00, 0xfd, 
+	0x30, 0x18, 0xe0, 0x53, 0x01, 0x35, 0x00, 0x00, 0x9b, 0x58, 0x5d, 0x6f, 0x00, 0x1f, 0x28, 0x04, 
+	0x00, 0xd9, 0x1d, 0x2d, 0x02, 0xd0, 0x01, 0x9b, 0x9d, 0x00, 0x42, 0xf0, 0xdb, 0x1d, 0x22, 0x52, 
+	0x1b, 0x00, 0x81, 0x0f, 0x4b, 0xe0, 0x19, 0x07, 0xf0, 0x88, 0xfc, 0x30, 0xc1, 0x44, 0x1d, 0x07, 
+	0xa5, 0x80, 0x18, 0x18, 0x00, 0x6d, 0x01, 0x33, 0x70, 0xbd, 0x20, 0xc3, 0x11, 0x9f, 0x11, 0xaf, 
+	0x10, 0xb5, 0x1d, 0x23, 0x10, 0xff, 0xf7, 0x98, 0x41, 0x6f, 0x1f, 0x23, 0x18, 0x40, 0x40, 0x06, 
+	0x00, 0xcf, 0x10, 0xb5, 0xdb, 0x05, 0x01, 0xd5, 0x01, 0x20, 0x23, 0x18, 0x43, 0xff, 0xf7, 0xee, 
+	0x61, 0x8b, 0xd5, 0x10, 0x37, 0x10, 0x21, 0x05, 0x50, 0x21, 0xd4, 0x30, 0x21, 0xdd, 0x82, 0x03, 
+	0x0c, 0x01, 0x4b, 0x18, 0x70, 0x14, 0xb3, 0x11, 0x23, 0x80, 0x22, 0x7a, 0x02, 0x0d, 0x2f, 0x03, 
+	0x3f, 0x00, 0x11, 0x10, 0x0f, 0x70, 0x03, 0xa7, 0x73, 0x08, 0xfe, 0x0b, 0x25, 0x01, 0x01, 0x5b, 
+	0x79, 0xfe, 0x04, 0x80, 0x02, 0xd7, 0xe2, 0xfd, 0x2c, 0x42, 0xf7, 0xd0, 0x70, 0x80, 0x40, 0x5f, 
+	0x70, 0xb5, 0x34, 0x4b, 0x34, 0x4c, 0x98, 0x00, 0x88, 0x22, 0x68, 0x1a, 0x60, 0x04, 0x28, 0x3f, 
+	0x00, 0xd8, 0x07, 0xf0, 0x06, 0xfa, 0x03, 0x35, 0x40, 0x00, 0x47, 0x56, 0x00, 0xde, 0x88, 0x11, 
+	0x04, 0x09, 0x00, 0x0c, 0x10, 0x0c, 0x86, 0x42, 0x25, 0xd1, 0x1d, 0x00, 0x89, 0x03, 0x2d, 0x15, 
+	0xd8, 0x58, 0x89, 0x00, 0x00, 0x04, 0x30, 0x43, 0xc0, 0x43, 0x90, 0x42, 0x01, 0x00, 0xd1, 0x01, 
+	0x35, 0x1d, 0x81, 0x1a, 0x89, 0x03, 0x00, 0x2a, 0x1a, 0xd8, 0x26, 0x48, 0x52, 0x00, 0x12, 0x08, 
+	0x5a, 0xc9, 0x43, 0x09, 0x00, 0x2d, 0x5a, 0x81, 0xd9, 0x00, 0x80, 0x13, 0x04, 0x0b, 0x43, 0x05, 
+	0xe0, 0x21, 0x00, 0x4a, 0x91, 0x42, 0xee, 0xd1, 0x01, 0x22, 0x9a, 0x00, 0x80, 0x20, 0x4b, 0x23, 
+	0x60, 0x80, 0x23, 0x1f, 0x10, 0x4a, 0x11, 0x88, 0x02, 0x87, 0x80, 0x2d, 0xe0, 0x00, 0x00, 0x22, 
+	0x1a, 0x81, 0xe1, 0xe7, 0x80, 0x22, 0x12, 0x00, 0x02, 0xe4, 0xe7, 0x19, 0x49, 0x8a, 0x42, 0x03, 
+	0x20, 0xd1, 0x02, 0x00, 0x25, 0x18, 0x4b, 0xeb, 0xe7, 0x04, 0x82, 0x00, 0x07, 0x00, 0x23, 0xe7, 
+	0xe7, 0x15, 0x00, 0x15, 0xf8, 0x20, 0xd1, 0x03, 0x00, 0x0d, 0x14, 0x4b, 0xe0, 0xe7, 0x14, 0x84, 
+	0x00, 0x0d, 0xf1, 0xd1, 0xda, 0x68, 0x11, 0xd9, 0x02, 0x22, 0x00, 0x1a, 0x61, 0x1a, 0x69, 0x00, 
+	0x2a, 0xf2, 0xd0, 0x00, 0x01, 0x3a, 0x1a, 0x61, 0x0e, 0x4b, 0xd1, 0xe7, 0x80, 0x00, 0x4d, 0x60, 
+	0xda, 0x60, 0x9a, 0x80, 0x1a, 0x81, 0x0a, 0x5a, 0x81, 0xda, 0x80, 0x30, 0xd5, 0x60, 0x02, 0xfb, 
+	0x20, 0xa6, 0x03, 0x83, 0x9a, 0x05, 0xc3, 0x02, 0x80, 0x0e, 0x73, 0x00, 0x02, 0x28, 0xa0, 0x00, 
+	0x0f, 0x13, 0x03, 0x1a, 0x04, 0x00, 0x00, 0x40, 0x03, 0x08, 0x00, 0x00, 0x30, 0x26, 0x00, 0x07, 
+	0x0e, 0x4b, 0x0f, 0x08, 0x4a, 0x1b, 0x68, 0x93, 0x0c, 0xb5, 0x0e, 0x4b, 0x1b, 0x00, 0x78, 0x00, 
+	0x2b, 0x12, 0xd0, 0x00, 0x22, 0x0c, 0x88, 0x04, 0x6d, 0x0c, 0x4b, 0x0d, 0x04, 0x79, 0x80, 0x22, 
+	0x19, 0x00, 0x88, 0xd2, 0x01, 0x0a, 0x43, 0x01, 0x21, 0x1a, 0x05, 0x80, 0x1a, 0x88, 0x8a, 0x43, 
+	0x30, 0x11, 0x0a, 0x00, 0x07, 0xeb, 0x11, 0x6b, 0x10, 0x63, 0x10, 0x47, 0x08, 0x00, 0x07, 0x34, 
+	0x00, 0x5b, 0x10, 0x5f, 0x40, 0x08, 0x00, 0x68, 0x01, 0x23, 0x03, 0x60, 0x04, 0x20, 0x19, 0x70, 
+	0x47, 0x00, 0x00, 0x03, 0x13, 0x8a, 0x04, 0x29, 0x00, 0xdf, 0x25, 0x4b, 0x12, 0x01, 0x5d, 0x01, 
+	0x30, 0x10, 0x37, 0x74, 0x00, 0x2f, 0x80, 0x10, 0x1b, 0x10, 0xb5, 0x80, 0x24, 0xa4, 0x01, 0x22, 
+	0x81, 0x0f, 0x23, 0x07, 0xf0, 0x21, 0xfd, 0x20, 0x00, 0x3e, 0xed, 0xa8, 0x01, 0xef, 0x57, 0x15, 
+	0x6f, 0x2c, 0x05, 0x33, 0x07, 0xf0, 0x15, 0x14, 0xfd, 0x2c, 0x20, 0x50, 0x17, 0xec, 0x25, 0x87, 
+	0x04, 0x4b, 0x11, 0xa0, 0x22, 0x19, 0x04, 0xcb, 0x08, 0xfd, 0xa0, 0x40, 0x19, 0x40, 0xd4, 0x00, 
+	0x17, 0x08, 0x4b, 0x0a, 0x00, 0xc9, 0x18, 0x64, 0x08, 0x05, 0x4b, 0x00, 0xdd, 0x20, 0x19, 0x06, 
+	0x19, 0x06, 0x4b, 0x11, 0x21, 0x00, 0x18, 0x01, 0xeb, 0xf4, 0xfc, 0x01, 0x40, 0x27, 0x02, 0x00, 
+	0xe0, 0xff, 0xff, 0xff, 0xdf, 0x06, 0xf7, 0x40, 0x22, 0x03, 0x02, 0x0f, 0x5f, 0x4b, 0x1a, 0x78, 
+	0x12, 0xe7, 0x06, 0x00, 0xd0, 0xc0, 0x22, 0x06, 0x49, 0xd2, 0x01, 0x07, 0x00, 0xf0, 0xdf, 0xfc, 
+	0xc0, 0x23, 0xdb, 0x01, 0x18, 0xa2, 0x60, 0x87, 0x0d, 0x00, 0x57, 0x00, 0xe0, 0x02, 0x00, 0x2b, 
+	0x0a, 0x84, 0x01, 0x1b, 0x80, 0x22, 0x09, 0x49, 0x0f, 0xed, 0xd1, 0x92, 0x81, 0x00, 0x29, 0xca, 
+	0xfc, 0x80, 0x20, 0x80, 0x01, 0x30, 0x27, 0xa3, 0x10, 0x39, 0xc2, 0x00, 0x0f, 0xc0, 0x01, 0xf6, 
+	0x03, 0xf3, 0x20, 0x33, 0xaa, 0x20, 0x5f, 0x07, 0x40, 0x5f, 0x04, 0x03, 0x8b, 0x05, 0x00, 0xc9, 
+	0xb0, 0x15, 0xfc, 0x80, 0x23, 0xb0, 0x5b, 0x7c, 0x0e, 0xcb, 0x80, 0x04, 0x9f, 0x00, 0x0a, 0x00, 
+	0x04, 0x00, 0x9b, 0x01, 0x00, 0x20, 0x56, 0x99, 0x00, 0xb5, 0x04, 0x40, 0xb5, 0x99, 0x60, 0xb5, 
+	0x31, 0x0f, 0xc0, 0xef, 0x40, 0x27, 0x07, 0x65, 0xa0, 0x27, 0x85, 0x80, 0x27, 0x40, 0xab, 0x00, 
+	0x25, 0x0b, 0xa1, 0x5d, 0x29, 0x70, 0x23, 0x73, 0x80, 0x23, 0x31, 0x43, 0x30, 0x23, 0x80, 0x80, 
+	0x23, 0x61, 0x61, 0x80, 0x23, 0x10, 0x97, 0x70, 0xb5, 0x05, 0x00, 0x06, 0x5b, 0x02, 0x20, 0xa0, 
+	0x29, 0x12, 0xd1, 0x0a, 0x01, 0x5b, 0x18, 0x20, 0x68, 0x29, 0x00, 0x25, 0x4e, 0xfc, 0x08, 0x4b, 
+	0x22, 0x8a, 0x40, 0x0b, 0x48, 0xfc, 0x06, 0x60, 0x0b, 0x42, 0x00, 0x3d, 0x70, 0xad, 0x61, 0x8b, 
+	0xd0, 0x00, 0x03, 0x64, 0x11, 0x07, 0x42, 0x03, 0xf8, 0x01, 0x93, 0x00, 0x45, 0x18, 0xac, 0x42, 
+	0x03, 0xd3, 0x07, 0xf0, 0x00, 0xcd, 0xfb, 0x00, 0x20, 0x14, 0xe0, 0x03, 0x23, 0x00, 0x20, 0x00, 
+	0x61, 0x68, 0x27, 0x68, 0x4c, 0x1e, 0x00, 0x1c, 0x43, 0x08, 0x30, 0x01, 0x34, 0x04, 0x19, 0x00, 
+	0xa5, 0x42, 0x16, 0xd3, 0x00, 0x23, 0x0c, 0x4a, 0x00, 0x16, 0x68, 0xb7, 0x42, 0x07, 0xd0, 0x01, 
+	0x33, 0x00, 0x04, 0x32, 0x0b, 0x2b, 0xf8, 0xd1, 0x02, 0x20, 0x80, 0x3f, 0xfd, 0x06, 0x4a, 0x9b, 
+	0x00, 0xd6, 0x18, 0xf3, 0x00, 0x6a, 0x00, 0xf0, 0x25, 0xf8, 0x00, 0x28, 0xd9, 0x00, 0xd1, 0x03, 
+	0x20, 0xf2, 0xe7, 0x01, 0x20, 0xf0, 0xa2, 0x01, 0x6f, 0xa4, 0x02, 0xdf, 0xf8, 0xb5, 0x06, 0x10, 
+	0xcf, 0x25, 0x00, 0x20, 0x00, 0x0a, 0x4b, 0x5f, 0x59, 0x58, 0x33, 0x01, 0xeb, 0x58, 0x08, 0x30, 
+	0x00, 0xf0, 0x10, 0x00, 0x29, 0x00, 0x03, 0xdd, 0x60, 0x60, 0x08, 0x30, 0x27, 0x60, 0x04, 0x24, 
+	0x18, 0x04, 0x35, 0x2c, 0x05, 0x4d, 0xa0, 0x1b, 0xd0, 0x30, 0x4f, 0x30, 0x37, 0x18, 0x00, 0x07, 
+	0x02, 0x00, 0xf0, 0xb5, 0x00, 0x03, 0x00, 0x03, 0x27, 0x85, 0xb0, 0x10, 0x32, 0x00, 0x02, 0x92, 
+	0x65, 0x4d, 0x44, 0x1a, 0x02, 0x9a, 0x04, 0x9a, 0x42, 0x07, 0xd8, 0x63, 0x04, 0x6b, 0x00, 0x2b, 
+	0x04, 0x01, 0xd0, 0x07, 0xf0, 0xda, 0x00, 0xb1, 0x3c, 0xe0, 0x00, 0x1a, 0x78, 0xaa, 0x5c, 0x0f, 
+	0x26, 0x10, 0x00, 0x00, 0x30, 0x40, 0x01, 0x90, 0x04, 0x38, 0x0b, 0x28, 0x00, 0x49, 0xd8, 0x06, 
+	0xf0, 0xe9, 0xff, 0x06, 0x06, 0x02, 0x36, 0x36, 0x48, 0xed, 0x48, 0x48, 0x00, 0x01, 0xed, 0x00, 
+	0x01, 0x20, 0x5e, 0x1c, 0x76, 0x1a, 0xb4, 0x46, 0x00, 0x18, 0x56, 0x84, 0x44, 0x64, 0x45, 0x39, 
+	0xdb, 0x00, 0x06, 0x00, 0x12, 0x36, 0x36, 0xdb, 0x02, 0x30, 0x00, 0x52, 0x49, 0x1a, 0x18, 0xc8, 
+	0x68, 0x00, 0x0c, 0x02, 0x0e, 0x69, 0x03, 0x90, 0x88, 0x68, 0x05, 0x89, 0x0c, 0x00, 0x02, 0x90, 
+	0x36, 0x0c, 0x93, 0x42, 0x2c, 0xd8, 0x00, 0x01, 0x29, 0xcb, 0xd0, 0x01, 0x9a, 0x04, 0x3a, 0x00, 
+	0x58, 0x1c, 0x01, 0x2a, 0x00, 0xd8, 0x98, 0x1c, 0x00, 0x01, 0x24, 0x00, 0x21, 0x01, 0x9b, 0x06, 
+	0x3b, 0x00, 0x1b, 0x06, 0x1b, 0x0e, 0x9c, 0x42, 0x49, 0x41, 0x02, 0x07, 0xf0, 0x72, 0xfb, 0x20, 
+	0x00, 0x5b, 0x0d, 0x5e, 0x00, 0x78, 0xb4, 0x46, 0x98, 0x78, 0x00, 0x02, 0x60, 0x02, 0x44, 0x84, 
+	0x42, 0x0a, 0xdb, 0x5e, 0x00, 0x69, 0x02, 0x01, 0x26, 0xb4, 0x44, 0x66, 0x46, 0x80, 0x1b, 0x10, 
+	0x69, 0x00, 0x01, 0xdb, 0x03, 0x30, 0xc9, 0xe7, 0x12, 0x09, 0x40, 0x3a, 0x09, 0x61, 0x9d, 0xe7, 
+	0x33, 0x48, 0x14, 0x78, 0x00, 0x07, 0x5d, 0x03, 0x24, 0x38, 0x09, 0x20, 0x40, 0x20, 0x04, 0x1c, 
+	0x1a, 0x45, 0x01, 0x24, 0x0f, 0x20, 0x24, 0x00, 0x06, 0x24, 0x0e, 0x38, 0x40, 0xbd, 0x09, 0x7f, 
+	0x00, 0x2f, 0x00, 0xd9, 0x8e, 0xe7, 0x01, 0x38, 0x0e, 0x20, 0x28, 0x3e, 0x00, 0xc5, 0x9a, 0xff, 
+	0x0f, 0x00, 0x3d, 0xa0, 0x00, 0x96, 0x3d, 0x60, 0x01, 0x8a, 0xff, 0x2d, 0x00, 0x41, 0x02, 0x00, 
+	0x45, 0x00, 0x43, 0x00, 0x33, 0x00, 0x0b, 0xff, 0x00, 0x27, 0x50, 0x78, 0x3f, 0x02, 0xc0, 0x19, 
+	0x01, 0x00, 0x2d, 0x00, 0xd1, 0x02, 0x21, 0x80, 0x25, 0x28, 0x00, 0x42, 0x17, 0xd1, 0xc0, 0x27, 
+	0x05, 0x06, 0x2d, 0x00, 0x0e, 0x38, 0x42, 0x28, 0xd1, 0x00, 0x2d, 0x10, 0x03, 0xd0, 0x68, 0xe7, 
+	0x90, 0x78, 0x57, 0x00, 0x99, 0x50, 0x23, 0x00, 0xff, 0x25, 0x2d, 0x02, 0xa8, 0x42, 0xe9, 0xda, 
+	0x00, 0x03, 0xe0, 0x01, 0x2d, 0x0f, 0xd0, 0x01, 0x20, 0x00, 0x01, 0x43, 0x12, 0x19, 0x86, 0xe7, 
+	0x50, 0x78, 0x04, 0x07, 0x00, 0x40, 0x3f, 0x3f, 0x00, 0x7b, 0x50, 0xe7, 0x03, 0x07, 0x27, 0x38, 
+	0x40, 0x06, 0x28, 0x01, 0xe7, 0x07, 0x2f, 0x00, 0x02, 0x21, 0xef, 0xe7, 0x02, 0x98, 0xe1, 0xe7, 
+	0x00, 0x03, 0x98, 0xdf, 0xe7, 0x30, 0x00, 0xdd, 0xe7, 0x00, 0x41, 0x3d, 0x15, 0x2d, 0xe6, 0xd8, 
+	0x05, 0x48, 0x01, 0xe8, 0x40, 0xc0, 0x07, 0xe2, 0xd5, 0x3a, 0x01, 0xe3, 0x00, 0x28, 0x96, 0x00, 
+	0x08, 0x24, 0x51, 0x00, 0x03, 0x00, 0xe8, 0x55, 0x00, 0x03, 0x09, 0x00, 0x30, 0x00, 0x00, 0x09, 
+	0x4b, 0x18, 0x68, 0x80, 0x23, 0x9b, 0x01, 0x00, 0xc3, 0x18, 0x01, 0x22, 0x10, 0xb5, 0x83, 0x42, 
+	0x01, 0x00, 0xdb, 0x06, 0x4a, 0xe0, 0x23, 0x1b, 0x09, 0x4b, 0x00, 0x01, 0x3a, 0xc0, 0x18, 0x07, 
+	0xf0, 0x49, 0xf9, 0xc8, 0x36, 0x17, 0x0f, 0x3d, 0x02, 0x01, 0x0f, 0x43, 0xf7, 0xb5, 0xe0, 0x00, 
+	0x21, 0x30, 0x4b, 0x31, 0x4a, 0x09, 0x05, 0x0c, 0x00, 0x78, 0x1b, 0x78, 0x10, 0x78, 0x2f, 0x4a, 
+	0x1b, 0x00, 0x02, 0x12, 0x78, 0x1b, 0x19, 0x00, 0x04, 0x1b, 0x00, 0x18, 0x2d, 0x48, 0x12, 0x06, 
+	0x9b, 0x18, 0x02, 0x00, 0x78, 0x94, 0x46, 0x2c, 0x4f, 0x3a, 0x78, 0x2c, 0x00, 0x4e, 0x00, 0x92, 
+	0x2c, 0x4d, 0x34, 0x78, 0x2a, 0x00, 0x78, 0x01, 0x92, 0x00, 0x9a, 0x12, 0x02, 0x24, 0x00, 0x04, 
+	0x62, 0x44, 0x12, 0x19, 0x01, 0x9c, 0x24, 0x00, 0x06, 0x12, 0x19, 0x27, 0x4c, 0x93, 0x42, 0x38, 
+	0x00, 0xd1, 0x26, 0x4a, 0x9a, 0x18, 0x01, 0x2a, 0x1d, 0x00, 0xd8, 0x01, 0x22, 0x5a, 0x40, 0x12, 
+	0x06, 0x12, 0x00, 0x0e, 0x0a, 0x70, 0x00, 0x78, 0x3a, 0x78, 0x36, 0x00, 0x78, 0x12, 0x02, 0x29, 
+	0x78, 0x12, 0x18, 0x36, 0x00, 0x04, 0x92, 0x19, 0x09, 0x06, 0x52, 0x18, 0x93, 0x10, 0x42, 0x09, 
+	0xd0, 0x14, 0x4b, 0x23, 0x60, 0xe0, 0x23, 0x03, 0xd8, 0x22, 0x1b, 0x05, 0x1a, 0x70, 0x37, 0x0f, 
+	0x00, 0xa5, 0x01, 0x02, 0xf4, 0xe7, 0x0b, 0x78, 0xdb, 0x43, 0x11, 0xe3, 0x00, 0x0b, 0x70, 0x02, 
+	0x78, 0x0b, 0x78, 0x9a, 0x42, 0x20, 0x0a, 0xd1, 0x10, 0x2b, 0xe0, 0x22, 0x23, 0x60, 0x12, 0x21, 
+	0x05, 0x13, 0x40, 0x1b, 0x13, 0x70, 0xe5, 0xe7, 0x10, 0x2d, 0x44, 0xf3, 0x20, 0x05, 0x23, 0x60, 
+	0xde, 0x01, 0x07, 0x01, 0x00, 0x28, 0x00, 0x0e, 0x05, 0x4f, 0x0e, 0x05, 0x73, 0x0e, 0x00, 0x80, 
+	0x19, 0x00, 0x0e, 0x01, 0x00, 0x03, 0x05, 0xdb, 0x0e, 0x03, 0x00, 0x03, 0x82, 0x10, 0xeb, 0x28, 
+	0xce, 0x58, 0xa8, 0x11, 0x0b, 0x35, 0x70, 0x00, 0xb5, 0x00, 0x2a, 0x04, 0xd1, 0x10, 0x49, 0x09, 
+	0x00, 0x68, 0x19, 0x60, 0x0a, 0x70, 0x5a, 0x60, 0x1c, 0x00, 0x68, 0x0e, 0x4d, 0x23, 0x68, 0xab, 
+	0x42, 0x10, 0x40, 0xd0, 0x06, 0xff, 0xff, 0xe0, 0x21, 0x0b, 0x4b, 0x20, 0x00, 0x00, 0x1a, 0x68, 
+	0x09, 0x05, 0x07, 0xf0, 0xd2, 0x04, 0xf9, 0x23, 0x68, 0x09, 0x4a, 0x08, 0xc9, 0x2b, 0x02, 0x01, 
+	0xd9, 0x00, 0x23, 0x25, 0x60, 0x63, 0x60, 0x57, 0x13, 0x50, 0x78, 0x00, 0x4f, 0x44, 0x00, 0x03, 
+	0xd8, 0x31, 0xa7, 0x57, 0x80, 0x50, 0x5b, 0x70, 0xb5, 0x10, 0x4a, 0x55, 0x68, 0x6a, 0x00, 0x1e, 
+	0x12, 0x78, 0x0f, 0x4c, 0x54, 0x43, 0x80, 0x10, 0x22, 0x00, 0x20, 0x06, 0x33, 0x68, 0xd2, 0x01, 
+	0x9e, 0x00, 0x18, 0x9d, 0x42, 0x10, 0xd9, 0x5a, 0x78, 0x19, 0x80, 0x01, 0x05, 0x0a, 0x43, 0x99, 
+	0x78, 0x09, 0x04, 0x11, 0x00, 0x43, 0xda, 0x78, 0x12, 0x06, 0x0a, 0x43, 0x80, 0x01, 0x18, 0x80, 
+	0x33, 0x9e, 0x42, 0xef, 0xd1, 0x34, 0x1b, 0x00, 0x00, 0x19, 0xf7, 0xe7, 0x18, 0x92, 0x02, 0x02, 
+	0x04, 0x01, 0x01, 0x01, 0x01, 0x20, 0x04, 0xd3, 0x80, 0x22, 0x00, 0xd2, 0x01, 0x03, 0x00, 0x10, 
+	0xb5, 0x84, 0x18, 0x30, 0x00, 0x20, 0xf0, 0x3d, 0x00, 0x3d, 0x33, 0x80, 0x18, 0x9c, 0xc0, 0x06, 
+	0xf7, 0x34, 0x97, 0x70, 0xb5, 0xfe, 0xf7, 0xca, 0xf9, 0x00, 0x13, 0x4b, 0x02, 0x68, 0x9a, 0x42, 
+	0x20, 0xd1, 0x00, 0xc3, 0x68, 0xc3, 0x18, 0x59, 0x1e, 0x09, 0x78, 0x00, 0x10, 0x4d, 0x82, 0x68, 
+	0x4d, 0x43, 0x80, 0x21, 0x44, 0x82, 0x00, 0x43, 0xc9, 0x01, 0x56, 0x01, 0x79, 0x10, 0xd9, 0x00, 
+	0x51, 0x78, 0x14, 0x78, 0x09, 0x02, 0x21, 0x43, 0x00, 0x94, 0x78, 0x24, 0x04, 0x0c, 0x43, 0xd1, 
+	0x78, 0x00, 0x09, 0x06, 0x21, 0x43, 0x40, 0x18, 0x80, 0x32, 0x50, 0x96, 0x60, 0x89, 0x40, 0x00, 
+	0x89, 0xff, 0xf7, 0xbf, 0xff, 0x03, 0xf7, 0xe7, 0x54, 0x52, 0x49, 0x4d, 0x10, 0x8f, 0x06, 0x37, 
+	0x80, 0x08, 0x1d, 0xa8, 0xfa, 0x00, 0x22, 0x09, 0x20, 0x0b, 0x04, 0x49, 0xff, 0xf7, 0xc7, 0xfb, 
+	0x0a, 0x69, 0x20, 0x0a, 0xa0, 0x00, 0x09, 0xc2, 0x03, 0xff, 0xff, 0xf7, 0xf9, 0xfa, 0x5a, 0x10, 
+	0x24, 0x01, 0x3c, 0x0b, 0xff, 0xf9, 0x00, 0x2c, 0xfa, 0x24, 0xd1, 0x20, 0x09, 0xcb, 0x14, 0xfb, 
+	0x58, 0x9f, 0xea, 0x9a, 0x00, 0x00, 0x08, 0x06, 0x9b, 0x00, 0x08, 0x70, 0xb5, 0x04, 0x0d, 0x00, 
+	0x0a, 0x21, 0x06, 0x05, 0x0f, 0x2c, 0xf9, 0x00, 0x03, 0x00, 0x30, 0x33, 0x04, 0x00, 0x2b, 0x70, 
+	0x40, 0x30, 0x00, 0x11, 0x07, 0xf0, 0x8a, 0xf9, 0x30, 0x31, 0x0b, 0x20, 0x00, 0x69, 0x70, 0x30, 
+	0x7d, 0xf8, 0x25, 0x5b, 0x07, 0x35, 0x44, 0x26, 0x00, 0x1b, 0x00, 0x01, 0x36, 0x05, 0x57, 0xf9, 
+	0x09, 0x00, 0x2f, 0xf8, 0xd8, 0x00, 0x23, 0xad, 0x19, 0x2b, 0x18, 0x70, 0x6e, 0x1e, 0x04, 0xc7, 
+	0x00, 0x33, 0x82, 0xf9, 0x01, 0x48, 0x3e, 0x10, 0x35, 0x71, 0x70, 0x10, 0x0d, 0x3d, 0xf9, 0x27, 
+	0x81, 0x04, 0xe3, 0x09, 0x2f, 0xf0, 0xd8, 0x28, 0x00, 0x34, 0xc3, 0xc0, 0x10, 0x6d, 0x18, 0xcb, 
+	0x8c, 0xf8, 0x29, 0x00, 0x20, 0x18, 0x0a, 0xff, 0xf7, 0xd4, 0xff, 0x31, 0xbb, 0xf7, 0x20, 0x17, 
+	0x1a, 0x10, 0x49, 0x16, 0x00, 0x0d, 0x3d, 0xf0, 0x75, 0xf8, 0x28, 0x22, 0x00, 0x18, 0x06, 0x7d, 
+	0xe3, 0xf8, 0x21, 0x00, 0xb3, 0xae, 0x02, 0xff, 0xe1, 0x21, 0x28, 0x00, 0x09, 0x06, 0xb1, 0xdb, 
+	0x20, 0xf8, 0x3c, 0x00, 0x55, 0x3e, 0xf9, 0xe7, 0x1c, 0x08, 0x21, 0x00, 0x39, 0x00, 0x19, 0xa1, 
+	0xff, 0x28, 0x00, 0x10, 0x11, 0x42, 0xcf, 0x20, 0x17, 0x32, 0xf9, 0xa7, 0x1d, 0x30, 0x17, 0x95, 
+	0x00, 0xff, 0x20, 0x00, 0x31, 0x00, 0x0b, 0x30, 0xff, 0x18, 0xf7, 0xa4, 0xff, 0x00, 0x6d, 0x00, 
+	0x49, 0x24, 0xf8, 0x01, 0x02, 0x99, 0xe0, 0x1d, 0xff, 0xf7, 0x9c, 0x4a, 0xa5, 0xc0, 0x26, 0x46, 
+	0x1e, 0x00, 0xfb, 0xc0, 0x4b, 0x0e, 0x49, 0x00, 0x07, 0xf0, 0x00, 0xb5, 0x65, 0x4e, 0x8b, 0xb0, 
+	0x09, 0x93, 0x33, 0x01, 0x68, 0x15, 0x00, 0x01, 0x90, 0x05, 0x91, 0x05, 0x43, 0x02, 0xd1, 0xff, 
+	0xf7, 0xb4, 0xfe, 0x60, 0x15, 0x4f, 0x93, 0x00, 0x01, 0x9b, 0x02, 0x3b, 0x5a, 0x42, 0x5a, 0x41, 
+	0x00, 0x2c, 0x68, 0x37, 0x68, 0x03, 0x92, 0x05, 0x9b, 0x00, 0x00, 0x9a, 0x1b, 0x68, 0x04, 0x37, 
+	0x12, 0x1b, 0x00, 0x0b, 0x2a, 0x09, 0xdd, 0x0f, 0x2b, 0x07, 0xdd, 0x80, 0x0c, 0xc5, 0x9c, 0x0e, 
+	0x3a, 0x0b, 0x3c, 0xa2, 0x42, 0x00, 0x01, 0xdc, 0x0f, 0x3b, 0x1c, 0x00, 0x00, 0x9b, 0x00, 0x1b, 
+	0x1b, 0x02, 0x2b, 0x04, 0xdc, 0x00, 0x9b, 0x20, 0xdc, 0x1e, 0x3c, 0x75, 0x02, 0x20, 0x2c, 0x60, 
+	0x03, 0x20, 0x1b, 0x04, 0x0e, 0x75, 0xd2, 0xf9, 0x08, 0x23, 0x00, 0x00, 0x25, 0x02, 0x93, 0x3e, 
+	0x88, 0x00, 0x2e, 0x3a, 0x08, 0xd1, 0x49, 0x4b, 0x02, 0x00, 0x4b, 0x9b, 0x1a, 0x03, 0x20, 0x93, 
+	0x00, 0x0a, 0x8d, 0x58, 0xd0, 0x46, 0x4f, 0x03, 0x02, 0x9b, 0x07, 0x9a, 0x06, 0x99, 0x38, 0x00, 
+	0xc3, 0x76, 0x28, 0xff, 0x32, 0x00, 0xcb, 0x32, 0x01, 0xc5, 0xc4, 0xfa, 0x00, 0x22, 0x2d, 0x04, 
+	0x08, 0xe1, 0x33, 0x20, 0x3f, 0x01, 0xd9, 0xbd, 0x00, 0xfa, 0x01, 0x9b, 0x01, 0x2b, 0x4b, 0xd1, 
+	0x04, 0x02, 0x9b, 0xeb, 0x18, 0x10, 0x2b, 0x08, 0x00, 0x65, 0x28, 0x08, 0x1b, 0xea, 0x1a, 0x53, 
+	0x00, 0x9f, 0x39, 0x49, 0x22, 0xa2, 0x00, 0xf1, 0xad, 0x02, 0x0d, 0x20, 0x20, 0x37, 0x00, 0x29, 
+	0xa8, 0x00, 0xfa, 0x01, 0x35, 0x05, 0x9b, 0x02, 0x9a, 0x1d, 0x00, 0x60, 0x08, 0x98, 0x2d, 0x4b, 
+	0xda, 0x60, 0x0b, 0x82, 0x45, 0x93, 0x7b, 0x88, 0x03, 0x9a, 0x93, 0x07, 0xe1, 0x01, 0x00, 0x9a, 
+	0x03, 0x2a, 0x19, 0xd1, 0x02, 0x2b, 0x17, 0x40, 0xd0, 0x10, 0x4b, 0x02, 0x3b, 0x0e, 0x2b, 0x0a, 
+	0xd8, 0x20, 0x00, 0x9b, 0x30, 0x4b, 0x22, 0x23, 0x39, 0x00, 0x18, 0x00, 0x1b, 0x40, 0x19, 0x10, 
+	0x31, 0xff, 0xf7, 0x84, 0x40, 0xfa, 0x10, 0x9d, 0x03, 0xd1, 0xbb, 0x68, 0x07, 0x96, 0x00, 0x06, 
+	0x93, 0x08, 0x97, 0x01, 0x35, 0x02, 0x9b, 0x00, 0x9b, 0x19, 0x02, 0x93, 0xbf, 0x19, 0x9b, 0xe7, 
+	0x00, 0x17, 0x4b, 0x99, 0x68, 0x00, 0x29, 0xae, 0xd0, 0x10, 0x0a, 0x88, 0x17, 0x00, 0xbb, 0x89, 
+	0x68, 0xa1, 0xe7, 0x14, 0x01, 0x9b, 0x19, 0x08, 0x71, 0x1f, 0x0b, 0x5f, 0x18, 0x49, 0x10, 0x02, 
+	0x2b, 0x1b, 0x00, 0x07, 0x03, 0x2b, 0xbb, 0xd1, 0x00, 0x09, 0x9b, 0x03, 0x9a, 0x9e, 0x1a, 0x00, 
+	0x2e, 0x00, 0x12, 0xdd, 0x0d, 0x4c, 0x13, 0x49, 0x20, 0x00, 0x02, 0x06, 0xf0, 0x83, 0xff, 0x31, 
+	0x00, 0x12, 0x91, 0xf6, 0x20, 0xfe, 0x10, 0x20, 0x0f, 0x53, 0xff, 0x00, 0x22, 0x21, 0x80, 0x0d, 
+	0x01, 0xff, 0xf7, 0x4c, 0xfa, 0xa3, 0xe7, 0x0c, 0x05, 0x49, 0x00, 0x22, 0xf8, 0xe7, 0x13, 0xcf, 
+	0x5c, 0x19, 0x77, 0xaa, 0x00, 0x03, 0x9c, 0x00, 0x03, 0x32, 0x01, 0xab, 0x48, 0x00, 0x03, 0x4e, 
+	0xaa, 0x00, 0x03, 0x5a, 0x00, 0x03, 0x66, 0x00, 0x03, 0x72, 0x00, 0x03, 0x82, 0xa0, 0x00, 0x03, 
+	0x89, 0x00, 0x03, 0xf7, 0xb5, 0x15, 0x00, 0x00, 0x00, 0x90, 0x01, 0x91, 0xff, 0xf7, 0xd6, 0xfd, 
+	0x00, 0x80, 0x0a, 0x48, 0x06, 0x00, 0x0c, 0x4f, 0x3a, 0x68, 0x13, 0x00, 0x1d, 0x92, 0x88, 0x00, 
+	0x2a, 0x03, 0xd1, 0xf9, 0x40, 0x60, 0x3d, 0xeb, 0x5c, 0x88, 0xa4, 0x46, 0x01, 0x9c, 0x01, 0xa4, 
+	0x45, 0x05, 0xd1, 0x00, 0x9c, 0xa6, 0x1b, 0x11, 0x00, 0x20, 0x2b, 0x60, 0x01, 0x36, 0x9b, 0x18, 
+	0x89, 0x08, 0x18, 0x1a, 0x88, 0xea, 0x20, 0x73, 0xf0, 0xb5, 0x2d, 0x80, 0x0c, 0xf1, 0x04, 0x00, 
+	0x0d, 0x00, 0x17, 0x00, 0x85, 0x41, 0xb0, 0x32, 0x0d, 0xad, 0xfd, 0xb3, 0x68, 0x39, 0x00, 0xb1, 
+	0x12, 0x03, 0xaa, 0x00, 0x01, 0xc7, 0xca, 0xff, 0x04, 0xd7, 0x2d, 0x00, 0x43, 0xd1, 0x00, 0x9b, 
+	0x00, 0x2b, 0x00, 0xd0, 0x08, 0x1d, 0x88, 0xf2, 0x68, 0x00, 0x2f, 0x32, 0x9a, 0x18, 0x00, 0x17, 
+	0x00, 0x00, 0x29, 0x01, 0xd0, 0x03, 0x9f, 0x00, 0x39, 0x88, 0x1d, 0x48, 0x01, 0x90, 0x00, 0x68, 
+	0x00, 0x84, 0x46, 0x6c, 0x1a, 0x14, 0x19, 0xe3, 0x1a, 0x00, 0x08, 0x33, 0x00, 0x20, 0x63, 0x45, 
+	0x27, 0xd8, 0x00, 0x79, 0x18, 0x52, 0x1a, 0x82, 0x42, 0x04, 0xdd, 0x10, 0x78, 0x19, 0x81, 0x0e, 
+	0x83, 0x06, 0xf0, 0xee, 0xfd, 0x80, 0x11, 0xdb, 0x2a, 0x00, 0x38, 0x00, 0x00, 0x99, 0x06, 0x08, 
+	0xf0, 0xf9, 0xff, 0x01, 0x02, 0x1d, 0xe0, 0x20, 0x31, 0x04, 0x68, 0x5b, 0x42, 0x62, 0x1a, 0x14, 
+	0xd9, 0xf2, 0x60, 0x00, 0x00, 0x05, 0x08, 0x32, 0x06, 0xf0, 0x58, 0xff, 0x00, 0x01, 0x9b, 0x1a, 
+	0x68, 0xf0, 0x68, 0x09, 0x4b, 0x00, 0x08, 0x3a, 0x12, 0x1a, 0x29, 0x00, 0xc0, 0x18, 0xa3, 0x20, 
+	0x13, 0x20, 0x57, 0x67, 0x00, 0x25, 0xbd, 0x05, 0x6b, 0x10, 0xbb, 0xd0, 0x11, 0x2b, 0x03, 0xa5, 
+	0x0e, 0x1d, 0xbf, 0x01, 0x94, 0xff, 0xf7, 0x00, 0x51, 0xfd, 0x1c, 0x4e, 0x23, 0x00, 0x69, 0x46, 
+	0x90, 0x0b, 0x58, 0xaa, 0x34, 0x0d, 0xb1, 0x89, 0xfe, 0x00, 0x9b, 0x08, 0xa3, 0x42, 0x29, 0xd0, 
+	0x11, 0x7b, 0xe9, 0xf8, 0xf4, 0x08, 0x27, 0x00, 0x9d, 0x28, 0x00, 0x09, 0x48, 0xf8, 0x04, 0x00, 
+	0x23, 0x04, 0x00, 0x18, 0x42, 0x0a, 0xd0, 0x01, 0x08, 0x22, 0x30, 0x68, 0x11, 0x00, 0x11, 0x7d, 
+	0xff, 0x33, 0xa0, 0x05, 0x35, 0x9a, 0x01, 0x1f, 0x02, 0x3d, 0x35, 0x60, 0x3c, 0x04, 0x42, 0x05, 
+	0xd0, 0x00, 0x23, 0x30, 0x45, 0xff, 0xf7, 0x40, 0x67, 0x00, 0x43, 0x00, 0x2b, 0x02, 0xd0, 0x06, 
+	0x4b, 0x00, 0x1c, 0x42, 0xde, 0xd0, 0x01, 0xf0, 0xb9, 0xf8, 0x9d, 0x14, 0x6d, 0xe6, 0xf8, 0x53, 
+	0x5b, 0x11, 0xb3, 0x1b, 0x64, 0xf0, 0x00, 0x83, 0x60, 0x23, 0x01, 0x49, 0x01, 0x43, 0x90, 0x01, 
+	0x93, 0x34, 0x60, 0x04, 0xfe, 0xf7, 0xc0, 0xff, 0x03, 0x00, 0x93, 0x07, 0xfd, 0x02, 0x1f, 0x4b, 
+	0x03, 0x20, 0x1c, 0x60, 0x01, 0x4b, 0x9b, 0x01, 0x02, 0xa9, 0xff, 0xf7, 0x3f, 0xfe, 0x02, 0x00, 
+	0x93, 0x44, 0x2c, 0x20, 0x93, 0x9f, 0xf8, 0x02, 0x00, 0x91, 0xfe, 0xf7, 0x28, 0xff, 0xff, 0x30, 
+	0x91, 0x0c, 0x00, 0x91, 0x13, 0x4f, 0x52, 0x00, 0x42, 0x01, 0x21, 0x38, 0x68, 0xff, 0xf7, 0x32, 
+	0x20, 0xff, 0x3b, 0x60, 0x95, 0x3d, 0x60, 0xf4, 0x23, 0x1c, 0x81, 0x00, 0x97, 0x03, 0x20, 0x00, 
+	0x9b, 0x03, 0xaa, 0x10, 0x47, 0x1a, 0x1b, 0xfe, 0x0a, 0x20, 0x91, 0x01, 0xff, 0xfc, 0x10, 0x91, 
+	0x9d, 0x09, 0xf8, 0x01, 0x9b, 0x33, 0x00, 0x75, 0x85, 0xff, 0x11, 0x27, 0xe1, 0x7d, 0x97, 0x50, 
+	0x9f, 0x02, 0x2f, 0x4d, 0x2b, 0x68, 0x14, 0x22, 0x33, 0x98, 0x31, 0xe5, 0xba, 0xfc, 0x0e, 0xef, 
+	0x0a, 0x17, 0x40, 0x42, 0x08, 0xa8, 0x04, 0xe5, 0x2a, 0x62, 0x3b, 0xe9, 0x42, 0x3b, 0x5e, 0x88, 
+	0xb4, 0x00, 0x46, 0x01, 0x9e, 0xb4, 0x45, 0x09, 0xd1, 0xde, 0x00, 0x68, 0xb4, 0x46, 0x00, 0x9e, 
+	0x01, 0x37, 0xb4, 0x00, 0x45, 0x03, 0xd1, 0x00, 0x2c, 0x00, 0xd0, 0x23, 0x15, 0x60, 0x38, 0x00, 
+	0x32, 0x43, 0xe6, 0x22, 0x43, 0x02, 0x27, 0xef, 0x02, 0x1b, 0x05, 0x18, 0x40, 0x70, 0x47, 0x0a, 
+	0x93, 0x02, 0xe0, 0x1a, 0x9b, 0x0f, 0x51, 0x04, 0x51, 0xa3, 0x42, 0x05, 0xdc, 0x01, 0x06, 0x24, 
+	0x64, 0x42, 0x20, 0x00, 0x35, 0x59, 0x10, 0xf5, 0xeb, 0x00, 0xfc, 0xa8, 0x42, 0xf6, 0xd0, 0x01, 
+	0x34, 0xee, 0x40, 0xe7, 0x00, 0x8d, 0x02, 0x73, 0xb5, 0x27, 0x4c, 0x23, 0xc4, 0x19, 0xc9, 0x00, 
+	0x91, 0x71, 0xfc, 0x25, 0x00, 0x33, 0x1b, 0x01, 0x23, 0x38, 0xd5, 0x07, 0x6b, 0x68, 0x12, 0x02, 
+	0x07, 0xf7, 0x03, 0x26, 0x04, 0x01, 0xaa, 0x23, 0x61, 0xa3, 0x01, 0xcd, 0x9e, 0xff, 0x00, 0x05, 
+	0x1e, 0x06, 0xda, 0x30, 0x22, 0x20, 0x69, 0x01, 0x1c, 0x49, 0x06, 0xf0, 0xbd, 0xfe, 0xa3, 0x0f, 
+	0xa7, 0x00, 0x1b, 0x4b, 0x01, 0x99, 0x1b, 0x68, 0x4b, 0x71, 0x05, 0x1a, 0x4b, 0x18, 0x78, 0x03, 
+	0x0e, 0x81, 0x19, 0x0b, 0xd3, 0x00, 0x0c, 0x23, 0x10, 0x26, 0x92, 0x00, 0x1a, 0x40, 0x40, 0x17, 
+	0x0c, 0x13, 0x1b, 0x01, 0x33, 0x40, 0x1a, 0x43, 0x40, 0x15, 0x00, 0x09, 0x02, 0x43, 0x5b, 0x01, 
+	0x13, 0x43, 0x00, 0x8b, 0x71, 0x63, 0x69, 0x8b, 0x60, 0x00, 0x2d, 0x01, 0x0a, 0xda, 0x00, 0x21, 
+	0x02, 0x22, 0x08, 0x00, 0x8d, 0x0a, 0x7f, 0xfe, 0x00, 0x23, 0x10, 0x5f, 0x73, 0x47, 0xff, 0x20, 
+	0x01, 0x68, 0x1b, 0x05, 0x08, 0x1a, 0x30, 0x22, 0x12, 0x75, 0x18, 0x13, 0xfe, 0xf0, 0x20, 0xdf, 
+	0x10, 0xd3, 0x28, 0x97, 0x00, 0x2a, 0x08, 0xd8, 0x01, 0x4f, 0x9b, 0x00, 0x0b, 0x3e, 0x00, 0x07, 
+	0x9a, 0xa0, 0x00, 0x07, 0x95, 0x2b, 0xab, 0xff, 0xf7, 0x43, 0xfc, 0x03, 0x03, 0x4b, 0x58, 0x61, 
+	0xff, 0xf7, 0x99, 0x4e, 0xef, 0x22, 0x9b, 0x89, 0x08, 0xf9, 0x04, 0x4b, 0x5a, 0x00, 0x15, 0x8e, 
+	0xff, 0x04, 0xe1, 0xd0, 0x66, 0x8b, 0x10, 0x1b, 0x13, 0x00, 0xe5, 0x13, 0xb5, 0x1b, 0x01, 0x20, 
+	0x1e, 0xd5, 0x30, 0xdf, 0xff, 0xf7, 0x30, 0xff, 0x00, 0x00, 0x28, 0x17, 0xdb, 0x01, 0x9a, 0x0e, 
+	0x4b, 0x51, 0x00, 0x79, 0x19, 0x60, 0x93, 0x79, 0x03, 0x24, 0x18, 0x00, 0x00, 0x0c, 0x49, 0x20, 
+	0x40, 0x08, 0x70, 0x0b, 0x14, 0x49, 0x98, 0x10, 0x10, 0x07, 0x0a, 0x0a, 0xd0, 0xc0, 0x0f, 0x00, 
+	0x08, 0x70, 0x09, 0x49, 0x5b, 0x11, 0x0b, 0x70, 0x17, 0x92, 0x68, 0x08, 0x00, 0x5b, 0x13, 0x40, 
+	0x53, 0x10, 0x9f, 0xf0, 0x9b, 0x20, 0x00, 0x03, 0x10, 0x6b, 0x70, 0xb5, 0x20, 0x4d, 0x20, 0x00, 
+	0x4c, 0x2b, 0x68, 0x26, 0x00, 0xa3, 0x42, 0x2a, 0x08, 0xd0, 0xdb, 0x46, 0x1e, 0x01, 0xab, 0xfd, 
+	0xf7, 0x32, 0x00, 0xfd, 0xc4, 0x22, 0x00, 0x21, 0x1c, 0x48, 0x06, 0x0a, 0xf0, 0xfb, 0xfd, 0xc0, 
+	0x00, 0x09, 0x1b, 0x00, 0x09, 0xf6, 0xaa, 0x20, 0x09, 0x19, 0x00, 0x09, 0xf1, 0x20, 0x09, 0x18, 
+	0x00, 0x09, 0xec, 0x48, 0xfd, 0x08, 0x45, 0x21, 0x16, 0x00, 0x09, 0xe7, 0xfd, 0x01, 0x00, 0x21, 
+	0x40, 0x22, 0x15, 0x48, 0x49, 0x42, 0x06, 0x22, 0xf0, 0xe1, 0x00, 0x0b, 0x30, 0x22, 0x13, 0x20, 
+	0x0b, 0xdb, 0x0a, 0xfd, 0x2c, 0x60, 0x11, 0x02, 0x59, 0xb3, 0x0c, 0x15, 0xdb, 0x00, 0x46, 0x9e, 
+	0x22, 0x0f, 0x48, 0x10, 0x49, 0x92, 0xb4, 0x04, 0xe3, 0xcf, 0x00, 0x17, 0x58, 0xab, 0x14, 0x08, 
+	0x53, 0xef, 0xbe, 0x20, 0xad, 0xde, 0x18, 0x53, 0x18, 0x96, 0x02, 0x02, 0x9c, 0x08, 0x97, 0x02, 
+	0x02, 0xdc, 0x00, 0x07, 0x5c, 0x98, 0x02, 0x1a, 0x02, 0x1c, 0x99, 0x00, 0x0f, 0x00, 0x03, 0xdc, 
+	0x00, 0x03, 0x0c, 0x60, 0x9a, 0x0d, 0x1f, 0x00, 0x03, 0x20, 0x20, 0x20, 0x20, 0xf0, 0x08, 0xb5, 
+	0x1c, 0x00, 0x27, 0x04, 0x91, 0x0a, 0x9b, 0x05, 0xc0, 0x09, 0x3c, 0x0b, 0xd7, 0x37, 0x00, 0x2b, 
+	0x23, 0xd1, 0x01, 0x40, 0x00, 0x14, 0x3f, 0x06, 0xf0, 0xbe, 0xfd, 0x03, 0x95, 0x00, 0x03, 0x22, 
+	0x03, 0x9b, 0x33, 0x33, 0x93, 0x43, 0x00, 0x23, 0x80, 0x15, 0x4b, 0x65, 0x60, 0x1b, 0x68, 0x01, 
+	0x15, 0x4d, 0xa3, 0x60, 0x66, 0x80, 0x28, 0x03, 0x39, 0x20, 0xba, 0xfb, 0x01, 0x61, 0x78, 0xe0, 
+	0x60, 0x10, 0x34, 0x15, 0x00, 0x2b, 0x10, 0x03, 0x69, 0x10, 0x02, 0x2f, 0xc1, 0x02, 0xed, 0x40, 
+	0x79, 0x63, 0x1b, 0x00, 0x93, 0x3a, 0x00, 0x29, 0x00, 0x00, 0x03, 0xab, 0xfe, 0xf7, 0xa9, 0xf9, 
+	0xda, 0xe7, 0x40, 0x28, 0x01, 0x11, 0x8d, 0xfd, 0x01, 0x00, 0x35, 0x31, 0x20, 0x0f, 0x22, 0x02, 
+	0xa1, 0x31, 0x06, 0xf0, 0xe2, 0xfc, 0x57, 0xe7, 0x04, 0x63, 0x1c, 0x01, 0x43, 0x24, 0x1e, 0xeb, 
+	0x1f, 0xab, 0x22, 0xab, 0x40, 0x1d, 0x00, 0x57, 0x04, 0x00, 0x01, 0x2b, 0x32, 0xd0, 0x40, 0x02, 
+	0x0c, 0x05, 0x00, 0x26, 0x1b, 0x0e, 0x03, 0x2b, 0x00, 0x03, 0xd8, 0x18, 0x4a, 0x5b, 0x00, 0xd2, 
+	0x18, 0x01, 0x16, 0x8e, 0x17, 0x4b, 0x9c, 0x42, 0x02, 0x01, 0x05, 0x0c, 0x80, 0x26, 0xb6, 0x01, 
+	0x13, 0x6d, 0x32, 0xd5, 0x06, 0xfb, 0x00, 0xe0, 0x22, 0xf0, 0x21, 0x2b, 0x68, 0x49, 0x02, 0x00, 
+	0x12, 0x02, 0x9a, 0x18, 0x5b, 0x18, 0x2b, 0x61, 0x00, 0xab, 0x60, 0x6a, 0x60, 0x30, 0x00, 0x00, 
+	0x92, 0x10, 0x01, 0x21, 0x22, 0x02, 0x81, 0x8a, 0xff, 0x80, 0x20, 0x80, 0x0f, 0x64, 0x21, 0x40, 
+	0x02, 0xff, 0xf7, 0x38, 0xfd, 0x0b, 0x00, 0x23, 0x6b, 0x60, 0x10, 0x21, 0x76, 0x23, 0x2f, 0x10, 
+	0x49, 0x18, 0xd3, 0xe7, 0x35, 0x00, 0x83, 0x12, 0x7f, 0x00, 0x80, 0x03, 0x50, 0x02, 0x11, 0xd3, 
+	0x26, 0x0a, 0x43, 0x80, 0x23, 0x70, 0xb5, 0x00, 0x14, 0x00, 0x1b, 0x05, 0x86, 0xb0, 0x1c, 0x40, 
+	0x40, 0x1a, 0x01, 0xd9, 0x22, 0x4b, 0x9c, 0x69, 0x00, 0x2c, 0x04, 0x3d, 0xd1, 0x02, 0x26, 0x21, 
+	0x00, 0xa3, 0x33, 0x42, 0x44, 0x21, 0x04, 0x19, 0xf7, 0xfa, 0x05, 0x08, 0x1b, 0x03, 0xaa, 0x80, 
+	0x13, 0x75, 0xff, 0xfd, 0x28, 0x00, 0x01, 0x21, 0x04, 0x80, 0x02, 0x6b, 0xfa, 0xfd, 0x19, 0x4d, 
+	0x00, 0x28, 0x16, 0x00, 0xdb, 0x04, 0x98, 0x01, 0x88, 0x2a, 0x00, 0x00, 0x00, 0x94, 0x30, 0x39, 
+	0x30, 0x30, 0x05, 0xab, 0x05, 0x01, 0x91, 0xfe, 0xf7, 0x9b, 0xfa, 0x01, 0x34, 0x11, 0x39, 0x02, 
+	0x03, 0x3b, 0x01, 0x2b, 0x0b, 0xd8, 0x04, 0x53, 0xfe, 0xb0, 0x06, 0xad, 0xb0, 0x33, 0xb9, 0x15, 
+	0x39, 0x7f, 0xff, 0x34, 0x00, 0x11, 0xee, 0xe7, 0x0c, 0x02, 0x41, 0xe0, 0x23, 0x80, 0x0b, 0x35, 
+	0x82, 0x15, 0x9b, 0x92, 0x01, 0x06, 0xf0, 0x7f, 0x01, 0x5b, 0x7b, 0x01, 0xfe, 0xe8, 0xe7, 0x00, 
+	0x24, 0xe6, 0xe7, 0x12, 0x8b, 0xbc, 0x10, 0xa3, 0x34, 0x00, 0xb3, 0x10, 0xaf, 0x10, 0xbb, 0x15, 
+	0xa7, 0xf0, 0xb5, 0x42, 0x7b, 0x02, 0xf5, 0x8b, 0xb0, 0x04, 0x90, 0x31, 0x15, 0x7b, 0x00, 0xfa, 
+	0x00, 0x23, 0x03, 0x93, 0x04, 0x9b, 0x00, 0x02, 0x25, 0x01, 0x2b, 0x06, 0xd1, 0x75, 0x00, 0x1b, 
+	0x1d, 0x28, 0x1e, 0x02, 0x00, 0xb3, 0x9d, 0x00, 0xb3, 0x80, 0x22, 0x72, 0xc0, 0x00, 0x0f, 0x0b, 
+	0x6b, 0x42, 0x00, 0xd1, 0xb8, 0xe0, 0xe0, 0x30, 0x22, 0x6c, 0x04, 0x21, 0x11, 0x3b, 0x62, 0x60, 
+	0xf0, 0x22, 0x68, 0x52, 0x04, 0x15, 0x13, 0xaf, 0x04, 0x08, 0x19, 0x45, 0xd1, 0x69, 0x00, 0x4b, 
+	0x1f, 0x78, 0x03, 0x2f, 0x00, 0xd0, 0x86, 0x02, 0xe0, 0x28, 0x00, 0x04, 0x99, 0x08, 0x00, 0xdd, 
+	0x8b, 0x10, 0xfd, 0x05, 0x90, 0x0d, 0x4f, 0xda, 0x98, 0xe0, 0x26, 0x02, 0x69, 0x30, 0x22, 0x30, 
+	0x00, 0x08, 0x06, 0x6b, 0xa7, 0x00, 0xfc, 0x32, 0x00, 0x80, 0x26, 0x63, 0x68, 0x36, 0x00, 0x02, 
+	0x31, 0x00, 0x00, 0x93, 0x30, 0x32, 0x09, 0x00, 0xab, 0x5c, 0x48, 0xfe, 0xf7, 0xac, 0xf8, 0x00, 
+	0x00, 0x21, 0x09, 0x9b, 0x61, 0x60, 0x33, 0x33, 0xa4, 0x00, 0x68, 0xbb, 0x43, 0xe5, 0x60, 0x23, 
+	0x80, 0x66, 0x02, 0x60, 0x04, 0x9a, 0x05, 0x98, 0x08, 0x05, 0xb5, 0x74, 0x20, 0xfc, 0x05, 0x00, 
+	0xef, 0x61, 0xfe, 0x00, 0x2d, 0x00, 0x01, 0xd0, 0x73, 0xe0, 0xff, 0xf7, 0xc0, 0xfa, 0x03, 0x5c, 
+	0x00, 0x2b, 0x05, 0xd1, 0x20, 0x88, 0xff, 0xf7, 0x0a, 0x00, 0xfd, 0x04, 0x9b, 0x03, 0x93, 0xa5, 
+	0xe7, 0x00, 0x03, 0x20, 0x46, 0x4b, 0x18, 0x61, 0x98, 0x68, 0x6b, 0x13, 0xcb, 0x40, 0x07, 0x00, 
+	0x81, 0x4a, 0xfd, 0x06, 0x00, 0x00, 0x2e, 0x00, 0x58, 0xdb, 0x07, 0x9f, 0xb8, 0x68, 0x00, 0x28, 
+	0x08, 0x54, 0xd0, 0x01, 0x21, 0x10, 0x97, 0x3f, 0xfd, 0x05, 0x11, 0x1e, 0x54, 0xdb, 0x10, 0x93, 
+	0x08, 0x99, 0x30, 0x02, 0xc1, 0x18, 0x5d, 0xfc, 0x3c, 0x21, 0x47, 0x00, 0x99, 0x21, 0x1b, 0x05, 
+	0x00, 0xc0, 0x18, 0x63, 0x68, 0x30, 0x32, 0x00, 0x93, 0x10, 0x89, 0x01, 0x09, 0x02, 0x93, 0x5f, 
+	0xf8, 0x03, 0x22, 0x08, 0x09, 0x9b, 0xa4, 0x68, 0x32, 0xdd, 0xbb, 0x68, 0xe3, 0x40, 0x60, 0x1d, 
+	0x4d, 0x28, 0x00, 0x00, 0x21, 0x63, 0x60, 0x2a, 0x02, 0x3a, 0x10, 0x9f, 0x24, 0x20, 0x9f, 0x11, 
+	0x00, 0x9f, 0x1d, 0xd0, 0x15, 0x37, 0x20, 0x9d, 0xb6, 0x20, 0x9d, 0xbb, 0xfc, 0x01, 0x23, 0x20, 
+	0x52, 0xe7, 0x50, 0x8b, 0x04, 0xfd, 0x63, 0x69, 0x06, 0x19, 0x00, 0xab, 0x42, 0x00, 0x1b, 0x61, 
+	0xb5, 0x1d, 0x49, 0x31, 0xb5, 0x14, 0xa4, 0xfb, 0xab, 0x60, 0x27, 0xf0, 0x01, 0xc1, 0xa6, 0xfd, 
+	0x00, 0x00, 0x22, 0x12, 0x4b, 0x1a, 0x61, 0x9a, 0x60, 0x00, 0x01, 0x20, 0x94, 0xe7, 0x00, 0x23, 
+	0xb8, 0x68, 0x80, 0x35, 0x77, 0x18, 0xfd, 0x00, 0x28, 0xf1, 0xdb, 0x11, 0x01, 0x4d, 0x10, 0x4b, 
+	0x2e, 0x68, 0x28, 0x60, 0x10, 0x45, 0x80, 0x10, 0xaf, 0xff, 0xf7, 0x78, 0xfe, 0x2e, 0x60, 0x00, 
+	0x28, 0x28, 0xe2, 0x00, 0x7f, 0x31, 0x20, 0x7f, 0x00, 0xd0, 0x75, 0x00, 0xe7, 0xa3, 0x68, 0x08, 
+	0x93, 0x18, 0x88, 0xbb, 0xfe, 0x47, 0x9f, 0x13, 0xef, 0x12, 0x0f, 0x22, 0x03, 0x02, 0x0b, 0x12, 
+	0x07, 0x13, 0x4f, 0x37, 0x11, 0xb5, 0x02, 0x25, 0x13, 0x49, 0x2b, 0x42, 0x2d, 0x01, 0xf1, 0x12, 
+	0xa4, 0xf9, 0x29, 0x0b, 0x0f, 0x01, 0xaa, 0x16, 0xc5, 0xac, 0x00, 0xfc, 0x00, 0x28, 0x06, 0xdb, 
+	0x01, 0x9b, 0x9b, 0x60, 0x68, 0x13, 0x49, 0x10, 0x11, 0xe3, 0xfe, 0x14, 0x4d, 0x2b, 0x4a, 0x78, 
+	0x09, 0x5d, 0xd8, 0x13, 0x60, 0xc1, 0x11, 0x40, 0xc1, 0x43, 0x08, 0xfb, 0x01, 0x21, 0x20, 0x00, 
+	0x39, 0xff, 0xf7, 0x90, 0x80, 0x00, 0x37, 0x02, 0xda, 0x0b, 0x48, 0xff, 0xf7, 0x2d, 0x51, 0xfe, 
+	0x10, 0x2d, 0x07, 0x02, 0xbd, 0x32, 0xfd, 0x37, 0x23, 0xeb, 0x01, 0xff, 0xf7, 0x39, 0xfd, 0xea, 
+	0xe7, 0x01, 0x00, 0x4b, 0x0e, 0xbd, 0xfe, 0xf5, 0xe7, 0x12, 0x97, 0x52, 0x93, 0x20, 0x93, 0x23, 
+	0x00, 0xf0, 0xb5, 0x47, 0x4c, 0x23, 0x60, 0x47, 0x4b, 0x40, 0x1f, 0x03, 0x53, 0x5b, 0x02, 0xfd, 
+	0x18, 0x87, 0xb0, 0x00, 0x28, 0x00, 0x67, 0x60, 0xe5, 0x61, 0xfe, 0xf7, 0x10, 0xa3, 0xff, 0x02, 
+	0x02, 0x4b, 0x0b, 0xd1, 0xe0, 0x61, 0x04, 0x20, 0x61, 0xa0, 0x60, 0x60, 0x01, 0x0b, 0x58, 0xfd, 
+	0xa0, 0x17, 0xb1, 0x07, 0x41, 0xf1, 0xe6, 0x69, 0x02, 0x9b, 0xf6, 0x00, 0x18, 0x33, 0x00, 0x38, 
+	0x33, 0x03, 0x93, 0x26, 0x08, 0x61, 0xa6, 0x60, 0x28, 0x05, 0x7a, 0x02, 0x99, 0x04, 0x08, 0xab, 
+	0x00, 0x97, 0xfd, 0x08, 0x53, 0x03, 0x23, 0x04, 0x00, 0x9d, 0x01, 0x3d, 0x1d, 0x43, 0x6b, 0x1c, 
+	0x73, 0x02, 0x63, 0x02, 0x9b, 0x33, 0x63, 0x2e, 0x05, 0xa0, 0x21, 0x00, 0x69, 0x09, 0x36, 0x9a, 
+	0x19, 0x52, 0x1a, 0xe0, 0x00, 0x69, 0x06, 0xf0, 0x78, 0xfb, 0x00, 0x21, 0xe2, 0x00, 0x69, 0xe1, 
+	0x61, 0x2a, 0x49, 0x23, 0x69, 0xa2, 0x00, 0x60, 0x22, 0x61, 0x0c, 0x78, 0x39, 0x35, 0x00, 0x00, 
+	0x2c, 0x1e, 0xd0, 0x03, 0x3c, 0x61, 0x1e, 0x8c, 0x00, 0x41, 0x25, 0x49, 0x64, 0x42, 0x0c, 0x40, 
+	0x80, 0x00, 0x21, 0x9b, 0x1a, 0xf6, 0x1a, 0x03, 0x9b, 0x09, 0x00, 0x02, 0x9e, 0x19, 0x64, 0x18, 
+	0x32, 0x00, 0x21, 0x04, 0x00, 0x05, 0xab, 0x20, 0x48, 0x10, 0x5f, 0x4d, 0xff, 0x00, 0x03, 0x22, 
+	0x05, 0x9b, 0x01, 0x3b, 0x13, 0x43, 0x00, 0x59, 0x1c, 0x32, 0x1f, 0x08, 0x3e, 0x11, 0x60, 0x00, 
+	0x09, 0x33, 0x34, 0x60, 0x5d, 0x19, 0x00, 0x23, 0x00, 0x14, 0x4f, 0xbe, 0x68, 0x73, 0x80, 0x02, 
+	0x9b, 0x10, 0x1c, 0x19, 0x16, 0x03, 0x45, 0x35, 0x80, 0xb3, 0x60, 0x44, 0x74, 0x00, 0xb9, 0xf1, 
+	0xf8, 0x14, 0x01, 0x71, 0xf0, 0x60, 0x00, 0x10, 0x36, 0x00, 0x2b, 0x09, 0xd0, 0x30, 0x00, 0x51, 
+	0x11, 0x05, 0x13, 0x37, 0x03, 0x83, 0xfb, 0x61, 0x7b, 0x00, 0x1d, 0x04, 0xec, 0xfc, 0x93, 0xe7, 
+	0x0e, 0x26, 0x19, 0x09, 0xfb, 0xa3, 0x35, 0x07, 0x30, 0x25, 0x07, 0x5e, 0xfa, 0xed, 0x41, 0xcb, 
+	0x1e, 0x6b, 0x8f, 0x21, 0x37, 0xa0, 0xff, 0xff, 0x11, 0x37, 0x15, 0x1b, 0x55, 0x17, 0x11, 0xd3, 
+	0x80, 0x59, 0x83, 0x57, 0xff, 0x20, 0x4b, 0x01, 0x38, 0x98, 0x01, 0x42, 0x04, 0xd9, 0xff, 0xf7, 
+	0x25, 0xf9, 0x39, 0x25, 0x88, 0x0b, 0x57, 0xf8, 0x1b, 0x4d, 0x19, 0x99, 0x01, 0xaa, 0x01, 0xc8, 
+	0x0c, 0x1f, 0x0c, 0x98, 0xf9, 0x20, 0x08, 0xf7, 0x1f, 0xfc, 0x01, 0x00, 0x26, 0x04, 0x27, 0x00, 
+	0x98, 0xfe, 0xf7, 0x7e, 0x02, 0xfb, 0x04, 0x00, 0x30, 0x42, 0x08, 0x0b, 0xf9, 0x28, 0x84, 0x29, 
+	0x91, 0xb4, 0xfa, 0x00, 0x28, 0x14, 0x25, 0x04, 0xf9, 0x42, 0x3c, 0x0b, 0xbd, 0x00, 0x22, 0x31, 
+	0x00, 0x15, 0xd7, 0xa9, 0x69, 0xfa, 0x39, 0x05, 0x19, 0x9d, 0x30, 0x21, 0xf7, 0x98, 0xf9, 0x19, 
+	0x97, 0x04, 0xdd, 0xd0, 0x00, 0xf0, 0xed, 0x0e, 0x05, 0xfe, 0xf7, 0x10, 0x1a, 0xfc, 0xc5, 0x00, 
+	0xaf, 0xbe, 0xdf, 0x00, 0x00, 0xb8, 0x18, 0xf7, 0x03, 0x01, 0xe5, 0x05, 0x0d, 0x27, 0x6b, 0x21, 
+	0xd5, 0x00, 0x00, 0x24, 0x80, 0x22, 0x1f, 0x4b, 0x1c, 0x60, 0x1f, 0x02, 0x4b, 0x52, 0x00, 0x03, 
+	0x20, 0x1a, 0x09, 0x2b, 0x81, 0x08, 0xfb, 0xfe, 0xf7, 0xbf, 0x00, 0x03, 0xeb, 0xfa, 0x22, 0x00, 
+	0x00, 0x09, 0x20, 0x1a, 0x49, 0xfe, 0xf7, 0x9c, 0x80, 0x09, 0x0f, 0xfe, 0xf7, 0xd3, 0xfb, 0xff, 
+	0xf7, 0xf3, 0x20, 0xfe, 0xa0, 0x02, 0x81, 0x16, 0x4b, 0x98, 0x42, 0x07, 0x49, 0xdd, 0x03, 0xff, 
+	0xf8, 0x02, 0x00, 0x17, 0xeb, 0xfb, 0x37, 0x71, 0xe4, 0x03, 0xe3, 0x0d, 0xad, 0x10, 0x7f, 0x54, 
+	0xfb, 0x00, 0xa7, 0xda, 0x80, 0x35, 0x20, 0x40, 0x07, 0xef, 0x10, 0xb7, 0x58, 0x40, 0xb7, 0xa8, 
+	0x20, 0x2f, 0x11, 0xd3, 0xfb, 0x03, 0x00, 0x05, 0x4e, 0xfb, 0xe3, 0x00, 0x93, 0xb5, 0x13, 0x07, 
+	0x54, 0x00, 0x03, 0x19, 0x93, 0xa2, 0x0b, 0xbf, 0xbf, 0x00, 0xa3, 0x10, 0xf0, 0xb5, 0x44, 0x04, 
+	0xd9, 0x89, 0xb0, 0x0f, 0x00, 0xc1, 0x02, 0x67, 0x05, 0x15, 0xfe, 0xf7, 0xf0, 0xff, 0x40, 0x2d, 
+	0x27, 0x08, 0x93, 0x42, 0x0e, 0xd0, 0x0b, 0x1f, 0x26, 0x3e, 0x4d, 0x00, 0xa3, 0x61, 0x2b, 0x78, 
+	0x03, 0x93, 0x3d, 0x4b, 0x00, 0x10, 0x00, 0x19, 0x68, 0x2e, 0x70, 0x06, 0xf0, 0x40, 0x29, 0x03, 
+	0x6b, 0xa6, 0x61, 0x2b, 0x70, 0x38, 0x00, 0x00, 0x3b, 0x6b, 0x04, 0x93, 0x38, 0x4b, 0x7c, 0x6b, 
+	0x00, 0x19, 0x78, 0x38, 0x30, 0x3a, 0x88, 0x05, 0x19, 0x04, 0x00, 0x29, 0x11, 0xd1, 0x23, 0x02, 
+	0x8b, 0x93, 0x42, 0x00, 0x08, 0xd1, 0x80, 0x23, 0x04, 0x9a, 0x5b, 0x02, 0x00, 0x9a, 0x42, 0x03, 
+	0xd8, 0x02, 0x91, 0x03, 0x91, 0x01, 0x9c, 0x42, 0x1f, 0xd9, 0x00, 0x20, 0x09, 0x42, 0xb5, 0x00, 
+	0x2b, 0x68, 0x02, 0x93, 0x6b, 0x68, 0x03, 0x93, 0x01, 0x23, 0x00, 0x03, 0x99, 0x40, 0x33, 0x5b, 
+	0x0f, 0x91, 0x40, 0xf0, 0x60, 0x2f, 0xeb, 0xd8, 0x9c, 0x42, 0xe9, 0xd8, 0x30, 0x80, 0x23, 0x00, 
+	0x83, 0x00, 0x0d, 0xe4, 0xd8, 0x89, 0x23, 0x00, 0x1b, 0x02, 0x99, 0x42, 0xe0, 0xd8, 0x08, 0x35, 
+	0x40, 0x04, 0x0d, 0x5d, 0x23, 0x43, 0x13, 0x43, 0x03, 0x9a, 0x00, 0x13, 0x43, 0x19, 0x00, 0x03, 
+	0x22, 0x11, 0x40, 0x00, 0x05, 0x91, 0x13, 0x42, 0xd3, 0xd1, 0xe0, 0x23, 0x00, 0x13, 0x4e, 0x32, 
+	0x68, 0x1b, 0x02, 0xd2, 0x18, 0x00, 0xf2, 0x61, 0x06, 0xab, 0x00, 0x91, 0x21, 0x00, 0x14, 0x06, 
+	0x94, 0xfd, 0x0d, 0xd1, 0x02, 0x04, 0x11, 0x08, 0xd0, 0x20, 0x05, 0x9b, 0x04, 0xb5, 0x93, 0x0f, 
+	0x4a, 0x03, 0x99, 0x10, 0x07, 0xab, 0x07, 0x00, 0x17, 0x6a, 0xff, 0x04, 0x99, 0x04, 0xf0, 0x69, 
+	0xfe, 0xf7, 0xc6, 0x06, 0xe7, 0xf3, 0x61, 0x00, 0x98, 0x42, 0xb3, 0xd1, 0x09, 0x4b, 0xba, 0x68, 
+	0x41, 0x1a, 0x02, 0x11, 0xf5, 0xfd, 0x38, 0x88, 0xad, 0x42, 0x6b, 0xba, 0x12, 0x4f, 0x4d, 0x16, 
+	0xf3, 0x53, 0xab, 0x42, 0x6f, 0x0a, 0x01, 0xcb, 0x07, 0x80, 0x01, 0xcb, 0x0c, 0xd5, 0xfe, 0xf7, 
+	0x89, 0xff, 0x00, 0x51, 0x21, 0x11, 0x81, 0x93, 0x01, 0x71, 0x04, 0xdb, 0x05, 0x0a, 0x07, 0x43, 
+	0x18, 0x02, 0x21, 0x56, 0xff, 0x03, 0xb0, 0x79, 0x13, 0x10, 0x47, 0x80, 0x1b, 0x97, 0x85, 0xb0, 
+	0x02, 0x94, 0xfe, 0xf7, 0x42, 0x08, 0xff, 0x32, 0x4f, 0x23, 0x0c, 0xd5, 0x02, 0xaa, 0x03, 0x22, 
+	0xa9, 0x3c, 0x00, 0x71, 0x7a, 0xf8, 0x03, 0x08, 0x5b, 0xa3, 0x20, 0x42, 0x47, 0x08, 0x21, 0xfe, 
+	0xf7, 0xd9, 0xfa, 0x03, 0x20, 0x9e, 0x30, 0x00, 0x07, 0x39, 0xfa, 0x01, 0x22, 0x01, 0x80, 0x0b, 
+	0x8d, 0x02, 0x40, 0x18, 0x42, 0x3e, 0xd0, 0x00, 0x34, 0x26, 0xeb, 0x0a, 0x65, 0x10, 0x17, 0x90, 
+	0x0c, 0x95, 0x98, 0x42, 0x10, 0x05, 0xd1, 0x30, 0x08, 0x37, 0x80, 0x26, 0xff, 0xf7, 0x04, 0x21, 
+	0xff, 0xb6, 0x01, 0x1f, 0x00, 0x8f, 0x01, 0x36, 0x08, 0xb3, 0x42, 0xee, 0xdc, 0x15, 0x9f, 0x9e, 
+	0x42, 0x0d, 0x51, 0xda, 0x11, 0xf5, 0x56, 0x0e, 0x95, 0x29, 0x20, 0x19, 0x02, 0x4d, 0x00, 0x5d, 
+	0xfb, 0x3c, 0x26, 0x01, 0x3e, 0x06, 0xf0, 0x02, 0x7b, 0xf9, 0x00, 0x2e, 0xfa, 0xd1, 0x12, 0xbb, 
+	0x06, 0x82, 0x02, 0xbb, 0x02, 0xaa, 0x18, 0x00, 0x03, 0x0b, 0xc1, 0x3a, 0x35, 0xf8, 0x05, 0x19, 
+	0xb2, 0x0c, 0x5b, 0x0f, 0x02, 0xc3, 0xbf, 0x02, 0xc3, 0x24, 0x8b, 0xfa, 0x12, 0xc3, 0xb8, 0xfa, 
+	0x58, 0xa5, 0x04, 0x23, 0x18, 0x18, 0x42, 0xe3, 0x06, 0x3f, 0x1c, 0x0d, 0x2b, 0xf9, 0x3b, 0x20, 
+	0x68, 0x72, 0x0c, 0x0d, 0xdb, 0xd1, 0x02, 0x3e, 0x3e, 0x1b, 0x60, 0xd8, 0xe7, 0x12, 0xdf, 0x1b, 
+	0x3f, 0xb7, 0x02, 0x4b, 0x12, 0xe7, 0x00, 0x10, 0xb5, 0x0f, 0x48, 0x0f, 0x49, 0x03, 0x78, 0x00, 
+	0x0a, 0x68, 0x0f, 0x4c, 0x01, 0x33, 0x1b, 0x06, 0x00, 0x1b, 0x0e, 0x14, 0x43, 0x03, 0x70, 0x0c, 
+	0x60, 0x02, 0x01, 0x2b, 0x07, 0xd1, 0x9a, 0x43, 0x14, 0xd9, 0x13, 0x10, 0x43, 0x0b, 0x60, 0x3a, 
+	0x85, 0x02, 0x2b, 0x03, 0xd1, 0x01, 0x06, 0x4b, 0x1a, 0x40, 0x01, 0x23, 0xf4, 0x05, 0xe7, 0x14, 
+	0x03, 0x70, 0xf3, 0x01, 0x77, 0x98, 0x00, 0x4b, 0x10, 0x3d, 0x00, 0x00, 0x03, 0x01, 0x00, 0x01, 
+	0x00, 0xff, 0xff, 0x2a, 0xfe, 0xff, 0x30, 0x4f, 0x43, 0xa0, 0x4f, 0x43, 0x20, 0x4f, 0x08, 0x14, 
+	0xd1, 0x01, 0x33, 0x10, 0x51, 0x9b, 0xa0, 0x51, 0x02, 0xd1, 0x04, 0x06, 0x48, 0x02, 0x40, 0xf5, 
+	0x00, 0x4f, 0x43, 0x70, 0x50, 0xf4, 0x80, 0x4f, 0x02, 0x05, 0x66, 0xff, 0xff, 0xfd, 0xff, 0x08, 
+	0x04, 0x4a, 0x13, 0x78, 0x30, 0x47, 0x02, 0x2b, 0x00, 0x00, 0xd9, 0x00, 0x23, 0x13, 0x70, 0x70, 
+	0x47, 0x3f, 0x80, 0x01, 0xd3, 0x01, 0x23, 0x02, 0x4a, 0x11, 0x78, 0x8b, 0x40, 0x43, 0x10, 0x0f, 
+	0x00, 0x3c, 0x00, 0x03, 0x80, 0x23, 0x00, 0x03, 0x4a, 0x11, 0x68, 0xdb, 0x00, 0x4b, 0x40, 0x1d, 
+	0x13, 0x60, 0x70, 0x01, 0xc7, 0x20, 0x93, 0x00, 0x23, 0x91, 0x00, 0x23, 0x62, 0x93, 0x00, 0x23, 
+	0x10, 0x57, 0x03, 0x21, 0x03, 0x20, 0x4d, 0x0b, 0x4a, 0x40, 0x10, 0x35, 0xc0, 0x46, 0x1a, 0xf3, 
+	0x02, 0x00, 0x11, 0x59, 0x16, 0x42, 0x4b, 0x41, 0x10, 0x11, 0x3d, 0x00, 0x0f, 0xd0, 0x23, 0x94, 
+	0xc5, 0xc0, 0x23, 0x12, 0x5f, 0x10, 0xb5, 0x08, 0x60, 0x95, 0x04, 0x40, 0x95, 0x04, 0x01, 0x22, 
+	0x04, 0x4b, 0x1a, 0x03, 0x67, 0x2d, 0xf8, 0xda, 0x30, 0xd9, 0x1b, 0x47, 0x4c, 0x20, 0x2b, 0x04, 
+	0x7f, 0xf9, 0x14, 0x1d, 0xc4, 0x00, 0xf9, 0xfd, 0xf7, 0xe6, 0xf9, 0x10, 0xb5, 0x07, 0x00, 0x4c, 
+	0x20, 0x78, 0x03, 0x21, 0x01, 0x30, 0x06, 0x10, 0xf0, 0x6b, 0xf8, 0x02, 0x14, 0xd1, 0x01, 0x31, 
+	0x21, 0xaa, 0x00, 0x37, 0x45, 0x40, 0x37, 0x3c, 0x2c, 0x1b, 0x07, 0x60, 0x5f, 0x03, 0x88, 0x40, 
+	0x5f, 0x06, 0xf0, 0x5c, 0x40, 0x21, 0xc0, 0x46, 0xea, 0x88, 0x00, 0x23, 0x0f, 0x4a, 0xd3, 0x40, 
+	0x21, 0xd3, 0x70, 0x01, 0x83, 0x01, 0x97, 0x0c, 0x4b, 0x0d, 0x4a, 0x1a, 0x00, 0xf9, 0x11, 0x51, 
+	0x02, 0x09, 0x4b, 0x0b, 0x4a, 0xf8, 0xe7, 0x0a, 0x61, 0xd1, 0x01, 0xfe, 0x22, 0x06, 0x4b, 0xd2, 
+	0x05, 0xf2, 0x00, 0x0b, 0x00, 0xf1, 0xd9, 0x04, 0x4b, 0x06, 0x49, 0x19, 0x60, 0x05, 0x00, 0x23, 
+	0xd3, 0x70, 0xeb, 0x41, 0x67, 0x60, 0x00, 0x9f, 0x00, 0xa0, 0x8c, 0x00, 0x00, 0xe0, 0xa5, 0x01, 
+	0x00, 0x22, 0x50, 0x46, 0x06, 0xd9, 0x20, 0x70, 0x47, 0x00, 0x01, 0xb5, 0x00, 0x04, 0x00, 0x07, 
+	0x48, 0x16, 0x00, 0x07, 0x4d, 0x84, 0x1f, 0x7f, 0x05, 0xf0, 0x40, 0xff, 0x05, 0x45, 0x1d, 0x05, 
+	0x17, 0xf0, 0x14, 0xff, 0x5d, 0x8d, 0x9c, 0x00, 0x3b, 0x21, 0xa7, 0x00, 0x29, 0x40, 0x09, 0x0a, 
+	0x53, 0x12, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x00, 0x08, 0x4b, 0x58, 0x6a, 0xc3, 0x0f, 0x1b, 0x18, 
+	0x00, 0x20, 0x00, 0x5b, 0x10, 0x0a, 0x30, 0xc0, 0x1a, 0x41, 0x05, 0x02, 0xc9, 0xf8, 0xf9, 0x60, 
+	0x1c, 0x10, 0x20, 0x33, 0xf5, 0x12, 0x77, 0x10, 0x33, 0x10, 0x3b, 0x11, 0x13, 0xcc, 0x0c, 0xdd, 
+	0xdf, 0x0c, 0xf7, 0xf0, 0x10, 0x1b, 0x10, 0x47, 0x02, 0x57, 0x40, 0x47, 0x05, 0x49, 0x25, 0x30, 
+	0x1d, 0xfe, 0xf7, 0xdb, 0x60, 0x39, 0x3f, 0x2b, 0x50, 0x37, 0xb0, 0x00, 0x37, 0x43, 0xe7, 0x40, 
+	0x37, 0x70, 0xb5, 0x01, 0x25, 0x13, 0x39, 0x0f, 0x5b, 0x08, 0x22, 0x20, 0x20, 0x24, 0x00, 0x6f, 
+	0xc0, 0xf9, 0x23, 0x80, 0x06, 0xad, 0x23, 0x4c, 0x9b, 0x00, 0x1a, 0x59, 0x23, 0x44, 0x49, 0x18, 
+	0x07, 0xe5, 0xff, 0x22, 0x00, 0x11, 0x9b, 0x00, 0x00, 0xe3, 0x18, 0xda, 0x68, 0x20, 0x49, 0xff, 
+	0xf7, 0x04, 0xdd, 0xff, 0x20, 0x4e, 0xf3, 0x20, 0x0f, 0x9a, 0x69, 0x44, 0x1e, 0x00, 0x0f, 0xd5, 
+	0xff, 0x1e, 0x03, 0x8d, 0x9b, 0x0a, 0x28, 0x2b, 0x40, 0x30, 0x23, 0x1b, 0x00, 0x13, 0xcb, 0xff, 
+	0xb3, 0x51, 0x78, 0x50, 0x0f, 0x18, 0x00, 0x0f, 0xc3, 0xff, 0x18, 0x40, 0x43, 0x13, 0x9a, 0x6a, 
+	0x16, 0x00, 0x0f, 0xbb, 0xff, 0x07, 0x21, 0x40, 0x53, 0x48, 0x14, 0x00, 0x0f, 0xb3, 0xff, 0x17, 
+	0x23, 0x9b, 0x00, 0xe4, 0x09, 0x18, 0x13, 0x49, 0xe2, 0x03, 0x73, 0xab, 0xff, 0x3c, 0xc1, 0x6b, 
+	0xcd, 0x03, 0x63, 0x12, 0xab, 0x60, 0x0b, 0x83, 0xe3, 0x00, 0x0b, 0x12, 0xa7, 0x6c, 0xeb, 0x00, 
+	0x07, 0x11, 0x07, 0xf7, 0x00, 0x07, 0x12, 0xa3, 0x03, 0x9c, 0x1b, 0x00, 0x08, 0x0e, 0x00, 0x03, 
+	0x12, 0x8b, 0x1f, 0x00, 0x07, 0x12, 0x5f, 0x69, 0x2a, 0x00, 0x07, 0x12, 0x8b, 0x3c, 0x00, 0x07, 
+	0x10, 0xb5, 0x10, 0xe1, 0x50, 0x48, 0x20, 0xe1, 0x0f, 0x00, 0xe1, 0x4f, 0xf9, 0x0f, 0x4a, 0x00, 
+	0x12, 0x68, 0x0f, 0x4b, 0x92, 0x00, 0xd2, 0x58, 0x45, 0x0e, 0x20, 0xe1, 0x74, 0xff, 0x0d, 0x00, 
+	0x7d, 0x0d, 0x00, 0xf3, 0x91, 0x00, 0x9f, 0x6b, 0x0c, 0x00, 0x8f, 0x6b, 0xff, 0x0c, 0x40, 0x8f, 
+	0x01, 0x0b, 0x49, 0xe2, 0x6c, 0xff, 0xf7, 0x63, 0x4e, 0x5f, 0x60, 0x4e, 0x00, 0x4f, 0x1d, 0xef, 
+	0x18, 0x98, 0x00, 0x08, 0x65, 0xed, 0x00, 0x0b, 0x12, 0xa3, 0x10, 0x9b, 0x6f, 0x00, 0x0b, 0x12, 
+	0xe7, 0x77, 0x60, 0x6f, 0x52, 0x10, 0x20, 0x6f, 0x0d, 0x00, 0x6f, 0x17, 0xf9, 0x10, 0x5d, 0x01, 
+	0x02, 0x3b, 0x5a, 0x42, 0x53, 0x41, 0x0b, 0x20, 0x63, 0xda, 0x22, 0x6d, 0x0a, 0x20, 0x77, 0x38, 
+	0xff, 0x09, 0x40, 0x65, 0x08, 0x1b, 0x49, 0x62, 0x6e, 0x1e, 0x8b, 0x52, 0x9f, 0x8c, 0x00, 0x47, 
+	0x12, 0xc7, 0xb7, 0x10, 0x5b, 0xa0, 0x00, 0x0b, 0x12, 0xaf, 0xaf, 0x20, 0x5b, 0xf2, 0x2f, 0x72, 
+	0x2f, 0x0d, 0xfe, 0xf7, 0xe1, 0xf8, 0xb1, 0xf3, 0x52, 0x63, 0x05, 0x60, 0x33, 0xb8, 0x12, 0x19, 
+	0xce, 0x60, 0x25, 0x10, 0x23, 0x12, 0xad, 0x15, 0x00, 0x88, 0x88, 0x22, 0xa9, 0xeb, 0xfd, 0x29, 
+	0x05, 0xa7, 0x05, 0xf0, 0xbf, 0x40, 0xfd, 0x31, 0x7f, 0xf7, 0xb5, 0x2a, 0x4e, 0x33, 0x68, 0x00, 
+	0x01, 0x20, 0x01, 0x93, 0xfd, 0xf7, 0xa7, 0xff, 0x00, 0x28, 0x4d, 0xab, 0x6a, 0x5a, 0x1c, 0x3c, 
+	0xd0, 0x14, 0x33, 0x60, 0x26, 0x00, 0xb7, 0x26, 0x20, 0xcb, 0x2f, 0x1d, 0x04, 0x5a, 0x6f, 0x38, 
+	0x00, 0x24, 0x01, 0x33, 0xdb, 0xff, 0x05, 0x00, 0x22, 0x39, 0x00, 0x12, 0x00, 0xfb, 0x9e, 0x00, 
+	0xfb, 0x11, 0x13, 0x20, 0x20, 0x00, 0xfb, 0x99, 0xf8, 0x6b, 0x41, 0xe5, 0x5a, 0x1e, 0x20, 0xf1, 
+	0xa3, 0x0a, 0x23, 0x10, 0xef, 0xe2, 0x22, 0x25, 0x9c, 0x24, 0xfe, 0x1a, 0x00, 0x05, 0x95, 0xff, 
+	0x10, 0x05, 0x92, 0xff, 0x40, 0x19, 0x00, 0x05, 0x8f, 0xff, 0x6b, 0x6a, 0x18, 0x4c, 0x04, 0x08, 
+	0x2b, 0x0d, 0xd1, 0x21, 0x07, 0xd3, 0x88, 0xff, 0xa9, 0x12, 0x2b, 0x85, 0x20, 0x05, 0x82, 0x06, 
+	0x05, 0x33, 0x60, 0x38, 0xd5, 0x45, 0x13, 0x00, 0x0f, 0x7a, 0xff, 0x12, 0x00, 0x05, 0x77, 0x20, 
+	0x05, 0x36, 0x74, 0xff, 0x1e, 0x33, 0x50, 0xef, 0x09, 0x13, 0x97, 0x01, 0x37, 0xc3, 0xa8, 0x01, 
+	0x2f, 0xdb, 0x00, 0x03, 0xf3, 0x00, 0x03, 0x00, 0x9d, 0x00, 0x2a, 0x08, 0x0d, 0x00, 0x03, 0x17, 
+	0x00, 0x03, 0x28, 0x00, 0x03, 0x36, 0xaa, 0x00, 0x03, 0x64, 0x00, 0x03, 0x6c, 0x00, 0x03, 0x3c, 
+	0x00, 0x03, 0x49, 0xb0, 0x00, 0x03, 0x56, 0x00, 0x03, 0x16, 0xb3, 0x20, 0x4e, 0x83, 0x00, 0x00, 
+	0x20, 0x4d, 0xf3, 0x18, 0x9b, 0x68, 0x85, 0xb0, 0x00, 0x2c, 0x60, 0x02, 0x93, 0x01, 0x90, 0x00, 
+	0xf0, 0x40, 0xf9, 0x09, 0x35, 0xfd, 0xf7, 0x84, 0xff, 0x1b, 0x4b, 0x00, 0x1b, 0x88, 0xdb, 0x43, 
+	0x1b, 0x4a, 0x13, 0x60, 0x00, 0x01, 0x9b, 0xf3, 0x18, 0x1b, 0x7f, 0x03, 0x93, 0x02, 0x03, 0x98, 
+	0xfd, 0xf7, 0xdc, 0xfe, 0x16, 0xb7, 0x18, 0x10, 0x42, 0x09, 0xd0, 0x0b, 0x3f, 0x00, 0x2f, 0x68, 
+	0xf3, 0x00, 0x18, 0x5b, 0x6a, 0xba, 0x00, 0xd3, 0x58, 0x00, 0x02, 0xf0, 0xdd, 0xf9, 0x2f, 0x60, 
+	0x10, 0x06, 0x63, 0x02, 0x40, 0xd0, 0x07, 0x95, 0xf0, 0xd6, 0xf9, 0x0e, 0x4f, 0x3c, 0x20, 0x42, 
+	0xe5, 0x0b, 0x79, 0x53, 0xff, 0x00, 0x20, 0xfd, 0x01, 0xf7, 0x80, 0xff, 0x3c, 0x42, 0x03, 0xd1, 
+	0x56, 0x73, 0x00, 0x05, 0xf0, 0x24, 0xfe, 0x03, 0x4b, 0x1c, 0x88, 0x06, 0xe4, 0x43, 0xf3, 0xe7, 
+	0xe0, 0x00, 0xbf, 0x10, 0xcf, 0x30, 0x0a, 0x01, 0x00, 0x04, 0x58, 0x00, 0x07, 0xf1, 0x06, 0x67, 
+	0x02, 0xb2, 0x26, 0x6b, 0x02, 0x1b, 0xab, 0x42, 0x27, 0x10, 0xb5, 0x16, 0xb5, 0x0f, 0x22, 0xf8, 
+	0x03, 0x00, 0x13, 0xa2, 0xff, 0x08, 0x00, 0x0b, 0x09, 0xe9, 0x44, 0xe1, 0x01, 0xf3, 0x00, 0x13, 
+	0x98, 0x40, 0x27, 0x70, 0xb5, 0x13, 0x6d, 0x00, 0x00, 0x2b, 0x25, 0xd0, 0x15, 0x4c, 0x16, 0x49, 
+	0x00, 0x20, 0x00, 0x16, 0x4d, 0x05, 0xf0, 0xf6, 0xfc, 0x00, 0x05, 0xf0, 0xa8, 0xfd, 0x82, 0x06, 
+	0x92, 0x0f, 0x24, 0x30, 0x32, 0x0f, 0xdb, 0x76, 0x0f, 0x08, 0x57, 0x30, 0x31, 0x08, 0x69, 0x76, 
+	0x01, 0x13, 0x10, 0x07, 0xe9, 0x76, 0x01, 0x40, 0x12, 0x10, 0x07, 0x29, 0x77, 0x01, 0x15, 0x00, 
+	0x14, 0x00, 0x11, 0x40, 0x10, 0x40, 0x00, 0x22, 0x30, 0x31, 0x00, 0x30, 0x30, 0xa9, 0x77, 0xe8, 
+	0x77, 0x21, 0x00, 0x51, 0x10, 0x01, 0x0b, 0xac, 0x43, 0xa1, 0xc0, 0x46, 0x40, 0x44, 0x5b, 0x60, 
+	0x71, 0x01, 0x3f, 0x11, 0x7f, 0x4e, 0x4b, 0xf7, 0xb5, 0x1d, 0x80, 0x0b, 0xd1, 0x01, 0x24, 0x00, 
+	0x26, 0x4c, 0x4f, 0x1b, 0x00, 0x05, 0x9d, 0x42, 0xad, 0x41, 0xbe, 0x62, 0xfd, 0x02, 0xf7, 0xc7, 
+	0xfe, 0x21, 0x00, 0x49, 0x04, 0x29, 0x1a, 0x08, 0x0c, 0x91, 0x43, 0x0a, 0x0b, 0x4f, 0xa2, 0x40, 
+	0x99, 0x00, 0x43, 0x0a, 0x43, 0x21, 0x00, 0x3a, 0x70, 0x5a, 0x91, 0x00, 0x11, 0xe3, 0x40, 0x10, 
+	0x13, 0x99, 0x43, 0x0b, 0x00, 0x17, 0x00, 0x13, 0x43, 0x7b, 0x70, 0x40, 0x4b, 0x6d, 0x42, 0x00, 
+	0x5b, 0x19, 0x1b, 0x7f, 0x3f, 0x4a, 0x7b, 0x62, 0x00, 0x3f, 0x4b, 0x1e, 0x60, 0x13, 0x88, 0x00, 
+	0x93, 0x01, 0x16, 0x80, 0x3d, 0x4a, 0x13, 0x88, 0x01, 0x09, 0x93, 0x00, 0x16, 0x80, 0x1e, 0x60, 
+	0xbe, 0x62, 0xff, 0xf7, 0x70, 0xaf, 0x0f, 0x27, 0x11, 0x7f, 0x1f, 0x67, 0x8b, 0xf8, 0x04, 0x00, 
+	0x64, 0xb0, 0x08, 0x27, 0x0c, 0xd7, 0xfe, 0x35, 0x0a, 0x6d, 0xfd, 0xf7, 0x14, 0xbc, 0xfd, 0x34, 
+	0x21, 0xaf, 0x34, 0x01, 0xaf, 0xff, 0xf7, 0x00, 0x7c, 0xff, 0x29, 0x4e, 0x70, 0x6a, 0xfd, 0xf7, 
+	0x40, 0x05, 0x01, 0xad, 0x2c, 0x4f, 0x3a, 0x68, 0x04, 0x00, 0x00, 0xb2, 0x62, 0x18, 0x42, 0x16, 
+	0xd0, 0x25, 0x4b, 0x14, 0xa9, 0x00, 0x5b, 0x01, 0xb1, 0x92, 0x21, 0xb1, 0x04, 0xf9, 0x03, 0x80, 
+	0x22, 0xb3, 0x6a, 0x3b, 0x60, 0x0d, 0x25, 0x0f, 0x07, 0x00, 0x93, 0x42, 0x9b, 0x41, 0x5b, 0x42, 
+	0xab, 0x42, 0x40, 0x03, 0x08, 0x3d, 0x01, 0x25, 0x3b, 0x60, 0xb3, 0x62, 0x52, 0xf1, 0x08, 0x4b, 
+	0x01, 0x01, 0xc1, 0x72, 0xfe, 0x0a, 0xd1, 0x42, 0x30, 0xd3, 0xd0, 0x18, 0x89, 0x3a, 0x41, 0xf1, 
+	0xff, 0xfe, 0xf7, 0x10, 0x55, 0xfe, 0x02, 0x01, 0xd7, 0x70, 0xfe, 0x02, 0x25, 0x00, 0x2c, 0x42, 
+	0x11, 0xd1, 0x00, 0x9a, 0x0f, 0x4b, 0x02, 0x1a, 0x80, 0x01, 0x9a, 0x10, 0x4b, 0x0a, 0xf5, 0x80, 
+	0x00, 0xfd, 0xf7, 0x06, 0xfe, 0xfd, 0xf7, 0x54, 0xfe, 0x00, 0x01, 0x22, 0x07, 0x4b, 0x52, 0x42, 
+	0x9a, 0x62, 0x82, 0x32, 0xcb, 0x05, 0xf0, 0x29, 0xfd, 0x0b, 0x21, 0xf5, 0xe5, 0xe0, 0x4a, 0xab, 
+	0x57, 0xbf, 0x12, 0x03, 0x80, 0x00, 0x00, 0x04, 0x40, 0xff, 0x17, 0x3f, 0x02, 0x07, 0x12, 0x0f, 
+	0x1a, 0xc3, 0x52, 0x13, 0x12, 0x0f, 0x06, 0x7a, 0x03, 0xdf, 0x20, 0x07, 0x24, 0x11, 0x05, 0x0b, 
+	0xff, 0x05, 0xf0, 0x03, 0x04, 0xfd, 0x01, 0x3c, 0xf8, 0xd2, 0x02, 0xc3, 0x00, 0x01, 0x08, 0x34, 
+	0xfd, 0xf7, 0x08, 0x00, 0x11, 0xfa, 0xfc, 0x11, 0x10, 0x2c, 0xf7, 0xd1, 0x52, 0x15, 0xfe, 0xf7, 
+	0x04, 0xfe, 0x04, 0xff, 0xf7, 0xe6, 0xff, 0x80, 0x0d, 0xcd, 0xdb, 0x04, 0x42, 0x1a, 0x06, 0xcb, 
+	0x05, 0x4a, 0x13, 0x80, 0x60, 0x03, 0xf0, 0x35, 0x87, 0xfc, 0x40, 0x29, 0x00, 0x77, 0x12, 0x00, 
+	0x03, 0x50, 0x00, 0x03, 0xa2, 0x16, 0x33, 0xcd, 0x00, 0x49, 0xad, 0xfc, 0x07, 0x00, 0xdb, 0xd8, 
+	0x22, 0xfe, 0x05, 0x21, 0x53, 0x9b, 0x05, 0x02, 0x40, 0x55, 0x05, 0x18, 0xf0, 0xc8, 0xfc, 0x18, 
+	0x77, 0x10, 0x97, 0x70, 0xb5, 0x14, 0x08, 0x4e, 0x14, 0x4b, 0x32, 0x0a, 0x57, 0x05, 0xf0, 0x51, 
+	0xa4, 0x02, 0x61, 0x6b, 0x00, 0x03, 0x45, 0xfc, 0x11, 0x13, 0x88, 0xfd, 0x00, 0x34, 0x68, 0x0a, 
+	0x3c, 0x4a, 0x2c, 0x12, 0xdd, 0x00, 0x4a, 0x24, 0x20, 0x25, 0x32, 0x68, 0x12, 0x1b, 0x80, 0x14, 
+	0x8d, 0x0a, 0x4b, 0xa1, 0x00, 0x28, 0x00, 0x59, 0x00, 0x58, 0x01, 0x35, 0xfd, 0xf7, 0x83, 0xfe, 
+	0x01, 0x04, 0x34, 0x34, 0x2d, 0xf1, 0xd1, 0x32, 0x57, 0xe3, 0x43, 0x06, 0xdb, 0x17, 0x1c, 0x40, 
+	0xe9, 0x43, 0xd7, 0x55, 0x73, 0x70, 0x80, 0x02, 0xf1, 0xfd, 0xf7, 0x96, 0xfe, 0x12, 0x4a, 0x13, 
+	0x04, 0x4b, 0x12, 0x68, 0x13, 0x4d, 0x1a, 0xbf, 0xc5, 0xff, 0x45, 0x2b, 0x00, 0x8f, 0xf0, 0x26, 
+	0x10, 0x01, 0xe5, 0x5e, 0x00, 0x1d, 0x34, 0x15, 0xfd, 0x1c, 0xd1, 0x11, 0xa3, 0xb8, 0x05, 0xc5, 
+	0x1c, 0x42, 0x22, 0xf4, 0xd0, 0x10, 0x05, 0x05, 0xd1, 0x08, 0x00, 0x1b, 0x79, 0x41, 0xfe, 0x30, 
+	0x5d, 0x05, 0xf0, 0x6e, 0xfc, 0x2c, 0x01, 0x73, 0x7d, 0xf1, 0x00, 0x5f, 0x10, 0x5b, 0x93, 0x6b, 
+	0x19, 0xd3, 0x11, 0x5b, 0x18, 0x02, 0xdb, 0x00, 0xf1, 0x04, 0xda, 0xe5, 0x01, 0x00, 0x10, 0xe3, 
+	0x00, 0x0f, 0xe0, 0xa0, 0x11, 0x10, 0xf0, 0x9f, 0x15, 0x00, 0x01, 0x90, 0x89, 0xe2, 0x40, 0x80, 
+	0x58, 0xe2, 0x00, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0x00, 0xb8, 0xf4, 0x9a, 0xe5, 
+	0x7c, 0x46, 0x00, 0x08, 0x00, 0x02, 0x01, 0x13, 0xe3, 0x0f, 0x00, 0x00, 0x1a, 0x00, 0x04, 0x02, 
+	0xa0, 0xe1, 0x06, 0x02, 0x90, 0xe2, 0x00, 0x03, 0x02, 0xb0, 0x31, 0x06, 0x44, 0x94, 0x22, 0x00, 
+	0x02, 0x32, 0x83, 0x23, 0x06, 0x02, 0x94, 0xe2, 0x28, 0x83, 0x01, 0x00, 0x0f, 0x42, 0x30, 0x0f, 
+	0x05, 0x32, 0xc3, 0x00, 0xe3, 0xff, 0x04, 0x14, 0xe3, 0x01, 0x31, 0x83, 0x40, 0x03, 0xd0, 0x4b, 
+	0x01, 0x02, 0x13, 0xe3, 0x06, 0x44, 0x10, 0x44, 0x12, 0x02, 0x10, 0x07, 0x42, 0x44, 0x12, 0xf3, 
+	0x00, 0xff, 0xff, 0xea, 0x01, 0xb8, 0x4b, 0xe2, 0x80, 0x80, 0xc0, 0x27, 0x27, 0x0c, 0xa0, 0xe1, 
+	0x27, 0xc8, 0xa0, 0x00, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x01, 0x2b, 0x8a, 0x00, 0xe2, 0x00, 0xe0, 
+	0x8f, 0xe2, 0x21, 0xf5, 0x92, 0x61, 0xe7, 0xe0, 0x27, 0x00, 0x23, 0xff, 0x00, 0x0c, 0xe2, 0xf0, 
+	0x27, 0x84, 0xb0, 0x27, 0x03, 0x31, 0xa0, 0xe3, 0xd0, 0x8b, 0xff, 0x04, 0x00, 0x05, 0xe2, 0x00, 
+	0x30, 0xa0, 0xe3, 0x00, 0x00, 0x21, 0x90, 0xe0, 0x10, 0xb7, 0x01, 0x04, 0x90, 0x23, 0x10, 0xb3, 
+	0x22, 0xff, 0x58, 0x00, 0x17, 0x50, 0x85, 0xe1, 0xd0, 0x43, 0x05, 0x18, 0x04, 0xa0, 0xe1, 0xf0, 
+	0x2f, 0x00, 0x2f, 0x54, 0x05, 0xe2, 0x23, 0x20, 0x54, 0xf0, 0x2f, 0xff, 0x04, 0x06, 0xf0, 0x5f, 
+	0x10, 0x2f, 0x4b, 0x68, 0x00, 0x17, 0x60, 0x86, 0xe0, 0x2f, 0x06, 0xf0, 0x5f, 0x30, 0x2f, 0x04, 
+	0x64, 0x06, 0xe2, 0x20, 0x64, 0xf0, 0x2f, 0xff, 0x04, 0x69, 0x07, 0xf0, 0x5f, 0x10, 0x2f, 0x78, 
+	0x00, 0x17, 0x70, 0x87, 0xe0, 0x2f, 0x60, 0x07, 0xf0, 0x5f, 0x30, 0x2f, 0x74, 0x07, 0xe2, 0x20, 
+	0x74, 0xc2, 0xf0, 0x2f, 0x11, 0x5b, 0x2c, 0x16, 0xe0, 0xe1, 0x11, 0x53, 0x01, 0x0c, 0xf1, 0x9a, 
+	0xe7, 0x00, 0x01, 0x93, 0xf0, 0x3f, 0x83, 0x03, 0x66, 0x20, 0x00, 0x17, 0xd1, 0x7f, 0x01, 0x8c, 
+	0xb0, 0x4b, 0x10, 0x37, 0x04, 0x27, 0x40, 0x94, 0x30, 0x37, 0x44, 0x94, 0x20, 0x37, 0xf0, 0xcf, 
+	0x31, 0x8f, 0x09, 0xa0, 0x0c, 0xb0, 0xe1, 0x10, 0x27, 0x80, 0x00, 0x81, 0x8f, 0x4b, 0x5c, 0xf1, 
+	0x5f, 0xff, 0x08, 0x40, 0x2f, 0x08, 0xc0, 0x2f, 0x01, 0x8f, 0x3d, 0x00, 0x58, 0xf0, 0x2f, 0x51, 
+	0x8f, 0xe0, 0x5f, 0x11, 0x8f, 0x6c, 0xf1, 0x5f, 0x39, 0xff, 0x08, 0x40, 0x2f, 0xd0, 0x5f, 0x01, 
+	0x8f, 0x00, 0x68, 0xf0, 0x2f, 0xe9, 0x51, 0x8f, 0xe0, 0x5f, 0x11, 0x8f, 0x7c, 0xf1, 0x5f, 0xff, 
+	0x08, 0x40, 0x2f, 0xce, 0xd0, 0x5f, 0x01, 0x8f, 0x00, 0x78, 0xf0, 0x2f, 0xe1, 0x8f, 0x10, 0x3b, 
+	0x00, 0xe5, 0xb0, 0x3b, 0xf1, 0x87, 0xf1, 0x87, 0xa4, 0x4c, 0x40, 0x33, 0x40, 0x31, 0x87, 0x1a, 
+	0x04, 0x4c, 0xa0, 0xf0, 0x6b, 0xf1, 0xfb, 0xe1, 0x13, 0xb3, 0x02, 0x10, 0x05, 0x80, 0x13, 0x11, 
+	0xff, 0x00, 0x30, 0x0f, 0xe1, 0x0e, 0x06, 0x32, 0x03, 0xe2, 0xf1, 0xfb, 0xf0, 0x73, 0x20, 0x37, 
+	0x45, 0x38, 0x84, 0x13, 0x11, 0xff, 0x50, 0x37, 0xf1, 0x3b, 0x05, 0xe2, 0x23, 0x04, 0x3f, 0xb0, 
+	0xe1, 0x60, 0x00, 0x00, 0x67, 0x05, 0x10, 0x41, 0xe3, 0x00, 0x9f, 0x13, 0xff, 0x04, 0x10, 0xe2, 
+	0xf3, 0x8f, 0xff, 0xb1, 0xcf, 0xf0, 0x33, 0x40, 0x33, 0xf3, 0x63, 0x61, 0xa3, 0xf0, 0x33, 0x40, 
+	0x33, 0xf3, 0x37, 0xfe, 0xf1, 0x0b, 0x41, 0x0b, 0xf0, 0x43, 0x30, 0x43, 0xf1, 0x0f, 0xf1, 0x0f, 
+	0x10, 0x3b, 0x64, 0x53, 0x40, 0x10, 0x3b, 0x14, 0x30, 0x3b, 0x44, 0x14, 0x20, 0x3b, 0xf0, 0xab, 
+	0x1f, 0x05, 0xe2, 0x80, 0x01, 0xdf, 0x51, 0x33, 0xf1, 0x07, 0x71, 0x07, 0xa0, 0x27, 0xfd, 0xf0, 
+	0xfb, 0x60, 0xfb, 0xa0, 0x27, 0xf0, 0xef, 0xf0, 0xef, 0x00, 0xef, 0x80, 0x02, 0xcf, 0xee, 0xf1, 
+	0xef, 0xf0, 0xdf, 0x50, 0x3f, 0xc5, 0x80, 0x2f, 0xf3, 0xbb, 0x75, 0x4b, 0xc0, 0x8d, 0x90, 0x27, 
+	0x00, 0x00, 0xe2, 0xf3, 0xb7, 0x30, 0x2b, 0xc6, 0x90, 0x27, 0xfb, 0xf3, 0xab, 0x65, 0x3b, 0xe0, 
+	0x4f, 0xf3, 0xa7, 0x20, 0x2b, 0xc7, 0x90, 0x27, 0xf3, 0x9b, 0xff, 0x65, 0x2b, 0xe0, 0x4f, 0xf3, 
+	0x97, 0xf1, 0x2f, 0x42, 0x1f, 0x90, 0x3b, 0xf1, 0x2f, 0xf1, 0xe7, 0x23, 0x60, 0x0e, 0x05, 0x5b, 
+	0x0c, 0x80, 0xe1, 0x12, 0x47, 0x10, 0x37, 0x39, 0x01, 0x31, 0xf1, 0xef, 0x94, 0xf7, 0x11, 0x2b, 
+	0x60, 0x0a, 0x10, 0x33, 0x7f, 0x90, 0x20, 0x67, 0x10, 0x2f, 0xf6, 0x83, 0x32, 0x1b, 0xf0, 0x5b, 
+	0xf2, 0x23, 0x94, 0xf3, 0xff, 0x11, 0x37, 0xe0, 0x5b, 0xf6, 0x7f, 0x22, 0x4f, 0xf0, 0x5b, 0xf2, 
+	0x57, 0x94, 0xef, 0x11, 0x43, 0xed, 0xe0, 0x5b, 0xf6, 0x7b, 0xe1, 0x53, 0x60, 0x08, 0x77, 0x10, 
+	0x67, 0x20, 0x41, 0x57, 0xff, 0x10, 0x37, 0xf1, 0x57, 0xf0, 0xcb, 0x15, 0x5b, 0x61, 0xc3, 0xf2, 
+	0x0f, 0x60, 0x97, 0xa0, 0x27, 0xfe, 0xf1, 0xe7, 0xf0, 0x93, 0x00, 0x93, 0x15, 0x7b, 0xf1, 0xe3, 
+	0xf0, 0x8b, 0x28, 0xf7, 0x18, 0xb0, 0x05, 0xab, 0x01, 0x03, 0xf3, 0x00, 0x2b, 0x01, 0x32, 0x83, 
+	0xe3, 0x19, 0x11, 0x00, 0x16, 0x00, 0xc3, 0xf3, 0xf3, 0x01, 0x1c, 0x30, 0x27, 0x13, 0x11, 0x50, 
+	0xc5, 0xe0, 0x7f, 0x01, 0x10, 0xf0, 0x1b, 0xe0, 0x1b, 0x33, 0x60, 0xc6, 0xf0, 0x1b, 0x50, 0x53, 
+	0x70, 0xc7, 0xf0, 0x1b, 0x50, 0x37, 0xca, 0xf0, 0x1b, 0x70, 0x37, 0x40, 0xc4, 0xf0, 0x1b, 0x14, 
+	0x30, 0x1b, 0x07, 0xbd, 0x03, 0x17, 0x11, 0xf2, 0xa3, 0x60, 0xef, 0xf0, 0x1f, 0xf0, 0x1f, 0x11, 
+	0xf2, 0x87, 0xf9, 0xb0, 0x5f, 0xf2, 0x4b, 0xb0, 0x3f, 0xf0, 0x1f, 0xb0, 0x3f, 0x40, 0x84, 0xe0, 
+	0x1f, 0x00, 0x00, 0x54, 0x2d, 0xe9, 0x0c, 0xaa, 0x9f, 0xe5, 0x00, 0x05, 0x00, 0x00, 0xeb, 0x00, 
+	0x54, 0xbd, 0xe8, 0x08, 0x1e, 0xff, 0x2f, 0xe1, 0x1b, 0x0b, 0x7f, 0x00, 0xc0, 0x00, 0xe3, 0x80, 
+	0x00, 0x30, 0xe2, 0xf1, 0x04, 0xca, 0x00, 0xe5, 0x72, 0x0d, 0xa0, 0xe3, 0xcc, 0x04, 0x8a, 0x2a, 
+	0xe5, 0xc8, 0x00, 0x03, 0x33, 0x00, 0x0b, 0xd0, 0x00, 0x07, 0xdc, 0x01, 0xc9, 0x9f, 0xe5, 0xa0, 
+	0x00, 0x9f, 0xe5, 0x0c, 0x99, 0x2a, 0xe5, 0xd4, 0x00, 0x0b, 0x98, 0x40, 0x0b, 0xb4, 0x00, 0x07, 
+	0xc8, 0xea, 0x00, 0x0f, 0x10, 0x0b, 0x10, 0x13, 0xc0, 0x40, 0x0b, 0x94, 0x00, 0x0b, 0xb8, 0xb6, 
+	0x40, 0x0b, 0x68, 0x00, 0x0b, 0x10, 0x63, 0x80, 0x0b, 0x6f, 0x00, 0x6f, 0x01, 0x53, 0xd4, 0x00, 
+	0x0b, 0x02, 0x00, 0x0b, 0x39, 0x0c, 0x30, 0x67, 0x10, 0x13, 0xaa, 0x10, 0x6b, 0x66, 0x40, 0x6b, 
+	0x70, 0x00, 0x37, 0x3c, 0x40, 0x5f, 0x68, 0xaa, 0x00, 0x0b, 0x34, 0x40, 0x0b, 0x4c, 0x00, 0x07, 
+	0x5c, 0x40, 0x53, 0x30, 0xab, 0x00, 0x0b, 0x54, 0x40, 0x0b, 0x2c, 0x00, 0x0b, 0x4c, 0x40, 0x0b, 
+	0x10, 0xcf, 0x05, 0x33, 0x0d, 0x58, 0xe3, 0x5e, 0x00, 0x03, 0x66, 0x00, 0x03, 0x00, 0x2f, 0x0c, 
+	0x58, 0xe3, 0x33, 0x8d, 0x88, 0xe2, 0x40, 0x66, 0x00, 0x03, 0x80, 0x80, 0x98, 0xe2, 0x01, 0x8c, 
+	0x40, 0x98, 0x06, 0x0b, 0x40, 0xe2, 0x01, 0x0c, 0x40, 0xe2, 0x04, 0x33, 0x2d, 0x58, 0xe2, 0x66, 
+	0x00, 0x03, 0x01, 0x19, 0x40, 0x41, 0x00, 0x03, 0x81, 0xe2, 0x04, 0xe0, 0x2d, 0xe5, 0x00, 0xca, 
+	0x08, 0x00, 0xeb, 0x5f, 0x09, 0x00, 0xeb, 0x00, 0x75, 0x04, 0x00, 0xeb, 0x1c, 0x0a, 0x00, 0xeb, 
+	0x80, 0x0c, 0x1f, 0xe1, 0xf4, 0xf8, 0x9f, 0xe5, 0xf4, 0x08, 0x80, 0x10, 0x5f, 0x90, 0xe5, 0x0e, 
+	0x0a, 0x50, 0xe3, 0x34, 0x00, 0x00, 0x1f, 0x05, 0x3c, 0x00, 0x1f, 0x15, 0xe4, 0x50, 0x18, 0x10, 
+	0x13, 0x81, 0x00, 0x03, 0xa0, 0xe3, 0x10, 0x06, 0x15, 0x8a, 0xe5, 0x18, 0x00, 0x03, 0x20, 0x00, 
+	0x03, 0x28, 0x01, 0x5b, 0x04, 0x2b, 0x01, 0x00, 0xeb, 0xa5, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x50, 
+	0xe3, 0x01, 0x44, 0xa0, 0x03, 0x13, 0x58, 0x02, 0xa0, 0x03, 0x11, 0x44, 0xa0, 0x13, 0x00, 0x07, 
+	0x13, 0x00, 0xd5, 0x04, 0xda, 0x15, 0x00, 0x00, 0xb0, 0x11, 0x02, 0xa8, 0x58, 0x9f, 0x15, 0x36, 
+	0x67, 0x08, 0x97, 0x78, 0x0a, 0x9f, 0xe5, 0x07, 0x32, 0x1a, 0x5f, 0xa0, 0x1c, 0x8f, 0xe1, 0x50, 
+	0x98, 0x00, 0x6f, 0x00, 0x02, 0x9f, 0xa2, 0x14, 0xca, 0xe5, 0x41, 0xa1, 0x00, 0x03, 0xa8, 0x14, 
+	0x8a, 0xe5, 0xac, 0x00, 0x03, 0x50, 0xb0, 0x00, 0x03, 0xb4, 0x00, 0x03, 0x7c, 0xb8, 0x9f, 0xe5, 
+	0x02, 0x02, 0x80, 0xa0, 0xe3, 0x01, 0x9c, 0x00, 0x2f, 0x1a, 0x00, 0x09, 0xe2, 0x11, 0x2d, 0x8a, 
+	0xe2, 0x21, 0x05, 0x10, 0x92, 0xe7, 0xc4, 0x01, 0x3b, 0x00, 0x90, 0x89, 0xe0, 0x00, 0x12, 0x0d, 
+	0x8a, 0xe2, 0xf8, 0x0b, 0x80, 0xe8, 0x08, 0x04, 0xf0, 0x9d, 0xe4, 0x1c, 0xe3, 0xf8, 0x4f, 0x2d, 
+	0x00, 0x09, 0x18, 0xa8, 0x9f, 0xe5, 0xfc, 0x05, 0xca, 0xab, 0x20, 0x57, 0xd7, 0x00, 0x53, 0x3c, 
+	0x00, 0x63, 0x04, 0x00, 0x13, 0x10, 0x73, 0x00, 0x44, 0x00, 0x0a, 0xe5, 0x48, 0x00, 0x4a, 0xe5, 
+	0x4c, 0x47, 0x00, 0x03, 0x28, 0x28, 0x01, 0x57, 0x21, 0x6f, 0x82, 0xe5, 0x41, 0x20, 0x00, 0xf3, 
+	0x60, 0x00, 0x8a, 0xe5, 0x1c, 0x00, 0x07, 0x55, 0x80, 0x00, 0x07, 0x18, 0x00, 0x07, 0xa0, 0x00, 
+	0x07, 0x14, 0x00, 0x07, 0x55, 0xc0, 0x00, 0x07, 0x10, 0x00, 0x07, 0xe0, 0x00, 0x07, 0x0c, 0x00, 
+	0x07, 0x05, 0x08, 0x03, 0x8a, 0xe5, 0x08, 0x00, 0x07, 0x0c, 0x00, 0x07, 0x55, 0x04, 0x00, 0x07, 
+	0x28, 0x00, 0x07, 0x00, 0x00, 0x07, 0x48, 0x00, 0x07, 0x07, 0xfc, 0x07, 0x9f, 0xe5, 0x68, 0x00, 
+	0x07, 0x11, 0x9b, 0x10, 0x03, 0x88, 0x00, 0x73, 0xe1, 0x0b, 0xb0, 0x04, 0xd7, 0x00, 0x51, 0xe3, 
+	0x80, 0x00, 0x8f, 0xe1, 0x00, 0x40, 0x2d, 0xe9, 0xdb, 0xff, 0x14, 0xff, 0xeb, 0xa4, 0x04, 0x43, 
+	0x1c, 0x0d, 0x6b, 0x02, 0x00, 0x00, 0x51, 0xe5, 0xd1, 0x20, 0x51, 0xe1, 0x02, 0xc0, 0x00, 0x81, 
+	0xe0, 0x44, 0xc0, 0x0a, 0xe5, 0xff, 0x20, 0x00, 0x02, 0xe2, 0x01, 0x2c, 0x62, 0xe2, 0x09, 0x00, 
+	0x00, 0x52, 0xe3, 0x09, 0x00, 0x00, 0xca, 0x00, 0x10, 0x15, 0xdc, 0xe5, 0xfa, 0x00, 0x3b, 0x06, 
+	0x00, 0x2b, 0x01, 0x00, 0x0b, 0x00, 0x02, 0xc0, 0xdc, 0xe5, 0x0c, 0x14, 0x81, 0xe1, 0x02, 0xbc, 
+	0x14, 0x4a, 0xe1, 0x68, 0x17, 0x00, 0x6b, 0xc0, 0x01, 0x1f, 0xe5, 0x00, 0xc0, 0x81, 0xe5, 0x18, 
+	0x01, 0x7b, 0x05, 0x16, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x07, 0x19, 0x00, 0x07, 0x65, 0x28, 0x00, 
+	0x07, 0x00, 0x5f, 0x0a, 0x30, 0x00, 0x07, 0x1f, 0x00, 0x07, 0x58, 0x38, 0x00, 0x07, 0x22, 0x00, 
+	0x07, 0x10, 0x93, 0x44, 0x10, 0x0a, 0x8a, 0x0e, 0x0f, 0x51, 0xe5, 0xc2, 0x00, 0x13, 0x25, 0x00, 
+	0x13, 0xc3, 0xaa, 0x00, 0x07, 0x20, 0x00, 0x07, 0xca, 0x00, 0x07, 0x24, 0x00, 0x07, 0xd2, 0xa9, 
+	0x40, 0x17, 0xda, 0x00, 0x07, 0x26, 0x00, 0x07, 0x00, 0x40, 0x33, 0x3b, 0x41, 0x24, 0x00, 0xdb, 
+	0x00, 0x20, 0xc0, 0xe5, 0x20, 0x00, 0x07, 0xd7, 0x11, 0x2b, 0x10, 0x13, 0x18, 0x40, 0x13, 0x14, 
+	0x00, 0x07, 0x11, 0x37, 0x10, 0x13, 0x5e, 0x0c, 0x40, 0x13, 0x08, 0x00, 0x07, 0x11, 0x43, 0x21, 
+	0x07, 0x40, 0x13, 0xfc, 0x6d, 0x06, 0x31, 0x4f, 0x10, 0x13, 0xf4, 0x00, 0x0b, 0x10, 0x13, 0xf0, 
+	0x00, 0x07, 0xdd, 0x11, 0x5b, 0x10, 0x13, 0xe8, 0x00, 0x0b, 0x11, 0x57, 0x10, 0x0b, 0xe0, 0x00, 
+	0x0b, 0xdd, 0x11, 0x6b, 0x10, 0x0b, 0xd8, 0x00, 0x0b, 0x11, 0x67, 0x10, 0x0b, 0xd0, 0x00, 0x0b, 
+	0xd8, 0x11, 0x6b, 0x10, 0x0b, 0xc8, 0x00, 0x0b, 0x51, 0x6f, 0xb8, 0x04, 0x9a, 0x0a, 0xe5, 0xbc, 
+	0x16, 0x9f, 0x00, 0xdb, 0x50, 0x11, 0x7b, 0x01, 0x05, 0x01, 0x89, 0x48, 0xe2, 0xbc, 0x02, 0x27, 
+	0xac, 0x00, 0x13, 0x62, 0xb8, 0x02, 0x4b, 0x10, 0x23, 0x01, 0x89, 0x88, 0x00, 0x13, 0x9a, 0x26, 
+	0xe5, 0xb8, 0x00, 0x17, 0x98, 0xf6, 0x00, 0x5f, 0x02, 0x33, 0x58, 0x00, 0x20, 0xa0, 0x13, 0x08, 
+	0x10, 0xc1, 0x13, 0x8c, 0x0a, 0xf6, 0x9f, 0x15, 0x10, 0x00, 0x0f, 0x60, 0x00, 0x0f, 0x10, 0xa0, 
+	0x00, 0x0f, 0x7c, 0x00, 0x0f, 0x1f, 0x10, 0x01, 0xe2, 0x40, 0x0a, 0x20, 0xa0, 0xe3, 0x70, 0x00, 
+	0x2b, 0x70, 0x00, 0x47, 0x00, 0x20, 0x00, 0x91, 0x00, 0x5f, 0x80, 0xe2, 0x03, 0xf0, 0x28, 0x20, 
+	0xe1, 0xff, 0x0b, 0x67, 0x20, 0xcc, 0x03, 0xe0, 0xc0, 0x00, 0xc0, 0xac, 0xe2, 0x0c, 0x2c, 0xb0, 
+	0xe1, 0x20, 0x08, 0xc8, 0x03, 0xe0, 0x45, 0x10, 0x0b, 0xcc, 0xb0, 0xe1, 0x00, 0x2c, 0x24, 0x82, 
+	0xe1, 0x20, 0xc4, 0x03, 0xe0, 0x40, 0xa5, 0x50, 0x0f, 0x28, 0x82, 0xe1, 0x00, 0xc0, 0x03, 0x20, 
+	0xe0, 0x55, 0x50, 0x0f, 0x0c, 0x82, 0xe1, 0x24, 0x26, 0x8a, 0x02, 0xdb, 0x00, 0x20, 0xe0, 0x23, 
+	0x57, 0x04, 0x00, 0x07, 0x08, 0xc2, 0x00, 0x03, 0x0b, 0xb7, 0x01, 0x31, 0xa0, 0x03, 0x0b, 0xc3, 
+	0x13, 0x48, 0x02, 0x0f, 0xa7, 0x5f, 0x8d, 0xb4, 0xd3, 0xf4, 0xc5, 0x9f, 0x02, 0xe5, 0x9c, 0x02, 
+	0x9c, 0xe5, 0x20, 0x08, 0xbb, 0xa0, 0x68, 0x22, 0x02, 0x0f, 0x07, 0x2f, 0x80, 0x0a, 0x67, 0x80, 
+	0x18, 0xa0, 0x00, 0xe1, 0x3f, 0x23, 0x04, 0xe2, 0xa1, 0x17, 0x82, 0x00, 0xe0, 0xff, 0x28, 0x00, 
+	0xe2, 0x02, 0x10, 0x81, 0x80, 0x00, 0x07, 0x04, 0xe2, 0x02, 0x00, 0x81, 0xe0, 0x57, 0x80, 0x00, 
+	0xaf, 0x13, 0x0c, 0x80, 0xe2, 0xbc, 0x1f, 0xdc, 0x22, 0xe1, 0x01, 0x0b, 0xd7, 0x01, 0x10, 0x81, 
+	0x00, 0x0b, 0xcc, 0x16, 0xe1, 0x00, 0x44, 0x0f, 0x57, 0x44, 0x00, 0x23, 0x00, 0x67, 0x9a, 0xa8, 
+	0xc0, 0x67, 0x11, 0x00, 0x13, 0xa5, 0xc6, 0xdf, 0x25, 0x08, 0xa0, 0x2a, 0xe1, 0x26, 0x00, 0x67, 
+	0x04, 0x02, 0xbb, 0x70, 0x00, 0x87, 0x1c, 0xa0, 0x11, 0xd7, 0x58, 0x02, 0xd3, 0x78, 0xa0, 0xe1, 
+	0x01, 0x68, 0xe4, 0x12, 0xdb, 0x03, 0xa7, 0x0f, 0x83, 0x58, 0x05, 0x01, 0x27, 0x80, 0x48, 0x04, 
+	0xe0, 0x54, 0xf5, 0x9f, 0xe5, 0x13, 0xaf, 0x0f, 0x02, 0x08, 0x06, 0xe2, 0x0f, 0x12, 0x0e, 0x7f, 
+	0x0d, 0x92, 0xe7, 0x00, 0x21, 0x1d, 0x92, 0xe7, 0x26, 0x08, 0x80, 0xe0, 0x00, 0x27, 0x18, 0x81, 
+	0xe0, 0x25, 0xcc, 0xa0, 0xe1, 0x3a, 0x25, 0x28, 0x00, 0x83, 0x12, 0xf3, 0x02, 0xef, 0x11, 0x22, 
+	0xbf, 0x5c, 0x41, 0xe3, 0x0c, 0x7c, 0x0a, 0x78, 0x00, 0x2d, 0xe9, 0x01, 0x03, 0x20, 0xe1, 0x01, 
+	0x1b, 0x43, 0x50, 0xa0, 0xe1, 0x0c, 0x60, 0x0d, 0xa0, 0xe1, 0x06, 0x20, 0x0a, 0x97, 0x04, 0x33, 
+	0x00, 0x00, 0x57, 0x04, 0x20, 0x30, 0x83, 0xe2, 0x03, 0x03, 0x5b, 0x20, 0x40, 0x10, 0x84, 0xe2, 
+	0x04, 0x03, 0x57, 0x01, 0x50, 0x55, 0xe2, 0x00, 0xf6, 0xff, 0xff, 0xca, 0x78, 0x00, 0xbd, 0xe8, 
+	0x35, 0xdc, 0xf4, 0x02, 0x43, 0x40, 0x2b, 0xd4, 0x00, 0x0b, 0xcc, 0x00, 0x03, 0x2a, 0x82, 0x22, 
+	0x30, 0x0f, 0xc4, 0x00, 0x0b, 0xbc, 0x00, 0x03, 0xf8, 0x05, 0x4b, 0x2d, 0xe9, 0xf0, 0xa3, 0x34, 
+	0x13, 0x45, 0x04, 0x0b, 0x4c, 0x82, 0x04, 0x2f, 0x73, 0x06, 0x06, 0x27, 0x00, 0x0f, 0xa4, 0x14, 
+	0x80, 0x10, 0x17, 0xc1, 0xe5, 0xb3, 0xcf, 0x8f, 0xe2, 0x9c, 0xa0, 0x00, 0x0b, 0x0a, 0x01, 0xff, 
+	0x01, 0x00, 0xdc, 0xe4, 0x00, 0x00, 0x11, 0x8a, 0xe7, 0x01, 0x20, 0x52, 0xe2, 0xfb, 0xa0, 0x00, 
+	0x67, 0x2f, 0x16, 0x53, 0xf1, 0x9f, 0x57, 0xa8, 0x00, 0x02, 0x00, 0xea, 0xd0, 0x4e, 0x00, 0x08, 
+	0xd0, 0x03, 0x74, 0x0a, 0x4f, 0x00, 0x08, 0x10, 0x00, 0x07, 0x28, 0x00, 0x03, 0x00, 0x95, 0x00, 
+	0x03, 0xf8, 0x4d, 0x30, 0x13, 0xc0, 0x00, 0x0b, 0x54, 0x00, 0x03, 0x00, 0x53, 0x48, 0x41, 0x4e, 
+	0x54, 0x41, 0x45, 0x00, 0x00, 0x57, 0x45, 0x4e, 0x44, 0x59, 0x00, 0x53, 0x50, 0x00, 0x4f, 0x4f, 
+	0x4b, 0x45, 0x44, 0x00, 0x42, 0x45, 0x00, 0x54, 0x52, 0x41, 0x59, 0x41, 0x4c, 0x00, 0x5a, 0x10, 
+	0x41, 0x50, 0x50, 0x00, 0x0f, 0x58, 0x54, 0x52, 0x45, 0x20, 0x4d, 0x45, 0x00, 0x1d, 0x52, 0x54, 
+	0x42, 0x58, 0x47, 0x00, 0x45, 0x00, 0x44, 0x57, 0x20, 0x33, 0x00, 0x44, 0x00, 0x52, 0x59, 0x4d, 
+	0x4f, 0x55, 0x54, 0x48, 0x00, 0x00, 0x41, 0x4c, 0x49, 0x43, 0x45, 0x00, 0x4d, 0x45, 0x00, 0x47, 
+	0x41, 0x4d, 0x41, 0x4e, 0x58, 0x32, 0x53, 0x00, 0x45, 0x42, 0x32, 0x58, 0x45, 0x00, 0x42, 0x41, 
+	0x00, 0x4c, 0x4c, 0x4f, 0x4f, 0x4e, 0x20, 0x47, 0x42, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x4b, 0x45, 
+	0x52, 0x20, 0x40, 0x43, 0x00, 0x0a, 0x42, 0x49, 0x4f, 0x4e, 0x49, 0x43, 0x00, 0x2d, 0x43, 0x4f, 
+	0x4d, 0x4d, 0x41, 0x56, 0x34, 0x10, 0x45, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x9a, 0xe5, 0x00, 
+	0x4d, 0x1f, 0x81, 0xe2, 0x94, 0xc0, 0x4f, 0xe2, 0xa0, 0x10, 0xf7, 0x00, 0x00, 0xe7, 0x02, 0x30, 
+	0xd1, 0xe7, 0x02, 0x01, 0x40, 0xdc, 0xe7, 0x04, 0x00, 0x53, 0xe1, 0x14, 0x73, 0x04, 0x00, 0x00, 
+	0x53, 0xe3, 0x02, 0x01, 0x8f, 0x01, 0x20, 0x1b, 0x82, 0xe2, 0x0f, 0x01, 0xa3, 0x01, 0x63, 0xba, 
+	0x05, 0xcf, 0x24, 0xdb, 0xc2, 0x10, 0x27, 0x10, 0x17, 0x00, 0x00, 0x54, 0xe3, 0x01, 0x13, 0x1a, 
+	0x01, 0x02, 0xc0, 0x8c, 0xe0, 0x00, 0x40, 0xdc, 0x01, 0x3b, 0x70, 0x54, 0x01, 0x2f, 0x00, 0x33, 
+	0x02, 0x77, 0xe9, 0xff, 0xff, 0xea, 0x16, 0x00, 0x00, 0xf0, 0x17, 0x0b, 0xe1, 0x01, 0xaf, 0x05, 
+	0xf7, 0x00, 0x35, 0xea, 0x01, 0x00, 0x07, 0x11, 0x6f, 0x17, 0x01, 0x6f, 0x58, 0x00, 0x0f, 0x4d, 
+	0xeb, 0x00, 0x0f, 0x38, 0x13, 0x01, 0xa3, 0x01, 0x53, 0x34, 0x00, 0x07, 0xaa, 0x11, 0x67, 0x52, 
+	0x40, 0x17, 0x28, 0x00, 0x0f, 0x7c, 0x00, 0x17, 0x24, 0xaa, 0x40, 0x17, 0xd3, 0x00, 0x13, 0x1c, 
+	0x00, 0x0b, 0x77, 0x00, 0x13, 0x18, 0xaa, 0x40, 0x13, 0x47, 0x00, 0x2b, 0xec, 0x00, 0x17, 0x0c, 
+	0x00, 0x0f, 0x71, 0xa0, 0x00, 0x17, 0x08, 0x40, 0x17, 0x40, 0x10, 0x8f, 0xe2, 0x40, 0xb0, 0x03, 
+	0xeb, 0x10, 0x00, 0xd7, 0x11, 0xfb, 0xc8, 0xf2, 0x9f, 0xe5, 0xac, 0x10, 0x0f, 0x03, 0x03, 0x0b, 
+	0xd8, 0x13, 0xc3, 0x06, 0x1f, 0x00, 0x10, 0x00, 0x80, 0xe5, 0x04, 0x10, 0x10, 0xe5, 0xff, 0x14, 
+	0x00, 0xc1, 0xe3, 0xcd, 0x14, 0x81, 0xe3, 0x04, 0x10, 0x41, 0x00, 0x00, 0x0f, 0x90, 0xe5, 0xff, 
+	0x10, 0xc1, 0x00, 0x0b, 0x40, 0x80, 0x07, 0x7b, 0x00, 0xea, 0xc3, 0x13, 0x38, 0xfa, 0x00, 0x4a, 
+	0xc1, 0xa7, 0x20, 0x05, 0xfb, 0x76, 0x00, 0x01, 0x18, 0xf5, 0xc9, 0x00, 0x45, 0x00, 0x5a, 0x14, 
+	0x03, 0xc8, 0x22, 0x37, 0x06, 0xff, 0xea, 0x00, 0x25, 0xdf, 0x50, 0xe3, 0x7e, 0x00, 0x10, 0xa0, 
+	0x03, 0x7b, 0x10, 0xa0, 0x13, 0x8c, 0x46, 0x22, 0x16, 0xd3, 0xc2, 0xe5, 0x04, 0x00, 0x13, 0x02, 
+	0x9b, 0xe3, 0x50, 0x05, 0x00, 0x13, 0x7c, 0x40, 0x13, 0x11, 0xce, 0x8f, 0xe2, 0x00, 0x00, 0xc1, 
+	0x8c, 0xe0, 0xb2, 0x10, 0xdc, 0xe0, 0x4b, 0x6c, 0x20, 0x13, 0x82, 0xe5, 0x10, 0x0b, 0x64, 0x00, 
+	0x0b, 0x13, 0xb3, 0x54, 0x60, 0x40, 0x13, 0x02, 0x00, 0x37, 0x1c, 0x40, 0x33, 0x44, 0x30, 0x08, 
+	0x8f, 0xe2, 0x4c, 0x40, 0x03, 0x73, 0x50, 0x8f, 0xe2, 0x40, 0x14, 0x00, 0x17, 0x90, 0x51, 0x25, 
+	0xe0, 0x0a, 0x60, 0x82, 0x12, 0x93, 0xd3, 0xe4, 0x04, 0x10, 0x94, 0x22, 0x97, 0xb2, 0x20, 0x10, 
+	0xd5, 0x03, 0xd7, 0xb0, 0xe1, 0x31, 0x00, 0x00, 0x02, 0x1b, 0x01, 0x60, 0x56, 0xe2, 0xf7, 0x02, 
+	0xa3, 0x04, 0x00, 0x00, 0x5b, 0xe3, 0x14, 0x12, 0x9f, 0x05, 0xac, 0x04, 0x13, 0x8a, 0x05, 0xf8, 
+	0x4b, 0x35, 0xc3, 0xfc, 0xeb, 0x00, 0xec, 0xfd, 0xe3, 0xe4, 0xdb, 0xdd, 0xd3, 0xf4, 0x00, 0x00, 
+	0x00, 0x60, 0x2a, 0x00, 0x03, 0xb4, 0x29, 0x10, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x28, 0x2b, 0x00, 
+	0x03, 0x50, 0xa4, 0x00, 0x03, 0xe4, 0x00, 0x03, 0x24, 0x2c, 0x00, 0x03, 0x54, 0x58, 0x00, 0x03, 
+	0xb8, 0x00, 0x03, 0x68, 0x00, 0x0f, 0x40, 0x05, 0x00, 0x55, 0x08, 0x33, 0x1e, 0x14, 0x13, 0x1e, 
+	0x13, 0x00, 0x34, 0x13, 0x42, 0x13, 0x62, 0x13, 0x78, 0x13, 0x00, 0x83, 0x13, 0x40, 0x05, 0x9c, 
+	0x08, 0x2e, 0x1e, 0x00, 0x73, 0x13, 0x7d, 0x13, 0x93, 0x13, 0xa1, 0x13, 0x06, 0xc1, 0x13, 0xd7, 
+	0x13, 0xe2, 0xf0, 0x13, 0x20, 0x13, 0x4b, 0x00, 0x08, 0x70, 0x1c, 0xd2, 0x11, 0xdc, 0x11, 0xf2, 
+	0x00, 0x11, 0x00, 0x12, 0x20, 0x12, 0x36, 0x12, 0x41, 0x00, 0x12, 0x40, 0x04, 0x22, 0x08, 0x07, 
+	0x1e, 0xc8, 0x08, 0x13, 0xd2, 0x13, 0xe8, 0x03, 0xea, 0x13, 0x14, 0x29, 0x00, 0x14, 0x34, 0x14, 
+	0xc0, 0xc4, 0x81, 0xc3, 0xc0, 0x20, 0xc4, 0x78, 0x30, 0x03, 0xc3, 0x76, 0xc2, 0x60, 0xc4, 0x08, 
+	0x74, 0xc2, 0x40, 0x24, 0x1a, 0xbb, 0x82, 0xe0, 0x01, 0x08, 0x00, 0x11, 0xe3, 0x01, 0x01, 0x8f, 
+	0xb0, 0x20, 0xd1, 0x82, 0x02, 0x43, 0x00, 0x1a, 0xff, 0x20, 0xc2, 0x02, 0xab, 0x82, 0x09, 0xe1, 
+	0xb0, 0x20, 0xc1, 0x22, 0x87, 0xff, 0x2c, 0x00, 0x0f, 0xc0, 0x05, 0x6f, 0x50, 0x0f, 0x02, 0xca, 
+	0x4c, 0xe2, 0x01, 0x0a, 0x00, 0x1c, 0xe3, 0xd3, 0x10, 0x00, 0x0a, 0x18, 0xf1, 0xd4, 0x01, 0x57, 
+	0x40, 0x0f, 0xc0, 0x00, 0x0f, 0x0c, 0x00, 0x0f, 0x68, 0x51, 0x01, 0x00, 0x03, 0x04, 0x50, 0x00, 
+	0x03, 0x10, 0x00, 0x03, 0x00, 0xd8, 0x37, 0x00, 0x03, 0xe0, 0x4b, 0x00, 0x03, 0x48, 0xfc, 0x00, 
+	0x03, 0x8c, 0x46, 0x03, 0xab, 0x00, 0x00, 0x02, 0xd0, 0x01, 0xe0, 0x00, 0x66, 0x13, 0x02, 0xc2, 
+	0x4d, 0x01, 0x50, 0x42, 0x80, 0x10, 0x0b, 0xfe, 0xff, 0xdc, 0xf5, 0x00, 0x06, 0xe4, 0x00, 0x04, 
+	0x00, 0x03, 0x4c, 0x03, 0x00, 0x03, 0x90, 0x81, 0x00, 0x07, 0xec, 0x05, 0x00, 0x03, 0x2c, 0x07, 
+	0x01, 0x33, 0x00, 0x08, 0x00, 0x03, 0xa0, 0x1a, 0x00, 0x03, 0xd4, 0x81, 0x00, 0x03, 0x48, 0x1c, 
+	0x00, 0x03, 0x60, 0x1d, 0x01, 0x4b, 0x0a, 0x1e, 0x00, 0x03, 0x6c, 0x00, 0x27, 0x64, 0x00, 0x03, 
+	0xc0, 0xa0, 0x00, 0x2b, 0xb0, 0x00, 0x03, 0x1c, 0x06, 0x00, 0x03, 0x0c, 0xaa, 0x00, 0x03, 0x5c, 
+	0x00, 0x33, 0x4c, 0x00, 0x03, 0xd4, 0x00, 0x37, 0xc4, 0xaa, 0x00, 0x03, 0xc8, 0x00, 0x37, 0xbc, 
+	0x00, 0x03, 0x64, 0x00, 0x3b, 0x7c, 0xa4, 0x00, 0x3b, 0x44, 0x00, 0x3b, 0xb0, 0x4d, 0x00, 0x0b, 
+	0x4a, 0x00, 0x30, 0x08, 0xd8, 0x00, 0x07, 0x04, 0x3f, 0x03, 0x1c, 0x5a, 0x00, 0x01, 0x03, 0xca, 
+	0xfe, 0xba, 0xbe, 0xa8, 0x57, 0x00, 0xb7, 0x00, 0x8f, 0x00, 0x08, 0x40, 0xac, 0x00, 0x00, 0x04, 
+	0x81, 0x00, 0x2f, 0x38, 0x46, 0x00, 0x03, 0xeb, 0x56, 0x00, 0xc7, 0x08, 0x00, 0x00, 0x03, 0xfd, 
+	0x00, 0xad, 0x3c, 0x4b, 0x00, 0x02, 0x08, 0xd2, 0x33, 0x00, 0x00, 0xa4, 0x00, 0x07, 0x4a, 0xa0, 
+	0x02, 0x08, 0xb8, 0x00, 0x07, 0x0e, 0x39, 0x00, 0x00, 0xec, 0xd4, 0x00, 0x07, 0x11, 0xc7, 0xc0, 
+	0x01, 0xef, 0x04, 0x00, 0xdf, 0xa8, 0x97, 0x14, 0xff, 0x02, 0xb0, 0x01, 0xf3, 0xb8, 0x00, 0x63, 
+	0xf0, 0x44, 0xda, 0x01, 0xef, 0x10, 0xef, 0xf0, 0x08, 0x47, 0x00, 0x03, 0x30, 0x00, 0x0b, 0xa4, 
+	0x81, 0x20, 0xff, 0x00, 0x00, 0xd0, 0x55, 0x00, 0x08, 0x00, 0x56, 0x3f, 0x00, 0xe4, 0x00, 0x07, 
+	0x04, 0x03, 0x20, 0x07, 0x10, 0x18, 0x10, 0x07, 0x0b, 0x53, 0x07, 0x00, 0x54, 0x56, 0x00, 0x08, 
+	0x04, 0x23, 0x20, 0x07, 0x11, 0x38, 0xe8, 0x10, 0x2f, 0x08, 0xb3, 0x20, 0x07, 0x0b, 0x10, 0x27, 
+	0x57, 0x00, 0x08, 0x55, 0x0c, 0x40, 0x07, 0x0d, 0x40, 0x07, 0x0f, 0x00, 0x07, 0x80, 0x00, 0x2f, 
+	0xf7, 0x00, 0xb3, 0x20, 0x07, 0x05, 0xf3, 0x20, 0x07, 0x12, 0x40, 0x07, 0x02, 0x10, 0x20, 0x07, 
+	0xf6, 0x0a, 0x34, 0x20, 0x2f, 0x08, 0xd3, 0x20, 0x07, 0x17, 0x40, 0x07, 0x08, 0xdb, 0x00, 0x77, 
+	0x58, 0x00, 0x07, 0x04, 0x98, 0x20, 0x07, 0x1b, 0x40, 0x07, 0x08, 0xeb, 0x20, 0x07, 0x59, 0x1d, 
+	0x40, 0x07, 0x1e, 0x40, 0x07, 0x08, 0xf3, 0x00, 0x78, 0x00, 0x07, 0x59, 0xfe, 0x00, 0x07, 0xc4, 
+	0x00, 0x07, 0x0f, 0xe3, 0x00, 0xa4, 0x10, 0x07, 0x10, 0xff, 0xff, 0xff, 0x10, 0xa7, 0x00, 0x00, 
+	0x01, 0x03, 0xcc, 0x40, 0x02, 0x10, 0x03, 0x04, 0x07, 0x50, 0x09, 0x00, 0x03, 0x08, 0x09, 0x84, 
+	0x10, 0xc5, 0x03, 0x00, 0xc0, 0x15, 0x08, 0x57, 0x05, 0x9a, 0x01, 0xe5, 0xf3, 0x4f, 0x2d, 0xe9, 
+	0x40, 0xa5, 0x13, 0xa7, 0xec, 0x05, 0x27, 0x03, 0xf7, 0x10, 0x0f, 0x30, 0x00, 0x0f, 0x1a, 0x67, 
+	0xe6, 0x15, 0x2d, 0xca, 0xe5, 0x17, 0x17, 0x24, 0x47, 0x17, 0x10, 0x0b, 0x1c, 0x57, 0x23, 0x82, 
+	0x06, 0xc7, 0xb8, 0x35, 0x8a, 0xe5, 0x03, 0x06, 0x9b, 0xbc, 0x00, 0x05, 0x8a, 0xe5, 0xc0, 0x15, 
+	0x8a, 0xe5, 0x46, 0x20, 0x11, 0xd3, 0x00, 0x0f, 0x51, 0xe3, 0x4b, 0x11, 0xd3, 0x01, 0x05, 0x33, 
+	0x00, 0x51, 0x03, 0x01, 0x50, 0x07, 0xf3, 0x0a, 0x50, 0xa0, 0x13, 0x43, 0x00, 0x17, 0x80, 0x00, 
+	0x17, 0xc0, 0x16, 0x00, 0x51, 0x13, 0x06, 0xfb, 0x03, 0x07, 0x53, 0x02, 0x88, 0x55, 0x90, 0x03, 
+	0xeb, 0x54, 0x03, 0x01, 0x4b, 0x1a, 0xe5, 0x05, 0xda, 0xce, 0x18, 0xdf, 0x1a, 0x1b, 0x1a, 0xe6, 
+	0x00, 0x0b, 0x15, 0x8b, 0x15, 0xa7, 0xd6, 0x9b, 0x2c, 0x67, 0x50, 0xe3, 0x13, 0x1f, 0x15, 0x5f, 
+	0xe6, 0x1a, 0xff, 0x07, 0x8f, 0xbd, 0x00, 0x27, 0xea, 0x10, 0x1b, 0x14, 0x9f, 0x00, 0x0f, 0x10, 
+	0x63, 0x03, 0x10, 0x3f, 0xdc, 0x00, 0x53, 0x10, 0x5b, 0x03, 0x10, 0x33, 0x10, 0x5b, 0x10, 0x17, 
+	0xa5, 0x44, 0x00, 0xca, 0xe5, 0xa6, 0x54, 0xca, 0xe5, 0x02, 0x29, 0x12, 0xa0, 0xe3, 0x48, 0x00, 
+	0x87, 0x12, 0x11, 0x07, 0x57, 0x10, 0x11, 0x41, 0xe2, 0xc4, 0x00, 0xaf, 0x47, 0x01, 0xd3, 0x0d, 
+	0x47, 0x40, 0x50, 0x0a, 0x87, 0x50, 0x13, 0x05, 0x00, 0xa0, 0x03, 0x00, 0x49, 0x01, 0xd3, 0x15, 
+	0xcd, 0x05, 0xca, 0x15, 0x21, 0x61, 0x1f, 0x04, 0xcf, 0x01, 0x91, 0xe7, 0xc8, 0x00, 0xd7, 0x09, 
+	0xff, 0x5f, 0x2d, 0xe9, 0x10, 0xf7, 0x28, 0xc4, 0x30, 0xf7, 0x0b, 0xff, 0x5f, 0xbd, 0xe8, 0x16, 
+	0x57, 0x84, 0x00, 0x1b, 0x10, 0x93, 0x6f, 0x88, 0x00, 0x07, 0x5b, 0xf7, 0x08, 0x07, 0x83, 0x10, 
+	0x13, 0x27, 0xcf, 0x00, 0x0b, 0xa1, 0x10, 0x5f, 0xff, 0x20, 0xbf, 0xa0, 0x03, 0x67, 0x1f, 0x16, 
+	0x8f, 0x0a, 0xd1, 0xe7, 0xe6, 0x15, 0x10, 0xeb, 0x51, 0x01, 0x6b, 0xc0, 0x2c, 0x03, 0xcc, 0x00, 
+	0xcf, 0xdc, 0x05, 0xd7, 0x1b, 0xe3, 0xd8, 0x13, 0x30, 0x9f, 0x15, 0x1d, 0x53, 0x02, 0xcb, 0x0a, 
+	0x02, 0x03, 0x13, 0xb2, 0x26, 0x9f, 0xcd, 0x01, 0x0b, 0x00, 0xc4, 0xe3, 0xc0, 0x00, 0x1b, 0xb0, 
+	0x9a, 0x00, 0xaf, 0xbc, 0x03, 0x0a, 0x67, 0x09, 0xe3, 0xe0, 0x01, 0x9b, 0x07, 0x5d, 0x04, 0x05, 
+	0x2b, 0x2b, 0x07, 0xe7, 0x0b, 0x77, 0x11, 0xab, 0xa4, 0x00, 0x1b, 0x05, 0x82, 0x2d, 0xa0, 0xe3, 
+	0x41, 0x00, 0x0f, 0x9c, 0x00, 0x0b, 0xaa, 0x10, 0xef, 0x3e, 0x00, 0x0b, 0x94, 0x00, 0x0b, 0x20, 
+	0x06, 0x2b, 0x3b, 0xad, 0x00, 0x0b, 0x8c, 0x00, 0x0b, 0x8c, 0x16, 0x47, 0x09, 0x9b, 0xb0, 0x01, 
+	0xff, 0x5a, 0x28, 0x0a, 0x3f, 0x2c, 0x1c, 0x8f, 0x00, 0x13, 0x60, 0x00, 0x07, 0x64, 0xab, 0x00, 
+	0x03, 0x74, 0x00, 0x0b, 0x68, 0x00, 0x07, 0x6c, 0x10, 0x03, 0x00, 0x0b, 0x76, 0x70, 0x10, 0x13, 
+	0x10, 0x1b, 0x00, 0x0b, 0x78, 0x10, 0x2b, 0x00, 0x03, 0x00, 0x05, 0x90, 0xa0, 0xe3, 0xc4, 0x94, 
+	0x31, 0x3f, 0xd7, 0x00, 0xd7, 0x01, 0x08, 0x20, 0x91, 0xe4, 0x00, 0x00, 0x32, 0x06, 0x2f, 0x24, 
+	0x00, 0x0a, 0x07, 0x33, 0x5a, 0x2c, 0x01, 0x2f, 0x01, 0x5b, 0x00, 0x8a, 0xe2, 0x04, 0x00, 0x11, 
+	0xe5, 0x1e, 0x00, 0x06, 0xb0, 0xe8, 0x04, 0x10, 0x85, 0x05, 0xd3, 0x00, 0x03, 0x20, 0xa8, 0x40, 
+	0x03, 0x30, 0x40, 0x03, 0x40, 0x30, 0x03, 0x00, 0xf0, 0xa0, 0x03, 0xe1, 0x8f, 0xfc, 0xff, 0xeb, 
+	0x04, 0x00, 0x9f, 0x11, 0x3b, 0x4d, 0x10, 0x01, 0x67, 0xf0, 0x4f, 0x35, 0xdb, 0x13, 0xb3, 0xff, 
+	0x0f, 0x0c, 0x4c, 0xff, 0x0b, 0xf0, 0xff, 0x7f, 0x40, 0x03, 0x03, 0xc0, 0x1c, 0x20, 0x0c, 0x8f, 
+	0xe2, 0xb4, 0x25, 0x01, 0x83, 0x0f, 0xeb, 0x01, 0x00, 0x01, 0x93, 0xe7, 0x01, 0x00, 0x82, 0xe7, 
+	0x04, 0x0a, 0x03, 0x06, 0x02, 0x0c, 0x51, 0xe3, 0xfa, 0x07, 0xb7, 0x10, 0x3b, 0xb4, 0xad, 0x02, 
+	0xdf, 0x40, 0x01, 0x2f, 0x44, 0x1b, 0x2f, 0x07, 0x27, 0xc4, 0x00, 0xf3, 0x09, 0x21, 0x07, 0x00, 
+	0xe0, 0x11, 0xbb, 0xa0, 0x12, 0x01, 0x07, 0xf5, 0x01, 0xe3, 0x02, 0x43, 0x07, 0x4f, 0x30, 0x23, 
+	0x48, 0x00, 0x03, 0x4c, 0x00, 0x03, 0x5a, 0x80, 0x00, 0x2b, 0x90, 0x04, 0x43, 0x90, 0x03, 0x0e, 
+	0x00, 0xa3, 0xa0, 0xac, 0x04, 0x9b, 0xe0, 0x00, 0x03, 0x04, 0x13, 0xeb, 0x00, 0x03, 0x20, 0x02, 
+	0xdc, 0x0b, 0xbf, 0x00, 0x2f, 0x2c, 0x00, 0x03, 0x10, 0x1f, 0x02, 0xa7, 0xe2, 0x95, 0xad, 0x01, 
+	0xd3, 0x93, 0x01, 0xb7, 0x93, 0x00, 0x07, 0x11, 0xd7, 0x95, 0x12, 0xcf, 0x80, 0x01, 0x9f, 0x91, 
+	0x05, 0xca, 0x05, 0x91, 0x15, 0xca, 0x02, 0x15, 0x94, 0x15, 0xca, 0x05, 0x94, 0x02, 0x63, 0x90, 
+	0xa2, 0x00, 0x17, 0x91, 0x02, 0x0b, 0x81, 0x02, 0x80, 0x03, 0x57, 0x2d, 0x30, 0xe5, 0x1f, 0x00, 
+	0x2b, 0x07, 0x7f, 0x02, 0x78, 0x0f, 0x00, 0x00, 0xeb, 0x04, 0xe0, 0x9d, 0xe4, 0x40, 0x0f, 0x00, 
+	0x24, 0xea, 0x74, 0x00, 0x63, 0x00, 0x47, 0x70, 0x83, 0xb0, 0x01, 0x80, 0xb0, 0x6f, 0x01, 0x0c, 
+	0x1c, 0xe3, 0xdc, 0xf1, 0x9f, 0x55, 0x05, 0x50, 0x9b, 0xac, 0x05, 0xfb, 0xcc, 0x00, 0x33, 0xa0, 
+	0x00, 0x03, 0x58, 0x84, 0xc0, 0x2b, 0x93, 0x00, 0x6b, 0x10, 0x93, 0x00, 0x10, 0x21, 0x09, 0xe0, 
+	0x00, 0x10, 0x01, 0x06, 0x7f, 0x51, 0xe3, 0x00, 0x17, 0x3b, 0x11, 0x08, 0x0d, 0xbb, 0x2e, 0xb3, 
+	0x06, 0x43, 0x08, 0x0d, 0x13, 0x10, 0x2b, 0xc0, 0x00, 0x9f, 0x2c, 0x43, 0x1f, 0x0f, 0x00, 0x0a, 
+	0x3c, 0x11, 0xd4, 0x00, 0x47, 0x42, 0x27, 0x78, 0x00, 0x0b, 0x08, 0x02, 0x8f, 0x28, 0x10, 0x15, 
+	0x8f, 0x02, 0x09, 0x40, 0x07, 0x0a, 0x40, 0x07, 0x0b, 0x00, 0x07, 0x55, 0x2c, 0x00, 0x07, 0x0c, 
+	0x40, 0x07, 0x2c, 0x0d, 0x8f, 0x30, 0x00, 0x03, 0xb3, 0x10, 0x4f, 0xae, 0x00, 0xeb, 0x01, 0xc2, 
+	0xea, 0xad, 0x00, 0x07, 0x05, 0x63, 0x2d, 0xea, 0xac, 0x00, 0x07, 0x3f, 0x01, 0x2b, 0x14, 0x6f, 
+	0xaa, 0x23, 0xef, 0xc1, 0x08, 0x6f, 0x13, 0x37, 0x10, 0x00, 0xe2, 0x20, 0x02, 0x03, 0x3b, 0x0d, 
+	0x01, 0x80, 0xe0, 0x80, 0x0b, 0xe3, 0x50, 0xd7, 0x14, 0x01, 0x03, 0x5d, 0x2c, 0x41, 0x07, 0xac, 
+	0x0e, 0xdb, 0x90, 0xd7, 0x10, 0x13, 0x40, 0x00, 0x1b, 0x78, 0x8c, 0x04, 0xff, 0x51, 0xa7, 0x10, 
+	0xbf, 0x10, 0x9f, 0x0a, 0x00, 0xa0, 0x48, 0x43, 0x00, 0x57, 0x53, 0x92, 0x00, 0x0f, 0xec, 0x0e, 
+	0x00, 0x5b, 0xea, 0x10, 0x4b, 0x50, 0x00, 0x2b, 0x51, 0xbf, 0x60, 0xc0, 0x4b, 0x51, 0x43, 0xbb, 
+	0x50, 0x6b, 0x40, 0xf0, 0x1f, 0x20, 0x1f, 0x51, 0x8f, 0x20, 0xc0, 0x1f, 0x17, 0x83, 0x00, 0xb1, 
+	0x03, 0x00, 0x08, 0x29, 0x02, 0x00, 0x08, 0x5a, 0x89, 0x00, 0x03, 0xa4, 0x05, 0x8b, 0x10, 0x2f, 
+	0x98, 0x00, 0x2b, 0x08, 0xa1, 0x06, 0x7f, 0xfc, 0x00, 0x07, 0x34, 0x4c, 0x00, 0x03, 0x16, 0xf3, 
+	0x05, 0x00, 0x80, 0x03, 0x02, 0xf8, 0x06, 0xe7, 0xbc, 0x07, 0x8b, 0x20, 0x2c, 0x40, 0x15, 0x90, 
+	0x02, 0x02, 0x00, 0xe0, 0x02, 0x80, 0x26, 0xc7, 0x28, 0x78, 0xff, 0x02, 0x81, 0x29, 0x00, 0x21, 
+	0x08, 0xd4, 0x00, 0x3b, 0x18, 0x92, 0x02, 0x02, 0x10, 0x77, 0x20, 0xa8, 0x69, 0x30, 0xdf, 0x00, 
+	0x04, 0x2d, 0xe9, 0xd8, 0x0a, 0xab, 0x9f, 0xe5, 0x44, 0x02, 0xcb, 0x40, 0x02, 0xdf, 0x00, 0x82, 
+	0x0d, 0x33, 0xff, 0x04, 0xc0, 0xe3, 0x01, 0x0d, 0x33, 0x2b, 0x8a, 0x24, 0x5b, 0x80, 0xe1, 0x48, 
+	0x14, 0x93, 0x04, 0x33, 0x3f, 0xb0, 0x04, 0x1b, 0x9f, 0xe5, 0xb0, 0x2b, 0x1e, 0x93, 0x81, 0xe5, 
+	0x04, 0x01, 0x13, 0xa0, 0xe3, 0x08, 0x01, 0x67, 0xb4, 0x00, 0x04, 0xc1, 0xe1, 0x02, 0x2c, 0x81, 
+	0x04, 0x8f, 0xe0, 0xe3, 0x03, 0xb2, 0x00, 0xc2, 0xe1, 0x94, 0x0b, 0x00, 0x23, 0x00, 0x07, 0xb3, 
+	0x14, 0xbb, 0xb8, 0x00, 0x07, 0x10, 0x37, 0x0e, 0xc0, 0x0f, 0xe3, 0x1c, 0x0f, 0xd0, 0x19, 0xeb, 
+	0x04, 0x6b, 0x80, 0x04, 0x43, 0x2a, 0xfe, 0xff, 0xeb, 0x50, 0x6c, 0x00, 0x4f, 0x6c, 0x00, 0x2f, 
+	0x12, 0x2e, 0xa0, 0xe3, 0x56, 0x26, 0x00, 0x0f, 0x64, 0x40, 0x0b, 0x23, 0x00, 0x0b, 0x25, 0x1f, 
+	0x10, 0x1c, 0xe0, 0xe3, 0x54, 0x10, 0x6f, 0x00, 0x4b, 0x28, 0xe3, 0x02, 0x80, 0x22, 0x13, 0x02, 
+	0x10, 0x07, 0x04, 0x80, 0x13, 0x04, 0x0f, 0xe3, 0x04, 0x01, 0x06, 0x80, 0x13, 0x08, 0x10, 0x07, 
+	0x08, 0x80, 0x21, 0x13, 0x10, 0x10, 0x07, 0x0a, 0x80, 0x13, 0x20, 0x10, 0x07, 0x08, 0x0c, 0x80, 
+	0x13, 0x40, 0x00, 0x07, 0x10, 0x00, 0x80, 0x30, 0x13, 0x80, 0x10, 0x0f, 0x00, 0x07, 0x04, 0x00, 
+	0x82, 0xe4, 0x05, 0x01, 0x10, 0x91, 0xe2, 0xeb, 0x03, 0xcf, 0x04, 0x00, 0x67, 0xc1, 0x10, 0x0f, 
+	0x10, 0x9b, 0x08, 0x50, 0x2d, 0xe9, 0xa5, 0x25, 0xff, 0x2c, 0xb0, 0xe1, 0x06, 0xec, 0x1a, 0x1a, 
+	0xff, 0x15, 0xa3, 0xe4, 0xca, 0xc2, 0x46, 0x9b, 0x25, 0xff, 0xa0, 0x03, 0xd8, 0x1a, 0x3c, 0xf3, 
+	0x74, 0x82, 0x40, 0xc7, 0xcc, 0x0a, 0x9f, 0xe5, 0x30, 0x00, 0xc7, 0xf8, 0x0d, 0xfd, 0xff, 0xeb, 
+	0xc4, 0x00, 0x0b, 0x1f, 0x03, 0xf5, 0x00, 0x0b, 0x6a, 0xbc, 0x00, 0x0b, 0x10, 0xdf, 0xf2, 0x00, 
+	0x0b, 0xb4, 0x40, 0x0b, 0xef, 0xaa, 0x00, 0x0b, 0xac, 0x40, 0x0b, 0xec, 0x00, 0x0b, 0xa4, 0x00, 
+	0x0b, 0x84, 0xaa, 0x00, 0x0b, 0xe9, 0x00, 0x0b, 0x9c, 0x00, 0x0b, 0x01, 0x05, 0x5f, 0xe6, 0xb5, 
+	0x00, 0x0b, 0x06, 0x15, 0x87, 0x00, 0x0b, 0xe3, 0x00, 0x0b, 0x88, 0x40, 0x17, 0x55, 0xe0, 0x00, 
+	0x0b, 0x80, 0x40, 0x0b, 0xdd, 0x00, 0x0b, 0x78, 0x00, 0x0b, 0x05, 0x03, 0x2a, 0xa0, 0xe3, 0xda, 
+	0x00, 0x0b, 0xc8, 0x00, 0x87, 0x55, 0x6c, 0x00, 0x0f, 0xa0, 0x00, 0x4b, 0xd6, 0x00, 0x0f, 0x64, 
+	0x40, 0x0b, 0x56, 0xd3, 0x00, 0x0b, 0x5c, 0x40, 0x0b, 0xd0, 0x00, 0x0b, 0x56, 0x53, 0x4c, 0x50, 
+	0xfa, 0x31, 0x4b, 0x48, 0x40, 0xcb, 0x0c, 0x00, 0x41, 0xe5, 0x05, 0xe6, 0x04, 0xca, 0xe5, 0xe7, 
+	0x00, 0x03, 0xee, 0x00, 0x03, 0x55, 0xef, 0x00, 0x03, 0xe9, 0x00, 0x03, 0xf3, 0x00, 0x03, 0xf0, 
+	0x00, 0x03, 0x55, 0xf2, 0x00, 0x03, 0xf1, 0x00, 0x03, 0xf4, 0x02, 0x93, 0x91, 0x00, 0x37, 0x43, 
+	0xe4, 0x00, 0x0b, 0x02, 0x80, 0x88, 0xe3, 0x21, 0xfb, 0x00, 0x5f, 0x05, 0xb2, 0x04, 0xc1, 0xe1, 
+	0x04, 0x00, 0x07, 0xb6, 0x00, 0x07, 0x55, 0x2e, 0x01, 0x17, 0xfc, 0x00, 0x23, 0xeb, 0x00, 0x23, 
+	0xff, 0x00, 0x07, 0x5a, 0xec, 0x00, 0x07, 0xed, 0x00, 0x03, 0x08, 0xd7, 0xeb, 0x10, 0x0f, 0x2a, 
+	0xcb, 0x03, 0x37, 0x10, 0x83, 0xd8, 0xf9, 0x35, 0x97, 0xd4, 0x00, 0x07, 0x05, 0x7a, 0x1e, 0xeb, 
+	0x08, 0x50, 0x32, 0x5b, 0x25, 0x9f, 0x1c, 0x6f, 0x07, 0x93, 0xb0, 0x01, 0x10, 0xd2, 0xe1, 0xa7, 
+	0x41, 0x9c, 0xe7, 0x14, 0xcb, 0x2a, 0x9c, 0x19, 0x10, 0xab, 0xd1, 0x20, 0x33, 0xa4, 0x00, 0x33, 
+	0xe9, 0xd8, 0x01, 0xab, 0x10, 0x0b, 0x9c, 0x00, 0x0b, 0x03, 0xeb, 0xeb, 0x04, 0xf0, 0x2a, 0x9d, 
+	0xe4, 0x10, 0x27, 0xeb, 0x40, 0x17, 0x88, 0x00, 0x17, 0xec, 0xab, 0x40, 0x0b, 0x80, 0x00, 0x0b, 
+	0xed, 0x40, 0x0b, 0x78, 0x40, 0x6f, 0x15, 0x0f, 0xa5, 0x10, 0x6b, 0x6c, 0x00, 0x57, 0x6c, 0x09, 
+	0x31, 0x93, 0x68, 0x00, 0x1b, 0x02, 0xf0, 0x44, 0x2d, 0xe9, 0xcc, 0xa8, 0x06, 0xbb, 0x79, 0xd0, 
+	0x06, 0xa7, 0x03, 0x0f, 0x81, 0x0c, 0x6b, 0x01, 0x72, 0x87, 0xe0, 0x04, 0x54, 0x69, 0x9f, 0xe5, 
+	0x10, 0x1f, 0xb7, 0x00, 0xd7, 0x1c, 0xe4, 0xa0, 0x01, 0x04, 0x4f, 0x0f, 0x6b, 0x50, 0x0b, 0x80, 
+	0x52, 0x40, 0x85, 0x60, 0x0b, 0x00, 0x55, 0x85, 0xe1, 0xb2, 0x50, 0x01, 0xc6, 0xe0, 0x01, 0x40, 
+	0x54, 0xe2, 0xf3, 0x06, 0xb7, 0x29, 0xf0, 0x44, 0x30, 0xd7, 0x18, 0x00, 0x5b, 0x18, 0x29, 0x10, 
+	0x7b, 0x48, 0xd2, 0x18, 0x97, 0xe2, 0x3b, 0x04, 0x47, 0x01, 0x00, 0xc2, 0x56, 0xe5, 0x00, 0x1b, 
+	0x51, 0x10, 0xb7, 0x00, 0x10, 0xdf, 0x02, 0x6f, 0x11, 0x86, 0x29, 0x13, 0x9d, 0xe4, 0xec, 0x28, 
+	0x10, 0xd7, 0x10, 0x2b, 0x10, 0x8b, 0x1e, 0x13, 0x01, 0xe4, 0x08, 0x10, 0x0f, 0x90, 0x28, 0x9f, 
+	0x10, 0x0f, 0x76, 0xd8, 0x02, 0x9f, 0x50, 0x0b, 0x11, 0x2f, 0xd8, 0x17, 0x4f, 0x11, 0x37, 0x00, 
+	0x12, 0x06, 0xef, 0x30, 0x1d, 0xb3, 0x00, 0x42, 0x18, 0x37, 0xe1, 0x54, 0x0a, 0x80, 0x13, 0x02, 
+	0x00, 0x13, 0x30, 0x06, 0xcf, 0x01, 0x10, 0x14, 0x42, 0xe5, 0x98, 0x00, 0x4f, 0x98, 0x00, 0x63, 
+	0x01, 0x10, 0x02, 0xd0, 0xe4, 0x2a, 0x10, 0x51, 0xe2, 0x00, 0x43, 0xb3, 0x00, 0x05, 0x1a, 0x81, 
+	0xe3, 0xb2, 0x10, 0xc2, 0xe0, 0x07, 0x0f, 0x00, 0x12, 0xe3, 0xf8, 0x46, 0xef, 0x21, 0x8f, 0x05, 
+	0xcf, 0x95, 0x05, 0x57, 0xeb, 0x14, 0x00, 0x03, 0x26, 0x12, 0xf7, 0x80, 0x08, 0xaf, 0xd2, 0x00, 
+	0x13, 0x11, 0x6b, 0x2c, 0x00, 0x43, 0x38, 0xc8, 0x31, 0xcb, 0x4c, 0x0a, 0xf8, 0x9f, 0xe5, 0x4c, 
+	0x00, 0x0f, 0x4c, 0x40, 0x0f, 0x3c, 0xaa, 0x00, 0x0f, 0x44, 0x00, 0x0f, 0x44, 0x40, 0x0f, 0x2c, 
+	0x00, 0x0f, 0x3c, 0xae, 0x00, 0x0f, 0x3c, 0x40, 0x0f, 0x1c, 0x00, 0x0f, 0x50, 0x4b, 0x11, 0xab, 
+	0x28, 0x95, 0x00, 0x1b, 0xec, 0xc7, 0x30, 0x1b, 0x00, 0x00, 0x1b, 0x1c, 0x11, 0x03, 0x9a, 0x40, 
+	0x2b, 0xf0, 0xf7, 0x01, 0x7f, 0x00, 0x0f, 0xf8, 0x40, 0x1f, 0xe0, 0xab, 0x00, 0x0f, 0x04, 0x00, 
+	0x0f, 0xf0, 0x40, 0x0f, 0xd0, 0x00, 0x0f, 0x50, 0x4b, 0x9a, 0x11, 0xeb, 0xec, 0x27, 0x02, 0xf7, 
+	0x40, 0x1b, 0xb4, 0x00, 0x1b, 0xe0, 0xaa, 0x00, 0x0f, 0xb4, 0x40, 0x0f, 0xa4, 0x00, 0x0f, 0xd4, 
+	0x00, 0x0f, 0xac, 0xaa, 0x40, 0x0f, 0x94, 0x00, 0x0f, 0xc8, 0x00, 0x0f, 0xa4, 0x40, 0x0f, 0x84, 
+	0xaa, 0x40, 0x4b, 0x18, 0x00, 0x4b, 0x66, 0x4a, 0x3b, 0x18, 0x0e, 0x2f, 0xe0, 0x41, 0x06, 0x1a, 
+	0xc3, 0x90, 0xe5, 0x18, 0x20, 0x90, 0x0a, 0xdb, 0x32, 0x91, 0xe1, 0x19, 0x57, 0x13, 0x47, 0xd4, 
+	0x16, 0x38, 0xff, 0xd0, 0x95, 0x40, 0x07, 0x80, 0x07, 0x00, 0x4f, 0x36, 0x0f, 0x8f, 0x47, 0x00, 
+	0xa3, 0x20, 0x20, 0x93, 0x08, 0x9f, 0x84, 0xe4, 0x02, 0x28, 0xb0, 0x80, 0x17, 0xcb, 0x0a, 0x22, 
+	0x28, 0xa0, 0xe1, 0x04, 0x10, 0x03, 0x93, 0xe4, 0x53, 0x0d, 0x00, 0xeb, 0x0e, 0x7b, 0x2f, 0xe3, 
+	0x55, 0x65, 0x03, 0x13, 0x66, 0x00, 0x03, 0x18, 0x00, 0x73, 0xf8, 0x0b, 0x2b, 0xa0, 0x10, 0x83, 
+	0x44, 0x00, 0x83, 0xf8, 0x8f, 0xbd, 0xe8, 0x53, 0x00, 0x4e, 0x8a, 0xe2, 0x0f, 0x00, 0x94, 0xe8, 
+	0x1f, 0xa2, 0x00, 0x8b, 0x4c, 0x02, 0x8f, 0x01, 0x10, 0x81, 0x23, 0xc3, 0x28, 0x82, 0x00, 0x1f, 
+	0x01, 0x23, 0xa0, 0xe3, 0x60, 0x00, 0x13, 0xf8, 0x08, 0x01, 0x91, 0xe8, 0x30, 0x10, 0x1b, 0x40, 
+	0xc4, 0xe1, 0x48, 0x34, 0x20, 0x07, 0x84, 0xe1, 0x10, 0x2b, 0x02, 0x10, 0x11, 0x28, 0xe2, 0x44, 
+	0x18, 0xaf, 0x85, 0x02, 0x2b, 0x88, 0x88, 0xe1, 0x00, 0x08, 0x70, 0xa0, 0x11, 0x3c, 0x85, 0x9a, 
+	0x15, 0xa1, 0x10, 0x43, 0x02, 0x07, 0xab, 0xe8, 0x06, 0x9f, 0xd5, 0x1b, 0x5b, 0x00, 0xe4, 0x06, 
+	0x9f, 0x05, 0x48, 0x00, 0x82, 0xe5, 0x01, 0x08, 0x10, 0x82, 0xe2, 0xf8, 0x01, 0x81, 0x2a, 0x8b, 
+	0x04, 0xb0, 0x04, 0xc2, 0xe1, 0x58, 0x00, 0x43, 0xb0, 0x00, 0x02, 0xd1, 0xe1, 0x02, 0x0a, 0xc0, 
+	0xe3, 0x15, 0xcb, 0xc0, 0xa8, 0x00, 0xff, 0xb4, 0x00, 0x07, 0x1f, 0x07, 0xd3, 0x0f, 0x00, 0x84, 
+	0x80, 0x22, 0xd7, 0x53, 0x2e, 0x8a, 0xe2, 0xf0, 0x00, 0x92, 0x0d, 0xe8, 0xff, 0x04, 0x14, 0x22, 
+	0x8b, 0x10, 0x8f, 0x90, 0x03, 0x4b, 0x00, 0xff, 0x0c, 0x14, 0xe3, 0x94, 0xf6, 0x9f, 0x05, 0x00, 
+	0x04, 0x50, 0x81, 0xe5, 0x10, 0x60, 0x81, 0xe5, 0x04, 0x14, 0x70, 0x81, 0xe5, 0x18, 0x12, 0x7b, 
+	0x20, 0x52, 0x32, 0xe2, 0xf9, 0x42, 0x5b, 0x07, 0xbf, 0x0a, 0x80, 0x02, 0x6b, 0xdf, 0x01, 0x20, 
+	0xa0, 0x03, 0xbf, 0x20, 0xa0, 0x13, 0x1b, 0x93, 0x01, 0x03, 0x00, 0x5c, 0xe3, 0x04, 0x20, 0xc2, 
+	0x0b, 0x7b, 0x10, 0x5c, 0xe3, 0x08, 0x00, 0x07, 0x54, 0xf6, 0x9f, 0xe5, 0x23, 0x53, 0xce, 0x11, 
+	0x03, 0x9c, 0xe8, 0x0f, 0x41, 0x03, 0x20, 0xff, 0xda, 0x00, 0x17, 0x10, 0x07, 0x38, 0x10, 0x07, 
+	0x20, 0x8f, 0x8c, 0x20, 0x8f, 0x2c, 0x40, 0x26, 0x03, 0xcb, 0x12, 0x92, 0xe7, 0x00, 0x10, 0x82, 
+	0x94, 0x01, 0x7b, 0x82, 0xe2, 0x50, 0x0b, 0x18, 0x00, 0x17, 0x00, 0x13, 0xd8, 0x70, 0x17, 0x50, 
+	0x0b, 0x1c, 0x80, 0x0b, 0x90, 0x17, 0xec, 0xf5, 0x9f, 0x73, 0xe5, 0x56, 0x0f, 0x16, 0xd3, 0x08, 
+	0x63, 0x1a, 0x04, 0x00, 0xd7, 0x11, 0x1b, 0x00, 0x04, 0x00, 0x52, 0xe3, 0x44, 0x05, 0x9f, 0x05, 
+	0x01, 0xb0, 0x00, 0xd0, 0x01, 0x00, 0x08, 0x80, 0x13, 0x7f, 0x2d, 0xe1, 0x10, 0x00, 0x1b, 0xbc, 
+	0x00, 0x33, 0x10, 0x1f, 0xe4, 0x2c, 0x53, 0x0b, 0x2d, 0xe9, 0xb0, 0x45, 0x07, 0x03, 0x55, 0x06, 
+	0x13, 0x0a, 0xdb, 0x4e, 0x2d, 0x17, 0x47, 0x10, 0xb0, 0x22, 0x33, 0x24, 0xb7, 0x00, 0x2b, 0x01, 
+	0x14, 0x90, 0x59, 0xe2, 0x0a, 0xdb, 0x1a, 0x12, 0x6b, 0x04, 0x00, 0x79, 0x95, 0x0f, 0x36, 0x02, 
+	0x27, 0x80, 0x13, 0x0b, 0xe3, 0xe3, 0x64, 0x00, 0x4b, 0x40, 0xfc, 0x03, 0xeb, 0x6c, 0x25, 0x9a, 
+	0xe5, 0xfc, 0x24, 0xd6, 0x0b, 0x3f, 0x07, 0x87, 0x03, 0x06, 0xab, 0x74, 0x0b, 0x7b, 0x10, 0x47, 
+	0x58, 0xb5, 0x00, 0x47, 0x02, 0x00, 0x27, 0x12, 0x3f, 0x03, 0x05, 0x43, 0x4c, 0x10, 0x57, 0x48, 
+	0x03, 0x00, 0xa7, 0x12, 0xd0, 0x22, 0x2b, 0x00, 0x12, 0xc0, 0x20, 0xe5, 0x08, 0x00, 0x03, 0x00, 
+	0x00, 0x0f, 0xe1, 0x80, 0x02, 0x00, 0xc0, 0xe3, 0x00, 0xf0, 0x29, 0x67, 0x8b, 0xf4, 0xb9, 0x00, 
+	0x43, 0x0c, 0x13, 0x6b, 0x17, 0x57, 0x24, 0x27, 0x04, 0xef, 0x37, 0xcf, 0x57, 0x51, 0x04, 0x3b, 
+	0xc0, 0x00, 0x07, 0x41, 0x14, 0x9f, 0x0c, 0xdb, 0x13, 0xff, 0x45, 0x59, 0x00, 0x4f, 0x59, 0xe5, 
+	0xf0, 0x04, 0x73, 0x41, 0x0d, 0x87, 0x95, 0x01, 0x0f, 0x0a, 0xcb, 0x00, 0x0b, 0x4e, 0x00, 0x0b, 
+	0x3d, 0x00, 0x0b, 0x55, 0xa6, 0x02, 0x47, 0x41, 0x00, 0x07, 0x51, 0x29, 0x77, 0xd9, 0x00, 0x2b, 
+	0x00, 0xd9, 0xe5, 0x02, 0x20, 0xd9, 0xe5, 0x03, 0xc0, 0x1a, 0xd9, 0xe5, 0xe6, 0x00, 0x27, 0x50, 
+	0x2f, 0x4f, 0x00, 0x2f, 0x25, 0xb5, 0x00, 0x0b, 0xa1, 0x19, 0xd3, 0x00, 0x07, 0x45, 0x00, 0x2f, 
+	0x20, 0x01, 0x4f, 0x09, 0xfa, 0x00, 0x5c, 0x03, 0x08, 0x1b, 0x0a, 0x28, 0x40, 0x0b, 0xa3, 0x06, 
+	0x2f, 0x0a, 0x12, 0x9b, 0xfe, 0x00, 0x52, 0x12, 0x0b, 0x1d, 0xd3, 0xaa, 0x20, 0x0f, 0x3d, 0x00, 
+	0x0f, 0xc8, 0x00, 0x0f, 0x0e, 0x00, 0x0f, 0x36, 0xda, 0x00, 0x3b, 0x12, 0xc7, 0x28, 0x40, 0x1b, 
+	0x0e, 0xc3, 0x0a, 0x0f, 0xce, 0xea, 0xb2, 0x10, 0x0b, 0x2d, 0x00, 0x0b, 0x06, 0x8b, 0xea, 0x04, 
+	0x00, 0x87, 0x05, 0xab, 0x00, 0x87, 0x20, 0x00, 0x13, 0xf8, 0x00, 0x3b, 0x21, 0x20, 0x63, 0x70, 
+	0x17, 0x6e, 0x18, 0x40, 0x17, 0x0f, 0x0f, 0x0a, 0x00, 0x3f, 0x60, 0x8b, 0x0f, 0x5f, 0x0a, 0x54, 
+	0x04, 0x00, 0xc7, 0x4f, 0x00, 0x0f, 0x18, 0x00, 0x0f, 0xf9, 0x00, 0x2c, 0x50, 0x03, 0x0f, 0x8b, 
+	0x0a, 0x0f, 0x57, 0x00, 0x23, 0x51, 0xe3, 0x7a, 0xfb, 0x00, 0x33, 0x0f, 0x8b, 0x03, 0xff, 0x30, 
+	0xeb, 0x20, 0x00, 0xcf, 0xfc, 0xe8, 0x00, 0xdb, 0x13, 0xe3, 0x00, 0x27, 0xea, 0x0f, 0xbf, 0xea, 
+	0xc4, 0xc3, 0x26, 0x9f, 0xe5, 0x00, 0xa7, 0xea, 0xc0, 0x00, 0x07, 0x00, 0xbf, 0xea, 0x66, 0xbc, 
+	0x00, 0x07, 0x00, 0x30, 0xea, 0xb8, 0x00, 0x07, 0x08, 0x63, 0xea, 0x66, 0xb4, 0x00, 0x07, 0x0e, 
+	0x93, 0xea, 0xb0, 0x00, 0x07, 0x02, 0x17, 0xea, 0x6d, 0xac, 0x00, 0x07, 0x1a, 0xbf, 0xa8, 0x00, 
+	0x07, 0x1a, 0xbf, 0xa4, 0x00, 0x07, 0x21, 0x20, 0x06, 0x0d, 0x53, 0x06, 0x8a, 0xe5, 0x24, 0x00, 
+	0x07, 0x55, 0x2c, 0x00, 0x07, 0x18, 0x00, 0x07, 0x20, 0x00, 0x07, 0x1c, 0x00, 0x07, 0x55, 0x24, 
+	0x00, 0x07, 0x10, 0x00, 0x07, 0x18, 0x00, 0x07, 0x14, 0x00, 0x07, 0x50, 0x1c, 0x10, 0x0f, 0x96, 
+	0x00, 0x0b, 0xc6, 0x8a, 0xe5, 0x0c, 0x85, 0x02, 0x93, 0x01, 0x10, 0xbd, 0xe8, 0x16, 0x4f, 0x02, 
+	0x01, 0xb7, 0x23, 0x01, 0x20, 0x11, 0xbb, 0x51, 0xe3, 0x44, 0x00, 0xb7, 0x1e, 0x07, 0x6d, 0xbe, 
+	0x00, 0xd7, 0x11, 0xb7, 0x44, 0x11, 0xaf, 0x41, 0xab, 0xfe, 0x00, 0x1f, 0x95, 0x0f, 0x07, 0x0a, 
+	0x01, 0x00, 0x0b, 0xb8, 0x00, 0x0b, 0x11, 0x00, 0x0b, 0x66, 0xb9, 0x00, 0x07, 0x04, 0xfb, 0x0a, 
+	0xba, 0x00, 0x07, 0x0d, 0x2e, 0x0a, 0x75, 0xbb, 0x00, 0x07, 0x06, 0x03, 0x21, 0x7b, 0x03, 0x00, 
+	0x37, 0xfa, 0x00, 0x0f, 0x58, 0x33, 0x03, 0x1b, 0xfc, 0x0c, 0xfb, 0x11, 0x3b, 0xf8, 0x12, 0x9f, 
+	0x2a, 0x05, 0x38, 0x00, 0x07, 0xf4, 0x00, 0x07, 0x30, 0x00, 0x07, 0xf0, 0xca, 0x00, 0x07, 0x01, 
+	0xe7, 0xea, 0x02, 0x00, 0x2b, 0xfb, 0x31, 0xab, 0x1a, 0x55, 0xd0, 0x40, 0x2b, 0xd8, 0x40, 0x2b, 
+	0xd4, 0x00, 0x07, 0x23, 0x80, 0x23, 0x95, 0x00, 0x67, 0x1a, 0xac, 0x40, 0x23, 0xbc, 0x40, 0x23, 
+	0xb8, 0x00, 0x07, 0x57, 0x1a, 0x80, 0x23, 0x16, 0x00, 0x23, 0x88, 0x40, 0x23, 0x0d, 0x77, 0x20, 
+	0x23, 0x79, 0x9c, 0x00, 0x07, 0x00, 0xb3, 0x60, 0x23, 0x02, 0x43, 0x1a, 0x64, 0x40, 0x23, 0x5d, 
+	0x84, 0x40, 0x23, 0x80, 0x00, 0x07, 0x11, 0x7b, 0x11, 0xb3, 0xfd, 0x00, 0x23, 0x99, 0x01, 0x77, 
+	0x1a, 0x40, 0x1d, 0xb7, 0x22, 0x23, 0x52, 0xe3, 0x00, 0x2f, 0x88, 0x02, 0xaa, 0x00, 0xea, 0x2c, 
+	0x00, 0x13, 0x30, 0x26, 0x9a, 0x02, 0xe5, 0x38, 0x26, 0x8a, 0xe5, 0x34, 0x00, 0x07, 0x3c, 0xa1, 
+	0x00, 0x07, 0x30, 0x01, 0x5b, 0x34, 0x16, 0x8a, 0xe5, 0x11, 0x53, 0x69, 0x40, 0x04, 0xb7, 0x14, 
+	0xef, 0x04, 0x37, 0x9f, 0x11, 0xa2, 0x04, 0x2b, 0x05, 0x02, 0x00, 0x80, 0xe3, 0xa2, 0x08, 0xeb, 
+	0x24, 0x0d, 0xeb, 0x95, 0x18, 0xff, 0xa5, 0x14, 0x14, 0x3f, 0x51, 0x20, 0x1f, 0xa6, 0x40, 0x0b, 
+	0x02, 0x30, 0xfe, 0xff, 0x1a, 0xf8, 0x20, 0x01, 0xef, 0xc1, 0xec, 0x00, 0x03, 0x07, 0xf7, 0x13, 
+	0xc3, 0x14, 0x0d, 0x27, 0x17, 0xf3, 0x10, 0x21, 0xfe, 0x08, 0x23, 0x10, 0x17, 0x00, 0x0f, 0x19, 
+	0x37, 0xf0, 0x3f, 0x01, 0x6b, 0x00, 0x3f, 0x00, 0x81, 0x00, 0x27, 0xf0, 0xc0, 0x9f, 0xe5, 0xdc, 
+	0xf0, 0x18, 0xd7, 0xd5, 0xf0, 0x27, 0x10, 0x0b, 0x3c, 0x00, 0x27, 0xe8, 0x00, 0x67, 0xd0, 0x00, 
+	0x27, 0x60, 0xb4, 0x00, 0x27, 0x1c, 0x47, 0xfc, 0x7f, 0x00, 0x03, 0xf8, 0x08, 0x2c, 0x00, 0x03, 
+	0x85, 0x02, 0xa0, 0x40, 0x5f, 0x40, 0x00, 0x5f, 0x48, 0xac, 0x02, 0x02, 0x88, 0x9c, 0x02, 0x00, 
+	0x02, 0x7c, 0x79, 0x00, 0x03, 0xef, 0xbe, 0xad, 0x28, 0xde, 0xe1, 0x0c, 0x5f, 0xd8, 0x0c, 0x3f, 
+	0xdc, 0x99, 0x02, 0x24, 0x02, 0x9c, 0x00, 0x03, 0x5c, 0x98, 0x00, 0x07, 0x97, 0x02, 0x02, 0x02, 
+	0xdc, 0x96, 0x02, 0x02, 0x18, 0x00, 0x03, 0x00, 0x40, 0x40, 0x02, 0x3a, 0x80, 0x00, 0x06, 0x00, 
+	0x40, 0x01, 0x01, 0x06, 0x00, 0x50, 0x00, 0x06, 0x48, 0xbd, 0x0c, 0x5b, 0x09, 0xbc, 0x02, 0x02, 
+	0x08, 0x00, 0x03, 0x6c, 0x3a, 0x0c, 0x47, 0xa8, 0x0c, 0x5b, 0xc8, 0x01, 0xe0, 0x98, 0x01, 0x60, 
+	0x64, 0xf6, 0x00, 0x10, 0x06, 0xbc, 0x31, 0x0e, 0x3b, 0x4f, 0x00, 0x03, 0x54, 0x82, 0x00, 0x17, 
+	0xbc, 0x63, 0x00, 0x08, 0xfc, 0x00, 0x03, 0x24, 0x06, 0x64, 0x00, 0x08, 0x7c, 0x78, 0x00, 0x8b, 
+	0x00, 0x03, 0xa4, 0x80, 0x0c, 0xbf, 0xa0, 0x76, 0x00, 0x08, 0xc0, 0xdf, 0x02, 0x10, 0x02, 0xc8, 
+	0x33, 0x00, 0x3f, 0x3c, 0x00, 0x03, 0x6d, 0x08, 0x19, 0x00, 0x08, 0xa8, 0x00, 0x83, 0xf8, 0x3b, 
+	0x00, 0x00, 0x03, 0xc0, 0x4a, 0x00, 0x06, 0xe4, 0x39, 0x00, 0x2a, 0x03, 0x84, 0x00, 0x2b, 0xc8, 
+	0x00, 0x23, 0x8c, 0x00, 0x07, 0xd0, 0xaa, 0x00, 0x07, 0x94, 0x00, 0x07, 0xd8, 0x00, 0x07, 0xbc, 
+	0x00, 0x07, 0xcc, 0xaa, 0x00, 0x03, 0xdc, 0x00, 0x03, 0xec, 0x00, 0x03, 0xc4, 0x00, 0x03, 0xd4, 
+	0xa8, 0x00, 0x03, 0xe4, 0x00, 0x03, 0xf4, 0x00, 0x03, 0x00, 0xe2, 0x00, 0x26, 0x06, 0x1c, 0x00, 
+	0xc7, 0x50, 0x48, 0x00, 0x1b, 0x00, 0x8b, 0xfa, 0x00, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0xec, 0xff, 
+	0x28, 0xa9, 0x06, 0x78, 0x44, 0x00, 0x0f, 0xac, 0x00, 0x03, 0xa4, 0x5e, 0x0f, 0x0f, 0x00, 0x01, 
+	0x00, 0x05, 0x00, 0x02, 0x00, 0x05, 0x5c, 0x08, 0x34, 0x00, 0x03, 0x9c, 0x00, 0x03, 0x20, 0x00, 
+	0x00, 0x02, 0x05, 0x80, 0xef, 0x00, 0x06, 0xb0, 0x00, 0x0b, 0xa4, 0x95, 0x0d, 0xb7, 0x88, 0x35, 
+	0x00, 0x4b, 0x38, 0x00, 0xc3, 0x37, 0x00, 0x6f, 0xaa, 0x00, 0x03, 0xc4, 0x00, 0x03, 0x24, 0x00, 
+	0x0f, 0x1c, 0x00, 0x03, 0x38, 0xaa, 0x00, 0x03, 0x54, 0x00, 0x03, 0xb8, 0x00, 0x13, 0x8c, 0x00, 
+	0xab, 0x20, 0xaa, 0x00, 0x03, 0x00, 0x00, 0x03, 0x10, 0x00, 0x03, 0x70, 0x00, 0x03, 0x48, 0xad, 
+	0x00, 0x03, 0x64, 0x00, 0x03, 0x3c, 0x10, 0xc7, 0x00, 0x03, 0x5c, 0x00, 0x03, 0x55, 0x78, 0x00, 
+	0x03, 0x50, 0x00, 0x03, 0x34, 0x00, 0x03, 0x1c, 0x0d, 0xbb, 0x6f, 0xe7, 0x02, 0x3b, 0x1d, 0xeb, 
+	0xe6, 0x40, 0x07, 0x10, 0x03, 0x19, 0x5b, 0x10, 0x07, 0xf5, 0x19, 0x17, 0x10, 0x07, 0x18, 0xd3, 
+	0x10, 0x07, 0xef, 0x40, 0x07, 0xee, 0x40, 0x07, 0x68, 0xf0, 0x00, 0x07, 0x15, 0xa3, 0xf0, 0x01, 
+	0xf7, 0x3f, 0x10, 0x01, 0x21, 0xe2, 0xa8, 0x0e, 0x3f, 0x01, 0x00, 0xd0, 0xe7, 0x10, 0x13, 0x57, 
+	0xf2, 0x40, 0x1b, 0xf2, 0x40, 0x1b, 0x90, 0x80, 0x1b, 0x1b, 0xd7, 0x30, 0x23, 0xa0, 0x30, 0x07, 
+	0x18, 0x0a, 0xf7, 0x74, 0xa0, 0x9f, 0xe5, 0x82, 0x80, 0x48, 0xef, 0x38, 0x10, 0x8f, 0x12, 0x00, 
+	0x41, 0x91, 0x40, 0x17, 0x08, 0x9f, 0x13, 0x3c, 0x30, 0x8f, 0xe2, 0x00, 0x04, 0x21, 0xb3, 0xe7, 
+	0x58, 0x10, 0x3d, 0xf3, 0x06, 0x1c, 0x41, 0x8a, 0x0a, 0x2f, 0x81, 0xe2, 0x08, 0x20, 0xb3, 0x20, 
+	0x0f, 0x0a, 0x00, 0x40, 0x82, 0x15, 0x10, 0x0b, 0x04, 0x40, 0x0b, 0x18, 0x80, 0x4a, 0xf3, 0x00, 
+	0x80, 0x48, 0xe2, 0x02, 0x8c, 0x48, 0x2b, 0xe2, 0x0f, 0x00, 0x03, 0xdc, 0x01, 0x23, 0x90, 0x11, 
+	0x1b, 0x02, 0x0b, 0x57, 0xfc, 0x02, 0x13, 0xf4, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x12, 0x0b, 0x11, 
+	0xc7, 0x80, 0x12, 0x9f, 0xb0, 0x3e, 0x00, 0x03, 0x0b, 0xb0, 0xa0, 0x8b, 0x3a, 0x73, 0x00, 0xff, 
+	0xef, 0x30, 0x07, 0x12, 0x40, 0x07, 0x76, 0xa3, 0xc8, 0x2b, 0xb7, 0x00, 0xcb, 0x00, 0xc0, 0x10, 
+	0x0f, 0x0d, 0xef, 0x64, 0xc0, 0x00, 0x97, 0x0b, 0x53, 0xe1, 0x01, 0xc0, 0xa0, 0x03, 0x5c, 0xaa, 
+	0x40, 0x0b, 0x02, 0x00, 0x0b, 0x54, 0x40, 0x0b, 0x04, 0x00, 0x0b, 0x0c, 0xdc, 0x0b, 0x0b, 0x10, 
+	0x37, 0x10, 0x16, 0xcf, 0x06, 0xe3, 0x10, 0x4f, 0xba, 0x0b, 0x00, 0xc1, 0xe1, 0xb6, 0x0c, 0xc1, 
+	0xe1, 0xb2, 0x0d, 0x13, 0xc1, 0xe1, 0xbe, 0x00, 0x03, 0x02, 0x1c, 0x00, 0xd3, 0x09, 0xbf, 0xa8, 
+	0x1f, 0x83, 0x20, 0x00, 0x3b, 0x20, 0x03, 0x3f, 0x01, 0x20, 0x42, 0x20, 0xe0, 0x00, 0x03, 0xa3, 
+	0x81, 0xfa, 0xff, 0xea, 0x6e, 0x00, 0x7a, 0xb0, 0x5a, 0x7e, 0x68, 0xbe, 0xab, 0x7f, 0x0c, 0x18, 
+	0xae, 0xba, 0x80, 0x00, 0x03, 0x13, 0x0f, 0xac, 0x67, 0x10, 0x00, 0x08, 0x68, 0x0f, 0x47, 0xcc, 
+	0x20, 0x8f, 0xe2, 0x38, 0x5e, 0x3f, 0x01, 0x27, 0x0c, 0x23, 0x0c, 0x1b, 0xe3, 0x9c, 0x11, 0x17, 
+	0x9f, 0xe5, 0x27, 0x0b, 0x2b, 0x1c, 0x00, 0xb3, 0x04, 0xcf, 0x2d, 0x7b, 0x58, 0x8c, 0x00, 0x13, 
+	0xb0, 0x0f, 0x27, 0x1f, 0x2f, 0x00, 0x00, 0x01, 0x42, 0xef, 0x04, 0x67, 0xef, 0x04, 0x40, 0xb0, 
+	0x19, 0x07, 0x1a, 0x01, 0x04, 0xc0, 0x92, 0xe4, 0x0c, 0xc0, 0xb0, 0x10, 0xa3, 0x08, 0x01, 0x01, 
+	0x08, 0x5c, 0x13, 0xcb, 0xc1, 0x01, 0x40, 0x31, 0x4c, 0xe2, 0x10, 0x17, 0x10, 0xb7, 0x04, 0xc0, 
+	0x12, 0x09, 0xd7, 0x24, 0x44, 0xe2, 0x10, 0x0b, 0x05, 0x50, 0x30, 0x33, 0xb2, 0x00, 0x32, 0xd3, 
+	0xe0, 0x11, 0xab, 0x10, 0x33, 0x02, 0x0c, 0x2c, 0x0b, 0xc1, 0x0c, 0x01, 0x50, 0x40, 0xe2, 0x10, 
+	0x17, 0x10, 0x27, 0xb2, 0x00, 0x06, 0x53, 0xe1, 0x01, 0x50, 0x45, 0x20, 0x33, 0x18, 0x8f, 0xe3, 
+	0x8b, 0x07, 0xef, 0xb0, 0x00, 0xdc, 0x06, 0x17, 0x51, 0x68, 0x63, 0x10, 0x17, 0x55, 0xdd, 0x00, 
+	0x17, 0xe9, 0x20, 0x1b, 0xcc, 0x20, 0x1b, 0xfa, 0x50, 0x1b, 0x32, 0x00, 0xfe, 0x06, 0x0e, 0x03, 
+	0x1f, 0x00, 0x02, 0x00, 0x03, 0x04, 0xa4, 0x00, 0x03, 0x88, 0x00, 0x0f, 0xfc, 0x09, 0x05, 0x33, 
+	0x00, 0xfe, 0x00, 0xff, 0xff, 0x09, 0xa8, 0xec, 0x30, 0x09, 0xe9, 0x86, 0x06, 0xf0, 0x8a, 0x46, 
+	0x02, 0x08, 0x10, 0x0b, 0x10, 0x07, 0x00, 0x00, 0xa8, 0xec, 0x08, 0xa0, 0x68, 0x02, 0x08, 0xf4, 
+	0xc0, 0x0d, 0x64, 0x50, 0x17, 0x2e, 0x59, 0x6b, 0x09, 0x02, 0x00, 0x20, 0xe0, 0x08, 0x07, 0x0b, 
+	0x08, 0xfc, 0x1f, 0x80, 0x08, 0x01, 0x4a, 0x10, 0x00, 0x08, 0x12, 0x06, 0x80, 0x00, 0x4f, 0x00, 
+	0x00, 0x08, 0x66, 0x1b, 0x80, 0x08, 0x08, 0x00, 0x08, 0x80, 0x08, 0x0e, 0x08, 0x10, 0x67, 0x00, 
+	0x08, 0xe4, 0xd9, 0x09, 0x51, 0x10, 0x03, 0x88, 0x40, 0x03, 0x00, 0x13, 0x09, 0xe0, 0x00, 0x6b, 
+	0x95, 0x00, 0x66, 0x00, 0xec, 0x40, 0x07, 0xfc, 0x40, 0x07, 0x4a, 0x00, 0x07, 0x05, 0x00, 0x00, 
+	0x20, 0x09, 0xf0, 0x00, 0x07, 0xe8, 0x10, 0x0b, 0x10, 0xd2, 0x00, 0x15, 0x20, 0x03, 0x80, 0x00, 
+	0x15, 0x5a, 0x10, 0xa5, 0x5a, 0xa5, 0x00, 0x22, 0x00, 0x54, 0x53, 0xf4, 0x10, 0x01, 0x34, 0x12, 
+	0x10, 0x05, 0x78, 0x56, 0x54, 0x53, 0x00, 0x54, 0x53, 0x78, 0x56, 0x34, 0x12, 0xf4, 0x01, 0x01, 
+	0xcd, 0xab, 0x54, 0x53, 0x00, 0x00, 0xee, 0x05, 0xe9, 0x41, 0xfa, 0x05, 0x13, 0x01, 0x33, 0xa0, 
+	0xe3, 0x38, 0x01, 0x9b, 0x00, 0x38, 0x01, 0x9f, 0xe5, 0xb1, 0x00, 0x83, 0xe1, 0x00, 0xb0, 0x18, 
+	0xd3, 0xe1, 0xb0, 0x38, 0xc3, 0xe1, 0x15, 0xb0, 0x00, 0xd3, 0x09, 0x33, 0x80, 0x0a, 0xfb, 0xc3, 
+	0x02, 0x7f, 0x39, 0x03, 0xef, 0x30, 0x0f, 0x1b, 0x0b, 0x00, 0x1b, 0x18, 0xc3, 0x22, 0x4f, 0xa0, 
+	0x2d, 0xaf, 0x31, 0x1d, 0x47, 0xa0, 0xe3, 0xb4, 0x10, 0xc3, 0x2d, 0xe1, 0x07, 0x00, 0x07, 0xb2, 
+	0x00, 0x07, 0x10, 0x0f, 0xb0, 0x00, 0x07, 0x55, 0x05, 0x40, 0x07, 0x65, 0x0a, 0x1f, 0x08, 0x02, 
+	0xaf, 0x02, 0x00, 0x0f, 0x06, 0x22, 0x13, 0x01, 0xe0, 0x04, 0x09, 0x9b, 0x10, 0x17, 0x22, 0x32, 
+	0x13, 0xa0, 0x00, 0x23, 0x30, 0x0b, 0x82, 0x20, 0x07, 0xb3, 0xc0, 0x1d, 0x5c, 0xe2, 0xf5, 0x01, 
+	0x7f, 0x10, 0x37, 0x10, 0x47, 0x00, 0x00, 0x37, 0x51, 0x20, 0x00, 0x37, 0x04, 0xc0, 0x4f, 0xb0, 
+	0x10, 0xd3, 0x07, 0xd7, 0x13, 0x01, 0xe2, 0xa2, 0x10, 0x33, 0x2f, 0x82, 0x60, 0x37, 0x12, 0x67, 
+	0x68, 0x18, 0xf0, 0x2f, 0x60, 0x2f, 0xa0, 0x03, 0x07, 0x01, 0x0b, 0x80, 0x83, 0x60, 0x2f, 0xa8, 
+	0x25, 0x8a, 0xe5, 0xac, 0x0a, 0x53, 0x10, 0xcb, 0x88, 0x09, 0x7f, 0xda, 0x01, 0x60, 0x00, 0x3b, 
+	0x40, 0x90, 0xe4, 0x00, 0x04, 0x50, 0x91, 0xe4, 0x05, 0x40, 0x34, 0xe0, 0x00, 0x04, 0x50, 0x00, 
+	0x15, 0x06, 0xc0, 0x8c, 0x11, 0x38, 0x86, 0x60, 0x0c, 0xb7, 0x0b, 0xbb, 0x0c, 0xb3, 0xca, 0x00, 
+	0x40, 0x04, 0xd3, 0xe5, 0x04, 0xc0, 0x8c, 0x00, 0x43, 0xc3, 0xe4, 0x28, 0xf0, 0x0f, 0x33, 0xeb, 
+	0x32, 0x01, 0xef, 0x0c, 0xc0, 0x00, 0x22, 0x00, 0xc4, 0x22, 0x2f, 0xa0, 0xe3, 0xd0, 0x00, 0x53, 
+	0xd4, 0xa0, 0x00, 0x03, 0xb2, 0x04, 0x5f, 0xac, 0x04, 0x8a, 0xe5, 0xb0, 0xa1, 0x00, 0x03, 0xa6, 
+	0x4b, 0x4f, 0xd8, 0x01, 0x9f, 0x05, 0x00, 0x03, 0x36, 0x15, 0xd8, 0x01, 0x73, 0x1d, 0x2f, 0xd4, 
+	0x00, 0x0f, 0x00, 0x03, 0x15, 0x5c, 0xd4, 0x40, 0x0f, 0xd0, 0x00, 0x07, 0x5b, 0x7b, 0x02, 0x33, 
+	0x1a, 0xc4, 0x82, 0x01, 0x97, 0x34, 0x01, 0x81, 0xe5, 0x3c, 0x00, 0x03, 0x44, 0xaa, 0x00, 0x03, 
+	0x48, 0x00, 0x03, 0x4c, 0x00, 0x03, 0x50, 0x00, 0x03, 0x54, 0xaa, 0x00, 0x03, 0x58, 0x00, 0x03, 
+	0xa0, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xa8, 0xad, 0x00, 0x03, 0xac, 0x00, 0x03, 0xc0, 0x00, 0x03, 
+	0x19, 0xab, 0x8c, 0x40, 0x3b, 0x6d, 0x88, 0x00, 0x07, 0x10, 0x3f, 0x84, 0x00, 0x07, 0x10, 0x43, 
+	0x80, 0x00, 0x07, 0xb6, 0x10, 0x47, 0x7c, 0x00, 0x07, 0x10, 0x4b, 0x78, 0x00, 0x07, 0x10, 0x4f, 
+	0x74, 0xdb, 0x00, 0x07, 0x10, 0x53, 0x70, 0x00, 0x07, 0x10, 0x57, 0x6c, 0x00, 0x07, 0x10, 0x5b, 
+	0x6d, 0x68, 0x00, 0x07, 0x10, 0x5f, 0x64, 0x00, 0x07, 0x10, 0x63, 0x60, 0x00, 0x07, 0xbf, 0x10, 
+	0x67, 0x5c, 0x00, 0x07, 0x10, 0x6b, 0x2b, 0x53, 0x05, 0x8f, 0x10, 0xef, 0x55, 0xc3, 0xb5, 0x11, 
+	0x07, 0xa8, 0x00, 0xf7, 0x10, 0x0b, 0xaf, 0x40, 0x17, 0xb0, 0x40, 0x07, 0x6e, 0xb1, 0x40, 0x07, 
+	0x18, 0x2f, 0x1c, 0x07, 0xef, 0x04, 0xa7, 0x24, 0x93, 0x6a, 0x17, 0xfa, 0xff, 0x0a, 0x10, 0x17, 
+	0xff, 0x00, 0x0b, 0x30, 0x4f, 0x35, 0xe7, 0xd5, 0x10, 0x1b, 0x10, 0x07, 0xab, 0x40, 0x0f, 0xaf, 
+	0x40, 0x07, 0xb0, 0x40, 0x07, 0x75, 0xb1, 0x40, 0x07, 0x18, 0x87, 0x10, 0x07, 0xf5, 0x40, 0x07, 
+	0xf4, 0x40, 0x07, 0x54, 0xf7, 0x40, 0x07, 0xf6, 0x40, 0x07, 0x2f, 0x05, 0xe7, 0x01, 0x00, 0x35, 
+	0x40, 0xe2, 0x30, 0x2b, 0x30, 0x8b, 0x0f, 0x02, 0xdb, 0xf4, 0x40, 0x0b, 0x6a, 0xe0, 0x00, 0x0b, 
+	0x12, 0xfb, 0xf7, 0x80, 0x1b, 0xf6, 0x40, 0x0b, 0xf1, 0xa1, 0x46, 0x57, 0xf1, 0x06, 0x57, 0x7f, 
+	0x10, 0xc1, 0xe3, 0x01, 0xfa, 0x0c, 0xe2, 0x01, 0x00, 0x80, 0x00, 0x17, 0x36, 0x4b, 0xbc, 0x42, 
+	0x83, 0x07, 0xbb, 0x70, 0x00, 0x08, 0x2c, 0x40, 0x07, 0xc7, 0x00, 0x0b, 0x42, 0xec, 0x00, 0x03, 
+	0xa0, 0x3d, 0x00, 0x03, 0x10, 0x0f, 0x90, 0x45, 0x44, 0x00, 0x0b, 0x6c, 0x00, 0x08, 0x18, 0x2f, 
+	0x68, 0x00, 0x07, 0x54, 0x70, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x8c, 0x00, 0x03, 0x30, 0x43, 0x83, 
+	0x06, 0x0b, 0x6b, 0x00, 0x08, 0x5c, 0x66, 0x00, 0x03, 0x07, 0xff, 0x57, 0x64, 0x00, 0x07, 0x84, 
+	0x00, 0x07, 0x50, 0x00, 0x3f, 0x17, 0x27, 0x15, 0xb7, 0x34, 0x94, 0x02, 0x0d, 0xdf, 0x02, 0x23, 
+	0xf1, 0x01, 0x0f, 0xb4, 0x08, 0x4d, 0xc1, 0x21, 0x17, 0xb0, 0x06, 0x05, 0xc3, 0x00, 0x03, 0xb4, 
+	0x00, 0x03, 0x53, 0xb8, 0x00, 0x03, 0xbc, 0x00, 0x03, 0xb0, 0x07, 0x00, 0x13, 0x00, 0x03, 0x56, 
+	0xb4, 0x00, 0x03, 0xb8, 0x00, 0x03, 0xbc, 0x00, 0x03, 0x10, 0xbb, 0x01, 0x4d, 0xc3, 0x0f, 0x33, 
+	0x00, 0xcc, 0x20, 0xc7, 0x10, 0x0b, 0x62, 0x00, 0x0b, 0x6a, 0x74, 0x0d, 0x3b, 0x50, 0x0f, 0x63, 
+	0x80, 0x1b, 0x64, 0x00, 0x0b, 0x75, 0xaa, 0x80, 0x1b, 0x65, 0x00, 0x0f, 0x76, 0x80, 0x0f, 0x68, 
+	0x00, 0x0f, 0x77, 0xaa, 0x80, 0x0f, 0x69, 0x80, 0x3b, 0x6c, 0x00, 0x0b, 0x78, 0x80, 0x1b, 0x6d, 
+	0xaa, 0x00, 0x0f, 0x79, 0x80, 0x0f, 0x80, 0x01, 0x33, 0xa0, 0x01, 0x33, 0x70, 0xaa, 0x80, 0x33, 
+	0x72, 0x00, 0x0b, 0x7a, 0x80, 0x23, 0x60, 0x00, 0x23, 0x73, 0xaa, 0x80, 0x1f, 0x74, 0x00, 0x0b, 
+	0x7b, 0x80, 0x1f, 0x75, 0x00, 0x0f, 0x7c, 0xd0, 0x50, 0x0f, 0x01, 0x1b, 0x60, 0x0e, 0xbf, 0x02, 
+	0x00, 0xc1, 0xe7, 0xaa, 0x50, 0x1f, 0x78, 0x80, 0x3b, 0x79, 0x80, 0x0b, 0x7c, 0x80, 0x0b, 0x7d, 
+	0xab, 0x80, 0x0b, 0x80, 0x80, 0x0b, 0x81, 0x80, 0x0b, 0x84, 0x50, 0x0b, 0x10, 0x63, 0x2a, 0x00, 
+	0xd1, 0x60, 0x0b, 0x62, 0x80, 0x0b, 0x63, 0x80, 0x0b, 0x64, 0xaa, 0x80, 0x0b, 0x65, 0x80, 0x0b, 
+	0x68, 0x80, 0x0b, 0x69, 0x80, 0x0b, 0x6c, 0xae, 0x80, 0x0b, 0x6d, 0x80, 0x0b, 0x70, 0x00, 0x0b, 
+	0x11, 0x27, 0x50, 0x0f, 0x72, 0xba, 0x80, 0x1b, 0x73, 0x00, 0x0b, 0x11, 0x1f, 0x50, 0x0f, 0x74, 
+	0x80, 0x1b, 0x75, 0xda, 0x80, 0x0b, 0x31, 0x13, 0xd1, 0x31, 0x13, 0x00, 0x0f, 0x78, 0x80, 0x1b, 
+	0x79, 0xaa, 0x80, 0x0b, 0x7c, 0x80, 0x0b, 0x7d, 0x80, 0x0b, 0x80, 0x80, 0x0b, 0x81, 0xa5, 0x80, 
+	0x0b, 0x84, 0x00, 0x0b, 0x70, 0x20, 0x10, 0x9f, 0x12, 0x0c, 0x43, 0x20, 0xc0, 0x03, 0x10, 0x17, 
+	0x77, 0xf3, 0x02, 0x00, 0xe8, 0x02, 0x05, 0x9a, 0xe5, 0xb4, 0x14, 0x9a, 0x0d, 0xd7, 0x80, 0x56, 
+	0xe2, 0x0b, 0x87, 0xe1, 0x0c, 0x83, 0xaa, 0x1c, 0x6b, 0x1f, 0xfb, 0x78, 0x0a, 0xf6, 0x9f, 0x05, 
+	0x01, 0x0f, 0x47, 0x02, 0x0d, 0x8b, 0x02, 0x00, 0x00, 0x90, 0xe1, 0x68, 0xf6, 0x9f, 0x15, 0x0b, 
+	0x82, 0x0b, 0xab, 0x01, 0x58, 0xa0, 0x03, 0x1b, 0x10, 0x07, 0x68, 0x10, 0xa0, 0x03, 0x2b, 0x10, 
+	0x07, 0x78, 0xa0, 0x03, 0x4c, 0x5d, 0xf6, 0x04, 0x9f, 0x06, 0x15, 0x0f, 0x0d, 0xd3, 0x47, 0xbf, 
+	0x38, 0x40, 0x0f, 0xaa, 0x12, 0xf3, 0xd8, 0x05, 0x5b, 0xdc, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe4, 
+	0xa8, 0x02, 0x03, 0xe7, 0x00, 0x03, 0xe8, 0x00, 0x0b, 0x00, 0x00, 0xe0, 0x2a, 0xe3, 0xd4, 0x00, 
+	0x0b, 0x00, 0x05, 0xf7, 0x0c, 0x00, 0x2f, 0x01, 0x00, 0x2a, 0xa0, 0xe3, 0x51, 0xf8, 0xff, 0xeb, 
+	0x04, 0xa0, 0x40, 0x0b, 0x4e, 0x00, 0x0b, 0xfc, 0x05, 0x9f, 0xe5, 0x5a, 0x0a, 0x2f, 0xa0, 0xe3, 
+	0x4b, 0x00, 0x0b, 0xe6, 0x04, 0x07, 0x02, 0xe8, 0x04, 0x7b, 0x1d, 0xf7, 0x10, 0x33, 0xe4, 0x00, 
+	0x1b, 0x02, 0x2b, 0xa0, 0x2d, 0xe3, 0x44, 0x00, 0x1b, 0xdc, 0x10, 0x0b, 0x00, 0x33, 0x41, 0x00, 
+	0x0b, 0x30, 0x2b, 0x15, 0x00, 0x27, 0x03, 0xeb, 0x2b, 0x15, 0xca, 0xe5, 0x08, 0xc4, 0x08, 0x00, 
+	0xeb, 0x1c, 0xb7, 0xc0, 0xf5, 0x9f, 0x5d, 0xe5, 0x14, 0xa7, 0xec, 0x10, 0x77, 0x16, 0xff, 0x00, 
+	0x2f, 0x70, 0x06, 0xaf, 0x68, 0x35, 0x00, 0x2f, 0x18, 0x3f, 0x30, 0x01, 0x9f, 0xe1, 0x25, 0xda, 
+	0x28, 0xe5, 0xf0, 0x00, 0x3b, 0x10, 0x00, 0x63, 0x02, 0x10, 0x81, 0xac, 0x0b, 0x5b, 0x50, 0x09, 
+	0xc7, 0x81, 0x07, 0xbe, 0x04, 0xef, 0x10, 0xa0, 0x32, 0x03, 0x30, 0x00, 0x07, 0x00, 0x0c, 0x1a, 
+	0x07, 0x1d, 0x8b, 0x10, 0x20, 0xc1, 0x13, 0x10, 0x13, 0x01, 0x20, 0x82, 0x02, 0xf0, 0xa0, 0x00, 
+	0x67, 0xe2, 0x00, 0x37, 0x01, 0x20, 0x02, 0xe0, 0xe1, 0x0a, 0x25, 0xca, 0xe5, 0x05, 0x0a, 0x73, 
+	0xd0, 0x0a, 0x73, 0x02, 0x14, 0x10, 0xd1, 0xe7, 0x10, 0x33, 0xc0, 0x04, 0x9b, 0x0f, 0x00, 0x58, 
+	0x80, 0x0c, 0x90, 0x40, 0x0b, 0xbc, 0x1f, 0x73, 0x10, 0xe3, 0x21, 0x0b, 0x02, 0x80, 0x01, 0x0f, 
+	0x06, 0xe3, 0x20, 0x00, 0x0b, 0x04, 0x8f, 0x03, 0x01, 0x0f, 0x00, 0x20, 0xe2, 0xd4, 0x00, 0x43, 
+	0x11, 0x0f, 0x05, 0x30, 0x00, 0x10, 0xe2, 0x30, 0x00, 0x1b, 0x35, 0x00, 0x2b, 0xf5, 0x10, 0x3f, 
+	0x29, 0x67, 0x0a, 0x1b, 0x10, 0x07, 0x30, 0x00, 0x7b, 0x2a, 0x00, 0x83, 0x82, 0x10, 0x37, 0xf0, 
+	0xc4, 0x9f, 0xe5, 0xd8, 0x01, 0xc3, 0xdc, 0x20, 0x15, 0x9a, 0x0a, 0xdb, 0x9c, 0xe7, 0x01, 0x20, 
+	0xc2, 0x41, 0x11, 0x00, 0x8f, 0x01, 0x00, 0x20, 0x8c, 0xe7, 0x11, 0xc3, 0x82, 0x0f, 0xc7, 0x0a, 
+	0x01, 0x10, 0x91, 0xe0, 0x00, 0xc3, 0x22, 0x26, 0xdc, 0x15, 0x27, 0x37, 0x31, 0x04, 0x01, 0xeb, 
+	0x11, 0x8f, 0x0f, 0xeb, 0x4e, 0x0b, 0x11, 0x0b, 0x10, 0x1b, 0x02, 0x01, 0x0b, 0xe0, 0x00, 0xbb, 
+	0x15, 0x13, 0x59, 0xe0, 0x01, 0x07, 0x02, 0x0e, 0x5f, 0x0d, 0x7a, 0x1a, 0xd4, 0x00, 0x0b, 0x77, 
+	0x10, 0x02, 0x37, 0x1e, 0x9f, 0x10, 0x33, 0x0a, 0x00, 0x07, 0x11, 0x1f, 0x07, 0x38, 0x00, 0xba, 
+	0x00, 0x20, 0xdc, 0xe5, 0x07, 0x10, 0x02, 0x18, 0xe2, 0x01, 0x12, 0x02, 0x67, 0x1a, 0xbb, 0x00, 
+	0x00, 0xca, 0x5e, 0x15, 0x00, 0x73, 0x03, 0x80, 0x4b, 0x1b, 0x23, 0xb2, 0x03, 0x70, 0x63, 0x03, 
+	0xef, 0x00, 0x63, 0x11, 0x0f, 0x0b, 0xb7, 0xe3, 0x10, 0x17, 0x10, 0x1f, 0x50, 0x2b, 0x10, 0x23, 
+	0xe8, 0x90, 0x17, 0x5b, 0x57, 0x90, 0x47, 0xf0, 0x00, 0x03, 0xb3, 0x0f, 0x4f, 0x82, 0x02, 0xbb, 
+	0x8a, 0xe5, 0xb4, 0x04, 0x9a, 0x22, 0x53, 0xf8, 0x02, 0x00, 0x02, 0xe2, 0xa0, 0xf0, 0x9f, 0x2c, 
+	0x37, 0x2c, 0x0a, 0x73, 0x00, 0x08, 0x98, 0x00, 0x03, 0xa8, 0x00, 0x03, 0xa0, 0xb4, 0x00, 0x03, 
+	0xb4, 0xf0, 0x03, 0x20, 0x03, 0xb8, 0x00, 0x03, 0x28, 0x74, 0xcd, 0x05, 0xd7, 0xf0, 0x03, 0x08, 
+	0x14, 0x00, 0x1b, 0x10, 0x07, 0x90, 0x00, 0x03, 0x4d, 0xdc, 0x00, 0x03, 0x0c, 0x75, 0x00, 0x13, 
+	0x00, 0x03, 0x78, 0x00, 0x03, 0x4c, 0x88, 0x00, 0x03, 0x90, 0x72, 0xf0, 0x03, 0x50, 0x03, 0x01, 
+	0x00, 0x58, 0xdc, 0x00, 0xe3, 0x00, 0x03, 0xd3, 0x12, 0x37, 0xa0, 0x03, 0xe2, 0x98, 0x40, 0xfb, 
+	0x3c, 0x23, 0x02, 0xab, 0x1c, 0x23, 0x00, 0x2d, 0xe9, 0x28, 0x34, 0x13, 0x17, 0x4f, 0xfc, 0x00, 
+	0xf7, 0xc1, 0xe5, 0x08, 0xad, 0x00, 0x03, 0x10, 0x00, 0x03, 0x18, 0x00, 0x03, 0x10, 0x13, 0x01, 
+	0x00, 0x07, 0x55, 0x09, 0x00, 0x03, 0x11, 0x00, 0x03, 0x19, 0x00, 0x03, 0x06, 0x01, 0xab, 0x92, 
+	0x30, 0x17, 0xc2, 0xe4, 0x5b, 0x17, 0x01, 0x00, 0x0a, 0xfb, 0x20, 0x22, 0x82, 0xe0, 0xf0, 0x1b, 
+	0xff, 0x1a, 0x3b, 0x0c, 0x07, 0xd8, 0x12, 0x22, 0x9f, 0xe5, 0x0b, 0x4b, 0xea, 0xd4, 0x00, 0x07, 
+	0xe1, 0xab, 0x00, 0x07, 0xc0, 0x00, 0x07, 0x12, 0x00, 0x7b, 0xdf, 0x00, 0x0b, 0x2d, 0x4b, 0xa7, 
+	0x03, 0xab, 0xb0, 0x00, 0x13, 0x8c, 0x32, 0x0f, 0xcb, 0x0c, 0x0f, 0x20, 0x43, 0x41, 0x10, 0x00, 
+	0x03, 0x04, 0x80, 0xe1, 0xfe, 0x0c, 0x07, 0x57, 0x00, 0x11, 0x83, 0xe0, 0x04, 0x00, 0x91, 0xe4, 
+	0x04, 0x30, 0x00, 0x82, 0x00, 0x03, 0x30, 0x07, 0x01, 0x40, 0x54, 0xe2, 0x40, 0xf4, 0x00, 0x5f, 
+	0xb0, 0x02, 0x52, 0xe1, 0xb8, 0x01, 0x11, 0x42, 0xe1, 0xb0, 0x00, 0x03, 0xb8, 0x00, 0x42, 0x01, 
+	0xaf, 0x18, 0xfc, 0xe5, 0x40, 0x02, 0x23, 0x02, 0x53, 0x13, 0xe3, 0x15, 0x14, 0xca, 0x15, 0x80, 
+	0x00, 0x0b, 0x3f, 0x0d, 0x14, 0x41, 0x00, 0x01, 0x00, 0x1b, 0x18, 0xfa, 0xff, 0xeb, 0x18, 0x03, 
+	0x67, 0x29, 0x24, 0x12, 0x33, 0xdb, 0xf8, 0x00, 0x77, 0x14, 0x70, 0x03, 0xc3, 0x21, 0x34, 0xda, 
+	0x00, 0xf7, 0x13, 0xe3, 0x38, 0x42, 0x0a, 0xd3, 0x10, 0x52, 0x9f, 0x05, 0x00, 0x03, 0x15, 0x01, 
+	0x00, 0xd5, 0x40, 0xe4, 0x10, 0x3b, 0x10, 0x00, 0x13, 0x03, 0x01, 0x0c, 0x01, 0x80, 0x02, 0x00, 
+	0xc2, 0x84, 0xe0, 0x10, 0x19, 0xeb, 0x20, 0x00, 0x9c, 0x00, 0x7f, 0x81, 0xe4, 0x04, 0x60, 0x56, 
+	0x88, 0x30, 0xfb, 0x70, 0x57, 0xe2, 0x00, 0x43, 0x03, 0x0c, 0x50, 0x19, 0x85, 0x02, 0x10, 0x09, 
+	0xef, 0x0b, 0x5b, 0xca, 0xf8, 0x00, 0x63, 0xe8, 0x5c, 0x43, 0x11, 0x7f, 0x17, 0xef, 0xe7, 0x23, 
+	0x9b, 0xa0, 0xe3, 0x12, 0x0f, 0x10, 0x81, 0xe1, 0xe7, 0x03, 0xab, 0x13, 0xbf, 0x13, 0xbb, 0x04, 
+	0xfb, 0x02, 0x15, 0xff, 0x10, 0x81, 0x12, 0xec, 0x02, 0xff, 0xc4, 0x8b, 0x19, 0xcf, 0x16, 0x81, 
+	0xe0, 0x11, 0x93, 0xd6, 0x0c, 0x5f, 0x11, 0x57, 0x7c, 0x2c, 0x1d, 0x0b, 0x4c, 0x77, 0x10, 0x43, 
+	0x1b, 0x07, 0x10, 0x3f, 0x03, 0x00, 0x64, 0x11, 0x20, 0xe3, 0x00, 0x37, 0x15, 0x90, 0x00, 0x37, 
+	0x22, 0x2d, 0x15, 0xa0, 0xe3, 0xca, 0x00, 0x33, 0x39, 0x40, 0x2f, 0x44, 0x00, 0x13, 0x75, 0xc5, 
+	0x01, 0x5f, 0xd1, 0x0f, 0x01, 0x0b, 0xe2, 0x11, 0x6f, 0x5a, 0x01, 0xab, 0x41, 0x20, 0x0b, 0x87, 
+	0x90, 0x31, 0x22, 0xe0, 0x1c, 0x00, 0x07, 0x44, 0x5a, 0x21, 0x77, 0xd2, 0xe4, 0x20, 0x0b, 0x5f, 
+	0x01, 0x10, 0x16, 0xc3, 0xe4, 0x20, 0x03, 0x4f, 0xfc, 0x18, 0xab, 0x10, 0x0b, 0x11, 0x8d, 0x70, 
+	0x0b, 0xfc, 0x10, 0xc0, 0x20, 0x07, 0x11, 0x7f, 0xf2, 0x00, 0xff, 0xee, 0x11, 0x4f, 0x10, 0x63, 
+	0x12, 0x63, 0xe3, 0x42, 0x5b, 0x10, 0x03, 0x11, 0x5b, 0x80, 0x90, 0x01, 0x5b, 0xc8, 0x60, 0x00, 
+	0xd3, 0x66, 0x86, 0xe0, 0xe8, 0x41, 0x50, 0x00, 0x07, 0x56, 0x85, 0xe0, 0xe8, 0x40, 0x12, 0x6b, 
+	0x40, 0xd5, 0x02, 0x1f, 0xd5, 0xe4, 0x0e, 0x20, 0xd5, 0xe5, 0x00, 0x0f, 0x30, 0xd5, 0xe5, 0x00, 
+	0x01, 0x94, 0xe7, 0x00, 0x01, 0x11, 0x94, 0xe7, 0x02, 0x21, 0x94, 0xe7, 0x04, 0x03, 0x31, 0x94, 
+	0xe7, 0x81, 0x07, 0xe7, 0x02, 0x01, 0x10, 0x80, 0xe1, 0x83, 0x00, 0x03, 0x04, 0x00, 0x86, 0xe4, 
+	0x04, 0x1f, 0x00, 0x16, 0xe3, 0xf1, 0x00, 0x6b, 0x10, 0x50, 0x2e, 0x85, 0xe2, 0x11, 0x6f, 0xee, 
+	0x00, 0x0b, 0x11, 0x63, 0x10, 0x63, 0x0e, 0x0a, 0x7d, 0xa0, 0xe3, 0x98, 0x00, 0x63, 0x98, 0x00, 
+	0x5f, 0xb2, 0x00, 0x00, 0x75, 0xe1, 0xff, 0x10, 0x00, 0xe2, 0x10, 0x80, 0x04, 0xf7, 0x20, 0x27, 
+	0xa0, 0xe1, 0x02, 0x15, 0x81, 0x01, 0xe1, 0x20, 0x25, 0xa0, 0xe1, 0x03, 0x20, 0x04, 0x1f, 0x80, 
+	0x16, 0xd7, 0x16, 0x81, 0xe1, 0xb2, 0x10, 0x66, 0xe1, 0xb1, 0x10, 0x43, 0xf3, 0x22, 0xb7, 0x15, 
+	0xbf, 0xca, 0xe5, 0x2b, 0x25, 0xd3, 0x10, 0x80, 0xe3, 0x2b, 0x00, 0x0b, 0x59, 0x07, 0x00, 0xeb, 
+	0x30, 0xf8, 0x40, 0x31, 0xbf, 0x04, 0x7b, 0x03, 0xc0, 0xcf, 0x02, 0x00, 0x02, 0xc0, 0xbf, 0x02, 
+	0x02, 0xe8, 0xbd, 0x02, 0x80, 0x06, 0xac, 0x00, 0x06, 0x00, 0xc2, 0x00, 0x06, 0xbc, 0x66, 0x31, 
+	0x09, 0x63, 0x00, 0x13, 0xc2, 0xdf, 0x00, 0x1b, 0x00, 0x03, 0xd2, 0xb2, 0x00, 0x03, 0xca, 0x00, 
+	0x03, 0x1e, 0xdf, 0x00, 0x58, 0x00, 0x03, 0x5c, 0x10, 0x03, 0x02, 0x20, 0x00, 0x27, 0x80, 0xe7, 
+	0x00, 0x06, 0x28, 0x7c, 0x79, 0x0f, 0xc3, 0xef, 0x00, 0x0b, 0xee, 0x00, 0x06, 0x00, 0xaf, 0xcb, 
+	0x46, 0x79, 0xaa, 0x6d, 0x22, 0x6f, 0x0c, 0x5f, 0x08, 0x29, 0x55, 0xf0, 0x0b, 0xf0, 0x0b, 0xff, 
+	0xff, 0x01, 0xff, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x0d, 0x97, 0xf0, 0xf0, 0x0b, 0xf0, 0x0b, 
+	0xf0, 0x0b, 0x30, 0x0b, 0xef, 0xef, 0xff, 0x5a, 0x04, 0x8c, 0xe7, 0x18, 0x4a, 0x9c, 0x10, 0x17, 
+	0xef, 0xef, 0x02, 0xef, 0x5a, 0x63, 0xad, 0x10, 0x18, 0xc0, 0x23, 0xe7, 0x00, 0xef, 0xd6, 0xc6, 
+	0xde, 0x8c, 0x6b, 0x84, 0x29, 0xe0, 0x30, 0x17, 0x90, 0x23, 0x70, 0x3b, 0xff, 0xa0, 0x67, 0xd7, 
+	0x67, 0x00, 0x8c, 0x55, 0x20, 0x46, 0x15, 0x07, 0xff, 0xff, 0x01, 0xad, 0x80, 0x80, 0xb7, 0x25, 
+	0x29, 0x59, 0x10, 0x17, 0x30, 0xb0, 0x7f, 0xf0, 0x5f, 0x00, 0x0b, 0xdf, 0xdf, 0x7f, 0x00, 0x08, 
+	0x5f, 0xaf, 0x1f, 0x3f, 0x0f, 0xcf, 0x00, 0xff, 0xdf, 0x03, 0x00, 0x80, 0xff, 0xff, 0x00, 0x80, 
+	0x08, 0x9f, 0x10, 0x0b, 0x06, 0xff, 0x00, 0x00, 0x3f, 0x37, 0x1e, 0x6f, 0x00, 0x5f, 0xc0, 0x10, 
+	0xc0, 0xc0, 0x80, 0x30, 0x17, 0xff, 0xff, 0x9c, 0xb5, 0x10, 0xff, 0x31, 0x94, 0x40, 0x17, 0xf7, 
+	0xce, 0x73, 0x8c, 0x00, 0x4a, 0x08, 0x21, 0x21, 0x9c, 0xff, 0xff, 0xde, 0x00, 0xef, 0xc6, 0x73, 
+	0xff, 0x63, 0x52, 0x00, 0x00, 0x40, 0x29, 0x00, 0x17, 0xe7, 0xa5, 0xa5, 0x7b, 0x29, 0x29, 0x41, 
+	0x42, 0x30, 0x23, 0xef, 0x75, 0x29, 0x6b, 0xbd, 0xf0, 0x2f, 0xc0, 0xf0, 0x2f, 0x00, 0x2f, 0xa5, 
+	0xd6, 0xff, 0xe7, 0xef, 0xff, 0x04, 0xde, 0x8c, 0x10, 0x5a, 0x10, 0xb0, 0x2f, 0xc6, 0xc6, 0x14, 
+	0xff, 0x6b, 0x6b, 0x00, 0x92, 0x63, 0x30, 0xfb, 0x42, 0xef, 0x80, 0x40, 0x5f, 0xf7, 0xef, 0xc8, 
+	0x90, 0x88, 0x84, 0x50, 0x20, 0x44, 0x42, 0x20, 0x2f, 0xa5, 0xa5, 0xff, 0x52, 0x52, 0xa0, 0x00, 
+	0x6b, 0xa5, 0x20, 0x0b, 0xc6, 0x52, 0x52, 0x8c, 0x00, 0x20, 0x00, 0x5a, 0x00, 0x0b, 0xad, 0xb5, 
+	0xbd, 0x5a, 0x6b, 0x08, 0x7b, 0x08, 0x21, 0x42, 0x10, 0x17, 0xad, 0xbd, 0x52, 0x07, 0x5a, 0x7b, 
+	0x00, 0x10, 0x39, 0xf0, 0x0b, 0x60, 0x0b, 0x60, 0x2f, 0x00, 0xef, 0xf7, 0xff, 0xce, 0xb5, 0xad, 
+	0xc6, 0x21, 0x63, 0x29, 0x03, 0xb4, 0x00, 0x17, 0x94, 0xce, 0xf7, 0x00, 0x1f, 0x2f, 0xa6, 0x98, 
+	0x00, 0x24, 0x84, 0x5a, 0x00, 0x15, 0x11, 0xbb, 0xef, 0xad, 0xa5, 0x00, 0x9c, 0x6b, 0x5a, 0x5a, 
+	0x42, 0x10, 0x08, 0xd6, 0x00, 0xd6, 0xe7, 0x8c, 0xa5, 0xb5, 0x42, 0x52, 0x6b, 0x10, 0x00, 0x10, 
+	0x18, 0x20, 0x83, 0xd6, 0x52, 0x52, 0xad, 0x10, 0x00, 0x00, 0x84, 0x10, 0x2f, 0xe7, 0x84, 0xff, 
+	0x52, 0x20, 0x42, 0x5a, 0x41, 0x13, 0xce, 0xf7, 0xde, 0x9c, 0xf7, 0x24, 0xb5, 0x6b, 0x10, 0x17, 
+	0xff, 0x66, 0x00, 0x97, 0x00, 0x10, 0x47, 0x52, 0x21, 0xeb, 0xd6, 0x55, 0x55, 0xa0, 0x2f, 0x00, 
+	0xc0, 0x10, 0x0b, 0x01, 0xce, 0x8c, 0xf7, 0x9c, 0x5a, 0x84, 0x52, 0x00, 0x0b, 0x00, 0x83, 0xff, 
+	0xa5, 0x3e, 0x73, 0x42, 0x00, 0x33, 0x00, 0x09, 0x00, 0xcc, 0xcc, 0xff, 0x77, 0x78, 0xff, 0x00, 
+	0x23, 0x35, 0xc1, 0x05, 0x0a, 0x5a, 0xff, 0xbd, 0x00, 0xc4, 0xf1, 0x4d, 0x60, 0x9f, 0x12, 0x29, 
+	0x20, 0x80, 0xb2, 0x33, 0xe2, 0xff, 0xd1, 0xa9, 0xff, 0x89, 0x51, 0x00, 0xa2, 0x48, 0x04, 0x25, 
+	0x03, 0xff, 0xb4, 0xb4, 0x18, 0xff, 0x47, 0x47, 0x11, 0xc5, 0x00, 0x23, 0xf2, 0xb0, 0xd6, 0x00, 
+	0xc3, 0x4d, 0xa3, 0x5b, 0x11, 0x6a, 0x00, 0x00, 0x00, 0xf7, 0xff, 0x63, 0xc6, 0xce, 0x42, 0x73, 
+	0x7b, 0x40, 0x21, 0x00, 0x17, 0xf3, 0xff, 0x33, 0xc1, 0xce, 0x22, 0x1c, 0x6f, 0x7b, 0x11, 0xf0, 
+	0x0b, 0xf0, 0x0b, 0x00, 0x0b, 0xf8, 0xe8, 0x00, 0xc8, 0xd8, 0x90, 0x48, 0xa8, 0x28, 0x20, 0x30, 
+	0x30, 0x18, 0x50, 0xf0, 0x0b, 0xf0, 0x0b, 0xd8, 0xd8, 0xc0, 0xc8, 0x0b, 0xb0, 0x70, 0xb0, 0x50, 
+	0x03, 0xb7, 0x00, 0xf0, 0x0b, 0xf0, 0x0b, 0x00, 0xf8, 0xc0, 0xf8, 0xe8, 0x98, 0x50, 0x98, 0x38, 
+	0x0c, 0x60, 0x38, 0x38, 0x98, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xf8, 0x04, 0xa8, 0xc0, 0x80, 0x48, 
+	0xf8, 0x09, 0x8a, 0x18, 0x00, 0xc0, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xd8, 0xb0, 0x78, 0xc0, 0x78, 
+	0x03, 0x68, 0x88, 0x40, 0x58, 0x38, 0x20, 0xf0, 0x0b, 0xf0, 0x0b, 0x01, 0xd8, 0xe8, 0xf8, 0xe0, 
+	0x88, 0x50, 0xa8, 0x00, 0x99, 0x38, 0x40, 0x10, 0xf0, 0x0b, 0xf0, 0x0b, 0x00, 0x64, 0x00, 0xa0, 
+	0xe8, 0x2c, 0x78, 0x78, 0x00, 0x74, 0x58, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xe8, 0x00, 0xe0, 0xf8, 
+	0xb8, 0x88, 0x80, 0x40, 0x00, 0x30, 0xe0, 0x00, 0x9b, 0xf0, 0x0b, 0xe0, 0x0b, 0xf0, 0xc8, 0xa0, 
+	0xc0, 0x88, 0x1c, 0x48, 0x28, 0x78, 0x11, 0xd3, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xf8, 0x04, 0xf8, 
+	0xf8, 0xe8, 0x50, 0xf8, 0x0a, 0x2e, 0x00, 0x58, 0xe0, 0xf0, 0x0b, 0xf0, 0x0b, 0x11, 0x5b, 0x88, 
+	0x88, 0x78, 0x30, 0xe8, 0x38, 0x28, 0x28, 0x21, 0x67, 0xf0, 0x0b, 0xc0, 0x0b, 0xf8, 0xa0, 0x00, 
+	0x3c, 0xf8, 0x00, 0x00, 0x3b, 0x00, 0xd4, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xc8, 0x00, 0x80, 0x90, 
+	0xb0, 0xe0, 0x28, 0x10, 0x60, 0x10, 0x34, 0x08, 0x10, 0xf0, 0x0b, 0xf0, 0x0b, 0xd0, 0x00, 0x9b, 
+	0x90, 0x50, 0x1c, 0xa0, 0x00, 0x00, 0x04, 0xbc, 0xf0, 0x0b, 0xf0, 0x0b, 0x68, 0xb8, 0x01, 0x38, 
+	0xe0, 0x50, 0x40, 0xe0, 0xb8, 0x80, 0x00, 0x0c, 0xe0, 0xf0, 0x0b, 0xf0, 0x0b, 0x00, 0x3a, 0xb8, 
+	0xb8, 0xb8, 0x70, 0x70, 0x70, 0x70, 0x31, 0x2b, 0xf0, 0x0b, 0xd0, 0x0b, 0xd0, 0x98, 0x70, 0xc0, 
+	0x01, 0xc0, 0xf8, 0x60, 0x28, 0x30, 0x48, 0x60, 0xf0, 0x0b, 0xc8, 0xf0, 0x0b, 0x02, 0xdb, 0xe0, 
+	0x80, 0x0c, 0x30, 0x00, 0x00, 0x10, 0x60, 0x10, 0xf0, 0x0b, 0xf0, 0x0b, 0xe0, 0xa8, 0xc8, 0xf8, 
+	0xf8, 0x01, 0x78, 0x00, 0xb8, 0xf8, 0x20, 0x20, 0x58, 0xf0, 0x0b, 0x80, 0xf0, 0x0b, 0xf0, 0xf8, 
+	0xb8, 0xe0, 0xa8, 0x78, 0x08, 0x70, 0xc8, 0x21, 0xf7, 0xf0, 0x0b, 0xe0, 0x0b, 0xf8, 0xf8, 0xc0, 
+	0xe0, 0x00, 0xb0, 0x68, 0xb0, 0x78, 0x20, 0x50, 0x48, 0x70, 0xc0, 0xf0, 0x0b, 0xf0, 0x0b, 0x78, 
+	0x78, 0xc8, 0xf8, 0x68, 0xf8, 0x03, 0xf8, 0xd0, 0x00, 0x40, 0x40, 0x40, 0xf0, 0x0b, 0xf0, 0x0b, 
+	0x20, 0x60, 0xd8, 0x01, 0xee, 0xf8, 0xc8, 0x30, 0x38, 0x38, 0x30, 0x00, 0x00, 0xf0, 0x0b, 0xf0, 
+	0x0b, 0xe0, 0xf8, 0xa0, 0x78, 0x01, 0xc8, 0x38, 0x48, 0x88, 0x18, 0x08, 0x18, 0xf0, 0x0b, 0x81, 
+	0xf0, 0x0b, 0x00, 0xf0, 0xa8, 0x68, 0x78, 0xa8, 0x00, 0x6a, 0x0c, 0xd0, 0x00, 0x00, 0x78, 0xf0, 
+	0x0b, 0xf0, 0x0b, 0xf0, 0xe8, 0x00, 0xf0, 0xe8, 0xa0, 0x60, 0x40, 0x78, 0x38, 0x18, 0x30, 0x08, 
+	0x08, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xe0, 0xe0, 0xd8, 0x07, 0xa0, 0xd0, 0x98, 0xa0, 0xe0, 0x0c, 
+	0xc8, 0xf0, 0x0b, 0xf0, 0x0b, 0x80, 0x02, 0x1a, 0x90, 0xc8, 0xc8, 0x48, 0x68, 0x78, 0x08, 0x31, 
+	0x20, 0x48, 0xf0, 0x0b, 0xf0, 0x0b, 0xf8, 0xd8, 0xa8, 0x01, 0x8b, 0x03, 0x78, 0x58, 0x88, 0x00, 
+	0x20, 0x30, 0xf0, 0x0b, 0xf0, 0x0b, 0x00, 0xb8, 0xd0, 0xd0, 0xd8, 0x80, 0xd8, 0x80, 0x00, 0x70, 
+	0xa0, 0x01, 0x2b, 0xf0, 0x0b, 0xf0, 0x0b, 0xb0, 0xe0, 0x18, 0xb8, 0x13, 0x20, 0x58, 0x28, 0x04, 
+	0x87, 0x80, 0x60, 0xf0, 0x0b, 0xf0, 0x0b, 0x80, 0x01, 0x87, 0xb8, 0xc0, 0x58, 0x80, 0x88, 0x40, 
+	0x40, 0x3b, 0x50, 0x28, 0xf0, 0x0b, 0xf0, 0x0b, 0x16, 0x9b, 0x9c, 0x18, 0x2a, 0x37, 0xdf, 0xfd, 
+	0xf0, 0x0b, 0xf0, 0x0b, 0x08, 0x62, 0xf0, 0x0b, 0xf0, 0x0b, 0x30, 0x0b, 0xa5, 0x08, 0x29, 0xf0, 
+	0x37, 0xf5, 0xf0, 0x0b, 0xf0, 0x0b, 0x30, 0x3b, 0xad, 0x63, 0x84, 0x31, 0xf0, 0xf0, 0x0b, 0xf0, 
+	0x0b, 0x20, 0x60, 0x00, 0x01, 0x84, 0x84, 0xff, 0xde, 0xf1, 0x10, 0x14, 0xf0, 0x0b, 0xf0, 0x0b, 
+	0x27, 0xd3, 0xa5, 0x52, 0x52, 0x08, 0xb7, 0xe1, 0x38, 0x6f, 0xf0, 0x0b, 0xd0, 0x0b, 0xff, 0xce, 
+	0x00, 0x9c, 0x60, 0x9b, 0xc6, 0xf0, 0x0b, 0xe0, 0x0b, 0xad, 0xad, 0x84, 0x07, 0x8c, 0xf0, 0x0b, 
+	0xff, 0x19, 0x73, 0x00, 0x94, 0x08, 0xf1, 0xe0, 0x17, 0x63, 0xa5, 0x00, 0xa1, 0xc0, 0x10, 0xa4, 
+	0xc0, 0x0b, 0xff, 0x84, 0x84, 0x94, 0x3a, 0x3a, 0x8f, 0xf0, 0x17, 0x8c, 0x8c, 0xde, 0x29, 0x17, 
+	0xd0, 0x0b, 0x90, 0x2f, 0xf0, 0x17, 0x83, 0xf0, 0x0b, 0x7b, 0xff, 0x31, 0x00, 0x84, 0x50, 0xbf, 
+	0xc0, 0x17, 0x3f, 0x63, 0xc5, 0xf0, 0x0b, 0xf0, 0x23, 0xf0, 0x9b, 0xf0, 0x0b, 0xf0, 0x3b, 0xf0, 
+	0xbf, 0x80, 0xd0, 0x0b, 0xc5, 0x42, 0xff, 0xd6, 0x00, 0x94, 0x3a, 0x38, 0x00, 0x4a, 0xf1, 0x4f, 
+	0xf1, 0x4f, 0xe0, 0x0b, 0x7b, 0xff, 0x00, 0x3b, 0xb5, 0x73, 0xf0, 0x0b, 0xf1, 0x07, 0x40, 0x0b, 
+	0x52, 0x02, 0xab, 0x50, 0x3b, 0xfe, 0x90, 0x0b, 0xf0, 0x2f, 0xf3, 0x0b, 0xa0, 0x0b, 0xf0, 0x2f, 
+	0xf2, 0xe7, 0x62, 0xe7, 0x63, 0x32, 0x52, 0xd6, 0x40, 0x0a, 0xa0, 0x0b, 0xb5, 0xb5, 0x1a, 0xa5, 
+	0xad, 0x7f, 0x5a, 0x10, 0x84, 0x90, 0x0b, 0xf0, 0x62, 0x30, 0x0b, 0xf1, 0x43, 0xf1, 0x43, 0xc1, 
+	0x4f, 0xff, 0xf0, 0x2f, 0xf0, 0x5c, 0xf2, 0x27, 0xf0, 0x0b, 0xf0, 0x2f, 0xf3, 0xa7, 0x90, 0x0b, 
+	0xf2, 0x1b, 0xff, 0xf0, 0x23, 0x90, 0x0b, 0xf0, 0x77, 0xf2, 0x7b, 0xf2, 0x9f, 0xf0, 0x0b, 0xf1, 
+	0xdf, 0xf0, 0x0b, 0x3f, 0x5a, 0xbd, 0x34, 0x26, 0x24, 0x20, 0xf1, 0xdf, 0xe0, 0x0b, 0xa0, 0x2f, 
+	0xf4, 0xf7, 0xf8, 0xe0, 0x0b, 0x90, 0x2f, 0xf2, 0xcf, 0xf2, 0xc3, 0x80, 0x2f, 0x9c, 0x94, 0xb5, 
+	0x07, 0xff, 0x63, 0x94, 0x73, 0x00, 0x11, 0xeb, 0x80, 0x0b, 0xb1, 0xd3, 0xef, 0x60, 0xef, 0x0d, 
+	0x62, 0x10, 0x0e, 0x52, 0x00, 0x16, 0xa0, 0x0b, 0x30, 0xa8, 0x31, 0x76, 0xaf, 0x91, 0x67, 0x52, 
+	0x05, 0x15, 0x84, 0x00, 0x12, 0x21, 0x10, 0x80, 0x0b, 0xd0, 0x2f, 0xf4, 0xf2, 0xcf, 0xf2, 0xcf, 
+	0x52, 0xc3, 0x50, 0x6d, 0x7b, 0x2d, 0x06, 0xce, 0x63, 0x01, 0xef, 0xef, 0x9c, 0x84, 0x31, 0x5a, 
+	0x5a, 0x0d, 0xc7, 0xff, 0x90, 0x0b, 0xa0, 0xef, 0xf2, 0x1b, 0xf0, 0x0b, 0xa1, 0xdf, 0x30, 0x5c, 
+	0xf2, 0xcf, 0xf2, 0xff, 0xff, 0xe1, 0x7f, 0xf0, 0x2f, 0xf0, 0x5f, 0xf2, 0x87, 0xf0, 0x0b, 0xf5, 
+	0x9f, 0xf0, 0x3b, 0xf2, 0xff, 0xf5, 0xf0, 0x47, 0xf2, 0xb7, 0x30, 0x0b, 0x00, 0x2b, 0x31, 0x00, 
+	0x23, 0x4a, 0xf0, 0x5f, 0xff, 0xf0, 0x5f, 0xd0, 0x53, 0xf1, 0x43, 0xe0, 0x0b, 0x10, 0x06, 0x44, 
+	0x7f, 0xb0, 0x3b, 0xf2, 0x9f, 0xf8, 0xf0, 0x6b, 0xd0, 0xcb, 0xf3, 0x8f, 0xf1, 0x1f, 0x20, 0x2f, 
+	0xf8, 0x4f, 0x2d, 0x00, 0xe9, 0x00, 0xc0, 0xa0, 0xe1, 0xa0, 0xa3, 0x9f, 0x00, 0xe5, 0x12, 0x2d, 
+	0x8a, 0xe2, 0xf8, 0x0b, 0x92, 0x00, 0xe8, 0x0a, 0x02, 0x03, 0xe2, 0x05, 0x12, 0x03, 0x10, 0xe2, 
+	0xa1, 0x1b, 0x00, 0x17, 0x0c, 0x81, 0xe1, 0x24, 0x00, 0x08, 0x80, 0xe1, 0xb2, 0x00, 0xcc, 0xe0, 
+	0x25, 0x2a, 0x08, 0xa0, 0x20, 0x07, 0x26, 0x40, 0x07, 0x27, 0x40, 0x07, 0x2b, 0x80, 0x40, 0x07, 
+	0xc4, 0x04, 0x9a, 0xe5, 0x00, 0x00, 0x49, 0x40, 0xe0, 0x10, 0x0b, 0x04, 0x80, 0x8c, 0xe4, 0xf8, 
+	0x4f, 0x00, 0xbd, 0xe8, 0x10, 0x00, 0xa0, 0xe3, 0x1e, 0xff, 0x28, 0x2f, 0xe1, 0x50, 0x67, 0x38, 
+	0x80, 0x67, 0x01, 0x00, 0xdc, 0x04, 0xe4, 0xa0, 0x30, 0x00, 0xe2, 0x0b, 0x98, 0xe2, 0x80, 0x01, 
+	0x0c, 0xa0, 0xe1, 0x83, 0x3b, 0x80, 0xe1, 0x10, 0x13, 0x21, 0x00, 0x4c, 0x10, 0x4f, 0xdc, 0xe0, 
+	0x00, 0x58, 0x40, 0x07, 0x54, 0x68, 0x40, 0x07, 0x78, 0x40, 0x07, 0xb8, 0x40, 0x07, 0x90, 0xa0, 
+	0x00, 0xe1, 0x04, 0x80, 0x9c, 0xe4, 0xf8, 0x0b, 0x82, 0x50, 0xe8, 0x10, 0x6b, 0x01, 0x80, 0x6b, 
+	0xd0, 0xa2, 0x9f, 0xe5, 0x20, 0x94, 0x84, 0x00, 0x8f, 0x30, 0xa0, 0xe1, 0x80, 0x20, 0x00, 0xa0, 
+	0xe3, 0x00, 0x10, 0xa0, 0xe3, 0x18, 0xf2, 0x0c, 0xff, 0xeb, 0x00, 0x40, 0x00, 0x0b, 0x00, 0x27, 
+	0x04, 0x20, 0x00, 0xa0, 0xe1, 0xb4, 0x02, 0x00, 0xeb, 0x04, 0x00, 0x00, 0xc3, 0xe7, 0x01, 0x40, 
+	0x84, 0xe2, 0x01, 0x0c, 0x00, 0x54, 0xe3, 0xf8, 0xff, 0xff, 0xba, 0x74, 0x05, 0x01, 0xda, 0xe5, 
+	0x11, 0x00, 0xc3, 0xe5, 0x75, 0x00, 0x07, 0x55, 0x13, 0x00, 0x07, 0x76, 0x00, 0x07, 0x14, 0x00, 
+	0x07, 0x77, 0x00, 0x07, 0x55, 0x16, 0x00, 0x07, 0x78, 0x00, 0x07, 0x18, 0x00, 0x07, 0x79, 0x00, 
+	0x07, 0x55, 0x19, 0x00, 0x07, 0x7a, 0x00, 0x07, 0x1b, 0x00, 0x07, 0x7b, 0x00, 0x07, 0x56, 0x1d, 
+	0x00, 0x07, 0x7c, 0x00, 0x07, 0x1e, 0x00, 0x07, 0x20, 0x8f, 0x0c, 0xa0, 0x70, 0x8f, 0x40, 0x80, 
+	0x8f, 0x00, 0x00, 0xd3, 0xe5, 0xd4, 0x08, 0x05, 0xca, 0xe5, 0x02, 0x00, 0x07, 0xb2, 0x04, 0xca, 
+	0x2a, 0xe5, 0x04, 0x00, 0x07, 0xab, 0x00, 0x07, 0x05, 0x00, 0x97, 0x05, 0xaa, 0x00, 0x0b, 0xaf, 
+	0x00, 0x0b, 0x06, 0x00, 0x07, 0xb0, 0x00, 0x07, 0x07, 0xaa, 0x00, 0x07, 0xb1, 0x00, 0x07, 0x0f, 
+	0x00, 0x07, 0xa2, 0x00, 0x07, 0x10, 0xd0, 0x00, 0xbf, 0x00, 0x2f, 0xe7, 0x10, 0xbf, 0x0f, 0xe0, 
+	0xa0, 0xe1, 0x09, 0xec, 0xf1, 0x9f, 0xe5, 0x10, 0xbf, 0x40, 0x00, 0x30, 0xbf, 0x5d, 0x40, 0x00, 
+	0x27, 0xe4, 0x00, 0x27, 0x00, 0xef, 0x20, 0x1f, 0xd0, 0x00, 0x1f, 0x44, 0x41, 0x00, 0x13, 0xcc, 
+	0x11, 0x9f, 0x01, 0x9b, 0xc1, 0xe5, 0xad, 0x10, 0x13, 0xc4, 0x00, 0x13, 0x42, 0x00, 0x13, 0x10, 
+	0x0b, 0xbc, 0x00, 0x0b, 0x55, 0x43, 0x40, 0x0b, 0xb4, 0x00, 0x0b, 0x45, 0x40, 0x0b, 0xac, 0x00, 
+	0x0b, 0x55, 0x47, 0x40, 0x0b, 0xa4, 0x00, 0x0b, 0x48, 0x40, 0x0b, 0x9c, 0x00, 0x0b, 0x55, 0x49, 
+	0x40, 0x0b, 0x94, 0x00, 0x0b, 0x4a, 0x40, 0x0b, 0x8c, 0x00, 0x0b, 0x55, 0x4b, 0x40, 0x0b, 0x84, 
+	0x00, 0x0b, 0x4d, 0x00, 0x0b, 0xf1, 0x00, 0x87, 0x05, 0xf9, 0xee, 0xff, 0xeb, 0x4f, 0x40, 0x17, 
+	0x70, 0x00, 0x17, 0x55, 0x51, 0x40, 0x0b, 0x68, 0x00, 0x0b, 0x52, 0x40, 0x0b, 0x60, 0x00, 0x0b, 
+	0x55, 0x53, 0x40, 0x0b, 0x58, 0x00, 0x0b, 0x54, 0x40, 0x0b, 0x50, 0x00, 0x0b, 0x55, 0x68, 0x40, 
+	0x0b, 0x48, 0x00, 0x0b, 0x6a, 0x40, 0x0b, 0x40, 0x00, 0x0b, 0x54, 0x70, 0x40, 0x0b, 0x38, 0x00, 
+	0x0b, 0x80, 0xc1, 0x13, 0xd8, 0xf0, 0xe6, 0x31, 0x13, 0x51, 0xd3, 0xd2, 0x1b, 0xb4, 0xa0, 0x72, 
+	0x83, 0x12, 0x0b, 0xc4, 0x20, 0x04, 0x8a, 0x01, 0x2f, 0xe0, 0xe3, 0xf0, 0x00, 0x9f, 0x20, 0xe5, 
+	0x30, 0x02, 0x2b, 0x8e, 0xf1, 0xff, 0xeb, 0xe8, 0xad, 0x00, 0x0b, 0x40, 0x00, 0x0b, 0x8b, 0x00, 
+	0x0b, 0x12, 0x3b, 0xdc, 0x00, 0x0f, 0xaa, 0x12, 0x47, 0x87, 0x00, 0x0f, 0xd4, 0x40, 0x0b, 0x84, 
+	0x00, 0x0b, 0xcc, 0xaa, 0x40, 0x0b, 0x81, 0x00, 0x0b, 0xc4, 0x00, 0x0b, 0x84, 0x00, 0x0b, 0x7e, 
+	0x8d, 0x00, 0x0b, 0x84, 0x05, 0x9a, 0x31, 0x53, 0x00, 0x8b, 0x88, 0x40, 0x0b, 0x6c, 0xac, 0x00, 
+	0x0b, 0x10, 0x07, 0xa8, 0x00, 0x07, 0x30, 0x7f, 0x82, 0xe8, 0xd5, 0x21, 0x53, 0x40, 0x17, 0x98, 
+	0x40, 0x07, 0x94, 0x40, 0x07, 0x90, 0x40, 0x07, 0x70, 0x8c, 0x00, 0x07, 0x10, 0xc3, 0x10, 0xbf, 
+	0x68, 0x51, 0x00, 0x03, 0x00, 0x20, 0x40, 0x00, 0x03, 0x70, 0x37, 0x00, 0x03, 0x80, 0x0e, 0xd1, 
+	0x03, 0xcc, 0x4f, 0x00, 0x03, 0x90, 0x38, 0x14, 0x00, 0x03, 0xb4, 0x00, 0x03, 0x54, 0x00, 0x0f, 
+	0xbc, 0x63, 0x10, 0x00, 0x08, 0xfc, 0x00, 0x03, 0x24, 0x64, 0x00, 0x08, 0x05, 0x54, 0x3a, 0x00, 
+	0x03, 0xc0, 0x00, 0x03, 0x6c, 0x00, 0x03, 0x05, 0x68, 0x6c, 0x00, 0x08, 0x70, 0x00, 0x03, 0x7c, 
+	0x00, 0x03, 0x41, 0x8c, 0x00, 0x03, 0x5c, 0x66, 0x00, 0x08, 0x64, 0x00, 0x03, 0x00, 0x50, 0x42, 
+	0x00, 0x03, 0xdc, 0x99, 0x02, 0x02, 0x48, 0x9c, 0x00, 0x03, 0x5c, 0x98, 0x00, 0x07, 0x97, 0x02, 
+	0x02, 0x04, 0xdc, 0x96, 0x02, 0x02, 0x18, 0x00, 0x03, 0xa4, 0x55, 0x10, 0x00, 0x08, 0xac, 0x00, 
+	0x53, 0x9c, 0x46, 0x00, 0x03, 0x04, 0x64, 0x5b, 0x00, 0x08, 0xcc, 0x00, 0x03, 0x90, 0x35, 0x00, 
+	0x00, 0x03, 0x80, 0x47, 0x00, 0x03, 0xa8, 0x32, 0x00, 0x00, 0x03, 0x02, 0xb4, 0x71, 0x46, 0x49, 
+	0x08, 0x00, 0x49, 0x00, 0x09, 0x56, 0x49, 0x00, 0x8e, 0x44, 0x02, 0x02, 0xbc, 0x70, 0x47, 0xc0, 
+	0x46, 0x60, 0x13, 0x5c, 0xa5, 0x70, 0x13, 0x03, 0x20, 0x13, 0x40, 0x00, 0x00, 0x15, 0x5e, 0x10, 
+	0x15, 0x42, 0x03, 0x00, 0x15, 0x01, 0x20, 0x51, 0xe2, 0x00, 0xcf, 0x01, 0x00, 0x36, 0x00, 0x00, 
+	0x3a, 0x01, 0x00, 0x50, 0xe1, 0x00, 0x22, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x11, 0xe1, 0x00, 0x23, 
+	0x00, 0x00, 0x0a, 0x0e, 0x02, 0x11, 0xe3, 0x00, 0x81, 0x11, 0xa0, 0x01, 0x08, 0x30, 0xa0, 0x03, 
+	0x01, 0x01, 0x30, 0xa0, 0x13, 0x01, 0x02, 0x51, 0x03, 0xb3, 0x00, 0x51, 0x31, 0x01, 0x12, 0xa0, 
+	0x31, 0x03, 0x32, 0x00, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x02, 0x01, 0x81, 0x30, 0x13, 0x81, 
+	0x10, 0xa0, 0x31, 0x83, 0x30, 0x30, 0x13, 0x60, 0x00, 0x01, 0x7b, 0x10, 0x4b, 0x01, 0x00, 0x40, 
+	0x20, 0x03, 0x0a, 0x20, 0x82, 0x21, 0xa1, 0x00, 0x0b, 0xa1, 0x00, 0x0b, 0xa3, 0x80, 0x00, 0x0b, 
+	0x21, 0x01, 0x50, 0xe1, 0x21, 0x01, 0x40, 0x1a, 0x20, 0x23, 0x21, 0x00, 0x17, 0x00, 0x0b, 0xa1, 
+	0x00, 0x0b, 0xa3, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x50, 0xe3, 0x23, 0x32, 0xb0, 0x00, 0x11, 0x21, 
+	0x12, 0xa0, 0x11, 0xef, 0xff, 0xff, 0x06, 0x1a, 0x02, 0x00, 0xa0, 0xe1, 0x11, 0x67, 0x02, 0x2f, 
+	0x03, 0xa0, 0x02, 0x1b, 0x13, 0x20, 0x0b, 0x08, 0x51, 0xe3, 0x21, 0x18, 0x02, 0xa0, 0x21, 0x10, 
+	0x20, 0xa0, 0x23, 0x00, 0x63, 0x33, 0x20, 0x01, 0x0c, 0x00, 0x0f, 0x14, 0xa0, 0x21, 0x08, 0x20, 
+	0x08, 0x82, 0x22, 0x10, 0x00, 0x00, 0x0b, 0x12, 0xa0, 0x21, 0x58, 0x04, 0x00, 0x0b, 0x04, 0x00, 
+	0x0b, 0x00, 0x77, 0x82, 0xa1, 0x20, 0x0b, 0x82, 0x90, 0x30, 0x02, 0x30, 0x47, 0x1f, 0x00, 0x03, 
+	0x00, 0x47, 0xa0, 0x00, 0x03, 0x50, 0x00, 0xaf, 0xe0, 0x13, 0x99, 0x01, 0x00, 0x60, 0xea, 0x00, 
+	0xb7, 0x12, 0x97, 0x0a, 0x03, 0x40, 0x2d, 0xe9, 0x00, 0xbc, 0xff, 0xff, 0xeb, 0x06, 0x40, 0xbd, 
+	0xe8, 0x00, 0x92, 0x00, 0x03, 0xe0, 0x03, 0x10, 0x41, 0xe0, 0xd0, 0x10, 0x33, 0x10, 0x1f, 0x43, 
+	0x01, 0x07, 0x01, 0xc0, 0x20, 0xe0, 0x0a, 0x00, 0x10, 0x61, 0x42, 0x11, 0x2b, 0x27, 0x00, 0x0f, 
+	0x00, 0x00, 0x30, 0xb0, 0xe1, 0x00, 0x30, 0x60, 0x42, 0x01, 0x0a, 0x00, 0x53, 0xe1, 0x26, 0x41, 
+	0x2f, 0x28, 0x91, 0x2f, 0x20, 0xa9, 0x01, 0x2f, 0x20, 0x31, 0x2f, 0x03, 0x41, 0x2f, 0x02, 0x22, 
+	0x71, 0x2f, 0xce, 0x10, 0x13, 0x11, 0x2f, 0x82, 0x20, 0x41, 0x2f, 0x02, 0xfb, 0x10, 0x4b, 0x01, 
+	0x02, 0x30, 0x43, 0x20, 0x02, 0x00, 0x80, 0x01, 0x2f, 0x53, 0x28, 0xe1, 0xa1, 0x00, 0x0b, 0xa2, 
+	0x00, 0x0b, 0x21, 0x01, 0x53, 0x01, 0xe1, 0x21, 0x31, 0x43, 0x20, 0x22, 0x01, 0x00, 0x17, 0xa8, 
+	0x00, 0x0b, 0xa1, 0x00, 0x0b, 0xa2, 0x00, 0x0b, 0x00, 0x00, 0x53, 0x11, 0xe3, 0x22, 0x22, 0x71, 
+	0x2f, 0x00, 0x00, 0x5c, 0x00, 0xd7, 0x2c, 0x60, 0x42, 0x30, 0xb7, 0x3c, 0x00, 0x03, 0x50, 0x0b, 
+	0xa0, 0x33, 0x00, 0xcc, 0x0f, 0xa0, 0x01, 0x01, 0x00, 0x80, 0x03, 0xe5, 0xf1, 0x43, 0xf1, 0x43, 
+	0xf1, 0x43, 0x82, 0x90, 0x10, 0x5b, 0x33, 0x01, 0x47, 0xc0, 0x50, 0x53, 0x91, 0x4b, 0x02, 0x01, 
+	0xe0, 0xc3, 0x02, 0x01, 0x15, 0xa0, 0xb3, 0x45, 0x41, 0x4f, 0xf7, 0x41, 0x4f, 0xb1, 0xf1, 0x4f, 
+	0x40, 0xe1, 0x12, 0x83, 0x10, 0xb5, 0x07, 0x4c, 0x23, 0x78, 0x00, 0x00, 0x2b, 0x07, 0xd1, 0x06, 
+	0x4b, 0x00, 0x2b, 0x00, 0x02, 0xd0, 0x05, 0x48, 0x00, 0xe0, 0x00, 0xbf, 0x00, 0x01, 0x23, 0x23, 
+	0x70, 0x10, 0xbc, 0x01, 0xbc, 0x0c, 0x00, 0x47, 0x74, 0x78, 0x03, 0x4f, 0x07, 0x0f, 0x44, 0xa9, 
+	0x80, 0x03, 0x27, 0xb5, 0x0f, 0x4b, 0x0f, 0x4d, 0x5e, 0x1b, 0x00, 0xb6, 0x10, 0xab, 0x42, 0x06, 
+	0xd0, 0x00, 0x24, 0x00, 0x08, 0xcd, 0x01, 0x34, 0x00, 0xf0, 0x1c, 0xf8, 0x00, 0xa6, 0x42, 0xf9, 
+	0xd8, 0xf7, 0xf7, 0x52, 0xf9, 0x15, 0x09, 0x4b, 0x0a, 0xe0, 0x1d, 0x0d, 0x20, 0x1d, 0x70, 0x20, 
+	0x4b, 0x6a, 0x44, 0x00, 0x4b, 0x10, 0x03, 0x48, 0x40, 0x07, 0x18, 0x00, 0x7f, 0x05, 0x00, 0x4b, 
+	0x10, 0xb5, 0x00, 0x2b, 0x03, 0xd0, 0x04, 0x64, 0x49, 0x30, 0x79, 0x30, 0x75, 0xc0, 0x46, 0x10, 
+	0x73, 0x88, 0x7d, 0xc0, 0x00, 0x27, 0x00, 0x77, 0x30, 0xb5, 0x03, 0x2a, 0x19, 0xd9, 0x00, 0x03, 
+	0x00, 0x0b, 0x43, 0x55, 0x1e, 0x9b, 0x07, 0x00, 0x10, 0xd0, 0x00, 0x23, 0x03, 0xe0, 0x5a, 0x1c, 
+	0x00, 0x9d, 0x42, 0x12, 0xd0, 0x13, 0x00, 0xc2, 0x5c, 0x00, 0xcc, 0x5c, 0xa2, 0x42, 0xf7, 0xd0, 
+	0x10, 0x1b, 0x00, 0x0c, 0xe0, 0x04, 0x3a, 0x04, 0x30, 0x04, 0x31, 0x00, 0x03, 0x2a, 0x03, 0xd9, 
+	0x04, 0x68, 0x0b, 0x68, 0x00, 0x9c, 0x42, 0xf6, 0xd0, 0x55, 0x1e, 0x00, 0x2a, 0x00, 0xe7, 0xd1, 
+	0x00, 0x20, 0x30, 0xbc, 0x02, 0xbc, 0x00, 0x08, 0x47, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0xb5, 0x00, 
+	0x88, 0x42, 0x0e, 0xd9, 0x8b, 0x18, 0x98, 0x42, 0x10, 0x0b, 0xd2, 0x53, 0x00, 0x1d, 0x03, 0xd0, 
+	0xca, 0x5c, 0x00, 0xc2, 0x54, 0x01, 0x3b, 0xfb, 0xd2, 0x80, 0xbc, 0x10, 0xb8, 0x46, 0xf0, 0x20, 
+	0x27, 0x05, 0x00, 0x0f, 0x2a, 0x14, 0x0a, 0xd8, 0x56, 0x00, 0x1d, 0xf4, 0x00, 0x6b, 0xcc, 0x5c, 
+	0x00, 0x1a, 0x00, 0xec, 0x54, 0x01, 0x33, 0x96, 0x42, 0x00, 0xf9, 0xd1, 0xec, 0xe7, 0x03, 0x24, 
+	0x03, 0x00, 0x40, 0x26, 0x00, 0x89, 0x1e, 0x40, 0x1c, 0x42, 0x31, 0xd1, 0x00, 0x15, 0x00, 0x10, 
+	0x3d, 0x2d, 0x09, 0xa8, 0x46, 0x00, 0x2d, 0x01, 0xac, 0x46, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x84, 
+	0x44, 0x27, 0x68, 0x1f, 0x60, 0x67, 0x68, 0x00, 0x5f, 0x60, 0xa7, 0x68, 0x9f, 0x60, 0xe7, 0x68, 
+	0x00, 0x1d, 0x00, 0xdf, 0x60, 0x10, 0x34, 0x10, 0x33, 0x00, 0x65, 0x45, 0xf2, 0xd1, 0x45, 0x46, 
+	0x0f, 0x23, 0x00, 0x0c, 0x24, 0x01, 0x35, 0x2d, 0x01, 0x49, 0x19, 0x00, 0x13, 0x40, 0x45, 0x19, 
+	0x14, 0x42, 0x13, 0xd0, 0x00, 0x8c, 0x59, 0xac, 0x51, 0x04, 0x36, 0x9c, 0x1b, 0x00, 0x03, 0x2c, 
+	0xf9, 0xd8, 0x04, 0x3b, 0x9b, 0x08, 0x00, 0x01, 0x33, 0x9b, 0x00, 0xed, 0x18, 0xc9, 0x18, 0x08, 
+	0x03, 0x23, 0x1a, 0x40, 0x10, 0x7f, 0xbf, 0xd1, 0xb3, 0x00, 0xe7, 0x56, 0x1e, 0xbc, 0xe7, 0x1a, 
+	0x00, 0xb7, 0x00, 0xe7, 0xc0, 0x46, 0xf0, 0xb5, 0x05, 0x00, 0x83, 0x08, 0x07, 0x4d, 0xd0, 0x54, 
+	0x00, 0x19, 0x47, 0xd0, 0x0a, 0x00, 0x06, 0x03, 0x00, 0x03, 0x26, 0x12, 0x0e, 0x02, 0x00, 0xe0, 
+	0x01, 0x35, 0x01, 0x3c, 0x3f, 0xd3, 0x01, 0x00, 0x33, 0x2a, 0x70, 0x33, 0x42, 0xf8, 0xd1, 0x03, 
+	0x00, 0x2c, 0x30, 0xd9, 0xff, 0x22, 0x0a, 0x40, 0x15, 0x00, 0x02, 0xad, 0x18, 0x2a, 0x04, 0xad, 
+	0x18, 0x0f, 0x00, 0x2c, 0x37, 0xd9, 0x27, 0x00, 0x10, 0x3f, 0x3f, 0x00, 0x09, 0x3e, 0x01, 0xb4, 
+	0x46, 0x1e, 0x00, 0x1a, 0x00, 0x00, 0x10, 0x36, 0x66, 0x44, 0x15, 0x60, 0x55, 0x00, 0x60, 0x95, 
+	0x60, 0xd5, 0x60, 0x10, 0x32, 0x96, 0x80, 0x00, 0x33, 0x01, 0x37, 0x3f, 0x01, 0xdb, 0x19, 0x0f, 
+	0x00, 0x27, 0x0c, 0x22, 0x27, 0x40, 0x22, 0x40, 0x3c, 0x00, 0x00, 0x00, 0x2a, 0x0e, 0xd0, 0x3e, 
+	0x1f, 0xb6, 0x00, 0x08, 0xb4, 0x00, 0xa4, 0x46, 0x1a, 0x00, 0x1c, 0x00, 0x1d, 0x64, 0x44, 0x20, 
+	0xc2, 0xa2, 0x42, 0xfc, 0x00, 0xd1, 0x03, 0x24, 0x01, 0x36, 0xb6, 0x00, 0x9b, 0x00, 0x19, 0x3c, 
+	0x40, 0x00, 0x2c, 0x06, 0xd0, 0x09, 0x00, 0x06, 0x09, 0x0e, 0x1c, 0x19, 0x19, 0x70, 0x01, 0x04, 
+	0x33, 0x9c, 0x42, 0xfb, 0xd1, 0x31, 0x3b, 0x03, 0x00, 0x01, 0x14, 0x00, 0xbd, 0xe7, 0x27, 0x00, 
+	0xdf, 0x00, 0xaf, 0x00, 0x70, 0xb5, 0x10, 0x4b, 0x10, 0x4d, 0x11, 0x4c, 0x00, 0x5b, 0x1b, 0x23, 
+	0x64, 0x80, 0x23, 0x10, 0x49, 0x00, 0xe5, 0x63, 0x61, 0x60, 0x1b, 0x05, 0x99, 0x42, 0x00, 0x04, 
+	0xd2, 0x63, 0x6c, 0x00, 0x2b, 0x08, 0xd0, 0x00, 0x0c, 0x4b, 0x63, 0x60, 0x0c, 0x4b, 0x0d, 0x4a, 
+	0x00, 0x1a, 0x60, 0x0d, 0x4b, 0x1a, 0x60, 0xf7, 0xf7, 0x00, 0x99, 0xfa, 0x81, 0x22, 0x92, 0x04, 
+	0x28, 0x00, 0x00, 0x52, 0x1a, 0x00, 0xf0, 0x1f, 0xf9, 0x65, 0x60, 0x40, 0xf0, 0x00, 0x43, 0x14, 
+	0x92, 0x02, 0x02, 0xc4, 0x00, 0x10, 0x00, 0x02, 0x08, 0x00, 0x03, 0x70, 0x2a, 0x01, 0x08, 0xa0, 
+	0x00, 0x03, 0x0e, 0x10, 0x13, 0xef, 0xbe, 0xad, 0xde, 0x0c, 0x02, 0x9a, 0x02, 0x02, 0x70, 0xb5, 
+	0x04, 0x01, 0x13, 0x16, 0x10, 0xd1, 0x02, 0x68, 0x12, 0x9b, 0xd3, 0x18, 0x93, 0x43, 0x00, 0x2b, 
+	0x42, 0x0f, 0xd1, 0x42, 0x68, 0x0b, 0x4b, 0x82, 0x10, 0x0b, 0x04, 0x30, 0x2b, 0x42, 0x08, 0x00, 
+	0x0d, 0x08, 0x80, 0x60, 0x0d, 0xf1, 0xd0, 0x00, 0xe0, 0x01, 0x30, 0x03, 0x80, 0x02, 0xf1, 0xfb, 
+	0xd1, 0x00, 0xf0, 0x08, 0xf8, 0x20, 0x20, 0x00, 0x70, 0x20, 0xb7, 0xff, 0xfe, 0xfe, 0xfe, 0x80, 
+	0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x0a, 0x78, 0x01, 0x20, 0x31, 0x1a, 0x00, 0xd3, 0x00, 0x2a, 
+	0xf9, 0xd1, 0x70, 0x01, 0x47, 0x10, 0xb5, 0x83, 0x07, 0x0c, 0xd0, 0x01, 0x69, 0x40, 0x21, 0x01, 
+	0x67, 0x33, 0x0b, 0x42, 0x07, 0xd0, 0x1a, 0x44, 0x78, 0x10, 0x19, 0x18, 0x1a, 0x10, 0x40, 0xef, 
+	0x19, 0x68, 0x00, 0x0c, 0x4a, 0x0d, 0x4c, 0x8a, 0x18, 0x8a, 0x43, 0x42, 0x22, 0x00, 0x79, 0x59, 
+	0x68, 0x09, 0x4a, 0x10, 0x0b, 0x04, 0x23, 0x33, 0x22, 0x00, 0x79, 0x59, 0x68, 0x05, 0x60, 0x0d, 
+	0x20, 0x79, 0x43, 0x33, 0x10, 0x3d, 0xfb, 0xd1, 0xdf, 0xe7, 0x50, 0x6f, 0x10, 0xbf, 0x00, 0x03, 
+	0x23, 0x0c, 0x43, 0x06, 0x00, 0x23, 0x42, 0x00, 0x01, 0xd1, 0x93, 0x42, 0x17, 0xd3, 0x33, 0x00, 
+	0x00, 0x00, 0x24, 0x06, 0xe0, 0x0d, 0x5d, 0x01, 0x3a, 0x08, 0x35, 0x55, 0x01, 0x33, 0x03, 0x43, 
+	0x2d, 0x04, 0xd0, 0x08, 0x00, 0x2a, 0xf6, 0xd1, 0x30, 0xa7, 0x00, 0x21, 0x9c, 0x05, 0x18, 0x00, 
+	0x2a, 0xf8, 0xd0, 0x11, 0x75, 0xa3, 0x01, 0x75, 0x04, 0xf3, 0xe7, 0x07, 0x4d, 0x04, 0x02, 0xf9, 
+	0x10, 0xc6, 0x80, 0x12, 0xf9, 0xe0, 0xd9, 0x0c, 0x68, 0x04, 0x4b, 0xe3, 0x23, 0x18, 0xa3, 0x01, 
+	0x05, 0xf4, 0xd0, 0xd9, 0x01, 0x3f, 0x10, 0x63, 0x80, 0x10, 0x6b, 0x78, 0x47, 0xfd, 0xe7, 0x04, 
+	0xf0, 0x1f, 0x30, 0xe5, 0x14, 0x06, 0xb3, 0x10, 0x0b, 0xab, 0xfe, 0xff, 0xea, 0xb4, 0x50, 0x13, 
+	0x28, 0x00, 0x13, 0x10, 0x07, 0x40, 0x40, 0x1b, 0x55, 0xf1, 0x92, 0x30, 0x1b, 0x20, 0xf2, 0x30, 
+	0x07, 0xec, 0xf4, 0x30, 0x07, 0x06, 0xf5, 0x00, 0x0f, 0x10, 0x27, 0x16, 0xf7, 0x10, 0x0f, 0x59, 
+	0x40, 0x27, 0xea, 0x40, 0x1f, 0x49, 0xf7, 0x40, 0x07, 0xeb, 0xfd, 0x30, 0x27, 0x14, 0x45, 0x30, 
+	0x27, 0x52, 0xe7, 0x40, 0x27, 0x47, 0x40, 0x73, 0x2d, 0xed, 0x30, 0x07, 0x7f, 0x40, 0xf5, 0x30, 
+	0x07, 0xad, 0xec, 0xff, 0xea, 0x00, 0xc0, 0x10, 0x9f, 0xe5, 0x1c, 0x04, 0x93, 0xa9, 0x14, 0x00, 
+	0x08, 0x9a, 0x10, 0x3b, 0xe4, 0x44, 0x30, 0x3b, 0x10, 0x0b, 0x30, 0x40, 0x47, 0xbb, 0x55, 0xef, 
+	0x30, 0x2f, 0x61, 0x40, 0x37, 0x1f, 0x40, 0x57, 0xc4, 0x40, 0x57, 0x5a, 0x3d, 0x40, 0x57, 0x9a, 
+	0x40, 0x87, 0x10, 0x3b, 0x38, 0x40, 0xab, 0x67, 0xcc, 0x00, 0x23, 0x10, 0x0f, 0x94, 0x3d, 0x04, 
+	0xcf, 0x40, 0x6b, 0x25, 0x8f, 0x2f, 0x00, 0x08, 0x10, 0x1b, 0xb6, 0x00, 0x2f, 0x10, 0x1b, 0x17, 
+	0xd3, 0x50, 0x37, 0x5e, 0xa4, 0x40, 0x73, 0x09, 0x00, 0x53, 0x4e, 0x2c, 0xf0, 0x01, 0x1c, 0x27, 
+	0xb5, 0x00, 0xc0, 0x46, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x01, 0x70, 0x47, 0x00, 0xfe, 0x00, 
+	0x06, 0x71, 0x2c, 0x3d, 0x18, 0x15, 0x00, 0xdb, 0x14, 0xbf, 0x00, 0x03, 0x0c, 0x00, 0x16, 0x00, 
+	0x00, 0x35, 0x00, 0x67, 0x00, 0x75, 0x00, 0x92, 0x08, 0x00, 0x99, 0x00, 0xb7, 0x00, 0x11, 0x28, 
+	0x41, 0xa5, 0x4b, 0x41, 0x09, 0x5e, 0x00, 0x58, 0x00, 0x03, 0x6f, 0x00, 0x03, 0x1d, 0xd5, 0x24, 
+	0x61, 0x45, 0x0a, 0xfb, 0x52, 0x00, 0x03, 0x3b, 0x00, 0x00, 0x64, 0xaa, 0x00, 0x03, 0x03, 0x81, 
+	0x00, 0x9c, 0x00, 0x03, 0xb3, 0x55, 0x00, 0x00, 0x00, 0x34, 0x00, 0x66, 0x45, 0xf4, 0x20, 0x00, 
+	0x00, 0x00, 0x3d, 0x00, 0x6a, 0x49, 0x00, 0x00, 0x55, 0x19, 0x00, 0x15, 0x1d, 0x00, 0x03, 0x46, 
+	0x00, 0x31, 0x0d, 0x00, 0x03, 0x40, 0xbf, 0x00, 0x19, 0x28, 0x46, 0x4b, 0x00, 0x90, 0x00, 0x10, 
+	0x9a, 0x00, 0xbd, 0x00, 0x17, 0x39, 0x00, 0x43, 0x00, 0x60, 0x97, 0x1e, 0xf3, 0x00, 0x4d, 0x18, 
+	0x49, 0x3f, 0x00, 0x66, 0x22, 0x4c, 0xc6, 0x00, 0x21, 0x95, 0x00, 0xb3, 0x00, 0x0f, 0x3e, 0xc2, 
+	0x05, 0x60, 0x00, 0x35, 0x52, 0x69, 0x00, 0xf2, 0x00, 0x07, 0x59, 0x00, 0x00, 0xc6, 0x41, 0x00, 
+	0x00, 0x86, 0x00, 0xa8, 0x87, 0x00, 0x0b, 0xbf, 0x43, 0xce, 0x00, 0x03, 0x0e, 0x00, 0x09, 0x08, 
+	0x77, 0x00, 0x00, 0x27, 0x42, 0x49, 0x00, 0x5c, 0x00, 0xb3, 0xa8, 0x0e, 0xf3, 0xc9, 0x00, 0x0d, 
+	0x4e, 0x00, 0x03, 0x18, 0x4b, 0x6a, 0x28, 0x4b, 0x6b, 0x00, 0x07, 0x9d, 0x00, 0x03, 0x17, 0x00, 
+	0x27, 0x08, 0x4e, 0x61, 0x41, 0x8b, 0x00, 0x09, 0x01, 0x00, 0x10, 0x00, 0x00, 0x29, 0x00, 0x52, 
+	0x00, 0x5d, 0x00, 0x68, 0x0a, 0x00, 0x6d, 0x00, 0xf6, 0x00, 0x11, 0x70, 0x00, 0x03, 0xa2, 0x34, 
+	0x00, 0xf7, 0x10, 0x9f, 0x00, 0x6f, 0xd3, 0x00, 0xaf, 0xf4, 0x2d, 0x00, 0x31, 0x2e, 0x30, 0x37, 
+	0x00, 0x2a, 0x7c, 0x3b, 0x00, 0x40, 0x5c, 0x7e, 0x5e, 0x60, 0x7b, 0x7d, 0x7f, 0x00, 0x4e, 0x49, 
+	0x4e, 0x54, 0x45, 0x4e, 0x44, 0x4f, 0x00, 0x00, 0xff, 0x56, 0x45, 0x52, 0x53, 0x52, 0x41, 0x24, 
+	0x4d, 0x20, 0x00, 0x03, 0x32, 0x56, 0x00, 0x04, 0x49, 0x4f, 0x00, 0x20, 0x20, 0x52, 0x45, 0x47, 
+	0x53, 0x4d, 0x41, 0x00, 0x50, 0x52, 0x50, 0x41, 0x4c, 0x20, 0x45, 0x4d, 0x10, 0x55, 0x20, 0x4f, 
+	0x00, 0x1f, 0x53, 0x47, 0x42, 0x20, 0x00, 0xcd, 0x19, 0x00, 0x08, 0xed, 0x1a, 0x00, 0x08, 0x04, 
+	0x15, 0x1b, 0x00, 0x08, 0x35, 0x00, 0x07, 0xa4, 0x89, 0x01, 0x00, 0x08, 0xa8, 0x88, 0x00, 0x08, 
+	0x3d, 0x00, 0x0f, 0x65, 0x61, 0x00, 0x03, 0x0c, 0x74, 0x08, 0x85, 0x00, 0x07, 0xc9, 0x00, 0x03, 
+	0x55, 0xc1, 0x00, 0x0b, 0xe9, 0x00, 0x03, 0x65, 0x00, 0x27, 0x91, 0x00, 0x03, 0x55, 0x14, 0x00, 
+	0x2b, 0x40, 0x00, 0x2b, 0x05, 0x00, 0x0b, 0xc5, 0x00, 0x03, 0x54, 0xc9, 0x00, 0x1b, 0x1d, 0x00, 
+	0x07, 0xcd, 0x00, 0x2b, 0x10, 0x32, 0x00, 0x9b, 0x1f, 0x1f, 0x1f, 0x22, 0x1a, 0x9f, 0x1f, 0x44, 
+	0x5b, 0x20, 0x07, 0x1f, 0x32, 0x9d, 0x20, 0x07, 0x25, 0x1f, 0x44, 0x5d, 0x20, 0x07, 0x24, 0x32, 
+	0x9f, 0x10, 0x07, 0x1f, 0x24, 0x20, 0x1f, 0x5f, 0x30, 0x0f, 0x3f, 0x9f, 0x1f, 0xdc, 0xdf, 0x22, 
+	0xac, 0x10, 0x30, 0x0f, 0x62, 0x10, 0x10, 0x20, 0x01, 0x1c, 0xc3, 0xf0, 0x07, 0x40, 0x07, 0x1a, 
+	0x1a, 0x1a, 0x1a, 0x20, 0x04, 0x40, 0x08, 0x25, 0x9c, 0x9c, 0x10, 0x01, 0x1f, 0x9c, 0x30, 0x10, 
+	0x50, 0x60, 0x1a, 0xbc, 0xc0, 0x01, 0x50, 0xb0, 0x0e, 0x30, 0x47, 0x70, 0x17, 0x70, 0x5f, 0x18, 
+	0x1f, 0x00, 0x26, 0x27, 0x2f, 0x1f, 0x1a, 0x1f, 0x18, 0x19, 0x02, 0x26, 0x2e, 0x2f, 0x2f, 0x2a, 
+	0x1f, 0x00, 0x0f, 0x1f, 0xc2, 0x40, 0x0f, 0x00, 0x07, 0x2a, 0x1f, 0xa1, 0x1f, 0x10, 0xdf, 0x2a, 
+	0x0b, 0x1f, 0x3f, 0x1f, 0xb3, 0x20, 0x07, 0x21, 0x00, 0x05, 0x30, 0x0f, 0x22, 0x73, 0x10, 0x10, 
+	0xd7, 0x30, 0x00, 0x02, 0xa2, 0xcf, 0x43, 0x31, 0x46, 0x47, 0xf2, 0xe4, 0x90, 0x01, 0x20, 0x00, 
+	0x80, 0x00, 0x01, 0x10, 0x02, 0x13, 0xa2, 0x0a, 0xf3, 0x9d, 0x00, 0x08, 0x16, 0xd5, 0x40, 0x07, 
+	0x10, 0x0f, 0x1d, 0x00, 0x03, 0x02, 0x00, 0x03, 0x07, 0x00, 0x03, 0x55, 0x0d, 0x40, 0x17, 0xd9, 
+	0x00, 0x03, 0xb4, 0x00, 0x03, 0xc8, 0x00, 0x03, 0x41, 0xdc, 0x00, 0x03, 0xa2, 0xa1, 0x00, 0x08, 
+	0xa1, 0x00, 0x03, 0x54, 0xfe, 0x00, 0x03, 0xfd, 0x00, 0x03, 0xfc, 0x00, 0x03, 0xe8, 0x9a, 0xd5, 
+	0x00, 0x0b, 0x00, 0x1b, 0x50, 0x00, 0x0b, 0x8e, 0x00, 0x07, 0xa4, 0x00, 0x03, 0x6a, 0xa9, 0x00, 
+	0x03, 0x10, 0x3f, 0x94, 0x00, 0x03, 0x98, 0x00, 0x03, 0x9f, 0xaa, 0x00, 0x03, 0xe6, 0x00, 0x1f, 
+	0xeb, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf4, 0xa4, 0x00, 0x03, 0xf8, 0x00, 0x03, 0x71, 0x36, 0x30, 
+	0x03, 0x51, 0x34, 0x84, 0x02, 0x17, 0x35, 0x00, 0x08, 0xa5, 0x00, 0x03, 0x0b, 0x08, 0x26, 0x08, 
+	0x03, 0x10, 0xd5, 0xe8, 0x99, 0x01, 0xfb, 0x00, 0x5b, 0xc8, 0xaa, 0x00, 0x07, 0xbc, 0x00, 0x03, 
+	0xb4, 0x00, 0x03, 0xe4, 0x00, 0x47, 0xed, 0xa8, 0x00, 0x03, 0xf7, 0x00, 0x03, 0xff, 0x00, 0x03, 
+	0x07, 0x9e, 0x00, 0x2a, 0x08, 0x0e, 0x00, 0x03, 0x16, 0x00, 0x03, 0x27, 0x00, 0x03, 0x3a, 0xaa, 
+	0x00, 0x03, 0x46, 0x00, 0x03, 0x4d, 0x00, 0x03, 0x6a, 0x00, 0x03, 0x7a, 0xaa, 0x00, 0x03, 0x90, 
+	0x00, 0x03, 0x9a, 0x00, 0x03, 0xa0, 0x00, 0x03, 0xb1, 0xaa, 0x00, 0x03, 0xb8, 0x00, 0x03, 0xbf, 
+	0x00, 0x03, 0xc6, 0x00, 0x03, 0xcd, 0xaa, 0x00, 0x03, 0xd4, 0x00, 0x03, 0xdb, 0x00, 0x03, 0xe2, 
+	0x00, 0x03, 0xe9, 0xaa, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf7, 0x00, 0x03, 0xfe, 0x00, 0x03, 0x05, 
+	0x0a, 0x9f, 0x00, 0x08, 0x0c, 0x00, 0x03, 0x13, 0x00, 0x03, 0x1a, 0xaa, 0x00, 0x03, 0x21, 0x00, 
+	0x03, 0x28, 0x00, 0x03, 0x2f, 0x00, 0x03, 0x36, 0xaa, 0x00, 0x03, 0x3d, 0x00, 0x03, 0x44, 0x00, 
+	0x03, 0x4b, 0x00, 0x03, 0x52, 0xaa, 0x00, 0x03, 0x59, 0x00, 0x03, 0x60, 0x00, 0x03, 0x67, 0x00, 
+	0x03, 0x6e, 0xaa, 0x00, 0x03, 0x75, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x83, 0x00, 0x03, 0x8a, 0xb5, 
+	0x00, 0x03, 0x91, 0x00, 0x03, 0x10, 0xa3, 0x98, 0x00, 0x07, 0x9f, 0x00, 0x03, 0x55, 0xa8, 0x00, 
+	0x03, 0xb8, 0x00, 0x03, 0xc7, 0x00, 0x03, 0xc9, 0x00, 0x03, 0x54, 0xd7, 0x00, 0x03, 0xe5, 0x00, 
+	0x03, 0xf2, 0x00, 0x03, 0x10, 0xa0, 0x1a, 0x00, 0x08, 0x1c, 0x00, 0x03, 0x10, 0xbf, 0x2a, 0x00, 
+	0x07, 0x34, 0xaa, 0x00, 0x03, 0x3f, 0x00, 0x03, 0x56, 0x00, 0x03, 0x5c, 0x00, 0x03, 0x68, 0xaa, 
+	0x00, 0x03, 0x7d, 0x00, 0x03, 0x8e, 0x00, 0x03, 0x9f, 0x00, 0x03, 0xaa, 0xaa, 0x00, 0x03, 0xaf, 
+	0x00, 0x03, 0xbb, 0x00, 0x03, 0xc7, 0x00, 0x03, 0xd3, 0xab, 0x00, 0x03, 0xe1, 0x00, 0x03, 0xf0, 
+	0x00, 0x03, 0xf4, 0x00, 0x03, 0x10, 0xff, 0x55, 0xff, 0x00, 0x07, 0x06, 0x01, 0x77, 0x0f, 0x00, 
+	0x03, 0x22, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x3f, 0x00, 0x03, 0x52, 0x00, 0x03, 0x62, 0x00, 
+	0x03, 0x55, 0x6f, 0x00, 0x03, 0x78, 0x00, 0x03, 0x8f, 0x00, 0x03, 0x99, 0x00, 0x03, 0x55, 0xa4, 
+	0x00, 0x03, 0xb2, 0x00, 0x03, 0xbe, 0x00, 0x03, 0xc4, 0x00, 0x03, 0x6a, 0xed, 0x10, 0xa7, 0x00, 
+	0x07, 0xce, 0x00, 0x03, 0xd5, 0x00, 0x03, 0xd1, 0xa8, 0x00, 0x03, 0xd8, 0x00, 0x03, 0xdf, 0x00, 
+	0x03, 0x05, 0x33, 0x00, 0x25, 0x08, 0x29, 0x00, 0x03, 0x01, 0x3b, 0x00, 0x23, 0x32, 0x01, 0xcb, 
+	0xad, 0x00, 0x03, 0x35, 0x00, 0x03, 0x4d, 0x10, 0x03, 0x00, 0x17, 0x5d, 0x00, 0x07, 0x55, 0x71, 
+	0x00, 0x03, 0x81, 0x00, 0x03, 0xb9, 0x00, 0x03, 0x95, 0x00, 0x03, 0x33, 0xe5, 0x31, 0x00, 0x07, 
+	0x00, 0x03, 0x0f, 0x38, 0x00, 0x37, 0x00, 0x03, 0x40, 0x29, 0x00, 0x03, 0x15, 0x2e, 0x00, 0x08, 
+	0xad, 0x30, 0xa1, 0x01, 0x2b, 0x24, 0x01, 0x3f, 0x3a, 0x00, 0x08, 0xf5, 0x00, 0x27, 0x70, 0x3f, 
+	0x00, 0x07, 0xf0, 0x2b, 0xb0, 0x1f, 0x3d, 0x40, 0x0b, 0x40, 0x00, 0x10, 0x40, 0x26, 0x40, 0x35, 
+	0x40, 0x03, 0x40, 0x00, 0x06, 0x40, 0x14, 0x40, 0x0e, 0x40, 0x0d, 0x40, 0x00, 0x25, 0x40, 0x12, 
+	0x40, 0x28, 0x40, 0x02, 0x40, 0x02, 0x18, 0x40, 0x09, 0x40, 0x0a, 0x40, 0x05, 0x0d, 0x6f, 0x00, 
+	0x20, 0x52, 0x4f, 0x4d, 0x53, 0x20, 0x66, 0x6f, 0x00, 0x75, 0x6e, 0x64, 0x21, 0x00, 0x55, 0x73, 
+	0x65, 0x00, 0x20, 0x47, 0x6f, 0x6f, 0x6d, 0x62, 0x61, 0x20, 0x00, 0x46, 0x72, 0x6f, 0x6e, 0x74, 
+	0x00, 0x74, 0x6f, 0x00, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x61, 0x00, 0x20, 0x63, 0x6f, 
+	0x6d, 0x70, 0x69, 0x6c, 0x61, 0x08, 0x74, 0x69, 0x6f, 0x6e, 0x10, 0x33, 0x2c, 0x00, 0x6f, 0x10, 
+	0x72, 0x20, 0x75, 0x00, 0x2f, 0x50, 0x6f, 0x67, 0x6f, 0x00, 0x73, 0x68, 0x65, 0x6c, 0x6c, 0x20, 
+	0x77, 0x69, 0x00, 0x74, 0x68, 0x20, 0x61, 0x00, 0x73, 0x75, 0x70, 0x00, 0x70, 0x6f, 0x72, 0x74, 
+	0x65, 0x64, 0x20, 0x66, 0x00, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x63, 0x61, 0x72, 0x00, 0x74, 0x72, 
+	0x69, 0x64, 0x67, 0x65, 0x2e, 0x00, 0x88, 0x40, 0x5b, 0x43, 0x6f, 0x6c, 0x00, 0x3c, 0x76, 0x30, 
+	0x2e, 0x20, 0x35, 0x00, 0x25, 0x4e, 0x4f, 0x63, 0x74, 0x20, 0x31, 0x00, 0x38, 0x20, 0x32, 0x30, 
+	0x30, 0x30, 0x00, 0x20, 0x00, 0x20, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x65, 0x00, 0x72, 0x72, 
+	0x6f, 0x72, 0x21, 0x20, 0x4d, 0x65, 0x00, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x66, 0x75, 0x6c, 0x30, 
+	0x6c, 0x2e, 0x00, 0x1b, 0x00, 0x01, 0x44, 0x65, 0x6c, 0x65, 0x88, 0x00, 0x1f, 0x73, 0x6f, 0x6d, 
+	0x00, 0x04, 0x61, 0x76, 0x65, 0x02, 0x73, 0x2e, 0x00, 0x30, 0x30, 0x3a, 0x20, 0x02, 0x20, 0x00, 
+	0x2d, 0x20, 0x00, 0x2c, 0x20, 0x66, 0x72, 0x65, 0x04, 0x65, 0x20, 0x00, 0x50, 0x75, 0x00, 0x7a, 
+	0x53, 0x45, 0x05, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x00, 0xc5, 0x64, 0x20, 0x35, 0x00, 0x00, 0x3c, 
+	0x4e, 0x45, 0x57, 0x3e, 0x00, 0x53, 0x80, 0x00, 0x36, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3a, 
+	0x04, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x50, 0x0b, 0x45, 0x72, 0x60, 0x61, 0x00, 0xd0, 0x15, 0xc4, 
+	0x3a, 0x00, 0x50, 0x6c, 0x65, 0xc0, 0x10, 0x0c, 0x20, 0x4c, 0x75, 0x70, 0x20, 0x00, 0x20, 0x62, 
+	0x00, 0x79, 0x74, 0x65, 0x73, 0x00, 0x57, 0x65, 0x20, 0x04, 0x6e, 0x6f, 0x77, 0x20, 0x68, 0x10, 
+	0x41, 0x65, 0x6e, 0x00, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x73, 0x70, 0x61, 0x38, 0x63, 0x65, 0x30, 
+	0x9b, 0x30, 0x01, 0x00, 0x5e, 0x69, 0x6e, 0x67, 0x32, 0x2e, 0x2e, 0x40, 0xb0, 0x06, 0x05, 0x4f, 
+	0x4d, 0x00, 0x35, 0x74, 0xc0, 0x31, 0x65, 0x60, 0x15, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x08, 
+	0x53, 0x65, 0x74, 0x74, 0x00, 0x2d, 0x73, 0x00, 0x56, 0x00, 0x53, 0x79, 0x6e, 0x63, 0x3a, 0x20, 
+	0x00, 0x46, 0x0a, 0x50, 0x53, 0x2d, 0x4d, 0x00, 0xab, 0x72, 0x00, 0x0b, 0x41, 0x00, 0x75, 0x74, 
+	0x6f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x80, 0x00, 0x0b, 0x53, 0x77, 0x61, 0x70, 0x20, 0x41, 0x2d, 
+	0x50, 0x42, 0x40, 0x16, 0x6c, 0x70, 0xb7, 0x20, 0x00, 0x47, 0x61, 0x8c, 0x01, 0x0c, 0x42, 0x6f, 
+	0x79, 0x40, 0x1b, 0x26, 0x62, 0x62, 0x6f, 0x20, 0x72, 0x64, 0x20, 0x44, 0x49, 0x64, 0x65, 0x6e, 
+	0x74, 0x00, 0x69, 0x66, 0x79, 0x20, 0x61, 0x73, 0x20, 0x47, 0x30, 0x42, 0x41, 0x00, 0x11, 0x30, 
+	0x7f, 0x44, 0x69, 0x73, 0x70, 0x13, 0x6c, 0x61, 0x79, 0x70, 0x81, 0x50, 0x61, 0x01, 0x23, 0x50, 
+	0x4f, 0x38, 0x6d, 0x61, 0x10, 0x73, 0x00, 0x47, 0x40, 0x15, 0x20, 0x4e, 0x75, 0x32, 0x6d, 0x62, 
+	0x20, 0x4f, 0x60, 0xe6, 0x70, 0x65, 0x01, 0xe3, 0x48, 0x00, 0x61, 0x63, 0x6b, 0x73, 0x00, 0x44, 
+	0x6f, 0x75, 0x38, 0x62, 0x6c, 0x01, 0x3a, 0x10, 0x12, 0x00, 0x22, 0x4c, 0x43, 0x44, 0x00, 0x20, 
+	0x73, 0x63, 0x61, 0x6e, 0x6c, 0x69, 0x6e, 0x48, 0x65, 0x01, 0x2b, 0x63, 0x6b, 0x00, 0x13, 0x4a, 
+	0x61, 0x67, 0xa0, 0xd1, 0xfd, 0x20, 0x02, 0x4a, 0x00, 0x42, 0x79, 0x20, 0x46, 0x00, 0x6c, 0x75, 
+	0x42, 0x42, 0x61, 0x2c, 0x20, 0x44, 0x01, 0x77, 0x65, 0x64, 0x69, 0x74, 0x2c, 0x20, 0x00, 0x2a, 
+	0x04, 0x61, 0x00, 0x42, 0x20, 0x61, 0x00, 0xca, 0x66, 0x69, 0x58, 0x72, 0x10, 0x90, 0x41, 0x90, 
+	0x0c, 0x40, 0xb8, 0x2d, 0x3e, 0x00, 0xfd, 0xb1, 0x42, 0x00, 0x10, 0x80, 0x93, 0x10, 0x0d, 0x11, 
+	0x3a, 0x31, 0xed, 0x53, 0x11, 0x29, 0xe0, 0x00, 0x12, 0x21, 0xee, 0x50, 0x0c, 0x4d, 0x61, 0x6e, 
+	0x61, 0x67, 0xc8, 0x31, 0xf0, 0x00, 0x0d, 0x52, 0x65, 0x01, 0x4e, 0x72, 0x74, 0x00, 0x0e, 0x45, 
+	0x78, 0x69, 0x74, 0x91, 0xce, 0x60, 0x01, 0x52, 0x66, 0x00, 0x04, 0x33, 0x00, 0x4f, 0x46, 0x46, 
+	0x00, 0x4a, 0x77, 0x00, 0x40, 0x4d, 0x00, 0xb0, 0x75, 0x6d, 0x00, 0x48, 0x69, 0x67, 0x10, 0x68, 
+	0x00, 0x46, 0x02, 0xa3, 0x00, 0x48, 0x61, 0x6c, 0x60, 0x66, 0x02, 0x11, 0x00, 0x85, 0x00, 0x50, 
+	0x72, 0x65, 0x66, 0xc8, 0x10, 0x9d, 0x01, 0x43, 0x6f, 0x76, 0x00, 0x08, 0x47, 0x42, 0x43, 0xf5, 
+	0x50, 0x13, 0x00, 0x0a, 0x30, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x0c, 0x2b, 0x10, 0x07, 0x00, 0x50, 
+	0x65, 0x61, 0x20, 0x53, 0x6f, 0x75, 0x70, 0x04, 0x00, 0x47, 0x72, 0x61, 0x79, 0x01, 0x3d, 0x6c, 
+	0x65, 0x00, 0x00, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x20, 0x31, 0x80, 0x40, 0x07, 0x32, 0x00, 0x5a, 
+	0x65, 0x6c, 0x64, 0x61, 0x40, 0x2e, 0x00, 0x75, 0x74, 0x72, 0x6f, 0x69, 0x64, 0x00, 0x10, 0x41, 
+	0x64, 0x76, 0x01, 0xda, 0x75, 0x72, 0x65, 0x20, 0x06, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0xf0, 0x10, 
+	0x00, 0x32, 0x42, 0x0a, 0x61, 0x6c, 0x6c, 0x6f, 0x01, 0x67, 0x4b, 0x00, 0x2f, 0x42, 0x06, 0x61, 
+	0x74, 0x6d, 0x61, 0x6e, 0x40, 0x06, 0x03, 0x2c, 0x52, 0x41, 0x65, 0x00, 0x2b, 0x6e, 0x20, 0x6f, 
+	0x66, 0x20, 0x01, 0x47, 0x00, 0x20, 0x4a, 0x6f, 0x6b, 0x65, 0x72, 0x00, 0x42, 0x98, 0x03, 0xdf, 
+	0x69, 0x63, 0x01, 0xa4, 0x02, 0x01, 0x6e, 0x64, 0x6f, 0x00, 0x00, 0x43, 0x61, 0x73, 0x74, 0x6c, 
+	0x65, 0x76, 0x04, 0x61, 0x6e, 0x69, 0x61, 0x20, 0x60, 0x5e, 0x00, 0x44, 0x00, 0x72, 0x2e, 0x20, 
+	0x4d, 0x61, 0x72, 0x69, 0x6f, 0x02, 0x00, 0x4b, 0x69, 0x72, 0x62, 0x79, 0x01, 0xff, 0x6e, 0x00, 
+	0x6b, 0x65, 0x79, 0x20, 0x4b, 0x6f, 0x6e, 0x67, 0x2e, 0x20, 0x4c, 0x10, 0x89, 0x59, 0x04, 0x10, 
+	0x01, 0x1f, 0x10, 0xfc, 0x31, 0x55, 0x41, 0x30, 0x06, 0x42, 0x30, 0x06, 0x43, 0x30, 0x06, 0x44, 
+	0x30, 0x06, 0x55, 0x45, 0x30, 0x06, 0x46, 0x30, 0x06, 0x47, 0x30, 0x06, 0x48, 0x20, 0x06, 0x55, 
+	0x32, 0x30, 0x37, 0x32, 0x30, 0x37, 0x32, 0x30, 0x37, 0x32, 0x30, 0x37, 0x55, 0x32, 0x30, 0x37, 
+	0x32, 0x30, 0x37, 0x32, 0x30, 0x37, 0x32, 0x30, 0x37, 0x55, 0x33, 0x30, 0x37, 0x33, 0x30, 0x37, 
+	0x33, 0x30, 0x37, 0x33, 0x30, 0x37, 0x55, 0x33, 0x30, 0x37, 0x33, 0x30, 0x37, 0x33, 0x30, 0x37, 
+	0x33, 0x30, 0x37, 0x55, 0x34, 0x30, 0x37, 0x34, 0x30, 0x37, 0x34, 0x30, 0x37, 0x34, 0x30, 0x37, 
+	0x54, 0x34, 0x30, 0x37, 0x34, 0x30, 0x37, 0x34, 0x30, 0x37, 0x34, 0x48, 0x20, 0x00, 0x54, 0x01, 
+	0x89, 0x69, 0x73, 0x00, 0x41, 0x6c, 0x03, 0x6c, 0x65, 0x79, 0x77, 0x61, 0x79, 0x02, 0x51, 0x01, 
+	0x13, 0x00, 0x27, 0x73, 0x20, 0x50, 0x69, 0x63, 0x72, 0x6f, 0x30, 0x73, 0x73, 0x02, 0x8f, 0x04, 
+	0x1b, 0x20, 0x49, 0x6e, 0x76, 0x50, 0x61, 0x03, 0x8b, 0x73, 0x0b, 0x24, 0x50, 0x6f, 0x63, 0x6b, 
+	0x08, 0x65, 0x74, 0x20, 0x43, 0x03, 0xb0, 0x72, 0x61, 0x00, 0x00, 0x52, 0x61, 0x64, 0x61, 0x72, 
+	0x20, 0x4d, 0x69, 0x34, 0x73, 0x73, 0x01, 0x75, 0x00, 0x1b, 0x6b, 0x04, 0xed, 0x6e, 0x20, 0x00, 
+	0x42, 0x6c, 0x75, 0x65, 0x00, 0x4b, 0x61, 0x65, 0x24, 0x72, 0x75, 0x04, 0x35, 0x20, 0x54, 0x13, 
+	0xdb, 0x6e, 0x69, 0x10, 0x20, 0x4b, 0x61, 0x03, 0x4b, 0x77, 0x61, 0x20, 0x4e, 0x16, 0x61, 0x72, 
+	0x75, 0x60, 0x2a, 0x52, 0x12, 0x67, 0x40, 0x0b, 0x47, 0xc0, 0x04, 0xaa, 0x00, 0x44, 0x69, 0x6e, 
+	0x6f, 0x63, 0x63, 0x68, 0x99, 0x01, 0x99, 0x4d, 0x6f, 0x03, 0x91, 0x02, 0xe2, 0x69, 0x61, 0x34, 
+	0x1f, 0x80, 0x12, 0x0f, 0x57, 0x61, 0x74, 0x63, 0x68, 0x20, 0x47, 0x82, 0x02, 0x13, 0x65, 0x72, 
+	0x79, 0x00, 0x59, 0x05, 0xb8, 0x69, 0xe6, 0x91, 0xbb, 0x31, 0xcd, 0x20, 0xbf, 0x6e, 0x62, 0x00, 
+	0x24, 0x31, 0xcb, 0x53, 0x3d, 0x75, 0x70, 0x02, 0xaa, 0x20, 0xda, 0x30, 0x10, 0x40, 0xc4, 0x42, 
+	0x03, 0xce, 0x32, 0x65, 0x72, 0x12, 0x51, 0x02, 0x5c, 0x20, 0x49, 0x05, 0xe7, 0x75, 0x40, 0x73, 
+	0x05, 0xe2, 0x6c, 0x66, 0x00, 0x44, 0x79, 0x6e, 0x3d, 0x61, 0x62, 0x05, 0xfc, 0x04, 0xc5, 0x12, 
+	0x6d, 0x02, 0x40, 0x74, 0x03, 0x77, 0xd8, 0x05, 0x3d, 0x20, 0x43, 0x42, 0x10, 0x19, 0x41, 0x3a, 
+	0x20, 0x41, 0x74, 0x70, 0x74, 0x03, 0xad, 0x30, 0x8a, 0x00, 0x78, 0x43, 0x6f, 0x6f, 0x6b, 0x03, 
+	0x69, 0x65, 0x00, 0x51, 0x69, 0x78, 0x40, 0x2c, 0x30, 0x81, 0xcc, 0x00, 0xd2, 0x20, 0x4a, 0x73, 
+	0x65, 0x10, 0x96, 0x60, 0xa6, 0x44, 0x72, 0x1d, 0x65, 0x61, 0x6d, 0xf0, 0xa4, 0x10, 0x10, 0x02, 
+	0xfa, 0x57, 0x13, 0xf8, 0x73, 0x52, 0x15, 0x9c, 0xd2, 0x9e, 0x00, 0x1c, 0x4b, 0x69, 0x11, 0x03, 
+	0x01, 0x9a, 0x41, 0x73, 0x04, 0x3b, 0x63, 0x74, 0x00, 0x4d, 0x79, 0x00, 0x08, 0x0c, 0x63, 0x20, 
+	0x51, 0x75, 0x04, 0x05, 0x03, 0x60, 0x67, 0x61, 0xc1, 0x11, 0x3a, 0x33, 0x70, 0x20, 0x4c, 0x69, 
+	0x6e, 0x6b, 0x00, 0x6d, 0x02, 0x41, 0x77, 0x61, 0x6b, 0x65, 0x6e, 0x04, 0x69, 0x00, 0xb8, 0x04, 
+	0x40, 0x72, 0x01, 0x4b, 0x01, 0xd1, 0x43, 0x8a, 0x20, 0x49, 0x49, 0xc0, 0x80, 0xaf, 0x10, 0x0d, 
+	0x50, 0x61, 0x63, 0x2d, 0x69, 0x6e, 0x03, 0x2d, 0x54, 0x69, 0x6d, 0x65, 0x00, 0x00, 0xf0, 0x00, 
+	0xe2, 0xa0, 0x01, 0x9f, 0x79, 0x07, 0x70, 0x6e, 0x65, 0x00, 0x31, 0x50, 0x54, 0x00, 0x10, 0x52, 
+	0x32, 0x30, 0x06, 0x33, 0x30, 0x06, 0x34, 0x50, 0x04, 0x00, 0x43, 0x72, 0x61, 0x70, 0x04, 0x22, 
+	0x6f, 0x74, 0xa0, 0x04, 0x13, 0x41, 0x00, 0x03, 0x50, 0x00, 0x4e, 0x44, 0x53, 0x10, 0x00, 0x49, 
+	0x49, 0x00, 0x01, 0x00, 0x35, 0x6d, 0x69, 0x0a, 0x6e, 0x00, 0x31, 0x30, 0x10, 0x05, 0x33, 0x20, 
+	0x05, 0x4f, 0x00, 0x4e, 0x00, 0x53, 0x4c, 0x4f, 0x57, 0x4d, 0x4f, 0x40, 0x00, 0x27, 0x77, 0x52, 
+	0x00, 0x10, 0xc0, 0x0a, 0x00, 0x00, 0x30, 0x00, 0x00, 0xf0, 0x01, 0xa0, 0x01, 0x60, 0x00, 0x01, 
+	0x00, 0x00, 0x40, 0x80, 0x30, 0x03, 0x77, 0x00, 0x77, 0x77, 0x14, 0x11, 0x61, 0x0d, 0x11, 0x11, 
+	0x00, 0x00, 0x50, 0x00, 0x0f, 0x10, 0x03, 0x10, 0x00, 0x04, 0x03, 0x82, 0xa0, 0x2b, 0x26, 0x0c, 
+	0xd8, 0x27, 0x00, 0x00, 0x17, 0x15, 0xb7, 0x00, 0x1f, 0x13, 0xe0, 0x1f, 0x00, 0x20, 0x3f, 0x11, 
+	0x00, 0x3f, 0xf0, 0x66, 0xb0, 0x00, 0x01, 0x4d, 0x50, 0x00, 0x3f, 0x40, 0x14, 0x00, 0x00, 0x3f, 
+	0x20, 0x2a, 0x88, 0x00, 0x7c, 0x40, 0x38, 0x02, 0x00, 0x06, 0x23, 0x00, 0x70, 0x37, 0x00, 0x47, 
+	0x66, 0x00, 0x13, 0x00, 0x50, 0x35, 0x01, 0x00, 0x55, 0x80, 0x00, 0x50, 0x5e, 0x88, 0x18, 0x00, 
+	0x80, 0x11, 0x88, 0x00, 0x01, 0x00, 0x88, 0x01, 0x81, 0x18, 0x77, 0x01, 0x00, 0x70, 0x17, 0x00, 
+	0x66, 0x01, 0x60, 0x16, 0x51, 0x00, 0x15, 0x50, 0x14, 0x30, 0x10, 0x55, 0x00, 0x24, 0x00, 0x10, 
+	0x6a, 0x60, 0x18, 0x00, 0x00, 0x52, 0x86, 0x04, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x1c, 0x0f, 
+	0x16, 0x00, 0xe0, 0x30, 0x5f, 0x10, 0x03, 0x00, 0x5f, 0x80, 0x00, 0x88, 0x68, 0x00, 0x48, 0x10, 
+	0x11, 0x84, 0x16, 0x00, 0x00, 0x09, 0x16, 0x00, 0x40, 0x47, 0x01, 0x12, 0x00, 0x40, 0x46, 0x12, 
+	0x01, 0x54, 0x13, 0x00, 0x5f, 0x00, 0x10, 0x55, 0x55, 0x15, 0x10, 0xab, 0x80, 0x88, 0x00, 0x88, 
+	0x16, 0x08, 0x10, 0x21, 0x68, 0x01, 0x20, 0x10, 0x3f, 0x77, 0x77, 0x00, 0x70, 0x10, 0x62, 0x12, 
+	0x35, 0x00, 0x00, 0x53, 0x14, 0x01, 0x51, 0x55, 0x45, 0x12, 0x40, 0x10, 0x00, 0xba, 0x81, 0x60, 
+	0x88, 0x00, 0x1b, 0x00, 0x00, 0x03, 0x48, 0x88, 0x01, 0x70, 0x13, 0x02, 0x77, 0x00, 0x01, 0x36, 
+	0x01, 0x66, 0x01, 0x30, 0x3b, 0x55, 0x00, 0x80, 0x00, 0x7c, 0x11, 0x01, 0x86, 0x88, 0x88, 0x00, 
+	0x01, 0x86, 0xa0, 0x00, 0x27, 0x88, 0x00, 0x67, 0x00, 0x47, 0x12, 0x73, 0x14, 0x11, 0x88, 0x00, 
+	0x9f, 0x00, 0x35, 0x00, 0x50, 0x70, 0x3f, 0x86, 0x88, 0x01, 0x00, 0x10, 0x80, 0x48, 0x11, 0x00, 
+	0x06, 0x68, 0x00, 0x00, 0x77, 0x13, 0x00, 0x72, 0x14, 0x46, 0x01, 0x40, 0x00, 0x16, 0x54, 0x03, 
+	0x02, 0x50, 0x14, 0x41, 0x55, 0x00, 0x45, 0x11, 0x10, 0x1f, 0x88, 0x02, 0x88, 0x88, 0x00, 0x18, 
+	0x11, 0x11, 0x82, 0x00, 0x7c, 0x88, 0x1d, 0x00, 0x14, 0x00, 0x40, 0x00, 0xff, 0x11, 0x63, 0x80, 
+	0x00, 0xbf, 0x60, 0x00, 0x37, 0x00, 0x86, 0x14, 0x82, 0x08, 0x06, 0x86, 0x02, 0x80, 0x00, 0xa5, 
+	0x77, 0x47, 0x11, 0x00, 0x66, 0x12, 0x61, 0x06, 0x01, 0x55, 0x03, 0x50, 0x00, 0x15, 0x51, 0x55, 
+	0x55, 0x20, 0x3f, 0x80, 0x50, 0x00, 0x1f, 0x68, 0x01, 0x60, 0x18, 0x74, 0x13, 0x70, 0x00, 0x00, 
+	0x17, 0x40, 0x66, 0x66, 0x14, 0x00, 0x31, 0x00, 0x55, 0x07, 0x13, 0x50, 0x55, 0x24, 0x01, 0x00, 
+	0x00, 0x1f, 0x31, 0x6f, 0x10, 0xdb, 0xfe, 0x11, 0x17, 0x00, 0x11, 0x6f, 0x10, 0x07, 0x71, 0x7b, 
+	0x00, 0x1a, 0x00, 0x00, 0x9f, 0x00, 0x03, 0x60, 0x38, 0x16, 0x66, 0x00, 0x11, 0x4f, 0xc1, 0xf0, 
+	0x21, 0x9e, 0x02, 0x00, 0x00, 0x80, 0x30, 0x48, 0x01, 0x10, 0x9e, 0x11, 0x9e, 0x10, 0x10, 0x66, 
+	0x02, 0x0e, 0x6d, 0x51, 0x25, 0x00, 0x3f, 0x00, 0x55, 0x00, 0x08, 0x70, 0x2f, 0x00, 0xc7, 0x59, 
+	0x00, 0x16, 0x11, 0x4f, 0x66, 0x00, 0x7f, 0x92, 0x03, 0x00, 0x80, 0x28, 0x00, 0x2a, 0x90, 0x00, 
+	0x42, 0x00, 0x00, 0x81, 0x10, 0x08, 0x77, 0x02, 0x00, 0x60, 0x69, 0x00, 0x36, 0x21, 0xdc, 0x11, 
+	0xe3, 0x20, 0x10, 0x25, 0x00, 0x88, 0x88, 0x00, 0x5e, 0x08, 0x81, 0x08, 0x80, 0x00, 0x18, 0x00, 
+	0xa4, 0x11, 0x77, 0x13, 0xae, 0x20, 0x40, 0x1f, 0x0e, 0xba, 0x50, 0x00, 0x63, 0x10, 0x07, 0x10, 
+	0x00, 0x01, 0x18, 0x20, 0x80, 0x01, 0x01, 0xa7, 0x18, 0x00, 0x10, 0x17, 0x71, 0x11, 0x04, 0x00, 
+	0x16, 0x60, 0x00, 0x01, 0x50, 0x01, 0x7f, 0x10, 0x15, 0x00, 0x51, 0x04, 0x11, 0x00, 0x11, 0x10, 
+	0x01, 0x0e, 0x1c, 0x48, 0x01, 0x00, 0x80, 0x46, 0x86, 0x01, 0x80, 0x14, 0x01, 0x84, 0x00, 0x02, 
+	0x74, 0x02, 0x72, 0x14, 0x64, 0x00, 0x7f, 0x00, 0x00, 0x55, 0x11, 0x51, 0x15, 0x45, 0x01, 0x40, 
+	0x00, 0x15, 0x6e, 0x11, 0x01, 0x01, 0x11, 0x97, 0x88, 0x00, 0x01, 0xff, 0x10, 0xe5, 0x02, 0x9f, 
+	0x12, 0x00, 0x00, 0x66, 0x11, 0x61, 0x16, 0x55, 0x01, 0x52, 0x14, 0x00, 0x70, 0x55, 0x01, 0x9f, 
+	0x00, 0xa6, 0x00, 0x3f, 0x00, 0x88, 0x02, 0x84, 0x28, 0x0e, 0x41, 0x28, 0x88, 0x40, 0x12, 0x0f, 
+	0x1d, 0x79, 0x10, 0xde, 0x53, 0x01, 0x15, 0x00, 0x30, 0x25, 0x31, 0x55, 0x55, 0x13, 0x31, 0x9f, 
+	0x00, 0x02, 0x46, 0x00, 0x88, 0x21, 0x88, 0x04, 0x92, 0x00, 0x7f, 0x55, 0x01, 0x21, 0x55, 0x13, 
+	0x55, 0x55, 0x01, 0x34, 0x01, 0x10, 0xe6, 0xb8, 0x11, 0xbf, 0x0e, 0x89, 0x00, 0x02, 0x21, 0x02, 
+	0x3e, 0x47, 0x01, 0x66, 0xb7, 0x00, 0x00, 0x33, 0x55, 0x00, 0x0b, 0x02, 0x23, 0x05, 0x00, 0x11, 
+	0x07, 0xf0, 0x1f, 0x40, 0x1f, 0xe0, 0x10, 0x00, 0xe5, 0x00, 0x03, 0xb0, 0x7f, 0x77, 0x17, 0x66, 
+	0x00, 0x02, 0x61, 0x07, 0x16, 0x53, 0x15, 0x50, 0x15, 0x00, 0x60, 0x7f, 0x21, 0x9d, 0x30, 0x03, 
+	0xa0, 0x00, 0x00, 0xbf, 0x17, 0x30, 0xbf, 0x50, 0x15, 0x55, 0x01, 0x00, 0x40, 0xfc, 0x02, 0x6b, 
+	0x12, 0xe0, 0x42, 0xfb, 0x00, 0xd2, 0xff, 0x61, 0xe3, 0x03, 0x40, 0x00, 0x84, 0x00, 0xcc, 0x60, 
+	0x20, 0x20, 0xbf, 0x04, 0x54, 0x12, 0x00, 0x9f, 0x32, 0x7f, 0x01, 0x80, 0x81, 0x00, 0xdb, 0x00, 
+	0x68, 0x01, 0x88, 0x81, 0x16, 0x00, 0x00, 0x9e, 0x90, 0x02, 0x84, 0x61, 0x24, 0x00, 0xc0, 0x45, 
+	0x07, 0x02, 0x44, 0x00, 0x01, 0x51, 0x24, 0x21, 0x3f, 0x33, 0x01, 0x20, 0x00, 0x03, 0xf0, 0x21, 
+	0x1f, 0x40, 0xbb, 0x00, 0xdf, 0x00, 0x21, 0xe7, 0x48, 0x01, 0x40, 0x18, 0x00, 0x88, 0x04, 0x14, 
+	0x84, 0x18, 0x88, 0x68, 0x02, 0xa0, 0x77, 0x74, 0x00, 0x74, 0x17, 0x46, 0x62, 0x42, 0x16, 0x1c, 
+	0x45, 0x00, 0x11, 0x41, 0x11, 0x7f, 0x20, 0x9f, 0x01, 0xdd, 0x00, 0x18, 0x88, 0x95, 0x01, 0xdd, 
+	0x88, 0x86, 0x00, 0x00, 0xbf, 0x42, 0x10, 0xbf, 0x64, 0x00, 0xbf, 0x40, 0x00, 0x51, 0x40, 0xbf, 
+	0x00, 0x11, 0x62, 0x88, 0x68, 0x00, 0x02, 0x18, 0x86, 0x12, 0x82, 0x01, 0x9f, 0x71, 0x00, 0x5f, 
+	0x54, 0x12, 0x52, 0x30, 0x14, 0x42, 0x43, 0x00, 0x3f, 0x01, 0x3f, 0x04, 0x88, 0x11, 0x81, 0xb0, 
+	0x00, 0x50, 0xff, 0x13, 0xd1, 0x3f, 0xe0, 0x3f, 0x51, 0x00, 0x62, 0x14, 0x54, 0x01, 0x12, 0x55, 
+	0x12, 0x42, 0x00, 0x55, 0x24, 0x15, 0xf0, 0x3f, 0xa6, 0x10, 0x3f, 0x00, 0x64, 0x00, 0x3f, 0x51, 
+	0x14, 0x01, 0x43, 0x20, 0x00, 0x9f, 0x84, 0x88, 0x02, 0x7f, 0x88, 0x12, 0x41, 0x00, 0x00, 0x1f, 
+	0x00, 0x11, 0x73, 0x00, 0x77, 0x77, 0x00, 0x03, 0x10, 0x11, 0x62, 0x16, 0x45, 0xcf, 0x33, 0x10, 
+	0x5f, 0x41, 0xff, 0x02, 0xe8, 0x3e, 0x31, 0x67, 0xf4, 0x00, 0x5f, 0x01, 0x17, 0x73, 0x60, 0x22, 
+	0x5b, 0x20, 0x00, 0x5f, 0x50, 0xbf, 0x13, 0x53, 0x13, 0xdf, 0x20, 0x00, 0xbf, 0x58, 0x48, 0x03, 
+	0x97, 0x68, 0x00, 0x1b, 0x00, 0x12, 0xa1, 0x71, 0x14, 0x77, 0x85, 0x03, 0xfd, 0x20, 0x36, 0x01, 
+	0x03, 0x2f, 0x3b, 0x54, 0x04, 0xe0, 0xe0, 0x00, 0x00, 0xc0, 0x13, 0xb7, 0x20, 0x03, 0x81, 0x60, 
+	0x00, 0x18, 0x47, 0x47, 0x08, 0x47, 0x17, 0x66, 0x26, 0x00, 0x01, 0x1f, 0x12, 0x41, 0x15, 0x08, 
+	0x25, 0x01, 0x00, 0x10, 0x14, 0x14, 0x60, 0x68, 0x00, 0x00, 0x01, 0x00, 0x68, 0x81, 0x06, 0x80, 
+	0x16, 0x10, 0x68, 0x04, 0x00, 0xa3, 0x48, 0x71, 0x01, 0xd3, 0x46, 0x46, 0x14, 0x00, 0x5d, 0x04, 
+	0x45, 0x01, 0x14, 0x10, 0x45, 0x12, 0x00, 0x00, 0x1f, 0x86, 0x01, 0xd8, 0x61, 0x08, 0x00, 0x80, 
+	0x03, 0x57, 0x86, 0x84, 0x14, 0x00, 0x71, 0xe8, 0x14, 0x00, 0x3f, 0xc0, 0x9f, 0x23, 0x97, 0x68, 
+	0x14, 0xfe, 0x00, 0x01, 0x00, 0x47, 0x86, 0x04, 0x4f, 0x14, 0x01, 0x00, 0x00, 0x45, 0x00, 0x58, 
+	0x54, 0xff, 0x00, 0x52, 0x02, 0x88, 0x00, 0x57, 0x68, 0x20, 0x88, 0x00, 0x4a, 0xff, 0x00, 0x00, 
+	0x5f, 0x46, 0x00, 0x03, 0x45, 0x11, 0x60, 0x00, 0x00, 0x04, 0x14, 0x0f, 0x06, 0x17, 0x03, 0x7b, 
+	0x80, 0x00, 0x3c, 0x81, 0x41, 0x18, 0x70, 0x74, 0x12, 0x00, 0x00, 0x11, 0x00, 0x62, 0x64, 0x00, 
+	0x35, 0x51, 0x31, 0x00, 0x8d, 0x11, 0x1f, 0x12, 0x10, 0x51, 0x00, 0x1f, 0x00, 0x10, 0x3f, 0x11, 
+	0x10, 0x3c, 0xd0, 0xc0, 0x40, 0x00, 0x50, 0x3f, 0x48, 0x00, 0xa0, 0x80, 0x14, 0x00, 0x00, 0x20, 
+	0x80, 0x05, 0x03, 0x70, 0x73, 0x01, 0x27, 0x00, 0x36, 0x01, 0x46, 0x00, 0x13, 0x15, 0x00, 0x54, 
+	0x00, 0x01, 0x51, 0x45, 0x13, 0x0f, 0x25, 0x10, 0x11, 0x00, 0x01, 0xf6, 0x2b, 0x40, 0x01, 0x52, 
+	0x5f, 0x24, 0x00, 0x7b, 0x7c, 0x00, 0x00, 0x03, 0x00, 0x43, 0xe6, 0x00, 0x8f, 0xa4, 0xa6, 0x01, 
+	0x29, 0x10, 0x81, 0x41, 0x01, 0x04, 0x03, 0x64, 0x14, 0x60, 0x14, 0x61, 0x03, 0x5a, 0x20, 0x46, 
+	0x15, 0x03, 0x5c, 0x80, 0x08, 0x43, 0x1e, 0x00, 0x00, 0xc3, 0x70, 0x10, 0x17, 0x41, 0x07, 0x01, 
+	0x1e, 0x00, 0x16, 0x50, 0x15, 0x30, 0x50, 0x15, 0x04, 0x43, 0x00, 0x13, 0xa4, 0xef, 0x86, 0x88, 
+	0x02, 0x40, 0x10, 0x00, 0x28, 0x31, 0x18, 0x01, 0xe2, 0x11, 0x40, 0x26, 0x00, 0x00, 0x1c, 0x16, 
+	0x10, 0x54, 0x50, 0x1f, 0x43, 0x00, 0x5c, 0x03, 0xc7, 0x70, 0x14, 0x15, 0x71, 0x17, 0x00, 0x60, 
+	0x01, 0xdf, 0x50, 0x02, 0x1f, 0x20, 0x10, 0x00, 0x5f, 0x80, 0x96, 0xeb, 0x87, 0x78, 0x00, 0x40, 
+	0x00, 0x18, 0x11, 0x14, 0x53, 0x70, 0x03, 0xa3, 0x40, 0x00, 0x01, 0x71, 0x20, 0x54, 0x02, 0xa1, 
+	0x10, 0x3f, 0x00, 0x19, 0x20, 0x86, 0x16, 0x06, 0xa3, 0x36, 0x67, 0x00, 0x71, 0x17, 0x01, 0x80, 
+	0xc0, 0xb1, 0x9f, 0x80, 0x01, 0xbf, 0x01, 0x80, 0x13, 0x81, 0x14, 0x70, 0x14, 0x79, 0x00, 0x10, 
+	0x66, 0x66, 0x16, 0x00, 0x26, 0x11, 0x51, 0x00, 0x00, 0xc3, 0x45, 0x13, 0x63, 0xde, 0x30, 0xbf, 
+	0x00, 0x17, 0xae, 0x30, 0xbf, 0x00, 0x04, 0x21, 0x00, 0x00, 0x02, 0xdf, 0x05, 0x20, 0x10, 0x1c, 
+	0x20, 0xfe, 0x00, 0x02, 0x09, 0x12, 0x9b, 0xf2, 0x9f, 0x30, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x03, 
+	0x06, 0x6e, 0x55, 0x40, 0x00, 0x12, 0x84, 0x3e, 0x80, 0x16, 0x70, 0x17, 0x47, 0x00, 0x11, 0x14, 
+	0x60, 0x66, 0x14, 0x04, 0x5d, 0x45, 0x02, 0x00, 0x22, 0x51, 0x04, 0x4e, 0x10, 0x00, 0x30, 0x88, 
+	0x00, 0x00, 0x2f, 0xf4, 0x5f, 0xe0, 0xbf, 0x80, 0x02, 0x00, 0x84, 0x82, 0x02, 0x80, 0x48, 0x48, 
+	0x01, 0x23, 0x00, 0x17, 0x00, 0x17, 0x60, 0x14, 0x16, 0x16, 0x50, 0x00, 0x14, 0x15, 0xd9, 0x13, 
+	0x7f, 0x76, 0x07, 0x86, 0x00, 0x14, 0x09, 0x02, 0x43, 0x14, 0x10, 0x00, 0x1f, 0x00, 0xb0, 0x00, 
+	0xc3, 0x14, 0x40, 0xbf, 0x71, 0x7f, 0x00, 0x00, 0x40, 0x38, 0x31, 0x47, 0x17, 0x00, 0x62, 0x00, 
+	0x17, 0x40, 0x36, 0x91, 0x7f, 0x40, 0x3f, 0x03, 0x00, 0xc7, 0x20, 0x80, 0x18, 0x11, 0x9f, 0x30, 
+	0x17, 0x00, 0x60, 0x66, 0x66, 0x3d, 0x13, 0x50, 0x05, 0xdd, 0x00, 0x10, 0x82, 0x50, 0x01, 0x05, 
+	0x47, 0x18, 0x01, 0x00, 0x3f, 0x5d, 0x18, 0x11, 0x3f, 0x30, 0x31, 0x3f, 0x00, 0x40, 0xa4, 0x40, 
+	0x01, 0x68, 0x05, 0x03, 0x1f, 0x00, 0x88, 0x38, 0x11, 0x13, 0x03, 0x62, 0xe3, 0x96, 0x00, 0xee, 
+	0x07, 0xa7, 0x01, 0xbf, 0x00, 0x01, 0x00, 0x00, 0x74, 0x77, 0x03, 0x00, 0x10, 0x61, 0x7d, 0x16, 
+	0x00, 0x12, 0x1f, 0x37, 0xff, 0x37, 0x3f, 0x26, 0x7f, 0x00, 0x51, 0xbf, 0x40, 0x00, 0x56, 0x1e, 
+	0x20, 0x54, 0x00, 0x05, 0x00, 0x40, 0x70, 0xdf, 0x03, 0xe3, 0x10, 0x00, 0x03, 0x70, 0x8b, 0x04, 
+	0x03, 0x60, 0x04, 0x60, 0x00, 0x08, 0x9f, 0x45, 0x10, 0xbf, 0xa0, 0x1f, 0x02, 0x00, 0x60, 0x04, 
+	0x80, 0x14, 0x30, 0x16, 0x06, 0xe3, 0x00, 0x25, 0x0d, 0x46, 0x11, 0x00, 0x53, 0x07, 0x00, 0x00, 
+	0x91, 0x3f, 0x15, 0x06, 0xe5, 0x00, 0x16, 0x18, 0x00, 0x18, 0x60, 0x17, 0x17, 0x17, 0x30, 0x03, 
+	0x36, 0x00, 0x36, 0x16, 0x10, 0x53, 0x53, 0x01, 0x1d, 0x80, 0x00, 0xff, 0x94, 0x00, 0x3b, 0x10, 
+	0x38, 0x03, 0x44, 0x00, 0x71, 0x03, 0xc0, 0x46, 0x36, 0xb8, 0x09, 0x7e, 0x00, 0x51, 0x04, 0xab, 
+	0x70, 0x40, 0x60, 0x7f, 0x04, 0x00, 0x70, 0x16, 0x85, 0x02, 0x3f, 0x14, 0x00, 0x11, 0x00, 0x54, 
+	0x08, 0x03, 0x34, 0x70, 0x1f, 0xbe, 0x12, 0x00, 0x7f, 0x11, 0x13, 0x84, 0x10, 0x3f, 0x09, 0xe2, 
+	0x00, 0x17, 0x43, 0x53, 0x5f, 0x78, 0xfe, 0x03, 0x5b, 0x00, 0xa3, 0xbe, 0x17, 0xe3, 0x20, 0x9f, 
+	0x39, 0x17, 0x00, 0x09, 0x3a, 0x20, 0x03, 0x70, 0xe6, 0x19, 0x94, 0x00, 0x17, 0x9b, 0x86, 0x5f, 
+	0x88, 0x04, 0x07, 0xdb, 0x00, 0x02, 0x17, 0x80, 0xf6, 0x12, 0x5f, 0x00, 0x23, 0x00, 0x01, 0xdc, 
+	0x12, 0x5b, 0x00, 0x24, 0x9d, 0x61, 0x00, 0x3e, 0x28, 0x2d, 0x60, 0x16, 0x00, 0xbf, 0x11, 0x00, 
+	0x14, 0x9f, 0x00, 0x43, 0x35, 0x09, 0xc1, 0x0c, 0x00, 0x13, 0x40, 0x14, 0x20, 0x26, 0xbf, 0x00, 
+	0x62, 0x00, 0x81, 0x81, 0x0c, 0x02, 0x10, 0x68, 0x28, 0x04, 0x00, 0xdf, 0x00, 0x33, 0x46, 0x26, 
+	0x06, 0x00, 0x50, 0x00, 0x52, 0x51, 0x02, 0x24, 0x5b, 0x43, 0xef, 0x00, 0x50, 0x00, 0x10, 0x07, 
+	0x80, 0x10, 0x08, 0x58, 0x00, 0x00, 0xef, 0x00, 0x3d, 0x52, 0x4a, 0xd6, 0x5a, 0x39, 0x67, 0x9c, 
+	0x00, 0x73, 0xde, 0x7b, 0xff, 0x7f, 0xff, 0x7f, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x1f, 0xea, 
+	0x3d, 0x4c, 0x4a, 0xcf, 0x00, 0x5a, 0x31, 0x67, 0x92, 0x73, 0xd4, 0x7b, 0xf7, 0x3c, 0x7f, 0xfc, 
+	0xa0, 0x1f, 0xfe, 0xeb, 0xfe, 0xeb, 0x20, 0x01, 0x80, 0x58, 0x00, 0xe2, 0x01, 0x00, 0xd9, 0x54, 
+	0x00, 0xf1, 0x9a, 0x03, 0x57, 0xb8, 0xf4, 0x9a, 0xe5, 0x40, 0xc0, 0x0f, 0x00, 0x0b, 0x10, 0xe4, 
+	0x01, 0x10, 0x00, 0x03, 0x04, 0x80, 0xe1, 0x00, 0x04, 0x58, 0xa0, 0xe1, 0x01, 0x8c, 0xb0, 0x1f, 
+	0x24, 0x0c, 0x00, 0xa0, 0xe1, 0x25, 0xc8, 0xa0, 0xe1, 0x0f, 0x1a, 0x00, 0x0c, 0xe2, 0x01, 0x2b, 
+	0x8a, 0xe2, 0x00, 0xe0, 0x01, 0x8f, 0xe2, 0x21, 0xf5, 0x92, 0xe7, 0x80, 0xd0, 0x47, 0x10, 0x58, 
+	0x85, 0xe2, 0xd0, 0x13, 0x02, 0x32, 0x03, 0xe2, 0x00, 0x01, 0x54, 0x85, 0xe2, 0xff, 0x04, 0x15, 
+	0xe3, 0x04, 0x01, 0x31, 0x83, 0x03, 0x0f, 0x10, 0x07, 0x32, 0x83, 0x61, 0x03, 0xd0, 0x83, 0x10, 
+	0x27, 0x02, 0x31, 0x83, 0xe3, 0x50, 0x1f, 0x18, 0x01, 0x54, 0x45, 0x60, 0x33, 0xf0, 0xaf, 0xd9, 
+	0xe4, 0xff, 0x01, 0x58, 0x05, 0xe2, 0x00, 0x5c, 0x85, 0xe1, 0xd0, 0x6f, 0x00, 0x00, 0x30, 0xa0, 
+	0xe3, 0x04, 0x40, 0x94, 0xe0, 0x00, 0x02, 0x32, 0x83, 0x23, 0x01, 0x44, 0x84, 0x23, 0xb0, 0xe0, 
+	0x3b, 0xc0, 0x00, 0xe7, 0x00, 0x3f, 0x00, 0xc4, 0x8c, 0xe1, 0x20, 0x2b, 0x08, 0xf0, 0xd3, 0x01, 
+	0xc0, 0x8c, 0xe2, 0x2b, 0xc8, 0x00, 0xef, 0xd0, 0x17, 0x05, 0x8d, 0xc0, 0x47, 0x31, 0x03, 0xe2, 
+	0x00, 0x05, 0x10, 0x27, 0xe0, 0x05, 0x70, 0x97, 0xe0, 0x12, 0x07, 0x10, 0x21, 0x30, 0x6f, 0x02, 
+	0x11, 0x10, 0xbb, 0x13, 0xc2, 0xd0, 0x93, 0x11, 0x3b, 0x2c, 0x16, 0xe0, 0xe1, 0x10, 0x4b, 0x01, 
+	0x02, 0xf1, 0x9a, 0xe7, 0x00, 0x4c, 0xa0, 0xe0, 0xb7, 0x01, 0x21, 0x58, 0x45, 0xe1, 0x3b, 0x05, 
+	0x04, 0xa0, 0xe1, 0x21, 0x3f, 0x14, 0x04, 0x90, 0xe2, 0x31, 0x3b, 0x10, 0x21, 0x1b, 0xff, 0x54, 
+	0x03, 0x05, 0xe2, 0x20, 0x54, 0x85, 0xe1, 0xd0, 0xdb, 0x50, 0x2f, 0xc7, 0x31, 0x47, 0x30, 0x2b, 
+	0x01, 0x04, 0x50, 0x20, 0x3b, 0xf0, 0x33, 0x81, 0x4b, 0x98, 0x00, 0x1b, 0x00, 0x58, 0xf1, 0x4b, 
+	0x11, 0x4b, 0xa4, 0x4c, 0xb0, 0x80, 0x00, 0x53, 0x83, 0x23, 0x80, 0x40, 0x84, 0x23, 0x04, 0xed, 
+	0x00, 0xb7, 0xf0, 0x3f, 0x82, 0x3b, 0x68, 0xf2, 0x3b, 0x12, 0x3b, 0x26, 0xf2, 0x3b, 0x99, 0xf2, 
+	0x3b, 0x68, 0x86, 0xf2, 0x3b, 0x10, 0xfb, 0x64, 0x86, 0x02, 0x07, 0x7c, 0x16, 0x42, 0x3b, 0x00, 
+	0x07, 0xf2, 0x3b, 0x82, 0x3b, 0x30, 0x1f, 0x01, 0x64, 0x70, 0x46, 0x60, 0x33, 0xf0, 0xaf, 0x00, 
+	0xef, 0x68, 0x06, 0xe2, 0x00, 0x21, 0x6c, 0x86, 0xe0, 0xef, 0x02, 0x02, 0x13, 0xe3, 0x10, 0xf3, 
+	0x0c, 0x02, 0x45, 0x84, 0x13, 0x52, 0x43, 0xd0, 0x3f, 0xd1, 0x00, 0x03, 0xd9, 0xe0, 0x00, 0x90, 
+	0x89, 0xe0, 0xd0, 0x3b, 0x50, 0x17, 0x0b, 0x04, 0x00, 0x70, 0xe3, 0x03, 0xb6, 0x0b, 0xe0, 0xdf, 
+	0x02, 0x2f, 0x5f, 0x06, 0x02, 0x2f, 0x06, 0xf2, 0x2f, 0xe2, 0x2f, 0x11, 0x2f, 0xf2, 0x2f, 0xd1, 
+	0x2f, 0x58, 0x46, 0xe1, 0x2f, 0x06, 0xf2, 0x2f, 0x32, 0x2f, 0x64, 0x06, 0xe2, 0x1f, 0x20, 0x64, 
+	0x86, 0xe1, 0xbb, 0x50, 0x2f, 0xf2, 0x2f, 0xf0, 0x33, 0xa1, 0x3f, 0x90, 0x00, 0x1b, 0x00, 0x68, 
+	0xf1, 0x3f, 0x03, 0xf0, 0x28, 0xe1, 0x91, 0x11, 0x3f, 0x64, 0x40, 0x00, 0x57, 0x05, 0x14, 0xe3, 
+	0x00, 0xe3, 0x04, 0x13, 0x02, 0x45, 0xc4, 0xe3, 0xe0, 0x43, 0x01, 0x13, 0x66, 0xe3, 0x41, 0x2f, 
+	0x0b, 0xb0, 0x48, 0x02, 0xe0, 0xdb, 0x40, 0x1f, 0xf8, 0x15, 0xff, 0xff, 0x1a, 0x51, 0x53, 0x03, 
+	0x01, 0x53, 0xc0, 0xc0, 0x27, 0x10, 0x44, 0x10, 0x1a, 0x00, 0x8f, 0x59, 0xe1, 0x09, 0x00, 0x00, 
+	0x00, 0x0a, 0x1e, 0xff, 0x2f, 0xe1, 0x00, 0x20, 0x02, 0xd9, 0xe5, 0xfa, 0x00, 0x52, 0xe3, 0x00, 
+	0x0b, 0x11, 0x90, 0x02, 0x93, 0xe5, 0x02, 0x00, 0x0f, 0x02, 0x14, 0x81, 0xe1, 0x00, 0xbc, 0xc4, 
+	0x5a, 0xe1, 0x0c, 0x00, 0x51, 0xe1, 0x80, 0x10, 0x17, 0x0f, 0x80, 0x08, 0xe2, 0x01, 0x10, 0xa0, 
+	0x06, 0xe3, 0x48, 0x10, 0x4a, 0xe5, 0x10, 0x33, 0xa2, 0xbf, 0x78, 0xd0, 0xf2, 0xbf, 0x12, 0xbf, 
+	0x27, 0xf2, 0xbf, 0xe7, 0x01, 0x78, 0x87, 0xe5, 0xe1, 0x7f, 0xf0, 0x13, 0x42, 0xc3, 0x74, 0x87, 
+	0x02, 0x8f, 0x17, 0x42, 0xc3, 0xf1, 0x00, 0x07, 0xf2, 0xc3, 0x82, 0xc3, 0x30, 0x1f, 0x01, 0x74, 
+	0x47, 0x60, 0x33, 0xc0, 0xf1, 0x83, 0x01, 0x83, 0x78, 0x07, 0xe2, 0x00, 0x7c, 0x87, 0xd6, 0xf2, 
+	0x17, 0x71, 0x5b, 0x10, 0x01, 0x5b, 0x12, 0xf0, 0x1f, 0x30, 0x1f, 0xa1, 0x11, 0xff, 0xff, 0x0a, 
+	0x51, 0x5b, 0xac, 0xff, 0xff, 0xe1, 0x5b, 0xbf, 0x12, 0xaf, 0x07, 0x02, 0xab, 0x32, 0xa7, 0x20, 
+	0x93, 0xe2, 0xa7, 0x11, 0x17, 0x92, 0xa7, 0xeb, 0x10, 0xff, 0xf2, 0xab, 0x11, 0x17, 0x47, 0xe1, 
+	0x17, 0x07, 0xf2, 0xab, 0x32, 0xab, 0x03, 0x74, 0x07, 0xe2, 0x20, 0x74, 0x87, 0xe2, 0x77, 0x50, 
+	0x2f, 0xf2, 0xf2, 0xab, 0xf0, 0x33, 0xa1, 0x27, 0x00, 0x1b, 0x00, 0x78, 0xf1, 0x27, 0xff, 0x03, 
+	0x44, 0x24, 0xe2, 0x09, 0x32, 0x83, 0xe2, 0x9b, 0x14, 0x03, 0xd6, 0xf2, 0x9b, 0xf0, 0x1f, 0x51, 
+	0x82, 0x9b, 0x5c, 0xf1, 0x3f, 0xb5, 0x17, 0xb8, 0xf1, 0xf2, 0x57, 0xf2, 0x57, 0x52, 0x57, 0xf1, 
+	0x2b, 0x01, 0xb8, 0x8b, 0xe0, 0x13, 0xc0, 0xd1, 0x7b, 0x21, 0x4b, 0x00, 0x80, 0xe2, 0xff, 0x00, 
+	0x10, 0xbf, 0x31, 0x4f, 0x00, 0x31, 0x23, 0xd0, 0x5f, 0xd0, 0xa7, 0xf0, 0x47, 0x41, 0x63, 0x40, 
+	0x3f, 0x3f, 0x01, 0x00, 0x31, 0x63, 0xf0, 0x47, 0xf0, 0xef, 0xf0, 0xcf, 0xf0, 0x27, 0x12, 0x57, 
+	0xf9, 0x02, 0x53, 0xf1, 0x77, 0x71, 0x77, 0xf2, 0xb7, 0x80, 0x1f, 0xf3, 0xfe, 0x72, 0xb7, 0x35, 
+	0xfe, 0xfe, 0xf1, 0x77, 0x10, 0x5f, 0x0b, 0x05, 0x67, 0x0b, 0xf5, 0x67, 0xd9, 0xf2, 0xbf, 0xe2, 
+	0xbf, 0x47, 0xf2, 0xbf, 0x53, 0xc3, 0x44, 0x94, 0x42, 0xa7, 0x71, 0x14, 0xf3, 0xbf, 0xa3, 0xbf, 
+	0x30, 0x1f, 0x01, 0x44, 0x54, 0x20, 0x2f, 0xe4, 0xf2, 0x93, 0x08, 0x7b, 0xf0, 0x63, 0xe5, 0x06, 
+	0x10, 0x3f, 0x32, 0x23, 0x6c, 0xe2, 0xd0, 0x2f, 0x18, 0xe7, 0x05, 0xf7, 0xb7, 0x20, 0x17, 0xff, 
+	0x04, 0xb7, 0x05, 0x87, 0x50, 0xf0, 0x1b, 0x10, 0x1b, 0x06, 0xf0, 0x33, 0x40, 0x33, 0x03, 0x0f, 
+	0xde, 0xf0, 0x33, 0x20, 0x1b, 0x07, 0xf0, 0x33, 0xe1, 0x23, 0xf9, 0x77, 0x70, 0x3f, 0x04, 0xad, 
+	0xf0, 0x57, 0xe5, 0x18, 0x5b, 0x25, 0xf0, 0x57, 0x20, 0x17, 0x26, 0x00, 0x17, 0x19, 0xff, 0x5c, 
+	0xc5, 0xe2, 0x0b, 0x10, 0x1b, 0xff, 0x08, 0xf0, 0xdb, 0xbf, 0x50, 0x1b, 0x27, 0xf0, 0x37, 0x80, 
+	0x37, 0xf0, 0xdf, 0xf0, 0xc7, 0x00, 0xc7, 0xf8, 0xf3, 0xa9, 0x60, 0x43, 0x24, 0xf0, 0xaf, 0xe5, 
+	0x18, 0x33, 0xff, 0x04, 0x00, 0x33, 0x6d, 0x60, 0xf7, 0x13, 0x10, 0x1b, 0x05, 0xf7, 0x2b, 0x20, 
+	0x17, 0x06, 0xf0, 0x17, 0xf7, 0x40, 0x4b, 0x00, 0xa7, 0xf0, 0x4b, 0x20, 0x1b, 0x07, 0xf0, 0x33, 
+	0xf0, 0xbf, 0xf8, 0xc3, 0xaa, 0x60, 0x3f, 0x04, 0xf0, 0x57, 0xe5, 0x17, 0xb3, 0x25, 0x00, 0x57, 
+	0xff, 0x33, 0x6c, 0xc6, 0xf1, 0x37, 0x00, 0x1b, 0xff, 0x08, 0xf0, 0xdb, 0x50, 0x1b, 0x6f, 0x26, 
+	0xf0, 0x8f, 0x20, 0x17, 0x27, 0xf0, 0x4f, 0x80, 0x4f, 0xf0, 0xdf, 0xf0, 0xc7, 0xeb, 0x00, 0xc7, 
+	0xf8, 0x4b, 0x60, 0x43, 0x24, 0xf0, 0x77, 0xe5, 0x16, 0xf7, 0x21, 0x87, 0x6f, 0x70, 0xf5, 0xef, 
+	0x10, 0x1b, 0x05, 0xf6, 0x07, 0x40, 0x33, 0x00, 0x67, 0xf0, 0x33, 0xb7, 0x20, 0x1b, 0x06, 0xf0, 
+	0x33, 0x20, 0x17, 0x07, 0xf0, 0x17, 0xf0, 0xbf, 0xf7, 0x87, 0xaa, 0x60, 0x3f, 0x04, 0xf0, 0x6f, 
+	0xe5, 0x16, 0x8f, 0x25, 0x00, 0x57, 0xff, 0x3e, 0x7c, 0xc7, 0xf1, 0x37, 0x00, 0x1b, 0x21, 0x87, 
+	0xf0, 0x37, 0x20, 0x1b, 0x26, 0xf7, 0xf0, 0x37, 0x80, 0x37, 0xf0, 0xdf, 0x50, 0x1b, 0x27, 0xf0, 
+	0xc7, 0xf0, 0xc7, 0xf7, 0x27, 0xa7, 0x60, 0x3f, 0x24, 0xf0, 0x3f, 0xe5, 0x25, 0xf6, 0xbf, 0xfb, 
+	0xd7, 0x10, 0x27, 0x86, 0x0d, 0x63, 0xff, 0x00, 0x00, 0xe2, 0xf0, 0x2b, 0xf0, 0x2b, 0x26, 0xfc, 
+	0xf0, 0x53, 0xf0, 0x27, 0x10, 0x27, 0xf0, 0x53, 0xf0, 0x2b, 0x40, 0x2b, 0xa1, 0x04, 0x04, 0xda, 
+	0xe5, 0xa2, 0x14, 0xda, 0x05, 0x77, 0x10, 0xe0, 0x00, 0x05, 0x00, 0x00, 0x1a, 0x01, 0x90, 0x49, 
+	0xe2, 0xe0, 0x1a, 0x03, 0xd0, 0xcf, 0x06, 0x73, 0xe2, 0xa8, 0x0f, 0x00, 0xea, 0xe9, 0xf7, 0x97, 
+	0xf0, 0x57, 0x38, 0x3f, 0x05, 0xe0, 0x43, 0x05, 0x44, 0xfd, 0x1f, 0x16, 0xff, 0x44, 0x06, 0xe0, 
+	0x27, 0x06, 0xf0, 0x27, 0x00, 0x27, 0x07, 0xbe, 0xe0, 0x27, 0x07, 0xf0, 0x27, 0xe1, 0xb7, 0xf6, 
+	0x4b, 0x00, 0x4b, 0x13, 0x1f, 0x10, 0x10, 0x24, 0xe0, 0x00, 0x0c, 0xc3, 0x04, 0x30, 0x21, 0xe0, 
+	0x70, 0x01, 0x26, 0x5b, 0x07, 0x07, 0xf6, 0x8f, 0xe5, 0x05, 0x14, 0x24, 0x1f, 0xe0, 0x05, 0x44, 
+	0xf0, 0x27, 0xe0, 0x9f, 0x13, 0x3f, 0xf0, 0x53, 0xf0, 0x2b, 0xdf, 0x10, 0xdf, 0x00, 0x53, 0x06, 
+	0xf0, 0x53, 0xf0, 0x53, 0x15, 0x03, 0xf0, 0x53, 0xf0, 0x2b, 0xdd, 0x11, 0x0b, 0x00, 0x53, 0x07, 
+	0xf0, 0x53, 0xe0, 0x27, 0xe1, 0x1f, 0x1c, 0x00, 0x5f, 0x71, 0x4c, 0xf0, 0x37, 0xd1, 0x33, 0x1d, 
+	0xef, 0x01, 0x32, 0x04, 0xf0, 0x57, 0xc1, 0x82, 0xef, 0x1c, 0xdf, 0x01, 0x0c, 0x40, 0x22, 0x60, 
+	0x00, 0x8b, 0x1f, 0x60, 0x44, 0xb4, 0xf0, 0x8b, 0xf2, 0xfb, 0x22, 0xa7, 0xf0, 0x37, 0xf0, 0x37, 
+	0xff, 0xd3, 0x07, 0xf0, 0x33, 0xf0, 0x33, 0xf3, 0x13, 0xf0, 0x6b, 0xf0, 0x37, 0xc1, 0x2f, 0xf0, 
+	0x6b, 0xff, 0xf0, 0x33, 0xd0, 0x33, 0xf0, 0x6b, 0xf0, 0x37, 0xf0, 0x37, 0xe1, 0x9b, 0xf0, 0x3f, 
+	0xf1, 0xa3, 0xdd, 0xde, 0x5f, 0x0f, 0x9b, 0x23, 0xf1, 0xab, 0xf2, 0xff, 0x32, 0x57, 0x54, 0x70, 
+	0x53, 0xdf, 0x09, 0x9b, 0x00, 0x2f, 0x33, 0xf0, 0x2f, 0x53, 0x03, 0xf0, 0x2b, 0xf0, 0x2b, 0x93, 
+	0x07, 0xff, 0xf0, 0x2f, 0xf0, 0x2f, 0x53, 0x0b, 0xf0, 0x2b, 0xf0, 0x2b, 0x93, 0x0f, 0xf0, 0x2f, 
+	0xf0, 0x2f, 0xfe, 0x53, 0x13, 0xf0, 0x2b, 0xf0, 0x2b, 0xf1, 0x7b, 0x33, 0x17, 0xf0, 0x3b, 0xf1, 
+	0x77, 0x9a, 0x00, 0xe5, 0x00, 0x40, 0xa0, 0xe3, 0x03, 0x31, 0xa0, 0xe1, 0xf6, 0x77, 0x01, 0x67, 
+	0x1a, 0xb3, 0x23, 0x3f, 0xb0, 0xe1, 0x30, 0xb7, 0x47, 0xd4, 0xe0, 0x4f, 0xff, 0x44, 0x14, 0xfb, 
+	0x07, 0x2b, 0x2f, 0x30, 0x37, 0xff, 0x31, 0x7b, 0xf0, 0x37, 0xf0, 0x37, 0x71, 0x7f, 0xf0, 0x73, 
+	0xf0, 0x3b, 0xf0, 0x3b, 0x70, 0x73, 0xff, 0x31, 0x93, 0xf0, 0x37, 0xf0, 0x37, 0x71, 0x97, 0xf0, 
+	0x73, 0xf0, 0x3b, 0xf0, 0x3b, 0x70, 0x73, 0xff, 0x31, 0xab, 0xf0, 0x37, 0xf0, 0x37, 0xf1, 0xaf, 
+	0x3d, 0x97, 0x40, 0x7f, 0x21, 0xb7, 0xf0, 0x47, 0xe4, 0x50, 0x47, 0xd1, 0xbb, 0x20, 0x33, 0x40, 
+	0xa0, 0x00, 0x1f, 0xa0, 0x23, 0x82, 0x01, 0xc3, 0x33, 0x0b, 0x32, 0xa0, 0x23, 0xec, 0x93, 0x32, 
+	0x03, 0xa0, 0xe3, 0x05, 0x40, 0x14, 0xe0, 0xf0, 0x87, 0x40, 0x1b, 0x6f, 0x44, 0xf0, 0x1b, 0x50, 
+	0x1b, 0x06, 0xf0, 0x37, 0x70, 0x1b, 0xf0, 0x37, 0x60, 0x1b, 0x7e, 0x07, 0xf0, 0x37, 0x70, 0x1b, 
+	0xf0, 0x37, 0xf1, 0x13, 0x1d, 0xaf, 0x00, 0x2b, 0x00, 0x76, 0x4c, 0x30, 0x2b, 0xef, 0x33, 0x00, 
+	0x1b, 0x04, 0xf0, 0x63, 0x74, 0x1f, 0x30, 0x9c, 0x00, 0x3b, 0x40, 0x34, 0xf0, 0x1f, 0x12, 0xef, 
+	0x00, 0x1b, 0x05, 0x44, 0xf7, 0xf0, 0x1b, 0x63, 0xff, 0xf0, 0x3b, 0xa0, 0x3b, 0x06, 0xf0, 0x3b, 
+	0x73, 0xdf, 0xf0, 0x3b, 0xbd, 0xa0, 0x3b, 0x07, 0xf0, 0x3b, 0xf0, 0xfb, 0x13, 0xbf, 0x10, 0x47, 
+	0x4c, 0x30, 0x2b, 0x8c, 0xf3, 0xaf, 0xa0, 0xe3, 0x01, 0xf3, 0xaf, 0x80, 0xf7, 0x94, 0xe1, 0xff, 
+	0xf0, 0x63, 0x50, 0xf7, 0xf0, 0x1b, 0xb0, 0xf7, 0xf0, 0x1f, 0x70, 0xf7, 0xf0, 0x1b, 0xb0, 0xf7, 
+	0xff, 0xf0, 0x1f, 0x70, 0xf7, 0xf0, 0x1b, 0xf0, 0xf7, 0x50, 0xf7, 0x30, 0x2b, 0xe0, 0xf7, 0x00, 
+	0x1b, 0xe1, 0x06, 0x1b, 0xf0, 0x47, 0x96, 0x13, 0x00, 0x54, 0xe0, 0x00, 0xf4, 0xf3, 0xdf, 0xf6, 
+	0x13, 0x14, 0x97, 0x04, 0xf0, 0x2b, 0xf0, 0x2b, 0x86, 0x13, 0xf0, 0x5b, 0xf0, 0x2f, 0xff, 0x56, 
+	0x13, 0xf0, 0x5b, 0xf0, 0x2b, 0x96, 0x13, 0xf0, 0x5b, 0xf0, 0x2f, 0x56, 0x13, 0xf0, 0x5b, 0xee, 
+	0xf0, 0x2b, 0xf1, 0x5b, 0x36, 0x13, 0x0c, 0xf0, 0x3b, 0xf1, 0x6b, 0x03, 0x5f, 0x01, 0x02, 0x13, 
+	0xe3, 0x68, 0x00, 0x00, 0x0a, 0xd0, 0x17, 0x0f, 0x00, 0x12, 0x0b, 0xe2, 0x11, 0x2d, 0x8a, 0xe2, 
+	0x21, 0x00, 0x1d, 0x92, 0xe7, 0x2b, 0x58, 0xd1, 0xe7, 0x01, 0x05, 0xb8, 0x8b, 0xe2, 0x2b, 0x08, 
+	0x30, 0x07, 0x00, 0x0f, 0x57, 0x04, 0x05, 0x58, 0xa0, 0xe1, 0xc0, 0xf0, 0x4b, 0xe3, 0x0a, 0x84, 
+	0x00, 0x4b, 0x02, 0x90, 0x89, 0xe2, 0xf0, 0x1b, 0x13, 0xe3, 0x00, 0xf8, 0xff, 0xff, 0x1a, 0xff, 
+	0xff, 0xff, 0xea, 0x10, 0x44, 0x10, 0x1a, 0x0b, 0xc7, 0x59, 0xe1, 0x0b, 0x00, 0x20, 0x00, 0x0b, 
+	0x00, 0x23, 0xe4, 0x00, 0x10, 0xd9, 0xe5, 0x14, 0x01, 0x94, 0x80, 0x0b, 0xab, 0x09, 0x30, 0x73, 
+	0x05, 0x92, 0x00, 0xe7, 0xc4, 0x04, 0x8a, 0xe5, 0x00, 0x90, 0x89, 0x18, 0xe0, 0x01, 0x8c, 0xc0, 
+	0x97, 0x0b, 0xf3, 0x01, 0x10, 0xa0, 0x00, 0xe3, 0x48, 0x10, 0x4a, 0xe5, 0x1e, 0xff, 0x2f, 0x58, 
+	0xe1, 0x10, 0x57, 0x5b, 0xf0, 0x73, 0x69, 0xb7, 0x02, 0xb8, 0x5b, 0x50, 0xe2, 0x60, 0xcb, 0x2d, 
+	0x00, 0xcb, 0x08, 0xc2, 0x47, 0x01, 0x06, 0xc8, 0x9b, 0xe2, 0x20, 0x04, 0x01, 0x33, 0x00, 0x0b, 
+	0x06, 0x07, 0x02, 0x11, 0x43, 0xf8, 0x07, 0x00, 0x87, 0xc0, 0x67, 0x20, 0x97, 0xe0, 0xfa, 0x73, 
+	0xf8, 0xcf, 0x00, 0x2b, 0x38, 0x10, 0x00, 0xe2, 0xc4, 0x41, 0x04, 0x02, 0xb7, 0x00, 0x49, 0xe0, 
+	0x01, 0x90, 0xc0, 0x73, 0x42, 0xcd, 0x10, 0x73, 0xcc, 0x47, 0x01, 0x18, 0x30, 0x73, 0x21, 0xf7, 
+	0x00, 0x0b, 0x10, 0xe7, 0xf0, 0xe3, 0xb1, 0x2b, 0x03, 0x0c, 0xe3, 0xd0, 0x67, 0x1c, 0xdb, 0xa7, 
+	0xa1, 0x97, 0x98, 0xc1, 0x97, 0x94, 0x89, 0xf1, 0x43, 0xf0, 0x5f, 0x20, 0x5f, 0x70, 0xa0, 0x01, 
+	0x8b, 0xf1, 0x33, 0x30, 0x1b, 0x8e, 0xff, 0xff, 0x0a, 0x6e, 0x95, 0x01, 0xa7, 0x10, 0x0b, 0x04, 
+	0x00, 0x87, 0xf0, 0x27, 0x00, 0x27, 0x10, 0x02, 0xd9, 0xe4, 0x01, 0x20, 0xd9, 0xe4, 0x50, 0xf7, 
+	0x02, 0x39, 0x94, 0x81, 0xf0, 0xf7, 0xf0, 0xf7, 0xa0, 0x97, 0x06, 0x8d, 0xf1, 0x73, 0xe1, 0xfa, 
+	0x4b, 0xf1, 0x7b, 0xa7, 0x97, 0x02, 0x13, 0xe3, 0xb8, 0x00, 0xaf, 0xd0, 0xf2, 0xbf, 0x81, 0x27, 
+	0x68, 0xc1, 0x27, 0x64, 0x86, 0xe1, 0x06, 0x6e, 0x68, 0xf2, 0xbf, 0x10, 0x4b, 0x5a, 0x00, 0x4b, 
+	0xf0, 0xef, 0x30, 0x1b, 0x48, 0xb7, 0x01, 0x33, 0x4f, 0x01, 0x17, 0x10, 0x0b, 0xbe, 0xf0, 0x27, 
+	0x6b, 0xbf, 0xf2, 0x73, 0xbe, 0xf2, 0x73, 0x5b, 0xf2, 0x73, 0x82, 0x73, 0xf9, 0xcf, 0xf0, 0xfb, 
+	0x30, 0x93, 0x79, 0xc6, 0x00, 0x93, 0xf0, 0x17, 0x13, 0xe3, 0x28, 0xf1, 0xdf, 0x60, 0x1b, 0x16, 
+	0xaf, 0x00, 0xbb, 0x1d, 0x40, 0xc7, 0x8c, 0xf0, 0x27, 0x60, 0x8b, 0xf8, 0xab, 0xf8, 0xab, 0xd0, 
+	0xf0, 0x97, 0xc1, 0x7b, 0x78, 0xc1, 0x7b, 0x74, 0x87, 0xe1, 0x07, 0x7b, 0x78, 0xf1, 0x7b, 0x1c, 
+	0x8b, 0xf1, 0x37, 0xf1, 0x37, 0x0d, 0xf1, 0x37, 0x20, 0xab, 0xc0, 0xf8, 0x43, 0x70, 0x1f, 0xd1, 
+	0x00, 0xd9, 0xe0, 0x0b, 0x24, 0x40, 0xa0, 0x00, 0xc7, 0x22, 0xe0, 0x00, 0x2c, 0x92, 0xe0, 0x43, 
+	0x02, 0x40, 0xc7, 0x00, 0xb8, 0x8b, 0xe0, 0x12, 0x57, 0xe0, 0x8b, 0x12, 0x1e, 0xa0, 0xe1, 0x10, 
+	0x83, 0x01, 0x01, 0x32, 0xab, 0x27, 0x16, 0x98, 0x80, 0xe0, 0xe8, 0xdf, 0xc0, 0x00, 0x73, 0x11, 
+	0xaf, 0xc4, 0x10, 0x8c, 0xe1, 0x24, 0x0d, 0x7b, 0x0f, 0x1a, 0x0c, 0xe2, 0x08, 0x01, 0x2b, 0x8a, 
+	0xe2, 0x15, 0x83, 0x21, 0xf5, 0x92, 0x7e, 0xe7, 0xf0, 0xa3, 0x00, 0x2b, 0xf7, 0xeb, 0xf1, 0x33, 
+	0x11, 0x33, 0x41, 0x2b, 0x2b, 0x40, 0x48, 0x30, 0x07, 0x04, 0x4c, 0xa0, 0xe1, 0xa0, 0x30, 0x14, 
+	0x00, 0xe2, 0x50, 0x0d, 0xab, 0x80, 0x00, 0x6b, 0x83, 0x3b, 0x48, 0x80, 0xf5, 0x7b, 0x80, 0xc8, 
+	0xe8, 0x27, 0x0a, 0x02, 0x03, 0x01, 0xe2, 0x05, 0x12, 0x03, 0xe2, 0xa1, 0x1b, 0x00, 0x3f, 0x03, 
+	0x0c, 0x81, 0xe1, 0x24, 0x08, 0x80, 0xf1, 0x63, 0xf1, 0x63, 0x1f, 0x43, 0xb4, 0x06, 0xf1, 0x63, 
+	0x70, 0xbf, 0xf7, 0xb3, 0xf1, 0x63, 0x81, 0x63, 0x63, 0x78, 0xf1, 0x63, 0x26, 0xdf, 0xb0, 0xa0, 
+	0xe1, 0xe6, 0x8b, 0x81, 0x53, 0xfd, 0xa6, 0xcf, 0x00, 0xff, 0xe6, 0x07, 0xf5, 0x07, 0xf5, 0x07, 
+	0xc5, 0x07, 0xc0, 0x05, 0x3f, 0x10, 0x01, 0x80, 0x88, 0x01, 0x27, 0x48, 0xe2, 0x21, 0x0b, 0x3c, 
+	0x00, 0xea, 0x63, 0x6f, 0xf7, 0x2b, 0xf3, 0x6f, 0x51, 0x03, 0xf1, 0x9f, 0x00, 0xe7, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x3c, 0x00, 0x2a, 0x08, 0x9c, 0x00, 0x03, 0xcc, 0x00, 0x03, 0xfc, 0x00, 0x03, 
+	0x2c, 0x0a, 0x3d, 0x00, 0x08, 0x5c, 0x00, 0x03, 0x8c, 0x00, 0x03, 0xd8, 0xa6, 0x00, 0x03, 0xfc, 
+	0x00, 0x03, 0x2c, 0x3e, 0x00, 0x13, 0x00, 0x03, 0x8c, 0xa8, 0x00, 0x03, 0xbc, 0x00, 0x03, 0xec, 
+	0x00, 0x03, 0x1c, 0x3f, 0x00, 0x20, 0x08, 0x60, 0x00, 0x03, 0x8c, 0x27, 0x00, 0x03, 0xbc, 0x82, 
+	0x00, 0x03, 0x24, 0x26, 0x00, 0x03, 0x54, 0x00, 0x03, 0x84, 0x82, 0x00, 0x03, 0xd0, 0xf3, 0x00, 
+	0x06, 0x88, 0x00, 0x1b, 0xd4, 0xa0, 0x00, 0x03, 0xf8, 0x00, 0x03, 0x00, 0xf4, 0x00, 0x06, 0x2c, 
+	0x68, 0x40, 0x00, 0x37, 0x00, 0x27, 0x60, 0x00, 0x07, 0x20, 0x28, 0x00, 0x28, 0x03, 0x94, 0x00, 
+	0x07, 0xe4, 0x00, 0x03, 0x0c, 0x41, 0x00, 0x2a, 0x08, 0x54, 0x00, 0x0f, 0x34, 0x00, 0x07, 0xb4, 
+	0x00, 0x3b, 0x5c, 0xb5, 0x00, 0x07, 0xd8, 0x10, 0x47, 0x00, 0x07, 0xfc, 0x00, 0x07, 0xc4, 0x00, 
+	0x07, 0x41, 0xe8, 0x00, 0x03, 0x14, 0x42, 0x00, 0x08, 0x38, 0x00, 0x03, 0x55, 0x64, 0x00, 0x03, 
+	0x88, 0x00, 0x03, 0xb4, 0x00, 0x03, 0x78, 0x00, 0x37, 0x41, 0xf4, 0x00, 0x07, 0x24, 0x43, 0x00, 
+	0x08, 0x50, 0x00, 0x03, 0x54, 0x80, 0x00, 0x03, 0xac, 0x00, 0x03, 0xdc, 0x00, 0x03, 0x08, 0x44, 
+	0x15, 0x00, 0x08, 0x18, 0x00, 0x6f, 0x98, 0x00, 0x23, 0x3c, 0x00, 0x07, 0x55, 0x34, 0x00, 0x83, 
+	0x4c, 0x00, 0x13, 0x58, 0x00, 0x07, 0x74, 0x00, 0x07, 0x55, 0x9c, 0x00, 0x03, 0xbc, 0x00, 0x1b, 
+	0xdc, 0x00, 0x03, 0x7c, 0x00, 0x13, 0x50, 0xd8, 0x00, 0x0f, 0xa4, 0x00, 0x07, 0x04, 0x29, 0x00, 
+	0x03, 0x41, 0x64, 0x00, 0x2f, 0x8c, 0x25, 0x00, 0x03, 0xcc, 0x00, 0x03, 0xff, 0xf0, 0x1f, 0xf0, 
+	0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xee, 0xf0, 0x1f, 
+	0xf0, 0x1f, 0x10, 0x1f, 0xf4, 0xf0, 0x1f, 0xf0, 0x3f, 0x00, 0x03, 0x00, 0x6a, 0x45, 0x01, 0xcb, 
+	0x00, 0x03, 0x2c, 0x00, 0x17, 0x38, 0x00, 0x07, 0x54, 0xab, 0x00, 0x03, 0x70, 0x00, 0x03, 0x48, 
+	0x00, 0x0f, 0x8c, 0x00, 0x07, 0xf0, 0x1f, 0xff, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 
+	0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf5, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x50, 
+	0x1f, 0xa8, 0x00, 0x03, 0xc8, 0x00, 0x03, 0x50, 0x90, 0x00, 0x0f, 0xe8, 0x00, 0x07, 0x08, 0x46, 
+	0x00, 0x08, 0x57, 0x28, 0x00, 0x03, 0xcc, 0x01, 0x2b, 0x48, 0x00, 0x07, 0xf0, 0x1f, 0xf0, 0x1f, 
+	0xff, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 
+	0x1f, 0xf4, 0xf0, 0x1f, 0xf0, 0x1f, 0x50, 0x1f, 0xeb, 0x73, 0x28, 0x04, 0xa3, 0x00, 0x59, 0x01, 
+	0xe5, 0x01, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0x06, 0xcb, 0x80, 0x04, 0x4b, 0x01, 0x32, 0x83, 0xe3, 
+	0x11, 0x00, 0x12, 0xd6, 0x25, 0x2f, 0xe5, 0xaf, 0x18, 0xd0, 0x27, 0x14, 0xf5, 0x57, 0xfb, 0xdb, 
+	0xe7, 0x8f, 0x50, 0x2f, 0x40, 0x00, 0x10, 0x0e, 0x1b, 0xf0, 0x57, 0x1c, 0xc3, 0x17, 0xd7, 0x01, 
+	0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x90, 0x04, 0xd7, 0x12, 0x0f, 0xe1, 0x06, 0x00, 0x33, 0xff, 
+	0x68, 0x0c, 0xdb, 0x60, 0x5c, 0x86, 0xe5, 0x73, 0x06, 0x05, 0xf7, 0xf0, 0x2f, 0x00, 0x2f, 0x64, 
+	0x06, 0x3e, 0xe2, 0x20, 0x09, 0x27, 0xd0, 0x2f, 0x1c, 0xc7, 0xf0, 0x2f, 0x00, 0x2f, 0x78, 0x93, 
+	0x0c, 0xdf, 0x70, 0x87, 0xe0, 0x2f, 0x86, 0x04, 0x08, 0x3f, 0xf0, 0x53, 0xa1, 0xa0, 0x23, 0x87, 
+	0x90, 0x23, 0x74, 0x07, 0xe2, 0x20, 0x08, 0x23, 0x98, 0xd0, 0x23, 0x84, 0x40, 0x70, 0x23, 0xd0, 
+	0x1b, 0x64, 0x4e, 0xa0, 0x06, 0xe1, 0x04, 0x4c, 0x84, 0xe1, 0x18, 0x8f, 0x10, 0x23, 0x01, 0x40, 
+	0x31, 0xf0, 0x23, 0xff, 0x08, 0x05, 0xe2, 0xa0, 0x08, 0xa6, 0x80, 0x67, 0x54, 0x0e, 0x47, 0x58, 
+	0x85, 0xf6, 0x83, 0xe1, 0xbf, 0x17, 0xf5, 0xf1, 0x97, 0x4e, 0x87, 0xf1, 0x07, 0x00, 0x57, 0x58, 
+	0x00, 0x57, 0x50, 0xf0, 0x57, 0x6c, 0x05, 0xf1, 0x67, 0x60, 0x87, 0x20, 0x0d, 0x4f, 0xf1, 0x97, 
+	0xa0, 0xe1, 0x92, 0x19, 0x7b, 0x60, 0x00, 0x00, 0x37, 0x05, 0x10, 0x16, 0x93, 0x13, 0x1f, 0xff, 
+	0x04, 0x10, 0x29, 0x6f, 0xf1, 0x47, 0x47, 0x53, 0xf0, 0x33, 0x70, 0x33, 0xdc, 0xf1, 0x57, 0x20, 
+	0x33, 0x85, 0x91, 0x7b, 0xf0, 0x8b, 0x20, 0x23, 0xc4, 0x0c, 0xed, 0x70, 0x23, 0x17, 0x8b, 0xd0, 
+	0x1f, 0xa5, 0x80, 0x1f, 0x20, 0xff, 0x5c, 0xf0, 0x43, 0x3d, 0xa4, 0x4c, 0x70, 0x23, 0x18, 0xcf, 
+	0xe1, 0x77, 0xe3, 0x0f, 0x15, 0xf1, 0x77, 0xe3, 0xf0, 0x27, 0xf1, 0x9f, 0xc1, 0xc7, 0x11, 0x60, 
+	0xc6, 0xe0, 0x6b, 0xf3, 0xbb, 0xe1, 0x43, 0xbb, 0x0e, 0x57, 0x20, 0x33, 0x20, 0xc2, 0xe1, 0x22, 
+	0x0a, 0x8f, 0xd5, 0xf9, 0xd3, 0xc0, 0x63, 0x14, 0x30, 0x2f, 0x07, 0x09, 0x97, 0x11, 0xf3, 0x5b, 
+	0x00, 0xe5, 0x29, 0x5b, 0x00, 0x03, 0x0c, 0xc0, 0x1f, 0x08, 0xe5, 0x00, 0x10, 0xdc, 0x08, 0x3b, 
+	0xdc, 0xe5, 0x00, 0x00, 0x14, 0x81, 0xe1, 0x01, 0x22, 0x81, 0xe0, 0x93, 0x00, 0x20, 0x82, 0xe2, 
+	0x00, 0x20, 0xcc, 0xe5, 0x53, 0x0b, 0x2c, 0x82, 0xe2, 0x22, 0x09, 0x33, 0x01, 0x00, 0x0b, 0x1b, 
+	0x83, 0x50, 0x11, 0xe8, 0xe3, 0x07, 0x68, 0xe3, 0x27, 0x18, 0x81, 0xe0, 0x80, 0x1c, 0x5b, 0x06, 
+	0xcc, 0x8a, 0xe2, 0x08, 0xc0, 0x8c, 0x00, 0xe2, 0xb0, 0x20, 0xdc, 0xe1, 0x02, 0x00, 0x50, 0x20, 
+	0xe1, 0x0d, 0x0d, 0x9f, 0x04, 0x20, 0x9c, 0xe5, 0x02, 0x10, 0x00, 0x51, 0xe1, 0x0f, 0x7b, 0x1a, 
+	0x20, 0x20, 0x80, 0x80, 0x00, 0x1b, 0xcc, 0xe1, 0x20, 0x20, 0x81, 0xe2, 0x04, 0x00, 0x20, 0x8c, 
+	0xe5, 0x02, 0x76, 0x87, 0xe2, 0x02, 0x0a, 0x66, 0x86, 0xe2, 0x5f, 0x00, 0x5f, 0xa1, 0xcd, 0x6f, 
+	0x04, 0x82, 0x00, 0xd7, 0x94, 0xc2, 0x9f, 0xe5, 0x1c, 0x0f, 0x47, 0xf4, 0xe2, 0x0c, 0x0f, 0xa9, 
+	0x53, 0x00, 0x6f, 0x00, 0xc0, 0xd1, 0x00, 0xb7, 0xd1, 0x00, 0xe5, 0x00, 0x04, 0x8c, 0xe1, 0x0f, 
+	0xca, 0x00, 0x00, 0xe2, 0x2c, 0xc5, 0x92, 0xe7, 0x00, 0xc0, 0x8c, 0x08, 0xe0, 0x01, 0xe0, 0xdc, 
+	0x0d, 0xfb, 0xdc, 0xe4, 0x40, 0x00, 0xe8, 0xca, 0xe5, 0x41, 0x28, 0xca, 0xe5, 0x02, 0x14, 0x24, 
+	0x8e, 0xe1, 0x10, 0x13, 0x02, 0x0b, 0xd7, 0x03, 0x00, 0x02, 0x80, 0xe2, 0x00, 0x00, 0xc1, 0xe5, 
+	0x1a, 0x4f, 0x01, 0x82, 0x00, 0x07, 0x99, 0xcd, 0x8a, 0xe2, 0x11, 0x00, 0xfb, 0x01, 0x02, 0x00, 
+	0x41, 0xe5, 0x05, 0x00, 0xa0, 0x0e, 0xd7, 0x41, 0x28, 0xe5, 0x64, 0x00, 0x07, 0x04, 0x00, 0x07, 
+	0x01, 0xb7, 0x4b, 0x41, 0xe2, 0x2a, 0xa3, 0xc2, 0x03, 0xe2, 0xac, 0xcb, 0x1a, 0xa3, 0x44, 0x8c, 
+	0x00, 0xd3, 0x41, 0xe5, 0x0e, 0x02, 0xbf, 0x24, 0x64, 0x88, 0x0a, 0x4b, 0x6c, 0x86, 0xe1, 0x30, 
+	0x3f, 0xcc, 0xe5, 0x6a, 0x06, 0x09, 0x00, 0xeb, 0x27, 0x98, 0x11, 0x93, 0xf9, 0xd7, 0x0e, 0x9c, 
+	0xc1, 0x37, 0x70, 0x14, 0x0c, 0xe7, 0x0a, 0xe7, 0x11, 0x2f, 0x2b, 0x08, 0x25, 0xe1, 0x47, 0x40, 
+	0x8b, 0x45, 0x74, 0x00, 0x17, 0x25, 0x0a, 0x23, 0x10, 0xff, 0x00, 0x50, 0x05, 0x3b, 0xa0, 0x03, 
+	0x02, 0x32, 0x14, 0xa0, 0x13, 0x07, 0x01, 0x17, 0x0e, 0xc1, 0x17, 0x7e, 0x58, 0x20, 0x85, 0xe2, 
+	0x10, 0x43, 0x2b, 0x08, 0xf1, 0xe7, 0x01, 0x46, 0x20, 0x11, 0x03, 0x50, 0xe2, 0x02, 0x1a, 0x57, 
+	0x0e, 0x33, 0x02, 0xe5, 0x00, 0x93, 0x10, 0x3b, 0x0b, 0x0b, 0x13, 0x08, 0x00, 0x3b, 0x0b, 0xc0, 
+	0x3b, 0xd0, 0x20, 0x63, 0x01, 0x3b, 0x17, 0x01, 0x37, 0x01, 0x00, 0x40, 0xe2, 0x40, 0x17, 0x01, 
+	0x03, 0x16, 0x10, 0xd1, 0xe5, 0x80, 0x00, 0x26, 0x51, 0xe3, 0x00, 0x0f, 0xb2, 0x80, 0x25, 0xb7, 
+	0x30, 0x3f, 0x13, 0xb5, 0x00, 0x3f, 0x07, 0xc0, 0xbb, 0x50, 0x3f, 0x04, 0x00, 0x3f, 0x97, 0x00, 
+	0xe7, 0x02, 0x91, 0x00, 0xc2, 0xe5, 0x90, 0x05, 0x01, 0x63, 0x60, 0x10, 0xd1, 0xe5, 0x03, 0x00, 
+	0x8b, 0x02, 0x24, 0x86, 0xe1, 0x55, 0x02, 0x00, 0x87, 0x26, 0x01, 0x0f, 0x0d, 0x00, 0x3f, 0x15, 
+	0xc0, 0x7f, 0x51, 0x50, 0x00, 0x3f, 0x26, 0x00, 0x3f, 0x01, 0x68, 0x86, 0x01, 0x87, 0x01, 0xd1, 
+	0xe5, 0x06, 0x0c, 0x80, 0xe3, 0x40, 0x00, 0x13, 0x30, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x87, 0x01, 
+	0x04, 0x80, 0xe1, 0x60, 0x00, 0x01, 0xa7, 0x13, 0xc7, 0x03, 0x8c, 0x48, 0xe2, 0x98, 0x05, 0xf0, 
+	0x9f, 0xe5, 0x50, 0xc4, 0x1e, 0xb7, 0xfc, 0x00, 0x1f, 0xd4, 0x01, 0xa7, 0x00, 0x1f, 0x02, 0x00, 
+	0x3b, 0x74, 0x00, 0x13, 0x25, 0xc8, 0x04, 0x8c, 0xe0, 0x17, 0x20, 0xdc, 0x00, 0xbf, 0xdc, 0xe5, 
+	0x42, 0x02, 0x12, 0xbb, 0x00, 0x80, 0xe0, 0x16, 0x01, 0x8b, 0x20, 0x03, 0x14, 0xa0, 0xe1, 0x17, 
+	0x10, 0xcc, 0x00, 0xd3, 0x00, 0xcb, 0x04, 0x0c, 0x40, 0x02, 0x02, 0x09, 0xb0, 0xd3, 0x02, 0x8b, 
+	0xe6, 0xf0, 0xd3, 0x10, 0xd3, 0x2f, 0x1b, 0x00, 0xe1, 0x62, 0x1b, 0x30, 0xdf, 0xd2, 0x8a, 0x02, 
+	0xbb, 0xc1, 0xe5, 0x0a, 0x00, 0x37, 0x01, 0xc0, 0x37, 0x95, 0x00, 0xf0, 0x00, 0x06, 0x68, 0x1f, 
+	0x00, 0x03, 0x01, 0x04, 0x23, 0xa0, 0xe3, 0x01, 0x33, 0x0c, 0x7b, 0x12, 0xb2, 0x00, 0xe5, 0x21, 
+	0x18, 0x01, 0xe0, 0xb8, 0x00, 0x53, 0x80, 0x10, 0x8b, 0xe1, 0xb8, 0x00, 0x43, 0xe1, 0x80, 0x00, 
+	0x00, 0x11, 0xe2, 0xb2, 0x00, 0xc2, 0x11, 0x6c, 0xc0, 0x23, 0x9f, 0x15, 0x02, 0xc7, 0x11, 0x40, 
+	0xc0, 0x03, 0xd3, 0x00, 0x13, 0x5b, 0x58, 0x00, 0x0f, 0x03, 0x13, 0x1b, 0x00, 0x0b, 0x54, 0x00, 
+	0x0b, 0x0b, 0xb2, 0x06, 0x1a, 0x01, 0x00, 0xa0, 0x01, 0x00, 0x2b, 0x04, 0x87, 0x4f, 0x04, 0xe1, 
+	0x08, 0x40, 0x2d, 0xe9, 0x14, 0x8f, 0x9f, 0x30, 0x00, 0xc3, 0xe3, 0x1f, 0x30, 0x83, 0xe3, 0x03, 
+	0xf0, 0x1c, 0x29, 0xe1, 0x00, 0x10, 0x13, 0x03, 0x13, 0x13, 0x0f, 0x00, 0x40, 0x2a, 0xbd, 0xe8, 
+	0x50, 0x1f, 0x92, 0x40, 0x1f, 0x01, 0x10, 0x13, 0xf0, 0x10, 0x69, 0xe1, 0x1e, 0x00, 0x1f, 0x88, 
+	0x2d, 0x00, 0x03, 0x2c, 0x71, 0x18, 0x0b, 0x0b, 0x36, 0x0a, 0x0b, 0x00, 0x5c, 0xf0, 0x5f, 0x05, 
+	0x2d, 0xe9, 0x64, 0xa0, 0x9f, 0x02, 0xdb, 0x9f, 0x01, 0x6b, 0x00, 0x5d, 0xe1, 0x04, 0x00, 0x00, 
+	0xda, 0x5c, 0x10, 0xb8, 0x10, 0x0b, 0x90, 0x12, 0x3f, 0x00, 0xf7, 0x10, 0x8b, 0x00, 0xea, 0x0b, 
+	0xe0, 0x0c, 0xf7, 0x00, 0x0b, 0x20, 0x07, 0x0f, 0xe0, 0xa0, 0xe1, 0x3c, 0xc8, 0x01, 0x7f, 0x00, 
+	0x97, 0xe3, 0x67, 0x01, 0xe3, 0x1f, 0x01, 0x00, 0x20, 0xeb, 0xe9, 0x00, 0x03, 0x95, 0x06, 0x00, 
+	0xeb, 0x5c, 0xd4, 0x00, 0x03, 0x10, 0x1f, 0x20, 0x00, 0x1f, 0x20, 0x00, 0x53, 0x70, 0x00, 0x28, 
+	0x0f, 0xe5, 0x10, 0x0f, 0x18, 0x00, 0x0f, 0xf0, 0x9f, 0xbd, 0x10, 0xe8, 0x68, 0x51, 0x0a, 0x9f, 
+	0x7d, 0x00, 0x03, 0xef, 0x00, 0xbe, 0xad, 0xde, 0x08, 0x59, 0x00, 0x08, 0x04, 0x49, 0x5e, 0x30, 
+	0x8b, 0xd0, 0x5b, 0x0c, 0x1f, 0x04, 0xda, 0x00, 0x33, 0x00, 0x10, 0xe3, 0x42, 0x00, 0x00, 0x0a, 
+	0xd0, 0x04, 0x8c, 0x11, 0xfb, 0x58, 0xe1, 0xe8, 0x00, 0x13, 0x01, 0x33, 0x42, 0x90, 0x81, 0x02, 
+	0xfb, 0x00, 0x00, 0xa0, 0xa3, 0xef, 0x14, 0x10, 0x0f, 0x01, 0x50, 0xe1, 0x39, 0x00, 0x00, 0xba, 
+	0xee, 0x00, 0x0b, 0x41, 0xa6, 0x02, 0x9f, 0x36, 0x00, 0x00, 0xca, 0x07, 0x00, 0x07, 0x56, 0x5a, 
+	0x00, 0xbb, 0x02, 0x00, 0x93, 0x2a, 0x00, 0x93, 0x10, 0x4b, 0xb8, 0x31, 0x12, 0x9f, 0x01, 0xa3, 
+	0x01, 0xe3, 0x1a, 0xc1, 0x03, 0x11, 0xf3, 0x40, 0x03, 0x00, 0x07, 0x01, 0x18, 0x81, 0xe1, 0x14, 
+	0x15, 0x14, 0x8a, 0xe5, 0xa0, 0x00, 0x1b, 0x10, 0x00, 0x13, 0x08, 0x10, 0x51, 0x81, 0x20, 0x13, 
+	0x08, 0x10, 0x1f, 0x1c, 0x81, 0x12, 0x18, 0x9f, 0x0d, 0x03, 0x14, 0x81, 0x12, 0x00, 0x13, 0x02, 
+	0xf7, 0x10, 0x03, 0xef, 0x11, 0x00, 0x1a, 0xa5, 0x20, 0x83, 0x50, 0xe3, 0x03, 0x10, 0x2b, 0xcc, 
+	0x00, 0x23, 0x00, 0x33, 0x13, 0x04, 0x00, 0x43, 0x00, 0x0b, 0xe2, 0x01, 0x10, 0x14, 0x81, 0xe2, 
+	0x00, 0x0f, 0xe3, 0x02, 0x17, 0x81, 0x20, 0xe3, 0x08, 0x00, 0x13, 0x20, 0x15, 0x9a, 0xe5, 0xee, 
+	0x82, 0x00, 0x2f, 0x00, 0x00, 0x60, 0xe2, 0x21, 0x03, 0x47, 0x00, 0xae, 0x02, 0x3b, 0x20, 0x00, 
+	0x5f, 0x10, 0x00, 0x1b, 0x10, 0x13, 0x12, 0x43, 0xc8, 0x10, 0x00, 0x80, 0xe3, 0x0c, 0xbd, 0xe1, 
+	0x18, 0x05, 0x8a, 0x28, 0xe5, 0xe7, 0x00, 0x2b, 0x08, 0x10, 0x27, 0x18, 0xa0, 0xe1, 0x57, 0xe6, 
+	0x00, 0x0b, 0x28, 0x80, 0x33, 0x0c, 0x00, 0x33, 0x11, 0xb3, 0x00, 0xf7, 0x9b, 0x60, 0xd3, 0xec, 
+	0x11, 0x70, 0xd3, 0x50, 0xcb, 0xd4, 0x00, 0x13, 0x50, 0xcb, 0xfd, 0x50, 0xc7, 0x10, 0x1b, 0x10, 
+	0x9b, 0x10, 0xc7, 0x10, 0x9b, 0x10, 0xcb, 0x05, 0x80, 0xcb, 0xa1, 0x50, 0xc7, 0x01, 0x00, 0xbb, 
+	0x00, 0x00, 0xb0, 0xe3, 0x10, 0xcf, 0x47, 0x02, 0x10, 0x37, 0x10, 0x41, 0x12, 0x10, 0xc7, 0xf0, 
+	0x97, 0xf0, 0x97, 0xd3, 0x11, 0xff, 0x50, 0x97, 0x54, 0xf0, 0x97, 0xe5, 0x3c, 0x80, 0x97, 0x21, 
+	0x57, 0xff, 0xf0, 0x97, 0x20, 0x97, 0x12, 0x63, 0x60, 0x97, 0x00, 0x2b, 0xd0, 0x8b, 0xf1, 0x53, 
+	0xb0, 0x87, 0x04, 0xf8, 0x41, 0x2d, 0xe9, 0x05, 0x06, 0x5f, 0x3e, 0x00, 0x00, 0x9c, 0xe8, 0x04, 
+	0x60, 0xa0, 0xe1, 0x05, 0x70, 0x0a, 0xa0, 0xe1, 0x30, 0x85, 0x18, 0xeb, 0x18, 0x10, 0xf3, 0x0a, 
+	0x04, 0x08, 0x30, 0xc3, 0xe1, 0x34, 0x00, 0x0f, 0x08, 0x30, 0x00, 0x83, 0xe1, 0xff, 0x0c, 0x18, 
+	0xe3, 0x38, 0x65, 0x08, 0x9a, 0x15, 0x3c, 0x75, 0x02, 0x5f, 0x80, 0xa0, 0xe1, 0x0b, 0xfc, 0x00, 
+	0xa1, 0xe8, 0x15, 0x27, 0x08, 0x00, 0x27, 0x50, 0x0b, 0xf0, 0x10, 0x33, 0x50, 0x0b, 0x00, 0x9b, 
+	0x60, 0x0b, 0xf3, 0xff, 0xff, 0x1a, 0x68, 0x00, 0x00, 0x73, 0x10, 0x6b, 0x14, 0x06, 0xcb, 0x1c, 
+	0x25, 0x9a, 0x08, 0xe5, 0x12, 0x4e, 0x82, 0x10, 0x2f, 0xeb, 0x1c, 0x25, 0x0d, 0x8a, 0xe5, 0x04, 
+	0x20, 0x00, 0x7b, 0x00, 0x1b, 0x18, 0x00, 0x1b, 0x81, 0x03, 0x5a, 0xeb, 0xf8, 0x81, 0xbd, 0xe8, 
+	0x88, 0x18, 0xd3, 0x00, 0x00, 0x12, 0xe3, 0x00, 0x10, 0xbc, 0x15, 0xb2, 0x00, 0x10, 0xc2, 0x10, 
+	0x02, 0x00, 0x40, 0x12, 0x01, 0x00, 0x13, 0xa0, 0xe3, 0xd4, 0xc0, 0x81, 0xe5, 0x02, 0x00, 0xc0, 
+	0x80, 0xe2, 0x2c, 0xc1, 0xb0, 0xe1, 0xd8, 0x00, 0x20, 0x81, 0x15, 0x85, 0xc4, 0x8c, 0x13, 0xdc, 
+	0x00, 0xc0, 0x81, 0x15, 0xff, 0xc4, 0xcc, 0x13, 0x00, 0x10, 0x20, 0x82, 0xe0, 0x10, 0xd7, 0x40, 
+	0x7f, 0x00, 0x00, 0x40, 0x02, 0x07, 0x1c, 0x40, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x01, 0x91, 0xe5, 
+	0x04, 0x00, 0xc0, 0xe1, 0x05, 0x04, 0x3f, 0x00, 0x04, 0x00, 0x81, 0xe5, 0x14, 0x70, 0x81, 0xe5, 
+	0x21, 0x18, 0x10, 0x01, 0x47, 0x20, 0x52, 0xe2, 0xf7, 0x00, 0x97, 0xa0, 0x10, 0x2f, 0x4c, 0x01, 
+	0x27, 0x48, 0x05, 0x9a, 0xe5, 0x4c, 0x88, 0x02, 0x57, 0x03, 0xc0, 0x00, 0x00, 0xbb, 0x5c, 0xe3, 
+	0x80, 0x08, 0x2a, 0x9f, 0xd5, 0x03, 0x00, 0x07, 0x7c, 0x2a, 0x9f, 0x8c, 0x00, 0xa6, 0x5c, 0xe3, 
+	0x78, 0x00, 0x07, 0x14, 0x93, 0x48, 0x20, 0x00, 0x83, 0xe5, 0x2e, 0x25, 0xda, 0xe5, 0xb4, 0x25, 
+	0x10, 0xc3, 0xe1, 0x1f, 0x10, 0x9f, 0x20, 0xa0, 0x03, 0x60, 0x0b, 0xfa, 0x9f, 0x15, 0x50, 0x00, 
+	0x17, 0x00, 0x07, 0x93, 0x00, 0x4f, 0x02, 0x01, 0x54, 0xfa, 0x9f, 0xe5, 0x48, 0x00, 0x53, 0x50, 
+	0x89, 0x00, 0xf3, 0x03, 0x00, 0x01, 0x04, 0x9f, 0x50, 0xe3, 0x08, 0x33, 0x4a, 0x0a, 0x07, 0xbf, 
+	0xe3, 0x0f, 0x00, 0x07, 0x03, 0x00, 0x07, 0x14, 0xd6, 0x00, 0x07, 0x12, 0x9f, 0x30, 0x00, 0x73, 
+	0x34, 0x00, 0x03, 0x10, 0x87, 0x20, 0x16, 0x0a, 0x9f, 0xe5, 0x10, 0x0f, 0x1c, 0x00, 0x07, 0x10, 
+	0x13, 0x21, 0x81, 0x02, 0xf3, 0xff, 0x08, 0xc0, 0xe3, 0x21, 0x1c, 0x05, 0x3f, 0xa7, 0x02, 0xf7, 
+	0x3c, 0x40, 0x27, 0xf8, 0x09, 0x30, 0x27, 0x10, 0x07, 0x10, 0x27, 0x62, 0xf4, 0x00, 0x07, 0x50, 
+	0x1b, 0x00, 0x00, 0xe0, 0x20, 0x53, 0xe4, 0xb4, 0x40, 0x1b, 0xd8, 0x40, 0x1b, 0xd0, 0x4b, 0x38, 
+	0x50, 0x2f, 0x44, 0x2d, 0x50, 0xe9, 0x11, 0x57, 0xb8, 0x00, 0x27, 0xb2, 0x04, 0xc1, 0xe1, 0x50, 
+	0xb4, 0x00, 0x07, 0x44, 0x01, 0x27, 0xb9, 0xff, 0xff, 0xeb, 0x20, 0x81, 0x05, 0x12, 0x3b, 0xb0, 
+	0xe1, 0x4e, 0x00, 0x00, 0x42, 0x1b, 0x11, 0x97, 0x00, 0x84, 0xbd, 0xe8, 0x10, 0x13, 0xe3, 0x4a, 
+	0x15, 0x02, 0x73, 0x10, 0x21, 0x00, 0xd7, 0x10, 0x11, 0x6f, 0x01, 0x02, 0x84, 0x59, 0x9f, 0xe5, 
+	0x84, 0x69, 0x00, 0x03, 0x79, 0xac, 0x00, 0x03, 0x89, 0x00, 0x03, 0x99, 0x05, 0x07, 0x05, 0x5b, 
+	0x80, 0xc9, 0x08, 0x9f, 0xe5, 0x80, 0x19, 0x08, 0x6f, 0x10, 0x8f, 0xe5, 0x05, 0x7c, 0xb9, 0x9f, 
+	0xe5, 0x06, 0x00, 0x43, 0x78, 0x00, 0x13, 0x55, 0x78, 0x00, 0x13, 0x08, 0x00, 0x13, 0x74, 0x00, 
+	0x13, 0x01, 0x10, 0x57, 0x60, 0x80, 0x05, 0x67, 0x00, 0x60, 0x0c, 0x10, 0x1f, 0xe5, 0x07, 0x01, 
+	0x2c, 0x0b, 0xe2, 0x22, 0xa3, 0x91, 0xe7, 0x11, 0x1b, 0x01, 0x22, 0x03, 0x81, 0xe7, 0x0a, 0xa0, 
+	0xb0, 0x15, 0x5b, 0x02, 0x1a, 0x01, 0xbc, 0x8b, 0xe2, 0x80, 0x02, 0x1f, 0x1f, 0x0b, 0x0d, 0x1b, 
+	0xe3, 0xf5, 0x41, 0xb7, 0xaa, 0x00, 0x1b, 0x05, 0x8c, 0x28, 0x2a, 0x1e, 0x01, 0x4b, 0x04, 0x00, 
+	0x1b, 0x08, 0xb0, 0x8b, 0x20, 0xe2, 0xf9, 0x08, 0xd7, 0xa7, 0x41, 0x9c, 0xe7, 0x04, 0x04, 0x30, 
+	0x9c, 0xe4, 0xff, 0x2c, 0x0a, 0x9f, 0x00, 0x03, 0x20, 0xe2, 0x02, 0x06, 0xe3, 0xff, 0x2c, 0x04, 
+	0xe2, 0xff, 0x10, 0x10, 0x04, 0xe2, 0x16, 0xd7, 0x05, 0x20, 0x01, 0xe0, 0x04, 0x82, 0x02, 0x80, 
+	0xe1, 0x06, 0x00, 0x07, 0x87, 0x21, 0x01, 0x82, 0xe0, 0x02, 0x06, 0x80, 0xe1, 0x08, 0x02, 0x3b, 
+	0x01, 0x04, 0x00, 0x8b, 0xe4, 0xfc, 0x27, 0x8b, 0x06, 0xe7, 0x00, 0x11, 0xe3, 0x09, 0x00, 0xc0, 
+	0x01, 0x02, 0x0c, 0x0a, 0x80, 0x03, 0x02, 0x05, 0x00, 0x0b, 0x08, 0x00, 0x0b, 0x04, 0x04, 0x80, 
+	0x03, 0xfc, 0x0f, 0x8b, 0x02, 0x4b, 0x1b, 0xe3, 0x00, 0x23, 0x38, 0xa0, 0x11, 0x24, 0x48, 0xa0, 
+	0x11, 0x50, 0xe6, 0x00, 0x87, 0xdd, 0x00, 0x6f, 0xfe, 0x00, 0x1b, 0xe2, 0x00, 0x80, 0x10, 0xa0, 
+	0x13, 0xa0, 0x10, 0x41, 0x10, 0x00, 0x81, 0xb0, 0x8b, 0x10, 0x01, 0xc0, 0x8c, 0x10, 0xa0, 0x10, 
+	0xa7, 0xca, 0x40, 0xa7, 0xff, 0x47, 0x2d, 0xe9, 0x8c, 0x0c, 0xa8, 0x9f, 0xe5, 0xe4, 0x41, 0x4f, 
+	0x05, 0xd7, 0x11, 0x80, 0x00, 0xf8, 0x9f, 0x15, 0x80, 0x48, 0x9f, 0xe5, 0xe3, 0x80, 0x02, 0x4b, 
+	0x02, 0x00, 0x52, 0xe3, 0x78, 0xf8, 0x9f, 0x28, 0xa5, 0x29, 0x00, 0x0b, 0x80, 0x02, 0x53, 0x70, 
+	0xf8, 0x9f, 0x10, 0x05, 0x70, 0x58, 0x04, 0x03, 0x80, 0xa0, 0xe3, 0x2d, 0xa0, 0x21, 0x6b, 0xb0, 
+	0x1a, 0x73, 0x0a, 0x04, 0x90, 0xa0, 0xe3, 0x41, 0x25, 0x01, 0x2f, 0x01, 0x90, 0x59, 0xe2, 0xfc, 
+	0x00, 0x5b, 0x05, 0x18, 0x40, 0x84, 0xe2, 0x01, 0x0a, 0x83, 0xf8, 0x00, 0x0b, 0x80, 0x16, 0x6b, 
+	0x03, 0x00, 0xb5, 0xe8, 0x03, 0x00, 0x84, 0x2a, 0xe8, 0x20, 0x40, 0x17, 0xfa, 0x00, 0x17, 0xa6, 
+	0x23, 0xff, 0xb0, 0x95, 0x16, 0x83, 0x0a, 0x2c, 0x40, 0x7f, 0x18, 0x00, 0x7b, 0x4c, 0x00, 0x0b, 
+	0xc0, 0x14, 0x77, 0x0c, 0xa7, 0xe3, 0xf8, 0x17, 0x9f, 0xe5, 0xb0, 0x10, 0x30, 0xd1, 0x11, 0x07, 
+	0xcf, 0x03, 0xb0, 0x30, 0xc0, 0x18, 0xe1, 0xfc, 0x07, 0x00, 0xab, 0x00, 0x13, 0x08, 0x20, 0xa0, 
+	0x00, 0xe3, 0xb0, 0x32, 0xd1, 0xe0, 0xb2, 0x30, 0xc0, 0x50, 0xe0, 0x13, 0x2f, 0xfb, 0x00, 0x4f, 
+	0xff, 0x47, 0xbd, 0xe8, 0xec, 0x10, 0xd3, 0x60, 0x67, 0x40, 0x17, 0xe4, 0x01, 0x07, 0x11, 0xf3, 
+	0xb2, 0x60, 0x04, 0xd5, 0xe0, 0x1f, 0x00, 0x16, 0x02, 0x1b, 0x80, 0x12, 0x66, 0x80, 0x0b, 0x2b, 
+	0x09, 0x03, 0x12, 0x0e, 0x11, 0xe3, 0x04, 0x5b, 0x3e, 0x0b, 0x0e, 0x16, 0xe2, 0x20, 0x00, 0x17, 
+	0x20, 0x40, 0x17, 0x04, 0x3b, 0x00, 0xeb, 0x80, 0x72, 0x87, 0xe1, 0x1f, 0x0b, 0x16, 0x01, 0xe2, 
+	0x19, 0x0e, 0x80, 0x12, 0xa0, 0x03, 0x30, 0x17, 0x80, 0x00, 0xab, 0xeb, 0x00, 0x75, 0x87, 0xe1, 
+	0xb2, 0x70, 0x20, 0xc4, 0xe0, 0x12, 0x1b, 0x01, 0x2c, 0x60, 0xe2, 0x92, 0x00, 0x02, 0x03, 0xe0, 
+	0x01, 0x28, 0x73, 0xe2, 0x04, 0x08, 0x30, 0x61, 0xe2, 0x00, 0x01, 0xcf, 0x91, 0x02, 0x02, 0x82, 
+	0x0b, 0x57, 0x20, 0xe0, 0xa0, 0x06, 0xa0, 0x27, 0x9f, 0xf0, 0x6a, 0x10, 0x0b, 0x93, 0x1a, 0x27, 
+	0x11, 0x0a, 0xb3, 0x14, 0x0a, 0xcb, 0x00, 0x10, 0xd9, 0xe5, 0x3e, 0x03, 0x67, 0x05, 0x00, 0xd9, 
+	0x05, 0x05, 0xc9, 0x00, 0x50, 0x03, 0x02, 0x00, 0x07, 0x3d, 0x00, 0x07, 0x80, 0x02, 0x6f, 0x1a, 
+	0xa3, 0x8d, 0x48, 0xe2, 0x24, 0xe3, 0x22, 0x9a, 0xe5, 0x17, 0x23, 0x02, 0x00, 0x18, 0x17, 0x1f, 
+	0x03, 0xa2, 0x57, 0x27, 0x64, 0x10, 0x07, 0xf7, 0x9f, 0xa5, 0x15, 0xa3, 0x64, 0xa8, 0x05, 0xa3, 
+	0x6c, 0x04, 0x17, 0xa0, 0x01, 0x07, 0x04, 0x04, 0x00, 0x10, 0xea, 0x68, 0xc5, 0x00, 0x0b, 0x90, 
+	0x8c, 0xe2, 0x07, 0x00, 0x24, 0xa0, 0xe3, 0xa5, 0x54, 0xda, 0xe5, 0x29, 0xac, 0x01, 0x43, 0x04, 
+	0x01, 0x43, 0x20, 0x17, 0xeb, 0x12, 0x6f, 0x00, 0x13, 0x28, 0xe2, 0x1a, 0x01, 0x67, 0x9f, 0x00, 
+	0x43, 0x18, 0x00, 0x00, 0x52, 0x8a, 0x16, 0x07, 0xff, 0x0c, 0x2b, 0xff, 0x1c, 0x02, 0x83, 0x1a, 
+	0xc1, 0x04, 0x73, 0x00, 0xb7, 0x06, 0x12, 0x03, 0xe2, 0xa1, 0x24, 0x8b, 0x00, 0x82, 0xe4, 0x02, 
+	0x1b, 0xa0, 0xe3, 0x02, 0x01, 0x04, 0x13, 0xe3, 0x01, 0x1b, 0x81, 0x0e, 0x23, 0x55, 0xe3, 0x00, 
+	0x02, 0x03, 0x03, 0x12, 0xa0, 0x19, 0x81, 0x11, 0x00, 0x07, 0x04, 0x03, 0x12, 0x20, 0x16, 0x81, 
+	0x11, 0x08, 0x01, 0x02, 0x03, 0x02, 0x05, 0xaf, 0x01, 0xff, 0x08, 0x30, 0x03, 0xe2, 0x15, 0xb7, 
+	0x05, 0xdb, 0xe2, 0xb4, 0x10, 0xc2, 0x02, 0xe0, 0x09, 0x00, 0x5c, 0xe1, 0xe2, 0x42, 0x5b, 0x2a, 
+	0x0e, 0x0e, 0xa0, 0xe3, 0x08, 0x00, 0x4b, 0x12, 0xf7, 0x50, 0x83, 0x1c, 0xf1, 0x40, 0x83, 0x00, 
+	0x8b, 0xf0, 0x83, 0x80, 0x83, 0x02, 0x09, 0x80, 0x07, 0xa7, 0xe1, 0xf0, 0x87, 0xf0, 0x87, 0xb0, 
+	0x87, 0x01, 0x10, 0xc1, 0xe3, 0x90, 0x8b, 0x40, 0xe0, 0xf0, 0x8b, 0xea, 0x0a, 0xc0, 0xa0, 0xe1, 
+	0x98, 0x00, 0xa5, 0x9f, 0xe5, 0xb8, 0x05, 0x9f, 0xe5, 0x60, 0x80, 0x05, 0x0b, 0xb4, 0x25, 0x9f, 
+	0xe5, 0xb4, 0x35, 0x9f, 0x9a, 0x1b, 0xeb, 0xe8, 0x58, 0x00, 0x0f, 0x19, 0xe3, 0xa8, 0x40, 0x0f, 
+	0x12, 0x0a, 0x1e, 0x81, 0xe2, 0xa0, 0x00, 0x1f, 0x98, 0x40, 0x0f, 0x38, 0x02, 0x00, 0x8f, 0xe2, 
+	0x70, 0x09, 0x0f, 0x20, 0x23, 0x8c, 0xae, 0x00, 0x3f, 0xb4, 0x09, 0xc3, 0x4c, 0x01, 0x87, 0x03, 
+	0xeb, 0x05, 0x9b, 0x50, 0x10, 0xe3, 0xe4, 0x14, 0x15, 0x9b, 0x50, 0xe3, 0xe0, 0x14, 0x88, 0x15, 
+	0x9b, 0x50, 0xe3, 0xdc, 0x00, 0x07, 0x48, 0x10, 0x82, 0x18, 0xe5, 0x0c, 0xa0, 0x32, 0x0b, 0x10, 
+	0x37, 0xba, 0x2b, 0xc2, 0x01, 0xe1, 0xb6, 0x2c, 0xc2, 0xe1, 0xb2, 0x2d, 0x10, 0x3b, 0x17, 0x9f, 
+	0xe5, 0xc0, 0x00, 0x4f, 0x08, 0x01, 0xd3, 0x10, 0x4b, 0x10, 0x23, 0x83, 0x17, 0x7b, 0x0e, 0xf0, 
+	0xa0, 0xe1, 0xe4, 0x49, 0x17, 0x14, 0xc7, 0x80, 0x18, 0xeb, 0x02, 0x80, 0x88, 0x13, 0x02, 0x80, 
+	0xc8, 0x00, 0x03, 0x00, 0x20, 0x21, 0xe0, 0x00, 0x20, 0x02, 0x64, 0xe0, 0x13, 0x8f, 0x03, 0x5b, 
+	0x0a, 0x0c, 0x00, 0x9f, 0xb8, 0x24, 0xc0, 0x08, 0x8b, 0x02, 0x0b, 0xe8, 0x24, 0xca, 0xe5, 0x0f, 
+	0x80, 0x12, 0x08, 0xe2, 0x01, 0x02, 0xef, 0xb5, 0x05, 0x02, 0xab, 0x00, 0x40, 0x9d, 0x07, 0xcb, 
+	0xca, 0xe5, 0x9c, 0xfd, 0xff, 0xeb, 0x79, 0x01, 0x02, 0xaf, 0x10, 0x5f, 0x00, 0x9b, 0x02, 0x5b, 
+	0x00, 0xea, 0x00, 0x9b, 0x87, 0x03, 0x73, 0x00, 0xea, 0x82, 0x1a, 0x01, 0x63, 0x00, 0x5f, 0x10, 
+	0x67, 0x08, 0x33, 0x2d, 0x58, 0xe2, 0x00, 0x07, 0xb1, 0xff, 0xc8, 0x00, 0xc1, 0xe3, 0x42, 0x23, 
+	0xa0, 0xe1, 0x92, 0x0c, 0x15, 0x0c, 0xe0, 0x4c, 0x0e, 0xa3, 0x21, 0x08, 0x33, 0x91, 0x00, 0x0b, 
+	0x18, 0x0c, 0x83, 0x48, 0x26, 0xc7, 0x10, 0x33, 0x03, 0x20, 0x10, 0x95, 0x10, 0x2b, 0x01, 0x01, 
+	0x04, 0x23, 0xf0, 0x01, 0x67, 0x12, 0x00, 0x4b, 0xc4, 0x2a, 0x8f, 0x80, 0x57, 0x03, 0x20, 0x00, 
+	0x03, 0x6f, 0x52, 0xe3, 0x68, 0x0b, 0x02, 0x87, 0x10, 0x1b, 0x70, 0x00, 0x1b, 0xff, 0x28, 0x05, 
+	0x00, 0xe2, 0x03, 0x08, 0x52, 0xe3, 0xee, 0xff, 0xff, 0x2f, 0x0a, 0x02, 0x00, 0x07, 0xdf, 0x00, 
+	0x07, 0x90, 0x53, 0x00, 0x3b, 0x20, 0x0f, 0x00, 0xff, 0x28, 0xc1, 0xe3, 0x48, 0xc3, 0xa0, 0xe1, 
+	0x5d, 0x9c, 0x03, 0x4f, 0x42, 0x0f, 0x17, 0x20, 0x83, 0x00, 0x0b, 0x02, 0x40, 0x83, 0x6b, 0xe7, 
+	0x81, 0x1f, 0x10, 0xef, 0x79, 0x40, 0xef, 0xe7, 0x00, 0xef, 0x1b, 0x1f, 0x95, 0x04, 0x97, 0xea, 
+	0xe6, 0xc0, 0x23, 0x70, 0x40, 0x23, 0xe6, 0x40, 0x23, 0x60, 0x2a, 0x03, 0x27, 0x17, 0x03, 0xb7, 
+	0xfd, 0xff, 0xba, 0x84, 0x1a, 0xfd, 0xff, 0xca, 0x10, 0x57, 0x03, 0x77, 0xe2, 0x03, 0x7f, 0x15, 
+	0x20, 0x30, 0x16, 0x02, 0x0b, 0x00, 0x59, 0xe1, 0x34, 0xf6, 0x14, 0x9a, 0x05, 0x38, 0x40, 0x0b, 
+	0x3c, 0x00, 0x0b, 0xb0, 0xf3, 0x9b, 0x06, 0x1b, 0x10, 0xd9, 0x20, 0x57, 0x01, 0x6b, 0xb2, 0x21, 
+	0xd7, 0x70, 0x0f, 0x5b, 0xa2, 0xc0, 0x0f, 0x12, 0x14, 0x6f, 0x10, 0x13, 0x24, 0x06, 0xdf, 0x12, 
+	0x7f, 0x42, 0x25, 0x00, 0xc7, 0xff, 0x10, 0x01, 0xe2, 0x00, 0xff, 0xea, 0x55, 0x25, 0x00, 0x13, 
+	0xec, 0x00, 0x07, 0x26, 0x40, 0x13, 0xe9, 0x10, 0x0b, 0xbb, 0x00, 0x13, 0xe7, 0x80, 0x27, 0x10, 
+	0x1f, 0x10, 0x27, 0xea, 0x80, 0x27, 0x10, 0x1f, 0xb5, 0x10, 0x27, 0xe5, 0x00, 0x07, 0x90, 0xb3, 
+	0x00, 0x00, 0x77, 0xfe, 0x0b, 0x37, 0xb3, 0x04, 0xbf, 0x1a, 0x50, 0x83, 0x18, 0xfb, 0x01, 0x10, 
+	0x0c, 0xb7, 0x08, 0x5b, 0x1a, 0x10, 0x10, 0x4f, 0x1f, 0x9f, 0x11, 0xeb, 0x11, 0x12, 0x27, 0x00, 
+	0xb4, 0x00, 0x17, 0x24, 0x00, 0x13, 0x10, 0x43, 0xeb, 0x81, 0x2b, 0xd0, 0xf2, 0x10, 0x9f, 0xe5, 
+	0x03, 0x04, 0xb7, 0x81, 0x10, 0x8c, 0xe0, 0x00, 0xb0, 0x10, 0xd1, 0xe1, 0xb0, 0x10, 0xc2, 0xe1, 
+	0x59, 0x0c, 0x00, 0x0f, 0xa1, 0x40, 0x0f, 0x08, 0xf7, 0xe1, 0x30, 0x10, 0x0f, 0x65, 0x11, 0x30, 
+	0x0f, 0x03, 0x6f, 0xe1, 0xc0, 0x10, 0x0f, 0x12, 0x30, 0x0f, 0x6d, 0xb6, 0x00, 0x0f, 0x10, 0x53, 
+	0xec, 0x00, 0x53, 0x58, 0x7b, 0x80, 0x00, 0x53, 0x5d, 0xed, 0x80, 0x0f, 0x74, 0x00, 0x0f, 0x5b, 
+	0xfb, 0x51, 0x9f, 0x08, 0x41, 0x9f, 0x4b, 0xef, 0x01, 0x9f, 0xef, 0xfc, 0x32, 0xb3, 0xa5, 0x30, 
+	0x33, 0x25, 0x0b, 0x92, 0x07, 0xd7, 0xe2, 0xf3, 0x00, 0x1b, 0x3c, 0xc2, 0x07, 0xbf, 0xc6, 0x01, 
+	0x8c, 0x10, 0x60, 0xc4, 0x8a, 0xe5, 0x64, 0x00, 0x03, 0x65, 0x30, 0x00, 0x0f, 0x09, 0xa3, 0x12, 
+	0xf8, 0x00, 0x0b, 0xff, 0x03, 0x4b, 0x15, 0x40, 0x00, 0xcf, 0x23, 0x43, 0xf3, 0x03, 0x4b, 0xfe, 
+	0x0b, 0x9b, 0xe5, 0x10, 0x0b, 0x1c, 0x5b, 0x90, 0x6b, 0xed, 0x04, 0x30, 0x6b, 0xee, 0x00, 0x4f, 
+	0x40, 0xd4, 0x40, 0x6b, 0x60, 0x24, 0x9a, 0xe5, 0x0c, 0x00, 0x08, 0xc2, 0xe7, 0xac, 0x12, 0x31, 
+	0x67, 0xff, 0x00, 0x31, 0xd0, 0x23, 0x17, 0x11, 0x37, 0xf8, 0x0e, 0x87, 0xa1, 0x01, 0xfc, 0xe7, 
+	0x53, 0x07, 0x00, 0x17, 0x01, 0x03, 0x6b, 0x12, 0x01, 0x0e, 0xbf, 0x0e, 0x83, 0xc0, 0x10, 0xe7, 
+	0x50, 0x37, 0x26, 0x1b, 0x5c, 0xe2, 0xef, 0xff, 0x00, 0xff, 0x4a, 0x24, 0x21, 0x9f, 0xe5, 0xa1, 
+	0x02, 0x02, 0xf2, 0xe7, 0x21, 0x11, 0xa0, 0xe1, 0x20, 0x2f, 0xc0, 0x14, 0xa0, 0xe3, 0x1c, 0x20, 
+	0x2f, 0xc2, 0x20, 0x2f, 0x2c, 0xc8, 0x68, 0xb0, 0x20, 0x87, 0x10, 0x2f, 0xe3, 0x00, 0x2f, 0x02, 
+	0x0a, 0x51, 0x38, 0xe3, 0xf1, 0x00, 0x07, 0x26, 0x2f, 0x00, 0xa7, 0x3f, 0x20, 0x01, 0x13, 0xe2, 
+	0x60, 0xc1, 0x13, 0xa7, 0xcc, 0xe7, 0x17, 0xf3, 0x01, 0xbb, 0x02, 0x12, 0x3f, 0x10, 0x01, 0x12, 
+	0x80, 0x0b, 0xdf, 0xf0, 0x15, 0x14, 0xca, 0x15, 0x10, 0x27, 0xf2, 0x40, 0x27, 0x3c, 0xf0, 0x27, 
+	0xa0, 0x20, 0x27, 0xf2, 0x40, 0x27, 0x07, 0x50, 0x2d, 0xe9, 0x6c, 0xa0, 0x04, 0xd7, 0x68, 0x46, 
+	0x2f, 0x78, 0x02, 0x00, 0xeb, 0x07, 0x00, 0x90, 0xbd, 0xe8, 0xfe, 0x0c, 0x5c, 0xe3, 0x18, 0x10, 
+	0x0f, 0x00, 0x4a, 0x10, 0x1b, 0x02, 0x00, 0xd1, 0xe7, 0xd4, 0x11, 0x23, 0x10, 0x13, 0x15, 0x00, 
+	0x13, 0x02, 0x02, 0x17, 0x64, 0x15, 0xda, 0x06, 0x63, 0x00, 0x1b, 0xa0, 0x03, 0xbf, 0x0f, 0x17, 
+	0xb7, 0x10, 0x1f, 0x46, 0x02, 0x50, 0x53, 0x3a, 0x20, 0x20, 0x20, 0x06, 0x56, 0x00, 0x00, 0x00, 
+	0xfa, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0xec, 0x02, 0xff, 0xfa, 0xff, 0xe0, 0xff, 0xe0, 0x0d, 0xf3, 
+	0x08, 0x29, 0x5f, 0x00, 0x02, 0x76, 0xff, 0x05, 0xd2, 0x04, 0x09, 0x09, 0x31, 0x08, 0x1d, 0x08, 
+	0x00, 0x20, 0x00, 0x09, 0x0c, 0x1d, 0xc8, 0x00, 0x28, 0x00, 0x00, 0x98, 0x08, 0x98, 0x08, 0x68, 
+	0x0a, 0x00, 0x68, 0x00, 0x07, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x04, 0x72, 0x00, 0x72, 0xff, 
+	0xfd, 0x00, 0x44, 0x58, 0x03, 0x08, 0x02, 0x9c, 0x99, 0x02, 0x05, 0x3a, 0x00, 0x06, 0x00, 0x0b, 
+	0x5c, 0x03, 0x02, 0xbc, 0x10, 0x0b, 0x68, 0x0f, 0x6b, 0x0e, 0x53, 0x42, 0xb4, 0x10, 0x4f, 0x01, 
+	0x00, 0x05, 0x94, 0x00, 0x07, 0x80, 0x82, 0x00, 0x03, 0xfc, 0x78, 0x00, 0x03, 0x34, 0x00, 0x07, 
+	0xf0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x60, 0x00, 0x08, 0xb0, 0xc0, 0x00, 0x68, 0x00, 0x70, 0x04, 
+	0x06, 0x00, 0x60, 0xa6, 0x01, 0x08, 0x00, 0x60, 0xa2, 0x40, 0x00, 0x0b, 0x28, 0x97, 0x00, 0x40, 
+	0x00, 0x1f, 0x0f, 0xf0, 0x4b, 0x00, 0x03, 0xab, 0x2a, 0x00, 0x06, 0x00, 0x9a, 0x19, 0x0a, 0x00, 
+	0x46, 0x17, 0x00, 0x0b, 0x00, 0x93, 0x24, 0x07, 0x00, 0x48, 0x62, 0xb2, 0x0e, 0x97, 0x63, 0x00, 
+	0x47, 0x00, 0x03, 0x24, 0x64, 0x00, 0x5b, 0xc0, 0x15, 0x02, 0x02, 0xdc, 0x00, 0x6f, 0x7c, 0x00, 
+	0x57, 0xbc, 0x00, 0x03, 0x01, 0xb4, 0x14, 0x9a, 0xe5, 0x21, 0x01, 0xb0, 0x05, 0x1f, 0x12, 0x9a, 
+	0xe5, 0xf0, 0x0b, 0x1b, 0x24, 0x20, 0x01, 0x57, 0x10, 0x00, 0x01, 0x20, 0xa1, 0xc4, 0xb0, 0x21, 
+	0x22, 0x18, 0x10, 0x01, 0x20, 0x0f, 0x11, 0xc7, 0x0b, 0x12, 0xe3, 0x10, 0x20, 0xc0, 0x8f, 0x0c, 
+	0xc7, 0xdc, 0x17, 0x00, 0x00, 0x81, 0x20, 0xe1, 0xd0, 0x4a, 0xab, 0xff, 0x01, 0xff, 0x40, 0x00, 
+	0x00, 0x02, 0x01, 0x03, 0x04, 0x06, 0x05, 0x07, 0x08, 0x00, 0x0a, 0x09, 0x0b, 0x0c, 0xe0, 0xd0, 
+	0x0f, 0x01, 0x0c, 0x20, 0xd9, 0xe4, 0x10, 0x0f, 0xc3, 0x15, 0xa7, 0x68, 0x10, 0x00, 0x8f, 0xe2, 
+	0x02, 0xf1, 0x91, 0x07, 0x97, 0x1d, 0x40, 0x8a, 0x06, 0x27, 0xd1, 0xe7, 0x00, 0x4c, 0xa0, 0xe1, 
+	0x40, 0xc0, 0x09, 0x07, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x01, 0x9a, 0x57, 0xb8, 0xf4, 0x9a, 
+	0xe5, 0x25, 0x04, 0xe3, 0x0a, 0xff, 0x20, 0x02, 0xe2, 0x50, 0x33, 0x34, 0xf0, 0x33, 0xe1, 0x41, 
+	0x80, 0xc0, 0x33, 0xff, 0x20, 0x0c, 0xe2, 0xff, 0x01, 0xb3, 0x60, 0x8b, 0x02, 0x3b, 0x10, 0x33, 
+	0x02, 0xf1, 0x9f, 0x07, 0x28, 0x00, 0x01, 0x00, 0xea, 0xf8, 0x42, 0x00, 0x03, 0xfc, 0x40, 0x6b, 
+	0x0f, 0x8b, 0x6c, 0x00, 0x08, 0x90, 0x44, 0x00, 0x2a, 0x03, 0x14, 0x00, 0x07, 0x1c, 0x00, 0x03, 
+	0x24, 0x00, 0x03, 0x2c, 0xe8, 0x40, 0x13, 0xf0, 0x03, 0x30, 0x03, 0x34, 0x10, 0x1f, 0x6e, 0x00, 
+	0x08, 0x55, 0x9c, 0x00, 0x03, 0xa8, 0x00, 0x03, 0xb4, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xaa, 0x10, 
+	0x1b, 0xcc, 0x00, 0x07, 0xd8, 0x00, 0x03, 0xe4, 0x00, 0x03, 0xf0, 0xa0, 0x00, 0x03, 0xfc, 0x00, 
+	0x03, 0x0c, 0x6f, 0x00, 0x08, 0x18, 0xad, 0x00, 0x03, 0x28, 0x00, 0x03, 0x34, 0x00, 0x03, 0x10, 
+	0x27, 0x50, 0x00, 0x07, 0x55, 0x5c, 0x00, 0x03, 0x68, 0x00, 0x03, 0x74, 0x00, 0x03, 0x80, 0x00, 
+	0x03, 0x5d, 0x8c, 0x00, 0x03, 0x98, 0x40, 0x1f, 0xf0, 0x03, 0xb0, 0x03, 0x40, 0x00, 0x27, 0xf1, 
+	0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0x30, 0x03, 0x5c, 0x37, 0x00, 0x07, 0x86, 0x0c, 0x00, 0x03, 
+	0xe8, 0x65, 0x00, 0xa7, 0x00, 0x03, 0xdc, 0x38, 0x1a, 0x00, 0x03, 0x4c, 0x00, 0x0f, 0x10, 0x5b, 
+	0xfc, 0x00, 0x0f, 0x04, 0x6b, 0x66, 0x00, 0xb7, 0x00, 0x03, 0x14, 0x00, 0x03, 0x1c, 0x00, 0x03, 
+	0x10, 0x17, 0x4a, 0x98, 0x41, 0x17, 0xa8, 0x3a, 0x30, 0x27, 0x3c, 0x00, 0x0f, 0x44, 0xaa, 0x00, 
+	0x03, 0x4c, 0x00, 0x03, 0x54, 0x00, 0x03, 0x5c, 0x00, 0x03, 0x0c, 0xf5, 0xf1, 0x3b, 0xf0, 0x03, 
+	0xf0, 0x03, 0xe0, 0x03, 0x24, 0x00, 0x73, 0x2c, 0x00, 0x03, 0x5b, 0x40, 0x00, 0x03, 0x48, 0x40, 
+	0x7f, 0x90, 0x03, 0xb0, 0x01, 0xbf, 0xf0, 0x37, 0xf0, 0xf0, 0x03, 0xf0, 0x03, 0x30, 0x03, 0x12, 
+	0x7b, 0x24, 0x0c, 0xa0, 0xe1, 0x51, 0x18, 0x42, 0x4b, 0x74, 0xa2, 0x4b, 0xc1, 0xe7, 0xff, 0x03, 
+	0xd3, 0x7a, 0x9c, 0x06, 0x17, 0xf2, 0x83, 0x32, 0x83, 0x90, 0x3b, 0x38, 0xf0, 0x3b, 0xe3, 0x73, 
+	0x8d, 0x00, 0x3b, 0xf2, 0x8b, 0x32, 0x8b, 0xed, 0xfe, 0x72, 0x8b, 0x0e, 0xee, 0x2b, 0xea, 0xbc, 
+	0x00, 0xcb, 0xb0, 0x02, 0x8b, 0xb4, 0x00, 0x03, 0x10, 0x9b, 0x55, 0xc0, 0x00, 0x07, 0xcc, 0x00, 
+	0x03, 0xd4, 0x00, 0x03, 0xdc, 0x40, 0x13, 0xd0, 0xf0, 0x03, 0x30, 0x03, 0xe4, 0x00, 0x1f, 0x54, 
+	0x6d, 0x00, 0x08, 0x55, 0x60, 0x00, 0x03, 0x70, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x8c, 0x00, 0x03, 
+	0xaa, 0x10, 0x1b, 0x9c, 0x00, 0x07, 0xac, 0x00, 0x03, 0xb8, 0x00, 0x03, 0xc8, 0xaa, 0x00, 0x03, 
+	0xd8, 0x00, 0x03, 0xec, 0x00, 0x03, 0xfc, 0x00, 0x03, 0x0c, 0xaa, 0x02, 0x97, 0x1c, 0x42, 0xb3, 
+	0x3c, 0x00, 0x07, 0x48, 0x00, 0x03, 0x54, 0xaa, 0x00, 0x03, 0x60, 0x00, 0x03, 0x6c, 0x00, 0x03, 
+	0x78, 0x00, 0x03, 0x84, 0xef, 0x40, 0x1f, 0xf0, 0x03, 0xb0, 0x03, 0x2c, 0x00, 0x27, 0xf0, 0x03, 
+	0xf0, 0x03, 0xf0, 0x03, 0xa0, 0x30, 0x03, 0x64, 0x02, 0x8b, 0xcc, 0x4f, 0x00, 0x03, 0x84, 0xb4, 
+	0x02, 0x83, 0xa8, 0x00, 0x03, 0x10, 0x53, 0x54, 0x02, 0x8b, 0x2c, 0x35, 0x01, 0x00, 0x03, 0xd4, 
+	0x39, 0x00, 0x03, 0x28, 0x02, 0x6f, 0x55, 0x38, 0x00, 0x03, 0x48, 0x00, 0x03, 0xb4, 0x42, 0x7b, 
+	0xa0, 0x42, 0x67, 0x55, 0x6c, 0x00, 0x0f, 0xec, 0x01, 0x03, 0x68, 0x00, 0x0f, 0x70, 0x00, 0x03, 
+	0x53, 0x7c, 0x00, 0x03, 0x8c, 0x00, 0x03, 0x30, 0x43, 0x04, 0xb3, 0xf1, 0x3b, 0xe8, 0xf0, 0x03, 
+	0xf0, 0x03, 0xe0, 0x03, 0x5c, 0x02, 0x7f, 0x5c, 0x3b, 0x00, 0x2d, 0x03, 0x64, 0x00, 0x07, 0x84, 
+	0x00, 0x07, 0xd0, 0x1f, 0x50, 0xf2, 0x8b, 0xfa, 0xf0, 0x03, 0xf0, 0x03, 0x60, 0x03, 0x92, 0x37, 
+	0x18, 0x77, 0xa1, 0x07, 0x6f, 0x75, 0x1b, 0x02, 0x00, 0xea, 0x54, 0xd7, 0x15, 0x3f, 0xa4, 0x00, 
+	0x13, 0x09, 0xaf, 0x82, 0x2b, 0x43, 0x0d, 0x00, 0x00, 0xaa, 0x70, 0x05, 0x83, 0x74, 0x00, 0x14, 
+	0x8a, 0xe5, 0x04, 0x12, 0x9f, 0xe5, 0x34, 0xa0, 0x00, 0x07, 0xc4, 0x00, 0x0f, 0x01, 0x90, 0x49, 
+	0xe0, 0x01, 0x02, 0x00, 0x2d, 0xe9, 0x0f, 0x1a, 0x09, 0x3d, 0x4f, 0x05, 0x09, 0x92, 0xe7, 0xc4, 
+	0x04, 0x0a, 0xf7, 0x90, 0x89, 0x00, 0x17, 0x24, 0xbd, 0xe8, 0x16, 0x9f, 0xd8, 0x11, 0x0a, 0x7b, 
+	0x16, 0x81, 0x5c, 0xe0, 0x10, 0x3b, 0xd0, 0x00, 0x0b, 0x10, 0x3b, 0x07, 0x8f, 0xea, 0xa4, 0xad, 
+	0x08, 0x07, 0xf8, 0x48, 0x07, 0xcf, 0x00, 0x07, 0x1b, 0x2b, 0xd0, 0x0e, 0xbf, 0x41, 0x10, 0x0a, 
+	0xf7, 0x21, 0x22, 0x82, 0x01, 0x20, 0x00, 0x07, 0x04, 0x01, 0x20, 0x82, 0x01, 0x0f, 0x02, 0xfb, 
+	0x00, 0x20, 0x11, 0x22, 0xe0, 0xd4, 0x00, 0x1b, 0xd4, 0x25, 0xca, 0x25, 0xdb, 0x41, 0xf0, 0x00, 
+	0x0b, 0x04, 0x10, 0x81, 0xe3, 0xf0, 0x07, 0x0f, 0x69, 0xd4, 0x1e, 0xa7, 0x09, 0x57, 0xf0, 0x49, 
+	0x43, 0x09, 0x20, 0x0e, 0x17, 0x20, 0x10, 0xd9, 0x09, 0x62, 0x51, 0x03, 0x02, 0x10, 0xf9, 0x60, 
+	0x05, 0x10, 0x17, 0x0e, 0xdb, 0x0a, 0x02, 0x20, 0x59, 0xe0, 0x78, 0xa2, 0x0f, 0xb7, 0x1a, 0xab, 
+	0x10, 0x73, 0x1b, 0xbf, 0x80, 0x00, 0xc0, 0x4a, 0xe3, 0x0c, 0xff, 0x1a, 0xea, 0x48, 0xcf, 0x0c, 
+	0x03, 0x43, 0xff, 0x0a, 0x5f, 0x2d, 0xe9, 0xea, 0x00, 0x9b, 0x2f, 0x1f, 0x4b, 0x00, 0x00, 0x40, 
+	0xe0, 0x00, 0x02, 0xb0, 0xe1, 0x04, 0xe0, 0x01, 0x8f, 0x12, 0x18, 0xc1, 0x9f, 0x15, 0x1c, 0x00, 
+	0x5f, 0x06, 0xff, 0x5f, 0xbd, 0xe8, 0x10, 0x10, 0xd3, 0x00, 0xaf, 0x00, 0x28, 0x20, 0xc1, 0x20, 
+	0x8f, 0xc8, 0x01, 0x0b, 0x39, 0x0c, 0x51, 0xa1, 0x07, 0xeb, 0x80, 0x09, 0x9f, 0xa0, 0x01, 0x81, 
+	0x13, 0x00, 0x83, 0x18, 0x80, 0x48, 0xe0, 0x10, 0x4b, 0x0a, 0x6b, 0xe2, 0x00, 0x02, 0x41, 0xa0, 
+	0x10, 0x43, 0xe2, 0xd4, 0xc0, 0x9f, 0xe5, 0x00, 0x43, 0x03, 0xe1, 0xff, 0x9f, 0xbd, 0xe8, 0x83, 
+	0x00, 0x5f, 0x19, 0xf7, 0xa6, 0x01, 0x0b, 0x0a, 0x10, 0x23, 0xc0, 0x10, 0x0c, 0x33, 0x06, 0xdf, 
+	0x00, 0x30, 0x00, 0xc1, 0x00, 0x03, 0x38, 0x93, 0xf0, 0x0f, 0x2d, 0xe9, 0x50, 0x00, 0x08, 0xa7, 
+	0x20, 0x0f, 0x37, 0x1f, 0x00, 0x00, 0x4a, 0x00, 0xf0, 0x00, 0xb0, 0xe8, 0x00, 0x0f, 0xb1, 0xe8, 
+	0x00, 0x08, 0x40, 0x34, 0xe0, 0x10, 0x80, 0x00, 0x15, 0x00, 0x01, 0xc0, 0x8c, 0x13, 0x09, 0x50, 
+	0x35, 0xe0, 0x04, 0x0c, 0x90, 0x00, 0x15, 0x02, 0x00, 0x0b, 0x0a, 0x60, 0x01, 0x36, 0xe0, 0x08, 
+	0xa0, 0x00, 0x15, 0x04, 0x00, 0x0b, 0x00, 0x0b, 0x70, 0x37, 0xe0, 0x04, 0xb0, 0x00, 0x15, 0x6a, 
+	0x08, 0x00, 0x0b, 0xd0, 0x37, 0x10, 0x80, 0x37, 0x20, 0x80, 0x37, 0x40, 0xa1, 0x80, 0x37, 0x80, 
+	0x00, 0x0b, 0x00, 0x40, 0xd3, 0xe5, 0x00, 0x4b, 0x02, 0xe1, 0x01, 0xc0, 0xc3, 0xe4, 0xdc, 0x01, 
+	0xb3, 0x20, 0x01, 0x20, 0x92, 0xe2, 0xf0, 0x0f, 0xbd, 0xd8, 0x00, 0x9b, 0x01, 0xd1, 0x14, 0xf0, 
+	0x9f, 0xe5, 0x14, 0x45, 0x05, 0xd3, 0x08, 0xf0, 0x01, 0x02, 0x24, 0x00, 0x07, 0x05, 0xf1, 0x00, 
+	0x18, 0x06, 0x52, 0x56, 0x02, 0x5b, 0x00, 0x03, 0x70, 0x6a, 0x00, 0x75, 0x08, 0x19, 0xf3, 0x11, 
+	0x67, 0x10, 0x03, 0x40, 0x01, 0x1f, 0x0c, 0x48, 0xcf, 0x55, 0x48, 0x80, 0x0b, 0x50, 0x80, 0x0b, 
+	0x58, 0x80, 0x0b, 0x60, 0x80, 0x0b, 0x74, 0x68, 0x80, 0x0b, 0x12, 0x83, 0x50, 0x0b, 0x74, 0x80, 
+	0x0b, 0x0e, 0x14, 0x04, 0x8c, 0xe3, 0x01, 0x19, 0x81, 0x0c, 0xa7, 0xc1, 0xe5, 0xa2, 0x30, 0x2f, 
+	0xc1, 0x20, 0x17, 0xb9, 0x1c, 0x4a, 0x01, 0x57, 0x41, 0x78, 0xe2, 0x50, 0x0f, 0x30, 0x33, 0x30, 
+	0x0b, 0x11, 0x53, 0x14, 0x00, 0x00, 0x15, 0xba, 0xf8, 0x03, 0x01, 0xa3, 0x30, 0x01, 0xaf, 0x40, 
+	0x00, 0x03, 0x56, 0x50, 0x00, 0x03, 0x60, 0x00, 0x03, 0x70, 0x11, 0xbf, 0x00, 0x03, 0x90, 0x03, 
+	0xa0, 0xe1, 0xfa, 0x03, 0xa0, 0xe8, 0x10, 0x2b, 0x08, 0xd7, 0x7c, 0xba, 0x50, 0x0b, 0x02, 0x5c, 
+	0x60, 0x0b, 0x0d, 0xb7, 0x60, 0x0b, 0xf3, 0xff, 0x05, 0xff, 0xaa, 0xf8, 0x03, 0xbd, 0x00, 0x0b, 
+	0x92, 0x1d, 0x87, 0x02, 0xd1, 0x04, 0x10, 0x80, 0xe4, 0x04, 0x00, 0x17, 0xfc, 0x68, 0xff, 0x3c, 
+	0xc7, 0x10, 0x23, 0x11, 0x10, 0x73, 0x07, 0x2d, 0xe9, 0x03, 0xf8, 0x07, 0xb1, 0xe8, 0xf8, 0x07, 
+	0x30, 0x37, 0x0d, 0x8b, 0xfe, 0x00, 0x13, 0x70, 0x0f, 0x03, 0x77, 0xa0, 0x0f, 0x0e, 0xcb, 0xa0, 
+	0x0f, 0x02, 0x33, 0xaa, 0x30, 0xf8, 0x07, 0x80, 0x67, 0x00, 0x13, 0x04, 0xc0, 0x91, 0xa4, 0x04, 
+	0x04, 0xc0, 0x80, 0xa4, 0xfb, 0x30, 0x6b, 0x01, 0x04, 0x20, 0x20, 0x82, 0x0a, 0xe3, 0xd1, 0xe4, 
+	0x01, 0xc0, 0xc0, 0x3e, 0xe4, 0x01, 0x00, 0x1f, 0x40, 0x17, 0x03, 0x1b, 0x30, 0x0f, 0x50, 0x93, 
+	0x03, 0x08, 0xc0, 0x10, 0xe2, 0xf4, 0x0e, 0x2b, 0x03, 0xc0, 0x11, 0x29, 0xe2, 0xd6, 0x02, 0x8b, 
+	0x18, 0x0b, 0x87, 0x8c, 0xc1, 0x01, 0x1f, 0x08, 0xe0, 0x6c, 0xe2, 0x03, 0x0f, 0xbb, 0x04, 0x30, 
+	0x91, 0x18, 0xe4, 0x33, 0x3c, 0x02, 0xbf, 0x10, 0x63, 0x40, 0x91, 0xe4, 0x00, 0x14, 0x3e, 0x83, 
+	0xe1, 0x04, 0x30, 0x80, 0xa4, 0x08, 0x34, 0x3c, 0xa0, 0xa1, 0x0d, 0x3b, 0xca, 0x18, 0x40, 0x20, 
+	0xbd, 0x08, 0x60, 0x6f, 0x30, 0xc0, 0xe4, 0x23, 0x34, 0xf4, 0x01, 0x37, 0x40, 0x6f, 0x00, 0x1b, 
+	0x2e, 0xdf, 0x92, 0x03, 0xa3, 0x92, 0x05, 0xd1, 0x0f, 0x07, 0x04, 0x4f, 0x0a, 0x04, 0x4f, 0x87, 
+	0x1f, 0x4f, 0x0e, 0x9a, 0x01, 0xa0, 0xe1, 0xb0, 0x15, 0x9a, 0x05, 0x28, 0x04, 0x0f, 0x51, 0x2c, 
+	0x00, 0x03, 0x8e, 0x40, 0x13, 0x7e, 0x1f, 0x4f, 0x01, 0x52, 0x01, 0xa0, 0xe1, 0x2c, 0x10, 0x0a, 
+	0xe5, 0x30, 0x00, 0x03, 0x55, 0x94, 0x00, 0x3b, 0x84, 0x04, 0x9b, 0x1f, 0x0c, 0x67, 0x01, 0x0c, 
+	0x6f, 0x50, 0x90, 0x00, 0x47, 0x91, 0x03, 0x3b, 0x81, 0x02, 0x80, 0xe1, 0xa4, 0x00, 0x13, 0xe3, 
+	0x03, 0x3b, 0x02, 0x6a, 0x00, 0x1f, 0x01, 0x0c, 0x4a, 0x1c, 0x12, 0x6f, 0x01, 0x0f, 0x40, 0x27, 
+	0x65, 0x10, 0x13, 0x0a, 0x40, 0x1c, 0x00, 0x1f, 0x00, 0x12, 0x91, 0x05, 0xca, 0x15, 0x95, 0x00, 
+	0x37, 0x05, 0x90, 0x0b, 0x6f, 0x5f, 0x00, 0x17, 0x94, 0x00, 0x43, 0x9a, 0x01, 0xcf, 0xe2, 0x24, 
+	0x03, 0x73, 0x0a, 0x33, 0xe5, 0x00, 0xf7, 0xea, 0x55, 0x7f, 0x80, 0x5f, 0x56, 0x00, 0x23, 0x3f, 
+	0x80, 0x0f, 0x52, 0x00, 0x0f, 0x04, 0x6c, 0x00, 0x00, 0x02, 0xe3, 0x2e, 0x9b, 0x20, 0xe2, 0x58, 
+	0x65, 0x24, 0x1b, 0x10, 0x1e, 0xf3, 0x00, 0x5e, 0xa0, 0xe3, 0x65, 0x80, 0x00, 0x23, 0x00, 0x44, 
+	0x2d, 0xe9, 0xcc, 0x92, 0x9f, 0x04, 0xe5, 0x47, 0x00, 0x00, 0xeb, 0x01, 0xaf, 0x0a, 0x6f, 0xb2, 
+	0x00, 0x07, 0x54, 0x00, 0x03, 0x01, 0x67, 0x1a, 0x3e, 0x00, 0x07, 0x00, 0x00, 0x84, 0xbd, 0xe8, 
+	0xf8, 0x4f, 0x2d, 0xe9, 0xac, 0x00, 0x52, 0x9f, 0xe5, 0x7c, 0x60, 0x85, 0xe2, 0xa8, 0x42, 0x72, 
+	0x00, 0x7b, 0x40, 0xa0, 0xe3, 0x3b, 0x00, 0x1b, 0x13, 0x80, 0x00, 0x2f, 0x22, 0x32, 0x84, 0xe0, 
+	0x60, 0x00, 0x53, 0x00, 0xe3, 0x15, 0x00, 0x00, 0xca, 0x06, 0x00, 0x55, 0x40, 0xe1, 0x01, 0x0c, 
+	0xaa, 0xb2, 0x20, 0xc5, 0xe0, 0xb2, 0x02, 0xc0, 0xc5, 0xe0, 0x06, 0x0d, 0x5c, 0x02, 0xc3, 0xa0, 
+	0x20, 0x41, 0x78, 0x05, 0x7b, 0x00, 0x12, 0x81, 0xe0, 0x02, 0x00, 0x1a, 0x81, 0x52, 0x04, 0x02, 
+	0x87, 0xe0, 0x03, 0x80, 0x02, 0xb3, 0x22, 0x32, 0x8c, 0xe0, 0x68, 0xff, 0xff, 0x05, 0xeb, 0x03, 
+	0xc0, 0xa0, 0xe1, 0x14, 0x93, 0x37, 0x00, 0x4f, 0x61, 0xeb, 0x00, 0x73, 0x1e, 0x47, 0x00, 0x10, 
+	0x85, 0xe5, 0x04, 0x37, 0x00, 0xeb, 0xf8, 0x8f, 0xbd, 0xe8, 0x0b, 0xb0, 0xa0, 0x01, 0xe1, 0xf8, 
+	0x4f, 0xbd, 0xe8, 0x2c, 0x02, 0x00, 0x43, 0xba, 0x20, 0x1b, 0x80, 0x00, 0xc3, 0x30, 0xbb, 0x11, 
+	0xa3, 0xf5, 0x01, 0x03, 0x66, 0xb4, 0x15, 0x4b, 0x00, 0x3d, 0x07, 0x10, 0xd7, 0x66, 0x40, 0xd7, 
+	0xff, 0x80, 0x01, 0xa0, 0xe3, 0xf4, 0xb1, 0x9f, 0xe5, 0xf4, 0x04, 0xf7, 0x01, 0xe8, 0x91, 0x9f, 
+	0xe5, 0xb2, 0x20, 0xdb, 0x00, 0x97, 0x02, 0xdb, 0xe0, 0x02, 0x20, 0xb0, 0xe1, 0x10, 0xeb, 0x18, 
+	0x1a, 0xe0, 0x4f, 0xe2, 0x50, 0xa3, 0x00, 0x7f, 0xea, 0x10, 0x3b, 0xc4, 0xe5, 0x15, 0x23, 0x01, 
+	0x5b, 0x10, 0xf7, 0xc4, 0x01, 0x30, 0x73, 0x30, 0x00, 0x9f, 0x6b, 0x20, 0x00, 0x67, 0x10, 0x4f, 
+	0xb4, 0x10, 0x1f, 0x80, 0x04, 0xeb, 0x15, 0x47, 0xa0, 0x04, 0xe3, 0xa0, 0x00, 0x23, 0x2c, 0xb3, 
+	0xa0, 0xe1, 0x0b, 0x21, 0x01, 0x80, 0x04, 0x7f, 0x90, 0xe4, 0x0b, 0xb0, 0x05, 0x77, 0xcd, 0x05, 
+	0x9b, 0x04, 0x93, 0xe2, 0x03, 0x08, 0xc3, 0x02, 0x6b, 0xba, 0x10, 0x6f, 0xb3, 0x10, 0xab, 0xab, 
+	0x00, 0x1b, 0x02, 0x24, 0x2a, 0x10, 0x00, 0x7b, 0x04, 0xf7, 0x66, 0xe2, 0x05, 0xdf, 0x04, 0x9b, 
+	0x82, 0x22, 0x10, 0x17, 0x01, 0x6f, 0x2a, 0x6a, 0x8b, 0x00, 0x07, 0x16, 0x0b, 0x22, 0x0e, 0xfb, 
+	0x3f, 0x0d, 0x83, 0xf0, 0xb2, 0x01, 0x0f, 0x40, 0x00, 0x07, 0x0f, 0xdf, 0x0a, 0x38, 0x00, 0x67, 
+	0x21, 0x0d, 0x12, 0xf0, 0xe7, 0x01, 0x00, 0x0f, 0x0f, 0xbf, 0x0a, 0x0d, 0xeb, 0x80, 0x01, 0xeb, 
+	0x1c, 0xe2, 0x40, 0x00, 0x60, 0x12, 0x00, 0x17, 0xc0, 0x8c, 0x10, 0x10, 0x6b, 0xdb, 0x00, 0x6b, 
+	0x10, 0x67, 0x50, 0xd3, 0x06, 0x22, 0xc2, 0x8c, 0xe0, 0xfc, 0x12, 0x2b, 0x41, 0x7b, 0x06, 0x00, 
+	0x34, 0xa0, 0xe3, 0x02, 0x3a, 0x83, 0x52, 0x80, 0x0c, 0x32, 0x83, 0xe0, 0x80, 0x02, 0xcf, 0x13, 
+	0xd3, 0x01, 0x0c, 0x21, 0x50, 0xe3, 0x0d, 0x84, 0xba, 0x06, 0x3a, 0x83, 0x23, 0x27, 0x00, 0x04, 
+	0x50, 0x18, 0xe0, 0x05, 0x51, 0x99, 0x17, 0x00, 0x24, 0x74, 0x18, 0xe0, 0x07, 0x71, 0x99, 0x17, 
+	0x02, 0x87, 0x60, 0x85, 0xe1, 0x24, 0x58, 0x40, 0x13, 0x7c, 0x80, 0x40, 0x13, 0x70, 0x85, 0xe1, 
+	0xc0, 0x00, 0xa3, 0xe8, 0xe7, 0x13, 0x5b, 0x0e, 0x6b, 0x23, 0x8f, 0x05, 0x09, 0xf0, 0x3f, 0xf0, 
+	0x3f, 0xb0, 0x3f, 0x1d, 0xc0, 0x00, 0xa0, 0x20, 0x43, 0x00, 0xe7, 0x20, 0x43, 0x02, 0x00, 0x43, 
+	0x38, 0x05, 0xa9, 0xf0, 0x47, 0xf0, 0x47, 0xf0, 0x47, 0xc0, 0x00, 0xaa, 0xe0, 0x20, 0x4b, 0x04, 
+	0x63, 0x20, 0x4b, 0x7c, 0x79, 0x00, 0x03, 0x1c, 0xa5, 0x1e, 0x03, 0xe2, 0x0e, 0x0f, 0x40, 0x03, 
+	0x2d, 0x9f, 0xe8, 0x09, 0x03, 0x11, 0xc8, 0x04, 0x9a, 0x01, 0xbf, 0x88, 0xe0, 0xe8, 0x1f, 0xc3, 
+	0x00, 0x10, 0x81, 0xe2, 0xe8, 0x14, 0xca, 0xe5, 0x4b, 0x82, 0x06, 0xcf, 0xc0, 0xf4, 0x9a, 0x45, 
+	0xe4, 0x07, 0x3f, 0x28, 0xe0, 0x02, 0x3b, 0x13, 0x2f, 0x12, 0x4f, 0x0f, 0xe0, 0xa0, 0x01, 0xd4, 
+	0x00, 0xf5, 0x9f, 0x05, 0x04, 0xc0, 0x8f, 0xe2, 0xb8, 0x14, 0xc4, 0x8a, 0xe5, 0x00, 0x23, 0xe5, 
+	0xf0, 0x3f, 0xca, 0xe5, 0x63, 0x8f, 0x40, 0x3f, 0x90, 0x27, 0x48, 0x00, 0x5a, 0x20, 0x43, 0x08, 
+	0x83, 0x20, 0x1a, 0x47, 0x00, 0x0b, 0x01, 0x00, 0x90, 0xe2, 0x47, 0x25, 0x00, 0x4a, 0x03, 0xbf, 
+	0x50, 0xe3, 0x15, 0x37, 0x08, 0x08, 0x7f, 0x00, 0x12, 0x0d, 0x8a, 0xe2, 0xf8, 0x0b, 0x80, 0xe8, 
+	0x72, 0x09, 0x04, 0x37, 0x18, 0x97, 0x17, 0x6b, 0x68, 0xc5, 0x37, 0x6b, 0x08, 0xeb, 0x08, 0x87, 
+	0x12, 0x8f, 0x10, 0x33, 0x48, 0x00, 0x03, 0xd4, 0x00, 0x9b, 0x03, 0xbb, 0x40, 0xe3, 0x00, 0x93, 
+	0x11, 0x48, 0xf5, 0x9f, 0x15, 0x3a, 0x0d, 0x0b, 0x00, 0xeb, 0xd8, 0x00, 0x8b, 0x17, 0x83, 0xd8, 
+	0x08, 0xbb, 0x04, 0x02, 0x00, 0x18, 0xe3, 0x0e, 0x02, 0x57, 0x06, 0x1c, 0x30, 0x8a, 0xe2, 0x08, 
+	0x63, 0x06, 0x53, 0x91, 0xe5, 0x24, 0x15, 0xa4, 0x32, 0xcb, 0x94, 0x0b, 0x77, 0x04, 0x1c, 0x10, 
+	0x13, 0xd1, 0xe5, 0x68, 0x7c, 0x04, 0x3f, 0x00, 0x33, 0xe3, 0x16, 0x73, 0x0c, 0x00, 0x41, 0x22, 
+	0xe5, 0xa2, 0x20, 0x57, 0x80, 0xe3, 0xa2, 0x09, 0x37, 0x06, 0x6e, 0x0d, 0x02, 0xd3, 0x00, 0xdb, 
+	0x90, 0x02, 0xf3, 0x10, 0xd7, 0x50, 0xcf, 0x15, 0x10, 0xed, 0xff, 0xea, 0x10, 0xf7, 0x06, 0x0d, 
+	0x40, 0xe2, 0xea, 0x10, 0x1f, 0xf1, 0x0f, 0xb1, 0x0f, 0x99, 0x41, 0x0f, 0x00, 0x08, 0x4b, 0x01, 
+	0x3b, 0x8c, 0x98, 0x05, 0xe3, 0x70, 0x2f, 0x10, 0xd3, 0xe8, 0x00, 0x6b, 0x10, 0x37, 0x26, 0x01, 
+	0x0c, 0x30, 0x4f, 0x80, 0xc4, 0x08, 0x43, 0x00, 0x1f, 0xb4, 0xb5, 0x40, 0xcf, 0xb4, 0x00, 0xcf, 
+	0x10, 0x2b, 0xa1, 0x00, 0x9b, 0xa2, 0x18, 0xe3, 0x24, 0x10, 0x11, 0x09, 0x97, 0x18, 0x13, 0x13, 
+	0xdf, 0x58, 0xf4, 0x31, 0x9f, 0xe5, 0x58, 0xf7, 0x02, 0xbf, 0x0a, 0x4c, 0x14, 0x18, 0xd3, 0x06, 
+	0xd1, 0xe5, 0x01, 0x20, 0x42, 0x09, 0x6f, 0x18, 0x83, 0x52, 0xb7, 0x11, 0x5f, 0x1a, 0x59, 0x0f, 
+	0x58, 0xc3, 0x28, 0x00, 0x63, 0x28, 0xc3, 0x09, 0x07, 0xa7, 0x13, 0xbb, 0x14, 0x20, 0x37, 0xc1, 
+	0xe5, 0x50, 0x07, 0x11, 0x3f, 0x07, 0x57, 0x50, 0x0a, 0x10, 0xc7, 0xe9, 0x21, 0x13, 0x50, 0xe1, 
+	0xd7, 0x1f, 0x70, 0x8f, 0x01, 0x33, 0x04, 0x9f, 0x01, 0x37, 0x04, 0x20, 0x80, 0x03, 0x14, 0x04, 
+	0x20, 0xc0, 0x04, 0xf2, 0x52, 0x04, 0xaf, 0xc1, 0x15, 0x00, 0x0c, 0x20, 0x41, 0x15, 0x04, 0x00, 
+	0x12, 0x13, 0x66, 0x40, 0x00, 0x03, 0x04, 0x4b, 0x1a, 0x01, 0x0c, 0xa7, 0x13, 0xf7, 0x28, 0xe8, 
+	0x1c, 0xaf, 0x00, 0x47, 0x11, 0x57, 0x02, 0x41, 0x57, 0xcc, 0x24, 0x9a, 0x20, 0xe5, 0xa8, 0x00, 
+	0xdb, 0x02, 0x06, 0x80, 0xe0, 0xa8, 0xac, 0x00, 0xdb, 0xb1, 0x00, 0x63, 0x04, 0x03, 0xc7, 0x19, 
+	0xb7, 0x03, 0x10, 0x44, 0x11, 0x01, 0xaf, 0xa0, 0x03, 0x12, 0x01, 0x17, 0x81, 0x10, 0x10, 0x40, 
+	0xe0, 0xac, 0x00, 0x27, 0x12, 0x01, 0x90, 0xe0, 0xab, 0x00, 0x4b, 0x3a, 0x10, 0x43, 0x04, 0x40, 
+	0x43, 0xb0, 0x10, 0xcb, 0x0d, 0x4b, 0x50, 0xac, 0x00, 0x3f, 0xb2, 0x00, 0x3f, 0x81, 0x10, 0x01, 
+	0xe2, 0x60, 0x81, 0x01, 0x03, 0x01, 0x1f, 0x05, 0x08, 0x10, 0x81, 0x03, 0x00, 0xa2, 0x14, 0xca, 
+	0x05, 0xb2, 0x04, 0xda, 0x05, 0x82, 0x0d, 0x27, 0x02, 0xb2, 0x04, 0xca, 0x05, 0x01, 0x2f, 0xe3, 
+	0x0d, 0xa7, 0xec, 0xff, 0x0a, 0x51, 0x43, 0x15, 0xf7, 0xa3, 0x00, 0x0f, 0x06, 0x00, 0x20, 0xd9, 
+	0xe5, 0x76, 0x01, 0x23, 0x0a, 0x3f, 0x0a, 0x00, 0xc8, 0xc4, 0x9a, 0xe5, 0x80, 0xc0, 0x4c, 0xe2, 
+	0x05, 0x0c, 0xc0, 0x58, 0xe0, 0x19, 0x09, 0xa7, 0x0c, 0x08, 0x3b, 0x10, 0x68, 0x02, 0xdf, 0x20, 
+	0xb7, 0x60, 0x02, 0xcf, 0xe5, 0x53, 0xb8, 0x00, 0x8b, 0xbc, 0x00, 0x6f, 0x04, 0x00, 0x01, 0xbf, 
+	0x00, 0x07, 0x04, 0x93, 0xec, 0xff, 0xea, 0x48, 0x20, 0x1f, 0xc0, 0xe3, 0x6d, 0x40, 0x00, 0x1f, 
+	0x11, 0xc3, 0x80, 0x1a, 0x27, 0x01, 0xc3, 0xbc, 0x00, 0x0b, 0xd4, 0x10, 0x23, 0x10, 0x77, 0x89, 
+	0xc0, 0x77, 0x85, 0x80, 0x77, 0x01, 0x90, 0x04, 0x89, 0x02, 0x01, 0x80, 0xc8, 0x06, 0xdf, 0x10, 
+	0xe3, 0x00, 0x40, 0x20, 0xa0, 0x13, 0x01, 0x10, 0xc1, 0x13, 0x95, 0x08, 0x37, 0x1a, 0x02, 0x00, 
+	0x0f, 0x48, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0xaa, 0x11, 0x4f, 0x04, 0x00, 0x0f, 0x50, 0x00, 0x0f, 
+	0x04, 0x00, 0x0f, 0x74, 0x12, 0xf2, 0x9f, 0x05, 0x00, 0xdf, 0xe5, 0xc4, 0x12, 0x6b, 0x00, 0x10, 
+	0x49, 0xe0, 0x02, 0x08, 0xdf, 0x02, 0xb8, 0x5b, 0xe2, 0x10, 0x0f, 0x12, 0x0b, 0x3b, 0xbf, 0xcd, 
+	0x92, 0xe7, 0x2b, 0x00, 0x08, 0xcc, 0x47, 0x01, 0x18, 0x9b, 0xe2, 0x20, 0x0e, 0x04, 0xa0, 0xe1, 
+	0x21, 0x00, 0x0b, 0x1b, 0xdb, 0x9b, 0xd7, 0x06, 0x58, 0x8d, 0xbe, 0x63, 0x90, 0x02, 0x03, 0x01, 
+	0x7f, 0xea, 0xe8, 0x24, 0x07, 0xda, 0xe5, 0x74, 0x01, 0xdf, 0x23, 0x5b, 0x02, 0x17, 0x20, 0x8b, 
+	0x54, 0xd0, 0x20, 0x67, 0x58, 0x15, 0xab, 0x5a, 0x0b, 0xcb, 0x42, 0x91, 0xa8, 0x00, 0xb7, 0x00, 
+	0x00, 0x2b, 0x90, 0x10, 0x07, 0x20, 0xa0, 0xa3, 0x50, 0x24, 0x27, 0x47, 0x52, 0x27, 0x47, 0xec, 
+	0xff, 0xff, 0xda, 0x12, 0xef, 0xc4, 0xda, 0x03, 0x4b, 0x51, 0xe1, 0x02, 0x3f, 0xaa, 0x65, 0x0c, 
+	0x02, 0x1f, 0x07, 0x03, 0xba, 0xe4, 0x00, 0xfb, 0x20, 0x01, 0xe3, 0x95, 0x08, 0x3b, 0x0a, 0xee, 
+	0x00, 0x0b, 0xa6, 0x3b, 0xa7, 0xca, 0x30, 0x3b, 0x02, 0x4c, 0xe0, 0x04, 0x50, 0x2d, 0xe9, 0x07, 
+	0xcb, 0xeb, 0xb0, 0x10, 0x1b, 0x07, 0x00, 0x1b, 0x06, 0xb8, 0xca, 0x31, 0xf8, 0xff, 0x20, 0xeb, 
+	0x00, 0x02, 0x77, 0xd4, 0xf7, 0xff, 0xcb, 0x04, 0x1a, 0x50, 0xbd, 0xe8, 0x00, 0x4b, 0x20, 0x63, 
+	0x24, 0x0c, 0x3f, 0x2a, 0x80, 0x20, 0x37, 0x51, 0xe3, 0x4a, 0xf8, 0xff, 0xca, 0x20, 0x00, 0xc5, 
+	0x9a, 0xb5, 0x00, 0xc8, 0x4c, 0xb0, 0x20, 0x00, 0xc5, 0x8a, 0xb5, 0xf8, 0x41, 0x2d, 0xe9, 0x05, 
+	0x00, 0xcc, 0x8a, 0xe2, 0x1e, 0x00, 0x9c, 0xe8, 0x04, 0xa9, 0x0a, 0x07, 0x04, 0x0a, 0x07, 0x04, 
+	0x0a, 0x07, 0x30, 0x85, 0x0f, 0x47, 0x10, 0x04, 0x18, 0xe3, 0x09, 0xf3, 0x0a, 0x08, 0x30, 0xc3, 
+	0x20, 0xe1, 0x34, 0x00, 0x0f, 0x08, 0x30, 0x83, 0xe1, 0xff, 0x00, 0x0c, 0x18, 0xe3, 0x38, 0x65, 
+	0x9a, 0x15, 0x3c, 0x40, 0x75, 0x13, 0xb7, 0xa0, 0xe1, 0xfc, 0x00, 0xa1, 0xe8, 0xdf, 0x02, 0xeb, 
+	0x1a, 0x27, 0x0a, 0x50, 0x0b, 0x10, 0x33, 0x50, 0x0b, 0x12, 0xcb, 0x50, 0x0b, 0x82, 0x0a, 0x27, 
+	0x1a, 0x00, 0x15, 0x8a, 0xe5, 0x10, 0x6f, 0x14, 0x82, 0x06, 0xbf, 0x1c, 0x25, 0x9a, 0xe5, 0x4d, 
+	0x00, 0xb3, 0x1c, 0x04, 0x25, 0x8a, 0xe5, 0xf8, 0x81, 0x07, 0xa3, 0x10, 0xdf, 0x02, 0xe5, 0x07, 
+	0x20, 0x01, 0xe2, 0x78, 0x1d, 0x7f, 0x20, 0x04, 0x80, 0xe1, 0x01, 0x00, 0x32, 0x20, 0xbf, 0x14, 
+	0x20, 0x48, 0xcf, 0x03, 0x3f, 0xcf, 0xe5, 0x02, 0x63, 0xea, 0x15, 0x8e, 0x48, 0x48, 0x18, 0x9f, 
+	0xe3, 0x06, 0x80, 0x0b, 0x33, 0x0d, 0x58, 0x94, 0x13, 0x33, 0xba, 0x03, 0x02, 0x77, 0x5e, 0x00, 
+	0x0b, 0x01, 0x00, 0x08, 0xc0, 0xa3, 0x10, 0x16, 0x14, 0x0b, 0x59, 0xe1, 0x14, 0x0a, 0xf6, 0x9a, 
+	0x05, 0x18, 0x40, 0x0b, 0x1c, 0x00, 0x0b, 0x20, 0xaa, 0x40, 0x0b, 0x24, 0x00, 0x0b, 0x28, 0x40, 
+	0x0b, 0x2c, 0x00, 0x0b, 0x54, 0xee, 0x0b, 0xd7, 0x13, 0xb7, 0x1b, 0x23, 0xe9, 0x03, 0x2f, 0x24, 
+	0x8f, 0x01, 0x4b, 0x68, 0x20, 0x00, 0x5f, 0x63, 0xbb, 0x74, 0x20, 0x4f, 0xe5, 0x84, 0xd0, 0x00, 
+	0x03, 0x17, 0x63, 0x28, 0x00, 0x2f, 0x64, 0x5b, 0x00, 0x08, 0x20, 0x6d, 0x1c, 0x0f, 0x07, 0x46, 
+	0x00, 0x08, 0xa4, 0x3e, 0x00, 0x00, 0x03, 0x18, 0xf5, 0x00, 0x06, 0x58, 0x4a, 0x34, 0x00, 0x08, 
+	0x1c, 0x0b, 0x5c, 0x17, 0x8c, 0x00, 0x0f, 0x88, 0x60, 0x00, 0x00, 0x08, 0x9c, 0x63, 0x00, 0x08, 
+	0xc4, 0x15, 0x00, 0x9a, 0xe5, 0x21, 0x07, 0x00, 0xe0, 0x88, 0x05, 0x10, 0x8a, 0xe5, 0x54, 0x17, 
+	0x57, 0x01, 0x91, 0xe7, 0x01, 0x0a, 0x09, 0x50, 0xe2, 0x50, 0x02, 0x63, 0x54, 0x00, 0x03, 0x58, 
+	0xba, 0x00, 0x03, 0x5c, 0x00, 0x03, 0x5e, 0x63, 0xfe, 0x5f, 0x89, 0x2d, 0xc3, 0x8c, 0xa8, 0x00, 
+	0x3f, 0x18, 0x00, 0x3f, 0xc8, 0x01, 0x3f, 0x80, 0x06, 0x02, 0x4b, 0xe0, 0x05, 0xa3, 0xe0, 0x68, 
+	0x00, 0x1f, 0x6c, 0x00, 0x03, 0x1e, 0x63, 0x2e, 0x18, 0x92, 0x06, 0xb7, 0xe0, 0x00, 0x03, 0x02, 
+	0x74, 0x50, 0x01, 0x88, 0x15, 0x3d, 0x00, 0x03, 0x10, 0x03, 0xf0, 0x0f, 0x07, 0xe4, 0x00, 0x03, 
+	0x55, 0xd8, 0x40, 0x03, 0xcc, 0x40, 0x03, 0xc0, 0x40, 0x03, 0xb4, 0x40, 0x03, 0x5a, 0xa8, 0x40, 
+	0x03, 0x9c, 0x40, 0x03, 0x08, 0x73, 0x03, 0x07, 0xe7, 0x03, 0x59, 0x40, 0x00, 0x03, 0x68, 0x00, 
+	0x03, 0x06, 0x07, 0x03, 0xa4, 0x00, 0x03, 0x50, 0xd0, 0x00, 0x03, 0xec, 0x00, 0x03, 0x0c, 0x01, 
+	0x00, 0x03, 0x55, 0x54, 0x00, 0x03, 0x80, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xb8, 0x00, 0x03, 0x81, 
+	0x01, 0xf4, 0x03, 0x1c, 0x02, 0x00, 0x03, 0x38, 0x00, 0x03, 0x35, 0x70, 0x3b, 0x0f, 0xdb, 0x00, 
+	0x07, 0x7c, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x50, 0xb8, 0x00, 0x03, 0xe0, 0x00, 0x03, 0x0c, 0x03, 
+	0x00, 0x03, 0x55, 0x28, 0x00, 0x03, 0x4c, 0x00, 0x03, 0x84, 0x00, 0x03, 0xb0, 0x00, 0x03, 0x53, 
+	0xd4, 0x00, 0x03, 0xe8, 0x00, 0x03, 0x18, 0x04, 0x00, 0x17, 0x00, 0x03, 0x50, 0x68, 0x00, 0x03, 
+	0x90, 0x00, 0x03, 0x1c, 0x05, 0x00, 0x03, 0x55, 0x3c, 0x00, 0x03, 0x68, 0x00, 0x03, 0x7c, 0x00, 
+	0x03, 0xa4, 0x00, 0x03, 0x54, 0xd0, 0x00, 0x03, 0x98, 0x00, 0x5b, 0xec, 0x00, 0x07, 0x34, 0x06, 
+	0x15, 0x00, 0x03, 0x58, 0x00, 0x03, 0x80, 0x00, 0x03, 0x94, 0x00, 0x03, 0x50, 0xc4, 0x00, 0x03, 
+	0xf8, 0x00, 0x03, 0x14, 0x07, 0x00, 0x03, 0x55, 0x2c, 0x00, 0x03, 0x74, 0x00, 0x03, 0x94, 0x00, 
+	0x03, 0xc0, 0x00, 0x03, 0x41, 0xd4, 0x00, 0x03, 0x1c, 0x08, 0x00, 0x03, 0x64, 0x00, 0x03, 0x54, 
+	0x8c, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xec, 0x00, 0x03, 0x18, 0x09, 0x15, 0x00, 0x03, 0xf4, 0x00, 
+	0x4f, 0x40, 0x00, 0x07, 0x64, 0x00, 0x03, 0x5a, 0x8c, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x10, 0xff, 
+	0xbc, 0x00, 0x07, 0xd4, 0xa0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x08, 0x0a, 0x00, 0x03, 0x24, 0xab, 
+	0x00, 0x03, 0x3c, 0x00, 0x03, 0x64, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x10, 0x23, 0x55, 0x94, 0x00, 
+	0x07, 0xb0, 0x00, 0x03, 0xcc, 0x00, 0x03, 0xe8, 0x00, 0x03, 0x35, 0x04, 0x0b, 0x00, 0x7b, 0x00, 
+	0x03, 0x44, 0x00, 0x03, 0x60, 0x00, 0x03, 0xaa, 0x10, 0x23, 0x78, 0x00, 0x07, 0x90, 0x00, 0x03, 
+	0xac, 0x00, 0x03, 0xc4, 0xa6, 0x00, 0x03, 0xec, 0x00, 0x03, 0x04, 0x0c, 0x01, 0x5f, 0x00, 0x03, 
+	0x3c, 0xd5, 0x00, 0x03, 0x10, 0x23, 0x54, 0x00, 0x07, 0x70, 0x00, 0x03, 0x8c, 0x00, 0x03, 0x58, 
+	0xb4, 0x00, 0x03, 0xcc, 0x00, 0x03, 0x03, 0xd0, 0x03, 0x00, 0x0d, 0xea, 0x00, 0xb7, 0x00, 0x03, 
+	0x10, 0x23, 0x34, 0x00, 0x07, 0x4c, 0x00, 0x03, 0x74, 0xaa, 0x00, 0x03, 0x8c, 0x00, 0x03, 0xa8, 
+	0x00, 0x03, 0xc4, 0x00, 0x03, 0xe0, 0xa6, 0x00, 0x03, 0xfc, 0x40, 0x23, 0x14, 0x0e, 0x00, 0x53, 
+	0x00, 0x03, 0x54, 0xaa, 0x00, 0x03, 0x7c, 0x00, 0x03, 0xa8, 0x00, 0x03, 0xd0, 0x00, 0x03, 0x08, 
+	0x0a, 0x3c, 0x00, 0x08, 0x30, 0x00, 0x03, 0xfc, 0x00, 0x0b, 0x2c, 0x6a, 0x0f, 0x00, 0x1f, 0x00, 
+	0x03, 0x68, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x90, 0xab, 0x00, 0x03, 0xa4, 0x00, 0x03, 0xb8, 0x00, 
+	0x03, 0xcc, 0x00, 0x03, 0x10, 0x47, 0x4d, 0xf0, 0x00, 0x07, 0x1c, 0x10, 0x00, 0xc7, 0x00, 0x03, 
+	0x70, 0x00, 0x03, 0x54, 0x98, 0x00, 0x03, 0xc4, 0x00, 0x03, 0xec, 0x00, 0x03, 0x24, 0x11, 0xd5, 
+	0x00, 0x17, 0x00, 0x03, 0x78, 0x00, 0x03, 0xb0, 0x00, 0x03, 0xe4, 0x00, 0x03, 0x05, 0x1c, 0x12, 
+	0x00, 0x03, 0x50, 0x00, 0x03, 0x88, 0x00, 0x03, 0x53, 0xc8, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x20, 
+	0x13, 0x00, 0xaf, 0x00, 0x03, 0x54, 0x7c, 0x00, 0x03, 0xa8, 0x00, 0x03, 0xd8, 0x00, 0x03, 0x04, 
+	0x14, 0xd5, 0x02, 0x53, 0x00, 0x03, 0x58, 0x00, 0x03, 0x94, 0x00, 0x03, 0xcc, 0x00, 0x03, 0x35, 
+	0x08, 0x15, 0x00, 0x13, 0x00, 0x03, 0x7c, 0x00, 0x03, 0xb4, 0x00, 0x03, 0x4d, 0xfc, 0x00, 0x03, 
+	0x20, 0x16, 0x00, 0xc7, 0x00, 0x03, 0x58, 0x00, 0x03, 0x55, 0x74, 0x00, 0x03, 0x90, 0x00, 0x03, 
+	0xac, 0x00, 0x03, 0xc8, 0x00, 0x03, 0x41, 0xf4, 0x00, 0x03, 0x10, 0x17, 0x00, 0x03, 0x30, 0x00, 
+	0x03, 0x55, 0x4c, 0x00, 0x03, 0x6c, 0x00, 0x03, 0x88, 0x00, 0x03, 0xa8, 0x00, 0x03, 0x53, 0xc4, 
+	0x00, 0x03, 0xf0, 0x00, 0x03, 0x08, 0x18, 0x02, 0x67, 0x00, 0x03, 0x55, 0x44, 0x00, 0x03, 0x64, 
+	0x00, 0x03, 0x80, 0x00, 0x03, 0xa0, 0x00, 0x03, 0x53, 0xbc, 0x00, 0x03, 0xe8, 0x00, 0x03, 0x04, 
+	0x19, 0x01, 0x4f, 0x00, 0x03, 0x55, 0x60, 0x00, 0x03, 0x90, 0x00, 0x03, 0xbc, 0x00, 0x03, 0xec, 
+	0x00, 0x03, 0x35, 0x18, 0x1a, 0x00, 0x73, 0x01, 0x27, 0x54, 0x00, 0x07, 0x6c, 0x00, 0x03, 0x53, 
+	0xa0, 0x00, 0x03, 0xd4, 0x00, 0x03, 0x14, 0x1b, 0x00, 0x6f, 0x00, 0x03, 0x54, 0x6c, 0x00, 0x03, 
+	0x98, 0x00, 0x03, 0xe8, 0x00, 0x03, 0x04, 0x1c, 0x13, 0x00, 0x03, 0x48, 0x00, 0x03, 0x80, 0x21, 
+	0x01, 0x23, 0x00, 0x07, 0x59, 0x8c, 0x00, 0x03, 0xe0, 0x00, 0x03, 0x10, 0x1f, 0x14, 0x1d, 0x01, 
+	0x67, 0xb5, 0x00, 0x03, 0x60, 0x00, 0x03, 0x11, 0x4f, 0x88, 0x00, 0x07, 0xa4, 0x00, 0x03, 0x66, 
+	0xe0, 0x00, 0x03, 0x10, 0x1f, 0x10, 0x1e, 0x03, 0x0b, 0x00, 0x37, 0x28, 0xd6, 0x00, 0x07, 0x10, 
+	0x1f, 0x50, 0x40, 0x07, 0x6c, 0x00, 0x07, 0x10, 0x1f, 0xa0, 0x6e, 0x3f, 0x00, 0xcf, 0x00, 0x0b, 
+	0xd8, 0x00, 0x07, 0x10, 0x17, 0x10, 0x03, 0xdc, 0x95, 0x00, 0x0f, 0x18, 0x1f, 0x30, 0x1f, 0x38, 
+	0x00, 0x07, 0x68, 0x00, 0x03, 0x7a, 0x8c, 0x00, 0x03, 0x50, 0x1f, 0x22, 0xb3, 0x40, 0x1f, 0x24, 
+	0x03, 0xfb, 0xdc, 0xa5, 0x00, 0x0b, 0x54, 0x00, 0x07, 0x1c, 0x20, 0x30, 0x1b, 0x30, 0x00, 0x07, 
+	0x6a, 0x7c, 0x00, 0x03, 0x10, 0x1f, 0x9c, 0x00, 0x07, 0xcc, 0x00, 0x03, 0xe0, 0xb6, 0x00, 0x03, 
+	0x44, 0x00, 0x87, 0x50, 0x3f, 0x50, 0x00, 0x0b, 0x10, 0x1f, 0x90, 0xe9, 0x04, 0x03, 0xf0, 0x03, 
+	0x70, 0x03, 0xd8, 0x0b, 0x1b, 0x10, 0x3b, 0x01, 0x67, 0x55, 0x45, 0x30, 0x03, 0x14, 0x00, 0x03, 
+	0x24, 0x10, 0x07, 0x40, 0x30, 0x03, 0xff, 0x94, 0x8b, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xbc, 0x70, 0x01, 0x02, 0x00, 0x01, 0xf0, 0x15, 0xb0, 
+	0x01, 0x1b, 0xf7, 0x08, 0xbc, 0xf8, 0xb5, 0x4b, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0x48, 0xac, 0x02, 0x10, 0x02, 0x88, 0x9c, 0x00, 0x03, 0xae, 0x02, 0x02, 0xc8, 0x41, 0x9e, 0x30, 
+	0x63, 0x48, 0xbd, 0x02, 0x02, 0xa8, 0x00, 0x6f, 0xff, 0x07, 0xcf, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x30, 0x01, 0x9d, 0xc0, 0x74, 0x50, 0x46, 0x30, 0x03, 
+	0x30, 0x0c, 0x03, 0x67, 0x4f, 0xf1, 0xc7, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 
+	0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0x80, 0x50, 0x01, 0x04, 0xf0, 0x1f, 0xe5, 0x8c, 0xf6, 0x00, 0x42, 0x06, 0x10, 0x07, 0x60, 
+	0x50, 0x00, 0x08, 0x10, 0x07, 0x70, 0xc1, 0x00, 0x07, 0x10, 0x1b, 0xa9, 0x8f, 0x00, 0x08, 0x29, 
+	0x00, 0x03, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf8, 0xb5, 0x98, 0x23, 0x00, 0x1b, 0x02, 0x98, 0x42, 
+	0x28, 0xda, 0x3f, 0x26, 0x00, 0x1f, 0x4b, 0xc0, 0x18, 0x1f, 0x4b, 0x05, 0x11, 0x00, 0x1c, 0x68, 
+	0xc3, 0x17, 0x42, 0x18, 0x33, 0x40, 0x00, 0xe9, 0x0f, 0x5b, 0x19, 0x49, 0x19, 0x01, 0x25, 0x00, 
+	0x1f, 0x27, 0x6d, 0x42, 0x28, 0x00, 0x0f, 0x32, 0x00, 0x12, 0x11, 0x49, 0x10, 0x01, 0x32, 0x39, 
+	0x40, 0x00, 0x88, 0x40, 0xd1, 0x17, 0x31, 0x40, 0xd6, 0x0f, 0x00, 0x89, 0x18, 0xb2, 0x18, 0x52, 
+	0x10, 0x3a, 0x40, 0x00, 0x95, 0x40, 0x9b, 0x11, 0x9a, 0x00, 0xa6, 0x18, 0x00, 0xed, 0x43, 0x37, 
+	0x68, 0x89, 0x11, 0x8b, 0x42, 0x00, 0x05, 0xd1, 0x28, 0x40, 0x38, 0x43, 0x30, 0x60, 0x02, 0xf8, 
+	0xbc, 0x01, 0xbc, 0x00, 0x47, 0x10, 0x09, 0x00, 0x00, 0x26, 0x8b, 0x42, 0x02, 0xda, 0xc9, 0x1a, 
+	0x01, 0x00, 0x39, 0x8e, 0x00, 0x17, 0x1d, 0x32, 0x00, 0xf6, 0x00, 0x19, 0xe0, 0x19, 0xff, 0x21, 
+	0xa4, 0x19, 0x00, 0x00, 0xf0, 0x0f, 0xfc, 0x23, 0x68, 0x2b, 0x43, 0x23, 0x00, 0x60, 0xe8, 0xe7, 
+	0xc0, 0x46, 0x00, 0x80, 0xff, 0x00, 0xff, 0x60, 0x56, 0x00, 0x03, 0xf7, 0xb5, 0x17, 0x00, 0x4a, 
+	0x53, 0x68, 0x01, 0x93, 0x16, 0x4b, 0x95, 0x00, 0x68, 0x1b, 0x68, 0x9c, 0x46, 0x00, 0x2d, 0x0d, 
+	0x00, 0xd1, 0x14, 0x4b, 0xd5, 0x60, 0x1d, 0x80, 0x14, 0x00, 0x4b, 0x51, 0x60, 0x20, 0x31, 0x19, 
+	0x60, 0x10, 0x00, 0x4b, 0x90, 0x60, 0x20, 0x30, 0x18, 0x60, 0xf7, 0x80, 0x20, 0x61, 0xd3, 0x68, 
+	0x17, 0x2b, 0x11, 0xdc, 0x67, 0x00, 0x46, 0x0b, 0x4e, 0xdc, 0x00, 0xa5, 0x53, 0x34, 0x00, 0x19, 
+	0x7d, 0x1b, 0x65, 0x80, 0x01, 0x9d, 0x01, 0x00, 0x33, 0x65, 0x60, 0xd3, 0x60, 0x00, 0x28, 0xe4, 
+	0x00, 0xd1, 0x18, 0x2b, 0xe2, 0xd0, 0xdb, 0x00, 0x98, 0x02, 0x53, 0xdf, 0xe7, 0xdb, 0x46, 0xdd, 
+	0x00, 0x67, 0x4c, 0x00, 0x78, 0x00, 0x03, 0x70, 0x57, 0x00, 0x03, 0x5c, 0x08, 0x98, 0x02, 0x02, 
+	0x74, 0x00, 0x07, 0xf0, 0xb5, 0x06, 0x00, 0x00, 0x8b, 0xb0, 0x00, 0x2e, 0x03, 0xdc, 0x0b, 0x20, 
+	0xb0, 0xf0, 0x20, 0x51, 0x80, 0x21, 0x9f, 0x4b, 0x1b, 0x00, 0x88, 0xf0, 0x18, 0x42, 0x1e, 0x09, 
+	0x02, 0x8b, 0x00, 0x42, 0x00, 0xda, 0x8b, 0xe0, 0xf0, 0x21, 0x09, 0x00, 0x02, 0x0a, 0x40, 0x19, 
+	0x0b, 0x09, 0x03, 0x00, 0x00, 0x24, 0x05, 0x94, 0x8a, 0x42, 0x02, 0xd0, 0x81, 0x00, 0x1a, 0x05, 
+	0x91, 0xd6, 0x1a, 0xf8, 0x20, 0x96, 0x00, 0x4a, 0x15, 0x88, 0x71, 0x19, 0x00, 0x02, 0x4a, 0x00, 
+	0x1e, 0x02, 0x40, 0xe8, 0x0a, 0xc0, 0x02, 0x82, 0x00, 0x42, 0x04, 0xd0, 0x05, 0x98, 0x89, 0x1a, 
+	0x41, 0x00, 0x18, 0x05, 0x91, 0x56, 0x1b, 0x8f, 0x4a, 0x90, 0x00, 0x48, 0x19, 0x13, 0x89, 0x00, 
+	0x89, 0x58, 0x00, 0x00, 0x78, 0xc9, 0x18, 0x02, 0x28, 0x00, 0xd0, 0xf5, 0x00, 0xe0, 0x28, 0x13, 
+	0x80, 0x00, 0x80, 0x58, 0x80, 0x00, 0x22, 0x40, 0x19, 0x12, 0x02, 0x95, 0x42, 0x00, 0x00, 0xd0, 
+	0xf3, 0xe0, 0x88, 0x4c, 0x22, 0x68, 0x9a, 0x80, 0x00, 0x09, 0xfb, 0xe0, 0x00, 0x21, 0x08, 0x00, 
+	0xff, 0x00, 0xf7, 0x7e, 0xff, 0x84, 0x4b, 0x85, 0x4a, 0x1b, 0x00, 0x78, 0x01, 0x92, 0x00, 0x2b, 
+	0x01, 0xd1, 0x83, 0x00, 0x4b, 0x01, 0x93, 0x01, 0x9b, 0x20, 0x68, 0x1c, 0x00, 0x00, 0xc0, 0x34, 
+	0x19, 0x88, 0x00, 0x29, 0x07, 0x00, 0xd0, 0x5a, 0x88, 0x52, 0x18, 0x81, 0x42, 0x46, 0x01, 0xd2, 
+	0xdb, 0x46, 0x00, 0x23, 0x01, 0x9a, 0x00, 0x4e, 0x00, 0x23, 0x7b, 0x4f, 0x04, 0x93, 0x04, 0x9b, 
+	0xdb, 0x00, 0x00, 0xfb, 0x5a, 0x00, 0x2b, 0x04, 0xd0, 0x04, 0x00, 0x9b, 0x01, 0x33, 0x04, 0x93, 
+	0x18, 0x2b, 0xf5, 0x00, 0xd1, 0x00, 0x25, 0x01, 0x9a, 0xeb, 0x00, 0xd3, 0x80, 0x00, 0x15, 0x02, 
+	0xd0, 0x01, 0x35, 0x18, 0x2d, 0xf7, 0x00, 0xd1, 0x00, 0x22, 0x71, 0x4b, 0x06, 0x92, 0x1a, 0x00, 
+	0x60, 0x02, 0x92, 0x06, 0x9b, 0x04, 0x9a, 0x93, 0x01, 0x42, 0x28, 0xd1, 0x17, 0x2d, 0x03, 0xdc, 
+	0x10, 0x47, 0x01, 0xed, 0x00, 0xab, 0x52, 0x6a, 0x4b, 0x1b, 0x01, 0x4d, 0x80, 0x00, 0x0f, 0x21, 
+	0x69, 0x4a, 0xdb, 0x00, 0x99, 0x52, 0x00, 0x5d, 0x49, 0x33, 0x04, 0x0a, 0x88, 0x1b, 0x0c, 0x00, 
+	0x9a, 0x18, 0x0a, 0x80, 0x5b, 0x4a, 0x11, 0x88, 0x00, 0x5b, 0x18, 0xdb, 0x04, 0x63, 0x49, 0xdb, 
+	0x0c, 0x00, 0x0b, 0x43, 0x13, 0x80, 0x05, 0x9e, 0x64, 0xe7, 0x00, 0xc0, 0x24, 0x99, 0x0b, 0x24, 
+	0x02, 0x89, 0x03, 0x00, 0x22, 0x40, 0x72, 0xe7, 0x08, 0x33, 0xa3, 0x42, 0x00, 0xb9, 0xd0, 0x10, 
+	0x00, 0xac, 0xe7, 0x02, 0x9b, 0x00, 0xdc, 0x00, 0x01, 0x9b, 0x1c, 0x19, 0x02, 0x9b, 0x00, 0x08, 
+	0x93, 0x9d, 0x42, 0x05, 0xdc, 0x3b, 0x00, 0x00, 0x01, 0x35, 0x03, 0xcb, 0x03, 0xc4, 0x38, 0x00, 
+	0x04, 0x4d, 0xe0, 0x22, 0x68, 0x3b, 0x00, 0xeb, 0x0f, 0xd1, 0x10, 0x7b, 0x68, 0x62, 0x00, 0x07, 
+	0x03, 0xd0, 0x20, 0x00, 0x01, 0x63, 0x60, 0x00, 0xf0, 0xfb, 0xfa, 0x02, 0x00, 0xb3, 0x10, 0x02, 
+	0x93, 0x06, 0x00, 0x05, 0x06, 0x93, 0x08, 0x37, 0x00, 0xb0, 0xe7, 0x3a, 0x88, 0x7b, 0x88, 0x9b, 
+	0x18, 0x00, 0x9c, 0x46, 0x02, 0x98, 0x21, 0x88, 0x63, 0x88, 0x00, 0x01, 0x30, 0x03, 0x90, 0x5b, 
+	0x18, 0x8c, 0x45, 0x01, 0x30, 0xdd, 0x93, 0x42, 0x50, 0xdd, 0x08, 0x00, 0xe9, 0x00, 0x09, 0x93, 
+	0x09, 0x99, 0x01, 0x9b, 0x59, 0x18, 0x00, 0x03, 0x00, 0x02, 0x90, 0x07, 0x93, 0x07, 0x9b, 0x00, 
+	0xab, 0x42, 0x38, 0xdb, 0x07, 0x9a, 0x08, 0x9b, 0x00, 0xd3, 0x1a, 0x5a, 0x1e, 0x07, 0x92, 0x01, 
+	0x2b, 0x00, 0x13, 0xd0, 0x03, 0x9b, 0xea, 0x1a, 0x07, 0x9b, 0x00, 0xd2, 0x1a, 0x00, 0x2a, 0x0b, 
+	0xdd, 0x9c, 0x46, 0x00, 0x03, 0x99, 0x09, 0x98, 0x01, 0x9b, 0x61, 0x44, 0x00, 0xc9, 0x00, 0x08, 
+	0x30, 0xd2, 0x00, 0x59, 0x18, 0x00, 0x18, 0x18, 0x00, 0xf0, 0xc8, 0xfa, 0x07, 0x9b, 0x00, 0xed, 
+	0x1a, 0x23, 0x00, 0x3a, 0x00, 0x03, 0xca, 0x00, 0x03, 0xc3, 0x20, 0x00, 0x00, 0xf0, 0xb7, 0xfa, 
+	0x01, 0xbd, 0xe7, 0x93, 0x42, 0x1f, 0xdd, 0x02, 0x00, 0x3b, 0x10, 0x03, 0x9b, 0xd8, 0x00, 0xc5, 
+	0x21, 0x00, 0xd2, 0x00, 0x92, 0x10, 0x2b, 0xb2, 0xfa, 0x90, 0x27, 0xa3, 0xfa, 0x00, 0xd1, 0x9b, 
+	0x00, 0xa6, 0xe7, 0x0b, 0x89, 0x08, 0x00, 0x9c, 0x45, 0x00, 0xc2, 0xdd, 0x40, 0x89, 0xc0, 0x18, 
+	0x08, 0x31, 0x04, 0x82, 0x42, 0xbd, 0xda, 0x07, 0x00, 0xc1, 0xb6, 0xe7, 0x00, 0x03, 0x9b, 0x08, 
+	0x34, 0x02, 0x93, 0x7e, 0xe7, 0x00, 0x01, 0x28, 0x00, 0xd1, 0x5c, 0xe7, 0x2b, 0x13, 0x02, 0x9b, 
+	0x00, 0x98, 0x58, 0x40, 0x19, 0x13, 0x6b, 0x9d, 0x00, 0x42, 0x08, 0xdb, 0x14, 0x4b, 0x14, 0x4a, 
+	0xeb, 0x02, 0x18, 0x5b, 0x11, 0x9b, 0x18, 0x32, 0x00, 0x4b, 0x9b, 0x10, 0xfa, 0x4b, 0xe7, 0x10, 
+	0x07, 0x91, 0xfa, 0x31, 0x00, 0x41, 0x28, 0x01, 0xfd, 0x35, 0xfe, 0x43, 0xe7, 0x5c, 0x03, 0x07, 
+	0x41, 0x5e, 0x00, 0x03, 0xa8, 0x55, 0x00, 0x03, 0xeb, 0x00, 0x07, 0x04, 0x04, 0x00, 0x00, 0x02, 
+	0x5b, 0x00, 0x07, 0xdc, 0x96, 0x03, 0x02, 0x02, 0x9c, 0x97, 0x02, 0x02, 0x12, 0xbb, 0x12, 0xc7, 
+	0x60, 0x18, 0x00, 0x0f, 0x13, 0x37, 0x00, 0x68, 0xff, 0xff, 0x9c, 0x00, 0x99, 0x02, 0x02, 0x07, 
+	0x04, 0xa0, 0xe1, 0x02, 0x00, 0x02, 0x13, 0xe3, 0x02, 0x05, 0x80, 0x13, 0x00, 0x00, 0x00, 0x90, 
+	0xe0, 0x00, 0x30, 0x0f, 0xe1, 0x06, 0x00, 0x32, 0x03, 0xe2, 0xff, 0x74, 0x07, 0xe2, 0x20, 0x00, 
+	0x74, 0x87, 0xe1, 0x80, 0x80, 0x58, 0xe2, 0x01, 0x00, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x9a, 0x57, 
+	0xb8, 0x08, 0xf4, 0x9a, 0xe5, 0x05, 0x00, 0x2f, 0x23, 0x3f, 0xb0, 0x10, 0xe1, 0x60, 0x00, 0x00, 
+	0x37, 0x05, 0x10, 0xe3, 0x02, 0x00, 0x32, 0x83, 0x13, 0xff, 0x04, 0x10, 0xe2, 0x01, 0x00, 0x31, 
+	0x83, 0x03, 0xff, 0x54, 0x05, 0xe2, 0x20, 0x21, 0x54, 0x85, 0xe0, 0x33, 0xa6, 0x0c, 0xb0, 0xe1, 
+	0x60, 0x57, 0x02, 0x68, 0x06, 0xe2, 0x00, 0x6c, 0x86, 0xe0, 0x23, 0xa7, 0x82, 0x90, 0x23, 0x78, 
+	0x07, 0xe2, 0x00, 0x7c, 0xf0, 0x7b, 0x01, 0x06, 0x1c, 0xa0, 0xe3, 0xa0, 0x01, 0x00, 0x77, 0x00, 
+	0x23, 0x01, 0x01, 0x32, 0x83, 0xe3, 0x11, 0x00, 0x15, 0xe1, 0x10, 0x77, 0xd8, 0xf0, 0x27, 0xd0, 
+	0x27, 0x16, 0xf0, 0x27, 0x00, 0x27, 0x27, 0xc8, 0xa0, 0x00, 0xe1, 0x2c, 0x16, 0xe0, 0xe1, 0x00, 
+	0xe0, 0x8f, 0x00, 0xe2, 0x01, 0xf1, 0x9a, 0xe7, 0x00, 0x28, 0xa0, 0x01, 0xe1, 0x01, 0x00, 0x59, 
+	0xe5, 0x01, 0x18, 0x30, 0x3f, 0x00, 0x07, 0x00, 0x00, 0xe2, 0x11, 0x20, 0x82, 0xe1, 0x00, 0x22, 
+	0x08, 0xa0, 0xe1, 0x0f, 0x1a, 0x0c, 0xe2, 0x08, 0x01, 0x2b, 0x8a, 0xe2, 0x10, 0x2b, 0x21, 0xf5, 
+	0x92, 0x10, 0xe7, 0x01, 0x8c, 0xb0, 0x4b, 0x12, 0x2d, 0x8a, 0xe2, 0x00, 0xf8, 0x0b, 0x82, 0xe8, 
+	0xe6, 0x05, 0xda, 0xe5, 0x00, 0x01, 0x00, 0x50, 0xe3, 0x05, 0x00, 0x00, 0x1a, 0x02, 0xb4, 0x04, 
+	0x9a, 0xe5, 0xec, 0x15, 0x00, 0x8f, 0x00, 0x40, 0x50, 0x00, 0x57, 0x00, 0xba, 0x0f, 0xe0, 0xa0, 
+	0xe1, 0x00, 0xe8, 0xf2, 0x9f, 0xe5, 0xe8, 0x12, 0x9f, 0xe5, 0x00, 0xb0, 0x00, 0xd1, 0xe1, 0xff, 
+	0x00, 0x20, 0xe2, 0x00, 0x03, 0x0c, 0x20, 0xe2, 0xdc, 0x14, 0x9a, 0xe5, 0x00, 0x00, 0x10, 0x21, 
+	0xe0, 0x00, 0x10, 0x01, 0xe0, 0x00, 0xdc, 0x04, 0x8a, 0xe5, 0xfc, 0x25, 0xda, 0xe5, 0x00, 0x00, 
+	0x00, 0x52, 0xe3, 0xf8, 0x4f, 0xbd, 0x08, 0x04, 0x1e, 0xff, 0x2f, 0x01, 0x60, 0x00, 0x73, 0x03, 
+	0x0c, 0x01, 0x11, 0xe3, 0x01, 0x0c, 0x10, 0x13, 0x02, 0x00, 0x03, 0x00, 0xac, 0x12, 0x9f, 0x15, 
+	0x11, 0xff, 0x2f, 0x11, 0x00, 0x03, 0x3c, 0x10, 0xe2, 0x03, 0x3c, 0x33, 0x12, 0x04, 0x0c, 0x00, 
+	0xc0, 0x13, 0xe0, 0x00, 0x37, 0x0e, 0x00, 0x20, 0x00, 0x0a, 0x00, 0x1f, 0xe3, 0x08, 0x00, 0x11, 
+	0x13, 0x21, 0xd7, 0x24, 0x00, 0x87, 0x20, 0x82, 0x12, 0x03, 0x00, 0x47, 0x00, 0x00, 0x20, 0xa0, 
+	0x03, 0xd7, 0x24, 0xca, 0xe5, 0xda, 0x00, 0x3f, 0x20, 0x1b, 0x70, 0x40, 0x3f, 0x10, 0x0f, 0x04, 
+	0x00, 0x0f, 0x64, 0xd4, 0x40, 0x0f, 0x10, 0x9f, 0x5c, 0x00, 0x9f, 0xdc, 0x00, 0xb7, 0xf4, 0x25, 
+	0xc0, 0x00, 0x93, 0x00, 0xc7, 0xf8, 0x25, 0x9a, 0x15, 0x01, 0x20, 0x02, 0x52, 0xe2, 0xf4, 0x25, 
+	0x8a, 0xe5, 0x00, 0x1f, 0x01, 0x00, 0x40, 0xf2, 0x9f, 0x05, 0x00, 0x10, 0xa0, 0xe3, 0x04, 0xe8, 
+	0x14, 0xca, 0xe5, 0xd4, 0x00, 0x27, 0x01, 0x00, 0x20, 0x10, 0xe3, 0x00, 0x17, 0x11, 0x2c, 0xf2, 
+	0x9f, 0x15, 0x22, 0x12, 0x0d, 0x11, 0x03, 0x90, 0xe8, 0x24, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xd1, 
+	0xe5, 0x7c, 0x20, 0x00, 0xe2, 0x02, 0x80, 0x00, 0xfb, 0x00, 0x20, 0xc1, 0x15, 0x0c, 0x20, 0x41, 
+	0x20, 0x15, 0xc8, 0x00, 0x2f, 0x00, 0x80, 0x88, 0xe0, 0x08, 0x09, 0x02, 0x9f, 0xe5, 0xb8, 0x00, 
+	0xaf, 0x06, 0x1c, 0x01, 0x4f, 0x00, 0x10, 0x81, 0xe2, 0x00, 0x00, 0x91, 0xe5, 0xf8, 0x44, 0x11, 
+	0x10, 0x33, 0x81, 0xe5, 0xc0, 0x01, 0x4b, 0x00, 0x00, 0x00, 0xa0, 0xe3, 0x24, 0x05, 0xca, 0xe5, 
+	0x5c, 0x05, 0x85, 0x00, 0x0b, 0x05, 0x8a, 0xe5, 0x54, 0x00, 0x07, 0x1c, 0x00, 0x07, 0x05, 0x07, 
+	0x00, 0xe0, 0xe3, 0x00, 0x01, 0x8b, 0x20, 0x00, 0x0b, 0x00, 0xcc, 0xf1, 0x9f, 0xe5, 0xff, 0x5f, 
+	0x2d, 0xe9, 0xa0, 0x10, 0xb3, 0xc4, 0x00, 0x0b, 0x01, 0x03, 0xa0, 0xe3, 0x00, 0x02, 0x12, 0xd0, 
+	0xe5, 0x01, 0x10, 0xc1, 0x00, 0x07, 0xc0, 0x08, 0xe5, 0x08, 0x10, 0x50, 0x20, 0x0b, 0x08, 0x10, 
+	0x40, 0x20, 0xe5, 0xe3, 0x01, 0x93, 0x00, 0x00, 0xb0, 0xe1, 0x4c, 0xad, 0x01, 0x93, 0x50, 0x00, 
+	0x4b, 0x4c, 0x00, 0x3f, 0x10, 0x37, 0x90, 0x00, 0x37, 0x04, 0xe4, 0x04, 0xda, 0xe5, 0x80, 0x00, 
+	0xc3, 0x28, 0x05, 0x01, 0xca, 0x05, 0x28, 0x05, 0xda, 0x15, 0x29, 0x40, 0x77, 0x41, 0x60, 0x01, 
+	0xb7, 0x5c, 0x15, 0x8a, 0xe5, 0x60, 0x40, 0x7f, 0x55, 0x58, 0x00, 0x0f, 0x54, 0x00, 0x0f, 0x58, 
+	0x00, 0x0f, 0x01, 0x00, 0x9f, 0x56, 0x81, 0x00, 0x27, 0x64, 0x40, 0x57, 0x11, 0x11, 0x77, 0x01, 
+	0x2b, 0x0b, 0xb2, 0x00, 0x07, 0x03, 0x00, 0x07, 0x03, 0x7b, 0x0a, 0x6c, 0x00, 0x33, 0x68, 0xa8, 
+	0x00, 0x33, 0x6c, 0x00, 0x33, 0x68, 0x00, 0x33, 0x06, 0x00, 0x00, 0x33, 0xea, 0xfc, 0x00, 0xff, 
+	0x10, 0x13, 0xfc, 0x14, 0x30, 0x13, 0x02, 0x13, 0x5a, 0xea, 0x10, 0x87, 0x0c, 0x00, 0x87, 0x10, 
+	0xf3, 0x64, 0x00, 0x53, 0xd7, 0xda, 0x00, 0x8f, 0x12, 0x3f, 0x67, 0x00, 0x8b, 0x10, 0x5b, 0x16, 
+	0x00, 0x4b, 0x83, 0xd8, 0x00, 0x67, 0x10, 0x5f, 0x02, 0x00, 0xbf, 0x10, 0x2f, 0xe0, 0xf0, 0x9f, 
+	0x21, 0xe5, 0x0d, 0x00, 0x3b, 0x02, 0x00, 0x18, 0xe3, 0x00, 0x8b, 0x2b, 0x03, 0x65, 0x00, 0xbb, 
+	0x19, 0x00, 0x27, 0x66, 0x40, 0x27, 0x10, 0x7f, 0xc2, 0x10, 0x3b, 0x11, 0x97, 0xb8, 0xf0, 0x9f, 
+	0x15, 0x10, 0x33, 0xb4, 0xda, 0x00, 0x33, 0x10, 0xb7, 0x66, 0x00, 0x63, 0x10, 0x6b, 0x67, 0x00, 
+	0x07, 0x0c, 0xeb, 0x00, 0x43, 0x50, 0x33, 0x40, 0x1b, 0x05, 0x00, 0x4b, 0x15, 0x50, 0x6f, 0x11, 
+	0xef, 0x0b, 0x74, 0xf0, 0x9f, 0x05, 0x10, 0x3f, 0x78, 0x00, 0x3f, 0x50, 0x37, 0xba, 0x10, 0x0f, 
+	0x6c, 0x00, 0x0f, 0x10, 0xab, 0x10, 0x27, 0x03, 0x40, 0x97, 0x54, 0x80, 0x80, 0x23, 0x02, 0xda, 
+	0x7f, 0xeb, 0xff, 0x9f, 0xbd, 0x10, 0xe8, 0xb0, 0x52, 0x05, 0x3e, 0x01, 0x00, 0x04, 0xa5, 0x00, 
+	0x38, 0x00, 0x08, 0x79, 0x30, 0x00, 0x08, 0xad, 0x00, 0x2e, 0x00, 0x08, 0xd4, 0x3c, 0x00, 0x03, 
+	0x68, 0x05, 0x69, 0x00, 0x08, 0x8c, 0x46, 0x08, 0x53, 0x50, 0x07, 0x5b, 0x00, 0x4a, 0x00, 0x03, 
+	0xa4, 0x3e, 0x00, 0x03, 0x28, 0x00, 0x2e, 0x00, 0x03, 0x78, 0x4e, 0x00, 0x03, 0xbc, 0x00, 0x31, 
+	0x00, 0x03, 0xac, 0x3b, 0x00, 0x03, 0x80, 0x09, 0x5d, 0x00, 0x08, 0xf4, 0x00, 0x03, 0xa4, 0x47, 
+	0x07, 0x7b, 0x08, 0x60, 0x00, 0x08, 0x64, 0x08, 0x9f, 0x78, 0x47, 0xfd, 0x00, 0xe7, 0x00, 0xc0, 
+	0x9f, 0xe5, 0x1c, 0xff, 0x2f, 0x04, 0xe1, 0x8d, 0x02, 0x00, 0x08, 0x90, 0x0f, 0x15, 0x90, 0xb3, 
+	0xb0, 0x0f, 0xd5, 0x40, 0x0f, 0x18, 0xcb, 0xa4, 0x45, 0x00, 0x5b, 0x40, 0x0b, 0x18, 0xd4, 0x43, 
+	0x00, 0x00, 0xb2, 0x30, 0x01, 0x64, 0x6b, 0x41, 0x20, 0x52, 0x4d, 0x00, 0x07, 0x00, 0x00, 0x00, 
 };
 
-
 #endif /* SIMPLELIGHT_EMULATOR_GOOMBA_INCLUDED */
@@ -1,5239 +1,3759 @@
-/* Generated by bin2c, do not edit manually */
+/* Generated by tools/lz77/bin2lzh.py, do not edit manually */
 
 #ifndef SIMPLELIGHT_EMULATOR_POCKETNES_INCLUDED
 #define SIMPLELIGHT_EMULATOR_POCKETNES_INCLUDED
 
-/* Contents of file test.gba */
+/* LZ77 (BIOS type 0x10) of pocketnes.gba, 83624 -> 59968 bytes */
 const long int pocketnes_gba_size = 83624;
-const unsigned char pocketnes_gba[83624] = {
-    0x2E, 0x00, 0x00, 0xEA, 0x24, 0xFF, 0xAE, 0x51, 0x69, 0x9A, 0xA2, 0x21, 0x3D, 0x84, 0x82, 0x0A,
-    0x84, 0xE4, 0x09, 0xAD, 0x11, 0x24, 0x8B, 0x98, 0xC0, 0x81, 0x7F, 0x21, 0xA3, 0x52, 0xBE, 0x19,
-    0x93, 0x09, 0xCE, 0x20, 0x10, 0x46, 0x4A, 0x4A, 0xF8, 0x27, 0x31, 0xEC, 0x58, 0xC7, 0xE8, 0x33,
-    0x82, 0xE3, 0xCE, 0xBF, 0x85, 0xF4, 0xDF, 0x94, 0xCE, 0x4B, 0x09, 0xC1, 0x94, 0x56, 0x8A, 0xC0,
-    0x13, 0x72, 0xA7, 0xFC, 0x9F, 0x84, 0x4D, 0x73, 0xA3, 0xCA, 0x9A, 0x61, 0x58, 0x97, 0xA3, 0x27,
-    0xFC, 0x03, 0x98, 0x76, 0x23, 0x1D, 0xC7, 0x61, 0x03, 0x04, 0xAE, 0x56, 0xBF, 0x38, 0x84, 0x00,
-    0x40, 0xA7, 0x0E, 0xFD, 0xFF, 0x52, 0xFE, 0x03, 0x6F, 0x95, 0x30, 0xF1, 0x97, 0xFB, 0xC0, 0x85,
-    0x60, 0xD6, 0x80, 0x25, 0xA9, 0x63, 0xBE, 0x03, 0x01, 0x4E, 0x38, 0xE2, 0xF9, 0xA2, 0x34, 0xFF,
-    0xBB, 0x3E, 0x03, 0x44, 0x78, 0x00, 0x90, 0xCB, 0x88, 0x11, 0x3A, 0x94, 0x65, 0xC0, 0x7C, 0x63,
-    0x87, 0xF0, 0x3C, 0xAF, 0xD6, 0x25, 0xE4, 0x8B, 0x38, 0x0A, 0xAC, 0x72, 0x21, 0xD4, 0xF8, 0x07,
-    0x50, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x4E, 0x45, 0x53, 0x00, 0x00, 0x00, 0x50, 0x4E, 0x45, 0x53,
-    0x30, 0x31, 0x96, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x03, 0xA0, 0xE3, 0x08, 0x02, 0x80, 0xE5, 0x12, 0x00, 0xA0, 0xE3, 0x00, 0xF0, 0x29, 0xE1,
-    0xB8, 0xD0, 0x9F, 0xE5, 0x1F, 0x00, 0xA0, 0xE3, 0x00, 0xF0, 0x29, 0xE1, 0xB0, 0xD0, 0x9F, 0xE5,
-    0x01, 0x00, 0x8F, 0xE2, 0x10, 0xFF, 0x2F, 0xE1, 0x00, 0x27, 0x2B, 0x48, 0x40, 0x01, 0x0D, 0xD2,
-    0x78, 0x46, 0x40, 0x01, 0x0A, 0xD3, 0x01, 0x27, 0x02, 0x22, 0x12, 0x06, 0x27, 0x4B, 0x9B, 0x1A,
-    0x16, 0x1C, 0x91, 0x00, 0x00, 0xF0, 0x3A, 0xF8, 0x25, 0x48, 0x87, 0x46, 0x25, 0x49, 0x26, 0x4A,
-    0x26, 0x4C, 0x00, 0xF0, 0x32, 0xF8, 0x26, 0x49, 0x26, 0x4A, 0x27, 0x4C, 0x00, 0xF0, 0x2D, 0xF8,
-    0x26, 0x4A, 0x27, 0x49, 0x53, 0x1A, 0x02, 0xD0, 0x26, 0x4A, 0x00, 0xF0, 0x27, 0xF8, 0x26, 0x49,
-    0x26, 0x4A, 0x27, 0x4C, 0x00, 0xF0, 0x21, 0xF8, 0x26, 0x48, 0x27, 0x49, 0x09, 0x1A, 0x00, 0xF0,
-    0x12, 0xF8, 0x26, 0x48, 0x26, 0x49, 0x09, 0x1A, 0x00, 0xF0, 0x0D, 0xF8, 0x25, 0x49, 0x26, 0x48,
-    0x08, 0x60, 0x26, 0x4B, 0x00, 0xF0, 0x10, 0xF8, 0x25, 0x48, 0x07, 0x60, 0x00, 0x20, 0x00, 0x21,
-    0x24, 0x4B, 0x00, 0xF0, 0x09, 0xF8, 0x03, 0x22, 0x89, 0x18, 0x91, 0x43, 0x03, 0xD0, 0x00, 0x22,
-    0x04, 0xC0, 0x04, 0x39, 0xFC, 0xD1, 0x70, 0x47, 0x18, 0x47, 0xA3, 0x1A, 0x03, 0x20, 0x1B, 0x18,
-    0x83, 0x43, 0x03, 0xD0, 0x01, 0xC9, 0x01, 0xC2, 0x04, 0x3B, 0xFB, 0xD1, 0x70, 0x47, 0xC0, 0x46,
-    0xA0, 0x7F, 0x00, 0x03, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x02,
-    0x0B, 0x01, 0x00, 0x08, 0x38, 0x2E, 0x01, 0x08, 0xC8, 0x6D, 0x00, 0x03, 0x70, 0x76, 0x00, 0x03,
-    0x70, 0xE8, 0x00, 0x08, 0x00, 0x28, 0x00, 0x03, 0xC8, 0x6D, 0x00, 0x03, 0xE0, 0x36, 0x01, 0x08,
-    0xE0, 0x36, 0x01, 0x08, 0x6C, 0x7C, 0x00, 0x03, 0xE0, 0x36, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02,
-    0x08, 0x00, 0x00, 0x02, 0x70, 0x76, 0x00, 0x03, 0x6C, 0x7C, 0x00, 0x03, 0x08, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x02, 0x4C, 0x7C, 0x00, 0x03, 0x00, 0x00, 0x04, 0x02, 0x31, 0xCE, 0x00, 0x08,
-    0x70, 0x00, 0x00, 0x02, 0x71, 0xD3, 0x00, 0x08, 0xF8, 0xB5, 0xC0, 0x46, 0xF8, 0xBC, 0x08, 0xBC,
-    0x9E, 0x46, 0x70, 0x47, 0x00, 0x00, 0x00, 0x00, 0x10, 0xB5, 0x03, 0x00, 0x05, 0x48, 0x04, 0x78,
-    0x00, 0x20, 0x84, 0x42, 0x02, 0xD1, 0x18, 0x00, 0x0D, 0xF0, 0x00, 0xFA, 0x10, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0xC0, 0x46, 0x30, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x04, 0x4B, 0x1B, 0x78, 0x00, 0x2B,
-    0x01, 0xD1, 0x0D, 0xF0, 0x41, 0xF9, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x30, 0x00, 0x00, 0x02,
-    0x06, 0x4B, 0x30, 0xB5, 0x1C, 0x68, 0x91, 0x42, 0x02, 0xDB, 0x30, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x8B, 0x02, 0x8D, 0x00, 0xC3, 0x18, 0x63, 0x51, 0x01, 0x31, 0xF4, 0xE7, 0x60, 0x73, 0x00, 0x03,
-    0x06, 0x4B, 0x30, 0xB5, 0x1C, 0x68, 0x91, 0x42, 0x02, 0xDB, 0x30, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x4B, 0x03, 0x8D, 0x00, 0xC3, 0x18, 0x63, 0x51, 0x01, 0x31, 0xF4, 0xE7, 0x5C, 0x73, 0x00, 0x03,
-    0x10, 0xB5, 0x4B, 0x03, 0x8A, 0x18, 0xC0, 0x1A, 0xFF, 0xF7, 0xEA, 0xFF, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0x10, 0xB5, 0x8B, 0x02, 0x8A, 0x18, 0xC0, 0x1A, 0xFF, 0xF7, 0xD1, 0xFF, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0xF0, 0xB5, 0x00, 0x26, 0x85, 0xB0, 0x03, 0x92, 0x84, 0x00, 0x8D, 0x00,
-    0x03, 0x9B, 0x9E, 0x42, 0x03, 0xDB, 0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0A, 0x4F,
-    0x3B, 0x68, 0x1A, 0x59, 0x01, 0x92, 0x80, 0x22, 0x5B, 0x59, 0x92, 0x01, 0x19, 0x00, 0x01, 0x98,
-    0x02, 0x93, 0xFF, 0xF7, 0xA9, 0xFF, 0x3B, 0x68, 0x02, 0x9A, 0x1A, 0x51, 0x01, 0x9A, 0x01, 0x36,
-    0x5A, 0x51, 0x04, 0x34, 0x04, 0x35, 0xE3, 0xE7, 0x5C, 0x73, 0x00, 0x03, 0x1D, 0x4B, 0x1B, 0x68,
-    0xF7, 0xB5, 0x06, 0x00, 0xD0, 0x00, 0xC5, 0x58, 0x0E, 0x20, 0xCF, 0x00, 0x0C, 0x00, 0xD9, 0x59,
-    0x01, 0x92, 0x0A, 0x0E, 0x02, 0x40, 0x08, 0x2A, 0x19, 0xD0, 0xDB, 0x19, 0x99, 0x68, 0xE0, 0x23,
-    0xF8, 0x26, 0x80, 0x20, 0x1B, 0x05, 0x19, 0x40, 0x36, 0x06, 0x89, 0x19, 0x01, 0x34, 0x40, 0x04,
-    0x81, 0x42, 0x09, 0xD3, 0x2B, 0x40, 0x9B, 0x19, 0x83, 0x42, 0x05, 0xD3, 0x01, 0x9B, 0x02, 0x22,
-    0x59, 0x00, 0x60, 0x00, 0xFF, 0xF7, 0xB6, 0xFF, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x80, 0x22,
-    0x30, 0x00, 0xD2, 0x01, 0xFF, 0xF7, 0x60, 0xFF, 0x80, 0x23, 0xDB, 0x01, 0x1A, 0x00, 0x29, 0x00,
-    0xF0, 0x18, 0xFF, 0xF7, 0x59, 0xFF, 0x02, 0x22, 0x30, 0x00, 0x61, 0x00, 0xFF, 0xF7, 0x90, 0xFF,
-    0xEA, 0xE7, 0xC0, 0x46, 0x5C, 0x73, 0x00, 0x03, 0xF7, 0xB5, 0x21, 0x4B, 0x21, 0x4C, 0x1B, 0x68,
-    0x21, 0x4E, 0x01, 0x93, 0x23, 0x68, 0x00, 0x25, 0xB3, 0x42, 0x06, 0xD0, 0x1F, 0x4A, 0x93, 0x42,
-    0x03, 0xD0, 0x1F, 0x4D, 0x5D, 0x1B, 0x6B, 0x1E, 0x9D, 0x41, 0x04, 0xF0, 0x2B, 0xFD, 0x00, 0x28,
-    0x04, 0xD0, 0x1C, 0x4B, 0x1B, 0x78, 0x32, 0x00, 0x9B, 0x07, 0x00, 0xD4, 0x17, 0x4A, 0x00, 0x23,
-    0x19, 0x4E, 0xF0, 0x5C, 0xFF, 0x28, 0x0C, 0xD0, 0x99, 0x00, 0x8C, 0x46, 0x17, 0x4F, 0x59, 0x03,
-    0x49, 0x42, 0xC9, 0x19, 0x01, 0x9F, 0x80, 0x00, 0xC0, 0x59, 0x41, 0x18, 0x60, 0x46, 0x14, 0x4F,
-    0x39, 0x50, 0x01, 0x33, 0x05, 0x2B, 0xEC, 0xD1, 0x00, 0x2D, 0x09, 0xD1, 0x31, 0x78, 0x11, 0x4B,
-    0xFF, 0x29, 0x08, 0xD1, 0x10, 0x49, 0x22, 0x60, 0x19, 0x60, 0x10, 0x4A, 0x0C, 0x4B, 0x1A, 0x60,
-    0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0E, 0x4A, 0x1A, 0x60, 0x05, 0x4B, 0x23, 0x60, 0xF7, 0xE7,
-    0x5C, 0x73, 0x00, 0x03, 0xE8, 0x6D, 0x00, 0x03, 0xF4, 0x52, 0x00, 0x03, 0xE8, 0x52, 0x00, 0x03,
-    0xC0, 0x52, 0x00, 0x03, 0x64, 0x73, 0x00, 0x03, 0xFF, 0x72, 0x00, 0x03, 0x00, 0xA0, 0xFF, 0xFF,
-    0x04, 0x6E, 0x00, 0x03, 0x2C, 0x6E, 0x00, 0x03, 0xDC, 0x52, 0x00, 0x03, 0x00, 0xA8, 0xFF, 0x02,
-    0x0C, 0x53, 0x00, 0x03, 0x08, 0x4B, 0x30, 0xB5, 0x1C, 0x68, 0x00, 0x23, 0x07, 0x4D, 0x08, 0x49,
-    0xEA, 0x5C, 0x92, 0x00, 0x10, 0x59, 0x9A, 0x00, 0x01, 0x33, 0x88, 0x50, 0x08, 0x2B, 0xF7, 0xD1,
-    0x30, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x60, 0x73, 0x00, 0x03, 0x04, 0x73, 0x00, 0x03,
-    0x7C, 0x74, 0x00, 0x03, 0x10, 0xB5, 0xFF, 0xF7, 0x87, 0xFF, 0xFF, 0xF7, 0xE3, 0xFF, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x70, 0xB5, 0x0E, 0x00, 0x05, 0x00, 0x0E, 0x49, 0x0E, 0x48, 0x14, 0x00,
-    0x0C, 0xF0, 0xBA, 0xFF, 0x31, 0x00, 0x0C, 0xF0, 0x8D, 0xFF, 0x0C, 0x49, 0x0C, 0xF0, 0x8A, 0xFF,
-    0x0B, 0x49, 0x0C, 0xF0, 0x87, 0xFF, 0x06, 0x00, 0x20, 0x04, 0x00, 0x0C, 0x05, 0xF0, 0x43, 0xFB,
-    0x01, 0x00, 0x30, 0x00, 0x0C, 0xF0, 0x7E, 0xFF, 0x28, 0x00, 0x04, 0xF0, 0xE3, 0xFD, 0x70, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x34, 0xE2, 0x00, 0x08, 0xBC, 0x00, 0x00, 0x02, 0xD8, 0x00, 0x00, 0x02,
-    0x1F, 0xE5, 0x00, 0x08, 0x70, 0xB5, 0x0E, 0x00, 0x05, 0x00, 0x0D, 0x49, 0x0D, 0x48, 0x14, 0x00,
-    0x0C, 0xF0, 0x92, 0xFF, 0x31, 0x00, 0x0C, 0xF0, 0x65, 0xFF, 0x0B, 0x49, 0x0C, 0xF0, 0x62, 0xFF,
-    0x06, 0x00, 0x20, 0x04, 0x00, 0x0C, 0x05, 0xF0, 0x1E, 0xFB, 0x01, 0x00, 0x30, 0x00, 0x0C, 0xF0,
-    0x59, 0xFF, 0x28, 0x00, 0x04, 0xF0, 0xBE, 0xFD, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xC0, 0x46,
-    0x3A, 0xE2, 0x00, 0x08, 0xBC, 0x00, 0x00, 0x02, 0x3E, 0xE2, 0x00, 0x08, 0xF8, 0xB5, 0x02, 0x20,
-    0x02, 0xF0, 0xF6, 0xFD, 0x00, 0x22, 0x20, 0x20, 0x38, 0x49, 0x02, 0xF0, 0x2D, 0xFE, 0x38, 0x49,
-    0x00, 0x20, 0x04, 0xF0, 0x79, 0xFE, 0x37, 0x4C, 0x05, 0x00, 0xA0, 0x89, 0x05, 0xF0, 0xFB, 0xFA,
-    0x35, 0x49, 0x02, 0x00, 0x28, 0x00, 0x04, 0xF0, 0xB1, 0xFD, 0x23, 0x69, 0x05, 0x00, 0x33, 0x4F,
-    0x33, 0x4E, 0x01, 0x2B, 0x2A, 0xD1, 0x39, 0x00, 0x00, 0x23, 0xE2, 0x5E, 0xFF, 0xF7, 0xBA, 0xFF,
-    0x31, 0x00, 0x02, 0x23, 0xE2, 0x5E, 0xFF, 0xF7, 0xB5, 0xFF, 0x04, 0x23, 0xE2, 0x5E, 0x2D, 0x49,
-    0xFF, 0xF7, 0xB0, 0xFF, 0x06, 0x23, 0xE2, 0x5E, 0x2B, 0x49, 0xFF, 0xF7, 0xAB, 0xFF, 0x08, 0x23,
-    0xE2, 0x5E, 0x2A, 0x49, 0xFF, 0xF7, 0xA6, 0xFF, 0x0A, 0x23, 0xE2, 0x5E, 0x28, 0x49, 0xFF, 0xF7,
-    0xA1, 0xFF, 0x28, 0x49, 0x28, 0x4A, 0x04, 0xF0, 0x89, 0xFD, 0x28, 0x49, 0x04, 0xF0, 0x44, 0xFE,
-    0x27, 0x49, 0x04, 0xF0, 0x41, 0xFE, 0xF8, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x02, 0x21, 0x20, 0x7D,
-    0x04, 0xF0, 0xF8, 0xFE, 0x01, 0x00, 0x23, 0x48, 0x0C, 0xF0, 0x26, 0xFF, 0x39, 0x00, 0x00, 0x23,
-    0xE2, 0x5E, 0x28, 0x00, 0xFF, 0xF7, 0x5E, 0xFF, 0x31, 0x00, 0x02, 0x23, 0xE2, 0x5E, 0xFF, 0xF7,
-    0x59, 0xFF, 0x04, 0x23, 0xE2, 0x5E, 0x13, 0x49, 0xFF, 0xF7, 0x54, 0xFF, 0x06, 0x23, 0xE2, 0x5E,
-    0x11, 0x49, 0xFF, 0xF7, 0x4F, 0xFF, 0x08, 0x23, 0xE2, 0x5E, 0x10, 0x49, 0xFF, 0xF7, 0x4A, 0xFF,
-    0x0A, 0x23, 0xE2, 0x5E, 0x0E, 0x49, 0xFF, 0xF7, 0x45, 0xFF, 0x13, 0x4A, 0x0D, 0x49, 0x04, 0xF0,
-    0x55, 0xFD, 0x10, 0x4A, 0x11, 0x49, 0x04, 0xF0, 0x51, 0xFD, 0xC9, 0xE7, 0x45, 0xE2, 0x00, 0x08,
-    0x59, 0xE2, 0x00, 0x08, 0x08, 0x00, 0x00, 0x02, 0x68, 0xE2, 0x00, 0x08, 0x7A, 0xE2, 0x00, 0x08,
-    0x7D, 0xE2, 0x00, 0x08, 0x80, 0xE2, 0x00, 0x08, 0x83, 0xE2, 0x00, 0x08, 0x86, 0xE2, 0x00, 0x08,
-    0x89, 0xE2, 0x00, 0x08, 0x90, 0xE2, 0x00, 0x08, 0x8C, 0xE2, 0x00, 0x08, 0xA7, 0xE2, 0x00, 0x08,
-    0xCF, 0xE2, 0x00, 0x08, 0xD8, 0x00, 0x00, 0x02, 0xB5, 0xE2, 0x00, 0x08, 0xB8, 0xE2, 0x00, 0x08,
-    0x00, 0x21, 0x10, 0xB5, 0x08, 0x00, 0x0C, 0xF0, 0x4D, 0xFF, 0x11, 0x4C, 0x00, 0x21, 0x20, 0x80,
-    0x04, 0x20, 0x0C, 0xF0, 0x47, 0xFF, 0x00, 0x21, 0x60, 0x80, 0x08, 0x20, 0x0C, 0xF0, 0x42, 0xFF,
-    0x00, 0x21, 0xA0, 0x80, 0x0C, 0x20, 0x0C, 0xF0, 0x3D, 0xFF, 0x00, 0x21, 0xE0, 0x80, 0x10, 0x20,
-    0x0C, 0xF0, 0x38, 0xFF, 0x00, 0x21, 0x20, 0x81, 0x14, 0x20, 0x0C, 0xF0, 0x33, 0xFF, 0x00, 0x21,
-    0x60, 0x81, 0x18, 0x20, 0x0C, 0xF0, 0x2E, 0xFF, 0xA0, 0x81, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x08, 0x00, 0x00, 0x02, 0xA0, 0x22, 0x01, 0x21, 0x10, 0xB5, 0x04, 0x4B, 0xD2, 0x00, 0x98, 0x69,
-    0x49, 0x42, 0x0C, 0xF0, 0x0B, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x08, 0x00, 0x00, 0x02,
-    0xA0, 0x22, 0x10, 0xB5, 0x04, 0x4B, 0x05, 0x49, 0xD8, 0x69, 0x92, 0x01, 0x0C, 0xF0, 0xB6, 0xFF,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x22, 0xC3, 0x07, 0x06, 0xD5, 0x01, 0x38, 0x03, 0x88, 0x09, 0x02, 0x13, 0x40, 0x19, 0x43,
-    0x01, 0x80, 0x70, 0x47, 0x03, 0x88, 0x93, 0x43, 0xF9, 0xE7, 0xF0, 0xB5, 0x21, 0x4F, 0x3B, 0x6A,
-    0x85, 0xB0, 0x01, 0x90, 0x02, 0x91, 0x00, 0x20, 0x31, 0x2B, 0x2B, 0xDC, 0x03, 0x25, 0x12, 0x30,
-    0x58, 0x43, 0x5D, 0x43, 0x7C, 0x6A, 0x20, 0x18, 0x46, 0x1E, 0xEB, 0x1C, 0x02, 0x30, 0x02, 0x1B,
-    0x93, 0x42, 0x23, 0xD9, 0x12, 0x23, 0x3E, 0x6A, 0x5E, 0x43, 0x03, 0x93, 0x03, 0x36, 0x3B, 0x6A,
-    0x03, 0x9A, 0x01, 0x33, 0x5A, 0x43, 0xB2, 0x42, 0x1D, 0xDC, 0x01, 0x9B, 0x19, 0x06, 0x09, 0x0E,
-    0x60, 0x19, 0xFF, 0xF7, 0xCD, 0xFF, 0x01, 0x9B, 0x68, 0x1C, 0x19, 0x0A, 0x20, 0x18, 0xFF, 0xF7,
-    0xC7, 0xFF, 0xA8, 0x1C, 0x20, 0x18, 0x02, 0x99, 0xFF, 0xF7, 0xC2, 0xFF, 0x01, 0x20, 0x3B, 0x6A,
-    0x01, 0x33, 0x3B, 0x62, 0x05, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x31, 0x78, 0xFF, 0xF7,
-    0xB7, 0xFF, 0x30, 0x00, 0xD0, 0xE7, 0xA0, 0x19, 0x20, 0x21, 0xFF, 0xF7, 0xB1, 0xFF, 0x01, 0x36,
-    0xD5, 0xE7, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0xF0, 0x22, 0x03, 0x00, 0xD2, 0x01, 0x40, 0x04,
-    0x10, 0xB5, 0x40, 0x0C, 0x13, 0x42, 0x02, 0xD0, 0xB0, 0x23, 0xDB, 0x01, 0xC0, 0x18, 0x04, 0x21,
-    0x04, 0xF0, 0x00, 0xFE, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x0F, 0x4B, 0x19, 0x6A, 0x58, 0x6A,
-    0x03, 0x23, 0x70, 0xB5, 0x59, 0x43, 0x00, 0x28, 0x06, 0xD0, 0xA0, 0x25, 0x02, 0x00, 0x0B, 0x4E,
-    0xAD, 0x01, 0x13, 0x1A, 0x99, 0x42, 0x02, 0xD8, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x54, 0x78,
-    0x13, 0x78, 0x24, 0x02, 0x1B, 0x19, 0x1B, 0x04, 0x1B, 0x0C, 0xAB, 0x42, 0x01, 0xD2, 0x94, 0x78,
-    0xF4, 0x54, 0x03, 0x32, 0xED, 0xE7, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-    0x10, 0xB5, 0x01, 0x21, 0x0C, 0xF0, 0x7E, 0xFE, 0xFF, 0xF7, 0x62, 0xFF, 0xFF, 0xF7, 0x28, 0xFF,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x00, 0x20, 0xFF, 0xF7, 0xF1, 0xFF, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x04, 0x20, 0xFF, 0xF7, 0xEA, 0xFF, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0x10, 0xB5, 0x08, 0x20, 0xFF, 0xF7, 0xE3, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x10, 0xB5, 0x0C, 0x20, 0xFF, 0xF7, 0xDC, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5,
-    0x10, 0x20, 0xFF, 0xF7, 0xD5, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x14, 0x20,
-    0xFF, 0xF7, 0xCE, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x03, 0x23, 0x10, 0xB5, 0x04, 0x4A,
-    0x11, 0x69, 0x4B, 0x40, 0x13, 0x61, 0xFF, 0xF7, 0xF3, 0xFE, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x08, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x09, 0x4C, 0x23, 0x69, 0x01, 0x2B, 0x06, 0xD1, 0xFF, 0xF7,
-    0x1F, 0xFF, 0xFF, 0xF7, 0xE5, 0xFE, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x02, 0x23, 0x16, 0x21,
-    0x09, 0x20, 0x22, 0x7D, 0x05, 0xF0, 0x3E, 0xF8, 0x20, 0x75, 0xF2, 0xE7, 0x08, 0x00, 0x00, 0x02,
-    0x10, 0xB5, 0x0C, 0x4C, 0xA3, 0x69, 0x00, 0x2B, 0x10, 0xD0, 0xE3, 0x69, 0x00, 0x2B, 0x0D, 0xD0,
-    0x63, 0x6A, 0x00, 0x2B, 0x0A, 0xD0, 0xFF, 0xF7, 0xF5, 0xFE, 0xFF, 0xF7, 0x01, 0xFF, 0x23, 0x69,
-    0x00, 0x2B, 0x01, 0xD1, 0x01, 0x33, 0x23, 0x61, 0xFF, 0xF7, 0xC2, 0xFE, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x0C, 0x4B, 0x9A, 0x69, 0x10, 0xB5, 0x00, 0x2A,
-    0x0D, 0xD0, 0xDA, 0x69, 0x00, 0x2A, 0x0A, 0xD0, 0x5A, 0x6A, 0x00, 0x2A, 0x07, 0xD0, 0x1B, 0x69,
-    0x00, 0x2B, 0x07, 0xD1, 0xFF, 0xF7, 0xD4, 0xFF, 0x05, 0x20, 0x04, 0xF0, 0x5F, 0xFF, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0xFF, 0xF7, 0xA4, 0xFE, 0xF6, 0xE7, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02,
-    0xA0, 0x21, 0xF0, 0xB5, 0x1F, 0x24, 0x01, 0x25, 0x0A, 0x4B, 0x9A, 0x69, 0x89, 0x01, 0x88, 0x42,
-    0x0A, 0xDA, 0x26, 0x00, 0x2F, 0x00, 0x86, 0x43, 0xB7, 0x40, 0x43, 0x11, 0x9B, 0x00, 0x9B, 0x58,
-    0x3B, 0x42, 0x03, 0xD1, 0x01, 0x30, 0xF2, 0xE7, 0x01, 0x20, 0x40, 0x42, 0xF0, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x04, 0x00, 0x00, 0x20, 0xFF, 0xF7,
-    0xDF, 0xFF, 0x43, 0x1C, 0x04, 0xD0, 0x00, 0x2C, 0x02, 0xD0, 0x01, 0x3C, 0x01, 0x30, 0xF6, 0xE7,
-    0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xF0, 0xB5, 0x2B, 0x4B, 0x0C, 0x21, 0x5A, 0x5E, 0x8D, 0xB0,
-    0x01, 0x92, 0x2A, 0x4A, 0x17, 0x68, 0xDB, 0x69, 0x7D, 0x1F, 0x02, 0x93, 0xEB, 0x43, 0xDB, 0x17,
-    0x1D, 0x40, 0x7B, 0x1B, 0x28, 0x00, 0x13, 0x60, 0xFF, 0xF7, 0xDE, 0xFF, 0x04, 0x00, 0x02, 0x20,
-    0x02, 0xF0, 0xBE, 0xFB, 0x00, 0x22, 0x20, 0x20, 0x21, 0x49, 0x02, 0xF0, 0xF5, 0xFB, 0x00, 0x22,
-    0x21, 0x20, 0x20, 0x49, 0x02, 0xF0, 0xF0, 0xFB, 0x00, 0x26, 0x63, 0x1C, 0x2E, 0xD0, 0x1E, 0x4B,
-    0x20, 0x04, 0x1B, 0x5D, 0x00, 0x0C, 0x03, 0x93, 0xFF, 0xF7, 0xE6, 0xFE, 0x1B, 0x4A, 0x01, 0x00,
-    0x04, 0xA8, 0x04, 0xF0, 0x41, 0xFC, 0x02, 0x21, 0x03, 0x98, 0x04, 0xF0, 0xEB, 0xFC, 0x04, 0xA9,
-    0x02, 0x00, 0x08, 0x00, 0x04, 0xF0, 0x38, 0xFC, 0x02, 0x9B, 0x02, 0x21, 0x18, 0x5D, 0x04, 0xF0,
-    0xE1, 0xFC, 0x04, 0xA9, 0x03, 0x00, 0x12, 0x4A, 0x08, 0x00, 0x04, 0xF0, 0xB1, 0xFC, 0x30, 0x00,
-    0x04, 0xA9, 0x04, 0xF0, 0x19, 0xFC, 0x01, 0x9B, 0x01, 0x36, 0x5B, 0x1B, 0xB3, 0x42, 0x05, 0xDD,
-    0x60, 0x1C, 0xFF, 0xF7, 0x85, 0xFF, 0x04, 0x00, 0x0A, 0x2E, 0xCE, 0xD1, 0x03, 0x4B, 0x1F, 0x60,
-    0x0D, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x08, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02,
-    0xDA, 0xE2, 0x00, 0x08, 0xF3, 0xE2, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x10, 0xE6, 0x00, 0x08,
-    0x08, 0xE3, 0x00, 0x08, 0xF0, 0xB5, 0x44, 0x4A, 0x44, 0x49, 0x13, 0x6A, 0x52, 0x6A, 0x95, 0xB0,
-    0x01, 0x92, 0x0A, 0x68, 0x44, 0x1F, 0x02, 0x92, 0xE2, 0x43, 0xD2, 0x17, 0x14, 0x40, 0x02, 0x9A,
-    0x12, 0x1B, 0x0A, 0x60, 0x22, 0x00, 0x01, 0x33, 0x0A, 0x32, 0x9A, 0x42, 0x00, 0xDD, 0x1A, 0x00,
-    0x03, 0x25, 0x2B, 0x00, 0x53, 0x43, 0x02, 0x20, 0x04, 0x93, 0x02, 0xF0, 0x51, 0xFB, 0x00, 0x22,
-    0x20, 0x20, 0x37, 0x49, 0x02, 0xF0, 0x88, 0xFB, 0x00, 0x22, 0x21, 0x20, 0x35, 0x49, 0x02, 0xF0,
-    0x83, 0xFB, 0x00, 0x22, 0x22, 0x20, 0x34, 0x49, 0x02, 0xF0, 0x7E, 0xFB, 0x20, 0x22, 0x6C, 0x43,
-    0x07, 0xAB, 0x1A, 0x70, 0x1A, 0x82, 0x01, 0x9B, 0x1F, 0x19, 0x00, 0x23, 0x03, 0x95, 0x00, 0x93,
-    0x04, 0x9B, 0x9C, 0x42, 0x06, 0xDB, 0x29, 0x4B, 0x02, 0x9A, 0x1A, 0x60, 0x15, 0xB0, 0xF0, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x24, 0x4E, 0x03, 0x9A, 0x33, 0x6A, 0x53, 0x43, 0xA3, 0x42, 0x0D, 0xD1,
-    0x26, 0x49, 0x0C, 0xA8, 0x0C, 0xF0, 0xA0, 0xFC, 0x00, 0x98, 0x0C, 0xA9, 0x04, 0xF0, 0xAC, 0xFB,
-    0x00, 0x9B, 0x01, 0x33, 0x00, 0x93, 0x03, 0x34, 0x03, 0x37, 0xE1, 0xE7, 0x7B, 0x78, 0x3D, 0x78,
-    0x1B, 0x02, 0xED, 0x18, 0x2D, 0x04, 0xBB, 0x78, 0x2D, 0x0C, 0x28, 0x00, 0x05, 0x93, 0xFF, 0xF7,
-    0x4B, 0xFE, 0x1B, 0x4A, 0x01, 0x00, 0x0C, 0xA8, 0x04, 0xF0, 0xA6, 0xFB, 0x02, 0x21, 0x05, 0x98,
-    0x04, 0xF0, 0x50, 0xFC, 0x0C, 0xA9, 0x02, 0x00, 0x08, 0x00, 0x04, 0xF0, 0x9D, 0xFB, 0x31, 0x6A,
-    0x03, 0x9B, 0x4B, 0x43, 0x19, 0x00, 0x05, 0x23, 0x63, 0x43, 0xC9, 0x18, 0x01, 0x9B, 0x59, 0x18,
-    0x06, 0xAB, 0x0F, 0x22, 0x58, 0x1D, 0x0C, 0xF0, 0x05, 0xFB, 0x0C, 0xA9, 0x07, 0xAA, 0x08, 0x00,
-    0x2D, 0x04, 0x04, 0xF0, 0x89, 0xFB, 0x2D, 0x14, 0x0A, 0x4A, 0x00, 0xD4, 0x0A, 0x4A, 0x0C, 0xA9,
-    0x08, 0x00, 0x04, 0xF0, 0x81, 0xFB, 0xBF, 0xE7, 0x08, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02,
-    0x0E, 0xE3, 0x00, 0x08, 0x25, 0xE3, 0x00, 0x08, 0x40, 0xE3, 0x00, 0x08, 0x51, 0xE3, 0x00, 0x08,
-    0x69, 0xE5, 0x00, 0x08, 0x8C, 0xE2, 0x00, 0x08, 0xB5, 0xE2, 0x00, 0x08, 0x03, 0x22, 0x3C, 0x4B,
-    0x59, 0x6A, 0x1B, 0x6A, 0xF0, 0xB5, 0x53, 0x43, 0x14, 0x00, 0x44, 0x43, 0x0C, 0x32, 0x42, 0x43,
-    0x9B, 0x18, 0x89, 0xB0, 0xCB, 0x18, 0x01, 0x93, 0x36, 0x4B, 0x1A, 0x68, 0x02, 0x92, 0x01, 0x22,
-    0x47, 0x1F, 0x52, 0x42, 0x1A, 0x60, 0xFB, 0x43, 0xDB, 0x17, 0x1F, 0x40, 0x0C, 0x19, 0x05, 0x00,
-    0x80, 0x26, 0xC7, 0x1B, 0xFF, 0xF7, 0x46, 0xFF, 0xF0, 0x21, 0x63, 0x78, 0x22, 0x78, 0x1B, 0x02,
-    0x9B, 0x18, 0xA2, 0x78, 0x36, 0x02, 0x03, 0x92, 0xC9, 0x01, 0x5A, 0x04, 0x1E, 0x40, 0x52, 0x0C,
-    0x0B, 0x42, 0x02, 0xD0, 0xB0, 0x23, 0xDB, 0x01, 0xD2, 0x18, 0x04, 0x23, 0x00, 0x21, 0x38, 0x00,
-    0x04, 0xF0, 0xA0, 0xFE, 0xC0, 0x22, 0x24, 0x49, 0x43, 0x04, 0x5B, 0x0C, 0xD2, 0x01, 0x59, 0x18,
-    0x93, 0x42, 0x01, 0xD2, 0x41, 0x05, 0x49, 0x0D, 0x0E, 0x43, 0x09, 0x06, 0x20, 0x00, 0x09, 0x0E,
-    0xFF, 0xF7, 0x76, 0xFD, 0x31, 0x0A, 0x09, 0x06, 0x09, 0x0E, 0x60, 0x1C, 0xFF, 0xF7, 0x70, 0xFD,
-    0x28, 0x00, 0xFF, 0xF7, 0x17, 0xFF, 0x02, 0x23, 0x03, 0x9A, 0x05, 0x21, 0x38, 0x00, 0x04, 0xF0,
-    0x81, 0xFE, 0x01, 0x06, 0xA0, 0x1C, 0x00, 0x24, 0x09, 0x0E, 0xFF, 0xF7, 0x61, 0xFD, 0x28, 0x00,
-    0xFF, 0xF7, 0x08, 0xFF, 0x04, 0xAB, 0x0F, 0x22, 0x18, 0x00, 0x01, 0x99, 0xDC, 0x73, 0x0C, 0xF0,
-    0x81, 0xFA, 0x0F, 0x23, 0x08, 0x21, 0x38, 0x00, 0x04, 0xAA, 0x04, 0xF0, 0xF1, 0xFE, 0x04, 0xAB,
-    0x19, 0x5D, 0x01, 0x9B, 0x18, 0x19, 0x01, 0x34, 0xFF, 0xF7, 0x4A, 0xFD, 0x0F, 0x2C, 0xF6, 0xD1,
-    0x04, 0x4B, 0x02, 0x9A, 0x1A, 0x60, 0x09, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0x08, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x00, 0xA8, 0xFF, 0xFF, 0xF7, 0xB5, 0x21, 0x4E,
-    0x0C, 0x23, 0xF5, 0x5E, 0x00, 0x2D, 0x33, 0xD0, 0x00, 0x24, 0x1F, 0x4F, 0x3C, 0x60, 0xFF, 0xF7,
-    0x72, 0xFE, 0x1E, 0x4A, 0x13, 0x88, 0xDB, 0x43, 0x1D, 0x49, 0x00, 0x94, 0x0B, 0x60, 0x01, 0x92,
-    0x28, 0x00, 0x02, 0xF0, 0xFD, 0xF9, 0x01, 0x23, 0x04, 0x00, 0x18, 0x42, 0x10, 0xD0, 0x38, 0x68,
-    0xFF, 0xF7, 0x52, 0xFE, 0x17, 0x4B, 0x19, 0x5C, 0x00, 0x04, 0x00, 0x0C, 0xFF, 0xF7, 0x25, 0xFD,
-    0x00, 0x28, 0x05, 0xD0, 0x33, 0x6A, 0x58, 0x1E, 0xFF, 0xF7, 0x58, 0xFF, 0x01, 0x23, 0x00, 0x93,
-    0xF1, 0x23, 0x1C, 0x42, 0x01, 0xD0, 0xFF, 0xF7, 0x4E, 0xFE, 0x0F, 0x4B, 0x1C, 0x42, 0xDF, 0xD0,
-    0x02, 0x25, 0x2C, 0x42, 0x07, 0xD1, 0x00, 0x9B, 0x00, 0x2B, 0x01, 0xD0, 0x03, 0xF0, 0xEE, 0xFE,
-    0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0C, 0xF0, 0xE9, 0xFB, 0x01, 0x9B, 0x1C, 0x88, 0xE4, 0x43,
-    0xEF, 0xE7, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04,
-    0x88, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0xF7, 0xB5, 0x1F, 0x4E,
-    0x33, 0x6A, 0x05, 0x00, 0x83, 0x42, 0x1B, 0xDD, 0x03, 0x24, 0x07, 0x00, 0x44, 0x43, 0x72, 0x6A,
-    0x01, 0x3B, 0x01, 0x92, 0x33, 0x62, 0x14, 0x19, 0x33, 0x6A, 0xBB, 0x42, 0x13, 0xDC, 0x03, 0x24,
-    0x5C, 0x43, 0x0F, 0x20, 0x01, 0x9B, 0x1C, 0x19, 0x27, 0x00, 0x45, 0x43, 0x3B, 0x1B, 0x9D, 0x42,
-    0x18, 0xDC, 0x0F, 0x27, 0x65, 0x19, 0x33, 0x6A, 0x7B, 0x43, 0x2A, 0x1B, 0x93, 0x42, 0x17, 0xDC,
-    0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x20, 0x00, 0xE1, 0x78, 0xFF, 0xF7, 0xC1, 0xFC, 0x21, 0x79,
-    0x60, 0x1C, 0xFF, 0xF7, 0xBD, 0xFC, 0x61, 0x79, 0xA0, 0x1C, 0xFF, 0xF7, 0xB9, 0xFC, 0x01, 0x37,
-    0x03, 0x34, 0xD9, 0xE7, 0x38, 0x00, 0xF9, 0x78, 0xFF, 0xF7, 0xB2, 0xFC, 0x01, 0x37, 0xDD, 0xE7,
-    0x28, 0x00, 0xA9, 0x7C, 0xFF, 0xF7, 0xAC, 0xFC, 0x01, 0x35, 0xDC, 0xE7, 0x08, 0x00, 0x00, 0x02,
-    0xF0, 0xB5, 0x00, 0x24, 0x37, 0x4F, 0x38, 0x4D, 0x7B, 0x6A, 0x85, 0xB0, 0x20, 0x00, 0x02, 0x93,
-    0x2C, 0x60, 0xFF, 0xF7, 0x47, 0xFE, 0x35, 0x4A, 0x13, 0x88, 0xDB, 0x43, 0x01, 0x26, 0x34, 0x49,
-    0x03, 0x92, 0x0B, 0x60, 0x3B, 0x6A, 0x58, 0x1C, 0x02, 0xF0, 0x6A, 0xF9, 0x08, 0x22, 0x01, 0x90,
-    0x10, 0x42, 0x0D, 0xD0, 0x2A, 0x68, 0x3B, 0x6A, 0x9A, 0x42, 0x3F, 0xD1, 0x00, 0x21, 0x08, 0x00,
-    0xFF, 0xF7, 0x93, 0xFC, 0x34, 0x00, 0x00, 0x28, 0x02, 0xD0, 0x28, 0x68, 0xFF, 0xF7, 0xC6, 0xFE,
-    0x01, 0x9B, 0x33, 0x42, 0x14, 0xD0, 0x28, 0x68, 0x3B, 0x6A, 0x98, 0x42, 0x02, 0xDA, 0xFF, 0xF7,
-    0xBD, 0xFE, 0x34, 0x00, 0x2B, 0x68, 0x3A, 0x6A, 0x93, 0x42, 0x09, 0xD1, 0x00, 0x21, 0x08, 0x00,
-    0xFF, 0xF7, 0x7B, 0xFC, 0x34, 0x00, 0x00, 0x28, 0x02, 0xD0, 0x28, 0x68, 0xFF, 0xF7, 0xAE, 0xFE,
-    0x01, 0x9B, 0x5B, 0x07, 0x03, 0xD5, 0x28, 0x68, 0xFF, 0xF7, 0x78, 0xFF, 0x34, 0x00, 0xFD, 0x23,
-    0x01, 0x9A, 0x1A, 0x42, 0x02, 0xD0, 0x28, 0x68, 0xFF, 0xF7, 0x04, 0xFE, 0x15, 0x4B, 0x01, 0x9A,
-    0x1A, 0x42, 0xBF, 0xD0, 0x02, 0x25, 0x01, 0x9B, 0x2B, 0x42, 0x13, 0xD1, 0x00, 0x2C, 0x01, 0xD0,
-    0x03, 0xF0, 0x3C, 0xFE, 0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x03, 0x23, 0x53, 0x43,
-    0x02, 0x9A, 0x01, 0x33, 0xD1, 0x5C, 0xD0, 0x18, 0x80, 0x23, 0x59, 0x40, 0xFF, 0xF7, 0x40, 0xFC,
-    0x34, 0x00, 0xBD, 0xE7, 0x0C, 0xF0, 0x2A, 0xFB, 0x03, 0x9B, 0x18, 0x88, 0xC3, 0x43, 0x01, 0x93,
-    0xE1, 0xE7, 0xC0, 0x46, 0x08, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04,
-    0x88, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xF0, 0xB5, 0x00, 0x24, 0x5D, 0x4B, 0x1C, 0x60,
-    0x5D, 0x4B, 0x85, 0xB0, 0x03, 0x91, 0x1C, 0x60, 0x02, 0x90, 0x02, 0xF0, 0x9B, 0xF8, 0x01, 0x20,
-    0x02, 0xF0, 0x36, 0xF9, 0x07, 0x20, 0x02, 0xF0, 0xCD, 0xF9, 0x58, 0x4B, 0x1C, 0x80, 0x00, 0xF0,
-    0xC7, 0xF9, 0x02, 0xF0, 0xDD, 0xF9, 0x80, 0x23, 0x80, 0x22, 0xDB, 0x04, 0xD2, 0x00, 0x1A, 0x80,
-    0x20, 0x00, 0x22, 0x00, 0x52, 0x49, 0x02, 0xF0, 0x5F, 0xF9, 0x22, 0x00, 0x01, 0x20, 0x51, 0x49,
-    0x02, 0xF0, 0x5A, 0xF9, 0x22, 0x00, 0x02, 0x20, 0x4F, 0x49, 0x02, 0xF0, 0x55, 0xF9, 0x22, 0x00,
-    0x03, 0x20, 0x4E, 0x49, 0x02, 0xF0, 0x50, 0xF9, 0x7F, 0x27, 0x00, 0x23, 0x4C, 0x4E, 0x4D, 0x4D,
-    0x33, 0x70, 0xA3, 0x00, 0x59, 0x59, 0x30, 0x00, 0x18, 0x35, 0x0C, 0xF0, 0x5B, 0xFA, 0x63, 0x5D,
-    0x1A, 0x06, 0x00, 0xD5, 0x78, 0xE0, 0x08, 0x21, 0x03, 0x9A, 0x9B, 0x00, 0x98, 0x58, 0x04, 0xF0,
-    0x49, 0xFA, 0x01, 0x00, 0x30, 0x00, 0x0C, 0xF0, 0x4D, 0xFA, 0x60, 0x1D, 0x00, 0x22, 0x31, 0x00,
-    0x01, 0x34, 0x02, 0xF0, 0x31, 0xF9, 0x06, 0x2C, 0xDF, 0xD1, 0x00, 0x22, 0x0C, 0x20, 0x3E, 0x49,
-    0x02, 0xF0, 0x2A, 0xF9, 0x3D, 0x4B, 0x1A, 0x88, 0xD2, 0x43, 0x01, 0x93, 0x11, 0x00, 0x01, 0x9B,
-    0x1B, 0x88, 0xDA, 0x43, 0x0B, 0x43, 0xD8, 0x43, 0x05, 0x33, 0x4F, 0xD0, 0x01, 0x28, 0xF5, 0xD1,
-    0x02, 0xF0, 0xDE, 0xF8, 0x00, 0x22, 0x36, 0x49, 0x10, 0x00, 0x02, 0xF0, 0x15, 0xF9, 0x00, 0x24,
-    0x08, 0x27, 0x00, 0x23, 0x33, 0x49, 0x33, 0x70, 0xA5, 0x00, 0x0A, 0x2C, 0x06, 0xDC, 0x2D, 0x4B,
-    0x20, 0x33, 0x59, 0x59, 0x30, 0x00, 0x0C, 0xF0, 0x1D, 0xFA, 0x2F, 0x49, 0x30, 0x00, 0x0C, 0xF0,
-    0x19, 0xFA, 0x02, 0x9B, 0x39, 0x00, 0x58, 0x59, 0x04, 0xF0, 0x0C, 0xFA, 0x01, 0x00, 0x30, 0x00,
-    0x0C, 0xF0, 0x10, 0xFA, 0x28, 0x49, 0x30, 0x00, 0x0C, 0xF0, 0x0C, 0xFA, 0x27, 0x49, 0x09, 0x2C,
-    0x06, 0xDC, 0x20, 0x4B, 0x4C, 0x33, 0x59, 0x59, 0x30, 0x00, 0x0C, 0xF0, 0x03, 0xFA, 0x22, 0x49,
-    0x30, 0x00, 0x0C, 0xF0, 0xFF, 0xF9, 0x03, 0x9B, 0x39, 0x00, 0x58, 0x59, 0x04, 0xF0, 0xF2, 0xF9,
-    0x01, 0x34, 0x01, 0x00, 0x30, 0x00, 0x0C, 0xF0, 0xF5, 0xF9, 0x00, 0x22, 0x31, 0x00, 0x20, 0x00,
-    0x02, 0xF0, 0xDA, 0xF8, 0x13, 0x2C, 0xC4, 0xD1, 0x01, 0x9B, 0x1A, 0x88, 0xD2, 0x43, 0x11, 0x00,
-    0x01, 0x9B, 0x1B, 0x88, 0xDA, 0x43, 0x0B, 0x43, 0x05, 0x33, 0xF8, 0xD1, 0x0C, 0xF0, 0x5E, 0xFA,
-    0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x3B, 0x40, 0x08, 0x21, 0x02, 0x9A, 0x9B, 0x00,
-    0x84, 0xE7, 0xC0, 0x46, 0x80, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x04,
-    0x5F, 0xE3, 0x00, 0x08, 0x79, 0xE3, 0x00, 0x08, 0x91, 0xE3, 0x00, 0x08, 0xA4, 0xE3, 0x00, 0x08,
-    0xBC, 0x00, 0x00, 0x02, 0x70, 0xDD, 0x00, 0x08, 0xB4, 0xE3, 0x00, 0x08, 0x30, 0x01, 0x00, 0x04,
-    0xD2, 0xE3, 0x00, 0x08, 0xCD, 0xE3, 0x00, 0x08, 0xD0, 0xE3, 0x00, 0x08, 0xCC, 0xE3, 0x00, 0x08,
-    0x70, 0x47, 0x00, 0x23, 0x05, 0x49, 0x06, 0x48, 0x9A, 0x00, 0x01, 0x33, 0x88, 0x50, 0x0E, 0x2B,
-    0xFA, 0xD1, 0x04, 0x4B, 0x04, 0x4A, 0x1A, 0x60, 0x70, 0x47, 0xC0, 0x46, 0xAC, 0x76, 0x00, 0x03,
-    0x41, 0x10, 0x00, 0x08, 0xFC, 0x7F, 0x00, 0x03, 0x74, 0x4F, 0x00, 0x03, 0x10, 0xB5, 0xFF, 0xF7,
-    0xE8, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xFF, 0x23, 0x02, 0x00, 0x9A, 0x43, 0x00, 0x23,
-    0x9A, 0x42, 0x01, 0xD0, 0x00, 0x12, 0x08, 0x33, 0xF0, 0x22, 0x10, 0x42, 0x01, 0xD0, 0x00, 0x11,
-    0x04, 0x33, 0x0C, 0x22, 0x10, 0x42, 0x01, 0xD0, 0x80, 0x10, 0x02, 0x33, 0x80, 0x07, 0xC0, 0x0F,
-    0x1B, 0x18, 0x00, 0x20, 0x0D, 0x2B, 0x03, 0xDC, 0x02, 0x48, 0x9B, 0x00, 0x19, 0x50, 0x18, 0x18,
-    0x70, 0x47, 0xC0, 0x46, 0xAC, 0x76, 0x00, 0x03, 0x10, 0xB5, 0xFF, 0xF7, 0xDD, 0xFF, 0x10, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x00, 0x21, 0x12, 0x4A, 0x10, 0xB5, 0x03, 0x00, 0x11, 0x80, 0xC1, 0x07,
-    0x04, 0xD5, 0x08, 0x21, 0x0F, 0x48, 0x04, 0x88, 0x21, 0x43, 0x01, 0x80, 0x99, 0x07, 0x04, 0xD5,
-    0x10, 0x21, 0x0C, 0x48, 0x04, 0x88, 0x21, 0x43, 0x01, 0x80, 0x59, 0x07, 0x04, 0xD5, 0x20, 0x21,
-    0x08, 0x48, 0x04, 0x88, 0x21, 0x43, 0x01, 0x80, 0x07, 0x49, 0x08, 0x88, 0x18, 0x43, 0x01, 0x23,
-    0x00, 0x04, 0x00, 0x0C, 0x08, 0x80, 0x13, 0x80, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0x08, 0x02, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x10, 0xB5, 0xFF, 0xF7,
-    0xD1, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x00, 0x22, 0x10, 0x4B, 0x10, 0xB5, 0x1A, 0x80,
-    0xC2, 0x07, 0x04, 0xD5, 0x08, 0x24, 0x0E, 0x49, 0x0A, 0x88, 0xA2, 0x43, 0x0A, 0x80, 0x82, 0x07,
-    0x04, 0xD5, 0x10, 0x24, 0x0A, 0x49, 0x0A, 0x88, 0xA2, 0x43, 0x0A, 0x80, 0x42, 0x07, 0x04, 0xD5,
-    0x20, 0x24, 0x07, 0x49, 0x0A, 0x88, 0xA2, 0x43, 0x0A, 0x80, 0x06, 0x49, 0x0A, 0x88, 0x82, 0x43,
-    0x0A, 0x80, 0x01, 0x22, 0x1A, 0x80, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x08, 0x02, 0x00, 0x04,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x10, 0xB5, 0xFF, 0xF7, 0xD5, 0xFF, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x11, 0x4A, 0x11, 0x4B, 0x12, 0x78, 0x1B, 0x68, 0x00, 0x2A,
-    0x02, 0xD1, 0x80, 0x21, 0x09, 0x01, 0x5B, 0x18, 0x0E, 0x49, 0x08, 0x78, 0x20, 0x21, 0x00, 0x28,
-    0x0C, 0xD0, 0x0D, 0x49, 0x0C, 0x78, 0x81, 0x01, 0x77, 0x2C, 0x00, 0xD0, 0x41, 0x01, 0x0B, 0x48,
-    0x00, 0x78, 0x02, 0x43, 0x02, 0xD1, 0x80, 0x22, 0x92, 0x01, 0x9B, 0x18, 0x08, 0x4A, 0x10, 0x78,
-    0xC0, 0x00, 0x40, 0x18, 0x18, 0x1A, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x6A, 0x73, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x02, 0x69, 0x73, 0x00, 0x03, 0x67, 0x73, 0x00, 0x03, 0xB6, 0x72, 0x00, 0x03,
-    0x68, 0x73, 0x00, 0x03, 0x70, 0xB5, 0x05, 0x00, 0x0C, 0x00, 0xFF, 0xF7, 0xCB, 0xFF, 0x0E, 0x4B,
-    0xC3, 0x18, 0x00, 0x2C, 0x0C, 0xD1, 0x0D, 0x4A, 0x13, 0x60, 0x0D, 0x4B, 0xC2, 0x18, 0x0D, 0x4B,
-    0x1A, 0x60, 0x0D, 0x4B, 0xC0, 0x18, 0x0D, 0x4B, 0x18, 0x60, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x01, 0x2C, 0xFA, 0xD1, 0xAB, 0x42, 0xF8, 0xD2, 0x00, 0x23, 0x04, 0x4A, 0x13, 0x60, 0x05, 0x4A,
-    0x13, 0x60, 0x06, 0x4A, 0x13, 0x60, 0xF0, 0xE7, 0x7C, 0xCF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x02,
-    0x7C, 0xD4, 0xFF, 0xFF, 0x24, 0x00, 0x00, 0x02, 0x7C, 0xFC, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x02,
-    0x00, 0x23, 0x0C, 0x4A, 0x13, 0x70, 0x0C, 0x4A, 0x13, 0x80, 0x0C, 0x4A, 0x13, 0x80, 0x0C, 0x4A,
-    0x13, 0x80, 0x80, 0x23, 0xDB, 0x04, 0x1A, 0x88, 0x0A, 0x49, 0x0A, 0x40, 0x1A, 0x80, 0x89, 0x31,
-    0x1A, 0x88, 0xFF, 0x31, 0x8A, 0x43, 0x1A, 0x80, 0x80, 0x22, 0x19, 0x88, 0xD2, 0x00, 0x0A, 0x43,
-    0x1A, 0x80, 0x70, 0x47, 0x35, 0x75, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x04, 0xC6, 0x00, 0x00, 0x04,
-    0xDE, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0xFF, 0xFF, 0x01, 0x22, 0x01, 0x4B, 0x1A, 0x70, 0x70, 0x47,
-    0x35, 0x75, 0x00, 0x03, 0x10, 0xB5, 0x14, 0x00, 0x22, 0x00, 0x0C, 0xF0, 0x1D, 0xF9, 0x40, 0x1A,
-    0x01, 0x28, 0x0A, 0xDD, 0xA0, 0x42, 0x06, 0xDB, 0x00, 0x1B, 0x08, 0x18, 0x00, 0x2C, 0xF3, 0xD1,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x24, 0x1A, 0xF4, 0xE7, 0x00, 0x24, 0xF4, 0xE7, 0xF0, 0xB5,
-    0x8B, 0xB0, 0x04, 0x90, 0x05, 0x91, 0xCC, 0x4B, 0x1B, 0x78, 0x03, 0x93, 0xCB, 0x4B, 0x1D, 0x68,
-    0xCB, 0x4B, 0x1C, 0x68, 0x80, 0x23, 0x04, 0x9A, 0x1B, 0x05, 0x9A, 0x42, 0x00, 0xD2, 0x40, 0x34,
-    0xFF, 0x23, 0xFF, 0x34, 0x9C, 0x43, 0xC7, 0x4B, 0x1B, 0x78, 0x45, 0x2B, 0x00, 0xD9, 0xC9, 0xE1,
-    0x27, 0x2B, 0x07, 0xD8, 0x0F, 0x2B, 0x00, 0xD9, 0x74, 0xE1, 0x03, 0x2B, 0x00, 0xD9, 0x5F, 0xE1,
-    0x10, 0x27, 0x10, 0xE0, 0x1A, 0x00, 0x01, 0x21, 0x28, 0x3A, 0x12, 0x06, 0x12, 0x0E, 0x91, 0x40,
-    0x0A, 0x00, 0xBD, 0x49, 0x20, 0x27, 0x0A, 0x42, 0x05, 0xD1, 0x84, 0x21, 0x89, 0x05, 0x10, 0x3F,
-    0x0A, 0x42, 0x00, 0xD0, 0x08, 0x3F, 0xB9, 0x4A, 0x12, 0x78, 0x02, 0x2A, 0x00, 0xD1, 0x9F, 0xE3,
-    0x01, 0x2B, 0x07, 0xD1, 0x10, 0x2A, 0x00, 0xD9, 0x20, 0x27, 0xB5, 0x4B, 0x1B, 0x78, 0x01, 0x2B,
-    0x00, 0xD1, 0x20, 0x27, 0x04, 0x9A, 0xD2, 0x68, 0x02, 0x92, 0x00, 0x22, 0x04, 0x9B, 0x9B, 0x68,
-    0x1B, 0x0A, 0x08, 0x93, 0x01, 0x92, 0xAF, 0x4B, 0x02, 0x9A, 0x9A, 0x42, 0x10, 0xD1, 0x08, 0x9B,
-    0x5A, 0x1E, 0x93, 0x41, 0x01, 0x33, 0x01, 0x93, 0x80, 0x23, 0x04, 0x9A, 0x1B, 0x05, 0x9A, 0x42,
-    0x06, 0xD2, 0xA9, 0x4B, 0x19, 0x68, 0x01, 0x22, 0x00, 0x29, 0x00, 0xD0, 0x03, 0x92, 0x1A, 0x60,
-    0x05, 0x9B, 0x00, 0x2B, 0x31, 0xD0, 0xFF, 0xF7, 0x5B, 0xFF, 0x80, 0x22, 0xC0, 0x20, 0x00, 0x21,
-    0x92, 0x01, 0xC0, 0x04, 0x0C, 0xF0, 0x9A, 0xF8, 0x80, 0x22, 0x00, 0x21, 0x9F, 0x48, 0x92, 0x01,
-    0x0C, 0xF0, 0x94, 0xF8, 0x03, 0x9B, 0x00, 0x2B, 0x0B, 0xD1, 0x80, 0x22, 0x19, 0x00, 0x12, 0x02,
-    0x9B, 0x48, 0x0C, 0xF0, 0x8B, 0xF8, 0x80, 0x22, 0x03, 0x99, 0x9A, 0x48, 0x12, 0x02, 0x0C, 0xF0,
-    0x85, 0xF8, 0x99, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x05, 0xD0, 0x80, 0x22, 0x00, 0x21, 0x97, 0x48,
-    0x92, 0x01, 0x0C, 0xF0, 0x7B, 0xF8, 0x96, 0x4B, 0x1B, 0x78, 0x01, 0x2B, 0x05, 0xD1, 0x80, 0x22,
-    0x00, 0x21, 0x94, 0x48, 0x12, 0x01, 0x0C, 0xF0, 0x71, 0xF8, 0xC0, 0x23, 0x9B, 0x02, 0xE3, 0x18,
-    0x06, 0x93, 0x8F, 0x4B, 0x19, 0x78, 0x00, 0x29, 0x02, 0xD1, 0x80, 0x23, 0x1B, 0x01, 0xED, 0x18,
-    0x83, 0x4B, 0x18, 0x78, 0x81, 0x4B, 0x1B, 0x78, 0xDB, 0x00, 0x5B, 0x42, 0x00, 0x28, 0x00, 0xD1,
-    0x56, 0xE1, 0x7C, 0x4A, 0x16, 0x78, 0x82, 0x01, 0x77, 0x2E, 0x00, 0xD0, 0x42, 0x01, 0x82, 0x48,
-    0x00, 0x78, 0x01, 0x43, 0x02, 0xD1, 0x80, 0x21, 0x89, 0x01, 0x6D, 0x18, 0xAD, 0x1A, 0x82, 0x4A,
-    0x15, 0x60, 0xED, 0x18, 0x81, 0x4B, 0x1D, 0x60, 0x01, 0x9B, 0x00, 0x2B, 0x17, 0xD0, 0x73, 0x4A,
-    0x73, 0x4B, 0x7F, 0x49, 0x12, 0x78, 0x09, 0x78, 0x1B, 0x78, 0x52, 0x00, 0xD2, 0x18, 0x0B, 0x43,
-    0x59, 0x1E, 0x8B, 0x41, 0xC0, 0x21, 0x5B, 0x42, 0x09, 0x02, 0x9B, 0x03, 0x5B, 0x18, 0x79, 0x49,
-    0x69, 0x1A, 0xCB, 0x18, 0x52, 0x03, 0x9A, 0x42, 0x01, 0xDD, 0x01, 0x23, 0x03, 0x93, 0x05, 0x9B,
-    0x01, 0x2B, 0x1B, 0xD1, 0x6E, 0x4B, 0x19, 0x78, 0x73, 0x4A, 0x74, 0x4B, 0x00, 0x29, 0x00, 0xD0,
-    0x20, 0xE1, 0x73, 0x49, 0x11, 0x60, 0x73, 0x4A, 0x1A, 0x60, 0x73, 0x4B, 0x73, 0x4A, 0x1A, 0x60,
-    0x73, 0x4B, 0x74, 0x4A, 0x1A, 0x60, 0x74, 0x4B, 0x74, 0x4A, 0x1A, 0x60, 0x74, 0x4B, 0x75, 0x4A,
-    0x1A, 0x60, 0x75, 0x4B, 0x75, 0x4A, 0x1A, 0x60, 0x0C, 0xF0, 0x76, 0xF8, 0x58, 0x4B, 0x19, 0x78,
-    0x00, 0x29, 0x03, 0xD1, 0x08, 0x22, 0x5D, 0x48, 0xFE, 0xF7, 0xD2, 0xFE, 0x04, 0x9B, 0x10, 0x33,
-    0x09, 0x93, 0x02, 0x93, 0x01, 0x9B, 0x00, 0x2B, 0x03, 0xD0, 0x01, 0x22, 0x4A, 0x4B, 0x02, 0x94,
-    0x5A, 0x70, 0x6B, 0x4B, 0x1B, 0x78, 0x5B, 0x07, 0x05, 0xD5, 0x80, 0x22, 0x92, 0x00, 0x94, 0x46,
-    0x02, 0x9B, 0x63, 0x44, 0x02, 0x93, 0x49, 0x4D, 0x2A, 0x78, 0x02, 0x98, 0x52, 0x00, 0x00, 0x21,
-    0xFE, 0xF7, 0xC6, 0xFE, 0x46, 0x4B, 0x1A, 0x78, 0x28, 0x78, 0x00, 0x2A, 0x00, 0xD1, 0xF8, 0xE0,
-    0x02, 0x9B, 0x80, 0x03, 0x18, 0x18, 0xD2, 0x00, 0x00, 0x21, 0xFE, 0xF7, 0xA9, 0xFE, 0x01, 0x9B,
-    0x02, 0x2B, 0x00, 0xD0, 0x0A, 0xE1, 0x3E, 0x4B, 0x1D, 0x78, 0x00, 0x2D, 0x00, 0xD0, 0xFA, 0xE0,
-    0xC0, 0x22, 0x02, 0x9B, 0x12, 0x02, 0x9E, 0x18, 0x06, 0x21, 0x01, 0x9A, 0x3D, 0x48, 0x20, 0x2F,
-    0x00, 0xD1, 0xE1, 0xE0, 0xFE, 0xF7, 0xB4, 0xFE, 0x1A, 0x21, 0x01, 0x9A, 0x30, 0x00, 0xFE, 0xF7,
-    0xAF, 0xFE, 0x04, 0x22, 0x1C, 0x21, 0x36, 0x48, 0xFE, 0xF7, 0xAA, 0xFE, 0x03, 0x9B, 0x00, 0x2B,
-    0x00, 0xD0, 0xF3, 0xE1, 0x01, 0x22, 0x04, 0x9B, 0x10, 0x3B, 0x19, 0x68, 0x26, 0x4B, 0x5A, 0x70,
-    0x03, 0x9A, 0x9A, 0x70, 0x80, 0x23, 0x04, 0x9D, 0x14, 0x35, 0x1B, 0x05, 0x9D, 0x42, 0x12, 0xD2,
-    0x03, 0x23, 0x0F, 0x26, 0x4A, 0x1E, 0x13, 0x43, 0x07, 0x93, 0xFF, 0xF7, 0x61, 0xFE, 0x07, 0x9B,
-    0xF6, 0x1A, 0x81, 0x23, 0x07, 0x9A, 0x9B, 0x04, 0xF6, 0x18, 0x29, 0x00, 0x30, 0x00, 0x0F, 0x3A,
-    0x0C, 0xF0, 0x46, 0xF8, 0x35, 0x00, 0x01, 0x9B, 0x01, 0x2B, 0x00, 0xD0, 0x6F, 0xE1, 0x21, 0x00,
-    0x28, 0x00, 0x0B, 0xF0, 0xC9, 0xFF, 0x80, 0x23, 0x1B, 0x05, 0x9D, 0x42, 0x00, 0xD3, 0xC5, 0xE1,
-    0x0B, 0xF0, 0xF2, 0xFF, 0x04, 0x20, 0x01, 0xF0, 0xAB, 0xFD, 0x00, 0x23, 0x05, 0x93, 0x82, 0xE6,
-    0x18, 0x1F, 0x0B, 0x28, 0x00, 0xD9, 0x9B, 0xE6, 0x0B, 0xF0, 0x18, 0xFA, 0x78, 0x00, 0x9A, 0xFE,
-    0x9A, 0xFE, 0x6D, 0x00, 0x9A, 0xFE, 0x9A, 0xFE, 0x9A, 0xFE, 0x6D, 0x00, 0x9A, 0xFE, 0x9A, 0xFE,
-    0x9A, 0xFE, 0x6D, 0x00, 0x20, 0x27, 0x19, 0x2B, 0x00, 0xD1, 0x9C, 0xE6, 0x10, 0x3F, 0x22, 0x2B,
-    0x00, 0xD0, 0x98, 0xE6, 0x10, 0x37, 0x96, 0xE6, 0x30, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02,
-    0x48, 0x00, 0x00, 0x02, 0x67, 0x73, 0x00, 0x03, 0x05, 0x00, 0x00, 0x04, 0x68, 0x73, 0x00, 0x03,
-    0x69, 0x73, 0x00, 0x03, 0x41, 0x50, 0x33, 0x33, 0x70, 0x76, 0x00, 0x03, 0x00, 0x40, 0x00, 0x06,
-    0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x01, 0x06, 0xB6, 0x72, 0x00, 0x03, 0x8C, 0xC1, 0x03, 0x02,
-    0x6A, 0x73, 0x00, 0x03, 0x8C, 0xB9, 0x03, 0x02, 0x60, 0x73, 0x00, 0x03, 0x5C, 0x73, 0x00, 0x03,
-    0xB7, 0x72, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x74, 0x00, 0x03, 0x00, 0x75, 0x00, 0x03,
-    0x70, 0x7D, 0x00, 0x06, 0x28, 0x7C, 0x00, 0x06, 0x04, 0x75, 0x00, 0x03, 0xE0, 0x7A, 0x00, 0x06,
-    0xDC, 0x74, 0x00, 0x03, 0x20, 0x77, 0x00, 0x06, 0xE0, 0x74, 0x00, 0x03, 0x60, 0x73, 0x00, 0x06,
-    0xF4, 0x74, 0x00, 0x03, 0x80, 0x71, 0x00, 0x06, 0xF8, 0x74, 0x00, 0x03, 0x48, 0xF2, 0x03, 0x02,
-    0x64, 0x73, 0x00, 0x03, 0x69, 0x2B, 0x10, 0xD8, 0x4C, 0x2B, 0x00, 0xD8, 0x38, 0xE6, 0x1A, 0x00,
-    0x01, 0x21, 0x4D, 0x3A, 0x12, 0x06, 0x12, 0x0E, 0x91, 0x40, 0x0A, 0x00, 0xD4, 0x49, 0x10, 0x27,
-    0x0A, 0x42, 0x00, 0xD1, 0x3F, 0xE6, 0x20, 0x27, 0x3D, 0xE6, 0x20, 0x27, 0xA3, 0x2B, 0x00, 0xD1,
-    0x39, 0xE6, 0x10, 0x3F, 0xE4, 0x2B, 0x00, 0xD0, 0x35, 0xE6, 0x9B, 0xE7, 0x08, 0x27, 0x32, 0xE6,
-    0x20, 0x3D, 0xB4, 0xE6, 0xCB, 0x49, 0x69, 0x18, 0x11, 0x60, 0xCB, 0x4A, 0xAA, 0x18, 0x1A, 0x60,
-    0xCA, 0x4B, 0xEA, 0x18, 0xCA, 0x4B, 0x1A, 0x60, 0xCA, 0x4B, 0xEA, 0x18, 0xCA, 0x4B, 0x1A, 0x60,
-    0xCA, 0x4B, 0xEA, 0x18, 0xCA, 0x4B, 0x1A, 0x60, 0xCA, 0x4B, 0xED, 0x18, 0xCA, 0x4B, 0x1D, 0x60,
-    0xD7, 0xE6, 0x08, 0x22, 0xC9, 0x48, 0x07, 0xE7, 0xFE, 0xF7, 0xD2, 0xFD, 0x1A, 0x21, 0x30, 0x00,
-    0x01, 0x9A, 0xFE, 0xF7, 0xCD, 0xFD, 0x04, 0x22, 0x1C, 0x21, 0x20, 0x00, 0xFE, 0xF7, 0xC8, 0xFD,
-    0x04, 0x22, 0x29, 0x00, 0x17, 0xE7, 0x08, 0x22, 0x60, 0x21, 0xC1, 0x48, 0xFE, 0xF7, 0xC9, 0xFD,
-    0x18, 0x22, 0x68, 0x21, 0xBF, 0x48, 0xFE, 0xF7, 0xC4, 0xFD, 0x0F, 0xE7, 0x01, 0x9B, 0x00, 0x2B,
-    0x00, 0xD0, 0x0B, 0xE7, 0xBC, 0x4B, 0x1D, 0x78, 0x2B, 0x00, 0x09, 0x3B, 0x07, 0x2B, 0x02, 0xD8,
-    0x20, 0x2F, 0x00, 0xD1, 0xF8, 0xE0, 0x08, 0x2D, 0x09, 0xDC, 0x02, 0x99, 0xAA, 0x03, 0x20, 0x00,
-    0xFE, 0xF7, 0x6A, 0xFD, 0x00, 0x21, 0x20, 0x00, 0x6A, 0x00, 0xFE, 0xF7, 0xA1, 0xFD, 0x03, 0x9B,
-    0x00, 0x2B, 0x02, 0xD1, 0xB1, 0x4B, 0x03, 0x9A, 0x9A, 0x70, 0xAF, 0x4B, 0x1D, 0x78, 0x01, 0x2D,
-    0x00, 0xD1, 0x1B, 0xE1, 0x02, 0x23, 0x01, 0x93, 0xAE, 0x1E, 0xAD, 0x4B, 0x1B, 0x78, 0x00, 0x2B,
-    0x04, 0xD0, 0xAC, 0x4B, 0x1B, 0x78, 0x01, 0x2B, 0x00, 0xD0, 0x12, 0xE1, 0x20, 0x2F, 0x02, 0xD1,
-    0x02, 0x23, 0x00, 0x26, 0x01, 0x93, 0x01, 0x9B, 0x9A, 0x03, 0x02, 0x9B, 0xB1, 0x03, 0x59, 0x18,
-    0xA5, 0x48, 0xFE, 0xF7, 0x41, 0xFD, 0x01, 0x9B, 0xA3, 0x48, 0x5A, 0x00, 0x71, 0x00, 0xFE, 0xF7,
-    0x77, 0xFD, 0x20, 0x2F, 0x0A, 0xD0, 0x80, 0x22, 0x02, 0x99, 0xD2, 0x01, 0x9F, 0x48, 0xFE, 0xF7,
-    0x33, 0xFD, 0x02, 0x22, 0x00, 0x21, 0x9D, 0x48, 0xFE, 0xF7, 0x6A, 0xFD, 0x9C, 0x4A, 0x13, 0x78,
-    0x4A, 0x2B, 0x15, 0xD1, 0x94, 0x49, 0x9B, 0x4B, 0x0D, 0x78, 0x1B, 0x68, 0x8F, 0x48, 0x9A, 0x49,
-    0x20, 0x2D, 0x00, 0xD0, 0x00, 0xE1, 0x59, 0x62, 0x08, 0x21, 0x18, 0x62, 0x97, 0x4B, 0x19, 0x70,
-    0x01, 0x23, 0x8F, 0x49, 0x0B, 0x70, 0x96, 0x49, 0x0B, 0x70, 0xFF, 0x21, 0x95, 0x4B, 0x19, 0x70,
-    0x13, 0x78, 0x77, 0x2B, 0x00, 0xD0, 0x2D, 0xE1, 0x8E, 0x4B, 0x07, 0x26, 0x18, 0x68, 0x40, 0x23,
-    0x82, 0x4D, 0x1A, 0x00, 0x32, 0x40, 0x92, 0x02, 0x99, 0x00, 0x52, 0x19, 0x01, 0x33, 0x42, 0x50,
-    0x80, 0x2B, 0xF6, 0xD1, 0x82, 0x4A, 0x7F, 0x3B, 0x13, 0x70, 0x89, 0x4A, 0x13, 0x70, 0xFF, 0x22,
-    0x88, 0x4B, 0x1A, 0x70, 0x85, 0x4B, 0xBF, 0x3A, 0x1A, 0x70, 0x09, 0x98, 0x02, 0xF0, 0x7C, 0xFF,
-    0x7A, 0x4B, 0x58, 0x60, 0x84, 0x4B, 0x98, 0x42, 0x04, 0xD1, 0x07, 0x22, 0x03, 0x21, 0x20, 0x00,
-    0xFE, 0xF7, 0x5C, 0xFD, 0x05, 0x9B, 0x00, 0x2B, 0x03, 0xD0, 0x01, 0x21, 0x06, 0x98, 0xFF, 0xF7,
-    0xC1, 0xFC, 0x0B, 0xF0, 0x43, 0xFE, 0x05, 0x9B, 0x00, 0x2B, 0x01, 0xD1, 0x0B, 0xF0, 0x94, 0xFE,
-    0x01, 0x22, 0x7A, 0x4B, 0x1A, 0x70, 0x0B, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x01, 0x9B,
-    0x02, 0x2B, 0x00, 0xD0, 0x8F, 0xE6, 0x28, 0x00, 0x21, 0x00, 0x0B, 0xF0, 0x55, 0xFE, 0xC0, 0x23,
-    0x5B, 0x02, 0xE6, 0x18, 0x08, 0x9B, 0xED, 0x18, 0x66, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x2E, 0xD1,
-    0x80, 0x22, 0x31, 0x00, 0x12, 0x02, 0x64, 0x48, 0x0B, 0xF0, 0xC8, 0xFE, 0xA0, 0x23, 0x80, 0x22,
-    0x5B, 0x02, 0xE6, 0x18, 0xD2, 0x01, 0x31, 0x00, 0x60, 0x48, 0x0B, 0xF0, 0xBF, 0xFE, 0x31, 0x00,
-    0x28, 0x00, 0x0B, 0xF0, 0x39, 0xFE, 0x80, 0x22, 0x21, 0x00, 0x30, 0x00, 0x92, 0x02, 0xFF, 0xF7,
-    0xE1, 0xFC, 0xC0, 0x23, 0x80, 0x22, 0x1B, 0x02, 0xE0, 0x18, 0x58, 0x49, 0xD2, 0x01, 0x0B, 0xF0,
-    0xFB, 0xFD, 0xD0, 0x23, 0x9B, 0x02, 0xE3, 0x18, 0x06, 0x93, 0x20, 0x2F, 0x00, 0xD0, 0x5A, 0xE6,
-    0x80, 0x22, 0x21, 0x00, 0x12, 0x02, 0x50, 0x48, 0x0B, 0xF0, 0xEE, 0xFD, 0x53, 0xE6, 0xD0, 0x23,
-    0xC0, 0x22, 0x5B, 0x02, 0xE1, 0x18, 0xD2, 0x01, 0x46, 0x48, 0x0B, 0xF0, 0x97, 0xFE, 0x80, 0x22,
-    0x31, 0x00, 0x92, 0x01, 0x42, 0x48, 0x0B, 0xF0, 0x91, 0xFE, 0x31, 0x00, 0x28, 0x00, 0x0B, 0xF0,
-    0x0B, 0xFE, 0x80, 0x22, 0x21, 0x00, 0x30, 0x00, 0x92, 0x02, 0xFF, 0xF7, 0xB3, 0xFC, 0xE0, 0x23,
-    0x9B, 0x02, 0xE3, 0x18, 0x06, 0x93, 0x36, 0xE6, 0x08, 0x25, 0x06, 0xE7, 0x01, 0x9B, 0x02, 0x2B,
-    0x00, 0xD0, 0x12, 0xE7, 0x3B, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x00, 0xD1, 0x3E, 0xE7, 0x80, 0x22,
-    0x35, 0x4B, 0x1D, 0x78, 0x02, 0x9B, 0x01, 0x3D, 0xAE, 0x03, 0x9E, 0x19, 0x30, 0x00, 0x37, 0x49,
-    0xD2, 0x01, 0xFE, 0xF7, 0x71, 0xFC, 0x69, 0x00, 0x01, 0x9A, 0x34, 0x48, 0xFE, 0xF7, 0x98, 0xFC,
-    0x03, 0x9B, 0x75, 0x1C, 0xFF, 0x35, 0x00, 0x2B, 0x0B, 0xD1, 0xE0, 0x22, 0x31, 0x00, 0x52, 0x02,
-    0x28, 0x00, 0x0B, 0xF0, 0x4D, 0xFE, 0x80, 0x22, 0x30, 0x00, 0x2C, 0x49, 0x52, 0x00, 0x0B, 0xF0,
-    0x55, 0xFE, 0x82, 0x23, 0xDB, 0x01, 0xF0, 0x18, 0x60, 0x22, 0x00, 0x21, 0xFE, 0xF7, 0x89, 0xFC,
-    0x10, 0x22, 0x70, 0x21, 0x28, 0x00, 0xFE, 0xF7, 0x84, 0xFC, 0x0F, 0xE7, 0x00, 0x26, 0x01, 0x95,
-    0xE3, 0xE6, 0x80, 0x22, 0x02, 0x9B, 0x01, 0x3D, 0xAE, 0x03, 0x99, 0x19, 0xD2, 0x01, 0x1F, 0x48,
-    0xFE, 0xF7, 0x32, 0xFC, 0x02, 0x22, 0x1D, 0x48, 0x69, 0x00, 0xFE, 0xF7, 0x69, 0xFC, 0x20, 0x2F,
-    0x00, 0xD0, 0xFB, 0xE6, 0x80, 0x22, 0x02, 0x9B, 0x71, 0x1E, 0xFF, 0x39, 0x59, 0x18, 0x52, 0x00,
-    0x1F, 0x48, 0xFE, 0xF7, 0x21, 0xFC, 0xF1, 0xE6, 0x03, 0xC3, 0x00, 0x21, 0x17, 0x4B, 0xFE, 0xE6,
-    0x05, 0x02, 0x00, 0x10, 0x70, 0xFD, 0xFF, 0xFF, 0x28, 0xFC, 0xFF, 0xFF, 0xE0, 0xFA, 0xFF, 0xFF,
-    0x04, 0x75, 0x00, 0x03, 0x20, 0xF7, 0xFF, 0xFF, 0xDC, 0x74, 0x00, 0x03, 0x60, 0xF3, 0xFF, 0xFF,
-    0xE0, 0x74, 0x00, 0x03, 0x80, 0xF1, 0xFF, 0xFF, 0xF4, 0x74, 0x00, 0x03, 0x8C, 0xC1, 0x03, 0x02,
-    0x00, 0xA0, 0x00, 0x06, 0x00, 0xE0, 0x00, 0x06, 0x68, 0x73, 0x00, 0x03, 0x30, 0x00, 0x00, 0x02,
-    0xB7, 0x72, 0x00, 0x03, 0x69, 0x73, 0x00, 0x03, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x01, 0x06,
-    0x67, 0x73, 0x00, 0x03, 0x60, 0x73, 0x00, 0x03, 0x8C, 0xC5, 0x03, 0x02, 0xB9, 0x72, 0x00, 0x03,
-    0xB6, 0x72, 0x00, 0x03, 0xB8, 0x72, 0x00, 0x03, 0xF7, 0x79, 0x22, 0x61, 0x35, 0x75, 0x00, 0x03,
-    0x00, 0xFF, 0x00, 0x06, 0x55, 0x2B, 0x00, 0xD0, 0xE7, 0xE6, 0x01, 0x22, 0x02, 0x4B, 0xE3, 0xE6,
-    0x01, 0x2B, 0x00, 0xD0, 0x65, 0xE4, 0x5F, 0xE4, 0xB7, 0x72, 0x00, 0x03, 0x10, 0xB5, 0x09, 0x4B,
-    0x09, 0x4A, 0x1B, 0x68, 0x09, 0x49, 0x12, 0x78, 0x58, 0x18, 0x52, 0x07, 0x01, 0xD4, 0x10, 0x3B,
-    0x18, 0x00, 0x00, 0x21, 0x06, 0x4B, 0x99, 0x70, 0xFF, 0xF7, 0x11, 0xFC, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x40, 0x73, 0x00, 0x03, 0x64, 0x73, 0x00, 0x03, 0xF0, 0xFD, 0xFF, 0xFF,
-    0x30, 0x00, 0x00, 0x02, 0xF7, 0xB5, 0x0C, 0x00, 0x15, 0x00, 0x01, 0x90, 0x4B, 0x07, 0x01, 0xD5,
-    0x08, 0x23, 0x1C, 0x43, 0x74, 0x4F, 0x75, 0x4E, 0x01, 0x2D, 0x0B, 0xD1, 0x74, 0x4B, 0x1B, 0x78,
-    0x2B, 0x42, 0x07, 0xD0, 0x01, 0x9B, 0x34, 0x60, 0x3B, 0x60, 0x03, 0xF0, 0x73, 0xF9, 0xF7, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x0B, 0xF0, 0xC8, 0xFC, 0x6E, 0x4B, 0x1B, 0x7A, 0x00, 0x2B, 0x01, 0xD1,
-    0x0B, 0xF0, 0xD8, 0xFC, 0x01, 0x9B, 0x3B, 0x60, 0x00, 0x23, 0x6B, 0x4A, 0x13, 0x70, 0x6B, 0x4A,
-    0x13, 0x70, 0xFF, 0x22, 0x6A, 0x4B, 0x01, 0x98, 0x34, 0x60, 0x1A, 0x70, 0x01, 0xF0, 0xFA, 0xFB,
-    0x03, 0x00, 0x0E, 0x22, 0x30, 0x33, 0x99, 0x79, 0x01, 0x93, 0x07, 0x33, 0x1B, 0x78, 0x1A, 0x40,
-    0x04, 0x00, 0x50, 0x42, 0x42, 0x41, 0x52, 0x42, 0x13, 0x40, 0x0F, 0x20, 0x1E, 0x00, 0x0A, 0x09,
-    0x86, 0x43, 0x92, 0x19, 0x5F, 0x4F, 0x60, 0x4E, 0x01, 0x40, 0x1B, 0x01, 0xCB, 0x18, 0x3A, 0x70,
-    0x33, 0x70, 0x03, 0xF0, 0x5F, 0xF9, 0x00, 0x28, 0x03, 0xD1, 0x02, 0x22, 0x33, 0x78, 0x93, 0x43,
-    0x33, 0x70, 0x18, 0x23, 0x30, 0x78, 0x03, 0x40, 0x5A, 0x1E, 0x93, 0x41, 0x57, 0x49, 0x3A, 0x78,
-    0x0B, 0x70, 0x01, 0x23, 0x05, 0x2A, 0x22, 0xD0, 0x00, 0x23, 0x09, 0x2A, 0x1F, 0xD0, 0x63, 0x2A,
-    0x1F, 0xD0, 0x23, 0x00, 0x52, 0x4F, 0x40, 0x33, 0x3B, 0x60, 0x33, 0x78, 0x5B, 0x07, 0x03, 0xD5,
-    0x90, 0x23, 0x9B, 0x00, 0xE3, 0x18, 0x3B, 0x60, 0x23, 0x00, 0x34, 0x33, 0x1B, 0x78, 0x4D, 0x49,
-    0x0B, 0x70, 0x4D, 0x49, 0x9B, 0x03, 0x58, 0x1E, 0x35, 0x34, 0x08, 0x60, 0x21, 0x78, 0x4B, 0x48,
-    0x01, 0x70, 0x00, 0x29, 0x24, 0xD1, 0x4A, 0x4B, 0x4A, 0x49, 0x19, 0x60, 0x0E, 0xE0, 0x0B, 0x70,
-    0xDF, 0xE7, 0x10, 0x23, 0x18, 0x43, 0x30, 0x70, 0xDB, 0xE7, 0x40, 0x00, 0x88, 0x42, 0xFC, 0xDB,
-    0x39, 0x68, 0xCB, 0x18, 0x42, 0x49, 0x0B, 0x60, 0x40, 0x4B, 0x18, 0x70, 0x3F, 0x4B, 0x1B, 0x78,
-    0x01, 0x20, 0x41, 0x49, 0x00, 0x2B, 0x53, 0xD0, 0x00, 0x24, 0x08, 0x70, 0x3F, 0x48, 0x04, 0x70,
-    0x5B, 0x03, 0x77, 0x2A, 0x06, 0xD1, 0x5B, 0x00, 0x01, 0x24, 0x3C, 0x48, 0x04, 0x70, 0x03, 0xE0,
-    0x01, 0x20, 0xE3, 0xE7, 0x4A, 0x2A, 0xF7, 0xD0, 0x55, 0x2A, 0x01, 0xD0, 0xA3, 0x2A, 0x01, 0xD1,
-    0x01, 0x22, 0x0A, 0x70, 0x36, 0x4A, 0x01, 0x3B, 0x13, 0x60, 0x80, 0x22, 0x00, 0x21, 0x12, 0x01,
-    0x34, 0x48, 0x0B, 0xF0, 0x5B, 0xFC, 0x80, 0x22, 0x33, 0x4C, 0x00, 0x21, 0x92, 0x01, 0x20, 0x00,
-    0x0B, 0xF0, 0x54, 0xFC, 0x20, 0x22, 0x00, 0x21, 0x30, 0x48, 0x0B, 0xF0, 0x4F, 0xFC, 0x33, 0x78,
-    0x5B, 0x07, 0x07, 0xD5, 0x80, 0x22, 0x39, 0x68, 0x2D, 0x4B, 0x2E, 0x48, 0xC9, 0x18, 0x92, 0x00,
-    0x0B, 0xF0, 0xFC, 0xFC, 0x33, 0x78, 0x9B, 0x07, 0x05, 0xD4, 0x7C, 0x22, 0x2A, 0x4B, 0xE2, 0x54,
-    0x2A, 0x4B, 0x01, 0x32, 0xE2, 0x54, 0x01, 0x2D, 0x01, 0xD1, 0x02, 0xF0, 0xC3, 0xFF, 0x00, 0x21,
-    0x08, 0x00, 0xFF, 0xF7, 0xBF, 0xFA, 0x01, 0x2D, 0x01, 0xD1, 0x02, 0xF0, 0xDF, 0xFE, 0x01, 0x21,
-    0x01, 0x98, 0xFF, 0xF7, 0x24, 0xFB, 0x02, 0xF0, 0x0D, 0xF8, 0x0B, 0xF0, 0xA1, 0xFC, 0x2E, 0xE7,
-    0x16, 0x4C, 0x20, 0x70, 0xFF, 0x24, 0x1E, 0x48, 0x04, 0x70, 0x1E, 0x48, 0x0B, 0x70, 0x03, 0x70,
-    0x80, 0x23, 0x9B, 0x01, 0xA5, 0xE7, 0xC0, 0x46, 0x44, 0x73, 0x00, 0x03, 0x48, 0x73, 0x00, 0x03,
-    0xBB, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x02, 0x3A, 0x74, 0x00, 0x03, 0x3B, 0x74, 0x00, 0x03,
-    0xFF, 0x72, 0x00, 0x03, 0x67, 0x73, 0x00, 0x03, 0x64, 0x73, 0x00, 0x03, 0x6A, 0x73, 0x00, 0x03,
-    0x40, 0x73, 0x00, 0x03, 0x68, 0x73, 0x00, 0x03, 0x50, 0x73, 0x00, 0x03, 0x69, 0x73, 0x00, 0x03,
-    0x54, 0x73, 0x00, 0x03, 0x8C, 0xC1, 0x03, 0x02, 0xB7, 0x72, 0x00, 0x03, 0xB6, 0x72, 0x00, 0x03,
-    0x58, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0xDC, 0x72, 0x00, 0x03,
-    0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x18, 0x00, 0x03, 0x7D, 0x1C, 0x00, 0x00, 0x7D, 0x1D, 0x00, 0x00,
-    0xB8, 0x72, 0x00, 0x03, 0xB9, 0x72, 0x00, 0x03, 0x70, 0xB5, 0x80, 0x24, 0x80, 0x23, 0x01, 0x00,
-    0x96, 0x22, 0xC0, 0x20, 0xE4, 0x04, 0x23, 0x80, 0x52, 0x02, 0xC0, 0x04, 0x0B, 0xF0, 0x8E, 0xFC,
-    0x0B, 0xF0, 0xCC, 0xFB, 0x15, 0x4B, 0x23, 0x80, 0x10, 0x24, 0x20, 0x00, 0x01, 0xF0, 0xB6, 0xFA,
-    0x0B, 0xF0, 0xC4, 0xFB, 0x01, 0x3C, 0xF8, 0xD2, 0x96, 0x24, 0x01, 0x25, 0x03, 0x26, 0x0B, 0xF0,
-    0xBD, 0xFB, 0x0F, 0x4B, 0x1A, 0x88, 0x0F, 0x4B, 0x9A, 0x42, 0x02, 0xD1, 0x0E, 0x4B, 0x1D, 0x70,
-    0x5E, 0x70, 0x01, 0x3C, 0x00, 0x2C, 0xF2, 0xD1, 0xC0, 0x22, 0xC0, 0x20, 0x21, 0x00, 0x52, 0x02,
-    0xC0, 0x04, 0x0B, 0xF0, 0xB3, 0xFB, 0x01, 0xF0, 0x83, 0xFA, 0x01, 0xF0, 0x6D, 0xF9, 0x07, 0x4B,
-    0x1C, 0x60, 0x01, 0xF0, 0x2F, 0xF9, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x03, 0x04, 0x00, 0x00,
-    0x30, 0x01, 0x00, 0x04, 0x0F, 0x03, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02,
-    0xF8, 0xB5, 0x0E, 0x00, 0x05, 0x00, 0x0B, 0xF0, 0x3F, 0xFB, 0x04, 0x00, 0x30, 0x00, 0x0B, 0xF0,
-    0x3B, 0xFB, 0x2A, 0x00, 0x01, 0x00, 0x24, 0x1A, 0x50, 0x1B, 0x84, 0x42, 0x0E, 0xDC, 0x00, 0x20,
-    0xF8, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xD7, 0x5C, 0xBC, 0x46, 0xF7, 0x5C, 0xBC, 0x45, 0x03, 0xD1,
-    0x01, 0x33, 0x8B, 0x42, 0xF7, 0xDB, 0xF3, 0xD0, 0x01, 0x32, 0xED, 0xE7, 0x00, 0x23, 0xF8, 0xE7,
-    0x01, 0x23, 0xA2, 0x4A, 0xF0, 0xB5, 0x13, 0x80, 0x03, 0x22, 0x00, 0x25, 0xA0, 0x4C, 0xA3, 0x70,
-    0xA0, 0x4B, 0x1A, 0x70, 0xA0, 0x4B, 0x63, 0x60, 0xA0, 0x4B, 0x89, 0xB0, 0x1D, 0x70, 0xFF, 0xF7,
-    0x28, 0xF9, 0x9F, 0x49, 0x10, 0x20, 0xFF, 0xF7, 0x3F, 0xF9, 0x9E, 0x49, 0x20, 0x20, 0xFF, 0xF7,
-    0x3B, 0xF9, 0x9D, 0x49, 0x40, 0x20, 0xFF, 0xF7, 0x37, 0xF9, 0x9C, 0x49, 0x80, 0x20, 0xFF, 0xF7,
-    0x33, 0xF9, 0x9B, 0x49, 0x04, 0x20, 0xFF, 0xF7, 0x2F, 0xF9, 0x9A, 0x49, 0x02, 0x20, 0xFF, 0xF7,
-    0x2B, 0xF9, 0x99, 0x48, 0xFF, 0xF7, 0x4E, 0xF9, 0x30, 0x21, 0x98, 0x4A, 0x13, 0x88, 0x8B, 0x43,
-    0x13, 0x80, 0x06, 0x23, 0x96, 0x4A, 0x11, 0x88, 0x0B, 0x43, 0x13, 0x80, 0x80, 0x23, 0xDB, 0x04,
-    0x1A, 0x88, 0x80, 0x2A, 0x00, 0xD1, 0x1D, 0x80, 0xA0, 0x25, 0xFF, 0x22, 0x00, 0x26, 0x91, 0x4B,
-    0xED, 0x04, 0x2B, 0x80, 0x90, 0x4B, 0x1A, 0x80, 0x90, 0x4A, 0x33, 0x04, 0x1B, 0x0C, 0x13, 0x80,
-    0x01, 0x36, 0x0B, 0xF0, 0x2B, 0xFB, 0x11, 0x2E, 0xF6, 0xD1, 0x80, 0x23, 0x00, 0x21, 0xC0, 0x22,
-    0xC0, 0x20, 0xDB, 0x04, 0x29, 0x80, 0x52, 0x02, 0x19, 0x80, 0xC0, 0x04, 0x0B, 0xF0, 0x26, 0xFB,
-    0xF8, 0x22, 0x87, 0x4E, 0x33, 0x68, 0x5B, 0x0E, 0x12, 0x06, 0x5B, 0x06, 0x9B, 0x18, 0x5A, 0x42,
-    0x53, 0x41, 0x23, 0x72, 0x0B, 0xF0, 0x54, 0xFB, 0x60, 0x70, 0x01, 0xF0, 0xD5, 0xF8, 0x01, 0xF0,
-    0xDF, 0xF8, 0x80, 0x23, 0x7F, 0x4A, 0x5B, 0x00, 0x13, 0x60, 0x01, 0xF0, 0x93, 0xF8, 0x80, 0x22,
-    0x01, 0x25, 0x7D, 0x4B, 0xD2, 0x00, 0x1A, 0x80, 0x0B, 0xF0, 0x86, 0xFB, 0x7B, 0x4B, 0x7C, 0x4A,
-    0x1D, 0x70, 0xE3, 0x68, 0x13, 0x60, 0x80, 0x22, 0x52, 0x02, 0x99, 0x18, 0x79, 0x4A, 0x11, 0x60,
-    0xC0, 0x22, 0x92, 0x02, 0x9B, 0x18, 0x27, 0x7A, 0x77, 0x4A, 0x07, 0x96, 0x13, 0x60, 0x00, 0x2F,
-    0x00, 0xD1, 0xB2, 0xE0, 0x75, 0x4B, 0x1A, 0x78, 0x01, 0x33, 0x00, 0x2A, 0xFB, 0xD1, 0x1D, 0x00,
-    0x01, 0x33, 0x5A, 0x1E, 0x12, 0x78, 0x00, 0x2A, 0xF9, 0xD1, 0x01, 0x3D, 0x2B, 0x78, 0x2F, 0x2B,
-    0x01, 0xD0, 0x00, 0x2B, 0xF9, 0xD1, 0x20, 0x00, 0x01, 0x35, 0x20, 0x22, 0x29, 0x00, 0x10, 0x30,
-    0x0B, 0xF0, 0x10, 0xF9, 0x28, 0x00, 0x6A, 0x49, 0xFF, 0xF7, 0x3A, 0xFF, 0x69, 0x4F, 0x3E, 0x68,
-    0x00, 0x28, 0x05, 0xD1, 0x28, 0x00, 0x68, 0x49, 0xFF, 0xF7, 0x32, 0xFF, 0x00, 0x28, 0x41, 0xD0,
-    0x04, 0x23, 0x1E, 0x43, 0x01, 0x22, 0x07, 0x9B, 0x1B, 0x68, 0x30, 0x3B, 0x23, 0x63, 0x63, 0x4B,
-    0x3E, 0x60, 0x1A, 0x60, 0x03, 0x22, 0x62, 0x48, 0x62, 0x4B, 0x1B, 0x1A, 0x01, 0x3B, 0x1A, 0x43,
-    0x61, 0x49, 0x01, 0x32, 0x0B, 0xF0, 0x72, 0xFB, 0x63, 0x6B, 0x00, 0x2B, 0x0E, 0xD1, 0x80, 0x23,
-    0x21, 0x6B, 0x1B, 0x05, 0x99, 0x42, 0x09, 0xD2, 0xE0, 0x68, 0x81, 0x42, 0x06, 0xD9, 0x81, 0x22,
-    0x92, 0x04, 0x52, 0x1A, 0x0B, 0xF0, 0x54, 0xFB, 0xE3, 0x68, 0x23, 0x63, 0x0B, 0xF0, 0xBE, 0xFA,
-    0xFF, 0xF7, 0x5E, 0xF9, 0x55, 0x49, 0x01, 0x20, 0xFF, 0xF7, 0x76, 0xF8, 0x04, 0x22, 0x02, 0x21,
-    0x13, 0x00, 0x05, 0x92, 0x04, 0x92, 0x03, 0x92, 0x02, 0x92, 0x01, 0x92, 0x00, 0x92, 0x50, 0x48,
-    0x00, 0xF0, 0xDC, 0xF9, 0x02, 0xF0, 0x70, 0xFB, 0x01, 0xF0, 0x38, 0xFA, 0x09, 0xB0, 0xF0, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x04, 0x23, 0x9E, 0x43, 0xBC, 0xE7, 0x96, 0x23, 0x26, 0x6B, 0x5B, 0x02,
-    0xF3, 0x18, 0x23, 0x63, 0x07, 0x95, 0x20, 0x6B, 0x01, 0xF0, 0x84, 0xF9, 0x00, 0x25, 0x00, 0x28,
-    0x03, 0xD0, 0x44, 0x4B, 0x02, 0x6B, 0x9A, 0x42, 0x28, 0xD0, 0x3C, 0x4F, 0x3D, 0x60, 0x00, 0x2D,
-    0x2B, 0xD1, 0x01, 0xF0, 0x45, 0xF9, 0x03, 0x20, 0x01, 0xF0, 0x92, 0xF8, 0x2D, 0x4B, 0x1D, 0x60,
-    0x00, 0xF0, 0xF0, 0xFF, 0x2A, 0x00, 0x28, 0x00, 0x3B, 0x49, 0x01, 0xF0, 0xC5, 0xF8, 0x2A, 0x00,
-    0x01, 0x20, 0x3A, 0x49, 0x01, 0xF0, 0xC0, 0xF8, 0x2A, 0x00, 0x02, 0x20, 0x38, 0x49, 0x01, 0xF0,
-    0xBB, 0xF8, 0x2A, 0x00, 0x03, 0x20, 0x37, 0x49, 0x01, 0xF0, 0xB6, 0xF8, 0x2A, 0x00, 0x04, 0x20,
-    0x35, 0x49, 0x01, 0xF0, 0xB1, 0xF8, 0x0B, 0xF0, 0x49, 0xFA, 0xFC, 0xE7, 0x03, 0x6A, 0x30, 0x33,
-    0xC0, 0x18, 0x01, 0xF0, 0x4F, 0xF9, 0x01, 0x35, 0xC9, 0xE7, 0x07, 0x9B, 0x00, 0x2B, 0x02, 0xD0,
-    0x30, 0x00, 0xFF, 0xF7, 0x61, 0xFE, 0x3D, 0x60, 0x7C, 0xE7, 0x20, 0x6B, 0x30, 0x30, 0x01, 0xF0,
-    0x41, 0xF9, 0x00, 0x28, 0xB1, 0xD0, 0x3E, 0x00, 0x07, 0x97, 0xB4, 0xE7, 0xC8, 0x00, 0x00, 0x08,
-    0x3C, 0x00, 0x00, 0x02, 0x49, 0x73, 0x00, 0x03, 0x8C, 0xB9, 0x03, 0x02, 0x35, 0x75, 0x00, 0x03,
-    0x7C, 0x37, 0x00, 0x06, 0x70, 0x38, 0x00, 0x06, 0x90, 0x38, 0x00, 0x06, 0xB0, 0x6A, 0x00, 0x08,
-    0x08, 0x34, 0x00, 0x06, 0x7C, 0x34, 0x00, 0x06, 0xF1, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
-    0x00, 0x02, 0x00, 0x04, 0xFF, 0x7F, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x04,
-    0xFC, 0xFB, 0x03, 0x02, 0x80, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x04, 0x52, 0x76, 0x00, 0x03,
-    0xA4, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x02, 0x08, 0xFC, 0x03, 0x02,
-    0x53, 0xE4, 0x00, 0x08, 0x48, 0x73, 0x00, 0x03, 0x57, 0xE4, 0x00, 0x08, 0x90, 0x00, 0x00, 0x02,
-    0x00, 0x30, 0x00, 0x06, 0x88, 0x3F, 0x00, 0x06, 0xE8, 0x36, 0x01, 0x08, 0x40, 0x54, 0x00, 0x03,
-    0x70, 0x10, 0x00, 0x00, 0x4E, 0x45, 0x53, 0x1A, 0x5B, 0xE4, 0x00, 0x08, 0x6A, 0xE4, 0x00, 0x08,
-    0x83, 0xE4, 0x00, 0x08, 0x9F, 0xE4, 0x00, 0x08, 0xB7, 0xE4, 0x00, 0x08, 0x70, 0x47, 0x70, 0xB5,
-    0x05, 0x00, 0x48, 0x1E, 0x40, 0x19, 0x0C, 0x00, 0x0B, 0xF0, 0x6A, 0xFA, 0x60, 0x43, 0x40, 0x1B,
-    0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x43, 0x1E, 0x98, 0x41, 0x70, 0x47, 0x00, 0x48, 0x70, 0x47,
-    0xE8, 0xDD, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 0x70, 0x10, 0x00, 0x00, 0x00, 0x48, 0x70, 0x47,
-    0xD2, 0xE4, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 0xD7, 0xE4, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47,
-    0xD2, 0xE4, 0x00, 0x08, 0x00, 0x48, 0x70, 0x47, 0xD7, 0xE4, 0x00, 0x08, 0xF0, 0xB5, 0x05, 0x04,
-    0x04, 0x0C, 0x0E, 0x00, 0x17, 0x00, 0x01, 0x20, 0x91, 0xB0, 0x2D, 0x0C, 0x00, 0x29, 0x04, 0xD0,
-    0x00, 0x2F, 0x06, 0xD1, 0x24, 0x04, 0x20, 0x00, 0x28, 0x43, 0x11, 0xB0, 0xF0, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0x48, 0x4B, 0x9F, 0x42, 0x7F, 0xD9, 0x47, 0x4B, 0x48, 0x48, 0xFF, 0x18, 0x32, 0x00,
-    0x33, 0x18, 0x0F, 0x93, 0x13, 0x78, 0x5B, 0x19, 0x00, 0x93, 0x00, 0x99, 0x53, 0x78, 0x5B, 0x18,
-    0x01, 0x93, 0x01, 0x99, 0x93, 0x78, 0x5B, 0x18, 0x02, 0x93, 0x02, 0x99, 0xD3, 0x78, 0x5B, 0x18,
-    0x03, 0x93, 0x03, 0x99, 0x13, 0x79, 0x5B, 0x18, 0x04, 0x93, 0x04, 0x99, 0x53, 0x79, 0x5B, 0x18,
-    0x05, 0x93, 0x05, 0x99, 0x93, 0x79, 0x5B, 0x18, 0x06, 0x93, 0x06, 0x99, 0xD3, 0x79, 0x5B, 0x18,
-    0x07, 0x93, 0x07, 0x99, 0x13, 0x7A, 0x5B, 0x18, 0x08, 0x93, 0x08, 0x99, 0x53, 0x7A, 0x5B, 0x18,
-    0x09, 0x93, 0x09, 0x99, 0x93, 0x7A, 0x5B, 0x18, 0x0A, 0x93, 0xD3, 0x7A, 0x0A, 0x99, 0x5B, 0x18,
-    0x0B, 0x93, 0x0B, 0x99, 0x13, 0x7B, 0x5B, 0x18, 0x0C, 0x93, 0x0C, 0x99, 0x8C, 0x46, 0x53, 0x7B,
-    0x9C, 0x44, 0x63, 0x46, 0x91, 0x7B, 0xD5, 0x7B, 0x0D, 0x93, 0xCB, 0x18, 0x0E, 0x93, 0xED, 0x18,
-    0x00, 0x9B, 0x19, 0x00, 0x01, 0x9B, 0x9C, 0x46, 0x61, 0x44, 0x0B, 0x00, 0x02, 0x99, 0x5B, 0x18,
-    0x03, 0x99, 0x5B, 0x18, 0x04, 0x99, 0x5B, 0x18, 0x05, 0x99, 0x5B, 0x18, 0x06, 0x99, 0x5B, 0x18,
-    0x07, 0x99, 0x5B, 0x18, 0x08, 0x99, 0x5B, 0x18, 0x09, 0x99, 0x5B, 0x18, 0x0A, 0x99, 0x5B, 0x18,
-    0x0B, 0x99, 0x5B, 0x18, 0x0C, 0x99, 0x5B, 0x18, 0x0D, 0x99, 0x5B, 0x18, 0x0E, 0x99, 0x59, 0x18,
-    0x0F, 0x9B, 0x49, 0x19, 0x10, 0x32, 0x64, 0x18, 0x9B, 0x1A, 0x0F, 0x2B, 0x9A, 0xDC, 0x02, 0x00,
-    0x10, 0x3A, 0x13, 0x09, 0x59, 0x1C, 0x09, 0x01, 0x1B, 0x01, 0x76, 0x18, 0xD0, 0x1A, 0x9A, 0x42,
-    0x0F, 0xD1, 0x28, 0x00, 0x0E, 0x49, 0x0B, 0xF0, 0x9F, 0xF9, 0x20, 0x00, 0x0D, 0x00, 0x0C, 0x49,
-    0x0B, 0xF0, 0x9A, 0xF9, 0x0C, 0x00, 0x73, 0xE7, 0x38, 0x00, 0x00, 0x27, 0x0F, 0x28, 0x00, 0xD9,
-    0x7D, 0xE7, 0x30, 0x18, 0x33, 0x78, 0x01, 0x36, 0xED, 0x18, 0x64, 0x19, 0xB0, 0x42, 0xF9, 0xD1,
-    0x06, 0x00, 0xE6, 0xE7, 0xAF, 0x15, 0x00, 0x00, 0x50, 0xEA, 0xFF, 0xFF, 0xB0, 0x15, 0x00, 0x00,
-    0xF1, 0xFF, 0x00, 0x00, 0x10, 0xB5, 0x0A, 0xF0, 0x1F, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x10, 0xB5, 0x0A, 0xF0, 0x3F, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x0A, 0xF0,
-    0x8D, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x0A, 0xF0, 0xDF, 0xFF, 0x10, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x03, 0x22, 0x20, 0x4B, 0x52, 0x42, 0x30, 0xB5, 0x1A, 0x60, 0x01, 0x32,
-    0x5A, 0x60, 0x01, 0x32, 0x9A, 0x60, 0x00, 0x23, 0x91, 0xB0, 0x01, 0xAA, 0x9B, 0x54, 0x01, 0x33,
-    0x10, 0x2B, 0xFB, 0xD1, 0x00, 0x24, 0x00, 0x94, 0x03, 0x2C, 0x05, 0xD9, 0x00, 0x20, 0x01, 0x38,
-    0x11, 0xB0, 0x30, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x05, 0xAB, 0x1C, 0x19, 0x22, 0x00, 0x0F, 0xAB,
-    0x10, 0xC2, 0x9A, 0x42, 0xFC, 0xD1, 0x20, 0x1D, 0x05, 0x00, 0x20, 0x22, 0x00, 0x21, 0x0A, 0xF0,
-    0xB5, 0xFF, 0x23, 0x68, 0x21, 0x00, 0x1B, 0x1B, 0x5A, 0x42, 0x5A, 0x41, 0x28, 0x00, 0x24, 0x31,
-    0x08, 0xC8, 0x5D, 0x42, 0x6B, 0x41, 0x1A, 0x40, 0x88, 0x42, 0xF9, 0xD1, 0x63, 0x6A, 0x1C, 0x1B,
-    0x63, 0x42, 0x5C, 0x41, 0x22, 0x42, 0xD9, 0xD0, 0x02, 0x9B, 0x03, 0x98, 0x5A, 0x1E, 0x93, 0x41,
-    0x42, 0x1E, 0x90, 0x41, 0x18, 0x40, 0xD2, 0xE7, 0x74, 0x76, 0x00, 0x03, 0xF8, 0xB5, 0x01, 0x24,
-    0x1C, 0x4F, 0x06, 0x9E, 0x07, 0x9D, 0xFC, 0x60, 0x00, 0x28, 0x30, 0xD0, 0x48, 0x1C, 0x01, 0xD0,
-    0x02, 0x29, 0x2C, 0xD1, 0x51, 0x1C, 0x01, 0xD0, 0x04, 0x2A, 0x28, 0xD1, 0x5A, 0x1C, 0x01, 0xD0,
-    0x04, 0x2B, 0x24, 0xD1, 0x73, 0x1C, 0x01, 0xD0, 0x04, 0x2E, 0x20, 0xD1, 0x6B, 0x1C, 0x01, 0xD0,
-    0x04, 0x2D, 0x1C, 0xD1, 0x08, 0x9B, 0x01, 0x33, 0x02, 0xD0, 0x08, 0x9B, 0x04, 0x2B, 0x16, 0xD1,
-    0x09, 0x9B, 0x01, 0x33, 0x02, 0xD0, 0x09, 0x9B, 0x04, 0x2B, 0x10, 0xD1, 0x0A, 0x9B, 0x01, 0x33,
-    0x02, 0xD0, 0x0A, 0x9B, 0x04, 0x2B, 0x0A, 0xD1, 0x0B, 0x9B, 0x01, 0x33, 0x02, 0xD0, 0x0B, 0x9B,
-    0x04, 0x2B, 0x04, 0xD1, 0xFF, 0xF7, 0x86, 0xFF, 0xF8, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x01, 0x20,
-    0x40, 0x42, 0xF9, 0xE7, 0x74, 0x76, 0x00, 0x03, 0xF0, 0xB5, 0x8B, 0xB0, 0x01, 0x90, 0x03, 0x91,
-    0x02, 0x92, 0x09, 0x93, 0x0D, 0x29, 0x00, 0xD8, 0x48, 0xE1, 0x03, 0x00, 0x8C, 0x46, 0x63, 0x44,
-    0x04, 0x93, 0x0B, 0x00, 0x0D, 0x3B, 0xC3, 0x18, 0x05, 0x93, 0x03, 0x00, 0x00, 0x90, 0x02, 0x9A,
-    0x04, 0x33, 0xD9, 0x78, 0x8C, 0x46, 0x99, 0x78, 0x06, 0x91, 0x59, 0x78, 0x07, 0x91, 0x19, 0x78,
-    0x08, 0x91, 0x61, 0x46, 0x88, 0x01, 0x06, 0x99, 0x48, 0x40, 0x07, 0x99, 0x40, 0x01, 0x48, 0x40,
-    0x08, 0x99, 0x40, 0x01, 0x48, 0x40, 0x21, 0x21, 0x41, 0x43, 0x48, 0x09, 0x10, 0x9D, 0x81, 0x04,
-    0x8C, 0x0C, 0x09, 0x0C, 0x49, 0x59, 0x01, 0x9D, 0xA9, 0x42, 0x00, 0xD2, 0x94, 0xE0, 0x5D, 0x1A,
-    0x9B, 0x4E, 0x6F, 0x1E, 0xB7, 0x42, 0x00, 0xD9, 0x8E, 0xE0, 0x80, 0x27, 0x3F, 0x01, 0xBD, 0x42,
-    0x1A, 0xD9, 0xCF, 0x78, 0x67, 0x45, 0x17, 0xD0, 0x96, 0x4C, 0x40, 0x05, 0x40, 0x0D, 0x44, 0x40,
-    0x10, 0x98, 0xA1, 0x00, 0x09, 0x58, 0x01, 0x98, 0x88, 0x42, 0x00, 0xD9, 0x7C, 0xE0, 0x5D, 0x1A,
-    0x68, 0x1E, 0xB0, 0x42, 0x00, 0xD9, 0x77, 0xE0, 0x80, 0x27, 0x3F, 0x01, 0xBD, 0x42, 0x03, 0xD9,
-    0xC8, 0x78, 0x60, 0x45, 0x00, 0xD0, 0x6F, 0xE0, 0x08, 0x78, 0x08, 0x9E, 0xB0, 0x42, 0x6B, 0xD1,
-    0x48, 0x78, 0x07, 0x9E, 0xB0, 0x42, 0x67, 0xD1, 0x88, 0x78, 0x06, 0x9E, 0xB0, 0x42, 0x63, 0xD1,
-    0x10, 0x98, 0xA4, 0x00, 0x23, 0x50, 0x00, 0x98, 0x18, 0x1A, 0x00, 0x28, 0x10, 0xDD, 0x03, 0x28,
-    0x63, 0xDC, 0x96, 0x1E, 0x34, 0x78, 0x04, 0x43, 0x34, 0x70, 0x00, 0x24, 0x00, 0x9E, 0x36, 0x5D,
-    0x16, 0x55, 0x01, 0x34, 0xA0, 0x42, 0xF9, 0xD1, 0x00, 0x9C, 0x24, 0x18, 0x00, 0x94, 0x12, 0x18,
-    0xCC, 0x78, 0xD8, 0x78, 0x84, 0x42, 0x67, 0xD0, 0x18, 0x1D, 0x80, 0x21, 0x00, 0x9B, 0x01, 0x38,
-    0xC3, 0x1A, 0x1B, 0x06, 0x1B, 0x0E, 0x09, 0x01, 0x8D, 0x42, 0x00, 0xD9, 0x91, 0xE0, 0x1C, 0x26,
-    0x69, 0x1E, 0x8C, 0x00, 0x01, 0x3B, 0x5B, 0x01, 0x34, 0x40, 0x1C, 0x43, 0xC9, 0x08, 0x14, 0x70,
-    0x51, 0x70, 0x02, 0x32, 0x05, 0x9B, 0x83, 0x42, 0x2B, 0xD8, 0x02, 0x9B, 0x09, 0x99, 0xD3, 0x1A,
-    0x0B, 0x60, 0x04, 0x9B, 0x1B, 0x1A, 0x00, 0x2B, 0x15, 0xD0, 0x03, 0x99, 0x02, 0x9C, 0xC8, 0x1A,
-    0x01, 0x99, 0x08, 0x18, 0x51, 0x1C, 0xA2, 0x42, 0x00, 0xD0, 0xAA, 0xE0, 0xEE, 0x2B, 0x00, 0xD9,
-    0xA7, 0xE0, 0x1A, 0x00, 0x11, 0x32, 0x22, 0x70, 0x00, 0x22, 0x84, 0x5C, 0x8C, 0x54, 0x01, 0x32,
-    0x93, 0x42, 0xFA, 0xD1, 0xCA, 0x18, 0x11, 0x23, 0x00, 0x20, 0x13, 0x70, 0x02, 0x9B, 0x50, 0x70,
-    0x90, 0x70, 0x03, 0x32, 0xD2, 0x1A, 0x09, 0x9B, 0x1A, 0x60, 0x0B, 0xB0, 0xF0, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0x00, 0x90, 0x03, 0x00, 0x4C, 0xE7, 0x10, 0x99, 0xA4, 0x00, 0x63, 0x50, 0x58, 0x1C,
-    0x05, 0x9B, 0x83, 0x42, 0xF6, 0xD8, 0x00, 0x98, 0xC7, 0xE7, 0x54, 0x1C, 0x12, 0x28, 0x03, 0xDC,
-    0xC6, 0x1E, 0x16, 0x70, 0x22, 0x00, 0x98, 0xE7, 0x06, 0x00, 0x00, 0x27, 0x12, 0x3E, 0x17, 0x70,
-    0x22, 0x00, 0x01, 0x32, 0xA4, 0x46, 0x14, 0x00, 0xFF, 0x2E, 0x02, 0xD8, 0x64, 0x46, 0x26, 0x70,
-    0x8B, 0xE7, 0x62, 0x46, 0xFF, 0x3E, 0xF2, 0xE7, 0x0C, 0x79, 0x18, 0x79, 0x84, 0x42, 0x01, 0xD0,
-    0x58, 0x1D, 0x92, 0xE7, 0x4C, 0x79, 0x58, 0x79, 0x84, 0x42, 0x01, 0xD0, 0x98, 0x1D, 0x8C, 0xE7,
-    0x8C, 0x79, 0x98, 0x79, 0x84, 0x42, 0x01, 0xD0, 0xD8, 0x1D, 0x86, 0xE7, 0xCC, 0x79, 0xD8, 0x79,
-    0x84, 0x42, 0x02, 0xD0, 0x08, 0x33, 0x18, 0x00, 0x7F, 0xE7, 0x18, 0x00, 0x0C, 0x7A, 0x1B, 0x7A,
-    0x09, 0x30, 0x9C, 0x42, 0x00, 0xD0, 0x78, 0xE7, 0x09, 0x31, 0x04, 0x9B, 0x83, 0x42, 0x03, 0xD9,
-    0x0C, 0x78, 0x03, 0x78, 0x9C, 0x42, 0x26, 0xD0, 0x80, 0x21, 0x00, 0x9B, 0x54, 0x1C, 0xC3, 0x1A,
-    0xC9, 0x01, 0x8D, 0x42, 0x2C, 0xD8, 0x20, 0x26, 0x69, 0x1E, 0x21, 0x2B, 0x1E, 0xD8, 0x02, 0x3B,
-    0x09, 0xE0, 0x80, 0x21, 0x02, 0x3B, 0x1B, 0x06, 0x1B, 0x0E, 0x54, 0x1C, 0xC9, 0x01, 0x8D, 0x42,
-    0x09, 0xD8, 0x20, 0x26, 0x69, 0x1E, 0x33, 0x43, 0x13, 0x70, 0x8B, 0x00, 0x89, 0x09, 0x23, 0x70,
-    0x61, 0x70, 0xA2, 0x1C, 0x66, 0xE7, 0x20, 0x49, 0x69, 0x18, 0x08, 0x25, 0xCE, 0x0A, 0x2E, 0x40,
-    0x33, 0x43, 0x10, 0x26, 0xEF, 0xE7, 0x01, 0x31, 0x01, 0x30, 0xCE, 0xE7, 0x21, 0x3B, 0x16, 0x70,
-    0x00, 0x26, 0x22, 0x00, 0x01, 0x34, 0xFF, 0x2B, 0xE6, 0xD9, 0x16, 0x70, 0xFF, 0x3B, 0xF8, 0xE7,
-    0x15, 0x49, 0x69, 0x18, 0x08, 0x25, 0xCF, 0x0A, 0x10, 0x26, 0x2F, 0x40, 0x09, 0x2B, 0x02, 0xD8,
-    0x02, 0x3B, 0x3B, 0x43, 0xD7, 0xE7, 0x09, 0x3B, 0x3E, 0x43, 0xE8, 0xE7, 0x03, 0x9B, 0x02, 0x9A,
-    0x49, 0xE7, 0x03, 0x2B, 0x05, 0xD8, 0x94, 0x1E, 0x21, 0x78, 0x19, 0x43, 0x21, 0x70, 0x11, 0x00,
-    0x52, 0xE7, 0xDC, 0x1E, 0x12, 0x2B, 0x07, 0xD9, 0x1C, 0x00, 0x00, 0x25, 0x12, 0x3C, 0x15, 0x70,
-    0x0A, 0x00, 0x01, 0x31, 0xFF, 0x2C, 0x01, 0xD8, 0x14, 0x70, 0x45, 0xE7, 0xFF, 0x3C, 0xF6, 0xE7,
-    0xFE, 0xBF, 0x00, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xF0, 0xB5, 0x85, 0xB0,
-    0x02, 0x93, 0x00, 0x23, 0x03, 0x91, 0x02, 0x99, 0x0B, 0x60, 0x01, 0x78, 0x84, 0x46, 0x01, 0x92,
-    0x11, 0x29, 0x0E, 0xD9, 0x11, 0x39, 0x45, 0x1C, 0x03, 0x29, 0x00, 0xDC, 0xC5, 0xE0, 0xE8, 0x5C,
-    0x01, 0x9A, 0xD0, 0x54, 0x01, 0x33, 0x99, 0x42, 0xF9, 0xD1, 0x01, 0x9B, 0x6C, 0x18, 0x5B, 0x18,
-    0x18, 0xE0, 0x05, 0x00, 0x01, 0x9B, 0x29, 0x78, 0x6C, 0x1C, 0x0F, 0x29, 0x16, 0xD8, 0x00, 0x29,
-    0x2F, 0xD0, 0x20, 0x78, 0x18, 0x70, 0x60, 0x78, 0x58, 0x70, 0xA5, 0x78, 0x9D, 0x70, 0x03, 0x25,
-    0xE0, 0x1C, 0xDE, 0x1C, 0xCF, 0x1C, 0x62, 0x5D, 0x5A, 0x55, 0x01, 0x35, 0xAF, 0x42, 0xFA, 0xD1,
-    0x44, 0x18, 0x73, 0x18, 0x21, 0x78, 0x0F, 0x29, 0x22, 0xD9, 0x01, 0x34, 0x26, 0x78, 0x3F, 0x29,
-    0x40, 0xD9, 0xC8, 0x06, 0x40, 0x0F, 0xC0, 0x43, 0xF6, 0x00, 0x80, 0x1B, 0x49, 0x09, 0x65, 0x1C,
-    0x18, 0x18, 0x4E, 0x1E, 0x01, 0x78, 0x19, 0x70, 0x41, 0x78, 0x59, 0x70, 0x02, 0x21, 0x9C, 0x1C,
-    0xB7, 0x1C, 0x42, 0x5C, 0x5A, 0x54, 0x01, 0x31, 0x8F, 0x42, 0xFA, 0xD1, 0xA3, 0x19, 0x16, 0xE0,
-    0xFF, 0x31, 0x20, 0x78, 0x01, 0x34, 0x00, 0x28, 0xFA, 0xD0, 0x0F, 0x30, 0x09, 0x18, 0xC8, 0xE7,
-    0x42, 0x48, 0x89, 0x08, 0x40, 0x1A, 0x61, 0x78, 0x89, 0x00, 0x41, 0x1A, 0x58, 0x18, 0x59, 0x5C,
-    0x19, 0x70, 0x41, 0x78, 0x59, 0x70, 0x81, 0x78, 0xA5, 0x1C, 0x99, 0x70, 0x03, 0x33, 0xA9, 0x1E,
-    0x0C, 0x78, 0x03, 0x20, 0x21, 0x00, 0x01, 0x40, 0x04, 0x42, 0xAC, 0xD0, 0x00, 0x20, 0x2C, 0x5C,
-    0x1C, 0x54, 0x04, 0x00, 0x01, 0x30, 0x81, 0x42, 0xF9, 0xD1, 0x02, 0x34, 0x5B, 0x18, 0x2C, 0x19,
-    0x69, 0x5C, 0xBB, 0xE7, 0x1F, 0x29, 0x19, 0xD9, 0x1F, 0x20, 0x0E, 0x00, 0x06, 0x40, 0x01, 0x42,
-    0x0B, 0xD1, 0xFF, 0x27, 0x25, 0x02, 0x65, 0x1B, 0x38, 0x00, 0x60, 0x43, 0x26, 0x78, 0x40, 0x19,
-    0x01, 0x34, 0x00, 0x2E, 0xF8, 0xD0, 0x1F, 0x36, 0x36, 0x18, 0x20, 0x78, 0x61, 0x78, 0x80, 0x08,
-    0x89, 0x01, 0x40, 0x18, 0xC0, 0x43, 0xA5, 0x1C, 0x18, 0x18, 0xAB, 0xE7, 0x0F, 0x29, 0x30, 0xD9,
-    0x80, 0x20, 0xCD, 0x02, 0xC0, 0x01, 0x0E, 0x00, 0x28, 0x40, 0x07, 0x25, 0x2E, 0x40, 0x29, 0x42,
-    0x0B, 0xD1, 0xFF, 0x21, 0x27, 0x02, 0xE7, 0x1B, 0x0D, 0x00, 0x65, 0x43, 0x26, 0x78, 0xED, 0x19,
-    0x01, 0x34, 0x00, 0x2E, 0xF8, 0xD0, 0x07, 0x36, 0x76, 0x19, 0x21, 0x78, 0x65, 0x78, 0x89, 0x08,
-    0xAD, 0x01, 0x49, 0x19, 0x09, 0x18, 0x16, 0x4A, 0x59, 0x1A, 0xA5, 0x1C, 0x88, 0x18, 0x8B, 0x42,
-    0x88, 0xD1, 0x03, 0x99, 0x62, 0x46, 0x8C, 0x46, 0x62, 0x44, 0x10, 0x00, 0x01, 0x9A, 0x9A, 0x1A,
-    0x02, 0x9B, 0x1A, 0x60, 0xA8, 0x42, 0x12, 0xD1, 0x00, 0x20, 0x05, 0xB0, 0xF0, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0x89, 0x08, 0x65, 0x1C, 0xCC, 0x43, 0xB6, 0x00, 0xA4, 0x1B, 0x19, 0x5D, 0x19, 0x70,
-    0x18, 0x19, 0x41, 0x78, 0x59, 0x70, 0x02, 0x33, 0x91, 0xE7, 0x01, 0x9B, 0x96, 0xE7, 0x85, 0x42,
-    0x80, 0x41, 0x03, 0x23, 0x98, 0x43, 0x04, 0x38, 0xE7, 0xE7, 0xC0, 0x46, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x00, 0xC0, 0xFF, 0xFF, 0xF0, 0xB5, 0x00, 0x25, 0x0E, 0x00, 0x41, 0x18, 0x8C, 0x46, 0x19, 0x68,
-    0x1D, 0x60, 0x07, 0x78, 0x85, 0xB0, 0x54, 0x18, 0x01, 0x94, 0x11, 0x2F, 0x00, 0xD8, 0x1B, 0xE1,
-    0x3C, 0x00, 0x11, 0x3C, 0x01, 0x30, 0x03, 0x2C, 0x00, 0xDC, 0x13, 0xE1, 0xA1, 0x42, 0x00, 0xD2,
-    0x23, 0xE1, 0x01, 0x3E, 0x10, 0x3F, 0xBE, 0x42, 0x00, 0xD2, 0x1C, 0xE1, 0x41, 0x5D, 0x51, 0x55,
-    0x01, 0x35, 0xAC, 0x42, 0xFA, 0xD1, 0x06, 0x19, 0x11, 0x19, 0x2E, 0xE0, 0x07, 0x78, 0x46, 0x1C,
-    0x0F, 0x2F, 0x2E, 0xD8, 0x00, 0x2F, 0x08, 0xD1, 0xB4, 0x45, 0x00, 0xD1, 0xB0, 0xE0, 0x30, 0x78,
-    0x01, 0x36, 0x00, 0x28, 0x4C, 0xD0, 0x0F, 0x30, 0x3F, 0x18, 0x01, 0x98, 0xFC, 0x1C, 0x40, 0x1A,
-    0xA0, 0x42, 0x00, 0xD2, 0x02, 0xE1, 0x60, 0x46, 0x3D, 0x1D, 0x80, 0x1B, 0xA8, 0x42, 0x00, 0xD2,
-    0x9E, 0xE0, 0x30, 0x78, 0x08, 0x70, 0x70, 0x78, 0x48, 0x70, 0xF0, 0x1C, 0x02, 0x90, 0xC8, 0x1C,
-    0x03, 0x90, 0xB0, 0x78, 0x88, 0x70, 0x03, 0x20, 0x35, 0x5C, 0x0D, 0x54, 0x01, 0x30, 0x84, 0x42,
-    0xFA, 0xD1, 0x02, 0x99, 0xCE, 0x19, 0x03, 0x99, 0xC9, 0x19, 0x37, 0x78, 0x0F, 0x2F, 0x29, 0xD9,
-    0x01, 0x36, 0x3F, 0x2F, 0x5F, 0xD9, 0xFC, 0x06, 0x64, 0x0F, 0xE5, 0x43, 0x34, 0x78, 0xE4, 0x00,
-    0x2C, 0x1B, 0x7F, 0x09, 0x0C, 0x19, 0x70, 0x1C, 0x7D, 0x1E, 0xA2, 0x42, 0x00, 0xD9, 0xD9, 0xE0,
-    0x01, 0x9E, 0x01, 0x37, 0x76, 0x1A, 0xBE, 0x42, 0x00, 0xD2, 0xCF, 0xE0, 0x26, 0x78, 0x0E, 0x70,
-    0x8E, 0x1C, 0x02, 0x96, 0x66, 0x78, 0x4E, 0x70, 0xAE, 0x1C, 0x03, 0x96, 0x02, 0x26, 0xA7, 0x5D,
-    0x8F, 0x55, 0x03, 0x9F, 0x01, 0x36, 0xB7, 0x42, 0xF9, 0xD1, 0x02, 0x99, 0x49, 0x19, 0x18, 0xE0,
-    0xFF, 0x37, 0xA9, 0xE7, 0x61, 0x4C, 0xBF, 0x08, 0xE4, 0x1B, 0x77, 0x78, 0xBF, 0x00, 0xE7, 0x1B,
-    0xCF, 0x19, 0xB0, 0x1C, 0xBA, 0x42, 0x00, 0xD9, 0xB4, 0xE0, 0x01, 0x9C, 0x64, 0x1A, 0x02, 0x2C,
-    0x00, 0xD8, 0xAB, 0xE0, 0x3C, 0x78, 0x0C, 0x70, 0x7C, 0x78, 0x4C, 0x70, 0xBC, 0x78, 0x8C, 0x70,
-    0x03, 0x31, 0x84, 0x1E, 0x26, 0x78, 0x03, 0x25, 0x34, 0x00, 0x2C, 0x40, 0x2E, 0x42, 0x00, 0xD1,
-    0x8B, 0xE0, 0x01, 0x9D, 0x6D, 0x1A, 0xA5, 0x42, 0x00, 0xD2, 0x97, 0xE0, 0x65, 0x46, 0x66, 0x1C,
-    0x2D, 0x1A, 0xB5, 0x42, 0x34, 0xD3, 0x00, 0x25, 0x46, 0x5D, 0x4E, 0x55, 0x2E, 0x00, 0x01, 0x35,
-    0xAC, 0x42, 0xF9, 0xD1, 0x02, 0x36, 0x86, 0x19, 0x05, 0x19, 0x09, 0x19, 0xB4, 0x45, 0x00, 0xD8,
-    0x76, 0xE0, 0x2F, 0x78, 0x9D, 0xE7, 0x1F, 0x2F, 0x26, 0xD9, 0x1F, 0x20, 0x3D, 0x00, 0x05, 0x40,
-    0x07, 0x42, 0x0D, 0xD1, 0x66, 0x45, 0x1B, 0xD0, 0xFF, 0x27, 0x34, 0x02, 0x34, 0x1B, 0x38, 0x00,
-    0x70, 0x43, 0x35, 0x78, 0x00, 0x19, 0x01, 0x36, 0x00, 0x2D, 0x0F, 0xD0, 0x1F, 0x35, 0x2D, 0x18,
-    0x34, 0x78, 0x70, 0x78, 0xA4, 0x08, 0x80, 0x01, 0x24, 0x18, 0xE4, 0x43, 0xB0, 0x1C, 0x0C, 0x19,
-    0x94, 0x42, 0x67, 0xD3, 0x01, 0x9E, 0xAF, 0x1C, 0x76, 0x1A, 0x8C, 0xE7, 0xB4, 0x45, 0xE6, 0xD1,
-    0x89, 0x1A, 0x04, 0x20, 0x19, 0x60, 0x4E, 0xE0, 0x0F, 0x2F, 0x30, 0xD9, 0x80, 0x20, 0xFC, 0x02,
-    0xC0, 0x01, 0x04, 0x40, 0x3D, 0x00, 0x07, 0x20, 0x02, 0x94, 0x05, 0x40, 0x07, 0x42, 0x0D, 0xD1,
-    0x66, 0x45, 0xED, 0xD0, 0xFF, 0x27, 0x34, 0x02, 0x34, 0x1B, 0x38, 0x00, 0x70, 0x43, 0x35, 0x78,
-    0x00, 0x19, 0x01, 0x36, 0x00, 0x2D, 0x17, 0xD0, 0x07, 0x35, 0x2D, 0x18, 0x37, 0x78, 0x70, 0x78,
-    0xBF, 0x08, 0x80, 0x01, 0x3F, 0x18, 0x02, 0x98, 0x21, 0x4C, 0x3F, 0x18, 0xCF, 0x1B, 0xB0, 0x1C,
-    0x3C, 0x19, 0xB9, 0x42, 0xCC, 0xD1, 0x89, 0x1A, 0x19, 0x60, 0x84, 0x45, 0x25, 0xD1, 0x00, 0x20,
-    0x05, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xB4, 0x45, 0xDE, 0xD1, 0xC8, 0xE7, 0xBF, 0x08,
-    0xFC, 0x43, 0x37, 0x78, 0xBF, 0x00, 0xE7, 0x1B, 0xCF, 0x19, 0x70, 0x1C, 0xBA, 0x42, 0x21, 0xD8,
-    0x01, 0x9C, 0x64, 0x1A, 0x01, 0x2C, 0x19, 0xD9, 0x3C, 0x78, 0x0C, 0x70, 0x7C, 0x78, 0x4C, 0x70,
-    0x02, 0x31, 0x6E, 0xE7, 0x11, 0x00, 0x74, 0xE7, 0x11, 0x00, 0x60, 0x45, 0x00, 0xD2, 0xF5, 0xE6,
-    0x07, 0x20, 0x89, 0x1A, 0x19, 0x60, 0x40, 0x42, 0xDA, 0xE7, 0x60, 0x45, 0x80, 0x41, 0x03, 0x23,
-    0x98, 0x43, 0x04, 0x38, 0xD4, 0xE7, 0x11, 0x00, 0xA2, 0xE7, 0x11, 0x00, 0x89, 0x1A, 0x05, 0x20,
-    0x19, 0x60, 0xF0, 0xE7, 0x89, 0x1A, 0x06, 0x20, 0x19, 0x60, 0xEC, 0xE7, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x00, 0xC0, 0xFF, 0xFF, 0xF0, 0xB5, 0x8B, 0xB0, 0x08, 0x92, 0x02, 0x00, 0x04, 0x91, 0x41, 0x1A,
-    0x0F, 0x00, 0x0F, 0x26, 0x10, 0x32, 0x01, 0x90, 0x02, 0x92, 0x93, 0x4D, 0x12, 0x3F, 0x02, 0x9B,
-    0x01, 0x9A, 0x93, 0x42, 0x08, 0xD9, 0x03, 0x20, 0x01, 0x9B, 0x1A, 0x78, 0xAA, 0x5C, 0x14, 0x09,
-    0x04, 0x40, 0x32, 0x40, 0x0F, 0x2A, 0x01, 0xD1, 0x00, 0x20, 0x90, 0xE0, 0x04, 0x2A, 0x1C, 0xD1,
-    0x01, 0x20, 0x01, 0x9B, 0x18, 0x56, 0x02, 0x00, 0x12, 0x32, 0xF5, 0xDB, 0x82, 0x1C, 0x9A, 0x18,
-    0x43, 0x1C, 0x26, 0xDB, 0x10, 0x78, 0x28, 0x5C, 0x30, 0x40, 0x05, 0x28, 0x00, 0xD0, 0x82, 0xE0,
-    0x53, 0x78, 0x9C, 0x46, 0x90, 0x78, 0x00, 0x02, 0x60, 0x44, 0x81, 0x42, 0x00, 0xDA, 0x7A, 0xE0,
-    0xB8, 0x42, 0x00, 0xDA, 0x77, 0xE0, 0x01, 0x92, 0xD1, 0xE7, 0x05, 0x2A, 0x00, 0xD0, 0x72, 0xE0,
-    0x01, 0x9B, 0x9A, 0x78, 0x58, 0x78, 0x12, 0x02, 0x12, 0x18, 0x91, 0x42, 0xD4, 0xDB, 0x12, 0x39,
-    0x8A, 0x42, 0xD1, 0xDB, 0x51, 0x13, 0x75, 0x48, 0x89, 0x00, 0x09, 0x58, 0x8A, 0x18, 0x00, 0x2A,
-    0xCA, 0xD0, 0x00, 0x25, 0x2C, 0x00, 0x2F, 0x00, 0x04, 0x9B, 0xD3, 0x1A, 0x05, 0x93, 0x06, 0x95,
-    0x03, 0x95, 0x02, 0x95, 0x01, 0x9B, 0x93, 0x42, 0x58, 0xD8, 0xBD, 0xD1, 0x1F, 0x22, 0x19, 0x78,
-    0x11, 0x40, 0xE2, 0x1C, 0x10, 0x29, 0x0E, 0xD1, 0x00, 0x2D, 0xB5, 0xD1, 0xFF, 0x21, 0x04, 0x9B,
-    0x01, 0x9A, 0xD2, 0x1A, 0x05, 0x9B, 0x02, 0x32, 0x09, 0x02, 0x5A, 0x40, 0x0A, 0x40, 0x51, 0x1E,
-    0x8A, 0x41, 0x12, 0x19, 0x03, 0x32, 0x00, 0x2F, 0x1E, 0xD0, 0x02, 0x9B, 0x00, 0x2B, 0x1B, 0xD0,
-    0x01, 0x21, 0x00, 0x20, 0x5E, 0x4C, 0x49, 0x42, 0x25, 0x8C, 0x8D, 0x42, 0x10, 0xD0, 0x01, 0x23,
-    0x5B, 0x42, 0x9C, 0x46, 0x00, 0x21, 0x5B, 0x4B, 0x4E, 0x00, 0x9E, 0x5B, 0x66, 0x45, 0x02, 0xD0,
-    0xB5, 0x42, 0x91, 0xD0, 0xB4, 0x46, 0x02, 0x9B, 0x01, 0x31, 0x8B, 0x42, 0xF3, 0xD1, 0x29, 0x00,
-    0x01, 0x30, 0x02, 0x34, 0x87, 0x42, 0xE7, 0xD1, 0x08, 0x9B, 0x53, 0x4C, 0x19, 0x01, 0x01, 0x9B,
-    0x0B, 0x51, 0x03, 0x9B, 0x64, 0x18, 0x23, 0x71, 0x03, 0x23, 0x5A, 0x43, 0x00, 0x20, 0xD3, 0x17,
-    0xA2, 0x60, 0x01, 0x21, 0x0A, 0xF0, 0x98, 0xFC, 0x08, 0x9B, 0x4C, 0x4A, 0x01, 0x30, 0xE0, 0x60,
-    0x58, 0x01, 0x80, 0x18, 0x46, 0x49, 0x20, 0x22, 0x0A, 0xF0, 0xE8, 0xFC, 0x01, 0x20, 0x0B, 0xB0,
-    0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x01, 0x9B, 0x1A, 0x19, 0x84, 0xE7, 0x03, 0x26, 0x0F, 0x23,
-    0x11, 0x78, 0x3D, 0x48, 0x40, 0x5C, 0x01, 0x09, 0x0E, 0x40, 0x09, 0x96, 0x86, 0x09, 0x18, 0x40,
-    0x06, 0x28, 0x00, 0xD9, 0x58, 0xE7, 0x09, 0xF0, 0xB1, 0xFE, 0x0B, 0x00, 0x0F, 0x00, 0x0B, 0x00,
-    0x21, 0x00, 0x51, 0x00, 0x57, 0xFF, 0x07, 0x00, 0x06, 0x9B, 0x00, 0x2B, 0x00, 0xD1, 0x4B, 0xE7,
-    0x02, 0x34, 0x09, 0x9B, 0xD2, 0x18, 0x85, 0xE7, 0x51, 0x78, 0x03, 0x34, 0x01, 0x2E, 0x20, 0xD8,
-    0x10, 0x2F, 0x00, 0xD1, 0x40, 0xE7, 0x7D, 0x00, 0x78, 0x1C, 0x31, 0x4F, 0x79, 0x53, 0x07, 0x00,
-    0x00, 0x25, 0x01, 0x2E, 0xED, 0xD1, 0x01, 0x23, 0x06, 0x93, 0xEA, 0xE7, 0x91, 0x78, 0x50, 0x78,
-    0x09, 0x02, 0x09, 0x18, 0x04, 0x34, 0x01, 0x2E, 0xEA, 0xD9, 0x2A, 0x4B, 0xC8, 0x18, 0x80, 0x23,
-    0xDB, 0x01, 0x98, 0x42, 0x00, 0xD2, 0x27, 0xE7, 0x80, 0x20, 0x00, 0x02, 0x81, 0x42, 0x00, 0xDB,
-    0x22, 0xE7, 0x02, 0x9B, 0x10, 0x2B, 0x00, 0xD1, 0x1E, 0xE7, 0x01, 0x33, 0x07, 0x93, 0x02, 0x9B,
-    0x5B, 0x00, 0x18, 0x00, 0x09, 0x04, 0x1B, 0x4B, 0x09, 0x0C, 0x19, 0x52, 0x03, 0x2E, 0x27, 0xD1,
-    0x03, 0x9B, 0x02, 0x34, 0x10, 0x2B, 0x00, 0xD1, 0x0E, 0xE7, 0x5D, 0x00, 0x01, 0x33, 0x14, 0x4E,
-    0x03, 0x93, 0x07, 0x9B, 0x71, 0x53, 0x02, 0x93, 0x01, 0x25, 0xBA, 0xE7, 0x02, 0x34, 0x00, 0x2D,
-    0x00, 0xD0, 0x01, 0xE7, 0x01, 0x21, 0x51, 0x56, 0x8E, 0x1C, 0x0B, 0x4B, 0x90, 0x19, 0x96, 0x5D,
-    0x9E, 0x5D, 0x0F, 0x23, 0x1E, 0x40, 0x05, 0x2E, 0x07, 0xD1, 0x86, 0x78, 0x40, 0x78, 0x36, 0x02,
-    0x05, 0x9B, 0x36, 0x18, 0xB3, 0x42, 0x00, 0xD1, 0xEE, 0xE6, 0x00, 0x29, 0xA1, 0xDA, 0xEB, 0xE6,
-    0x07, 0x9B, 0x02, 0x93, 0x9D, 0xE7, 0xC0, 0x46, 0x3C, 0xDE, 0x00, 0x08, 0xF8, 0x6D, 0x00, 0x03,
-    0x20, 0xFB, 0x03, 0x02, 0x60, 0xFB, 0x03, 0x02, 0x60, 0xFA, 0x03, 0x02, 0xA0, 0xFA, 0x03, 0x02,
-    0x40, 0xFB, 0x03, 0x02, 0x00, 0xE0, 0xFF, 0xFF, 0xF7, 0xB5, 0x8B, 0x1F, 0x01, 0x90, 0x03, 0x2B,
-    0x33, 0xD8, 0x1B, 0x4B, 0x01, 0x27, 0x00, 0x20, 0x9C, 0x46, 0x7F, 0x42, 0x63, 0x46, 0xC3, 0x5C,
-    0x99, 0x42, 0x12, 0xD1, 0x17, 0x4A, 0x83, 0x00, 0x9B, 0x58, 0x3D, 0x00, 0x00, 0x93, 0x3C, 0x00,
-    0x00, 0x23, 0x00, 0x9E, 0x01, 0x9A, 0xF6, 0x5C, 0xD2, 0x5C, 0x02, 0x2E, 0x0A, 0xD1, 0x66, 0x1C,
-    0x19, 0xD0, 0xA2, 0x42, 0x0B, 0xD0, 0x99, 0x42, 0x0C, 0xD0, 0x01, 0x30, 0x09, 0x28, 0xE5, 0xD1,
-    0x0A, 0x38, 0x07, 0xE0, 0x22, 0x2E, 0x0B, 0xD1, 0x6E, 0x1C, 0x06, 0xD1, 0x15, 0x00, 0x01, 0x33,
-    0x99, 0x42, 0xE6, 0xD1, 0xFE, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xAA, 0x42, 0xF7, 0xD0, 0xEA, 0xE7,
-    0xB2, 0x42, 0xF4, 0xD0, 0xE7, 0xE7, 0x14, 0x00, 0xF1, 0xE7, 0x01, 0x20, 0x40, 0x42, 0xF1, 0xE7,
-    0xF0, 0xDD, 0x00, 0x08, 0xFC, 0xDD, 0x00, 0x08, 0xF8, 0xB5, 0x0F, 0x00, 0x14, 0x00, 0x4C, 0x21,
-    0x16, 0x22, 0x0A, 0xF0, 0x25, 0xF9, 0x06, 0x00, 0x03, 0x1E, 0x21, 0xD0, 0x85, 0x78, 0x43, 0x78,
-    0x2D, 0x02, 0xED, 0x18, 0xC2, 0x1B, 0x52, 0x1B, 0x78, 0x19, 0x13, 0x2A, 0x21, 0xD1, 0x1E, 0x49,
-    0x30, 0x31, 0x0A, 0xF0, 0x51, 0xF9, 0x00, 0x23, 0x98, 0x42, 0x11, 0xD1, 0x1B, 0x4A, 0x24, 0x01,
-    0xA6, 0x50, 0x14, 0x19, 0x23, 0x71, 0xAB, 0x1D, 0x13, 0x35, 0x5D, 0x40, 0xFF, 0x23, 0x1B, 0x02,
-    0x1D, 0x42, 0x09, 0xD1, 0x12, 0x23, 0xFF, 0x33, 0xA3, 0x60, 0x15, 0x4B, 0xE3, 0x60, 0x01, 0x23,
-    0x18, 0x00, 0xF8, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x1E, 0x23, 0xFF, 0x33, 0xA3, 0x60, 0x11, 0x4B,
-    0xF4, 0xE7, 0x11, 0x00, 0xFF, 0xF7, 0x88, 0xFF, 0x00, 0x23, 0x98, 0x42, 0xF0, 0xDB, 0x03, 0x00,
-    0x0A, 0x4A, 0x24, 0x01, 0xA6, 0x50, 0x14, 0x19, 0x03, 0x22, 0x80, 0x3B, 0x23, 0x71, 0x06, 0x4B,
-    0x43, 0x33, 0x1B, 0x5C, 0x5A, 0x43, 0x00, 0x20, 0x01, 0x21, 0xA2, 0x60, 0xD3, 0x17, 0x0A, 0xF0,
-    0x6B, 0xFB, 0x01, 0x30, 0xE0, 0x60, 0xDA, 0xE7, 0xF0, 0xDD, 0x00, 0x08, 0x60, 0xFA, 0x03, 0x02,
-    0x01, 0x0F, 0xF0, 0x00, 0x6D, 0xF3, 0xE5, 0x00, 0xF7, 0xB5, 0x00, 0x24, 0x06, 0x00, 0x0F, 0x00,
-    0x15, 0x00, 0xA2, 0x42, 0x03, 0xD1, 0x18, 0x4B, 0x1C, 0x78, 0x64, 0x06, 0xE4, 0x0F, 0x2B, 0x01,
-    0x01, 0x93, 0x16, 0x4B, 0x2A, 0x01, 0x9A, 0x18, 0x93, 0x79, 0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E,
-    0x08, 0x2B, 0x0B, 0xD0, 0x93, 0x71, 0x11, 0x4B, 0x22, 0x01, 0xD3, 0x58, 0x00, 0x2B, 0x02, 0xD0,
-    0x20, 0x00, 0x0A, 0xF0, 0x2F, 0xFB, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x00, 0x23, 0x39, 0x00,
-    0x93, 0x71, 0x30, 0x00, 0x2A, 0x00, 0xFF, 0xF7, 0xFD, 0xFD, 0x00, 0x28, 0xEB, 0xD1, 0x07, 0x4B,
-    0x2A, 0x01, 0xD0, 0x50, 0x20, 0x00, 0x0A, 0xF0, 0x1D, 0xFB, 0x2A, 0x00, 0x39, 0x00, 0x30, 0x00,
-    0xFF, 0xF7, 0x72, 0xFF, 0xDF, 0xE7, 0xC0, 0x46, 0xC4, 0x59, 0x00, 0x03, 0x60, 0xFA, 0x03, 0x02,
-    0x03, 0x00, 0x01, 0x30, 0xFF, 0x30, 0x2A, 0x2B, 0x08, 0xDC, 0x20, 0x2B, 0x00, 0xDA, 0x20, 0x23,
-    0x03, 0x48, 0xC3, 0x18, 0x20, 0x3B, 0x18, 0x78, 0x01, 0x30, 0xFF, 0x30, 0x70, 0x47, 0xC0, 0x46,
-    0x7D, 0xDF, 0x00, 0x08, 0xF7, 0xB5, 0x05, 0x00, 0x1D, 0x28, 0x29, 0xDC, 0x7F, 0x27, 0x16, 0x4A,
-    0x43, 0x00, 0x9E, 0x18, 0x15, 0x4A, 0x16, 0x48, 0x9B, 0x18, 0x01, 0x93, 0x2D, 0x18, 0x2C, 0x78,
-    0x20, 0x00, 0x33, 0x88, 0x38, 0x40, 0x00, 0x93, 0xFF, 0xF7, 0xDA, 0xFF, 0x80, 0x23, 0xE4, 0x09,
-    0xDB, 0x01, 0x24, 0x03, 0xC0, 0x18, 0x00, 0x9A, 0x24, 0x18, 0x24, 0x04, 0x24, 0x0C, 0x3A, 0x40,
-    0x2A, 0x2A, 0x00, 0xD1, 0x0A, 0x3A, 0x80, 0x21, 0x00, 0x9B, 0x49, 0x01, 0x0B, 0x40, 0x5B, 0x11,
-    0x9B, 0x18, 0x2B, 0x70, 0x01, 0x9B, 0x34, 0x80, 0x40, 0x36, 0x1E, 0x35, 0xB3, 0x42, 0xDE, 0xD1,
-    0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x00, 0x20, 0x00, 0x06, 0x40, 0x25, 0x00, 0x06,
-    0xE8, 0xF7, 0x03, 0x02, 0xF7, 0xB5, 0x19, 0x4E, 0x33, 0x68, 0xDC, 0x08, 0x3F, 0x23, 0x72, 0x68,
-    0xD7, 0x08, 0x1C, 0x40, 0x1F, 0x40, 0xBC, 0x42, 0x16, 0xD0, 0x3A, 0x1B, 0x1A, 0x40, 0x20, 0x2A,
-    0x0B, 0xDC, 0x1F, 0x25, 0x01, 0x93, 0x20, 0x00, 0x28, 0x40, 0xFF, 0xF7, 0xB3, 0xFF, 0x01, 0x9B,
-    0x01, 0x34, 0x1C, 0x40, 0xA7, 0x42, 0xF6, 0xD1, 0x06, 0xE0, 0x1D, 0x00, 0x01, 0x3C, 0x01, 0x3F,
-    0x1C, 0x40, 0x1F, 0x40, 0xBC, 0x42, 0x09, 0xD1, 0x73, 0x68, 0x09, 0x4A, 0x33, 0x60, 0x13, 0x80,
-    0xB2, 0x68, 0x08, 0x4B, 0x1A, 0x80, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x1F, 0x20, 0x20, 0x40,
-    0x01, 0x3C, 0xFF, 0xF7, 0x97, 0xFF, 0x2C, 0x40, 0xEC, 0xE7, 0xC0, 0x46, 0x7C, 0x00, 0x00, 0x02,
-    0x18, 0x00, 0x00, 0x04, 0x1A, 0x00, 0x00, 0x04, 0x10, 0xB5, 0x03, 0x49, 0x03, 0x48, 0x09, 0xF0,
-    0xC7, 0xFC, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x40, 0x25, 0x00, 0x06, 0x68, 0xD6, 0x00, 0x08,
-    0x10, 0xB5, 0x40, 0x22, 0x03, 0x49, 0x04, 0x48, 0x0A, 0xF0, 0xE8, 0xFA, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x24, 0xDD, 0x00, 0x08, 0x80, 0x00, 0x00, 0x05, 0x02, 0x4B, 0x1B, 0x88,
-    0xDB, 0x43, 0x02, 0x4A, 0xD3, 0x60, 0x70, 0x47, 0x30, 0x01, 0x00, 0x04, 0x7C, 0x00, 0x00, 0x02,
-    0xF7, 0xB5, 0x1C, 0x4F, 0x06, 0x00, 0x3C, 0x69, 0x0A, 0xF0, 0x10, 0xFA, 0x1A, 0x4B, 0x1D, 0x88,
-    0xEB, 0x43, 0x01, 0x93, 0xFB, 0x68, 0x1D, 0x43, 0x01, 0x9B, 0xED, 0x43, 0xFB, 0x60, 0x00, 0x2E,
-    0x23, 0xD0, 0x6B, 0x06, 0x05, 0xD5, 0xA0, 0x19, 0x31, 0x00, 0x01, 0x38, 0x0A, 0xF0, 0x58, 0xFA,
-    0x0C, 0x00, 0x2B, 0x06, 0x04, 0xD5, 0x60, 0x1C, 0x31, 0x00, 0x0A, 0xF0, 0x51, 0xFA, 0x0C, 0x00,
-    0xEB, 0x06, 0x03, 0xD5, 0x0A, 0x34, 0xA6, 0x42, 0x00, 0xDC, 0x74, 0x1E, 0xAB, 0x06, 0x03, 0xD5,
-    0x0A, 0x3C, 0xE3, 0x43, 0xDB, 0x17, 0x1C, 0x40, 0xC0, 0x22, 0x01, 0x9B, 0x92, 0x00, 0x13, 0x40,
-    0x93, 0x42, 0x01, 0xD0, 0x05, 0x4B, 0x1D, 0x40, 0x3C, 0x61, 0x28, 0x00, 0xFE, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0xC0, 0x46, 0x7C, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04, 0xFF, 0xFC, 0xFF, 0xFF,
-    0x10, 0xB5, 0x03, 0x07, 0x0A, 0xD4, 0x15, 0x4B, 0xC2, 0x07, 0x02, 0xD5, 0x5A, 0x68, 0xFF, 0x2A,
-    0x04, 0xD9, 0x82, 0x07, 0x08, 0xD5, 0x5B, 0x68, 0xFF, 0x2B, 0x05, 0xD9, 0x10, 0x4B, 0x11, 0x49,
-    0x11, 0x4A, 0x02, 0xC3, 0x93, 0x42, 0xFC, 0xD1, 0x0C, 0x4C, 0x43, 0x07, 0x09, 0xD4, 0xC3, 0x07,
-    0x02, 0xD5, 0x63, 0x68, 0xFF, 0x2B, 0x04, 0xD8, 0x83, 0x07, 0x07, 0xD5, 0x63, 0x68, 0xFF, 0x2B,
-    0x04, 0xD8, 0x0A, 0x4A, 0x0A, 0x49, 0x0B, 0x48, 0x0A, 0xF0, 0xB8, 0xF9, 0x00, 0x23, 0xA3, 0x60,
-    0xFF, 0xF7, 0x38, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x7C, 0x00, 0x00, 0x02,
-    0x00, 0x20, 0x00, 0x06, 0x2A, 0x41, 0x2A, 0x41, 0x40, 0x25, 0x00, 0x06, 0x76, 0x02, 0x00, 0x00,
-    0x20, 0x20, 0x20, 0x20, 0xE8, 0xF7, 0x03, 0x02, 0xF8, 0xB5, 0x1F, 0x24, 0x2A, 0x4B, 0x0E, 0x00,
-    0x5B, 0x68, 0xA0, 0x42, 0x19, 0xDD, 0xFF, 0x2B, 0x19, 0xD8, 0x1E, 0x21, 0x20, 0x40, 0x20, 0x25,
-    0x0B, 0x00, 0x43, 0x43, 0x00, 0x2A, 0x01, 0xD0, 0xAA, 0x25, 0x80, 0x22, 0x48, 0x43, 0x00, 0x21,
-    0x22, 0x4C, 0x01, 0x33, 0x05, 0x55, 0x1B, 0x19, 0x70, 0x5C, 0x1F, 0x28, 0x35, 0xD8, 0x20, 0x22,
-    0x1D, 0x29, 0x2F, 0xD0, 0x1A, 0x70, 0x01, 0x31, 0xFA, 0xE7, 0xFF, 0x2B, 0xE5, 0xD8, 0x1C, 0x4B,
-    0x04, 0x40, 0xA4, 0x01, 0xE4, 0x18, 0x80, 0x23, 0x17, 0x07, 0xDB, 0x05, 0xFF, 0x18, 0x3F, 0x0C,
-    0x00, 0x2A, 0x07, 0xDB, 0x08, 0xD0, 0x3B, 0x00, 0x80, 0x33, 0xFF, 0x33, 0x1B, 0x04, 0x1B, 0x0C,
-    0x23, 0x80, 0x02, 0x34, 0x00, 0x25, 0x08, 0xE0, 0x95, 0x23, 0x5B, 0x00, 0xF8, 0xE7, 0xFF, 0xF7,
-    0x9F, 0xFE, 0x6B, 0x00, 0x38, 0x18, 0xE0, 0x52, 0x01, 0x35, 0x70, 0x5D, 0x1F, 0x28, 0x07, 0xD8,
-    0x95, 0x23, 0x5B, 0x00, 0x1D, 0x2D, 0x05, 0xD0, 0x6A, 0x00, 0xA3, 0x52, 0x01, 0x35, 0xF9, 0xE7,
-    0x1D, 0x2D, 0xEC, 0xD1, 0xF8, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x1D, 0x29, 0xFA, 0xD0, 0x80, 0x18,
-    0x18, 0x70, 0x01, 0x31, 0x01, 0x33, 0xBF, 0xE7, 0x7C, 0x00, 0x00, 0x02, 0xE8, 0xF7, 0x03, 0x02,
-    0x00, 0x20, 0x00, 0x06, 0xF2, 0x22, 0x07, 0x4B, 0xFF, 0x32, 0x1A, 0x80, 0x00, 0x04, 0x06, 0x4B,
-    0x00, 0x0C, 0x18, 0x80, 0x10, 0x23, 0x18, 0x1A, 0x00, 0x06, 0xD8, 0x40, 0x03, 0x4B, 0x18, 0x80,
-    0x70, 0x47, 0xC0, 0x46, 0x50, 0x00, 0x00, 0x04, 0x54, 0x00, 0x00, 0x04, 0x52, 0x00, 0x00, 0x04,
-    0x10, 0xB5, 0x00, 0x20, 0xFF, 0xF7, 0xE6, 0xFF, 0x80, 0x23, 0x87, 0x21, 0xDB, 0x04, 0x1A, 0x88,
-    0x8A, 0x43, 0x80, 0x21, 0x1A, 0x80, 0x1A, 0x88, 0xC9, 0x00, 0x0A, 0x43, 0x1A, 0x80, 0x02, 0x4B,
-    0x19, 0x80, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0C, 0x00, 0x00, 0x04, 0xBF, 0x22, 0x03, 0x4B,
-    0x00, 0x04, 0x1A, 0x80, 0x02, 0x4B, 0x00, 0x0C, 0x18, 0x80, 0x70, 0x47, 0x50, 0x00, 0x00, 0x04,
-    0x54, 0x00, 0x00, 0x04, 0x70, 0xB5, 0xFF, 0xF7, 0xE1, 0xFE, 0x0B, 0x25, 0x01, 0x20, 0xFF, 0xF7,
-    0xE7, 0xFE, 0x04, 0x00, 0x0A, 0xF0, 0xFA, 0xF8, 0x2C, 0x42, 0xF7, 0xD0, 0x70, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x09, 0x4A, 0x94, 0x46, 0x09, 0x4B, 0x1B, 0x68, 0x82, 0xB0, 0x42, 0x1C,
-    0x01, 0x93, 0xFF, 0x32, 0x63, 0x44, 0x01, 0x68, 0x99, 0x42, 0x02, 0xD1, 0x30, 0x38, 0x02, 0xB0,
-    0x70, 0x47, 0x04, 0x30, 0x90, 0x42, 0xF6, 0xD1, 0x00, 0x20, 0xF8, 0xE7, 0x00, 0x00, 0x53, 0x1A,
-    0xE4, 0xDD, 0x00, 0x08, 0x0B, 0x4B, 0x70, 0xB5, 0x04, 0x00, 0x18, 0x68, 0xFF, 0xF7, 0xE2, 0xFF,
-    0x09, 0x4B, 0x1D, 0x78, 0x00, 0x28, 0x03, 0xD0, 0x00, 0x2D, 0x01, 0xD1, 0x00, 0x2C, 0x02, 0xD1,
-    0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x03, 0x6A, 0x30, 0x33, 0xC0, 0x18, 0xFF, 0xF7, 0xD2, 0xFF,
-    0x01, 0x3C, 0xEF, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x02, 0xF0, 0xB5, 0x85, 0xB0,
-    0x03, 0x90, 0x0A, 0xF0, 0xBB, 0xF8, 0x32, 0x4D, 0x2C, 0x68, 0x14, 0x2C, 0x30, 0xDD, 0x25, 0x00,
-    0x03, 0x98, 0x14, 0x3D, 0x68, 0x43, 0x61, 0x1E, 0xC0, 0x00, 0x0A, 0xF0, 0x21, 0xF9, 0x07, 0x23,
-    0xC4, 0x17, 0x1C, 0x40, 0x24, 0x18, 0x15, 0x27, 0xE4, 0x10, 0xA5, 0x42, 0x00, 0xDC, 0x01, 0x3F,
-    0x28, 0x4B, 0x18, 0x40, 0x04, 0xD5, 0x08, 0x23, 0x01, 0x38, 0x5B, 0x42, 0x18, 0x43, 0x01, 0x30,
-    0x25, 0x4B, 0x18, 0x60, 0xFF, 0xF7, 0x26, 0xFE, 0x00, 0x23, 0x01, 0x93, 0x20, 0x00, 0xFF, 0xF7,
-    0xB9, 0xFF, 0x00, 0x23, 0x05, 0x00, 0x1E, 0x00, 0x00, 0x93, 0xBE, 0x42, 0x18, 0xDB, 0x03, 0x23,
-    0x00, 0x98, 0x98, 0x43, 0x01, 0x3B, 0x18, 0x43, 0x05, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x14, 0x23, 0x1B, 0x1B, 0xE2, 0x07, 0x06, 0xD5, 0x04, 0x22, 0x17, 0x4B, 0x1A, 0x60, 0xFF, 0xF7,
-    0x09, 0xFE, 0x15, 0x23, 0x1B, 0x1B, 0x5B, 0x10, 0x00, 0x24, 0x01, 0x93, 0x2F, 0x68, 0xDD, 0xE7,
-    0x03, 0x9B, 0x1B, 0x1B, 0x02, 0x93, 0x0E, 0x4B, 0x1B, 0x68, 0x01, 0x2B, 0x08, 0xDD, 0x02, 0x9B,
-    0xF2, 0x1A, 0x53, 0x42, 0x5A, 0x41, 0x01, 0x9B, 0x29, 0x00, 0xF0, 0x18, 0xFF, 0xF7, 0xCC, 0xFE,
-    0x02, 0x9B, 0x9E, 0x42, 0x04, 0xD1, 0xAB, 0x6A, 0x18, 0x04, 0x6B, 0x6A, 0x03, 0x43, 0x00, 0x93,
-    0x28, 0x6A, 0x30, 0x30, 0x28, 0x18, 0xFF, 0xF7, 0x65, 0xFF, 0x01, 0x36, 0x05, 0x00, 0xC4, 0xE7,
-    0x90, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x02, 0xF7, 0xB5, 0x03, 0x20,
-    0xFF, 0xF7, 0x76, 0xFE, 0x80, 0x22, 0x36, 0x4B, 0xD2, 0x00, 0x1A, 0x80, 0x10, 0x20, 0xFF, 0xF7,
-    0x09, 0xFF, 0x01, 0x20, 0x01, 0xF0, 0x7C, 0xFA, 0x32, 0x4B, 0x18, 0x68, 0x80, 0x23, 0x00, 0x02,
-    0x9B, 0x05, 0x00, 0x0A, 0xC0, 0x18, 0x0A, 0xF0, 0xD3, 0xF8, 0x2F, 0x4B, 0x1B, 0x78, 0x2F, 0x4C,
-    0x2F, 0x4D, 0x30, 0x4E, 0x00, 0x2B, 0x02, 0xD1, 0x22, 0x68, 0x01, 0x2A, 0x19, 0xDC, 0xC1, 0x23,
-    0x29, 0x68, 0x9B, 0x00, 0x01, 0x22, 0x00, 0x20, 0x19, 0x40, 0xFE, 0xF7, 0x23, 0xFB, 0x80, 0x23,
-    0x00, 0x25, 0x5B, 0x00, 0x33, 0x60, 0x28, 0x4B, 0x1D, 0x60, 0xFF, 0xF7, 0xAB, 0xFD, 0x28, 0x00,
-    0xFF, 0xF7, 0xE0, 0xFE, 0x01, 0x20, 0x65, 0x60, 0x0A, 0xF0, 0xC2, 0xF8, 0xF7, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0x80, 0x22, 0x52, 0x00, 0x32, 0x60, 0x63, 0x60, 0xFF, 0xF7, 0x9B, 0xFD, 0xA7, 0x68,
-    0x38, 0x00, 0xFF, 0xF7, 0x4B, 0xFF, 0x01, 0x90, 0xE0, 0x60, 0x08, 0x20, 0xFF, 0xF7, 0xCA, 0xFE,
-    0xC0, 0x23, 0x01, 0x22, 0x29, 0x68, 0x9B, 0x00, 0x19, 0x40, 0x01, 0x9B, 0x38, 0x00, 0x19, 0x43,
-    0x62, 0x60, 0xFE, 0xF7, 0xF7, 0xFA, 0xC0, 0x23, 0x9B, 0x00, 0x01, 0x93, 0x13, 0x4F, 0xA0, 0x68,
-    0x3B, 0x68, 0x83, 0x42, 0x0F, 0xD0, 0x01, 0x9A, 0x29, 0x68, 0xE3, 0x68, 0x11, 0x40, 0x19, 0x43,
-    0x01, 0x22, 0xFE, 0xF7, 0xE7, 0xFA, 0x63, 0x68, 0x05, 0x2B, 0xEF, 0xD1, 0xA2, 0x68, 0x3B, 0x68,
-    0x9A, 0x42, 0xEB, 0xD1, 0xBB, 0xE7, 0x00, 0x20, 0x0A, 0xF0, 0x8A, 0xF8, 0xF3, 0xE7, 0xC0, 0x46,
-    0x0C, 0x00, 0x00, 0x04, 0x24, 0x74, 0x00, 0x03, 0x44, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x02,
-    0x48, 0x73, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x44, 0x73, 0x00, 0x03,
-    0x11, 0x4B, 0x1A, 0x68, 0x11, 0x00, 0x11, 0x4B, 0x18, 0x68, 0x81, 0x43, 0xF0, 0x20, 0x1A, 0x60,
-    0x10, 0x40, 0x0F, 0x4A, 0x13, 0x68, 0x83, 0x42, 0x11, 0xD1, 0x53, 0x68, 0x01, 0x33, 0x53, 0x60,
-    0x18, 0x2B, 0x0F, 0xDD, 0x03, 0x22, 0x13, 0x40, 0x5A, 0x42, 0x53, 0x41, 0x5B, 0x42, 0x18, 0x40,
-    0x00, 0x22, 0x08, 0x4B, 0x1A, 0x60, 0x0B, 0x23, 0x0B, 0x40, 0x18, 0x43, 0x70, 0x47, 0x00, 0x23,
-    0x09, 0xC2, 0xF5, 0xE7, 0x00, 0x20, 0xF3, 0xE7, 0x70, 0x72, 0x00, 0x03, 0x78, 0x00, 0x00, 0x02,
-    0x84, 0x76, 0x00, 0x03, 0x74, 0x72, 0x00, 0x03, 0xF8, 0xB5, 0x3E, 0x4C, 0xA7, 0x68, 0x63, 0x68,
-    0x26, 0x68, 0x01, 0x2B, 0x0C, 0xD1, 0x00, 0x22, 0x3B, 0x4B, 0x3C, 0x4D, 0x1A, 0x60, 0x2B, 0x68,
-    0x93, 0x42, 0x53, 0xD1, 0x00, 0x23, 0x2B, 0x60, 0xFF, 0xF7, 0x1C, 0xFD, 0x02, 0x23, 0x63, 0x60,
-    0x63, 0x68, 0x02, 0x2B, 0x2B, 0xD1, 0x36, 0x4B, 0x1B, 0x88, 0xDB, 0x43, 0x35, 0x4A, 0x13, 0x60,
-    0xFF, 0xF7, 0xB6, 0xFF, 0x05, 0x00, 0x38, 0x00, 0xEB, 0x06, 0x03, 0xD5, 0x0A, 0x30, 0x86, 0x42,
-    0x00, 0xDC, 0x70, 0x1E, 0xAB, 0x06, 0x03, 0xD5, 0x0A, 0x38, 0xC3, 0x43, 0xDB, 0x17, 0x18, 0x40,
-    0x6B, 0x06, 0x01, 0xD5, 0x80, 0x19, 0x01, 0x38, 0x2B, 0x06, 0xDB, 0x0F, 0x31, 0x00, 0xC0, 0x18,
-    0x09, 0xF0, 0xC6, 0xFF, 0x0E, 0x00, 0x8F, 0x42, 0x04, 0xD0, 0x08, 0x00, 0xFF, 0xF7, 0xA6, 0xFE,
-    0xE0, 0x60, 0xA6, 0x60, 0x0B, 0x23, 0x1D, 0x42, 0x01, 0xD0, 0x08, 0x3B, 0x63, 0x60, 0x63, 0x68,
-    0x03, 0x2B, 0x02, 0xD0, 0x63, 0x68, 0x04, 0x2B, 0x30, 0xD1, 0x1D, 0x4B, 0x1A, 0x88, 0x0B, 0x23,
-    0x93, 0x43, 0x01, 0xD1, 0x04, 0x33, 0x63, 0x60, 0x18, 0x4D, 0x28, 0x68, 0xFF, 0x28, 0x16, 0xD9,
-    0x00, 0x20, 0xFF, 0xF7, 0x0F, 0xFE, 0x80, 0x23, 0x5B, 0x00, 0x2B, 0x60, 0xFF, 0xF7, 0xD2, 0xFC,
-    0x63, 0x68, 0x04, 0x2B, 0x1A, 0xD1, 0x05, 0x23, 0x63, 0x60, 0x17, 0xE0, 0x20, 0x3B, 0x2B, 0x60,
-    0xFF, 0xF7, 0xC8, 0xFC, 0x2B, 0x68, 0x01, 0x3B, 0xFF, 0x2B, 0xA9, 0xD9, 0xA2, 0xE7, 0x07, 0x23,
-    0x20, 0x30, 0x28, 0x60, 0x40, 0x09, 0x18, 0x1A, 0x43, 0x1C, 0x00, 0xD1, 0x00, 0x20, 0xFF, 0xF7,
-    0xF1, 0xFD, 0xFF, 0xF7, 0xB7, 0xFC, 0x2B, 0x68, 0xFF, 0x2B, 0xD9, 0xD8, 0xF8, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x90, 0x00, 0x00, 0x02, 0x74, 0x72, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02,
-    0x30, 0x01, 0x00, 0x04, 0x70, 0x72, 0x00, 0x03, 0x01, 0x20, 0x40, 0x42, 0x70, 0x47, 0x01, 0x20,
-    0x0B, 0x68, 0x9A, 0x18, 0x40, 0x42, 0x0A, 0x60, 0x70, 0x47, 0x70, 0xB5, 0x05, 0x00, 0x14, 0x00,
-    0x00, 0x68, 0x03, 0x60, 0x42, 0x60, 0x08, 0x30, 0x28, 0x60, 0x09, 0xF0, 0x43, 0xFD, 0x2B, 0x68,
-    0x1B, 0x19, 0x20, 0x00, 0x2B, 0x60, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x06, 0x4C,
-    0x24, 0x78, 0x00, 0x2C, 0x04, 0xD0, 0xFF, 0xF7, 0xE8, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x01, 0x20, 0x40, 0x42, 0xF9, 0xE7, 0xC0, 0x46, 0x6A, 0x73, 0x00, 0x03, 0x10, 0xB5, 0x06, 0x4C,
-    0x24, 0x78, 0x00, 0x2C, 0x04, 0xD0, 0xFF, 0xF7, 0xD8, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x01, 0x20, 0x40, 0x42, 0xF9, 0xE7, 0xC0, 0x46, 0xB6, 0x72, 0x00, 0x03, 0x10, 0xB5, 0x09, 0x68,
-    0xFF, 0xF7, 0xCB, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x0C, 0x4B, 0x1A, 0x78,
-    0x0C, 0x4B, 0x0D, 0x49, 0x1A, 0x70, 0x0D, 0x4A, 0x0B, 0x68, 0x10, 0x68, 0x1B, 0x1A, 0x0B, 0x60,
-    0x0B, 0x49, 0x0C, 0x4B, 0x08, 0x68, 0xC3, 0x1A, 0x0B, 0x60, 0x00, 0x23, 0x13, 0x60, 0x0A, 0x4B,
-    0x1A, 0x68, 0x0A, 0x4B, 0x1A, 0x60, 0x09, 0xF0, 0xA9, 0xFE, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0xC4, 0x59, 0x00, 0x03, 0x92, 0x72, 0x00, 0x03, 0x54, 0x72, 0x00, 0x03, 0x64, 0x72, 0x00, 0x03,
-    0x58, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x6D, 0x00, 0x03, 0x78, 0x72, 0x00, 0x03,
-    0x70, 0xB5, 0x25, 0x4C, 0x25, 0x68, 0xFC, 0xF7, 0x85, 0xFE, 0x23, 0x68, 0x1B, 0x04, 0x23, 0x4A,
-    0x5B, 0x0F, 0x9B, 0x00, 0x9B, 0x58, 0x22, 0x49, 0x0B, 0x60, 0x22, 0x49, 0x5D, 0x19, 0x08, 0x68,
-    0x21, 0x4B, 0xC3, 0x18, 0x0B, 0x60, 0x21, 0x4B, 0x5A, 0x60, 0x21, 0x4B, 0x1A, 0x78, 0x21, 0x4B,
-    0x1A, 0x70, 0x21, 0x4B, 0x21, 0x49, 0x1A, 0x68, 0x21, 0x4B, 0x1A, 0x60, 0x0A, 0x68, 0x21, 0x4B,
-    0xD2, 0x18, 0x0A, 0x60, 0x20, 0x4A, 0x11, 0x68, 0xCB, 0x18, 0x13, 0x60, 0x25, 0x60, 0x09, 0xF0,
-    0x3D, 0xFF, 0x1E, 0x4B, 0x1A, 0x68, 0x53, 0x04, 0x08, 0xD4, 0x1D, 0x49, 0x08, 0x68, 0xFF, 0x28,
-    0x04, 0xDC, 0x1C, 0x4B, 0x1B, 0x68, 0x1B, 0x02, 0x1B, 0x18, 0x0B, 0x60, 0x1A, 0x4B, 0x1B, 0x78,
-    0x04, 0x2B, 0x05, 0xD1, 0x19, 0x4B, 0xD9, 0x78, 0x00, 0x29, 0x01, 0xD1, 0x0C, 0x31, 0xD9, 0x70,
-    0x93, 0x04, 0x05, 0xD4, 0x80, 0x22, 0x16, 0x4B, 0x1A, 0x70, 0x16, 0x4B, 0x71, 0x3A, 0x1A, 0x70,
-    0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x54, 0x72, 0x00, 0x03, 0xF8, 0x6D, 0x00, 0x03,
-    0x64, 0x72, 0x00, 0x03, 0x58, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x3C, 0x72, 0x00, 0x03,
-    0x92, 0x72, 0x00, 0x03, 0xC4, 0x59, 0x00, 0x03, 0x78, 0x72, 0x00, 0x03, 0xC8, 0x73, 0x00, 0x03,
-    0xD0, 0x6D, 0x00, 0x03, 0x80, 0x02, 0x00, 0x05, 0xCC, 0x73, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x02,
-    0x50, 0x72, 0x00, 0x03, 0x48, 0x75, 0x00, 0x03, 0x67, 0x73, 0x00, 0x03, 0xDC, 0x72, 0x00, 0x03,
-    0x94, 0x73, 0x00, 0x03, 0x9C, 0x73, 0x00, 0x03, 0x70, 0xB5, 0x0D, 0x00, 0x14, 0x00, 0x1E, 0x00,
-    0x09, 0x68, 0x9A, 0x42, 0x08, 0xDC, 0x09, 0xF0, 0x6D, 0xFC, 0x2B, 0x68, 0x1B, 0x19, 0x2B, 0x60,
-    0x20, 0x00, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x1A, 0x00, 0x09, 0xF0, 0x63, 0xFC, 0x2B, 0x68,
-    0x1C, 0x19, 0x2C, 0x60, 0x34, 0x00, 0xF3, 0xE7, 0x10, 0xB5, 0x07, 0x4C, 0x24, 0x78, 0x00, 0x2C,
-    0x07, 0xD1, 0x01, 0x20, 0x0B, 0x68, 0x9A, 0x18, 0x0A, 0x60, 0x40, 0x42, 0x10, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0xFF, 0xF7, 0xD9, 0xFF, 0xF9, 0xE7, 0x6A, 0x73, 0x00, 0x03, 0x10, 0xB5, 0x07, 0x4C,
-    0x24, 0x78, 0x00, 0x2C, 0x07, 0xD1, 0x01, 0x20, 0x0B, 0x68, 0x9A, 0x18, 0x0A, 0x60, 0x40, 0x42,
-    0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xFF, 0xF7, 0xC7, 0xFF, 0xF9, 0xE7, 0xB6, 0x72, 0x00, 0x03,
-    0x70, 0xB5, 0x15, 0x00, 0x1C, 0x00, 0xFF, 0xF7, 0xBF, 0xFF, 0xA5, 0x42, 0x03, 0xDA, 0x03, 0x4B,
-    0x1A, 0x68, 0x03, 0x4B, 0x1A, 0x60, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x80, 0x72, 0x00, 0x03,
-    0x98, 0x72, 0x00, 0x03, 0x10, 0xB5, 0x00, 0x68, 0xFF, 0xF7, 0xAE, 0xFF, 0x10, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0x01, 0x20, 0x40, 0x42, 0x70, 0x47, 0x01, 0x20, 0x0B, 0x68, 0x9A, 0x18, 0x40, 0x42,
-    0x0A, 0x60, 0x70, 0x47, 0x01, 0x20, 0x0B, 0x68, 0x9A, 0x18, 0x40, 0x42, 0x0A, 0x60, 0x70, 0x47,
-    0xF8, 0xB5, 0x00, 0x23, 0x0F, 0x4C, 0x9D, 0x00, 0x65, 0x59, 0xA9, 0x42, 0x02, 0xD0, 0x01, 0x33,
-    0x0F, 0x2B, 0xF8, 0xD1, 0x01, 0x21, 0x99, 0x40, 0x0B, 0x4C, 0x25, 0x68, 0x29, 0x43, 0x0B, 0x4D,
-    0x6F, 0x1C, 0x9E, 0x00, 0xFB, 0x18, 0x21, 0x60, 0xDB, 0x7F, 0x09, 0x49, 0x9B, 0x00, 0x8C, 0x19,
-    0x5D, 0x59, 0x73, 0x58, 0x01, 0x00, 0x20, 0x6C, 0x00, 0xF0, 0xA2, 0xF9, 0xF8, 0xBC, 0x02, 0xBC,
-    0x08, 0x47, 0xC0, 0x46, 0x28, 0x63, 0x00, 0x08, 0xA0, 0x00, 0x00, 0x02, 0x08, 0xE0, 0x00, 0x08,
-    0x88, 0xDF, 0x00, 0x08, 0x0B, 0x00, 0xF0, 0xB5, 0x00, 0x24, 0x85, 0x49, 0x9D, 0x18, 0x84, 0x4A,
-    0x09, 0x78, 0x14, 0x70, 0x83, 0x4A, 0x14, 0x60, 0x83, 0x4A, 0x87, 0xB0, 0x03, 0x91, 0x11, 0x88,
-    0x05, 0x93, 0x01, 0x91, 0x06, 0x00, 0x14, 0x80, 0x02, 0x92, 0xAB, 0x42, 0x00, 0xD3, 0xA8, 0xE0,
-    0x1A, 0x00, 0x02, 0xCA, 0x7D, 0x48, 0x05, 0x92, 0xA7, 0x00, 0xC7, 0x59, 0xB9, 0x42, 0x00, 0xD1,
-    0xC4, 0xE0, 0x01, 0x34, 0x0F, 0x2C, 0xF7, 0xD1, 0x05, 0x93, 0x01, 0x23, 0x78, 0x4C, 0x79, 0x4D,
-    0x79, 0x4F, 0x21, 0x68, 0x30, 0x00, 0x00, 0x22, 0x2B, 0x70, 0x3B, 0x70, 0xFE, 0xF7, 0x7A, 0xF8,
-    0x02, 0x9B, 0x01, 0x9A, 0x1A, 0x80, 0xFF, 0xF7, 0xA0, 0xFE, 0x00, 0x23, 0x2B, 0x70, 0x05, 0x9D,
-    0x08, 0x22, 0x29, 0x00, 0x20, 0x00, 0x3B, 0x70, 0x09, 0xF0, 0xAC, 0xFB, 0x29, 0x00, 0x80, 0x22,
-    0x08, 0x31, 0x12, 0x01, 0x6D, 0x48, 0x09, 0xF0, 0xA5, 0xFB, 0x80, 0x22, 0x6C, 0x4B, 0x92, 0x01,
-    0xE9, 0x18, 0x6C, 0x48, 0x09, 0xF0, 0x9E, 0xFB, 0x6B, 0x4B, 0x6C, 0x4A, 0x1B, 0x78, 0xAC, 0x18,
-    0x00, 0x2B, 0x06, 0xD0, 0x80, 0x22, 0x6A, 0x4B, 0x6A, 0x48, 0xE9, 0x18, 0x92, 0x01, 0x09, 0xF0,
-    0x91, 0xFB, 0x80, 0x22, 0x05, 0x94, 0x05, 0x9C, 0x67, 0x48, 0x21, 0x00, 0x12, 0x01, 0x09, 0xF0,
-    0x89, 0xFB, 0x66, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x05, 0xD0, 0x80, 0x22, 0x12, 0x01, 0x64, 0x48,
-    0xA1, 0x18, 0x09, 0xF0, 0x7F, 0xFB, 0x82, 0x23, 0x5B, 0x01, 0xE1, 0x18, 0x20, 0x22, 0x61, 0x48,
-    0x09, 0xF0, 0x78, 0xFB, 0x60, 0x4B, 0x20, 0x22, 0xE1, 0x18, 0x60, 0x48, 0x09, 0xF0, 0x72, 0xFB,
-    0x5F, 0x4B, 0x08, 0x22, 0xE1, 0x18, 0x5F, 0x48, 0x09, 0xF0, 0x6C, 0xFB, 0x87, 0x23, 0x00, 0x25,
-    0x5D, 0x4E, 0x5B, 0x01, 0xE1, 0x18, 0x10, 0x22, 0x30, 0x00, 0x09, 0xF0, 0x63, 0xFB, 0x5B, 0x4B,
-    0x5B, 0x4A, 0xE1, 0x18, 0x80, 0x20, 0xAB, 0x00, 0xF3, 0x58, 0x00, 0x02, 0x1B, 0x18, 0x68, 0x03,
-    0x18, 0x18, 0xC3, 0x17, 0xDB, 0x04, 0xDB, 0x0C, 0x1B, 0x18, 0x5B, 0x13, 0x53, 0x55, 0x01, 0x35,
-    0x04, 0x2D, 0xEF, 0xD1, 0x53, 0x4E, 0x77, 0x68, 0x20, 0x22, 0x30, 0x00, 0x09, 0xF0, 0x4A, 0xFB,
-    0x51, 0x4B, 0x77, 0x60, 0x51, 0x4E, 0xE1, 0x18, 0x2A, 0x00, 0x30, 0x00, 0x09, 0xF0, 0x42, 0xFB,
-    0x4F, 0x4A, 0x13, 0x68, 0x9B, 0x05, 0x9B, 0x0D, 0x13, 0x60, 0x4E, 0x4A, 0x31, 0x68, 0x13, 0x68,
-    0x5B, 0x1A, 0x13, 0x60, 0x00, 0x23, 0x33, 0x60, 0x4B, 0x4B, 0x20, 0x22, 0xE1, 0x18, 0x4B, 0x48,
-    0x09, 0xF0, 0x30, 0xFB, 0x4A, 0x4B, 0xE4, 0x18, 0x4A, 0x4B, 0x1A, 0x68, 0x4A, 0x4B, 0x05, 0x94,
-    0x1A, 0x60, 0xFF, 0xF7, 0x3D, 0xFE, 0x09, 0xF0, 0x0D, 0xFD, 0x09, 0xF0, 0x33, 0xFD, 0x80, 0x22,
-    0x46, 0x4B, 0x19, 0x68, 0x46, 0x4B, 0x52, 0x00, 0x18, 0x68, 0x09, 0xF0, 0x9F, 0xFD, 0x80, 0x22,
-    0x01, 0x21, 0x92, 0x00, 0x49, 0x42, 0x43, 0x48, 0x09, 0xF0, 0xE0, 0xFC, 0x01, 0x21, 0x20, 0x22,
-    0x49, 0x42, 0x41, 0x48, 0x09, 0xF0, 0xDA, 0xFC, 0x01, 0x22, 0x40, 0x4B, 0x1A, 0x70, 0x18, 0x4B,
-    0x03, 0x9A, 0x1A, 0x70, 0x07, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x00, 0x2C, 0x00, 0xD0,
-    0x3A, 0xE7, 0xAA, 0x42, 0xD5, 0xD2, 0x5A, 0x68, 0x05, 0xA8, 0x08, 0x33, 0x05, 0x93, 0xFF, 0xF7,
-    0xE7, 0xFE, 0x01, 0x23, 0x14, 0x4F, 0x3B, 0x70, 0x11, 0x4B, 0x22, 0x00, 0x19, 0x68, 0x30, 0x00,
-    0xFD, 0xF7, 0xB0, 0xFF, 0x02, 0x9B, 0x01, 0x9A, 0x1A, 0x80, 0x3C, 0x70, 0xFF, 0xF7, 0xD5, 0xFD,
-    0x05, 0x9B, 0xAB, 0x42, 0xBD, 0xD2, 0x1A, 0x00, 0x02, 0xCA, 0x05, 0x92, 0xAA, 0x42, 0xB8, 0xD2,
-    0x5A, 0x68, 0x05, 0xA8, 0x08, 0x33, 0x05, 0x93, 0xFF, 0xF7, 0xCA, 0xFE, 0xF0, 0xE7, 0xC0, 0x46,
-    0x52, 0x76, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x04, 0x28, 0x63, 0x00, 0x08,
-    0x48, 0x73, 0x00, 0x03, 0x38, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-    0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0xB6, 0x72, 0x00, 0x03, 0x08, 0x48, 0x00, 0x00,
-    0x08, 0x28, 0x00, 0x00, 0x8C, 0xC1, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02, 0x6A, 0x73, 0x00, 0x03,
-    0x8C, 0xB9, 0x03, 0x02, 0xBC, 0x74, 0x00, 0x03, 0xB0, 0x10, 0x00, 0x00, 0xDC, 0x72, 0x00, 0x03,
-    0xD0, 0x10, 0x00, 0x00, 0x04, 0x73, 0x00, 0x03, 0x08, 0x6E, 0x00, 0x03, 0xF0, 0x10, 0x00, 0x00,
-    0x00, 0x73, 0x00, 0x03, 0x3C, 0x72, 0x00, 0x03, 0x10, 0x11, 0x00, 0x00, 0x64, 0x72, 0x00, 0x03,
-    0x58, 0x72, 0x00, 0x03, 0x54, 0x72, 0x00, 0x03, 0x1C, 0x11, 0x00, 0x00, 0x78, 0x72, 0x00, 0x03,
-    0x3C, 0x11, 0x00, 0x00, 0x80, 0x72, 0x00, 0x03, 0x98, 0x72, 0x00, 0x03, 0xE4, 0x74, 0x00, 0x03,
-    0xE8, 0x74, 0x00, 0x03, 0x8C, 0xEB, 0x03, 0x02, 0x90, 0xED, 0x03, 0x02, 0xD8, 0x72, 0x00, 0x03,
-    0xF7, 0xB5, 0x00, 0x25, 0x01, 0x90, 0x2C, 0x00, 0xFF, 0xF7, 0x6F, 0xFD, 0x01, 0x26, 0x33, 0x00,
-    0xA3, 0x40, 0x13, 0x4A, 0x11, 0x68, 0x0B, 0x43, 0x13, 0x60, 0x12, 0x4B, 0x1F, 0x00, 0x12, 0x4A,
-    0x10, 0x00, 0x20, 0x37, 0xE7, 0x5D, 0xBF, 0x00, 0xDB, 0x19, 0x1F, 0x6B, 0x0F, 0x4B, 0xA1, 0x00,
-    0x40, 0x30, 0x5B, 0x58, 0x8A, 0x58, 0x09, 0x58, 0x01, 0xA8, 0x00, 0xF0, 0x1A, 0xF8, 0x00, 0x28,
-    0x00, 0xDB, 0x08, 0x30, 0xC3, 0x43, 0xDB, 0x17, 0x18, 0x40, 0x01, 0x34, 0x2D, 0x18, 0x0F, 0x2C,
-    0xDD, 0xD1, 0xFF, 0xF7, 0x75, 0xFD, 0x28, 0x00, 0xFE, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xC0, 0x46,
-    0xA0, 0x00, 0x00, 0x02, 0x08, 0xE0, 0x00, 0x08, 0x88, 0xDF, 0x00, 0x08, 0x28, 0x63, 0x00, 0x08,
-    0x28, 0x47, 0x38, 0x47, 0x80, 0x22, 0x01, 0x21, 0x70, 0xB5, 0x14, 0x4E, 0x52, 0x00, 0x49, 0x42,
-    0x30, 0x00, 0x09, 0xF0, 0x13, 0xFC, 0x01, 0x21, 0x11, 0x4C, 0x10, 0x22, 0x49, 0x42, 0x20, 0x00,
-    0x09, 0xF0, 0x0C, 0xFC, 0x01, 0x21, 0x0F, 0x4D, 0x10, 0x22, 0x28, 0x00, 0x49, 0x42, 0x09, 0xF0,
-    0x05, 0xFC, 0x0D, 0x4B, 0x1B, 0x78, 0x00, 0x2B, 0x09, 0xD1, 0x1A, 0x06, 0x12, 0x0E, 0x11, 0x00,
-    0x08, 0x31, 0xF1, 0x54, 0xEA, 0x54, 0xE2, 0x54, 0x01, 0x33, 0x08, 0x2B, 0xF5, 0xD1, 0x00, 0x22,
-    0x06, 0x4B, 0x1A, 0x60, 0x5A, 0x60, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x68, 0xEF, 0x03, 0x02,
-    0x48, 0xEF, 0x03, 0x02, 0x58, 0xEF, 0x03, 0x02, 0x69, 0x73, 0x00, 0x03, 0x8C, 0x76, 0x00, 0x03,
-    0x00, 0x23, 0x10, 0xB5, 0x83, 0x42, 0x06, 0xDB, 0x07, 0x2B, 0x01, 0xDC, 0xCA, 0x54, 0x58, 0x1C,
-    0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xCC, 0x5C, 0x94, 0x42, 0xF9, 0xD0, 0x01, 0x33, 0xF1, 0xE7,
-    0xF0, 0xB5, 0x50, 0x4B, 0x1B, 0x68, 0x89, 0xB0, 0x01, 0x93, 0x4F, 0x4B, 0x1D, 0x68, 0x4F, 0x4B,
-    0x1A, 0x78, 0x20, 0x23, 0x14, 0x00, 0x69, 0x1C, 0xFF, 0x31, 0x02, 0x91, 0x1C, 0x40, 0x1A, 0x42,
-    0x42, 0xD1, 0x27, 0x00, 0x07, 0x26, 0x4A, 0x4B, 0x1B, 0x68, 0x03, 0x93, 0x2A, 0x78, 0xEF, 0x2A,
-    0x16, 0xDC, 0x03, 0x99, 0x93, 0x00, 0xCB, 0x18, 0x7F, 0x21, 0x5B, 0x78, 0x01, 0x98, 0x8B, 0x43,
-    0x5B, 0x11, 0x69, 0x78, 0xB2, 0x43, 0xC3, 0x18, 0x9B, 0x18, 0x89, 0x11, 0x5A, 0x5C, 0x41, 0x4B,
-    0x9B, 0x5C, 0x7F, 0x2B, 0x22, 0xD9, 0x20, 0x00, 0x06, 0xA9, 0xFF, 0xF7, 0xC1, 0xFF, 0x04, 0x00,
-    0x02, 0x9B, 0x04, 0x35, 0xAB, 0x42, 0xE1, 0xD1, 0x3B, 0x19, 0x08, 0x2B, 0x01, 0xDD, 0x08, 0x24,
-    0xE4, 0x1B, 0x01, 0x26, 0x00, 0x20, 0xB4, 0x46, 0x37, 0x49, 0x02, 0x90, 0x4A, 0x68, 0x0B, 0x68,
-    0x01, 0x90, 0x00, 0x2C, 0x35, 0xD1, 0x02, 0x9C, 0x00, 0x2C, 0x00, 0xD0, 0x4A, 0x60, 0x00, 0x28,
-    0x00, 0xD0, 0x0B, 0x60, 0x09, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x38, 0x00, 0x04, 0xA9,
-    0xFF, 0xF7, 0x9E, 0xFF, 0x07, 0x00, 0xDB, 0xE7, 0x00, 0x24, 0x01, 0x26, 0x27, 0x00, 0x29, 0x78,
-    0xEF, 0x29, 0x13, 0xD8, 0x6A, 0x78, 0x07, 0x20, 0x13, 0x00, 0x81, 0x43, 0x33, 0x40, 0x01, 0x98,
-    0x9B, 0x00, 0xC3, 0x18, 0x5B, 0x18, 0x92, 0x11, 0x9A, 0x5C, 0x22, 0x4B, 0x9B, 0x5C, 0x7F, 0x2B,
-    0x09, 0xD9, 0x20, 0x00, 0x06, 0xA9, 0xFF, 0xF7, 0x83, 0xFF, 0x04, 0x00, 0x02, 0x9B, 0x04, 0x35,
-    0xAB, 0x42, 0xE4, 0xD1, 0xC0, 0xE7, 0x38, 0x00, 0x04, 0xA9, 0xFF, 0xF7, 0x79, 0xFF, 0x07, 0x00,
-    0xF4, 0xE7, 0x07, 0x2A, 0x0E, 0xDD, 0x19, 0x48, 0xC6, 0x5C, 0x00, 0x20, 0x87, 0x42, 0x03, 0xDC,
-    0xFF, 0x25, 0x14, 0x48, 0x85, 0x55, 0x08, 0xE0, 0x04, 0xAD, 0x45, 0x5D, 0xB5, 0x42, 0x11, 0xD0,
-    0x01, 0x30, 0xF3, 0xE7, 0x60, 0x46, 0x02, 0x90, 0x01, 0x32, 0x01, 0x9D, 0x06, 0xA8, 0x46, 0x5D,
-    0x0E, 0x48, 0xC6, 0x54, 0x18, 0x00, 0x0B, 0x4D, 0x08, 0x30, 0xA8, 0x55, 0x01, 0x98, 0x01, 0x30,
-    0x01, 0x90, 0x01, 0x3C, 0x58, 0x1C, 0x07, 0x28, 0x00, 0xDD, 0xD8, 0x1F, 0x03, 0x00, 0x60, 0x46,
-    0x9F, 0xE7, 0xC0, 0x46, 0x18, 0x75, 0x00, 0x03, 0xE8, 0x74, 0x00, 0x03, 0x95, 0x72, 0x00, 0x03,
-    0xE0, 0x74, 0x00, 0x03, 0x68, 0xEF, 0x03, 0x02, 0x8C, 0x76, 0x00, 0x03, 0x48, 0xEF, 0x03, 0x02,
-    0xE0, 0x22, 0x0B, 0x4B, 0x10, 0xB5, 0x1B, 0x68, 0x0A, 0x48, 0x12, 0x05, 0x0A, 0x49, 0x9A, 0x18,
-    0x1B, 0x18, 0x14, 0x78, 0x08, 0x78, 0x84, 0x42, 0x07, 0xD1, 0x01, 0x32, 0x01, 0x31, 0x9A, 0x42,
-    0xF7, 0xD1, 0x01, 0x20, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x00, 0x20, 0xFA, 0xE7, 0xC0, 0x46,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x0E, 0x00, 0x08, 0x00, 0x03, 0x00, 0x23, 0x10, 0xB5,
-    0xCC, 0x5C, 0xC4, 0x54, 0x01, 0x33, 0x9A, 0x42, 0xFA, 0xD1, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x80, 0x22, 0x0B, 0x4B, 0x1B, 0x68, 0x92, 0x01, 0x9A, 0x18, 0x10, 0xB5, 0x9A, 0x42, 0x0A, 0xDA,
-    0x01, 0x22, 0xE0, 0x20, 0x00, 0x24, 0xD2, 0x18, 0x00, 0x05, 0x59, 0x1C, 0x91, 0x42, 0x04, 0xD1,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x03, 0x4A, 0xF3, 0xE7, 0x1C, 0x54, 0x0B, 0x00, 0xF4, 0xE7,
-    0x00, 0x00, 0x00, 0x02, 0x01, 0x20, 0x00, 0x00, 0xF7, 0xB5, 0xE0, 0x20, 0x23, 0x4A, 0x24, 0x4B,
-    0x00, 0x05, 0x04, 0x78, 0x1B, 0x78, 0x11, 0x78, 0x22, 0x4A, 0x1B, 0x02, 0x12, 0x78, 0x1B, 0x19,
-    0x09, 0x04, 0x21, 0x4F, 0x5B, 0x18, 0x12, 0x06, 0x9B, 0x18, 0x3A, 0x78, 0x1F, 0x4E, 0x00, 0x92,
-    0x1F, 0x4D, 0x32, 0x78, 0x1F, 0x4C, 0x29, 0x78, 0x8C, 0x46, 0x21, 0x78, 0x01, 0x91, 0x1E, 0x49,
-    0x59, 0x18, 0x01, 0x29, 0x26, 0xD8, 0x00, 0x99, 0x12, 0x02, 0x52, 0x18, 0x61, 0x46, 0x09, 0x04,
-    0x8C, 0x46, 0x01, 0x99, 0x62, 0x44, 0x09, 0x06, 0x51, 0x18, 0x8B, 0x42, 0x1A, 0xD1, 0x0F, 0x22,
-    0x5A, 0x40, 0x12, 0x06, 0x12, 0x0E, 0x02, 0x70, 0x3F, 0x78, 0x32, 0x78, 0x2D, 0x78, 0x12, 0x02,
-    0x21, 0x78, 0xD2, 0x19, 0x2D, 0x04, 0x52, 0x19, 0x09, 0x06, 0x52, 0x18, 0x9B, 0x1A, 0x5A, 0x1E,
-    0x93, 0x41, 0xE0, 0x22, 0x5B, 0x42, 0x12, 0x02, 0xDB, 0x03, 0x9B, 0x18, 0x0B, 0x4A, 0x13, 0x60,
-    0xD7, 0x23, 0x03, 0x70, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x02, 0x00, 0x00, 0x0E,
-    0x01, 0x00, 0x00, 0x0E, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x0E, 0x01, 0x80, 0x00, 0x0E,
-    0x02, 0x80, 0x00, 0x0E, 0x03, 0x80, 0x00, 0x0E, 0x29, 0xCE, 0x58, 0xA8, 0x00, 0x00, 0x00, 0x02,
-    0x11, 0x4B, 0x10, 0xB5, 0x1C, 0x68, 0xFF, 0xF7, 0x9F, 0xFF, 0xE0, 0x21, 0x0F, 0x4B, 0x20, 0x00,
-    0x1A, 0x68, 0x09, 0x05, 0xFF, 0xF7, 0x72, 0xFF, 0x23, 0x68, 0x0D, 0x4A, 0x9B, 0x18, 0x01, 0x2B,
-    0x0B, 0xD9, 0x0C, 0x4B, 0x23, 0x60, 0x00, 0x23, 0xE0, 0x20, 0x63, 0x60, 0x01, 0x3B, 0x0C, 0x22,
-    0x21, 0x00, 0xA3, 0x60, 0x00, 0x05, 0xFF, 0xF7, 0x61, 0xFF, 0x01, 0x22, 0x06, 0x4B, 0x1A, 0x70,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x29, 0xCE, 0x58, 0xA8, 0xD7, 0x31, 0xA7, 0x57, 0x32, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x02, 0x20,
-    0xFF, 0xF7, 0x76, 0xF8, 0x80, 0x22, 0x0D, 0x4B, 0x52, 0x00, 0x1A, 0x60, 0xFE, 0xF7, 0xD2, 0xFF,
-    0x00, 0x22, 0x29, 0x20, 0x0A, 0x49, 0xFF, 0xF7, 0xA7, 0xF8, 0x00, 0x22, 0x2A, 0x20, 0x09, 0x49,
-    0xFF, 0xF7, 0xA2, 0xF8, 0x5A, 0x24, 0x01, 0x3C, 0x09, 0xF0, 0x38, 0xFA, 0x00, 0x2C, 0xFA, 0xD1,
-    0x02, 0x20, 0xFF, 0xF7, 0x5D, 0xF8, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x80, 0x00, 0x00, 0x02,
-    0xE3, 0xE4, 0x00, 0x08, 0xFF, 0xE4, 0x00, 0x08, 0x70, 0xB5, 0x0D, 0x00, 0x0A, 0x21, 0x06, 0x00,
-    0x09, 0xF0, 0x96, 0xFA, 0x03, 0x00, 0x30, 0x33, 0x04, 0x00, 0x2B, 0x70, 0x30, 0x00, 0x0A, 0x21,
-    0x09, 0xF0, 0x76, 0xFA, 0x30, 0x31, 0x20, 0x00, 0x69, 0x70, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0xF7, 0xB5, 0x0D, 0x00, 0x04, 0x00, 0x1A, 0x49, 0x16, 0x00, 0x01, 0x93, 0x09, 0xF0, 0xB4, 0xF9,
-    0x28, 0x00, 0x18, 0x49, 0x09, 0xF0, 0x7C, 0xFA, 0x21, 0x00, 0xFF, 0xF7, 0xDD, 0xFF, 0xE1, 0x21,
-    0x28, 0x00, 0x09, 0x01, 0x09, 0xF0, 0x74, 0xFA, 0x3C, 0x21, 0x09, 0xF0, 0x59, 0xFA, 0xE7, 0x1C,
-    0x08, 0x00, 0x39, 0x00, 0xFF, 0xF7, 0xD0, 0xFF, 0x28, 0x00, 0x3C, 0x21, 0x09, 0xF0, 0x68, 0xFA,
-    0x3C, 0x21, 0x09, 0xF0, 0x4D, 0xFA, 0xA7, 0x1D, 0x08, 0x00, 0x39, 0x00, 0xFF, 0xF7, 0xC4, 0xFF,
-    0x20, 0x00, 0x31, 0x00, 0x0B, 0x30, 0x01, 0xF0, 0xFF, 0xFC, 0x04, 0x00, 0x06, 0x49, 0x09, 0xF0,
-    0x61, 0xF9, 0x01, 0x99, 0xE0, 0x1D, 0x01, 0xF0, 0xF7, 0xFC, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x17, 0xE5, 0x00, 0x08, 0xC0, 0x4B, 0x03, 0x00, 0x23, 0xE5, 0x00, 0x08, 0xF0, 0xB5, 0x8D, 0xB0,
-    0x0B, 0x93, 0x62, 0x4B, 0x1B, 0x68, 0x01, 0x93, 0x61, 0x4B, 0x1E, 0x68, 0x03, 0x00, 0x02, 0x3B,
-    0x06, 0x91, 0x59, 0x42, 0x59, 0x41, 0x15, 0x68, 0x07, 0x91, 0x06, 0x9B, 0x01, 0x99, 0x02, 0x90,
-    0x1B, 0x68, 0x04, 0x36, 0x49, 0x1B, 0x0B, 0x29, 0x09, 0xDD, 0x0F, 0x2B, 0x07, 0xDD, 0x19, 0x00,
-    0x01, 0x9D, 0x0E, 0x39, 0x0B, 0x3D, 0xA9, 0x42, 0x01, 0xDC, 0x0F, 0x3B, 0x1D, 0x00, 0x01, 0x9B,
-    0x5B, 0x1B, 0x02, 0x2B, 0x04, 0xDC, 0x01, 0x9B, 0xDD, 0x1E, 0xEB, 0x43, 0xDB, 0x17, 0x1D, 0x40,
-    0x02, 0x20, 0x15, 0x60, 0x43, 0x1B, 0x05, 0x93, 0xFE, 0xF7, 0xD2, 0xFF, 0x08, 0x23, 0x00, 0x24,
-    0x22, 0x27, 0x04, 0x93, 0x33, 0x88, 0x03, 0x93, 0x00, 0x2B, 0x39, 0xD1, 0x49, 0x4B, 0x1E, 0x68,
-    0x04, 0x9B, 0xF6, 0x1A, 0x01, 0x9B, 0x48, 0x4F, 0x9C, 0x42, 0x59, 0xD0, 0x33, 0x00, 0x09, 0x9A,
-    0x08, 0x99, 0x38, 0x00, 0xFF, 0xF7, 0x7C, 0xFF, 0x39, 0x00, 0x32, 0x20, 0x03, 0x9A, 0xFE, 0xF7,
-    0xF3, 0xFF, 0x00, 0x2C, 0x04, 0xD0, 0x00, 0x22, 0x33, 0x20, 0x40, 0x49, 0xFE, 0xF7, 0xEC, 0xFF,
-    0x02, 0x9B, 0x01, 0x2B, 0x4A, 0xD1, 0x05, 0x9B, 0xE3, 0x18, 0x10, 0x2B, 0x08, 0xDC, 0x01, 0x9B,
-    0x60, 0x1B, 0xE2, 0x1A, 0x53, 0x42, 0x5A, 0x41, 0x39, 0x49, 0x22, 0x30, 0xFE, 0xF7, 0xDC, 0xFF,
-    0x00, 0x22, 0x20, 0x20, 0x37, 0x49, 0xFE, 0xF7, 0xD7, 0xFF, 0x01, 0x34, 0x06, 0x9B, 0x04, 0x9A,
-    0x1C, 0x60, 0x0A, 0x98, 0x2E, 0x4B, 0x9A, 0x60, 0x0D, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x73, 0x88, 0x07, 0x9A, 0x93, 0x42, 0x04, 0xD0, 0x02, 0x9A, 0x03, 0x2A, 0x19, 0xD1, 0x02, 0x2B,
-    0x17, 0xD0, 0x05, 0x9B, 0xE3, 0x18, 0x02, 0x3B, 0x0E, 0x2B, 0x09, 0xD8, 0x31, 0x00, 0x01, 0x9B,
-    0x78, 0x1B, 0xE2, 0x1A, 0x53, 0x42, 0x5A, 0x41, 0x00, 0x19, 0x10, 0x31, 0xFE, 0xF7, 0xB4, 0xFF,
-    0x01, 0x9B, 0x9C, 0x42, 0x04, 0xD1, 0xB3, 0x68, 0x08, 0x93, 0x03, 0x9B, 0x0A, 0x96, 0x09, 0x93,
-    0x01, 0x34, 0x03, 0x9A, 0x94, 0x46, 0x04, 0x9B, 0x63, 0x44, 0x04, 0x93, 0xB6, 0x18, 0x99, 0xE7,
-    0x17, 0x4B, 0x59, 0x68, 0x33, 0x00, 0x0A, 0x88, 0x89, 0x68, 0xA2, 0xE7, 0x02, 0x9B, 0x00, 0x2B,
-    0x05, 0xD1, 0x1A, 0x00, 0x18, 0x49, 0x20, 0x20, 0xFE, 0xF7, 0x96, 0xFF, 0xBE, 0xE7, 0x02, 0x9B,
-    0x02, 0x2B, 0x02, 0xD1, 0x00, 0x22, 0x15, 0x49, 0xF5, 0xE7, 0x02, 0x9B, 0x03, 0x2B, 0xB5, 0xD1,
-    0x0B, 0x9B, 0x98, 0x1B, 0x00, 0x28, 0x0D, 0xDD, 0x00, 0x04, 0x00, 0x0C, 0x01, 0xF0, 0x5B, 0xFC,
-    0x09, 0x4D, 0x02, 0x00, 0x0E, 0x49, 0x28, 0x00, 0x0E, 0x4B, 0x01, 0xF0, 0x61, 0xF8, 0x00, 0x22,
-    0x29, 0x00, 0xE0, 0xE7, 0x00, 0x22, 0x0C, 0x49, 0xDD, 0xE7, 0xC0, 0x46, 0x8C, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0xBC, 0x00, 0x00, 0x02, 0x2B, 0xE5, 0x00, 0x08,
-    0x41, 0xE5, 0x00, 0x08, 0x47, 0xE5, 0x00, 0x08, 0x53, 0xE5, 0x00, 0x08, 0x5F, 0xE5, 0x00, 0x08,
-    0x72, 0xE5, 0x00, 0x08, 0x6B, 0xE5, 0x00, 0x08, 0x82, 0xE5, 0x00, 0x08, 0xF7, 0xB5, 0x14, 0x00,
-    0x00, 0x90, 0x01, 0x91, 0xFF, 0xF7, 0x74, 0xFE, 0x01, 0x20, 0x40, 0x42, 0x08, 0x26, 0x01, 0x00,
-    0x0E, 0x4F, 0x3A, 0x68, 0x13, 0x1D, 0x92, 0x88, 0x00, 0x2A, 0x03, 0xD1, 0xBE, 0x60, 0xFE, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x5D, 0x88, 0xAC, 0x46, 0x01, 0x9D, 0xAC, 0x45, 0x09, 0xD1, 0xDD, 0x68,
-    0xAC, 0x46, 0x00, 0x9D, 0x01, 0x31, 0xAC, 0x45, 0x03, 0xD1, 0x08, 0x00, 0x00, 0x2C, 0x00, 0xD0,
-    0x23, 0x60, 0x9B, 0x18, 0xB6, 0x18, 0x1A, 0x88, 0xE6, 0xE7, 0xC0, 0x46, 0xA4, 0x00, 0x00, 0x02,
-    0x01, 0x4B, 0x98, 0x68, 0x70, 0x47, 0xC0, 0x46, 0x08, 0xEE, 0x03, 0x02, 0x07, 0xB5, 0x02, 0x21,
-    0x00, 0x20, 0x01, 0xAA, 0xFF, 0xF7, 0xCA, 0xFF, 0x00, 0x28, 0x08, 0xDB, 0x05, 0x4B, 0x01, 0x9A,
-    0x1B, 0x68, 0xD3, 0x1A, 0x04, 0x4A, 0x53, 0x60, 0x03, 0xB0, 0x01, 0xBC, 0x00, 0x47, 0x01, 0x23,
-    0x5B, 0x42, 0xF7, 0xE7, 0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xB5, 0x41, 0x4F,
-    0xBB, 0x68, 0x87, 0xB0, 0xFD, 0x68, 0x3C, 0x68, 0x03, 0x93, 0x7B, 0x68, 0x16, 0x00, 0x04, 0x93,
-    0x05, 0x90, 0x02, 0x91, 0xFF, 0xF7, 0x24, 0xFE, 0x21, 0x00, 0x03, 0x9A, 0x28, 0x00, 0x08, 0xF0,
-    0xD9, 0xFE, 0x2B, 0x1D, 0x01, 0x93, 0xAB, 0x88, 0x00, 0x93, 0xEB, 0x88, 0x00, 0x22, 0x04, 0x34,
-    0xB3, 0x42, 0x05, 0xD0, 0x72, 0x1C, 0x40, 0xD1, 0x02, 0x3B, 0x5A, 0x42, 0x53, 0x41, 0x5A, 0x42,
-    0x05, 0x9B, 0x9A, 0x42, 0x02, 0xDA, 0x00, 0x9B, 0x00, 0x2B, 0x39, 0xD1, 0x03, 0x9B, 0x00, 0x9A,
-    0x9E, 0x1A, 0x02, 0x9B, 0x00, 0x2B, 0x0C, 0xD1, 0x04, 0x9B, 0x1D, 0x88, 0x2A, 0x4B, 0x1B, 0x68,
-    0x76, 0x19, 0x9E, 0x42, 0x24, 0xD8, 0x20, 0x00, 0x2A, 0x00, 0x04, 0x99, 0x08, 0xF0, 0xB2, 0xFE,
-    0x64, 0x19, 0x00, 0x9A, 0x94, 0x46, 0x01, 0x9B, 0x63, 0x44, 0x02, 0x93, 0x01, 0x9B, 0x9D, 0x5A,
-    0x00, 0x2D, 0x30, 0xD1, 0x01, 0x23, 0x32, 0x00, 0x5B, 0x42, 0x63, 0x60, 0x1D, 0x4B, 0x08, 0x32,
-    0x25, 0x60, 0x9A, 0x60, 0x1C, 0x4B, 0xA4, 0x1B, 0x19, 0x68, 0x91, 0x42, 0x2E, 0xD8, 0xE0, 0x20,
-    0x39, 0x68, 0x00, 0x05, 0xFF, 0xF7, 0x5A, 0xFD, 0xFF, 0xF7, 0x90, 0xFF, 0x01, 0x23, 0x02, 0x93,
-    0x02, 0x98, 0x07, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x01, 0x22, 0x52, 0x42, 0xBF, 0xE7,
-    0x00, 0x99, 0x8C, 0x46, 0x00, 0x9B, 0xE4, 0x18, 0x01, 0x9B, 0x63, 0x44, 0x01, 0x93, 0x1B, 0x88,
-    0x00, 0x93, 0x01, 0x9B, 0x5B, 0x88, 0x9E, 0x42, 0x03, 0xD0, 0x71, 0x1C, 0xB0, 0xD1, 0x02, 0x2B,
-    0xAE, 0xD0, 0x01, 0x32, 0xAC, 0xE7, 0x2A, 0x00, 0x20, 0x00, 0x02, 0x99, 0x08, 0xF0, 0x72, 0xFE,
-    0x02, 0x9B, 0x5B, 0x19, 0x64, 0x19, 0x02, 0x93, 0x1D, 0x88, 0xC1, 0xE7, 0xA5, 0x54, 0x01, 0x32,
-    0xCA, 0xE7, 0xC0, 0x46, 0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0xF7, 0xB5, 0x00, 0x24,
-    0x01, 0x94, 0xFF, 0xF7, 0xA5, 0xFD, 0x1A, 0x4D, 0x23, 0x00, 0x69, 0x46, 0x02, 0x20, 0x01, 0xAA,
-    0x2C, 0x60, 0xFF, 0xF7, 0x43, 0xFE, 0x00, 0x9B, 0xA3, 0x42, 0x26, 0xD0, 0x20, 0x00, 0x01, 0xF0,
-    0x57, 0xF9, 0x04, 0x26, 0xF4, 0x27, 0x00, 0x98, 0xFE, 0xF7, 0xFA, 0xFD, 0x04, 0x00, 0x30, 0x42,
-    0x0B, 0xD0, 0x01, 0x22, 0x28, 0x68, 0x11, 0x00, 0xFF, 0xF7, 0x58, 0xFF, 0x00, 0x9B, 0x29, 0x68,
-    0x5A, 0x1E, 0x8A, 0x42, 0x01, 0xD1, 0x02, 0x3B, 0x2B, 0x60, 0x3C, 0x42, 0x05, 0xD0, 0x00, 0x23,
-    0x69, 0x46, 0x02, 0x20, 0x01, 0xAA, 0xFF, 0xF7, 0x21, 0xFE, 0x00, 0x9B, 0x00, 0x2B, 0x02, 0xD0,
-    0x04, 0x4B, 0x1C, 0x42, 0xDF, 0xD0, 0x01, 0xF0, 0x5B, 0xF9, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x8C, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0xF7, 0xB5, 0x00, 0x24, 0x05, 0x00, 0x01, 0x94,
-    0xFF, 0xF7, 0x66, 0xFD, 0x16, 0x4E, 0x2B, 0x00, 0x69, 0x46, 0x03, 0x20, 0x01, 0x27, 0x01, 0xAA,
-    0x34, 0x60, 0xFF, 0xF7, 0x03, 0xFE, 0x7F, 0x42, 0x00, 0x98, 0xFE, 0xF7, 0xC1, 0xFD, 0x04, 0x23,
-    0x04, 0x00, 0x18, 0x42, 0x0B, 0xD0, 0x3A, 0x00, 0x01, 0x21, 0x30, 0x68, 0xFF, 0xF7, 0x1E, 0xFF,
-    0x00, 0x9B, 0x31, 0x68, 0x5A, 0x1E, 0x8A, 0x42, 0x01, 0xD1, 0x02, 0x3B, 0x33, 0x60, 0xF4, 0x23,
-    0x1C, 0x42, 0x05, 0xD0, 0x2B, 0x00, 0x69, 0x46, 0x03, 0x20, 0x01, 0xAA, 0xFF, 0xF7, 0xE6, 0xFD,
-    0x04, 0x4B, 0x1C, 0x42, 0xE0, 0xD0, 0xFF, 0xF7, 0x3B, 0xFD, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x8C, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x3A, 0x4B, 0x1B, 0x68, 0xF7, 0xB5, 0x1B, 0x01,
-    0x49, 0xD5, 0x0F, 0x22, 0xFF, 0x21, 0x38, 0x4B, 0x1B, 0x78, 0x1A, 0x40, 0x37, 0x4B, 0x1B, 0x78,
-    0x37, 0x4C, 0x5B, 0x01, 0x0B, 0x40, 0x21, 0x79, 0x13, 0x43, 0x00, 0x22, 0x8B, 0x42, 0x01, 0xD0,
-    0x23, 0x71, 0x01, 0x32, 0x33, 0x4B, 0x19, 0x78, 0x03, 0x23, 0x60, 0x20, 0x19, 0x40, 0x32, 0x4B,
-    0x1B, 0x78, 0x5B, 0x01, 0x03, 0x40, 0x19, 0x43, 0x30, 0x4B, 0x1B, 0x78, 0x5F, 0x38, 0x03, 0x40,
-    0x5D, 0x42, 0x6B, 0x41, 0x1B, 0x01, 0x0B, 0x43, 0x61, 0x79, 0x8B, 0x42, 0x01, 0xD0, 0x02, 0x00,
-    0x63, 0x71, 0x2B, 0x4E, 0xA1, 0x68, 0x33, 0x69, 0x99, 0x42, 0x1A, 0xD0, 0xA3, 0x60, 0x29, 0x4D,
-    0x68, 0x68, 0x03, 0x28, 0x1A, 0xDD, 0x2B, 0x68, 0x98, 0x42, 0x17, 0xD2, 0xE0, 0x23, 0x1B, 0x05,
-    0xC0, 0x18, 0x30, 0x22, 0x21, 0x00, 0xFF, 0xF7, 0x71, 0xFC, 0x23, 0x4B, 0x1B, 0x78, 0x01, 0x2B,
-    0x09, 0xD1, 0x30, 0x68, 0x6B, 0x68, 0x30, 0x22, 0x21, 0x00, 0xC0, 0x18, 0xFF, 0xF7, 0x66, 0xFC,
-    0x01, 0xE0, 0x00, 0x2A, 0xE3, 0xD1, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x02, 0x21, 0x00, 0x20,
-    0x01, 0xAA, 0xFF, 0xF7, 0x63, 0xFE, 0x00, 0x28, 0x01, 0xDA, 0x73, 0x68, 0x01, 0x93, 0x01, 0x9B,
-    0x86, 0xCC, 0x86, 0xC3, 0x86, 0xCC, 0x86, 0xC3, 0x86, 0xCC, 0x86, 0xC3, 0x86, 0xCC, 0x86, 0xC3,
-    0x00, 0x28, 0xE8, 0xDA, 0x00, 0x21, 0x02, 0x22, 0x08, 0x00, 0xFF, 0xF7, 0x97, 0xFE, 0x01, 0xAA,
-    0x02, 0x21, 0x00, 0x20, 0xFF, 0xF7, 0x4A, 0xFE, 0x33, 0x68, 0x01, 0x9A, 0xD3, 0x1A, 0x6B, 0x60,
-    0xD9, 0xE7, 0xC0, 0x46, 0x6C, 0x00, 0x00, 0x02, 0x49, 0x73, 0x00, 0x03, 0xC6, 0x5E, 0x00, 0x03,
-    0x08, 0xEE, 0x03, 0x02, 0xBA, 0x00, 0x00, 0x02, 0xBB, 0x00, 0x00, 0x02, 0x75, 0x73, 0x00, 0x03,
-    0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x32, 0x00, 0x00, 0x02, 0x00, 0x22, 0x10, 0xB5,
-    0x04, 0x4B, 0x1A, 0x61, 0xFF, 0xF7, 0x70, 0xFF, 0xFF, 0xF7, 0x2A, 0xFC, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0xA4, 0x00, 0x00, 0x02, 0x21, 0x4B, 0x1B, 0x68, 0x37, 0xB5, 0x1B, 0x01,
-    0x2E, 0xD5, 0x02, 0x21, 0x00, 0x20, 0x01, 0xAA, 0xFF, 0xF7, 0x18, 0xFE, 0x1D, 0x49, 0x00, 0x28,
-    0x29, 0xDB, 0x1D, 0x4A, 0x01, 0x9B, 0x12, 0x68, 0x1C, 0x48, 0x9A, 0x1A, 0x42, 0x60, 0x0F, 0x20,
-    0x1A, 0x79, 0x1B, 0x4C, 0x10, 0x40, 0x20, 0x70, 0x1A, 0x48, 0x52, 0x11, 0x02, 0x70, 0x5A, 0x79,
-    0x03, 0x24, 0x15, 0x00, 0x18, 0x48, 0x25, 0x40, 0x05, 0x70, 0x50, 0x11, 0x20, 0x40, 0x17, 0x4C,
-    0x20, 0x70, 0x01, 0x20, 0x12, 0x09, 0x90, 0x43, 0x02, 0x00, 0x15, 0x48, 0x02, 0x70, 0x0A, 0x00,
-    0x13, 0xCB, 0x13, 0xC2, 0x13, 0xCB, 0x13, 0xC2, 0x13, 0xCB, 0x13, 0xC2, 0x13, 0xCB, 0x13, 0xC2,
-    0x37, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0A, 0x00, 0x0E, 0x4B, 0x13, 0xCB, 0x13, 0xC2, 0x13, 0xCB,
-    0x13, 0xC2, 0x13, 0xCB, 0x13, 0xC2, 0x13, 0xCB, 0x13, 0xC2, 0xFF, 0xF7, 0x25, 0xFF, 0xEF, 0xE7,
-    0x6C, 0x00, 0x00, 0x02, 0x08, 0xEE, 0x03, 0x02, 0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-    0x49, 0x73, 0x00, 0x03, 0xC6, 0x5E, 0x00, 0x03, 0xBA, 0x00, 0x00, 0x02, 0xBB, 0x00, 0x00, 0x02,
-    0x75, 0x73, 0x00, 0x03, 0x78, 0xE0, 0x00, 0x08, 0x15, 0x4B, 0x70, 0xB5, 0x04, 0x00, 0x98, 0x42,
-    0x10, 0xD9, 0x43, 0x78, 0x05, 0x78, 0x1B, 0x02, 0x2B, 0x43, 0x85, 0x78, 0x2D, 0x04, 0x2B, 0x43,
-    0xC5, 0x78, 0x04, 0x22, 0x2D, 0x06, 0x0F, 0x49, 0x04, 0x38, 0x1D, 0x43, 0x08, 0xF0, 0xC4, 0xFC,
-    0x00, 0x28, 0x11, 0xD0, 0x80, 0x23, 0x00, 0x25, 0xDB, 0x01, 0xE1, 0x18, 0x62, 0x78, 0x23, 0x78,
-    0x12, 0x02, 0x1A, 0x43, 0xA3, 0x78, 0x1B, 0x04, 0x1A, 0x43, 0xE3, 0x78, 0x1B, 0x06, 0x13, 0x43,
-    0x80, 0x34, 0xED, 0x18, 0x8C, 0x42, 0xF1, 0xD1, 0x28, 0x00, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x03, 0x00, 0x00, 0x02, 0x9B, 0xE5, 0x00, 0x08, 0x7F, 0xB5, 0x05, 0x00, 0x16, 0x4C, 0x10, 0x00,
-    0x62, 0x68, 0x0E, 0x00, 0x00, 0x93, 0x29, 0x00, 0x30, 0x32, 0x03, 0xAB, 0xFD, 0xF7, 0x14, 0xFE,
-    0x03, 0x22, 0x03, 0x9B, 0x64, 0x68, 0x33, 0x33, 0x93, 0x43, 0x23, 0x80, 0x0F, 0x4B, 0x65, 0x60,
-    0x1B, 0x68, 0x0F, 0x4D, 0xA3, 0x60, 0x66, 0x80, 0x28, 0x68, 0xFE, 0xF7, 0x9B, 0xFD, 0x40, 0x30,
-    0xFF, 0xF7, 0xB2, 0xFF, 0x0B, 0x4B, 0x1B, 0x78, 0xE0, 0x60, 0x0B, 0x49, 0x10, 0x34, 0x00, 0x2B,
-    0x03, 0xD1, 0x28, 0x68, 0xFE, 0xF7, 0x8E, 0xFD, 0x01, 0x00, 0x20, 0x00, 0x08, 0xF0, 0x0C, 0xFE,
-    0x7F, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0xA4, 0x00, 0x00, 0x02, 0x60, 0x72, 0x00, 0x03,
-    0x44, 0x73, 0x00, 0x03, 0x44, 0x00, 0x00, 0x02, 0x4C, 0x00, 0x00, 0x02, 0xF7, 0xB5, 0x00, 0x24,
-    0x1F, 0x4D, 0xE8, 0x68, 0x01, 0x94, 0xFF, 0xF7, 0x03, 0xFA, 0x2B, 0x68, 0xEA, 0x68, 0x21, 0x00,
-    0xFF, 0xF7, 0xBA, 0xFF, 0xFF, 0xF7, 0xCC, 0xFB, 0x1A, 0x4D, 0x23, 0x00, 0x69, 0x46, 0x01, 0xAA,
-    0x01, 0x20, 0x2C, 0x60, 0xFF, 0xF7, 0x6A, 0xFC, 0x20, 0x00, 0x00, 0xF0, 0x81, 0xFF, 0x01, 0x26,
-    0x04, 0x27, 0x00, 0x98, 0xFE, 0xF7, 0x24, 0xFC, 0x04, 0x00, 0x30, 0x42, 0x08, 0xD0, 0x00, 0x22,
-    0x28, 0x68, 0x11, 0x00, 0xFF, 0xF7, 0x82, 0xFD, 0x00, 0x28, 0x01, 0xD1, 0xFF, 0xF7, 0xDE, 0xFB,
-    0x3C, 0x42, 0x04, 0xD0, 0x00, 0x22, 0x31, 0x00, 0x28, 0x68, 0xFF, 0xF7, 0x77, 0xFD, 0xF4, 0x23,
-    0x1C, 0x42, 0x05, 0xD0, 0x00, 0x23, 0x69, 0x46, 0x30, 0x00, 0x01, 0xAA, 0xFF, 0xF7, 0x46, 0xFC,
-    0x05, 0x4B, 0x1C, 0x42, 0xDD, 0xD0, 0x00, 0xF0, 0x83, 0xFF, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0xA4, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x70, 0xB5, 0x80, 0x25,
-    0x0C, 0x4E, 0x0D, 0x4B, 0x1C, 0x68, 0x33, 0x68, 0xAD, 0x01, 0x1C, 0x19, 0x2A, 0x00, 0x01, 0x00,
-    0x20, 0x00, 0xFF, 0xF7, 0x03, 0xFB, 0x28, 0x00, 0xF3, 0x68, 0x22, 0x00, 0x01, 0x21, 0xFF, 0xF7,
-    0x6B, 0xFF, 0x80, 0x20, 0x01, 0x22, 0x00, 0x21, 0x40, 0x02, 0xFF, 0xF7, 0x47, 0xFD, 0x70, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0xA4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x06, 0x4B, 0x10, 0xB5,
-    0x18, 0x68, 0xFF, 0xF7, 0x29, 0xFF, 0x00, 0x22, 0x11, 0x00, 0xFF, 0xF7, 0xEF, 0xFC, 0xC0, 0x43,
-    0xC0, 0x0F, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x40, 0x73, 0x00, 0x03, 0x70, 0xB5, 0x05, 0x00,
-    0x00, 0x24, 0x0A, 0x4B, 0x1B, 0x68, 0xA3, 0x42, 0x05, 0xDC, 0x01, 0x24, 0x64, 0x42, 0x20, 0x00,
-    0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x20, 0x00, 0xFE, 0xF7, 0xF4, 0xFC, 0x40, 0x30, 0xFF, 0xF7,
-    0x0B, 0xFF, 0xA8, 0x42, 0xF3, 0xD0, 0x01, 0x34, 0xEB, 0xE7, 0xC0, 0x46, 0x90, 0x00, 0x00, 0x02,
-    0xF0, 0xB5, 0x38, 0x4B, 0x1B, 0x68, 0x05, 0x00, 0x87, 0xB0, 0x01, 0x20, 0x1B, 0x01, 0x35, 0xD5,
-    0x35, 0x4B, 0x9E, 0x68, 0x00, 0x2E, 0x01, 0xD1, 0x01, 0x20, 0x2F, 0xE0, 0x01, 0x21, 0x30, 0x00,
-    0x04, 0xAA, 0xFF, 0xF7, 0xBB, 0xFC, 0x04, 0x1E, 0x37, 0xDB, 0x30, 0x4F, 0x30, 0x22, 0x04, 0x99,
-    0x78, 0x68, 0x08, 0xF0, 0xE7, 0xFB, 0x2E, 0x4B, 0x18, 0x68, 0xE0, 0x23, 0x80, 0x26, 0x1B, 0x05,
-    0x7A, 0x68, 0xC0, 0x18, 0xFB, 0x68, 0xB6, 0x01, 0x31, 0x00, 0x00, 0x93, 0x30, 0x32, 0x05, 0xAB,
-    0xFD, 0xF7, 0x2A, 0xFD, 0x03, 0x21, 0x05, 0x9B, 0x7A, 0x68, 0x33, 0x33, 0x8B, 0x43, 0x04, 0x92,
-    0x20, 0x00, 0x13, 0x80, 0x56, 0x60, 0x00, 0x21, 0x01, 0x22, 0xFF, 0xF7, 0xDF, 0xFC, 0x04, 0x1E,
-    0x10, 0xD1, 0xFF, 0xF7, 0x3B, 0xFB, 0x00, 0x2D, 0x04, 0xD1, 0x00, 0x20, 0x07, 0xB0, 0xF0, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x04, 0x9B, 0x18, 0x88, 0xFF, 0xF7, 0x96, 0xFD, 0x20, 0x00, 0xFF, 0xF7,
-    0xB7, 0xFF, 0xF3, 0xE7, 0xFF, 0xF7, 0x52, 0xFE, 0xBE, 0xE7, 0x30, 0x00, 0xFF, 0xF7, 0x96, 0xFF,
-    0x04, 0x1E, 0xB9, 0xDB, 0x13, 0x4F, 0x14, 0x4E, 0x3B, 0x68, 0x02, 0x93, 0x33, 0x68, 0x03, 0x93,
-    0xFE, 0xF7, 0x90, 0xFC, 0x0E, 0x4B, 0x40, 0x30, 0x30, 0x60, 0x18, 0x68, 0xE0, 0x23, 0x1B, 0x05,
-    0xC0, 0x18, 0x3C, 0x60, 0xFF, 0xF7, 0x52, 0xFF, 0x02, 0x9B, 0x3B, 0x60, 0x03, 0x9B, 0x04, 0x1E,
-    0x33, 0x60, 0xDF, 0xD1, 0xFF, 0xF7, 0x0A, 0xFB, 0x00, 0x2D, 0xCE, 0xD0, 0x03, 0x4B, 0x5B, 0x68,
-    0x04, 0x93, 0xD0, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0x08, 0xEE, 0x03, 0x02, 0xA4, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x02, 0x44, 0x73, 0x00, 0x03, 0x40, 0x73, 0x00, 0x03, 0x7F, 0xB5, 0x1E, 0x4B,
-    0x1B, 0x68, 0x1B, 0x01, 0x05, 0xD5, 0x1D, 0x4D, 0x2B, 0x68, 0x00, 0x2B, 0x04, 0xD1, 0x1C, 0x4A,
-    0x13, 0x60, 0x7F, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x1A, 0x4B, 0x18, 0x68, 0xFF, 0xF7, 0x74, 0xFE,
-    0x03, 0x21, 0x02, 0xAA, 0xFF, 0xF7, 0x3A, 0xFC, 0x00, 0x28, 0x20, 0xDB, 0x00, 0x24, 0x02, 0x98,
-    0x15, 0x4E, 0x01, 0x88, 0x00, 0x94, 0x30, 0x39, 0xF2, 0x68, 0x03, 0xAB, 0x30, 0x30, 0x03, 0x91,
-    0xFD, 0xF7, 0x24, 0xFE, 0x01, 0x23, 0x03, 0x98, 0x03, 0x40, 0x42, 0x08, 0xD2, 0x18, 0x23, 0x00,
-    0xF1, 0x68, 0x2D, 0x68, 0x52, 0x00, 0x9A, 0x42, 0x05, 0xD1, 0x12, 0x21, 0x08, 0xF0, 0xA8, 0xFD,
-    0x07, 0x4B, 0x18, 0x60, 0xD5, 0xE7, 0xCC, 0x5A, 0xEC, 0x52, 0x02, 0x33, 0xF3, 0xE7, 0x00, 0x22,
-    0x03, 0x4B, 0x1A, 0x60, 0xCD, 0xE7, 0xC0, 0x46, 0x6C, 0x00, 0x00, 0x02, 0x2C, 0x00, 0x00, 0x02,
-    0x28, 0x00, 0x00, 0x02, 0x40, 0x73, 0x00, 0x03, 0xA4, 0x00, 0x00, 0x02, 0x1D, 0x4B, 0x1B, 0x68,
-    0x13, 0xB5, 0x1B, 0x01, 0x2C, 0xD5, 0x07, 0x20, 0xFE, 0xF7, 0xBC, 0xFB, 0x00, 0x22, 0x1A, 0x49,
-    0x29, 0x20, 0xFE, 0xF7, 0x59, 0xFB, 0x19, 0x4B, 0x18, 0x68, 0xFF, 0xF7, 0x2D, 0xFE, 0x03, 0x21,
-    0x01, 0xAA, 0xFF, 0xF7, 0xF3, 0xFB, 0x04, 0x1E, 0x01, 0xDA, 0x80, 0x24, 0x64, 0x02, 0x14, 0x4B,
-    0x1B, 0x68, 0x00, 0x2B, 0x17, 0xD0, 0x12, 0x20, 0x12, 0x4A, 0x58, 0x43, 0x12, 0x4B, 0x03, 0x21,
-    0x12, 0x68, 0xDB, 0x68, 0xFF, 0xF7, 0x48, 0xFE, 0x03, 0x22, 0x00, 0x21, 0x20, 0x00, 0xFF, 0xF7,
-    0x25, 0xFC, 0x00, 0x28, 0x01, 0xD1, 0xFF, 0xF7, 0x81, 0xFA, 0x02, 0x20, 0xFE, 0xF7, 0xF8, 0xFA,
-    0x13, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x80, 0x23, 0x5B, 0x02, 0x9C, 0x42, 0xF5, 0xDA, 0x03, 0x22,
-    0x01, 0x21, 0xEB, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0xA0, 0xE5, 0x00, 0x08, 0x40, 0x73, 0x00, 0x03,
-    0x28, 0x00, 0x00, 0x02, 0x2C, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x02, 0x19, 0x4B, 0x1B, 0x68,
-    0x37, 0xB5, 0x00, 0x24, 0x1B, 0x01, 0x24, 0xD5, 0x07, 0x20, 0xFE, 0xF7, 0x73, 0xFB, 0x22, 0x00,
-    0x15, 0x49, 0x29, 0x20, 0xFE, 0xF7, 0x10, 0xFB, 0x14, 0x4D, 0xE8, 0x68, 0xFF, 0xF7, 0x58, 0xF8,
-    0x21, 0x00, 0xEA, 0x68, 0x2B, 0x68, 0xFF, 0xF7, 0x0F, 0xFE, 0x11, 0x4B, 0x18, 0x68, 0xFF, 0xF7,
-    0xDB, 0xFD, 0x21, 0x00, 0x01, 0xAA, 0xFF, 0xF7, 0xA1, 0xFB, 0xA0, 0x42, 0x01, 0xDA, 0x80, 0x20,
-    0x40, 0x02, 0x00, 0x22, 0x11, 0x00, 0xFF, 0xF7, 0xE1, 0xFB, 0x04, 0x1E, 0x05, 0xD1, 0xFF, 0xF7,
-    0x3D, 0xFA, 0x20, 0x00, 0x3E, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x02, 0x20, 0xFE, 0xF7, 0xB0, 0xFA,
-    0x01, 0x24, 0xF6, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0xB5, 0xE5, 0x00, 0x08, 0xA4, 0x00, 0x00, 0x02,
-    0x40, 0x73, 0x00, 0x03, 0x05, 0x4B, 0x10, 0xB5, 0x18, 0x68, 0xFF, 0xF7, 0xB5, 0xFD, 0x04, 0x4B,
-    0x18, 0x61, 0xFF, 0xF7, 0xC1, 0xFC, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x40, 0x73, 0x00, 0x03,
-    0xA4, 0x00, 0x00, 0x02, 0x1F, 0xB5, 0x18, 0x4B, 0x1B, 0x68, 0x1B, 0x01, 0x25, 0xD5, 0x17, 0x4B,
-    0x1B, 0x78, 0x9B, 0x07, 0x21, 0xD5, 0x16, 0x4B, 0x18, 0x68, 0xFF, 0xF7, 0x9D, 0xFD, 0x01, 0x21,
-    0x02, 0xAA, 0xFF, 0xF7, 0x63, 0xFB, 0x13, 0x4C, 0x00, 0x28, 0x19, 0xDB, 0x00, 0x23, 0x02, 0x98,
-    0x01, 0x88, 0x22, 0x00, 0x00, 0x93, 0x30, 0x39, 0x30, 0x30, 0x03, 0xAB, 0x03, 0x91, 0xFD, 0xF7,
-    0x4D, 0xFD, 0x0D, 0x4B, 0x18, 0x68, 0xE0, 0x23, 0x80, 0x22, 0x1B, 0x05, 0x21, 0x00, 0xC0, 0x18,
-    0x92, 0x01, 0xFF, 0xF7, 0x43, 0xF9, 0xFF, 0xF7, 0xC5, 0xFF, 0x1F, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x20, 0x00, 0xFF, 0xF7, 0x2B, 0xFE, 0xEC, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0x64, 0x73, 0x00, 0x03,
-    0x40, 0x73, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x20, 0x10, 0xB5,
-    0xFF, 0xF7, 0x66, 0xFE, 0x0C, 0x4B, 0x1B, 0x78, 0x9B, 0x07, 0x12, 0xD5, 0xFF, 0xF7, 0xFE, 0xFC,
-    0x0A, 0x4B, 0x18, 0x68, 0xE0, 0x23, 0x80, 0x22, 0x1B, 0x05, 0xC0, 0x18, 0x08, 0x49, 0x92, 0x01,
-    0xFF, 0xF7, 0x1C, 0xF9, 0xFF, 0xF7, 0x9E, 0xFF, 0x01, 0x20, 0xFF, 0xF7, 0x51, 0xFE, 0xFF, 0xF7,
-    0xA9, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x64, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x08, 0x00, 0x03, 0x7F, 0xB5, 0x0C, 0x00, 0x00, 0x23, 0x05, 0x00, 0x20, 0x00, 0x0C, 0x4E,
-    0x09, 0x88, 0x00, 0x93, 0x30, 0x39, 0x03, 0xAB, 0xF2, 0x68, 0x30, 0x30, 0x03, 0x91, 0xFD, 0xF7,
-    0xFD, 0xFC, 0x28, 0x00, 0xF1, 0x68, 0x03, 0x9A, 0xFE, 0xF7, 0x4C, 0xFE, 0xFF, 0xF7, 0xAE, 0xFE,
-    0xA2, 0x68, 0x04, 0x4B, 0x1A, 0x60, 0xFF, 0xF7, 0xC1, 0xFF, 0x7F, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0xA4, 0x00, 0x00, 0x02, 0x60, 0x72, 0x00, 0x03, 0xF0, 0xB5, 0x00, 0x24, 0x85, 0xB0, 0x02, 0x94,
-    0xFF, 0xF7, 0x66, 0xF9, 0x2E, 0x4E, 0x23, 0x00, 0x20, 0x00, 0x02, 0xAA, 0x03, 0xA9, 0x34, 0x60,
-    0xFF, 0xF7, 0x04, 0xFA, 0x03, 0x9B, 0x05, 0x00, 0xA3, 0x42, 0x29, 0xD0, 0x20, 0x00, 0x00, 0xF0,
-    0x17, 0xFD, 0x01, 0x27, 0x03, 0x98, 0xFE, 0xF7, 0xBB, 0xF9, 0x02, 0x00, 0x04, 0x00, 0x3A, 0x40,
-    0x38, 0x42, 0x36, 0xD0, 0x23, 0x4B, 0xE8, 0x68, 0x1B, 0x68, 0x83, 0x42, 0x1C, 0xD1, 0x22, 0x4B,
-    0x18, 0x68, 0x00, 0x28, 0x1B, 0xDB, 0x29, 0x00, 0xFF, 0xF7, 0xB4, 0xFF, 0xF4, 0x23, 0x1C, 0x42,
-    0x06, 0xD0, 0x00, 0x23, 0x02, 0xAA, 0x18, 0x00, 0x03, 0xA9, 0xFF, 0xF7, 0xDF, 0xF9, 0x05, 0x00,
-    0x03, 0x9B, 0x00, 0x2B, 0x02, 0xD0, 0x19, 0x4B, 0x1C, 0x42, 0xDB, 0xD0, 0x00, 0xF0, 0x18, 0xFD,
-    0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xFF, 0xF7, 0xC8, 0xFD, 0xE1, 0xE7, 0x02, 0x20,
-    0xFE, 0xF7, 0xCE, 0xF9, 0x00, 0x22, 0x29, 0x20, 0x11, 0x49, 0xFE, 0xF7, 0x05, 0xFA, 0x3C, 0x23,
-    0x01, 0x93, 0x08, 0xF0, 0x9B, 0xFB, 0x01, 0x9B, 0x01, 0x3B, 0x01, 0x93, 0x00, 0x2B, 0xF8, 0xD1,
-    0xD4, 0xE7, 0x04, 0x23, 0x18, 0x42, 0xD1, 0xD0, 0x39, 0x00, 0x30, 0x68, 0xFF, 0xF7, 0xDE, 0xFA,
-    0x03, 0x9B, 0x31, 0x68, 0x5A, 0x1E, 0x8A, 0x42, 0xC8, 0xD1, 0x02, 0x3B, 0x33, 0x60, 0xC5, 0xE7,
-    0x8C, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x02, 0x44, 0x73, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00,
-    0xC8, 0xE5, 0x00, 0x08, 0x0C, 0x4B, 0x1B, 0x68, 0x07, 0xB5, 0x1B, 0x01, 0x03, 0xD4, 0x00, 0x20,
-    0x03, 0xB0, 0x02, 0xBC, 0x08, 0x47, 0x09, 0x4B, 0x18, 0x68, 0xFF, 0xF7, 0xAD, 0xFC, 0x00, 0x21,
-    0x01, 0xAA, 0xFF, 0xF7, 0x73, 0xFA, 0x00, 0x28, 0xF1, 0xDB, 0x05, 0x4B, 0x01, 0x99, 0x18, 0x68,
-    0xFF, 0xF7, 0x58, 0xFF, 0x01, 0x20, 0xEB, 0xE7, 0x6C, 0x00, 0x00, 0x02, 0x40, 0x73, 0x00, 0x03,
-    0x44, 0x73, 0x00, 0x03, 0x02, 0x4B, 0x18, 0x68, 0x80, 0x23, 0x1B, 0x05, 0x18, 0x40, 0x70, 0x47,
-    0x6C, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x0F, 0x48, 0x0F, 0x49, 0x03, 0x78, 0x0A, 0x68, 0x0F, 0x4C,
-    0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E, 0x14, 0x43, 0x03, 0x70, 0x0C, 0x60, 0x01, 0x2B, 0x07, 0xD1,
-    0x9A, 0x43, 0x80, 0x23, 0x5B, 0x02, 0x1A, 0x43, 0x0A, 0x60, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47,
-    0x02, 0x2B, 0x03, 0xD1, 0x06, 0x4B, 0x1A, 0x40, 0x01, 0x23, 0xF4, 0xE7, 0x00, 0x23, 0x03, 0x70,
-    0xF3, 0xE7, 0xC0, 0x46, 0xB8, 0x00, 0x00, 0x02, 0x24, 0x74, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00,
-    0xFF, 0xFF, 0xFE, 0xFF, 0x10, 0xB5, 0x10, 0x48, 0x10, 0x49, 0x43, 0x78, 0x0A, 0x68, 0x10, 0x4C,
-    0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E, 0x14, 0x43, 0x43, 0x70, 0x0C, 0x60, 0x01, 0x2B, 0x08, 0xD1,
-    0x01, 0x33, 0x9A, 0x43, 0x80, 0x23, 0x9B, 0x02, 0x1A, 0x43, 0x0A, 0x60, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0x02, 0x2B, 0x04, 0xD1, 0x07, 0x48, 0x02, 0x40, 0x13, 0x43, 0x0B, 0x60, 0xF5, 0xE7,
-    0x00, 0x23, 0x43, 0x70, 0xF2, 0xE7, 0xC0, 0x46, 0xB8, 0x00, 0x00, 0x02, 0x24, 0x74, 0x00, 0x03,
-    0x02, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0x0F, 0x4A, 0x93, 0x78, 0x01, 0x33, 0x1B, 0x06,
-    0x1B, 0x0E, 0x93, 0x70, 0x01, 0x2B, 0x03, 0xD1, 0x0C, 0x4B, 0x0D, 0x4A, 0x1A, 0x60, 0x70, 0x47,
-    0x02, 0x2B, 0x02, 0xD1, 0x09, 0x4B, 0x0B, 0x4A, 0xF8, 0xE7, 0x03, 0x2B, 0x03, 0xD1, 0xFE, 0x22,
-    0x06, 0x4B, 0xD2, 0x05, 0xF2, 0xE7, 0x03, 0x2B, 0xF1, 0xD9, 0x04, 0x4B, 0x06, 0x49, 0x19, 0x60,
-    0x00, 0x23, 0x93, 0x70, 0xEB, 0xE7, 0xC0, 0x46, 0xB8, 0x00, 0x00, 0x02, 0x60, 0x68, 0x00, 0x03,
-    0xA0, 0x8C, 0x00, 0x00, 0xE0, 0xA5, 0x01, 0x00, 0x50, 0x46, 0x00, 0x00, 0x05, 0x4A, 0x13, 0x78,
-    0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E, 0x02, 0x2B, 0x01, 0xD8, 0x13, 0x70, 0x70, 0x47, 0x00, 0x23,
-    0xFB, 0xE7, 0xC0, 0x46, 0xB2, 0x72, 0x00, 0x03, 0x01, 0x23, 0x02, 0x4A, 0x11, 0x78, 0x8B, 0x43,
-    0x13, 0x70, 0x70, 0x47, 0xC4, 0x5E, 0x00, 0x03, 0x80, 0x23, 0x03, 0x4A, 0x11, 0x68, 0xDB, 0x00,
-    0x4B, 0x40, 0x13, 0x60, 0x70, 0x47, 0xC0, 0x46, 0x24, 0x74, 0x00, 0x03, 0x07, 0x4A, 0x13, 0x78,
-    0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E, 0x01, 0x2B, 0x01, 0xD8, 0x13, 0x70, 0x70, 0x47, 0x00, 0x23,
-    0x13, 0x70, 0x01, 0x22, 0x02, 0x4B, 0x1A, 0x70, 0xF8, 0xE7, 0xC0, 0x46, 0x75, 0x73, 0x00, 0x03,
-    0x74, 0x73, 0x00, 0x03, 0x01, 0x23, 0x02, 0x4A, 0xD1, 0x78, 0x4B, 0x40, 0xD3, 0x70, 0x70, 0x47,
-    0xB8, 0x00, 0x00, 0x02, 0x02, 0x23, 0x02, 0x4A, 0xD1, 0x78, 0x4B, 0x40, 0xD3, 0x70, 0x70, 0x47,
-    0xB8, 0x00, 0x00, 0x02, 0x20, 0x23, 0x02, 0x4A, 0x11, 0x68, 0x4B, 0x40, 0x13, 0x60, 0x70, 0x47,
-    0x48, 0x73, 0x00, 0x03, 0x80, 0x22, 0x08, 0x4B, 0x1B, 0x68, 0x92, 0x05, 0x98, 0x18, 0xE0, 0x22,
-    0x10, 0xB5, 0x12, 0x06, 0x90, 0x42, 0x02, 0xD3, 0xC0, 0x22, 0xD2, 0x05, 0x98, 0x18, 0x08, 0xF0,
-    0x17, 0xFB, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x24, 0x74, 0x00, 0x03, 0x10, 0xB5, 0x07, 0x4A,
-    0x13, 0x78, 0x01, 0x33, 0x1B, 0x06, 0x1B, 0x0E, 0x04, 0x2B, 0x05, 0xD8, 0x13, 0x70, 0x08, 0xF0,
-    0x85, 0xFA, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x00, 0x23, 0xF7, 0xE7, 0xC6, 0x5E, 0x00, 0x03,
-    0x00, 0x22, 0x03, 0x21, 0x10, 0xB5, 0x06, 0x4B, 0x1A, 0x70, 0x06, 0x4A, 0x13, 0x78, 0x01, 0x33,
-    0x0B, 0x40, 0x13, 0x70, 0x08, 0xF0, 0x7A, 0xFA, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0xB3, 0x72, 0x00, 0x03, 0x49, 0x73, 0x00, 0x03, 0x70, 0xB5, 0x08, 0x4C, 0x05, 0x00, 0x20, 0x1D,
-    0x16, 0x00, 0x81, 0x42, 0x01, 0xD0, 0x08, 0xF0, 0xEF, 0xF9, 0x31, 0x00, 0x20, 0x1D, 0x08, 0xF0,
-    0xC1, 0xF9, 0x28, 0x00, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xC0, 0x46, 0xB8, 0x00, 0x00, 0x02,
-    0x10, 0xB5, 0x04, 0x00, 0x09, 0x4B, 0x1A, 0x68, 0x12, 0x1A, 0x53, 0x42, 0x5A, 0x41, 0x08, 0x4B,
-    0x19, 0x1D, 0x5B, 0x6A, 0xD8, 0x0F, 0xC0, 0x18, 0x23, 0x00, 0x40, 0x10, 0x0A, 0x33, 0x18, 0x1A,
-    0xFE, 0xF7, 0x92, 0xF8, 0x60, 0x1C, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x8C, 0x00, 0x00, 0x02,
-    0xB8, 0x00, 0x00, 0x02, 0x10, 0xB5, 0xFF, 0xF7, 0xCF, 0xFF, 0xFF, 0xF7, 0xE1, 0xFF, 0x10, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x04, 0x00, 0x06, 0x4B, 0x1A, 0x68, 0x06, 0x49, 0x12, 0x1A,
-    0x53, 0x42, 0x5A, 0x41, 0x25, 0x30, 0x04, 0x31, 0xFE, 0xF7, 0x76, 0xF8, 0x60, 0x1C, 0x10, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x8C, 0x00, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x02, 0x10, 0xB5, 0xFF, 0xF7,
-    0xB3, 0xFF, 0xFF, 0xF7, 0xE7, 0xFF, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x06, 0x4B, 0x18, 0x68,
-    0xC3, 0x06, 0x02, 0xD4, 0x40, 0x07, 0xC0, 0x0F, 0x70, 0x47, 0x08, 0x23, 0x18, 0x40, 0x43, 0x42,
-    0x58, 0x41, 0x02, 0x30, 0xF8, 0xE7, 0xC0, 0x46, 0x48, 0x73, 0x00, 0x03, 0x70, 0xB5, 0x01, 0x25,
-    0x02, 0x20, 0xFE, 0xF7, 0x15, 0xF8, 0x00, 0x22, 0x20, 0x20, 0x22, 0x49, 0xFE, 0xF7, 0x4C, 0xF8,
-    0x21, 0x4B, 0x1B, 0x78, 0x21, 0x4C, 0x9B, 0x00, 0x1A, 0x59, 0x21, 0x49, 0x00, 0x20, 0xFF, 0xF7,
-    0xD5, 0xFF, 0x20, 0x4B, 0x1B, 0x78, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x68, 0x1E, 0x49, 0xFF, 0xF7,
-    0xCD, 0xFF, 0x1E, 0x4B, 0x1B, 0x68, 0x9B, 0x0A, 0x2B, 0x40, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x68,
-    0x1B, 0x49, 0xFF, 0xF7, 0xC3, 0xFF, 0x1B, 0x4E, 0xB3, 0x78, 0x9B, 0x00, 0xE3, 0x18, 0x9A, 0x69,
-    0x19, 0x49, 0xFF, 0xF7, 0xBB, 0xFF, 0xF3, 0x78, 0x2B, 0x40, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x68,
-    0x16, 0x49, 0xFF, 0xF7, 0xB3, 0xFF, 0xF3, 0x78, 0x2B, 0x41, 0x2B, 0x40, 0x9B, 0x00, 0xE3, 0x18,
-    0xDA, 0x68, 0x13, 0x49, 0xFF, 0xF7, 0xAA, 0xFF, 0x05, 0x00, 0xFF, 0xF7, 0xAF, 0xFF, 0x80, 0x00,
-    0x24, 0x18, 0xA2, 0x6A, 0x28, 0x00, 0x0F, 0x49, 0xFF, 0xF7, 0xA0, 0xFF, 0x70, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0xDE, 0xE5, 0x00, 0x08, 0xB2, 0x72, 0x00, 0x03, 0xA8, 0xE0, 0x00, 0x08,
-    0xF4, 0xE5, 0x00, 0x08, 0xC4, 0x5E, 0x00, 0x03, 0xFC, 0xE5, 0x00, 0x08, 0x24, 0x74, 0x00, 0x03,
-    0x08, 0xE6, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x02, 0x13, 0xE6, 0x00, 0x08, 0x1F, 0xE6, 0x00, 0x08,
-    0x30, 0xE6, 0x00, 0x08, 0x41, 0xE6, 0x00, 0x08, 0x1C, 0x23, 0x0C, 0x4A, 0x11, 0x68, 0x99, 0x43,
-    0x0B, 0x00, 0x10, 0xB5, 0x02, 0x28, 0x0C, 0xD0, 0x03, 0x28, 0x0C, 0xD0, 0x01, 0x28, 0x05, 0xD0,
-    0x13, 0x60, 0x08, 0xF0, 0x05, 0xFA, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x0C, 0x21, 0x0B, 0x43,
-    0xF6, 0xE7, 0x18, 0x21, 0xFB, 0xE7, 0x10, 0x21, 0xF9, 0xE7, 0xC0, 0x46, 0x48, 0x73, 0x00, 0x03,
-    0x10, 0xB5, 0xFF, 0xF7, 0x6B, 0xFF, 0x03, 0x23, 0x01, 0x30, 0x18, 0x40, 0xFF, 0xF7, 0xDC, 0xFF,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x04, 0x00, 0x09, 0x4B, 0x1A, 0x68, 0x12, 0x1A,
-    0x53, 0x42, 0x5A, 0x41, 0x07, 0x4B, 0x5B, 0x6A, 0xD8, 0x0F, 0xC0, 0x18, 0x23, 0x00, 0x40, 0x10,
-    0x0A, 0x33, 0x18, 0x1A, 0xFD, 0xF7, 0xB8, 0xFF, 0x60, 0x1C, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0x8C, 0x00, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x02, 0x10, 0xB5, 0x04, 0x00, 0x05, 0x4B, 0x1A, 0x68,
-    0x12, 0x1A, 0x53, 0x42, 0x5A, 0x41, 0x25, 0x30, 0xFD, 0xF7, 0xA6, 0xFF, 0x60, 0x1C, 0x10, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x8C, 0x00, 0x00, 0x02, 0x70, 0xB5, 0x04, 0x00, 0x15, 0x00, 0x88, 0x42,
-    0x01, 0xD0, 0x08, 0xF0, 0xD9, 0xF8, 0x29, 0x00, 0x20, 0x00, 0x08, 0xF0, 0xAB, 0xF8, 0x70, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x70, 0xB5, 0x01, 0x20, 0xFD, 0xF7, 0x52, 0xFF, 0x27, 0x4B, 0x1B, 0x78,
-    0x27, 0x4C, 0x28, 0x4D, 0x9B, 0x00, 0xE3, 0x18, 0x2E, 0x1D, 0x9A, 0x6B, 0x30, 0x00, 0x26, 0x49,
-    0xFF, 0xF7, 0xE2, 0xFF, 0x00, 0x22, 0x31, 0x00, 0x13, 0x20, 0xFD, 0xF7, 0x7D, 0xFF, 0x23, 0x49,
-    0x00, 0x20, 0xFF, 0xF7, 0xB0, 0xFF, 0x6B, 0x78, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x68, 0x20, 0x49,
-    0xFF, 0xF7, 0xE8, 0xFE, 0x2B, 0x78, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x68, 0x1D, 0x49, 0xFF, 0xF7,
-    0xE1, 0xFE, 0x1D, 0x4B, 0x1B, 0x68, 0x5B, 0x0F, 0x01, 0x3B, 0x9B, 0x00, 0xE3, 0x18, 0xDA, 0x6C,
-    0x1A, 0x49, 0xFF, 0xF7, 0xD7, 0xFE, 0x1A, 0x49, 0xFF, 0xF7, 0x95, 0xFF, 0x19, 0x49, 0xFF, 0xF7,
-    0x92, 0xFF, 0x6B, 0x6A, 0x18, 0x4E, 0x19, 0x4D, 0x19, 0x4C, 0x09, 0x2B, 0x0B, 0xD1, 0x31, 0x00,
-    0xFF, 0xF7, 0x89, 0xFF, 0x29, 0x00, 0xFF, 0xF7, 0x86, 0xFF, 0x21, 0x00, 0xFF, 0xF7, 0x83, 0xFF,
-    0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x13, 0x49, 0xFF, 0xF7, 0x7D, 0xFF, 0x12, 0x49, 0xFF, 0xF7,
-    0x7A, 0xFF, 0x12, 0x49, 0xFF, 0xF7, 0x77, 0xFF, 0xE9, 0xE7, 0xC0, 0x46, 0x3D, 0x00, 0x00, 0x02,
-    0xA8, 0xE0, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x02, 0x4A, 0xE6, 0x00, 0x08, 0x63, 0xE6, 0x00, 0x08,
-    0x72, 0xE6, 0x00, 0x08, 0x7F, 0xE6, 0x00, 0x08, 0x24, 0x74, 0x00, 0x03, 0x8C, 0xE6, 0x00, 0x08,
-    0x99, 0xE6, 0x00, 0x08, 0xA3, 0xE6, 0x00, 0x08, 0xB4, 0xE6, 0x00, 0x08, 0xBA, 0xE6, 0x00, 0x08,
-    0xC2, 0xE6, 0x00, 0x08, 0xC7, 0xE6, 0x00, 0x08, 0xD4, 0xE6, 0x00, 0x08, 0xE1, 0xE6, 0x00, 0x08,
-    0x70, 0xB5, 0x04, 0x00, 0x16, 0x00, 0x1D, 0x00, 0x88, 0x42, 0x01, 0xD0, 0x08, 0xF0, 0x54, 0xF8,
-    0x31, 0x00, 0x20, 0x00, 0x08, 0xF0, 0x26, 0xF8, 0x29, 0x00, 0x20, 0x00, 0x08, 0xF0, 0x22, 0xF8,
-    0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x70, 0xB5, 0x04, 0x00, 0x16, 0x00, 0x1D, 0x00, 0x88, 0x42,
-    0x01, 0xD0, 0x08, 0xF0, 0x41, 0xF8, 0x31, 0x00, 0x20, 0x00, 0x08, 0xF0, 0x13, 0xF8, 0x29, 0x00,
-    0x20, 0x00, 0x08, 0xF0, 0x0F, 0xF8, 0x20, 0x00, 0x04, 0x99, 0x08, 0xF0, 0x0B, 0xF8, 0x70, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x70, 0xB5, 0x86, 0xB0, 0x01, 0xAD, 0x0E, 0x00, 0x11, 0x22, 0x0D, 0x49,
-    0x04, 0x00, 0x28, 0x00, 0x07, 0xF0, 0xBE, 0xFE, 0x00, 0x22, 0x08, 0x20, 0x0F, 0x21, 0x0A, 0x4B,
-    0x80, 0x1B, 0x1A, 0x72, 0x07, 0x32, 0x90, 0x42, 0x04, 0xDD, 0x18, 0x18, 0x06, 0xB0, 0x70, 0xBC,
-    0x02, 0xBC, 0x08, 0x47, 0x26, 0x00, 0x0E, 0x40, 0xAE, 0x5D, 0x24, 0x09, 0x9E, 0x54, 0x01, 0x3A,
-    0xF1, 0xE7, 0xC0, 0x46, 0xEF, 0xE6, 0x00, 0x08, 0x94, 0x76, 0x00, 0x03, 0xF7, 0xB5, 0x02, 0x20,
-    0xFD, 0xF7, 0x8E, 0xFE, 0x00, 0x22, 0x20, 0x20, 0x21, 0x49, 0xFD, 0xF7, 0xC5, 0xFE, 0x03, 0x22,
-    0x01, 0x26, 0x20, 0x4D, 0x2B, 0x78, 0x20, 0x4C, 0x13, 0x40, 0x9B, 0x00, 0xE3, 0x18, 0x5A, 0x6E,
-    0x1E, 0x49, 0x00, 0x20, 0xFF, 0xF7, 0x4A, 0xFE, 0x1D, 0x4B, 0x1B, 0x78, 0x9B, 0x00, 0xE3, 0x18,
-    0x5A, 0x6F, 0x1C, 0x49, 0xFF, 0xF7, 0x42, 0xFE, 0x1B, 0x4B, 0x1B, 0x78, 0x9B, 0x00, 0xE4, 0x18,
-    0xE2, 0x6F, 0x1A, 0x49, 0xFF, 0xF7, 0x3A, 0xFE, 0x19, 0x4F, 0x3B, 0x68, 0x5B, 0x09, 0x19, 0x4C,
-    0x33, 0x40, 0x9B, 0x00, 0xE3, 0x18, 0x1A, 0x69, 0x17, 0x49, 0xFF, 0xF7, 0x2F, 0xFE, 0x3B, 0x68,
-    0x01, 0x90, 0x5B, 0x09, 0xA8, 0x78, 0x1E, 0x40, 0x6B, 0x78, 0x00, 0x02, 0x18, 0x43, 0xB6, 0x00,
-    0x00, 0x04, 0x04, 0x21, 0xA6, 0x19, 0x00, 0x14, 0xB6, 0x69, 0xFF, 0xF7, 0x9B, 0xFF, 0x31, 0x00,
-    0x02, 0x00, 0x01, 0x98, 0xFF, 0xF7, 0x1A, 0xFE, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0x00, 0xE7, 0x00, 0x08, 0x49, 0x73, 0x00, 0x03, 0xA8, 0xE0, 0x00, 0x08, 0x17, 0xE7, 0x00, 0x08,
-    0x75, 0x73, 0x00, 0x03, 0x21, 0xE7, 0x00, 0x08, 0xC6, 0x5E, 0x00, 0x03, 0x2B, 0xE7, 0x00, 0x08,
-    0x48, 0x73, 0x00, 0x03, 0x28, 0xE1, 0x00, 0x08, 0x33, 0xE7, 0x00, 0x08, 0x00, 0xB5, 0x16, 0x4B,
-    0x1B, 0x78, 0x89, 0xB0, 0x00, 0x2B, 0x24, 0xD0, 0x14, 0x49, 0x68, 0x46, 0x07, 0xF0, 0xA4, 0xFF,
-    0x08, 0xF0, 0x32, 0xF8, 0x6A, 0x46, 0x83, 0x06, 0x9B, 0x0F, 0x30, 0x33, 0x13, 0x75, 0x0F, 0x23,
-    0x02, 0x00, 0x69, 0x46, 0x1A, 0x40, 0x30, 0x32, 0x4A, 0x75, 0x02, 0x13, 0x1A, 0x40, 0x30, 0x32,
-    0xCA, 0x75, 0x02, 0x12, 0x1A, 0x40, 0x30, 0x32, 0x0A, 0x76, 0x02, 0x15, 0x1A, 0x40, 0x30, 0x32,
-    0x8A, 0x76, 0x00, 0x22, 0x00, 0x14, 0x18, 0x40, 0x30, 0x30, 0xC8, 0x76, 0x10, 0x00, 0xFD, 0xF7,
-    0x43, 0xFE, 0x09, 0xB0, 0x01, 0xBC, 0x00, 0x47, 0x3E, 0x00, 0x00, 0x02, 0x46, 0xE7, 0x00, 0x08,
-    0x80, 0x22, 0x58, 0x4B, 0x1B, 0x68, 0x12, 0x05, 0x93, 0x42, 0x9B, 0x41, 0x80, 0x22, 0xF0, 0xB5,
-    0x5F, 0x42, 0x55, 0x4B, 0x1B, 0x68, 0x52, 0x02, 0x01, 0x20, 0x1A, 0x40, 0x51, 0x42, 0x4A, 0x41,
-    0x04, 0x00, 0x82, 0x40, 0x51, 0x49, 0x9C, 0x43, 0x22, 0x43, 0x0A, 0x70, 0x5A, 0x08, 0x90, 0x43,
-    0x80, 0x22, 0x92, 0x02, 0x13, 0x40, 0x5A, 0x42, 0x53, 0x41, 0x00, 0x24, 0x5B, 0x00, 0x03, 0x43,
-    0x4B, 0x70, 0x4B, 0x4B, 0x01, 0x33, 0xDB, 0x19, 0xDB, 0x7F, 0x4A, 0x4E, 0x4B, 0x62, 0x4A, 0x4B,
-    0x1C, 0x60, 0x33, 0x88, 0x89, 0xB0, 0x02, 0x93, 0x48, 0x4D, 0x34, 0x80, 0x2B, 0x88, 0x03, 0x93,
-    0x47, 0x4B, 0x2C, 0x80, 0x1C, 0x60, 0xFF, 0xF7, 0x75, 0xFE, 0x05, 0x96, 0x06, 0x95, 0x07, 0xF0,
-    0x9D, 0xFF, 0x20, 0x00, 0xFD, 0xF7, 0x5E, 0xFE, 0x63, 0x01, 0x42, 0x4D, 0x5B, 0x42, 0xE0, 0x33,
-    0x01, 0x34, 0x2B, 0x60, 0xFD, 0xF7, 0x1E, 0xFD, 0x08, 0x2C, 0xF0, 0xD1, 0x01, 0x20, 0xFF, 0xF7,
-    0xC7, 0xF9, 0x04, 0x1E, 0x04, 0xD1, 0xFF, 0xF7, 0x5D, 0xFE, 0x2C, 0x60, 0xFD, 0xF7, 0x12, 0xFD,
-    0x39, 0x4A, 0x13, 0x88, 0xDB, 0x43, 0x39, 0x49, 0x07, 0x92, 0x0B, 0x60, 0xFF, 0xF7, 0x76, 0xFF,
-    0x2F, 0x4D, 0x6B, 0x1C, 0xDB, 0x19, 0xD8, 0x7F, 0xFD, 0xF7, 0x62, 0xFD, 0x01, 0x23, 0x03, 0x40,
-    0x04, 0x93, 0x01, 0x23, 0x04, 0x00, 0x18, 0x42, 0x18, 0xD0, 0x2D, 0x4E, 0x33, 0x68, 0x01, 0x93,
-    0xBB, 0x00, 0x01, 0x9A, 0xED, 0x18, 0xAB, 0x6A, 0x92, 0x00, 0xD3, 0x58, 0x00, 0xF0, 0xB0, 0xFA,
-    0x80, 0x22, 0x01, 0x9B, 0x33, 0x60, 0x1F, 0x4B, 0x1B, 0x68, 0x12, 0x05, 0x93, 0x42, 0x9B, 0x41,
-    0x5B, 0x42, 0xBB, 0x42, 0x02, 0xD0, 0x00, 0x23, 0x04, 0x9F, 0x33, 0x60, 0xF1, 0x23, 0x1C, 0x42,
-    0x01, 0xD0, 0xFF, 0xF7, 0x27, 0xFE, 0x22, 0x4B, 0x1C, 0x42, 0xCF, 0xD0, 0xFE, 0xF7, 0x80, 0xFE,
-    0x00, 0x28, 0x01, 0xD1, 0xFF, 0xF7, 0xDE, 0xFA, 0x01, 0x25, 0x08, 0x26, 0x07, 0xF0, 0x46, 0xFF,
-    0x70, 0x1B, 0xFD, 0xF7, 0x07, 0xFE, 0x17, 0x4B, 0x6A, 0x01, 0x01, 0x35, 0x1A, 0x60, 0xFD, 0xF7,
-    0xC9, 0xFC, 0x09, 0x2D, 0xF2, 0xD1, 0x07, 0x3D, 0x2C, 0x42, 0x0C, 0xD1, 0x05, 0x9B, 0x02, 0x9A,
-    0x1A, 0x80, 0x06, 0x9B, 0x03, 0x9A, 0x03, 0x20, 0x1A, 0x80, 0xFD, 0xF7, 0x59, 0xFD, 0x09, 0xB0,
-    0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x07, 0xF0, 0x29, 0xFF, 0x07, 0x9B, 0x1C, 0x88, 0xE4, 0x43,
-    0xEA, 0xE7, 0xC0, 0x46, 0x6C, 0x00, 0x00, 0x02, 0x24, 0x74, 0x00, 0x03, 0xB8, 0x00, 0x00, 0x02,
-    0x28, 0xE1, 0x00, 0x08, 0x80, 0x00, 0x00, 0x04, 0x6C, 0x72, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04,
-    0x8C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x30, 0x01, 0x00, 0x04, 0x88, 0x00, 0x00, 0x02,
-    0x02, 0x03, 0x00, 0x00, 0x10, 0xB5, 0x07, 0x24, 0x20, 0x00, 0xFD, 0xF7, 0xCB, 0xFD, 0x07, 0xF0,
-    0x05, 0xFF, 0x01, 0x3C, 0xF8, 0xD2, 0x00, 0x24, 0x20, 0x00, 0x01, 0x34, 0xFD, 0xF7, 0xEE, 0xFD,
-    0x07, 0xF0, 0xFC, 0xFE, 0x11, 0x2C, 0xF7, 0xD1, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5,
-    0x0C, 0x4B, 0xDB, 0x78, 0x9B, 0x07, 0x01, 0xD5, 0xFF, 0xF7, 0x38, 0xFA, 0xFF, 0xF7, 0xE2, 0xFF,
-    0x80, 0x23, 0x80, 0x22, 0x00, 0x24, 0xDB, 0x04, 0x1A, 0x80, 0x07, 0x4B, 0x1C, 0x60, 0x07, 0x4B,
-    0x1C, 0x60, 0xFD, 0xF7, 0x6F, 0xFC, 0x06, 0x4B, 0x1C, 0x80, 0x07, 0xF0, 0xD7, 0xFE, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0xB8, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02,
-    0x50, 0x00, 0x00, 0x04, 0x10, 0xB5, 0xFF, 0xF7, 0xC5, 0xFF, 0x07, 0xF0, 0xBB, 0xFE, 0x07, 0x20,
-    0xFD, 0xF7, 0x90, 0xFD, 0x05, 0x4B, 0x1B, 0x88, 0xDB, 0x43, 0x9B, 0x05, 0x02, 0xD1, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x07, 0xF0, 0xC2, 0xFE, 0xF4, 0xE7, 0xC0, 0x46, 0x30, 0x01, 0x00, 0x04,
-    0x70, 0xB5, 0x05, 0x00, 0x00, 0x24, 0x00, 0x2D, 0x03, 0xD0, 0x20, 0x00, 0x08, 0x30, 0xFD, 0xF7,
-    0x79, 0xFD, 0x06, 0x4B, 0x62, 0x01, 0x01, 0x34, 0x1A, 0x60, 0xFD, 0xF7, 0x3B, 0xFC, 0x07, 0xF0,
-    0xAD, 0xFE, 0x09, 0x2C, 0xEF, 0xD1, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x80, 0x00, 0x00, 0x02,
-    0x10, 0xB5, 0xFE, 0xF7, 0xF1, 0xFE, 0x01, 0x20, 0xFF, 0xF7, 0xE2, 0xFF, 0x03, 0x4B, 0x9D, 0x46,
-    0xFD, 0xF7, 0x4C, 0xFE, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x00, 0x7F, 0x00, 0x03,
-    0x10, 0xB5, 0x80, 0x24, 0x64, 0x00, 0x07, 0xF0, 0x91, 0xFE, 0x07, 0x4B, 0x1C, 0x60, 0x20, 0x3C,
-    0xFD, 0xF7, 0x18, 0xFC, 0x23, 0x00, 0x20, 0x33, 0xF5, 0xD1, 0x02, 0x20, 0xFD, 0xF7, 0xB0, 0xFC,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x80, 0x00, 0x00, 0x02, 0xF0, 0xB5, 0x00, 0x24,
-    0x21, 0x4F, 0x83, 0x00, 0x21, 0x4E, 0xFB, 0x18, 0x1B, 0x6C, 0x85, 0xB0, 0x34, 0x60, 0x05, 0x00,
-    0x00, 0x93, 0x00, 0xF0, 0xBD, 0xF9, 0x20, 0x00, 0xFF, 0xF7, 0xB2, 0xFF, 0x1C, 0x4A, 0x13, 0x88,
-    0xDB, 0x43, 0x1C, 0x49, 0x0B, 0x60, 0x7B, 0x1C, 0x5B, 0x19, 0xDB, 0x7F, 0x03, 0x92, 0x02, 0x93,
-    0x02, 0x98, 0xFD, 0xF7, 0x4D, 0xFC, 0x01, 0x23, 0x04, 0x00, 0x18, 0x42, 0x0B, 0xD0, 0x33, 0x68,
-    0x01, 0x93, 0xAB, 0x00, 0x01, 0x9A, 0xFB, 0x18, 0x9B, 0x6A, 0x92, 0x00, 0xD3, 0x58, 0x00, 0xF0,
-    0x9F, 0xF9, 0x01, 0x9B, 0x33, 0x60, 0xF1, 0x23, 0x1C, 0x42, 0x02, 0xD0, 0x00, 0x9B, 0x00, 0xF0,
-    0x97, 0xF9, 0x0D, 0x4B, 0x1C, 0x42, 0xE3, 0xD0, 0xFF, 0xF7, 0xB2, 0xFF, 0x02, 0x25, 0x2C, 0x42,
-    0x03, 0xD1, 0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x07, 0xF0, 0x3F, 0xFE, 0x03, 0x9B,
-    0x1C, 0x88, 0xE4, 0x43, 0xF3, 0xE7, 0xC0, 0x46, 0x28, 0xE1, 0x00, 0x08, 0x8C, 0x00, 0x00, 0x02,
-    0x30, 0x01, 0x00, 0x04, 0x88, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x00, 0x10, 0xB5, 0x02, 0x20,
-    0xFF, 0xF7, 0xAC, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x03, 0x20, 0xFF, 0xF7,
-    0xA5, 0xFF, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x10, 0xB5, 0x04, 0x20, 0xFF, 0xF7, 0x9E, 0xFF,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x02, 0x23, 0x10, 0xB5, 0x04, 0x4A, 0x11, 0x68, 0x4B, 0x40,
-    0x13, 0x60, 0x07, 0xF0, 0x91, 0xFE, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x48, 0x73, 0x00, 0x03,
-    0x01, 0x23, 0x10, 0xB5, 0x04, 0x4A, 0x11, 0x68, 0x4B, 0x40, 0x13, 0x60, 0x07, 0xF0, 0x84, 0xFE,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x48, 0x73, 0x00, 0x03, 0xF7, 0xB5, 0x1F, 0x24,
-    0x16, 0x00, 0x00, 0x25, 0x25, 0x30, 0x20, 0x40, 0x40, 0x01, 0x4C, 0x1C, 0x04, 0x19, 0x01, 0x93,
-    0x64, 0x00, 0x70, 0x5D, 0x1F, 0x28, 0x02, 0xD8, 0xF7, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xFD, 0xF7,
-    0x2F, 0xFB, 0x0B, 0x4B, 0xE7, 0x18, 0x80, 0x23, 0xDB, 0x01, 0xC0, 0x18, 0x01, 0x9B, 0x38, 0x80,
-    0x9D, 0x42, 0x09, 0xD1, 0x70, 0x5D, 0x20, 0x28, 0x00, 0xD1, 0x3F, 0x30, 0xFD, 0xF7, 0x20, 0xFB,
-    0xA0, 0x23, 0xDB, 0x01, 0xC0, 0x18, 0x38, 0x80, 0x01, 0x35, 0x02, 0x34, 0xE1, 0xE7, 0xC0, 0x46,
-    0x00, 0x20, 0x00, 0x06, 0xF0, 0xB5, 0x1F, 0x00, 0x85, 0xB0, 0x01, 0x3B, 0x00, 0x90, 0x01, 0x91,
-    0x10, 0x00, 0x39, 0x00, 0x15, 0x00, 0x03, 0x93, 0xFF, 0xF7, 0x3C, 0xFD, 0x01, 0x99, 0x02, 0x00,
-    0x7B, 0x1E, 0x00, 0x98, 0xFF, 0xF7, 0xC2, 0xFF, 0x24, 0x4A, 0x13, 0x88, 0xDB, 0x43, 0x24, 0x49,
-    0x02, 0x92, 0x0B, 0x60, 0x7C, 0x1E, 0x07, 0xF0, 0xB9, 0xFD, 0x21, 0x49, 0x02, 0x9B, 0x0A, 0x68,
-    0x1B, 0x88, 0x1A, 0x43, 0xDB, 0x43, 0x0B, 0x60, 0x10, 0x23, 0x93, 0x43, 0x59, 0x1E, 0x8B, 0x41,
-    0xE4, 0x18, 0x20, 0x23, 0x93, 0x43, 0xD6, 0x43, 0x5A, 0x1E, 0x93, 0x41, 0xE4, 0x1A, 0x20, 0x00,
-    0x39, 0x00, 0x07, 0xF0, 0x19, 0xFE, 0x03, 0x9B, 0x5A, 0x1A, 0x01, 0x23, 0x92, 0x00, 0x0C, 0x00,
-    0x93, 0x40, 0x72, 0x06, 0x00, 0xD5, 0xED, 0x18, 0x32, 0x06, 0x00, 0xD5, 0xED, 0x1A, 0xF0, 0x23,
-    0x1E, 0x42, 0x09, 0xD0, 0x39, 0x00, 0x28, 0x00, 0xFF, 0xF7, 0x04, 0xFD, 0x23, 0x00, 0x02, 0x00,
-    0x01, 0x99, 0x00, 0x98, 0xFF, 0xF7, 0x8A, 0xFF, 0x0A, 0x4B, 0x1E, 0x42, 0xCB, 0xD0, 0x03, 0x24,
-    0x26, 0x42, 0x04, 0xD1, 0x28, 0x00, 0x05, 0xB0, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x07, 0xF0,
-    0x7D, 0xFD, 0x02, 0x9B, 0x1E, 0x88, 0xF6, 0x43, 0xF2, 0xE7, 0xC0, 0x46, 0x30, 0x01, 0x00, 0x04,
-    0x88, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x70, 0xB5, 0xFF, 0xF7, 0x07, 0xFD, 0x0D, 0x4B,
-    0x1B, 0x68, 0x9B, 0x06, 0x0C, 0x4A, 0xDB, 0x0F, 0x9B, 0x00, 0xD3, 0x18, 0x98, 0x69, 0x07, 0xF0,
-    0x13, 0xFD, 0x0A, 0x4C, 0xA2, 0x78, 0x63, 0x78, 0x12, 0x02, 0x1A, 0x43, 0x04, 0x23, 0x01, 0x00,
-    0x18, 0x00, 0xFF, 0xF7, 0x87, 0xFF, 0x03, 0x04, 0x1B, 0x0E, 0x60, 0x70, 0xA3, 0x70, 0x70, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0x48, 0x73, 0x00, 0x03, 0x28, 0xE1, 0x00, 0x08, 0x49, 0x73, 0x00, 0x03,
-    0xF0, 0xB5, 0x85, 0xB0, 0x02, 0x93, 0x00, 0x23, 0x17, 0x00, 0x01, 0x91, 0x00, 0x90, 0xFF, 0xF7,
-    0x45, 0xFF, 0x2B, 0x4A, 0x13, 0x88, 0xDB, 0x43, 0x00, 0x24, 0x2A, 0x49, 0x03, 0x92, 0x0B, 0x60,
-    0x07, 0xF0, 0x3C, 0xFD, 0x27, 0x49, 0x03, 0x9B, 0x0A, 0x68, 0x1B, 0x88, 0x1A, 0x43, 0xDB, 0x43,
-    0x0B, 0x60, 0x10, 0x23, 0x93, 0x43, 0x59, 0x1E, 0x8B, 0x41, 0xE4, 0x18, 0x20, 0x23, 0xD6, 0x43,
-    0x93, 0x43, 0x02, 0xD0, 0x02, 0x9B, 0x01, 0x3B, 0xE4, 0x18, 0x20, 0x00, 0x02, 0x99, 0x07, 0xF0,
-    0x9B, 0xFD, 0x0C, 0x00, 0x7D, 0x18, 0x73, 0x06, 0x02, 0xD5, 0x2B, 0x78, 0x01, 0x33, 0x2B, 0x70,
-    0xB3, 0x05, 0x02, 0xD5, 0x2B, 0x78, 0x0A, 0x33, 0x2B, 0x70, 0x33, 0x06, 0x02, 0xD5, 0x2B, 0x78,
-    0x5E, 0x33, 0x2B, 0x70, 0xF3, 0x05, 0x02, 0xD5, 0x2B, 0x78, 0x55, 0x33, 0x2B, 0x70, 0x28, 0x78,
-    0x5F, 0x21, 0x20, 0x38, 0x07, 0xF0, 0x64, 0xFD, 0xFC, 0x23, 0x20, 0x31, 0x9B, 0x00, 0x29, 0x70,
-    0x1E, 0x42, 0x05, 0xD0, 0x23, 0x00, 0x3A, 0x00, 0x01, 0x99, 0x00, 0x98, 0xFF, 0xF7, 0xFE, 0xFE,
-    0x03, 0x23, 0x1E, 0x42, 0xBC, 0xD0, 0x1C, 0x00, 0x07, 0xF0, 0xF8, 0xFC, 0x22, 0x00, 0x03, 0x9B,
-    0x1B, 0x88, 0x9A, 0x43, 0xF8, 0xD1, 0x05, 0xB0, 0xF0, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0x30, 0x01, 0x00, 0x04, 0x88, 0x00, 0x00, 0x02, 0xF7, 0xB5, 0x0C, 0x00, 0x01, 0x90, 0x00, 0x25,
-    0x08, 0x00, 0x0A, 0x27, 0x39, 0x00, 0x06, 0x00, 0x01, 0x35, 0x07, 0xF0, 0x71, 0xFD, 0x09, 0x2E,
-    0xF8, 0xD8, 0x01, 0x9B, 0x5D, 0x19, 0x00, 0x23, 0x0A, 0x27, 0x2B, 0x70, 0x6E, 0x1E, 0x20, 0x00,
-    0x39, 0x00, 0x07, 0xF0, 0x49, 0xFD, 0x01, 0x3E, 0x30, 0x31, 0x20, 0x00, 0x71, 0x70, 0x39, 0x00,
-    0x01, 0x94, 0x07, 0xF0, 0x5D, 0xFD, 0x01, 0x9B, 0x04, 0x00, 0x09, 0x2B, 0xEF, 0xD8, 0x28, 0x00,
-    0xFE, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x10, 0xB5, 0x04, 0x4C, 0x09, 0x34, 0x01, 0x00, 0x20, 0x00,
-    0xFF, 0xF7, 0xD2, 0xFF, 0x20, 0x00, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x94, 0x76, 0x00, 0x03,
-    0x18, 0x47, 0xC0, 0x46, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7,
-    0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x95, 0x1E, 0x00, 0xEA,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7, 0x01, 0x04, 0x80, 0xE2,
-    0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x12, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x86, 0x1E, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7, 0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7,
-    0x01, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x5C, 0x25, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x77, 0x1E, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0,
-    0x20, 0xCC, 0xDB, 0xE7, 0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1,
-    0x01, 0x0C, 0x40, 0x22, 0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3,
-    0x40, 0x80, 0xC8, 0x73, 0x12, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x64, 0x1E, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7,
-    0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x55, 0xE0, 0x43, 0x3C, 0xA0, 0xE1,
-    0x01, 0x80, 0x88, 0xE3, 0x12, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x54, 0x1E, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7,
-    0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0,
-    0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x12, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x41, 0x1E, 0x00, 0xEA,
-    0x0B, 0xB0, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x3C, 0x1E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0x00, 0x00, 0x80, 0xE0,
-    0x00, 0x5C, 0x95, 0xE1, 0x25, 0x3C, 0x85, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x0C, 0x00, 0xCB, 0xE7,
-    0x0F, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x31, 0x1E, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x5C, 0x95, 0xE1,
-    0x25, 0x3C, 0x85, 0xE1, 0x01, 0x80, 0x88, 0x23, 0x01, 0x80, 0xC8, 0x33, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x1F, 0x1E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0,
-    0x2C, 0x0C, 0xDB, 0xE7, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x5C, 0x95, 0xE1, 0x25, 0x3C, 0x85, 0xE1,
-    0x01, 0x80, 0x88, 0xE3, 0x2C, 0x0C, 0xCB, 0xE7, 0x12, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x13, 0x1E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x5C, 0x95, 0xE1, 0x25, 0x3C, 0x85, 0xE1,
-    0x01, 0x80, 0x88, 0x23, 0x01, 0x80, 0xC8, 0x33, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x00, 0x1E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x00, 0x80, 0xE0, 0x00, 0x5C, 0x95, 0xE1, 0x25, 0x3C, 0x85, 0xE1, 0x01, 0x80, 0x88, 0x23,
-    0x01, 0x80, 0xC8, 0x33, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xED, 0x1D, 0x00, 0xEA,
-    0x01, 0x90, 0x89, 0xE2, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xE8, 0x1D, 0x00, 0xEA, 0x01, 0x90, 0x89, 0xE2, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xE3, 0x1D, 0x00, 0xEA, 0x01, 0x90, 0x89, 0xE2, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xDE, 0x1D, 0x00, 0xEA, 0x02, 0x90, 0x89, 0xE2,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD9, 0x1D, 0x00, 0xEA,
-    0x02, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD2, 0x1D, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5,
-    0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x80, 0xE1,
-    0x03, 0x5C, 0xA0, 0xE1, 0x05, 0x60, 0xA0, 0xE1, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xBF, 0x1D, 0x00, 0xEA, 0x00, 0x00, 0xA0, 0xE1, 0x02, 0x19, 0x81, 0xE2,
-    0x01, 0x00, 0xD9, 0xE4, 0x06, 0x60, 0x05, 0xE0, 0x00, 0x6C, 0x56, 0xE0, 0x46, 0x3C, 0xA0, 0xE1,
-    0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xB5, 0x1D, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x06, 0x00, 0x05, 0xE0,
-    0x20, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xA9, 0x1D, 0x00, 0xEA,
-    0x04, 0xE0, 0x2D, 0xE5, 0x28, 0x05, 0xDA, 0xE5, 0x02, 0x00, 0x10, 0xE3, 0x74, 0x10, 0x9F, 0x15,
-    0x54, 0x10, 0x0A, 0x15, 0x70, 0x00, 0x9F, 0xE5, 0x00, 0x00, 0x90, 0xE5, 0x0E, 0x0A, 0x50, 0xE3,
-    0x7C, 0x00, 0x1F, 0x05, 0x84, 0x00, 0x1F, 0x15, 0x60, 0x10, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5,
-    0x89, 0x0D, 0x00, 0xEB, 0x2F, 0x0C, 0x00, 0xEB, 0x00, 0x50, 0xA0, 0xE3, 0x00, 0x60, 0xA0, 0xE3,
-    0x00, 0x70, 0xA0, 0xE3, 0x00, 0x30, 0xA0, 0xE3, 0x44, 0x40, 0x4A, 0xE2, 0x40, 0x00, 0x9F, 0xE5,
-    0x1C, 0x04, 0x8A, 0xE5, 0x4D, 0x80, 0xC8, 0xE3, 0x24, 0x54, 0x8A, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0x30, 0x0B, 0x00, 0xEB, 0x00, 0x00, 0xA0, 0xE3, 0xE1, 0x0A, 0x00, 0xEB, 0x24, 0xC0, 0x9F, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x20, 0xF0, 0x9F, 0xE5, 0x15, 0x8C, 0x48, 0xE2, 0x01, 0x0B, 0x8A, 0xE2,
-    0xF8, 0x03, 0x80, 0xE8, 0x04, 0xF0, 0x9D, 0xE4, 0xF4, 0x52, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x53, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0xB8, 0x44, 0x00, 0x03,
-    0xF0, 0x47, 0x2D, 0xE9, 0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0xC1, 0xE4, 0x00, 0x30, 0x1F, 0xE5,
-    0x00, 0xF0, 0x1F, 0xE5, 0x01, 0x01, 0x01, 0x01, 0x30, 0x45, 0x00, 0x03, 0x00, 0x01, 0x02, 0x03,
-    0x04, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x19,
-    0x1A, 0x20, 0x21, 0x22, 0x28, 0x2A, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
-    0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x55, 0x56, 0x57, 0x58, 0x5C, 0x5D, 0x5E, 0x61, 0x63,
-    0x69, 0x76, 0x77, 0x8C, 0x97, 0x98, 0x9E, 0xA3, 0xB2, 0xB4, 0xB8, 0xBB, 0xCE, 0xE4, 0xE8, 0xF5,
-    0xF9, 0xFC, 0xFE, 0x00, 0x50, 0x9B, 0x00, 0x08, 0xC8, 0x9B, 0x00, 0x08, 0x64, 0x9B, 0x00, 0x08,
-    0x78, 0x9B, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0x80, 0xB3, 0x00, 0x08, 0x8C, 0x9B, 0x00, 0x08,
-    0xD8, 0xC7, 0x00, 0x08, 0xFC, 0xC7, 0x00, 0x08, 0x70, 0x9D, 0x00, 0x08, 0xE4, 0x9D, 0x00, 0x08,
-    0xC8, 0x9F, 0x00, 0x08, 0x74, 0xA3, 0x00, 0x08, 0x74, 0xA4, 0x00, 0x08, 0x34, 0xA7, 0x00, 0x08,
-    0x60, 0xA9, 0x00, 0x08, 0x6C, 0xAA, 0x00, 0x08, 0x9C, 0xAB, 0x00, 0x08, 0xD0, 0xAC, 0x00, 0x08,
-    0x60, 0xA9, 0x00, 0x08, 0xE4, 0xAC, 0x00, 0x08, 0x84, 0xAD, 0x00, 0x08, 0xE4, 0xAD, 0x00, 0x08,
-    0x84, 0xAE, 0x00, 0x08, 0x84, 0xB2, 0x00, 0x08, 0xF4, 0xB2, 0x00, 0x08, 0x14, 0xB9, 0x00, 0x08,
-    0xDC, 0xBB, 0x00, 0x08, 0x84, 0x9D, 0x00, 0x08, 0xB0, 0xBD, 0x00, 0x08, 0x58, 0xBF, 0x00, 0x08,
-    0xBC, 0xBF, 0x00, 0x08, 0xBC, 0xC1, 0x00, 0x08, 0xA0, 0x9B, 0x00, 0x08, 0x04, 0xC2, 0x00, 0x08,
-    0x40, 0xC2, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0xD4, 0xC2, 0x00, 0x08, 0x94, 0xC3, 0x00, 0x08,
-    0xFC, 0xC3, 0x00, 0x08, 0x4C, 0xC4, 0x00, 0x08, 0xA0, 0xC4, 0x00, 0x08, 0xF8, 0xC4, 0x00, 0x08,
-    0x6C, 0xC6, 0x00, 0x08, 0xE0, 0xC6, 0x00, 0x08, 0x34, 0xC7, 0x00, 0x08, 0x54, 0xC7, 0x00, 0x08,
-    0x94, 0xC8, 0x00, 0x08, 0xF0, 0xC8, 0x00, 0x08, 0x28, 0xC9, 0x00, 0x08, 0x48, 0xC9, 0x00, 0x08,
-    0x84, 0xC9, 0x00, 0x08, 0x0C, 0x9C, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08,
-    0x84, 0x9D, 0x00, 0x08, 0x64, 0x9F, 0x00, 0x08, 0xBC, 0xC1, 0x00, 0x08, 0x14, 0xB9, 0x00, 0x08,
-    0x80, 0xA1, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0xB4, 0x9B, 0x00, 0x08, 0xE4, 0xA6, 0x00, 0x08,
-    0xE0, 0xAE, 0x00, 0x08, 0x5C, 0xAF, 0x00, 0x08, 0xF0, 0xAA, 0x00, 0x08, 0x6C, 0xAC, 0x00, 0x08,
-    0xE0, 0xAE, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08, 0xE0, 0xAE, 0x00, 0x08,
-    0x50, 0x9B, 0x00, 0x08, 0x11, 0xFF, 0x2F, 0xE1, 0xF0, 0x4F, 0x2D, 0xE9, 0x98, 0xA3, 0x9F, 0xE5,
-    0x98, 0xB3, 0x9F, 0xE5, 0x98, 0x13, 0x9F, 0xE5, 0x7A, 0x24, 0xDA, 0xE5, 0x7B, 0x04, 0xDA, 0xE5,
-    0x02, 0x00, 0x10, 0xE1, 0x8C, 0x13, 0x9F, 0x15, 0x04, 0x00, 0x00, 0x1A, 0x02, 0x20, 0xB0, 0xE1,
-    0x02, 0x00, 0x00, 0x0A, 0x80, 0x13, 0x9F, 0xE5, 0x17, 0x20, 0xA0, 0xE3, 0x00, 0x00, 0x00, 0xEA,
-    0xE7, 0x20, 0xA0, 0xE3, 0x74, 0x03, 0x9F, 0xE5, 0x00, 0x20, 0xC0, 0xE5, 0x06, 0x0C, 0x8A, 0xE2,
-    0x20, 0x20, 0xA0, 0xE3, 0x04, 0x03, 0x00, 0xEB, 0x01, 0x0B, 0x8A, 0xE2, 0xD0, 0x00, 0x80, 0xE2,
-    0x00, 0x10, 0xE0, 0xE3, 0x30, 0x20, 0xA0, 0xE3, 0xFF, 0x02, 0x00, 0xEB, 0x50, 0x03, 0x9F, 0xE5,
-    0x00, 0x05, 0x8A, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x34, 0x05, 0xCA, 0xE5, 0x44, 0x13, 0x9F, 0xE5,
-    0x30, 0x15, 0x8A, 0xE5, 0xC8, 0x44, 0x9A, 0xE5, 0xCC, 0x54, 0x9A, 0xE5, 0x1C, 0x25, 0x9A, 0xE5,
-    0x02, 0x01, 0x12, 0xE3, 0x01, 0x00, 0x00, 0x5A, 0xD0, 0x44, 0x8A, 0xE5, 0xD4, 0x54, 0x8A, 0xE5,
-    0x00, 0x90, 0xA0, 0xE3, 0x28, 0x94, 0x8A, 0xE5, 0x44, 0x40, 0x4A, 0xE2, 0x00, 0x00, 0xA0, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x10, 0xF3, 0x9F, 0xE5, 0x00, 0x00, 0xE0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x08, 0xF3, 0x9F, 0xE5, 0x08, 0x03, 0x9F, 0xE5, 0x08, 0x13, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5,
-    0x04, 0x13, 0x9F, 0xE5, 0x04, 0x03, 0x9F, 0xE5, 0x00, 0x10, 0x80, 0xE5, 0x00, 0x13, 0x9F, 0xE5,
-    0x00, 0x03, 0x9F, 0xE5, 0x00, 0x10, 0x80, 0xE5, 0xFC, 0x12, 0x9F, 0xE5, 0x0C, 0x10, 0x0A, 0xE5,
-    0xF8, 0x12, 0x9F, 0xE5, 0x10, 0x10, 0x0A, 0xE5, 0xF4, 0x12, 0x9F, 0xE5, 0x50, 0x10, 0x0A, 0xE5,
-    0xF0, 0x12, 0x9F, 0xE5, 0x54, 0x10, 0x0A, 0xE5, 0xEC, 0x12, 0x9F, 0xE5, 0x38, 0x10, 0x0A, 0xE5,
-    0xC9, 0x0C, 0x00, 0xEB, 0xFE, 0x0C, 0x00, 0xEB, 0xE8, 0x03, 0x00, 0xEB, 0x7F, 0x01, 0x00, 0xEB,
-    0xFA, 0x0A, 0x00, 0xEB, 0x2A, 0x0B, 0x00, 0xEB, 0x00, 0x00, 0xA0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xC8, 0xF2, 0x9F, 0xE5, 0x2B, 0x05, 0xDA, 0xE5, 0xA9, 0x1F, 0x4F, 0xE2, 0xC0, 0x52, 0x9F, 0xE5,
-    0x01, 0x20, 0xD1, 0xE4, 0x00, 0x00, 0x52, 0xE1, 0x01, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x51, 0xE1,
-    0xFA, 0xFF, 0xFF, 0x1A, 0x0B, 0x4D, 0x4F, 0xE2, 0x00, 0x00, 0xA0, 0xE1, 0x04, 0x10, 0x41, 0xE0,
-    0xA1, 0x5F, 0x4F, 0xE2, 0x01, 0x11, 0x85, 0xE0, 0x20, 0xE0, 0x8F, 0xE2, 0x58, 0x50, 0x4A, 0xE2,
-    0x04, 0x00, 0x11, 0xE5, 0x1E, 0x00, 0xB0, 0xE8, 0x04, 0x10, 0x05, 0xE4, 0x04, 0x20, 0x05, 0xE4,
-    0x04, 0x30, 0x05, 0xE4, 0x04, 0x40, 0x05, 0xE4, 0x44, 0x40, 0x4A, 0xE2, 0x00, 0xF0, 0xA0, 0xE1,
-    0x28, 0x15, 0xDA, 0xE5, 0x01, 0x00, 0x11, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x64, 0xF2, 0x9F, 0xE5,
-    0x0E, 0xFF, 0xFF, 0xEB, 0xF0, 0x4F, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x58, 0xC2, 0x9F, 0xE5,
-    0x58, 0x02, 0x9F, 0xE5, 0x00, 0x00, 0x90, 0xE5, 0x54, 0x12, 0x9F, 0xE5, 0x00, 0x10, 0x91, 0xE5,
-    0x00, 0x20, 0xA0, 0xE3, 0x1C, 0xFF, 0x2F, 0xE1, 0x56, 0x45, 0x52, 0x53, 0x43, 0x50, 0x55, 0x53,
-    0x47, 0x46, 0x58, 0x53, 0x52, 0x41, 0x4D, 0x20, 0x53, 0x52, 0x41, 0x4D, 0x56, 0x52, 0x4D, 0x31,
-    0x56, 0x52, 0x4D, 0x32, 0x56, 0x52, 0x4D, 0x34, 0x4D, 0x41, 0x50, 0x52, 0x50, 0x41, 0x4C, 0x32,
-    0x4D, 0x49, 0x52, 0x32, 0x4F, 0x41, 0x4D, 0x20, 0x53, 0x4E, 0x44, 0x30, 0x53, 0x4E, 0x44, 0x31,
-    0x54, 0x49, 0x4D, 0x45, 0x4E, 0x4F, 0x50, 0x45, 0xFF, 0x5F, 0x2D, 0xE9, 0x98, 0xA1, 0x9F, 0xE5,
-    0x5C, 0x00, 0x00, 0xEB, 0x0F, 0xE0, 0xA0, 0xE1, 0xF8, 0xF1, 0x9F, 0xE5, 0x10, 0x05, 0x9A, 0xE5,
-    0x20, 0x17, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x1A, 0x01, 0x0C, 0x10, 0xE3, 0xE8, 0x01, 0x9F, 0x15,
-    0xE8, 0x01, 0x9F, 0x05, 0x04, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x51, 0xE3, 0xE0, 0x01, 0x9F, 0x05,
-    0x02, 0x00, 0x51, 0xE3, 0xDC, 0x01, 0x9F, 0x05, 0xDC, 0x01, 0x9F, 0xC5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xD8, 0xF1, 0x9F, 0xE5, 0x5A, 0x04, 0xDA, 0xE5, 0x00, 0x10, 0xA0, 0xE1, 0x00, 0x20, 0xA0, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xC8, 0xF1, 0x9F, 0xE5, 0x58, 0x04, 0xDA, 0xE5, 0x04, 0x00, 0x10, 0xE3,
-    0x01, 0x10, 0xA0, 0x03, 0x20, 0x10, 0xA0, 0x13, 0x55, 0x14, 0xCA, 0xE5, 0xB4, 0x01, 0x9F, 0xE5,
-    0x00, 0x10, 0xC0, 0xE5, 0xB0, 0x01, 0x9F, 0xE5, 0x00, 0x10, 0xC0, 0xE5, 0xAC, 0x01, 0x9F, 0xE5,
-    0xAC, 0x11, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0x44, 0x04, 0x9A, 0xE5, 0x60, 0x04, 0x8A, 0xE5,
-    0x48, 0x04, 0x9A, 0xE5, 0x68, 0x04, 0x8A, 0xE5, 0x01, 0x2B, 0x8A, 0xE2, 0xC8, 0x20, 0x82, 0xE2,
-    0x03, 0x00, 0x92, 0xE8, 0x6D, 0x2E, 0x8A, 0xE2, 0x03, 0x00, 0x92, 0xE8, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x50, 0xF1, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x78, 0xF1, 0x9F, 0xE5, 0xFF, 0x5F, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0x0C, 0x00, 0x00, 0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02, 0xB0, 0x5D, 0x00, 0x03, 0xB0, 0x5D, 0x00, 0x03,
-    0xB0, 0x5D, 0x00, 0x03, 0xB0, 0x5D, 0x00, 0x03, 0x02, 0x0D, 0x00, 0x00, 0x8C, 0xE5, 0x03, 0x02,
-    0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0xF0, 0x5D, 0x00, 0x03,
-    0xF0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03, 0x02, 0x4C, 0x00, 0x00,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02,
-    0xB0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03, 0xB0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03,
-    0x02, 0x8C, 0x00, 0x00, 0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02,
-    0x8C, 0xE5, 0x03, 0x02, 0xB0, 0x5D, 0x00, 0x03, 0xB0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03,
-    0xF0, 0x5D, 0x00, 0x03, 0x02, 0xCC, 0x00, 0x00, 0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02,
-    0x8C, 0xB9, 0x03, 0x02, 0x8C, 0xBD, 0x03, 0x02, 0xB0, 0x5D, 0x00, 0x03, 0xF0, 0x5D, 0x00, 0x03,
-    0xFC, 0x5D, 0x00, 0x03, 0x08, 0x5E, 0x00, 0x03, 0x00, 0x00, 0xA0, 0xE3, 0x34, 0x05, 0xCA, 0xE5,
-    0xE0, 0x06, 0xCA, 0xE5, 0x58, 0x24, 0xDA, 0xE5, 0x10, 0x00, 0x12, 0xE3, 0xC8, 0x04, 0x9A, 0x05,
-    0xCC, 0x04, 0x9A, 0x15, 0x30, 0x05, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x3C, 0x6E, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x84, 0x5D, 0x00, 0x03, 0x68, 0x5D, 0x00, 0x03,
-    0x67, 0x5D, 0x00, 0x03, 0x0C, 0x08, 0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0xD8, 0x47, 0x00, 0x03,
-    0x24, 0x48, 0x00, 0x03, 0x80, 0x30, 0x00, 0x06, 0x18, 0x51, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03,
-    0x20, 0x51, 0x00, 0x03, 0xB8, 0x52, 0x00, 0x03, 0xAC, 0x50, 0x00, 0x03, 0x88, 0x50, 0x00, 0x03,
-    0xDC, 0x52, 0x00, 0x03, 0xB0, 0x50, 0x00, 0x03, 0xE8, 0x52, 0x00, 0x03, 0x00, 0xA8, 0xFF, 0x02,
-    0xB4, 0x4A, 0x00, 0x03, 0x44, 0x60, 0x00, 0x08, 0xC4, 0x46, 0x00, 0x03, 0xB5, 0x1A, 0x00, 0x08,
-    0x44, 0x73, 0x00, 0x03, 0x48, 0x73, 0x00, 0x03, 0x48, 0x4B, 0x00, 0x03, 0x58, 0x64, 0x00, 0x08,
-    0x34, 0x64, 0x00, 0x08, 0x7C, 0x64, 0x00, 0x08, 0xA0, 0x64, 0x00, 0x08, 0xC4, 0x64, 0x00, 0x08,
-    0xD4, 0x46, 0x00, 0x03, 0x2C, 0x59, 0x00, 0x03, 0x50, 0x5D, 0x00, 0x03, 0x18, 0x5D, 0x00, 0x03,
-    0xCC, 0x59, 0x00, 0x03, 0x38, 0x58, 0x00, 0x03, 0x9C, 0x95, 0x00, 0x08, 0x01, 0x00, 0xA0, 0xE1,
-    0x01, 0x20, 0x42, 0xE0, 0x00, 0x10, 0xA0, 0xE3, 0x03, 0x02, 0x00, 0xEA, 0xF0, 0x5F, 0x2D, 0xE9,
-    0x7C, 0xA1, 0x9F, 0xE5, 0x01, 0x1B, 0x8A, 0xE2, 0x00, 0x10, 0x81, 0xE2, 0x01, 0x2B, 0x8A, 0xE2,
-    0x30, 0x20, 0x82, 0xE2, 0xF4, 0xFF, 0xFF, 0xEB, 0x01, 0x1B, 0x8A, 0xE2, 0x3C, 0x10, 0x81, 0xE2,
-    0x01, 0x2B, 0x8A, 0xE2, 0x74, 0x20, 0x82, 0xE2, 0xEF, 0xFF, 0xFF, 0xEB, 0x01, 0x1B, 0x8A, 0xE2,
-    0x90, 0x10, 0x81, 0xE2, 0x01, 0x2B, 0x8A, 0xE2, 0x9E, 0x20, 0x82, 0xE2, 0xEA, 0xFF, 0xFF, 0xEB,
-    0x01, 0x30, 0xA0, 0xE3, 0x55, 0x34, 0xCA, 0xE5, 0x01, 0x1B, 0x8A, 0xE2, 0xA0, 0x10, 0x81, 0xE2,
-    0x05, 0x2C, 0x8A, 0xE2, 0x38, 0x20, 0x82, 0xE2, 0xE3, 0xFF, 0xFF, 0xEB, 0x05, 0x1C, 0x8A, 0xE2,
-    0x44, 0x10, 0x81, 0xE2, 0x05, 0x2C, 0x8A, 0xE2, 0xC8, 0x20, 0x82, 0xE2, 0xDE, 0xFF, 0xFF, 0xEB,
-    0x05, 0x1C, 0x8A, 0xE2, 0xFC, 0x10, 0x81, 0xE2, 0x06, 0x2C, 0x8A, 0xE2, 0x00, 0x20, 0x82, 0xE2,
-    0xD9, 0xFF, 0xFF, 0xEB, 0x06, 0x1C, 0x8A, 0xE2, 0x40, 0x10, 0x81, 0xE2, 0x06, 0x2C, 0x8A, 0xE2,
-    0x60, 0x20, 0x82, 0xE2, 0xD4, 0xFF, 0xFF, 0xEB, 0x06, 0x0C, 0x8A, 0xE2, 0x80, 0x00, 0x80, 0xE2,
-    0xE0, 0x10, 0x9F, 0xE5, 0x20, 0x20, 0xA0, 0xE3, 0xD7, 0x01, 0x00, 0xEB, 0x06, 0x1C, 0x8A, 0xE2,
-    0xF4, 0x10, 0x81, 0xE2, 0x06, 0x2C, 0x8A, 0xE2, 0xF8, 0x20, 0x82, 0xE2, 0xCA, 0xFF, 0xFF, 0xEB,
-    0x07, 0x1C, 0x8A, 0xE2, 0x0C, 0x10, 0x81, 0xE2, 0x02, 0x2B, 0x8A, 0xE2, 0x14, 0x20, 0x82, 0xE2,
-    0xC5, 0xFF, 0xFF, 0xEB, 0x00, 0x00, 0xA0, 0xE3, 0xD0, 0x06, 0x8A, 0xE5, 0xD4, 0x06, 0x8A, 0xE5,
-    0xE0, 0x06, 0xCA, 0xE5, 0xE8, 0x06, 0xCA, 0xE5, 0x11, 0x1D, 0xA0, 0xE3, 0xE4, 0x16, 0x8A, 0xE5,
-    0x58, 0x04, 0xDA, 0xE5, 0x04, 0x00, 0x10, 0xE3, 0x01, 0x10, 0xA0, 0x03, 0x20, 0x10, 0xA0, 0x13,
-    0x55, 0x14, 0xCA, 0xE5, 0x80, 0x00, 0x9F, 0xE5, 0x00, 0x10, 0xC0, 0xE5, 0x7C, 0x00, 0x9F, 0xE5,
-    0x00, 0x10, 0xC0, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0xCC, 0x06, 0x00, 0xEB, 0xC4, 0x06, 0x00, 0xEB,
-    0xFF, 0x00, 0xE0, 0xE3, 0xE8, 0x06, 0x8A, 0xE5, 0x64, 0x04, 0x8A, 0xE5, 0x6C, 0x04, 0x8A, 0xE5,
-    0xE0, 0x06, 0x8A, 0xE5, 0xF0, 0x5F, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x44, 0x2D, 0xE9,
-    0x3C, 0xA0, 0x9F, 0xE5, 0x48, 0x10, 0x9F, 0xE5, 0xBC, 0x06, 0x9A, 0xE5, 0x1E, 0x2E, 0xA0, 0xE3,
-    0xAD, 0x01, 0x00, 0xEB, 0xB8, 0x06, 0x9A, 0xE5, 0x1E, 0x2E, 0xA0, 0xE3, 0xAA, 0x01, 0x00, 0xEB,
-    0x00, 0x10, 0xA0, 0xE3, 0xB4, 0x06, 0x9A, 0xE5, 0x1E, 0x2E, 0xA0, 0xE3, 0xA6, 0x01, 0x00, 0xEB,
-    0xB0, 0x06, 0x9A, 0xE5, 0x1E, 0x2E, 0xA0, 0xE3, 0xA3, 0x01, 0x00, 0xEB, 0x00, 0x44, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x3C, 0x6E, 0x00, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x50, 0x5D, 0x00, 0x03,
-    0x18, 0x5D, 0x00, 0x03, 0x40, 0x04, 0x40, 0x04, 0xFE, 0x47, 0x2D, 0xE9, 0x78, 0x80, 0x9F, 0xE5,
-    0x00, 0x80, 0x98, 0xE5, 0x01, 0x00, 0x58, 0xE3, 0x48, 0x80, 0x9F, 0x05, 0x48, 0x80, 0x9F, 0x15,
-    0x68, 0x20, 0x9F, 0xE5, 0x00, 0x80, 0x82, 0xE5, 0x64, 0x80, 0x9F, 0xE5, 0x00, 0x80, 0x98, 0xE7,
-    0x60, 0x20, 0x9F, 0xE5, 0x00, 0x80, 0x82, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x01, 0x30, 0xA0, 0xE3,
-    0x54, 0x20, 0x9F, 0xE5, 0x54, 0x70, 0x9F, 0xE5, 0x00, 0x70, 0x97, 0xE5, 0x50, 0x50, 0x9F, 0xE5,
-    0x00, 0x50, 0x95, 0xE5, 0x04, 0x50, 0x45, 0xE2, 0x00, 0x60, 0xA0, 0xE3, 0x44, 0x90, 0x9F, 0xE5,
-    0x00, 0x90, 0xD9, 0xE5, 0x40, 0xF0, 0x9F, 0xE5, 0x0A, 0x00, 0x58, 0xE1, 0x09, 0x00, 0x58, 0xE1,
-    0x03, 0x00, 0x00, 0x0A, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x00, 0x00, 0xCA, 0x03, 0x00, 0x00, 0xBA,
-    0x03, 0x00, 0x00, 0xAA, 0x03, 0x00, 0x00, 0xDA, 0x03, 0x00, 0x00, 0xEA, 0x18, 0x00, 0x00, 0x02,
-    0x44, 0x4F, 0x00, 0x03, 0xC0, 0x67, 0x00, 0x08, 0x48, 0x4F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
-    0x24, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x1C, 0x00, 0x00, 0x02, 0x2C, 0x4F, 0x00, 0x03,
-    0x02, 0xCC, 0x80, 0xE2, 0xB2, 0x20, 0xCC, 0xE1, 0xA8, 0x00, 0x00, 0xEA, 0x0B, 0xB0, 0xA0, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xFF, 0xEF, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE3,
-    0x01, 0x10, 0xA0, 0xE3, 0x00, 0x00, 0x04, 0xEF, 0x1E, 0xFF, 0x2F, 0xE1, 0x44, 0x02, 0x9F, 0xE5,
-    0x00, 0xC0, 0xA0, 0xE3, 0x00, 0x00, 0x0D, 0xEF, 0x3C, 0x12, 0x9F, 0xE5, 0x01, 0x00, 0x50, 0xE1,
-    0x01, 0xC0, 0xA0, 0x03, 0x34, 0x12, 0x9F, 0xE5, 0x01, 0x00, 0x50, 0xE1, 0x02, 0xC0, 0xA0, 0x03,
-    0x2C, 0x12, 0x9F, 0xE5, 0x01, 0x00, 0x50, 0xE1, 0x04, 0xC0, 0xA0, 0x03, 0x0C, 0x00, 0xA0, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x50, 0x01, 0x00, 0x00, 0xB6, 0xFE, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x06, 0x02, 0x00, 0x07,
-    0x24, 0x60, 0x4F, 0xE2, 0x7F, 0x00, 0x96, 0xE8, 0xB8, 0x10, 0xC5, 0xE0, 0xB8, 0x00, 0xC5, 0xE0,
-    0xB8, 0x00, 0xC5, 0xE0, 0xB8, 0x3E, 0xC5, 0xE0, 0xB8, 0x20, 0xC5, 0xE0, 0xB8, 0x00, 0xC5, 0xE0,
-    0xB8, 0x00, 0xC5, 0xE0, 0xB8, 0x3E, 0xC5, 0xE0, 0xF6, 0xFF, 0xFF, 0x1A, 0xB8, 0x10, 0xC6, 0xE0,
-    0xB8, 0x00, 0xC6, 0xE0, 0xB8, 0x00, 0xC6, 0xE0, 0xB8, 0x4E, 0xC6, 0xE0, 0xB8, 0x20, 0xC6, 0xE0,
-    0xB8, 0x00, 0xC6, 0xE0, 0xB8, 0x00, 0xC6, 0xE0, 0xB0, 0x40, 0xC6, 0xE1, 0x00, 0x44, 0x2D, 0xE9,
-    0xB0, 0xA1, 0x9F, 0xE5, 0xB0, 0x01, 0x9F, 0xE5, 0xB0, 0x11, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5,
-    0x0D, 0x05, 0xDA, 0xE5, 0xA8, 0x31, 0x9F, 0xE5, 0x02, 0x00, 0x50, 0xE3, 0x07, 0x00, 0x00, 0x2A,
-    0x50, 0x30, 0x43, 0xE2, 0x4E, 0x00, 0xE0, 0xE3, 0x01, 0x00, 0xC3, 0xE4, 0x01, 0x00, 0x80, 0xE2,
-    0x01, 0x0C, 0x50, 0xE3, 0xFB, 0xFF, 0xFF, 0x1A, 0x00, 0x44, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x03, 0x05, 0xA0, 0xE3, 0xF3, 0x14, 0xA0, 0xE3, 0xEF, 0x14, 0xA0, 0x83, 0x21, 0x2C, 0xA0, 0xE1,
-    0x01, 0x20, 0xC3, 0xE4, 0x00, 0x10, 0x81, 0xE0, 0xB4, 0x00, 0x52, 0xE3, 0xFA, 0xFF, 0xFF, 0x1A,
-    0x00, 0x44, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x33, 0xA0, 0xE3, 0xBA, 0x3B, 0xC3, 0xE1,
-    0xB6, 0x3C, 0xC3, 0xE1, 0xBE, 0x3D, 0xC3, 0xE1, 0x48, 0x11, 0x9F, 0xE5, 0x48, 0x01, 0x9F, 0xE5,
-    0xB1, 0x00, 0x83, 0xE1, 0xB0, 0x18, 0xD3, 0xE1, 0xB0, 0x38, 0xC3, 0xE1, 0xB0, 0x00, 0xD3, 0xE1,
-    0x80, 0x00, 0x80, 0xE3, 0xB0, 0x00, 0xC3, 0xE1, 0x00, 0x00, 0x03, 0xEF, 0xB0, 0x00, 0xD3, 0xE1,
-    0x80, 0x00, 0xC0, 0xE3, 0xB0, 0x00, 0xC3, 0xE1, 0xB0, 0x18, 0xC3, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x18, 0x31, 0x9F, 0xE5, 0x01, 0x10, 0xA0, 0xE3, 0xB4, 0x10, 0xC3, 0xE1, 0x07, 0x10, 0xA0, 0xE3,
-    0xB2, 0x10, 0xC3, 0xE1, 0x01, 0x10, 0xA0, 0xE3, 0xB0, 0x10, 0xC3, 0xE1, 0x05, 0x10, 0xA0, 0xE3,
-    0xB0, 0x10, 0xC3, 0xE1, 0x65, 0x20, 0xA0, 0xE3, 0x08, 0xC0, 0xA0, 0xE3, 0x02, 0x10, 0xA0, 0xE3,
-    0x22, 0x13, 0x01, 0xE0, 0x04, 0x10, 0x81, 0xE3, 0xB0, 0x10, 0xC3, 0xE1, 0x22, 0x13, 0xA0, 0xE1,
-    0x05, 0x10, 0x81, 0xE3, 0xB0, 0x10, 0xC3, 0xE1, 0x82, 0x20, 0xA0, 0xE1, 0x01, 0xC0, 0x5C, 0xE2,
-    0xF5, 0xFF, 0xFF, 0x1A, 0x05, 0x10, 0xA0, 0xE3, 0xB2, 0x10, 0xC3, 0xE1, 0x00, 0x20, 0xA0, 0xE3,
-    0x20, 0xC0, 0xA0, 0xE3, 0x04, 0x10, 0xA0, 0xE3, 0xB0, 0x10, 0xC3, 0xE1, 0x05, 0x10, 0xA0, 0xE3,
-    0xB0, 0x10, 0xC3, 0xE1, 0xB0, 0x10, 0xD3, 0xE1, 0x02, 0x10, 0x01, 0xE2, 0xA2, 0x20, 0xA0, 0xE1,
-    0x01, 0x2F, 0x82, 0xE1, 0x01, 0xC0, 0x5C, 0xE2, 0xF5, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xA0, 0xE3,
-    0x18, 0xC0, 0xA0, 0xE3, 0x04, 0x10, 0xA0, 0xE3, 0xB0, 0x10, 0xC3, 0xE1, 0x05, 0x10, 0xA0, 0xE3,
-    0xB0, 0x10, 0xC3, 0xE1, 0xB0, 0x10, 0xD3, 0xE1, 0x02, 0x10, 0x01, 0xE2, 0xA0, 0x00, 0xA0, 0xE1,
-    0x01, 0x0B, 0x80, 0xE1, 0x01, 0xC0, 0x5C, 0xE2, 0xF5, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x13, 0xA0, 0xE3, 0x00, 0x00, 0xA0, 0xE3, 0xBA, 0x0B, 0xC1, 0xE1, 0xB6, 0x0C, 0xC1, 0xE1,
-    0xB2, 0x0D, 0xC1, 0xE1, 0xBE, 0x0D, 0xC1, 0xE1, 0x02, 0x1C, 0x81, 0xE2, 0x08, 0x00, 0x81, 0xE5,
-    0x3C, 0x00, 0x9F, 0xE5, 0x3C, 0x10, 0x9F, 0xE5, 0x3C, 0x20, 0x9F, 0xE5, 0x01, 0x20, 0x42, 0xE0,
-    0x00, 0xE0, 0xA0, 0xE1, 0xD6, 0x00, 0x00, 0xEA, 0x6E, 0x7A, 0xB0, 0x5A, 0x7E, 0x68, 0xBE, 0xAB,
-    0x7F, 0x18, 0xAE, 0xBA, 0x80, 0x18, 0xAE, 0xBA, 0x3C, 0x6E, 0x00, 0x03, 0xEF, 0xBE, 0xAF, 0xDE,
-    0x48, 0x7C, 0x00, 0x03, 0x40, 0x7B, 0x00, 0x03, 0x32, 0x01, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,
-    0xC4, 0x00, 0x00, 0x08, 0x8C, 0xE1, 0x03, 0x02, 0x94, 0x99, 0x00, 0x08, 0x50, 0x9B, 0x00, 0x08,
-    0x00, 0x04, 0x2D, 0xE9, 0x00, 0xA3, 0x9F, 0xE5, 0x01, 0x33, 0xA0, 0xE3, 0x01, 0x3C, 0x83, 0xE2,
-    0x01, 0x00, 0xA0, 0xE3, 0x01, 0x00, 0x50, 0xE2, 0xFD, 0xFF, 0xFF, 0x1A, 0x01, 0x0C, 0xA0, 0xE3,
-    0xB8, 0x12, 0xD3, 0xE1, 0x80, 0x00, 0x11, 0xE3, 0xF9, 0xFF, 0xFF, 0x1A, 0x40, 0x00, 0x11, 0xE3,
-    0x0D, 0x00, 0x00, 0x1A, 0x20, 0x00, 0x93, 0xE5, 0x24, 0x10, 0x93, 0xE5, 0xFF, 0x2C, 0x00, 0xE2,
-    0xAA, 0x0C, 0x52, 0xE3, 0x0B, 0x00, 0x00, 0x0A, 0xD0, 0x25, 0x9A, 0xE5, 0x01, 0x08, 0x12, 0xE3,
-    0x05, 0x00, 0x00, 0x0A, 0xD8, 0x05, 0x8A, 0x15, 0xDC, 0x15, 0x8A, 0x15, 0x00, 0x20, 0x22, 0xE0,
-    0xFF, 0x2C, 0x12, 0xE2, 0xE0, 0x05, 0x8A, 0x15, 0xE4, 0x15, 0x8A, 0x15, 0xD2, 0x35, 0xCA, 0xE5,
-    0x00, 0x04, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x05, 0x2C, 0x8A, 0xE2, 0xD8, 0x20, 0x82, 0xE2,
-    0xB0, 0x00, 0xC2, 0xE1, 0xE8, 0x25, 0x9A, 0xE5, 0x01, 0x24, 0x82, 0xE3, 0x02, 0x23, 0xC2, 0xE3,
-    0xE8, 0x25, 0x8A, 0xE5, 0x00, 0x04, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0xD0, 0x35, 0x9A, 0xE5,
-    0x01, 0x08, 0x13, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0x01, 0x53, 0xA0, 0xE3, 0x01, 0x5C, 0x85, 0xE2,
-    0xB8, 0x12, 0xD5, 0xE1, 0x80, 0x00, 0x11, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0x24, 0x44, 0xDA, 0xE5,
-    0x55, 0x40, 0x24, 0xE2, 0x80, 0x40, 0xC4, 0xE3, 0x04, 0x04, 0x80, 0xE1, 0xD8, 0x25, 0x9A, 0xE5,
-    0xDC, 0x35, 0x9A, 0xE5, 0x01, 0x00, 0x72, 0xE3, 0x0F, 0x2C, 0x22, 0x02, 0xF8, 0x45, 0xDA, 0xE5,
-    0x02, 0x00, 0x54, 0xE3, 0x11, 0x00, 0x00, 0x0A, 0x03, 0x00, 0x54, 0xE3, 0x07, 0x00, 0x00, 0x0A,
-    0x23, 0x48, 0x22, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0x04, 0x00, 0x00, 0x0A, 0xD4, 0x15, 0x9A, 0xE5,
-    0x23, 0x48, 0x21, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0xD0, 0x15, 0x8A, 0x05, 0x17, 0x00, 0x00, 0xEA,
-    0x03, 0x40, 0x22, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0x04, 0x00, 0x00, 0x0A, 0xD4, 0x15, 0x9A, 0xE5,
-    0x03, 0x40, 0x21, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0xD0, 0x15, 0x8A, 0x05, 0x0F, 0x00, 0x00, 0xEA,
-    0x22, 0x48, 0x22, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0x04, 0x00, 0x00, 0x0A, 0xD4, 0x15, 0x9A, 0xE5,
-    0x22, 0x48, 0x21, 0xE0, 0xFF, 0x0C, 0x14, 0xE3, 0xD0, 0x15, 0x8A, 0x05, 0x07, 0x00, 0x00, 0xEA,
-    0xD0, 0x45, 0x9A, 0xE5, 0xD4, 0x15, 0x9A, 0xE5, 0x01, 0x40, 0x24, 0xE0, 0xFF, 0x0C, 0x14, 0xE3,
-    0x04, 0x00, 0x00, 0x1A, 0xD0, 0x15, 0x9A, 0xE5, 0xD0, 0x05, 0x8A, 0xE5, 0xD4, 0x15, 0x8A, 0xE5,
-    0x01, 0x40, 0x94, 0xE3, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x40, 0x14, 0xE2, 0xD0, 0x15, 0x9A, 0xE5,
-    0xD4, 0x15, 0x8A, 0x05, 0x01, 0x00, 0xA0, 0x11, 0x01, 0x08, 0x80, 0xE3, 0xD0, 0x05, 0x8A, 0xE5,
-    0xBA, 0x02, 0xC5, 0xE1, 0xB8, 0x12, 0xD5, 0xE1, 0x04, 0x00, 0x11, 0xE3, 0x04, 0x00, 0x00, 0x1A,
-    0xB8, 0x12, 0xD5, 0xE1, 0x08, 0x00, 0x11, 0xE3, 0xFC, 0xFF, 0xFF, 0x0A, 0x80, 0x10, 0x81, 0xE3,
-    0xB8, 0x12, 0xC5, 0xE1, 0x00, 0x00, 0x34, 0xE3, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x04, 0x2D, 0xE9,
-    0x44, 0xA1, 0x9F, 0xE5, 0x0F, 0x04, 0xC0, 0xE3, 0xE8, 0x05, 0x8A, 0xE5, 0x02, 0x20, 0xA0, 0xE3,
-    0xA0, 0x1E, 0xA0, 0xE1, 0x06, 0x00, 0x51, 0xE3, 0x04, 0x20, 0xA0, 0x03, 0x05, 0x00, 0x51, 0xE3,
-    0x03, 0x20, 0xA0, 0x03, 0xF8, 0x25, 0xCA, 0xE5, 0x01, 0x23, 0xA0, 0xE3, 0x01, 0x2C, 0x82, 0xE2,
-    0x00, 0x10, 0xA0, 0xE3, 0xB4, 0x13, 0xC2, 0xE1, 0x02, 0x01, 0x10, 0xE3, 0x02, 0x1A, 0xA0, 0x03,
-    0x06, 0x1A, 0xA0, 0x13, 0x02, 0x10, 0x81, 0x12, 0xB8, 0x12, 0xC2, 0xE1, 0x00, 0x04, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0x03, 0x12, 0xE3, 0x0D, 0x00, 0x00, 0x0A, 0x9E, 0xFF, 0xFF, 0xEB,
-    0x06, 0xF0, 0xA0, 0x11, 0xEC, 0x25, 0xCA, 0xE5, 0x22, 0x28, 0xA0, 0xE1, 0xED, 0x25, 0xCA, 0xE5,
-    0xF8, 0x45, 0xDA, 0xE5, 0x02, 0x00, 0x54, 0xE3, 0x03, 0x00, 0x00, 0x0A, 0xEE, 0x35, 0xCA, 0xE5,
-    0x23, 0x38, 0xA0, 0xE1, 0x03, 0x00, 0x54, 0xE3, 0xEF, 0x35, 0xCA, 0x15, 0x00, 0x00, 0x10, 0xE2,
-    0x06, 0xF0, 0xA0, 0xE1, 0x02, 0x19, 0xA0, 0xE3, 0xD4, 0x15, 0x8A, 0xE5, 0x03, 0x04, 0x12, 0xE3,
-    0x1B, 0x00, 0x00, 0x0A, 0x02, 0x04, 0x12, 0xE3, 0x08, 0x00, 0x00, 0x0A, 0x22, 0x0C, 0xA0, 0xE3,
-    0x89, 0xFF, 0xFF, 0xEB, 0x02, 0x19, 0xA0, 0x03, 0xD4, 0x15, 0x8A, 0x05, 0xE8, 0x25, 0x9A, 0xE5,
-    0x03, 0x24, 0xC2, 0x03, 0x02, 0x23, 0x82, 0x03, 0xE8, 0x25, 0x8A, 0xE5, 0x0E, 0x00, 0x00, 0xEA,
-    0x11, 0x00, 0x00, 0xEB, 0x0C, 0x00, 0x00, 0x1A, 0x02, 0x24, 0x82, 0xE3, 0xE8, 0x25, 0x8A, 0xE5,
-    0x08, 0x05, 0x9A, 0xE5, 0x04, 0x00, 0x14, 0xE3, 0x02, 0x00, 0x00, 0x0A, 0xD8, 0x35, 0xDA, 0xE5,
-    0x07, 0x10, 0xC1, 0xE3, 0x03, 0x10, 0x81, 0xE1, 0x67, 0xFD, 0xFF, 0xEB, 0x00, 0x10, 0xA0, 0xE3,
-    0xD0, 0x15, 0x8A, 0xE5, 0xD8, 0x15, 0x8A, 0xE5, 0xDC, 0x15, 0x8A, 0xE5, 0x01, 0x00, 0x90, 0xE3,
-    0x06, 0xF0, 0xA0, 0xE1, 0x00, 0x00, 0x00, 0xEB, 0xFB, 0xFF, 0xFF, 0xEA, 0x01, 0x53, 0xA0, 0xE3,
-    0x01, 0x5C, 0x85, 0xE2, 0x0C, 0x15, 0x9A, 0xE5, 0x07, 0x00, 0x01, 0xE2, 0xAA, 0x0C, 0x80, 0xE3,
-    0xB8, 0x42, 0xD5, 0xE1, 0x80, 0x00, 0x14, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0xBA, 0x02, 0xC5, 0xE1,
-    0x80, 0x40, 0x84, 0xE3, 0xB8, 0x42, 0xC5, 0xE1, 0x0E, 0xF0, 0xA0, 0xE1, 0x3C, 0x6E, 0x00, 0x03,
-    0x01, 0x14, 0x81, 0xE1, 0x01, 0x18, 0x81, 0xE1, 0x08, 0xF0, 0x9F, 0xE5, 0x04, 0xF0, 0x9F, 0xE5,
-    0x04, 0xF0, 0x9F, 0xE5, 0x04, 0xF0, 0x9F, 0xE5, 0x24, 0x51, 0x00, 0x03, 0x2C, 0x51, 0x00, 0x03,
-    0xC0, 0x51, 0x00, 0x03, 0x75, 0x75, 0x75, 0x27, 0x1B, 0x8F, 0x00, 0x00, 0xAB, 0x47, 0x00, 0x9F,
-    0x8F, 0x00, 0x77, 0xAB, 0x00, 0x13, 0xA7, 0x00, 0x00, 0x7F, 0x0B, 0x00, 0x43, 0x2F, 0x00, 0x00,
-    0x47, 0x00, 0x00, 0x51, 0x00, 0x00, 0x3F, 0x17, 0x1B, 0x3F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0xBC, 0x00, 0x73, 0xEF, 0x23, 0x3B, 0xEF, 0x83, 0x00, 0xF3,
-    0xBF, 0x00, 0xBF, 0xE7, 0x00, 0x5B, 0xDB, 0x2B, 0x00, 0xCB, 0x4F, 0x0F, 0x8B, 0x73, 0x00, 0x00,
-    0x97, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x93, 0x3B, 0x00, 0x83, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xBF, 0xFF, 0x5F, 0x97, 0xFF, 0xA7, 0x8B, 0xFD,
-    0xF7, 0x7B, 0xFF, 0xFF, 0x77, 0xB7, 0xFF, 0x77, 0x63, 0xFF, 0x9B, 0x3B, 0xF3, 0xBF, 0x3F, 0x83,
-    0xD3, 0x13, 0x4F, 0xDF, 0x4B, 0x58, 0xF8, 0x98, 0x00, 0xEB, 0xDB, 0x66, 0x66, 0x66, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAB, 0xE7, 0xFF, 0xC7, 0xD7, 0xFF, 0xD7, 0xCB, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xC7, 0xDB, 0xFF, 0xBF, 0xB3, 0xFF, 0xDB, 0xAB, 0xFF, 0xE7, 0xA3, 0xE3,
-    0xFF, 0xA3, 0xAB, 0xF3, 0xBF, 0xB3, 0xFF, 0xCF, 0x9F, 0xFF, 0xF3, 0xD1, 0xD1, 0xD1, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x35, 0x3F, 0x16, 0x22, 0x1C, 0x09, 0x30, 0x15, 0x30, 0x00, 0x27, 0x05,
-    0x04, 0x28, 0x08, 0x30, 0x21, 0x3F, 0x3F, 0x3F, 0x3C, 0x32, 0x36, 0x12, 0x3F, 0x2B, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x24, 0x01, 0x3F, 0x31, 0x3F, 0x2A, 0x2C, 0x0C, 0x3F, 0x14, 0x3F, 0x07, 0x34, 0x06,
-    0x3F, 0x02, 0x26, 0x0F, 0x3F, 0x19, 0x10, 0x0A, 0x3F, 0x3F, 0x37, 0x17, 0x3F, 0x11, 0x1A, 0x3F,
-    0x3F, 0x25, 0x18, 0x3F, 0x0F, 0x27, 0x18, 0x3F, 0x3F, 0x25, 0x3F, 0x34, 0x16, 0x13, 0x3F, 0x34,
-    0x20, 0x23, 0x3F, 0x0B, 0x3F, 0x23, 0x06, 0x3F, 0x1B, 0x27, 0x3F, 0x22, 0x3F, 0x24, 0x3F, 0x3F,
-    0x32, 0x08, 0x3F, 0x03, 0x3F, 0x37, 0x26, 0x33, 0x11, 0x3F, 0x10, 0x22, 0x14, 0x3F, 0x00, 0x09,
-    0x12, 0x0F, 0x3F, 0x30, 0x3F, 0x3F, 0x2A, 0x17, 0x0C, 0x01, 0x15, 0x19, 0x3F, 0x2C, 0x07, 0x37,
-    0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x1C, 0x3F, 0x1A, 0x30, 0x01, 0x07, 0x02, 0x3F, 0x3F, 0x30,
-    0x3F, 0x3F, 0x3F, 0x30, 0x32, 0x1C, 0x11, 0x12, 0x3F, 0x18, 0x17, 0x26, 0x0C, 0x3F, 0x3F, 0x02,
-    0x16, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x0F, 0x37, 0x3F, 0x28, 0x27, 0x3F, 0x29, 0x3F, 0x21, 0x3F,
-    0x11, 0x3F, 0x0F, 0x3F, 0x31, 0x3F, 0x3F, 0x06, 0x0F, 0x2A, 0x30, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
-    0x13, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x1C, 0x3F, 0x3F, 0x3F, 0x01, 0x17, 0x10, 0x3F, 0x2A, 0x3F,
-    0x36, 0x37, 0x1A, 0x39, 0x25, 0x3F, 0x12, 0x3F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x1B, 0x22, 0x19,
-    0x04, 0x0F, 0x3A, 0x21, 0x3F, 0x0A, 0x07, 0x06, 0x13, 0x3F, 0x00, 0x15, 0x0C, 0x3F, 0x11, 0x3F,
-    0x3F, 0x38, 0x3F, 0x3F, 0x3F, 0x30, 0x07, 0x16, 0x3F, 0x3B, 0x30, 0x3C, 0x0F, 0x27, 0x3F, 0x31,
-    0x29, 0x3F, 0x11, 0x09, 0x0F, 0x3F, 0x3F, 0x10, 0x1A, 0x30, 0x31, 0x3F, 0x01, 0x0F, 0x36, 0x3F,
-    0x15, 0x3F, 0x3F, 0x3C, 0x3F, 0x3F, 0x3F, 0x12, 0x19, 0x18, 0x17, 0x3F, 0x00, 0x3F, 0x3F, 0x02,
-    0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x37, 0x3F, 0x27, 0x26, 0x20, 0x3F, 0x04, 0x22, 0x3F,
-    0x11, 0x3F, 0x3F, 0x3F, 0x2C, 0x3F, 0x3F, 0x3F, 0x07, 0x2A, 0x28, 0x3F, 0x0A, 0x3F, 0x32, 0x38,
-    0x13, 0x3F, 0x3F, 0x0C, 0x60, 0x54, 0x9F, 0xE5, 0x60, 0x64, 0x9F, 0xE5, 0xC0, 0x70, 0xA0, 0xE3,
-    0x28, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x10, 0xE3, 0x0E, 0x00, 0x00, 0x0A, 0x28, 0x00, 0x1A, 0xE5,
-    0x4C, 0x14, 0x9F, 0xE5, 0x01, 0x10, 0xF0, 0xE7, 0x01, 0x20, 0xF0, 0xE5, 0x01, 0x40, 0xF0, 0xE5,
-    0x01, 0x00, 0xD0, 0xE5, 0x02, 0x14, 0x81, 0xE1, 0x04, 0x18, 0x81, 0xE1, 0x00, 0x1C, 0x81, 0xE1,
-    0x70, 0x20, 0x8F, 0xE2, 0x08, 0x00, 0x92, 0xE4, 0x01, 0x00, 0x50, 0xE1, 0x05, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x50, 0xE3, 0xFA, 0xFF, 0xFF, 0x1A, 0x06, 0x00, 0xA0, 0xE1, 0x05, 0x10, 0xA0, 0xE1,
-    0x07, 0x20, 0xA0, 0xE1, 0x0C, 0xF4, 0x9F, 0xE5, 0x04, 0x10, 0x12, 0xE5, 0x01, 0x20, 0xD1, 0xE4,
-    0x82, 0x20, 0x82, 0xE0, 0x05, 0x00, 0xF2, 0xE7, 0x01, 0xC0, 0xD2, 0xE5, 0x0C, 0x04, 0x80, 0xE1,
-    0xB2, 0x00, 0xC6, 0xE0, 0x02, 0x00, 0xD2, 0xE5, 0x01, 0x20, 0xD1, 0xE4, 0x82, 0x20, 0x82, 0xE0,
-    0x05, 0xC0, 0xF2, 0xE7, 0x0C, 0x04, 0x80, 0xE1, 0xB2, 0x00, 0xC6, 0xE0, 0x01, 0x00, 0xD2, 0xE5,
-    0x02, 0xC0, 0xD2, 0xE5, 0x0C, 0x04, 0x80, 0xE1, 0xB2, 0x00, 0xC6, 0xE0, 0x06, 0x70, 0x57, 0xE2,
-    0xED, 0xFF, 0xFF, 0x1A, 0x0E, 0xF0, 0xA0, 0xE1, 0x18, 0xF3, 0xF3, 0xFF, 0xA4, 0x6E, 0x00, 0x08,
-    0x92, 0xF4, 0x22, 0xF4, 0xA4, 0x6E, 0x00, 0x08, 0x9C, 0x80, 0x00, 0x80, 0xA4, 0x6E, 0x00, 0x08,
-    0x81, 0x82, 0x00, 0x80, 0xA4, 0x6E, 0x00, 0x08, 0x92, 0xFD, 0xF3, 0xFF, 0xA4, 0x6E, 0x00, 0x08,
-    0xCE, 0x80, 0x00, 0x80, 0xE4, 0x6E, 0x00, 0x08, 0x53, 0x80, 0x00, 0x80, 0xE4, 0x6E, 0x00, 0x08,
-    0x62, 0xC0, 0x08, 0xC0, 0xE4, 0x6E, 0x00, 0x08, 0x2F, 0x81, 0x50, 0x80, 0xE4, 0x6E, 0x00, 0x08,
-    0x3F, 0x86, 0xAF, 0x85, 0x24, 0x6F, 0x00, 0x08, 0x2A, 0x86, 0x9A, 0x85, 0x24, 0x6F, 0x00, 0x08,
-    0x0A, 0x81, 0x00, 0x80, 0x64, 0x6F, 0x00, 0x08, 0xDE, 0xB5, 0x78, 0xB5, 0x64, 0x6F, 0x00, 0x08,
-    0x25, 0xC3, 0x98, 0xC2, 0x64, 0x6F, 0x00, 0x08, 0x36, 0x83, 0x4C, 0x80, 0x64, 0x6F, 0x00, 0x08,
-    0x00, 0xD3, 0x70, 0xC0, 0x64, 0x6F, 0x00, 0x08, 0x25, 0xC3, 0x98, 0xC2, 0x64, 0x6F, 0x00, 0x08,
-    0xBA, 0x80, 0x00, 0x80, 0xA4, 0x6F, 0x00, 0x08, 0xA5, 0xF0, 0x07, 0xF0, 0xA4, 0x6F, 0x00, 0x08,
-    0x05, 0x80, 0x00, 0xFF, 0xA4, 0x6F, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x64, 0x6F, 0x00, 0x08,
-    0xF0, 0x47, 0x2D, 0xE9, 0x10, 0xA3, 0x9F, 0xE5, 0xA5, 0xFF, 0xFF, 0xEB, 0xFC, 0x62, 0x9F, 0xE5,
-    0x06, 0x70, 0xA0, 0xE1, 0x04, 0x13, 0x9F, 0xE5, 0x00, 0x10, 0xD1, 0xE5, 0x40, 0x40, 0xA0, 0xE3,
-    0x01, 0x00, 0xD6, 0xE4, 0x0B, 0x00, 0x00, 0xEB, 0x00, 0x50, 0xA0, 0xE1, 0x01, 0x00, 0xD6, 0xE4,
-    0x08, 0x00, 0x00, 0xEB, 0x80, 0x52, 0x85, 0xE1, 0x01, 0x00, 0xD6, 0xE4, 0x05, 0x00, 0x00, 0xEB,
-    0x00, 0x55, 0x85, 0xE1, 0xB2, 0x50, 0xC7, 0xE0, 0x01, 0x40, 0x54, 0xE2, 0xF3, 0xFF, 0xFF, 0x1A,
-    0xF0, 0x47, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x2C, 0x60, 0xE2, 0x92, 0x02, 0x03, 0xE0,
-    0x01, 0x28, 0x73, 0xE2, 0x04, 0x30, 0x61, 0xE2, 0x00, 0x04, 0x80, 0xE1, 0x91, 0x02, 0x02, 0xE0,
-    0x93, 0x20, 0x20, 0xE0, 0xA0, 0x06, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0xFF, 0x10, 0xE0, 0xE3,
-    0x9C, 0x22, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x01, 0x00, 0x11, 0xE3, 0x01, 0x02, 0x80, 0x13,
-    0x02, 0x00, 0x11, 0xE3, 0x01, 0x04, 0x80, 0x13, 0x04, 0x00, 0x11, 0xE3, 0x01, 0x06, 0x80, 0x13,
-    0x08, 0x00, 0x11, 0xE3, 0x01, 0x08, 0x80, 0x13, 0x10, 0x00, 0x11, 0xE3, 0x01, 0x0A, 0x80, 0x13,
-    0x20, 0x00, 0x11, 0xE3, 0x01, 0x0C, 0x80, 0x13, 0x40, 0x00, 0x11, 0xE3, 0x10, 0x00, 0x80, 0x13,
-    0x80, 0x00, 0x11, 0xE3, 0x01, 0x00, 0x80, 0x13, 0x04, 0x00, 0x82, 0xE4, 0x01, 0x10, 0x91, 0xE2,
-    0xEB, 0xFF, 0xFF, 0x1A, 0x4C, 0x02, 0x9F, 0xE5, 0x00, 0x00, 0x82, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x00, 0x44, 0x2D, 0xE9, 0x30, 0xA2, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x58, 0x04, 0xCA, 0xE5,
-    0x5A, 0x04, 0xCA, 0xE5, 0xF5, 0x06, 0xCA, 0xE5, 0xC8, 0x07, 0x8A, 0xE5, 0xCC, 0x07, 0x8A, 0xE5,
-    0xD0, 0x07, 0x8A, 0xE5, 0xD4, 0x07, 0x8A, 0xE5, 0xD8, 0x07, 0x8A, 0xE5, 0x18, 0x12, 0x9F, 0xE5,
-    0x00, 0x00, 0xC1, 0xE5, 0x14, 0x22, 0x9F, 0xE5, 0x14, 0x12, 0x9F, 0xE5, 0x00, 0x20, 0x81, 0xE5,
-    0xEC, 0x26, 0x8A, 0xE5, 0x77, 0x04, 0xCA, 0xE5, 0x01, 0x00, 0xA0, 0xE3, 0xF4, 0x06, 0xCA, 0xE5,
-    0x00, 0x12, 0x9F, 0xE5, 0x00, 0x02, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0xFC, 0x11, 0x9F, 0xE5,
-    0xFC, 0x01, 0x9F, 0xE5, 0x04, 0x00, 0x81, 0xE4, 0xF8, 0x01, 0x9F, 0xE5, 0x04, 0x00, 0x81, 0xE4,
-    0x11, 0x1D, 0xA0, 0xE3, 0xE4, 0x16, 0x8A, 0xE5, 0x01, 0x18, 0x81, 0xE1, 0xB8, 0x06, 0x9A, 0xE5,
-    0x1E, 0x2E, 0xA0, 0xE3, 0xC8, 0xFE, 0xFF, 0xEB, 0xBC, 0x06, 0x9A, 0xE5, 0x1E, 0x2E, 0xA0, 0xE3,
-    0xC5, 0xFE, 0xFF, 0xEB, 0xC4, 0x06, 0x9A, 0xE5, 0x05, 0x2D, 0xA0, 0xE3, 0xC2, 0xFE, 0xFF, 0xEB,
-    0x00, 0x10, 0xA0, 0xE3, 0xC0, 0x01, 0x9F, 0xE5, 0x02, 0x2B, 0xA0, 0xE3, 0xBE, 0xFE, 0xFF, 0xEB,
-    0xB8, 0x01, 0x9F, 0xE5, 0x22, 0x2E, 0xA0, 0xE3, 0xBB, 0xFE, 0xFF, 0xEB, 0x00, 0x10, 0xE0, 0xE3,
-    0xAC, 0x01, 0x9F, 0xE5, 0x2C, 0x20, 0xA0, 0xE3, 0xB7, 0xFE, 0xFF, 0xEB, 0xA4, 0x01, 0x9F, 0xE5,
-    0x2C, 0x20, 0xA0, 0xE3, 0xB4, 0xFE, 0xFF, 0xEB, 0xE0, 0x10, 0xA0, 0xE3, 0x07, 0x04, 0xA0, 0xE3,
-    0x01, 0x2B, 0xA0, 0xE3, 0xB0, 0xFE, 0xFF, 0xEB, 0xF0, 0x10, 0xA0, 0xE3, 0x88, 0x01, 0x9F, 0xE5,
-    0xF0, 0x06, 0x8A, 0xE5, 0x01, 0x2C, 0xA0, 0xE3, 0xAB, 0xFE, 0xFF, 0xEB, 0x7C, 0x01, 0x9F, 0xE5,
-    0xA8, 0x06, 0x8A, 0xE5, 0xAC, 0x06, 0x8A, 0xE5, 0x01, 0x2C, 0xA0, 0xE3, 0xA6, 0xFE, 0xFF, 0xEB,
-    0x00, 0x00, 0xE0, 0xE3, 0xC8, 0x04, 0x8A, 0xE5, 0xCC, 0x04, 0x8A, 0xE5, 0x03, 0x00, 0x00, 0xEB,
-    0x7E, 0xFF, 0xFF, 0xEB, 0x00, 0x44, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE1,
-    0x7B, 0x14, 0xDA, 0xE5, 0x7A, 0x24, 0xDA, 0xE5, 0x02, 0x00, 0x11, 0xE1, 0x40, 0x01, 0x9F, 0x15,
-    0x40, 0x01, 0x9F, 0x05, 0x40, 0x11, 0x9F, 0xE5, 0xB0, 0x00, 0xC1, 0xE1, 0x3C, 0x01, 0x9F, 0x15,
-    0x3C, 0x01, 0x9F, 0x05, 0xB4, 0x00, 0xC1, 0xE1, 0x38, 0x11, 0x9F, 0xE5, 0x2B, 0x05, 0xDA, 0xE5,
-    0x09, 0x00, 0x50, 0xE3, 0x0A, 0x00, 0x50, 0x13, 0xEA, 0x04, 0xA0, 0xE3, 0x13, 0x00, 0x80, 0xE3,
-    0x4C, 0x00, 0x1F, 0x15, 0x00, 0x00, 0x81, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x18, 0x11, 0x9F, 0xE5,
-    0x00, 0x00, 0xD1, 0xE5, 0x01, 0x00, 0x50, 0xE2, 0x3B, 0x00, 0xA0, 0x43, 0x00, 0x00, 0xC1, 0xE5,
-    0x1E, 0xFF, 0x2F, 0x51, 0x04, 0x01, 0x9F, 0xE5, 0x00, 0x00, 0xD0, 0xE5, 0x01, 0x00, 0x10, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x30, 0x04, 0x9A, 0xE5, 0x00, 0x00, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x10, 0xA0, 0xE3, 0x30, 0x14, 0x8A, 0xE5, 0xE4, 0x20, 0x9F, 0xE5, 0x00, 0x20, 0x92, 0xE5,
-    0x01, 0x0C, 0x52, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0x64, 0x10, 0xA0, 0xE3, 0x00, 0x00, 0x06, 0xEF,
-    0x30, 0x00, 0x80, 0xE2, 0xCC, 0x20, 0x9F, 0xE5, 0x00, 0x00, 0xC2, 0xE5, 0x01, 0x00, 0xA0, 0xE1,
-    0x0A, 0x10, 0xA0, 0xE3, 0x00, 0x00, 0x06, 0xEF, 0x30, 0x00, 0x80, 0xE2, 0xB8, 0x20, 0x9F, 0xE5,
-    0x00, 0x00, 0xC2, 0xE5, 0x30, 0x10, 0x81, 0xE2, 0xB0, 0x20, 0x9F, 0xE5, 0x00, 0x10, 0xC2, 0xE5,
-    0xAC, 0x00, 0x9F, 0xE5, 0xAC, 0x20, 0x9F, 0xE5, 0x41, 0xCC, 0xA0, 0xE3, 0x01, 0x10, 0xD0, 0xE4,
-    0x20, 0x00, 0x51, 0xE3, 0x0A, 0x10, 0x81, 0x02, 0x0C, 0x10, 0x81, 0xE0, 0xB2, 0x10, 0xC2, 0xE0,
-    0x0F, 0x00, 0x12, 0xE3, 0xF8, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1, 0xE4, 0x6D, 0x00, 0x08,
-    0xC0, 0x00, 0x00, 0x05, 0xFA, 0xFF, 0x00, 0x00, 0xC0, 0x51, 0x00, 0x03, 0x3C, 0x6E, 0x00, 0x03,
-    0xC6, 0x5E, 0x00, 0x03, 0xEC, 0x76, 0x00, 0x03, 0xEF, 0xBE, 0xAD, 0xDE, 0xC4, 0x59, 0x00, 0x03,
-    0xC0, 0x59, 0x00, 0x03, 0x38, 0x58, 0x00, 0x03, 0x4C, 0x58, 0x00, 0x03, 0x14, 0x5D, 0x00, 0x03,
-    0x70, 0x58, 0x00, 0x03, 0xE8, 0x59, 0x00, 0x03, 0x54, 0x5B, 0x00, 0x03, 0x8C, 0xE1, 0x03, 0x02,
-    0x8C, 0xEB, 0x03, 0x02, 0xDC, 0xED, 0x03, 0x02, 0xB0, 0xED, 0x03, 0x02, 0x00, 0xFE, 0x03, 0x02,
-    0x00, 0xFF, 0x03, 0x02, 0x29, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x78, 0x5F, 0x00, 0x03,
-    0x30, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xC0, 0x5D, 0x00, 0x03, 0xC5, 0x5E, 0x00, 0x03,
-    0xC4, 0x5E, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0xC1, 0x5E, 0x00, 0x03, 0xC2, 0x5E, 0x00, 0x03,
-    0xC3, 0x5E, 0x00, 0x03, 0xBC, 0x5E, 0x00, 0x03, 0x00, 0x20, 0x00, 0x06, 0x02, 0x09, 0xA0, 0xE3,
-    0xB0, 0x00, 0xC6, 0xE1, 0x00, 0x00, 0xA0, 0xE3, 0x00, 0x10, 0xA0, 0xE3, 0x00, 0x20, 0xA0, 0xE3,
-    0x00, 0x30, 0xA0, 0xE3, 0x0F, 0x00, 0xA8, 0xE8, 0x0F, 0x00, 0xA8, 0xE8, 0x00, 0x80, 0xBD, 0xE8,
-    0xDC, 0x4A, 0x9F, 0xE5, 0x00, 0x40, 0x94, 0xE5, 0x04, 0x40, 0xB0, 0xE1, 0x02, 0x4B, 0xA0, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x40, 0xA0, 0xE3, 0xC4, 0x0A, 0x9F, 0xE5, 0x00, 0x40, 0x80, 0xE5,
-    0xC0, 0xEA, 0x9F, 0xE5, 0xC0, 0x0A, 0x9F, 0xE5, 0x10, 0xFF, 0x2F, 0xE1, 0x0E, 0xC0, 0xA0, 0xE1,
-    0x08, 0x00, 0x54, 0xE3, 0x06, 0x00, 0x00, 0x0B, 0x08, 0x00, 0x55, 0xE3, 0x02, 0x10, 0xA0, 0x01,
-    0x03, 0x00, 0x00, 0x0B, 0x08, 0x00, 0x56, 0xE3, 0x03, 0x10, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x0B,
-    0x1C, 0xFF, 0x2F, 0xE1, 0xFF, 0x10, 0x01, 0xE2, 0x01, 0x10, 0x81, 0xE2, 0xF0, 0x00, 0x51, 0xE3,
-    0x1E, 0xFF, 0x2F, 0xA1, 0xE8, 0x06, 0xDA, 0xE5, 0xFF, 0x40, 0xE0, 0xE3, 0x04, 0x00, 0x80, 0xE1,
-    0xE8, 0x06, 0x8A, 0xE5, 0x59, 0x04, 0xDA, 0xE5, 0x20, 0x00, 0x10, 0xE3, 0x10, 0x40, 0xA0, 0x13,
-    0x08, 0x40, 0xA0, 0x03, 0x04, 0x00, 0x81, 0xE0, 0xF0, 0x00, 0x50, 0xE3, 0xF0, 0x40, 0x61, 0xA2,
-    0xB8, 0x06, 0x9A, 0xE5, 0x81, 0x00, 0x80, 0xE0, 0x50, 0xFA, 0x9F, 0xE5, 0x00, 0x40, 0x2D, 0xE9,
-    0x00, 0x00, 0xA0, 0xE3, 0x90, 0x04, 0x8A, 0xE5, 0x94, 0x04, 0x8A, 0xE5, 0x17, 0x03, 0x00, 0xEB,
-    0x0F, 0x03, 0x00, 0xEB, 0x0F, 0xE0, 0xA0, 0xE1, 0x34, 0xFA, 0x9F, 0xE5, 0x34, 0xCA, 0x9F, 0xE5,
-    0x34, 0x2A, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x30, 0xFA, 0x9F, 0xE5, 0x30, 0xCA, 0x9F, 0xE5,
-    0x30, 0x2A, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x20, 0xFA, 0x9F, 0xE5, 0x2E, 0x05, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x0A, 0x1C, 0xCA, 0x9F, 0xE5, 0x1C, 0x2A, 0x9F, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x04, 0xFA, 0x9F, 0xE5, 0x14, 0xCA, 0x9F, 0xE5, 0x14, 0x2A, 0x9F, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xF4, 0xF9, 0x9F, 0xE5, 0x00, 0x80, 0xBD, 0xE8, 0x7B, 0x04, 0xDA, 0xE5,
-    0xFE, 0x15, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x01, 0x10, 0xB0, 0x11, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x40, 0x2D, 0xE9, 0xF0, 0x69, 0x9F, 0xE5, 0x04, 0xC0, 0xA0, 0xE3, 0xEC, 0x59, 0x9F, 0xE5,
-    0x00, 0x00, 0x96, 0xE5, 0x10, 0x10, 0x96, 0xE5, 0x00, 0x10, 0x31, 0xE0, 0x04, 0x60, 0x86, 0x02,
-    0x02, 0x5A, 0x85, 0x02, 0x0F, 0xE0, 0xA0, 0x11, 0xD4, 0xF9, 0x9F, 0x15, 0x01, 0xC0, 0x5C, 0xE2,
-    0xF6, 0xFF, 0xFF, 0x1A, 0x01, 0x9B, 0x8A, 0xE2, 0xE0, 0x90, 0x89, 0xE2, 0x0F, 0x00, 0x99, 0xE8,
-    0x01, 0x9B, 0x8A, 0xE2, 0xF0, 0x90, 0x89, 0xE2, 0xF0, 0x00, 0x99, 0xE8, 0x04, 0x00, 0x50, 0xE1,
-    0x05, 0x00, 0x51, 0x01, 0x06, 0x00, 0x52, 0x01, 0x07, 0x00, 0x53, 0x01, 0x10, 0x00, 0x00, 0x0A,
-    0x01, 0x6B, 0x8A, 0xE2, 0xE0, 0x60, 0x86, 0xE2, 0x00, 0x00, 0x96, 0xE5, 0x10, 0x10, 0x96, 0xE5,
-    0x00, 0x10, 0x31, 0xE0, 0x04, 0x60, 0x86, 0x02, 0x01, 0x0B, 0x8A, 0x12, 0xE0, 0x00, 0x80, 0x12,
-    0x00, 0x00, 0x46, 0x10, 0x06, 0x54, 0xA0, 0x13, 0x00, 0x56, 0x85, 0x10, 0x0F, 0xE0, 0xA0, 0x11,
-    0x6C, 0xF9, 0x9F, 0x15, 0x01, 0x0B, 0x8A, 0xE2, 0xF0, 0x00, 0x80, 0xE2, 0x00, 0x00, 0x56, 0xE1,
-    0xF0, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8, 0x16, 0x08, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x13, 0x00, 0x00, 0x1A, 0x15, 0x08, 0xDA, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x15, 0x08, 0xCA, 0xE5,
-    0xB4, 0x00, 0x50, 0xE3, 0x0E, 0x00, 0x00, 0xBA, 0x01, 0x00, 0xA0, 0xE3, 0x16, 0x08, 0xCA, 0xE5,
-    0x0D, 0x00, 0xA0, 0xE1, 0x00, 0x20, 0x0F, 0xE1, 0xDF, 0x20, 0xC2, 0xE3, 0x92, 0x20, 0x82, 0xE3,
-    0x02, 0xF0, 0x29, 0xE1, 0x0D, 0x10, 0xA0, 0xE1, 0x00, 0x20, 0x0F, 0xE1, 0xDF, 0x20, 0xC2, 0xE3,
-    0x1F, 0x20, 0x82, 0xE3, 0x02, 0xF0, 0x29, 0xE1, 0x08, 0x29, 0x9F, 0xE5, 0x0B, 0xB0, 0xA0, 0xE1,
-    0x12, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0xFC, 0x18, 0x9F, 0xE5, 0xFC, 0x28, 0x9F, 0xE5,
-    0x00, 0x00, 0x91, 0xE5, 0x02, 0x00, 0x50, 0xE1, 0x05, 0x00, 0x00, 0x1A, 0xF0, 0x18, 0x9F, 0xE5,
-    0xF0, 0x28, 0x9F, 0xE5, 0x00, 0x00, 0x91, 0xE5, 0x02, 0x00, 0x50, 0xE1, 0x06, 0x00, 0x00, 0x1A,
-    0x00, 0x80, 0xBD, 0xE8, 0x0B, 0xB0, 0xA0, 0xE1, 0x0D, 0x00, 0x51, 0xE1, 0x0A, 0x00, 0x00, 0xAA,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xD0, 0xF8, 0x9F, 0xE5, 0x02, 0x00, 0x00, 0xEA, 0x0B, 0xB0, 0xA0, 0xE1,
-    0x0D, 0x00, 0x51, 0xE1, 0x04, 0x00, 0x00, 0xAA, 0xC0, 0x08, 0x9F, 0xE5, 0x00, 0x00, 0xD0, 0xE5,
-    0x03, 0x00, 0x00, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xB4, 0xF8, 0x9F, 0xE5, 0x00, 0x80, 0xBD, 0xE8,
-    0x00, 0x44, 0x2D, 0xE9, 0x7E, 0xB4, 0xDA, 0xE5, 0xA4, 0x76, 0x9A, 0xE5, 0xBC, 0x86, 0x9A, 0xE5,
-    0xB4, 0x96, 0x9A, 0xE5, 0xC0, 0x46, 0x9A, 0xE5, 0xC4, 0x56, 0x9A, 0xE5, 0xC8, 0x66, 0x9A, 0xE5,
-    0x0B, 0xC0, 0xA0, 0xE1, 0x78, 0x04, 0xDA, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x03, 0x00, 0x00, 0xE2,
-    0x80, 0x18, 0x9F, 0xE5, 0x00, 0x00, 0xC1, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x28, 0x00, 0xC1, 0xE5,
-    0x03, 0x00, 0x00, 0xE2, 0x18, 0x00, 0xC1, 0xE5, 0x38, 0x05, 0xDA, 0xE5, 0x01, 0x00, 0x20, 0xE2,
-    0x39, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0x10, 0xE0, 0x38, 0x05, 0xCA, 0xE5, 0x0A, 0xAD, 0x84, 0xE2,
-    0x8B, 0x80, 0x88, 0xE0, 0x8B, 0x90, 0x89, 0xE0, 0x4C, 0xF8, 0x9F, 0x15, 0x4C, 0xF8, 0x9F, 0xE5,
-    0x51, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0xA8, 0x16, 0x9A, 0xE5, 0x51, 0x24, 0xDA, 0xE5,
-    0x02, 0x00, 0xC1, 0xE7, 0x01, 0x20, 0x82, 0xE2, 0x51, 0x24, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x06, 0x00, 0x00, 0x1A, 0x00, 0x50, 0x2D, 0xE9,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x18, 0xF8, 0x9F, 0xE5, 0x03, 0x01, 0x52, 0xE3, 0x00, 0x00, 0xA0, 0x33,
-    0xFF, 0x00, 0xA0, 0x83, 0x00, 0x90, 0xBD, 0xE8, 0xA8, 0x16, 0x9A, 0xE5, 0x51, 0x24, 0xDA, 0xE5,
-    0x02, 0x00, 0xD1, 0xE7, 0x03, 0x20, 0x02, 0xE2, 0x02, 0x00, 0x52, 0xE3, 0xE3, 0x00, 0x00, 0x02,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5,
-    0x01, 0x20, 0x82, 0xE0, 0x0D, 0x10, 0x82, 0xE2, 0xD8, 0x07, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2,
-    0xB0, 0xC0, 0x8C, 0xE2, 0xD0, 0xF7, 0x9F, 0xE5, 0xD0, 0x17, 0x9F, 0xE5, 0x00, 0x00, 0xD1, 0xE5,
-    0x40, 0x00, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0xA8, 0x06, 0x9A, 0xE5, 0x00, 0x10, 0xD0, 0xE5,
-    0xF0, 0x00, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0xA1, 0x03, 0x20, 0xD0, 0xE5, 0xFF, 0x00, 0x52, 0xE3,
-    0x1E, 0xFF, 0x2F, 0xA1, 0x02, 0x10, 0x81, 0xE2, 0x08, 0xC8, 0x9A, 0xE5, 0x9C, 0x01, 0x01, 0xE0,
-    0xF6, 0xC6, 0xDA, 0xE5, 0x92, 0x1C, 0x21, 0xE0, 0xC0, 0x10, 0x41, 0xE2, 0x14, 0x07, 0x9A, 0xE5,
-    0x41, 0x12, 0x80, 0xE0, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0xC7, 0x9A, 0xE5,
-    0x0C, 0x20, 0x82, 0xE0, 0x02, 0x00, 0x51, 0xE1, 0x1E, 0xFF, 0x2F, 0x41, 0x00, 0x00, 0xA0, 0xE3,
-    0x74, 0x04, 0xCA, 0xE5, 0x68, 0x07, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x5C, 0xC0, 0x8C, 0xE2,
-    0x54, 0xF7, 0x9F, 0xE5, 0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0,
-    0x30, 0xB0, 0x70, 0xF0, 0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8,
-    0x38, 0xB8, 0x78, 0xF8, 0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4,
-    0x34, 0xB4, 0x74, 0xF4, 0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC,
-    0x3C, 0xBC, 0x7C, 0xFC, 0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2,
-    0x32, 0xB2, 0x72, 0xF2, 0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA,
-    0x3A, 0xBA, 0x7A, 0xFA, 0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6,
-    0x36, 0xB6, 0x76, 0xF6, 0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE,
-    0x3E, 0xBE, 0x7E, 0xFE, 0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1,
-    0x31, 0xB1, 0x71, 0xF1, 0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9,
-    0x39, 0xB9, 0x79, 0xF9, 0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5,
-    0x35, 0xB5, 0x75, 0xF5, 0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD,
-    0x3D, 0xBD, 0x7D, 0xFD, 0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3,
-    0x33, 0xB3, 0x73, 0xF3, 0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB,
-    0x3B, 0xBB, 0x7B, 0xFB, 0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7,
-    0x37, 0xB7, 0x77, 0xF7, 0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF,
-    0x3F, 0xBF, 0x7F, 0xFF, 0x40, 0x00, 0x13, 0xE3, 0x58, 0x36, 0x9F, 0x15, 0x00, 0x00, 0xD3, 0x17,
-    0xA8, 0xC6, 0x9A, 0xE5, 0x03, 0x20, 0xDC, 0xE5, 0x5A, 0x14, 0xDA, 0xE5, 0x06, 0x10, 0x01, 0xE2,
-    0x06, 0x00, 0x51, 0xE3, 0x04, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x52, 0xE3, 0x02, 0x00, 0x00, 0xCA,
-    0xFF, 0x30, 0xA0, 0xE3, 0x13, 0x02, 0xD0, 0xE1, 0x2C, 0xF6, 0x9F, 0x05, 0xF8, 0x00, 0x52, 0xE3,
-    0x03, 0x00, 0x00, 0xBA, 0xFF, 0x30, 0xA0, 0xE3, 0xFF, 0x40, 0x62, 0xE2, 0x33, 0x04, 0xD0, 0xE1,
-    0x14, 0xF6, 0x9F, 0x05, 0x60, 0x00, 0x2D, 0xE9, 0x60, 0x17, 0x9A, 0xE5, 0x0C, 0x10, 0x81, 0xE2,
-    0x14, 0xC7, 0x9A, 0xE5, 0x0C, 0x10, 0x41, 0xE0, 0xEC, 0xC7, 0x9A, 0xE5, 0x91, 0x2C, 0x84, 0xE0,
-    0x70, 0x14, 0x9A, 0xE5, 0x91, 0x3C, 0x85, 0xE0, 0x05, 0x50, 0x44, 0xE0, 0xF0, 0x17, 0x9A, 0xE5,
-    0x01, 0x00, 0x53, 0xE1, 0x01, 0x50, 0x85, 0x32, 0x01, 0x50, 0x45, 0xE2, 0x4C, 0x14, 0x9A, 0xE5,
-    0xFF, 0xC0, 0x01, 0xE2, 0xF0, 0x00, 0x5C, 0xE3, 0x05, 0xC0, 0x8C, 0xE0, 0x02, 0x00, 0x00, 0xAA,
-    0xF0, 0x00, 0x5C, 0xE3, 0x10, 0x10, 0x81, 0xA2, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x0C, 0x5C, 0xE3,
-    0x01, 0x1C, 0x81, 0xA2, 0x05, 0x10, 0x81, 0xE0, 0xFE, 0x1C, 0xC1, 0xE3, 0xA8, 0xC6, 0x9A, 0xE5,
-    0x03, 0x20, 0xDC, 0xE5, 0x5C, 0x34, 0x9A, 0xE5, 0x03, 0x20, 0x82, 0xE0, 0x08, 0x50, 0x82, 0xE2,
-    0x01, 0x0C, 0x12, 0xE3, 0xFF, 0x20, 0x02, 0xE2, 0x02, 0x2A, 0x82, 0x13, 0x01, 0x0C, 0x15, 0xE3,
-    0xFF, 0x50, 0x05, 0xE2, 0x02, 0x5A, 0x85, 0x13, 0xF8, 0x30, 0x01, 0xE2, 0x03, 0x31, 0xA0, 0xE1,
-    0x01, 0x0C, 0x11, 0xE3, 0x02, 0x3B, 0x83, 0x12, 0xA2, 0x41, 0x83, 0xE0, 0xA5, 0x51, 0x83, 0xE0,
-    0x66, 0xCE, 0x8A, 0xE2, 0x24, 0x35, 0xA0, 0xE1, 0x03, 0x31, 0x9C, 0xE7, 0x3F, 0x4B, 0xC4, 0xE3,
-    0x04, 0x40, 0xD3, 0xE7, 0x25, 0x35, 0xA0, 0xE1, 0x03, 0x31, 0x9C, 0xE7, 0x3F, 0x5B, 0xC5, 0xE3,
-    0x05, 0x50, 0xD3, 0xE7, 0x58, 0x34, 0xDA, 0xE5, 0x10, 0x00, 0x13, 0xE3, 0x01, 0x4C, 0x84, 0x12,
-    0x01, 0x5C, 0x85, 0x12, 0x19, 0xCD, 0x8A, 0xE2, 0x24, 0x33, 0xA0, 0xE1, 0x03, 0x31, 0x9C, 0xE7,
-    0x3F, 0x40, 0x04, 0xE2, 0x04, 0x42, 0x83, 0xE0, 0x25, 0x33, 0xA0, 0xE1, 0x03, 0x31, 0x9C, 0xE7,
-    0x3F, 0x50, 0x05, 0xE2, 0x05, 0x52, 0x83, 0xE0, 0x07, 0x10, 0x01, 0xE2, 0x01, 0x30, 0xF4, 0xE7,
-    0x08, 0x40, 0xD4, 0xE5, 0x03, 0x40, 0x84, 0xE1, 0x01, 0x30, 0xF5, 0xE7, 0x08, 0x50, 0xD5, 0xE5,
-    0x03, 0x50, 0x85, 0xE1, 0x04, 0x44, 0x85, 0xE1, 0x07, 0x20, 0x02, 0xE2, 0x08, 0x30, 0x62, 0xE2,
-    0x10, 0x03, 0x14, 0xE0, 0xE4, 0xF4, 0x9F, 0x05, 0x00, 0x10, 0xA0, 0xE3, 0x0F, 0x0A, 0x10, 0xE3,
-    0x00, 0x02, 0xA0, 0x01, 0x04, 0x10, 0x81, 0x02, 0x03, 0x09, 0x10, 0xE3, 0x00, 0x01, 0xA0, 0x01,
-    0x02, 0x10, 0x81, 0x02, 0x02, 0x09, 0x10, 0xE3, 0x01, 0x10, 0x81, 0x02, 0x60, 0x00, 0xBD, 0xE8,
-    0x18, 0x00, 0xBD, 0xE8, 0x02, 0x10, 0x51, 0xE0, 0x1D, 0x00, 0x00, 0x0A, 0x60, 0x07, 0x9A, 0xE5,
-    0x00, 0x10, 0x81, 0xE0, 0x68, 0x00, 0x8F, 0xE2, 0xA4, 0xF4, 0x9F, 0xE5, 0x07, 0x50, 0x2D, 0xE9,
-    0x00, 0xC0, 0xA0, 0xE3, 0x08, 0x00, 0x00, 0xEA, 0x07, 0x50, 0x2D, 0xE9, 0xFB, 0x56, 0xCA, 0xE5,
-    0xFA, 0x06, 0xDA, 0xE5, 0x04, 0x00, 0x50, 0xE3, 0x07, 0x90, 0xBD, 0xA8, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x5C, 0xF4, 0x9F, 0xE5, 0xF0, 0x00, 0x5C, 0xE3, 0x07, 0x90, 0xBD, 0xA8, 0xFA, 0x06, 0xDA, 0xE5,
-    0x01, 0x10, 0x80, 0xE2, 0xFA, 0x16, 0xCA, 0xE5, 0x00, 0x17, 0x9A, 0xE5, 0x80, 0x20, 0x81, 0xE2,
-    0x00, 0xC0, 0xE2, 0xE7, 0x5A, 0xC4, 0xDA, 0xE5, 0x04, 0xC0, 0xC2, 0xE5, 0x80, 0x02, 0x81, 0xE0,
-    0x1A, 0x1D, 0x8A, 0xE2, 0x20, 0x20, 0xA0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x44, 0xF4, 0x9F, 0xE5,
-    0x07, 0x90, 0xBD, 0xE8, 0x02, 0x80, 0xC8, 0xE3, 0x01, 0x00, 0xA0, 0xE3, 0x3B, 0x16, 0x00, 0xEB,
-    0x18, 0x04, 0x9F, 0xE5, 0x00, 0x10, 0xD0, 0xE5, 0x40, 0x10, 0x81, 0xE3, 0x00, 0x10, 0xC0, 0xE5,
-    0x24, 0xF4, 0x9F, 0xE5, 0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x40, 0x2D, 0xE9, 0xD0, 0x07, 0x9A, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x00, 0xE0, 0x8F, 0x12,
-    0x10, 0xFF, 0x2F, 0x11, 0x00, 0x00, 0xA0, 0xE3, 0xF4, 0x06, 0xCA, 0xE5, 0xFC, 0x13, 0x9F, 0xE5,
-    0xFC, 0x03, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0xF8, 0x13, 0x9F, 0xE5, 0xF8, 0x03, 0x9F, 0xE5,
-    0x04, 0x00, 0x81, 0xE4, 0xF4, 0x03, 0x9F, 0xE5, 0x04, 0x00, 0x81, 0xE4, 0xFB, 0x06, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0xCB, 0xFF, 0xFF, 0x1B, 0x6C, 0x10, 0x1A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xDC, 0xF3, 0x9F, 0xE5, 0xF3, 0xFE, 0xFF, 0xEB, 0x0F, 0xE0, 0xA0, 0xE1, 0xD4, 0xF3, 0x9F, 0xE5,
-    0xD4, 0x07, 0x9A, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x00, 0xE0, 0x8F, 0x12, 0x10, 0xFF, 0x2F, 0x11,
-    0x00, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0,
-    0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x14, 0xC7, 0x9A, 0xE5, 0x0C, 0x10, 0x41, 0xE0,
-    0xEC, 0xC7, 0x9A, 0xE5, 0x91, 0x2C, 0x84, 0xE0, 0x70, 0x14, 0x9A, 0xE5, 0x91, 0x3C, 0x80, 0xE0,
-    0x00, 0x00, 0x44, 0xE0, 0xF0, 0x17, 0x9A, 0xE5, 0x01, 0x00, 0x53, 0xE1, 0x01, 0x00, 0x80, 0x32,
-    0x01, 0x00, 0x52, 0xE1, 0x01, 0x00, 0x40, 0x32, 0x4C, 0x14, 0x9A, 0xE5, 0xFF, 0xC0, 0x01, 0xE2,
-    0xF0, 0x00, 0x5C, 0xE3, 0x00, 0xC0, 0x8C, 0xE0, 0x02, 0x00, 0x00, 0xAA, 0xF0, 0x00, 0x5C, 0xE3,
-    0x10, 0x10, 0x81, 0xA2, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x0C, 0x5C, 0xE3, 0x01, 0x1C, 0x81, 0xA2,
-    0x00, 0x10, 0x81, 0xE0, 0xFE, 0x1C, 0xC1, 0xE3, 0x1E, 0xFF, 0x2F, 0xE1, 0x38, 0x40, 0x2D, 0xE9,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xF8, 0xF2, 0x9F, 0xE5, 0x0C, 0x40, 0xA0, 0xE1, 0x2E, 0x00, 0x00, 0xEA,
-    0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x11, 0x38, 0x40, 0x2D, 0xE9,
-    0xC8, 0x07, 0x9A, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x00, 0xE0, 0x8F, 0x12, 0x10, 0xFF, 0x2F, 0x11,
-    0x01, 0x00, 0xA0, 0xE3, 0xF4, 0x06, 0xCA, 0xE5, 0xF0, 0x12, 0x9F, 0xE5, 0x08, 0x03, 0x9F, 0xE5,
-    0x00, 0x00, 0x81, 0xE5, 0xEC, 0x12, 0x9F, 0xE5, 0x00, 0x03, 0x9F, 0xE5, 0x04, 0x00, 0x81, 0xE4,
-    0xFC, 0x02, 0x9F, 0xE5, 0x04, 0x00, 0x81, 0xE4, 0x79, 0x04, 0xDA, 0xE5, 0x01, 0x00, 0x50, 0xE3,
-    0x02, 0x00, 0xA0, 0xE3, 0x79, 0x04, 0xCA, 0x05, 0x0F, 0xE0, 0xA0, 0x01, 0xE4, 0xF2, 0x9F, 0x05,
-    0x07, 0xCC, 0x8A, 0xE2, 0x68, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xD8, 0xF2, 0x9F, 0xE5,
-    0x07, 0xCC, 0x8A, 0xE2, 0x5C, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xC8, 0xF2, 0x9F, 0xE5,
-    0xBC, 0xFF, 0xFF, 0xEB, 0x4C, 0x14, 0x8A, 0xE5, 0x6C, 0x00, 0x1A, 0xE5, 0x7B, 0x00, 0xC0, 0xE3,
-    0xE0, 0x00, 0xC0, 0xE3, 0x01, 0xCC, 0x01, 0xE2, 0x8C, 0x01, 0x80, 0xE1, 0x07, 0xC0, 0x01, 0xE2,
-    0x0C, 0x06, 0x80, 0xE1, 0xF8, 0xC0, 0x01, 0xE2, 0x0C, 0x01, 0x80, 0xE1, 0x6C, 0x00, 0x0A, 0xE5,
-    0x06, 0x02, 0x52, 0xE3, 0x00, 0x40, 0xD4, 0xE2, 0x00, 0x40, 0xA0, 0x43, 0xF0, 0x00, 0x54, 0xE3,
-    0xF0, 0x40, 0xA0, 0xA3, 0xE4, 0x16, 0x9A, 0xE5, 0xE8, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0x50, 0xE3,
-    0xF0, 0x00, 0x54, 0x03, 0x0A, 0x00, 0x00, 0x1A, 0xE9, 0x06, 0xCA, 0xE5, 0xEB, 0xC6, 0xDA, 0xE5,
-    0x0C, 0xC0, 0xB0, 0xE1, 0x06, 0x00, 0x00, 0x1A, 0xB8, 0xC6, 0x9A, 0xE5, 0x80, 0xC0, 0x8C, 0xE0,
-    0xB0, 0xC0, 0xDC, 0xE1, 0x0C, 0x00, 0x51, 0xE1, 0x01, 0x00, 0x00, 0x1A, 0xE8, 0x46, 0xCA, 0xE5,
-    0x02, 0x00, 0x00, 0xEA, 0x04, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x3C, 0xF2, 0x9F, 0xE5,
-    0x60, 0x04, 0x9A, 0xE5, 0x64, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0xF0, 0x00, 0x54, 0x03,
-    0x0B, 0x00, 0x00, 0x1A, 0x65, 0x14, 0xCA, 0xE5, 0x67, 0xC4, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1,
-    0x07, 0x00, 0x00, 0x1A, 0xA0, 0xC6, 0x9A, 0xE5, 0x01, 0xC1, 0x8C, 0xE0, 0xB0, 0xC0, 0xDC, 0xE1,
-    0x08, 0xC0, 0x4C, 0xE2, 0x0C, 0x00, 0x50, 0xE1, 0x01, 0x00, 0x00, 0x1A, 0x64, 0x44, 0xCA, 0xE5,
-    0x02, 0x00, 0x00, 0xEA, 0x04, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0xF0, 0xF1, 0x9F, 0xE5,
-    0x68, 0x24, 0x9A, 0xE5, 0x6C, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0xF0, 0x00, 0x54, 0x03,
-    0x0A, 0x00, 0x00, 0x1A, 0x6D, 0x14, 0xCA, 0xE5, 0x6F, 0xC4, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1,
-    0x06, 0x00, 0x00, 0x1A, 0xA0, 0xC6, 0x9A, 0xE5, 0x01, 0xC1, 0x8C, 0xE0, 0xB2, 0xC0, 0xDC, 0xE1,
-    0x0C, 0x00, 0x52, 0xE1, 0x01, 0x00, 0x00, 0x1A, 0x6C, 0x44, 0xCA, 0xE5, 0x02, 0x00, 0x00, 0xEA,
-    0x04, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0xA8, 0xF1, 0x9F, 0xE5, 0x34, 0x15, 0xDA, 0xE5,
-    0x00, 0x00, 0x51, 0xE3, 0xF0, 0x00, 0x54, 0x03, 0x0B, 0x00, 0x00, 0x1A, 0x35, 0x15, 0xCA, 0xE5,
-    0x37, 0xC5, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x1A, 0xB0, 0xC6, 0x9A, 0xE5,
-    0x81, 0xC0, 0x8C, 0xE0, 0xB0, 0xC0, 0xDC, 0xE1, 0x30, 0x05, 0x9A, 0xE5, 0x0C, 0x00, 0x50, 0xE1,
-    0x01, 0x00, 0x00, 0x1A, 0x34, 0x45, 0xCA, 0xE5, 0x02, 0x00, 0x00, 0xEA, 0x04, 0x20, 0xA0, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x60, 0xF1, 0x9F, 0xE5, 0x6D, 0x2E, 0x8A, 0xE2, 0x28, 0x00, 0x92, 0xE8,
-    0xE0, 0x16, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0xF0, 0x00, 0x54, 0x03, 0x0B, 0x00, 0x00, 0x1A,
-    0xE1, 0x16, 0xCA, 0xE5, 0xE3, 0xC6, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x1A,
-    0xD8, 0xC6, 0x9A, 0xE5, 0x81, 0xC1, 0x8C, 0xE0, 0x03, 0x00, 0x9C, 0xE8, 0x04, 0x00, 0x50, 0xE1,
-    0x05, 0x00, 0x51, 0x01, 0x01, 0x00, 0x00, 0x1A, 0xE0, 0x46, 0xCA, 0xE5, 0x03, 0x00, 0x00, 0xEA,
-    0x04, 0x00, 0xA0, 0xE1, 0x03, 0x40, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x0C, 0xF1, 0x9F, 0xE5,
-    0xCC, 0x07, 0x9A, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x00, 0xE0, 0x8F, 0x12, 0x10, 0xFF, 0x2F, 0x11,
-    0x38, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE3, 0xE8, 0x06, 0xCA, 0xE5,
-    0x34, 0x05, 0xCA, 0xE5, 0x64, 0x04, 0xCA, 0xE5, 0x6C, 0x04, 0xCA, 0xE5, 0xE0, 0x06, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x20, 0x58, 0x00, 0x03, 0x3C, 0x56, 0x00, 0x03, 0x21, 0x3D, 0x00, 0x08,
-    0x18, 0x65, 0x00, 0x03, 0x94, 0x61, 0x00, 0x03, 0x00, 0x60, 0x00, 0x06, 0x8C, 0xE1, 0x03, 0x02,
-    0x18, 0x63, 0x00, 0x03, 0x00, 0x68, 0x00, 0x06, 0x8C, 0xE5, 0x03, 0x02, 0x00, 0x70, 0x00, 0x06,
-    0x8C, 0xB9, 0x03, 0x02, 0x00, 0x78, 0x00, 0x06, 0x8C, 0xBD, 0x03, 0x02, 0x48, 0xEF, 0x03, 0x02,
-    0x00, 0x40, 0x01, 0x06, 0x2C, 0x4D, 0x00, 0x03, 0x89, 0x0E, 0x00, 0x08, 0xEC, 0x7A, 0x00, 0x03,
-    0xEF, 0xBE, 0xAD, 0xDE, 0x48, 0x7C, 0x00, 0x03, 0xEF, 0xBE, 0xAF, 0xDE, 0xBC, 0x71, 0x00, 0x08,
-    0x49, 0x73, 0x00, 0x03, 0xCC, 0x68, 0x00, 0x08, 0xFC, 0x53, 0x00, 0x03, 0x90, 0x53, 0x00, 0x03,
-    0x48, 0x53, 0x00, 0x03, 0xAC, 0x67, 0x00, 0x03, 0x10, 0x95, 0x00, 0x08, 0xA0, 0x66, 0x00, 0x03,
-    0xC4, 0x59, 0x00, 0x03, 0xA0, 0x31, 0x00, 0x06, 0x04, 0x79, 0x00, 0x08, 0x30, 0x32, 0x00, 0x06,
-    0x2C, 0x32, 0x00, 0x06, 0x60, 0x32, 0x00, 0x06, 0xC0, 0x51, 0x00, 0x03, 0x88, 0x44, 0x00, 0x03,
-    0x4C, 0x58, 0x00, 0x03, 0x68, 0x81, 0x00, 0x08, 0x70, 0x58, 0x00, 0x03, 0x34, 0x5A, 0x00, 0x03,
-    0x7C, 0x5B, 0x00, 0x03, 0xEC, 0x5B, 0x00, 0x03, 0x48, 0x4B, 0x00, 0x03, 0x14, 0x5D, 0x00, 0x03,
-    0xE8, 0x59, 0x00, 0x03, 0x54, 0x5B, 0x00, 0x03, 0x30, 0x31, 0x00, 0x06, 0x2C, 0x67, 0x00, 0x03,
-    0x94, 0x59, 0x00, 0x03, 0xCC, 0x5A, 0x00, 0x03, 0x98, 0x5C, 0x00, 0x03, 0x10, 0x4C, 0x00, 0x03,
-    0x04, 0x64, 0x00, 0x03, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0x74, 0x21, 0x9F, 0xE5, 0x92, 0xC1, 0x81, 0xE0, 0x01, 0x00, 0x11, 0xE3,
-    0x6C, 0x11, 0x9F, 0xE5, 0x01, 0x80, 0x48, 0xE0, 0x03, 0x8C, 0x48, 0x02, 0x01, 0x10, 0xA0, 0xE3,
-    0xFC, 0x15, 0xCA, 0xE5, 0xE0, 0x10, 0x00, 0xE2, 0xA1, 0xC1, 0x94, 0xE7, 0xFF, 0x00, 0x00, 0xE2,
-    0x00, 0x14, 0x8C, 0xE0, 0xF0, 0x06, 0x9A, 0xE5, 0xA8, 0x06, 0x8A, 0xE5, 0x01, 0x2C, 0xA0, 0xE3,
-    0x51, 0xC4, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1, 0x38, 0xF1, 0x9F, 0x15, 0xF0, 0x14, 0x00, 0xEA,
-    0x0C, 0x20, 0x42, 0xE0, 0x0C, 0x00, 0x80, 0xE0, 0x00, 0x10, 0x2D, 0xE9, 0x01, 0xC0, 0xD1, 0xE4,
-    0x01, 0xC0, 0xC0, 0xE4, 0x01, 0x20, 0x52, 0xE2, 0xFB, 0xFF, 0xFF, 0x1A, 0x00, 0x10, 0xBD, 0xE8,
-    0x01, 0x0C, 0x40, 0xE2, 0x01, 0x20, 0xD1, 0xE4, 0x01, 0x20, 0xC0, 0xE4, 0x01, 0xC0, 0x5C, 0xE2,
-    0xFB, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1, 0x05, 0x50, 0x2D, 0xE9, 0xC0, 0xFD, 0xFF, 0xEB,
-    0x05, 0x50, 0xBD, 0xE8, 0xF0, 0xF0, 0x9F, 0xE5, 0x18, 0x50, 0x2D, 0xE9, 0xD9, 0xFE, 0xFF, 0xEB,
-    0xFF, 0x20, 0x01, 0xE2, 0x01, 0x10, 0x81, 0xE2, 0xFF, 0x00, 0x52, 0xE3, 0x01, 0x1C, 0x41, 0x02,
-    0xEF, 0x00, 0x52, 0xE3, 0x10, 0x10, 0x81, 0x02, 0x02, 0x1C, 0xC1, 0xE3, 0x48, 0x14, 0x8A, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xC4, 0xF0, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x18, 0x90, 0xBD, 0xE8,
-    0x50, 0x14, 0xCA, 0xE5, 0x1F, 0x00, 0x00, 0xE2, 0x1A, 0x1D, 0x8A, 0xE2, 0x00, 0x00, 0xD1, 0xE7,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xA8, 0xC0, 0x9F, 0xE5, 0xB0, 0x20, 0xDC, 0xE1, 0x01, 0x20, 0xC2, 0xE3,
-    0xB0, 0x20, 0xCC, 0xE1, 0x98, 0x04, 0x9A, 0xE5, 0x90, 0x14, 0x9A, 0xE5, 0x01, 0x00, 0x50, 0xE1,
-    0x04, 0x00, 0x00, 0x1A, 0x01, 0x10, 0xA0, 0xE3, 0x9C, 0x14, 0xCA, 0xE5, 0x0C, 0x10, 0x9F, 0xE5,
-    0x80, 0x00, 0x9F, 0xE5, 0x00, 0x10, 0x80, 0xE5, 0x01, 0x20, 0x82, 0xE3, 0xB0, 0x20, 0xCC, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x10, 0xA0, 0xE3, 0x9C, 0x14, 0xCA, 0xE5, 0x08, 0x10, 0x9F, 0xE5,
-    0x60, 0x00, 0x9F, 0xE5, 0x00, 0x10, 0x80, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0xC0, 0x8C, 0xE0,
-    0x98, 0x04, 0x8A, 0xE5, 0x50, 0x10, 0x9F, 0xE5, 0x04, 0x00, 0xC1, 0xE5, 0x20, 0x04, 0xA0, 0xE1,
-    0x00, 0x00, 0xC1, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0xFD, 0x00, 0x50, 0xE3, 0x3C, 0xF0, 0x9F, 0xB5,
-    0x0F, 0x0D, 0x5C, 0xE3, 0x34, 0xF0, 0x9F, 0xA5, 0x05, 0x50, 0x2D, 0xE9, 0x0C, 0xC0, 0x8C, 0xE0,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x28, 0xF0, 0x9F, 0xE5, 0x05, 0x50, 0xBD, 0xE8, 0x1C, 0xF0, 0x9F, 0xE5,
-    0x56, 0x55, 0x55, 0x55, 0x00, 0x03, 0x06, 0x00, 0x20, 0x81, 0x00, 0x08, 0xA8, 0x58, 0x00, 0x03,
-    0x50, 0x5C, 0x00, 0x03, 0x00, 0x02, 0x00, 0x04, 0xC4, 0x5D, 0x00, 0x03, 0xE0, 0x5D, 0x00, 0x03,
-    0xC4, 0x5D, 0x00, 0x03, 0x5C, 0xC8, 0x00, 0x08, 0x44, 0x05, 0xDA, 0xE5, 0x0F, 0x20, 0x00, 0xE2,
-    0x57, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x0A, 0x57, 0x55, 0xCA, 0xE5,
-    0x65, 0x25, 0xCA, 0xE5, 0x0F, 0x10, 0xA0, 0xE3, 0x64, 0x15, 0xCA, 0xE5, 0x65, 0xC5, 0xDA, 0xE5,
-    0x01, 0xC0, 0x5C, 0xE2, 0x02, 0xC0, 0xA0, 0x41, 0x65, 0xC5, 0xCA, 0xE5, 0x09, 0x00, 0x00, 0x5A,
-    0x64, 0x15, 0xDA, 0xE5, 0x20, 0x20, 0x00, 0xE2, 0x01, 0x20, 0x92, 0xE1, 0x05, 0x00, 0x00, 0x0A,
-    0x01, 0x10, 0x41, 0xE2, 0x0F, 0x10, 0x01, 0xE2, 0x64, 0x15, 0xCA, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x01, 0x02, 0xA0, 0x01, 0xCC, 0x00, 0x00, 0x0B, 0x48, 0x05, 0xDA, 0xE5, 0x0F, 0x20, 0x00, 0xE2,
-    0x5B, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x0A, 0x5B, 0x55, 0xCA, 0xE5,
-    0x69, 0x25, 0xCA, 0xE5, 0x0F, 0x10, 0xA0, 0xE3, 0x68, 0x15, 0xCA, 0xE5, 0x69, 0xC5, 0xDA, 0xE5,
-    0x01, 0xC0, 0x5C, 0xE2, 0x02, 0xC0, 0xA0, 0x41, 0x69, 0xC5, 0xCA, 0xE5, 0x09, 0x00, 0x00, 0x5A,
-    0x68, 0x15, 0xDA, 0xE5, 0x20, 0x20, 0x00, 0xE2, 0x01, 0x20, 0x92, 0xE1, 0x05, 0x00, 0x00, 0x0A,
-    0x01, 0x10, 0x41, 0xE2, 0x0F, 0x10, 0x01, 0xE2, 0x68, 0x15, 0xCA, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x01, 0x02, 0xA0, 0x01, 0x06, 0x01, 0x00, 0x0B, 0x50, 0x05, 0xDA, 0xE5, 0x0F, 0x20, 0x00, 0xE2,
-    0x63, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x0A, 0x63, 0x55, 0xCA, 0xE5,
-    0x6D, 0x25, 0xCA, 0xE5, 0x0F, 0x10, 0xA0, 0xE3, 0x6C, 0x15, 0xCA, 0xE5, 0x6D, 0xC5, 0xDA, 0xE5,
-    0x01, 0xC0, 0x5C, 0xE2, 0x02, 0xC0, 0xA0, 0x41, 0x6D, 0xC5, 0xCA, 0xE5, 0x09, 0x00, 0x00, 0x5A,
-    0x6C, 0x15, 0xDA, 0xE5, 0x20, 0x20, 0x00, 0xE2, 0x01, 0x20, 0x92, 0xE1, 0x05, 0x00, 0x00, 0x0A,
-    0x01, 0x10, 0x41, 0xE2, 0x0F, 0x10, 0x01, 0xE2, 0x6C, 0x15, 0xCA, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x01, 0x02, 0xA0, 0x01, 0x58, 0x01, 0x00, 0x0B, 0x4C, 0x25, 0xDA, 0xE5, 0x5C, 0x05, 0xDA, 0xE5,
-    0x5F, 0x15, 0xDA, 0xE5, 0x80, 0x00, 0x12, 0xE3, 0x5F, 0x55, 0xCA, 0x05, 0x01, 0x10, 0xB0, 0xE1,
-    0x7F, 0x00, 0x02, 0x12, 0x01, 0x00, 0x80, 0x12, 0x00, 0x00, 0xB0, 0xE1, 0x01, 0x00, 0x50, 0x12,
-    0x5C, 0x05, 0xCA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xD4, 0xFB, 0x9F, 0xE5, 0x54, 0x05, 0xDA, 0xE5,
-    0x01, 0x10, 0x80, 0xE2, 0x54, 0x15, 0xCA, 0xE5, 0x03, 0x00, 0x00, 0xE2, 0x00, 0xF1, 0x9F, 0xE7,
-    0x00, 0x00, 0xA0, 0xE1, 0x10, 0x84, 0x00, 0x08, 0x98, 0x85, 0x00, 0x08, 0x1C, 0x84, 0x00, 0x08,
-    0xF4, 0x83, 0x00, 0x08, 0x58, 0x05, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0xAC, 0x25, 0x9A, 0xE5,
-    0x66, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x82, 0xE0, 0x12, 0x20, 0x42, 0xE2, 0x63, 0x00, 0x00, 0xEA,
-    0x58, 0x05, 0xDA, 0xE5, 0xC0, 0x00, 0x10, 0xE3, 0x68, 0x00, 0x00, 0x0B, 0x44, 0x05, 0xDA, 0xE5,
-    0x20, 0x00, 0x10, 0xE3, 0x04, 0x00, 0x00, 0x1A, 0x55, 0x05, 0xDA, 0xE5, 0x01, 0x00, 0x50, 0xE2,
-    0x01, 0x00, 0x00, 0x4A, 0x55, 0x05, 0xCA, 0xE5, 0x6E, 0x00, 0x00, 0xEB, 0x48, 0x05, 0xDA, 0xE5,
-    0x20, 0x00, 0x10, 0xE3, 0x04, 0x00, 0x00, 0x1A, 0x59, 0x05, 0xDA, 0xE5, 0x01, 0x00, 0x50, 0xE2,
-    0x01, 0x00, 0x00, 0x4A, 0x59, 0x05, 0xCA, 0xE5, 0xB9, 0x00, 0x00, 0xEB, 0x4C, 0x05, 0xDA, 0xE5,
-    0x80, 0x00, 0x10, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0x5D, 0x05, 0xDA, 0xE5, 0x01, 0x00, 0x50, 0xE2,
-    0x02, 0x00, 0x00, 0x4A, 0x5D, 0x05, 0xCA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x20, 0xFB, 0x9F, 0xE5,
-    0x50, 0x05, 0xDA, 0xE5, 0x20, 0x00, 0x10, 0xE3, 0x04, 0x00, 0x00, 0x1A, 0x61, 0x05, 0xDA, 0xE5,
-    0x01, 0x00, 0x50, 0xE2, 0x01, 0x00, 0x00, 0x4A, 0x61, 0x05, 0xCA, 0xE5, 0x11, 0x01, 0x00, 0xEB,
-    0x45, 0x15, 0xDA, 0xE5, 0x66, 0x05, 0xDA, 0xE5, 0x87, 0x20, 0x01, 0xE2, 0x00, 0x20, 0x92, 0xE1,
-    0x18, 0x00, 0x00, 0x0A, 0x56, 0x25, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0xFF, 0x20, 0x32, 0x12,
-    0x21, 0x22, 0xA0, 0x01, 0x07, 0x20, 0x02, 0x02, 0x01, 0x20, 0x40, 0x12, 0x66, 0x25, 0xCA, 0xE5,
-    0x00, 0x20, 0xA0, 0xE3, 0x56, 0x25, 0xCA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x0D, 0x00, 0x00, 0x1A,
-    0x07, 0x00, 0x11, 0xE2, 0x80, 0x00, 0x11, 0x13, 0x0A, 0x00, 0x00, 0x0A, 0x70, 0x25, 0x9A, 0xE5,
-    0x08, 0x00, 0x52, 0xE3, 0x07, 0x00, 0x00, 0xBA, 0x08, 0x00, 0x11, 0xE3, 0x32, 0x10, 0xA0, 0xE1,
-    0x01, 0x10, 0xE0, 0x11, 0x01, 0x20, 0x82, 0xE0, 0x02, 0x0B, 0x52, 0xE3, 0x01, 0x00, 0x00, 0xAA,
-    0x70, 0x25, 0x8A, 0xE5, 0x5C, 0x00, 0x00, 0xEB, 0x49, 0x15, 0xDA, 0xE5, 0x6A, 0x05, 0xDA, 0xE5,
-    0x87, 0x20, 0x01, 0xE2, 0x00, 0x20, 0x92, 0xE1, 0x18, 0x00, 0x00, 0x0A, 0x5A, 0x25, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0xFF, 0x20, 0x32, 0x12, 0x21, 0x22, 0xA0, 0x01, 0x07, 0x20, 0x02, 0x02,
-    0x01, 0x20, 0x40, 0x12, 0x6A, 0x25, 0xCA, 0xE5, 0x00, 0x20, 0xA0, 0xE3, 0x5A, 0x25, 0xCA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x0D, 0x00, 0x00, 0x1A, 0x07, 0x00, 0x11, 0xE2, 0x80, 0x00, 0x11, 0x13,
-    0x0A, 0x00, 0x00, 0x0A, 0x74, 0x25, 0x9A, 0xE5, 0x08, 0x00, 0x52, 0xE3, 0x07, 0x00, 0x00, 0xBA,
-    0x08, 0x00, 0x11, 0xE3, 0x32, 0x10, 0xA0, 0xE1, 0x00, 0x10, 0x61, 0x12, 0x01, 0x20, 0x82, 0xE0,
-    0x02, 0x0B, 0x52, 0xE3, 0x01, 0x00, 0x00, 0xAA, 0x74, 0x25, 0x8A, 0xE5, 0x91, 0x00, 0x00, 0xEB,
-    0xAC, 0x25, 0x9A, 0xE5, 0x01, 0x00, 0x00, 0xEA, 0xAC, 0x25, 0x9A, 0xE5, 0x06, 0x20, 0x42, 0xE2,
-    0xC0, 0x17, 0x9A, 0xE5, 0xCD, 0x0F, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0xBC, 0xC0, 0x8C, 0xE2,
-    0x02, 0x10, 0x81, 0xE0, 0x0F, 0xE0, 0xA0, 0xE1, 0xE8, 0xF9, 0x9F, 0xE5, 0xE8, 0xF9, 0x9F, 0xE5,
-    0x07, 0xCC, 0x8A, 0xE2, 0x98, 0xC0, 0x8C, 0xE2, 0xC0, 0x17, 0x9A, 0xE5, 0x0C, 0x20, 0x82, 0xE2,
-    0x00, 0x00, 0x8F, 0xE2, 0xCC, 0xF9, 0x9F, 0xE5, 0x20, 0x04, 0xDA, 0xE5, 0x40, 0x00, 0x80, 0xE3,
-    0x20, 0x04, 0xCA, 0xE5, 0xC4, 0xF9, 0x9F, 0xE5, 0x44, 0x05, 0xCA, 0xE5, 0x01, 0x13, 0xA0, 0xE3,
-    0xC0, 0x20, 0x00, 0xE2, 0x62, 0x20, 0xC1, 0xE5, 0x44, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x64, 0x05, 0xDA, 0x05, 0x00, 0x02, 0xA0, 0xE1, 0xF0, 0x00, 0x00, 0xE2, 0x55, 0x15, 0xDA, 0xE5,
-    0x01, 0x10, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0x03, 0x70, 0x25, 0x9A, 0xE5, 0x45, 0x15, 0xDA, 0xE5,
-    0x08, 0x00, 0x11, 0xE3, 0x07, 0x10, 0x01, 0x02, 0x32, 0x11, 0x82, 0x00, 0x02, 0x10, 0xA0, 0x11,
-    0x02, 0x0B, 0x51, 0xE3, 0x00, 0x00, 0xA0, 0xA3, 0x07, 0x00, 0x52, 0xE3, 0x00, 0x00, 0xA0, 0xD3,
-    0x01, 0x13, 0xA0, 0xE3, 0x63, 0x20, 0xD1, 0xE5, 0x63, 0x00, 0xC1, 0xE5, 0x02, 0x00, 0x50, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0xB0, 0xE1, 0x02, 0x20, 0xB0, 0x11, 0xE7, 0x13, 0x00, 0x0A,
-    0x9C, 0x05, 0x9A, 0xE5, 0x01, 0x05, 0x80, 0xE3, 0x08, 0x01, 0x81, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x45, 0x05, 0xCA, 0xE5, 0xFF, 0x10, 0xA0, 0xE3, 0x56, 0x15, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x46, 0x05, 0xCA, 0xE5, 0x70, 0x05, 0xCA, 0xE5, 0x70, 0x25, 0x9A, 0xE5, 0x02, 0x11, 0xA0, 0xE3,
-    0x02, 0x17, 0x81, 0xE2, 0xA8, 0x05, 0x9A, 0xE5, 0x90, 0x12, 0x32, 0xE0, 0x82, 0x10, 0xB0, 0x41,
-    0x00, 0x20, 0xA0, 0x43, 0x22, 0x2A, 0xA0, 0xE1, 0x02, 0x0B, 0x52, 0xE3, 0x01, 0x20, 0x42, 0x02,
-    0x02, 0x09, 0x82, 0xE2, 0x94, 0x05, 0x8A, 0xE5, 0x0F, 0x0A, 0x82, 0xE2, 0x02, 0x00, 0x80, 0xE0,
-    0x81, 0x08, 0x80, 0xE2, 0x9C, 0x05, 0x8A, 0xE5, 0x01, 0x05, 0x80, 0xE3, 0x01, 0x13, 0xA0, 0xE3,
-    0x08, 0x01, 0x81, 0xE5, 0xC7, 0xFF, 0xFF, 0xEA, 0x47, 0x05, 0xCA, 0xE5, 0xFF, 0x20, 0xA0, 0xE3,
-    0x57, 0x25, 0xCA, 0xE5, 0x60, 0x15, 0xDA, 0xE5, 0x01, 0x20, 0x11, 0xE2, 0x20, 0x20, 0x8F, 0x12,
-    0xFF, 0x00, 0x00, 0xE2, 0xA0, 0x21, 0xD2, 0x17, 0x55, 0x25, 0xCA, 0xE5, 0x07, 0x20, 0x00, 0xE2,
-    0x71, 0x25, 0xCA, 0xE5, 0x0E, 0xC0, 0xA0, 0xE1, 0xDE, 0xFF, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1,
-    0xBA, 0x13, 0x00, 0xEA, 0x0A, 0xFE, 0x14, 0x02, 0x28, 0x04, 0x50, 0x06, 0xA0, 0x08, 0x3C, 0x0A,
-    0x0E, 0x0C, 0x1A, 0x0E, 0x0C, 0x10, 0x18, 0x12, 0x30, 0x14, 0x60, 0x16, 0xC0, 0x18, 0x48, 0x1A,
-    0x10, 0x1C, 0x20, 0x1E, 0x48, 0x05, 0xCA, 0xE5, 0x01, 0x13, 0xA0, 0xE3, 0xC0, 0x20, 0x00, 0xE2,
-    0x68, 0x20, 0xC1, 0xE5, 0x48, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x10, 0xE3, 0x68, 0x05, 0xDA, 0x05,
-    0x00, 0x02, 0xA0, 0xE1, 0x59, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0x03,
-    0x74, 0x25, 0x9A, 0xE5, 0x49, 0x15, 0xDA, 0xE5, 0x08, 0x00, 0x11, 0xE3, 0x07, 0x10, 0x01, 0x02,
-    0x32, 0x11, 0x82, 0x00, 0x02, 0x10, 0xA0, 0x11, 0x02, 0x0B, 0x51, 0xE3, 0x00, 0x00, 0xA0, 0xA3,
-    0x07, 0x00, 0x52, 0xE3, 0x00, 0x00, 0xA0, 0xD3, 0x01, 0x13, 0xA0, 0xE3, 0x69, 0x20, 0xD1, 0xE5,
-    0x69, 0x00, 0xC1, 0xE5, 0xF0, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x50, 0xE1, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x00, 0xB0, 0xE1, 0x02, 0x20, 0xB0, 0x11, 0x80, 0x13, 0x00, 0x0A, 0xA0, 0x05, 0x9A, 0xE5,
-    0x01, 0x05, 0x80, 0xE3, 0x0C, 0x01, 0x81, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x49, 0x05, 0xCA, 0xE5,
-    0xFF, 0x10, 0xA0, 0xE3, 0x5A, 0x15, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x4A, 0x05, 0xCA, 0xE5,
-    0x74, 0x05, 0xCA, 0xE5, 0x74, 0x25, 0x9A, 0xE5, 0x02, 0x11, 0xA0, 0xE3, 0x02, 0x17, 0x81, 0xE2,
-    0xA8, 0x05, 0x9A, 0xE5, 0x90, 0x12, 0x32, 0xE0, 0x82, 0x10, 0xB0, 0x41, 0x00, 0x20, 0xA0, 0x43,
-    0x22, 0x2A, 0xA0, 0xE1, 0x02, 0x0B, 0x52, 0xE3, 0x01, 0x20, 0x42, 0x02, 0x02, 0x09, 0x82, 0xE2,
-    0x98, 0x05, 0x8A, 0xE5, 0x0F, 0x0A, 0x82, 0xE2, 0x02, 0x00, 0x80, 0xE0, 0x81, 0x08, 0x80, 0xE2,
-    0xA0, 0x05, 0x8A, 0xE5, 0x01, 0x05, 0x80, 0xE3, 0x01, 0x13, 0xA0, 0xE3, 0x0C, 0x01, 0x81, 0xE5,
-    0xC7, 0xFF, 0xFF, 0xEA, 0x4B, 0x05, 0xCA, 0xE5, 0xFF, 0x20, 0xA0, 0xE3, 0x5B, 0x25, 0xCA, 0xE5,
-    0x60, 0x15, 0xDA, 0xE5, 0x02, 0x20, 0x11, 0xE2, 0x4B, 0x2F, 0x4F, 0x12, 0xFF, 0x00, 0x00, 0xE2,
-    0xA0, 0x21, 0xD2, 0x17, 0x59, 0x25, 0xCA, 0xE5, 0x07, 0x20, 0x00, 0xE2, 0x75, 0x25, 0xCA, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0xDE, 0xFF, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1, 0x53, 0x13, 0x00, 0xEA,
-    0x4C, 0x05, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x4E, 0x05, 0xCA, 0xE5, 0x78, 0x05, 0xCA, 0xE5,
-    0x78, 0x25, 0x9A, 0xE5, 0x02, 0x11, 0xA0, 0xE3, 0x02, 0x17, 0x81, 0xE2, 0xA8, 0x05, 0x9A, 0xE5,
-    0x90, 0x12, 0x32, 0xE0, 0x82, 0x10, 0xB0, 0x41, 0x00, 0x20, 0xA0, 0x43, 0x22, 0x2A, 0xA0, 0xE1,
-    0x02, 0x0B, 0x52, 0xE3, 0x01, 0x20, 0x42, 0x02, 0x01, 0x13, 0xA0, 0xE3, 0xB4, 0x27, 0xC1, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x4F, 0x05, 0xCA, 0xE5, 0xFF, 0x20, 0xA0, 0xE3, 0x5F, 0x25, 0xCA, 0xE5,
-    0x60, 0x15, 0xDA, 0xE5, 0x04, 0x20, 0x11, 0xE2, 0x6B, 0x2F, 0x4F, 0x12, 0xFF, 0x00, 0x00, 0xE2,
-    0xA0, 0x21, 0xD2, 0x17, 0x5D, 0x25, 0xCA, 0xE5, 0x07, 0x20, 0x00, 0xE2, 0x79, 0x25, 0xCA, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0xC4, 0xF6, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0xE2, 0xFF, 0xFF, 0xEA, 0x50, 0x05, 0xCA, 0xE5, 0x50, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x6C, 0x05, 0xDA, 0x05, 0x00, 0x02, 0xA0, 0xE1, 0xF0, 0x00, 0x00, 0xE2, 0x61, 0x15, 0xDA, 0xE5,
-    0x01, 0x10, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0x03, 0x01, 0x13, 0xA0, 0xE3, 0x79, 0x20, 0xD1, 0xE5,
-    0x79, 0x00, 0xC1, 0xE5, 0x02, 0x00, 0x50, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0xA4, 0x05, 0x9A, 0xE5,
-    0x02, 0x09, 0x80, 0xE3, 0x7C, 0x00, 0x81, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x52, 0x05, 0xCA, 0xE5,
-    0x0F, 0x10, 0x00, 0xE2, 0x18, 0x20, 0x8F, 0xE2, 0x01, 0x20, 0xD2, 0xE7, 0x80, 0x00, 0x10, 0xE3,
-    0x08, 0x20, 0x82, 0x13, 0x01, 0x13, 0xA0, 0xE3, 0xA4, 0x25, 0x8A, 0xE5, 0xBC, 0x27, 0xC1, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x01, 0x05, 0x11, 0x15, 0x17, 0x25, 0x33, 0x34, 0x35, 0x37, 0x45,
-    0x47, 0x55, 0x65, 0x75, 0x53, 0x05, 0xCA, 0xE5, 0xFF, 0x20, 0xA0, 0xE3, 0x63, 0x25, 0xCA, 0xE5,
-    0x60, 0x15, 0xDA, 0xE5, 0x08, 0x20, 0x11, 0xE2, 0x9B, 0x2F, 0x4F, 0x12, 0xFF, 0x00, 0x00, 0xE2,
-    0xA0, 0x21, 0xD2, 0x17, 0x61, 0x25, 0xCA, 0xE5, 0xD6, 0xFF, 0xFF, 0xEA, 0x7C, 0x25, 0xDA, 0xE5,
-    0x7C, 0x05, 0xCA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x20, 0x14, 0xDA, 0x05, 0x80, 0x10, 0xC1, 0x03,
-    0x20, 0x14, 0xCA, 0x05, 0x00, 0x20, 0x22, 0xE0, 0x0F, 0x00, 0x12, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x0F, 0x00, 0x00, 0xE2, 0x98, 0x10, 0x8F, 0xE2, 0x00, 0x00, 0x80, 0xE0, 0xB0, 0x20, 0x91, 0xE1,
-    0x01, 0x03, 0xA0, 0xE3, 0x01, 0x1C, 0xA0, 0xE3, 0xB1, 0x20, 0x80, 0xE1, 0x00, 0x40, 0x2D, 0xE9,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xD8, 0xF5, 0x9F, 0xE5, 0x00, 0x40, 0xBD, 0xE8, 0x7C, 0x05, 0xDA, 0xE5,
-    0x0F, 0x00, 0x00, 0xE2, 0x88, 0x10, 0x8F, 0xE2, 0x0C, 0x25, 0xDA, 0xE5, 0x04, 0x00, 0x12, 0xE3,
-    0x10, 0x00, 0x80, 0x12, 0x80, 0x10, 0x81, 0xE0, 0xB0, 0x20, 0xD1, 0xE1, 0xB8, 0x25, 0x8A, 0xE5,
-    0xAC, 0x10, 0x8F, 0xE2, 0x00, 0x21, 0x91, 0xE7, 0xBC, 0x25, 0x8A, 0xE5, 0xA4, 0xF5, 0x9F, 0xE5,
-    0x00, 0x00, 0x80, 0xE0, 0xFE, 0x00, 0x00, 0xE2, 0x80, 0x00, 0x40, 0xE2, 0x88, 0x05, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x7E, 0x05, 0xCA, 0xE5, 0xFF, 0x10, 0x00, 0xE2, 0x03, 0x09, 0xA0, 0xE3,
-    0x01, 0x03, 0x80, 0xE1, 0x8C, 0x05, 0x8A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x7F, 0x05, 0xCA, 0xE5,
-    0xFF, 0x00, 0x00, 0xE2, 0x00, 0x02, 0xA0, 0xE1, 0x01, 0x00, 0x80, 0xE2, 0x80, 0x05, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x54, 0xF0, 0x16, 0xF2, 0x8D, 0xF3, 0x49, 0xF4, 0x88, 0xF5, 0xB4, 0xF6,
-    0xBA, 0xF7, 0x2A, 0xF8, 0x0B, 0xF9, 0x25, 0xFA, 0xCD, 0xFA, 0x51, 0xFB, 0x1F, 0xFC, 0xE4, 0xFC,
-    0x5E, 0xFD, 0x06, 0xFE, 0x04, 0x05, 0x74, 0x04, 0xFC, 0x03, 0xC0, 0x03, 0x5A, 0x03, 0xFA, 0x02,
-    0xA6, 0x02, 0x82, 0x02, 0x3A, 0x02, 0xE0, 0x01, 0xAA, 0x01, 0x80, 0x01, 0x3E, 0x01, 0xFC, 0x00,
-    0xD8, 0x00, 0xA2, 0x00, 0xAA, 0x04, 0x26, 0x04, 0xB4, 0x03, 0x7E, 0x03, 0x3C, 0x03, 0xC4, 0x02,
-    0x76, 0x02, 0x52, 0x02, 0x10, 0x02, 0xBC, 0x01, 0x8C, 0x01, 0x62, 0x01, 0x26, 0x01, 0xEA, 0x00,
-    0xC6, 0x00, 0x96, 0x00, 0x5F, 0x0A, 0x33, 0x00, 0xDC, 0x7C, 0x39, 0x00, 0x41, 0x40, 0x40, 0x00,
-    0x45, 0x44, 0x44, 0x00, 0xDE, 0x61, 0x4C, 0x00, 0x59, 0x01, 0x56, 0x00, 0x29, 0xA9, 0x60, 0x00,
-    0xBD, 0x14, 0x66, 0x00, 0xB7, 0xF9, 0x72, 0x00, 0x89, 0x88, 0x88, 0x00, 0x23, 0xD7, 0x99, 0x00,
-    0xAB, 0xAA, 0xAA, 0x00, 0x8B, 0x16, 0xCE, 0x00, 0x42, 0x10, 0x04, 0x01, 0x4C, 0x68, 0x2F, 0x01,
-    0x10, 0x8B, 0x94, 0x01, 0x46, 0xE3, 0x36, 0x00, 0xC2, 0xB5, 0x3D, 0x00, 0x7D, 0x21, 0x45, 0x00,
-    0x76, 0x4E, 0x49, 0x00, 0x57, 0x26, 0x4F, 0x00, 0xA2, 0x90, 0x5C, 0x00, 0x81, 0x06, 0x68, 0x00,
-    0x79, 0x54, 0x6E, 0x00, 0x08, 0x1F, 0x7C, 0x00, 0x86, 0x9A, 0x93, 0x00, 0xB6, 0x7E, 0xA5, 0x00,
-    0x44, 0x21, 0xB9, 0x00, 0x5D, 0xE9, 0xDE, 0x00, 0x82, 0x11, 0x18, 0x01, 0x6B, 0xFD, 0x4A, 0x01,
-    0x1C, 0xE8, 0xB4, 0x01, 0x20, 0x24, 0xDA, 0xE5, 0x80, 0x20, 0xD2, 0xE3, 0x44, 0x00, 0x00, 0x1A,
-    0x20, 0x24, 0xCA, 0xE5, 0x60, 0x15, 0xDA, 0xE5, 0x0F, 0x10, 0x01, 0xE2, 0xC0, 0x25, 0x9A, 0xE5,
-    0x02, 0x20, 0xB0, 0xE1, 0x10, 0x10, 0x81, 0x13, 0x60, 0x05, 0xCA, 0xE5, 0x00, 0xC0, 0x31, 0xE0,
-    0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x40, 0x2D, 0xE9, 0x01, 0xC0, 0x1C, 0xE0, 0x0E, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0xE3, 0x01, 0x00, 0x1C, 0xE3, 0x55, 0x55, 0xCA, 0x15, 0xA5, 0xFE, 0xFF, 0x1B,
-    0x00, 0x00, 0xA0, 0xE3, 0x02, 0x00, 0x1C, 0xE3, 0x59, 0x55, 0xCA, 0x15, 0xF3, 0xFE, 0xFF, 0x1B,
-    0x04, 0x00, 0x1C, 0xE3, 0x5D, 0x55, 0xCA, 0x15, 0x6F, 0x12, 0x00, 0x1B, 0x00, 0x00, 0xA0, 0xE3,
-    0x08, 0x00, 0x1C, 0xE3, 0x61, 0x55, 0xCA, 0x15, 0x56, 0xFF, 0xFF, 0x1B, 0x60, 0x05, 0xDA, 0xE5,
-    0xC0, 0x15, 0x9A, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x7D, 0x25, 0xDA, 0xE5, 0x0F, 0x20, 0x02, 0xE2,
-    0x10, 0x20, 0x82, 0x13, 0x00, 0x20, 0x32, 0xE0, 0x7D, 0x05, 0xCA, 0xE5, 0x10, 0x00, 0x12, 0xE3,
-    0x1E, 0x00, 0x00, 0x0A, 0x10, 0x00, 0x10, 0xE3, 0x06, 0x00, 0x00, 0x1A, 0x00, 0x10, 0xE0, 0x03,
-    0x84, 0x15, 0x8A, 0x05, 0x0F, 0xE0, 0xA0, 0xE1, 0xC4, 0xF3, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0xC0, 0x05, 0x8A, 0xE5, 0x15, 0x00, 0x00, 0xEA, 0x0F, 0xE0, 0xA0, 0xE1, 0xB0, 0xF3, 0x9F, 0xE5,
-    0x7E, 0x05, 0xDA, 0xE5, 0x86, 0xFF, 0xFF, 0xEB, 0x90, 0x05, 0x8A, 0xE5, 0x7F, 0x05, 0xDA, 0xE5,
-    0x89, 0xFF, 0xFF, 0xEB, 0x84, 0x05, 0x8A, 0xE5, 0x32, 0x00, 0x50, 0xE3, 0x98, 0x13, 0x9F, 0x55,
-    0x80, 0x20, 0xA0, 0x53, 0xB2, 0x20, 0xC1, 0x51, 0xC5, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1,
-    0x01, 0x20, 0xA0, 0xE3, 0xC5, 0x25, 0xCA, 0xE5, 0x01, 0x00, 0x40, 0x02, 0xC0, 0x05, 0x8A, 0xE5,
-    0x0F, 0xE0, 0xA0, 0x01, 0x74, 0xF3, 0x9F, 0x05, 0x0F, 0xE0, 0xA0, 0xE1, 0x64, 0xF3, 0x9F, 0xE5,
-    0x00, 0x80, 0xBD, 0xE8, 0x03, 0x10, 0x59, 0xE5, 0x9D, 0x00, 0x51, 0xE3, 0x99, 0x00, 0x51, 0x13,
-    0x40, 0x20, 0xC2, 0x03, 0xB5, 0xFF, 0xFF, 0xEA, 0xC0, 0x00, 0x00, 0xE2, 0x58, 0x05, 0xCA, 0xE5,
-    0x40, 0x00, 0x10, 0xE3, 0x20, 0x14, 0xDA, 0x15, 0x40, 0x10, 0xC1, 0x13, 0x20, 0x14, 0xCA, 0x15,
-    0x80, 0x00, 0x10, 0xE3, 0x00, 0x10, 0xA0, 0x13, 0x01, 0x10, 0xA0, 0x03, 0x54, 0x15, 0xCA, 0xE5,
-    0x0C, 0x07, 0x9A, 0xE5, 0x48, 0x04, 0x40, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x00, 0x10, 0x81, 0xE0,
-    0xC0, 0x27, 0x9A, 0xE5, 0x01, 0x00, 0x42, 0xE0, 0x14, 0x23, 0x9F, 0xE5, 0x90, 0x02, 0x02, 0xE0,
-    0x22, 0x28, 0xA0, 0xE1, 0x01, 0x20, 0x02, 0xE2, 0x82, 0x20, 0x82, 0xE0, 0xAC, 0x05, 0x9A, 0x05,
-    0x00, 0x20, 0x82, 0x00, 0x02, 0x10, 0x81, 0xE0, 0x07, 0xCC, 0x8A, 0xE2, 0xBC, 0xC0, 0x8C, 0xE2,
-    0xF0, 0x02, 0x9F, 0xE5, 0xF0, 0xF2, 0x9F, 0xE5, 0x20, 0x04, 0xDA, 0xE5, 0x40, 0x10, 0xC0, 0xE3,
-    0x20, 0x14, 0xCA, 0xE5, 0xC0, 0x00, 0x00, 0xE2, 0x55, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1,
-    0x01, 0x00, 0x80, 0x13, 0x59, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x02, 0x00, 0x80, 0x13,
-    0x5D, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x04, 0x00, 0x80, 0x13, 0x61, 0x15, 0xDA, 0xE5,
-    0x01, 0x10, 0xB0, 0xE1, 0x08, 0x00, 0x80, 0x13, 0xC0, 0x15, 0x9A, 0xE5, 0x01, 0x10, 0xB0, 0xE1,
-    0x10, 0x00, 0x80, 0x13, 0x1E, 0xFF, 0x2F, 0xE1, 0x0C, 0x27, 0x9A, 0xE5, 0x0C, 0x20, 0x82, 0xE2,
-    0x00, 0x00, 0x00, 0xEA, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0xB0, 0x25, 0x9A, 0xE5, 0x02, 0x00, 0x51, 0xE0, 0x1E, 0xFF, 0x2F, 0x41,
-    0xB0, 0x15, 0x8A, 0xE5, 0xB4, 0x15, 0x9A, 0xE5, 0x00, 0x20, 0x51, 0xE0, 0xB4, 0x25, 0x8A, 0xC5,
-    0x1E, 0xFF, 0x2F, 0xC1, 0x01, 0x00, 0x40, 0xE0, 0xBC, 0x15, 0x9A, 0xE5, 0x90, 0xC1, 0x82, 0xE0,
-    0xB8, 0x15, 0x9A, 0xE5, 0x92, 0x01, 0x0C, 0xE0, 0x0C, 0x00, 0x50, 0xE0, 0x00, 0x10, 0x41, 0xE0,
-    0xB4, 0x15, 0x8A, 0xE5, 0x01, 0x20, 0x82, 0xE2, 0xC4, 0x05, 0xDA, 0xE5, 0x02, 0x10, 0x50, 0xE0,
-    0xC4, 0x15, 0xCA, 0xC5, 0x1E, 0xFF, 0x2F, 0xC1, 0x00, 0x20, 0x42, 0xE0, 0x07, 0x00, 0x02, 0xE2,
-    0x08, 0x00, 0x60, 0xE2, 0xC4, 0x05, 0xCA, 0xE5, 0xA2, 0x21, 0xA0, 0xE1, 0x01, 0x20, 0x82, 0xE2,
-    0xC0, 0x05, 0x9A, 0xE5, 0xC5, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0x90, 0xE0, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x00, 0xB0, 0xE1, 0xC5, 0x05, 0xCA, 0x05, 0x1E, 0xFF, 0x2F, 0x01, 0x02, 0x10, 0x50, 0xE0,
-    0x12, 0x00, 0x00, 0xCA, 0x7C, 0xC5, 0xDA, 0xE5, 0xC0, 0xC0, 0x0C, 0xE2, 0x40, 0x00, 0x1C, 0xE3,
-    0x09, 0x00, 0x00, 0x1A, 0x01, 0x10, 0xB0, 0xE1, 0x00, 0x10, 0xA0, 0xE3, 0xC5, 0x15, 0xCA, 0x45,
-    0xC0, 0x25, 0x9A, 0xE5, 0x80, 0x00, 0x5C, 0xE3, 0x08, 0x00, 0x00, 0x1A, 0x20, 0xC4, 0xDA, 0xE5,
-    0x80, 0xC0, 0x8C, 0xE3, 0x20, 0xC4, 0xCA, 0xE5, 0x04, 0x00, 0x00, 0xEA, 0x80, 0xC5, 0x9A, 0xE5,
-    0x0C, 0xC0, 0xB0, 0xE1, 0x01, 0x10, 0xA0, 0x03, 0x0C, 0x10, 0x91, 0xE0, 0xFD, 0xFF, 0xFF, 0xDA,
-    0xC0, 0x15, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0xC0, 0x25, 0x9A, 0xE5, 0x01, 0x20, 0x52, 0xE2,
-    0x1E, 0xFF, 0x2F, 0x41, 0xC4, 0x05, 0xDA, 0xE5, 0x01, 0x00, 0x40, 0xE2, 0x07, 0x00, 0x00, 0xE2,
-    0x82, 0x01, 0x80, 0xE0, 0xB8, 0x25, 0x9A, 0xE5, 0xB4, 0x15, 0x9A, 0xE5, 0x90, 0x12, 0x2C, 0xE0,
-    0xB0, 0x15, 0x9A, 0xE5, 0x0C, 0x10, 0x81, 0xE0, 0x70, 0x01, 0x9F, 0xE5, 0x70, 0xC1, 0x9F, 0xE5,
-    0x64, 0xF1, 0x9F, 0xE5, 0xB2, 0xFF, 0xFF, 0xEB, 0xEE, 0xFF, 0xFF, 0xEB, 0x64, 0xF1, 0x9F, 0xE5,
-    0x01, 0x13, 0xA0, 0xE3, 0xB8, 0x08, 0xD1, 0xE1, 0x03, 0x09, 0xC0, 0xE3, 0x02, 0x09, 0x80, 0xE3,
-    0xB8, 0x08, 0xC1, 0xE1, 0x80, 0x00, 0xA0, 0xE3, 0xB4, 0x08, 0xC1, 0xE1, 0x48, 0x01, 0x9F, 0xE5,
-    0x80, 0x00, 0x81, 0xE5, 0x08, 0x00, 0xA0, 0xE3, 0x60, 0x00, 0x81, 0xE5, 0x68, 0x00, 0x81, 0xE5,
-    0x02, 0x09, 0xA0, 0xE3, 0x64, 0x00, 0x81, 0xE5, 0x6C, 0x00, 0x81, 0xE5, 0x40, 0x00, 0xA0, 0xE3,
-    0x70, 0x00, 0x81, 0xE5, 0x94, 0xC0, 0x8F, 0xE2, 0x0F, 0x00, 0x9C, 0xE8, 0x1C, 0xC1, 0x9F, 0xE5,
-    0x0F, 0x00, 0x8C, 0xE8, 0x01, 0x13, 0xA0, 0xE3, 0x80, 0x00, 0xA0, 0xE3, 0x70, 0x00, 0x81, 0xE5,
-    0x02, 0x09, 0xA0, 0xE3, 0x74, 0x00, 0x81, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x78, 0x00, 0x81, 0xE5,
-    0x02, 0x09, 0xA0, 0xE3, 0x78, 0x00, 0x81, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x78, 0x00, 0x81, 0xE5,
-    0xB2, 0x1D, 0xC1, 0xE1, 0xA4, 0x00, 0x81, 0xE2, 0xCC, 0x00, 0x81, 0xE5, 0xE0, 0x00, 0x9F, 0xE5,
-    0xC8, 0x00, 0x81, 0xE5, 0xDC, 0x00, 0x9F, 0xE5, 0xB2, 0x0D, 0xC1, 0xE1, 0x01, 0x1C, 0x81, 0xE2,
-    0x00, 0x00, 0xA0, 0xE3, 0xB4, 0x00, 0xC1, 0xE0, 0x7F, 0x00, 0xE0, 0xE3, 0xB2, 0x00, 0xC1, 0xE0,
-    0x00, 0x00, 0xA0, 0xE3, 0xB0, 0x00, 0xC1, 0xE1, 0xC4, 0x00, 0xA0, 0xE3, 0xB2, 0x00, 0xC1, 0xE0,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0x08, 0x00, 0xA0, 0xE3, 0xC4, 0x05, 0xCA, 0xE5,
-    0x03, 0x00, 0xA0, 0xE3, 0xB4, 0x05, 0x8A, 0xE5, 0xA3, 0xFE, 0xFF, 0xEB, 0x00, 0x80, 0xBD, 0xE8,
-    0x76, 0x54, 0x32, 0x10, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98,
-    0xF8, 0x5F, 0x2D, 0xE9, 0x80, 0xA0, 0x9F, 0xE5, 0x44, 0x05, 0xDA, 0xE5, 0x9D, 0xFD, 0xFF, 0xEB,
-    0xC4, 0xFD, 0xFF, 0xEB, 0xA1, 0x11, 0x00, 0xEB, 0x48, 0x05, 0xDA, 0xE5, 0xEC, 0xFD, 0xFF, 0xEB,
-    0x13, 0xFE, 0xFF, 0xEB, 0x89, 0x11, 0x00, 0xEB, 0x38, 0xFE, 0xFF, 0xEB, 0x55, 0xFE, 0xFF, 0xEB,
-    0x52, 0x05, 0xDA, 0xE5, 0x64, 0xFE, 0xFF, 0xEB, 0x8F, 0xFE, 0xFF, 0xEB, 0xF8, 0x5F, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0xAC, 0x38, 0x00, 0x06, 0xAC, 0x66, 0x00, 0x03, 0x88, 0x44, 0x00, 0x03,
-    0x98, 0x44, 0x00, 0x03, 0x28, 0x8D, 0x00, 0x08, 0x28, 0x8E, 0x00, 0x08, 0x00, 0x01, 0x00, 0x04,
-    0x24, 0x8E, 0x00, 0x08, 0x56, 0x55, 0x00, 0x00, 0x78, 0x82, 0x00, 0x08, 0xA0, 0x66, 0x00, 0x03,
-    0x64, 0x8E, 0x00, 0x08, 0xC8, 0x75, 0x00, 0x03, 0x7C, 0x44, 0x00, 0x03, 0x77, 0xFF, 0x0E, 0xB0,
-    0x90, 0x00, 0x00, 0x04, 0x80, 0x02, 0x00, 0x05, 0x40, 0xB6, 0x00, 0x00, 0x3C, 0x6E, 0x00, 0x03,
-    0x80, 0x29, 0x00, 0x03, 0x38, 0x2D, 0x00, 0x03, 0xC0, 0x30, 0x00, 0x03, 0x7C, 0x34, 0x00, 0x03,
-    0xDC, 0x37, 0x00, 0x03, 0x08, 0x3B, 0x00, 0x03, 0xC4, 0x3E, 0x00, 0x03, 0x38, 0x42, 0x00, 0x03,
-    0x1C, 0x30, 0x00, 0x03, 0xB0, 0x29, 0x00, 0x03, 0x68, 0x2D, 0x00, 0x03, 0xF0, 0x30, 0x00, 0x03,
-    0xAC, 0x34, 0x00, 0x03, 0x0C, 0x38, 0x00, 0x03, 0x38, 0x3B, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x03,
-    0x68, 0x42, 0x00, 0x03, 0x10, 0x30, 0x00, 0x03, 0x08, 0x40, 0x2D, 0xE9, 0x00, 0x10, 0xA0, 0xE3,
-    0x18, 0x18, 0x8A, 0xE5, 0x1C, 0x18, 0x8A, 0xE5, 0x3C, 0x00, 0x9F, 0xE5, 0x40, 0x20, 0xA0, 0xE3,
-    0x5D, 0xF7, 0xFF, 0xEB, 0x6C, 0x20, 0x4F, 0xE2, 0x10, 0x00, 0xA0, 0xE3, 0x2C, 0x10, 0x9F, 0xE5,
-    0x08, 0xC0, 0xA0, 0xE3, 0x04, 0x30, 0x92, 0xE4, 0x00, 0x31, 0x81, 0xE7, 0x20, 0x00, 0x80, 0xE2,
-    0x01, 0xC0, 0x5C, 0xE2, 0xFA, 0xFF, 0xFF, 0x1A, 0x04, 0x30, 0x92, 0xE4, 0x4C, 0x00, 0xA0, 0xE3,
-    0x00, 0x31, 0x81, 0xE7, 0x08, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x60, 0xFA, 0x03, 0x02,
-    0x3C, 0x6E, 0x00, 0x03, 0x01, 0x00, 0x10, 0xE3, 0xF8, 0x4F, 0x2D, 0x09, 0x84, 0xA4, 0x9F, 0xE5,
-    0x84, 0xB4, 0x9F, 0xE5, 0x14, 0x08, 0xCA, 0xE5, 0x80, 0x24, 0x9F, 0xE5, 0x00, 0x20, 0xD2, 0xE5,
-    0x02, 0x20, 0xB0, 0xE1, 0x78, 0x14, 0x9F, 0x15, 0x0F, 0xE0, 0xA0, 0x11, 0x11, 0xFF, 0x2F, 0x11,
-    0x00, 0x10, 0xA0, 0xE3, 0x76, 0x14, 0xCA, 0xE5, 0x41, 0x00, 0x00, 0xEA, 0x01, 0x2B, 0x8A, 0xE2,
-    0xF8, 0x03, 0x82, 0xE8, 0x01, 0x00, 0xA0, 0xE3, 0x16, 0x08, 0xCA, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0x15, 0x08, 0xCA, 0xE5, 0x4C, 0x14, 0x9F, 0xE5, 0xB0, 0x00, 0xD1, 0xE1, 0xFF, 0x00, 0x20, 0xE2,
-    0x03, 0x0C, 0x20, 0xE2, 0x34, 0x14, 0x9A, 0xE5, 0x00, 0x10, 0x21, 0xE0, 0x00, 0x10, 0x01, 0xE0,
-    0x34, 0x04, 0x8A, 0xE5, 0x0D, 0x35, 0xDA, 0xE5, 0x02, 0x00, 0x53, 0xE3, 0x08, 0x00, 0x00, 0x2A,
-    0x77, 0x34, 0xDA, 0xE5, 0x01, 0x0C, 0x10, 0xE3, 0x02, 0x30, 0x83, 0x12, 0x50, 0x00, 0x53, 0xE3,
-    0x50, 0x30, 0xA0, 0xC3, 0x02, 0x0C, 0x10, 0xE3, 0x02, 0x30, 0x53, 0x12, 0x00, 0x30, 0xA0, 0x43,
-    0x77, 0x34, 0xCA, 0xE5, 0x14, 0x28, 0xDA, 0xE5, 0x00, 0x00, 0x52, 0xE3, 0xF8, 0x4F, 0xBD, 0x08,
-    0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x23, 0xA0, 0xE3, 0x11, 0x3E, 0xA0, 0xE3, 0xB0, 0x35, 0xC2, 0xE1,
-    0x01, 0x3A, 0xA0, 0xE3, 0xB2, 0x35, 0xC2, 0xE1, 0x74, 0xE0, 0x8F, 0xE2, 0x03, 0x0C, 0x11, 0xE3,
-    0x01, 0x0C, 0x10, 0x13, 0x02, 0x0C, 0x10, 0x13, 0xCC, 0x13, 0x9F, 0x15, 0x11, 0xFF, 0x2F, 0x11,
-    0x03, 0x3C, 0x10, 0xE2, 0x03, 0x3C, 0x33, 0x12, 0x0C, 0x00, 0xC0, 0x13, 0x38, 0x04, 0x8A, 0xE5,
-    0x13, 0x00, 0x00, 0x0A, 0x02, 0x0C, 0x10, 0xE3, 0x04, 0x00, 0x11, 0x13, 0x78, 0x24, 0xDA, 0x15,
-    0x01, 0x20, 0x82, 0x12, 0x78, 0x24, 0xCA, 0x15, 0x02, 0x0C, 0x10, 0xE3, 0x08, 0x00, 0x11, 0x13,
-    0x76, 0x24, 0xDA, 0xE5, 0x01, 0x20, 0x82, 0x12, 0x03, 0x00, 0x52, 0xE3, 0x00, 0x20, 0xA0, 0x03,
-    0x76, 0x24, 0xCA, 0xE5, 0x01, 0x0C, 0x10, 0xE3, 0x08, 0x00, 0x11, 0x13, 0x7C, 0x13, 0x9F, 0x15,
-    0x11, 0xFF, 0x2F, 0x11, 0x01, 0x0C, 0x10, 0xE3, 0x04, 0x00, 0x11, 0x13, 0x70, 0x13, 0x9F, 0x15,
-    0x11, 0xFF, 0x2F, 0x11, 0x54, 0x23, 0x9F, 0xE5, 0x00, 0x20, 0xD2, 0xE5, 0x02, 0x20, 0xB0, 0xE1,
-    0x4C, 0x13, 0x9F, 0x15, 0x0F, 0xE0, 0xA0, 0x11, 0x11, 0xFF, 0x2F, 0x11, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x50, 0xF3, 0x9F, 0xE5, 0xBA, 0xFF, 0xFF, 0x1A, 0x34, 0x04, 0x9A, 0xE5, 0x48, 0x13, 0x9F, 0xE5,
-    0x00, 0x20, 0x91, 0xE5, 0x00, 0x00, 0x50, 0xE3, 0x04, 0x20, 0x91, 0x15, 0x01, 0x20, 0x52, 0xE2,
-    0x00, 0x20, 0x81, 0xE5, 0xC7, 0xF5, 0xFF, 0x0B, 0x00, 0x00, 0xA0, 0xE3, 0x16, 0x08, 0xCA, 0xE5,
-    0x24, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x24, 0x04, 0x8A, 0xE5, 0x01, 0x00, 0xA0, 0xE3,
-    0xFB, 0x06, 0xCA, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0xF5, 0x06, 0xCA, 0xE5, 0x0C, 0x13, 0x9F, 0xE5,
-    0x00, 0x00, 0xA0, 0xE3, 0x00, 0x00, 0xC1, 0xE5, 0xEC, 0x06, 0x9A, 0xE5, 0x00, 0x13, 0x9F, 0xE5,
-    0x00, 0x00, 0x81, 0xE5, 0xFC, 0x12, 0x9F, 0xE5, 0x00, 0x10, 0x91, 0xE5, 0x01, 0x10, 0xB0, 0xE1,
-    0x02, 0x00, 0x00, 0x0A, 0xF0, 0x02, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x10, 0xFF, 0x2F, 0xE1,
-    0x30, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x30, 0x04, 0x8A, 0xE5, 0x01, 0x0B, 0x8A, 0xE2,
-    0xF8, 0x03, 0x90, 0xE8, 0x0C, 0x15, 0x9A, 0xE5, 0x04, 0x20, 0x01, 0xE2, 0x04, 0x20, 0x32, 0xE2,
-    0x5A, 0x24, 0xDA, 0xE5, 0x18, 0x00, 0x12, 0x13, 0x24, 0x24, 0xDA, 0x15, 0x01, 0x20, 0x02, 0x12,
-    0x18, 0x07, 0x9A, 0xE5, 0x02, 0x00, 0x40, 0xE0, 0x14, 0x07, 0x8A, 0xE5, 0x04, 0x00, 0x11, 0xE3,
-    0x60, 0x20, 0x40, 0x02, 0x5B, 0x20, 0x40, 0x12, 0x04, 0x28, 0x8A, 0xE5, 0xF5, 0x20, 0x80, 0x02,
-    0xE4, 0x20, 0x80, 0x12, 0x0C, 0x28, 0x8A, 0xE5, 0x80, 0x20, 0x80, 0x02, 0x78, 0x20, 0x80, 0x12,
-    0x10, 0x28, 0x8A, 0xE5, 0xE4, 0x17, 0x9A, 0xE5, 0x01, 0x10, 0x80, 0xE0, 0x18, 0x17, 0x8A, 0xE5,
-    0x0C, 0x10, 0x41, 0xE2, 0x74, 0x02, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x2C, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x68, 0xF2, 0x9F, 0xE5, 0x14, 0x07, 0x9A, 0xE5, 0xF4, 0x27, 0x9A, 0xE5,
-    0x02, 0x10, 0x80, 0xE0, 0x5C, 0x02, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x50, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x48, 0xF2, 0x9F, 0xE5, 0x14, 0x07, 0x9A, 0xE5, 0xF8, 0x27, 0x9A, 0xE5,
-    0x02, 0x10, 0x80, 0xE0, 0x40, 0x02, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x44, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x28, 0xF2, 0x9F, 0xE5, 0x14, 0x07, 0x9A, 0xE5, 0xFC, 0x27, 0x9A, 0xE5,
-    0x02, 0x10, 0x80, 0xE0, 0x24, 0x02, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0xA4, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x08, 0xF2, 0x9F, 0xE5, 0x14, 0x07, 0x9A, 0xE5, 0x00, 0x28, 0x9A, 0xE5,
-    0x02, 0x10, 0x80, 0xE0, 0x08, 0x02, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x38, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xE8, 0xF1, 0x9F, 0xE5, 0x5A, 0x04, 0xDA, 0xE5, 0x18, 0x00, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0x11, 0xEC, 0xF1, 0x9F, 0x15, 0xEC, 0xF1, 0x9F, 0xE5, 0x08, 0x00, 0x4F, 0xE2,
-    0x24, 0x17, 0x9A, 0xE5, 0x07, 0x16, 0x81, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x20, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xB8, 0xF1, 0x9F, 0xE5, 0xCC, 0xF1, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xC8, 0xF1, 0x9F, 0xE5, 0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x1A,
-    0x40, 0x14, 0x9A, 0xE5, 0x6C, 0x10, 0x0A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xB0, 0xF1, 0x9F, 0xE5,
-    0xA4, 0xF1, 0x9F, 0xE5, 0x01, 0x00, 0xA0, 0xE3, 0x79, 0x04, 0xCA, 0xE5, 0x58, 0x04, 0xDA, 0xE5,
-    0x59, 0x04, 0xCA, 0xE5, 0x90, 0xF1, 0x9F, 0xE5, 0x01, 0x00, 0xA0, 0xE3, 0xF5, 0x06, 0xCA, 0xE5,
-    0x5A, 0x04, 0xDA, 0xE5, 0x18, 0x00, 0x10, 0xE3, 0x01, 0x00, 0x00, 0x0A, 0x57, 0xFA, 0xFF, 0xEB,
-    0x74, 0xF1, 0x9F, 0xE5, 0x50, 0xFA, 0xFF, 0xEB, 0x6C, 0xF1, 0x9F, 0xE5, 0x57, 0x54, 0xCA, 0xE5,
-    0x01, 0x10, 0xA0, 0xE3, 0xF7, 0x16, 0xCA, 0xE5, 0x30, 0x11, 0x9F, 0xE5, 0x00, 0x00, 0xD1, 0xE5,
-    0x80, 0x20, 0xC0, 0xE3, 0x00, 0x20, 0xC1, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0x80, 0xC8, 0xE3,
-    0x51, 0x54, 0xCA, 0xE5, 0x01, 0x20, 0x41, 0xE2, 0x54, 0x17, 0x9A, 0xE5, 0x02, 0x00, 0x51, 0xE1,
-    0x01, 0x10, 0x81, 0xE2, 0x54, 0x17, 0x8A, 0xE5, 0x08, 0x00, 0x00, 0x1A, 0x48, 0x00, 0x4F, 0xE2,
-    0xFC, 0xC0, 0x9F, 0xE5, 0x00, 0x00, 0x8C, 0xE5, 0x10, 0x00, 0x8F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2,
-    0x50, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xF4, 0xF0, 0x9F, 0xE5, 0x08, 0xF1, 0x9F, 0xE5,
-    0xFF, 0x1F, 0x2D, 0xE9, 0x00, 0x00, 0xA0, 0xE3, 0x2C, 0x10, 0x00, 0xEB, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x00, 0xF1, 0x9F, 0xE5, 0xFF, 0x1F, 0xBD, 0xE8, 0xFC, 0x00, 0x9F, 0xE5, 0xC0, 0x20, 0x9F, 0xE5,
-    0x00, 0x00, 0x82, 0xE5, 0xF7, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0xE3,
-    0xF7, 0x06, 0xCA, 0x15, 0x18, 0x00, 0x00, 0x1A, 0xA0, 0x20, 0x9F, 0xE5, 0x00, 0x00, 0xD2, 0xE5,
-    0x80, 0x00, 0x80, 0xE3, 0x00, 0x00, 0xC2, 0xE5, 0x18, 0x00, 0x8F, 0xE2, 0x54, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x50, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x8C, 0xF0, 0x9F, 0xE5, 0xA0, 0xF0, 0x9F, 0xE5, 0x58, 0x04, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE3,
-    0x68, 0x10, 0x9F, 0x15, 0x00, 0x00, 0xD1, 0x15, 0x80, 0x00, 0x10, 0x13, 0x06, 0x00, 0x00, 0x0A,
-    0x18, 0x00, 0x8F, 0xE2, 0x54, 0x17, 0x9A, 0xE5, 0x0C, 0x10, 0x81, 0xE2, 0x07, 0xCC, 0x8A, 0xE2,
-    0xB0, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0x80, 0xF0, 0x9F, 0xE5, 0x68, 0xF0, 0x9F, 0xE5,
-    0x02, 0x80, 0xC8, 0xE3, 0x78, 0xC0, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x74, 0xF0, 0x9F, 0xE5,
-    0x15, 0x8C, 0x48, 0xE2, 0x50, 0xF0, 0x9F, 0xE5, 0x3C, 0x6E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
-    0x32, 0x00, 0x00, 0x02, 0x7D, 0x1A, 0x00, 0x08, 0x30, 0x01, 0x00, 0x04, 0x11, 0x55, 0x00, 0x08,
-    0xC5, 0x4D, 0x00, 0x08, 0x4D, 0x4B, 0x00, 0x08, 0x20, 0x30, 0x00, 0x06, 0x5C, 0x68, 0x00, 0x03,
-    0xC4, 0x59, 0x00, 0x03, 0x38, 0x58, 0x00, 0x03, 0x28, 0x00, 0x00, 0x02, 0xAB, 0x07, 0x00, 0x08,
-    0xCC, 0x90, 0x00, 0x08, 0xAC, 0x66, 0x00, 0x03, 0x2C, 0x94, 0x00, 0x08, 0xE8, 0x93, 0x00, 0x08,
-    0xD4, 0x93, 0x00, 0x08, 0xAC, 0x93, 0x00, 0x08, 0x54, 0x7C, 0x00, 0x08, 0x88, 0x44, 0x00, 0x03,
-    0xC8, 0x7F, 0x00, 0x08, 0xA0, 0x5B, 0x00, 0x03, 0x08, 0x35, 0x00, 0x06, 0xCC, 0x59, 0x00, 0x03,
-    0xA0, 0x66, 0x00, 0x03, 0xFA, 0xFF, 0x00, 0x00, 0xB8, 0x44, 0x00, 0x03, 0x00, 0x44, 0x2D, 0xE9,
-    0x70, 0xA3, 0x9F, 0xE5, 0x0C, 0x05, 0x9A, 0xE5, 0x04, 0x00, 0x10, 0xE3, 0x01, 0x20, 0xA0, 0x03,
-    0x00, 0x20, 0xA0, 0x13, 0x10, 0x00, 0x10, 0xE3, 0x02, 0x20, 0xA0, 0x13, 0x01, 0x00, 0x52, 0xE3,
-    0x54, 0x13, 0x9F, 0x05, 0x54, 0x13, 0x9F, 0xC5, 0x54, 0x13, 0x9F, 0xB5, 0xE4, 0x17, 0x8A, 0xE5,
-    0x50, 0x13, 0x9F, 0xA5, 0x50, 0x13, 0x9F, 0xB5, 0xF0, 0x17, 0x8A, 0xE5, 0x4C, 0x13, 0x9F, 0xA5,
-    0x4C, 0x13, 0x9F, 0xB5, 0xEC, 0x17, 0x8A, 0xE5, 0x49, 0x1F, 0xA0, 0xA3, 0x44, 0x13, 0x9F, 0xB5,
-    0x00, 0x18, 0x8A, 0xE5, 0x40, 0x13, 0x9F, 0xA5, 0x40, 0x13, 0x9F, 0xB5, 0xFC, 0x17, 0x8A, 0xE5,
-    0x3C, 0x13, 0x9F, 0xA5, 0x3C, 0x13, 0x9F, 0xB5, 0xF8, 0x17, 0x8A, 0xE5, 0x38, 0x13, 0x9F, 0x05,
-    0x38, 0x13, 0x9F, 0xC5, 0x38, 0x13, 0x9F, 0xB5, 0xF4, 0x17, 0x8A, 0xE5, 0x34, 0x13, 0x9F, 0xA5,
-    0x34, 0x13, 0x9F, 0xB5, 0x08, 0x18, 0x8A, 0xE5, 0x30, 0x13, 0x9F, 0xA5, 0x30, 0x13, 0x9F, 0xB5,
-    0xAC, 0x15, 0x8A, 0xE5, 0x2C, 0x13, 0x9F, 0xA5, 0x2C, 0x13, 0x9F, 0xB5, 0xA8, 0x15, 0x8A, 0xE5,
-    0x10, 0x10, 0xA0, 0xA3, 0x0F, 0x10, 0xA0, 0xB3, 0xF6, 0x16, 0xCA, 0xE5, 0x00, 0x10, 0xA0, 0xE3,
-    0x75, 0x14, 0xCA, 0xE5, 0xD8, 0x17, 0x9A, 0xE5, 0x01, 0x10, 0xB0, 0xE1, 0x02, 0x00, 0x00, 0x0A,
-    0x04, 0xE0, 0x8F, 0xE2, 0x01, 0x00, 0x52, 0xE3, 0x11, 0xFF, 0x2F, 0xE1, 0x00, 0x44, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0xF0, 0x22, 0x9F, 0xE5, 0xF0, 0x02, 0x9F, 0xE5,
-    0x00, 0x20, 0x42, 0xE0, 0x00, 0x10, 0xE0, 0xE3, 0xCF, 0xF5, 0xFF, 0xEB, 0xE0, 0x02, 0x9F, 0xE5,
-    0x1C, 0x07, 0x8A, 0xE5, 0xDC, 0x02, 0x9F, 0xE5, 0x20, 0x07, 0x8A, 0xE5, 0x07, 0x06, 0xA0, 0xE3,
-    0x24, 0x07, 0x8A, 0xE5, 0x0C, 0x07, 0x8A, 0xE5, 0x00, 0x84, 0xA0, 0xE1, 0xC8, 0x02, 0x9F, 0xE5,
-    0x2C, 0x04, 0x8A, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x10, 0x07, 0x8A, 0xE5, 0x28, 0x07, 0x8A, 0xE5,
-    0x14, 0x07, 0x8A, 0xE5, 0x18, 0x07, 0x8A, 0xE5, 0x0C, 0x05, 0xDA, 0xE5, 0x04, 0x00, 0x10, 0xE3,
-    0x57, 0x0F, 0xE0, 0x03, 0xA4, 0x02, 0x9F, 0x15, 0x14, 0x07, 0x8A, 0xE5, 0x18, 0x07, 0x8A, 0xE5,
-    0x00, 0x80, 0xBD, 0xE8, 0x38, 0x40, 0x2D, 0xE9, 0x84, 0x42, 0x9F, 0xE5, 0x7C, 0x52, 0x9F, 0xE5,
-    0x00, 0x00, 0x94, 0xE5, 0x43, 0x00, 0x00, 0xEB, 0x0C, 0x00, 0x84, 0xE4, 0x05, 0x00, 0x54, 0xE1,
-    0xFA, 0xFF, 0xFF, 0xBA, 0x78, 0x42, 0x9F, 0xE5, 0x04, 0x10, 0xA0, 0xE1, 0x5C, 0x52, 0x9F, 0xE5,
-    0x00, 0x00, 0x94, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x01, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x10, 0xE3,
-    0x01, 0x00, 0x40, 0x00, 0x0C, 0x00, 0x84, 0xE4, 0x05, 0x00, 0x54, 0xE1, 0xF7, 0xFF, 0xFF, 0xBA,
-    0x50, 0x42, 0x9F, 0xE5, 0x05, 0x50, 0xA0, 0xE3, 0x00, 0x00, 0x94, 0xE5, 0x31, 0x00, 0x00, 0xEB,
-    0x04, 0x00, 0x84, 0xE4, 0x01, 0x50, 0x55, 0xE2, 0xFA, 0xFF, 0xFF, 0x1A, 0x38, 0x40, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x38, 0x40, 0x2D, 0xE9, 0x14, 0x42, 0x9F, 0xE5, 0x0C, 0x52, 0x9F, 0xE5,
-    0x24, 0x22, 0x9F, 0xE5, 0x00, 0x00, 0x94, 0xE5, 0x23, 0x00, 0x50, 0xE3, 0x31, 0x00, 0x00, 0xAB,
-    0x23, 0x00, 0x50, 0xE3, 0x00, 0x01, 0x92, 0xB7, 0x00, 0x00, 0x00, 0xBA, 0x0B, 0xB0, 0xA0, 0xE1,
-    0x0C, 0x00, 0x84, 0xE4, 0x05, 0x00, 0x54, 0xE1, 0xF5, 0xFF, 0xFF, 0xBA, 0xF0, 0x41, 0x9F, 0xE5,
-    0xD8, 0x51, 0x9F, 0xE5, 0x04, 0x10, 0xA0, 0xE1, 0x00, 0x00, 0x94, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x06, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x10, 0xE3, 0x01, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x1A,
-    0x01, 0x00, 0x50, 0xE1, 0x00, 0x00, 0xA0, 0x33, 0x05, 0x00, 0x50, 0xE1, 0x00, 0x00, 0xA0, 0x83,
-    0x0C, 0x00, 0x84, 0xE4, 0x05, 0x00, 0x54, 0xE1, 0xF2, 0xFF, 0xFF, 0xBA, 0xB4, 0x41, 0x9F, 0xE5,
-    0x05, 0x50, 0xA0, 0xE3, 0xB0, 0x21, 0x9F, 0xE5, 0x00, 0x00, 0x94, 0xE5, 0x23, 0x00, 0x50, 0xE3,
-    0x14, 0x00, 0x00, 0xAB, 0x23, 0x00, 0x50, 0xE3, 0x00, 0x01, 0x92, 0xB7, 0x00, 0x00, 0x00, 0xBA,
-    0x0B, 0xB0, 0xA0, 0xE1, 0x04, 0x00, 0x84, 0xE4, 0x01, 0x50, 0x55, 0xE2, 0xF5, 0xFF, 0xFF, 0x1A,
-    0x38, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x7C, 0xC1, 0x9F, 0xE5, 0x00, 0x10, 0xA0, 0xE1,
-    0x00, 0x00, 0xA0, 0xE3, 0x00, 0x21, 0x9C, 0xE7, 0x02, 0x00, 0x51, 0xE1, 0x1E, 0xFF, 0x2F, 0x01,
-    0x01, 0x00, 0x80, 0xE2, 0x23, 0x00, 0x50, 0xE3, 0xF9, 0xFF, 0xFF, 0xBA, 0x0B, 0xB0, 0xA0, 0xE1,
-    0x01, 0x00, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0x06, 0x50, 0x2D, 0xE9, 0x4C, 0xC1, 0x9F, 0xE5,
-    0x04, 0x10, 0x9C, 0xE4, 0x01, 0x00, 0x71, 0xE3, 0x04, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x50, 0xE1,
-    0x04, 0x10, 0x9C, 0xE4, 0x01, 0x00, 0xA0, 0x01, 0xF8, 0xFF, 0xFF, 0x1A, 0xE9, 0xFF, 0xFF, 0xEB,
-    0x06, 0x50, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8C, 0x93, 0x00, 0x08, 0xCC, 0x90, 0x00, 0x08, 0xAC, 0x93, 0x00, 0x08, 0xE8, 0x93, 0x00, 0x08,
-    0x2C, 0x94, 0x00, 0x08, 0x70, 0x94, 0x00, 0x08, 0xD8, 0x94, 0x00, 0x08, 0xA0, 0x31, 0x00, 0x06,
-    0x34, 0x7C, 0x00, 0x08, 0xB4, 0x63, 0x00, 0x03, 0x64, 0x8E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0xD8, 0x85, 0x00, 0x08, 0xD4, 0x93, 0x00, 0x08, 0x10, 0x95, 0x00, 0x08, 0x78, 0x82, 0x00, 0x08,
-    0x74, 0x68, 0x00, 0x03, 0xF0, 0x9F, 0x00, 0x08, 0x78, 0xA7, 0x00, 0x08, 0x0C, 0x6C, 0x00, 0x03,
-    0x80, 0xB7, 0x00, 0x08, 0x94, 0xB7, 0x00, 0x08, 0xF0, 0xBB, 0x00, 0x08, 0xC4, 0xBD, 0x00, 0x08,
-    0x90, 0x6D, 0x00, 0x03, 0x58, 0xA7, 0x00, 0x08, 0x18, 0x6C, 0x00, 0x03, 0xF8, 0x6C, 0x00, 0x03,
-    0xF4, 0xB0, 0x00, 0x08, 0x90, 0xA4, 0x00, 0x08, 0xD0, 0xBF, 0x00, 0x08, 0x80, 0x3D, 0x00, 0x06,
-    0xC0, 0xA2, 0x00, 0x08, 0x64, 0x9B, 0x00, 0x08, 0x64, 0x8E, 0x00, 0x08, 0xBC, 0xA0, 0x00, 0x08,
-    0x64, 0x8E, 0x00, 0x08, 0x80, 0x3D, 0x00, 0x06, 0x80, 0x3D, 0x00, 0x06, 0x60, 0x3D, 0x00, 0x06,
-    0x80, 0x3D, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x6E, 0x00, 0x03, 0xFE, 0x5C, 0x01, 0x00,
-    0x98, 0x9F, 0x01, 0x00, 0x9E, 0x85, 0x01, 0x00, 0x36, 0xDB, 0x6C, 0xB3, 0x2B, 0x1B, 0xD3, 0xB2,
-    0x0D, 0x30, 0xC0, 0x00, 0x0D, 0x00, 0xCD, 0x00, 0x11, 0x01, 0x00, 0x00, 0xD8, 0x9F, 0x00, 0x00,
-    0xDA, 0x95, 0x00, 0x00, 0x05, 0x41, 0x01, 0x00, 0xF5, 0x2C, 0x01, 0x00, 0x4D, 0x42, 0x01, 0x00,
-    0xE7, 0x84, 0x01, 0x00, 0x27, 0x2E, 0x01, 0x00, 0x50, 0x15, 0x00, 0x00, 0xFB, 0x13, 0x00, 0x00,
-    0x66, 0x57, 0x00, 0x00, 0x6E, 0x61, 0x00, 0x00, 0x8C, 0x40, 0xED, 0xFF, 0x75, 0xD1, 0xEB, 0xFF,
-    0x04, 0x76, 0x00, 0x03, 0x5C, 0x75, 0x00, 0x03, 0x8C, 0x93, 0x00, 0x08, 0x14, 0x68, 0x00, 0x03,
-    0xB9, 0xFE, 0xFF, 0xFF, 0x58, 0x75, 0x00, 0x03, 0x04, 0x76, 0x00, 0x03, 0x68, 0x98, 0x00, 0x08,
-    0xF4, 0x98, 0x00, 0x08, 0xCC, 0x20, 0x8F, 0xE2, 0x5E, 0x3F, 0x8F, 0xE2, 0x00, 0x40, 0xA0, 0xE3,
-    0x00, 0x50, 0xA0, 0xE3, 0x9C, 0x11, 0x9F, 0xE5, 0x27, 0x00, 0x00, 0xEB, 0x1C, 0x10, 0xA0, 0xE3,
-    0x1F, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xA0, 0xE3, 0x8C, 0x11, 0x9F, 0xE5, 0xB0, 0x00, 0xC1, 0xE1,
-    0x08, 0x00, 0xA0, 0xE3, 0x00, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x00, 0xEF, 0x04, 0x40, 0xB0, 0xE1,
-    0x07, 0x00, 0x00, 0x1A, 0x04, 0xC0, 0x92, 0xE4, 0x0C, 0xC0, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01,
-    0x01, 0x08, 0x5C, 0xE3, 0x1E, 0xFF, 0x2F, 0xC1, 0x01, 0x40, 0x4C, 0xE2, 0x04, 0xC0, 0x92, 0xE4,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x04, 0xC0, 0x12, 0xE5, 0x01, 0x40, 0x44, 0xE2, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x05, 0x50, 0xB0, 0xE1, 0x07, 0x00, 0x00, 0x1A, 0xB2, 0x00, 0xD3, 0xE0, 0x00, 0x00, 0xB0, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x01, 0x02, 0x0C, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0xC1, 0x01, 0x50, 0x40, 0xE2,
-    0xB2, 0x00, 0xD3, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0xB2, 0x00, 0x53, 0xE1, 0x01, 0x50, 0x45, 0xE2,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0xE3, 0xFF, 0xFF, 0xEB, 0xB0, 0x00, 0xDC, 0xE1,
-    0x01, 0x10, 0x51, 0xE2, 0xFB, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8, 0x00, 0x40, 0x2D, 0xE9,
-    0xDD, 0xFF, 0xFF, 0xEB, 0xE9, 0xFF, 0xFF, 0xEB, 0xB0, 0x00, 0xCC, 0xE1, 0x01, 0x10, 0x51, 0xE2,
-    0xFA, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8, 0x00, 0x00, 0xFE, 0x09, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00, 0xFC, 0x09,
-    0x04, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x09, 0xA8, 0xEC, 0x30, 0x09, 0xE9, 0x03, 0x00, 0x00,
-    0x8A, 0x46, 0x02, 0x08, 0xA8, 0xEC, 0x30, 0x09, 0x8A, 0x46, 0x02, 0x08, 0x00, 0xA8, 0xEC, 0x08,
-    0xA0, 0x68, 0x02, 0x08, 0xF4, 0x01, 0x00, 0x00, 0x8A, 0x46, 0x02, 0x08, 0xA8, 0xEC, 0x30, 0x09,
-    0x2E, 0x59, 0x6B, 0x09, 0x02, 0x00, 0xE0, 0x08, 0x0E, 0x00, 0x00, 0x08, 0xFC, 0x1F, 0x80, 0x08,
-    0x4A, 0x10, 0x00, 0x08, 0x12, 0x06, 0x80, 0x08, 0x00, 0x00, 0x00, 0x08, 0x66, 0x1B, 0x80, 0x08,
-    0x08, 0x00, 0x80, 0x08, 0x0E, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0xE4, 0x01, 0x00, 0x08,
-    0xE4, 0x01, 0x00, 0x08, 0x88, 0x01, 0x00, 0x08, 0x88, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
-    0xE0, 0xFF, 0xFF, 0x09, 0x03, 0x00, 0x00, 0x00, 0xEC, 0xFF, 0xFF, 0x09, 0x03, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0xFF, 0x09, 0x03, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x20, 0x09,
-    0xF0, 0xFF, 0xFF, 0x09, 0xE8, 0xFF, 0xFF, 0x09, 0x00, 0xD2, 0x00, 0x15, 0x00, 0xD2, 0x00, 0x15,
-    0x00, 0x80, 0x00, 0x15, 0x5A, 0xA5, 0x5A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x54, 0x53, 0xF4, 0x01,
-    0x34, 0x12, 0x54, 0x53, 0xF4, 0x01, 0x78, 0x56, 0x54, 0x53, 0x54, 0x53, 0x78, 0x56, 0x34, 0x12,
-    0xF4, 0x01, 0xCD, 0xAB, 0x54, 0x53, 0x00, 0x00, 0xEE, 0x05, 0x00, 0x00, 0xFA, 0x7F, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xD8, 0x47, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03,
-    0xD8, 0x47, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0xB4, 0x4A, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0x98, 0x6A, 0x00, 0x03,
-    0x98, 0x6A, 0x00, 0x03, 0x98, 0x6A, 0x00, 0x03, 0x98, 0x6A, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x90, 0x6A, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x24, 0x48, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03,
-    0x24, 0x48, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0xB8, 0x6A, 0x00, 0x03, 0x24, 0x6B, 0x00, 0x03,
-    0x3C, 0x6B, 0x00, 0x03, 0x90, 0x6B, 0x00, 0x03, 0x0C, 0x00, 0xA0, 0xE3, 0xA0, 0x04, 0xCA, 0xE5,
-    0x10, 0x00, 0xA0, 0xE3, 0xA1, 0x04, 0xCA, 0xE5, 0xA2, 0x04, 0xCA, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0xA4, 0x04, 0xCA, 0xE5, 0xA5, 0x04, 0xCA, 0xE5, 0xA0, 0x04, 0xDA, 0xE5, 0x0C, 0x00, 0x80, 0xE3,
-    0xA0, 0x04, 0xCA, 0xE5, 0x04, 0xF0, 0x1F, 0xE5, 0xB8, 0x6B, 0x00, 0x03, 0x48, 0x9C, 0x00, 0x08,
-    0xC0, 0x9C, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xE0, 0x9C, 0x00, 0x08, 0x0C, 0x00, 0xA0, 0xE3,
-    0xA4, 0x04, 0xCA, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0xA8, 0x04, 0xCA, 0xE5, 0xA9, 0x04, 0xCA, 0xE5,
-    0x00, 0x00, 0xA0, 0xE3, 0x1C, 0xF1, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0xA8, 0x04, 0xCA, 0xE5,
-    0xA9, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x30, 0xC0, 0x8F, 0xE2, 0x80, 0x00, 0x10, 0xE3,
-    0xF8, 0xFF, 0xFF, 0x1A, 0xA9, 0x24, 0xDA, 0xE5, 0xA8, 0x14, 0xDA, 0xE5, 0x01, 0x00, 0x00, 0xE2,
-    0x10, 0x02, 0x81, 0xE1, 0x04, 0x00, 0x52, 0xE3, 0x00, 0x10, 0xA0, 0xE3, 0x0C, 0xF0, 0xA0, 0x01,
-    0x01, 0x20, 0x82, 0xE2, 0xA9, 0x24, 0xCA, 0xE5, 0xA8, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xA8, 0x14, 0xCA, 0xE5, 0xA9, 0x14, 0xCA, 0xE5, 0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xC0, 0xA0, 0xE1,
-    0x02, 0x00, 0x10, 0xE3, 0x04, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xB4, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0x11, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xA4, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0x0C, 0x00, 0x00, 0xEA,
-    0x00, 0xC0, 0x8F, 0xE2, 0xE0, 0xFF, 0xFF, 0xEA, 0xA8, 0x14, 0xCA, 0xE5, 0xA9, 0x14, 0xCA, 0xE5,
-    0xA5, 0x04, 0xCA, 0xE5, 0x10, 0x00, 0x10, 0xE3, 0xA0, 0x14, 0x8A, 0x15, 0x04, 0x00, 0x00, 0xEA,
-    0x00, 0xC0, 0x8F, 0xE2, 0xD8, 0xFF, 0xFF, 0xEA, 0xA8, 0x14, 0xCA, 0xE5, 0xA9, 0x14, 0xCA, 0xE5,
-    0xA7, 0x04, 0xCA, 0xE5, 0xA5, 0x04, 0xDA, 0xE5, 0x08, 0x00, 0x10, 0xE3, 0x13, 0x00, 0x00, 0x0A,
-    0xA7, 0x04, 0xDA, 0xE5, 0x08, 0x00, 0x80, 0xE3, 0xA4, 0x14, 0xDA, 0xE5, 0x08, 0x00, 0x11, 0xE3,
-    0x0D, 0x00, 0x00, 0x0A, 0x04, 0xE0, 0x2D, 0xE5, 0x00, 0xC0, 0xA0, 0xE1, 0x04, 0x00, 0x11, 0xE3,
-    0x04, 0x00, 0x00, 0x0A, 0x0F, 0xE0, 0xA0, 0xE1, 0x34, 0xF0, 0x9F, 0xE5, 0x0F, 0x00, 0x8C, 0xE3,
-    0x04, 0xE0, 0x9D, 0xE4, 0x2C, 0xF0, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x24, 0xF0, 0x9F, 0xE5,
-    0x08, 0x00, 0x0C, 0xE2, 0x04, 0xE0, 0x9D, 0xE4, 0x14, 0xF0, 0x9F, 0xE5, 0x18, 0xF0, 0x9F, 0xE5,
-    0x07, 0x00, 0x00, 0xE2, 0x10, 0xF0, 0x9F, 0xE5, 0x58, 0x48, 0x00, 0x03, 0xAC, 0x46, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03, 0x54, 0x48, 0x00, 0x03,
-    0xAC, 0x9D, 0x00, 0x08, 0xAC, 0x9D, 0x00, 0x08, 0xAC, 0x9D, 0x00, 0x08, 0xAC, 0x9D, 0x00, 0x08,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xC4, 0x9D, 0x00, 0x08, 0xC4, 0x9D, 0x00, 0x08, 0xC4, 0x9D, 0x00, 0x08,
-    0xC4, 0x9D, 0x00, 0x08, 0x18, 0x10, 0x1F, 0xE5, 0x54, 0x10, 0x0A, 0xE5, 0x28, 0x05, 0xDA, 0xE5,
-    0x01, 0x00, 0x80, 0xE3, 0x28, 0x05, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x40, 0x2D, 0xE9,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x20, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x20, 0x02, 0xA0, 0xE1,
-    0x18, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x20, 0x02, 0xA0, 0xE1, 0x04, 0xF0, 0x1F, 0xE5, 0x58, 0x48, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0xFC, 0x9D, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0x00, 0x00, 0xA0, 0xE3, 0x44, 0xF1, 0x9F, 0xE5, 0x02, 0xC9, 0xCC, 0xE3,
-    0x03, 0x00, 0x5C, 0xE3, 0x0E, 0xF0, 0xA0, 0x81, 0x11, 0x00, 0x00, 0x1A, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x40, 0x00, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x24, 0xF1, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x07, 0x00, 0x00, 0x0A, 0x80, 0x00, 0xA0, 0xE1,
-    0xA0, 0x04, 0x8A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0x08, 0xF1, 0x9F, 0xE5,
-    0x0C, 0xE0, 0xA0, 0xE1, 0xA0, 0x04, 0x9A, 0xE5, 0x00, 0xF1, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0xFC, 0xF0, 0x9F, 0xE5, 0x00, 0x00, 0x5C, 0xE3, 0x1D, 0x00, 0x00, 0x1A, 0x0E, 0xC0, 0xA0, 0xE1,
-    0xA0, 0x04, 0x8A, 0xE5, 0x40, 0x00, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0xD4, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x0F, 0x00, 0x00, 0x0A, 0x80, 0x00, 0xA0, 0xE1,
-    0xA0, 0x04, 0x8A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xC4, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xBC, 0xF0, 0x9F, 0xE5, 0xA0, 0x04, 0x9A, 0xE5,
-    0x02, 0x00, 0x80, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0x9C, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x90, 0xF0, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x98, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2,
-    0x7C, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x5C, 0xE3, 0x08, 0x00, 0x00, 0x1A, 0x0E, 0xC0, 0xA0, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x74, 0xF0, 0x9F, 0xE5, 0x00, 0x00, 0xB0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x50, 0xF0, 0x9F, 0xE5, 0x00, 0x00, 0xE0, 0xE3, 0x0C, 0xE0, 0xA0, 0xE1, 0x50, 0xF0, 0x9F, 0xE5,
-    0x02, 0x00, 0x5C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0x0E, 0xC0, 0xA0, 0xE1, 0x80, 0x00, 0xA0, 0xE1,
-    0x20, 0x04, 0x80, 0xE0, 0xA0, 0x04, 0x8A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x34, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x2C, 0xF0, 0x9F, 0xE5, 0xA0, 0x04, 0x9A, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x10, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0xA0, 0x04, 0x9A, 0xE5,
-    0x08, 0xF0, 0x9F, 0xE5, 0x58, 0x48, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0xB4, 0x47, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03,
-    0xD8, 0x47, 0x00, 0x03, 0x84, 0x9F, 0x00, 0x08, 0x8C, 0x9F, 0x00, 0x08, 0x94, 0x9F, 0x00, 0x08,
-    0x9C, 0x9F, 0x00, 0x08, 0x28, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x80, 0xE3, 0x28, 0x05, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x02, 0x09, 0x5C, 0xE3, 0x20, 0xF0, 0x9F, 0x05, 0x0A, 0x0A, 0x5C, 0xE3,
-    0x1C, 0xF0, 0x9F, 0x05, 0x03, 0x09, 0x5C, 0xE3, 0x18, 0xF0, 0x9F, 0x05, 0x0E, 0x0A, 0x5C, 0xE3,
-    0x14, 0xF0, 0x9F, 0x05, 0x0F, 0x0A, 0x5C, 0xE3, 0x10, 0xF0, 0x9F, 0x05, 0x10, 0xF0, 0x9F, 0xE5,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03, 0x6C, 0x4A, 0x00, 0x03,
-    0x08, 0x4B, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0xB4, 0xA0, 0x00, 0x08, 0xB4, 0xA0, 0x00, 0x08,
-    0xB4, 0xA0, 0x00, 0x08, 0xB4, 0xA0, 0x00, 0x08, 0x28, 0x15, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3,
-    0x28, 0x15, 0xCA, 0xE5, 0x24, 0x10, 0x1F, 0xE5, 0x54, 0x10, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x78, 0x17, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0x6C, 0xF1, 0x9F, 0xE5, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2,
-    0xAC, 0x24, 0x9A, 0xE5, 0xAC, 0x14, 0x8A, 0xE5, 0x02, 0x20, 0x41, 0xE0, 0xA8, 0x04, 0xDA, 0xE5,
-    0x01, 0x00, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x40, 0x01, 0x9F, 0xE5, 0x90, 0xC2, 0x82, 0xE0,
-    0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x08, 0x50, 0xE0, 0xA0, 0x04, 0x8A, 0xE5, 0x13, 0x00, 0x00, 0x8A,
-    0x02, 0x20, 0xB0, 0xE1, 0x11, 0x00, 0x00, 0x0A, 0x03, 0x40, 0x2D, 0xE9, 0x20, 0x01, 0x9F, 0xE5,
-    0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0x14, 0xF1, 0x9F, 0xE5,
-    0x03, 0x40, 0xBD, 0xE8, 0x09, 0x00, 0x00, 0xEA, 0xA8, 0x04, 0xDA, 0xE5, 0x01, 0x00, 0x10, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2, 0xAC, 0x14, 0x8A, 0xE5, 0xA0, 0x04, 0x9A, 0xE5,
-    0x20, 0x08, 0xA0, 0xE1, 0x80, 0x00, 0x90, 0xE0, 0x03, 0x08, 0xA0, 0x03, 0x00, 0x10, 0x81, 0xE0,
-    0x0C, 0x10, 0x41, 0xE2, 0xBC, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2,
-    0xC0, 0xF0, 0x9F, 0xE5, 0x0F, 0xC0, 0x0C, 0xE2, 0x08, 0x00, 0x1C, 0xE3, 0xB8, 0x10, 0x9F, 0x05,
-    0x64, 0x10, 0x8F, 0x12, 0x0C, 0xF1, 0x91, 0xE7, 0x20, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3,
-    0x20, 0x14, 0xCA, 0xE5, 0x01, 0x00, 0x10, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0xA8, 0x14, 0xDA, 0xE5,
-    0x01, 0x00, 0x11, 0xE3, 0x02, 0x00, 0x00, 0x0A, 0x01, 0x40, 0x2D, 0xE9, 0xC2, 0xFF, 0xFF, 0xEB,
-    0x01, 0x40, 0xBD, 0xE8, 0xA8, 0x04, 0xCA, 0xE5, 0xDB, 0xFF, 0xFF, 0xEA, 0xA8, 0x14, 0xDA, 0xE5,
-    0x01, 0x00, 0x11, 0xE3, 0x06, 0x00, 0x00, 0x1A, 0xA2, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0xA8, 0x14, 0xDA, 0xE5, 0x01, 0x00, 0x11, 0xE3, 0x06, 0x00, 0x00, 0x1A, 0xA3, 0x04, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x40, 0x2D, 0xE9, 0xB3, 0xFF, 0xFF, 0xEB, 0x01, 0x40, 0xBD, 0xE8,
-    0xA2, 0x04, 0xCA, 0xE5, 0xCB, 0xFF, 0xFF, 0xEA, 0x01, 0x40, 0x2D, 0xE9, 0xAE, 0xFF, 0xFF, 0xEB,
-    0x01, 0x40, 0xBD, 0xE8, 0xA3, 0x04, 0xCA, 0xE5, 0xC6, 0xFF, 0xFF, 0xEA, 0xD8, 0x47, 0x00, 0x03,
-    0xA0, 0x46, 0x00, 0x03, 0xC8, 0xA0, 0x00, 0x08, 0xFC, 0xA0, 0x00, 0x08, 0x10, 0xA1, 0x00, 0x08,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x88, 0x44, 0x00, 0x03,
-    0x56, 0x55, 0x55, 0x55, 0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03, 0x9C, 0x48, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x1C, 0x00, 0x8F, 0xE2, 0xC8, 0x11, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0xEC, 0x00, 0x8F, 0xE2,
-    0xC0, 0x11, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0x01, 0x00, 0xA0, 0xE3, 0xA3, 0x04, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x05, 0x0A, 0x5C, 0xE3, 0x1E, 0xFF, 0x2F, 0xB1, 0x03, 0x1C, 0x0C, 0xE2,
-    0x21, 0xF3, 0x9F, 0xE7, 0x00, 0x00, 0xA0, 0xE1, 0xD8, 0xA1, 0x00, 0x08, 0x30, 0xA2, 0x00, 0x08,
-    0x48, 0xA2, 0x00, 0x08, 0x60, 0xA2, 0x00, 0x08, 0xA1, 0x24, 0xDA, 0xE5, 0x80, 0x10, 0x00, 0xE2,
-    0x01, 0x20, 0x32, 0xE0, 0xA1, 0x14, 0xCA, 0x15, 0xA0, 0x14, 0xDA, 0xE5, 0x0F, 0x10, 0xC1, 0xE3,
-    0x0F, 0x20, 0x00, 0xE2, 0x02, 0x00, 0x81, 0xE1, 0xA0, 0x04, 0xCA, 0xE5, 0xE3, 0x0C, 0x00, 0x0A,
-    0x00, 0x40, 0x2D, 0xE9, 0xE1, 0x0C, 0x00, 0xEB, 0xA1, 0x04, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE2,
-    0x01, 0x00, 0x00, 0x0A, 0x2B, 0x00, 0x00, 0xEB, 0x00, 0x80, 0xBD, 0xE8, 0x00, 0x00, 0xA0, 0xE3,
-    0xA7, 0x0C, 0x00, 0xEB, 0x40, 0xC1, 0x9F, 0xE5, 0xD2, 0x0C, 0x00, 0xEB, 0x00, 0x80, 0xBD, 0xE8,
-    0x38, 0x11, 0x9F, 0xE5, 0x01, 0x00, 0x5C, 0xE1, 0x0A, 0x00, 0x00, 0x0A, 0x06, 0x00, 0x50, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x11, 0xB3, 0x0C, 0x00, 0xEA, 0xA0, 0x14, 0xDA, 0xE5, 0xF0, 0x10, 0xC1, 0xE3,
-    0x00, 0x22, 0xA0, 0xE1, 0x02, 0x00, 0x81, 0xE1, 0xA0, 0x04, 0xCA, 0xE5, 0xCB, 0x0C, 0x00, 0xEA,
-    0xA2, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0xA3, 0x14, 0xDA, 0xE5, 0xA3, 0x04, 0xCA, 0xE5,
-    0x01, 0x10, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x11,
-    0xA4, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0x21, 0xE2, 0xA4, 0x14, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x51, 0x0C, 0x5C, 0xE3, 0xB9, 0x0C, 0x00, 0xBA, 0x07, 0x1C, 0x0C, 0xE2, 0x01, 0x0C, 0x51, 0xE3,
-    0x04, 0x00, 0x00, 0x0A, 0x05, 0x0C, 0x51, 0xE3, 0xB4, 0x0C, 0x00, 0x1A, 0xA4, 0x04, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0xA2, 0x04, 0xDA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x00, 0x00, 0x00, 0xEB, 0xD3, 0x0C, 0x00, 0xEA, 0x00, 0x40, 0x2D, 0xE9, 0xC9, 0x0C, 0x00, 0xEB,
-    0x80, 0x00, 0x5C, 0xE3, 0x14, 0x00, 0x00, 0xBA, 0xF0, 0x00, 0x5C, 0xE3, 0x09, 0x00, 0x00, 0xAA,
-    0x01, 0x00, 0xA0, 0xE3, 0x8D, 0x0C, 0x00, 0xEB, 0x01, 0x00, 0xA0, 0xE3, 0xD0, 0x0C, 0x00, 0xEB,
-    0x14, 0x17, 0x9A, 0xE5, 0x08, 0x08, 0x9A, 0xE5, 0xF1, 0x20, 0xA0, 0xE3, 0x90, 0x02, 0x02, 0xE0,
-    0x22, 0x12, 0x81, 0xE0, 0x10, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xA0, 0xE3, 0x83, 0x0C, 0x00, 0xEB,
-    0x00, 0x00, 0xA0, 0xE3, 0xC6, 0x0C, 0x00, 0xEB, 0x18, 0x17, 0x9A, 0xE5, 0x08, 0x08, 0x9A, 0xE5,
-    0x80, 0x03, 0x80, 0xE0, 0x20, 0x12, 0x81, 0xE0, 0x07, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xA0, 0xE3,
-    0x7A, 0x0C, 0x00, 0xEB, 0x00, 0x00, 0xA0, 0xE3, 0xBD, 0x0C, 0x00, 0xEB, 0x14, 0x17, 0x9A, 0xE5,
-    0x08, 0x08, 0x9A, 0xE5, 0x80, 0x03, 0x80, 0xE0, 0x20, 0x12, 0x81, 0xE0, 0x94, 0x00, 0x4F, 0xE2,
-    0x14, 0xC0, 0x9F, 0xE5, 0x56, 0x0C, 0x00, 0xEB, 0x00, 0x80, 0xBD, 0xE8, 0x08, 0xC0, 0x9F, 0xE5,
-    0x84, 0x0C, 0x00, 0xEA, 0x20, 0x51, 0x00, 0x03, 0xAC, 0x50, 0x00, 0x03, 0xB0, 0x75, 0x00, 0x03,
-    0x01, 0x51, 0x00, 0x00, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0x08, 0x10, 0x8F, 0xE2, 0x50, 0x10, 0x0A, 0xE5, 0xA4, 0x00, 0x8F, 0xE2,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x41, 0x0C, 0x5C, 0xE3, 0xC4, 0xF0, 0x9F, 0x35, 0xFF, 0x20, 0x0C, 0xE2,
-    0xFE, 0x00, 0x52, 0xE3, 0x16, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0x52, 0xE3, 0x16, 0x00, 0x00, 0x0A,
-    0x17, 0x20, 0x02, 0xE2, 0x10, 0x00, 0x12, 0xE3, 0x08, 0x20, 0x42, 0x12, 0x00, 0x10, 0x8F, 0xE2,
-    0x02, 0xF1, 0x91, 0xE7, 0xBC, 0x52, 0x00, 0x03, 0x14, 0xA4, 0x00, 0x08, 0x20, 0xA4, 0x00, 0x08,
-    0x28, 0xA4, 0x00, 0x08, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0xB4, 0x47, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03,
-    0x10, 0x49, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03, 0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03,
-    0x80, 0x49, 0x00, 0x03, 0x10, 0x00, 0x10, 0xE3, 0x58, 0xF0, 0x9F, 0xE5, 0x10, 0x00, 0x10, 0xE3,
-    0x54, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x00, 0xE2, 0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xA2, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA3, 0x04, 0xCA, 0xE5, 0x01, 0x10, 0xA0, 0xE3,
-    0xA4, 0x14, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA4, 0x04, 0xDA, 0xE5, 0x00, 0x00, 0x50, 0xE3,
-    0x03, 0x00, 0x00, 0x0A, 0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x08, 0x90, 0xE2, 0xA0, 0x04, 0x8A, 0xE5,
-    0x18, 0xF0, 0x9F, 0x25, 0x00, 0x80, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x60, 0x0C, 0x00, 0xEA, 0xB0, 0x50, 0x00, 0x03, 0xAC, 0x46, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03,
-    0x98, 0x44, 0x00, 0x03, 0xA4, 0xA5, 0x00, 0x08, 0xA4, 0xA5, 0x00, 0x08, 0xA4, 0xA5, 0x00, 0x08,
-    0xF8, 0xA5, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x10, 0x14, 0x18, 0x18, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x78, 0x17, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0x28, 0xF2, 0x9F, 0xE5, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2,
-    0xB8, 0x24, 0x9A, 0xE5, 0xB8, 0x14, 0x8A, 0xE5, 0x02, 0x20, 0x41, 0xE0, 0x08, 0x02, 0x9F, 0xE5,
-    0x90, 0xC2, 0x82, 0xE0, 0xB4, 0xC4, 0xDA, 0xE5, 0x01, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0xB0, 0x04, 0x9A, 0xE5, 0x0E, 0x00, 0x1C, 0xE3, 0x0C, 0x00, 0x00, 0x1A, 0x00, 0x08, 0xA0, 0xE1,
-    0x02, 0x08, 0x50, 0xE0, 0x20, 0x08, 0xA0, 0xE1, 0xB0, 0x04, 0x8A, 0xE5, 0x1F, 0x00, 0x00, 0x2A,
-    0x03, 0x40, 0x2D, 0xE9, 0xD4, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xC8, 0xF1, 0x9F, 0xE5, 0x03, 0x40, 0xBD, 0xE8, 0x17, 0x00, 0x00, 0xEA,
-    0x90, 0x10, 0x4F, 0xE2, 0xAC, 0xC0, 0xD1, 0xE7, 0x10, 0x1C, 0xA0, 0xE1, 0x12, 0x1C, 0x51, 0xE0,
-    0x00, 0x20, 0xE0, 0xE3, 0x32, 0x0C, 0xC0, 0xE1, 0x31, 0x0C, 0x80, 0xE1, 0xB0, 0x04, 0x8A, 0xE5,
-    0xB8, 0x14, 0x9A, 0xE5, 0xED, 0xFF, 0xFF, 0x3A, 0x32, 0x0C, 0x00, 0xE0, 0x0B, 0x00, 0x00, 0xEA,
-    0xB4, 0xC4, 0xDA, 0xE5, 0x01, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2,
-    0xB8, 0x14, 0x8A, 0xE5, 0xB0, 0x04, 0x9A, 0xE5, 0x0E, 0x00, 0x1C, 0xE3, 0x07, 0x00, 0x00, 0x1A,
-    0x01, 0x00, 0x80, 0xE2, 0x80, 0x00, 0x90, 0xE0, 0x00, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x41, 0xE2,
-    0xF8, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0x40, 0xF1, 0x9F, 0xE5,
-    0x11, 0x2E, 0x4F, 0xE2, 0xAC, 0xC0, 0xD2, 0xE7, 0x00, 0x20, 0xE0, 0xE3, 0x32, 0x0C, 0x00, 0xE0,
-    0xF2, 0xFF, 0xFF, 0xEA, 0x03, 0x10, 0x0C, 0xE2, 0x07, 0xCA, 0x0C, 0xE2, 0x2C, 0x15, 0x81, 0xE1,
-    0xA1, 0x10, 0xB0, 0xE1, 0x01, 0xCB, 0x8A, 0xE2, 0xA0, 0xC0, 0x8C, 0xE2, 0x0F, 0x00, 0x00, 0xE2,
-    0x01, 0x20, 0xDC, 0xE7, 0xF0, 0x20, 0x02, 0x32, 0x00, 0x00, 0x82, 0x31, 0x0F, 0x20, 0x02, 0x22,
-    0x00, 0x02, 0x82, 0x21, 0x01, 0x00, 0xCC, 0xE7, 0x04, 0x00, 0x51, 0xE3, 0xF4, 0xC0, 0x9F, 0xA5,
-    0x00, 0xC0, 0x8F, 0x32, 0x01, 0xF1, 0x9C, 0xE7, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03,
-    0x94, 0x47, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x03, 0x10, 0x0C, 0xE2, 0x01, 0x0A, 0x1C, 0xE3,
-    0x04, 0x10, 0x81, 0x13, 0x0F, 0x00, 0x00, 0xE2, 0xAC, 0x24, 0x9A, 0xE5, 0x84, 0xC0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9C, 0xE7, 0x0F, 0x20, 0xC2, 0xE3, 0x00, 0x00, 0x82, 0xE1, 0xAC, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xF0, 0x20, 0xC2, 0xE3, 0x00, 0x02, 0x82, 0xE1, 0xAC, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x2C, 0xC2, 0xE3, 0x00, 0x04, 0x82, 0xE1, 0xAC, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x2A, 0xC2, 0xE3, 0x00, 0x06, 0x82, 0xE1, 0xAC, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xB0, 0x24, 0x8A, 0xE5, 0x20, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3,
-    0x20, 0x14, 0xCA, 0xE5, 0xB5, 0xFF, 0xFF, 0xEA, 0xB4, 0x14, 0xDA, 0xE5, 0x01, 0x00, 0x11, 0xE3,
-    0x02, 0x00, 0x00, 0x0A, 0x01, 0x40, 0x2D, 0xE9, 0x87, 0xFF, 0xFF, 0xEB, 0x01, 0x40, 0xBD, 0xE8,
-    0xB4, 0x04, 0xCA, 0xE5, 0xF3, 0xFF, 0xFF, 0xEA, 0x20, 0x11, 0xB0, 0xE1, 0x01, 0x00, 0x10, 0xE3,
-    0x44, 0xF0, 0x9F, 0x35, 0x44, 0xF0, 0x9F, 0x25, 0x14, 0xA6, 0x00, 0x08, 0x24, 0xA6, 0x00, 0x08,
-    0x34, 0xA6, 0x00, 0x08, 0x44, 0xA6, 0x00, 0x08, 0x54, 0xA6, 0x00, 0x08, 0x68, 0xA6, 0x00, 0x08,
-    0x88, 0xA6, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x00, 0x80, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xC7, 0x0B, 0x00, 0xEA, 0x88, 0x44, 0x00, 0x03, 0x56, 0x55, 0x55, 0x55,
-    0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03, 0x8C, 0x48, 0x00, 0x03, 0xC4, 0x46, 0x00, 0x03,
-    0xAC, 0x46, 0x00, 0x03, 0x00, 0xA7, 0x00, 0x08, 0x00, 0xA7, 0x00, 0x08, 0x00, 0xA7, 0x00, 0x08,
-    0x00, 0xA7, 0x00, 0x08, 0x04, 0x00, 0x8F, 0xE2, 0x54, 0x00, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x20, 0xC2, 0xA0, 0xE1, 0x00, 0x50, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x04, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x00, 0xF0, 0x1F, 0xE5, 0x6C, 0x4A, 0x00, 0x03, 0x08, 0x4B, 0x00, 0x03,
-    0xC0, 0xA8, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x04, 0xA9, 0x00, 0x08,
-    0x03, 0x00, 0x00, 0xEA, 0xC0, 0xA8, 0x00, 0x08, 0xC0, 0xA8, 0x00, 0x08, 0xCC, 0xA8, 0x00, 0x08,
-    0x04, 0xA9, 0x00, 0x08, 0xE0, 0x10, 0x8F, 0xE2, 0x50, 0x10, 0x0A, 0xE5, 0x49, 0x1F, 0x8F, 0xE2,
-    0x0C, 0x10, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x04, 0x9A, 0xE5, 0xC0, 0x11, 0x9F, 0xE5,
-    0x01, 0x00, 0x50, 0xE1, 0xBC, 0xF1, 0x9F, 0x15, 0x20, 0x04, 0xDA, 0xE5, 0x02, 0x00, 0x80, 0xE3,
-    0x20, 0x04, 0xCA, 0xE5, 0xB0, 0xF1, 0x9F, 0xE5, 0x78, 0x17, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB,
-    0xA0, 0xF1, 0x9F, 0xE5, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2, 0xB0, 0x24, 0x9A, 0xE5, 0xB0, 0x14, 0x8A, 0xE5,
-    0xA4, 0x04, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x02, 0x20, 0x41, 0xE0,
-    0x78, 0x01, 0x9F, 0xE5, 0x90, 0xC2, 0x82, 0xE0, 0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x00, 0x80, 0xE0,
-    0x02, 0x09, 0x50, 0xE3, 0xA0, 0x04, 0x8A, 0xB5, 0x0F, 0x00, 0x00, 0xBA, 0x50, 0x01, 0x9F, 0xE5,
-    0xA0, 0x04, 0x8A, 0xE5, 0x84, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2,
-    0x4C, 0xF1, 0x9F, 0xE5, 0xA4, 0x04, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0,
-    0x0C, 0x10, 0x81, 0xE2, 0xB0, 0x14, 0x8A, 0xE5, 0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x09, 0x60, 0xE2,
-    0x80, 0x00, 0x90, 0xE0, 0x00, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x41, 0xE2, 0xAC, 0x00, 0x4F, 0xE2,
-    0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0x04, 0xF1, 0x9F, 0xE5, 0x05, 0x0A, 0x5C, 0xE3,
-    0x00, 0xF1, 0x9F, 0x35, 0x01, 0x50, 0x2D, 0xE9, 0xD1, 0xFF, 0xFF, 0xEB, 0x01, 0x50, 0xBD, 0xE8,
-    0x20, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0x1E, 0x1B, 0x0C, 0xE2,
-    0x05, 0x0A, 0x51, 0xE3, 0xA0, 0x04, 0xCA, 0x05, 0x0E, 0xF0, 0xA0, 0x01, 0x16, 0x0B, 0x51, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x11, 0x7F, 0x10, 0x00, 0xE2, 0xA1, 0x14, 0xCA, 0xE5, 0x80, 0x00, 0x00, 0xE2,
-    0xA4, 0x04, 0xCA, 0xE5, 0xDA, 0xFF, 0xFF, 0xEA, 0x05, 0x0A, 0x5C, 0xE3, 0xB8, 0xF0, 0x9F, 0x35,
-    0x01, 0x50, 0x2D, 0xE9, 0xBE, 0xFF, 0xFF, 0xEB, 0x01, 0x50, 0xBD, 0xE8, 0x20, 0x14, 0xDA, 0xE5,
-    0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0x1E, 0x1B, 0x0C, 0xE2, 0x05, 0x0A, 0x51, 0xE3,
-    0xA0, 0x04, 0xDA, 0x05, 0x0E, 0xF0, 0xA0, 0x01, 0x16, 0x0B, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0x11,
-    0xA1, 0x04, 0xDA, 0xE5, 0xA4, 0x14, 0xDA, 0xE5, 0x01, 0x00, 0x80, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x1E, 0x1B, 0x0C, 0xE2, 0x74, 0x20, 0x9F, 0xE5, 0xA1, 0xF4, 0x92, 0xE7, 0x06, 0x2B, 0x0C, 0xE2,
-    0x01, 0x1B, 0x8A, 0xE2, 0xA8, 0x10, 0x81, 0xE2, 0xA2, 0x05, 0xC1, 0xE7, 0xA8, 0x04, 0x9A, 0xE5,
-    0x5C, 0x10, 0x9F, 0xE5, 0x01, 0x00, 0x10, 0xE0, 0x58, 0xF0, 0x9F, 0x05, 0x01, 0x00, 0x10, 0xE3,
-    0x50, 0xF0, 0x9F, 0x15, 0x01, 0x0C, 0x10, 0xE3, 0x4C, 0xF0, 0x9F, 0x15, 0x01, 0x08, 0x10, 0xE3,
-    0x48, 0xF0, 0x9F, 0xE5, 0x1E, 0x1B, 0x0C, 0xE2, 0x06, 0x0A, 0x51, 0xE3, 0x40, 0xF0, 0x9F, 0x05,
-    0x1A, 0x0B, 0x51, 0xE3, 0x3C, 0xF0, 0x9F, 0x05, 0x07, 0x0A, 0x51, 0xE3, 0x38, 0xF0, 0x9F, 0x05,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xFF, 0x7F, 0x00, 0x00, 0x88, 0x44, 0x00, 0x03, 0x98, 0x44, 0x00, 0x03,
-    0x56, 0x55, 0x55, 0x55, 0xA0, 0x66, 0x00, 0x03, 0xB0, 0x50, 0x00, 0x03, 0x88, 0x50, 0x00, 0x03,
-    0x9C, 0x48, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0xAC, 0x46, 0x00, 0x03, 0xC4, 0x46, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x74, 0xA9, 0x00, 0x08, 0xD8, 0xA9, 0x00, 0x08, 0xE0, 0xA9, 0x00, 0x08, 0x20, 0xAA, 0x00, 0x08,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x01, 0x00, 0x00, 0x1A, 0xA5, 0x04, 0xCA, 0xE5,
-    0x05, 0x00, 0x00, 0xEA, 0x2C, 0xC1, 0x8C, 0xE1, 0x03, 0xC0, 0x1C, 0xE2, 0xC4, 0xF0, 0x9F, 0x05,
-    0x01, 0x00, 0x5C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xC0, 0xA0, 0xE1,
-    0xA4, 0x04, 0xDA, 0xE5, 0x02, 0x00, 0x10, 0xE3, 0x01, 0x00, 0xE0, 0xE3, 0x04, 0x00, 0x00, 0x1A,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xA0, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0xA5, 0x04, 0xDA, 0xE5,
-    0x98, 0xF0, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x90, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0xA5, 0x04, 0xDA, 0xE5, 0x80, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3, 0x80, 0xF0, 0x9F, 0x05,
-    0x0B, 0x2A, 0x4C, 0xE2, 0x03, 0x2A, 0x02, 0xE2, 0x85, 0x00, 0x1C, 0xE3, 0x02, 0x2B, 0x82, 0x13,
-    0x4A, 0x00, 0x1C, 0xE3, 0x01, 0x29, 0x82, 0x13, 0x01, 0x1B, 0x8A, 0xE2, 0xA8, 0x10, 0x81, 0xE2,
-    0x0F, 0x00, 0x00, 0xE2, 0xA2, 0x05, 0xC1, 0xE7, 0x01, 0x29, 0xC2, 0xE3, 0xA2, 0x05, 0xF1, 0xE7,
-    0x08, 0x10, 0xD1, 0xE5, 0x01, 0x02, 0x80, 0xE1, 0x48, 0x10, 0x9F, 0xE5, 0xA2, 0xF4, 0x91, 0xE7,
-    0x0F, 0x0A, 0x5C, 0xE3, 0xED, 0xFF, 0xFF, 0x4A, 0x85, 0x00, 0x1C, 0xE3, 0x01, 0xC0, 0x8C, 0x13,
-    0x4A, 0x00, 0x1C, 0xE3, 0x02, 0xC0, 0x8C, 0x13, 0x03, 0xC0, 0x0C, 0xE2, 0x04, 0x10, 0x8F, 0xE2,
-    0xA0, 0x24, 0xDA, 0xE5, 0x0C, 0xF1, 0x91, 0xE7, 0xA4, 0x69, 0x00, 0x03, 0xC8, 0x69, 0x00, 0x03,
-    0xB8, 0x69, 0x00, 0x03, 0x2C, 0x6A, 0x00, 0x03, 0xA0, 0x46, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x9C, 0x48, 0x00, 0x03, 0x80, 0xAA, 0x00, 0x08,
-    0x8C, 0xAA, 0x00, 0x08, 0x94, 0xAA, 0x00, 0x08, 0xD4, 0xAA, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x01, 0x0A, 0x1C, 0xE3, 0x54, 0xF0, 0x9F, 0x05, 0x54, 0xF0, 0x9F, 0x15, 0x01, 0x0A, 0x1C, 0xE3,
-    0x50, 0xF0, 0x9F, 0x05, 0x0B, 0xCA, 0x4C, 0xE2, 0xAC, 0x15, 0xA0, 0xE1, 0x01, 0x00, 0x1C, 0xE3,
-    0x01, 0x10, 0x81, 0x13, 0x02, 0x00, 0x1C, 0xE3, 0x01, 0xCB, 0x8A, 0xE2, 0xA4, 0xC0, 0x8C, 0xE2,
-    0x0F, 0x00, 0x00, 0xE2, 0x01, 0x20, 0xDC, 0xE7, 0x78, 0x20, 0x02, 0x02, 0xA0, 0x00, 0x82, 0x01,
-    0x07, 0x20, 0x02, 0x12, 0x80, 0x01, 0x82, 0x11, 0x01, 0x00, 0xCC, 0xE7, 0x18, 0xC0, 0x9F, 0xE5,
-    0x01, 0xF1, 0x9C, 0xE7, 0x0F, 0x0A, 0x5C, 0xE3, 0xED, 0xFF, 0xFF, 0x4A, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x54, 0x47, 0x00, 0x03, 0xA0, 0x46, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x9C, 0x48, 0x00, 0x03,
-    0x18, 0xAB, 0x00, 0x08, 0x18, 0xAB, 0x00, 0x08, 0x18, 0xAB, 0x00, 0x08, 0x18, 0xAB, 0x00, 0x08,
-    0x14, 0x05, 0x9A, 0xE5, 0x01, 0x07, 0x50, 0xE3, 0x02, 0x07, 0x80, 0x82, 0x14, 0x05, 0x8A, 0xE5,
-    0x00, 0x00, 0xA0, 0xE3, 0x6C, 0xF0, 0x9F, 0xE5, 0xA0, 0xC4, 0x8A, 0xE5, 0x03, 0x00, 0x00, 0xE2,
-    0x0C, 0x01, 0x80, 0xE1, 0x0E, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x58, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x0A, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x4C, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x0A, 0x10, 0xE3, 0x02, 0x0B, 0xC0, 0x13, 0x40, 0x00, 0x10, 0xE3,
-    0x02, 0x00, 0x00, 0x1A, 0xA0, 0x03, 0xA0, 0xE1, 0x0C, 0xE0, 0xA0, 0xE1, 0x24, 0xF0, 0x9F, 0xE5,
-    0x80, 0x10, 0x00, 0xE0, 0x21, 0x13, 0xA0, 0xE1, 0xFE, 0x10, 0x81, 0xE3, 0x20, 0x03, 0x01, 0xE0,
-    0xA0, 0x04, 0x8A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x14, 0xF0, 0x9F, 0xE5, 0xA0, 0x04, 0x9A, 0xE5,
-    0x0C, 0xE0, 0xA0, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5, 0x58, 0x48, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xB0, 0xAB, 0x00, 0x08,
-    0xE0, 0xAB, 0x00, 0x08, 0xE8, 0xAB, 0x00, 0x08, 0x28, 0xAC, 0x00, 0x08, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x09, 0x0A, 0x5C, 0xE3, 0x03, 0x00, 0x00, 0xAA, 0xA4, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0x11, 0xE2,
-    0x90, 0xF0, 0x9F, 0x05, 0x90, 0xF0, 0x9F, 0x15, 0x2C, 0xC2, 0x8C, 0xE1, 0x2C, 0xC1, 0x8C, 0xE1,
-    0x03, 0xC0, 0x1C, 0xE2, 0x84, 0xF0, 0x9F, 0x05, 0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x0B, 0x0A, 0x5C, 0xE3, 0x78, 0xF0, 0x9F, 0x45, 0x0F, 0x00, 0x00, 0xE2, 0x0B, 0x2A, 0x4C, 0xE2,
-    0x03, 0x2A, 0x02, 0xE2, 0x55, 0x00, 0x1C, 0xE3, 0x01, 0x2B, 0x82, 0x13, 0xAA, 0x00, 0x1C, 0xE3,
-    0x02, 0x2B, 0x82, 0x13, 0x01, 0x1B, 0x8A, 0xE2, 0xA6, 0x10, 0x81, 0xE2, 0x22, 0x05, 0xC1, 0xE7,
-    0x01, 0x2B, 0xC2, 0xE3, 0x22, 0x05, 0xF1, 0xE7, 0x01, 0x10, 0xD1, 0xE5, 0x01, 0x02, 0x80, 0xE1,
-    0x40, 0x10, 0x9F, 0xE5, 0xA2, 0xF4, 0x91, 0xE7, 0x0F, 0x0A, 0x5C, 0xE3, 0xED, 0xFF, 0xFF, 0x4A,
-    0x2C, 0xC2, 0x8C, 0xE1, 0x2C, 0xC1, 0x8C, 0xE1, 0x03, 0xC0, 0x0C, 0xE2, 0x04, 0x10, 0x8F, 0xE2,
-    0xA0, 0x24, 0xDA, 0xE5, 0x0C, 0xF1, 0x91, 0xE7, 0xA4, 0x69, 0x00, 0x03, 0xB8, 0x69, 0x00, 0x03,
-    0xC8, 0x69, 0x00, 0x03, 0x2C, 0x6A, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0xA0, 0x46, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x9C, 0x48, 0x00, 0x03, 0x88, 0xAC, 0x00, 0x08,
-    0x94, 0xAC, 0x00, 0x08, 0x94, 0xAC, 0x00, 0x08, 0x94, 0xAC, 0x00, 0x08, 0x18, 0x00, 0xA0, 0xE3,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x18, 0x00, 0x00, 0xE2, 0xA0, 0x04, 0xCA, 0xE5,
-    0x02, 0x00, 0x00, 0xEA, 0x03, 0x00, 0x00, 0xE2, 0xA1, 0x04, 0xCA, 0xE5, 0xA0, 0x04, 0xDA, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x03, 0x10, 0xA0, 0xE3, 0xA0, 0x00, 0x81, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x10, 0xF0, 0x9F, 0xE5, 0xA0, 0x04, 0xDA, 0xE5, 0xA1, 0x14, 0xDA, 0xE5, 0xA0, 0x00, 0x81, 0xE1,
-    0x0C, 0xE0, 0xA0, 0xE1, 0x00, 0xF0, 0x1F, 0xE5, 0x24, 0x48, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03,
-    0x00, 0xAD, 0x00, 0x08, 0x10, 0xAD, 0x00, 0x08, 0x2C, 0xAD, 0x00, 0x08, 0x38, 0xAD, 0x00, 0x08,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0xAD, 0x00, 0x08, 0x10, 0xAD, 0x00, 0x08, 0x2C, 0xAD, 0x00, 0x08,
-    0x38, 0xAD, 0x00, 0x08, 0x02, 0x00, 0xA0, 0xE3, 0xA4, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x0A, 0x1C, 0xE3, 0x03, 0xC0, 0x1C, 0x02, 0x64, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0x11,
-    0x01, 0x0A, 0x1C, 0xE3, 0x0E, 0xF0, 0xA0, 0x01, 0x03, 0xC0, 0x0C, 0xE2, 0x03, 0x00, 0x5C, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x11, 0x20, 0x01, 0xA0, 0xE1, 0x48, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3,
-    0x03, 0x00, 0x1C, 0x03, 0x40, 0xF0, 0x9F, 0x05, 0x0D, 0x2A, 0x4C, 0xE2, 0x03, 0xC0, 0x0C, 0xE2,
-    0xA4, 0x14, 0xDA, 0xE5, 0x02, 0x00, 0x11, 0xE3, 0x8C, 0x10, 0x01, 0xE0, 0xAC, 0xC0, 0x81, 0x11,
-    0x22, 0x25, 0x8C, 0xE1, 0x08, 0x00, 0x12, 0xE3, 0x20, 0x10, 0x9F, 0x05, 0x20, 0x10, 0x4F, 0x12,
-    0x02, 0xF1, 0x91, 0xE7, 0x9C, 0x69, 0x00, 0x03, 0xC8, 0x69, 0x00, 0x03, 0x2C, 0x6A, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xA0, 0x46, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x9C, 0x48, 0x00, 0x03, 0x98, 0xAD, 0x00, 0x08, 0xBC, 0xAD, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x03, 0x00, 0x00, 0x1A,
-    0xA0, 0x14, 0x9A, 0xE5, 0x02, 0x00, 0x11, 0xE3, 0x20, 0xF0, 0x9F, 0x05, 0x20, 0xF0, 0x9F, 0x15,
-    0xA0, 0x04, 0x8A, 0xE5, 0x01, 0x00, 0x10, 0xE3, 0x18, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3,
-    0x14, 0xF0, 0x9F, 0x05, 0x07, 0xC0, 0x0C, 0xE2, 0x10, 0x10, 0x9F, 0xE5, 0x0C, 0xF1, 0x91, 0xE7,
-    0x54, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03,
-    0x9C, 0x48, 0x00, 0x03, 0xF8, 0xAD, 0x00, 0x08, 0x38, 0xAE, 0x00, 0x08, 0x44, 0xAE, 0x00, 0x08,
-    0x60, 0xAE, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x03, 0xC0, 0x0C, 0xE2, 0x24, 0x10, 0x8F, 0xE2,
-    0x0C, 0xF1, 0x91, 0xE7, 0xA4, 0x14, 0x9A, 0xE5, 0xFF, 0x00, 0x11, 0xE3, 0x64, 0xF0, 0x9F, 0x15,
-    0x01, 0x40, 0x2D, 0xE9, 0x40, 0x00, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x58, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x4C, 0xF0, 0x9F, 0xE5, 0x04, 0xAE, 0x00, 0x08, 0x74, 0x47, 0x00, 0x03,
-    0xA0, 0x49, 0x00, 0x03, 0xD4, 0x49, 0x00, 0x03, 0x03, 0xC0, 0x0C, 0xE2, 0x3C, 0x10, 0x9F, 0xE5,
-    0x0C, 0xF1, 0x91, 0xE7, 0x03, 0xC0, 0x1C, 0xE2, 0x01, 0x00, 0x00, 0x1A, 0xA3, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x5C, 0xE3, 0xA0, 0x04, 0xCA, 0x05, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x03, 0xC0, 0x1C, 0xE2, 0xFA, 0xFF, 0xFF, 0x1A, 0x01, 0x10, 0xA0, 0xE3, 0xA4, 0x14, 0xCA, 0xE5,
-    0x40, 0x00, 0x10, 0xE3, 0x00, 0xF0, 0x1F, 0xE5, 0x54, 0x47, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03,
-    0xAC, 0x48, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03,
-    0x58, 0x48, 0x00, 0x03, 0x08, 0x10, 0x8F, 0xE2, 0x54, 0x10, 0x0A, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0x24, 0xF0, 0x9F, 0xE5, 0x24, 0x10, 0x9F, 0xE5, 0x01, 0x00, 0x5C, 0xE1, 0x20, 0xF0, 0x9F, 0x05,
-    0x01, 0x10, 0x41, 0xE2, 0x01, 0x00, 0x5C, 0xE1, 0x18, 0xF0, 0x9F, 0x05, 0x01, 0x10, 0x41, 0xE2,
-    0x01, 0x00, 0x5C, 0xE1, 0x00, 0xF0, 0x1F, 0x05, 0x0C, 0xF0, 0x9F, 0xE5, 0x58, 0x48, 0x00, 0x03,
-    0xFF, 0x7F, 0x00, 0x00, 0x08, 0x4B, 0x00, 0x03, 0x6C, 0x4A, 0x00, 0x03, 0xE8, 0x52, 0x00, 0x03,
-    0x08, 0x3E, 0x00, 0x06, 0x14, 0x3F, 0x00, 0x06, 0x24, 0x3F, 0x00, 0x06, 0x50, 0x3F, 0x00, 0x06,
-    0x0C, 0x00, 0xA0, 0xE3, 0xA3, 0x04, 0xCA, 0xE5, 0x4C, 0x01, 0x9F, 0xE5, 0xC8, 0x07, 0x8A, 0xE5,
-    0x48, 0x01, 0x9F, 0xE5, 0xD0, 0x07, 0x8A, 0xE5, 0x44, 0x01, 0x9F, 0xE5, 0xCC, 0x07, 0x8A, 0xE5,
-    0xD4, 0x07, 0x8A, 0xE5, 0x3C, 0x01, 0x9F, 0xE5, 0xD8, 0x07, 0x8A, 0xE5, 0x2B, 0x05, 0xDA, 0xE5,
-    0x34, 0x11, 0x9F, 0xE5, 0x58, 0x20, 0x1A, 0xE5, 0x76, 0x00, 0x50, 0xE3, 0x2C, 0x21, 0x9F, 0x05,
-    0xF5, 0x00, 0x50, 0xE3, 0x2D, 0x35, 0xDA, 0x05, 0x00, 0x00, 0x53, 0x03, 0x20, 0x21, 0x9F, 0x05,
-    0xF9, 0x00, 0x50, 0xE3, 0x1C, 0x31, 0x9F, 0x05, 0x1C, 0x01, 0x9F, 0x05, 0x00, 0x30, 0x80, 0x05,
-    0x18, 0x21, 0x9F, 0x05, 0x58, 0x20, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x04, 0x3E, 0x00, 0x06,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x00, 0x01, 0x9F, 0xE5,
-    0x10, 0x00, 0x0A, 0xE5, 0xFC, 0x00, 0x9F, 0xE5, 0x54, 0x00, 0x0A, 0xE5, 0xFF, 0x00, 0xA0, 0xE3,
-    0xC3, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x00, 0x1C, 0xE3, 0xA4, 0x14, 0xDA, 0xE5,
-    0x04, 0x00, 0x00, 0x1A, 0xA4, 0x04, 0xCA, 0xE5, 0x01, 0xC0, 0x20, 0xE0, 0x40, 0x00, 0x1C, 0xE3,
-    0x6E, 0x00, 0x00, 0x1A, 0x0E, 0xF0, 0xA0, 0xE1, 0x07, 0x10, 0x01, 0xE2, 0x01, 0xF1, 0x9F, 0xE7,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0xB1, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x5C, 0xB1, 0x00, 0x08,
-    0x54, 0xB1, 0x00, 0x08, 0x01, 0x00, 0x1C, 0xE3, 0x9C, 0xF0, 0x9F, 0x05, 0xA8, 0x14, 0xDA, 0xE5,
-    0xFF, 0x00, 0x11, 0xE3, 0x0E, 0xC0, 0xA0, 0xE1, 0x00, 0x20, 0xA0, 0xE1, 0x7F, 0x00, 0x00, 0x1B,
-    0x0C, 0xE0, 0xA0, 0xE1, 0xA4, 0x14, 0xDA, 0xE5, 0x80, 0x00, 0x11, 0xE3, 0x07, 0x10, 0x01, 0xE2,
-    0x08, 0x10, 0x81, 0x13, 0x01, 0xF1, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x9C, 0x49, 0x00, 0x03,
-    0xD0, 0x49, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03, 0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03,
-    0x80, 0x49, 0x00, 0x03, 0xCC, 0xB0, 0x00, 0x08, 0xB4, 0xB0, 0x00, 0x08, 0x04, 0x4A, 0x00, 0x03,
-    0x38, 0x4A, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03,
-    0x10, 0x49, 0x00, 0x03, 0xCC, 0xB0, 0x00, 0x08, 0xB4, 0xB0, 0x00, 0x08, 0x18, 0x6C, 0x00, 0x03,
-    0x80, 0x3D, 0x00, 0x06, 0xF8, 0x6C, 0x00, 0x03, 0xF4, 0xB0, 0x00, 0x08, 0x48, 0x3E, 0x00, 0x06,
-    0x88, 0x3E, 0x00, 0x06, 0x88, 0xAF, 0x00, 0x08, 0xDC, 0xB1, 0x00, 0x08, 0x20, 0x51, 0x00, 0x03,
-    0xD4, 0xAF, 0x00, 0x08, 0xB8, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x10, 0x3E, 0x00, 0x06,
-    0xC8, 0x14, 0x9A, 0xE5, 0xCC, 0x24, 0x9A, 0xE5, 0xC8, 0x24, 0x8A, 0xE5, 0xCC, 0x14, 0x8A, 0xE5,
-    0xF8, 0x40, 0x2D, 0xE9, 0x19, 0xED, 0x8A, 0xE2, 0xFF, 0x00, 0x9E, 0xE8, 0xF0, 0x00, 0xAE, 0xE8,
-    0x0F, 0x00, 0x8E, 0xE8, 0x0F, 0xE0, 0xA0, 0xE1, 0x6C, 0xF0, 0x9F, 0xE5, 0xF8, 0x40, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0x00, 0xA0, 0xE1, 0x0E, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x58, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0x54, 0xF0, 0x9F, 0xE5, 0x02, 0x00, 0xA0, 0xE1,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x40, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x3C, 0xF0, 0x9F, 0xE5, 0xA5, 0x04, 0xDA, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x34, 0xF0, 0x9F, 0xE5, 0x5D, 0x1E, 0xA0, 0xA3, 0x30, 0x10, 0x9F, 0xB5, 0xB0, 0x14, 0x8A, 0xE5,
-    0x1D, 0x1E, 0xA0, 0xA3, 0x28, 0x10, 0x9F, 0xB5, 0xB4, 0x14, 0x8A, 0xE5, 0x24, 0x10, 0x9F, 0xA5,
-    0x24, 0x10, 0x9F, 0xB5, 0xBC, 0x14, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x48, 0x4B, 0x00, 0x03,
-    0x58, 0xB2, 0x00, 0x08, 0x74, 0x47, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x7F, 0x05, 0x00, 0x00, 0xBF, 0x01, 0x00, 0x00, 0x01, 0x03, 0x0C, 0x00, 0x01, 0xD0, 0x0C, 0x00,
-    0x02, 0x00, 0x10, 0xE3, 0x00, 0x10, 0xA0, 0x03, 0x01, 0x10, 0xA0, 0x13, 0xA7, 0x14, 0xCA, 0xE5,
-    0x02, 0x00, 0x00, 0xEA, 0xA6, 0x04, 0xCA, 0xE5, 0x00, 0x00, 0x00, 0xEA, 0xA5, 0x04, 0xCA, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x3F, 0x00, 0xA0, 0xE3, 0xA7, 0x14, 0xDA, 0xE5, 0x01, 0x03, 0x80, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xF8, 0xF0, 0x9F, 0xE5, 0xA6, 0x04, 0xDA, 0xE5, 0xA7, 0x14, 0xDA, 0xE5,
-    0x01, 0x03, 0x80, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0xE8, 0xF0, 0x9F, 0xE5, 0x3E, 0x00, 0xA0, 0xE3,
-    0xA7, 0x14, 0xDA, 0xE5, 0x01, 0x03, 0x80, 0xE1, 0xA4, 0x14, 0xDA, 0xE5, 0x40, 0x00, 0x11, 0xE3,
-    0x06, 0x00, 0x00, 0x1A, 0x0F, 0xE0, 0xA0, 0xE1, 0xCC, 0xF0, 0x9F, 0xE5, 0xA5, 0x04, 0xDA, 0xE5,
-    0xA7, 0x14, 0xDA, 0xE5, 0x01, 0x03, 0x80, 0xE1, 0x0C, 0xE0, 0xA0, 0xE1, 0xBC, 0xF0, 0x9F, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xB4, 0xF0, 0x9F, 0xE5, 0xA5, 0x04, 0xDA, 0xE5, 0xA7, 0x14, 0xDA, 0xE5,
-    0x01, 0x03, 0x80, 0xE1, 0x0C, 0xE0, 0xA0, 0xE1, 0x9C, 0xF0, 0x9F, 0xE5, 0x05, 0x0A, 0x5C, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x11, 0x02, 0x00, 0x00, 0xE2, 0xA8, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x03, 0x10, 0x00, 0xE2, 0x04, 0x00, 0x10, 0xE3, 0x20, 0x10, 0x81, 0x13, 0x08, 0x00, 0x10, 0xE3,
-    0x04, 0x10, 0x81, 0x13, 0x10, 0x00, 0x10, 0xE3, 0x40, 0x10, 0x81, 0x13, 0x20, 0x00, 0x10, 0xE3,
-    0x80, 0x10, 0x81, 0x13, 0x40, 0x00, 0x10, 0xE3, 0x10, 0x10, 0x81, 0x13, 0x80, 0x00, 0x10, 0xE3,
-    0x08, 0x10, 0x81, 0x13, 0x01, 0x00, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x10, 0x00, 0xE2,
-    0x02, 0x00, 0x10, 0xE3, 0x08, 0x10, 0x81, 0x13, 0x04, 0x00, 0x10, 0xE3, 0x10, 0x10, 0x81, 0x13,
-    0x08, 0x00, 0x10, 0xE3, 0x04, 0x10, 0x81, 0x13, 0x10, 0x00, 0x10, 0xE3, 0x02, 0x10, 0x81, 0x13,
-    0x01, 0x00, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0xA8, 0x14, 0xDA, 0xE5, 0xFF, 0x00, 0x11, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x20, 0x00, 0x50, 0xE3, 0xEF, 0xFF, 0xFF, 0xBA, 0x20, 0x00, 0x40, 0xE2,
-    0xDE, 0xFF, 0xFF, 0xEA, 0xB4, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x54, 0x47, 0x00, 0x03, 0xC4, 0xB2, 0x00, 0x08, 0xD8, 0xB2, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03,
-    0x94, 0x47, 0x00, 0x03, 0x0E, 0xC0, 0xA0, 0xE1, 0x44, 0x00, 0x9F, 0xE5, 0x10, 0x00, 0x0A, 0xE5,
-    0x40, 0x00, 0x9F, 0xE5, 0x54, 0x00, 0x0A, 0xE5, 0x05, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xE0, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x30, 0xF0, 0x9F, 0xE5, 0x06, 0x00, 0xA0, 0xE3, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x28, 0xF0, 0x9F, 0xE5, 0x24, 0x00, 0xA0, 0xE3, 0xA0, 0x04, 0x8A, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0xA0, 0xE3, 0xA4, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x0C, 0x53, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03,
-    0x34, 0x47, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x38, 0xB3, 0x00, 0x08, 0x0E, 0xC0, 0xA0, 0xE1, 0x54, 0x10, 0x9F, 0xE5, 0x10, 0x10, 0x0A, 0xE5,
-    0x50, 0x10, 0x9F, 0xE5, 0x54, 0x10, 0x0A, 0xE5, 0x00, 0x00, 0xE0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x44, 0xF0, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x3C, 0xF0, 0x9F, 0xE5,
-    0x0C, 0xF0, 0xA0, 0xE1, 0x38, 0xF0, 0x9F, 0xE5, 0x03, 0x10, 0x0C, 0xE2, 0x01, 0xF1, 0x9F, 0xE7,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x34, 0x47, 0x00, 0x03, 0x58, 0xB3, 0x00, 0x08, 0x40, 0xB3, 0x00, 0x08,
-    0x40, 0xB3, 0x00, 0x08, 0x14, 0xF0, 0x9F, 0xE5, 0x08, 0x00, 0x10, 0xE3, 0x14, 0xF0, 0x9F, 0x05,
-    0x14, 0xF0, 0x9F, 0xE5, 0x0C, 0x53, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03,
-    0x34, 0x47, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xC4, 0x46, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x2C, 0x10, 0x8F, 0xE2, 0x50, 0x10, 0x0A, 0xE5, 0x0D, 0x1D, 0x8F, 0xE2, 0x0C, 0x10, 0x0A, 0xE5,
-    0x03, 0x00, 0xA0, 0xE3, 0xA2, 0x04, 0xCA, 0xE5, 0xA3, 0x04, 0xCA, 0xE5, 0x7F, 0x00, 0xA0, 0xE3,
-    0xA4, 0x04, 0xCA, 0xE5, 0xA5, 0x04, 0xCA, 0xE5, 0xA6, 0x04, 0xCA, 0xE5, 0xA7, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x05, 0x0A, 0x5C, 0xE3, 0x80, 0xF4, 0x9F, 0x35, 0x51, 0x0C, 0x5C, 0xE3,
-    0xAE, 0x00, 0x00, 0x3A, 0x52, 0x0C, 0x5C, 0xE3, 0xAD, 0x00, 0x00, 0xAA, 0xFF, 0x20, 0x1C, 0xE2,
-    0x0E, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x52, 0xE3, 0x0F, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x52, 0xE3,
-    0x10, 0x00, 0x00, 0x0A, 0x14, 0x00, 0x52, 0xE3, 0x0E, 0xF0, 0xA0, 0xB1, 0x17, 0x00, 0x52, 0xE3,
-    0x18, 0x00, 0x00, 0xDA, 0x20, 0x00, 0x52, 0xE3, 0x0E, 0xF0, 0xA0, 0xB1, 0x27, 0x00, 0x52, 0xE3,
-    0x3E, 0x00, 0x00, 0xDA, 0x2B, 0x00, 0x52, 0xE3, 0x6E, 0x00, 0x00, 0xDA, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x03, 0x00, 0x00, 0xE2, 0xA2, 0x04, 0xCA, 0xE5, 0x12, 0x00, 0x00, 0xEA, 0x03, 0x00, 0x00, 0xE2,
-    0xA3, 0x04, 0xCA, 0xE5, 0x6D, 0x00, 0x00, 0xEA, 0xB8, 0x04, 0xCA, 0xE5, 0x55, 0x00, 0x50, 0xE3,
-    0x0C, 0xF4, 0x9F, 0x05, 0x00, 0x00, 0x50, 0xE3, 0x04, 0xF4, 0x9F, 0x05, 0xE4, 0x00, 0x50, 0xE3,
-    0x00, 0xF4, 0x9F, 0x05, 0x20, 0x12, 0x20, 0xE0, 0x0C, 0x10, 0x11, 0xE2, 0xF8, 0xF3, 0x9F, 0xE5,
-    0x00, 0x00, 0x50, 0xE3, 0xF4, 0xF3, 0x9F, 0xE5, 0x14, 0x20, 0x42, 0xE2, 0x01, 0x1B, 0x8A, 0xE2,
-    0xA4, 0x10, 0x81, 0xE2, 0x02, 0x00, 0xC1, 0xE7, 0xA2, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3,
-    0x02, 0x00, 0x00, 0x1A, 0xA5, 0x04, 0xDA, 0xE5, 0x20, 0x01, 0xA0, 0xE1, 0xD0, 0xF3, 0x9F, 0xE5,
-    0x04, 0xE0, 0x2D, 0xE5, 0x01, 0x00, 0x51, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0xA5, 0x04, 0xDA, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xBC, 0xF3, 0x9F, 0xE5, 0xA7, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4,
-    0xB4, 0xF3, 0x9F, 0xE5, 0x02, 0x00, 0x51, 0xE3, 0x08, 0x00, 0x00, 0x1A, 0xA5, 0x04, 0xDA, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x9C, 0xF3, 0x9F, 0xE5, 0xA6, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x98, 0xF3, 0x9F, 0xE5, 0xA7, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0x90, 0xF3, 0x9F, 0xE5,
-    0xA4, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x88, 0xF3, 0x9F, 0xE5, 0xA5, 0x04, 0xDA, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x80, 0xF3, 0x9F, 0xE5, 0xA6, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x68, 0xF3, 0x9F, 0xE5, 0xA7, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0x60, 0xF3, 0x9F, 0xE5,
-    0x00, 0x10, 0xA0, 0xE3, 0xB4, 0x14, 0xCA, 0xE5, 0x01, 0x1B, 0x8A, 0xE2, 0xA8, 0x10, 0x81, 0xE2,
-    0x20, 0x20, 0x42, 0xE2, 0x02, 0x00, 0xC1, 0xE7, 0xA3, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3,
-    0x01, 0x00, 0x00, 0x1A, 0xAF, 0x04, 0xDA, 0xE5, 0x40, 0xF3, 0x9F, 0xE5, 0x04, 0xE0, 0x2D, 0xE5,
-    0x01, 0x00, 0x51, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0xAB, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x2C, 0xF3, 0x9F, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0xAF, 0x04, 0xDA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x02, 0x00, 0x51, 0xE3, 0x09, 0x00, 0x00, 0x1A, 0xA9, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x10, 0xF3, 0x9F, 0xE5, 0xAB, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x08, 0xF3, 0x9F, 0xE5,
-    0xAD, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0xAF, 0x04, 0xDA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xA8, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xF0, 0xF2, 0x9F, 0xE5, 0xA9, 0x04, 0xDA, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xE8, 0xF2, 0x9F, 0xE5, 0xAA, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xE0, 0xF2, 0x9F, 0xE5, 0xAB, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xD8, 0xF2, 0x9F, 0xE5,
-    0xAC, 0x04, 0xDA, 0xE5, 0xAD, 0x04, 0xDA, 0xE5, 0xAE, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4,
-    0xAF, 0x04, 0xDA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x10, 0xA0, 0xE3, 0xB4, 0x14, 0xCA, 0xE5,
-    0x01, 0x1B, 0x8A, 0xE2, 0xA8, 0x10, 0x81, 0xE2, 0x20, 0x20, 0x42, 0xE2, 0x02, 0x00, 0xC1, 0xE7,
-    0xA3, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0x02, 0x00, 0x00, 0x1A, 0xB3, 0x04, 0xDA, 0xE5,
-    0xA0, 0x01, 0xA0, 0xE1, 0x74, 0xF2, 0x9F, 0xE5, 0x04, 0xE0, 0x2D, 0xE5, 0x01, 0x00, 0x51, 0xE3,
-    0x05, 0x00, 0x00, 0x1A, 0xB3, 0x04, 0xDA, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0xB3, 0x04, 0xDA, 0xE5,
-    0x20, 0x01, 0xA0, 0xE1, 0x74, 0xF2, 0x9F, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x02, 0x00, 0x51, 0xE3,
-    0x06, 0x00, 0x00, 0x1A, 0xB1, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x60, 0xF2, 0x9F, 0xE5,
-    0x04, 0xE0, 0x9D, 0xE4, 0xB3, 0x04, 0xDA, 0xE5, 0x58, 0xF2, 0x9F, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xB0, 0x04, 0xDA, 0xE5, 0xB1, 0x04, 0xDA, 0xE5, 0xB2, 0x04, 0xDA, 0xE5, 0xB3, 0x04, 0xDA, 0xE5,
-    0xB0, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x3C, 0xF2, 0x9F, 0xE5, 0xB1, 0x04, 0xDA, 0xE5,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x34, 0xF2, 0x9F, 0xE5, 0xB2, 0x04, 0xDA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x2C, 0xF2, 0x9F, 0xE5, 0x04, 0xE0, 0x9D, 0xE4, 0xB3, 0x04, 0xDA, 0xE5, 0x24, 0xF2, 0x9F, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xFF, 0x20, 0x0C, 0xE2, 0x03, 0x00, 0x52, 0xE3, 0x0D, 0x00, 0x00, 0x0A,
-    0x04, 0x00, 0x52, 0xE3, 0x05, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x52, 0xE3, 0xB6, 0x04, 0xCA, 0x05,
-    0x0E, 0xF0, 0xA0, 0x01, 0x06, 0x00, 0x52, 0xE3, 0xB7, 0x04, 0xCA, 0x05, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x80, 0x00, 0x10, 0xE2, 0xA1, 0x04, 0xCA, 0xE5, 0x20, 0x04, 0xDA, 0x05, 0x02, 0x00, 0xC0, 0x03,
-    0x20, 0x04, 0xCA, 0x05, 0x44, 0x00, 0x00, 0xEA, 0xA0, 0x04, 0xCA, 0xE5, 0x42, 0x00, 0x00, 0xEA,
-    0x52, 0x0C, 0x5C, 0xE3, 0xD0, 0xF1, 0x9F, 0x35, 0xFF, 0x20, 0x0C, 0xE2, 0x04, 0x00, 0x52, 0xE3,
-    0x05, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x52, 0xE3, 0x16, 0x00, 0x00, 0x0A, 0x06, 0x00, 0x52, 0xE3,
-    0x19, 0x00, 0x00, 0x0A, 0xFF, 0x00, 0xA0, 0xE3, 0x0E, 0xF0, 0xA0, 0xE1, 0x20, 0x04, 0xDA, 0xE5,
-    0x02, 0x00, 0x10, 0xE3, 0x02, 0x00, 0xC0, 0xE3, 0x20, 0x04, 0xCA, 0xE5, 0x00, 0x00, 0xA0, 0xE3,
-    0x80, 0x00, 0x80, 0x13, 0x10, 0x17, 0x9A, 0xE5, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0,
-    0x02, 0x10, 0x81, 0xE0, 0x14, 0x27, 0x9A, 0xE5, 0x02, 0x10, 0x41, 0xE0, 0xEC, 0xC7, 0x9A, 0xE5,
-    0x91, 0x2C, 0x8C, 0xE0, 0x03, 0x01, 0x52, 0xE3, 0x40, 0x00, 0x80, 0x33, 0xF1, 0x00, 0x5C, 0xE3,
-    0x40, 0x00, 0xC0, 0x83, 0x0E, 0xF0, 0xA0, 0xE1, 0xB6, 0x14, 0xDA, 0xE5, 0xB6, 0x24, 0xDA, 0xE5,
-    0x91, 0x02, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xE2, 0x0E, 0xF0, 0xA0, 0xE1, 0xB6, 0x14, 0xDA, 0xE5,
-    0xB6, 0x24, 0xDA, 0xE5, 0x91, 0x02, 0x00, 0xE0, 0x20, 0x04, 0xA0, 0xE1, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x20, 0x04, 0xDA, 0xE5, 0x02, 0x00, 0xC0, 0xE3, 0x20, 0x04, 0xCA, 0xE5, 0x16, 0x00, 0x00, 0xEB,
-    0x28, 0xF1, 0x9F, 0xE5, 0xA1, 0x04, 0xDA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0x1C, 0xF1, 0x9F, 0x05,
-    0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0xF7, 0xFF, 0xFF, 0x1A, 0x78, 0x17, 0x9A, 0xE5,
-    0x0C, 0x10, 0x81, 0xE2, 0x08, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xFC, 0xF0, 0x9F, 0xE5, 0x78, 0x17, 0x9A, 0xE5, 0x08, 0x08, 0x9A, 0xE5,
-    0x20, 0x12, 0x81, 0xE0, 0x5C, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xDC, 0xF0, 0x9F, 0xE5, 0xD0, 0xF0, 0x9F, 0xE5, 0xA1, 0x04, 0xDA, 0xE5,
-    0x80, 0x00, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0xA0, 0x04, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x01, 0xF0, 0x00, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0xA1, 0x01, 0x00, 0x80, 0xE2,
-    0x08, 0x18, 0x9A, 0xE5, 0x90, 0x01, 0x01, 0xE0, 0x14, 0x07, 0x9A, 0xE5, 0x21, 0x12, 0x80, 0xE0,
-    0x0C, 0x10, 0x41, 0xE2, 0x0C, 0x07, 0x9A, 0xE5, 0x48, 0x04, 0x40, 0xE0, 0x10, 0x27, 0x9A, 0xE5,
-    0x00, 0x20, 0x82, 0xE0, 0x02, 0x00, 0x51, 0xE1, 0xE4, 0x07, 0x9A, 0x45, 0x00, 0x10, 0x81, 0x40,
-    0xB4, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0x74, 0xF0, 0x9F, 0xE5,
-    0xB0, 0x50, 0x00, 0x03, 0x60, 0xB4, 0x00, 0x08, 0xD0, 0x46, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03,
-    0xAC, 0x46, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03, 0xD4, 0x47, 0x00, 0x03, 0x20, 0x48, 0x00, 0x03,
-    0x94, 0x47, 0x00, 0x03, 0xB4, 0x47, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0x6C, 0x4A, 0x00, 0x03, 0xA0, 0x49, 0x00, 0x03, 0xD4, 0x49, 0x00, 0x03,
-    0xBC, 0x48, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03,
-    0x08, 0x4B, 0x00, 0x03, 0x04, 0x4A, 0x00, 0x03, 0x38, 0x4A, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03,
-    0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0x88, 0x50, 0x00, 0x03,
-    0x88, 0x44, 0x00, 0x03, 0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03, 0xEC, 0x02, 0x9F, 0xE5,
-    0xC8, 0x07, 0x8A, 0xE5, 0xD0, 0x07, 0x8A, 0xE5, 0xE4, 0x02, 0x9F, 0xE5, 0xCC, 0x07, 0x8A, 0xE5,
-    0xD4, 0x07, 0x8A, 0xE5, 0x0C, 0x17, 0x9A, 0xE5, 0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5,
-    0x01, 0x20, 0x82, 0xE0, 0xB8, 0x24, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE3,
-    0xC8, 0x07, 0x8A, 0xE5, 0xCC, 0x07, 0x8A, 0xE5, 0xD0, 0x07, 0x8A, 0xE5, 0xD4, 0x07, 0x8A, 0xE5,
-    0x3C, 0x07, 0x00, 0xEA, 0x3C, 0xB9, 0x00, 0x08, 0x48, 0xBB, 0x00, 0x08, 0x58, 0xBB, 0x00, 0x08,
-    0x9C, 0xBB, 0x00, 0x08, 0x12, 0x00, 0xA0, 0xE3, 0xA3, 0x04, 0xCA, 0xE5, 0x94, 0x02, 0x9F, 0xE5,
-    0xD8, 0x07, 0x8A, 0xE5, 0xE4, 0xFF, 0xFF, 0xEA, 0x0E, 0xF0, 0xA0, 0xE1, 0xA4, 0x14, 0xDA, 0xE5,
-    0x01, 0x00, 0x1C, 0xE3, 0x0F, 0x20, 0x01, 0xE2, 0xA1, 0x12, 0xA0, 0xE1, 0x81, 0xC1, 0x81, 0xE1,
-    0x0C, 0xC0, 0x0C, 0xE2, 0x02, 0xF1, 0x9F, 0x17, 0x0F, 0x00, 0x00, 0xEA, 0x38, 0xBA, 0x00, 0x08,
-    0x54, 0xBA, 0x00, 0x08, 0x70, 0xBA, 0x00, 0x08, 0x8C, 0xBA, 0x00, 0x08, 0xA8, 0xBA, 0x00, 0x08,
-    0xC4, 0xBA, 0x00, 0x08, 0x18, 0xBB, 0x00, 0x08, 0x28, 0xBB, 0x00, 0x08, 0xE0, 0xBA, 0x00, 0x08,
-    0xFC, 0xBA, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x38, 0xBB, 0x00, 0x08, 0xA4, 0x04, 0xCA, 0xE5,
-    0xA0, 0x22, 0x31, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0xA0, 0x12, 0xA0, 0xE1, 0x81, 0xC1, 0x81, 0xE1,
-    0x0C, 0xC0, 0x0C, 0xE2, 0x00, 0x40, 0x2D, 0xE9, 0x05, 0x00, 0x12, 0xE3, 0x02, 0x00, 0x00, 0x1B,
-    0x02, 0x00, 0x12, 0xE3, 0x0E, 0x00, 0x00, 0x1B, 0x00, 0x80, 0xBD, 0xE8, 0x00, 0x20, 0xA0, 0xE3,
-    0x04, 0x40, 0x2D, 0xE9, 0x06, 0x10, 0x2D, 0xE9, 0x01, 0x0B, 0x8A, 0xE2, 0xA8, 0x00, 0x80, 0xE2,
-    0x02, 0x00, 0xD0, 0xE7, 0xDA, 0xFF, 0xFF, 0xEB, 0x06, 0x10, 0xBD, 0xE8, 0x01, 0x20, 0x82, 0xE2,
-    0x06, 0x00, 0x52, 0xE3, 0x02, 0x20, 0x82, 0x02, 0x0A, 0x00, 0x52, 0xE3, 0xF4, 0xFF, 0xFF, 0x1A,
-    0x04, 0x80, 0xBD, 0xE8, 0x02, 0x50, 0x2D, 0xE9, 0x06, 0x20, 0xB0, 0xE3, 0xA5, 0x04, 0xDA, 0xE5,
-    0xCF, 0xFF, 0xFF, 0xEB, 0x02, 0x50, 0xBD, 0xE8, 0x02, 0x50, 0x2D, 0xE9, 0x07, 0x20, 0xB0, 0xE3,
-    0xA6, 0x04, 0xDA, 0xE5, 0xCA, 0xFF, 0xFF, 0xEB, 0x02, 0x50, 0xBD, 0xE8, 0x0F, 0x20, 0xB0, 0xE3,
-    0xA7, 0x04, 0xDA, 0xE5, 0xC6, 0xFF, 0xFF, 0xEA, 0xA8, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7,
-    0x00, 0x00, 0x00, 0x00, 0x9C, 0x49, 0x00, 0x03, 0x04, 0x4A, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03,
-    0x2C, 0x49, 0x00, 0x03, 0xA9, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x49, 0x00, 0x03, 0x38, 0x4A, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03,
-    0xAA, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x49, 0x00, 0x03,
-    0xBC, 0x48, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03, 0xAB, 0x04, 0xCA, 0xE5,
-    0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x48, 0x49, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03,
-    0x48, 0x49, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0xAC, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x49, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03,
-    0xF4, 0x48, 0x00, 0x03, 0xAD, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x49, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03,
-    0xAE, 0x04, 0xCA, 0xE5, 0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0x48, 0x49, 0x00, 0x03, 0xAF, 0x04, 0xCA, 0xE5,
-    0x0C, 0xF0, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x10, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0xA5, 0x04, 0xCA, 0xE5, 0x02, 0x00, 0x11, 0xE3,
-    0xA4, 0xF0, 0x9F, 0x05, 0xA4, 0xF0, 0x9F, 0xE5, 0xA6, 0x04, 0xCA, 0xE5, 0x02, 0x00, 0x11, 0xE3,
-    0x98, 0xF0, 0x9F, 0x05, 0x98, 0xF0, 0x9F, 0xE5, 0xA7, 0x04, 0xCA, 0xE5, 0x02, 0x00, 0x11, 0xE3,
-    0x8C, 0xF0, 0x9F, 0x05, 0x80, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x1C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11,
-    0x01, 0x00, 0x10, 0xE3, 0x7C, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x1C, 0xE3, 0xA1, 0x04, 0xCA, 0x05,
-    0x1E, 0xFF, 0x2F, 0x01, 0xA1, 0x14, 0xDA, 0xE5, 0x00, 0x10, 0xA0, 0xE3, 0xA0, 0x14, 0xCA, 0xE5,
-    0x01, 0x00, 0x10, 0xE3, 0xA2, 0x14, 0xDA, 0xE5, 0x02, 0x00, 0xC1, 0xE3, 0x02, 0x00, 0x82, 0x13,
-    0x04, 0x00, 0x80, 0xE3, 0xA2, 0x04, 0xCA, 0xE5, 0x0C, 0x17, 0x9A, 0xE5, 0x48, 0x14, 0x41, 0xE0,
-    0x10, 0x27, 0x9A, 0xE5, 0xB8, 0x24, 0x8A, 0xE5, 0x3F, 0x06, 0x00, 0xEA, 0x01, 0x00, 0x1C, 0xE2,
-    0xA2, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0xC1, 0xE3, 0x00, 0x10, 0x81, 0xE1, 0xA2, 0x14, 0xCA, 0xE5,
-    0x20, 0x14, 0xDA, 0x05, 0x02, 0x10, 0xC1, 0x03, 0x20, 0x14, 0xCA, 0x05, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x18, 0x6C, 0x00, 0x03, 0xF8, 0x6C, 0x00, 0x03, 0xF4, 0xB0, 0x00, 0x08, 0x54, 0x47, 0x00, 0x03,
-    0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03, 0xB8, 0xBC, 0x00, 0x08,
-    0x68, 0xBD, 0x00, 0x08, 0x7C, 0xBD, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x78, 0x27, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0x88, 0xF1, 0x9F, 0xE5, 0x0C, 0x17, 0x9A, 0xE5,
-    0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x01, 0x20, 0x82, 0xE0, 0x0C, 0x20, 0x82, 0xE2,
-    0xAC, 0x14, 0x9A, 0xE5, 0xAC, 0x24, 0x8A, 0xE5, 0x01, 0x10, 0x42, 0xE0, 0xA8, 0xC4, 0xDA, 0xE5,
-    0x80, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x5C, 0x01, 0x9F, 0xE5, 0x90, 0xC1, 0x81, 0xE0,
-    0x01, 0x10, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0xA4, 0x04, 0x9A, 0xE5, 0x00, 0x08, 0xA0, 0xE1,
-    0x01, 0x08, 0x50, 0xE0, 0x20, 0x08, 0xA0, 0xE1, 0xA4, 0x04, 0x8A, 0xE5, 0x11, 0x00, 0x00, 0x8A,
-    0x00, 0x00, 0xA0, 0xE3, 0xA8, 0x04, 0xCA, 0xE5, 0xA4, 0x04, 0x8A, 0xE5, 0x02, 0x10, 0xA0, 0xE1,
-    0x28, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2, 0x20, 0xF1, 0x9F, 0xE5,
-    0xA8, 0xC4, 0xDA, 0xE5, 0x80, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x0C, 0x17, 0x9A, 0xE5,
-    0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x01, 0x20, 0x82, 0xE0, 0x0C, 0x20, 0x82, 0xE2,
-    0xAC, 0x24, 0x8A, 0xE5, 0xA4, 0x04, 0x9A, 0xE5, 0x80, 0x00, 0x90, 0xE0, 0x03, 0x08, 0xA0, 0x03,
-    0x00, 0x10, 0x82, 0xE0, 0x0C, 0x10, 0x41, 0xE2, 0xC0, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2,
-    0x74, 0xC0, 0x8C, 0xE2, 0xD8, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3, 0xD4, 0xF0, 0x9F, 0x05,
-    0x07, 0xC0, 0x0C, 0xE2, 0x7C, 0x10, 0x8F, 0xE2, 0x0C, 0xF1, 0x91, 0xE7, 0xA9, 0x14, 0xDA, 0xE5,
-    0x00, 0x00, 0x51, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0x40, 0x00, 0x10, 0xE3, 0xB8, 0xF0, 0x9F, 0xE5,
-    0x01, 0x10, 0xA0, 0xE3, 0xA9, 0x14, 0xCA, 0xE5, 0x80, 0x00, 0x10, 0xE3, 0xAC, 0xF0, 0x9F, 0xE5,
-    0x20, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0xA8, 0x14, 0xDA, 0xE5,
-    0x80, 0x00, 0x11, 0xE3, 0x02, 0x00, 0x00, 0x0A, 0x01, 0x40, 0x2D, 0xE9, 0xBA, 0xFF, 0xFF, 0xEB,
-    0x01, 0x40, 0xBD, 0xE8, 0x80, 0x00, 0x00, 0xE2, 0xA8, 0x04, 0xCA, 0xE5, 0xD3, 0xFF, 0xFF, 0xEA,
-    0x20, 0x14, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0xA0, 0x24, 0x9A, 0xE5,
-    0xA4, 0x24, 0x8A, 0xE5, 0xCD, 0xFF, 0xFF, 0xEA, 0xA1, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xCC, 0xBC, 0x00, 0x08, 0xE0, 0xBC, 0x00, 0x08,
-    0xBC, 0x52, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x08, 0x20, 0xBD, 0x00, 0x08, 0x38, 0xBD, 0x00, 0x08,
-    0x40, 0xBD, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x01, 0x0A, 0x1C, 0xE3, 0x30, 0xF0, 0x9F, 0x05,
-    0x07, 0xC0, 0x0C, 0xE2, 0x2C, 0x10, 0x9F, 0xE5, 0x0C, 0xF1, 0x91, 0xE7, 0x03, 0x09, 0x5C, 0xE3,
-    0x24, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0xE1, 0x88, 0x44, 0x00, 0x03, 0x56, 0x55, 0x55, 0x55,
-    0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0xC4, 0x46, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x9C, 0x48, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x7C, 0xBE, 0x00, 0x08, 0x90, 0xBE, 0x00, 0x08, 0xA4, 0xBE, 0x00, 0x08, 0x1C, 0xBF, 0x00, 0x08,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x78, 0x17, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0x5C, 0xF1, 0x9F, 0xE5,
-    0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0,
-    0x0C, 0x10, 0x81, 0xE2, 0xA8, 0x24, 0x9A, 0xE5, 0xA8, 0x14, 0x8A, 0xE5, 0x02, 0x20, 0x41, 0xE0,
-    0x3C, 0x01, 0x9F, 0xE5, 0x90, 0xC2, 0x82, 0xE0, 0xA4, 0xC4, 0xDA, 0xE5, 0x10, 0x00, 0x1C, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0xA0, 0x04, 0x9A, 0xE5, 0x00, 0x08, 0xA0, 0xE1, 0x02, 0x08, 0x50, 0xE0,
-    0x20, 0x08, 0xA0, 0xE1, 0xA0, 0x04, 0x8A, 0xE5, 0x0F, 0x00, 0x00, 0x2A, 0x00, 0x00, 0xA0, 0xE3,
-    0xA4, 0x04, 0xCA, 0xE5, 0x0C, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2,
-    0x04, 0xF1, 0x9F, 0xE5, 0xA4, 0xC4, 0xDA, 0xE5, 0x10, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0,
-    0x0C, 0x10, 0x81, 0xE2, 0xA8, 0x14, 0x8A, 0xE5, 0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2,
-    0x80, 0x00, 0x90, 0xE0, 0x00, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x41, 0xE2, 0xB0, 0x00, 0x4F, 0xE2,
-    0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0xBC, 0xF0, 0x9F, 0xE5, 0x02, 0x0B, 0x1C, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x01, 0x01, 0x0A, 0x1C, 0xE3, 0xB0, 0xF0, 0x9F, 0x05, 0xB0, 0xF0, 0x9F, 0xE5,
-    0x02, 0x0B, 0x1C, 0xE3, 0x0E, 0xF0, 0xA0, 0x01, 0x01, 0x0A, 0x1C, 0xE3, 0xA4, 0xF0, 0x9F, 0x05,
-    0xA4, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3, 0x06, 0x00, 0x00, 0x0A, 0x20, 0x14, 0xDA, 0xE5,
-    0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0x00, 0x10, 0xA0, 0xE3, 0xA5, 0x14, 0xCA, 0xE5,
-    0xA4, 0x04, 0xCA, 0xE5, 0xDA, 0xFF, 0xFF, 0xEA, 0xA4, 0x14, 0xDA, 0xE5, 0x10, 0x00, 0x11, 0xE3,
-    0x06, 0x00, 0x00, 0x1A, 0xA5, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0xA1, 0x04, 0xCA, 0x05,
-    0xA0, 0x04, 0xCA, 0x15, 0x01, 0x10, 0x21, 0xE2, 0xA5, 0x14, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x01, 0x40, 0x2D, 0xE9, 0xB5, 0xFF, 0xFF, 0xEB, 0x01, 0x40, 0xBD, 0xE8, 0xF4, 0xFF, 0xFF, 0xEA,
-    0xA5, 0x14, 0xDA, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0xA1, 0x04, 0xCA, 0x05, 0xA0, 0x04, 0xCA, 0x15,
-    0x01, 0x10, 0x21, 0xE2, 0xA5, 0x14, 0xCA, 0xE5, 0xC5, 0xFF, 0xFF, 0xEA, 0x02, 0x0B, 0x1C, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x01, 0x01, 0x0A, 0x1C, 0xE3, 0x20, 0xF0, 0x9F, 0x15, 0x20, 0xF0, 0x9F, 0xE5,
-    0x88, 0x44, 0x00, 0x03, 0x56, 0x55, 0x55, 0x55, 0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03,
-    0xA0, 0x49, 0x00, 0x03, 0xD4, 0x49, 0x00, 0x03, 0x08, 0x4A, 0x00, 0x03, 0x3C, 0x4A, 0x00, 0x03,
-    0xD8, 0x47, 0x00, 0x03, 0xA0, 0x46, 0x00, 0x03, 0x6C, 0xBF, 0x00, 0x08, 0x78, 0xBF, 0x00, 0x08,
-    0x84, 0xBF, 0x00, 0x08, 0x88, 0xBF, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3,
-    0x28, 0xF0, 0x9F, 0x15, 0x28, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3, 0x24, 0xF0, 0x9F, 0x15,
-    0x24, 0xF0, 0x9F, 0xE5, 0x24, 0xF0, 0x9F, 0xE5, 0x01, 0x0A, 0x1C, 0xE3, 0x20, 0xF0, 0x9F, 0x15,
-    0x10, 0x00, 0x10, 0xE3, 0x00, 0x00, 0x00, 0x1A, 0x18, 0xF0, 0x9F, 0xE5, 0x0C, 0xF0, 0x9F, 0xE5,
-    0xD4, 0x49, 0x00, 0x03, 0xA0, 0x49, 0x00, 0x03, 0x3C, 0x4A, 0x00, 0x03, 0x08, 0x4A, 0x00, 0x03,
-    0xC0, 0x52, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xA0, 0x46, 0x00, 0x03, 0x98, 0xC0, 0x00, 0x08,
-    0xA0, 0xC0, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x78, 0x17, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0xB0, 0xF1, 0x9F, 0xE5, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2,
-    0xA8, 0x24, 0x9A, 0xE5, 0xA8, 0x14, 0x8A, 0xE5, 0x02, 0x20, 0x41, 0xE0, 0x90, 0x01, 0x9F, 0xE5,
-    0x90, 0xC2, 0x82, 0xE0, 0xA4, 0xC4, 0xDA, 0xE5, 0x80, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0xA0, 0x04, 0x9A, 0xE5, 0x00, 0x08, 0xA0, 0xE1, 0x02, 0x08, 0x50, 0xE0, 0x20, 0x08, 0xA0, 0xE1,
-    0xA0, 0x04, 0x8A, 0xE5, 0x13, 0x00, 0x00, 0x2A, 0x01, 0x00, 0x1C, 0xE3, 0x11, 0x00, 0x00, 0x0A,
-    0x03, 0x40, 0x2D, 0xE9, 0x5C, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2, 0x80, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x50, 0xF1, 0x9F, 0xE5, 0x03, 0x40, 0xBD, 0xE8, 0x09, 0x00, 0x00, 0xEA,
-    0xA4, 0xC4, 0xDA, 0xE5, 0x80, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x81, 0xE2,
-    0xA8, 0x14, 0x8A, 0xE5, 0xA0, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x80, 0x00, 0x90, 0xE0,
-    0x00, 0x10, 0x81, 0xE0, 0x0C, 0x10, 0x41, 0xE2, 0xC0, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2,
-    0x74, 0xC0, 0x8C, 0xE2, 0x00, 0xF1, 0x9F, 0xE5, 0xA5, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xA5, 0x14, 0xDA, 0xE5, 0x08, 0x00, 0x11, 0xE3, 0x07, 0x10, 0x01, 0xE2, 0xEC, 0x20, 0x9F, 0x05,
-    0xB8, 0x20, 0x8F, 0x12, 0x01, 0xF1, 0x92, 0xE7, 0xA4, 0x14, 0xDA, 0xE5, 0x80, 0x00, 0x11, 0xE3,
-    0x02, 0x00, 0x00, 0x0A, 0x01, 0x40, 0x2D, 0xE9, 0xC3, 0xFF, 0xFF, 0xEB, 0x01, 0x40, 0xBD, 0xE8,
-    0xA4, 0x04, 0xCA, 0xE5, 0x01, 0x00, 0x10, 0xE3, 0xDC, 0xFF, 0xFF, 0x1A, 0x20, 0x14, 0xDA, 0xE5,
-    0x02, 0x10, 0xC1, 0xE3, 0x20, 0x14, 0xCA, 0xE5, 0xD8, 0xFF, 0xFF, 0xEA, 0xA4, 0x14, 0xDA, 0xE5,
-    0x80, 0x00, 0x11, 0xE3, 0x01, 0x00, 0x00, 0x1A, 0xA0, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x40, 0x2D, 0xE9, 0xB4, 0xFF, 0xFF, 0xEB, 0x01, 0x40, 0xBD, 0xE8, 0xA0, 0x04, 0xCA, 0xE5,
-    0xCE, 0xFF, 0xFF, 0xEA, 0xA4, 0x14, 0xDA, 0xE5, 0x80, 0x00, 0x11, 0xE3, 0x01, 0x00, 0x00, 0x1A,
-    0xA1, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x40, 0x2D, 0xE9, 0xAA, 0xFF, 0xFF, 0xEB,
-    0x01, 0x40, 0xBD, 0xE8, 0xA1, 0x04, 0xCA, 0xE5, 0xC4, 0xFF, 0xFF, 0xEA, 0x40, 0x00, 0x10, 0xE3,
-    0x5C, 0x10, 0x9F, 0x05, 0x5C, 0x10, 0x9F, 0x15, 0x10, 0x10, 0x0A, 0xE5, 0x58, 0x10, 0x9F, 0x05,
-    0x58, 0x10, 0x9F, 0x15, 0x54, 0x10, 0x0A, 0xE5, 0x54, 0xF0, 0x9F, 0x05, 0x54, 0x10, 0x9F, 0xE5,
-    0x38, 0x10, 0x0A, 0xE5, 0xFF, 0x00, 0xA0, 0xE3, 0xC3, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x3C, 0xC1, 0x00, 0x08, 0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0xA0, 0x46, 0x00, 0x03, 0xB8, 0xC0, 0x00, 0x08, 0xEC, 0xC0, 0x00, 0x08, 0x14, 0xC1, 0x00, 0x08,
-    0x88, 0x44, 0x00, 0x03, 0x56, 0x55, 0x55, 0x55, 0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03,
-    0x9C, 0x48, 0x00, 0x03, 0x0C, 0x53, 0x00, 0x03, 0xDC, 0x52, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03,
-    0xE8, 0x52, 0x00, 0x03, 0x34, 0x47, 0x00, 0x03, 0x00, 0xA8, 0xFF, 0x02, 0xD4, 0xC1, 0x00, 0x08,
-    0xD4, 0xC1, 0x00, 0x08, 0xD4, 0xC1, 0x00, 0x08, 0xD4, 0xC1, 0x00, 0x08, 0x01, 0x00, 0xB0, 0xE3,
-    0x20, 0xF0, 0x9F, 0xE5, 0x20, 0xC2, 0xA0, 0xE1, 0x00, 0x50, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x14, 0xF0, 0x9F, 0xE5, 0x08, 0x00, 0x1C, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1, 0x04, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x04, 0xF0, 0x9F, 0xE5, 0xAC, 0x46, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0xD8, 0x47, 0x00, 0x03, 0x18, 0xC2, 0x00, 0x08, 0x18, 0xC2, 0x00, 0x08, 0x18, 0xC2, 0x00, 0x08,
-    0x18, 0xC2, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x40, 0x2D, 0xE9, 0x80, 0x00, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0x11, 0x0C, 0xF0, 0x9F, 0x15, 0x01, 0x40, 0xBD, 0xE8, 0x40, 0x00, 0x10, 0xE3,
-    0x04, 0xF0, 0x9F, 0x15, 0x0E, 0xF0, 0xA0, 0xE1, 0xD8, 0x47, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0x54, 0xC2, 0x00, 0x08, 0x84, 0xC2, 0x00, 0x08, 0xB4, 0xC2, 0x00, 0x08, 0xC4, 0xC2, 0x00, 0x08,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x24, 0x9A, 0xE5, 0x0F, 0x00, 0x00, 0xE2, 0x01, 0x0A, 0x1C, 0xE3,
-    0x03, 0x00, 0x00, 0x1A, 0x0F, 0x28, 0xC2, 0xE3, 0x00, 0x08, 0x82, 0xE1, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x26, 0xC2, 0xE3, 0x00, 0x0A, 0x82, 0xE1, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x24, 0x9A, 0xE5, 0x0F, 0x00, 0x00, 0xE2, 0x01, 0x0A, 0x1C, 0xE3,
-    0x03, 0x00, 0x00, 0x1A, 0x0F, 0x24, 0xC2, 0xE3, 0x00, 0x0C, 0x82, 0xE1, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x22, 0xC2, 0xE3, 0x00, 0x0E, 0x82, 0xE1, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x02, 0x00, 0x00, 0x02, 0xA4, 0x04, 0xCA, 0x05,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x00, 0xF0, 0x1F, 0x15, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xD8, 0x47, 0x00, 0x03, 0xE8, 0xC2, 0x00, 0x08, 0x30, 0xC3, 0x00, 0x08, 0x3C, 0xC3, 0x00, 0x08,
-    0x48, 0xC3, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x88, 0xF0, 0x9F, 0x05,
-    0xA2, 0x04, 0xCA, 0xE5, 0x00, 0xC0, 0xA0, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0x01, 0x00, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x74, 0xF0, 0x9F, 0xE5, 0xA0, 0x14, 0xDA, 0xE5, 0x02, 0x00, 0x0C, 0xE2,
-    0x80, 0x01, 0x81, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x64, 0xF0, 0x9F, 0xE5, 0x00, 0x40, 0xBD, 0xE8,
-    0xA1, 0x14, 0xDA, 0xE5, 0x04, 0x00, 0x0C, 0xE2, 0x00, 0x01, 0x81, 0xE1, 0x54, 0xF0, 0x9F, 0xE5,
-    0x01, 0x0A, 0x1C, 0xE3, 0x50, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3,
-    0x48, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x00, 0x00, 0xE2, 0xA2, 0x14, 0xDA, 0xE5,
-    0x01, 0x0A, 0x1C, 0xE3, 0x03, 0x00, 0x00, 0x1A, 0xA0, 0x04, 0xCA, 0xE5, 0x02, 0x10, 0x01, 0xE2,
-    0x81, 0x01, 0x80, 0xE1, 0x18, 0xF0, 0x9F, 0xE5, 0xA1, 0x04, 0xCA, 0xE5, 0x04, 0x10, 0x01, 0xE2,
-    0x01, 0x01, 0x80, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x54, 0x47, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0x6C, 0x4A, 0x00, 0x03, 0x08, 0x4B, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03,
-    0x94, 0x47, 0x00, 0x03, 0xA8, 0xC3, 0x00, 0x08, 0xE8, 0xC3, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x1C, 0xE3, 0x01, 0x00, 0x00, 0x1A,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x14, 0xDA, 0xE5, 0x07, 0x10, 0x01, 0xE2,
-    0x00, 0x20, 0x8F, 0xE2, 0x01, 0xF1, 0x92, 0xE7, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xA0, 0x49, 0x00, 0x03, 0xD4, 0x49, 0x00, 0x03, 0x08, 0x4A, 0x00, 0x03, 0x3C, 0x4A, 0x00, 0x03,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x01, 0x00, 0x1C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11,
-    0x01, 0x00, 0x10, 0xE3, 0x04, 0xF0, 0x1F, 0xE5, 0xB8, 0x46, 0x00, 0x03, 0x28, 0xC4, 0x00, 0x08,
-    0x28, 0xC4, 0x00, 0x08, 0x28, 0xC4, 0x00, 0x08, 0x28, 0xC4, 0x00, 0x08, 0x00, 0x00, 0xA0, 0xE3,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x20, 0xF0, 0x9F, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x00, 0x00, 0xA0, 0xE3, 0x18, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0x2D, 0xE9, 0x20, 0x02, 0xA0, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x00, 0xF0, 0x1F, 0xE5,
-    0xB4, 0x4A, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03, 0xA0, 0x49, 0x00, 0x03, 0x60, 0xC4, 0x00, 0x08,
-    0x60, 0xC4, 0x00, 0x08, 0x60, 0xC4, 0x00, 0x08, 0x60, 0xC4, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x01, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x24, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x9D, 0xE8,
-    0x20, 0x02, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x18, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8,
-    0xFE, 0xCC, 0x0C, 0xE2, 0xFE, 0x0C, 0x5C, 0xE3, 0x0E, 0xF0, 0xA0, 0x01, 0x08, 0x00, 0x10, 0xE3,
-    0x04, 0xF0, 0x9F, 0xE5, 0xD8, 0x47, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xAC, 0x46, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0x08, 0x10, 0x8F, 0xE2, 0x50, 0x10, 0x0A, 0xE5, 0xFF, 0x00, 0xA0, 0xE3, 0x28, 0xF0, 0x9F, 0xE5,
-    0x41, 0x0C, 0x5C, 0xE3, 0x24, 0xF0, 0x9F, 0x35, 0xE1, 0x1C, 0x0C, 0xE2, 0x41, 0x0C, 0x51, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x11, 0x01, 0x40, 0x2D, 0xE9, 0xA0, 0x01, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x04, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x04, 0xF0, 0x9F, 0xE5, 0x58, 0x48, 0x00, 0x03,
-    0xB0, 0x50, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x28, 0x15, 0xDA, 0xE5, 0x02, 0x10, 0xC1, 0xE3,
-    0x28, 0x15, 0xCA, 0xE5, 0x18, 0x00, 0x8F, 0xE2, 0x54, 0x00, 0x0A, 0xE5, 0x14, 0x05, 0x9A, 0xE5,
-    0x02, 0x08, 0x10, 0xE3, 0x01, 0x00, 0xA0, 0x13, 0x00, 0x00, 0xA0, 0x03, 0xA0, 0x04, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x7F, 0x1E, 0xA0, 0xE3, 0x01, 0x10, 0x41, 0xE2, 0x2C, 0x02, 0x31, 0xE1,
-    0x0E, 0xF0, 0xA0, 0x11, 0x0F, 0xC0, 0x0C, 0xE2, 0x54, 0x10, 0x8F, 0xE2, 0x0C, 0xF1, 0x91, 0xE7,
-    0x00, 0xC0, 0xA0, 0xE1, 0x01, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x80, 0xF0, 0x9F, 0xE5,
-    0xA0, 0x14, 0x9A, 0xE5, 0x00, 0x00, 0x51, 0xE3, 0x02, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x1C, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x6C, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x01, 0x00, 0x80, 0xE2,
-    0x64, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x5C, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x01, 0x00, 0x80, 0xE2, 0x54, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x10, 0xE2,
-    0x50, 0xF0, 0x9F, 0xE5, 0x50, 0xC5, 0x00, 0x08, 0x84, 0xC5, 0x00, 0x08, 0x2C, 0x49, 0x00, 0x03,
-    0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0x9C, 0xC5, 0x00, 0x08,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03,
-    0x94, 0x47, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03, 0xAC, 0x46, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03,
-    0xF4, 0x48, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03, 0xC4, 0x46, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x04, 0x10, 0x8F, 0xE2,
-    0x54, 0x10, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x1C, 0xE3, 0x01, 0x00, 0x00, 0x1A,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x14, 0xDA, 0xE5, 0x07, 0x10, 0x01, 0xE2,
-    0x00, 0x20, 0x8F, 0xE2, 0x01, 0xF1, 0x92, 0xE7, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xA0, 0x49, 0x00, 0x03, 0xD4, 0x49, 0x00, 0x03, 0x08, 0x4A, 0x00, 0x03, 0x3C, 0x4A, 0x00, 0x03,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x01, 0x00, 0x1C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11,
-    0x01, 0x00, 0x10, 0xE3, 0x04, 0xF0, 0x1F, 0xE5, 0xB8, 0x46, 0x00, 0x03, 0x80, 0xC6, 0x00, 0x08,
-    0x80, 0xC6, 0x00, 0x08, 0x80, 0xC6, 0x00, 0x08, 0x80, 0xC6, 0x00, 0x08, 0x1E, 0xFF, 0x2F, 0xE1,
-    0xAC, 0x15, 0xA0, 0xE1, 0x0E, 0x10, 0x01, 0xE2, 0x08, 0x00, 0x1C, 0xE3, 0x01, 0x10, 0x81, 0x13,
-    0x10, 0x00, 0x1C, 0xE3, 0x01, 0x10, 0x81, 0x13, 0x00, 0xC0, 0x8F, 0xE2, 0x01, 0xF1, 0x9C, 0xE7,
-    0x54, 0x47, 0x00, 0x03, 0x74, 0x47, 0x00, 0x03, 0x94, 0x47, 0x00, 0x03, 0x7C, 0xC6, 0x00, 0x08,
-    0xBC, 0x48, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03,
-    0x2C, 0x49, 0x00, 0x03, 0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03,
-    0xA0, 0x46, 0x00, 0x03, 0x9C, 0x69, 0x00, 0x03, 0xC8, 0x69, 0x00, 0x03, 0x2C, 0x6A, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0x08, 0x10, 0x8F, 0xE2, 0x54, 0x10, 0x0A, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0x28, 0xF0, 0x9F, 0xE5,
-    0x06, 0x0A, 0x5C, 0xE3, 0x0E, 0xF0, 0xA0, 0x11, 0x01, 0x40, 0x2D, 0xE9, 0x20, 0x02, 0xA0, 0xE1,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x10, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x40, 0x10, 0x00, 0xE2,
-    0x03, 0x00, 0x00, 0xE2, 0x21, 0x02, 0x80, 0xE1, 0x00, 0xF0, 0x1F, 0xE5, 0x58, 0x48, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0xB0, 0x4A, 0x00, 0x03, 0xB0, 0x4A, 0x00, 0x03, 0xB0, 0x4A, 0x00, 0x03,
-    0xB0, 0x4A, 0x00, 0x03, 0x04, 0x10, 0x9F, 0xE5, 0x54, 0x10, 0x0A, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0xB0, 0x4A, 0x00, 0x03, 0x68, 0xC7, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0xCC, 0xC7, 0x00, 0x08,
-    0xBC, 0x52, 0x00, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x1C, 0xE3, 0xA0, 0x04, 0xCA, 0x05,
-    0x0E, 0xF0, 0xA0, 0x01, 0xA0, 0x14, 0xDA, 0xE5, 0x07, 0x10, 0x01, 0xE2, 0x00, 0x20, 0x8F, 0xE2,
-    0x01, 0xF1, 0xB2, 0xE7, 0xBC, 0xC7, 0x00, 0x08, 0xBC, 0xC7, 0x00, 0x08, 0xC4, 0xC7, 0x00, 0x08,
-    0xC4, 0xC7, 0x00, 0x08, 0xC4, 0xC7, 0x00, 0x08, 0xC4, 0xC7, 0x00, 0x08, 0x54, 0x47, 0x00, 0x03,
-    0x74, 0x47, 0x00, 0x03, 0x9C, 0x49, 0x00, 0x03, 0xD0, 0x49, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03,
-    0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0x3F, 0x00, 0x00, 0xE2,
-    0x20, 0xF0, 0x92, 0xE5, 0x40, 0x00, 0x80, 0xE3, 0x20, 0xF0, 0x92, 0xE5, 0x00, 0x00, 0x10, 0xE3,
-    0x04, 0xF0, 0x1F, 0xE5, 0xAC, 0x46, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0x1C, 0xC8, 0x00, 0x08,
-    0x2C, 0xC8, 0x00, 0x08, 0x44, 0xC8, 0x00, 0x08, 0x28, 0x05, 0xDA, 0xE5, 0x08, 0x00, 0xC0, 0xE3,
-    0x28, 0x05, 0xCA, 0xE5, 0x00, 0x00, 0xE0, 0xE3, 0x78, 0xF0, 0x9F, 0xE5, 0xC0, 0x52, 0x00, 0x03,
-    0x10, 0xC8, 0x00, 0x08, 0x2C, 0xC8, 0x00, 0x08, 0x44, 0xC8, 0x00, 0x08, 0x68, 0xF0, 0x9F, 0xE5,
-    0x01, 0x0A, 0x1C, 0xE3, 0x64, 0xF0, 0x9F, 0x05, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x0A, 0x1C, 0xE3,
-    0x5C, 0xF0, 0x9F, 0x05, 0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3,
-    0x01, 0x00, 0x00, 0x1A, 0xA1, 0x04, 0xCA, 0xE5, 0x48, 0xF0, 0x9F, 0xE5, 0xA2, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x01, 0x00, 0x00, 0x1A, 0xA3, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x10, 0xE3, 0x2C, 0xF0, 0x9F, 0xE5, 0xFF, 0x00, 0x50, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x01, 0x24, 0x10, 0x9F, 0xE5, 0x3F, 0x20, 0x0C, 0xE2, 0x10, 0x00, 0x52, 0xE3,
-    0x2C, 0x03, 0xC1, 0x37, 0x0E, 0xF0, 0xA0, 0xE1, 0x58, 0x48, 0x00, 0x03, 0xE8, 0xC7, 0x00, 0x08,
-    0xD8, 0x47, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0x6C, 0x4A, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03,
-    0xA8, 0x6D, 0x00, 0x03, 0xA8, 0xC8, 0x00, 0x08, 0xCC, 0xC8, 0x00, 0x08, 0xCC, 0xC8, 0x00, 0x08,
-    0xCC, 0xC8, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x0A, 0x1C, 0xE3, 0x06, 0x00, 0x00, 0x1A,
-    0xFF, 0x00, 0x0C, 0xE2, 0x20, 0x12, 0xA0, 0xE1, 0x0B, 0x00, 0x51, 0xE3, 0x24, 0xF0, 0x9F, 0x05,
-    0x07, 0x00, 0x51, 0xE3, 0x20, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0xE1, 0xFF, 0x00, 0x0C, 0xE2,
-    0x20, 0x12, 0xA0, 0xE1, 0x0D, 0x00, 0x51, 0xE3, 0x08, 0xF0, 0x9F, 0x05, 0x0E, 0x00, 0x51, 0xE3,
-    0x04, 0xF0, 0x9F, 0x05, 0x0E, 0xF0, 0xA0, 0xE1, 0x24, 0x48, 0x00, 0x03, 0xB4, 0x4A, 0x00, 0x03,
-    0x04, 0xC9, 0x00, 0x08, 0x04, 0xC9, 0x00, 0x08, 0x04, 0xC9, 0x00, 0x08, 0x04, 0xC9, 0x00, 0x08,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x01, 0x40, 0x2D, 0xE9, 0x01, 0x00, 0x10, 0xE3, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x08, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x20, 0x02, 0xA0, 0xE1, 0x00, 0xF0, 0x1F, 0xE5,
-    0xB8, 0x46, 0x00, 0x03, 0xD8, 0x47, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0x3C, 0xC9, 0x00, 0x08, 0x0E, 0xF0, 0xA0, 0xE1, 0x20, 0x01, 0xA0, 0xE1,
-    0x04, 0xF0, 0x1F, 0xE5, 0xD8, 0x47, 0x00, 0x03, 0x60, 0xC9, 0x00, 0x08, 0x60, 0xC9, 0x00, 0x08,
-    0x60, 0xC9, 0x00, 0x08, 0x60, 0xC9, 0x00, 0x08, 0x00, 0x00, 0xE0, 0xE3, 0x14, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8,
-    0x40, 0x00, 0x10, 0xE3, 0x04, 0xF0, 0x9F, 0xE5, 0xD8, 0x47, 0x00, 0x03, 0x24, 0x48, 0x00, 0x03,
-    0xB8, 0x46, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03, 0xC0, 0x52, 0x00, 0x03,
-    0xC0, 0x52, 0x00, 0x03, 0x28, 0x05, 0xDA, 0xE5, 0x10, 0x00, 0x80, 0xE3, 0x28, 0x05, 0xCA, 0xE5,
-    0x20, 0x00, 0x9F, 0xE5, 0x20, 0x10, 0x9F, 0xE5, 0x00, 0x00, 0x81, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x01, 0x40, 0x2D, 0xE9, 0x20, 0x01, 0xA0, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0x0C, 0xF0, 0x9F, 0xE5,
-    0x01, 0x40, 0xBD, 0xE8, 0x08, 0xF0, 0x9F, 0xE5, 0xB0, 0xC9, 0x00, 0x08, 0x18, 0x51, 0x00, 0x03,
-    0xB4, 0x4A, 0x00, 0x03, 0x80, 0x30, 0x00, 0x06, 0x10, 0xDF, 0x70, 0x47, 0x11, 0xDF, 0x70, 0x47,
-    0x12, 0xDF, 0x70, 0x47, 0x13, 0xDF, 0x70, 0x47, 0x14, 0xDF, 0x70, 0x47, 0x15, 0xDF, 0x70, 0x47,
-    0x16, 0xDF, 0x70, 0x47, 0x17, 0xDF, 0x70, 0x47, 0x18, 0xDF, 0x70, 0x47, 0x03, 0xB4, 0x71, 0x46,
-    0x49, 0x08, 0x40, 0x00, 0x49, 0x00, 0x09, 0x5E, 0x49, 0x00, 0x8E, 0x44, 0x03, 0xBC, 0x70, 0x47,
-    0x01, 0x20, 0x51, 0xE2, 0x1E, 0xFF, 0x2F, 0x01, 0x36, 0x00, 0x00, 0x3A, 0x01, 0x00, 0x50, 0xE1,
-    0x22, 0x00, 0x00, 0x9A, 0x02, 0x00, 0x11, 0xE1, 0x23, 0x00, 0x00, 0x0A, 0x0E, 0x02, 0x11, 0xE3,
-    0x81, 0x11, 0xA0, 0x01, 0x08, 0x30, 0xA0, 0x03, 0x01, 0x30, 0xA0, 0x13, 0x01, 0x02, 0x51, 0xE3,
-    0x00, 0x00, 0x51, 0x31, 0x01, 0x12, 0xA0, 0x31, 0x03, 0x32, 0xA0, 0x31, 0xFA, 0xFF, 0xFF, 0x3A,
-    0x02, 0x01, 0x51, 0xE3, 0x00, 0x00, 0x51, 0x31, 0x81, 0x10, 0xA0, 0x31, 0x83, 0x30, 0xA0, 0x31,
-    0xFA, 0xFF, 0xFF, 0x3A, 0x00, 0x20, 0xA0, 0xE3, 0x01, 0x00, 0x50, 0xE1, 0x01, 0x00, 0x40, 0x20,
-    0x03, 0x20, 0x82, 0x21, 0xA1, 0x00, 0x50, 0xE1, 0xA1, 0x00, 0x40, 0x20, 0xA3, 0x20, 0x82, 0x21,
-    0x21, 0x01, 0x50, 0xE1, 0x21, 0x01, 0x40, 0x20, 0x23, 0x21, 0x82, 0x21, 0xA1, 0x01, 0x50, 0xE1,
-    0xA1, 0x01, 0x40, 0x20, 0xA3, 0x21, 0x82, 0x21, 0x00, 0x00, 0x50, 0xE3, 0x23, 0x32, 0xB0, 0x11,
-    0x21, 0x12, 0xA0, 0x11, 0xEF, 0xFF, 0xFF, 0x1A, 0x02, 0x00, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x00, 0xA0, 0x03, 0x00, 0x00, 0xA0, 0x13, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x08, 0x51, 0xE3,
-    0x21, 0x18, 0xA0, 0x21, 0x10, 0x20, 0xA0, 0x23, 0x00, 0x20, 0xA0, 0x33, 0x01, 0x0C, 0x51, 0xE3,
-    0x21, 0x14, 0xA0, 0x21, 0x08, 0x20, 0x82, 0x22, 0x10, 0x00, 0x51, 0xE3, 0x21, 0x12, 0xA0, 0x21,
-    0x04, 0x20, 0x82, 0x22, 0x04, 0x00, 0x51, 0xE3, 0x03, 0x20, 0x82, 0x82, 0xA1, 0x20, 0x82, 0x90,
-    0x30, 0x02, 0xA0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0x1F, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE1,
-    0x00, 0x00, 0x50, 0xE3, 0x00, 0x00, 0xE0, 0x13, 0x5C, 0x02, 0x00, 0xEA, 0x00, 0x00, 0x51, 0xE3,
-    0xF8, 0xFF, 0xFF, 0x0A, 0x03, 0x40, 0x2D, 0xE9, 0xBC, 0xFF, 0xFF, 0xEB, 0x06, 0x40, 0xBD, 0xE8,
-    0x92, 0x00, 0x03, 0xE0, 0x03, 0x10, 0x41, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x51, 0xE3,
-    0x43, 0x00, 0x00, 0x0A, 0x01, 0xC0, 0x20, 0xE0, 0x00, 0x10, 0x61, 0x42, 0x01, 0x20, 0x51, 0xE2,
-    0x27, 0x00, 0x00, 0x0A, 0x00, 0x30, 0xB0, 0xE1, 0x00, 0x30, 0x60, 0x42, 0x01, 0x00, 0x53, 0xE1,
-    0x26, 0x00, 0x00, 0x9A, 0x02, 0x00, 0x11, 0xE1, 0x28, 0x00, 0x00, 0x0A, 0x0E, 0x02, 0x11, 0xE3,
-    0x81, 0x11, 0xA0, 0x01, 0x08, 0x20, 0xA0, 0x03, 0x01, 0x20, 0xA0, 0x13, 0x01, 0x02, 0x51, 0xE3,
-    0x03, 0x00, 0x51, 0x31, 0x01, 0x12, 0xA0, 0x31, 0x02, 0x22, 0xA0, 0x31, 0xFA, 0xFF, 0xFF, 0x3A,
-    0x02, 0x01, 0x51, 0xE3, 0x03, 0x00, 0x51, 0x31, 0x81, 0x10, 0xA0, 0x31, 0x82, 0x20, 0xA0, 0x31,
-    0xFA, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0xA0, 0xE3, 0x01, 0x00, 0x53, 0xE1, 0x01, 0x30, 0x43, 0x20,
-    0x02, 0x00, 0x80, 0x21, 0xA1, 0x00, 0x53, 0xE1, 0xA1, 0x30, 0x43, 0x20, 0xA2, 0x00, 0x80, 0x21,
-    0x21, 0x01, 0x53, 0xE1, 0x21, 0x31, 0x43, 0x20, 0x22, 0x01, 0x80, 0x21, 0xA1, 0x01, 0x53, 0xE1,
-    0xA1, 0x31, 0x43, 0x20, 0xA2, 0x01, 0x80, 0x21, 0x00, 0x00, 0x53, 0xE3, 0x22, 0x22, 0xB0, 0x11,
-    0x21, 0x12, 0xA0, 0x11, 0xEF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x5C, 0xE3, 0x00, 0x00, 0x60, 0x42,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x3C, 0xE1, 0x00, 0x00, 0x60, 0x42, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x00, 0x00, 0xA0, 0x33, 0xCC, 0x0F, 0xA0, 0x01, 0x01, 0x00, 0x80, 0x03, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x08, 0x51, 0xE3, 0x21, 0x18, 0xA0, 0x21, 0x10, 0x20, 0xA0, 0x23, 0x00, 0x20, 0xA0, 0x33,
-    0x01, 0x0C, 0x51, 0xE3, 0x21, 0x14, 0xA0, 0x21, 0x08, 0x20, 0x82, 0x22, 0x10, 0x00, 0x51, 0xE3,
-    0x21, 0x12, 0xA0, 0x21, 0x04, 0x20, 0x82, 0x22, 0x04, 0x00, 0x51, 0xE3, 0x03, 0x20, 0x82, 0x82,
-    0xA1, 0x20, 0x82, 0x90, 0x00, 0x00, 0x5C, 0xE3, 0x33, 0x02, 0xA0, 0xE1, 0x00, 0x00, 0x60, 0x42,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x1F, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xA0, 0xE1, 0x00, 0x00, 0x50, 0xE3,
-    0x02, 0x01, 0xE0, 0xC3, 0x02, 0x01, 0xA0, 0xB3, 0x08, 0x02, 0x00, 0xEA, 0x00, 0x00, 0x51, 0xE3,
-    0xF7, 0xFF, 0xFF, 0x0A, 0x03, 0x40, 0x2D, 0xE9, 0xB1, 0xFF, 0xFF, 0xEB, 0x06, 0x40, 0xBD, 0xE8,
-    0x92, 0x00, 0x03, 0xE0, 0x03, 0x10, 0x41, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0x70, 0x47, 0xC0, 0x46,
-    0x00, 0x00, 0x53, 0xE3, 0x00, 0x00, 0x52, 0x03, 0x07, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x51, 0xE3,
-    0x02, 0x11, 0xA0, 0xB3, 0x00, 0x00, 0xA0, 0xB3, 0x02, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x50, 0x03,
-    0x02, 0x11, 0xE0, 0x13, 0x00, 0x00, 0xE0, 0x13, 0x26, 0x02, 0x00, 0xEA, 0x08, 0xD0, 0x4D, 0xE2,
-    0x00, 0x60, 0x2D, 0xE9, 0x00, 0x00, 0x51, 0xE3, 0x06, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x53, 0xE3,
-    0x11, 0x00, 0x00, 0xBA, 0x10, 0x02, 0x00, 0xEB, 0x04, 0xE0, 0x9D, 0xE5, 0x08, 0xD0, 0x8D, 0xE2,
-    0x0C, 0x00, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x70, 0xE2, 0x81, 0x10, 0xC1, 0xE0,
-    0x00, 0x00, 0x53, 0xE3, 0x11, 0x00, 0x00, 0xBA, 0x07, 0x02, 0x00, 0xEB, 0x04, 0xE0, 0x9D, 0xE5,
-    0x08, 0xD0, 0x8D, 0xE2, 0x0C, 0x00, 0xBD, 0xE8, 0x00, 0x00, 0x70, 0xE2, 0x81, 0x10, 0xC1, 0xE0,
-    0x00, 0x20, 0x72, 0xE2, 0x83, 0x30, 0xC3, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x20, 0x72, 0xE2,
-    0x83, 0x30, 0xC3, 0xE0, 0xFC, 0x01, 0x00, 0xEB, 0x04, 0xE0, 0x9D, 0xE5, 0x08, 0xD0, 0x8D, 0xE2,
-    0x0C, 0x00, 0xBD, 0xE8, 0x00, 0x00, 0x70, 0xE2, 0x81, 0x10, 0xC1, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x00, 0x20, 0x72, 0xE2, 0x83, 0x30, 0xC3, 0xE0, 0xF3, 0x01, 0x00, 0xEB, 0x04, 0xE0, 0x9D, 0xE5,
-    0x08, 0xD0, 0x8D, 0xE2, 0x0C, 0x00, 0xBD, 0xE8, 0x00, 0x20, 0x72, 0xE2, 0x83, 0x30, 0xC3, 0xE0,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0x53, 0xE3, 0x00, 0x00, 0x52, 0x03, 0x04, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x51, 0xE3, 0x00, 0x00, 0x50, 0x03, 0x00, 0x10, 0xE0, 0x13, 0x00, 0x00, 0xE0, 0x13,
-    0xF4, 0x01, 0x00, 0xEA, 0x08, 0xD0, 0x4D, 0xE2, 0x00, 0x60, 0x2D, 0xE9, 0xE2, 0x01, 0x00, 0xEB,
-    0x04, 0xE0, 0x9D, 0xE5, 0x08, 0xD0, 0x8D, 0xE2, 0x0C, 0x00, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x10, 0x40, 0x2D, 0xE9, 0x00, 0x00, 0x51, 0xE3, 0x02, 0x00, 0x00, 0x1A, 0x05, 0x00, 0x00, 0xEB,
-    0x20, 0x00, 0x80, 0xE2, 0x01, 0x00, 0x00, 0xEA, 0x01, 0x00, 0xA0, 0xE1, 0x01, 0x00, 0x00, 0xEB,
-    0x10, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x1C, 0x10, 0xA0, 0xE3, 0x01, 0x08, 0x50, 0xE3,
-    0x20, 0x08, 0xA0, 0x21, 0x10, 0x10, 0x41, 0x22, 0x01, 0x0C, 0x50, 0xE3, 0x20, 0x04, 0xA0, 0x21,
-    0x08, 0x10, 0x41, 0x22, 0x10, 0x00, 0x50, 0xE3, 0x20, 0x02, 0xA0, 0x21, 0x04, 0x10, 0x41, 0x22,
-    0x08, 0x20, 0x8F, 0xE2, 0x00, 0x00, 0xD2, 0xE7, 0x01, 0x00, 0x80, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0xB5, 0x08, 0x4C, 0x23, 0x78, 0x00, 0x2B, 0x09, 0xD1, 0x00, 0xF0, 0x07, 0xF9, 0x06, 0x4B,
-    0x00, 0x2B, 0x02, 0xD0, 0x05, 0x48, 0x00, 0xE0, 0x00, 0xBF, 0x01, 0x23, 0x23, 0x70, 0x10, 0xBC,
-    0x01, 0xBC, 0x00, 0x47, 0xE4, 0x76, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xE8, 0x00, 0x08,
-    0x70, 0xB5, 0x0E, 0x4D, 0x0E, 0x4E, 0x76, 0x1B, 0xB6, 0x10, 0x06, 0xD0, 0x00, 0x24, 0x08, 0xCD,
-    0x01, 0x34, 0x00, 0xF0, 0x1B, 0xF8, 0xA6, 0x42, 0xF9, 0xD1, 0xF3, 0xF7, 0xE5, 0xF9, 0x09, 0x4D,
-    0x09, 0x4E, 0x76, 0x1B, 0xB6, 0x10, 0x06, 0xD0, 0x00, 0x24, 0x08, 0xCD, 0x01, 0x34, 0x00, 0xF0,
-    0x0D, 0xF8, 0xA6, 0x42, 0xF9, 0xD1, 0x70, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0x68, 0x76, 0x00, 0x03,
-    0x68, 0x76, 0x00, 0x03, 0x68, 0x76, 0x00, 0x03, 0x6C, 0x76, 0x00, 0x03, 0x18, 0x47, 0xC0, 0x46,
-    0xF0, 0xB5, 0x57, 0x46, 0x4E, 0x46, 0x45, 0x46, 0xDE, 0x46, 0xE0, 0xB5, 0x04, 0x00, 0x0D, 0x00,
-    0x92, 0x46, 0x99, 0x46, 0x83, 0xB0, 0x8B, 0x42, 0x30, 0xD8, 0x2D, 0xD0, 0x49, 0x46, 0x50, 0x46,
-    0x00, 0xF0, 0x9A, 0xFB, 0x29, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0xF0, 0x95, 0xFB, 0x33, 0x1A,
-    0x98, 0x46, 0x20, 0x3B, 0x9B, 0x46, 0x35, 0xD4, 0x5A, 0x46, 0x53, 0x46, 0x93, 0x40, 0x42, 0x46,
-    0x1F, 0x00, 0x53, 0x46, 0x93, 0x40, 0x1E, 0x00, 0xAF, 0x42, 0x3C, 0xD8, 0xAF, 0x42, 0x00, 0xD1,
-    0x7A, 0xE0, 0x5B, 0x46, 0xA4, 0x1B, 0xBD, 0x41, 0x00, 0x2B, 0x00, 0xDA, 0x77, 0xE0, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x92, 0x01, 0x93, 0x01, 0x23, 0x5A, 0x46, 0x93, 0x40, 0x01, 0x93, 0x01, 0x23,
-    0x42, 0x46, 0x93, 0x40, 0x00, 0x93, 0x2A, 0xE0, 0x82, 0x42, 0xCF, 0xD9, 0x00, 0x22, 0x00, 0x23,
-    0x00, 0x92, 0x01, 0x93, 0x0C, 0x9B, 0x00, 0x2B, 0x01, 0xD0, 0x1C, 0x60, 0x5D, 0x60, 0x00, 0x98,
-    0x01, 0x99, 0x03, 0xB0, 0x3C, 0xBC, 0x90, 0x46, 0x99, 0x46, 0xA2, 0x46, 0xAB, 0x46, 0xF0, 0xBC,
-    0x04, 0xBC, 0x10, 0x47, 0x42, 0x46, 0x20, 0x23, 0x9B, 0x1A, 0x52, 0x46, 0xDA, 0x40, 0x41, 0x46,
-    0x13, 0x00, 0x4A, 0x46, 0x8A, 0x40, 0x17, 0x00, 0x42, 0x46, 0x1F, 0x43, 0x53, 0x46, 0x93, 0x40,
-    0x1E, 0x00, 0xAF, 0x42, 0xC2, 0xD9, 0x00, 0x22, 0x00, 0x23, 0x00, 0x92, 0x01, 0x93, 0x43, 0x46,
-    0x00, 0x2B, 0xD7, 0xD0, 0xFB, 0x07, 0x72, 0x08, 0x1A, 0x43, 0x46, 0x46, 0x7B, 0x08, 0x0E, 0xE0,
-    0xAB, 0x42, 0x01, 0xD1, 0xA2, 0x42, 0x0C, 0xD8, 0xA4, 0x1A, 0x9D, 0x41, 0x01, 0x20, 0x24, 0x19,
-    0x6D, 0x41, 0x00, 0x21, 0x01, 0x3E, 0x24, 0x18, 0x4D, 0x41, 0x00, 0x2E, 0x06, 0xD0, 0xAB, 0x42,
-    0xEE, 0xD9, 0x01, 0x3E, 0x24, 0x19, 0x6D, 0x41, 0x00, 0x2E, 0xF8, 0xD1, 0x5B, 0x46, 0x00, 0x98,
-    0x01, 0x99, 0x00, 0x19, 0x69, 0x41, 0x00, 0x2B, 0x24, 0xDB, 0x2B, 0x00, 0x5A, 0x46, 0x44, 0x46,
-    0xD3, 0x40, 0x2A, 0x00, 0xE2, 0x40, 0x1C, 0x00, 0x5B, 0x46, 0x15, 0x00, 0x00, 0x2B, 0x2A, 0xDB,
-    0x26, 0x00, 0x9E, 0x40, 0x33, 0x00, 0x26, 0x00, 0x47, 0x46, 0xBE, 0x40, 0x32, 0x00, 0x80, 0x1A,
-    0x99, 0x41, 0x00, 0x90, 0x01, 0x91, 0x9D, 0xE7, 0xA3, 0x42, 0xBC, 0xD8, 0x81, 0xE7, 0x42, 0x46,
-    0x20, 0x23, 0x00, 0x21, 0x9B, 0x1A, 0x00, 0x22, 0x00, 0x91, 0x01, 0x92, 0x01, 0x22, 0xDA, 0x40,
-    0x01, 0x92, 0x84, 0xE7, 0x42, 0x46, 0x20, 0x23, 0x9B, 0x1A, 0x2A, 0x00, 0x46, 0x46, 0x9A, 0x40,
-    0x23, 0x00, 0xF3, 0x40, 0x44, 0x46, 0x13, 0x43, 0x2A, 0x00, 0xE2, 0x40, 0x1C, 0x00, 0x5B, 0x46,
-    0x15, 0x00, 0x00, 0x2B, 0xD4, 0xDA, 0x42, 0x46, 0x2F, 0x00, 0x20, 0x23, 0x26, 0x00, 0x97, 0x40,
-    0x9B, 0x1A, 0xDE, 0x40, 0x3B, 0x00, 0x33, 0x43, 0xCD, 0xE7, 0xC0, 0x46, 0x06, 0x48, 0x07, 0x4B,
-    0x10, 0xB5, 0x83, 0x42, 0x04, 0xD0, 0x06, 0x4B, 0x00, 0x2B, 0x01, 0xD0, 0x00, 0xF0, 0x0A, 0xF8,
-    0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46, 0x68, 0x76, 0x00, 0x03, 0x68, 0x76, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x47, 0xC0, 0x46, 0x06, 0x4B, 0x10, 0xB5, 0x00, 0x2B, 0x03, 0xD0,
-    0x05, 0x49, 0x06, 0x48, 0x00, 0xE0, 0x00, 0xBF, 0x00, 0xF0, 0x70, 0xF9, 0x10, 0xBC, 0x01, 0xBC,
-    0x00, 0x47, 0xC0, 0x46, 0x00, 0x00, 0x00, 0x00, 0x54, 0x7C, 0x00, 0x03, 0x6C, 0xE8, 0x00, 0x08,
-    0x70, 0xB5, 0x0E, 0x06, 0x34, 0x0E, 0x83, 0x07, 0x0F, 0xD0, 0x53, 0x1E, 0x00, 0x2A, 0x11, 0xD0,
-    0x03, 0x25, 0x04, 0xE0, 0x01, 0x30, 0x28, 0x42, 0x08, 0xD0, 0x01, 0x3B, 0x0A, 0xD3, 0x02, 0x78,
-    0xA2, 0x42, 0xF7, 0xD1, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x13, 0x00, 0x03, 0x2B, 0x0C, 0xD8,
-    0x00, 0x2B, 0x01, 0xD1, 0x00, 0x20, 0xF5, 0xE7, 0xC3, 0x18, 0x02, 0xE0, 0x01, 0x30, 0x83, 0x42,
-    0xF8, 0xD0, 0x02, 0x78, 0xA2, 0x42, 0xF9, 0xD1, 0xEC, 0xE7, 0xFF, 0x22, 0x36, 0x0C, 0x11, 0x40,
-    0x0E, 0x43, 0x31, 0x04, 0x06, 0x4D, 0x0E, 0x43, 0x02, 0x68, 0x06, 0x49, 0x72, 0x40, 0x51, 0x18,
-    0x91, 0x43, 0x29, 0x42, 0xE8, 0xD1, 0x04, 0x3B, 0x04, 0x30, 0x03, 0x2B, 0xF4, 0xD8, 0xDF, 0xE7,
-    0x80, 0x80, 0x80, 0x80, 0xFF, 0xFE, 0xFE, 0xFE, 0x30, 0xB5, 0x03, 0x2A, 0x0C, 0xD9, 0x03, 0x00,
-    0x0B, 0x43, 0x9B, 0x07, 0x1B, 0xD1, 0x03, 0x68, 0x0C, 0x68, 0xA3, 0x42, 0x17, 0xD1, 0x04, 0x3A,
-    0x04, 0x30, 0x04, 0x31, 0x03, 0x2A, 0xF6, 0xD8, 0x55, 0x1E, 0x00, 0x2A, 0x0B, 0xD0, 0x00, 0x23,
-    0x03, 0xE0, 0x5A, 0x1C, 0x9D, 0x42, 0x06, 0xD0, 0x13, 0x00, 0xC2, 0x5C, 0xCC, 0x5C, 0xA2, 0x42,
-    0xF7, 0xD0, 0x10, 0x1B, 0x00, 0xE0, 0x00, 0x20, 0x30, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x55, 0x1E,
-    0xED, 0xE7, 0xC0, 0x46, 0xF0, 0xB5, 0xC6, 0x46, 0x00, 0xB5, 0x0F, 0x2A, 0x43, 0xD9, 0x03, 0x27,
-    0x0D, 0x00, 0x3E, 0x00, 0x05, 0x43, 0x0C, 0x00, 0x03, 0x00, 0x2E, 0x40, 0x2F, 0x42, 0x3F, 0xD1,
-    0x15, 0x00, 0x10, 0x3D, 0x2D, 0x09, 0xAC, 0x46, 0x2D, 0x01, 0xA8, 0x46, 0x80, 0x44, 0x25, 0x68,
-    0x67, 0x68, 0x1D, 0x60, 0x5F, 0x60, 0xA5, 0x68, 0xE7, 0x68, 0x9D, 0x60, 0xDF, 0x60, 0x10, 0x34,
-    0x1F, 0x00, 0x10, 0x33, 0x47, 0x45, 0xF2, 0xD1, 0x65, 0x46, 0x0F, 0x23, 0x0C, 0x24, 0x01, 0x35,
-    0x2D, 0x01, 0x49, 0x19, 0x13, 0x40, 0x45, 0x19, 0x14, 0x42, 0x24, 0xD0, 0x8C, 0x59, 0xAC, 0x51,
-    0x04, 0x36, 0x9C, 0x1B, 0x03, 0x2C, 0xF9, 0xD8, 0x03, 0x24, 0x04, 0x3B, 0x9B, 0x08, 0x01, 0x33,
-    0x9B, 0x00, 0x22, 0x40, 0xED, 0x18, 0xC9, 0x18, 0x56, 0x1E, 0x00, 0x2A, 0x06, 0xD0, 0x00, 0x23,
-    0xCC, 0x5C, 0x1A, 0x00, 0xEC, 0x54, 0x01, 0x33, 0x96, 0x42, 0xF9, 0xD1, 0x04, 0xBC, 0x90, 0x46,
-    0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x05, 0x00, 0x56, 0x1E, 0x00, 0x2A, 0xEF, 0xD1, 0xF5, 0xE7,
-    0x05, 0x00, 0x56, 0x1E, 0xEB, 0xE7, 0x1A, 0x00, 0xF6, 0xE7, 0xC0, 0x46, 0xF0, 0xB5, 0x88, 0x42,
-    0x0C, 0xD9, 0x8B, 0x18, 0x98, 0x42, 0x09, 0xD2, 0x53, 0x1E, 0x00, 0x2A, 0x03, 0xD0, 0xCA, 0x5C,
-    0xC2, 0x54, 0x01, 0x3B, 0xFB, 0xD2, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x0F, 0x2A, 0x0B, 0xD8,
-    0x05, 0x00, 0x56, 0x1E, 0x00, 0x2A, 0xF6, 0xD0, 0x00, 0x23, 0xCC, 0x5C, 0x1A, 0x00, 0xEC, 0x54,
-    0x01, 0x33, 0x96, 0x42, 0xF9, 0xD1, 0xEE, 0xE7, 0x03, 0x27, 0x0D, 0x00, 0x3E, 0x00, 0x05, 0x43,
-    0x0C, 0x00, 0x03, 0x00, 0x2E, 0x40, 0x2F, 0x42, 0x2B, 0xD1, 0x15, 0x00, 0x10, 0x3D, 0x2D, 0x09,
-    0xAC, 0x46, 0x2D, 0x01, 0x2D, 0x18, 0x27, 0x68, 0x1F, 0x60, 0x67, 0x68, 0x5F, 0x60, 0xA7, 0x68,
-    0x9F, 0x60, 0xE7, 0x68, 0x10, 0x34, 0xDF, 0x60, 0x1F, 0x00, 0x10, 0x33, 0xAF, 0x42, 0xF2, 0xD1,
-    0x65, 0x46, 0x0F, 0x23, 0x0C, 0x24, 0x01, 0x35, 0x2D, 0x01, 0x49, 0x19, 0x13, 0x40, 0x45, 0x19,
-    0x14, 0x42, 0x11, 0xD0, 0x8C, 0x59, 0xAC, 0x51, 0x04, 0x36, 0x9C, 0x1B, 0x03, 0x2C, 0xF9, 0xD8,
-    0x03, 0x24, 0x04, 0x3B, 0x9B, 0x08, 0x01, 0x33, 0x9B, 0x00, 0xED, 0x18, 0xC9, 0x18, 0x22, 0x40,
-    0xBF, 0xE7, 0x05, 0x00, 0x56, 0x1E, 0xBF, 0xE7, 0x1A, 0x00, 0xBA, 0xE7, 0xF0, 0xB5, 0x05, 0x00,
-    0x83, 0x07, 0x4E, 0xD0, 0x54, 0x1E, 0x00, 0x2A, 0x46, 0xD0, 0x0A, 0x06, 0x03, 0x00, 0x03, 0x26,
-    0x12, 0x0E, 0x02, 0xE0, 0x01, 0x35, 0x01, 0x3C, 0x3E, 0xD3, 0x01, 0x33, 0x2A, 0x70, 0x33, 0x42,
-    0xF8, 0xD1, 0x03, 0x2C, 0x2F, 0xD9, 0xFF, 0x22, 0x0A, 0x40, 0x15, 0x02, 0x15, 0x43, 0x2A, 0x04,
-    0x15, 0x43, 0x0F, 0x2C, 0x38, 0xD9, 0x27, 0x00, 0x10, 0x3F, 0x3F, 0x09, 0x3E, 0x01, 0xB4, 0x46,
-    0x1E, 0x00, 0x1A, 0x00, 0x10, 0x36, 0x66, 0x44, 0x15, 0x60, 0x55, 0x60, 0x95, 0x60, 0xD5, 0x60,
-    0x10, 0x32, 0xB2, 0x42, 0xF8, 0xD1, 0x0F, 0x26, 0x0C, 0x22, 0x01, 0x37, 0x3F, 0x01, 0x26, 0x40,
-    0xDB, 0x19, 0x37, 0x00, 0x22, 0x42, 0x1A, 0xD0, 0x3E, 0x1F, 0xB6, 0x08, 0xB4, 0x00, 0xA4, 0x46,
-    0x1A, 0x00, 0x1C, 0x1D, 0x64, 0x44, 0x20, 0xC2, 0xA2, 0x42, 0xFC, 0xD1, 0x03, 0x24, 0x01, 0x36,
-    0xB6, 0x00, 0x9B, 0x19, 0x3C, 0x40, 0x00, 0x2C, 0x06, 0xD0, 0x09, 0x06, 0x1C, 0x19, 0x09, 0x0E,
-    0x19, 0x70, 0x01, 0x33, 0x9C, 0x42, 0xFB, 0xD1, 0xF0, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x34, 0x00,
-    0xF1, 0xE7, 0x14, 0x00, 0x03, 0x00, 0xBC, 0xE7, 0x27, 0x00, 0xDD, 0xE7, 0x08, 0x48, 0x09, 0x49,
-    0x09, 0x1A, 0x8B, 0x10, 0xC9, 0x0F, 0xC9, 0x18, 0x10, 0xB5, 0x49, 0x10, 0x04, 0xD0, 0x06, 0x4B,
-    0x00, 0x2B, 0x01, 0xD0, 0x00, 0xF0, 0x0A, 0xF8, 0x10, 0xBC, 0x01, 0xBC, 0x00, 0x47, 0xC0, 0x46,
-    0x68, 0x76, 0x00, 0x03, 0x68, 0x76, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x47, 0xC0, 0x46,
-    0x0B, 0x48, 0x0C, 0x4A, 0x0C, 0x4B, 0x12, 0x1A, 0x10, 0xB5, 0x9A, 0x63, 0x80, 0x22, 0x0B, 0x49,
-    0xD8, 0x60, 0x19, 0x63, 0x12, 0x05, 0x91, 0x42, 0x04, 0xD2, 0x5A, 0x6B, 0x00, 0x2A, 0x01, 0xD0,
-    0x07, 0x4A, 0x1A, 0x63, 0xF4, 0xF7, 0x1C, 0xFD, 0x00, 0x20, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47,
-    0xE0, 0x00, 0x00, 0x02, 0x8C, 0xB9, 0x03, 0x02, 0x3C, 0x00, 0x00, 0x02, 0x78, 0x46, 0x01, 0x08,
-    0x78, 0x46, 0x01, 0x0E, 0x70, 0xB5, 0x04, 0x00, 0x83, 0x07, 0x17, 0xD1, 0x02, 0x68, 0x10, 0x4B,
-    0xD3, 0x18, 0x93, 0x43, 0x0F, 0x4A, 0x15, 0x00, 0x13, 0x42, 0x0F, 0xD1, 0x42, 0x68, 0x0C, 0x4B,
-    0xD3, 0x18, 0x93, 0x43, 0x04, 0x30, 0x2B, 0x42, 0x08, 0xD1, 0x42, 0x68, 0x08, 0x4B, 0xD3, 0x18,
-    0x93, 0x43, 0x04, 0x30, 0x2B, 0x42, 0xF1, 0xD0, 0x00, 0xE0, 0x01, 0x30, 0x03, 0x78, 0x00, 0x2B,
-    0xFB, 0xD1, 0x00, 0xF0, 0x09, 0xF8, 0x20, 0x00, 0x70, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0xC0, 0x46,
-    0xFF, 0xFE, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x0A, 0x78, 0x01, 0x31, 0x1A, 0x70,
-    0x01, 0x33, 0x00, 0x2A, 0xF9, 0xD1, 0x70, 0x47, 0x10, 0xB5, 0x83, 0x07, 0x0C, 0xD0, 0x03, 0x00,
-    0x03, 0x21, 0x02, 0xE0, 0x01, 0x33, 0x0B, 0x42, 0x07, 0xD0, 0x1A, 0x78, 0x00, 0x2A, 0xF9, 0xD1,
-    0x18, 0x1A, 0x10, 0xBC, 0x02, 0xBC, 0x08, 0x47, 0x03, 0x00, 0x19, 0x68, 0x0C, 0x4A, 0x0D, 0x4C,
-    0x8A, 0x18, 0x8A, 0x43, 0x22, 0x42, 0x0F, 0xD1, 0x59, 0x68, 0x09, 0x4A, 0x8A, 0x18, 0x8A, 0x43,
-    0x04, 0x33, 0x22, 0x42, 0x08, 0xD1, 0x59, 0x68, 0x05, 0x4A, 0x8A, 0x18, 0x8A, 0x43, 0x04, 0x33,
-    0x22, 0x42, 0xF1, 0xD0, 0x00, 0xE0, 0x01, 0x33, 0x1A, 0x78, 0x00, 0x2A, 0xFB, 0xD1, 0xDF, 0xE7,
-    0xFF, 0xFE, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x78, 0x47, 0xC0, 0x46, 0x7B, 0xEE, 0xFF, 0xEA,
-    0x00, 0xC0, 0x9F, 0xE5, 0x1C, 0xFF, 0x2F, 0xE1, 0x7D, 0xCC, 0x00, 0x08, 0x78, 0x47, 0xC0, 0x46,
-    0x93, 0xF0, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0x26, 0xE5, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5,
-    0xF8, 0x6C, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46, 0x43, 0xE4, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46,
-    0x62, 0xE5, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0xA0, 0x66, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46,
-    0xD5, 0xE4, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0xB4, 0x4A, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46,
-    0x04, 0xF0, 0x1F, 0xE5, 0x24, 0x51, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46, 0x04, 0xF0, 0x1F, 0xE5,
-    0x6C, 0x52, 0x00, 0x03, 0x04, 0xF0, 0x1F, 0xE5, 0xC0, 0x51, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46,
-    0x12, 0xE7, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0x96, 0xE4, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46,
-    0xF1, 0xE4, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0x96, 0xE3, 0xFF, 0xEA, 0x00, 0xC0, 0x9F, 0xE5,
-    0x1C, 0xFF, 0x2F, 0xE1, 0x81, 0xCE, 0x00, 0x08, 0x04, 0xF0, 0x1F, 0xE5, 0x54, 0x48, 0x00, 0x03,
-    0x04, 0xF0, 0x1F, 0xE5, 0x6C, 0x4A, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46, 0x13, 0xE5, 0xFF, 0xEA,
-    0x04, 0xF0, 0x1F, 0xE5, 0xF8, 0x38, 0x00, 0x06, 0x78, 0x47, 0xC0, 0x46, 0xA7, 0xE2, 0xFF, 0xEA,
-    0x78, 0x47, 0xC0, 0x46, 0xB8, 0xE4, 0xFF, 0xEA, 0x00, 0xC0, 0x9F, 0xE5, 0x1C, 0xFF, 0x2F, 0xE1,
-    0x7D, 0xCC, 0x00, 0x08, 0x78, 0x47, 0xC0, 0x46, 0x80, 0xEE, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5,
-    0xD4, 0x38, 0x00, 0x06, 0x78, 0x47, 0xC0, 0x46, 0x04, 0xF0, 0x1F, 0xE5, 0x88, 0x39, 0x00, 0x06,
-    0x78, 0x47, 0xC0, 0x46, 0xB8, 0xFD, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0x2C, 0x67, 0x00, 0x03,
-    0x04, 0xF0, 0x1F, 0xE5, 0xBC, 0x52, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46, 0xF0, 0xFD, 0xFF, 0xEA,
-    0x04, 0xF0, 0x1F, 0xE5, 0x58, 0x48, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46, 0x56, 0xE4, 0xFF, 0xEA,
-    0x78, 0x47, 0xC0, 0x46, 0x60, 0xFD, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0x56, 0xFD, 0xFF, 0xEA,
-    0x04, 0xF0, 0x1F, 0xE5, 0x8C, 0x38, 0x00, 0x06, 0x78, 0x47, 0xC0, 0x46, 0x9D, 0xEE, 0xFF, 0xEA,
-    0x78, 0x47, 0xC0, 0x46, 0xE7, 0xE2, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0xFA, 0xE6, 0xFF, 0xEA,
-    0x78, 0x47, 0xC0, 0x46, 0xF0, 0xEF, 0xFF, 0xEA, 0x78, 0x47, 0xC0, 0x46, 0xEB, 0xFD, 0xFF, 0xEA,
-    0x78, 0x47, 0xC0, 0x46, 0x09, 0xFD, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0x14, 0x68, 0x00, 0x03,
-    0x78, 0x47, 0xC0, 0x46, 0x9C, 0xE5, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0xAC, 0x67, 0x00, 0x03,
-    0x04, 0xF0, 0x1F, 0xE5, 0x6C, 0x38, 0x00, 0x06, 0x04, 0xF0, 0x1F, 0xE5, 0x18, 0x6C, 0x00, 0x03,
-    0x78, 0x47, 0xC0, 0x46, 0x9E, 0xEE, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0x88, 0x44, 0x00, 0x03,
-    0x78, 0x47, 0xC0, 0x46, 0x04, 0xF0, 0x1F, 0xE5, 0x20, 0x52, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46,
-    0x47, 0xF0, 0xFF, 0xEA, 0x04, 0xF0, 0x1F, 0xE5, 0x08, 0x4B, 0x00, 0x03, 0x78, 0x47, 0xC0, 0x46,
-    0x04, 0xF0, 0x1F, 0xE5, 0xC0, 0x51, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x0A, 0x00, 0x30, 0x00, 0x00, 0xF0,
-    0x01, 0xA0, 0x01, 0x60, 0x01, 0x00, 0x00, 0x40, 0x80, 0x30, 0x03, 0x77, 0x77, 0x77, 0x14, 0x11,
-    0x61, 0x0D, 0x11, 0x11, 0x00, 0x50, 0x00, 0x0F, 0x10, 0x03, 0x10, 0x00, 0x03, 0x82, 0xA0, 0x2B,
-    0x26, 0x00, 0x00, 0x70, 0x27, 0x00, 0x17, 0x15, 0xB7, 0x00, 0x1F, 0x13, 0xE0, 0x1F, 0x20, 0x3F,
-    0x11, 0x00, 0x3F, 0xF0, 0x66, 0xB0, 0x01, 0x4D, 0x50, 0x00, 0x3F, 0x40, 0x14, 0x00, 0x3F, 0x20,
-    0x2A, 0x88, 0x00, 0x7C, 0x40, 0x38, 0x00, 0x06, 0x23, 0x00, 0x70, 0x37, 0x01, 0x00, 0x00, 0x66,
-    0x13, 0x00, 0x50, 0x35, 0x01, 0x00, 0x55, 0x80, 0x50, 0x5E, 0x88, 0x18, 0x00, 0x80, 0x11, 0x88,
-    0x01, 0x00, 0x88, 0x01, 0x81, 0x18, 0x77, 0x01, 0x70, 0x17, 0x00, 0x66, 0x01, 0x60, 0x16, 0x51,
-    0x15, 0x50, 0x14, 0x30, 0x10, 0x55, 0x00, 0x24, 0x10, 0x6A, 0x60, 0x18, 0x00, 0x00, 0x52, 0x86,
-    0x00, 0x03, 0x80, 0x00, 0x03, 0x70, 0x17, 0x00, 0x0F, 0x16, 0xE0, 0x30, 0x5F, 0x10, 0x03, 0x00,
-    0x5F, 0x80, 0x88, 0x68, 0x00, 0x48, 0x10, 0x11, 0x84, 0x16, 0x00, 0x09, 0x16, 0x00, 0x40, 0x47,
-    0x01, 0x12, 0x40, 0x46, 0x12, 0x01, 0x54, 0x13, 0x00, 0x5F, 0x10, 0x55, 0x55, 0x15, 0x10, 0xAB,
-    0x80, 0x88, 0x88, 0x16, 0x08, 0x10, 0x21, 0x68, 0x01, 0x20, 0x3F, 0x77, 0x77, 0x01, 0x00, 0x00,
-    0x10, 0x62, 0x12, 0x35, 0x00, 0x53, 0x14, 0x01, 0x51, 0x55, 0x45, 0x12, 0x10, 0x11, 0x11, 0x00,
-    0x81, 0x60, 0x88, 0x00, 0x1B, 0x00, 0x03, 0x48, 0x88, 0x01, 0x70, 0x13, 0x02, 0x77, 0x01, 0x36,
-    0x01, 0x66, 0x01, 0x30, 0x3B, 0x55, 0x80, 0x00, 0x7C, 0x11, 0x01, 0x86, 0x88, 0x88, 0x01, 0x86,
-    0xA0, 0x00, 0x27, 0x88, 0x00, 0x67, 0x47, 0x12, 0x73, 0x14, 0x11, 0x88, 0x00, 0x9F, 0x35, 0x00,
-    0x50, 0x70, 0x3F, 0x86, 0x88, 0x01, 0x10, 0x80, 0x48, 0x11, 0x00, 0x06, 0x68, 0x00, 0x77, 0x13,
-    0x00, 0x72, 0x14, 0x46, 0x01, 0x40, 0x16, 0x54, 0x03, 0x02, 0x50, 0x14, 0x41, 0x55, 0x45, 0x11,
-    0x10, 0x1F, 0x88, 0x02, 0x88, 0x88, 0x18, 0x11, 0x11, 0x82, 0x00, 0x7C, 0x88, 0x1D, 0x14, 0x00,
-    0x40, 0x00, 0xFF, 0x11, 0x63, 0x80, 0xBF, 0x60, 0x00, 0x37, 0x00, 0x86, 0x14, 0x82, 0x06, 0x86,
-    0x02, 0x80, 0x16, 0x00, 0x40, 0x77, 0x47, 0x11, 0x66, 0x12, 0x61, 0x06, 0x01, 0x55, 0x03, 0x50,
-    0x15, 0x51, 0x55, 0x55, 0x20, 0x3F, 0x80, 0x50, 0x1F, 0x68, 0x01, 0x60, 0x18, 0x74, 0x13, 0x70,
-    0x00, 0x17, 0x40, 0x66, 0x66, 0x14, 0x00, 0x31, 0x55, 0x07, 0x13, 0x50, 0x55, 0x24, 0x01, 0x00,
-    0x1F, 0x31, 0x6F, 0x10, 0xDB, 0xFE, 0x11, 0x17, 0x11, 0x6F, 0x10, 0x07, 0x71, 0x7B, 0x00, 0x1A,
-    0x00, 0x9F, 0x00, 0x03, 0x60, 0x38, 0x16, 0x66, 0x11, 0x4F, 0xC1, 0xF0, 0x21, 0x9E, 0x02, 0x00,
-    0x80, 0x30, 0x48, 0x01, 0x10, 0x9E, 0x11, 0x9E, 0x10, 0x66, 0x02, 0x00, 0x17, 0x00, 0x51, 0x25,
-    0x00, 0x3F, 0x55, 0x00, 0x08, 0x70, 0x2F, 0x00, 0xC7, 0x59, 0x16, 0x11, 0x4F, 0x66, 0x00, 0x7F,
-    0x92, 0x03, 0x80, 0x28, 0x00, 0x2A, 0x90, 0x00, 0x42, 0x00, 0x81, 0x10, 0x08, 0x77, 0x02, 0x00,
-    0x60, 0x69, 0x36, 0x21, 0xDC, 0x11, 0xE3, 0x20, 0x10, 0x25, 0x88, 0x88, 0x00, 0x5E, 0x08, 0x81,
-    0x08, 0x80, 0x18, 0x00, 0xA4, 0x11, 0x77, 0x13, 0xAE, 0x20, 0x1F, 0x00, 0x00, 0x18, 0x50, 0x00,
-    0x63, 0x10, 0x07, 0x10, 0x01, 0x18, 0x20, 0x80, 0x01, 0x01, 0xA7, 0x18, 0x10, 0x17, 0x71, 0x11,
-    0x04, 0x00, 0x16, 0x60, 0x01, 0x50, 0x01, 0x7F, 0x10, 0x15, 0x00, 0x51, 0x11, 0x00, 0x11, 0x10,
-    0x01, 0x40, 0x88, 0x00, 0x48, 0x01, 0x80, 0x46, 0x86, 0x01, 0x80, 0x14, 0x01, 0x84, 0x02, 0x74,
-    0x02, 0x72, 0x14, 0x64, 0x00, 0x7F, 0x00, 0x55, 0x11, 0x51, 0x15, 0x45, 0x01, 0x40, 0x15, 0x6E,
-    0x11, 0x01, 0x01, 0x11, 0x97, 0x88, 0x01, 0xFF, 0x10, 0xE5, 0x02, 0x9F, 0x12, 0x00, 0x66, 0x11,
-    0x61, 0x16, 0x55, 0x01, 0x52, 0x14, 0x70, 0x55, 0x01, 0x9F, 0x00, 0xA6, 0x00, 0x3F, 0x88, 0x02,
-    0x84, 0x28, 0x0E, 0x41, 0x28, 0x88, 0x12, 0x00, 0x9D, 0x00, 0x79, 0x10, 0xDE, 0x53, 0x01, 0x15,
-    0x30, 0x25, 0x31, 0x55, 0x55, 0x13, 0x31, 0x9F, 0x02, 0x46, 0x00, 0x88, 0x21, 0x88, 0x04, 0x92,
-    0x7F, 0x55, 0x01, 0x21, 0x55, 0x13, 0x55, 0x55, 0x34, 0x01, 0x10, 0xE6, 0xB8, 0x11, 0xBF, 0x88,
-    0x00, 0x08, 0x02, 0x21, 0x02, 0x3E, 0x47, 0x01, 0x66, 0xB7, 0x00, 0x33, 0x55, 0x00, 0x0B, 0x02,
-    0x23, 0x05, 0x11, 0x07, 0xF0, 0x1F, 0x40, 0x1F, 0xE0, 0x10, 0xE5, 0x00, 0x03, 0xB0, 0x7F, 0x77,
-    0x17, 0x66, 0x02, 0x61, 0x07, 0x16, 0x53, 0x15, 0x50, 0x15, 0x60, 0x7F, 0x21, 0x9D, 0x30, 0x03,
-    0xA0, 0x00, 0xBF, 0x17, 0x30, 0xBF, 0x50, 0x15, 0x55, 0x01, 0x40, 0xFC, 0x02, 0x6B, 0x12, 0xE0,
-    0x42, 0xFB, 0xD2, 0xFF, 0x61, 0xE3, 0x03, 0x40, 0x00, 0x84, 0xCC, 0x60, 0x20, 0x20, 0xBF, 0x04,
-    0x54, 0x12, 0x9F, 0x32, 0x7F, 0x01, 0x80, 0x81, 0x00, 0xDB, 0x68, 0x01, 0x88, 0x81, 0x16, 0x00,
-    0x00, 0x9E, 0x00, 0x00, 0x66, 0x61, 0x24, 0x00, 0x55, 0x11, 0x45, 0x07, 0x02, 0x44, 0x01, 0x51,
-    0x24, 0x21, 0x3F, 0x33, 0x01, 0x20, 0x03, 0xF0, 0x21, 0x1F, 0x40, 0xBB, 0x00, 0xDF, 0x21, 0xE7,
-    0x48, 0x01, 0x40, 0x18, 0x00, 0x88, 0x14, 0x84, 0x18, 0x88, 0x68, 0x88, 0x18, 0x00, 0x77, 0x74,
-    0x74, 0x17, 0x46, 0x62, 0x42, 0x16, 0x1C, 0x45, 0x11, 0x41, 0x11, 0x7F, 0x20, 0x9F, 0x01, 0xDD,
-    0x18, 0x88, 0x95, 0x01, 0xDD, 0x88, 0x86, 0x00, 0xBF, 0x42, 0x10, 0xBF, 0x64, 0x00, 0xBF, 0x40,
-    0x51, 0x40, 0xBF, 0x00, 0x11, 0x62, 0x88, 0x68, 0x02, 0x18, 0x86, 0x12, 0x82, 0x01, 0x9F, 0x71,
-    0x5F, 0x54, 0x12, 0x52, 0x30, 0x14, 0x42, 0x43, 0x3F, 0x01, 0x3F, 0x04, 0x88, 0x11, 0x81, 0xB0,
-    0x50, 0xFF, 0x13, 0xD1, 0x3F, 0xE0, 0x3F, 0x51, 0x62, 0x14, 0x54, 0x01, 0x12, 0x55, 0x12, 0x42,
-    0x55, 0x24, 0x15, 0xF0, 0x3F, 0xA6, 0x10, 0x3F, 0x64, 0x00, 0x3F, 0x51, 0x14, 0x01, 0x43, 0x20,
-    0x9F, 0x84, 0x88, 0x02, 0x7F, 0x88, 0x12, 0x41, 0x00, 0x1F, 0x00, 0x11, 0x73, 0x00, 0x77, 0x77,
-    0x03, 0x10, 0x11, 0x62, 0x16, 0x45, 0xCF, 0x33, 0x5F, 0x41, 0xFF, 0x88, 0x68, 0x00, 0x3E, 0x31,
-    0x67, 0xF4, 0x5F, 0x01, 0x17, 0x73, 0x60, 0x22, 0x5B, 0x20, 0x5F, 0x50, 0xBF, 0x13, 0x53, 0x13,
-    0xDF, 0x20, 0xBF, 0x58, 0x48, 0x03, 0x97, 0x68, 0x00, 0x1B, 0x12, 0xA1, 0x71, 0x14, 0x77, 0x85,
-    0x03, 0xFD, 0x36, 0x01, 0x10, 0x55, 0x00, 0x3B, 0x54, 0x04, 0xE0, 0xE0, 0x00, 0xC0, 0x13, 0xB7,
-    0x20, 0x03, 0x81, 0x60, 0x18, 0x47, 0x47, 0x08, 0x47, 0x17, 0x66, 0x26, 0x01, 0x1F, 0x12, 0x41,
-    0x15, 0x08, 0x25, 0x01, 0x10, 0x14, 0x14, 0x60, 0x68, 0x00, 0x00, 0x01, 0x68, 0x81, 0x06, 0x80,
-    0x16, 0x10, 0x68, 0x04, 0xA3, 0x48, 0x71, 0x01, 0xD3, 0x46, 0x46, 0x14, 0x5D, 0x04, 0x45, 0x01,
-    0x14, 0x10, 0x45, 0x12, 0x00, 0x1F, 0x86, 0x01, 0xD8, 0x61, 0x08, 0x00, 0x00, 0x48, 0x10, 0x86,
-    0x84, 0x14, 0x00, 0x71, 0xE8, 0x14, 0x3F, 0xC0, 0x9F, 0x23, 0x97, 0x68, 0x14, 0xFE, 0x01, 0x00,
-    0x47, 0x86, 0x04, 0x4F, 0x14, 0x01, 0x00, 0x45, 0x00, 0x58, 0x54, 0xFF, 0x00, 0x52, 0x88, 0x00,
-    0x57, 0x68, 0x20, 0x88, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x5F, 0x46, 0x00, 0x03, 0x45, 0x11, 0x60,
-    0x00, 0x04, 0x14, 0x0F, 0x06, 0x17, 0x03, 0x7B, 0x00, 0x00, 0x48, 0x81, 0x41, 0x18, 0x70, 0x74,
-    0x12, 0x00, 0x11, 0x00, 0x62, 0x64, 0x00, 0x35, 0x51, 0x31, 0x8D, 0x11, 0x1F, 0x12, 0x10, 0x51,
-    0x00, 0x1F, 0x10, 0x3F, 0x11, 0x10, 0x3C, 0xD0, 0xC0, 0x40, 0x50, 0x3F, 0x48, 0x00, 0xA0, 0x80,
-    0x14, 0x00, 0x20, 0x80, 0x05, 0x03, 0x70, 0x73, 0x01, 0x27, 0x36, 0x01, 0x46, 0x00, 0x13, 0x15,
-    0x00, 0x54, 0x01, 0x51, 0x45, 0x13, 0x0F, 0x25, 0x10, 0x11, 0x01, 0xF6, 0x2B, 0x40, 0x01, 0x52,
-    0x5F, 0x24, 0x7B, 0x7C, 0x00, 0x00, 0x03, 0x00, 0x43, 0xE6, 0x8F, 0xA4, 0xA6, 0x01, 0x29, 0x10,
-    0x81, 0x41, 0x04, 0x03, 0x64, 0x14, 0x60, 0x14, 0x61, 0x14, 0x00, 0x40, 0x46, 0x15, 0x00, 0xFF,
-    0x11, 0x80, 0x08, 0x43, 0x1E, 0x00, 0xC3, 0x70, 0x10, 0x17, 0x41, 0x07, 0x01, 0x1E, 0x16, 0x50,
-    0x15, 0x30, 0x50, 0x15, 0x04, 0x43, 0x13, 0xA4, 0xEF, 0x86, 0x88, 0x02, 0x40, 0x10, 0x28, 0x31,
-    0x18, 0x01, 0xE2, 0x11, 0x40, 0x26, 0x00, 0x1C, 0x16, 0x10, 0x54, 0x50, 0x1F, 0x43, 0x5C, 0x03,
-    0xC7, 0x70, 0x14, 0x15, 0x71, 0x17, 0x60, 0x01, 0xDF, 0x50, 0x02, 0x1F, 0x20, 0x10, 0x5F, 0x80,
-    0x96, 0xEB, 0x87, 0x78, 0x00, 0x40, 0x18, 0x11, 0x14, 0x53, 0x70, 0x03, 0xA3, 0x40, 0x01, 0x71,
-    0x20, 0x54, 0x02, 0xA1, 0x10, 0x3F, 0x19, 0x20, 0x86, 0x16, 0x06, 0xA3, 0x36, 0x67, 0x71, 0x17,
-    0x01, 0x80, 0xC0, 0xB1, 0x9F, 0x80, 0xBF, 0x01, 0x80, 0x13, 0x81, 0x14, 0x70, 0x00, 0x03, 0x70,
-    0x17, 0x10, 0x66, 0x66, 0x16, 0x00, 0x26, 0x11, 0x51, 0x00, 0xC3, 0x45, 0x13, 0x63, 0xDE, 0x30,
-    0xBF, 0x17, 0xAE, 0x30, 0xBF, 0x00, 0x04, 0x21, 0x00, 0x02, 0xDF, 0x05, 0x20, 0x10, 0x1C, 0x20,
-    0xFE, 0x02, 0x09, 0x12, 0x9B, 0xF2, 0x9F, 0x30, 0x3C, 0xF0, 0x1F, 0x00, 0x03, 0x06, 0x6E, 0x55,
-    0x40, 0x12, 0x84, 0x3E, 0x80, 0x16, 0x70, 0x17, 0x47, 0x11, 0x14, 0x60, 0x66, 0x14, 0x04, 0x5D,
-    0x45, 0x00, 0x22, 0x51, 0x04, 0x4E, 0x10, 0x04, 0x21, 0x00, 0x88, 0x00, 0x2F, 0xF4, 0x5F, 0xE0,
-    0xBF, 0x80, 0x02, 0x84, 0x82, 0x02, 0x80, 0x48, 0x48, 0x01, 0x23, 0x17, 0x00, 0x17, 0x60, 0x14,
-    0x16, 0x16, 0x50, 0x14, 0x15, 0xD9, 0x13, 0x7F, 0x76, 0x07, 0x86, 0x14, 0x09, 0x02, 0x43, 0x14,
-    0x10, 0x00, 0x1F, 0xB0, 0x00, 0xC3, 0x14, 0x40, 0xBF, 0x71, 0x7F, 0x00, 0x40, 0x38, 0x31, 0x47,
-    0x17, 0x00, 0x62, 0x17, 0x40, 0x36, 0x91, 0x7F, 0x40, 0x3F, 0x03, 0xC7, 0x20, 0x80, 0x18, 0x11,
-    0x9F, 0x30, 0x17, 0x60, 0x66, 0x66, 0x3D, 0x13, 0x50, 0x05, 0xDD, 0x10, 0x82, 0x50, 0x01, 0x05,
-    0x47, 0x18, 0x01, 0x3F, 0x5D, 0x18, 0x11, 0x3F, 0x30, 0x31, 0x3F, 0x40, 0xA4, 0x40, 0x01, 0x68,
-    0x05, 0x03, 0x1F, 0x88, 0x38, 0x11, 0x13, 0x03, 0x62, 0xE3, 0x96, 0xEE, 0x07, 0xA7, 0x01, 0xBF,
-    0x00, 0x01, 0x00, 0x74, 0x77, 0x03, 0x00, 0x10, 0x61, 0x7D, 0x16, 0x12, 0x1F, 0x37, 0xFF, 0x37,
-    0x3F, 0x26, 0x7F, 0x51, 0xBF, 0x40, 0x00, 0x56, 0x1E, 0x20, 0x54, 0x05, 0x00, 0x40, 0x70, 0xDF,
-    0x03, 0xE3, 0x10, 0x03, 0x70, 0x8B, 0x04, 0x03, 0x60, 0x04, 0x60, 0x08, 0x9F, 0x45, 0x10, 0xBF,
-    0xA0, 0x1F, 0x02, 0x60, 0x04, 0x80, 0x14, 0x30, 0x16, 0x06, 0xE3, 0x25, 0x0D, 0x46, 0x11, 0x00,
-    0x53, 0x07, 0x00, 0x91, 0x3F, 0x15, 0x06, 0xE5, 0x00, 0x16, 0x18, 0x18, 0x60, 0x17, 0x17, 0x17,
-    0x30, 0x03, 0x36, 0x36, 0x16, 0x10, 0x53, 0x53, 0x01, 0x1D, 0x80, 0xFF, 0x94, 0x00, 0x3B, 0x10,
-    0x38, 0x03, 0x44, 0x71, 0x03, 0xC0, 0x46, 0x36, 0xB8, 0x09, 0x7E, 0x51, 0x04, 0xAB, 0x70, 0x40,
-    0x60, 0x7F, 0x04, 0x70, 0x16, 0x85, 0x02, 0x3F, 0x14, 0x00, 0x11, 0x54, 0x08, 0x03, 0x34, 0x70,
-    0x1F, 0xBE, 0x12, 0x7F, 0x11, 0x13, 0x84, 0x10, 0x3F, 0x09, 0xE2, 0x17, 0x43, 0x53, 0x5F, 0x78,
-    0xFE, 0x03, 0x5B, 0xA3, 0xBE, 0x17, 0xE3, 0x20, 0x9F, 0x39, 0x17, 0x09, 0x3A, 0x20, 0x03, 0x70,
-    0xE6, 0x19, 0x94, 0x17, 0x9B, 0x86, 0x5F, 0x88, 0x04, 0x07, 0xDB, 0x02, 0x17, 0x80, 0xF6, 0x12,
-    0x5F, 0x00, 0x23, 0x01, 0xDC, 0x12, 0x5B, 0x00, 0x24, 0x9D, 0x61, 0x3E, 0x28, 0x2D, 0x60, 0x16,
-    0x00, 0xBF, 0x11, 0x14, 0x9F, 0x00, 0x43, 0x35, 0x09, 0xC1, 0x0C, 0x13, 0x40, 0x14, 0x20, 0x26,
-    0xBF, 0x00, 0x62, 0x81, 0x81, 0x0C, 0x02, 0x10, 0x68, 0x28, 0x04, 0xDF, 0x00, 0x33, 0x46, 0x26,
-    0x06, 0x00, 0x50, 0x52, 0x51, 0x02, 0x24, 0x5B, 0x43, 0xEF, 0x00, 0x00, 0x51, 0x02, 0x24, 0x5B,
-    0x80, 0x43, 0xEF, 0x00, 0x00, 0x58, 0x00, 0x00, 0xEF, 0x3D, 0x52, 0x4A, 0xD6, 0x5A, 0x39, 0x67,
-    0x9C, 0x73, 0xDE, 0x7B, 0xFF, 0x7F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0xEA, 0x3D, 0x4C, 0x4A, 0xCF, 0x5A, 0x31, 0x67,
-    0x92, 0x73, 0xD4, 0x7B, 0xF7, 0x7F, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0xB5, 0xC0, 0x46, 0xF8, 0xBC, 0x08, 0xBC, 0x9E, 0x46, 0x70, 0x47,
-    0xEE, 0xE3, 0x00, 0x08, 0xF3, 0xE3, 0x00, 0x08, 0xF8, 0xE3, 0x00, 0x08, 0xFD, 0xE3, 0x00, 0x08,
-    0x02, 0xE4, 0x00, 0x08, 0x07, 0xE4, 0x00, 0x08, 0x09, 0x8A, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00,
-    0x2F, 0xE4, 0x00, 0x08, 0x33, 0xE4, 0x00, 0x08, 0x37, 0xE4, 0x00, 0x08, 0x3B, 0xE4, 0x00, 0x08,
-    0x3F, 0xE4, 0x00, 0x08, 0x43, 0xE4, 0x00, 0x08, 0x47, 0xE4, 0x00, 0x08, 0x4B, 0xE4, 0x00, 0x08,
-    0x26, 0xE4, 0x00, 0x08, 0xCE, 0xE3, 0x00, 0x08, 0x4F, 0xE4, 0x00, 0x08, 0x0C, 0xE4, 0x00, 0x08,
-    0xCD, 0xE3, 0x00, 0x08, 0xCD, 0xE3, 0x00, 0x08, 0xCD, 0xE3, 0x00, 0x08, 0x11, 0xE4, 0x00, 0x08,
-    0x16, 0xE4, 0x00, 0x08, 0x1B, 0xE4, 0x00, 0x08, 0x20, 0xE4, 0x00, 0x08, 0x25, 0xE4, 0x00, 0x08,
-    0x2A, 0xE4, 0x00, 0x08, 0x4E, 0x45, 0x00, 0x00, 0x31, 0x2E, 0x30, 0x37, 0x00, 0xFF, 0xFF, 0xFF,
-    0x09, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x06, 0x06, 0x00, 0x00, 0x00, 0x74, 0xDF, 0x00, 0x08,
-    0x6D, 0xDF, 0x00, 0x08, 0x66, 0xDF, 0x00, 0x08, 0x5F, 0xDF, 0x00, 0x08, 0x58, 0xDF, 0x00, 0x08,
-    0x50, 0xDF, 0x00, 0x08, 0x48, 0xDF, 0x00, 0x08, 0x42, 0xDF, 0x00, 0x08, 0x3C, 0xDF, 0x00, 0x08,
-    0xA2, 0x00, 0x86, 0x90, 0xA0, 0x04, 0xB5, 0x80, 0xC9, 0x04, 0xB0, 0x0A, 0xE8, 0xE8, 0xE8, 0xE8,
-    0x88, 0xD0, 0xF3, 0x13, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x11, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x21, 0xFF, 0xFF, 0xFF, 0x22, 0x16, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x21, 0x21, 0xFF, 0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0x33, 0x33, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xFF, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x21, 0x61, 0x21, 0xFF, 0x10, 0x62, 0xFF, 0xFF, 0x33, 0x73, 0x33, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x21, 0x21, 0xFF, 0xFF, 0xFF, 0x22, 0xFF, 0xFF, 0x33, 0x33, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x21, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0x33, 0xFF, 0xF3, 0xFF, 0x24, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x02, 0x65, 0x22,
-    0x85, 0x02, 0xA5, 0x02, 0x65, 0x22, 0x85, 0x22, 0xE6, 0x02, 0xA5, 0x02, 0x65, 0x22, 0x85, 0x02,
-    0xA5, 0x02, 0x65, 0x22, 0x85, 0x02, 0xE6, 0x02, 0xA5, 0x02, 0x38, 0x65, 0x22, 0x85, 0x22, 0xA5,
-    0x02, 0x38, 0x65, 0x22, 0x85, 0x02, 0xA5, 0x02, 0x18, 0x65, 0x22, 0x85, 0x02, 0xA5, 0x02, 0x18,
-    0x65, 0x22, 0x85, 0x22, 0xE6, 0x02, 0x18, 0xA5, 0x02, 0x65, 0x22, 0x85, 0x02, 0x2A, 0x7C, 0x3B,
-    0x40, 0x5C, 0x7E, 0x5E, 0x60, 0x7B, 0x7D, 0x7F, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0xE0, 0x00, 0x08, 0x3C, 0x72, 0x00, 0x03,
-    0x78, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x00, 0x03, 0x8C, 0xC1, 0x03, 0x02,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xB9, 0x03, 0x02, 0xDC, 0x72, 0x00, 0x03, 0xBC, 0x74, 0x00, 0x03,
-    0x4C, 0x73, 0x00, 0x03, 0xE4, 0x74, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x73, 0x00, 0x03,
-    0x48, 0x75, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x49, 0x38, 0x00, 0x08, 0xE5, 0x38, 0x00, 0x08,
-    0x8F, 0x36, 0x00, 0x08, 0xC1, 0x38, 0x00, 0x08, 0x9D, 0x38, 0x00, 0x08, 0x79, 0x38, 0x00, 0x08,
-    0xF9, 0x38, 0x00, 0x08, 0x05, 0x39, 0x00, 0x08, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x07, 0x9B, 0x36, 0x00, 0x08, 0xFD, 0x36, 0x00, 0x08,
-    0x9B, 0x36, 0x00, 0x08, 0x9B, 0x36, 0x00, 0x08, 0xDD, 0x36, 0x00, 0x08, 0xBD, 0x36, 0x00, 0x08,
-    0x89, 0x36, 0x00, 0x08, 0xF3, 0x38, 0x00, 0x08, 0x50, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x4E, 0x45,
-    0x53, 0x20, 0x32, 0x30, 0x31, 0x33, 0x2D, 0x30, 0x37, 0x2D, 0x30, 0x31, 0x20, 0x73, 0x61, 0x76,
-    0x65, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0xFF, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x46, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xE8, 0x00, 0x08, 0x56, 0xE8, 0x00, 0x08,
-    0x5D, 0xE8, 0x00, 0x08, 0x56, 0xE8, 0x00, 0x08, 0x5A, 0xE8, 0x00, 0x08, 0x64, 0xE8, 0x00, 0x08,
-    0x45, 0xE8, 0x00, 0x08, 0x4A, 0xE8, 0x00, 0x08, 0x50, 0xE8, 0x00, 0x08, 0x56, 0xE8, 0x00, 0x08,
-    0x88, 0xE7, 0x00, 0x08, 0x92, 0xE7, 0x00, 0x08, 0x9F, 0xE7, 0x00, 0x08, 0xAE, 0xE7, 0x00, 0x08,
-    0x29, 0xE8, 0x00, 0x08, 0x2E, 0xE8, 0x00, 0x08, 0x33, 0xE8, 0x00, 0x08, 0x37, 0xE8, 0x00, 0x08,
-    0x3B, 0xE8, 0x00, 0x08, 0x0B, 0xE8, 0x00, 0x08, 0x11, 0xE8, 0x00, 0x08, 0x0E, 0xE8, 0x00, 0x08,
-    0x14, 0xE8, 0x00, 0x08, 0x1B, 0xE8, 0x00, 0x08, 0x22, 0xE8, 0x00, 0x08, 0xCA, 0xE7, 0x00, 0x08,
-    0xD3, 0xE7, 0x00, 0x08, 0xE5, 0xE7, 0x00, 0x08, 0xF9, 0xE7, 0x00, 0x08, 0xBF, 0xE7, 0x00, 0x08,
-    0xC2, 0xE7, 0x00, 0x08, 0x43, 0xE8, 0x00, 0x08, 0x42, 0xE8, 0x00, 0x08, 0x41, 0xE8, 0x00, 0x08,
-    0x40, 0xE8, 0x00, 0x08, 0x3F, 0xE8, 0x00, 0x08, 0x7D, 0xE7, 0x00, 0x08, 0x84, 0xE7, 0x00, 0x08,
-    0x63, 0xE7, 0x00, 0x08, 0x73, 0xE7, 0x00, 0x08, 0x0C, 0x09, 0x07, 0x05, 0x00, 0x0B, 0x00, 0x00,
-    0xE0, 0xE1, 0x00, 0x08, 0x10, 0xE2, 0x00, 0x08, 0xC4, 0xE1, 0x00, 0x08, 0xB0, 0xE1, 0x00, 0x08,
-    0xAC, 0xE1, 0x00, 0x08, 0x80, 0xE1, 0x00, 0x08, 0x65, 0x52, 0x00, 0x08, 0x65, 0x52, 0x00, 0x08,
-    0xDD, 0x50, 0x00, 0x08, 0xED, 0x53, 0x00, 0x08, 0x41, 0x10, 0x00, 0x08, 0x1D, 0x05, 0x00, 0x08,
-    0x91, 0x0D, 0x00, 0x08, 0x6D, 0x0C, 0x00, 0x08, 0x07, 0x08, 0x00, 0x08, 0x15, 0x08, 0x00, 0x08,
-    0x23, 0x08, 0x00, 0x08, 0x31, 0x08, 0x00, 0x08, 0x3F, 0x08, 0x00, 0x08, 0x4D, 0x08, 0x00, 0x08,
-    0x5B, 0x08, 0x00, 0x08, 0x75, 0x08, 0x00, 0x08, 0xA1, 0x08, 0x00, 0x08, 0x41, 0x10, 0x00, 0x08,
-    0xF1, 0x4F, 0x00, 0x08, 0x4D, 0x4F, 0x00, 0x08, 0xCD, 0x4F, 0x00, 0x08, 0x95, 0x4F, 0x00, 0x08,
-    0xD9, 0x59, 0x00, 0x08, 0x0D, 0x4F, 0x00, 0x08, 0x29, 0x4F, 0x00, 0x08, 0x39, 0x4F, 0x00, 0x08,
-    0xB9, 0x4E, 0x00, 0x08, 0x75, 0x4F, 0x00, 0x08, 0x85, 0x4F, 0x00, 0x08, 0xE1, 0x51, 0x00, 0x08,
-    0xD9, 0x08, 0x00, 0x08, 0x65, 0x4E, 0x00, 0x08, 0x15, 0x4E, 0x00, 0x08, 0xA5, 0x4F, 0x00, 0x08,
-    0x6B, 0x58, 0x00, 0x08, 0x5D, 0x58, 0x00, 0x08, 0x0D, 0x48, 0x00, 0x08, 0xE9, 0x4C, 0x00, 0x08,
-    0x6D, 0x44, 0x00, 0x08, 0x15, 0x57, 0x00, 0x08, 0x71, 0x57, 0x00, 0x08, 0xCF, 0x56, 0x00, 0x08,
-    0xD9, 0x08, 0x00, 0x08, 0x65, 0x4E, 0x00, 0x08, 0x15, 0x4E, 0x00, 0x08, 0xA5, 0x4F, 0x00, 0x08,
-    0x6B, 0x58, 0x00, 0x08, 0x5D, 0x58, 0x00, 0x08, 0x15, 0x57, 0x00, 0x08, 0x71, 0x57, 0x00, 0x08,
-    0xCF, 0x56, 0x00, 0x08, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x00, 0x4E, 0x65, 0x77, 0x00, 0x4F, 0x6C,
-    0x64, 0x20, 0x2D, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x61,
-    0x74, 0x20, 0x46, 0x69, 0x6E, 0x64, 0x65, 0x72, 0x00, 0x45, 0x64, 0x69, 0x74, 0x20, 0x43, 0x68,
-    0x65, 0x61, 0x74, 0x73, 0x2E, 0x2E, 0x2E, 0x00, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x52,
-    0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x2D, 0x20, 0x00, 0x3D, 0x3D, 0x00, 0x21, 0x3D, 0x00,
-    0x20, 0x3E, 0x00, 0x20, 0x3C, 0x00, 0x3E, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x4F, 0x66, 0x66, 0x00,
-    0x43, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E, 0x75, 0x6D,
-    0x62, 0x65, 0x72, 0x20, 0x2D, 0x20, 0x00, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x56, 0x61,
-    0x6C, 0x75, 0x65, 0x73, 0x00, 0x4F, 0x6E, 0x00, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x74,
-    0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x3A, 0x20, 0x00, 0x4E,
-    0x65, 0x77, 0x20, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x00, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
-    0x65, 0x61, 0x74, 0x20, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x52, 0x65, 0x73, 0x75, 0x6C,
-    0x74, 0x73, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x41, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x64,
-    0x64, 0x20, 0x63, 0x68, 0x65, 0x61, 0x74, 0x00, 0x20, 0x77, 0x61, 0x73, 0x20, 0x00, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x61, 0x74, 0x20, 0x4C, 0x69, 0x73, 0x74, 0x20, 0x45, 0x64,
-    0x69, 0x74, 0x6F, 0x72, 0x00, 0x41, 0x20, 0x74, 0x6F, 0x20, 0x45, 0x64, 0x69, 0x74, 0x2C, 0x20,
-    0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x00,
-    0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65,
-    0x00, 0x41, 0x64, 0x64, 0x20, 0x4E, 0x65, 0x77, 0x20, 0x43, 0x68, 0x65, 0x61, 0x74, 0x00, 0x4F,
-    0x68, 0x20, 0x6E, 0x6F, 0x21, 0x20, 0x50, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x4E, 0x45, 0x53, 0x20,
-    0x63, 0x72, 0x61, 0x73, 0x68, 0x65, 0x64, 0x21, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x53,
-    0x45, 0x4C, 0x45, 0x43, 0x54, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x2E,
-    0x00, 0x52, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
-    0x74, 0x73, 0x3A, 0x00, 0x28, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65,
-    0x73, 0x65, 0x29, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x41, 0x20, 0x66, 0x6F, 0x72, 0x20,
-    0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x00, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x00, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x2D, 0x53, 0x45,
-    0x4C, 0x45, 0x43, 0x54, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x00, 0x50, 0x43,
-    0x20, 0x20, 0x00, 0x4C, 0x52, 0x20, 0x20, 0x00, 0x52, 0x30, 0x20, 0x20, 0x00, 0x52, 0x31, 0x20,
-    0x20, 0x00, 0x52, 0x32, 0x20, 0x20, 0x00, 0x52, 0x31, 0x32, 0x20, 0x00, 0x43, 0x50, 0x53, 0x52,
-    0x00, 0x20, 0x52, 0x30, 0x20, 0x00, 0x20, 0x52, 0x31, 0x20, 0x00, 0x20, 0x52, 0x32, 0x20, 0x00,
-    0x20, 0x52, 0x33, 0x20, 0x00, 0x20, 0x52, 0x31, 0x32, 0x00, 0x20, 0x50, 0x43, 0x20, 0x00, 0x52,
-    0x34, 0x20, 0x00, 0x52, 0x35, 0x20, 0x00, 0x52, 0x36, 0x20, 0x00, 0x52, 0x37, 0x20, 0x00, 0x52,
-    0x38, 0x20, 0x00, 0x52, 0x39, 0x20, 0x00, 0x52, 0x31, 0x30, 0x00, 0x52, 0x31, 0x31, 0x00, 0x4C,
-    0x52, 0x20, 0x00, 0x28, 0x45, 0x29, 0x00, 0x28, 0x65, 0x29, 0x00, 0x4E, 0x6F, 0x20, 0x52, 0x4F,
-    0x4D, 0x53, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x21, 0x00, 0x55, 0x73, 0x65, 0x20, 0x50, 0x6F,
-    0x63, 0x6B, 0x65, 0x74, 0x4E, 0x45, 0x53, 0x20, 0x4D, 0x65, 0x6E, 0x75, 0x20, 0x4D, 0x61, 0x6B,
-    0x65, 0x72, 0x00, 0x74, 0x6F, 0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x61, 0x20, 0x63, 0x6F,
-    0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x52, 0x4F, 0x4D, 0x2C, 0x00, 0x6F,
-    0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x50, 0x6F, 0x67, 0x6F, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x00, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
-    0x20, 0x66, 0x6C, 0x61, 0x73, 0x68, 0x20, 0x63, 0x61, 0x72, 0x74, 0x72, 0x69, 0x64, 0x67, 0x65,
-    0x2E, 0x00, 0x31, 0x2E, 0x30, 0x37, 0x00, 0x4F, 0x63, 0x74, 0x20, 0x31, 0x38, 0x20, 0x32, 0x30,
-    0x30, 0x30, 0x00, 0x20, 0x20, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
-    0x21, 0x20, 0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x2E, 0x00, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20,
-    0x73, 0x61, 0x76, 0x65, 0x73, 0x2E, 0x00, 0x30, 0x30, 0x3A, 0x30, 0x30, 0x3A, 0x30, 0x30, 0x20,
-    0x2D, 0x20, 0x00, 0x2C, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x00, 0x50, 0x75, 0x73, 0x68, 0x20,
-    0x53, 0x45, 0x4C, 0x45, 0x43, 0x54, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65,
-    0x00, 0x3C, 0x4E, 0x45, 0x57, 0x3E, 0x00, 0x53, 0x61, 0x76, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74,
-    0x65, 0x3A, 0x00, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3A, 0x00, 0x45,
-    0x72, 0x61, 0x73, 0x65, 0x20, 0x53, 0x52, 0x41, 0x4D, 0x3A, 0x00, 0x20, 0x62, 0x79, 0x74, 0x65,
-    0x73, 0x00, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x75, 0x70,
-    0x20, 0x00, 0x57, 0x65, 0x20, 0x6E, 0x6F, 0x77, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6E,
-    0x6F, 0x75, 0x67, 0x68, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x41, 0x50, 0x33, 0x33, 0x00,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x68,
-    0x65, 0x61, 0x74, 0x2E, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x53, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x2E, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
-    0x4F, 0x4D, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x00, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69,
-    0x6E, 0x67, 0x73, 0x00, 0x56, 0x53, 0x79, 0x6E, 0x63, 0x3A, 0x20, 0x00, 0x46, 0x50, 0x53, 0x2D,
-    0x4D, 0x65, 0x74, 0x65, 0x72, 0x3A, 0x20, 0x00, 0x53, 0x77, 0x61, 0x70, 0x20, 0x41, 0x2D, 0x42,
-    0x3A, 0x20, 0x00, 0x41, 0x75, 0x74, 0x6F, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x3A, 0x20, 0x00, 0x41,
-    0x75, 0x74, 0x6F, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3A, 0x20, 0x00,
-    0x41, 0x75, 0x74, 0x6F, 0x73, 0x61, 0x76, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3A, 0x20,
-    0x00, 0x52, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x00, 0x50, 0x6F, 0x63, 0x6B, 0x65, 0x74,
-    0x4E, 0x45, 0x53, 0x20, 0x32, 0x30, 0x31, 0x33, 0x2D, 0x30, 0x37, 0x2D, 0x30, 0x31, 0x20, 0x6F,
-    0x6E, 0x20, 0x00, 0x43, 0x68, 0x65, 0x61, 0x74, 0x20, 0x46, 0x69, 0x6E, 0x64, 0x65, 0x72, 0x2D,
-    0x3E, 0x00, 0x42, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x66, 0x69, 0x72, 0x65, 0x3A, 0x20, 0x00, 0x41,
-    0x20, 0x61, 0x75, 0x74, 0x6F, 0x66, 0x69, 0x72, 0x65, 0x3A, 0x20, 0x00, 0x43, 0x6F, 0x6E, 0x74,
-    0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x3A, 0x20, 0x00, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-    0x2D, 0x3E, 0x00, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
-    0x73, 0x2D, 0x3E, 0x00, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x00, 0x52, 0x65, 0x73, 0x74, 0x61, 0x72,
-    0x74, 0x00, 0x45, 0x78, 0x69, 0x74, 0x00, 0x53, 0x61, 0x76, 0x65, 0x20, 0x53, 0x74, 0x61, 0x74,
-    0x65, 0x2D, 0x3E, 0x00, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x2D, 0x3E,
-    0x00, 0x4D, 0x61, 0x6E, 0x61, 0x67, 0x65, 0x20, 0x53, 0x52, 0x41, 0x4D, 0x2D, 0x3E, 0x00, 0x30,
-    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x00,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x53, 0x65,
-    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x00, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20,
-    0x00, 0x53, 0x63, 0x61, 0x6C, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x00, 0x47, 0x61, 0x6D, 0x6D, 0x61,
-    0x3A, 0x20, 0x00, 0x53, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x46, 0x6F, 0x6C, 0x6C, 0x6F, 0x77,
-    0x20, 0x62, 0x79, 0x3A, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30, 0x3A, 0x30, 0x30, 0x3A,
-    0x30, 0x30, 0x00, 0x53, 0x70, 0x72, 0x69, 0x74, 0x65, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72,
-    0x3A, 0x20, 0x00, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x00, 0x53, 0x70, 0x72,
-    0x69, 0x74, 0x65, 0x00, 0x52, 0x41, 0x4D, 0x00, 0x55, 0x53, 0x20, 0x28, 0x4E, 0x54, 0x53, 0x43,
-    0x29, 0x00, 0x45, 0x75, 0x72, 0x6F, 0x70, 0x65, 0x20, 0x28, 0x50, 0x41, 0x4C, 0x29, 0x00, 0x44,
-    0x65, 0x6E, 0x64, 0x79, 0x20, 0x28, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x29, 0x00, 0x4F, 0x76,
-    0x65, 0x72, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x4E, 0x54, 0x53, 0x43, 0x00, 0x4E,
-    0x6F, 0x20, 0x46, 0x6C, 0x69, 0x63, 0x6B, 0x65, 0x72, 0x00, 0x55, 0x6E, 0x73, 0x63, 0x61, 0x6C,
-    0x65, 0x64, 0x00, 0x55, 0x6E, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x64, 0x20, 0x28, 0x46, 0x6F, 0x6C,
-    0x6C, 0x6F, 0x77, 0x29, 0x00, 0x53, 0x63, 0x61, 0x6C, 0x65, 0x64, 0x20, 0x42, 0x47, 0x2C, 0x20,
-    0x46, 0x75, 0x6C, 0x6C, 0x20, 0x4F, 0x42, 0x4A, 0x00, 0x53, 0x63, 0x61, 0x6C, 0x65, 0x64, 0x20,
-    0x42, 0x47, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x4F, 0x42, 0x4A, 0x00, 0x31, 0x50, 0x00, 0x31, 0x50,
-    0x2B, 0x32, 0x50, 0x00, 0x4C, 0x69, 0x6E, 0x6B, 0x32, 0x50, 0x00, 0x4C, 0x69, 0x6E, 0x6B, 0x33,
-    0x50, 0x00, 0x4C, 0x69, 0x6E, 0x6B, 0x34, 0x50, 0x00, 0x43, 0x72, 0x61, 0x70, 0x00, 0x50, 0x72,
-    0x6F, 0x74, 0x00, 0x47, 0x42, 0x41, 0x00, 0x47, 0x42, 0x50, 0x00, 0x4E, 0x44, 0x53, 0x00, 0x49,
-    0x49, 0x49, 0x49, 0x49, 0x00, 0x35, 0x6D, 0x69, 0x6E, 0x00, 0x31, 0x30, 0x6D, 0x69, 0x6E, 0x00,
-    0x33, 0x30, 0x6D, 0x69, 0x6E, 0x00, 0x4F, 0x46, 0x46, 0x00, 0x4F, 0x4E, 0x00, 0x53, 0x4C, 0x4F,
-    0x57, 0x4D, 0x4F, 0x00, 0x77, 0x69, 0x74, 0x68, 0x20, 0x52, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x04, 0x9A, 0xE5, 0x00, 0x10, 0x49, 0xE0, 0x01, 0x00, 0x81, 0xE2, 0x20, 0x14, 0xA0, 0xE1,
-    0x1C, 0x24, 0x9A, 0xE5, 0x01, 0x10, 0x42, 0xE4, 0x01, 0x2C, 0x82, 0xE3, 0x01, 0x00, 0x42, 0xE4,
-    0x1C, 0x24, 0xCA, 0xE5, 0x4D, 0x00, 0x08, 0xE2, 0x02, 0x01, 0x13, 0xE3, 0x80, 0x00, 0x80, 0x13,
-    0xFF, 0x00, 0x13, 0xE3, 0x02, 0x00, 0x80, 0x03, 0x30, 0x00, 0x80, 0xE3, 0x10, 0xC0, 0x9F, 0xE5,
-    0x2A, 0x07, 0x00, 0xEB, 0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xEF, 0x0F, 0x00, 0xEA, 0xFE, 0xFF, 0x00, 0x00, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7,
-    0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xE6, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7,
-    0x00, 0x00, 0x80, 0xE0, 0x00, 0x3C, 0x90, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x0C, 0x00, 0xCB, 0xE7,
-    0x0F, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xDC, 0x0F, 0x00, 0xEA,
-    0x4D, 0x00, 0x08, 0xE2, 0x02, 0x01, 0x13, 0xE3, 0x80, 0x00, 0x80, 0x13, 0xFF, 0x00, 0x13, 0xE3,
-    0x02, 0x00, 0x80, 0x03, 0x30, 0x00, 0x80, 0xE3, 0x1C, 0x24, 0x9A, 0xE5, 0x01, 0x00, 0x42, 0xE4,
-    0x1C, 0x24, 0xCA, 0xE5, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xCF, 0x0F, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xC8, 0x0F, 0x00, 0xEA,
-    0x05, 0x50, 0x95, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xC1, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xB5, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x3C, 0x90, 0xE1, 0x01, 0x80, 0x88, 0x23,
-    0x01, 0x80, 0xC8, 0x33, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xA4, 0x0F, 0x00, 0xEA,
-    0x02, 0x01, 0x13, 0xE3, 0x45, 0x06, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2,
-    0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x8A, 0x0F, 0x00, 0xEA,
-    0x02, 0x01, 0x13, 0xE3, 0x39, 0x06, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3,
-    0x41, 0x06, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2,
-    0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x7C, 0x0F, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3,
-    0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5, 0x0C, 0x2C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1,
-    0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x78, 0x0F, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0x00, 0x5C, 0x85, 0xE1,
-    0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x6F, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7,
-    0x00, 0x00, 0x80, 0xE0, 0x00, 0x3C, 0x90, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x2C, 0x0C, 0xCB, 0xE7,
-    0x12, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x64, 0x0F, 0x00, 0xEA,
-    0x01, 0x80, 0xC8, 0xE3, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x5F, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x50, 0x0F, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x85, 0xE1, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x41, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x00, 0x80, 0xE0, 0x00, 0x3C, 0x90, 0xE1,
-    0x01, 0x80, 0x88, 0x23, 0x01, 0x80, 0xC8, 0x33, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x2F, 0x0F, 0x00, 0xEA, 0x01, 0x20, 0xD9, 0xE4, 0x28, 0x14, 0x9A, 0xE5, 0x01, 0x00, 0x49, 0xE0,
-    0x00, 0x10, 0xD9, 0xE5, 0x01, 0x94, 0x82, 0xE1, 0x20, 0x14, 0xA0, 0xE1, 0x1C, 0x24, 0x9A, 0xE5,
-    0x01, 0x10, 0x42, 0xE4, 0x01, 0x2C, 0x82, 0xE3, 0x01, 0x00, 0x42, 0xE4, 0x1C, 0x24, 0xCA, 0xE5,
-    0x0E, 0x1A, 0x09, 0xE2, 0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x1C, 0x0F, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0x40, 0x80, 0xC8, 0xE3, 0x40, 0x00, 0x10, 0xE3,
-    0x40, 0x80, 0x88, 0x13, 0x25, 0x3C, 0x00, 0xE0, 0x00, 0x3C, 0x83, 0xE1, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x11, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x00, 0xDB, 0xE7, 0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x09, 0x0F, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x00, 0xDB, 0xE7, 0xA8, 0x80, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0xE0, 0x00, 0x3C, 0x90, 0xE1,
-    0x08, 0x80, 0xA8, 0xE0, 0x0C, 0x00, 0xCB, 0xE7, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xFE, 0x0E, 0x00, 0xEA, 0x1C, 0x24, 0xDA, 0xE5, 0x01, 0x20, 0x82, 0xE2,
-    0x1C, 0x24, 0xCA, 0xE5, 0x01, 0x2C, 0x82, 0xE3, 0xDB, 0x00, 0x92, 0xE1, 0x4D, 0x80, 0xC8, 0xE3,
-    0x4D, 0x10, 0x00, 0xE2, 0x01, 0x80, 0x88, 0xE1, 0xFD, 0x30, 0xC0, 0xE3, 0x02, 0x30, 0x23, 0xE2,
-    0x03, 0x8B, 0x48, 0xE2, 0x0C, 0x06, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x5C, 0x05, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xEB, 0x0E, 0x00, 0xEA, 0xA8, 0x80, 0xB0, 0xE1, 0x02, 0x55, 0x85, 0x23, 0x05, 0x50, 0x95, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x08, 0x80, 0xA8, 0xE0, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xE2, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x40, 0x80, 0xC8, 0xE3, 0x40, 0x00, 0x10, 0xE3, 0x40, 0x80, 0x88, 0x13, 0x25, 0x3C, 0x00, 0xE0,
-    0x00, 0x3C, 0x83, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xD3, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x05, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xC7, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x80, 0xB0, 0xE1,
-    0x00, 0x00, 0xA0, 0xE0, 0x00, 0x3C, 0x90, 0xE1, 0x08, 0x80, 0xA8, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xB6, 0x0E, 0x00, 0xEA, 0x02, 0x01, 0x13, 0xE3, 0x57, 0x05, 0x00, 0x0A,
-    0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2,
-    0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x9C, 0x0E, 0x00, 0xEA, 0x02, 0x01, 0x13, 0xE3, 0x4B, 0x05, 0x00, 0x0A,
-    0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3, 0x53, 0x05, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2,
-    0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x8E, 0x0E, 0x00, 0xEA,
-    0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02,
-    0x01, 0x10, 0xD0, 0xE5, 0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1,
-    0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x8A, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0,
-    0x2C, 0x0C, 0xDB, 0xE7, 0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x81, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0xA8, 0x80, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0xE0,
-    0x00, 0x3C, 0x90, 0xE1, 0x08, 0x80, 0xA8, 0xE0, 0x2C, 0x0C, 0xCB, 0xE7, 0x12, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x75, 0x0E, 0x00, 0xEA, 0x01, 0x80, 0x88, 0xE3,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x70, 0x0E, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x61, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x5C, 0x05, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x52, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x80, 0xB0, 0xE1, 0x00, 0x00, 0xA0, 0xE0, 0x00, 0x3C, 0x90, 0xE1,
-    0x08, 0x80, 0xA8, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x40, 0x0E, 0x00, 0xEA,
-    0x1C, 0x24, 0xDA, 0xE5, 0x01, 0x20, 0x82, 0xE2, 0x1C, 0x24, 0xCA, 0xE5, 0x01, 0x2C, 0x82, 0xE3,
-    0xDB, 0x00, 0x92, 0xE1, 0x4D, 0x80, 0xC8, 0xE3, 0x4D, 0x10, 0x00, 0xE2, 0x01, 0x80, 0x88, 0xE1,
-    0xFD, 0x30, 0xC0, 0xE3, 0x02, 0x30, 0x23, 0xE2, 0x1C, 0x24, 0x9A, 0xE5, 0x02, 0x20, 0x82, 0xE2,
-    0x1C, 0x24, 0xCA, 0xE5, 0x02, 0x2C, 0xC2, 0xE3, 0x01, 0x2C, 0x82, 0xE3, 0x01, 0x00, 0x52, 0xE4,
-    0x01, 0x2C, 0x82, 0xE3, 0x00, 0x90, 0xD2, 0xE5, 0x00, 0x94, 0x89, 0xE1, 0x0E, 0x1A, 0x09, 0xE2,
-    0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0, 0x12, 0x8C, 0x48, 0xE2,
-    0x41, 0x05, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0x00, 0x5C, 0x25, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x1F, 0x0E, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x30, 0xDB, 0xE7, 0xA3, 0x30, 0xB0, 0xE1,
-    0x01, 0x80, 0x88, 0xE3, 0x0C, 0x30, 0xCB, 0xE7, 0x0F, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x16, 0x0E, 0x00, 0xEA, 0x25, 0x0C, 0xA0, 0xE1, 0x1C, 0x24, 0x9A, 0xE5,
-    0x01, 0x00, 0x42, 0xE4, 0x1C, 0x24, 0xCA, 0xE5, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x0E, 0x0E, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x5C, 0x25, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x07, 0x0E, 0x00, 0xEA, 0xA5, 0x3C, 0xB0, 0xE1, 0x03, 0x5C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3,
-    0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x00, 0x0E, 0x00, 0xEA,
-    0x18, 0x08, 0x9A, 0xE5, 0x00, 0x00, 0x59, 0xE1, 0x28, 0xF0, 0x9F, 0x05, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0x10, 0xD9, 0xE5, 0x01, 0x94, 0x80, 0xE1, 0x0E, 0x1A, 0x09, 0xE2, 0xA1, 0x05, 0x94, 0xE7,
-    0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xF2, 0x0D, 0x00, 0xEA, 0x00, 0x3B, 0x00, 0x06, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x25, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xE5, 0x0D, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0xA0, 0x00, 0xB0, 0xE1, 0x01, 0x80, 0x88, 0x23, 0x01, 0x80, 0xC8, 0x33,
-    0x00, 0x30, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD4, 0x0D, 0x00, 0xEA,
-    0x40, 0x00, 0x18, 0xE3, 0x75, 0x04, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2,
-    0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xBA, 0x0D, 0x00, 0xEA,
-    0x40, 0x00, 0x18, 0xE3, 0x69, 0x04, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3,
-    0x71, 0x04, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2,
-    0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xAC, 0x0D, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3,
-    0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5, 0x0C, 0x2C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x25, 0xE0, 0x45, 0x3C, 0xA0, 0xE1,
-    0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xA8, 0x0D, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0x00, 0x5C, 0x25, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x9F, 0x0D, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x3C, 0xDB, 0xE7,
-    0xA3, 0x30, 0xB0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x2C, 0x3C, 0xCB, 0xE7, 0x12, 0x8C, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x95, 0x0D, 0x00, 0xEA, 0x04, 0x80, 0xC8, 0xE3,
-    0x06, 0x8C, 0x48, 0xE2, 0xAC, 0x04, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x25, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x83, 0x0D, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x5C, 0x25, 0xE0, 0x45, 0x3C, 0xA0, 0xE1,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x74, 0x0D, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA0, 0x00, 0xB0, 0xE1,
-    0x01, 0x80, 0x88, 0x23, 0x01, 0x80, 0xC8, 0x33, 0x00, 0x30, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x62, 0x0D, 0x00, 0xEA, 0x1C, 0x24, 0x9A, 0xE5, 0x02, 0x20, 0x82, 0xE2,
-    0x1C, 0x24, 0xCA, 0xE5, 0x02, 0x2C, 0xC2, 0xE3, 0x01, 0x2C, 0x82, 0xE3, 0x01, 0x00, 0x52, 0xE4,
-    0x01, 0x2C, 0x82, 0xE3, 0x00, 0x90, 0xD2, 0xE5, 0x00, 0x94, 0x89, 0xE1, 0x01, 0x90, 0x89, 0xE2,
-    0x0E, 0x1A, 0x09, 0xE2, 0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x50, 0x0D, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x01, 0x0C, 0x40, 0x22,
-    0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x09, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x44, 0x0D, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0xA8, 0x80, 0xB0, 0xE1, 0x01, 0x0C, 0x80, 0x23,
-    0xA0, 0x00, 0xB0, 0xE1, 0x00, 0x3C, 0x80, 0xE1, 0x08, 0x80, 0xA8, 0xE0, 0x0C, 0x00, 0xCB, 0xE7,
-    0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x38, 0x0D, 0x00, 0xEA,
-    0x1C, 0x24, 0xDA, 0xE5, 0x01, 0x20, 0x82, 0xE2, 0x1C, 0x24, 0xCA, 0xE5, 0x01, 0x2C, 0x82, 0xE3,
-    0xDB, 0x30, 0x92, 0xE1, 0x03, 0x5C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x2E, 0x0D, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0xA8, 0x10, 0xB0, 0xE1,
-    0x01, 0x0C, 0x40, 0x22, 0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3,
-    0x40, 0x80, 0xC8, 0x73, 0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x23, 0x0D, 0x00, 0xEA, 0xA8, 0x80, 0xB0, 0xE1, 0x65, 0x50, 0xA0, 0xE1, 0x45, 0x3C, 0xB0, 0xE1,
-    0xFF, 0x54, 0x05, 0xE2, 0x08, 0x80, 0xA8, 0xE0, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x1A, 0x0D, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x0E, 0x2A, 0x0C, 0xE2, 0xA2, 0x15, 0x94, 0xE7, 0x0C, 0x90, 0xF1, 0xE7,
-    0x0C, 0x0C, 0xA0, 0xE1, 0x01, 0x04, 0x90, 0xE2, 0x01, 0x1C, 0x41, 0x22, 0x01, 0x00, 0xD1, 0xE5,
-    0x00, 0x94, 0x89, 0xE1, 0x0E, 0x1A, 0x09, 0xE2, 0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5,
-    0x00, 0x90, 0x89, 0xE0, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x07, 0x0D, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1,
-    0x01, 0x0C, 0x40, 0x22, 0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3,
-    0x40, 0x80, 0xC8, 0x73, 0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xF7, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x80, 0xB0, 0xE1,
-    0x01, 0x0C, 0x80, 0x23, 0xA0, 0x00, 0xB0, 0xE1, 0x00, 0x3C, 0x80, 0xE1, 0x08, 0x80, 0xA8, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xE5, 0x0C, 0x00, 0xEA, 0x40, 0x00, 0x18, 0xE3,
-    0x86, 0x03, 0x00, 0x0A, 0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0,
-    0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xCB, 0x0C, 0x00, 0xEA, 0x40, 0x00, 0x18, 0xE3,
-    0x7A, 0x03, 0x00, 0x0A, 0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3, 0x82, 0x03, 0x00, 0x0A,
-    0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1,
-    0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xBD, 0x0C, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7,
-    0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5, 0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22,
-    0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x01, 0x0C, 0x40, 0x22, 0x60, 0x54, 0xB5, 0xE0,
-    0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73, 0x0F, 0x8C, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xB5, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x01, 0x0C, 0x40, 0x22,
-    0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xA8, 0x0C, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0xA8, 0x80, 0xB0, 0xE1,
-    0x01, 0x0C, 0x80, 0x23, 0xA0, 0x00, 0xB0, 0xE1, 0x00, 0x3C, 0x80, 0xE1, 0x08, 0x80, 0xA8, 0xE0,
-    0x2C, 0x0C, 0xCB, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x9B, 0x0C, 0x00, 0xEA, 0x04, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x96, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1,
-    0x01, 0x0C, 0x40, 0x22, 0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3,
-    0x40, 0x80, 0xC8, 0x73, 0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x83, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x01, 0x0C, 0x40, 0x22,
-    0x60, 0x54, 0xB5, 0xE0, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x70, 0x0C, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x80, 0xB0, 0xE1,
-    0x01, 0x0C, 0x80, 0x23, 0xA0, 0x00, 0xB0, 0xE1, 0x00, 0x3C, 0x80, 0xE1, 0x08, 0x80, 0xA8, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x5D, 0x0C, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0x0C, 0x86, 0xE0, 0x20, 0xCC, 0xDB, 0xE7, 0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7,
-    0x01, 0xC4, 0x8C, 0xE1, 0x25, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x4F, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x27, 0x0C, 0xA0, 0xE1, 0x0C, 0x00, 0xCB, 0xE7,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x48, 0x0C, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x25, 0x0C, 0xA0, 0xE1, 0x0C, 0x00, 0xCB, 0xE7, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x41, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x26, 0x0C, 0xA0, 0xE1, 0x0C, 0x00, 0xCB, 0xE7, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x3A, 0x0C, 0x00, 0xEA, 0x01, 0x74, 0x47, 0xE2, 0x47, 0x3C, 0xA0, 0xE1,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x34, 0x0C, 0x00, 0xEA,
-    0x06, 0x50, 0xA0, 0xE1, 0x46, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x2E, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x27, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x94, 0xE7, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x23, 0x0C, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x25, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x18, 0x0C, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0x0C, 0xA0, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x0D, 0x0C, 0x00, 0xEA, 0x01, 0x00, 0x18, 0xE3,
-    0xAE, 0x02, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0,
-    0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xF3, 0x0B, 0x00, 0xEA, 0x01, 0x00, 0x18, 0xE3,
-    0xA2, 0x02, 0x00, 0x1A, 0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3, 0xAA, 0x02, 0x00, 0x0A,
-    0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1,
-    0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xE5, 0x0B, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7,
-    0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0x25, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xE4, 0x0B, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x27, 0x0C, 0xA0, 0xE1, 0x2C, 0x0C, 0xCB, 0xE7,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xDC, 0x0B, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x25, 0x0C, 0xA0, 0xE1, 0x2C, 0x0C, 0xCB, 0xE7,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD4, 0x0B, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x87, 0xE0, 0x26, 0x0C, 0xA0, 0xE1, 0x2C, 0x0C, 0xCB, 0xE7,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xCC, 0x0B, 0x00, 0xEA,
-    0x07, 0x50, 0xA0, 0xE1, 0x47, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xC6, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0x25, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xBA, 0x0B, 0x00, 0xEA, 0x26, 0x0C, 0xA0, 0xE1, 0x1C, 0x04, 0xCA, 0xE5,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xB4, 0x0B, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0,
-    0x25, 0x0C, 0xA0, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7,
-    0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xA8, 0x0B, 0x00, 0xEA,
-    0xD1, 0x30, 0xD9, 0xE0, 0x03, 0x7C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xA2, 0x0B, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x0C, 0x86, 0xE0,
-    0x20, 0xCC, 0xDB, 0xE7, 0x01, 0x04, 0x80, 0xE2, 0x20, 0x1C, 0xDB, 0xE7, 0x01, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x80, 0xE1,
-    0x03, 0x5C, 0xA0, 0xE1, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x93, 0x0B, 0x00, 0xEA, 0xD1, 0x30, 0xD9, 0xE0, 0x03, 0x6C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x8D, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0xDC, 0x30, 0x9B, 0xE1, 0x03, 0x7C, 0xA0, 0xE1, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x86, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0xDC, 0x30, 0x9B, 0xE1,
-    0x03, 0x5C, 0xA0, 0xE1, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x7F, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0xDC, 0x30, 0x9B, 0xE1, 0x03, 0x6C, 0xA0, 0xE1,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x78, 0x0B, 0x00, 0xEA,
-    0x05, 0x70, 0xA0, 0xE1, 0x47, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x72, 0x0B, 0x00, 0xEA, 0xD1, 0x30, 0xD9, 0xE0, 0x03, 0x5C, 0xA0, 0xE1,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x6C, 0x0B, 0x00, 0xEA,
-    0x05, 0x60, 0xA0, 0xE1, 0x46, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x66, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x80, 0xE1, 0x03, 0x7C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x5A, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x80, 0xE1, 0x03, 0x5C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x4E, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x80, 0xE1, 0x03, 0x6C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x42, 0x0B, 0x00, 0xEA, 0x01, 0x00, 0x18, 0xE3, 0xE3, 0x01, 0x00, 0x0A,
-    0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2,
-    0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x28, 0x0B, 0x00, 0xEA, 0x01, 0x00, 0x18, 0xE3, 0xD7, 0x01, 0x00, 0x0A,
-    0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3, 0xDF, 0x01, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2,
-    0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x1A, 0x0B, 0x00, 0xEA,
-    0x01, 0x00, 0xD9, 0xE4, 0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02,
-    0x01, 0x10, 0xD0, 0xE5, 0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1,
-    0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x80, 0xE1, 0x03, 0x5C, 0xA0, 0xE1, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x16, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x26, 0xCC, 0x8C, 0xE0,
-    0xFF, 0xC0, 0x0C, 0xE2, 0xDC, 0x30, 0x9B, 0xE1, 0x03, 0x7C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x0D, 0x0B, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x26, 0xCC, 0x8C, 0xE0, 0xFF, 0xC0, 0x0C, 0xE2, 0xDC, 0x30, 0x9B, 0xE1, 0x03, 0x5C, 0xA0, 0xE1,
-    0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x04, 0x0B, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x27, 0xCC, 0x8C, 0xE0, 0xFF, 0xC0, 0x0C, 0xE2, 0xDC, 0x30, 0x9B, 0xE1,
-    0x03, 0x6C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xFB, 0x0A, 0x00, 0xEA, 0x40, 0x80, 0xC8, 0xE3, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xF6, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x80, 0xE1,
-    0x03, 0x5C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xE7, 0x0A, 0x00, 0xEA, 0x1C, 0x64, 0xDA, 0xE5, 0x06, 0x6C, 0xA0, 0xE1, 0x46, 0x3C, 0xA0, 0xE1,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xE0, 0x0A, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x80, 0xE1, 0x03, 0x7C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD1, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x80, 0xE1, 0x03, 0x5C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xC2, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0,
-    0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x80, 0xE1,
-    0x03, 0x6C, 0xA0, 0xE1, 0x03, 0x8B, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xB3, 0x0A, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x3C, 0x57, 0xE0, 0x43, 0x3C, 0xA0, 0xE1,
-    0x01, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xAB, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0x00, 0x3C, 0x57, 0xE0,
-    0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x09, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xA2, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7,
-    0x00, 0x3C, 0x55, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x09, 0x8C, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x99, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x00, 0xDB, 0xE7, 0x01, 0x00, 0x40, 0xE2, 0x00, 0x3C, 0x80, 0xE1, 0x0C, 0x00, 0xCB, 0xE7,
-    0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x90, 0x0A, 0x00, 0xEA,
-    0x01, 0x74, 0x87, 0xE2, 0x47, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x8A, 0x0A, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0x3C, 0x55, 0xE0,
-    0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x82, 0x0A, 0x00, 0xEA, 0x01, 0x64, 0x46, 0xE2, 0x46, 0x3C, 0xA0, 0xE1,
-    0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x7C, 0x0A, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x57, 0xE0, 0x43, 0x3C, 0xA0, 0xE1,
-    0x01, 0x80, 0x88, 0xE3, 0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x6F, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x55, 0xE0,
-    0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x62, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x01, 0x00, 0x40, 0xE2, 0x00, 0x3C, 0x80, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x53, 0x0A, 0x00, 0xEA, 0xFF, 0x00, 0x13, 0xE3, 0xF4, 0x00, 0x00, 0x0A, 0xD1, 0x00, 0xD9, 0xE0,
-    0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1,
-    0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x39, 0x0A, 0x00, 0xEA, 0xFF, 0x00, 0x13, 0xE3, 0xE8, 0x00, 0x00, 0x0A, 0xD1, 0x00, 0xD9, 0xE0,
-    0x04, 0x00, 0x70, 0xE3, 0xEA, 0x00, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0,
-    0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x2B, 0x0A, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5,
-    0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x00, 0x3C, 0x55, 0xE0,
-    0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x0F, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x26, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0,
-    0x2C, 0x0C, 0xDB, 0xE7, 0x00, 0x3C, 0x55, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3,
-    0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x1C, 0x0A, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7, 0x01, 0x00, 0x40, 0xE2,
-    0x00, 0x3C, 0x80, 0xE1, 0x2C, 0x0C, 0xCB, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x12, 0x0A, 0x00, 0xEA, 0x08, 0x80, 0xC8, 0xE3, 0x06, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x0D, 0x0A, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x0C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x55, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x03, 0x8B, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xFD, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1,
-    0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x55, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x03, 0x8B, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xED, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x01, 0x00, 0x40, 0xE2, 0x00, 0x3C, 0x80, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xDD, 0x09, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0x3C, 0x56, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xD5, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x0C, 0x00, 0xDB, 0xE7, 0x00, 0x3C, 0x56, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3,
-    0x09, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xCC, 0x09, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0,
-    0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x09, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xC0, 0x09, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x00, 0xDB, 0xE7, 0x01, 0x00, 0x80, 0xE2, 0x00, 0x3C, 0x80, 0xE1,
-    0x0C, 0x00, 0xCB, 0xE7, 0x0F, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0xB7, 0x09, 0x00, 0xEA, 0x01, 0x64, 0x86, 0xE2, 0x46, 0x3C, 0xA0, 0xE1, 0x06, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xB1, 0x09, 0x00, 0xEA, 0x01, 0x00, 0xD9, 0xE4,
-    0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0, 0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1,
-    0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73, 0x06, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xA6, 0x09, 0x00, 0xEA, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xA2, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7,
-    0x00, 0x3C, 0x56, 0xE0, 0x43, 0x3C, 0xA0, 0xE1, 0x01, 0x80, 0x88, 0xE3, 0x03, 0x8B, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x95, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0, 0xFF, 0x54, 0x05, 0xE2,
-    0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73, 0x03, 0x8B, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x85, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0x01, 0x00, 0x80, 0xE2, 0x00, 0x3C, 0x80, 0xE1, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x76, 0x09, 0x00, 0xEA, 0xFF, 0x00, 0x13, 0xE3, 0x17, 0x00, 0x00, 0x1A,
-    0xD1, 0x00, 0xD9, 0xE0, 0xFF, 0x1C, 0x09, 0xE2, 0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2,
-    0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12, 0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x5C, 0x09, 0x00, 0xEA, 0xFF, 0x00, 0x13, 0xE3, 0x0B, 0x00, 0x00, 0x1A,
-    0xD1, 0x00, 0xD9, 0xE0, 0x04, 0x00, 0x70, 0xE3, 0x13, 0x00, 0x00, 0x0A, 0xFF, 0x1C, 0x09, 0xE2,
-    0x00, 0x90, 0x89, 0xE0, 0xFF, 0x2C, 0x09, 0xE2, 0x02, 0x00, 0x51, 0xE1, 0x03, 0x8C, 0x48, 0x12,
-    0x09, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x4E, 0x09, 0x00, 0xEA,
-    0x01, 0x90, 0x89, 0xE2, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x57, 0x09, 0x00, 0xEA, 0x18, 0x18, 0x9A, 0xE5, 0x01, 0x00, 0x59, 0xE1, 0x60, 0xF2, 0x9F, 0x05,
-    0x03, 0x00, 0x70, 0xE3, 0x5C, 0xF2, 0x9F, 0x05, 0xBD, 0xF9, 0xFF, 0xEA, 0x18, 0x18, 0x9A, 0xE5,
-    0x01, 0x00, 0x59, 0xE1, 0xBA, 0xF9, 0xFF, 0x1A, 0x44, 0xF2, 0x9F, 0xE5, 0x01, 0x00, 0xD9, 0xE4,
-    0xFF, 0x00, 0x50, 0xE3, 0x0B, 0xC0, 0xF0, 0xE7, 0x01, 0x0C, 0x40, 0x02, 0x01, 0x10, 0xD0, 0xE5,
-    0x0C, 0x2C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1,
-    0x00, 0x5C, 0xD5, 0xE0, 0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3,
-    0x40, 0x80, 0xC8, 0x73, 0x0F, 0x8C, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x37, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0, 0x2C, 0x0C, 0xDB, 0xE7,
-    0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0, 0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1,
-    0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73, 0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0x2A, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0xCC, 0x86, 0xE0,
-    0x2C, 0x0C, 0xDB, 0xE7, 0x01, 0x00, 0x80, 0xE2, 0x00, 0x3C, 0x80, 0xE1, 0x2C, 0x0C, 0xCB, 0xE7,
-    0x12, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x20, 0x09, 0x00, 0xEA,
-    0x08, 0x80, 0x88, 0xE3, 0x06, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57,
-    0x1B, 0x09, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x97, 0xE0, 0x03, 0x8C, 0x48, 0x22,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x27, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0,
-    0xFF, 0x54, 0x05, 0xE2, 0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73,
-    0x03, 0x8B, 0xD8, 0xE2, 0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0x08, 0x09, 0x00, 0xEA,
-    0x01, 0xC0, 0xD9, 0xE4, 0x0C, 0x0C, 0x96, 0xE0, 0x03, 0x8C, 0x48, 0x22, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2,
-    0x01, 0xF1, 0x9A, 0xE7, 0xA8, 0x10, 0xB0, 0xE1, 0x00, 0x5C, 0xD5, 0xE0, 0xFF, 0x54, 0x05, 0xE2,
-    0x45, 0x3C, 0xA0, 0xE1, 0x41, 0x80, 0x88, 0xE3, 0x40, 0x80, 0xC8, 0x73, 0x03, 0x8B, 0xD8, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xF5, 0x08, 0x00, 0xEA, 0x01, 0xC0, 0xD9, 0xE4,
-    0x01, 0x00, 0xD9, 0xE4, 0x00, 0xC4, 0x8C, 0xE1, 0x26, 0xCC, 0x8C, 0xE0, 0xAC, 0x16, 0xE0, 0xE1,
-    0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x9A, 0xE7, 0x01, 0x00, 0x80, 0xE2, 0x00, 0x3C, 0x80, 0xE1,
-    0xAC, 0x16, 0xE0, 0xE1, 0x00, 0xE0, 0x8F, 0xE2, 0x01, 0xF1, 0x94, 0xE7, 0x15, 0x8C, 0x58, 0xE2,
-    0x01, 0x00, 0xD9, 0x54, 0x00, 0xF1, 0x9A, 0x57, 0xE5, 0x08, 0x00, 0xEA, 0x20, 0x04, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x03, 0x00, 0x00, 0x1A, 0x00, 0x80, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xDE, 0x08, 0x00, 0xEA, 0x04, 0x00, 0x18, 0xE3, 0xF9, 0xFF, 0xFF, 0x1A,
-    0x84, 0xC0, 0x9F, 0xE5, 0x03, 0x00, 0x00, 0xEB, 0x15, 0x8C, 0x58, 0xE2, 0x01, 0x00, 0xD9, 0x54,
-    0x00, 0xF1, 0x9A, 0x57, 0xD6, 0x08, 0x00, 0xEA, 0x28, 0x04, 0x9A, 0xE5, 0x00, 0x00, 0x49, 0xE0,
-    0x20, 0x14, 0xA0, 0xE1, 0x1C, 0x24, 0x9A, 0xE5, 0x01, 0x10, 0x42, 0xE4, 0x01, 0x2C, 0x82, 0xE3,
-    0x01, 0x00, 0x42, 0xE4, 0x1C, 0x24, 0xCA, 0xE5, 0x4D, 0x00, 0x08, 0xE2, 0x02, 0x01, 0x13, 0xE3,
-    0x80, 0x00, 0x80, 0x13, 0xFF, 0x00, 0x13, 0xE3, 0x02, 0x00, 0x80, 0x03, 0x20, 0x00, 0x80, 0xE3,
-    0x1C, 0x24, 0x9A, 0xE5, 0x01, 0x00, 0x42, 0xE4, 0x1C, 0x24, 0xCA, 0xE5, 0x04, 0x80, 0x88, 0xE3,
-    0x28, 0x00, 0x1A, 0xE5, 0x0C, 0x90, 0xF0, 0xE7, 0x01, 0x20, 0xD0, 0xE5, 0x02, 0x94, 0x89, 0xE1,
-    0x0E, 0x1A, 0x09, 0xE2, 0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x14, 0x3B, 0x00, 0x06, 0x38, 0x3A, 0x00, 0x06, 0xFE, 0xFF, 0x00, 0x00,
-    0x00, 0x60, 0xA0, 0xE3, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
-    0x02, 0x00, 0x00, 0x1A, 0x01, 0x80, 0xD0, 0xE4, 0x01, 0x80, 0xC1, 0xE4, 0xF7, 0xFF, 0xFF, 0xEA,
-    0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x26, 0x00, 0x00, 0x0A,
-    0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x17, 0x00, 0x00, 0x0A,
-    0x00, 0x40, 0xA0, 0xE3, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
-    0x01, 0x40, 0x84, 0x12, 0x84, 0x40, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24,
-    0x03, 0x00, 0x12, 0xE1, 0x01, 0x40, 0x84, 0x12, 0x84, 0x40, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1,
-    0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x01, 0x40, 0x84, 0x12, 0x84, 0x40, 0xA0, 0xE1,
-    0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1, 0x01, 0x40, 0x84, 0x12,
-    0x00, 0x00, 0x54, 0xE3, 0x04, 0x40, 0x51, 0x17, 0x01, 0x40, 0xC1, 0xE4, 0xD7, 0xFF, 0xFF, 0xEA,
-    0x01, 0x40, 0xD0, 0xE4, 0xA4, 0x70, 0xB0, 0xE1, 0x2E, 0x00, 0x00, 0x0A, 0x07, 0x80, 0x51, 0x27,
-    0x01, 0x80, 0xC1, 0x24, 0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4, 0x07, 0x80, 0x51, 0xE7,
-    0x01, 0x80, 0xC1, 0xE4, 0x01, 0x60, 0xA0, 0xE3, 0xCD, 0xFF, 0xFF, 0xEA, 0x1A, 0x00, 0x00, 0xEB,
-    0x02, 0x40, 0x44, 0xE2, 0x00, 0x00, 0x56, 0xE3, 0x09, 0x00, 0x00, 0x1A, 0x01, 0x60, 0xA0, 0xE3,
-    0x00, 0x00, 0x54, 0xE3, 0x05, 0x00, 0x00, 0x1A, 0x13, 0x00, 0x00, 0xEB, 0x07, 0x80, 0x51, 0xE7,
-    0x01, 0x80, 0xC1, 0xE4, 0x01, 0x40, 0x54, 0xE2, 0xFB, 0xFF, 0xFF, 0x1A, 0xC0, 0xFF, 0xFF, 0xEA,
-    0x01, 0x40, 0x44, 0xE2, 0x01, 0x80, 0xD0, 0xE4, 0x04, 0x74, 0x88, 0xE0, 0x0A, 0x00, 0x00, 0xEB,
-    0x7D, 0x0C, 0x57, 0xE3, 0x01, 0x40, 0x84, 0xA2, 0x05, 0x0C, 0x57, 0xE3, 0x01, 0x40, 0x84, 0xA2,
-    0x80, 0x00, 0x57, 0xE3, 0x02, 0x40, 0x84, 0xB2, 0x07, 0x80, 0x51, 0xE7, 0x01, 0x80, 0xC1, 0xE4,
-    0x01, 0x40, 0x54, 0xE2, 0xFB, 0xFF, 0xFF, 0x1A, 0xB1, 0xFF, 0xFF, 0xEA, 0x01, 0x40, 0xA0, 0xE3,
-    0x84, 0x40, 0xA0, 0xE1, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
-    0x01, 0x40, 0x84, 0x12, 0xE3, 0x30, 0xB0, 0xE1, 0x01, 0x20, 0xD0, 0x24, 0x03, 0x00, 0x12, 0xE1,
-    0xF6, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1, 0xF0, 0x47, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x20, 0x11, 0xB0, 0xE1, 0x01, 0x00, 0x10, 0xE3, 0x02, 0x00, 0x00, 0x3A, 0x48, 0x08, 0x9F, 0x15,
-    0x48, 0x08, 0x9F, 0x05, 0x06, 0x00, 0x00, 0xEA, 0x44, 0x08, 0x9F, 0x05, 0x44, 0x08, 0x9F, 0x15,
-    0x03, 0x00, 0x00, 0xEA, 0x3C, 0x08, 0x9F, 0x05, 0x34, 0x08, 0x9F, 0x15, 0x00, 0x00, 0x00, 0xEA,
-    0x34, 0x08, 0x9F, 0xE5, 0x28, 0x15, 0xDA, 0xE5, 0x18, 0x00, 0x11, 0xE3, 0x28, 0x08, 0x9F, 0x15,
-    0x39, 0x40, 0x2D, 0xE9, 0x00, 0x50, 0x2D, 0xE9, 0x2F, 0x08, 0x00, 0xEB, 0x0C, 0x20, 0xA0, 0xE1,
-    0x00, 0x50, 0xBD, 0xE8, 0xF0, 0x00, 0x52, 0xE3, 0xF0, 0x20, 0xA0, 0x83, 0x30, 0x05, 0x9A, 0xE5,
-    0x34, 0x15, 0xDA, 0xE5, 0x2F, 0x01, 0x00, 0xEB, 0x04, 0x00, 0x9D, 0xE4, 0x04, 0x30, 0x90, 0xE4,
-    0x10, 0x35, 0x8A, 0xE5, 0x66, 0x1E, 0x8A, 0xE2, 0x3C, 0x00, 0xB0, 0xE8, 0x3C, 0x00, 0x81, 0xE8,
-    0x62, 0x1E, 0x8A, 0xE2, 0x3C, 0x00, 0xB0, 0xE8, 0x3C, 0x00, 0xA1, 0xE8, 0x1C, 0x00, 0x81, 0xE8,
-    0x38, 0x80, 0xBD, 0xE8, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x06, 0x00, 0xE0, 0xC3, 0x04, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x21, 0x91, 0xE7, 0x06, 0x2A, 0x52, 0xE2, 0x38, 0x20, 0x0A, 0xE5,
-    0x2B, 0x00, 0x00, 0xEA, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x06, 0x00, 0xE0, 0xC4, 0x04, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x21, 0x91, 0xE7, 0x02, 0x29, 0x52, 0xE2, 0x34, 0x20, 0x0A, 0xE5,
-    0x23, 0x00, 0x00, 0xEA, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x06, 0x00, 0xE0, 0xC5, 0x04, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x21, 0x91, 0xE7, 0x0A, 0x2A, 0x52, 0xE2, 0x30, 0x20, 0x0A, 0xE5,
-    0x1B, 0x00, 0x00, 0xEA, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x06, 0x00, 0xE0, 0xC6, 0x04, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x21, 0x91, 0xE7, 0x03, 0x29, 0x52, 0xE2, 0x2C, 0x20, 0x0A, 0xE5,
-    0x13, 0x00, 0x00, 0xEA, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x06, 0x00, 0xE0, 0xC7, 0x04, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x21, 0x91, 0xE7, 0x0E, 0x2A, 0x52, 0xE2, 0x28, 0x20, 0x0A, 0xE5,
-    0x0B, 0x00, 0x00, 0xEA, 0xA0, 0x00, 0xA0, 0xE1, 0x14, 0x15, 0x9A, 0xE5, 0x21, 0x07, 0x00, 0xE0,
-    0x80, 0x00, 0xA0, 0xE1, 0xC4, 0x04, 0xCA, 0xE5, 0x01, 0x20, 0x80, 0xE2, 0xC5, 0x24, 0xCA, 0xE5,
-    0x20, 0x15, 0x9A, 0xE5, 0x00, 0x01, 0xB1, 0xE7, 0x02, 0x09, 0x50, 0xE2, 0x34, 0x00, 0x0A, 0xE5,
-    0x30, 0x00, 0x0A, 0xE5, 0x28, 0x14, 0x9A, 0xE5, 0x01, 0x90, 0x49, 0xE0, 0x0E, 0x1A, 0x09, 0xE2,
-    0xA1, 0x05, 0x94, 0xE7, 0x28, 0x04, 0x8A, 0xE5, 0x00, 0x90, 0x89, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1,
-    0xA0, 0x00, 0xA0, 0xE1, 0x14, 0x15, 0x9A, 0xE5, 0x21, 0x07, 0x00, 0xE0, 0x80, 0x00, 0xA0, 0xE1,
-    0xC6, 0x04, 0xCA, 0xE5, 0x01, 0x20, 0x80, 0xE2, 0xC7, 0x24, 0xCA, 0xE5, 0x20, 0x15, 0x9A, 0xE5,
-    0x00, 0x01, 0xB1, 0xE7, 0x03, 0x09, 0x50, 0xE2, 0x2C, 0x00, 0x0A, 0xE5, 0x28, 0x00, 0x0A, 0xE5,
-    0xEB, 0xFF, 0xFF, 0xEA, 0xA0, 0x00, 0xA0, 0xE1, 0x14, 0x15, 0x9A, 0xE5, 0xA1, 0x07, 0x00, 0xE0,
-    0xA8, 0x16, 0x9F, 0xE5, 0x00, 0x24, 0x80, 0xE1, 0x02, 0x28, 0x82, 0xE1, 0x02, 0x21, 0x81, 0xE1,
-    0xC4, 0x24, 0x8A, 0xE5, 0x20, 0x15, 0x9A, 0xE5, 0x00, 0x02, 0xB1, 0xE7, 0x02, 0x09, 0x50, 0xE2,
-    0x34, 0x00, 0x0A, 0xE5, 0x30, 0x00, 0x0A, 0xE5, 0x08, 0x00, 0xB1, 0xE5, 0x03, 0x09, 0x50, 0xE2,
-    0x2C, 0x00, 0x0A, 0xE5, 0x28, 0x00, 0x0A, 0xE5, 0xD9, 0xFF, 0xFF, 0xEA, 0xBC, 0x48, 0x00, 0x03,
-    0xD8, 0x48, 0x00, 0x03, 0xF4, 0x48, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03,
-    0x48, 0x49, 0x00, 0x03, 0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0x1C, 0x25, 0x9A, 0xE5,
-    0x22, 0x05, 0x00, 0xE0, 0xC8, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7,
-    0x40, 0x16, 0x8A, 0xE5, 0x9B, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0,
-    0xC9, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x44, 0x16, 0x8A, 0xE5,
-    0x94, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xCA, 0x04, 0xCA, 0xE5,
-    0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x48, 0x16, 0x8A, 0xE5, 0x8D, 0x00, 0x00, 0xEA,
-    0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xCB, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5,
-    0x00, 0x11, 0x91, 0xE7, 0x4C, 0x16, 0x8A, 0xE5, 0x86, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5,
-    0x22, 0x05, 0x00, 0xE0, 0xCC, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7,
-    0x50, 0x16, 0x8A, 0xE5, 0x7F, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0,
-    0xCD, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x54, 0x16, 0x8A, 0xE5,
-    0x78, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xCE, 0x04, 0xCA, 0xE5,
-    0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x58, 0x16, 0x8A, 0xE5, 0x71, 0x00, 0x00, 0xEA,
-    0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xCF, 0x04, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5,
-    0x00, 0x11, 0x91, 0xE7, 0x5C, 0x16, 0x8A, 0xE5, 0x6A, 0x00, 0x00, 0xEA, 0xA0, 0x00, 0xA0, 0xE1,
-    0x80, 0x00, 0xA0, 0xE1, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xC8, 0x04, 0xCA, 0xE5,
-    0x01, 0x20, 0x80, 0xE3, 0xC9, 0x24, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7,
-    0x40, 0x16, 0x8A, 0xE5, 0x01, 0x1B, 0x81, 0xE2, 0x44, 0x16, 0x8A, 0xE5, 0x5D, 0x00, 0x00, 0xEA,
-    0xA0, 0x00, 0xA0, 0xE1, 0x80, 0x00, 0xA0, 0xE1, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0,
-    0xCA, 0x04, 0xCA, 0xE5, 0x01, 0x20, 0x80, 0xE3, 0xCB, 0x24, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5,
-    0x00, 0x11, 0x91, 0xE7, 0x48, 0x16, 0x8A, 0xE5, 0x01, 0x1B, 0x81, 0xE2, 0x4C, 0x16, 0x8A, 0xE5,
-    0x50, 0x00, 0x00, 0xEA, 0xA0, 0x00, 0xA0, 0xE1, 0x80, 0x00, 0xA0, 0xE1, 0x1C, 0x25, 0x9A, 0xE5,
-    0x22, 0x05, 0x00, 0xE0, 0xCC, 0x04, 0xCA, 0xE5, 0x01, 0x20, 0x80, 0xE3, 0xCD, 0x24, 0xCA, 0xE5,
-    0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x50, 0x16, 0x8A, 0xE5, 0x01, 0x1B, 0x81, 0xE2,
-    0x54, 0x16, 0x8A, 0xE5, 0x43, 0x00, 0x00, 0xEA, 0xA0, 0x00, 0xA0, 0xE1, 0x80, 0x00, 0xA0, 0xE1,
-    0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x05, 0x00, 0xE0, 0xCE, 0x04, 0xCA, 0xE5, 0x01, 0x20, 0x80, 0xE3,
-    0xCF, 0x24, 0xCA, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x11, 0x91, 0xE7, 0x58, 0x16, 0x8A, 0xE5,
-    0x01, 0x1B, 0x81, 0xE2, 0x5C, 0x16, 0x8A, 0xE5, 0x36, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5,
-    0x22, 0x06, 0x00, 0xE0, 0x00, 0x14, 0x80, 0xE1, 0x01, 0x18, 0x81, 0xE1, 0x8C, 0x24, 0x9F, 0xE5,
-    0x01, 0x21, 0x82, 0xE1, 0xC8, 0x24, 0x8A, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x12, 0x91, 0xE7,
-    0x06, 0x0C, 0x8A, 0xE2, 0x40, 0x00, 0x80, 0xE2, 0x01, 0x2B, 0x81, 0xE2, 0x06, 0x00, 0xA0, 0xE8,
-    0x01, 0x1B, 0x82, 0xE2, 0x01, 0x2B, 0x81, 0xE2, 0x06, 0x00, 0xA0, 0xE8, 0x25, 0x00, 0x00, 0xEA,
-    0xA0, 0x00, 0xA0, 0xE1, 0x1C, 0x25, 0x9A, 0xE5, 0xA2, 0x06, 0x00, 0xE0, 0x00, 0x14, 0x80, 0xE1,
-    0x01, 0x18, 0x81, 0xE1, 0x44, 0x24, 0x9F, 0xE5, 0x81, 0x21, 0x82, 0xE1, 0xC8, 0x24, 0x8A, 0xE5,
-    0x3C, 0x24, 0x9F, 0xE5, 0x81, 0x21, 0x82, 0xE1, 0xCC, 0x24, 0x8A, 0xE5, 0x24, 0x15, 0x9A, 0xE5,
-    0x80, 0x12, 0x91, 0xE7, 0x06, 0x0C, 0x8A, 0xE2, 0x40, 0x00, 0x80, 0xE2, 0x01, 0x2B, 0x81, 0xE2,
-    0x06, 0x00, 0xA0, 0xE8, 0x01, 0x1B, 0x82, 0xE2, 0x01, 0x2B, 0x81, 0xE2, 0x06, 0x00, 0xA0, 0xE8,
-    0x01, 0x1B, 0x82, 0xE2, 0x0A, 0x00, 0x00, 0xEA, 0x1C, 0x25, 0x9A, 0xE5, 0x22, 0x06, 0x00, 0xE0,
-    0x00, 0x14, 0x80, 0xE1, 0x01, 0x18, 0x81, 0xE1, 0xF0, 0x23, 0x9F, 0xE5, 0x01, 0x21, 0x82, 0xE1,
-    0xCC, 0x24, 0x8A, 0xE5, 0x24, 0x15, 0x9A, 0xE5, 0x00, 0x12, 0x91, 0xE7, 0x06, 0x0C, 0x8A, 0xE2,
-    0x50, 0x00, 0x80, 0xE2, 0x01, 0x2B, 0x81, 0xE2, 0x06, 0x00, 0xA0, 0xE8, 0x01, 0x1B, 0x82, 0xE2,
-    0x01, 0x2B, 0x81, 0xE2, 0x06, 0x00, 0xA0, 0xE8, 0x38, 0x50, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1,
-    0xC0, 0xF3, 0x9F, 0xE5, 0x58, 0x24, 0xDA, 0xE5, 0x10, 0x00, 0x12, 0xE3, 0xC8, 0x14, 0x9A, 0x05,
-    0xCC, 0x14, 0x9A, 0x15, 0x30, 0x05, 0x9A, 0xE5, 0x30, 0x15, 0x8A, 0xE5, 0x0E, 0x07, 0x00, 0xEB,
-    0x0C, 0x20, 0xA0, 0xE1, 0x38, 0x50, 0xBD, 0xE8, 0xF0, 0x00, 0x52, 0xE3, 0xF0, 0x20, 0xA0, 0x83,
-    0x34, 0x15, 0xDA, 0xE5, 0x01, 0x10, 0x52, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0x03, 0x00, 0x51, 0xE3,
-    0x0C, 0x00, 0x00, 0x5A, 0x04, 0x40, 0x2D, 0xE9, 0x01, 0x2B, 0x8A, 0xE2, 0xD0, 0x20, 0x82, 0xE2,
-    0x04, 0x10, 0x92, 0xE4, 0x01, 0x00, 0x50, 0xE1, 0x04, 0x10, 0x92, 0x14, 0x01, 0x00, 0x50, 0x11,
-    0x04, 0x10, 0x92, 0x14, 0x01, 0x00, 0x50, 0x11, 0x04, 0x10, 0x92, 0x14, 0x01, 0x00, 0x50, 0x11,
-    0x04, 0x80, 0xBD, 0x18, 0x04, 0x40, 0xBD, 0x08, 0xFC, 0x50, 0x2D, 0xE9, 0x13, 0x00, 0x00, 0xEB,
-    0x7C, 0x00, 0xBD, 0xE8, 0x00, 0x15, 0xDA, 0xE5, 0x10, 0x05, 0x9A, 0xE5, 0x00, 0x10, 0x81, 0xE1,
-    0x34, 0x05, 0xDA, 0xE5, 0x34, 0x25, 0xCA, 0xE5, 0x00, 0x00, 0x52, 0xE3, 0x06, 0x00, 0x00, 0x0A,
-    0x00, 0x20, 0x52, 0xE0, 0x04, 0x00, 0x00, 0x0A, 0x00, 0x20, 0x82, 0xB0, 0x00, 0x00, 0xA0, 0xB3,
-    0xB0, 0x76, 0x9A, 0xE5, 0x80, 0x00, 0x87, 0xE0, 0x47, 0x01, 0x00, 0xEB, 0x80, 0x90, 0xBD, 0xE8,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x30, 0x05, 0x9A, 0xE5, 0xEA, 0xFF, 0xFF, 0xEB, 0x1C, 0xFF, 0x2F, 0xE1,
-    0x01, 0x6B, 0x8A, 0xE2, 0xD0, 0x60, 0x86, 0xE2, 0x06, 0x20, 0xA0, 0xE1, 0x00, 0x10, 0x92, 0xE5,
-    0x01, 0x00, 0x50, 0xE1, 0x04, 0x10, 0xB2, 0x15, 0x01, 0x00, 0x50, 0x11, 0x04, 0x10, 0xB2, 0x15,
-    0x01, 0x00, 0x50, 0x11, 0x04, 0x10, 0xB2, 0x15, 0x01, 0x00, 0x50, 0x11, 0x12, 0x00, 0x00, 0x1A,
-    0x05, 0x4C, 0x8A, 0xE2, 0x00, 0x40, 0x84, 0xE2, 0x06, 0x70, 0x42, 0xE0, 0x07, 0x20, 0xA0, 0xE1,
-    0x00, 0x00, 0xD4, 0xE5, 0x00, 0x00, 0x57, 0xE1, 0x62, 0x24, 0x80, 0x11, 0x01, 0x00, 0xD4, 0xE5,
-    0x00, 0x00, 0x57, 0xE1, 0x62, 0x24, 0x80, 0x11, 0x02, 0x00, 0xD4, 0xE5, 0x00, 0x00, 0x57, 0xE1,
-    0x62, 0x24, 0x80, 0x11, 0x03, 0x00, 0xD4, 0xE5, 0x00, 0x00, 0x57, 0xE1, 0x62, 0x24, 0x80, 0x11,
-    0x62, 0x24, 0xA0, 0xE1, 0x00, 0x20, 0x84, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x25, 0x9A, 0xE5,
-    0x22, 0x7C, 0xA0, 0xE1, 0x07, 0x10, 0x96, 0xE7, 0x07, 0x00, 0xA6, 0xE7, 0x62, 0x2C, 0xA0, 0xE1,
-    0x00, 0x25, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x10, 0x70, 0xA0, 0xE3, 0x01, 0x40, 0xD3, 0xE4,
-    0x00, 0x00, 0x54, 0xE1, 0x0A, 0x00, 0x00, 0x0A, 0x01, 0x70, 0x57, 0xE2, 0xFA, 0xFF, 0xFF, 0x1A,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x40, 0x32, 0x9F, 0xE5, 0x00, 0x70, 0xD3, 0xE5, 0x07, 0x00, 0x54, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x11, 0x06, 0x00, 0x2D, 0xE9, 0x30, 0x12, 0x9F, 0xE5, 0x84, 0x15, 0x81, 0xE0,
-    0x06, 0x00, 0x00, 0xEA, 0x06, 0x00, 0x2D, 0xE9, 0x06, 0x14, 0xA0, 0xE3, 0x10, 0x70, 0x67, 0xE2,
-    0x0C, 0x20, 0x07, 0xE2, 0x03, 0x70, 0x07, 0xE2, 0x87, 0x15, 0x81, 0xE0, 0x02, 0x16, 0x81, 0xE0,
-    0x0F, 0x00, 0xC6, 0xE5, 0x05, 0x00, 0xA0, 0xE1, 0x02, 0x2B, 0xA0, 0xE3, 0x27, 0x01, 0x00, 0xEB,
-    0x02, 0x5B, 0x85, 0xE2, 0x06, 0x00, 0xBD, 0xE8, 0x0D, 0x00, 0x00, 0xEA, 0x00, 0x40, 0x2D, 0xE9,
-    0xEC, 0x21, 0x9F, 0xE5, 0xFF, 0x00, 0x11, 0xE3, 0x01, 0x00, 0xD6, 0xE4, 0x21, 0x14, 0xA0, 0xE1,
-    0x02, 0x5B, 0x85, 0x02, 0x06, 0x00, 0x00, 0x0A, 0xD8, 0x31, 0x9F, 0xE5, 0xD9, 0xFF, 0xFF, 0xEB,
-    0x40, 0x30, 0xA0, 0xE3, 0x0F, 0x00, 0xC6, 0xE5, 0x24, 0x45, 0x9A, 0xE5, 0x00, 0x41, 0x94, 0xE7,
-    0x02, 0x00, 0x00, 0xEB, 0x03, 0x00, 0x16, 0xE3, 0xF1, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8,
-    0x42, 0x54, 0x2D, 0xE9, 0xFF, 0xE0, 0xA0, 0xE3, 0x00, 0x1E, 0xB4, 0xE8, 0x09, 0x70, 0x1E, 0xE0,
-    0x07, 0x71, 0x92, 0x17, 0x0B, 0x80, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17, 0x88, 0x00, 0x87, 0xE1,
-    0x29, 0x74, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17, 0x2B, 0x84, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17,
-    0x88, 0x10, 0x87, 0xE1, 0x29, 0x78, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17, 0x2B, 0x88, 0x1E, 0xE0,
-    0x08, 0x81, 0x92, 0x17, 0x88, 0x60, 0x87, 0xE1, 0x29, 0x7C, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17,
-    0x2B, 0x8C, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17, 0x88, 0x70, 0x87, 0xE1, 0xC3, 0x00, 0xA5, 0xE8,
-    0x0A, 0x70, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17, 0x0C, 0x80, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17,
-    0x88, 0x00, 0x87, 0xE1, 0x2A, 0x74, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17, 0x2C, 0x84, 0x1E, 0xE0,
-    0x08, 0x81, 0x92, 0x17, 0x88, 0x10, 0x87, 0xE1, 0x2A, 0x78, 0x1E, 0xE0, 0x07, 0x71, 0x92, 0x17,
-    0x2C, 0x88, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17, 0x88, 0x60, 0x87, 0xE1, 0x2A, 0x7C, 0x1E, 0xE0,
-    0x07, 0x71, 0x92, 0x17, 0x2C, 0x8C, 0x1E, 0xE0, 0x08, 0x81, 0x92, 0x17, 0x88, 0x70, 0x87, 0xE1,
-    0xC3, 0x00, 0xA5, 0xE8, 0x01, 0x30, 0x53, 0xE2, 0xD2, 0xFF, 0xFF, 0x1A, 0x42, 0x94, 0xBD, 0xE8,
-    0x40, 0x42, 0x2D, 0xE9, 0xFF, 0xE0, 0xA0, 0xE3, 0x00, 0x0E, 0xB4, 0xE8, 0x09, 0x50, 0x1E, 0xE0,
-    0x05, 0x51, 0x92, 0x17, 0x0B, 0xC0, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17, 0x8C, 0x00, 0x85, 0xE1,
-    0x29, 0x54, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17, 0x2B, 0xC4, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17,
-    0x8C, 0x10, 0x85, 0xE1, 0x29, 0x58, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17, 0x2B, 0xC8, 0x1E, 0xE0,
-    0x0C, 0xC1, 0x92, 0x17, 0x8C, 0x60, 0x85, 0xE1, 0x29, 0x5C, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17,
-    0x2B, 0xCC, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17, 0x8C, 0xC0, 0x85, 0xE1, 0x43, 0x10, 0xA7, 0xE8,
-    0x43, 0x10, 0xA8, 0xE8, 0x00, 0x02, 0xB4, 0xE8, 0x0A, 0x50, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17,
-    0x09, 0xC0, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17, 0x8C, 0x00, 0x85, 0xE1, 0x2A, 0x54, 0x1E, 0xE0,
-    0x05, 0x51, 0x92, 0x17, 0x29, 0xC4, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17, 0x8C, 0x10, 0x85, 0xE1,
-    0x2A, 0x58, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17, 0x29, 0xC8, 0x1E, 0xE0, 0x0C, 0xC1, 0x92, 0x17,
-    0x8C, 0x60, 0x85, 0xE1, 0x2A, 0x5C, 0x1E, 0xE0, 0x05, 0x51, 0x92, 0x17, 0x29, 0xCC, 0x1E, 0xE0,
-    0x0C, 0xC1, 0x92, 0x17, 0x8C, 0xC0, 0x85, 0xE1, 0x43, 0x10, 0xA7, 0xE8, 0x43, 0x10, 0xA8, 0xE8,
-    0x01, 0x30, 0x53, 0xE2, 0xCF, 0xFF, 0xFF, 0x1A, 0x40, 0x82, 0xBD, 0xE8, 0x58, 0x64, 0x00, 0x08,
-    0x34, 0x64, 0x00, 0x08, 0x7C, 0x64, 0x00, 0x08, 0xA0, 0x64, 0x00, 0x08, 0xC4, 0x64, 0x00, 0x08,
-    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xCC, 0x63, 0x00, 0x03, 0x50, 0xEF, 0x03, 0x02,
-    0x00, 0x00, 0x01, 0x06, 0xEC, 0x76, 0x00, 0x03, 0x2C, 0x73, 0x00, 0x03, 0xE3, 0x30, 0xB0, 0xE1,
-    0x04, 0x40, 0xB5, 0x25, 0x03, 0x00, 0x14, 0xE1, 0x08, 0x00, 0x00, 0x0A, 0x06, 0x80, 0xD2, 0xE7,
-    0x06, 0xA0, 0xD7, 0xE7, 0x0A, 0x00, 0x58, 0xE1, 0x03, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x51, 0xE3,
-    0x03, 0x40, 0xC4, 0x11, 0x00, 0x40, 0x85, 0x15, 0x00, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x80, 0xE2,
-    0x01, 0x60, 0x86, 0xE2, 0x0A, 0x0B, 0x56, 0xE3, 0xEF, 0xFF, 0xFF, 0x1A, 0xFE, 0x47, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x12, 0x90, 0xE5, 0x21, 0x38, 0x11, 0xE0, 0x1E, 0xFF, 0x2F, 0x01,
-    0xB8, 0x20, 0x50, 0xE1, 0x03, 0x20, 0x82, 0xE1, 0xB8, 0x20, 0x40, 0xE1, 0x80, 0x20, 0x13, 0xE2,
-    0xE4, 0xF0, 0x9F, 0x15, 0xFF, 0x0C, 0x13, 0xE3, 0x23, 0x34, 0xA0, 0x11, 0x08, 0x20, 0x82, 0x12,
-    0xF0, 0x00, 0x13, 0xE3, 0x23, 0x32, 0xA0, 0x11, 0x04, 0x20, 0x82, 0x12, 0x0C, 0x00, 0x13, 0xE3,
-    0x23, 0x31, 0xA0, 0x11, 0x02, 0x20, 0x82, 0x12, 0x02, 0x00, 0x13, 0xE3, 0x01, 0x20, 0x82, 0x12,
-    0x01, 0x30, 0xA0, 0xE3, 0x13, 0x32, 0xA0, 0xE1, 0x02, 0xCC, 0x80, 0xE2, 0xB2, 0x30, 0xCC, 0xE1,
-    0xA8, 0xC0, 0x9F, 0xE5, 0x02, 0xC1, 0x9C, 0xE7, 0x0C, 0xC0, 0xB0, 0xE1, 0xE4, 0xFF, 0xFF, 0x0A,
-    0xE6, 0x0C, 0x11, 0xE3, 0x1C, 0xFF, 0x2F, 0x11, 0x08, 0x12, 0x90, 0xE5, 0x08, 0x02, 0x80, 0xE5,
-    0x00, 0x30, 0x4F, 0xE1, 0x0B, 0x40, 0x2D, 0xE9, 0x00, 0x10, 0x0F, 0xE1, 0xDF, 0x10, 0xC1, 0xE3,
-    0x1F, 0x10, 0x81, 0xE3, 0x01, 0xF0, 0x29, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0x00, 0xE0, 0x8F, 0xE2,
-    0x1C, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0xBD, 0xE8, 0x00, 0x10, 0x0F, 0xE1, 0xDF, 0x10, 0xC1, 0xE3,
-    0x92, 0x10, 0x81, 0xE3, 0x01, 0xF0, 0x29, 0xE1, 0x0B, 0x40, 0xBD, 0xE8, 0x08, 0x12, 0x80, 0xE5,
-    0x03, 0xF0, 0x69, 0xE1, 0x00, 0x12, 0x90, 0xE5, 0x21, 0x38, 0x11, 0xE0, 0xCF, 0xFF, 0xFF, 0x1A,
-    0x04, 0x10, 0x90, 0xE5, 0x20, 0x00, 0x11, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x21, 0x28, 0xA0, 0xE1,
-    0x21, 0x14, 0xA0, 0xE1, 0xFF, 0x10, 0x01, 0xE2, 0xA0, 0x00, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0xA1,
-    0xA0, 0x00, 0x52, 0xE3, 0x1E, 0xFF, 0x2F, 0xA1, 0x01, 0x00, 0x52, 0xE1, 0x1E, 0xFF, 0x2F, 0xB1,
-    0x0B, 0xB0, 0xA0, 0xE1, 0x02, 0x20, 0xA0, 0xE3, 0xD4, 0xFF, 0xFF, 0xEA, 0x00, 0x68, 0x00, 0x08,
-    0xAC, 0x76, 0x00, 0x03, 0x11, 0xFF, 0x2F, 0xE1, 0x01, 0x29, 0x4C, 0xE2, 0x15, 0x20, 0x52, 0xE2,
-    0x88, 0x00, 0x00, 0x4A, 0x03, 0x00, 0x52, 0xE3, 0x02, 0xF1, 0x9F, 0x47, 0x08, 0xF0, 0x9F, 0xE5,
-    0xD8, 0x8C, 0x00, 0x08, 0xCC, 0x30, 0x00, 0x06, 0x04, 0x31, 0x00, 0x06, 0xB8, 0x52, 0x00, 0x03,
-    0x01, 0x29, 0x4C, 0xE2, 0x18, 0x00, 0x52, 0xE3, 0x02, 0xF1, 0x9F, 0x47, 0x5C, 0xF0, 0x9F, 0xE5,
-    0xE8, 0x85, 0x00, 0x08, 0x70, 0x86, 0x00, 0x08, 0x80, 0x86, 0x00, 0x08, 0xD8, 0x86, 0x00, 0x08,
-    0x34, 0x87, 0x00, 0x08, 0xBC, 0x87, 0x00, 0x08, 0xCC, 0x87, 0x00, 0x08, 0x24, 0x88, 0x00, 0x08,
-    0x60, 0x88, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x68, 0x88, 0x00, 0x08, 0xA4, 0x88, 0x00, 0x08,
-    0xE4, 0x88, 0x00, 0x08, 0xBC, 0x52, 0x00, 0x03, 0x2C, 0x89, 0x00, 0x08, 0x64, 0x89, 0x00, 0x08,
-    0x8C, 0x89, 0x00, 0x08, 0x10, 0x8A, 0x00, 0x08, 0x24, 0x8A, 0x00, 0x08, 0x3C, 0x8A, 0x00, 0x08,
-    0xC4, 0x80, 0x00, 0x08, 0x34, 0x8B, 0x00, 0x08, 0x80, 0x30, 0x00, 0x06, 0x68, 0x8C, 0x00, 0x08,
-    0xC0, 0x52, 0x00, 0x03, 0xA2, 0x20, 0xA0, 0xE1, 0x03, 0x00, 0x00, 0xEA, 0x01, 0x18, 0x81, 0xE1,
-    0x02, 0x00, 0x10, 0xE3, 0xB2, 0x10, 0xC0, 0x10, 0x01, 0x20, 0x42, 0x12, 0x0C, 0x20, 0x52, 0xE2,
-    0x18, 0x00, 0x00, 0x4A, 0x38, 0x40, 0x2D, 0xE9, 0x01, 0x30, 0xA0, 0xE1, 0x01, 0x40, 0xA0, 0xE1,
-    0x01, 0x50, 0xA0, 0xE1, 0x01, 0xC0, 0xA0, 0xE1, 0x01, 0xE0, 0xA0, 0xE1, 0x3A, 0x50, 0xA0, 0xE8,
-    0x0C, 0x20, 0x52, 0xE2, 0x02, 0x00, 0x00, 0x4A, 0x3A, 0x50, 0xA0, 0xE8, 0x0C, 0x20, 0x52, 0xE2,
-    0xF9, 0xFF, 0xFF, 0x5A, 0x0C, 0x20, 0x92, 0xE2, 0x38, 0x40, 0xBD, 0x08, 0x1E, 0xFF, 0x2F, 0x01,
-    0x04, 0x20, 0x52, 0xE2, 0x05, 0x00, 0x00, 0x4A, 0x02, 0x10, 0xA0, 0xE8, 0x04, 0x20, 0x52, 0xE2,
-    0x02, 0x00, 0x00, 0x4A, 0x02, 0x10, 0xA0, 0xE8, 0x04, 0x20, 0x52, 0xE2, 0xF9, 0xFF, 0xFF, 0x5A,
-    0x08, 0x20, 0x42, 0xE2, 0x38, 0x40, 0xBD, 0xE8, 0x0C, 0x20, 0x92, 0xE2, 0x1E, 0xFF, 0x2F, 0xD1,
-    0xB2, 0x10, 0xC0, 0xE0, 0x01, 0x20, 0x52, 0xE2, 0xFC, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x20, 0x20, 0x52, 0xE2, 0x09, 0x00, 0x00, 0xBA, 0xF8, 0x07, 0x2D, 0xE9, 0xF8, 0x07, 0xB1, 0xE8,
-    0xF8, 0x07, 0xA0, 0xE8, 0x20, 0x20, 0x52, 0xE2, 0x03, 0x00, 0x00, 0xBA, 0xF8, 0x07, 0xB1, 0xE8,
-    0xF8, 0x07, 0xA0, 0xE8, 0x20, 0x20, 0x52, 0xE2, 0xF7, 0xFF, 0xFF, 0xAA, 0xF8, 0x07, 0xBD, 0xE8,
-    0x20, 0x20, 0x92, 0xE2, 0x1E, 0xFF, 0x2F, 0xD1, 0x04, 0xC0, 0x91, 0xE4, 0x04, 0xC0, 0x80, 0xE4,
-    0x04, 0x20, 0x52, 0xE2, 0xFB, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0xC0, 0xD0, 0xE4,
-    0x01, 0xC0, 0xC1, 0xE4, 0x01, 0x20, 0x52, 0xE2, 0xFB, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x01, 0x00, 0x50, 0xE1, 0xE5, 0xFF, 0xFF, 0xDA, 0x02, 0x00, 0x80, 0xE0, 0x02, 0x10, 0x81, 0xE0,
-    0x20, 0x20, 0x52, 0xE2, 0x05, 0x00, 0x00, 0xBA, 0xF8, 0x03, 0x2D, 0xE9, 0xF8, 0x13, 0x31, 0xE9,
-    0xF8, 0x13, 0x20, 0xE9, 0x20, 0x20, 0x52, 0xE2, 0xFB, 0xFF, 0xFF, 0xAA, 0xF8, 0x03, 0xBD, 0xE8,
-    0x20, 0x20, 0x92, 0xE2, 0x1E, 0xFF, 0x2F, 0xD1, 0x04, 0xC0, 0x31, 0xE5, 0x04, 0xC0, 0x20, 0xE5,
-    0x04, 0x20, 0x52, 0xE2, 0xFB, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1, 0x10, 0x20, 0x52, 0xE2,
-    0x07, 0x00, 0x00, 0xBA, 0xF8, 0x03, 0x2D, 0xE9, 0x78, 0x00, 0x91, 0xE8, 0x80, 0x13, 0x90, 0xE8,
-    0x78, 0x00, 0xA0, 0xE8, 0x80, 0x13, 0xA1, 0xE8, 0x10, 0x20, 0x52, 0xE2, 0xF9, 0xFF, 0xFF, 0xAA,
-    0xF8, 0x03, 0xBD, 0xE8, 0x10, 0x20, 0x92, 0xE2, 0x1E, 0xFF, 0x2F, 0xD1, 0x00, 0xC0, 0x91, 0xE5,
-    0x00, 0x30, 0x90, 0xE5, 0x04, 0x30, 0x81, 0xE4, 0x04, 0xC0, 0x80, 0xE4, 0x04, 0x20, 0x52, 0xE2,
-    0xF9, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1, 0x2C, 0x04, 0xA0, 0xE1, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x7E, 0xCB, 0xCC, 0xE3, 0x0C, 0x00, 0xDB, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x7E, 0xCB, 0xCC, 0xE3, 0x0C, 0x00, 0xCB, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1, 0x16, 0x1B, 0x4C, 0xE2,
-    0x01, 0x00, 0xDB, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1, 0x16, 0xCB, 0x4C, 0xE2, 0x0C, 0x00, 0xCB, 0xE7,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x16, 0x1B, 0x4C, 0xE2, 0x01, 0x00, 0xCB, 0xE7, 0x0E, 0x14, 0x8C, 0xE3,
-    0x02, 0x19, 0x81, 0xE2, 0x00, 0x00, 0xC1, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x38, 0x10, 0x1A, 0xE5,
-    0x0C, 0x00, 0xD1, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1, 0x34, 0x10, 0x1A, 0xE5, 0x0C, 0x00, 0xD1, 0xE7,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x30, 0x10, 0x1A, 0xE5, 0x0C, 0x00, 0xD1, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1,
-    0x2C, 0x10, 0x1A, 0xE5, 0x0C, 0x00, 0xD1, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1, 0x28, 0x10, 0x1A, 0xE5,
-    0x0C, 0x00, 0xD1, 0xE7, 0x0E, 0xF0, 0xA0, 0xE1, 0x25, 0x00, 0x00, 0xEB, 0x05, 0x20, 0x62, 0xE2,
-    0x04, 0x30, 0xA0, 0xE3, 0x03, 0x00, 0x52, 0xE1, 0x34, 0x00, 0x00, 0x0B, 0x0B, 0x01, 0x97, 0xE7,
-    0x0C, 0x08, 0x80, 0xE0, 0x04, 0x00, 0x84, 0xE4, 0xB2, 0x00, 0xD8, 0xE0, 0xB2, 0x00, 0xC5, 0xE0,
-    0xB2, 0x00, 0xD9, 0xE0, 0xB2, 0x00, 0xC6, 0xE0, 0x01, 0xB0, 0x8B, 0xE2, 0x01, 0x30, 0x53, 0xE2,
-    0xF3, 0xFF, 0xFF, 0x1A, 0x0A, 0x00, 0x54, 0xE1, 0xEE, 0xFF, 0xFF, 0xBA, 0x00, 0x84, 0xBD, 0xE8,
-    0x01, 0x30, 0xE0, 0xE3, 0x12, 0x00, 0x00, 0xEB, 0x04, 0x20, 0x62, 0xE2, 0x08, 0x30, 0x83, 0xE2,
-    0x01, 0x00, 0x13, 0xE3, 0x20, 0x00, 0x00, 0x1B, 0x0B, 0x01, 0x97, 0xE7, 0x0C, 0x08, 0x80, 0xE0,
-    0x04, 0x00, 0x84, 0xE4, 0xB2, 0x00, 0xD8, 0xE0, 0xB2, 0x00, 0xC5, 0xE0, 0xB2, 0x00, 0xD9, 0xE0,
-    0xB2, 0x00, 0xC6, 0xE0, 0x01, 0xB0, 0x8B, 0xE2, 0xC3, 0x00, 0x52, 0xE1, 0x01, 0x30, 0x83, 0x03,
-    0x02, 0x30, 0x53, 0xE2, 0xF1, 0xFF, 0xFF, 0x5A, 0x0A, 0x00, 0x54, 0xE1, 0xEC, 0xFF, 0xFF, 0xBA,
-    0xE9, 0xFF, 0xFF, 0xEA, 0x00, 0x20, 0xA0, 0xE3, 0x0B, 0x10, 0x82, 0xE0, 0x01, 0x20, 0x82, 0xE2,
-    0x01, 0x01, 0x97, 0xE7, 0x20, 0x18, 0x81, 0xE0, 0x03, 0x10, 0x01, 0xE2, 0xFF, 0x00, 0x51, 0xE3,
-    0x05, 0x00, 0x00, 0x1A, 0x0B, 0x10, 0x82, 0xE0, 0x01, 0x01, 0x97, 0xE7, 0x20, 0x18, 0x81, 0xE0,
-    0x03, 0x10, 0x01, 0xE2, 0xFF, 0x00, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x04, 0x00, 0x52, 0xE3,
-    0xF0, 0xFF, 0xFF, 0xBA, 0xFF, 0x20, 0xA0, 0xE3, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x30, 0xC3, 0xE3,
-    0x01, 0xC0, 0x8C, 0xE2, 0x02, 0x80, 0x88, 0xE2, 0x02, 0x90, 0x89, 0xE2, 0x1C, 0xF0, 0x8E, 0xE2,
-    0xF0, 0x5F, 0x2D, 0xE9, 0x00, 0xAA, 0x9F, 0xE5, 0x01, 0x53, 0xA0, 0xE3, 0xBA, 0x5B, 0xC5, 0xE1,
-    0xB6, 0x5C, 0xC5, 0xE1, 0xBE, 0x5D, 0xC5, 0xE1, 0x0F, 0xE0, 0xA0, 0xE1, 0xEC, 0xF9, 0x9F, 0xE5,
-    0xF8, 0x06, 0xDA, 0xE5, 0x02, 0x00, 0x50, 0xE3, 0x6E, 0x00, 0x00, 0xAA, 0x01, 0x00, 0x2D, 0xE9,
-    0x02, 0x00, 0xA0, 0xE3, 0xF8, 0x06, 0xCA, 0xE5, 0x01, 0x03, 0xA0, 0xE3, 0x01, 0x10, 0xA0, 0xE3,
-    0x08, 0x12, 0xC0, 0xE5, 0x0C, 0x05, 0x9A, 0xE5, 0x08, 0x00, 0x10, 0xE3, 0x04, 0x00, 0x00, 0x0A,
-    0x75, 0x04, 0xDA, 0xE5, 0x01, 0x00, 0x80, 0xE2, 0x06, 0x00, 0x50, 0xE3, 0x00, 0x00, 0xA0, 0x53,
-    0x75, 0x04, 0xCA, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0xA4, 0xF9, 0x9F, 0xE5, 0xF9, 0x06, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x41, 0x00, 0x00, 0x0A, 0xC0, 0x26, 0x9A, 0xE5, 0x0A, 0x3D, 0x82, 0xE2,
-    0xA4, 0x16, 0x9A, 0xE5, 0x0D, 0x05, 0xDA, 0xE5, 0x02, 0x00, 0x50, 0xE3, 0x25, 0x00, 0x00, 0x2A,
-    0x77, 0x04, 0xDA, 0xE5, 0x00, 0x11, 0x81, 0xE0, 0xF0, 0x00, 0xB1, 0xE8, 0x00, 0x48, 0x84, 0xE0,
-    0x00, 0x58, 0x85, 0xE0, 0x00, 0x68, 0x86, 0xE0, 0x00, 0x78, 0x87, 0xE0, 0xF0, 0x00, 0xA2, 0xE8,
-    0x03, 0x00, 0x52, 0xE1, 0xF7, 0xFF, 0xFF, 0x4A, 0x01, 0x00, 0x10, 0xE3, 0x0B, 0x00, 0x00, 0x1A,
-    0x80, 0x30, 0xA0, 0xE1, 0xBC, 0x16, 0x9A, 0xE5, 0xC4, 0x06, 0x9A, 0xE5, 0x05, 0x2D, 0xA0, 0xE3,
-    0x03, 0x10, 0x81, 0xE0, 0x29, 0xFF, 0xFF, 0xEB, 0xB4, 0x16, 0x9A, 0xE5, 0xC8, 0x06, 0x9A, 0xE5,
-    0x05, 0x2D, 0xA0, 0xE3, 0x03, 0x10, 0x81, 0xE0, 0x24, 0xFF, 0xFF, 0xEB, 0x0F, 0x00, 0x00, 0xEA,
-    0xBC, 0x16, 0x9A, 0xE5, 0xB4, 0x26, 0x9A, 0xE5, 0x80, 0x10, 0x81, 0xE0, 0x80, 0x20, 0x82, 0xE0,
-    0xC4, 0x36, 0x9A, 0xE5, 0xC8, 0x46, 0x9A, 0xE5, 0xA0, 0x50, 0xA0, 0xE3, 0xB2, 0x00, 0xD1, 0xE0,
-    0xB2, 0x00, 0xC3, 0xE0, 0xB2, 0x00, 0xD2, 0xE0, 0xB2, 0x00, 0xC4, 0xE0, 0x01, 0x50, 0x55, 0xE2,
-    0xF9, 0xFF, 0xFF, 0x1A, 0x01, 0x00, 0x00, 0xEA, 0x0F, 0xE0, 0xA0, 0xE1, 0xE4, 0xF8, 0x9F, 0xE5,
-    0x01, 0x53, 0xA0, 0xE3, 0xB0, 0x40, 0x85, 0xE2, 0xC0, 0x06, 0x9A, 0xE5, 0x04, 0x10, 0x90, 0xE4,
-    0x10, 0x20, 0x85, 0xE2, 0x00, 0x10, 0x82, 0xE5, 0xCC, 0x38, 0x9F, 0xE5, 0x0D, 0x00, 0xA4, 0xE8,
-    0xC4, 0x06, 0x9A, 0xE5, 0xB2, 0x10, 0xD0, 0xE0, 0x00, 0x20, 0x85, 0xE2, 0xB0, 0x10, 0xC2, 0xE1,
-    0xB8, 0x38, 0x9F, 0xE5, 0x0D, 0x00, 0xA4, 0xE8, 0x0C, 0x40, 0x84, 0xE2, 0xC8, 0x06, 0x9A, 0xE5,
-    0xB2, 0x10, 0xD0, 0xE0, 0x08, 0x20, 0x85, 0xE2, 0xB0, 0x10, 0xC2, 0xE1, 0x0D, 0x00, 0xA4, 0xE8,
-    0x01, 0x00, 0xBD, 0xE8, 0x01, 0x00, 0x50, 0xE3, 0x16, 0x00, 0x00, 0xAA, 0x01, 0x00, 0xA0, 0xE3,
-    0xF8, 0x06, 0xCA, 0xE5, 0xFF, 0x05, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x08, 0x00, 0x00, 0x0A,
-    0x12, 0x00, 0x00, 0xEB, 0x0F, 0xE0, 0xA0, 0xE1, 0x74, 0xF8, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x70, 0xF8, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x6C, 0xF8, 0x9F, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1,
-    0x68, 0xF8, 0x9F, 0xE5, 0x00, 0x00, 0xA0, 0xE3, 0xFE, 0x05, 0xCA, 0xE5, 0xF8, 0x06, 0xCA, 0xE5,
-    0x5C, 0x08, 0x9F, 0xE5, 0x00, 0x00, 0x90, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x04, 0xE0, 0x8F, 0x12,
-    0x50, 0xC8, 0x9F, 0x15, 0x1C, 0xFF, 0x2F, 0x11, 0xF0, 0x9F, 0xBD, 0xE8, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x2D, 0xE9, 0x01, 0x00, 0xA0, 0xE3, 0xE0, 0x01, 0x8F, 0xE5, 0x02, 0xBB, 0xA0, 0xE3,
-    0xA4, 0x76, 0x9A, 0xE5, 0x01, 0x70, 0x87, 0xE2, 0xDC, 0x86, 0x9A, 0xE5, 0x28, 0x98, 0x9F, 0xE5,
-    0xAC, 0xC6, 0x9A, 0xE5, 0x07, 0x24, 0xA0, 0xE3, 0x0C, 0x15, 0x9A, 0xE5, 0x03, 0x5C, 0x01, 0xE2,
-    0x03, 0x0C, 0x55, 0xE3, 0x03, 0x6C, 0xA0, 0x03, 0x00, 0x60, 0xA0, 0x13, 0x01, 0x0C, 0x55, 0xE3,
-    0x0D, 0x00, 0x00, 0x1A, 0x34, 0x34, 0x9A, 0xE5, 0x03, 0x3C, 0x13, 0xE2, 0x03, 0x3C, 0x33, 0x12,
-    0x09, 0x00, 0x00, 0x1A, 0x21, 0x38, 0xA0, 0xE1, 0x20, 0x00, 0x11, 0xE3, 0x03, 0x01, 0xDC, 0x07,
-    0xE8, 0x07, 0x9F, 0x15, 0x03, 0x00, 0xD0, 0x17, 0xEF, 0x00, 0x50, 0xE3, 0x02, 0x00, 0x00, 0x8A,
-    0x00, 0x01, 0x80, 0xE0, 0x20, 0x02, 0xA0, 0xE1, 0x77, 0x04, 0xCA, 0xE5, 0x77, 0x04, 0xDA, 0xE5,
-    0xCC, 0x57, 0x9F, 0xE5, 0x00, 0x50, 0x45, 0xE0, 0x59, 0x04, 0xDA, 0xE5, 0x20, 0x00, 0x10, 0xE3,
-    0x29, 0x00, 0x00, 0x1A, 0x04, 0x30, 0x9C, 0xE4, 0xFF, 0x00, 0x03, 0xE2, 0xEF, 0x00, 0x50, 0xE3,
-    0x22, 0x00, 0x00, 0x8A, 0xF8, 0x40, 0x00, 0xE2, 0x00, 0x11, 0xD7, 0xE7, 0x80, 0x10, 0x01, 0xE2,
-    0xA1, 0x42, 0x84, 0xE0, 0x03, 0x19, 0x03, 0xE2, 0x21, 0x47, 0x84, 0xE0, 0x04, 0x40, 0xD8, 0xE7,
-    0xD4, 0x40, 0x99, 0xE1, 0x02, 0x01, 0x14, 0xE3, 0x04, 0x43, 0x8B, 0xE0, 0x0F, 0xE0, 0xA0, 0x11,
-    0x80, 0xF7, 0x9F, 0x15, 0x3F, 0x1C, 0x03, 0xE2, 0x21, 0x44, 0x84, 0xE0, 0x00, 0x00, 0xD5, 0xE7,
-    0x01, 0x1C, 0x16, 0xE2, 0x02, 0x1C, 0x81, 0xE2, 0x01, 0x05, 0x13, 0x13, 0x40, 0x10, 0x81, 0x12,
-    0x01, 0x19, 0x53, 0xE0, 0xFF, 0x14, 0x01, 0xE2, 0x21, 0x04, 0x80, 0xE1, 0x01, 0x04, 0x80, 0x33,
-    0x03, 0x15, 0x03, 0xE2, 0x01, 0x03, 0x80, 0xE1, 0x02, 0x16, 0x03, 0xE2, 0xA1, 0x05, 0x80, 0xE1,
-    0x06, 0x00, 0x80, 0xE1, 0x04, 0x00, 0x82, 0xE4, 0x03, 0x08, 0x03, 0xE2, 0x20, 0x02, 0x84, 0xE1,
-    0xB4, 0x00, 0xC2, 0xE0, 0xFF, 0x00, 0x1C, 0xE3, 0xD9, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8,
-    0x2A, 0x0E, 0xA0, 0xE3, 0x08, 0x00, 0x82, 0xE4, 0xF9, 0xFF, 0xFF, 0xEA, 0x02, 0x69, 0x86, 0xE3,
-    0x04, 0x30, 0x9C, 0xE4, 0xFF, 0x00, 0x03, 0xE2, 0xEF, 0x00, 0x50, 0xE3, 0x24, 0x00, 0x00, 0x8A,
-    0xF8, 0x40, 0x00, 0xE2, 0x01, 0x1C, 0x03, 0xE2, 0x21, 0x43, 0x84, 0xE0, 0x03, 0x19, 0x03, 0xE2,
-    0x21, 0x47, 0x84, 0xE0, 0x04, 0x40, 0xD8, 0xE7, 0xD4, 0x40, 0x99, 0xE1, 0x02, 0x01, 0x14, 0xE3,
-    0x04, 0x43, 0x8B, 0xE0, 0x0F, 0xE0, 0xA0, 0x11, 0xD8, 0xF6, 0x9F, 0x15, 0x3E, 0x1C, 0x03, 0xE2,
-    0x21, 0x44, 0x84, 0xE0, 0x03, 0x0C, 0x16, 0xE3, 0x05, 0x00, 0x40, 0x12, 0xFF, 0x00, 0x00, 0x12,
-    0x00, 0x00, 0xD5, 0xE7, 0x01, 0x1C, 0x16, 0xE2, 0x02, 0x1C, 0x81, 0xE2, 0x01, 0x05, 0x13, 0x13,
-    0x40, 0x10, 0x81, 0x12, 0x01, 0x19, 0x53, 0xE0, 0xFF, 0x14, 0x01, 0xE2, 0x21, 0x04, 0x80, 0xE1,
-    0x01, 0x04, 0x80, 0x33, 0x03, 0x15, 0x03, 0xE2, 0x01, 0x03, 0x80, 0xE1, 0x02, 0x16, 0x03, 0xE2,
-    0xA1, 0x05, 0x80, 0xE1, 0x06, 0x00, 0x80, 0xE1, 0x04, 0x00, 0x82, 0xE4, 0x03, 0x08, 0x03, 0xE2,
-    0x20, 0x02, 0x84, 0xE1, 0xB4, 0x00, 0xC2, 0xE0, 0xFF, 0x00, 0x1C, 0xE3, 0xD7, 0xFF, 0xFF, 0x1A,
-    0x00, 0x80, 0xBD, 0xE8, 0x2A, 0x0E, 0xA0, 0xE3, 0x08, 0x00, 0x82, 0xE4, 0xF9, 0xFF, 0xFF, 0xEA,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0C, 0xE2, 0x00, 0xF1, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x58, 0x00, 0x03, 0x7C, 0x58, 0x00, 0x03, 0xC0, 0x59, 0x00, 0x03, 0x7C, 0x58, 0x00, 0x03,
-    0x20, 0x78, 0x00, 0x08, 0x7C, 0x58, 0x00, 0x03, 0x7C, 0x58, 0x00, 0x03, 0x14, 0x5D, 0x00, 0x03,
-    0x07, 0x20, 0x0C, 0xE2, 0x02, 0xF1, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x84, 0x58, 0x00, 0x03,
-    0x1C, 0x59, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0x00, 0x78, 0x00, 0x08, 0x08, 0x78, 0x00, 0x08,
-    0xE8, 0x59, 0x00, 0x03, 0x54, 0x5B, 0x00, 0x03, 0x4C, 0x5D, 0x00, 0x03, 0x00, 0x00, 0xA0, 0xE3,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x58, 0x14, 0xDA, 0xE5, 0x58, 0x04, 0xCA, 0xE5, 0x00, 0x20, 0x21, 0xE0,
-    0x80, 0x00, 0x12, 0xE3, 0x80, 0x00, 0x10, 0x13, 0x02, 0x00, 0x00, 0x0A, 0x20, 0x11, 0xDF, 0xE5,
-    0x80, 0x00, 0x11, 0xE3, 0xE0, 0xF5, 0x9F, 0x15, 0x10, 0x00, 0x12, 0xE3, 0x02, 0x00, 0x00, 0x0A,
-    0x05, 0x50, 0x2D, 0xE9, 0xA3, 0xFC, 0xFF, 0x1B, 0x05, 0x50, 0xBD, 0xE8, 0x04, 0x00, 0x12, 0xE3,
-    0x05, 0x00, 0x00, 0x0A, 0x04, 0x00, 0x10, 0xE3, 0x01, 0x10, 0xA0, 0x03, 0x20, 0x10, 0xA0, 0x13,
-    0x55, 0x14, 0xCA, 0xE5, 0x74, 0x14, 0xCF, 0xE5, 0x38, 0x14, 0xCF, 0xE5, 0x40, 0x14, 0x9A, 0xE5,
-    0x03, 0x1B, 0xC1, 0xE3, 0x03, 0xC0, 0x00, 0xE2, 0x0C, 0x15, 0x81, 0xE1, 0x40, 0x14, 0x8A, 0xE5,
-    0x01, 0xC0, 0x00, 0xE2, 0x08, 0x00, 0x10, 0xE3, 0x80, 0xC0, 0x8C, 0x13, 0x45, 0x14, 0xDA, 0xE5,
-    0x01, 0x00, 0x5C, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x45, 0xC4, 0xCA, 0xE5, 0xF4, 0x16, 0xDA, 0xE5,
-    0x01, 0x10, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x11, 0x59, 0x00, 0x00, 0xEA, 0x5A, 0x14, 0xDA, 0xE5,
-    0x5A, 0x04, 0xCA, 0xE5, 0x00, 0x20, 0x31, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x40, 0x2D, 0xE9,
-    0xE1, 0x00, 0x12, 0xE3, 0x01, 0x00, 0x00, 0x0A, 0x0F, 0xE0, 0xA0, 0xE1, 0x4C, 0xF5, 0x9F, 0xE5,
-    0x18, 0x00, 0x12, 0xE3, 0x07, 0x00, 0x00, 0x0A, 0xF5, 0x26, 0xDA, 0xE5, 0x02, 0x20, 0xB0, 0xE1,
-    0x04, 0x00, 0x00, 0x1A, 0x18, 0x00, 0x10, 0xE3, 0x08, 0xE0, 0x8F, 0xE2, 0x30, 0xF5, 0x9F, 0x05,
-    0x18, 0x00, 0x11, 0xE3, 0x2C, 0xF5, 0x9F, 0x05, 0x8F, 0x03, 0x00, 0xEB, 0x02, 0x40, 0xBD, 0xE8,
-    0x11, 0x0D, 0xA0, 0xE3, 0x08, 0x00, 0x11, 0xE3, 0x01, 0x0C, 0x80, 0x13, 0x10, 0x00, 0x11, 0xE3,
-    0x01, 0x0A, 0x80, 0x13, 0xE4, 0x16, 0x9A, 0xE5, 0xE4, 0x06, 0x8A, 0xE5, 0xF0, 0x00, 0x5C, 0xE3,
-    0xF0, 0xC0, 0xA0, 0x83, 0xE8, 0x06, 0xDA, 0xE5, 0xE8, 0xC6, 0xCA, 0xE5, 0x00, 0x00, 0x5C, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x20, 0x5C, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x20, 0x82, 0xB0,
-    0x00, 0x00, 0xA0, 0xB3, 0xB8, 0xC6, 0x9A, 0xE5, 0x80, 0x00, 0x8C, 0xE0, 0xDA, 0xFD, 0xFF, 0xEA,
-    0x57, 0x54, 0xCA, 0xE5, 0x01, 0x00, 0xA0, 0xE3, 0x1E, 0xFF, 0x2F, 0xE1, 0x57, 0x54, 0xCA, 0xE5,
-    0xEC, 0x06, 0x9A, 0xE5, 0xA4, 0x01, 0x0F, 0xE5, 0x1C, 0x00, 0x5F, 0xE5, 0x80, 0x10, 0xC0, 0xE3,
-    0x24, 0x10, 0x4F, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x57, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0x31, 0xE2,
-    0x57, 0x14, 0xCA, 0xE5, 0x05, 0x00, 0x00, 0x0A, 0x40, 0x14, 0xDA, 0xE5, 0x1F, 0x10, 0xC1, 0xE3,
-    0xA0, 0x11, 0x81, 0xE1, 0x40, 0x14, 0xCA, 0xE5, 0x44, 0x04, 0xCA, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x40, 0x14, 0x9A, 0xE5, 0x3E, 0x1E, 0xC1, 0xE3, 0x07, 0x1A, 0xC1, 0xE3, 0xF8, 0x20, 0x00, 0xE2,
-    0x02, 0x11, 0x81, 0xE1, 0x07, 0x20, 0x00, 0xE2, 0x02, 0x16, 0x81, 0xE1, 0x40, 0x14, 0x8A, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x57, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0x31, 0xE2, 0x57, 0x14, 0xCA, 0xE5,
-    0x39, 0x00, 0x00, 0x0A, 0x40, 0xC4, 0xDA, 0xE5, 0x1F, 0xC0, 0xCC, 0xE3, 0xA0, 0x11, 0xA0, 0xE1,
-    0x01, 0xC0, 0x8C, 0xE1, 0x40, 0xC4, 0xCA, 0xE5, 0x5C, 0x14, 0xDA, 0xE5, 0x07, 0x20, 0xC1, 0xE3,
-    0x07, 0xC0, 0x00, 0xE2, 0x0C, 0x20, 0x82, 0xE1, 0x44, 0xC4, 0xDA, 0xE5, 0x02, 0x00, 0x51, 0xE1,
-    0x5C, 0x24, 0xCA, 0x15, 0x00, 0x00, 0x5C, 0xE1, 0x44, 0x04, 0xCA, 0x15, 0x02, 0x00, 0x51, 0x01,
-    0x1E, 0xFF, 0x2F, 0x01, 0x44, 0x14, 0x9A, 0xE5, 0x5C, 0x04, 0x9A, 0xE5, 0x01, 0x00, 0x50, 0xE1,
-    0x05, 0x00, 0x00, 0x0A, 0xF4, 0x26, 0xDA, 0xE5, 0x02, 0x20, 0xB0, 0xE1, 0x02, 0x00, 0x00, 0x1A,
-    0x01, 0x40, 0x2D, 0xE9, 0x30, 0x02, 0x00, 0xEB, 0x01, 0x40, 0xBD, 0xE8, 0x00, 0x40, 0x2D, 0xE9,
-    0x3D, 0x03, 0x00, 0xEB, 0x00, 0x40, 0xBD, 0xE8, 0x46, 0x1E, 0x8A, 0xE2, 0x90, 0x00, 0x01, 0xE1,
-    0xF0, 0x00, 0x5C, 0xE3, 0xF0, 0xC0, 0xA0, 0x83, 0x64, 0x14, 0xDA, 0xE5, 0x64, 0xC4, 0xCA, 0xE5,
-    0x00, 0x00, 0x5C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0xC0, 0x5C, 0xE0, 0x1E, 0xFF, 0x2F, 0x01,
-    0x01, 0xC0, 0x8C, 0xB0, 0x00, 0x10, 0xA0, 0xB3, 0x08, 0x00, 0x80, 0xE2, 0xA0, 0x26, 0x9A, 0xE5,
-    0x01, 0x11, 0x82, 0xE0, 0x04, 0xC0, 0x5C, 0xE2, 0x05, 0x00, 0x00, 0xBA, 0xB4, 0x00, 0xC1, 0xE0,
-    0xB4, 0x00, 0xC1, 0xE0, 0xB4, 0x00, 0xC1, 0xE0, 0xB4, 0x00, 0xC1, 0xE0, 0x04, 0xC0, 0x5C, 0xE2,
-    0xF9, 0xFF, 0xFF, 0xAA, 0x04, 0xC0, 0x9C, 0xE2, 0x1E, 0xFF, 0x2F, 0x01, 0xB4, 0x00, 0xC1, 0xE0,
-    0x01, 0xC0, 0x5C, 0xE2, 0xFC, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1, 0x48, 0x04, 0xCA, 0xE5,
-    0x40, 0x14, 0x9A, 0xE5, 0x73, 0x1C, 0xC1, 0xE3, 0xE0, 0x10, 0xC1, 0xE3, 0xF8, 0x20, 0x00, 0xE2,
-    0x07, 0x00, 0x00, 0xE2, 0x02, 0x11, 0x81, 0xE1, 0x00, 0x16, 0x81, 0xE1, 0x40, 0x14, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0x57, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0x31, 0xE2, 0x57, 0x14, 0xCA, 0xE5,
-    0x3F, 0x00, 0x00, 0x12, 0x41, 0x04, 0xCA, 0x15, 0x1E, 0xFF, 0x2F, 0x11, 0x40, 0x04, 0xCA, 0xE5,
-    0x40, 0x14, 0x9A, 0xE5, 0x6C, 0x10, 0x0A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x57, 0x14, 0xDA, 0xE5,
-    0x01, 0x10, 0x31, 0xE2, 0x57, 0x14, 0xCA, 0xE5, 0x3F, 0x00, 0x00, 0x12, 0x41, 0x04, 0xCA, 0x15,
-    0x1E, 0xFF, 0x2F, 0x11, 0x40, 0x04, 0xCA, 0xE5, 0x40, 0x14, 0x9A, 0xE5, 0x6C, 0x10, 0x0A, 0xE5,
-    0x21, 0x06, 0xA0, 0xE1, 0x3E, 0x2E, 0x01, 0xE2, 0x22, 0x01, 0x80, 0xE1, 0x02, 0x2B, 0x01, 0xE2,
-    0xA2, 0x01, 0x80, 0xE1, 0x48, 0x04, 0x8A, 0xE5, 0x44, 0x04, 0x9A, 0xE5, 0x7F, 0x0C, 0xC0, 0xE3,
-    0xF8, 0x00, 0xC0, 0xE3, 0x1F, 0x20, 0x01, 0xE2, 0x01, 0xCB, 0x01, 0xE2, 0x82, 0x01, 0x80, 0xE1,
-    0x2C, 0x01, 0x80, 0xE1, 0x44, 0x04, 0x8A, 0xE5, 0x5C, 0x04, 0x8A, 0xE5, 0x04, 0xE0, 0x2D, 0xE5,
-    0xB1, 0xFF, 0xFF, 0xEB, 0x04, 0xE0, 0x9D, 0xE4, 0x18, 0x00, 0x00, 0xEA, 0x21, 0x06, 0xA0, 0xE1,
-    0x3E, 0x2E, 0x01, 0xE2, 0x22, 0x01, 0x80, 0xE1, 0x02, 0x2B, 0x01, 0xE2, 0xA2, 0x01, 0x80, 0xE1,
-    0x48, 0x04, 0x8A, 0xE5, 0x44, 0x04, 0x9A, 0xE5, 0x7F, 0x0C, 0xC0, 0xE3, 0xF8, 0x00, 0xC0, 0xE3,
-    0x1F, 0x20, 0x01, 0xE2, 0x82, 0x01, 0x80, 0xE1, 0x01, 0x2B, 0x01, 0xE2, 0x22, 0x01, 0x80, 0xE1,
-    0x5C, 0x04, 0x8A, 0xE5, 0x40, 0xC4, 0x9A, 0xE5, 0x7F, 0x0C, 0xC0, 0xE3, 0xF8, 0x00, 0xC0, 0xE3,
-    0x1F, 0x20, 0x0C, 0xE2, 0x82, 0x01, 0x80, 0xE1, 0x01, 0x2B, 0x0C, 0xE2, 0x22, 0x01, 0x80, 0xE1,
-    0x44, 0x04, 0x8A, 0xE5, 0x04, 0xE0, 0x2D, 0xE5, 0x8D, 0xFF, 0xFF, 0xEB, 0x04, 0xE0, 0x9D, 0xE4,
-    0x48, 0x04, 0x9A, 0xE5, 0x4C, 0x04, 0x8A, 0xE5, 0x00, 0x40, 0x2D, 0xE9, 0xD2, 0x02, 0x00, 0xEB,
-    0x70, 0x14, 0x8A, 0xE5, 0x00, 0x40, 0xBD, 0xE8, 0x06, 0x02, 0x52, 0xE3, 0x04, 0x00, 0x00, 0x3A,
-    0xF0, 0x17, 0x9A, 0xE5, 0x01, 0x00, 0x52, 0xE1, 0x01, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x5C, 0xE3,
-    0x01, 0x00, 0x80, 0x12, 0x68, 0x24, 0x9A, 0xE5, 0x68, 0x04, 0x8A, 0xE5, 0xF0, 0x00, 0x5C, 0xE3,
-    0xF0, 0xC0, 0xA0, 0x83, 0x6C, 0x14, 0xDA, 0xE5, 0x6C, 0xC4, 0xCA, 0xE5, 0x00, 0x00, 0x5C, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x01, 0xC0, 0x5C, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0xC0, 0x8C, 0xB0,
-    0x18, 0x40, 0x2D, 0xE9, 0x02, 0x30, 0xA0, 0xE1, 0x01, 0x00, 0x43, 0xE0, 0x00, 0x10, 0xA0, 0xB3,
-    0xA0, 0x26, 0x9A, 0xE5, 0x01, 0x11, 0x82, 0xE0, 0x02, 0x10, 0x81, 0xE2, 0xFF, 0x20, 0x03, 0xE2,
-    0x0C, 0x20, 0x82, 0xE0, 0xF0, 0x20, 0x52, 0xE2, 0x01, 0x00, 0x00, 0xCA, 0x84, 0xFF, 0xFF, 0xEB,
-    0x18, 0x80, 0xBD, 0xE8, 0x02, 0x40, 0x5C, 0xE0, 0x06, 0x00, 0x00, 0xDA, 0x10, 0x30, 0x80, 0xE2,
-    0x04, 0xC0, 0xA0, 0xE1, 0x7E, 0xFF, 0xFF, 0xEB, 0x03, 0x00, 0xA0, 0xE1, 0x02, 0xC0, 0xA0, 0xE1,
-    0x7B, 0xFF, 0xFF, 0xEB, 0x18, 0x80, 0xBD, 0xE8, 0xF0, 0x00, 0x80, 0xE2, 0xF0, 0x30, 0x83, 0xE2,
-    0xED, 0xFF, 0xFF, 0xEA, 0x6C, 0x00, 0x1A, 0xE5, 0xFF, 0x20, 0x80, 0xE2, 0xBC, 0x26, 0x4A, 0xE1,
-    0x3F, 0x09, 0xC0, 0xE3, 0x0F, 0x1B, 0x00, 0xE2, 0x19, 0x2D, 0x8A, 0xE2, 0x21, 0x14, 0x92, 0xE7,
-    0x3F, 0x2B, 0xC0, 0xE3, 0x02, 0x10, 0xD1, 0xE7, 0x3F, 0x0C, 0x50, 0xE3, 0x58, 0xF1, 0x9F, 0x25,
-    0x50, 0x04, 0xDA, 0xE5, 0x50, 0x14, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x6C, 0xC0, 0x1A, 0xE5,
-    0xFF, 0x20, 0x8C, 0xE2, 0xBC, 0x26, 0x4A, 0xE1, 0x3F, 0xC9, 0xCC, 0xE3, 0x0F, 0x1B, 0x1C, 0xE2,
-    0x06, 0x2C, 0x8A, 0xE2, 0x21, 0xF4, 0x92, 0xE7, 0xCC, 0x26, 0x9A, 0xE5, 0x0C, 0x00, 0xC2, 0xE7,
-    0x2A, 0x2C, 0x82, 0xE2, 0x2C, 0x22, 0xC2, 0xE7, 0x81, 0x2F, 0x82, 0xE2, 0x2C, 0x24, 0xC2, 0xE7,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x2C, 0x25, 0xA0, 0xE1, 0x19, 0x1D, 0x8A, 0xE2, 0x02, 0x11, 0x91, 0xE7,
-    0xCC, 0x26, 0x9A, 0xE5, 0x02, 0x10, 0x51, 0xE0, 0x1E, 0xFF, 0x2F, 0xB1, 0x02, 0x0A, 0x51, 0xE3,
-    0x1E, 0xFF, 0x2F, 0xA1, 0x3F, 0xCB, 0xCC, 0xE3, 0x01, 0xC0, 0x8C, 0xE0, 0xEE, 0xFF, 0xFF, 0xEA,
-    0xE8, 0x10, 0x9F, 0xE5, 0x00, 0x20, 0xA0, 0xE3, 0x3F, 0xCB, 0xCC, 0xE3, 0x0C, 0x00, 0xC1, 0xE7,
-    0x00, 0x00, 0xA0, 0xE1, 0x02, 0xC0, 0x8C, 0xE0, 0xD4, 0x10, 0x9F, 0xE5, 0x90, 0x24, 0x9A, 0xE5,
-    0xB2, 0xC0, 0x81, 0xE1, 0x02, 0x20, 0x82, 0xE2, 0x02, 0x2C, 0xC2, 0xE3, 0x90, 0x24, 0x8A, 0xE5,
-    0xFF, 0x2C, 0x42, 0xE2, 0xFF, 0x20, 0x52, 0xE2, 0x1E, 0xFF, 0x2F, 0x11, 0xB4, 0xF0, 0x9F, 0xE5,
-    0xB4, 0x10, 0x9F, 0xE5, 0x01, 0x2B, 0xA0, 0xE3, 0xEE, 0xFF, 0xFF, 0xEA, 0xAC, 0x10, 0x9F, 0xE5,
-    0x02, 0x2B, 0xA0, 0xE3, 0xEB, 0xFF, 0xFF, 0xEA, 0xA4, 0x10, 0x9F, 0xE5, 0x03, 0x2B, 0xA0, 0xE3,
-    0xE8, 0xFF, 0xFF, 0xEA, 0x9C, 0xF0, 0x9F, 0xE5, 0x3F, 0x0C, 0x5C, 0xE3, 0xF9, 0xFF, 0xFF, 0x4A,
-    0x01, 0x10, 0xA0, 0xE3, 0xFB, 0x16, 0xCA, 0xE5, 0x3F, 0x00, 0x00, 0xE2, 0x1A, 0x1D, 0x8A, 0xE2,
-    0x1F, 0xC0, 0x0C, 0xE2, 0x0C, 0x00, 0xC1, 0xE7, 0x03, 0x00, 0x1C, 0xE3, 0x10, 0xC0, 0x2C, 0x02,
-    0x0C, 0x00, 0xC1, 0x07, 0x10, 0xC0, 0xCC, 0x03, 0x0E, 0xF0, 0xA0, 0xE1, 0x3C, 0x6E, 0x00, 0x03,
-    0xC8, 0x76, 0x00, 0x08, 0x9C, 0x73, 0x00, 0x08, 0x90, 0x77, 0x00, 0x08, 0x01, 0x00, 0x60, 0xA6,
-    0x01, 0x00, 0x40, 0xA2, 0x0C, 0x76, 0x00, 0x08, 0x68, 0x5F, 0x00, 0x03, 0xA0, 0x61, 0x00, 0x03,
-    0x74, 0x32, 0x00, 0x06, 0x94, 0x00, 0x00, 0x02, 0x79, 0x35, 0x00, 0x08, 0x68, 0xEF, 0x03, 0x02,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x7B, 0x00, 0x03, 0x00, 0x75, 0x00, 0x08, 0x58, 0x81, 0x00, 0x08,
-    0xD8, 0x7B, 0x00, 0x08, 0x60, 0x7D, 0x00, 0x08, 0x54, 0x7C, 0x00, 0x08, 0xA0, 0x81, 0x00, 0x08,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE9, 0x03, 0x02, 0xB4, 0x81, 0x00, 0x08, 0x8C, 0xE5, 0x03, 0x02,
-    0x8C, 0xB9, 0x03, 0x02, 0x8C, 0xBD, 0x03, 0x02, 0x28, 0x82, 0x00, 0x08, 0x46, 0x50, 0x53, 0x3A,
-    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x59, 0xE3, 0x5C, 0xF6, 0x9F, 0xA5,
-    0x29, 0x02, 0x98, 0xE7, 0x00, 0x00, 0xB0, 0xE1, 0x01, 0x00, 0x00, 0x1A, 0x40, 0x90, 0x89, 0xE2,
-    0xF8, 0xFF, 0xFF, 0xEA, 0xFF, 0x00, 0x10, 0xE3, 0x10, 0x90, 0x89, 0x02, 0xFF, 0x0C, 0x10, 0x03,
-    0x10, 0x90, 0x89, 0x02, 0xFF, 0x08, 0x10, 0x03, 0x10, 0x90, 0x89, 0x02, 0x09, 0x00, 0xD7, 0xE7,
-    0x00, 0x00, 0xB0, 0xE1, 0x09, 0x00, 0x00, 0x1A, 0x01, 0x90, 0x89, 0xE2, 0x0F, 0x00, 0x19, 0xE3,
-    0xF9, 0xFF, 0xFF, 0x1A, 0x3F, 0x00, 0x19, 0xE3, 0xEA, 0xFF, 0xFF, 0x0A, 0x29, 0x02, 0xD8, 0xE7,
-    0x00, 0x00, 0xB0, 0xE1, 0xF4, 0xFF, 0xFF, 0x1A, 0x10, 0x90, 0x89, 0xE2, 0xF8, 0xFF, 0xFF, 0xEA,
-    0xCC, 0x46, 0x9A, 0xE5, 0x09, 0x42, 0x84, 0xE0, 0x01, 0xB0, 0x5B, 0xE2, 0x0F, 0x00, 0x00, 0x4B,
-    0x0F, 0x00, 0xB4, 0xE8, 0x0F, 0x00, 0xA5, 0xE8, 0xB2, 0x90, 0xC6, 0xE0, 0x00, 0x00, 0xA0, 0xE3,
-    0x09, 0x00, 0xC7, 0xE7, 0x01, 0x90, 0x89, 0xE2, 0x09, 0x00, 0xD7, 0xE7, 0x00, 0x00, 0xB0, 0xE1,
-    0xF4, 0xFF, 0xFF, 0x1A, 0xE8, 0xFF, 0xFF, 0xEA, 0xFC, 0x05, 0x9A, 0xE5, 0xFF, 0x0C, 0x10, 0xE3,
-    0xFF, 0x08, 0x10, 0x03, 0x1E, 0xFF, 0x2F, 0x01, 0x0B, 0x00, 0x00, 0xEA, 0x13, 0x00, 0x00, 0xEA,
-    0x90, 0x43, 0x2D, 0xE9, 0xFB, 0xFF, 0xFF, 0xEB, 0x80, 0x54, 0x9A, 0xE5, 0x88, 0x64, 0x9A, 0xE5,
-    0x60, 0x00, 0x2D, 0xE9, 0xF8, 0xFF, 0xFF, 0xEB, 0x13, 0xB0, 0xA0, 0xE3, 0x60, 0x00, 0xBD, 0xE8,
-    0x02, 0x09, 0xA0, 0xE3, 0xB0, 0x00, 0xC6, 0xE1, 0x90, 0x83, 0xBD, 0xE8, 0x80, 0x25, 0x9F, 0xE5,
-    0x84, 0x54, 0x9A, 0xE5, 0x8C, 0x64, 0x9A, 0xE5, 0x02, 0x09, 0xA0, 0xE3, 0xB0, 0x90, 0xD6, 0xE1,
-    0xB2, 0x00, 0xC6, 0xE0, 0x05, 0x40, 0xA0, 0xE1, 0x00, 0x44, 0x2D, 0xE9, 0x03, 0x00, 0x00, 0xEA,
-    0x05, 0x40, 0xA0, 0xE1, 0x00, 0x44, 0x2D, 0xE9, 0x54, 0x25, 0x9F, 0xE5, 0xB2, 0x90, 0xD6, 0xE0,
-    0x02, 0x09, 0x19, 0xE3, 0x00, 0x84, 0xBD, 0x18, 0x09, 0x30, 0xA0, 0xE1, 0x44, 0x75, 0x9F, 0xE5,
-    0x89, 0x72, 0x87, 0xE0, 0x05, 0x89, 0x87, 0xE2, 0x01, 0x0C, 0x19, 0xE3, 0x02, 0x7A, 0x87, 0x12,
-    0x01, 0x00, 0x89, 0xE2, 0xB2, 0x90, 0xD6, 0xE0, 0x01, 0x0C, 0x50, 0xE3, 0x01, 0x00, 0x00, 0x0A,
-    0x09, 0x00, 0x50, 0xE1, 0xF9, 0xFF, 0xFF, 0x0A, 0x03, 0x30, 0x40, 0xE0, 0x44, 0xE0, 0x4F, 0xE2,
-    0x82, 0xFB, 0xFF, 0xEA, 0x84, 0x54, 0x9A, 0xE5, 0x8C, 0x64, 0x9A, 0xE5, 0x40, 0x40, 0x2D, 0xE9,
-    0x03, 0x00, 0x00, 0xEB, 0x40, 0x40, 0xBD, 0xE8, 0x02, 0x09, 0xA0, 0xE3, 0xB0, 0x00, 0xC6, 0xE1,
-    0x1E, 0xFF, 0x2F, 0xE1, 0xB0, 0x90, 0xD6, 0xE1, 0x02, 0x09, 0x19, 0xE3, 0x1E, 0xFF, 0x2F, 0x11,
-    0x00, 0x5C, 0x2D, 0xE9, 0x38, 0xD0, 0x4D, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0xD8, 0xF4, 0x9F, 0xE5,
-    0x02, 0x09, 0x19, 0xE3, 0xFB, 0xFF, 0xFF, 0x0A, 0x38, 0xD0, 0x8D, 0xE2, 0x00, 0x5C, 0xBD, 0xE8,
-    0x1E, 0xFF, 0x2F, 0xE1, 0xC4, 0xA4, 0x9F, 0xE5, 0x7C, 0xB4, 0xDA, 0xE5, 0x00, 0x80, 0xA0, 0xE3,
-    0x29, 0x03, 0xA0, 0xE1, 0x7C, 0x00, 0xCF, 0xE5, 0x7D, 0x14, 0xDA, 0xE5, 0x01, 0x10, 0x80, 0xE0,
-    0xAC, 0x24, 0x9F, 0xE5, 0xD1, 0x00, 0x92, 0xE1, 0xA8, 0x74, 0x9F, 0xE5, 0x80, 0x75, 0x97, 0xE0,
-    0x01, 0x00, 0x00, 0x2A, 0x08, 0x71, 0x8D, 0xE7, 0x01, 0x80, 0x88, 0xE2, 0x00, 0x30, 0xA0, 0xE3,
-    0x4F, 0x2E, 0x8A, 0xE2, 0x03, 0x00, 0xD2, 0xE7, 0x0B, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x50, 0xE1,
-    0x06, 0x00, 0x00, 0x1A, 0x03, 0x00, 0x03, 0xE2, 0x68, 0x74, 0x9F, 0xE5, 0x80, 0x75, 0x87, 0xE0,
-    0x23, 0x01, 0xA0, 0xE1, 0x00, 0x77, 0x87, 0xE0, 0x08, 0x71, 0x8D, 0xE7, 0x01, 0x80, 0x88, 0xE2,
-    0x01, 0x30, 0x83, 0xE2, 0x10, 0x00, 0x53, 0xE3, 0xF1, 0xFF, 0xFF, 0xBA, 0x08, 0x80, 0xB0, 0xE1,
-    0x20, 0x00, 0x00, 0x0A, 0x70, 0x80, 0xCF, 0xE5, 0x01, 0x80, 0x58, 0xE2, 0x44, 0x80, 0xCF, 0xE5,
-    0xB0, 0x90, 0xD6, 0xE1, 0x29, 0x03, 0xA0, 0xE1, 0xFF, 0x00, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0x11,
-    0x02, 0x60, 0x86, 0xE2, 0x3F, 0x90, 0x09, 0xE2, 0x00, 0x70, 0x9D, 0xE5, 0x89, 0x72, 0x87, 0xE0,
-    0x0C, 0x24, 0x9F, 0xE5, 0x01, 0x00, 0xD5, 0xE4, 0x07, 0x10, 0xD5, 0xE5, 0x00, 0x01, 0x92, 0xE7,
-    0x01, 0x11, 0x92, 0xE7, 0x81, 0x00, 0x80, 0xE1, 0x04, 0x00, 0x87, 0xE4, 0x1F, 0x00, 0x17, 0xE3,
-    0xF7, 0xFF, 0xFF, 0x1A, 0x08, 0x50, 0x85, 0xE2, 0xFF, 0x00, 0xB0, 0xE3, 0x08, 0x00, 0x00, 0x0A,
-    0x20, 0x70, 0x47, 0xE2, 0x1F, 0x1C, 0x97, 0xE8, 0x01, 0x80, 0xA0, 0xE3, 0x08, 0x71, 0x9D, 0xE7,
-    0x89, 0x72, 0x87, 0xE0, 0x1F, 0x1C, 0x87, 0xE8, 0x01, 0x80, 0x88, 0xE2, 0xFF, 0x00, 0x58, 0xE3,
-    0xF9, 0xFF, 0xFF, 0xBA, 0xE1, 0xFF, 0xFF, 0xEA, 0x29, 0x03, 0xA0, 0xE1, 0xB2, 0x90, 0xF6, 0xE1,
-    0x10, 0x50, 0x85, 0xE2, 0x29, 0x15, 0xA0, 0xE1, 0x01, 0x00, 0x50, 0xE1, 0xFA, 0xFF, 0xFF, 0x0A,
-    0x1E, 0xFF, 0x2F, 0xE1, 0xB0, 0x53, 0x9F, 0xE5, 0xB0, 0x43, 0x9F, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x9D, 0x04, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0xA0, 0xE3,
-    0x9D, 0x04, 0xCA, 0xE5, 0x9C, 0x04, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x90, 0xF3, 0x9F, 0x15,
-    0x98, 0x64, 0x9A, 0xE5, 0x94, 0x74, 0x9A, 0xE5, 0x07, 0x00, 0x56, 0xE1, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x44, 0x2D, 0xE9, 0xEE, 0xFF, 0xFF, 0xEB, 0x78, 0x83, 0x9F, 0xE5, 0x78, 0xA3, 0x9F, 0xE5,
-    0x78, 0xB3, 0x9F, 0xE5, 0x00, 0x90, 0xE0, 0xE3, 0x07, 0x00, 0x56, 0xE1, 0x15, 0x00, 0x00, 0x0A,
-    0xB6, 0x00, 0x98, 0xE1, 0x02, 0x60, 0x86, 0xE2, 0x02, 0x6C, 0xC6, 0xE3, 0x01, 0x20, 0xC0, 0xE3,
-    0x09, 0x00, 0x52, 0xE1, 0xF7, 0xFF, 0xFF, 0x0A, 0x3F, 0x1B, 0xC0, 0xE3, 0x0F, 0x0D, 0x51, 0xE3,
-    0x0F, 0x00, 0x00, 0xAA, 0x02, 0x90, 0xA0, 0xE1, 0x02, 0x0B, 0x12, 0xE3, 0x0A, 0x00, 0xA0, 0xE1,
-    0x03, 0x0A, 0x40, 0x12, 0xB2, 0x00, 0x90, 0xE1, 0x00, 0x04, 0x80, 0xE1, 0xFF, 0x0C, 0xC0, 0xE3,
-    0x82, 0x10, 0x9B, 0xE7, 0x05, 0x10, 0xC1, 0xE1, 0x01, 0x00, 0x80, 0xE1, 0x82, 0x00, 0x8B, 0xE7,
-    0x07, 0x00, 0x56, 0xE1, 0xE9, 0xFF, 0xFF, 0x1A, 0x00, 0x44, 0xBD, 0xE8, 0x06, 0x00, 0xA0, 0xE1,
-    0x0C, 0xF3, 0x9F, 0xE5, 0x02, 0x0B, 0x12, 0xE3, 0x07, 0x10, 0x00, 0xE2, 0x81, 0xC1, 0x8B, 0xE0,
-    0x38, 0x10, 0x00, 0xE2, 0x81, 0xC2, 0x8C, 0xE0, 0x03, 0x1B, 0x00, 0xE2, 0x81, 0xC0, 0x8C, 0xE0,
-    0x00, 0x20, 0x8A, 0xE0, 0x03, 0x2A, 0x42, 0x12, 0x98, 0xE0, 0x4F, 0xE2, 0x01, 0x00, 0xD2, 0xE4,
-    0x00, 0x08, 0x80, 0xE1, 0x04, 0x31, 0x00, 0xE0, 0x04, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0,
-    0x03, 0x15, 0x81, 0xE1, 0x04, 0x10, 0x8C, 0xE5, 0x44, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0,
-    0x03, 0x15, 0x81, 0xE1, 0x44, 0x10, 0x8C, 0xE5, 0x04, 0x32, 0x00, 0xE0, 0x80, 0x10, 0x9C, 0xE5,
-    0x05, 0x10, 0x01, 0xE0, 0x03, 0x14, 0x81, 0xE1, 0x80, 0x10, 0x8C, 0xE5, 0xC0, 0x10, 0x9C, 0xE5,
-    0x05, 0x10, 0x01, 0xE0, 0x03, 0x14, 0x81, 0xE1, 0xC0, 0x10, 0x8C, 0xE5, 0x04, 0x33, 0x00, 0xE0,
-    0x84, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0, 0x03, 0x13, 0x81, 0xE1, 0x84, 0x10, 0x8C, 0xE5,
-    0xC4, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0, 0x03, 0x13, 0x81, 0xE1, 0xC4, 0x10, 0x8C, 0xE5,
-    0x04, 0x30, 0x00, 0xE0, 0x40, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0, 0x03, 0x16, 0x81, 0xE1,
-    0x40, 0x10, 0x8C, 0xE5, 0x00, 0x10, 0x9C, 0xE5, 0x05, 0x10, 0x01, 0xE0, 0x03, 0x16, 0x81, 0xE1,
-    0x08, 0x10, 0x8C, 0xE4, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x40, 0x2D, 0xE9, 0x0F, 0x6D, 0x82, 0xE2,
-    0xB2, 0x00, 0xD2, 0xE0, 0x00, 0x04, 0x80, 0xE1, 0xFF, 0x0C, 0xC0, 0xE3, 0x00, 0x10, 0x9C, 0xE5,
-    0x05, 0x10, 0xC1, 0xE1, 0x01, 0x00, 0x80, 0xE1, 0x04, 0x00, 0x8C, 0xE4, 0x06, 0x00, 0x52, 0xE1,
-    0xF6, 0xFF, 0xFF, 0xBA, 0x1E, 0xCD, 0x4C, 0xE2, 0x08, 0x70, 0xA0, 0xE3, 0x08, 0x60, 0xA0, 0xE3,
-    0xC9, 0xFF, 0xFF, 0xEB, 0x01, 0x60, 0x56, 0xE2, 0xFC, 0xFF, 0xFF, 0x1A, 0xC0, 0xC0, 0x8C, 0xE2,
-    0x01, 0x70, 0x57, 0xE2, 0xF8, 0xFF, 0xFF, 0x1A, 0x00, 0x80, 0xBD, 0xE8, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x04, 0x28, 0x9A, 0xE5,
-    0x02, 0x10, 0x41, 0xE0, 0xEC, 0xC7, 0x9A, 0xE5, 0x91, 0x2C, 0x8C, 0xE0, 0x08, 0x28, 0x9A, 0xE5,
-    0x92, 0x0C, 0x01, 0xE0, 0x0F, 0x10, 0x81, 0xE2, 0x21, 0x12, 0xA0, 0xE1, 0x0C, 0x28, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0x07, 0xCC, 0x8A, 0xE2, 0x68, 0xC0, 0x8C, 0xE2, 0x00, 0x00, 0x8F, 0xE2,
-    0xBA, 0x00, 0x00, 0xEA, 0x44, 0x04, 0x9A, 0xE5, 0x5C, 0x14, 0x9A, 0xE5, 0x00, 0x00, 0x51, 0xE1,
-    0x5C, 0x04, 0x8A, 0x15, 0xB8, 0xFD, 0xFF, 0x1B, 0x2E, 0xF8, 0xFF, 0xEA, 0x01, 0x0B, 0x8A, 0xE2,
-    0xC8, 0x00, 0x80, 0xE2, 0x6D, 0x1E, 0x8A, 0xE2, 0x0C, 0x00, 0x90, 0xE8, 0x30, 0x00, 0x91, 0xE8,
-    0x04, 0x00, 0x52, 0xE1, 0x05, 0x00, 0x53, 0x01, 0x0C, 0x00, 0x81, 0x18, 0x1E, 0xFF, 0x2F, 0x01,
-    0x00, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x68, 0xF1, 0x9F, 0xE5, 0x0C, 0x00, 0xA0, 0xE1,
-    0x00, 0x40, 0xBD, 0xE8, 0xEC, 0x00, 0x50, 0xE3, 0x03, 0x00, 0x00, 0xAA, 0x01, 0x00, 0x50, 0xE2,
-    0x00, 0x00, 0xA0, 0xD3, 0xA0, 0x01, 0xA0, 0xE1, 0x1E, 0x00, 0x50, 0xE3, 0x1E, 0x00, 0xA0, 0xA3,
-    0xE0, 0x16, 0xDA, 0xE5, 0xE0, 0x06, 0xCA, 0xE5, 0x00, 0x00, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x01, 0x00, 0x50, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x00, 0x80, 0xB0, 0x00, 0x10, 0xA0, 0xB3,
-    0xD8, 0x26, 0x9A, 0xE5, 0x81, 0x11, 0x82, 0xE0, 0x03, 0x00, 0x50, 0xE3, 0x0E, 0x00, 0x00, 0x4A,
-    0x03, 0x00, 0x40, 0xE2, 0x40, 0x40, 0x2D, 0xE9, 0x04, 0x20, 0xA0, 0xE1, 0x05, 0x30, 0xA0, 0xE1,
-    0x04, 0x60, 0xA0, 0xE1, 0x05, 0xE0, 0xA0, 0xE1, 0x7C, 0x40, 0xA1, 0xE8, 0x03, 0x00, 0x50, 0xE2,
-    0x02, 0x00, 0x00, 0x4A, 0x7C, 0x40, 0xA1, 0xE8, 0x03, 0x00, 0x50, 0xE2, 0xF9, 0xFF, 0xFF, 0x5A,
-    0x03, 0x00, 0x90, 0xE2, 0x40, 0x80, 0xBD, 0x08, 0x40, 0x40, 0xBD, 0xE8, 0x30, 0x00, 0xA1, 0xE8,
-    0x01, 0x00, 0x50, 0xE2, 0xFC, 0xFF, 0xFF, 0xCA, 0x1E, 0xFF, 0x2F, 0xE1, 0xAC, 0x06, 0x9A, 0xE5,
-    0x00, 0x20, 0xE0, 0xE3, 0x00, 0x30, 0xE0, 0xE3, 0x01, 0x40, 0xA0, 0xE3, 0x00, 0x50, 0xA0, 0xE3,
-    0x00, 0x60, 0xA0, 0xE3, 0x11, 0x70, 0xA0, 0xE3, 0x04, 0x10, 0x90, 0xE4, 0xFF, 0x14, 0xC1, 0xE3,
-    0x01, 0x70, 0x57, 0xE2, 0xA0, 0xF0, 0x9F, 0x05, 0x04, 0x80, 0x90, 0xE4, 0xFF, 0x84, 0xC8, 0xE3,
-    0x01, 0x00, 0x58, 0xE1, 0x01, 0x40, 0x84, 0x02, 0xF8, 0xFF, 0xFF, 0x0A, 0x02, 0x00, 0x58, 0xE1,
-    0x01, 0x50, 0x85, 0x02, 0xF5, 0xFF, 0xFF, 0x0A, 0x05, 0x50, 0xB0, 0xE1, 0x01, 0x50, 0xA0, 0x03,
-    0x08, 0x20, 0xA0, 0x01, 0xF1, 0xFF, 0xFF, 0x0A, 0x03, 0x00, 0x58, 0xE1, 0x01, 0x60, 0x86, 0x02,
-    0xEE, 0xFF, 0xFF, 0x0A, 0x06, 0x60, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x11, 0x01, 0x60, 0xA0, 0x03,
-    0x08, 0x30, 0xA0, 0x01, 0xE9, 0xFF, 0xFF, 0xEA, 0xB0, 0x10, 0xD0, 0xE1, 0x01, 0x1A, 0xC1, 0xE3,
-    0xB2, 0x10, 0xC0, 0xE0, 0x01, 0x40, 0x54, 0xE2, 0xFA, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1,
-    0xDC, 0x74, 0x00, 0x08, 0xEC, 0x76, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x74, 0x60, 0x00, 0x03,
-    0x3C, 0x6E, 0x00, 0x03, 0x68, 0xEF, 0x03, 0x02, 0x00, 0x00, 0x01, 0x06, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x9C, 0x75, 0x00, 0x08, 0x8C, 0xE9, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02,
-    0x00, 0x60, 0x00, 0x06, 0x10, 0x82, 0x00, 0x08, 0xAC, 0x67, 0x00, 0x03, 0x2C, 0x75, 0x00, 0x08,
-    0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32, 0x06, 0x02, 0x50, 0xE3,
-    0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3, 0x00, 0x50, 0xA0, 0xE1,
-    0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32, 0x06, 0x02, 0x50, 0xE3,
-    0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3, 0x25, 0x54, 0x80, 0xE1,
-    0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32, 0x06, 0x02, 0x50, 0xE3,
-    0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3, 0x25, 0x54, 0x80, 0xE1,
-    0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32, 0x06, 0x02, 0x50, 0xE3,
-    0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3, 0x25, 0x54, 0x80, 0xE1,
-    0x04, 0x50, 0x8C, 0xE4, 0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32,
-    0x06, 0x02, 0x50, 0xE3, 0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3,
-    0x00, 0x50, 0xA0, 0xE1, 0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32,
-    0x06, 0x02, 0x50, 0xE3, 0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3,
-    0x25, 0x54, 0x80, 0xE1, 0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32,
-    0x06, 0x02, 0x50, 0xE3, 0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3,
-    0x25, 0x54, 0x80, 0xE1, 0xA2, 0x20, 0xB0, 0xE1, 0x03, 0x04, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32,
-    0x06, 0x02, 0x50, 0xE3, 0x06, 0x02, 0xA0, 0xC3, 0x0A, 0x02, 0x50, 0xE3, 0x0A, 0x02, 0xA0, 0xB3,
-    0x25, 0x54, 0x80, 0xE1, 0x04, 0x50, 0x8C, 0xE4, 0x04, 0xF0, 0x1F, 0xE5, 0xF0, 0x37, 0x00, 0x06,
-    0x04, 0x20, 0x9C, 0xE5, 0x02, 0x00, 0x51, 0xE1, 0x00, 0x00, 0x8C, 0x05, 0x1E, 0xFF, 0x2F, 0x01,
-    0x03, 0x40, 0x2D, 0xE9, 0x27, 0x00, 0x00, 0xEB, 0x03, 0x40, 0xBD, 0xE8, 0x02, 0x00, 0x00, 0xEA,
-    0x08, 0x20, 0x9C, 0xE5, 0x01, 0x00, 0x12, 0xE3, 0xF4, 0xFF, 0xFF, 0x0A, 0x03, 0x00, 0x8C, 0xE8,
-    0x10, 0x27, 0x9A, 0xE5, 0x02, 0x10, 0x41, 0xE0, 0x0C, 0x07, 0x9A, 0xE5, 0x00, 0x10, 0x51, 0xE0,
-    0x09, 0x00, 0x00, 0xAA, 0x48, 0x04, 0x50, 0xE0, 0x00, 0x20, 0x82, 0x10, 0x10, 0x27, 0x8A, 0x15,
-    0x48, 0x04, 0x81, 0xE0, 0x0C, 0x07, 0x8A, 0xE5, 0x01, 0x84, 0x88, 0xE0, 0x1C, 0x07, 0x9A, 0xE5,
-    0x08, 0x00, 0x8C, 0xE5, 0x1C, 0xC7, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x10, 0x81, 0xE0,
-    0x1C, 0x07, 0x9A, 0xE5, 0x18, 0x00, 0x2D, 0xE9, 0x08, 0x40, 0x90, 0xE5, 0x00, 0x00, 0x54, 0xE3,
-    0x05, 0x00, 0x00, 0x0A, 0x04, 0x30, 0x94, 0xE5, 0x02, 0x30, 0x43, 0xE0, 0x03, 0x00, 0x51, 0xE1,
-    0x01, 0x00, 0x00, 0xBA, 0x04, 0x00, 0xA0, 0xE1, 0xF6, 0xFF, 0xFF, 0xEA, 0x08, 0x40, 0x8C, 0xE5,
-    0x08, 0xC0, 0x80, 0xE5, 0x18, 0x00, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x08, 0x10, 0x9C, 0xE5,
-    0x01, 0x00, 0x11, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0x1C, 0x17, 0x9A, 0xE5, 0x0C, 0x00, 0x51, 0xE1,
-    0x0A, 0x00, 0x00, 0x0A, 0x01, 0x00, 0xA0, 0xE1, 0x00, 0x00, 0x50, 0xE3, 0x1E, 0xFF, 0x2F, 0x01,
-    0x08, 0x10, 0x90, 0xE5, 0x0C, 0x00, 0x51, 0xE1, 0xF9, 0xFF, 0xFF, 0x1A, 0x08, 0x20, 0x9C, 0xE5,
-    0x08, 0x20, 0x80, 0xE5, 0x01, 0x20, 0xA0, 0xE3, 0x08, 0x20, 0x8C, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x0C, 0x07, 0x9A, 0xE5, 0x48, 0x04, 0x40, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x00, 0x20, 0x82, 0xE0,
-    0x10, 0x27, 0x8A, 0xE5, 0x08, 0x00, 0x91, 0xE5, 0x1C, 0x07, 0x8A, 0xE5, 0x01, 0x00, 0x80, 0xE2,
-    0x08, 0x00, 0x81, 0xE5, 0x03, 0x10, 0x90, 0xE5, 0x02, 0x10, 0x41, 0xE0, 0x0C, 0x17, 0x8A, 0xE5,
-    0xFF, 0x80, 0x08, 0xE2, 0x01, 0x84, 0x88, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0x0C, 0x27, 0x9A, 0xE5,
-    0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0x14, 0xC7, 0x9A, 0xE5,
-    0x0C, 0x10, 0x41, 0xE0, 0xEC, 0xC7, 0x9A, 0xE5, 0x91, 0x2C, 0xCC, 0xE0, 0x06, 0x02, 0x52, 0xE3,
-    0x00, 0xC0, 0xDC, 0xE2, 0x00, 0xC0, 0xA0, 0x43, 0x1E, 0xFF, 0x2F, 0xE1, 0x02, 0x00, 0x51, 0xE1,
-    0x0B, 0x00, 0x00, 0x1A, 0x03, 0x0C, 0x78, 0xE3, 0x09, 0x00, 0x00, 0xBA, 0x1C, 0xC7, 0x9A, 0xE5,
-    0x70, 0x00, 0x9F, 0xE5, 0x0C, 0x00, 0x50, 0xE1, 0x6C, 0x00, 0x9F, 0x15, 0x0C, 0x00, 0x50, 0x11,
-    0x68, 0x00, 0x9F, 0x15, 0x0C, 0x00, 0x50, 0x11, 0x02, 0x00, 0x00, 0x1A, 0x01, 0x00, 0xD9, 0xE4,
-    0x00, 0xF1, 0x9A, 0xE7, 0x1C, 0xC7, 0x9A, 0xE5, 0x08, 0x10, 0x9C, 0xE5, 0x1C, 0x17, 0x8A, 0xE5,
-    0x01, 0x20, 0xA0, 0xE3, 0x08, 0x20, 0x8C, 0xE5, 0x04, 0x20, 0x91, 0xE5, 0x04, 0x10, 0x9C, 0xE5,
-    0x01, 0x10, 0x42, 0xE0, 0x00, 0xE0, 0x9C, 0xE5, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0,
-    0x01, 0x84, 0x88, 0xE0, 0x48, 0x14, 0xA0, 0xE1, 0x0C, 0x17, 0x8A, 0xE5, 0x10, 0x17, 0x9A, 0xE5,
-    0x02, 0x10, 0x81, 0xE0, 0x10, 0x17, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x50, 0x46, 0x00, 0x00,
-    0x50, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x75, 0x00, 0x03, 0xBC, 0x75, 0x00, 0x03,
-    0xD4, 0x75, 0x00, 0x03, 0x78, 0x27, 0x9A, 0xE5, 0x04, 0x00, 0x00, 0xEB, 0xF4, 0xF1, 0x9F, 0xE5,
-    0x0C, 0x17, 0x9A, 0xE5, 0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x01, 0x20, 0x82, 0xE0,
-    0x0C, 0x20, 0x82, 0xE2, 0xB8, 0x14, 0x9A, 0xE5, 0xB8, 0x24, 0x8A, 0xE5, 0x01, 0x10, 0x42, 0xE0,
-    0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x0C, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x07, 0x10, 0xE3,
-    0x13, 0x00, 0x00, 0x1A, 0xC0, 0x01, 0x9F, 0xE5, 0x90, 0xC1, 0x81, 0xE0, 0xBC, 0x04, 0x9A, 0xE5,
-    0x0C, 0x00, 0x90, 0xE0, 0xBC, 0x04, 0x8A, 0xE5, 0x00, 0x10, 0xA1, 0xE2, 0xA0, 0x04, 0x9A, 0xE5,
-    0x01, 0x0C, 0x90, 0xE0, 0x00, 0x0C, 0x80, 0x20, 0xA0, 0x04, 0x8A, 0xE5, 0x1E, 0xFF, 0x2F, 0x31,
-    0x04, 0x40, 0x2D, 0xE9, 0x02, 0x10, 0xA0, 0xE1, 0x90, 0x01, 0x9F, 0xE5, 0x07, 0xCC, 0x8A, 0xE2,
-    0x80, 0xC0, 0x8C, 0xE2, 0x0F, 0xE0, 0xA0, 0xE1, 0x84, 0xF1, 0x9F, 0xE5, 0x02, 0x40, 0xBD, 0xE8,
-    0x08, 0x00, 0x00, 0xEA, 0x7C, 0x01, 0x9F, 0xE5, 0x90, 0xC1, 0x81, 0xE0, 0xEE, 0xFF, 0xFF, 0xEA,
-    0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0, 0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0,
-    0x0C, 0x10, 0x81, 0xE2, 0xB8, 0x14, 0x8A, 0xE5, 0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x0C, 0x10, 0xE3,
-    0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x07, 0x10, 0xE3, 0x20, 0x0C, 0xA0, 0xE1, 0x01, 0x0C, 0x60, 0xE2,
-    0x12, 0x00, 0x00, 0x1A, 0xBC, 0x24, 0x9A, 0xE5, 0x03, 0x05, 0x52, 0xE3, 0x08, 0x00, 0x00, 0x8A,
-    0x00, 0x20, 0xA0, 0xE3, 0xBC, 0x24, 0x8A, 0xE5, 0x2C, 0x21, 0x9F, 0xE5, 0x92, 0x10, 0x21, 0xE0,
-    0x0C, 0x10, 0x41, 0xE2, 0xF8, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2,
-    0x0C, 0xF1, 0x9F, 0xE5, 0x10, 0xC1, 0x9F, 0xE5, 0x00, 0x20, 0x62, 0xE2, 0x9C, 0x22, 0x80, 0xE0,
-    0x00, 0x10, 0x81, 0xE0, 0xA3, 0x04, 0xDA, 0xE5, 0xFF, 0x00, 0x60, 0xE2, 0xF1, 0xFF, 0xFF, 0xEA,
-    0x80, 0x00, 0x80, 0xE0, 0x00, 0x10, 0x81, 0xE0, 0xF0, 0xFF, 0xFF, 0xEA, 0xA0, 0x04, 0xCA, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xF0, 0x20, 0x02, 0xE2, 0x0F, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x80, 0xE1,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0x0F, 0x20, 0x02, 0xE2, 0x00, 0x02, 0x82, 0xE1,
-    0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA0, 0x14, 0x9A, 0xE5, 0x02, 0x0C, 0x11, 0xE3,
-    0x06, 0x00, 0x00, 0x0A, 0xA2, 0x24, 0xDA, 0xE5, 0x00, 0x20, 0x22, 0xE0, 0x06, 0x00, 0x12, 0xE3,
-    0x02, 0x00, 0x00, 0x0A, 0x03, 0x40, 0x2D, 0xE9, 0xA4, 0xFF, 0xFF, 0xEB, 0x03, 0x40, 0xBD, 0xE8,
-    0x20, 0x24, 0xDA, 0xE5, 0x02, 0x20, 0xC2, 0xE3, 0x20, 0x24, 0xCA, 0xE5, 0xFF, 0x18, 0xC1, 0xE3,
-    0x00, 0x18, 0x81, 0xE1, 0x02, 0x00, 0x10, 0xE3, 0x02, 0x1C, 0x81, 0x13, 0xA0, 0x14, 0x8A, 0x05,
-    0x1E, 0xFF, 0x2F, 0x01, 0xFF, 0x14, 0xC1, 0xE3, 0x01, 0x1C, 0x81, 0xE1, 0xA0, 0x14, 0x8A, 0xE5,
-    0x00, 0x10, 0xA0, 0xE3, 0xBC, 0x14, 0x8A, 0xE5, 0xB8, 0xFF, 0xFF, 0xEA, 0x20, 0x04, 0xDA, 0xE5,
-    0x02, 0x00, 0xC0, 0xE3, 0x20, 0x04, 0xCA, 0xE5, 0xA0, 0x04, 0x9A, 0xE5, 0x02, 0x0C, 0x10, 0xE3,
-    0x07, 0x00, 0x00, 0x0A, 0x01, 0x08, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0x00, 0x40, 0x2D, 0xE9,
-    0x8A, 0xFF, 0xFF, 0xEB, 0x00, 0x40, 0xBD, 0xE8, 0x00, 0x00, 0xA0, 0xE3, 0xA1, 0x04, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x08, 0x10, 0xE3, 0x02, 0x00, 0xA0, 0xE3, 0xA1, 0x04, 0xCA, 0xE5,
-    0xA6, 0xFF, 0xFF, 0xEA, 0x1E, 0xFF, 0x2F, 0xE1, 0x88, 0x44, 0x00, 0x03, 0x0D, 0x30, 0xC0, 0x00,
-    0x90, 0x6D, 0x00, 0x03, 0xA0, 0x66, 0x00, 0x03, 0x56, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00,
-    0x10, 0x00, 0x10, 0xE3, 0x14, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0x2D, 0xE9, 0x10, 0x00, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x04, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0x00, 0xF0, 0x1F, 0xE5,
-    0xAC, 0x46, 0x00, 0x03, 0x58, 0x48, 0x00, 0x03, 0x2C, 0xC0, 0x8F, 0xE2, 0x80, 0x00, 0x10, 0xE3,
-    0x40, 0xF1, 0x9F, 0x15, 0xA5, 0x24, 0xDA, 0xE5, 0xA4, 0x14, 0xDA, 0xE5, 0x01, 0x00, 0x00, 0xE2,
-    0x10, 0x02, 0x81, 0xE1, 0x04, 0x00, 0x52, 0xE3, 0x0C, 0xF0, 0xA0, 0x01, 0x01, 0x20, 0x82, 0xE2,
-    0xA5, 0x24, 0xCA, 0xE5, 0xA4, 0x04, 0xCA, 0xE5, 0x0E, 0xF0, 0xA0, 0xE1, 0xA4, 0x54, 0xCA, 0xE5,
-    0xA5, 0x54, 0xCA, 0xE5, 0xA0, 0x04, 0xCA, 0xE5, 0x0E, 0xC0, 0xA0, 0xE1, 0x02, 0x00, 0x10, 0xE3,
-    0x03, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x10, 0xE3, 0xE7, 0xF6, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x0E, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x10, 0xE3, 0xE6, 0xF6, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1,
-    0x0A, 0x00, 0x00, 0xEA, 0x00, 0xC0, 0x8F, 0xE2, 0xE3, 0xFF, 0xFF, 0xEA, 0xA4, 0x54, 0xCA, 0xE5,
-    0xA5, 0x54, 0xCA, 0xE5, 0xA1, 0x04, 0xCA, 0xE5, 0x04, 0x00, 0x00, 0xEA, 0x00, 0xC0, 0x8F, 0xE2,
-    0xDD, 0xFF, 0xFF, 0xEA, 0xA4, 0x54, 0xCA, 0xE5, 0xA5, 0x54, 0xCA, 0xE5, 0xA2, 0x04, 0xCA, 0xE5,
-    0x1C, 0x15, 0x9A, 0xE5, 0x02, 0x01, 0x11, 0xE3, 0x16, 0x00, 0x00, 0x1A, 0xA1, 0x04, 0xDA, 0xE5,
-    0x0E, 0xC0, 0xA0, 0xE1, 0xA0, 0x14, 0xDA, 0xE5, 0x10, 0x00, 0x11, 0xE3, 0x02, 0x00, 0x00, 0x1A,
-    0xCE, 0xF7, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1, 0x0E, 0x00, 0x00, 0xEA, 0xBA, 0xF7, 0xFF, 0xEB,
-    0xA2, 0x04, 0xDA, 0xE5, 0xDF, 0xF7, 0xFF, 0xEB, 0x0C, 0xE0, 0xA0, 0xE1, 0x09, 0x00, 0x00, 0xEA,
-    0x01, 0x0C, 0x50, 0xE3, 0x03, 0x10, 0x59, 0x05, 0xEE, 0x00, 0x51, 0x03, 0xFF, 0x00, 0xA0, 0x03,
-    0x00, 0xC0, 0x8F, 0xE2, 0xC4, 0xFF, 0xFF, 0xEA, 0x0F, 0x00, 0x00, 0xE2, 0xA4, 0x54, 0xCA, 0xE5,
-    0xA5, 0x54, 0xCA, 0xE5, 0xA3, 0x04, 0xCA, 0xE5, 0xA1, 0x04, 0xDA, 0xE5, 0xA3, 0x14, 0xDA, 0xE5,
-    0x10, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x80, 0xE1, 0xA0, 0x14, 0xDA, 0xE5, 0x08, 0x00, 0x11, 0xE3,
-    0x0B, 0x00, 0x00, 0x0A, 0x04, 0xE0, 0x2D, 0xE5, 0x00, 0xC0, 0xA0, 0xE1, 0x04, 0x00, 0x11, 0xE3,
-    0x03, 0x00, 0x00, 0x0A, 0xFB, 0xF6, 0xFF, 0xEB, 0x0F, 0x00, 0x8C, 0xE3, 0x04, 0xE0, 0x9D, 0xE4,
-    0x0B, 0xF7, 0xFF, 0xEA, 0x0A, 0xF7, 0xFF, 0xEB, 0x10, 0x00, 0x0C, 0xE2, 0x04, 0xE0, 0x9D, 0xE4,
-    0xF4, 0xF6, 0xFF, 0xEA, 0x12, 0xF7, 0xFF, 0xEA, 0xEC, 0x9B, 0x00, 0x08, 0x01, 0x00, 0x00, 0xEB,
-    0x38, 0x00, 0x00, 0xEB, 0x1B, 0xF6, 0xFF, 0xEA, 0xB8, 0xC4, 0x9A, 0xE5, 0x0C, 0x17, 0x9A, 0xE5,
-    0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x01, 0x20, 0x82, 0xE0, 0xB8, 0x24, 0x8A, 0xE5,
-    0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x11, 0x58, 0x04, 0xDA, 0xE5,
-    0x10, 0x10, 0x10, 0xE2, 0x01, 0x10, 0xA0, 0x13, 0x28, 0x00, 0x10, 0xE2, 0x01, 0x00, 0xA0, 0x13,
-    0x00, 0x00, 0x51, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x01, 0x00, 0x10, 0xE3, 0x14, 0x17, 0x9A, 0xE5,
-    0xB0, 0x04, 0x9A, 0x15, 0xB4, 0x04, 0x9A, 0x05, 0x01, 0x02, 0x40, 0xE0, 0x0C, 0xC2, 0x80, 0xE0,
-    0x02, 0x22, 0x80, 0xE0, 0xBC, 0x04, 0x9A, 0xE5, 0x90, 0x1C, 0x8C, 0xE0, 0x90, 0x12, 0x82, 0xE0,
-    0x0C, 0x00, 0x52, 0xE0, 0x1E, 0xFF, 0x2F, 0x01, 0xA2, 0x14, 0xDA, 0xE5, 0xA0, 0x24, 0xDA, 0xE5,
-    0x00, 0x00, 0x52, 0xE3, 0x0E, 0x00, 0x00, 0x0A, 0x00, 0xC0, 0x52, 0xE0, 0xA0, 0xC4, 0xCA, 0xE5,
-    0x13, 0x00, 0x00, 0x1A, 0x01, 0x00, 0x11, 0xE3, 0x11, 0x00, 0x00, 0x0A, 0x07, 0xCC, 0x8A, 0xE2,
-    0x80, 0xC0, 0x8C, 0xE2, 0xB8, 0x14, 0x9A, 0xE5, 0xA3, 0x04, 0xDA, 0xE5, 0x00, 0x10, 0x81, 0xE0,
-    0xD8, 0x00, 0x9F, 0xE5, 0x00, 0x40, 0x2D, 0xE9, 0x74, 0xFE, 0xFF, 0xEB, 0x00, 0x40, 0xBD, 0xE8,
-    0x07, 0x00, 0x00, 0xEA, 0x04, 0x00, 0x11, 0xE3, 0x04, 0x10, 0xC1, 0xE3, 0xA2, 0x14, 0xCA, 0xE5,
-    0xA1, 0x24, 0xDA, 0xE5, 0x01, 0x20, 0x82, 0x12, 0xA0, 0x24, 0xCA, 0xE5, 0x02, 0x20, 0xB0, 0xE1,
-    0xEB, 0xFF, 0xFF, 0x0A, 0x1E, 0xFF, 0x2F, 0xE1, 0xF4, 0x06, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x1F, 0x00, 0x00, 0x1A, 0x58, 0x04, 0xDA, 0xE5, 0x10, 0x10, 0x10, 0xE2, 0x01, 0x10, 0xA0, 0x13,
-    0x28, 0x00, 0x10, 0xE2, 0x01, 0x00, 0xA0, 0x13, 0x00, 0x00, 0x51, 0xE1, 0x18, 0x00, 0x00, 0x0A,
-    0xA0, 0x14, 0x9A, 0xE5, 0xFF, 0x14, 0xD1, 0xE3, 0x15, 0x00, 0x00, 0x0A, 0xB8, 0x24, 0x9A, 0xE5,
-    0x14, 0x17, 0x9A, 0xE5, 0x01, 0x20, 0x42, 0xE0, 0x01, 0x00, 0x10, 0xE3, 0xB0, 0x14, 0x9A, 0x15,
-    0xB4, 0x14, 0x9A, 0x05, 0x02, 0x22, 0x81, 0xE0, 0xBC, 0x04, 0x9A, 0xE5, 0x90, 0xC2, 0x82, 0xE0,
-    0xA0, 0xC4, 0xDA, 0xE5, 0x0C, 0xC0, 0xB0, 0xE1, 0x01, 0xC0, 0xA0, 0x03, 0x0C, 0x20, 0x82, 0xE0,
-    0x08, 0xC8, 0x9A, 0xE5, 0x9C, 0x02, 0x02, 0xE0, 0x01, 0x20, 0x42, 0xE0, 0x14, 0x07, 0x9A, 0xE5,
-    0x22, 0x12, 0x80, 0xE0, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0x20, 0x00, 0x9F, 0xE5,
-    0x46, 0xFE, 0xFF, 0xEA, 0x07, 0xCC, 0x8A, 0xE2, 0x74, 0xC0, 0x8C, 0xE2, 0x66, 0xFE, 0xFF, 0xEA,
-    0x20, 0x04, 0xDA, 0xE5, 0x02, 0x00, 0x80, 0xE3, 0x20, 0x04, 0xCA, 0xE5, 0xBD, 0xF5, 0xFF, 0xEA,
-    0x90, 0x6D, 0x00, 0x03, 0x0C, 0x6C, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03,
-    0xBC, 0x52, 0x00, 0x03, 0xBC, 0x52, 0x00, 0x03, 0xE8, 0x52, 0x00, 0x03, 0xB0, 0x50, 0x00, 0x03,
-    0x50, 0x58, 0x00, 0x03, 0xD0, 0x52, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0xA8, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x52, 0x00, 0x03, 0x3C, 0x53, 0x00, 0x03,
-    0x30, 0x53, 0x00, 0x03, 0x24, 0x53, 0x00, 0x03, 0x18, 0x53, 0x00, 0x03, 0xDC, 0x52, 0x00, 0x03,
-    0x88, 0x50, 0x00, 0x03, 0x24, 0x58, 0x00, 0x03, 0xC4, 0x52, 0x00, 0x03, 0x00, 0x28, 0x00, 0x03,
-    0x54, 0x5B, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x44, 0x5E, 0x00, 0x08,
-    0x58, 0x28, 0x00, 0x03, 0x78, 0x28, 0x00, 0x03, 0xF4, 0x5C, 0x00, 0x08, 0xA0, 0x28, 0x00, 0x03,
-    0xD4, 0x28, 0x00, 0x03, 0xF0, 0x28, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x6C, 0x5E, 0x00, 0x08,
-    0x0C, 0x29, 0x00, 0x03, 0x3C, 0x29, 0x00, 0x03, 0x20, 0x5D, 0x00, 0x08, 0x80, 0x29, 0x00, 0x03,
-    0xE8, 0x29, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0x30, 0x2A, 0x00, 0x03, 0x54, 0x2A, 0x00, 0x03, 0x68, 0x5D, 0x00, 0x08, 0x80, 0x2A, 0x00, 0x03,
-    0x94, 0x2A, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0x98, 0x5D, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0xD0, 0x2A, 0x00, 0x03, 0x0C, 0x2B, 0x00, 0x03, 0xE4, 0x5D, 0x00, 0x08, 0x54, 0x2B, 0x00, 0x03,
-    0x90, 0x5B, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xA0, 0x2B, 0x00, 0x03,
-    0xCC, 0x2B, 0x00, 0x03, 0xEC, 0x2B, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x18, 0x2C, 0x00, 0x03,
-    0x48, 0x2C, 0x00, 0x03, 0x64, 0x2C, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x88, 0x2C, 0x00, 0x03,
-    0xC4, 0x2C, 0x00, 0x03, 0xF4, 0x2C, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x38, 0x2D, 0x00, 0x03,
-    0xA0, 0x2D, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0xE8, 0x2D, 0x00, 0x03, 0x0C, 0x2E, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x3C, 0x2E, 0x00, 0x03,
-    0x50, 0x2E, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0x8C, 0x2E, 0x00, 0x03, 0xC8, 0x2E, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x10, 0x2F, 0x00, 0x03,
-    0xCC, 0x5B, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x44, 0x5E, 0x00, 0x08,
-    0x74, 0x2F, 0x00, 0x03, 0x94, 0x2F, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xB8, 0x2F, 0x00, 0x03,
-    0xD8, 0x2F, 0x00, 0x03, 0xF4, 0x2F, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x1C, 0x30, 0x00, 0x03,
-    0x4C, 0x30, 0x00, 0x03, 0x7C, 0x30, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xC0, 0x30, 0x00, 0x03,
-    0x28, 0x31, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0x70, 0x31, 0x00, 0x03, 0x94, 0x31, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xBC, 0x31, 0x00, 0x03,
-    0xC8, 0x31, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0x04, 0x32, 0x00, 0x03, 0x40, 0x32, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x88, 0x32, 0x00, 0x03,
-    0x08, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x44, 0x5E, 0x00, 0x08,
-    0xD0, 0x32, 0x00, 0x03, 0x00, 0x33, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x30, 0x33, 0x00, 0x03,
-    0x58, 0x33, 0x00, 0x03, 0x84, 0x33, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xA8, 0x33, 0x00, 0x03,
-    0xF4, 0x33, 0x00, 0x03, 0x34, 0x34, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x7C, 0x34, 0x00, 0x03,
-    0xE4, 0x34, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0x3C, 0x35, 0x00, 0x03, 0x70, 0x35, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xA4, 0x35, 0x00, 0x03,
-    0xB8, 0x35, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0x04, 0x36, 0x00, 0x03, 0x50, 0x36, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x30, 0x5E, 0x00, 0x08,
-    0x9C, 0x36, 0x00, 0x03, 0x30, 0x5E, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xD4, 0x36, 0x00, 0x03,
-    0xF0, 0x36, 0x00, 0x03, 0x0C, 0x37, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x28, 0x37, 0x00, 0x03,
-    0x30, 0x5E, 0x00, 0x08, 0x40, 0x37, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x37, 0x00, 0x03,
-    0x84, 0x37, 0x00, 0x03, 0xB0, 0x37, 0x00, 0x03, 0x10, 0x5F, 0x00, 0x08, 0xDC, 0x37, 0x00, 0x03,
-    0x44, 0x38, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x38, 0x00, 0x03,
-    0xA0, 0x38, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x38, 0x00, 0x03,
-    0xF8, 0x38, 0x00, 0x03, 0x28, 0x39, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08,
-    0x40, 0x39, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x70, 0x39, 0x00, 0x03,
-    0x88, 0x39, 0x00, 0x03, 0xC4, 0x39, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xDC, 0x39, 0x00, 0x03,
-    0xF8, 0x39, 0x00, 0x03, 0x14, 0x3A, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x30, 0x3A, 0x00, 0x03,
-    0x48, 0x3A, 0x00, 0x03, 0x60, 0x3A, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x78, 0x3A, 0x00, 0x03,
-    0xA8, 0x3A, 0x00, 0x03, 0xD8, 0x3A, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x08, 0x3B, 0x00, 0x03,
-    0x70, 0x3B, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x9C, 0x5E, 0x00, 0x08, 0xB8, 0x3B, 0x00, 0x03,
-    0xDC, 0x3B, 0x00, 0x03, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x24, 0x3C, 0x00, 0x03,
-    0x38, 0x3C, 0x00, 0x03, 0x74, 0x3C, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x90, 0x3C, 0x00, 0x03,
-    0xCC, 0x3C, 0x00, 0x03, 0x08, 0x3D, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x44, 0x3D, 0x00, 0x03,
-    0x54, 0x5C, 0x00, 0x08, 0x30, 0x5E, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x64, 0x3D, 0x00, 0x03,
-    0x88, 0x3D, 0x00, 0x03, 0xAC, 0x3D, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xD0, 0x3D, 0x00, 0x03,
-    0xE8, 0x3D, 0x00, 0x03, 0x08, 0x3E, 0x00, 0x03, 0xF0, 0x5E, 0x00, 0x08, 0x20, 0x3E, 0x00, 0x03,
-    0x54, 0x3E, 0x00, 0x03, 0x88, 0x3E, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xC4, 0x3E, 0x00, 0x03,
-    0x2C, 0x3F, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0x78, 0x3F, 0x00, 0x03, 0xA0, 0x3F, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xC8, 0x3F, 0x00, 0x03,
-    0xDC, 0x3F, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0x1C, 0x40, 0x00, 0x03, 0x5C, 0x40, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x9C, 0x40, 0x00, 0x03,
-    0x94, 0x5C, 0x00, 0x08, 0x30, 0x5E, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0xBC, 0x40, 0x00, 0x03,
-    0xE0, 0x40, 0x00, 0x03, 0x10, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x34, 0x41, 0x00, 0x03,
-    0x4C, 0x41, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0x4C, 0x41, 0x00, 0x03, 0x88, 0x41, 0x00, 0x03,
-    0xBC, 0x41, 0x00, 0x03, 0xFC, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x38, 0x42, 0x00, 0x03,
-    0xDC, 0x42, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0xE0, 0x5C, 0x00, 0x08, 0x58, 0x5E, 0x00, 0x08,
-    0x34, 0x43, 0x00, 0x03, 0x68, 0x43, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x90, 0x43, 0x00, 0x03,
-    0xA4, 0x43, 0x00, 0x03, 0x78, 0x41, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x80, 0x5E, 0x00, 0x08,
-    0xF0, 0x43, 0x00, 0x03, 0x3C, 0x44, 0x00, 0x03, 0xE0, 0x5C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xC0, 0xFC, 0x03, 0x02,
-    0x80, 0xFB, 0x03, 0x02, 0xDC, 0xED, 0x03, 0x02, 0xB0, 0xED, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x5D, 0x00, 0x03,
-    0xF0, 0x5D, 0x00, 0x03, 0xFC, 0x5D, 0x00, 0x03, 0x08, 0x5E, 0x00, 0x03, 0xB0, 0x5D, 0x00, 0x03,
-    0xF0, 0x5D, 0x00, 0x03, 0xFC, 0x5D, 0x00, 0x03, 0x18, 0x5E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xE1, 0x03, 0x02,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE1, 0x03, 0x02,
-    0x8C, 0xE1, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x8C, 0xE5, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x02, 0x00, 0xFF, 0x03, 0x02, 0x08, 0xF6, 0x03, 0x02,
-    0x28, 0xF4, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF2, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xC1, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x58, 0xF1, 0x03, 0x02, 0x68, 0xF0, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x38, 0xEE, 0x03, 0x02, 0xC0, 0xEE, 0x03, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xEF, 0xBE, 0xAD, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x49, 0xD0, 0x00, 0x08, 0x01, 0xCE, 0x00, 0x08,
-    0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x40, 0xC0, 0x10, 0x90, 0x50, 0xD0,
-    0x20, 0xA0, 0x60, 0xE0, 0x30, 0xB0, 0x70, 0xF0, 0x00, 0x02, 0x01, 0x03, 0x04, 0x06, 0x05, 0x07,
-    0x08, 0x0A, 0x09, 0x0B, 0x0C, 0xE0, 0xD0, 0x0F, 0x0E, 0x60, 0xA0, 0xE1, 0x24, 0x44, 0x9A, 0xE5,
-    0x24, 0x01, 0xB0, 0xE1, 0x38, 0x14, 0x9A, 0xE5, 0xF0, 0x00, 0x01, 0xE2, 0xE8, 0x25, 0x9A, 0xE5,
-    0x02, 0x10, 0x01, 0x20, 0xA1, 0xC4, 0xB0, 0x21, 0x22, 0x18, 0x01, 0x20, 0x4C, 0xC0, 0x4F, 0xE2,
-    0x20, 0x02, 0xDC, 0xE7, 0x0F, 0x10, 0x01, 0xE2, 0x01, 0x0B, 0x12, 0xE3, 0x4C, 0xC0, 0x4F, 0x12,
-    0x01, 0x10, 0xDC, 0x17, 0x00, 0x00, 0x81, 0xE1, 0x02, 0x01, 0x12, 0xE3, 0xC0, 0xF0, 0x9F, 0x15,
-    0x02, 0x02, 0x12, 0xE3, 0xEC, 0x05, 0xCA, 0x15, 0x01, 0x01, 0x12, 0xE3, 0xED, 0x05, 0xCA, 0x15,
-    0x00, 0x00, 0x10, 0xE2, 0x06, 0xF0, 0xA0, 0xE1, 0x01, 0x00, 0x10, 0xE2, 0xF9, 0x05, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0x01, 0xF8, 0x25, 0xDA, 0xE5, 0x03, 0x00, 0x52, 0xE3, 0x00, 0x20, 0xE0, 0xE3,
-    0xEC, 0x05, 0xDA, 0xE5, 0xEE, 0x15, 0xDA, 0xE5, 0x01, 0x04, 0x80, 0xE1, 0x02, 0x04, 0x80, 0x41,
-    0x02, 0x07, 0x80, 0x53, 0xF0, 0x05, 0x8A, 0xE5, 0xED, 0x05, 0xDA, 0xE5, 0xEF, 0x15, 0xDA, 0xE5,
-    0x01, 0x04, 0x80, 0xE1, 0x02, 0x04, 0x80, 0x41, 0x01, 0x07, 0x80, 0x53, 0xF4, 0x05, 0x8A, 0xE5,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xF0, 0x05, 0x9A, 0xE5, 0xC0, 0x10, 0xA0, 0xE1, 0x01, 0x00, 0x00, 0xE2,
-    0xF9, 0x25, 0xDA, 0xE5, 0x02, 0x20, 0xB0, 0xE1, 0xF0, 0x15, 0x8A, 0x05, 0x28, 0x15, 0xDA, 0xE5,
-    0x10, 0x00, 0x11, 0xE3, 0x40, 0x00, 0x80, 0x03, 0x0E, 0xF0, 0xA0, 0x01, 0xEC, 0x15, 0xDA, 0xE5,
-    0x08, 0x00, 0x11, 0xE3, 0x40, 0x00, 0x80, 0x13, 0x0E, 0xF0, 0xA0, 0xE1, 0xF4, 0x05, 0x9A, 0xE5,
-    0xC0, 0x10, 0xA0, 0xE1, 0x01, 0x00, 0x00, 0xE2, 0xF9, 0x25, 0xDA, 0xE5, 0x02, 0x20, 0xB0, 0xE1,
-    0xF4, 0x15, 0x8A, 0x05, 0x28, 0x15, 0xDA, 0xE5, 0x10, 0x00, 0x11, 0xE3, 0xF8, 0x00, 0x80, 0x13,
-    0x0E, 0xF0, 0xA0, 0xE1, 0xC4, 0x6C, 0x00, 0x08, 0x7A, 0x04, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x01, 0xFF, 0x5F, 0x2D, 0xE9, 0x00, 0x00, 0x00, 0xEB, 0xFF, 0x9F, 0xBD, 0xE8,
-    0xE0, 0x85, 0x9F, 0xE5, 0xFF, 0x00, 0x98, 0xE8, 0x01, 0x00, 0x80, 0xE1, 0x02, 0x00, 0x80, 0xE1,
-    0x03, 0x00, 0x80, 0xE1, 0x04, 0x00, 0x80, 0xE1, 0x05, 0x00, 0x80, 0xE1, 0x06, 0x00, 0x80, 0xE1,
-    0x07, 0x00, 0x90, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x40, 0x2D, 0xE9, 0xB8, 0x75, 0x9F, 0xE5,
-    0x80, 0x54, 0x9A, 0xE5, 0x88, 0x64, 0x9A, 0xE5, 0xB0, 0x00, 0xD6, 0xE1, 0x02, 0x09, 0x10, 0xE3,
-    0x0F, 0xE0, 0xA0, 0x01, 0xA4, 0xF5, 0x9F, 0x05, 0x14, 0xB0, 0xA0, 0xE3, 0xA0, 0x25, 0x9F, 0xE5,
-    0x00, 0x90, 0xA0, 0xE3, 0x9C, 0xF5, 0x9F, 0xE5, 0x5A, 0x24, 0xDA, 0xE5, 0x18, 0x20, 0x02, 0xE2,
-    0x18, 0x00, 0x52, 0xE3, 0x20, 0x00, 0x00, 0x1A, 0x58, 0x24, 0xDA, 0xE5, 0x74, 0x14, 0xDA, 0xE5,
-    0x20, 0x00, 0x12, 0xE3, 0x02, 0x00, 0x00, 0x1A, 0x08, 0x00, 0x51, 0xE3, 0x1A, 0x00, 0x00, 0x2A,
-    0x20, 0x00, 0x12, 0xE3, 0x18, 0x00, 0x2D, 0xE9, 0xA8, 0xC6, 0x9A, 0xE5, 0x01, 0x00, 0xDC, 0xE5,
-    0x02, 0x30, 0xDC, 0xE5, 0x01, 0xC0, 0x00, 0x12, 0x01, 0x00, 0xC0, 0x13, 0x08, 0xC0, 0x02, 0x02,
-    0xAC, 0xC1, 0xA0, 0x01, 0x0C, 0x04, 0x80, 0xE0, 0x20, 0x43, 0xA0, 0xE1, 0x19, 0xCD, 0x8A, 0xE2,
-    0x04, 0x41, 0x9C, 0xE7, 0x3F, 0x00, 0x00, 0xE2, 0x00, 0x42, 0x84, 0xE0, 0x80, 0x00, 0x13, 0xE3,
-    0x02, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x12, 0xE3, 0x07, 0x10, 0x61, 0x02, 0x17, 0x10, 0x61, 0x12,
-    0x01, 0x00, 0xF4, 0xE7, 0x08, 0x40, 0xD4, 0xE5, 0x04, 0x00, 0x90, 0xE1, 0x01, 0x00, 0x00, 0x0A,
-    0x14, 0xF5, 0x9F, 0xE5, 0x60, 0x00, 0xBD, 0xE8, 0x18, 0x00, 0xBD, 0xE8, 0x74, 0x14, 0xDA, 0xE5,
-    0x01, 0x10, 0x81, 0xE2, 0x08, 0x00, 0x51, 0xE3, 0x10, 0x10, 0xA0, 0x03, 0x18, 0x00, 0x51, 0xE3,
-    0x08, 0x00, 0x00, 0x0A, 0x74, 0x14, 0xCA, 0xE5, 0x60, 0x17, 0x9A, 0xE5, 0x08, 0x08, 0x9A, 0xE5,
-    0x20, 0x12, 0x81, 0xE0, 0xC4, 0x00, 0x4F, 0xE2, 0x07, 0xCC, 0x8A, 0xE2, 0x5C, 0xC0, 0x8C, 0xE2,
-    0x0F, 0xE0, 0xA0, 0xE1, 0xD4, 0xF4, 0x9F, 0xE5, 0xD4, 0xF4, 0x9F, 0xE5, 0x00, 0x40, 0x2D, 0xE9,
-    0xFC, 0x16, 0x9A, 0xE5, 0x84, 0x20, 0x81, 0xE2, 0x0D, 0x05, 0xDA, 0xE5, 0x02, 0x00, 0x50, 0xE3,
-    0x04, 0x00, 0xA0, 0xE3, 0x00, 0x40, 0xA0, 0xE3, 0x0A, 0x00, 0x00, 0x3A, 0x01, 0x30, 0x72, 0xE5,
-    0x83, 0x30, 0x83, 0xE0, 0x23, 0x31, 0xA0, 0xE1, 0x0D, 0x30, 0x53, 0xE2, 0x00, 0x30, 0xA0, 0xD3,
-    0x9F, 0x00, 0x53, 0xE3, 0x9F, 0x30, 0xA0, 0xA3, 0x04, 0x44, 0x83, 0xE1, 0x01, 0x00, 0x50, 0xE2,
-    0xF5, 0xFF, 0xFF, 0xCA, 0x09, 0x00, 0x00, 0xEA, 0x77, 0x54, 0xDA, 0xE5, 0x01, 0x50, 0x85, 0xE2,
-    0x01, 0x30, 0x72, 0xE5, 0x05, 0x30, 0x53, 0xE0, 0x00, 0x30, 0xA0, 0xD3, 0x9F, 0x00, 0x53, 0xE3,
-    0x9F, 0x30, 0xA0, 0xA3, 0x04, 0x44, 0x83, 0xE1, 0x01, 0x00, 0x50, 0xE2, 0xF7, 0xFF, 0xFF, 0xCA,
-    0x00, 0x00, 0xA0, 0xE3, 0x24, 0x44, 0xA0, 0xE1, 0xFF, 0x44, 0x84, 0xE3, 0xFF, 0x20, 0x14, 0xE2,
-    0x02, 0x00, 0x00, 0x1A, 0x44, 0x44, 0xA0, 0xE1, 0x01, 0x00, 0x80, 0xE2, 0xFA, 0xFF, 0xFF, 0xEA,
-    0x04, 0x47, 0x8A, 0xE5, 0x02, 0x20, 0xB0, 0xE1, 0x9F, 0x00, 0x52, 0x13, 0x34, 0x34, 0x9F, 0xE5,
-    0x00, 0x50, 0xD3, 0xE5, 0x20, 0x50, 0x85, 0xE3, 0x20, 0x50, 0xC5, 0xA3, 0x00, 0x50, 0xC3, 0xE5,
-    0x01, 0x20, 0xC3, 0xB5, 0x00, 0x70, 0xA0, 0xE3, 0xFF, 0x20, 0x14, 0xE2, 0x9F, 0x00, 0x52, 0xE3,
-    0x02, 0x00, 0x00, 0xAA, 0x01, 0x70, 0x87, 0xE2, 0x44, 0x44, 0xA0, 0xE1, 0xF9, 0xFF, 0xFF, 0xEA,
-    0x84, 0x80, 0x81, 0xE2, 0x00, 0x80, 0x88, 0xE0, 0x80, 0x12, 0x81, 0xE0, 0x01, 0x90, 0xD8, 0xE4,
-    0x05, 0x04, 0xA0, 0xE3, 0xF0, 0x23, 0x9F, 0xE5, 0x01, 0x00, 0x19, 0xE3, 0x7E, 0x40, 0xA0, 0xE3,
-    0x60, 0x40, 0xA0, 0x13, 0x18, 0x00, 0x00, 0xEB, 0x16, 0x00, 0x00, 0xEB, 0x15, 0x00, 0x00, 0xEB,
-    0x14, 0x00, 0x00, 0xEB, 0x66, 0x0F, 0x80, 0xE2, 0x13, 0x00, 0x00, 0xEB, 0x11, 0x00, 0x00, 0xEB,
-    0x10, 0x00, 0x00, 0xEB, 0x0F, 0x00, 0x00, 0xEB, 0x01, 0x70, 0x57, 0xE2, 0x0C, 0x00, 0x00, 0xBA,
-    0xB8, 0x03, 0x9F, 0xE5, 0x40, 0x30, 0x40, 0xE2, 0x08, 0x37, 0x8A, 0xE5, 0x01, 0x90, 0xD8, 0xE4,
-    0x01, 0x00, 0x19, 0xE3, 0x7E, 0x40, 0xA0, 0xE3, 0x60, 0x40, 0xA0, 0x13, 0x08, 0xC0, 0xA0, 0xE3,
-    0x05, 0x00, 0x00, 0xEB, 0x01, 0xC0, 0x5C, 0xE2, 0xFC, 0xFF, 0xFF, 0xCA, 0x01, 0x70, 0x57, 0xE2,
-    0xF5, 0xFF, 0xFF, 0xAA, 0x00, 0x80, 0xBD, 0xE8, 0x18, 0x00, 0x80, 0xE2, 0x04, 0x30, 0x91, 0xE4,
-    0x83, 0x60, 0x04, 0xE0, 0xB6, 0x60, 0x92, 0xE1, 0xA3, 0x53, 0x04, 0xE0, 0xB5, 0x50, 0x92, 0xE1,
-    0x05, 0x58, 0x86, 0xE1, 0xA3, 0x67, 0x04, 0xE0, 0xB6, 0x60, 0x92, 0xE1, 0xA3, 0x3B, 0x04, 0xE0,
-    0xB3, 0x30, 0x92, 0xE1, 0x03, 0x68, 0x86, 0xE1, 0x60, 0x00, 0xA0, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x4C, 0xC3, 0x9F, 0xE5, 0x08, 0x27, 0x9C, 0xE5, 0x40, 0x20, 0x82, 0xE2, 0x08, 0x27, 0x8C, 0xE5,
-    0x04, 0x27, 0x9C, 0xE5, 0xFF, 0x10, 0x02, 0xE2, 0x42, 0x24, 0xA0, 0xE1, 0x04, 0x27, 0x8C, 0xE5,
-    0xFF, 0x20, 0x02, 0xE2, 0x9F, 0x00, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0xA1, 0x01, 0x00, 0x52, 0xE1,
-    0xF3, 0xFF, 0xFF, 0xDA, 0x9F, 0x00, 0x52, 0xE3, 0x04, 0x10, 0xD0, 0xE5, 0x30, 0x10, 0x81, 0xE3,
-    0x20, 0x10, 0xC1, 0xA3, 0x04, 0x10, 0xC0, 0xE5, 0xFF, 0x20, 0xA0, 0xA3, 0x05, 0x20, 0xC0, 0xE5,
-    0x06, 0x10, 0xD0, 0xE5, 0x02, 0x00, 0x51, 0xE1, 0xE9, 0xFF, 0xFF, 0xAA, 0x00, 0x12, 0x90, 0xE5,
-    0x02, 0x28, 0x11, 0xE2, 0x1E, 0xFF, 0x2F, 0x01, 0x02, 0x1C, 0x80, 0xE2, 0x02, 0x20, 0xA0, 0xE3,
-    0x02, 0x20, 0xC1, 0xE5, 0x04, 0x10, 0xD0, 0xE5, 0x10, 0x10, 0xC1, 0xE3, 0x04, 0x10, 0xC0, 0xE5,
-    0x30, 0x40, 0x2D, 0xE9, 0xC8, 0x52, 0x9F, 0xE5, 0x08, 0x57, 0x95, 0xE5, 0x05, 0x14, 0xA0, 0xE3,
-    0x1C, 0x10, 0xB5, 0xE8, 0x0C, 0x00, 0x81, 0xE8, 0x20, 0x10, 0x81, 0xE2, 0x10, 0x10, 0x81, 0xE8,
-    0x20, 0x10, 0x81, 0xE2, 0x1C, 0x10, 0xB5, 0xE8, 0x0C, 0x00, 0x81, 0xE8, 0x20, 0x10, 0x81, 0xE2,
-    0x10, 0x10, 0x81, 0xE8, 0x1A, 0x1E, 0x81, 0xE2, 0x1C, 0x10, 0xB5, 0xE8, 0x0C, 0x00, 0x81, 0xE8,
-    0x20, 0x10, 0x81, 0xE2, 0x10, 0x10, 0x81, 0xE8, 0x20, 0x10, 0x81, 0xE2, 0x1C, 0x10, 0xB5, 0xE8,
-    0x0C, 0x00, 0x81, 0xE8, 0x20, 0x10, 0x81, 0xE2, 0x10, 0x10, 0x81, 0xE8, 0x05, 0x10, 0xD0, 0xE5,
-    0x06, 0x20, 0xD0, 0xE5, 0x01, 0x00, 0x52, 0xE1, 0x30, 0x80, 0xBD, 0xB8, 0x30, 0x40, 0xBD, 0xE8,
-    0x04, 0x10, 0xA0, 0xE3, 0x02, 0x2C, 0x80, 0xE2, 0x02, 0x10, 0xC2, 0xE5, 0xBF, 0xFF, 0xFF, 0xEA,
-    0x00, 0x40, 0x2D, 0xE9, 0x0F, 0xE0, 0xA0, 0xE1, 0x48, 0xF2, 0x9F, 0xE5, 0x79, 0x04, 0xDA, 0xE5,
-    0x02, 0x00, 0x50, 0xE3, 0x00, 0x00, 0xA0, 0xE3, 0x79, 0x04, 0xCA, 0xE5, 0x0F, 0xE0, 0xA0, 0x11,
-    0x34, 0xF2, 0x9F, 0x15, 0xFF, 0x1C, 0xA0, 0xE3, 0xE8, 0x06, 0x9A, 0xE5, 0x00, 0x24, 0x81, 0xE1,
-    0xFF, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x80, 0xE1, 0xE8, 0x06, 0x8A, 0xE5, 0x64, 0x04, 0x9A, 0xE5,
-    0x00, 0x24, 0x81, 0xE1, 0xFF, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x80, 0xE1, 0x64, 0x04, 0x8A, 0xE5,
-    0x6C, 0x04, 0x9A, 0xE5, 0x00, 0x24, 0x81, 0xE1, 0xFF, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x80, 0xE1,
-    0x6C, 0x04, 0x8A, 0xE5, 0xE0, 0x06, 0x9A, 0xE5, 0x00, 0x24, 0x81, 0xE1, 0xFF, 0x00, 0x00, 0xE2,
-    0x02, 0x00, 0x80, 0xE1, 0xE0, 0x06, 0x8A, 0xE5, 0x34, 0x05, 0x9A, 0xE5, 0x00, 0x24, 0x81, 0xE1,
-    0xFF, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x80, 0xE1, 0x34, 0x05, 0x8A, 0xE5, 0xFA, 0x06, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x0F, 0xE0, 0xA0, 0x01, 0xC0, 0xF1, 0x9F, 0x05, 0xFA, 0x06, 0xDA, 0xE5,
-    0x00, 0x17, 0x9A, 0xE5, 0x80, 0x10, 0x81, 0xE2, 0xFF, 0x20, 0xA0, 0xE3, 0x04, 0x00, 0x50, 0xE3,
-    0x02, 0x00, 0x00, 0xAA, 0x00, 0x20, 0xC1, 0xE7, 0x01, 0x00, 0x80, 0xE2, 0xFA, 0xFF, 0xFF, 0xEA,
-    0x00, 0x00, 0xA0, 0xE3, 0xFA, 0x06, 0xCA, 0xE5, 0x94, 0xC1, 0x9F, 0xE5, 0xB0, 0x20, 0xDC, 0xE1,
-    0x01, 0x20, 0xC2, 0xE3, 0xB0, 0x20, 0xCC, 0xE1, 0xA0, 0x06, 0x9A, 0xE5, 0xA4, 0x16, 0x9A, 0xE5,
-    0xA0, 0x16, 0x8A, 0xE5, 0xA4, 0x06, 0x8A, 0xE5, 0xB0, 0x06, 0x9A, 0xE5, 0xB4, 0x16, 0x9A, 0xE5,
-    0xB0, 0x16, 0x8A, 0xE5, 0xB4, 0x06, 0x8A, 0xE5, 0xB8, 0x06, 0x9A, 0xE5, 0xBC, 0x16, 0x9A, 0xE5,
-    0xB8, 0x16, 0x8A, 0xE5, 0xBC, 0x06, 0x8A, 0xE5, 0x80, 0x04, 0x9A, 0xE5, 0x84, 0x14, 0x9A, 0xE5,
-    0x80, 0x14, 0x8A, 0xE5, 0x84, 0x04, 0x8A, 0xE5, 0x88, 0x04, 0x9A, 0xE5, 0x8C, 0x14, 0x9A, 0xE5,
-    0x88, 0x14, 0x8A, 0xE5, 0x8C, 0x04, 0x8A, 0xE5, 0x90, 0x04, 0x9A, 0xE5, 0x94, 0x04, 0x8A, 0xE5,
-    0x01, 0x00, 0xA0, 0xE3, 0x9D, 0x04, 0xCA, 0xE5, 0x28, 0x31, 0x9F, 0xE5, 0x28, 0x11, 0x9F, 0xE5,
-    0x00, 0x30, 0x93, 0xE5, 0x00, 0x10, 0x91, 0xE5, 0x01, 0x00, 0x53, 0xE1, 0x9C, 0x04, 0xCA, 0x05,
-    0x06, 0x3C, 0x8A, 0xE2, 0xD8, 0x30, 0x83, 0xE2, 0x03, 0x00, 0x93, 0xE8, 0x00, 0x10, 0x83, 0xE5,
-    0x04, 0x00, 0x83, 0xE5, 0x00, 0x07, 0x9A, 0xE5, 0xFC, 0x16, 0x9A, 0xE5, 0xFC, 0x06, 0x8A, 0xE5,
-    0x00, 0x17, 0x8A, 0xE5, 0x01, 0x0B, 0x8A, 0xE2, 0xD0, 0x00, 0x80, 0xE2, 0x01, 0x1B, 0x8A, 0xE2,
-    0xE0, 0x10, 0x81, 0xE2, 0x78, 0x00, 0x90, 0xE8, 0x78, 0x00, 0x81, 0xE8, 0xFC, 0x05, 0xDA, 0xE5,
-    0x00, 0x00, 0xB0, 0xE1, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0xE3, 0xFC, 0x05, 0xCA, 0xE5,
-    0xA8, 0x06, 0x9A, 0xE5, 0xAC, 0x16, 0x9A, 0xE5, 0xF0, 0x16, 0x8A, 0xE5, 0xAC, 0x06, 0x8A, 0xE5,
-    0xFF, 0x06, 0xA0, 0xE3, 0xFC, 0x05, 0x8A, 0xE5, 0x01, 0x20, 0x82, 0xE3, 0xB0, 0x20, 0xCC, 0xE1,
-    0x88, 0x64, 0x9A, 0xE5, 0xF0, 0x90, 0xD6, 0xE1, 0x09, 0x90, 0xB0, 0xE1, 0x05, 0x00, 0x00, 0x4A,
-    0x80, 0x54, 0x9A, 0xE5, 0x0F, 0xE0, 0xA0, 0xE1, 0x90, 0xF0, 0x9F, 0xE5, 0x88, 0x64, 0x9A, 0xE5,
-    0x02, 0x09, 0xA0, 0xE3, 0xB0, 0x00, 0xC6, 0xE1, 0x01, 0x00, 0xA0, 0xE3, 0xFD, 0x05, 0xCA, 0xE5,
-    0x76, 0x44, 0xDA, 0xE5, 0x01, 0x00, 0x34, 0xE3, 0x08, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0xE3,
-    0x01, 0x10, 0xA0, 0xE3, 0x00, 0x00, 0x04, 0xEF, 0x75, 0x04, 0xDA, 0xE5, 0x05, 0x00, 0x50, 0xE3,
-    0xF9, 0xFF, 0xFF, 0x0A, 0x02, 0x00, 0x34, 0xE3, 0x00, 0x40, 0xA0, 0x03, 0xF6, 0xFF, 0xFF, 0x0A,
-    0x00, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x90, 0xED, 0x03, 0x02, 0x8C, 0xEB, 0x03, 0x02,
-    0x80, 0x5F, 0x00, 0x03, 0xEC, 0x76, 0x00, 0x03, 0xC8, 0x5E, 0x00, 0x03, 0x04, 0x7A, 0x00, 0x08,
-    0xAC, 0x66, 0x00, 0x03, 0x88, 0x44, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x05,
-    0x40, 0x01, 0x00, 0x05, 0x3C, 0x6E, 0x00, 0x03, 0x9C, 0x64, 0x00, 0x03, 0x30, 0x31, 0x00, 0x06,
-    0xCC, 0x7B, 0x00, 0x08, 0x00, 0x02, 0x00, 0x04, 0xC4, 0x5D, 0x00, 0x03, 0xF0, 0x81, 0x00, 0x08,
-    0x7C, 0x5F, 0x00, 0x03, 0xB2, 0x0D, 0xC0, 0xE1, 0xB6, 0x1C, 0xA0, 0xE3, 0x40, 0x10, 0x81, 0xE3,
-    0xB2, 0x1D, 0xC0, 0xE1, 0x00, 0x12, 0xD0, 0xE5, 0x01, 0x10, 0xC1, 0xE3, 0x00, 0x12, 0xC0, 0xE5,
-    0x01, 0x10, 0xA0, 0xE3, 0x08, 0x12, 0xC0, 0xE5, 0xF0, 0x45, 0x2D, 0xE9, 0x3C, 0xA1, 0x9F, 0xE5,
-    0x84, 0x35, 0x9A, 0xE5, 0x38, 0xC1, 0x9F, 0xE5, 0x80, 0x40, 0x8C, 0xE2, 0x02, 0x01, 0x13, 0xE3,
-    0x02, 0x31, 0xA0, 0x13, 0x16, 0x00, 0x00, 0x1A, 0x90, 0x15, 0x9A, 0xE5, 0x88, 0x05, 0x9A, 0xE5,
-    0x00, 0x0C, 0xA0, 0xE1, 0xFF, 0x04, 0x11, 0xE3, 0x44, 0x20, 0x4A, 0x02, 0xA1, 0x56, 0xA0, 0x01,
-    0x05, 0x51, 0x92, 0x07, 0x05, 0x10, 0x81, 0x00, 0x01, 0x30, 0x53, 0xE2, 0x07, 0x00, 0x00, 0x4A,
-    0x01, 0x20, 0xD1, 0xE4, 0xFC, 0xF0, 0x9F, 0xE5, 0x04, 0x00, 0x5C, 0xE1, 0xF9, 0xFF, 0xFF, 0x3A,
-    0x20, 0x0C, 0xA0, 0xE1, 0x88, 0x05, 0x8A, 0xE5, 0x90, 0x15, 0x8A, 0xE5, 0x12, 0x00, 0x00, 0xEA,
-    0x7C, 0x25, 0xDA, 0xE5, 0x40, 0x00, 0x12, 0xE3, 0x80, 0x35, 0x9A, 0x15, 0x8C, 0x15, 0x9A, 0x15,
-    0xEB, 0xFF, 0xFF, 0x1A, 0x00, 0x10, 0xA0, 0xE3, 0x0C, 0x00, 0xA0, 0xE1, 0x04, 0x20, 0x5C, 0xE0,
-    0x0F, 0xE0, 0xA0, 0xC1, 0xC0, 0xF0, 0x9F, 0xC5, 0x02, 0x01, 0x53, 0xE3, 0x06, 0x00, 0x00, 0x1A,
-    0x01, 0x13, 0xA0, 0xE3, 0x01, 0x1C, 0x81, 0xE2, 0x00, 0x00, 0xA0, 0xE3, 0xB2, 0x00, 0xC1, 0xE1,
-    0x7D, 0x05, 0xDA, 0xE5, 0xEF, 0x00, 0x00, 0xE2, 0x7D, 0x05, 0xCA, 0xE5, 0x84, 0x35, 0x8A, 0xE5,
-    0x01, 0x03, 0xA0, 0xE3, 0x00, 0x12, 0xD0, 0xE5, 0x01, 0x10, 0x81, 0xE3, 0x00, 0x12, 0xC0, 0xE5,
-    0xF0, 0x85, 0xBD, 0xE8, 0x01, 0x03, 0xA0, 0xE3, 0x70, 0x10, 0x9F, 0xE5, 0x9C, 0x25, 0x91, 0xE5,
-    0x08, 0x01, 0x80, 0xE5, 0x08, 0x21, 0x80, 0xE5, 0x94, 0x25, 0x91, 0xE5, 0x64, 0x20, 0x80, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x03, 0xA0, 0xE3, 0x50, 0x10, 0x9F, 0xE5, 0xA0, 0x25, 0x91, 0xE5,
-    0x0C, 0x01, 0x80, 0xE5, 0x0C, 0x21, 0x80, 0xE5, 0x98, 0x25, 0x91, 0xE5, 0x6C, 0x20, 0x80, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x5D, 0x05, 0xDA, 0xE5, 0x5C, 0x15, 0xDA, 0xE5, 0x00, 0x00, 0xB0, 0xE1,
-    0x01, 0x10, 0xB0, 0x11, 0x04, 0x00, 0x00, 0x0A, 0x01, 0x13, 0xA0, 0xE3, 0x73, 0x00, 0xD1, 0xE5,
-    0x20, 0x00, 0x80, 0xE3, 0x73, 0x00, 0xC1, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1, 0x01, 0x13, 0xA0, 0xE3,
-    0x73, 0x00, 0xD1, 0xE5, 0x20, 0x00, 0xC0, 0xE3, 0x73, 0x00, 0xC1, 0xE5, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x3C, 0x6E, 0x00, 0x03, 0x80, 0x02, 0x00, 0x05, 0x70, 0x65, 0x00, 0x03, 0x24, 0x51, 0x00, 0x03,
-    0x4C, 0xC4, 0x9F, 0xE5, 0x00, 0xC2, 0x8C, 0xE0, 0x04, 0x10, 0x9C, 0xE5, 0xFF, 0x0C, 0x11, 0xE3,
-    0x07, 0x00, 0x00, 0x0A, 0xFF, 0x18, 0xC1, 0xE3, 0xFF, 0x1C, 0xC1, 0xE3, 0x04, 0x10, 0x8C, 0xE5,
-    0x30, 0x04, 0x9F, 0xE5, 0x00, 0x00, 0xD0, 0xE5, 0x40, 0x00, 0x00, 0xE2, 0x20, 0x03, 0xA0, 0xE1,
-    0x16, 0x00, 0x00, 0xEA, 0x08, 0x40, 0x2D, 0xE9, 0x00, 0x20, 0xA0, 0xE1, 0x09, 0x00, 0xA0, 0xE1,
-    0x28, 0x14, 0x9A, 0xE5, 0x04, 0xE0, 0x8F, 0xE2, 0x0C, 0xC4, 0x9F, 0xE5, 0x1C, 0xFF, 0x2F, 0xE1,
-    0x08, 0x80, 0xBD, 0xE8, 0x0C, 0xC0, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x10, 0xDC, 0xE5,
-    0x4C, 0x00, 0x51, 0xE3, 0x08, 0x00, 0xA0, 0x03, 0x04, 0x00, 0x00, 0x0A, 0x1F, 0x00, 0x01, 0xE2,
-    0x10, 0x00, 0x50, 0xE3, 0x03, 0x00, 0x00, 0x1A, 0x10, 0x00, 0x41, 0xE2, 0xA0, 0x02, 0xA0, 0xE1,
-    0x0C, 0xC0, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0xE1, 0x00, 0x00, 0xB0, 0xE3, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x20, 0x08, 0xCA, 0xE5, 0xB8, 0xC3, 0x9F, 0xE5, 0x00, 0xC2, 0x8C, 0xE0, 0x00, 0x10, 0x9C, 0xE5,
-    0x1C, 0xC8, 0x9A, 0xE5, 0x0C, 0x00, 0x51, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x40, 0x2D, 0xE9,
-    0xE7, 0xFF, 0xFF, 0xEB, 0x03, 0x00, 0x00, 0x0A, 0xA0, 0x23, 0x9F, 0xE5, 0x00, 0x01, 0x92, 0xE7,
-    0x9C, 0x23, 0x9F, 0xE5, 0x01, 0x01, 0x82, 0xE7, 0x98, 0x03, 0x9F, 0xE5, 0x98, 0x23, 0x9F, 0xE5,
-    0x00, 0x00, 0x82, 0xE5, 0x03, 0x20, 0xA0, 0xE3, 0x0C, 0x20, 0xC0, 0xE5, 0x20, 0x08, 0xDA, 0xE5,
-    0x6C, 0xC3, 0x9F, 0xE5, 0x00, 0xC2, 0x8C, 0xE0, 0x00, 0x10, 0xA0, 0xE3, 0x05, 0x10, 0xCC, 0xE5,
-    0x00, 0xC0, 0x9C, 0xE5, 0x0C, 0x00, 0xB0, 0xE1, 0x18, 0x08, 0x8A, 0x05, 0x1C, 0x08, 0x8A, 0xE5,
-    0xD3, 0xFF, 0xFF, 0xEB, 0x0B, 0x00, 0x00, 0x0A, 0x08, 0x00, 0x50, 0xE3, 0x5C, 0x23, 0x9F, 0xE5,
-    0x00, 0x01, 0x92, 0xE7, 0x48, 0x23, 0x9F, 0xE5, 0x01, 0x01, 0x82, 0xE7, 0x02, 0x10, 0x8C, 0x12,
-    0x01, 0x10, 0x8C, 0x02, 0x18, 0x18, 0x8A, 0xE5, 0x02, 0x00, 0x00, 0x0A, 0x01, 0x10, 0xDC, 0xE5,
-    0x01, 0x1C, 0x61, 0xE2, 0x0C, 0x10, 0xC0, 0xE5, 0x00, 0x40, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x03, 0x00, 0x49, 0xE2, 0xFF, 0x0C, 0x00, 0xE2, 0xFF, 0x1C, 0x09, 0xE2, 0x01, 0x00, 0x50, 0xE1,
-    0x0F, 0x20, 0xA0, 0xE3, 0x12, 0x20, 0xA0, 0x13, 0x48, 0x04, 0xA0, 0xE1, 0x10, 0x13, 0x9F, 0x05,
-    0x10, 0x13, 0x9F, 0x15, 0x90, 0xC1, 0x81, 0xE0, 0x03, 0x00, 0x59, 0xE5, 0xCA, 0x00, 0x50, 0xE3,
-    0x1A, 0x00, 0x00, 0x0A, 0x88, 0x00, 0x50, 0xE3, 0x11, 0x00, 0x00, 0x0A, 0xE8, 0x00, 0x50, 0xE3,
-    0x08, 0x00, 0x00, 0x0A, 0xE8, 0x00, 0x50, 0xE3, 0x27, 0x00, 0x00, 0x1A, 0xFF, 0x04, 0x77, 0xE2,
-    0x25, 0x00, 0x00, 0x0A, 0x20, 0x0C, 0xA0, 0xE1, 0x00, 0x00, 0x51, 0xE1, 0x00, 0x7C, 0x87, 0xA0,
-    0x01, 0x7C, 0x87, 0xB0, 0x13, 0x00, 0x00, 0xEA, 0xFF, 0x04, 0x76, 0xE2, 0x1E, 0x00, 0x00, 0x0A,
-    0x20, 0x0C, 0xA0, 0xE1, 0x00, 0x00, 0x51, 0xE1, 0x00, 0x6C, 0x86, 0xA0, 0x01, 0x6C, 0x86, 0xB0,
-    0x0C, 0x00, 0x00, 0xEA, 0x01, 0x04, 0x57, 0xE2, 0x17, 0x00, 0x00, 0x0A, 0x20, 0x0C, 0xA0, 0xE1,
-    0x00, 0x00, 0x51, 0xE1, 0x00, 0x7C, 0x47, 0xA0, 0x01, 0x7C, 0x47, 0xB0, 0x05, 0x00, 0x00, 0xEA,
-    0x01, 0x04, 0x56, 0xE2, 0x10, 0x00, 0x00, 0x0A, 0x20, 0x0C, 0xA0, 0xE1, 0x00, 0x00, 0x51, 0xE1,
-    0x00, 0x6C, 0x46, 0xA0, 0x01, 0x6C, 0x46, 0xB0, 0x92, 0x00, 0x00, 0xA0, 0x92, 0x01, 0x00, 0xB0,
-    0x00, 0x84, 0x48, 0xE0, 0x08, 0x00, 0x00, 0xEA, 0x02, 0x00, 0x18, 0xE3, 0x02, 0x80, 0x88, 0xE3,
-    0x00, 0x00, 0x00, 0x0A, 0x06, 0x00, 0x00, 0xEB, 0x5C, 0xF2, 0x9F, 0xE5, 0x02, 0x00, 0x18, 0xE3,
-    0x02, 0x80, 0x88, 0xE3, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0xEB, 0xD1, 0x00, 0x59, 0xE1,
-    0x48, 0xF2, 0x9F, 0xE5, 0x20, 0x28, 0xDA, 0xE5, 0x14, 0xC2, 0x9F, 0xE5, 0x02, 0xC2, 0x8C, 0xE0,
-    0x04, 0x50, 0x2D, 0xE9, 0x08, 0x10, 0x9C, 0xE5, 0x48, 0x04, 0xA0, 0xE1, 0x01, 0x00, 0x50, 0xE1,
-    0x04, 0x90, 0xBD, 0xB8, 0x0C, 0xC0, 0x9C, 0xE5, 0x9C, 0x20, 0x80, 0xE0, 0x90, 0x01, 0x01, 0xE0,
-    0x01, 0x84, 0x48, 0xE0, 0x04, 0x50, 0xBD, 0xE8, 0x01, 0x10, 0xA0, 0xE3, 0x05, 0x10, 0xCC, 0xE5,
-    0xD4, 0x10, 0xDC, 0xE1, 0x01, 0x10, 0xB0, 0xE1, 0x1E, 0xFF, 0x2F, 0x01, 0x0E, 0x00, 0x00, 0x4A,
-    0x08, 0x00, 0x2D, 0xE9, 0x00, 0x30, 0xA0, 0xE1, 0xF4, 0xC1, 0x9F, 0xE5, 0x82, 0xC2, 0x8C, 0xE0,
-    0xB2, 0x20, 0xDC, 0xE0, 0x0E, 0x0A, 0x02, 0xE2, 0xA0, 0x05, 0x94, 0xE7, 0x02, 0x00, 0x80, 0xE0,
-    0x00, 0x20, 0xD0, 0xE5, 0x03, 0x20, 0x82, 0xE0, 0x00, 0x20, 0xC0, 0xE5, 0x01, 0x10, 0x51, 0xE2,
-    0xF6, 0xFF, 0xFF, 0x1A, 0x08, 0x00, 0xBD, 0xE8, 0x1E, 0xFF, 0x2F, 0xE1, 0x7F, 0x10, 0x01, 0xE2,
-    0x08, 0x00, 0x51, 0xE3, 0x1E, 0xFF, 0x2F, 0xC1, 0x05, 0x00, 0x51, 0xE3, 0x58, 0x20, 0x8F, 0xE2,
-    0x01, 0x11, 0x92, 0xE7, 0xD0, 0x40, 0x2D, 0xE9, 0x40, 0xD0, 0x4D, 0xE2, 0x09, 0x00, 0x00, 0xBA,
-    0x0D, 0x20, 0xA0, 0xE1, 0xD0, 0x40, 0xB1, 0xE8, 0xD0, 0x40, 0xA2, 0xE8, 0xD0, 0x40, 0xB1, 0xE8,
-    0xD0, 0x40, 0xA2, 0xE8, 0xD0, 0x40, 0xB1, 0xE8, 0xD0, 0x40, 0xA2, 0xE8, 0xD0, 0x40, 0xB1, 0xE8,
-    0xD0, 0x40, 0xA2, 0xE8, 0x0D, 0x10, 0xA0, 0xE1, 0xA8, 0x20, 0xB0, 0xE1, 0x02, 0x60, 0x59, 0xE5,
-    0x04, 0x70, 0x59, 0xE5, 0x06, 0x20, 0xDB, 0xE7, 0x07, 0xC0, 0xDB, 0xE7, 0x02, 0x2C, 0xA0, 0xE1,
-    0x0C, 0xCC, 0xA0, 0xE1, 0x24, 0xE0, 0x8F, 0xE2, 0x11, 0xFF, 0x2F, 0xE1, 0x78, 0x3C, 0x00, 0x06,
-    0x90, 0x3C, 0x00, 0x06, 0x9C, 0x3C, 0x00, 0x06, 0xB8, 0x3C, 0x00, 0x06, 0xAC, 0x3C, 0x00, 0x06,
-    0xD8, 0x3C, 0x00, 0x06, 0x04, 0x3D, 0x00, 0x06, 0x24, 0x3D, 0x00, 0x06, 0x30, 0x3D, 0x00, 0x06,
-    0x42, 0x3C, 0xA0, 0xE1, 0x02, 0x50, 0xA0, 0xE1, 0x06, 0x30, 0xCB, 0xE7, 0x02, 0x00, 0x00, 0xEA,
-    0x01, 0x54, 0x42, 0xE2, 0x42, 0x3C, 0xA0, 0xE1, 0x06, 0x30, 0xCB, 0xE7, 0x41, 0x80, 0xC8, 0xE3,
-    0x01, 0x80, 0x88, 0x23, 0x40, 0x80, 0x88, 0x63, 0x40, 0xD0, 0x8D, 0xE2, 0xD0, 0x80, 0xBD, 0xE8,
-    0x01, 0x00, 0x40, 0xE2, 0x01, 0x14, 0x8C, 0xE2, 0x90, 0x21, 0x22, 0xE0, 0x01, 0x24, 0x82, 0xE2,
-    0x0C, 0x20, 0x92, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1, 0x07, 0x70, 0x59, 0xE5, 0x07, 0xC0, 0xDB, 0xE7,
-    0x0C, 0xCC, 0xA0, 0xE1, 0x01, 0x00, 0x40, 0xE2, 0x90, 0x2C, 0x22, 0xE0, 0x0C, 0x20, 0x92, 0xE0,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x07, 0x70, 0x59, 0xE5, 0x07, 0xC0, 0xDB, 0xE7, 0x0C, 0xCC, 0xA0, 0xE1,
-    0x01, 0x00, 0x40, 0xE2, 0x01, 0x14, 0x8C, 0xE2, 0x90, 0x21, 0x22, 0xE0, 0x00, 0x00, 0x50, 0xE1,
-    0x2C, 0x1C, 0xA0, 0xE1, 0x01, 0x1C, 0x41, 0x22, 0x61, 0x24, 0xB2, 0xE0, 0x1E, 0xFF, 0x2F, 0xE1,
-    0x06, 0x70, 0x59, 0xE5, 0x07, 0xC0, 0xDB, 0xE7, 0x0C, 0xCC, 0xA0, 0xE1, 0x2C, 0x1C, 0xA0, 0xE1,
-    0x01, 0x1C, 0x41, 0x22, 0x61, 0x24, 0xB2, 0xE0, 0x01, 0x24, 0x82, 0xE2, 0x01, 0x00, 0x40, 0xE2,
-    0x00, 0x00, 0xB0, 0xE1, 0xF8, 0xFF, 0xFF, 0x1A, 0x10, 0xF0, 0x8E, 0xE2, 0x01, 0x24, 0x82, 0xE2,
-    0x2C, 0x1C, 0xA0, 0xE1, 0x01, 0x1C, 0x41, 0x22, 0x61, 0x24, 0xB2, 0xE0, 0x01, 0x00, 0x40, 0xE2,
-    0x00, 0x00, 0xB0, 0xE1, 0xF8, 0xFF, 0xFF, 0x1A, 0x1E, 0xFF, 0x2F, 0xE1, 0x06, 0x70, 0x59, 0xE5,
-    0x07, 0xC0, 0xDB, 0xE7, 0x0C, 0xCC, 0xA0, 0xE1, 0x2C, 0x1C, 0xA0, 0xE1, 0x01, 0x1C, 0x41, 0x22,
-    0x61, 0x24, 0xB2, 0xE0, 0x01, 0x00, 0x40, 0xE2, 0x00, 0x00, 0xB0, 0xE1, 0xF9, 0xFF, 0xFF, 0x1A,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x60, 0xFA, 0x03, 0x02, 0xC4, 0x59, 0x00, 0x03, 0xC9, 0x2E, 0x00, 0x08,
-    0xF0, 0x8F, 0x00, 0x08, 0x3C, 0x6E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x03, 0x7C, 0x71, 0x00, 0x03,
-    0x14, 0x90, 0x00, 0x08, 0x12, 0x11, 0x11, 0x11, 0x8F, 0xE3, 0x38, 0x0E, 0x1C, 0x30, 0x00, 0x03,
-    0xC4, 0x29, 0x00, 0x03, 0xA0, 0xFA, 0x03, 0x02, 0x0C, 0x27, 0x9A, 0xE5, 0x48, 0x24, 0x42, 0xE0,
-    0x10, 0x17, 0x9A, 0xE5, 0x02, 0x10, 0x81, 0xE0, 0xB8, 0x14, 0x8A, 0xE5, 0x6C, 0x00, 0x1A, 0xE5,
-    0x01, 0x0A, 0x10, 0xE3, 0x1E, 0xFF, 0x2F, 0x11, 0x58, 0x04, 0xDA, 0xE5, 0x10, 0x20, 0x10, 0xE2,
-    0x01, 0x20, 0xA0, 0x13, 0x28, 0x00, 0x10, 0xE2, 0x01, 0x00, 0xA0, 0x13, 0x00, 0x00, 0x52, 0xE1,
-    0x1E, 0xFF, 0x2F, 0x01, 0x14, 0xC7, 0x9A, 0xE5, 0x0C, 0x10, 0x41, 0xE0, 0xEC, 0xC7, 0x9A, 0xE5,
-    0x91, 0x2C, 0xCC, 0xE0, 0x00, 0xC0, 0xA0, 0xE3, 0x20, 0x10, 0x9F, 0xE5, 0x01, 0x00, 0x52, 0xE1,
-    0x01, 0xC0, 0xA0, 0x23, 0x18, 0x10, 0x9F, 0x25, 0x01, 0x00, 0x52, 0x21, 0x00, 0xC0, 0xA0, 0x23,
-    0x0C, 0x00, 0x50, 0xE1, 0x1E, 0xFF, 0x2F, 0x11, 0x01, 0x00, 0xA0, 0xE3, 0x04, 0xF0, 0x9F, 0xE5,
-    0xA2, 0x8B, 0x2E, 0xBA, 0xA3, 0x8E, 0x3A, 0xEA, 0x88, 0x6C, 0x00, 0x03, 0x3F, 0x00, 0x00, 0xE2,
-    0x01, 0x00, 0x1C, 0xE3, 0x07, 0x00, 0x00, 0x1A, 0xA4, 0x14, 0xDA, 0xE5, 0x01, 0xC0, 0x30, 0xE0,
-    0xA4, 0x04, 0xCA, 0x15, 0xC0, 0x00, 0x1C, 0xE3, 0x1E, 0xFF, 0x2F, 0x01, 0x80, 0x00, 0x1C, 0xE3,
-    0x2F, 0x00, 0x00, 0x0A, 0x38, 0xF1, 0x9F, 0xE5, 0xA4, 0x14, 0xDA, 0xE5, 0x80, 0x00, 0x11, 0xE3,
-    0x07, 0x10, 0x01, 0xE2, 0x08, 0x10, 0x81, 0x13, 0x01, 0xF1, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x00,
-    0x9C, 0x49, 0x00, 0x03, 0xD0, 0x49, 0x00, 0x03, 0x2C, 0x49, 0x00, 0x03, 0x48, 0x49, 0x00, 0x03,
-    0x64, 0x49, 0x00, 0x03, 0x80, 0x49, 0x00, 0x03, 0xE8, 0x3E, 0x00, 0x06, 0x74, 0x47, 0x00, 0x03,
-    0x04, 0x4A, 0x00, 0x03, 0x38, 0x4A, 0x00, 0x03, 0xBC, 0x48, 0x00, 0x03, 0xD8, 0x48, 0x00, 0x03,
-    0xF4, 0x48, 0x00, 0x03, 0x10, 0x49, 0x00, 0x03, 0xE8, 0x3E, 0x00, 0x06, 0x74, 0x47, 0x00, 0x03,
-    0x01, 0x00, 0x1C, 0xE3, 0xDF, 0xFF, 0xFF, 0x0A, 0xA4, 0x14, 0xDA, 0xE5, 0x07, 0x20, 0x01, 0xE2,
-    0x06, 0x00, 0x52, 0xE3, 0xE3, 0xFF, 0xFF, 0xAA, 0x80, 0x00, 0x11, 0xE3, 0x02, 0x00, 0x00, 0x0A,
-    0x02, 0x00, 0x52, 0xE3, 0xDF, 0xFF, 0xFF, 0xBA, 0x01, 0x00, 0x00, 0xEA, 0x02, 0x00, 0x52, 0xE3,
-    0xDC, 0xFF, 0xFF, 0xAA, 0xA9, 0x14, 0xDA, 0xE5, 0xA9, 0x04, 0xCA, 0xE5, 0x01, 0x10, 0x20, 0xE0,
-    0x80, 0x00, 0x11, 0xE3, 0xD7, 0xFF, 0xFF, 0x0A, 0x80, 0x00, 0x10, 0xE3, 0x01, 0x40, 0x2D, 0xE9,
-    0x0F, 0xE0, 0xA0, 0xE1, 0x8C, 0xF0, 0x9F, 0xE5, 0x01, 0x40, 0xBD, 0xE8, 0xD1, 0xFF, 0xFF, 0xEA,
-    0xA5, 0x04, 0xCA, 0xE5, 0x01, 0x00, 0xE0, 0xE3, 0xA4, 0x14, 0xDA, 0xE5, 0x40, 0x00, 0x11, 0xE3,
-    0x0E, 0xC0, 0xA0, 0xE1, 0x70, 0xF0, 0x9F, 0x15, 0x0F, 0xE0, 0xA0, 0xE1, 0x6C, 0xF0, 0x9F, 0xE5,
-    0xA5, 0x04, 0xDA, 0xE5, 0x0C, 0xE0, 0xA0, 0xE1, 0x64, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x1C, 0xE3,
-    0x0E, 0xF0, 0xA0, 0x11, 0x01, 0x00, 0x10, 0xE3, 0x58, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x1C, 0xE3,
-    0xA1, 0x04, 0xCA, 0x05, 0x1E, 0xFF, 0x2F, 0x01, 0x00, 0x00, 0xA0, 0x13, 0xA0, 0x04, 0xCA, 0x15,
-    0x0C, 0x17, 0x9A, 0xE5, 0x48, 0x14, 0x41, 0xE0, 0x10, 0x27, 0x9A, 0xE5, 0x01, 0x20, 0x82, 0xE0,
-    0xB8, 0x24, 0x8A, 0xE5, 0x30, 0xF0, 0x9F, 0xE5, 0x01, 0x00, 0x1C, 0xE2, 0xA2, 0x04, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0x11, 0x20, 0x04, 0xDA, 0xE5, 0x02, 0x00, 0xC0, 0xE3, 0x20, 0x04, 0xCA, 0xE5,
-    0x1E, 0xFF, 0x2F, 0xE1, 0x80, 0xB0, 0x00, 0x08, 0xAC, 0x46, 0x00, 0x03, 0xE0, 0xB0, 0x00, 0x08,
-    0x94, 0x47, 0x00, 0x03, 0x54, 0x47, 0x00, 0x03, 0xB8, 0x46, 0x00, 0x03, 0xF8, 0x6C, 0x00, 0x03,
-    0x64, 0x6B, 0x41, 0x52, 0x4D, 0x00, 0x00, 0x00, 0x53, 0x41, 0x56, 0x45, 0x00, 0x74, 0x4E, 0x45,
-    0x53, 0x20, 0x4D, 0x65, 0x6E, 0x75, 0x20, 0x4D, 0x61, 0x6B, 0x65, 0x72, 0x20, 0x76, 0x31, 0x2E,
-    0x32, 0x61, 0x20, 0x2D, 0x20, 0x42, 0x75, 0x00, 0x10, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const unsigned char pocketnes_gba_lz[59968] __attribute__((aligned(4))) = {
+	0x10, 0xa8, 0x46, 0x01, 0x00, 0x2e, 0x00, 0x00, 0xea, 0x24, 0xff, 0xae, 0x51, 0x00, 0x69, 0x9a, 
+	0xa2, 0x21, 0x3d, 0x84, 0x82, 0x0a, 0x00, 0x84, 0xe4, 0x09, 0xad, 0x11, 0x24, 0x8b, 0x98, 0x00, 
+	0xc0, 0x81, 0x7f, 0x21, 0xa3, 0x52, 0xbe, 0x19, 0x00, 0x93, 0x09, 0xce, 0x20, 0x10, 0x46, 0x4a, 
+	0x4a, 0x00, 0xf8, 0x27, 0x31, 0xec, 0x58, 0xc7, 0xe8, 0x33, 0x00, 0x82, 0xe3, 0xce, 0xbf, 0x85, 
+	0xf4, 0xdf, 0x94, 0x00, 0xce, 0x4b, 0x09, 0xc1, 0x94, 0x56, 0x8a, 0xc0, 0x00, 0x13, 0x72, 0xa7, 
+	0xfc, 0x9f, 0x84, 0x4d, 0x73, 0x00, 0xa3, 0xca, 0x9a, 0x61, 0x58, 0x97, 0xa3, 0x27, 0x00, 0xfc, 
+	0x03, 0x98, 0x76, 0x23, 0x1d, 0xc7, 0x61, 0x00, 0x03, 0x04, 0xae, 0x56, 0xbf, 0x38, 0x84, 0x00, 
+	0x00, 0x40, 0xa7, 0x0e, 0xfd, 0xff, 0x52, 0xfe, 0x03, 0x00, 0x6f, 0x95, 0x30, 0xf1, 0x97, 0xfb, 
+	0xc0, 0x85, 0x00, 0x60, 0xd6, 0x80, 0x25, 0xa9, 0x63, 0xbe, 0x03, 0x00, 0x01, 0x4e, 0x38, 0xe2, 
+	0xf9, 0xa2, 0x34, 0xff, 0x00, 0xbb, 0x3e, 0x03, 0x44, 0x78, 0x00, 0x90, 0xcb, 0x00, 0x88, 0x11, 
+	0x3a, 0x94, 0x65, 0xc0, 0x7c, 0x63, 0x00, 0x87, 0xf0, 0x3c, 0xaf, 0xd6, 0x25, 0xe4, 0x8b, 0x00, 
+	0x38, 0x0a, 0xac, 0x72, 0x21, 0xd4, 0xf8, 0x07, 0x00, 0x50, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x4e, 
+	0x45, 0x04, 0x53, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x30, 0x31, 0x18, 0x96, 0x00, 0x80, 0x00, 
+	0x0b, 0x20, 0x01, 0xee, 0x00, 0x00, 0x70, 0x06, 0x00, 0xbf, 0x50, 0x0e, 0xf0, 0x01, 0x00, 0x00, 
+	0x01, 0x03, 0x00, 0xa0, 0xe3, 0x08, 0x02, 0x80, 0xe5, 0x12, 0x00, 0x00, 0xa0, 0xe3, 0x00, 0xf0, 
+	0x29, 0xe1, 0xb8, 0xd0, 0x14, 0x9f, 0xe5, 0x1f, 0x40, 0x0b, 0xb0, 0x00, 0x0b, 0x01, 0x00, 0x00, 
+	0x8f, 0xe2, 0x10, 0xff, 0x2f, 0xe1, 0x00, 0x27, 0x00, 0x2b, 0x48, 0x40, 0x01, 0x0d, 0xd2, 0x78, 
+	0x46, 0x00, 0x40, 0x01, 0x0a, 0xd3, 0x01, 0x27, 0x02, 0x22, 0x00, 0x12, 0x06, 0x27, 0x4b, 0x9b, 
+	0x1a, 0x16, 0x1c, 0x00, 0x91, 0x00, 0x00, 0xf0, 0x3a, 0xf8, 0x25, 0x48, 0x00, 0x87, 0x46, 0x25, 
+	0x49, 0x26, 0x4a, 0x26, 0x4c, 0x05, 0x00, 0xf0, 0x32, 0xf8, 0x26, 0x00, 0x09, 0x27, 0x00, 0x09, 
+	0x20, 0x2d, 0xf8, 0x00, 0x07, 0x49, 0x53, 0x1a, 0x02, 0xd0, 0x04, 0x26, 0x4a, 0x00, 0xf0, 0x27, 
+	0x60, 0x17, 0x21, 0xf8, 0x00, 0x26, 0x48, 0x27, 0x49, 0x09, 0x1a, 0x00, 0xf0, 0x52, 0x12, 0x00, 
+	0x09, 0x26, 0x20, 0x09, 0x0d, 0xf8, 0x00, 0x3f, 0x48, 0x01, 0x08, 0x60, 0x26, 0x4b, 0x00, 0xf0, 
+	0x10, 0x00, 0x4f, 0x01, 0x07, 0x60, 0x00, 0x20, 0x00, 0x21, 0x24, 0x00, 0x0d, 0x00, 0x09, 0xf8, 
+	0x03, 0x22, 0x89, 0x18, 0x91, 0x43, 0x00, 0x03, 0xd0, 0x00, 0x22, 0x04, 0xc0, 0x04, 0x39, 0x00, 
+	0xfc, 0xd1, 0x70, 0x47, 0x18, 0x47, 0xa3, 0x1a, 0x04, 0x03, 0x20, 0x1b, 0x18, 0x83, 0x00, 0x15, 
+	0x01, 0xc9, 0x04, 0x01, 0xc2, 0x04, 0x3b, 0xfb, 0x00, 0x15, 0xc0, 0x46, 0x04, 0xa0, 0x7f, 0x00, 
+	0x03, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x08, 0xe0, 0x00, 0x00, 0x02, 0x0b, 0x01, 0x00, 0x00, 
+	0x08, 0x38, 0x2e, 0x01, 0x08, 0xc8, 0x6d, 0x00, 0x10, 0x03, 0x70, 0x76, 0x00, 0x03, 0xe8, 0x00, 
+	0x08, 0x00, 0x10, 0x28, 0x00, 0x03, 0x10, 0x0f, 0xe0, 0x36, 0x01, 0x08, 0x9a, 0x10, 0x03, 0x6c, 
+	0x7c, 0x30, 0x0b, 0x00, 0x33, 0x02, 0x00, 0x04, 0x02, 0xf4, 0x10, 0x27, 0x10, 0x13, 0x10, 0x0b, 
+	0x10, 0x43, 0x4c, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x04, 0x02, 0x31, 0xce, 0x00, 0x08, 0x70, 0x00, 
+	0x0f, 0x00, 0x71, 0xd3, 0x00, 0x08, 0xf8, 0xb5, 0xc0, 0x46, 0x00, 0xf8, 0xbc, 0x08, 0xbc, 0x9e, 
+	0x46, 0x70, 0x47, 0x80, 0x11, 0x47, 0x10, 0xb5, 0x03, 0x00, 0x05, 0x48, 0x04, 0x00, 0x78, 0x00, 
+	0x20, 0x84, 0x42, 0x02, 0xd1, 0x18, 0x00, 0x00, 0x0d, 0xf0, 0x00, 0xfa, 0x10, 0xbc, 0x02, 0x28, 
+	0xbc, 0x08, 0x00, 0x93, 0x30, 0x00, 0x33, 0x10, 0xb5, 0x04, 0x00, 0x4b, 0x1b, 0x78, 0x00, 0x2b, 
+	0x01, 0xd1, 0x0d, 0x00, 0xf0, 0x41, 0xf9, 0x10, 0xbc, 0x01, 0xbc, 0x00, 0x40, 0x47, 0x10, 0x17, 
+	0x06, 0x4b, 0x30, 0xb5, 0x1c, 0x68, 0x04, 0x91, 0x42, 0x02, 0xdb, 0x30, 0x20, 0x13, 0x8b, 0x02, 
+	0x00, 0x8d, 0x00, 0xc3, 0x18, 0x63, 0x51, 0x01, 0x31, 0x02, 0xf4, 0xe7, 0x60, 0x73, 0x00, 0x03, 
+	0xd0, 0x1f, 0x4b, 0x50, 0x03, 0x70, 0x1f, 0x5c, 0x00, 0x1f, 0x10, 0xb5, 0x4b, 0x03, 0x00, 0x8a, 
+	0x18, 0xc0, 0x1a, 0xff, 0xf7, 0xea, 0xff, 0x85, 0x30, 0x55, 0x10, 0xb5, 0x8b, 0x02, 0x30, 0x11, 
+	0xd1, 0x40, 0x11, 0x00, 0xf0, 0xb5, 0x00, 0x26, 0x85, 0xb0, 0x03, 0x92, 0x00, 0x84, 0x00, 0x8d, 
+	0x00, 0x03, 0x9b, 0x9e, 0x42, 0x04, 0x03, 0xdb, 0x05, 0xb0, 0xf0, 0x20, 0x19, 0x0a, 0x4f, 0x00, 
+	0x3b, 0x68, 0x1a, 0x59, 0x01, 0x92, 0x80, 0x22, 0x00, 0x5b, 0x59, 0x92, 0x01, 0x19, 0x00, 0x01, 
+	0x98, 0x00, 0x02, 0x93, 0xff, 0xf7, 0xa9, 0xff, 0x3b, 0x68, 0x00, 0x02, 0x9a, 0x1a, 0x51, 0x01, 
+	0x9a, 0x01, 0x36, 0x01, 0x5a, 0x51, 0x04, 0x34, 0x04, 0x35, 0xe3, 0x20, 0x6b, 0x00, 0x1d, 0x4b, 
+	0x1b, 0x68, 0xf7, 0xb5, 0x06, 0x00, 0x00, 0xd0, 0x00, 0xc5, 0x58, 0x0e, 0x20, 0xcf, 0x00, 0x10, 
+	0x0c, 0x00, 0xd9, 0x00, 0x3b, 0x0a, 0x0e, 0x02, 0x40, 0x00, 0x08, 0x2a, 0x19, 0xd0, 0xdb, 0x19, 
+	0x99, 0x68, 0x00, 0xe0, 0x23, 0xf8, 0x26, 0x80, 0x20, 0x1b, 0x05, 0x00, 0x19, 0x40, 0x36, 0x06, 
+	0x89, 0x19, 0x01, 0x34, 0x00, 0x40, 0x04, 0x81, 0x42, 0x09, 0xd3, 0x2b, 0x40, 0x00, 0x9b, 0x19, 
+	0x83, 0x42, 0x05, 0xd3, 0x01, 0x9b, 0x00, 0x02, 0x22, 0x59, 0x00, 0x60, 0x00, 0xff, 0xf7, 0x10, 
+	0xb6, 0xff, 0xf7, 0x20, 0x7f, 0x80, 0x22, 0x30, 0x00, 0x00, 0xd2, 0x01, 0xff, 0xf7, 0x60, 0xff, 
+	0x80, 0x23, 0x00, 0xdb, 0x01, 0x1a, 0x00, 0x29, 0x00, 0xf0, 0x18, 0x05, 0xff, 0xf7, 0x59, 0xff, 
+	0x02, 0x00, 0x17, 0x61, 0x00, 0x27, 0x02, 0x90, 0xff, 0xea, 0xe7, 0xc0, 0x46, 0x10, 0x7b, 0xf7, 
+	0x00, 0xb5, 0x21, 0x4b, 0x21, 0x4c, 0x1b, 0x68, 0x21, 0x00, 0x4e, 0x01, 0x93, 0x23, 0x68, 0x00, 
+	0x25, 0xb3, 0x00, 0x42, 0x06, 0xd0, 0x1f, 0x4a, 0x93, 0x42, 0x03, 0x00, 0xd0, 0x1f, 0x4d, 0x5d, 
+	0x1b, 0x6b, 0x1e, 0x9d, 0x00, 0x41, 0x04, 0xf0, 0x2b, 0xfd, 0x00, 0x28, 0x04, 0x20, 0xd0, 0x1c, 
+	0x01, 0x67, 0x32, 0x00, 0x9b, 0x07, 0x00, 0x00, 0xd4, 0x17, 0x4a, 0x00, 0x23, 0x19, 0x4e, 0xf0, 
+	0x00, 0x5c, 0xff, 0x28, 0x0c, 0xd0, 0x99, 0x00, 0x8c, 0x00, 0x46, 0x17, 0x4f, 0x59, 0x03, 0x49, 
+	0x42, 0xc9, 0x00, 0x19, 0x01, 0x9f, 0x80, 0x00, 0xc0, 0x59, 0x41, 0x00, 0x18, 0x60, 0x46, 0x14, 
+	0x4f, 0x39, 0x50, 0x01, 0x00, 0x33, 0x05, 0x2b, 0xec, 0xd1, 0x00, 0x2d, 0x09, 0x00, 0xd1, 0x31, 
+	0x78, 0x11, 0x4b, 0xff, 0x29, 0x08, 0x00, 0xd1, 0x10, 0x49, 0x22, 0x60, 0x19, 0x60, 0x10, 0x04, 
+	0x4a, 0x0c, 0x4b, 0x1a, 0x60, 0x30, 0xa7, 0x0e, 0x4a, 0x01, 0x1a, 0x60, 0x05, 0x4b, 0x23, 0x60, 
+	0xf7, 0x21, 0x07, 0x4d, 0xe8, 0x02, 0x3b, 0xf4, 0x52, 0x00, 0x07, 0x00, 0x03, 0xc0, 0x00, 0x03, 
+	0x48, 0x64, 0x00, 0x13, 0xff, 0x72, 0x02, 0x23, 0xa0, 0xff, 0xff, 0x05, 0x04, 0x6e, 0x00, 0x03, 
+	0x2c, 0x00, 0x03, 0xdc, 0x00, 0x17, 0x03, 0x00, 0xa8, 0xff, 0x02, 0x0c, 0x53, 0x02, 0x47, 0x21, 
+	0xc3, 0x00, 0x00, 0x23, 0x07, 0x4d, 0x08, 0x49, 0xea, 0x5c, 0x00, 0x92, 0x00, 0x10, 0x59, 0x9a, 
+	0x00, 0x01, 0x33, 0x02, 0x88, 0x50, 0x08, 0x2b, 0xf7, 0xd1, 0x31, 0xd5, 0xc0, 0x52, 0x46, 0x11, 
+	0xeb, 0x04, 0x00, 0x03, 0x7c, 0x74, 0x11, 0xd3, 0xff, 0x02, 0xf7, 0x87, 0xff, 0xff, 0xf7, 0xe3, 
+	0x41, 0xbf, 0x70, 0x00, 0xb5, 0x0e, 0x00, 0x05, 0x00, 0x0e, 0x49, 0x0e, 0x00, 0x48, 0x14, 0x00, 
+	0x0c, 0xf0, 0xba, 0xff, 0x31, 0x80, 0x00, 0x05, 0x8d, 0xff, 0x0c, 0x49, 0x0c, 0xf0, 0x8a, 0x20, 
+	0xff, 0x0b, 0x00, 0x05, 0x87, 0xff, 0x06, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0c, 0x05, 0xf0, 0x43, 
+	0xfb, 0x01, 0x20, 0x00, 0x30, 0x00, 0x1d, 0x7e, 0xff, 0x28, 0x00, 0x04, 0x08, 0xf0, 0xe3, 0xfd, 
+	0x70, 0x22, 0x81, 0x34, 0xe2, 0x00, 0x29, 0x08, 0xbc, 0x02, 0x6b, 0xd8, 0x00, 0x03, 0x1f, 0xe5, 
+	0x02, 0xc3, 0x8a, 0x20, 0x4f, 0x0d, 0x49, 0x0d, 0x20, 0x4f, 0x92, 0x20, 0x4f, 0x65, 0xaa, 0x20, 
+	0x49, 0x62, 0x60, 0x49, 0x1e, 0x40, 0x49, 0x59, 0x20, 0x49, 0xbe, 0x8a, 0x40, 0x49, 0xc0, 0x46, 
+	0x3a, 0x40, 0x4b, 0x3e, 0x00, 0x07, 0xf8, 0x00, 0xb5, 0x02, 0x20, 0x02, 0xf0, 0xf6, 0xfd, 0x00, 
+	0x00, 0x22, 0x20, 0x20, 0x38, 0x49, 0x02, 0xf0, 0x2d, 0x10, 0xfe, 0x38, 0x49, 0x00, 0x3e, 0xf0, 
+	0x79, 0xfe, 0x37, 0x00, 0x4c, 0x05, 0x00, 0xa0, 0x89, 0x05, 0xf0, 0xfb, 0x08, 0xfa, 0x35, 0x49, 
+	0x02, 0x03, 0x6e, 0x04, 0xf0, 0xb1, 0x00, 0xfd, 0x23, 0x69, 0x05, 0x00, 0x33, 0x4f, 0x33, 0x00, 
+	0x4e, 0x01, 0x2b, 0x2a, 0xd1, 0x39, 0x00, 0x00, 0x05, 0x23, 0xe2, 0x5e, 0xff, 0xf7, 0x10, 0xcb, 
+	0x02, 0x20, 0x09, 0x10, 0xb5, 0xff, 0x04, 0x00, 0x07, 0x2d, 0x49, 0xff, 0xf7, 0x14, 0xb0, 0xff, 
+	0x06, 0x00, 0x09, 0x2b, 0x00, 0x09, 0xab, 0xff, 0x51, 0x08, 0x00, 0x09, 0x2a, 0x00, 0x09, 0xa6, 
+	0xff, 0x0a, 0x00, 0x09, 0x40, 0x28, 0x00, 0x09, 0xa1, 0xff, 0x28, 0x49, 0x28, 0x4a, 0x00, 0x04, 
+	0xf0, 0x89, 0xfd, 0x28, 0x49, 0x04, 0xf0, 0x11, 0x44, 0xfe, 0x27, 0x00, 0x05, 0x41, 0xfe, 0xf8, 
+	0x21, 0x27, 0x00, 0x02, 0x21, 0x20, 0x7d, 0x04, 0xf0, 0xf8, 0xfe, 0x00, 0x01, 0x00, 0x23, 0x48, 
+	0x0c, 0xf0, 0x26, 0xff, 0xaa, 0x30, 0x65, 0x28, 0x02, 0x47, 0x5e, 0x60, 0x67, 0x59, 0x20, 0x67, 
+	0x13, 0xaa, 0x00, 0x49, 0x54, 0x20, 0x67, 0x11, 0x00, 0x09, 0x4f, 0x20, 0x67, 0x10, 0xa8, 0x00, 
+	0x09, 0x4a, 0x20, 0x67, 0x0e, 0x00, 0x09, 0x45, 0xff, 0x13, 0x20, 0x4a, 0x0d, 0x00, 0x5b, 0x55, 
+	0xfd, 0x10, 0x4a, 0x11, 0x82, 0x00, 0x07, 0x51, 0xfd, 0xc9, 0xe7, 0x45, 0x00, 0xf3, 0x59, 0xd5, 
+	0x00, 0x03, 0x14, 0x17, 0x68, 0x00, 0x07, 0x7a, 0x00, 0x03, 0x7d, 0x00, 0x03, 0x55, 0x80, 0x00, 
+	0x03, 0x83, 0x00, 0x03, 0x86, 0x00, 0x03, 0x89, 0x00, 0x03, 0x55, 0x90, 0x00, 0x03, 0x8c, 0x00, 
+	0x03, 0xa7, 0x00, 0x03, 0xcf, 0x00, 0x03, 0xa8, 0x11, 0x77, 0xb5, 0x00, 0x07, 0xb8, 0x00, 0x03, 
+	0x00, 0x21, 0x10, 0x20, 0xb5, 0x08, 0x01, 0x57, 0x4d, 0xff, 0x11, 0x4c, 0x00, 0x00, 0x21, 0x20, 
+	0x80, 0x04, 0x20, 0x0c, 0xf0, 0x47, 0x02, 0xff, 0x00, 0x21, 0x60, 0x80, 0x08, 0x00, 0x09, 0x42, 
+	0x8a, 0x00, 0x09, 0xa0, 0x80, 0x0c, 0x00, 0x09, 0x3d, 0x00, 0x09, 0xe0, 0x28, 0x80, 0x10, 0x00, 
+	0x09, 0x38, 0x00, 0x09, 0x20, 0x81, 0x14, 0xa4, 0x00, 0x09, 0x33, 0x10, 0x27, 0x81, 0x18, 0x00, 
+	0x09, 0x2e, 0xff, 0x31, 0xa0, 0x81, 0x32, 0x1b, 0x10, 0x8b, 0xa0, 0x22, 0x01, 0x00, 0x55, 0x00, 
+	0x04, 0x4b, 0xd2, 0x00, 0x98, 0x69, 0x49, 0x42, 0x1c, 0x0c, 0xf0, 0x0b, 0x42, 0x37, 0x30, 0x1b, 
+	0x10, 0x19, 0x05, 0x49, 0x01, 0xd8, 0x69, 0x92, 0x01, 0x0c, 0xf0, 0xb6, 0x40, 0x19, 0x30, 0xc0, 
+	0x46, 0x10, 0x1b, 0x04, 0xb6, 0x03, 0xff, 0x22, 0xc3, 0x00, 0x07, 0x06, 0xd5, 0x01, 0x38, 0x03, 
+	0x88, 0x09, 0x00, 0x02, 0x13, 0x40, 0x19, 0x43, 0x01, 0x80, 0x70, 0x00, 0x47, 0x03, 0x88, 0x93, 
+	0x43, 0xf9, 0xe7, 0xf0, 0x00, 0xb5, 0x21, 0x4f, 0x3b, 0x6a, 0x85, 0xb0, 0x01, 0x00, 0x90, 0x02, 
+	0x91, 0x00, 0x20, 0x31, 0x2b, 0x2b, 0x00, 0xdc, 0x03, 0x25, 0x12, 0x30, 0x58, 0x43, 0x5d, 0x00, 
+	0x43, 0x7c, 0x6a, 0x20, 0x18, 0x46, 0x1e, 0xeb, 0x00, 0x1c, 0x02, 0x30, 0x02, 0x1b, 0x93, 0x42, 
+	0x23, 0x00, 0xd9, 0x12, 0x23, 0x3e, 0x6a, 0x5e, 0x43, 0x03, 0x00, 0x93, 0x03, 0x36, 0x3b, 0x6a, 
+	0x03, 0x9a, 0x01, 0x00, 0x33, 0x5a, 0x43, 0xb2, 0x42, 0x1d, 0xdc, 0x01, 0x00, 0x9b, 0x19, 0x06, 
+	0x09, 0x0e, 0x60, 0x19, 0xff, 0x00, 0xf7, 0xcd, 0xff, 0x01, 0x9b, 0x68, 0x1c, 0x19, 0x20, 0x0a, 
+	0x20, 0x03, 0xdb, 0xc7, 0xff, 0xa8, 0x1c, 0x20, 0x00, 0x18, 0x02, 0x99, 0xff, 0xf7, 0xc2, 0xff, 
+	0x01, 0x01, 0x20, 0x3b, 0x6a, 0x01, 0x33, 0x3b, 0x62, 0x14, 0x8d, 0x80, 0x12, 0x5d, 0x31, 0x78, 
+	0xff, 0xf7, 0xb7, 0xff, 0x30, 0x00, 0x00, 0xd0, 0xe7, 0xa0, 0x19, 0x20, 0x21, 0xff, 0x03, 0xf7, 
+	0xb1, 0xff, 0x01, 0x36, 0xd5, 0x03, 0xff, 0x10, 0xab, 0x10, 0xf0, 0x22, 0x03, 0x04, 0x29, 0x40, 
+	0x04, 0x10, 0xb5, 0x01, 0x40, 0x0c, 0x13, 0x42, 0x02, 0xd0, 0xb0, 0x04, 0x2f, 0x00, 0xc0, 0x18, 
+	0x04, 0x21, 0x04, 0xf0, 0x00, 0xfe, 0x80, 0x35, 0x67, 0x0f, 0x4b, 0x19, 0x6a, 0x58, 0x6a, 0x03, 
+	0x00, 0x23, 0x70, 0xb5, 0x59, 0x43, 0x00, 0x28, 0x06, 0x00, 0xd0, 0xa0, 0x25, 0x02, 0x00, 0x0b, 
+	0x4e, 0xad, 0x00, 0x01, 0x13, 0x1a, 0x99, 0x42, 0x02, 0xd8, 0x70, 0x80, 0x20, 0xf7, 0x54, 0x78, 
+	0x13, 0x78, 0x24, 0x02, 0x1b, 0x00, 0x19, 0x1b, 0x04, 0x1b, 0x0c, 0xab, 0x42, 0x01, 0x00, 0xd2, 
+	0x94, 0x78, 0xf4, 0x54, 0x03, 0x32, 0xed, 0xc2, 0x40, 0x63, 0x11, 0x0f, 0x10, 0xb5, 0x01, 0x21, 
+	0x03, 0x3f, 0xfe, 0x14, 0xff, 0xf7, 0x62, 0x03, 0x81, 0x28, 0x65, 0x53, 0x00, 0x20, 0x16, 0xff, 
+	0xf7, 0xf1, 0x60, 0x0d, 0x04, 0x00, 0x0d, 0x75, 0x6f, 0x08, 0xc5, 0x00, 0x0d, 0x53, 0xab, 0x10, 
+	0xb5, 0x0c, 0x00, 0x0d, 0xdc, 0x60, 0x0d, 0x55, 0x10, 0x00, 0x0d, 0xd5, 0x60, 0x0d, 0x14, 0x00, 
+	0x0d, 0xce, 0x40, 0x0d, 0x20, 0x03, 0x23, 0x00, 0x47, 0x4a, 0x11, 0x69, 0x4b, 0x40, 0x06, 0x13, 
+	0x61, 0xff, 0xf7, 0xf3, 0x00, 0xc5, 0x51, 0xb3, 0x10, 0x00, 0xb5, 0x09, 0x4c, 0x23, 0x69, 0x01, 
+	0x2b, 0x06, 0x0a, 0xd1, 0xff, 0xf7, 0x1f, 0x00, 0x85, 0xe5, 0x40, 0x1b, 0x02, 0x00, 0x23, 0x16, 
+	0x21, 0x09, 0x20, 0x22, 0x7d, 0x05, 0x01, 0xf0, 0x3e, 0xf8, 0x20, 0x75, 0xf2, 0xe7, 0x30, 0x2b, 
+	0x00, 0x0c, 0x4c, 0xa3, 0x69, 0x00, 0x2b, 0x10, 0xd0, 0x40, 0xe3, 0x00, 0x05, 0x0d, 0xd0, 0x63, 
+	0x6a, 0x00, 0x2b, 0x04, 0x0a, 0xd0, 0xff, 0xf7, 0xf5, 0x00, 0xc1, 0x01, 0xff, 0x41, 0x23, 0x00, 
+	0x13, 0x01, 0xd1, 0x01, 0x33, 0x23, 0x00, 0x61, 0x61, 0xc2, 0x40, 0x45, 0x30, 0xeb, 0x0c, 0x4b, 
+	0x9a, 0x69, 0x00, 0xd5, 0x00, 0x2a, 0x0d, 0xd0, 0xda, 0x69, 0x00, 0x2a, 0x0a, 0x00, 0xd0, 0x5a, 
+	0x6a, 0x00, 0x2a, 0x07, 0xd0, 0x1b, 0xa2, 0x00, 0x2f, 0x07, 0x00, 0x75, 0xd4, 0xff, 0x05, 0x03, 
+	0xc7, 0x5f, 0x82, 0x40, 0xa9, 0xff, 0xf7, 0xa4, 0xfe, 0xf6, 0x41, 0x23, 0xa0, 0x00, 0x21, 0xf0, 
+	0xb5, 0x1f, 0x24, 0x01, 0x25, 0x0a, 0x80, 0x00, 0x3f, 0x89, 0x01, 0x88, 0x42, 0x0a, 0xda, 0x26, 
+	0x00, 0x00, 0x2f, 0x00, 0x86, 0x43, 0xb7, 0x40, 0x43, 0x00, 0x11, 0x9b, 0x00, 0x9b, 0x58, 0x3b, 
+	0x42, 0x03, 0x00, 0xd1, 0x01, 0x30, 0xf2, 0xe7, 0x01, 0x20, 0x40, 0x74, 0x42, 0x31, 0xd5, 0x30, 
+	0x37, 0x00, 0xeb, 0x00, 0x11, 0x43, 0xdf, 0xff, 0x00, 0x43, 0x1c, 0x04, 0xd0, 0x00, 0x2c, 0x02, 
+	0xd0, 0x02, 0x01, 0x3c, 0x01, 0x30, 0xf6, 0xe7, 0x31, 0xbb, 0xf0, 0x00, 0xb5, 0x2b, 0x4b, 0x0c, 
+	0x21, 0x5a, 0x5e, 0x8d, 0x00, 0xb0, 0x01, 0x92, 0x2a, 0x4a, 0x17, 0x68, 0xdb, 0x00, 0x69, 0x7d, 
+	0x1f, 0x02, 0x93, 0xeb, 0x43, 0xdb, 0x00, 0x17, 0x1d, 0x40, 0x7b, 0x1b, 0x28, 0x00, 0x13, 0x01, 
+	0x60, 0xff, 0xf7, 0xde, 0xff, 0x04, 0x00, 0x14, 0x6f, 0x2a, 0xbe, 0xfb, 0x14, 0x6f, 0x21, 0x04, 
+	0x6f, 0xf5, 0x00, 0x09, 0x21, 0x20, 0x20, 0x20, 0x00, 0x09, 0xf0, 0xfb, 0x00, 0x26, 0x63, 0x00, 
+	0x1c, 0x2e, 0xd0, 0x1e, 0x4b, 0x20, 0x04, 0x1b, 0x08, 0x5d, 0x00, 0x0c, 0x03, 0x06, 0xc5, 0xe6, 
+	0xfe, 0x1b, 0x04, 0x4a, 0x01, 0x00, 0x04, 0xa8, 0x04, 0x1f, 0xfc, 0x02, 0x00, 0x21, 0x03, 0x98, 
+	0x04, 0xf0, 0xeb, 0xfc, 0x04, 0x20, 0xa9, 0x02, 0x03, 0x82, 0x04, 0xf0, 0x38, 0xfc, 0x02, 0x00, 
+	0x9b, 0x02, 0x21, 0x18, 0x5d, 0x04, 0xf0, 0xe1, 0x84, 0x00, 0x13, 0x03, 0x00, 0x12, 0x4a, 0x10, 
+	0x15, 0xb1, 0xfc, 0x00, 0x30, 0x00, 0x04, 0xa9, 0x04, 0xf0, 0x19, 0xfc, 0x00, 0x01, 0x9b, 0x01, 
+	0x36, 0x5b, 0x1b, 0xb3, 0x42, 0x01, 0x05, 0xdd, 0x60, 0x1c, 0xff, 0xf7, 0x85, 0x00, 0x79, 0x00, 
+	0x0a, 0x2e, 0xce, 0xd1, 0x03, 0x4b, 0x1f, 0x60, 0x6a, 0x0d, 0x47, 0x39, 0x10, 0xd3, 0x8c, 0x00, 
+	0x03, 0xda, 0x03, 0xd3, 0xf3, 0xd0, 0x13, 0xd7, 0x12, 0x3b, 0xe6, 0x04, 0x1b, 0xe3, 0x00, 0x08, 
+	0xf0, 0x00, 0xb5, 0x44, 0x4a, 0x44, 0x49, 0x13, 0x6a, 0x52, 0x20, 0x6a, 0x95, 0x00, 0xcf, 0x0a, 
+	0x68, 0x44, 0x1f, 0x02, 0x00, 0x92, 0xe2, 0x43, 0xd2, 0x17, 0x14, 0x40, 0x02, 0x02, 0x9a, 0x12, 
+	0x1b, 0x0a, 0x60, 0x22, 0x05, 0xfd, 0x0a, 0x00, 0x32, 0x9a, 0x42, 0x00, 0xdd, 0x1a, 0x00, 0x03, 
+	0x00, 0x25, 0x2b, 0x00, 0x53, 0x43, 0x02, 0x20, 0x04, 0x0a, 0x93, 0x02, 0xf0, 0x51, 0x20, 0xd9, 
+	0x37, 0x00, 0xcf, 0x88, 0xc8, 0x20, 0xd9, 0x05, 0x3b, 0xf0, 0x83, 0x00, 0x09, 0x22, 0x20, 0x34, 
+	0x80, 0x00, 0x09, 0x7e, 0xfb, 0x20, 0x22, 0x6c, 0x43, 0x07, 0x00, 0xab, 0x1a, 0x70, 0x1a, 0x82, 
+	0x01, 0x9b, 0x1f, 0x00, 0x19, 0x00, 0x23, 0x03, 0x95, 0x00, 0x93, 0x04, 0x01, 0x9b, 0x9c, 0x42, 
+	0x06, 0xdb, 0x29, 0x4b, 0x07, 0xaf, 0x20, 0x60, 0x15, 0x40, 0x9b, 0x24, 0x4e, 0x03, 0x9a, 0x33, 
+	0x00, 0x6a, 0x53, 0x43, 0xa3, 0x42, 0x0d, 0xd1, 0x26, 0x00, 0x49, 0x0c, 0xa8, 0x0c, 0xf0, 0xa0, 
+	0xfc, 0x00, 0x20, 0x98, 0x0c, 0x00, 0xd9, 0xac, 0xfb, 0x00, 0x9b, 0x01, 0x00, 0x33, 0x00, 0x93, 
+	0x03, 0x34, 0x03, 0x37, 0xe1, 0x00, 0xe7, 0x7b, 0x78, 0x3d, 0x78, 0x1b, 0x02, 0xed, 0x00, 0x18, 
+	0x2d, 0x04, 0xbb, 0x78, 0x2d, 0x0c, 0x28, 0x2a, 0x00, 0x05, 0x01, 0x35, 0x4b, 0x21, 0x35, 0x0c, 
+	0x01, 0x35, 0xa6, 0x08, 0xfb, 0x02, 0x21, 0x05, 0x01, 0x35, 0x50, 0xfc, 0x0c, 0x80, 0x41, 0x35, 
+	0x9d, 0xfb, 0x31, 0x6a, 0x03, 0x9b, 0x4b, 0x00, 0x43, 0x19, 0x00, 0x05, 0x23, 0x63, 0x43, 0xc9, 
+	0x00, 0x18, 0x01, 0x9b, 0x59, 0x18, 0x06, 0xab, 0x0f, 0x00, 0x22, 0x58, 0x1d, 0x0c, 0xf0, 0x05, 
+	0xfb, 0x0c, 0x01, 0xa9, 0x07, 0xaa, 0x08, 0x00, 0x2d, 0x04, 0x05, 0x9b, 0x00, 0xfb, 0x2d, 0x14, 
+	0x0a, 0x4a, 0x00, 0xd4, 0x0a, 0x11, 0x4a, 0x0c, 0xa9, 0x10, 0x37, 0x81, 0xfb, 0xbf, 0x22, 0xab, 
+	0xaa, 0x11, 0x2f, 0x0e, 0x01, 0x1f, 0x25, 0x00, 0x03, 0x40, 0x00, 0x03, 0x51, 0xb8, 0x00, 0x03, 
+	0x69, 0x06, 0x8f, 0x15, 0x2b, 0x15, 0x1f, 0x03, 0x22, 0x3c, 0x00, 0x4b, 0x59, 0x6a, 0x1b, 0x6a, 
+	0xf0, 0xb5, 0x53, 0x00, 0x43, 0x14, 0x00, 0x44, 0x43, 0x0c, 0x32, 0x42, 0x00, 0x43, 0x9b, 0x18, 
+	0x89, 0xb0, 0xcb, 0x18, 0x01, 0x00, 0x93, 0x36, 0x4b, 0x1a, 0x68, 0x02, 0x92, 0x01, 0x00, 0x22, 
+	0x47, 0x1f, 0x52, 0x42, 0x1a, 0x60, 0xfb, 0x80, 0x02, 0x19, 0x1f, 0x40, 0x0c, 0x19, 0x05, 0x00, 
+	0x80, 0x00, 0x26, 0xc7, 0x1b, 0xff, 0xf7, 0x46, 0xff, 0xf0, 0x08, 0x21, 0x63, 0x78, 0x22, 0x00, 
+	0xcd, 0x9b, 0x18, 0xa2, 0x00, 0x78, 0x36, 0x02, 0x03, 0x92, 0xc9, 0x01, 0x5a, 0x02, 0x04, 0x1e, 
+	0x40, 0x52, 0x0c, 0x0b, 0x44, 0x2b, 0xd2, 0x02, 0x18, 0x04, 0x23, 0x00, 0x21, 0x38, 0x00, 0x8d, 
+	0xa0, 0x00, 0xfe, 0xc0, 0x22, 0x24, 0x49, 0x43, 0x04, 0x5b, 0x02, 0x0c, 0xd2, 0x01, 0x59, 0x18, 
+	0x93, 0x04, 0x05, 0x41, 0x00, 0x05, 0x49, 0x0d, 0x0e, 0x43, 0x09, 0x06, 0x20, 0x00, 0x00, 0x09, 
+	0x0e, 0xff, 0xf7, 0x76, 0xfd, 0x31, 0x32, 0x0a, 0x09, 0x14, 0xb9, 0x01, 0xf9, 0x70, 0xfd, 0x16, 
+	0x3d, 0x17, 0x02, 0xff, 0x02, 0x23, 0x03, 0x9a, 0x05, 0x20, 0x3d, 0x81, 0x01, 0xfe, 0x01, 0x06, 
+	0xa0, 0x1c, 0x00, 0x24, 0x10, 0x29, 0x44, 0x61, 0x20, 0x1d, 0x08, 0xff, 0x04, 0x01, 0x03, 0x18, 
+	0x00, 0x00, 0x01, 0x99, 0xdc, 0x73, 0x0c, 0xf0, 0x81, 0xfa, 0x10, 0x0f, 0x23, 0x08, 0x10, 0x29, 
+	0xaa, 0x04, 0xf0, 0xf1, 0x00, 0xfe, 0x04, 0xab, 0x19, 0x5d, 0x01, 0x9b, 0x18, 0xc0, 0x09, 0x09, 
+	0x06, 0x5b, 0xfd, 0x0f, 0x2c, 0xf6, 0xd1, 0x04, 0xbe, 0x21, 0xa9, 0x09, 0x41, 0xa9, 0x33, 0x1b, 
+	0x11, 0x17, 0x08, 0x2b, 0x07, 0x04, 0x21, 0x00, 0x4e, 0x0c, 0x23, 0xf5, 0x5e, 0x00, 0x2d, 0x33, 
+	0x02, 0xd0, 0x00, 0x24, 0x1f, 0x4f, 0x3c, 0x02, 0xf5, 0x72, 0x00, 0xfe, 0x1e, 0x4a, 0x13, 0x88, 
+	0xdb, 0x43, 0x1d, 0x00, 0x49, 0x00, 0x94, 0x0b, 0x60, 0x01, 0x92, 0x28, 0x80, 0x05, 0x0a, 0xfd, 
+	0xf9, 0x01, 0x23, 0x04, 0x00, 0x18, 0x00, 0x42, 0x10, 0xd0, 0x38, 0x68, 0xff, 0xf7, 0x52, 0x02, 
+	0xfe, 0x17, 0x4b, 0x19, 0x5c, 0x00, 0x07, 0xb5, 0xff, 0x20, 0xf7, 0x25, 0x09, 0x01, 0x05, 0xd0, 
+	0x33, 0x6a, 0x58, 0x00, 0x1e, 0xff, 0xf7, 0x58, 0xff, 0x01, 0x23, 0x00, 0x02, 0x93, 0xf1, 0x23, 
+	0x1c, 0x42, 0x01, 0x04, 0x0f, 0x4e, 0x00, 0xfe, 0x0f, 0x4b, 0x1c, 0x42, 0xdf, 0xd0, 0x02, 0x01, 
+	0x25, 0x2c, 0x42, 0x07, 0xd1, 0x00, 0x9b, 0x04, 0x17, 0x04, 0xd0, 0x03, 0xf0, 0xee, 0xfe, 0x38, 
+	0xdf, 0x0c, 0xf0, 0x00, 0xe9, 0xfb, 0x01, 0x9b, 0x1c, 0x88, 0xe4, 0x43, 0x6a, 0xef, 0x43, 0xe7, 
+	0x10, 0x93, 0x30, 0x03, 0x3e, 0x88, 0x45, 0x17, 0x02, 0x80, 0x0b, 0x01, 0xf7, 0xb5, 0x1f, 0x4e, 
+	0x33, 0x6a, 0x05, 0x00, 0x00, 0x83, 0x42, 0x1b, 0xdd, 0x03, 0x24, 0x07, 0x80, 0x01, 0xa1, 0x72, 
+	0x6a, 0x01, 0x3b, 0x01, 0x92, 0x33, 0x00, 0x62, 0x14, 0x19, 0x33, 0x6a, 0xbb, 0x42, 0x13, 0x01, 
+	0xdc, 0x03, 0x24, 0x5c, 0x43, 0x0f, 0x20, 0x00, 0x49, 0x00, 0x19, 0x27, 0x00, 0x45, 0x43, 0x3b, 
+	0x1b, 0x9d, 0x02, 0x42, 0x18, 0xdc, 0x0f, 0x27, 0x65, 0x00, 0x1d, 0x7b, 0x24, 0x43, 0x2a, 0x06, 
+	0x2b, 0x17, 0xdc, 0x30, 0x6f, 0x20, 0x00, 0x42, 0xe1, 0x05, 0xeb, 0xc1, 0xfc, 0x21, 0x79, 0x11, 
+	0x65, 0xbd, 0x08, 0xfc, 0x61, 0x79, 0xa0, 0x00, 0x07, 0xb9, 0xfc, 0x01, 0x00, 0x37, 0x03, 0x34, 
+	0xd9, 0xe7, 0x38, 0x00, 0xf9, 0xa0, 0x00, 0x1d, 0xb2, 0x00, 0x0d, 0xdd, 0xe7, 0x28, 0x00, 0xa9, 
+	0x00, 0x7c, 0xff, 0xf7, 0xac, 0xfc, 0x01, 0x35, 0xdc, 0xc0, 0x22, 0x43, 0x0a, 0xcb, 0x24, 0x37, 
+	0x4f, 0x38, 0x4d, 0x7b, 0x82, 0x06, 0x99, 0x20, 0x00, 0x02, 0x93, 0x2c, 0x01, 0x23, 0x47, 0x20, 
+	0xfe, 0x35, 0x21, 0x23, 0x01, 0x26, 0x34, 0x49, 0x03, 0x00, 0x92, 0x0b, 0x60, 0x3b, 0x6a, 0x58, 
+	0x1c, 0x02, 0x00, 0xf0, 0x6a, 0xf9, 0x08, 0x22, 0x01, 0x90, 0x10, 0x00, 0x42, 0x0d, 0xd0, 0x2a, 
+	0x68, 0x3b, 0x6a, 0x9a, 0x02, 0x42, 0x3f, 0xd1, 0x00, 0x21, 0x08, 0x01, 0xaf, 0x93, 0x00, 0xfc, 
+	0x34, 0x00, 0x00, 0x28, 0x02, 0xd0, 0x28, 0x80, 0x01, 0x3b, 0xc6, 0xfe, 0x01, 0x9b, 0x33, 0x42, 
+	0x14, 0x81, 0x00, 0x0b, 0x3b, 0x6a, 0x98, 0x42, 0x02, 0xda, 0x00, 0x8b, 0x00, 0xfe, 0x34, 0x00, 
+	0x2b, 0x68, 0x3a, 0x6a, 0x93, 0x2a, 0x42, 0x09, 0x40, 0x2f, 0x7b, 0x80, 0x2f, 0xae, 0x00, 0x2f, 
+	0x5b, 0x10, 0x07, 0x03, 0xd5, 0x10, 0x0b, 0x78, 0xff, 0x34, 0x00, 0x06, 0xfd, 0x23, 0x01, 0x9a, 
+	0x1a, 0x02, 0x61, 0x10, 0x0f, 0x04, 0x14, 0xfe, 0x15, 0x4b, 0x10, 0x0d, 0xbf, 0x01, 0x63, 0x01, 
+	0x9b, 0x02, 0x2b, 0x42, 0x13, 0xd1, 0x00, 0x2c, 0x11, 0x63, 0x3c, 0x4c, 0xfe, 0x5b, 0x6d, 0x03, 
+	0x23, 0x03, 0xe9, 0x07, 0x1f, 0xd1, 0x5c, 0x00, 0xd0, 0x18, 0x80, 0x23, 0x59, 0x40, 0xff, 0xf7, 
+	0x40, 0x40, 0x00, 0x5b, 0xbd, 0xe7, 0x0c, 0xf0, 0x2a, 0xfb, 0x00, 0x03, 0x9b, 0x18, 0x88, 0xc3, 
+	0x43, 0x01, 0x93, 0x58, 0xe1, 0xf1, 0x7f, 0x02, 0x11, 0x7b, 0x10, 0xf7, 0x5d, 0x4b, 0x1c, 0x10, 
+	0x60, 0x5d, 0x4b, 0x0b, 0xc9, 0x91, 0x1c, 0x60, 0x02, 0x02, 0x90, 0x02, 0xf0, 0x9b, 0xf8, 0x01, 
+	0x05, 0x0f, 0x36, 0x20, 0xf9, 0x07, 0x00, 0x05, 0xcd, 0xf9, 0x58, 0x4b, 0x1c, 0x00, 0x80, 0x00, 
+	0xf0, 0xc7, 0xf9, 0x02, 0xf0, 0xdd, 0x00, 0xf9, 0x80, 0x23, 0x80, 0x22, 0xdb, 0x04, 0xd2, 0x00, 
+	0x00, 0x1a, 0x80, 0x20, 0x00, 0x22, 0x00, 0x52, 0x92, 0x04, 0x3d, 0x5f, 0xf9, 0x04, 0x75, 0x20, 
+	0x51, 0x00, 0x09, 0x5a, 0x8a, 0x00, 0x09, 0x02, 0x20, 0x4f, 0x00, 0x09, 0x55, 0x00, 0x09, 0x03, 
+	0x20, 0x20, 0x4e, 0x00, 0x09, 0x50, 0xf9, 0x7f, 0x27, 0x00, 0x00, 0x23, 0x4c, 0x4e, 0x4d, 0x4d, 
+	0x33, 0x70, 0xa3, 0x00, 0x00, 0x59, 0x59, 0x30, 0x00, 0x18, 0x35, 0x0c, 0x00, 0xf0, 0x5b, 0xfa, 
+	0x63, 0x5d, 0x1a, 0x06, 0x00, 0x00, 0xd5, 0x78, 0xe0, 0x08, 0x21, 0x03, 0x9a, 0x9b, 0x01, 0x00, 
+	0x98, 0x58, 0x04, 0xf0, 0x49, 0xfa, 0x3a, 0x17, 0x00, 0x4d, 0xfa, 0x60, 0x1d, 0x00, 0x22, 0x31, 
+	0x00, 0x00, 0x01, 0x34, 0x02, 0xf0, 0x31, 0xf9, 0x06, 0x2c, 0x01, 0xdf, 0xd1, 0x00, 0x22, 0x0c, 
+	0x20, 0x3e, 0x00, 0x4b, 0x01, 0x2a, 0xf9, 0x3d, 0x4b, 0x1a, 0x88, 0xd2, 0x00, 0xcb, 0x00, 0x11, 
+	0x00, 0x01, 0x9b, 0x1b, 0x88, 0xda, 0x43, 0x00, 0x0b, 0x43, 0xd8, 0x43, 0x05, 0x33, 0x4f, 0xd0, 
+	0x00, 0x01, 0x28, 0xf5, 0xd1, 0x02, 0xf0, 0xde, 0xf8, 0x04, 0x00, 0x22, 0x36, 0x49, 0x10, 0x01, 
+	0xca, 0x15, 0xf9, 0x10, 0x00, 0x24, 0x08, 0x00, 0x77, 0x33, 0x49, 0x33, 0x70, 0x00, 0xa5, 0x00, 
+	0x0a, 0x2c, 0x06, 0xdc, 0x2d, 0x4b, 0x20, 0x20, 0x33, 0x10, 0x7d, 0x0c, 0xf0, 0x1d, 0xfa, 0x2f, 
+	0x40, 0x49, 0x10, 0x07, 0x19, 0xfa, 0x02, 0x9b, 0x39, 0x00, 0x04, 0x58, 0x59, 0x04, 0xf0, 0x0c, 
+	0x40, 0x79, 0x10, 0xfa, 0x4c, 0x28, 0x20, 0x19, 0x0c, 0xfa, 0x0e, 0x41, 0x00, 0x33, 0x20, 0x4b, 
+	0x44, 0x4c, 0x40, 0x33, 0x03, 0xfa, 0x22, 0x20, 0x19, 0xff, 0xf9, 0x42, 0x03, 0x40, 0x33, 0xf2, 
+	0xf9, 0x01, 0x34, 0x30, 0x35, 0xf5, 0x60, 0xf9, 0x10, 0xad, 0x02, 0x31, 0xf0, 0xda, 0xf8, 0x13, 
+	0x2c, 0x0c, 0xc4, 0xd1, 0x01, 0x9b, 0x10, 0xa3, 0x70, 0xa1, 0x05, 0x33, 0x02, 0xf8, 0xd1, 0x0c, 
+	0xf0, 0x5e, 0xfa, 0x51, 0xab, 0x3b, 0x0b, 0x40, 0x08, 0x21, 0x02, 0x00, 0xf3, 0x84, 0x01, 0x8f, 
+	0x0f, 0x4f, 0x21, 0x02, 0x84, 0x1e, 0x1b, 0x02, 0x00, 0x04, 0x5f, 0x04, 0xb3, 0x56, 0x79, 0x00, 
+	0x03, 0x91, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x1b, 0x0b, 0x70, 0x0d, 0xdd, 0x00, 0x08, 0xb4, 0x00, 
+	0x0b, 0x11, 0xaf, 0xd2, 0x00, 0x07, 0x56, 0xcd, 0x00, 0x03, 0xd0, 0x00, 0x03, 0xcc, 0x00, 0x03, 
+	0x0e, 0x1d, 0x23, 0x08, 0x05, 0x49, 0x06, 0x48, 0x3b, 0xf1, 0x0e, 0x2b, 0xfa, 0xb4, 0x04, 0x01, 
+	0x04, 0x0c, 0x4d, 0x1e, 0xab, 0xac, 0x0e, 0x67, 0x41, 0x10, 0x12, 0x00, 0x08, 0xfc, 0x0e, 0xaf, 
+	0x74, 0x4f, 0x3b, 0xf7, 0xe8, 0x80, 0x57, 0x73, 0x23, 0x02, 0x00, 0x9a, 0x43, 0x00, 0x23, 0x40, 
+	0x9a, 0x03, 0xbd, 0x00, 0x12, 0x08, 0x33, 0xf0, 0x22, 0x42, 0x10, 0x10, 0x09, 0x11, 0x04, 0x33, 
+	0x0c, 0x20, 0x09, 0x80, 0x00, 0x10, 0x02, 0x33, 0x80, 0x07, 0xc0, 0x0f, 0x1b, 0x00, 0x18, 0x00, 
+	0x20, 0x0d, 0x2b, 0x03, 0xdc, 0x02, 0x01, 0x48, 0x9b, 0x00, 0x19, 0x50, 0x18, 0x18, 0x50, 0x57, 
+	0xb0, 0x10, 0x4b, 0xdd, 0x00, 0x4b, 0x17, 0x5d, 0x00, 0x21, 0x12, 0x4a, 0x80, 0x1e, 0x9f, 0x11, 
+	0x80, 0xc1, 0x07, 0x04, 0xd5, 0x08, 0x02, 0x21, 0x0f, 0x48, 0x04, 0x88, 0x21, 0x09, 0xe9, 0x99, 
+	0x8a, 0x00, 0x0d, 0x10, 0x21, 0x0c, 0x40, 0x0d, 0x59, 0x00, 0x0d, 0x20, 0x20, 0x21, 0x08, 0x40, 
+	0x0d, 0x07, 0x49, 0x08, 0x88, 0x18, 0x61, 0x43, 0x04, 0x41, 0x04, 0x57, 0x08, 0x80, 0x13, 0x80, 
+	0x68, 0x3b, 0xec, 0x01, 0x03, 0x07, 0xc9, 0x07, 0x8a, 0x00, 0x09, 0x8b, 0x7e, 0x63, 0x00, 0x22, 
+	0x01, 0x10, 0x4b, 0x10, 0xb5, 0x1a, 0x80, 0xc2, 0x10, 0x61, 0x00, 0x24, 0x0e, 0x49, 0x0a, 0x88, 
+	0xa2, 0x43, 0x0a, 0x25, 0x80, 0x82, 0x10, 0x61, 0x24, 0x0a, 0x40, 0x0d, 0x42, 0x10, 0x61, 0x2a, 
+	0x24, 0x07, 0x40, 0x0d, 0x06, 0x00, 0x07, 0x82, 0x00, 0x07, 0x01, 0x38, 0x22, 0x1a, 0x40, 0x5d, 
+	0xd0, 0x5b, 0x79, 0x37, 0x11, 0x4a, 0x11, 0x00, 0x4b, 0x12, 0x78, 0x1b, 0x68, 0x00, 0x2a, 0x02, 
+	0x00, 0xd1, 0x80, 0x21, 0x09, 0x01, 0x5b, 0x18, 0x0e, 0x02, 0x49, 0x08, 0x78, 0x20, 0x21, 0x00, 
+	0x0d, 0xd9, 0x0d, 0x00, 0x49, 0x0c, 0x78, 0x81, 0x01, 0x77, 0x2c, 0x00, 0x00, 0xd0, 0x41, 0x01, 
+	0x0b, 0x48, 0x00, 0x78, 0x02, 0x48, 0x43, 0x00, 0x23, 0x22, 0x92, 0x05, 0x76, 0x08, 0x4a, 0x10, 
+	0x01, 0x78, 0xc0, 0x00, 0x40, 0x18, 0x18, 0x1a, 0x31, 0x07, 0x55, 0x6a, 0x0d, 0x5f, 0x40, 0x01, 
+	0xaf, 0x69, 0x00, 0x07, 0x67, 0x00, 0x03, 0x51, 0xb6, 0x0d, 0xb3, 0x68, 0x00, 0x07, 0x70, 0xb5, 
+	0x05, 0x0e, 0xcb, 0x00, 0xff, 0xf7, 0xcb, 0xff, 0x0e, 0x4b, 0xc3, 0x18, 0x00, 0x00, 0x2c, 0x0c, 
+	0xd1, 0x0d, 0x4a, 0x13, 0x60, 0x04, 0x0d, 0x4b, 0xc2, 0x18, 0x0d, 0x0e, 0x01, 0x0d, 0x4b, 0x48, 
+	0xc0, 0x00, 0x07, 0x18, 0x60, 0x3a, 0x41, 0x01, 0x2c, 0xfa, 0x00, 0xd1, 0xab, 0x42, 0xf8, 0xd2, 
+	0x00, 0x23, 0x04, 0xa8, 0x00, 0x23, 0x05, 0x00, 0x03, 0x06, 0x00, 0x03, 0xf0, 0xe7, 0x7c, 0x08, 
+	0xcf, 0xff, 0xff, 0x20, 0x00, 0x5b, 0x7c, 0xd4, 0xff, 0x21, 0xff, 0x24, 0x10, 0x07, 0xfc, 0xff, 
+	0xff, 0x2c, 0x15, 0x3b, 0x05, 0x23, 0x0c, 0x4a, 0x13, 0x70, 0x00, 0x03, 0x80, 0x50, 0x03, 0x88, 
+	0x0e, 0xe9, 0x04, 0x1a, 0x88, 0x01, 0x13, 0x40, 0x1a, 0x80, 0x00, 0x89, 0x31, 0x1a, 0x88, 0xff, 
+	0x31, 0x8a, 0x43, 0x00, 0x1a, 0x80, 0x80, 0x22, 0x19, 0x88, 0xd2, 0x00, 0x40, 0x0a, 0x00, 0x09, 
+	0x70, 0x47, 0x35, 0x75, 0x00, 0x03, 0x54, 0xba, 0x01, 0x07, 0xc6, 0x00, 0x03, 0xde, 0x00, 0x03, 
+	0xff, 0xfe, 0x00, 0xff, 0xff, 0x01, 0x22, 0x01, 0x4b, 0x1a, 0x70, 0xf0, 0x30, 0x1b, 0x0a, 0x47, 
+	0x03, 0xd5, 0x03, 0x23, 0xf9, 0x40, 0x1a, 0x01, 0x08, 0x28, 0x0a, 0xdd, 0xa0, 0x08, 0x01, 0x00, 
+	0x1b, 0x08, 0x90, 0x00, 0xb9, 0xf3, 0xd1, 0x31, 0x31, 0x24, 0x1a, 0xf4, 0xe7, 0x10, 0x00, 0x24, 
+	0xf4, 0x0b, 0xc3, 0x8b, 0xb0, 0x04, 0x90, 0x10, 0x05, 0x91, 0xcc, 0x0f, 0x13, 0x03, 0x93, 0xcb, 
+	0x4b, 0x00, 0x1d, 0x68, 0xcb, 0x4b, 0x1c, 0x68, 0x80, 0x23, 0x08, 0x04, 0x9a, 0x1b, 0x05, 0x08, 
+	0x7f, 0xd2, 0x40, 0x34, 0x01, 0xff, 0x23, 0xff, 0x34, 0x9c, 0x43, 0xc7, 0x00, 0x1f, 0x00, 0x45, 
+	0x2b, 0x00, 0xd9, 0xc9, 0xe1, 0x27, 0x2b, 0x11, 0x07, 0xd8, 0x0f, 0x00, 0x09, 0x74, 0xe1, 0x03, 
+	0x00, 0x05, 0x00, 0x5f, 0xe1, 0x10, 0x27, 0x10, 0xe0, 0x1a, 0x00, 0x00, 0x01, 0x21, 0x28, 0x3a, 
+	0x12, 0x06, 0x12, 0x0e, 0x00, 0x91, 0x40, 0x0a, 0x00, 0xbd, 0x49, 0x20, 0x27, 0x00, 0x0a, 0x42, 
+	0x05, 0xd1, 0x84, 0x21, 0x89, 0x05, 0x00, 0x10, 0x3f, 0x0a, 0x42, 0x00, 0xd0, 0x08, 0x3f, 0x00, 
+	0xb9, 0x4a, 0x12, 0x78, 0x02, 0x2a, 0x00, 0xd1, 0x10, 0x9f, 0xe3, 0x01, 0x0a, 0x3f, 0x10, 0x2a, 
+	0x00, 0xd9, 0x10, 0x20, 0x27, 0xb5, 0x00, 0x53, 0x01, 0x2b, 0x00, 0xd1, 0x04, 0x20, 0x27, 0x04, 
+	0x9a, 0xd2, 0x07, 0xbb, 0x00, 0x22, 0x00, 0x04, 0x9b, 0x9b, 0x68, 0x1b, 0x0a, 0x08, 0x93, 0x10, 
+	0x01, 0x92, 0xaf, 0x07, 0x05, 0x9a, 0x42, 0x10, 0xd1, 0x00, 0x08, 0x9b, 0x5a, 0x1e, 0x93, 0x41, 
+	0x01, 0x33, 0x20, 0x01, 0x93, 0x50, 0x93, 0x06, 0xd2, 0xa9, 0x4b, 0x19, 0x00, 0x68, 0x01, 0x22, 
+	0x00, 0x29, 0x00, 0xd0, 0x03, 0x68, 0x92, 0x0f, 0x75, 0x06, 0xa9, 0x31, 0x06, 0xbf, 0x5b, 0xff, 
+	0x80, 0x00, 0x22, 0xc0, 0x20, 0x00, 0x21, 0x92, 0x01, 0xc0, 0x00, 0x04, 0x0c, 0xf0, 0x9a, 0xf8, 
+	0x80, 0x22, 0x00, 0x11, 0x21, 0x9f, 0x48, 0x1c, 0xd3, 0x94, 0xf8, 0x03, 0x00, 0x23, 0x41, 0x0b, 
+	0x01, 0xf3, 0x19, 0x00, 0x12, 0x02, 0x9b, 0x0d, 0xf9, 0x40, 0x8b, 0x00, 0x1d, 0x03, 0x99, 0x9a, 
+	0x48, 0x12, 0x02, 0x04, 0x0c, 0xf0, 0x85, 0xf8, 0x99, 0x00, 0x87, 0x00, 0x2b, 0x28, 0x05, 0xd0, 
+	0x10, 0x31, 0x97, 0x20, 0x31, 0x7b, 0xf8, 0x96, 0xa0, 0x20, 0x9b, 0x05, 0x00, 0x33, 0x00, 0x21, 
+	0x94, 0x48, 0x12, 0x80, 0x00, 0x13, 0x71, 0xf8, 0xc0, 0x23, 0x9b, 0x02, 0xe3, 0x00, 0x18, 0x06, 
+	0x93, 0x8f, 0x4b, 0x19, 0x78, 0x00, 0x40, 0x29, 0x02, 0x43, 0x23, 0x1b, 0x01, 0xed, 0x18, 0x83, 
+	0x08, 0x4b, 0x18, 0x78, 0x81, 0x00, 0x2d, 0xdb, 0x00, 0x5b, 0x40, 0x42, 0x0e, 0xc8, 0xd1, 0x56, 
+	0xe1, 0x7c, 0x4a, 0x16, 0x00, 0x78, 0x82, 0x01, 0x77, 0x2e, 0x00, 0xd0, 0x42, 0x28, 0x01, 0x82, 
+	0x02, 0x6f, 0x01, 0x12, 0x6f, 0x21, 0x89, 0x01, 0x00, 0x6d, 0x18, 0xad, 0x1a, 0x82, 0x4a, 0x15, 
+	0x60, 0x01, 0xed, 0x18, 0x81, 0x4b, 0x1d, 0x60, 0x01, 0x00, 0x93, 0x00, 0x17, 0xd0, 0x73, 0x4a, 
+	0x73, 0x4b, 0x7f, 0x49, 0x00, 0x12, 0x78, 0x09, 0x78, 0x1b, 0x78, 0x52, 0x00, 0x00, 0xd2, 0x18, 
+	0x0b, 0x43, 0x59, 0x1e, 0x8b, 0x41, 0x00, 0xc0, 0x21, 0x5b, 0x42, 0x09, 0x02, 0x9b, 0x03, 0x00, 
+	0x5b, 0x18, 0x79, 0x49, 0x69, 0x1a, 0xcb, 0x18, 0x20, 0x52, 0x03, 0x03, 0xe5, 0xdd, 0x01, 0x23, 
+	0x03, 0x93, 0x01, 0x05, 0x9b, 0x01, 0x2b, 0x1b, 0xd1, 0x6e, 0x00, 0x81, 0x08, 0x73, 0x4a, 0x74, 
+	0x4b, 0x11, 0x03, 0x20, 0xe1, 0x73, 0x09, 0x49, 0x11, 0x60, 0x73, 0x04, 0x31, 0x73, 0x4b, 0x30, 
+	0x05, 0x55, 0x74, 0x00, 0x05, 0x74, 0x40, 0x05, 0x75, 0x00, 0x05, 0x75, 0x20, 0x05, 0x04, 0x0c, 
+	0xf0, 0x76, 0xf8, 0x58, 0x20, 0xb9, 0x03, 0xd1, 0x00, 0x08, 0x22, 0x5d, 0x48, 0xfe, 0xf7, 0xd2, 
+	0xfe, 0x00, 0x04, 0x9b, 0x10, 0x33, 0x09, 0x93, 0x02, 0x93, 0x80, 0x10, 0x8b, 0x03, 0xd0, 0x01, 
+	0x22, 0x4a, 0x4b, 0x02, 0x08, 0x94, 0x5a, 0x70, 0x6b, 0x00, 0xcd, 0x5b, 0x07, 0x05, 0x40, 0xd5, 
+	0x03, 0x23, 0x00, 0x94, 0x46, 0x02, 0x9b, 0x63, 0x00, 0x44, 0x02, 0x93, 0x49, 0x4d, 0x2a, 0x78, 
+	0x02, 0x02, 0x98, 0x52, 0x00, 0x00, 0x21, 0xfe, 0x07, 0x13, 0x46, 0x02, 0x4b, 0x1a, 0x78, 0x28, 
+	0x78, 0x00, 0x01, 0xcf, 0xf8, 0x00, 0xe0, 0x02, 0x9b, 0x80, 0x03, 0x18, 0x18, 0xd2, 0xa0, 0x20, 
+	0x19, 0xa9, 0x06, 0xfd, 0x02, 0x2b, 0x00, 0xd0, 0x0a, 0x00, 0xe1, 0x3e, 0x4b, 0x1d, 0x78, 0x00, 
+	0x2d, 0x00, 0x00, 0xd0, 0xfa, 0xe0, 0xc0, 0x22, 0x02, 0x9b, 0x12, 0x00, 0x02, 0x9e, 0x18, 0x06, 
+	0x21, 0x01, 0x9a, 0x3d, 0x00, 0x48, 0x20, 0x2f, 0x00, 0xd1, 0xe1, 0xe0, 0xfe, 0x08, 0xf7, 0xb4, 
+	0xfe, 0x1a, 0x00, 0x0f, 0x30, 0x00, 0xfe, 0x00, 0xf7, 0xaf, 0xfe, 0x04, 0x22, 0x1c, 0x21, 0x36, 
+	0x90, 0x00, 0x8f, 0xaa, 0xfe, 0x11, 0xa7, 0x00, 0xd0, 0xf3, 0xe1, 0x40, 0x01, 0x02, 0x09, 0x10, 
+	0x3b, 0x19, 0x68, 0x26, 0x4b, 0x02, 0x5a, 0x70, 0x03, 0x9a, 0x9a, 0x70, 0x01, 0xfb, 0x9d, 0x00, 
+	0x14, 0x35, 0x1b, 0x05, 0x9d, 0x42, 0x12, 0xd2, 0x00, 0x03, 0x23, 0x0f, 0x26, 0x4a, 0x1e, 0x13, 
+	0x43, 0x40, 0x07, 0x0a, 0x8b, 0x61, 0xfe, 0x07, 0x9b, 0xf6, 0x1a, 0x00, 0x81, 0x23, 0x07, 0x9a, 
+	0x9b, 0x04, 0xf6, 0x18, 0x40, 0x29, 0x05, 0xc7, 0x0f, 0x3a, 0x0c, 0xf0, 0x46, 0xf8, 0x62, 0x35, 
+	0x05, 0xb5, 0x02, 0x59, 0xd0, 0x6f, 0xe1, 0x04, 0x00, 0x00, 0x0c, 0x0b, 0xf0, 0xc9, 0xff, 0x01, 
+	0xab, 0x00, 0x3d, 0x00, 0xd3, 0x00, 0xc5, 0xe1, 0x0b, 0xf0, 0xf2, 0xff, 0x04, 0x20, 0x08, 0x01, 
+	0xf0, 0xab, 0xfd, 0x05, 0x77, 0x93, 0x82, 0xe6, 0x00, 0x18, 0x1f, 0x0b, 0x28, 0x00, 0xd9, 0x9b, 
+	0xe6, 0x00, 0x0b, 0xf0, 0x18, 0xfa, 0x78, 0x00, 0x9a, 0xfe, 0x18, 0x9a, 0xfe, 0x6d, 0x20, 0x05, 
+	0x90, 0x07, 0x20, 0x27, 0x19, 0x82, 0x02, 0xa7, 0x9c, 0xe6, 0x10, 0x3f, 0x22, 0x00, 0x55, 0x98, 
+	0x03, 0xe6, 0x10, 0x37, 0x96, 0xe6, 0x30, 0x03, 0xbb, 0x14, 0x2b, 0x6e, 0x48, 0x00, 0x03, 0x14, 
+	0x2b, 0x05, 0x03, 0x87, 0x14, 0x2b, 0x14, 0x3b, 0x41, 0x08, 0x50, 0x33, 0x33, 0x70, 0x05, 0x63, 
+	0x00, 0x40, 0x00, 0x11, 0x06, 0x00, 0x80, 0x00, 0x03, 0x00, 0x01, 0x06, 0x14, 0x4b, 0x08, 0x8c, 
+	0xc1, 0x03, 0x02, 0x14, 0x63, 0x8c, 0xb9, 0x03, 0x2a, 0x02, 0x60, 0x00, 0x07, 0x5c, 0x00, 0x03, 
+	0xb7, 0x00, 0x17, 0xe0, 0x98, 0x00, 0x43, 0xfc, 0x74, 0x00, 0x2f, 0x03, 0xbb, 0x70, 0x7d, 0x00, 
+	0x02, 0x06, 0x28, 0x7c, 0x00, 0x06, 0x04, 0x00, 0x0b, 0xe0, 0x08, 0x7a, 0x00, 0x06, 0xdc, 0x00, 
+	0x17, 0x20, 0x77, 0x00, 0x32, 0x06, 0xe0, 0x00, 0x07, 0x00, 0x33, 0x06, 0xf4, 0x00, 0x07, 0x80, 
+	0x08, 0x71, 0x00, 0x06, 0xf8, 0x00, 0x07, 0x48, 0xf2, 0x03, 0x20, 0x02, 0x64, 0x10, 0x73, 0x2b, 
+	0x10, 0xd8, 0x4c, 0x2b, 0x0a, 0x00, 0xd8, 0x38, 0xe6, 0x13, 0x89, 0x4d, 0x63, 0x89, 0xd4, 0x20, 
+	0x49, 0x10, 0x03, 0x89, 0x00, 0xd1, 0x3f, 0xe6, 0x20, 0x2a, 0x27, 0x3d, 0x00, 0x03, 0xa3, 0x00, 
+	0xc5, 0x39, 0x00, 0xc5, 0xe4, 0x80, 0x00, 0xc5, 0x35, 0xe6, 0x9b, 0xe7, 0x08, 0x27, 0x32, 0x00, 
+	0xe6, 0x20, 0x3d, 0xb4, 0xe6, 0xcb, 0x49, 0x69, 0x00, 0x18, 0x11, 0x60, 0xcb, 0x4a, 0xaa, 0x18, 
+	0x1a, 0x03, 0x60, 0xca, 0x4b, 0xea, 0x18, 0xca, 0x04, 0xd5, 0xf0, 0x07, 0x40, 0xed, 0x00, 0x07, 
+	0x1d, 0x60, 0xd7, 0xe6, 0x08, 0x22, 0x08, 0xc9, 0x48, 0x07, 0xe7, 0x02, 0x3f, 0xfd, 0x1a, 0x21, 
+	0x00, 0x30, 0x00, 0x01, 0x9a, 0xfe, 0xf7, 0xcd, 0xfd, 0xa8, 0x11, 0xc3, 0x20, 0x01, 0xcd, 0xc8, 
+	0x00, 0x09, 0x29, 0x00, 0x17, 0x02, 0xe7, 0x08, 0x22, 0x60, 0x21, 0xc1, 0x01, 0xd3, 0xc9, 0x02, 
+	0xfd, 0x18, 0x22, 0x68, 0x21, 0xbf, 0x00, 0x09, 0xc4, 0x10, 0xfd, 0x0f, 0xe7, 0x12, 0x67, 0x00, 
+	0xd0, 0x0b, 0xe7, 0x40, 0xbc, 0x02, 0x1d, 0x2b, 0x00, 0x09, 0x3b, 0x07, 0x2b, 0x20, 0x02, 0xd8, 
+	0x12, 0x11, 0xf8, 0xe0, 0x08, 0x2d, 0x09, 0x04, 0xdc, 0x02, 0x99, 0xaa, 0x03, 0x10, 0x43, 0x6a, 
+	0xfd, 0x52, 0x00, 0x00, 0x4b, 0x6a, 0x00, 0x09, 0xa1, 0xfd, 0x12, 0x11, 0x02, 0x14, 0xd1, 0xb1, 
+	0x4b, 0x12, 0x05, 0xaf, 0x00, 0x35, 0x01, 0x2d, 0x00, 0x00, 0xd1, 0x1b, 0xe1, 0x02, 0x23, 0x01, 
+	0x93, 0x11, 0xae, 0x1e, 0xad, 0x23, 0xb7, 0x04, 0xd0, 0xac, 0x34, 0x47, 0x00, 0xd0, 0x12, 0xe1, 
+	0x20, 0x2f, 0x02, 0xd1, 0x02, 0x08, 0x23, 0x00, 0x26, 0x01, 0x02, 0xd1, 0x9a, 0x03, 0x02, 0x02, 
+	0x9b, 0xb1, 0x03, 0x59, 0x18, 0xa5, 0x00, 0x7b, 0x41, 0x00, 0xfd, 0x01, 0x9b, 0xa3, 0x48, 0x5a, 
+	0x00, 0x71, 0x82, 0x00, 0x53, 0x77, 0xfd, 0x20, 0x2f, 0x0a, 0x03, 0xeb, 0x02, 0x08, 0x99, 0xd2, 
+	0x01, 0x9f, 0x00, 0x1b, 0x33, 0xfd, 0x02, 0xa0, 0x03, 0xe3, 0x9d, 0x00, 0x09, 0x6a, 0xfd, 0x9c, 
+	0x4a, 0x13, 0x00, 0x78, 0x4a, 0x2b, 0x15, 0xd1, 0x94, 0x49, 0x9b, 0x20, 0x4b, 0x0d, 0x06, 0x4d, 
+	0x8f, 0x48, 0x9a, 0x49, 0x20, 0x80, 0x02, 0xc5, 0x00, 0xe1, 0x59, 0x62, 0x08, 0x21, 0x18, 0x00, 
+	0x62, 0x97, 0x4b, 0x19, 0x70, 0x01, 0x23, 0x8f, 0x08, 0x49, 0x0b, 0x70, 0x96, 0x00, 0x03, 0xff, 
+	0x21, 0x95, 0x88, 0x00, 0x0f, 0x13, 0x78, 0x77, 0x00, 0x7b, 0x2d, 0xe1, 0x8e, 0x00, 0x4b, 0x07, 
+	0x26, 0x18, 0x68, 0x40, 0x23, 0x82, 0x00, 0x4d, 0x1a, 0x00, 0x32, 0x40, 0x92, 0x02, 0x99, 0x00, 
+	0x00, 0x52, 0x19, 0x01, 0x33, 0x42, 0x50, 0x80, 0x00, 0x2b, 0xf6, 0xd1, 0x82, 0x4a, 0x7f, 0x3b, 
+	0x13, 0x22, 0x70, 0x89, 0x05, 0xe7, 0xff, 0x22, 0x88, 0x05, 0xa5, 0x85, 0x00, 0x4b, 0xbf, 0x3a, 
+	0x1a, 0x70, 0x09, 0x98, 0x02, 0x00, 0xf0, 0x7c, 0xff, 0x7a, 0x4b, 0x58, 0x60, 0x84, 0x00, 0x4b, 
+	0x98, 0x42, 0x04, 0xd1, 0x07, 0x22, 0x03, 0x98, 0x21, 0x43, 0x5c, 0xfd, 0x14, 0xd3, 0x03, 0x8f, 
+	0x21, 0x06, 0x98, 0x84, 0x1b, 0x03, 0x0b, 0xf0, 0x43, 0xfe, 0x10, 0x11, 0x01, 0xd1, 0x01, 0x0b, 
+	0xf0, 0x94, 0xfe, 0x01, 0x22, 0x7a, 0x00, 0x41, 0x60, 0x0b, 0x48, 0x85, 0x33, 0x6f, 0x8f, 0xe6, 
+	0x28, 0x00, 0x21, 0x80, 0x02, 0xe7, 0x55, 0xfe, 0xc0, 0x23, 0x5b, 0x02, 0xe6, 0x02, 0x18, 0x08, 
+	0x9b, 0xed, 0x18, 0x66, 0x21, 0x1d, 0x2e, 0xa0, 0x04, 0xc1, 0x31, 0x04, 0xf5, 0x64, 0x48, 0x0b, 
+	0xf0, 0xc8, 0x30, 0xfe, 0xa0, 0x09, 0xf5, 0x10, 0x1f, 0xd2, 0x01, 0x31, 0x00, 0x44, 0x60, 0x00, 
+	0x11, 0xbf, 0xfe, 0x31, 0x23, 0x1f, 0x39, 0xfe, 0x10, 0x80, 0x22, 0x21, 0x03, 0x3d, 0x92, 0x02, 
+	0xff, 0xf7, 0x10, 0xe1, 0xfc, 0xc0, 0x00, 0x25, 0x1b, 0x02, 0xe0, 0x18, 0x00, 0x58, 0x49, 0xd2, 
+	0x01, 0x0b, 0xf0, 0xfb, 0xfd, 0x62, 0xd0, 0x44, 0xf7, 0x01, 0xa9, 0xd0, 0x5a, 0xe6, 0x10, 0x29, 
+	0x12, 0x20, 0x02, 0x50, 0x00, 0x3d, 0xee, 0xfd, 0x53, 0xe6, 0xd0, 0x2a, 0x23, 0xc0, 0x00, 0x51, 
+	0xe1, 0x00, 0x51, 0x46, 0x00, 0x11, 0x97, 0x82, 0x00, 0x47, 0x31, 0x00, 0x92, 0x01, 0x42, 0x00, 
+	0x0b, 0x91, 0xa2, 0x40, 0x5b, 0x0b, 0x80, 0x5b, 0xb3, 0xfc, 0xe0, 0x40, 0x4b, 0x36, 0x0c, 0xe6, 
+	0x08, 0x25, 0x06, 0x02, 0x0f, 0x10, 0xbd, 0x12, 0xe7, 0x40, 0x3b, 0x20, 0xab, 0x00, 0xd1, 0x3e, 
+	0xe7, 0x80, 0x22, 0x40, 0x35, 0x01, 0xe5, 0x02, 0x9b, 0x01, 0x3d, 0xae, 0x03, 0x04, 0x9e, 0x19, 
+	0x30, 0x00, 0x37, 0x00, 0x83, 0xfe, 0xf7, 0x14, 0x71, 0xfc, 0x69, 0x02, 0x67, 0x34, 0x01, 0xa3, 
+	0x98, 0xfc, 0x02, 0x03, 0x9b, 0x75, 0x1c, 0xff, 0x35, 0x15, 0xcf, 0xe0, 0x94, 0x00, 0x6b, 0x52, 
+	0x02, 0x10, 0x63, 0x4d, 0x00, 0x63, 0x30, 0x00, 0x14, 0x2c, 0x49, 0x52, 0x21, 0x03, 0x82, 0x0d, 
+	0xcd, 0xf0, 0x18, 0xc0, 0x0f, 0x44, 0x04, 0x91, 0x89, 0xfc, 0x10, 0x22, 0x70, 0x21, 0x42, 0x28, 
+	0x01, 0x55, 0x84, 0xfc, 0x0f, 0xe7, 0x02, 0x19, 0x95, 0x60, 0xe3, 0x00, 0xc1, 0x30, 0x5f, 0x99, 
+	0x19, 0xd2, 0x01, 0x1f, 0x80, 0x00, 0x53, 0x32, 0xfc, 0x02, 0x22, 0x1d, 0x48, 0x69, 0x94, 0x00, 
+	0x23, 0x69, 0xfc, 0x10, 0xe3, 0xfb, 0x20, 0x21, 0x71, 0x1e, 0x02, 0xff, 0x39, 0x59, 0x18, 0x52, 
+	0x00, 0x10, 0x21, 0x21, 0x00, 0xfc, 0xf1, 0xe6, 0x03, 0xc3, 0x00, 0x21, 0x17, 0x00, 0x4b, 0xfe, 
+	0xe6, 0x05, 0x02, 0x00, 0x10, 0x70, 0x08, 0xfd, 0xff, 0xff, 0x28, 0x07, 0xbf, 0xe0, 0xfa, 0xff, 
+	0x42, 0xff, 0x13, 0xa7, 0x20, 0xf7, 0xff, 0xff, 0x13, 0xa7, 0x60, 0x63, 0xf3, 0x00, 0x13, 0x13, 
+	0x9f, 0xf1, 0xff, 0xff, 0x13, 0xa7, 0x13, 0xef, 0x23, 0x00, 0xa0, 0x03, 0xff, 0xe0, 0x00, 0x06, 
+	0x14, 0x1b, 0x14, 0x33, 0xf8, 0x13, 0xef, 0x14, 0x23, 0x54, 0x17, 0x14, 0x3b, 0x14, 0x0b, 0x8c, 
+	0xc5, 0x03, 0x34, 0x02, 0xb9, 0x00, 0x1b, 0x14, 0x27, 0xb8, 0x00, 0x03, 0xf7, 0x79, 0x20, 0x22, 
+	0x61, 0x17, 0xcb, 0x00, 0xff, 0x00, 0x06, 0x55, 0x80, 0x01, 0x25, 0xe7, 0xe6, 0x01, 0x22, 0x02, 
+	0x4b, 0xe3, 0x42, 0xe6, 0x12, 0xe9, 0x65, 0xe4, 0x5f, 0xe4, 0x10, 0x47, 0x10, 0x00, 0xb5, 0x09, 
+	0x4b, 0x09, 0x4a, 0x1b, 0x68, 0x09, 0x80, 0x06, 0x41, 0x58, 0x18, 0x52, 0x07, 0x01, 0xd4, 0x10, 
+	0x20, 0x3b, 0x18, 0x05, 0x89, 0x06, 0x4b, 0x99, 0x70, 0xff, 0x16, 0xf7, 0x11, 0xfc, 0x59, 0x93, 
+	0x40, 0x00, 0x5f, 0x14, 0x27, 0xf0, 0xc0, 0x00, 0xb7, 0x10, 0x83, 0xf7, 0xb5, 0x0c, 0x00, 0x15, 
+	0x00, 0x00, 0x01, 0x90, 0x4b, 0x07, 0x01, 0xd5, 0x08, 0x23, 0x00, 0x1c, 0x43, 0x74, 0x4f, 0x75, 
+	0x4e, 0x01, 0x2d, 0x10, 0x0b, 0xd1, 0x74, 0x01, 0x87, 0x2b, 0x42, 0x07, 0xd0, 0x00, 0x01, 0x9b, 
+	0x34, 0x60, 0x3b, 0x60, 0x03, 0xf0, 0x30, 0x73, 0xf9, 0x3d, 0x8d, 0x02, 0x3b, 0xfc, 0x6e, 0x4b, 
+	0x1b, 0x40, 0x7a, 0x32, 0x83, 0xd8, 0xfc, 0x01, 0x9b, 0x3b, 0x60, 0x18, 0x00, 0x23, 0x6b, 0x02, 
+	0xcf, 0x10, 0x03, 0xff, 0x22, 0x6a, 0x00, 0x4b, 0x01, 0x98, 0x34, 0x60, 0x1a, 0x70, 0x01, 0x00, 
+	0xf0, 0xfa, 0xfb, 0x03, 0x00, 0x0e, 0x22, 0x30, 0x00, 0x33, 0x99, 0x79, 0x01, 0x93, 0x07, 0x33, 
+	0x1b, 0x00, 0x78, 0x1a, 0x40, 0x04, 0x00, 0x50, 0x42, 0x42, 0x00, 0x41, 0x52, 0x42, 0x13, 0x40, 
+	0x0f, 0x20, 0x1e, 0x00, 0x00, 0x0a, 0x09, 0x86, 0x43, 0x92, 0x19, 0x5f, 0x00, 0x4f, 0x60, 0x4e, 
+	0x01, 0x40, 0x1b, 0x01, 0xcb, 0x02, 0x18, 0x3a, 0x70, 0x33, 0x70, 0x03, 0x0c, 0x7b, 0x00, 0x00, 
+	0x28, 0x03, 0xd1, 0x02, 0x22, 0x33, 0x78, 0x93, 0x00, 0x43, 0x33, 0x70, 0x18, 0x23, 0x30, 0x78, 
+	0x03, 0x41, 0x40, 0x17, 0xf7, 0x57, 0x49, 0x3a, 0x78, 0x0b, 0x03, 0x71, 0x00, 0x05, 0x2a, 0x22, 
+	0xd0, 0x00, 0x23, 0x09, 0x2a, 0x10, 0x1f, 0xd0, 0x63, 0x00, 0x03, 0x23, 0x00, 0x52, 0x4f, 0x04, 
+	0x40, 0x33, 0x3b, 0x60, 0x33, 0x06, 0xa5, 0x03, 0xd5, 0x00, 0x90, 0x23, 0x9b, 0x00, 0xe3, 0x18, 
+	0x3b, 0x60, 0x14, 0x23, 0x00, 0x34, 0x00, 0x6f, 0x4d, 0x03, 0x97, 0x4d, 0x49, 0x00, 0x9b, 0x03, 
+	0x58, 0x1e, 0x35, 0x34, 0x08, 0x60, 0x00, 0x21, 0x78, 0x4b, 0x48, 0x01, 0x70, 0x00, 0x29, 0x00, 
+	0x24, 0xd1, 0x4a, 0x4b, 0x4a, 0x49, 0x19, 0x60, 0x00, 0x0e, 0xe0, 0x0b, 0x70, 0xdf, 0xe7, 0x10, 
+	0x23, 0x00, 0x18, 0x43, 0x30, 0x70, 0xdb, 0xe7, 0x40, 0x00, 0x00, 0x88, 0x42, 0xfc, 0xdb, 0x39, 
+	0x68, 0xcb, 0x18, 0x00, 0x42, 0x49, 0x0b, 0x60, 0x40, 0x4b, 0x18, 0x70, 0x40, 0x3f, 0x14, 0x49, 
+	0x20, 0x41, 0x49, 0x00, 0x2b, 0x53, 0x80, 0x0f, 0x5f, 0x08, 0x70, 0x3f, 0x48, 0x04, 0x70, 0x5b, 
+	0x00, 0x03, 0x77, 0x2a, 0x06, 0xd1, 0x5b, 0x00, 0x01, 0x20, 0x24, 0x3c, 0x00, 0x0d, 0x03, 0xe0, 
+	0x01, 0x20, 0xe3, 0x00, 0xe7, 0x4a, 0x2a, 0xf7, 0xd0, 0x55, 0x2a, 0x01, 0x00, 0xd0, 0xa3, 0x2a, 
+	0x01, 0xd1, 0x01, 0x22, 0x0a, 0x01, 0x70, 0x36, 0x4a, 0x01, 0x3b, 0x13, 0x60, 0x18, 0x2b, 0x10, 
+	0x12, 0x01, 0x34, 0x02, 0xfb, 0x5b, 0xfc, 0x80, 0x22, 0x28, 0x33, 0x4c, 0x18, 0x8b, 0x20, 0x02, 
+	0x91, 0x54, 0xfc, 0x20, 0xa5, 0x00, 0x19, 0x30, 0x00, 0x17, 0x4f, 0xfc, 0x10, 0xb3, 0x07, 0x07, 
+	0x59, 0x00, 0x39, 0x68, 0x2d, 0x4b, 0x2e, 0x48, 0xc9, 0x18, 0x50, 0x92, 0x00, 0x1f, 0xfc, 0x00, 
+	0x15, 0x9b, 0x07, 0x05, 0xd4, 0x00, 0x7c, 0x22, 0x2a, 0x4b, 0xe2, 0x54, 0x2a, 0x4b, 0x01, 0x01, 
+	0x32, 0xe2, 0x54, 0x01, 0x2d, 0x01, 0x0d, 0x09, 0x24, 0xc3, 0xff, 0x3e, 0x61, 0xbf, 0xfa, 0x30, 
+	0x0f, 0xdf, 0xfe, 0x10, 0x01, 0x21, 0x01, 0x04, 0x13, 0x24, 0xfb, 0x02, 0xf0, 0x00, 0x0d, 0xf8, 
+	0x0b, 0xf0, 0xa1, 0xfc, 0x2e, 0xe7, 0x01, 0x16, 0x4c, 0x20, 0x70, 0xff, 0x24, 0x1e, 0x00, 0x9b, 
+	0x04, 0x1e, 0x48, 0x0b, 0x70, 0x03, 0x07, 0x2b, 0x9b, 0x01, 0x55, 0xa5, 0x0c, 0x93, 0x44, 0x01, 
+	0xef, 0x48, 0x00, 0x03, 0xbb, 0x1e, 0x27, 0xab, 0x00, 0x03, 0x3a, 0x02, 0x8f, 0x3b, 0x00, 0x03, 
+	0xff, 0x02, 0x37, 0x12, 0x73, 0xf5, 0x12, 0x0f, 0x2a, 0xef, 0x00, 0x03, 0x12, 0x9b, 0x50, 0x46, 
+	0xbb, 0x54, 0x12, 0x8b, 0xec, 0x02, 0xb7, 0x12, 0x5f, 0x12, 0x8b, 0x58, 0x12, 0xab, 0x0f, 0xdf, 
+	0x00, 0x08, 0x14, 0x00, 0x03, 0xdc, 0x00, 0x0f, 0x00, 0x0a, 0x6b, 0x00, 0x18, 0x00, 0x00, 0x03, 
+	0x7d, 0x1c, 0x00, 0x00, 0x7d, 0x1d, 0x30, 0x00, 0x00, 0x12, 0xab, 0x12, 0xb7, 0x70, 0xb5, 0x80, 
+	0x24, 0x04, 0x80, 0x23, 0x01, 0x00, 0x96, 0x09, 0x85, 0xe4, 0x04, 0x00, 0x23, 0x80, 0x52, 0x02, 
+	0xc0, 0x04, 0x0b, 0xf0, 0x40, 0x8e, 0x04, 0xbd, 0xcc, 0xfb, 0x15, 0x4b, 0x23, 0x80, 0x00, 0x10, 
+	0x24, 0x20, 0x00, 0x01, 0xf0, 0xb6, 0xfa, 0x00, 0x0b, 0xf0, 0xc4, 0xfb, 0x01, 0x3c, 0xf8, 0xd2, 
+	0x00, 0x96, 0x24, 0x01, 0x25, 0x03, 0x26, 0x0b, 0xf0, 0x10, 0xbd, 0xfb, 0x0f, 0x0e, 0x0d, 0x0f, 
+	0x4b, 0x9a, 0x42, 0x00, 0x02, 0xd1, 0x0e, 0x4b, 0x1d, 0x70, 0x5e, 0x70, 0x01, 0x01, 0x3c, 0x00, 
+	0x2c, 0xf2, 0xd1, 0xc0, 0x00, 0x47, 0x60, 0x21, 0x03, 0xdf, 0x10, 0x45, 0xb3, 0xfb, 0x01, 0xf0, 
+	0x83, 0x02, 0xfa, 0x01, 0xf0, 0x6d, 0xf9, 0x07, 0x0e, 0xe1, 0x01, 0x16, 0xf0, 0x2f, 0xf9, 0x3b, 
+	0x6b, 0x03, 0x0c, 0x0c, 0x1d, 0x53, 0x0f, 0xb0, 0x00, 0xa1, 0x3c, 0x00, 0xe3, 0x1d, 0x87, 0xf8, 
+	0xb5, 0x0e, 0x00, 0x44, 0x05, 0x01, 0x55, 0x3f, 0xfb, 0x04, 0x04, 0x75, 0x0b, 0xf0, 0x00, 0x3b, 
+	0xfb, 0x2a, 0x00, 0x01, 0x00, 0x24, 0x1a, 0x00, 0x50, 0x1b, 0x84, 0x42, 0x0e, 0xdc, 0x00, 0x20, 
+	0x40, 0xf8, 0x2b, 0xe9, 0xd7, 0x5c, 0xbc, 0x46, 0xf7, 0x5c, 0x00, 0xbc, 0x45, 0x03, 0xd1, 0x01, 
+	0x33, 0x8b, 0x42, 0x00, 0xf7, 0xdb, 0xf3, 0xd0, 0x01, 0x32, 0xed, 0xe7, 0x00, 0x00, 0x23, 0xf8, 
+	0xe7, 0x01, 0x23, 0xa2, 0x4a, 0x00, 0xf0, 0xb5, 0x13, 0x80, 0x03, 0x22, 0x00, 0x25, 0x04, 0xa0, 
+	0x4c, 0xa3, 0x70, 0xa0, 0x05, 0x6d, 0xa0, 0x4b, 0x01, 0x63, 0x60, 0xa0, 0x4b, 0x89, 0xb0, 0x1d, 
+	0x03, 0x55, 0x00, 0x28, 0xf9, 0x9f, 0x49, 0x10, 0x20, 0xff, 0xf7, 0x04, 0x3f, 0xf9, 0x9e, 0x49, 
+	0x20, 0x00, 0x07, 0x3b, 0xf9, 0x10, 0x9d, 0x49, 0x40, 0x00, 0x07, 0x37, 0xf9, 0x9c, 0x49, 0x41, 
+	0x80, 0x00, 0x07, 0x33, 0xf9, 0x9b, 0x49, 0x04, 0x00, 0x07, 0x04, 0x2f, 0xf9, 0x9a, 0x49, 0x02, 
+	0x00, 0x07, 0x2b, 0xf9, 0x00, 0x99, 0x48, 0xff, 0xf7, 0x4e, 0xf9, 0x30, 0x21, 0x00, 0x98, 0x4a, 
+	0x13, 0x88, 0x8b, 0x43, 0x13, 0x80, 0x01, 0x06, 0x23, 0x96, 0x4a, 0x11, 0x88, 0x0b, 0x00, 0x09, 
+	0xa0, 0x3b, 0xe9, 0x80, 0x09, 0x47, 0x1d, 0x80, 0xa0, 0x25, 0xff, 0x00, 0x22, 0x00, 0x26, 0x91, 
+	0x4b, 0xed, 0x04, 0x2b, 0x00, 0x80, 0x90, 0x4b, 0x1a, 0x80, 0x90, 0x4a, 0x33, 0x00, 0x04, 0x1b, 
+	0x0c, 0x13, 0x80, 0x01, 0x36, 0x0b, 0x02, 0xf0, 0x2b, 0xfb, 0x11, 0x2e, 0xf6, 0x0a, 0x6f, 0x00, 
+	0x44, 0x21, 0x11, 0x15, 0xdb, 0x04, 0x29, 0x01, 0x5d, 0x19, 0x80, 0x80, 0x11, 0x19, 0x26, 0xfb, 
+	0xf8, 0x22, 0x87, 0x4e, 0x33, 0x00, 0x68, 0x5b, 0x0e, 0x12, 0x06, 0x5b, 0x06, 0x9b, 0x01, 0x18, 
+	0x5a, 0x42, 0x53, 0x41, 0x23, 0x72, 0x02, 0x73, 0x20, 0xfb, 0x60, 0x03, 0x8d, 0xd5, 0xf8, 0x01, 
+	0xf0, 0xdf, 0x00, 0xf8, 0x80, 0x23, 0x7f, 0x4a, 0x5b, 0x00, 0x13, 0xa1, 0x01, 0x37, 0x93, 0x0a, 
+	0xf7, 0x01, 0x25, 0x7d, 0x4b, 0x1f, 0xf7, 0x00, 0x0b, 0xf0, 0x86, 0xfb, 0x7b, 0x4b, 0x7c, 0x4a, 
+	0x08, 0x1d, 0x70, 0xe3, 0x68, 0x12, 0xbb, 0x52, 0x02, 0x99, 0x00, 0x18, 0x79, 0x4a, 0x11, 0x60, 
+	0xc0, 0x22, 0x92, 0x00, 0x02, 0x9b, 0x18, 0x27, 0x7a, 0x77, 0x4a, 0x07, 0x08, 0x96, 0x13, 0x60, 
+	0x00, 0x07, 0x9d, 0xb2, 0xe0, 0x75, 0x80, 0x09, 0xef, 0x01, 0x33, 0x00, 0x2a, 0xfb, 0xd1, 0x1d, 
+	0x88, 0x0e, 0xa5, 0x5a, 0x1e, 0x12, 0x09, 0xfb, 0xf9, 0xd1, 0x01, 0x04, 0x3d, 0x2b, 0x78, 0x2f, 
+	0x2b, 0x0e, 0x73, 0x2b, 0xf9, 0x48, 0xd1, 0x01, 0xdb, 0x35, 0x20, 0x07, 0xf9, 0x10, 0x30, 0x0b, 
+	0x00, 0xf0, 0x10, 0xf9, 0x28, 0x00, 0x6a, 0x49, 0xff, 0x00, 0xf7, 0x3a, 0xff, 0x69, 0x4f, 0x3e, 
+	0x68, 0x00, 0x02, 0x28, 0x05, 0xd1, 0x28, 0x00, 0x68, 0x00, 0x0f, 0x32, 0x00, 0xff, 0x00, 0x28, 
+	0x41, 0xd0, 0x04, 0x23, 0x1e, 0x00, 0x43, 0x01, 0x22, 0x07, 0x9b, 0x1b, 0x68, 0x30, 0x00, 0x3b, 
+	0x23, 0x63, 0x63, 0x4b, 0x3e, 0x60, 0x1a, 0x00, 0x60, 0x03, 0x22, 0x62, 0x48, 0x62, 0x4b, 0x1b, 
+	0x00, 0x1a, 0x01, 0x3b, 0x1a, 0x43, 0x61, 0x49, 0x01, 0x00, 0x32, 0x0b, 0xf0, 0x72, 0xfb, 0x63, 
+	0x6b, 0x00, 0x20, 0x2b, 0x0e, 0x00, 0xf3, 0x21, 0x6b, 0x1b, 0x05, 0x99, 0x00, 0x42, 0x09, 0xd2, 
+	0xe0, 0x68, 0x81, 0x42, 0x06, 0x01, 0xd9, 0x81, 0x22, 0x92, 0x04, 0x52, 0x1a, 0x10, 0xdf, 0x00, 
+	0xe3, 0x68, 0x23, 0x63, 0x0b, 0xf0, 0xbe, 0xfa, 0x01, 0xff, 0xf7, 0x5e, 0xf9, 0x55, 0x49, 0x01, 
+	0x01, 0x69, 0x00, 0x76, 0xf8, 0x04, 0x22, 0x02, 0x21, 0x13, 0x00, 0x00, 0x05, 0x92, 0x04, 0x92, 
+	0x03, 0x92, 0x02, 0x92, 0x00, 0x01, 0x92, 0x00, 0x92, 0x50, 0x48, 0x00, 0xf0, 0x04, 0xdc, 0xf9, 
+	0x02, 0xf0, 0x70, 0x02, 0x41, 0x38, 0xfa, 0x40, 0x09, 0x47, 0x35, 0x04, 0x23, 0x9e, 0x43, 0xbc, 
+	0xe7, 0x00, 0x96, 0x23, 0x26, 0x6b, 0x5b, 0x02, 0xf3, 0x18, 0x00, 0x23, 0x63, 0x07, 0x95, 0x20, 
+	0x6b, 0x01, 0xf0, 0x08, 0x84, 0xf9, 0x00, 0x25, 0x04, 0x87, 0xd0, 0x44, 0x4b, 0x00, 0x02, 0x6b, 
+	0x9a, 0x42, 0x28, 0xd0, 0x3c, 0x4f, 0x00, 0x3d, 0x60, 0x00, 0x2d, 0x2b, 0xd1, 0x01, 0xf0, 0x11, 
+	0x45, 0xf9, 0x03, 0x0a, 0x31, 0x92, 0xf8, 0x2d, 0x08, 0xff, 0x04, 0x00, 0xf0, 0xf0, 0xff, 0x2a, 
+	0x06, 0xd9, 0x3b, 0x49, 0x09, 0x01, 0xf0, 0xc5, 0xf8, 0x02, 0x5b, 0x20, 0x3a, 0x00, 0x09, 0x45, 
+	0xc0, 0x00, 0x09, 0x02, 0x20, 0x38, 0x00, 0x09, 0xbb, 0x00, 0x09, 0x14, 0x03, 0x20, 0x37, 0x00, 
+	0x09, 0xb6, 0x00, 0x09, 0x04, 0x20, 0x50, 0x35, 0x00, 0x09, 0xb1, 0x03, 0xab, 0x49, 0xfa, 0xfc, 
+	0xe7, 0x00, 0x03, 0x6a, 0x30, 0x33, 0xc0, 0x18, 0x01, 0xf0, 0x01, 0x4f, 0xf9, 0x01, 0x35, 0xc9, 
+	0xe7, 0x07, 0x18, 0xdb, 0x20, 0xd0, 0x30, 0x03, 0xdf, 0x61, 0xfe, 0x3d, 0x60, 0x7c, 0x00, 0xe7, 
+	0x20, 0x6b, 0x30, 0x30, 0x01, 0xf0, 0x41, 0x80, 0x05, 0x0b, 0xb1, 0xd0, 0x3e, 0x00, 0x07, 0x97, 
+	0xb4, 0x05, 0xe7, 0xc8, 0x00, 0x00, 0x08, 0x12, 0xd7, 0x49, 0x4a, 0x33, 0x80, 0x16, 0x0f, 0x7c, 
+	0x37, 0x00, 0x06, 0x70, 0x38, 0x00, 0x20, 0x06, 0x90, 0x00, 0x03, 0xb0, 0x6a, 0x00, 0x08, 0x08, 
+	0x09, 0x34, 0x00, 0x06, 0x7c, 0x00, 0x03, 0xf1, 0x10, 0x1f, 0x18, 0x82, 0x3f, 0x1b, 0xff, 0x7f, 
+	0x00, 0x00, 0x50, 0x00, 0x0b, 0x54, 0x8a, 0x00, 0x03, 0xfc, 0xfb, 0x03, 0x23, 0x17, 0x0c, 0x00, 
+	0x0b, 0x52, 0xaa, 0x0a, 0x93, 0xa4, 0x00, 0x0b, 0xb0, 0x00, 0x03, 0xa8, 0x00, 0x03, 0x08, 0x01, 
+	0xfc, 0x03, 0x02, 0x53, 0xe4, 0x00, 0x08, 0x14, 0x27, 0x50, 0x57, 0x00, 0x07, 0x90, 0x1e, 0x8f, 
+	0x30, 0x00, 0x06, 0x88, 0x00, 0x3f, 0x00, 0x06, 0xe8, 0x36, 0x01, 0x08, 0x40, 0x60, 0x54, 0x03, 
+	0xd7, 0x00, 0x57, 0x4e, 0x45, 0x53, 0x1a, 0x5b, 0xaa, 0x00, 0x1f, 0x6a, 0x00, 0x03, 0x83, 0x00, 
+	0x03, 0x9f, 0x00, 0x03, 0xb7, 0x90, 0x00, 0x03, 0x70, 0x47, 0x1f, 0x19, 0x48, 0x1e, 0x40, 0x19, 
+	0x40, 0x0c, 0x03, 0x69, 0x6a, 0xfa, 0x60, 0x43, 0x40, 0x1b, 0x40, 0x70, 0x23, 0x5f, 0x43, 0x1e, 
+	0x98, 0x41, 0x70, 0x47, 0x03, 0x00, 0x48, 0x70, 0x47, 0xe8, 0xdd, 0x04, 0x39, 0x00, 0x07, 0xdb, 
+	0x10, 0x47, 0x10, 0x07, 0xd2, 0x00, 0x37, 0x10, 0x07, 0xd7, 0x40, 0x07, 0x90, 0x0f, 0x00, 0xf0, 
+	0xb5, 0x05, 0x04, 0x04, 0x0c, 0x0e, 0x00, 0x40, 0x17, 0x01, 0x55, 0x91, 0xb0, 0x2d, 0x0c, 0x00, 
+	0x29, 0x00, 0x04, 0xd0, 0x00, 0x2f, 0x06, 0xd1, 0x24, 0x04, 0x06, 0x20, 0x00, 0x28, 0x43, 0x11, 
+	0x01, 0xbd, 0x10, 0x5b, 0x48, 0x00, 0x4b, 0x9f, 0x42, 0x7f, 0xd9, 0x47, 0x4b, 0x48, 0x00, 0x48, 
+	0xff, 0x18, 0x32, 0x00, 0x33, 0x18, 0x0f, 0x00, 0x93, 0x13, 0x78, 0x5b, 0x19, 0x00, 0x93, 0x00, 
+	0x04, 0x99, 0x53, 0x78, 0x5b, 0x18, 0x09, 0xfb, 0x99, 0x93, 0x82, 0x00, 0x07, 0x02, 0x93, 0x02, 
+	0x99, 0xd3, 0x00, 0x07, 0x03, 0x00, 0x93, 0x03, 0x99, 0x13, 0x79, 0x5b, 0x18, 0x04, 0x08, 0x93, 
+	0x04, 0x99, 0x53, 0x00, 0x07, 0x05, 0x93, 0x05, 0x20, 0x99, 0x93, 0x00, 0x07, 0x06, 0x93, 0x06, 
+	0x99, 0xd3, 0x80, 0x00, 0x07, 0x07, 0x93, 0x07, 0x99, 0x13, 0x7a, 0x5b, 0x02, 0x18, 0x08, 0x93, 
+	0x08, 0x99, 0x53, 0x00, 0x07, 0x09, 0x08, 0x93, 0x09, 0x99, 0x93, 0x00, 0x07, 0x0a, 0x93, 0xd3, 
+	0x00, 0x7a, 0x0a, 0x99, 0x5b, 0x18, 0x0b, 0x93, 0x0b, 0x00, 0x99, 0x13, 0x7b, 0x5b, 0x18, 0x0c, 
+	0x93, 0x0c, 0x00, 0x99, 0x8c, 0x46, 0x53, 0x7b, 0x9c, 0x44, 0x63, 0x00, 0x46, 0x91, 0x7b, 0xd5, 
+	0x7b, 0x0d, 0x93, 0xcb, 0x00, 0x18, 0x0e, 0x93, 0xed, 0x18, 0x00, 0x9b, 0x19, 0x80, 0x0c, 0x6d, 
+	0x9c, 0x46, 0x61, 0x44, 0x0b, 0x00, 0x02, 0xaa, 0x00, 0x2f, 0x03, 0x00, 0x03, 0x04, 0x00, 0x03, 
+	0x05, 0x00, 0x03, 0x06, 0xab, 0x00, 0x03, 0x07, 0x00, 0x03, 0x08, 0x00, 0x03, 0x09, 0x00, 0x03, 
+	0x20, 0x4f, 0xa8, 0x00, 0x03, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x03, 0x0e, 0x99, 0x59, 0x00, 0x18, 
+	0x0f, 0x9b, 0x49, 0x19, 0x10, 0x32, 0x64, 0x01, 0x18, 0x9b, 0x1a, 0x0f, 0x2b, 0x9a, 0xdc, 0x08, 
+	0x5c, 0x00, 0x3a, 0x13, 0x09, 0x59, 0x1c, 0x09, 0x01, 0x1b, 0x00, 0x01, 0x76, 0x18, 0xd0, 0x1a, 
+	0x9a, 0x42, 0x0f, 0x80, 0x03, 0x3d, 0x0e, 0x49, 0x0b, 0xf0, 0x9f, 0xf9, 0x20, 0x08, 0x00, 0x0d, 
+	0x00, 0x0c, 0x00, 0x09, 0x9a, 0xf9, 0x0c, 0x00, 0x00, 0x73, 0xe7, 0x38, 0x00, 0x00, 0x27, 0x0f, 
+	0x80, 0x0c, 0xb9, 0x7d, 0xe7, 0x30, 0x18, 0x33, 0x78, 0x01, 0x00, 0x36, 0xed, 0x18, 0x64, 0x19, 
+	0xb0, 0x42, 0xf9, 0x01, 0xd1, 0x06, 0x00, 0xe6, 0xe7, 0xaf, 0x15, 0x01, 0xff, 0x08, 0xea, 0xff, 
+	0xff, 0xb0, 0x00, 0x07, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x10, 0xb5, 0x0a, 0xf0, 0x1f, 0xff, 0x10, 
+	0xd5, 0x21, 0x3d, 0x10, 0x0b, 0x3f, 0x80, 0x0b, 0x8d, 0x80, 0x0b, 0xdf, 0x40, 0x0b, 0x00, 0x03, 
+	0x22, 0x20, 0x4b, 0x52, 0x42, 0x30, 0xb5, 0x05, 0x1a, 0x60, 0x01, 0x32, 0x5a, 0x00, 0x03, 0x9a, 
+	0x07, 0xed, 0x00, 0x91, 0xb0, 0x01, 0xaa, 0x9b, 0x54, 0x01, 0x33, 0x00, 0x10, 0x2b, 0xfb, 0xd1, 
+	0x00, 0x24, 0x00, 0x94, 0x00, 0x03, 0x2c, 0x05, 0xd9, 0x00, 0x20, 0x01, 0x38, 0x10, 0x11, 0xb0, 
+	0x30, 0x20, 0x33, 0x05, 0xab, 0x1c, 0x19, 0x00, 0x22, 0x00, 0x0f, 0xab, 0x10, 0xc2, 0x9a, 0x42, 
+	0x02, 0xfc, 0xd1, 0x20, 0x1d, 0x05, 0x00, 0x16, 0xf5, 0x0a, 0x00, 0xf0, 0xb5, 0xff, 0x23, 0x68, 
+	0x21, 0x00, 0x1b, 0x00, 0x1b, 0x5a, 0x42, 0x5a, 0x41, 0x28, 0x00, 0x24, 0x00, 0x31, 0x08, 0xc8, 
+	0x5d, 0x42, 0x6b, 0x41, 0x1a, 0x20, 0x40, 0x88, 0x00, 0xab, 0x63, 0x6a, 0x1c, 0x1b, 0x63, 0x01, 
+	0x42, 0x5c, 0x41, 0x22, 0x42, 0xd9, 0xd0, 0x0e, 0xee, 0x40, 0x98, 0x17, 0xf3, 0x42, 0x1e, 0x90, 
+	0x41, 0x18, 0x40, 0x10, 0xd2, 0xe7, 0x74, 0x02, 0xab, 0xf8, 0xb5, 0x01, 0x24, 0x00, 0x1c, 0x4f, 
+	0x06, 0x9e, 0x07, 0x9d, 0xfc, 0x60, 0x00, 0x00, 0x28, 0x30, 0xd0, 0x48, 0x1c, 0x01, 0xd0, 0x04, 
+	0x02, 0x29, 0x2c, 0xd1, 0x51, 0x00, 0x07, 0x04, 0x2a, 0x10, 0x28, 0xd1, 0x5a, 0x10, 0x07, 0x2b, 
+	0x24, 0xd1, 0x73, 0x84, 0x10, 0x07, 0x2e, 0x20, 0xd1, 0x6b, 0x10, 0x07, 0x2d, 0x1c, 0x00, 0xd1, 
+	0x08, 0x9b, 0x01, 0x33, 0x02, 0xd0, 0x08, 0x02, 0x9b, 0x04, 0x2b, 0x16, 0xd1, 0x09, 0x20, 0x0b, 
+	0x09, 0x8a, 0x00, 0x0b, 0x10, 0xd1, 0x0a, 0x20, 0x0b, 0x0a, 0x00, 0x0b, 0x0a, 0x28, 0xd1, 0x0b, 
+	0x20, 0x0b, 0x0b, 0x00, 0x0b, 0x04, 0xd1, 0xff, 0x10, 0xf7, 0x86, 0xff, 0x36, 0x17, 0x01, 0x20, 
+	0x40, 0x42, 0x40, 0xf9, 0x20, 0x7b, 0xf0, 0xb5, 0x8b, 0xb0, 0x01, 0x90, 0x00, 0x03, 0x91, 0x02, 
+	0x92, 0x09, 0x93, 0x0d, 0x29, 0x00, 0x00, 0xd8, 0x48, 0xe1, 0x03, 0x00, 0x8c, 0x46, 0x00, 0x63, 
+	0x44, 0x04, 0x93, 0x0b, 0x00, 0x0d, 0x3b, 0x60, 0xc3, 0x02, 0x47, 0x06, 0x74, 0x90, 0x02, 0x9a, 
+	0x04, 0x33, 0x00, 0xd9, 0x78, 0x8c, 0x46, 0x99, 0x78, 0x06, 0x91, 0x00, 0x59, 0x78, 0x07, 0x91, 
+	0x19, 0x78, 0x08, 0x91, 0x00, 0x61, 0x46, 0x88, 0x01, 0x06, 0x99, 0x48, 0x40, 0x01, 0x07, 0x99, 
+	0x40, 0x01, 0x48, 0x40, 0x08, 0x20, 0x05, 0x00, 0x21, 0x21, 0x41, 0x43, 0x48, 0x09, 0x10, 0x9d, 
+	0x00, 0x81, 0x04, 0x8c, 0x0c, 0x09, 0x0c, 0x49, 0x59, 0x00, 0x01, 0x9d, 0xa9, 0x42, 0x00, 0xd2, 
+	0x94, 0xe0, 0x00, 0x5d, 0x1a, 0x9b, 0x4e, 0x6f, 0x1e, 0xb7, 0x42, 0x00, 0x00, 0xd9, 0x8e, 0xe0, 
+	0x80, 0x27, 0x3f, 0x01, 0x00, 0xbd, 0x42, 0x1a, 0xd9, 0xcf, 0x78, 0x67, 0x45, 0x00, 0x17, 0xd0, 
+	0x96, 0x4c, 0x40, 0x05, 0x40, 0x0d, 0x00, 0x44, 0x40, 0x10, 0x98, 0xa1, 0x00, 0x09, 0x58, 0x14, 
+	0x01, 0x98, 0x88, 0x00, 0x23, 0x7c, 0x00, 0x2f, 0x68, 0x1e, 0x50, 0xb0, 0x00, 0x09, 0x77, 0x40, 
+	0x2d, 0x03, 0xd9, 0xc8, 0x78, 0x20, 0x60, 0x45, 0x0e, 0xe9, 0xe0, 0x08, 0x78, 0x08, 0x9e, 0x01, 
+	0xb0, 0x42, 0x6b, 0xd1, 0x48, 0x78, 0x07, 0x00, 0x07, 0x04, 0x67, 0xd1, 0x88, 0x78, 0x06, 0x00, 
+	0x07, 0x63, 0xd1, 0x00, 0x10, 0x98, 0xa4, 0x00, 0x23, 0x50, 0x00, 0x98, 0x00, 0x18, 0x1a, 0x00, 
+	0x28, 0x10, 0xdd, 0x03, 0x28, 0x00, 0x63, 0xdc, 0x96, 0x1e, 0x34, 0x78, 0x04, 0x43, 0x20, 0x34, 
+	0x70, 0x01, 0xc5, 0x9e, 0x36, 0x5d, 0x16, 0x55, 0x10, 0x01, 0x34, 0xa0, 0x01, 0x8b, 0x00, 0x9c, 
+	0x24, 0x18, 0x00, 0x00, 0x94, 0x12, 0x18, 0xcc, 0x78, 0xd8, 0x78, 0x00, 0x84, 0x42, 0x67, 0xd0, 
+	0x18, 0x1d, 0x80, 0x21, 0x00, 0x00, 0x9b, 0x01, 0x38, 0xc3, 0x1a, 0x1b, 0x06, 0x04, 0x1b, 0x0e, 
+	0x09, 0x01, 0x8d, 0x00, 0x75, 0x91, 0xe0, 0x00, 0x1c, 0x26, 0x69, 0x1e, 0x8c, 0x00, 0x01, 0x3b, 
+	0x00, 0x5b, 0x01, 0x34, 0x40, 0x1c, 0x43, 0xc9, 0x08, 0x00, 0x14, 0x70, 0x51, 0x70, 0x02, 0x32, 
+	0x05, 0x9b, 0x00, 0x83, 0x42, 0x2b, 0xd8, 0x02, 0x9b, 0x09, 0x99, 0x00, 0xd3, 0x1a, 0x0b, 0x60, 
+	0x04, 0x9b, 0x1b, 0x1a, 0x00, 0x00, 0x2b, 0x15, 0xd0, 0x03, 0x99, 0x02, 0x9c, 0x00, 0xc8, 0x1a, 
+	0x01, 0x99, 0x08, 0x18, 0x51, 0x1c, 0x00, 0xa2, 0x42, 0x00, 0xd0, 0xaa, 0xe0, 0xee, 0x2b, 0x00, 
+	0x00, 0xd9, 0xa7, 0xe0, 0x1a, 0x00, 0x11, 0x32, 0x00, 0x22, 0x70, 0x00, 0x22, 0x84, 0x5c, 0x8c, 
+	0x54, 0x00, 0x01, 0x32, 0x93, 0x42, 0xfa, 0xd1, 0xca, 0x18, 0x00, 0x11, 0x23, 0x00, 0x20, 0x13, 
+	0x70, 0x02, 0x9b, 0x00, 0x50, 0x70, 0x90, 0x70, 0x03, 0x32, 0xd2, 0x1a, 0x0c, 0x09, 0x9b, 0x1a, 
+	0x60, 0x1c, 0xe3, 0x11, 0x93, 0x00, 0x90, 0x00, 0x03, 0x00, 0x4c, 0xe7, 0x10, 0x99, 0xa4, 0x00, 
+	0x08, 0x63, 0x50, 0x58, 0x1c, 0x10, 0x6b, 0xf6, 0xd8, 0x00, 0x00, 0x98, 0xc7, 0xe7, 0x54, 0x1c, 
+	0x12, 0x28, 0x03, 0x00, 0xdc, 0xc6, 0x1e, 0x16, 0x70, 0x22, 0x00, 0x98, 0x42, 0xe7, 0x0b, 0x4c, 
+	0x27, 0x12, 0x3e, 0x17, 0x00, 0x0b, 0x01, 0x00, 0x32, 0xa4, 0x46, 0x14, 0x00, 0xff, 0x2e, 0x02, 
+	0x00, 0xd8, 0x64, 0x46, 0x26, 0x70, 0x8b, 0xe7, 0x62, 0x00, 0x46, 0xff, 0x3e, 0xf2, 0xe7, 0x0c, 
+	0x79, 0x18, 0x00, 0x79, 0x84, 0x42, 0x01, 0xd0, 0x58, 0x1d, 0x92, 0x08, 0xe7, 0x4c, 0x79, 0x58, 
+	0x20, 0x0b, 0x98, 0x1d, 0x8c, 0x08, 0xe7, 0x8c, 0x79, 0x98, 0x20, 0x0b, 0xd8, 0x1d, 0x86, 0x0c, 
+	0xe7, 0xcc, 0x79, 0xd8, 0x00, 0x0b, 0x02, 0x39, 0x33, 0x18, 0x00, 0x00, 0x7f, 0xe7, 0x18, 0x00, 
+	0x0c, 0x7a, 0x1b, 0x08, 0x7a, 0x09, 0x30, 0x9c, 0x00, 0xbb, 0x78, 0xe7, 0x09, 0x20, 0x31, 0x04, 
+	0x00, 0x79, 0x03, 0xd9, 0x0c, 0x78, 0x03, 0x04, 0x78, 0x9c, 0x42, 0x26, 0xd0, 0x11, 0x1d, 0x54, 
+	0x1c, 0x11, 0xc3, 0x1a, 0xc9, 0x01, 0x19, 0x2c, 0xd8, 0x20, 0x01, 0x17, 0x00, 0x21, 0x2b, 0x1e, 
+	0xd8, 0x02, 0x3b, 0x09, 0xe0, 0x09, 0x80, 0x21, 0x02, 0x3b, 0x11, 0x33, 0x54, 0x1c, 0x10, 0x1b, 
+	0x40, 0x09, 0x20, 0x1b, 0x33, 0x43, 0x13, 0x70, 0x8b, 0x00, 0x00, 0x89, 0x09, 0x23, 0x70, 0x61, 
+	0x70, 0xa2, 0x1c, 0x10, 0x66, 0xe7, 0x20, 0x0f, 0x71, 0x08, 0x25, 0xce, 0x0a, 0x00, 0x2e, 0x40, 
+	0x33, 0x43, 0x10, 0x26, 0xef, 0xe7, 0x00, 0x01, 0x31, 0x01, 0x30, 0xce, 0xe7, 0x21, 0x3b, 0x08, 
+	0x16, 0x70, 0x00, 0x26, 0x00, 0xc1, 0x34, 0xff, 0x2b, 0x00, 0xe6, 0xd9, 0x16, 0x70, 0xff, 0x3b, 
+	0xf8, 0xe7, 0x40, 0x15, 0x20, 0x29, 0xcf, 0x0a, 0x10, 0x26, 0x2f, 0x40, 0x40, 0x09, 0x0f, 0x2f, 
+	0x02, 0x3b, 0x3b, 0x43, 0xd7, 0xe7, 0x00, 0x09, 0x3b, 0x3e, 0x43, 0xe8, 0xe7, 0x03, 0x9b, 0x00, 
+	0x02, 0x9a, 0x49, 0xe7, 0x03, 0x2b, 0x05, 0xd8, 0x00, 0x94, 0x1e, 0x21, 0x78, 0x19, 0x43, 0x21, 
+	0x70, 0x00, 0x11, 0x00, 0x52, 0xe7, 0xdc, 0x1e, 0x12, 0x2b, 0x20, 0x07, 0xd9, 0x09, 0x9e, 0x25, 
+	0x12, 0x3c, 0x15, 0x70, 0x00, 0x0a, 0x00, 0x01, 0x31, 0xff, 0x2c, 0x01, 0xd8, 0x00, 0x14, 0x70, 
+	0x45, 0xe7, 0xff, 0x3c, 0xf6, 0xe7, 0x02, 0xfe, 0xbf, 0x00, 0x00, 0x1f, 0x20, 0x05, 0x8b, 0xc0, 
+	0x00, 0xff, 0xff, 0xf0, 0xb5, 0x85, 0xb0, 0x02, 0x93, 0x20, 0x00, 0x23, 0x02, 0xe5, 0x99, 0x0b, 
+	0x60, 0x01, 0x78, 0x00, 0x84, 0x46, 0x01, 0x92, 0x11, 0x29, 0x0e, 0xd9, 0x00, 0x11, 0x39, 0x45, 
+	0x1c, 0x03, 0x29, 0x00, 0xdc, 0x01, 0xc5, 0xe0, 0xe8, 0x5c, 0x01, 0x9a, 0xd0, 0x03, 0xf5, 0x40, 
+	0x99, 0x02, 0x21, 0x01, 0x9b, 0x6c, 0x18, 0x5b, 0x18, 0x10, 0x18, 0xe0, 0x05, 0x04, 0xef, 0x29, 
+	0x78, 0x6c, 0x1c, 0x00, 0x0f, 0x29, 0x16, 0xd8, 0x00, 0x29, 0x2f, 0xd0, 0x00, 0x20, 0x78, 0x18, 
+	0x70, 0x60, 0x78, 0x58, 0x70, 0x00, 0xa5, 0x78, 0x9d, 0x70, 0x03, 0x25, 0xe0, 0x1c, 0x00, 0xde, 
+	0x1c, 0xcf, 0x1c, 0x62, 0x5d, 0x5a, 0x55, 0x10, 0x01, 0x35, 0xaf, 0x01, 0xdb, 0x44, 0x18, 0x73, 
+	0x18, 0x00, 0x21, 0x78, 0x0f, 0x29, 0x22, 0xd9, 0x01, 0x34, 0x00, 0x26, 0x78, 0x3f, 0x29, 0x40, 
+	0xd9, 0xc8, 0x06, 0x00, 0x40, 0x0f, 0xc0, 0x43, 0xf6, 0x00, 0x80, 0x1b, 0x00, 0x49, 0x09, 0x65, 
+	0x1c, 0x18, 0x18, 0x4e, 0x1e, 0x00, 0x01, 0x78, 0x19, 0x70, 0x41, 0x78, 0x59, 0x70, 0x00, 0x02, 
+	0x21, 0x9c, 0x1c, 0xb7, 0x1c, 0x42, 0x5c, 0x04, 0x5a, 0x54, 0x01, 0x31, 0x8f, 0x00, 0x3b, 0xa3, 
+	0x19, 0x00, 0x16, 0xe0, 0xff, 0x31, 0x20, 0x78, 0x01, 0x34, 0x00, 0x00, 0x28, 0xfa, 0xd0, 0x0f, 
+	0x30, 0x09, 0x18, 0x00, 0xc8, 0xe7, 0x42, 0x48, 0x89, 0x08, 0x40, 0x1a, 0x00, 0x61, 0x78, 0x89, 
+	0x00, 0x41, 0x1a, 0x58, 0x18, 0x20, 0x59, 0x5c, 0x30, 0x39, 0x81, 0x78, 0xa5, 0x1c, 0x99, 0x06, 
+	0x70, 0x03, 0x33, 0xa9, 0x1e, 0x01, 0x9f, 0x0a, 0x37, 0x01, 0x00, 0x40, 0x04, 0x42, 0xac, 0xd0, 
+	0x00, 0x20, 0x2c, 0x00, 0x5c, 0x1c, 0x54, 0x04, 0x00, 0x01, 0x30, 0x81, 0x80, 0x00, 0xbf, 0x02, 
+	0x34, 0x5b, 0x18, 0x2c, 0x19, 0x69, 0x00, 0x5c, 0xbb, 0xe7, 0x1f, 0x29, 0x19, 0xd9, 0x1f, 0x00, 
+	0x20, 0x0e, 0x00, 0x06, 0x40, 0x01, 0x42, 0x0b, 0x00, 0xd1, 0xff, 0x27, 0x25, 0x02, 0x65, 0x1b, 
+	0x38, 0x01, 0x00, 0x60, 0x43, 0x26, 0x78, 0x40, 0x19, 0x00, 0x6b, 0x00, 0x2e, 0xf8, 0xd0, 0x1f, 
+	0x36, 0x36, 0x18, 0x20, 0x00, 0x78, 0x61, 0x78, 0x80, 0x08, 0x89, 0x01, 0x40, 0x08, 0x18, 0xc0, 
+	0x43, 0xa5, 0x00, 0xa7, 0xab, 0xe7, 0x0f, 0x00, 0x29, 0x30, 0xd9, 0x80, 0x20, 0xcd, 0x02, 0xc0, 
+	0x00, 0x01, 0x0e, 0x00, 0x28, 0x40, 0x07, 0x25, 0x2e, 0x20, 0x40, 0x29, 0x10, 0x3f, 0x21, 0x27, 
+	0x02, 0xe7, 0x1b, 0x14, 0x0d, 0x00, 0x65, 0x00, 0x3f, 0xed, 0x40, 0x3f, 0x07, 0x36, 0x00, 0x76, 
+	0x19, 0x21, 0x78, 0x65, 0x78, 0x89, 0x08, 0x00, 0xad, 0x01, 0x49, 0x19, 0x09, 0x18, 0x16, 0x4a, 
+	0x00, 0x59, 0x1a, 0xa5, 0x1c, 0x88, 0x18, 0x8b, 0x42, 0x00, 0x88, 0xd1, 0x03, 0x99, 0x62, 0x46, 
+	0x8c, 0x46, 0x11, 0x62, 0x44, 0x10, 0x0e, 0xd3, 0x9a, 0x1a, 0x02, 0x02, 0xe9, 0x01, 0xa8, 0x42, 
+	0x12, 0xd1, 0x00, 0x20, 0x05, 0x42, 0xef, 0x00, 0x89, 0x08, 0x65, 0x1c, 0xcc, 0x43, 0xb6, 0x00, 
+	0x00, 0xa4, 0x1b, 0x19, 0x5d, 0x19, 0x70, 0x18, 0x19, 0x90, 0x21, 0x19, 0x33, 0x91, 0x0f, 0x2d, 
+	0x96, 0xe7, 0x85, 0x42, 0x00, 0x80, 0x41, 0x03, 0x23, 0x98, 0x43, 0x04, 0x38, 0x58, 0xe7, 0x0b, 
+	0xe3, 0xff, 0x0e, 0x77, 0x31, 0xc7, 0x00, 0x25, 0x0e, 0x00, 0x00, 0x41, 0x18, 0x8c, 0x46, 0x19, 
+	0x68, 0x1d, 0x00, 0x60, 0x07, 0x78, 0x85, 0xb0, 0x54, 0x18, 0x01, 0x00, 0x94, 0x11, 0x2f, 0x00, 
+	0xd8, 0x1b, 0xe1, 0x3c, 0x00, 0x00, 0x11, 0x3c, 0x01, 0x30, 0x03, 0x2c, 0x00, 0x08, 0xdc, 0x13, 
+	0xe1, 0xa1, 0x04, 0x73, 0x23, 0xe1, 0x01, 0x08, 0x3e, 0x10, 0x3f, 0xbe, 0x00, 0x09, 0x1c, 0xe1, 
+	0x41, 0x28, 0x5d, 0x51, 0x01, 0xa5, 0xac, 0x01, 0x69, 0x06, 0x19, 0x11, 0x00, 0x19, 0x2e, 0xe0, 
+	0x07, 0x78, 0x46, 0x1c, 0x0f, 0x00, 0x2f, 0x2e, 0xd8, 0x00, 0x2f, 0x08, 0xd1, 0xb4, 0x02, 0x45, 
+	0x00, 0xd1, 0xb0, 0xe0, 0x30, 0x06, 0x59, 0x00, 0x20, 0x28, 0x4c, 0x01, 0x7b, 0x3f, 0x18, 0x01, 
+	0x98, 0xfc, 0x08, 0x1c, 0x40, 0x1a, 0xa0, 0x00, 0x39, 0x02, 0xe1, 0x60, 0x02, 0x46, 0x3d, 0x1d, 
+	0x80, 0x1b, 0xa8, 0x00, 0x0b, 0x9e, 0x80, 0x00, 0x23, 0x08, 0x70, 0x70, 0x78, 0x48, 0x70, 0xf0, 
+	0x00, 0x1c, 0x02, 0x90, 0xc8, 0x1c, 0x03, 0x90, 0xb0, 0x00, 0x78, 0x88, 0x70, 0x03, 0x20, 0x35, 
+	0x5c, 0x0d, 0x08, 0x54, 0x01, 0x30, 0x84, 0x00, 0x5b, 0x02, 0x99, 0xce, 0x00, 0x19, 0x03, 0x99, 
+	0xc9, 0x19, 0x37, 0x78, 0x0f, 0x00, 0x2f, 0x29, 0xd9, 0x01, 0x36, 0x3f, 0x2f, 0x5f, 0x00, 0xd9, 
+	0xfc, 0x06, 0x64, 0x0f, 0xe5, 0x43, 0x34, 0x00, 0x78, 0xe4, 0x00, 0x2c, 0x1b, 0x7f, 0x09, 0x0c, 
+	0x04, 0x19, 0x70, 0x1c, 0x7d, 0x1e, 0x04, 0x23, 0xd9, 0xd9, 0x01, 0xe0, 0x01, 0x9e, 0x01, 0x37, 
+	0x76, 0x1a, 0x10, 0x9f, 0x00, 0xcf, 0xe0, 0x26, 0x78, 0x0e, 0x70, 0x8e, 0x1c, 0x00, 0x02, 0x96, 
+	0x66, 0x78, 0x4e, 0x70, 0xae, 0x1c, 0x00, 0x03, 0x96, 0x02, 0x26, 0xa7, 0x5d, 0x8f, 0x55, 0x04, 
+	0x03, 0x9f, 0x01, 0x36, 0xb7, 0x11, 0xcf, 0x99, 0x49, 0x00, 0x19, 0x18, 0xe0, 0xff, 0x37, 0xa9, 
+	0xe7, 0x61, 0x00, 0x4c, 0xbf, 0x08, 0xe4, 0x1b, 0x77, 0x78, 0xbf, 0x00, 0x00, 0xe7, 0x1b, 0xcf, 
+	0x19, 0xb0, 0x1c, 0xba, 0x80, 0x00, 0x49, 0xb4, 0xe0, 0x01, 0x9c, 0x64, 0x1a, 0x02, 0x00, 0x2c, 
+	0x00, 0xd8, 0xab, 0xe0, 0x3c, 0x78, 0x0c, 0x00, 0x70, 0x7c, 0x78, 0x4c, 0x70, 0xbc, 0x78, 0x8c, 
+	0x00, 0x70, 0x03, 0x31, 0x84, 0x1e, 0x26, 0x78, 0x03, 0x00, 0x25, 0x34, 0x00, 0x2c, 0x40, 0x2e, 
+	0x42, 0x00, 0x00, 0xd1, 0x8b, 0xe0, 0x01, 0x9d, 0x6d, 0x1a, 0xa5, 0x80, 0x00, 0x6f, 0x97, 0xe0, 
+	0x65, 0x46, 0x66, 0x1c, 0x2d, 0x00, 0x1a, 0xb5, 0x42, 0x34, 0xd3, 0x00, 0x25, 0x46, 0x0a, 0x5d, 
+	0x4e, 0x55, 0x2e, 0x0a, 0xd5, 0xac, 0x10, 0x69, 0x36, 0x02, 0x86, 0x19, 0x05, 0x19, 0x09, 0x19, 
+	0x01, 0x13, 0xd8, 0x00, 0x76, 0xe0, 0x2f, 0x78, 0x9d, 0xe7, 0x1f, 0x2f, 0x40, 0x26, 0x02, 0x41, 
+	0x3d, 0x00, 0x05, 0x40, 0x07, 0x42, 0x00, 0x0d, 0xd1, 0x66, 0x45, 0x1b, 0xd0, 0xff, 0x27, 0x10, 
+	0x34, 0x02, 0x34, 0x02, 0x45, 0x70, 0x43, 0x35, 0x78, 0x20, 0x00, 0x19, 0x01, 0x35, 0x2d, 0x0f, 
+	0xd0, 0x1f, 0x35, 0x00, 0x2d, 0x18, 0x34, 0x78, 0x70, 0x78, 0xa4, 0x08, 0x00, 0x80, 0x01, 0x24, 
+	0x18, 0xe4, 0x43, 0xb0, 0x1c, 0x00, 0x0c, 0x19, 0x94, 0x42, 0x67, 0xd3, 0x01, 0x9e, 0x00, 0xaf, 
+	0x1c, 0x76, 0x1a, 0x8c, 0xe7, 0xb4, 0x45, 0x00, 0xe6, 0xd1, 0x89, 0x1a, 0x04, 0x20, 0x19, 0x60, 
+	0x0a, 0x4e, 0xe0, 0x0f, 0x2f, 0x12, 0x5b, 0xfc, 0x02, 0x5b, 0x04, 0x01, 0x40, 0x3d, 0x00, 0x07, 
+	0x20, 0x02, 0x94, 0x50, 0x5b, 0x42, 0xed, 0xf0, 0x5b, 0x2d, 0x17, 0xd0, 0x07, 0x00, 0x5b, 0x37, 
+	0xa0, 0x00, 0x5b, 0xbf, 0x00, 0x5b, 0x3f, 0x18, 0x02, 0x98, 0x21, 0x00, 0x4c, 0x3f, 0x18, 0xcf, 
+	0x1b, 0xb0, 0x1c, 0x3c, 0x08, 0x19, 0xb9, 0x42, 0xcc, 0x00, 0x55, 0x19, 0x60, 0x84, 0x20, 0x45, 
+	0x25, 0x82, 0x55, 0xb4, 0x45, 0xde, 0xd1, 0xc8, 0x02, 0xe7, 0xbf, 0x08, 0xfc, 0x43, 0x37, 0x41, 
+	0x27, 0x70, 0x90, 0x01, 0x27, 0x21, 0xd8, 0x11, 0x25, 0x01, 0x2c, 0x19, 0xd9, 0x80, 0x51, 0x23, 
+	0x02, 0x31, 0x6e, 0xe7, 0x11, 0x00, 0x74, 0xc1, 0x00, 0x03, 0x06, 0x57, 0xd2, 0xf5, 0xe6, 0x07, 
+	0x20, 0x10, 0x4b, 0x02, 0x40, 0x42, 0xda, 0xe7, 0x60, 0x45, 0x52, 0x7b, 0xd4, 0xa2, 0x00, 0x1d, 
+	0xa2, 0x00, 0x03, 0x89, 0x1a, 0x05, 0x00, 0xbb, 0xf0, 0x09, 0xe7, 0x89, 0x1a, 0x06, 0x00, 0x07, 
+	0xec, 0xe7, 0x72, 0x8f, 0x08, 0x8b, 0xb0, 0x08, 0x92, 0x0a, 0x88, 0x91, 0x41, 0x1a, 0x00, 0x0f, 
+	0x00, 0x0f, 0x26, 0x10, 0x32, 0x01, 0x90, 0x00, 0x02, 0x92, 0x93, 0x4d, 0x12, 0x3f, 0x02, 0x9b, 
+	0x02, 0x01, 0x9a, 0x93, 0x42, 0x08, 0xd9, 0x0b, 0x4f, 0x9b, 0x00, 0x1a, 0x78, 0xaa, 0x5c, 0x14, 
+	0x09, 0x04, 0x40, 0x10, 0x32, 0x40, 0x0f, 0x0f, 0x47, 0x00, 0x20, 0x90, 0xe0, 0x04, 0x04, 0x2a, 
+	0x1c, 0xd1, 0x01, 0x00, 0x19, 0x18, 0x56, 0x00, 0x02, 0x00, 0x12, 0x32, 0xf5, 0xdb, 0x82, 0x1c, 
+	0x00, 0x9a, 0x18, 0x43, 0x1c, 0x26, 0xdb, 0x10, 0x78, 0x00, 0x28, 0x5c, 0x30, 0x40, 0x05, 0x28, 
+	0x00, 0xd0, 0x00, 0x82, 0xe0, 0x53, 0x78, 0x9c, 0x46, 0x90, 0x78, 0x00, 0x00, 0x02, 0x60, 0x44, 
+	0x81, 0x42, 0x00, 0xda, 0x10, 0x7a, 0xe0, 0xb8, 0x00, 0x05, 0x77, 0xe0, 0x01, 0x92, 0x00, 0xd1, 
+	0xe7, 0x05, 0x2a, 0x00, 0xd0, 0x72, 0xe0, 0x00, 0x01, 0x9b, 0x9a, 0x78, 0x58, 0x78, 0x12, 0x02, 
+	0x00, 0x12, 0x18, 0x91, 0x42, 0xd4, 0xdb, 0x12, 0x39, 0x00, 0x8a, 0x42, 0xd1, 0xdb, 0x51, 0x13, 
+	0x75, 0x48, 0x40, 0x89, 0x07, 0x45, 0x8a, 0x18, 0x00, 0x2a, 0xca, 0xd0, 0x10, 0x00, 0x25, 0x2c, 
+	0x0c, 0xd6, 0x04, 0x9b, 0xd3, 0x1a, 0x00, 0x05, 0x93, 0x06, 0x95, 0x03, 0x95, 0x02, 0x95, 0x00, 
+	0x01, 0x9b, 0x93, 0x42, 0x58, 0xd8, 0xbd, 0xd1, 0x00, 0x1f, 0x22, 0x19, 0x78, 0x11, 0x40, 0xe2, 
+	0x1c, 0x01, 0x10, 0x29, 0x0e, 0xd1, 0x00, 0x2d, 0xb5, 0x03, 0xd9, 0x40, 0x04, 0x00, 0xaf, 0xd2, 
+	0x1a, 0x05, 0x9b, 0x02, 0x32, 0x00, 0x09, 0x02, 0x5a, 0x40, 0x0a, 0x40, 0x51, 0x1e, 0x00, 0x8a, 
+	0x41, 0x12, 0x19, 0x03, 0x32, 0x00, 0x2f, 0x40, 0x1e, 0x08, 0xb1, 0x00, 0x2b, 0x1b, 0xd0, 0x01, 
+	0x21, 0x00, 0x00, 0x20, 0x5e, 0x4c, 0x49, 0x42, 0x25, 0x8c, 0x00, 0x8d, 0x42, 0x10, 0xd0, 0x01, 
+	0x23, 0x5b, 0x42, 0x00, 0x9c, 0x46, 0x00, 0x21, 0x5b, 0x4b, 0x4e, 0x00, 0x00, 0x9e, 0x5b, 0x66, 
+	0x45, 0x02, 0xd0, 0xb5, 0x42, 0x08, 0x91, 0xd0, 0xb4, 0x46, 0x00, 0xf7, 0x31, 0x8b, 0x42, 0x10, 
+	0xf3, 0xd1, 0x29, 0x04, 0x8b, 0x02, 0x34, 0x87, 0x42, 0x40, 0xe7, 0x08, 0xa3, 0x53, 0x4c, 0x19, 
+	0x01, 0x01, 0x9b, 0x00, 0x0b, 0x51, 0x03, 0x9b, 0x64, 0x18, 0x23, 0x71, 0x00, 0x03, 0x23, 0x5a, 
+	0x43, 0x00, 0x20, 0xd3, 0x17, 0x10, 0xa2, 0x60, 0x01, 0x09, 0x35, 0x98, 0xfc, 0x08, 0x9b, 0x00, 
+	0x4c, 0x4a, 0x01, 0x30, 0xe0, 0x60, 0x58, 0x01, 0x00, 0x80, 0x18, 0x46, 0x49, 0x20, 0x22, 0x0a, 
+	0xf0, 0x0c, 0xe8, 0xfc, 0x01, 0x20, 0x57, 0x13, 0x01, 0x3d, 0x19, 0x84, 0x00, 0xe7, 0x03, 0x26, 
+	0x0f, 0x23, 0x11, 0x78, 0x3d, 0x00, 0x48, 0x40, 0x5c, 0x01, 0x09, 0x0e, 0x40, 0x09, 0x02, 0x96, 
+	0x86, 0x09, 0x18, 0x40, 0x06, 0x0a, 0x13, 0x58, 0x00, 0xe7, 0x09, 0xf0, 0xb1, 0xfe, 0x0b, 0x00, 
+	0x0f, 0x00, 0x00, 0x0b, 0x00, 0x21, 0x00, 0x51, 0x00, 0x57, 0x08, 0xff, 0x07, 0x00, 0x06, 0x00, 
+	0xad, 0x00, 0xd1, 0x4b, 0x00, 0xe7, 0x02, 0x34, 0x09, 0x9b, 0xd2, 0x18, 0x85, 0x00, 0xe7, 0x51, 
+	0x78, 0x03, 0x34, 0x01, 0x2e, 0x20, 0x20, 0xd8, 0x10, 0x0d, 0xe1, 0x40, 0xe7, 0x7d, 0x00, 0x78, 
+	0x02, 0x1c, 0x31, 0x4f, 0x79, 0x53, 0x07, 0x06, 0x35, 0x01, 0x00, 0x2e, 0xed, 0xd1, 0x01, 0x23, 
+	0x06, 0x93, 0xea, 0x00, 0xe7, 0x91, 0x78, 0x50, 0x78, 0x09, 0x02, 0x09, 0x20, 0x18, 0x04, 0x00, 
+	0x29, 0xea, 0xd9, 0x2a, 0x4b, 0xc8, 0x48, 0x18, 0x0e, 0xb1, 0x01, 0x98, 0x03, 0x2b, 0x27, 0xe7, 
+	0x80, 0x10, 0x20, 0x00, 0x02, 0x01, 0x81, 0xdb, 0x22, 0xe7, 0x02, 0x20, 0x9b, 0x10, 0x00, 0x59, 
+	0x1e, 0xe7, 0x01, 0x33, 0x07, 0x00, 0x93, 0x02, 0x9b, 0x5b, 0x00, 0x18, 0x00, 0x09, 0x10, 0x04, 
+	0x1b, 0x4b, 0x03, 0xd4, 0x52, 0x03, 0x2e, 0x27, 0x51, 0xd1, 0x06, 0xa3, 0x34, 0x10, 0x1f, 0x0e, 
+	0xe7, 0x5d, 0x0e, 0x3b, 0x00, 0x14, 0x4e, 0x03, 0x93, 0x07, 0x9b, 0x71, 0x53, 0x04, 0x02, 0x93, 
+	0x01, 0x25, 0xba, 0x00, 0x8b, 0x00, 0x2d, 0x00, 0x00, 0xd0, 0x01, 0xe7, 0x01, 0x21, 0x51, 0x56, 
+	0x00, 0x8e, 0x1c, 0x0b, 0x4b, 0x90, 0x19, 0x96, 0x5d, 0x00, 0x9e, 0x5d, 0x0f, 0x23, 0x1e, 0x40, 
+	0x05, 0x2e, 0x00, 0x07, 0xd1, 0x86, 0x78, 0x40, 0x78, 0x36, 0x02, 0x04, 0x05, 0x9b, 0x36, 0x18, 
+	0xb3, 0x03, 0xa7, 0xee, 0xe6, 0x00, 0x00, 0x29, 0xa1, 0xda, 0xeb, 0xe6, 0x07, 0x9b, 0x10, 0x02, 
+	0x93, 0x9d, 0x04, 0xfb, 0x3c, 0xde, 0x00, 0x08, 0x34, 0xf8, 0x6d, 0x0d, 0x6a, 0x0c, 0xdf, 0x60, 
+	0x10, 0x03, 0xfa, 0x03, 0x28, 0x02, 0xa0, 0x00, 0x03, 0x40, 0x00, 0x0b, 0x00, 0xe0, 0xff, 0x04, 
+	0xff, 0xf7, 0xb5, 0x8b, 0x1f, 0x09, 0xbf, 0x2b, 0x33, 0x00, 0xd8, 0x1b, 0x4b, 0x01, 0x27, 0x00, 
+	0x20, 0x9c, 0x00, 0x46, 0x7f, 0x42, 0x63, 0x46, 0xc3, 0x5c, 0x99, 0x80, 0x05, 0x6b, 0x17, 0x4a, 
+	0x83, 0x00, 0x9b, 0x58, 0x3d, 0x10, 0x00, 0x00, 0x93, 0x0d, 0x5d, 0x23, 0x00, 0x9e, 0x01, 0x00, 
+	0x9a, 0xf6, 0x5c, 0xd2, 0x5c, 0x02, 0x2e, 0x0a, 0x00, 0xd1, 0x66, 0x1c, 0x19, 0xd0, 0xa2, 0x42, 
+	0x0b, 0x00, 0xd0, 0x99, 0x42, 0x0c, 0xd0, 0x01, 0x30, 0x09, 0x00, 0x28, 0xe5, 0xd1, 0x0a, 0x38, 
+	0x07, 0xe0, 0x22, 0x00, 0x2e, 0x0b, 0xd1, 0x6e, 0x1c, 0x06, 0xd1, 0x15, 0x82, 0x00, 0xc1, 0x99, 
+	0x42, 0xe6, 0xd1, 0xfe, 0x21, 0x83, 0xaa, 0x00, 0x42, 0xf7, 0xd0, 0xea, 0xe7, 0xb2, 0x42, 0xf4, 
+	0x01, 0xd0, 0xe7, 0xe7, 0x14, 0x00, 0xf1, 0xe7, 0x1a, 0x3b, 0x14, 0xf1, 0xe7, 0xf0, 0x0c, 0xef, 
+	0xfc, 0x00, 0x03, 0xf8, 0xb5, 0x01, 0x0f, 0x00, 0x14, 0x00, 0x4c, 0x21, 0x16, 0x01, 0xb9, 0x00, 
+	0x25, 0xf9, 0x06, 0x00, 0x03, 0x1e, 0x21, 0xd0, 0x00, 0x85, 0x78, 0x43, 0x78, 0x2d, 0x02, 0xed, 
+	0x18, 0x00, 0xc2, 0x1b, 0x52, 0x1b, 0x78, 0x19, 0x13, 0x2a, 0x00, 0x21, 0xd1, 0x1e, 0x49, 0x30, 
+	0x31, 0x0a, 0xf0, 0x00, 0x51, 0xf9, 0x00, 0x23, 0x98, 0x42, 0x11, 0xd1, 0x00, 0x1b, 0x4a, 0x24, 
+	0x01, 0xa6, 0x50, 0x14, 0x19, 0x00, 0x23, 0x71, 0xab, 0x1d, 0x13, 0x35, 0x5d, 0x40, 0x00, 0xff, 
+	0x23, 0x1b, 0x02, 0x1d, 0x42, 0x09, 0xd1, 0x00, 0x12, 0x23, 0xff, 0x33, 0xa3, 0x60, 0x15, 0x4b, 
+	0x02, 0xe3, 0x60, 0x01, 0x23, 0x18, 0x00, 0x3a, 0xa9, 0x1e, 0x88, 0x20, 0x13, 0x11, 0x4b, 0xf4, 
+	0x03, 0x87, 0xff, 0xf7, 0x88, 0x41, 0xff, 0x10, 0x41, 0xf0, 0xdb, 0x03, 0x00, 0x0a, 0x40, 0x43, 
+	0x00, 0x03, 0x22, 0x80, 0x3b, 0x23, 0x71, 0x06, 0x4b, 0x08, 0x43, 0x33, 0x1b, 0x5c, 0x12, 0x59, 
+	0x01, 0x21, 0xa2, 0x01, 0x60, 0xd3, 0x17, 0x0a, 0xf0, 0x6b, 0xfb, 0x12, 0x55, 0x60, 0xda, 0x20, 
+	0xa7, 0x11, 0x33, 0x01, 0x0f, 0xf0, 0x00, 0x6d, 0x00, 0xf3, 0xe5, 0x00, 0xf7, 0xb5, 0x00, 0x24, 
+	0x06, 0x80, 0x02, 0x31, 0x15, 0x00, 0xa2, 0x42, 0x03, 0xd1, 0x18, 0x00, 0x4b, 0x1c, 0x78, 0x64, 
+	0x06, 0xe4, 0x0f, 0x2b, 0x00, 0x01, 0x01, 0x93, 0x16, 0x4b, 0x2a, 0x01, 0x9a, 0x04, 0x18, 0x93, 
+	0x79, 0x01, 0x33, 0x18, 0xd5, 0x08, 0x2b, 0x00, 0x0b, 0xd0, 0x93, 0x71, 0x11, 0x4b, 0x22, 0x01, 
+	0x20, 0xd3, 0x58, 0x1e, 0xbf, 0x20, 0x00, 0x0a, 0xf0, 0x2f, 0x20, 0xfb, 0xf7, 0x2f, 0x57, 0x00, 
+	0x23, 0x39, 0x00, 0x93, 0x08, 0x71, 0x30, 0x00, 0x2a, 0x00, 0x91, 0xfd, 0xfd, 0x00, 0x09, 0x28, 
+	0xeb, 0xd1, 0x07, 0x00, 0x3b, 0xd0, 0x50, 0x10, 0x23, 0x04, 0x1d, 0xfb, 0x2a, 0x00, 0x39, 0x0e, 
+	0x5c, 0xff, 0xf7, 0x10, 0x72, 0xff, 0xdf, 0x01, 0xbf, 0xc4, 0x59, 0x00, 0x03, 0xa0, 0x10, 0x7f, 
+	0x03, 0x03, 0x11, 0xff, 0x30, 0x2a, 0x2b, 0x08, 0x00, 0xdc, 0x20, 0x2b, 0x00, 0xda, 0x20, 0x23, 
+	0x03, 0x01, 0x48, 0xc3, 0x18, 0x20, 0x3b, 0x18, 0x78, 0x10, 0x15, 0x00, 0x70, 0x47, 0xc0, 0x46, 
+	0x7d, 0xdf, 0x00, 0x08, 0x40, 0xf7, 0x0e, 0x65, 0x1d, 0x28, 0x29, 0xdc, 0x7f, 0x27, 0x00, 0x16, 
+	0x4a, 0x43, 0x00, 0x9e, 0x18, 0x15, 0x4a, 0x10, 0x16, 0x48, 0x9b, 0x0d, 0xe9, 0x2d, 0x18, 0x2c, 
+	0x78, 0x00, 0x20, 0x00, 0x33, 0x88, 0x38, 0x40, 0x00, 0x93, 0x00, 0xff, 0xf7, 0xda, 0xff, 0x80, 
+	0x23, 0xe4, 0x09, 0x00, 0xdb, 0x01, 0x24, 0x03, 0xc0, 0x18, 0x00, 0x9a, 0x00, 0x24, 0x18, 0x24, 
+	0x04, 0x24, 0x0c, 0x3a, 0x40, 0x02, 0x2a, 0x2a, 0x00, 0xd1, 0x0a, 0x3a, 0x19, 0xad, 0x49, 0x00, 
+	0x01, 0x0b, 0x40, 0x5b, 0x11, 0x9b, 0x18, 0x2b, 0x00, 0x70, 0x01, 0x9b, 0x34, 0x80, 0x40, 0x36, 
+	0x1e, 0x04, 0x35, 0xb3, 0x42, 0xde, 0xd1, 0x30, 0xb9, 0xc0, 0x46, 0x28, 0x00, 0x20, 0x08, 0x0e, 
+	0x25, 0x0e, 0xf7, 0xf7, 0x03, 0x02, 0x00, 0xf7, 0xb5, 0x19, 0x4e, 0x33, 0x68, 0xdc, 0x08, 0x00, 
+	0x3f, 0x23, 0x72, 0x68, 0xd7, 0x08, 0x1c, 0x40, 0x00, 0x1f, 0x40, 0xbc, 0x42, 0x16, 0xd0, 0x3a, 
+	0x1b, 0x00, 0x1a, 0x40, 0x20, 0x2a, 0x0b, 0xdc, 0x1f, 0x25, 0x20, 0x01, 0x93, 0x0e, 0x8f, 0x40, 
+	0xff, 0xf7, 0xb3, 0xff, 0x00, 0x01, 0x9b, 0x01, 0x34, 0x1c, 0x40, 0xa7, 0x42, 0x00, 0xf6, 0xd1, 
+	0x06, 0xe0, 0x1d, 0x00, 0x01, 0x3c, 0x20, 0x01, 0x3f, 0x30, 0x2d, 0x09, 0xd1, 0x73, 0x68, 0x09, 
+	0x00, 0x4a, 0x33, 0x60, 0x13, 0x80, 0xb2, 0x68, 0x08, 0x10, 0x4b, 0x1a, 0x80, 0x30, 0x65, 0x1f, 
+	0x20, 0x20, 0x40, 0x00, 0x01, 0x3c, 0xff, 0xf7, 0x97, 0xff, 0x2c, 0x40, 0x55, 0xec, 0x01, 0x03, 
+	0x7c, 0x0f, 0x6f, 0x18, 0x0f, 0x97, 0x1a, 0x00, 0x03, 0x00, 0x10, 0xb5, 0x03, 0x49, 0x03, 0x48, 
+	0x09, 0xf0, 0x18, 0xc7, 0xfc, 0x10, 0x20, 0x2b, 0x10, 0x8b, 0x68, 0xd6, 0x00, 0x00, 0x08, 0x10, 
+	0xb5, 0x40, 0x22, 0x03, 0x49, 0x04, 0x51, 0x48, 0x03, 0xff, 0xfa, 0x30, 0x19, 0xc0, 0x46, 0x24, 
+	0x01, 0xbb, 0x80, 0x0f, 0xd3, 0x05, 0x02, 0x4b, 0x1b, 0x88, 0xdb, 0x43, 0x00, 0x02, 0x4a, 0xd3, 
+	0x60, 0x70, 0x47, 0x30, 0x01, 0x24, 0x00, 0x04, 0x10, 0x4f, 0xf7, 0xb5, 0x0d, 0x31, 0x00, 0x3c, 
+	0x00, 0x69, 0x0a, 0xf0, 0x10, 0xfa, 0x1a, 0x4b, 0x1d, 0x00, 0x88, 0xeb, 0x43, 0x01, 0x93, 0xfb, 
+	0x68, 0x1d, 0x00, 0x43, 0x01, 0x9b, 0xed, 0x43, 0xfb, 0x60, 0x00, 0x00, 0x2e, 0x23, 0xd0, 0x6b, 
+	0x06, 0x05, 0xd5, 0xa0, 0x00, 0x19, 0x31, 0x00, 0x01, 0x38, 0x0a, 0xf0, 0x58, 0x00, 0xfa, 0x0c, 
+	0x00, 0x2b, 0x06, 0x04, 0xd5, 0x60, 0x28, 0x1c, 0x31, 0x01, 0xa3, 0x51, 0x00, 0x0d, 0xeb, 0x06, 
+	0x03, 0x00, 0xd5, 0x0a, 0x34, 0xa6, 0x42, 0x00, 0xdc, 0x74, 0x20, 0x1e, 0xab, 0x10, 0x0b, 0x3c, 
+	0xe3, 0x43, 0xdb, 0x17, 0x00, 0x1c, 0x40, 0xc0, 0x22, 0x01, 0x9b, 0x92, 0x00, 0x10, 0x13, 0x40, 
+	0x93, 0x0b, 0x2b, 0x05, 0x4b, 0x1d, 0x40, 0x0e, 0x3c, 0x61, 0x28, 0x00, 0x33, 0x07, 0x30, 0xc7, 
+	0x10, 0x7f, 0xff, 0x10, 0xfc, 0xff, 0xff, 0x00, 0xc7, 0x07, 0x0a, 0xd4, 0x15, 0x00, 0x4b, 0xc2, 
+	0x07, 0x02, 0xd5, 0x5a, 0x68, 0xff, 0x00, 0x2a, 0x04, 0xd9, 0x82, 0x07, 0x08, 0xd5, 0x5b, 0x00, 
+	0x68, 0xff, 0x2b, 0x05, 0xd9, 0x10, 0x4b, 0x11, 0x02, 0x49, 0x11, 0x4a, 0x02, 0xc3, 0x93, 0x0e, 
+	0x21, 0x0c, 0x02, 0x4c, 0x43, 0x07, 0x09, 0xd4, 0xc3, 0x00, 0x25, 0x63, 0x82, 0x00, 0x1b, 0x04, 
+	0xd8, 0x83, 0x07, 0x07, 0x40, 0x09, 0x0a, 0x0a, 0x4a, 0x0a, 0x49, 0x0b, 0x00, 0xef, 0xb8, 0x03, 
+	0x15, 0xa3, 0x0f, 0x60, 0xff, 0xf7, 0x38, 0x0e, 0x95, 0x30, 0xf7, 0x10, 0x67, 0x11, 0xa7, 0x08, 
+	0x2a, 0x41, 0x2a, 0x41, 0x11, 0x1f, 0x76, 0x02, 0x00, 0x04, 0x00, 0x20, 0x20, 0x20, 0x20, 0x11, 
+	0xb3, 0xf8, 0xb5, 0x00, 0x1f, 0x24, 0x2a, 0x4b, 0x0e, 0x00, 0x5b, 0x68, 0x00, 0xa0, 0x42, 0x19, 
+	0xdd, 0xff, 0x2b, 0x19, 0xd8, 0x00, 0x1e, 0x21, 0x20, 0x40, 0x20, 0x25, 0x0b, 0x00, 0x10, 0x43, 
+	0x43, 0x00, 0x02, 0x84, 0xaa, 0x25, 0x80, 0x22, 0x00, 0x48, 0x43, 0x00, 0x21, 0x22, 0x4c, 0x01, 
+	0x33, 0x00, 0x05, 0x55, 0x1b, 0x19, 0x70, 0x5c, 0x1f, 0x28, 0x04, 0x35, 0xd8, 0x20, 0x22, 0x1d, 
+	0x0a, 0xc1, 0x1a, 0x70, 0x00, 0x01, 0x31, 0xfa, 0xe7, 0xff, 0x2b, 0xe5, 0xd8, 0x01, 0x1c, 0x4b, 
+	0x04, 0x40, 0xa4, 0x01, 0xe4, 0x04, 0xe7, 0x00, 0x17, 0x07, 0xdb, 0x05, 0xff, 0x18, 0x3f, 0x0c, 
+	0x00, 0x00, 0x2a, 0x07, 0xdb, 0x08, 0xd0, 0x3b, 0x00, 0x00, 0x80, 0x33, 0xff, 0x33, 0x1b, 0x04, 
+	0x1b, 0x0c, 0x20, 0x23, 0x80, 0x04, 0xb5, 0x25, 0x08, 0xe0, 0x95, 0x23, 0x10, 0x5b, 0x00, 0xf8, 
+	0x06, 0xf1, 0x9f, 0xfe, 0x6b, 0x00, 0x00, 0x38, 0x18, 0xe0, 0x52, 0x01, 0x35, 0x70, 0x5d, 0x08, 
+	0x1f, 0x28, 0x07, 0xd8, 0x10, 0x17, 0x1d, 0x2d, 0x05, 0x08, 0xd0, 0x6a, 0x00, 0xa3, 0x00, 0x13, 
+	0xf9, 0xe7, 0x1d, 0x08, 0x2d, 0xec, 0xd1, 0xf8, 0x20, 0xbf, 0x1d, 0x29, 0xfa, 0x08, 0xd0, 0x80, 
+	0x18, 0x18, 0x00, 0x6b, 0x01, 0x33, 0xbf, 0x70, 0xe7, 0x10, 0xcb, 0x10, 0xb7, 0x10, 0xcf, 0xf2, 
+	0x22, 0x07, 0x4b, 0x00, 0xff, 0x32, 0x1a, 0x80, 0x00, 0x04, 0x06, 0x4b, 0x02, 0x00, 0x0c, 0x18, 
+	0x80, 0x10, 0x23, 0x0d, 0xad, 0x06, 0x02, 0xd8, 0x40, 0x03, 0x4b, 0x18, 0x80, 0x13, 0x03, 0x50, 
+	0xa8, 0x02, 0x1f, 0x54, 0x00, 0x03, 0x52, 0x22, 0x27, 0x00, 0x20, 0xff, 0x20, 0xf7, 0xe6, 0x02, 
+	0xeb, 0x87, 0x21, 0xdb, 0x04, 0x1a, 0x00, 0x88, 0x8a, 0x43, 0x80, 0x21, 0x1a, 0x80, 0x1a, 0x00, 
+	0x88, 0xc9, 0x00, 0x0a, 0x43, 0x1a, 0x80, 0x02, 0x14, 0x4b, 0x19, 0x80, 0x31, 0x2d, 0x0c, 0x00, 
+	0x2b, 0xbf, 0x22, 0x39, 0x03, 0x4b, 0x02, 0x5d, 0x00, 0x15, 0x10, 0x55, 0x70, 0x47, 0x50, 0x47, 
+	0x00, 0x70, 0xb5, 0xff, 0xf7, 0xe1, 0xfe, 0x0b, 0x25, 0x44, 0x01, 0x00, 0x49, 0xe7, 0xfe, 0x04, 
+	0x01, 0xf9, 0xfa, 0xf8, 0x50, 0x2c, 0x04, 0xcd, 0x70, 0x41, 0x67, 0x09, 0x4a, 0x94, 0x46, 0x00, 
+	0x09, 0x4b, 0x1b, 0x68, 0x82, 0xb0, 0x42, 0x1c, 0x00, 0x01, 0x93, 0xff, 0x32, 0x63, 0x44, 0x01, 
+	0x68, 0x00, 0x99, 0x42, 0x02, 0xd1, 0x30, 0x38, 0x02, 0xb0, 0x04, 0x70, 0x47, 0x04, 0x30, 0x90, 
+	0x02, 0xef, 0x00, 0x20, 0x01, 0xf8, 0xe7, 0x00, 0x00, 0x53, 0x1a, 0xe4, 0x02, 0x8b, 0x00, 0x0b, 
+	0x4b, 0x70, 0xb5, 0x04, 0x00, 0x18, 0x68, 0x00, 0xff, 0xf7, 0xe2, 0xff, 0x09, 0x4b, 0x1d, 0x78, 
+	0x02, 0x00, 0x28, 0x03, 0xd0, 0x00, 0x2d, 0x07, 0xd3, 0x2c, 0x10, 0x02, 0xd1, 0x70, 0x22, 0x23, 
+	0x03, 0x6a, 0x30, 0x33, 0x00, 0xc0, 0x18, 0xff, 0xf7, 0xd2, 0xff, 0x01, 0x3c, 0x16, 0xef, 0xe7, 
+	0x6c, 0x00, 0xfb, 0x44, 0x00, 0x03, 0x1c, 0x7f, 0x03, 0x00, 0x90, 0x0a, 0xf0, 0xbb, 0xf8, 0x32, 
+	0x4d, 0x2c, 0x00, 0x68, 0x14, 0x2c, 0x30, 0xdd, 0x25, 0x00, 0x03, 0x00, 0x98, 0x14, 0x3d, 0x68, 
+	0x43, 0x61, 0x1e, 0xc0, 0x82, 0x00, 0x95, 0x21, 0xf9, 0x07, 0x23, 0xc4, 0x02, 0x7b, 0x24, 0x04, 
+	0x18, 0x15, 0x27, 0xe4, 0x10, 0x09, 0xa3, 0xdc, 0x01, 0x00, 0x3f, 0x28, 0x4b, 0x18, 0x40, 0x04, 
+	0xd5, 0x08, 0x00, 0x23, 0x01, 0x38, 0x5b, 0x42, 0x18, 0x43, 0x01, 0x08, 0x30, 0x25, 0x4b, 0x18, 
+	0x02, 0x23, 0x26, 0xfe, 0x00, 0x44, 0x23, 0x13, 0x95, 0xff, 0xf7, 0xb9, 0x05, 0x09, 0x05, 0x00, 
+	0x40, 0x1e, 0x05, 0xdb, 0xbe, 0x42, 0x18, 0xdb, 0x03, 0x23, 0x00, 0x00, 0x98, 0x98, 0x43, 0x01, 
+	0x3b, 0x18, 0x43, 0x80, 0x59, 0x07, 0x14, 0x23, 0x1b, 0x1b, 0xe2, 0x07, 0x06, 0x02, 0xd5, 0x04, 
+	0x22, 0x17, 0x4b, 0x1a, 0x00, 0x39, 0x09, 0x20, 0xfe, 0x15, 0x00, 0x11, 0x5b, 0x10, 0x00, 0x24, 
+	0x01, 0x08, 0x93, 0x2f, 0x68, 0xdd, 0x0d, 0x53, 0x1b, 0x1b, 0x02, 0x20, 0x93, 0x0e, 0x00, 0xfd, 
+	0x01, 0x2b, 0x08, 0xdd, 0x02, 0x01, 0x9b, 0xf2, 0x1a, 0x53, 0x42, 0x5a, 0x41, 0x0c, 0xf1, 0x20, 
+	0x00, 0xf0, 0x00, 0xbf, 0xcc, 0xfe, 0x02, 0x9b, 0x9e, 0x00, 0x42, 0x04, 0xd1, 0xab, 0x6a, 0x18, 
+	0x04, 0x6b, 0x00, 0x6a, 0x03, 0x43, 0x00, 0x93, 0x28, 0x6a, 0x30, 0x20, 0x30, 0x28, 0x00, 0x19, 
+	0x65, 0xff, 0x01, 0x36, 0x05, 0x0c, 0x00, 0xc4, 0xe7, 0x90, 0x00, 0xd7, 0x07, 0x45, 0x80, 0x84, 
+	0xa0, 0x23, 0x8b, 0x03, 0x01, 0x61, 0x76, 0xfe, 0x80, 0x22, 0x36, 0x02, 0x4b, 0xd2, 0x00, 0x1a, 
+	0x80, 0x10, 0x00, 0x0d, 0x09, 0x40, 0xff, 0x08, 0xe1, 0xf0, 0x7c, 0xfa, 0x32, 0x4b, 0x18, 0x00, 
+	0x68, 0x80, 0x23, 0x00, 0x02, 0x9b, 0x05, 0x00, 0x00, 0x0a, 0xc0, 0x18, 0x0a, 0xf0, 0xd3, 0xf8, 
+	0x2f, 0x00, 0x4b, 0x1b, 0x78, 0x2f, 0x4c, 0x2f, 0x4d, 0x30, 0x40, 0x4e, 0x05, 0x57, 0xd1, 0x22, 
+	0x68, 0x01, 0x2a, 0x19, 0x00, 0xdc, 0xc1, 0x23, 0x29, 0x68, 0x9b, 0x00, 0x01, 0x00, 0x22, 0x00, 
+	0x20, 0x19, 0x40, 0xfe, 0xf7, 0x23, 0x40, 0xfb, 0x00, 0x31, 0x25, 0x5b, 0x00, 0x33, 0x60, 0x28, 
+	0x22, 0x4b, 0x1d, 0x00, 0xbb, 0xab, 0xfd, 0x28, 0x00, 0xf1, 0xe0, 0x00, 0xfe, 0x01, 0x20, 0x65, 
+	0x60, 0x0a, 0xf0, 0xc2, 0x40, 0xf8, 0x34, 0x65, 0x80, 0x22, 0x52, 0x00, 0x32, 0x60, 0x41, 0x63, 
+	0x00, 0x1f, 0x9b, 0xfd, 0xa7, 0x68, 0x38, 0x00, 0x21, 0x01, 0x4b, 0xff, 0x01, 0x90, 0xe0, 0x60, 
+	0x08, 0x00, 0x7d, 0x02, 0xca, 0xfe, 0xc0, 0x23, 0x01, 0x22, 0x10, 0x53, 0x19, 0x00, 0x40, 0x01, 
+	0x9b, 0x38, 0x00, 0x19, 0x43, 0x62, 0x01, 0x60, 0xfe, 0xf7, 0xf7, 0xfa, 0xc0, 0x23, 0x00, 0x65, 
+	0x00, 0x93, 0x13, 0x4f, 0xa0, 0x68, 0x3b, 0x68, 0x83, 0x00, 0x42, 0x0f, 0xd0, 0x01, 0x9a, 0x29, 
+	0x68, 0xe3, 0x00, 0x68, 0x11, 0x40, 0x19, 0x43, 0x01, 0x22, 0xfe, 0x00, 0xf7, 0xe7, 0xfa, 0x63, 
+	0x68, 0x05, 0x2b, 0xef, 0x20, 0xd1, 0xa2, 0x00, 0x1d, 0x9a, 0x42, 0xeb, 0xd1, 0xbb, 0x00, 0xe7, 
+	0x00, 0x20, 0x0a, 0xf0, 0x8a, 0xf8, 0xf3, 0xc3, 0x04, 0xc3, 0x12, 0x67, 0x24, 0x74, 0x00, 0x03, 
+	0x11, 0xcf, 0x10, 0xfb, 0x0a, 0x48, 0x73, 0x00, 0x03, 0x04, 0x9b, 0x02, 0x10, 0xff, 0x44, 0x80, 
+	0x00, 0x0b, 0x11, 0x4b, 0x1a, 0x68, 0x11, 0x00, 0x11, 0x80, 0x00, 0xed, 0x81, 0x43, 0xf0, 0x20, 
+	0x1a, 0x60, 0x10, 0x08, 0x40, 0x0f, 0x4a, 0x13, 0x00, 0x63, 0x11, 0xd1, 0x53, 0x00, 0x68, 0x01, 
+	0x33, 0x53, 0x60, 0x18, 0x2b, 0x0f, 0x00, 0xdd, 0x03, 0x22, 0x13, 0x40, 0x5a, 0x42, 0x53, 0x44, 
+	0x41, 0x01, 0xd1, 0x40, 0x00, 0x22, 0x05, 0x2f, 0x60, 0x0b, 0x02, 0x23, 0x0b, 0x40, 0x18, 0x43, 
+	0x70, 0x06, 0x51, 0x09, 0x20, 0xc2, 0xf5, 0x00, 0x6d, 0xf3, 0xe7, 0x70, 0x72, 0x00, 0x21, 0x03, 
+	0x78, 0x10, 0x57, 0x76, 0x00, 0x03, 0x74, 0x00, 0x0b, 0x00, 0xf8, 0xb5, 0x3e, 0x4c, 0xa7, 0x68, 
+	0x63, 0x68, 0x40, 0x26, 0x01, 0xa7, 0x0c, 0xd1, 0x00, 0x22, 0x3b, 0x4b, 0x00, 0x3c, 0x4d, 0x1a, 
+	0x60, 0x2b, 0x68, 0x93, 0x42, 0x04, 0x53, 0xd1, 0x00, 0x23, 0x2b, 0x00, 0xfd, 0x1c, 0xfd, 0x00, 
+	0x02, 0x23, 0x63, 0x60, 0x63, 0x68, 0x02, 0x2b, 0x11, 0x2b, 0xd1, 0x36, 0x25, 0x29, 0x35, 0x4a, 
+	0x13, 0x00, 0x17, 0x04, 0xb6, 0xff, 0x05, 0x00, 0x38, 0x34, 0xe7, 0x30, 0x86, 0xa4, 0x02, 0x53, 
+	0x70, 0x34, 0xe7, 0x38, 0xc3, 0x04, 0xe7, 0x18, 0x40, 0x00, 0x6b, 0x06, 0x01, 0xd5, 0x80, 0x19, 
+	0x01, 0x38, 0x00, 0x2b, 0x06, 0xdb, 0x0f, 0x31, 0x00, 0xc0, 0x18, 0x00, 0x09, 0xf0, 0xc6, 0xff, 
+	0x0e, 0x00, 0x8f, 0x42, 0x10, 0x04, 0xd0, 0x08, 0x01, 0x49, 0xa6, 0xfe, 0xe0, 0x60, 0x52, 0xa6, 
+	0x00, 0x9d, 0x1d, 0x05, 0x05, 0x08, 0x3b, 0x10, 0x5d, 0x03, 0x80, 0x07, 0x03, 0x63, 0x68, 0x04, 
+	0x2b, 0x30, 0xd1, 0x1d, 0x00, 0x4b, 0x1a, 0x88, 0x0b, 0x23, 0x93, 0x43, 0x01, 0x00, 0xd1, 0x04, 
+	0x33, 0x63, 0x60, 0x18, 0x4d, 0x28, 0x04, 0x68, 0xff, 0x28, 0x16, 0xd9, 0x13, 0xad, 0x0f, 0xfe, 
+	0x64, 0x80, 0x04, 0x15, 0x10, 0x93, 0xd2, 0xfc, 0x10, 0x2b, 0x1a, 0xd1, 0x42, 0x05, 0x00, 0x99, 
+	0x17, 0xe0, 0x20, 0x3b, 0x10, 0x13, 0xc8, 0x00, 0xfc, 0x2b, 0x68, 0x01, 0x3b, 0xff, 0x2b, 0xa9, 
+	0x00, 0xd9, 0xa2, 0xe7, 0x07, 0x23, 0x20, 0x30, 0x28, 0x00, 0x60, 0x40, 0x09, 0x18, 0x1a, 0x43, 
+	0x1c, 0x00, 0x80, 0x03, 0x63, 0xff, 0xf7, 0xf1, 0xfd, 0xff, 0xf7, 0xb7, 0x84, 0x00, 0x21, 0xff, 
+	0x2b, 0xd9, 0xd8, 0x34, 0x47, 0xc0, 0x46, 0xfc, 0x11, 0x67, 0x11, 0x03, 0x11, 0x67, 0x15, 0x77, 
+	0x11, 0x1b, 0x18, 0x7d, 0x70, 0x47, 0x81, 0x0a, 0x21, 0x68, 0x9a, 0x18, 0x40, 0x42, 0x0a, 0x06, 
+	0x11, 0x40, 0x70, 0x07, 0x35, 0x14, 0x00, 0x00, 0x68, 0x03, 0x60, 0x10, 0x42, 0x60, 0x08, 0x00, 
+	0x55, 0x09, 0xf0, 0x43, 0xfd, 0x06, 0x2b, 0x68, 0x1b, 0x19, 0x20, 0x00, 0x89, 0x33, 0x95, 0x10, 
+	0x00, 0xb5, 0x06, 0x4c, 0x24, 0x78, 0x00, 0x2c, 0x04, 0x0e, 0xd0, 0xff, 0xf7, 0xe8, 0x05, 0x65, 
+	0x2a, 0x59, 0x00, 0x47, 0xf9, 0xb5, 0x01, 0xd7, 0x6a, 0x01, 0xbb, 0x90, 0x1f, 0xd8, 0xc0, 0x1f, 
+	0xb6, 0x00, 0x73, 0x14, 0x10, 0xb5, 0x09, 0x03, 0xf3, 0xcb, 0x40, 0x19, 0x10, 0xb5, 0x00, 0x0c, 
+	0x4b, 0x1a, 0x78, 0x0c, 0x4b, 0x0d, 0x49, 0x00, 0x1a, 0x70, 0x0d, 0x4a, 0x0b, 0x68, 0x10, 0x68, 
+	0x00, 0x1b, 0x1a, 0x0b, 0x60, 0x0b, 0x49, 0x0c, 0x4b, 0x10, 0x08, 0x68, 0xc3, 0x00, 0x09, 0x00, 
+	0x23, 0x13, 0x60, 0x73, 0x0a, 0x02, 0x0d, 0x00, 0x03, 0x00, 0x8b, 0xa9, 0xfe, 0x34, 0xa7, 0x18, 
+	0x07, 0x55, 0x92, 0x00, 0x4b, 0x54, 0x00, 0x03, 0x64, 0x00, 0x03, 0x58, 0x00, 0x03, 0x05, 0x00, 
+	0x00, 0x00, 0x03, 0xd0, 0x09, 0xdb, 0x78, 0x00, 0x0b, 0x00, 0x70, 0xb5, 0x25, 0x4c, 0x25, 0x68, 
+	0xfc, 0xf7, 0x00, 0x85, 0xfe, 0x23, 0x68, 0x1b, 0x04, 0x23, 0x4a, 0x10, 0x5b, 0x0f, 0x9b, 0x09, 
+	0xbb, 0x22, 0x49, 0x0b, 0x60, 0x00, 0x22, 0x49, 0x5d, 0x19, 0x08, 0x68, 0x21, 0x4b, 0x01, 0xc3, 
+	0x18, 0x0b, 0x60, 0x21, 0x4b, 0x5a, 0x00, 0x03, 0x20, 0x1a, 0x78, 0x00, 0x03, 0x70, 0x21, 0x4b, 
+	0x21, 0x49, 0x44, 0x1a, 0x00, 0x17, 0x1a, 0x60, 0x0a, 0x00, 0x05, 0xd2, 0x18, 0x00, 0x0a, 0x60, 
+	0x20, 0x4a, 0x11, 0x68, 0xcb, 0x18, 0x11, 0x13, 0x60, 0x25, 0x00, 0x77, 0x3d, 0xff, 0x1e, 0x00, 
+	0x83, 0x01, 0x53, 0x04, 0x08, 0xd4, 0x1d, 0x49, 0x08, 0x01, 0xa1, 0x11, 0x04, 0xdc, 0x1c, 0x03, 
+	0xeb, 0x1b, 0x02, 0x1b, 0x00, 0x45, 0x40, 0x1a, 0x03, 0x81, 0x04, 0x2b, 0x05, 0xd1, 0x19, 0x4b, 
+	0x00, 0xd9, 0x78, 0x00, 0x29, 0x01, 0xd1, 0x0c, 0x31, 0x00, 0xd9, 0x70, 0x93, 0x04, 0x05, 0xd4, 
+	0x80, 0x22, 0x40, 0x16, 0x00, 0x57, 0x16, 0x4b, 0x71, 0x3a, 0x1a, 0x70, 0xf7, 0x55, 0x23, 0x10, 
+	0xaf, 0x1a, 0x7f, 0x90, 0xb3, 0x3c, 0x00, 0x07, 0x10, 0xcb, 0x10, 0xd3, 0xb0, 0x10, 0xbb, 0xc8, 
+	0x01, 0x43, 0x10, 0xc7, 0x80, 0x02, 0x00, 0x05, 0x54, 0xcc, 0x00, 0x0b, 0xa0, 0x01, 0xaf, 0x50, 
+	0x00, 0x17, 0x48, 0x75, 0x15, 0x00, 0x03, 0x67, 0x00, 0x0f, 0xdc, 0x00, 0x0b, 0x94, 0x00, 0x07, 
+	0x44, 0x9c, 0x00, 0x03, 0x70, 0xb5, 0x0d, 0x01, 0xad, 0x1e, 0x00, 0x41, 0x09, 0x03, 0x61, 0x08, 
+	0xdc, 0x09, 0xf0, 0x6d, 0x01, 0xf3, 0x02, 0x1b, 0x19, 0x2b, 0x60, 0x20, 0x00, 0x31, 0xab, 0x1a, 
+	0x08, 0x00, 0x09, 0xf0, 0x63, 0x00, 0x13, 0x1c, 0x19, 0x2c, 0x00, 0x60, 0x34, 0x00, 0xf3, 0xe7, 
+	0x10, 0xb5, 0x07, 0xb6, 0x21, 0x9b, 0x07, 0x0d, 0x31, 0x11, 0xf3, 0x0a, 0x0d, 0xa3, 0x31, 0x87, 
+	0xff, 0x07, 0xf7, 0xd9, 0xff, 0xf9, 0xe7, 0x31, 0xbf, 0xf0, 0x23, 0x50, 0x23, 0x60, 0xc7, 0x00, 
+	0x23, 0x11, 0xc3, 0x70, 0xb5, 0x15, 0x00, 0x1c, 0x80, 0x02, 0xd9, 0xbf, 0xff, 0xa5, 0x42, 0x03, 
+	0xda, 0x03, 0xea, 0x01, 0x1b, 0x00, 0x03, 0x42, 0x1f, 0x80, 0x00, 0x1f, 0x98, 0x21, 0xe7, 0x00, 
+	0xb8, 0x01, 0xe7, 0xae, 0x82, 0x01, 0xb2, 0x69, 0x90, 0x0b, 0xf8, 0xb5, 0x00, 0x00, 0x23, 0x0f, 
+	0x4c, 0x9d, 0x00, 0x65, 0x59, 0xa9, 0x00, 0x42, 0x02, 0xd0, 0x01, 0x33, 0x0f, 0x2b, 0xf8, 0x02, 
+	0xd1, 0x01, 0x21, 0x99, 0x40, 0x0b, 0x01, 0xc5, 0x29, 0x00, 0x43, 0x0b, 0x4d, 0x6f, 0x1c, 0x9e, 
+	0x00, 0xfb, 0x00, 0x18, 0x21, 0x60, 0xdb, 0x7f, 0x09, 0x49, 0x9b, 0x00, 0x00, 0x8c, 0x19, 0x5d, 
+	0x59, 0x73, 0x58, 0x01, 0x01, 0x00, 0x20, 0x6c, 0x00, 0xf0, 0xa2, 0xf9, 0x3a, 0xd9, 0x02, 0xc0, 
+	0x46, 0x28, 0x63, 0x00, 0x08, 0x11, 0x2b, 0x08, 0x08, 0xe0, 0x00, 0x08, 0x88, 0x09, 0xff, 0x0b, 
+	0x00, 0xf0, 0x80, 0x0a, 0x9d, 0x85, 0x49, 0x9d, 0x18, 0x84, 0x4a, 0x09, 0x00, 0x78, 0x14, 0x70, 
+	0x83, 0x4a, 0x14, 0x60, 0x83, 0x00, 0x4a, 0x87, 0xb0, 0x03, 0x91, 0x11, 0x88, 0x05, 0x00, 0x93, 
+	0x01, 0x91, 0x06, 0x00, 0x14, 0x80, 0x02, 0x00, 0x92, 0xab, 0x42, 0x00, 0xd3, 0xa8, 0xe0, 0x1a, 
+	0x00, 0x00, 0x02, 0xca, 0x7d, 0x48, 0x05, 0x92, 0xa7, 0x08, 0x00, 0xc7, 0x59, 0xb9, 0x0c, 0x37, 
+	0xc4, 0xe0, 0x01, 0x04, 0x34, 0x0f, 0x2c, 0xf7, 0xd1, 0x00, 0x27, 0x23, 0x78, 0x00, 0x4c, 0x79, 
+	0x4d, 0x79, 0x4f, 0x21, 0x68, 0x30, 0x00, 0x00, 0x00, 0x22, 0x2b, 0x70, 0x3b, 0x70, 0xfe, 0x10, 
+	0xf7, 0x7a, 0xf8, 0x1e, 0x91, 0x1a, 0x80, 0xff, 0xf7, 0x40, 0xa0, 0x06, 0x41, 0x2b, 0x70, 0x05, 
+	0x9d, 0x08, 0x22, 0x40, 0x29, 0x07, 0x92, 0x3b, 0x70, 0x09, 0xf0, 0xac, 0xfb, 0x00, 0x29, 0x00, 
+	0x80, 0x22, 0x08, 0x31, 0x12, 0x01, 0x40, 0x6d, 0x09, 0x97, 0xa5, 0xfb, 0x80, 0x22, 0x6c, 0x4b, 
+	0x04, 0x92, 0x01, 0xe9, 0x18, 0x6c, 0x00, 0x0d, 0x9e, 0xfb, 0x00, 0x6b, 0x4b, 0x6c, 0x4a, 0x1b, 
+	0x78, 0xac, 0x18, 0x80, 0x09, 0x3e, 0xd0, 0x80, 0x22, 0x6a, 0x4b, 0x6a, 0x48, 0x01, 0xe9, 0x18, 
+	0x92, 0x01, 0x09, 0xf0, 0x91, 0x00, 0x27, 0x00, 0x05, 0x94, 0x05, 0x9c, 0x67, 0x48, 0x21, 0x00, 
+	0x44, 0x12, 0x00, 0x0f, 0x89, 0xfb, 0x66, 0x02, 0x55, 0x00, 0x2b, 0x41, 0x05, 0x00, 0x25, 0x12, 
+	0x01, 0x64, 0x48, 0xa1, 0x04, 0x51, 0x00, 0x7f, 0xfb, 0x82, 0x23, 0x5b, 0x01, 0xe1, 0x18, 0x10, 
+	0x20, 0x22, 0x61, 0x00, 0x4b, 0x78, 0xfb, 0x60, 0x4b, 0x04, 0x20, 0x22, 0xe1, 0x18, 0x60, 0x00, 
+	0x0b, 0x72, 0xfb, 0x14, 0x5f, 0x4b, 0x08, 0x00, 0x0b, 0x5f, 0x00, 0x0b, 0x6c, 0xfb, 0x48, 0x87, 
+	0x05, 0xed, 0x5d, 0x4e, 0x10, 0x29, 0x10, 0x22, 0x30, 0x80, 0x11, 0xff, 0xfb, 0x5b, 0x4b, 0x5b, 
+	0x4a, 0xe1, 0x18, 0x01, 0x80, 0x20, 0xab, 0x00, 0xf3, 0x58, 0x00, 0x02, 0xb3, 0x00, 0x68, 0x03, 
+	0x18, 0x18, 0xc3, 0x17, 0xdb, 0x04, 0x00, 0xdb, 0x0c, 0x1b, 0x18, 0x5b, 0x13, 0x53, 0x55, 0x00, 
+	0x01, 0x35, 0x04, 0x2d, 0xef, 0xd1, 0x53, 0x4e, 0x10, 0x77, 0x68, 0x20, 0x20, 0x31, 0x4a, 0xfb, 
+	0x51, 0x4b, 0x01, 0x77, 0x60, 0x51, 0x4e, 0xe1, 0x18, 0x2a, 0x0b, 0x7b, 0x04, 0x09, 0xf0, 0x42, 
+	0xfb, 0x4f, 0x05, 0x7d, 0x9b, 0x05, 0x00, 0x9b, 0x0d, 0x13, 0x60, 0x4e, 0x4a, 0x31, 0x68, 0x04, 
+	0x13, 0x68, 0x5b, 0x1a, 0x13, 0x03, 0x99, 0x33, 0x60, 0x50, 0x4b, 0x20, 0x83, 0x4b, 0x00, 0x77, 
+	0x30, 0xfb, 0x4a, 0x4b, 0x10, 0xe4, 0x18, 0x4a, 0x02, 0x09, 0x4a, 0x4b, 0x05, 0x94, 0x80, 0x17, 
+	0x23, 0x3d, 0xfe, 0x09, 0xf0, 0x0d, 0xfd, 0x09, 0x00, 0xf0, 0x33, 0xfd, 0x80, 0x22, 0x46, 0x4b, 
+	0x19, 0x08, 0x68, 0x46, 0x4b, 0x52, 0x07, 0xed, 0x09, 0xf0, 0x9f, 0x80, 0x00, 0x0f, 0x01, 0x21, 
+	0x92, 0x00, 0x49, 0x42, 0x43, 0x80, 0x00, 0x37, 0xe0, 0xfc, 0x01, 0x21, 0x20, 0x22, 0x49, 0x20, 
+	0x42, 0x41, 0x00, 0x0b, 0xda, 0xfc, 0x01, 0x22, 0x40, 0x80, 0x03, 0x33, 0x18, 0x4b, 0x03, 0x9a, 
+	0x1a, 0x70, 0x07, 0xc0, 0x07, 0x7b, 0x2c, 0x1f, 0x2c, 0x00, 0xd0, 0x3a, 0xe7, 0xaa, 0x00, 0x42, 
+	0xd5, 0xd2, 0x5a, 0x68, 0x05, 0xa8, 0x08, 0x20, 0x33, 0x05, 0x0b, 0xb5, 0xe7, 0xfe, 0x01, 0x23, 
+	0x14, 0x12, 0x4f, 0x3b, 0x70, 0x0c, 0x51, 0x00, 0x19, 0x01, 0x99, 0xfd, 0x10, 0xf7, 0xb0, 0xff, 
+	0x31, 0x93, 0x3c, 0x70, 0xff, 0xf7, 0x00, 0xd5, 0xfd, 0x05, 0x9b, 0xab, 0x42, 0xbd, 0xd2, 0x82, 
+	0x11, 0xd5, 0x05, 0x92, 0xaa, 0x42, 0xb8, 0x80, 0x39, 0xca, 0x2e, 0xfe, 0xf0, 0x04, 0x87, 0x52, 
+	0x06, 0x0f, 0x12, 0x2b, 0x05, 0x0b, 0x04, 0xdc, 0x12, 0x37, 0x16, 0x7f, 0x38, 0x15, 0x17, 0x1a, 
+	0x2b, 0x03, 0x93, 0x08, 0x08, 0x89, 0x00, 0x05, 0x08, 0x00, 0x03, 0x12, 0xeb, 0x08, 0x48, 0x00, 
+	0x0a, 0x00, 0x28, 0x00, 0x00, 0x8c, 0xc1, 0x03, 0x02, 0x8c, 0x10, 0xe1, 0x03, 0x02, 0x13, 0x23, 
+	0x8c, 0xb9, 0x03, 0x02, 0x42, 0xbc, 0x06, 0xbf, 0xb0, 0x10, 0x00, 0x00, 0x13, 0x8f, 0xd0, 0xa0, 
+	0x00, 0x07, 0x04, 0x00, 0x17, 0x08, 0x6e, 0x00, 0x03, 0xf0, 0xb0, 0x00, 0x0b, 0x00, 0x00, 0x0b, 
+	0x13, 0xd7, 0x10, 0x11, 0x00, 0x00, 0xdb, 0x53, 0xeb, 0x13, 0xfb, 0x1c, 0x00, 0x0f, 0x13, 0xe3, 
+	0x3c, 0x00, 0x07, 0x53, 0x27, 0x50, 0xe4, 0x00, 0x47, 0xe8, 0x00, 0x03, 0x8c, 0xeb, 0x03, 0x02, 
+	0x06, 0x90, 0xed, 0x03, 0x02, 0xd8, 0x00, 0x13, 0x0d, 0x57, 0x25, 0x10, 0x01, 0x90, 0x2c, 0x03, 
+	0x61, 0x6f, 0xfd, 0x01, 0x26, 0x04, 0x33, 0x00, 0xa3, 0x40, 0x13, 0x04, 0x8d, 0x0b, 0x43, 0x00, 
+	0x13, 0x60, 0x12, 0x4b, 0x1f, 0x00, 0x12, 0x4a, 0x00, 0x10, 0x00, 0x20, 0x37, 0xe7, 0x5d, 0xbf, 
+	0x00, 0x00, 0xdb, 0x19, 0x1f, 0x6b, 0x0f, 0x4b, 0xa1, 0x00, 0x00, 0x40, 0x30, 0x5b, 0x58, 0x8a, 
+	0x58, 0x09, 0x58, 0x00, 0x01, 0xa8, 0x00, 0xf0, 0x1a, 0xf8, 0x00, 0x28, 0x08, 0x00, 0xdb, 0x08, 
+	0x30, 0x36, 0x99, 0x01, 0x34, 0x2d, 0x00, 0x18, 0x0f, 0x2c, 0xdd, 0xd1, 0xff, 0xf7, 0x75, 0xf1, 
+	0x07, 0xf7, 0x5b, 0x7b, 0x93, 0x27, 0x10, 0xff, 0x28, 0x47, 0x38, 0x08, 0x01, 0x01, 0x01, 0x21, 
+	0x70, 0xb5, 0x14, 0x4e, 0x52, 0x01, 0x99, 0xa2, 0x11, 0xf5, 0x13, 0x01, 0x99, 0x11, 0x4c, 0x10, 
+	0x01, 0x9b, 0x20, 0xa0, 0x00, 0x0d, 0x0c, 0x00, 0x0d, 0x0f, 0x4d, 0x10, 0x22, 0x28, 0x82, 0x00, 
+	0x1d, 0x09, 0xf0, 0x05, 0xfc, 0x0d, 0x22, 0x9f, 0x09, 0x00, 0xd1, 0x1a, 0x06, 0x12, 0x0e, 0x11, 
+	0x00, 0x08, 0x00, 0x31, 0xf1, 0x54, 0xea, 0x54, 0xe2, 0x54, 0x01, 0x0a, 0x33, 0x08, 0x2b, 0xf5, 
+	0x07, 0x57, 0x06, 0x04, 0x0d, 0x5a, 0xc1, 0x04, 0x0f, 0x11, 0xbf, 0x68, 0xef, 0x03, 0x02, 0x48, 
+	0x00, 0x03, 0x58, 0x58, 0x00, 0x03, 0x69, 0x11, 0x3b, 0x01, 0x7b, 0x00, 0x23, 0x10, 0x00, 0xb5, 
+	0x83, 0x42, 0x06, 0xdb, 0x07, 0x2b, 0x01, 0x04, 0xdc, 0xca, 0x54, 0x58, 0x1c, 0x34, 0x23, 0xcc, 
+	0x5c, 0x19, 0x94, 0x42, 0xf9, 0x03, 0xfd, 0x0f, 0x0f, 0xb5, 0x50, 0x05, 0x5f, 0x00, 0x89, 0xb0, 
+	0x01, 0x93, 0x4f, 0x4b, 0x1d, 0x68, 0x40, 0x4f, 0x05, 0xa3, 0x20, 0x23, 0x14, 0x00, 0x69, 0x1c, 
+	0x00, 0xff, 0x31, 0x02, 0x91, 0x1c, 0x40, 0x1a, 0x42, 0x01, 0x42, 0xd1, 0x27, 0x00, 0x07, 0x26, 
+	0x4a, 0x00, 0x23, 0x00, 0x03, 0x93, 0x2a, 0x78, 0xef, 0x2a, 0x16, 0xdc, 0x00, 0x03, 0x99, 0x93, 
+	0x00, 0xcb, 0x18, 0x7f, 0x21, 0x00, 0x5b, 0x78, 0x01, 0x98, 0x8b, 0x43, 0x5b, 0x11, 0x00, 0x69, 
+	0x78, 0xb2, 0x43, 0xc3, 0x18, 0x9b, 0x18, 0x00, 0x89, 0x11, 0x5a, 0x5c, 0x41, 0x4b, 0x9b, 0x5c, 
+	0x08, 0x7f, 0x2b, 0x22, 0xd9, 0x0b, 0x34, 0xa9, 0xff, 0xf7, 0x10, 0xc1, 0xff, 0x04, 0x09, 0x40, 
+	0x04, 0x35, 0xab, 0x42, 0x00, 0xe1, 0xd1, 0x3b, 0x19, 0x08, 0x2b, 0x01, 0xdd, 0x00, 0x08, 0x24, 
+	0xe4, 0x1b, 0x01, 0x26, 0x00, 0x20, 0x00, 0xb4, 0x46, 0x37, 0x49, 0x02, 0x90, 0x4a, 0x68, 0x00, 
+	0x0b, 0x68, 0x01, 0x90, 0x00, 0x2c, 0x35, 0xd1, 0x24, 0x02, 0x9c, 0x12, 0x7b, 0x4a, 0x60, 0x01, 
+	0x4f, 0xd0, 0x0b, 0x22, 0x60, 0x09, 0x42, 0x8f, 0x38, 0x00, 0x04, 0x00, 0x45, 0x9e, 0x04, 0xff, 
+	0x07, 0x00, 0xdb, 0xe7, 0x09, 0xff, 0x26, 0x27, 0x00, 0x00, 0x29, 0x78, 0xef, 0x29, 0x13, 0xd8, 
+	0x6a, 0x00, 0x78, 0x07, 0x20, 0x13, 0x00, 0x81, 0x43, 0x33, 0x00, 0x40, 0x01, 0x98, 0x9b, 0x00, 
+	0xc3, 0x18, 0x5b, 0x02, 0x18, 0x92, 0x11, 0x9a, 0x5c, 0x22, 0x20, 0x7b, 0x09, 0xa1, 0x40, 0x7b, 
+	0x83, 0x60, 0x7b, 0xe4, 0xd1, 0xc0, 0xe7, 0x30, 0x49, 0x40, 0x79, 0x00, 0x49, 0xf4, 0xe7, 0x07, 
+	0x2a, 0x0e, 0xdd, 0x00, 0x19, 0x48, 0xc6, 0x5c, 0x00, 0x20, 0x87, 0x42, 0x00, 0x03, 0xdc, 0xff, 
+	0x25, 0x14, 0x48, 0x85, 0x55, 0x00, 0x08, 0xe0, 0x04, 0xad, 0x45, 0x5d, 0xb5, 0x42, 0x00, 0x11, 
+	0xd0, 0x01, 0x30, 0xf3, 0xe7, 0x60, 0x46, 0x00, 0x02, 0x90, 0x01, 0x32, 0x01, 0x9d, 0x06, 0xa8, 
+	0x00, 0x46, 0x5d, 0x0e, 0x48, 0xc6, 0x54, 0x18, 0x00, 0x00, 0x0b, 0x4d, 0x08, 0x30, 0xa8, 0x55, 
+	0x01, 0x98, 0x00, 0x01, 0x30, 0x01, 0x90, 0x01, 0x3c, 0x58, 0x1c, 0x00, 0x07, 0x28, 0x00, 0xdd, 
+	0xd8, 0x1f, 0x03, 0x00, 0x16, 0x60, 0x46, 0x9f, 0x02, 0xe3, 0x18, 0x06, 0x2f, 0x12, 0x57, 0x95, 
+	0xbc, 0x02, 0x4f, 0xe0, 0x00, 0x07, 0x11, 0x87, 0x11, 0x7b, 0x11, 0x8b, 0xe0, 0x22, 0x00, 0x0b, 
+	0x4b, 0x10, 0xb5, 0x1b, 0x68, 0x0a, 0x48, 0x00, 0x12, 0x05, 0x0a, 0x49, 0x9a, 0x18, 0x1b, 0x18, 
+	0x02, 0x14, 0x78, 0x08, 0x78, 0x84, 0x42, 0x05, 0xf3, 0x32, 0x06, 0x01, 0x31, 0x9a, 0x42, 0xf7, 
+	0x05, 0xfb, 0x31, 0x93, 0x00, 0x3b, 0x20, 0xfa, 0x00, 0x4b, 0x02, 0xd1, 0x1c, 0x73, 0x0e, 0x13, 
+	0x13, 0x11, 0xbb, 0x10, 0xcc, 0x5c, 0xc4, 0x01, 0xeb, 0x9a, 0x42, 0xfa, 0xd1, 0xa2, 0x37, 0x8f, 
+	0x80, 0x00, 0x4f, 0x1b, 0x68, 0x92, 0x0f, 0xf1, 0x10, 0x00, 0xb5, 0x9a, 0x42, 0x0a, 0xda, 0x01, 
+	0x22, 0xe0, 0x00, 0x20, 0x00, 0x24, 0xd2, 0x18, 0x00, 0x05, 0x59, 0x30, 0x1c, 0x91, 0x0a, 0xf9, 
+	0x30, 0x25, 0x03, 0x4a, 0xf3, 0xe7, 0x18, 0x1c, 0x54, 0x0b, 0x00, 0xed, 0x10, 0x4f, 0x01, 0x20, 
+	0x00, 0x00, 0x00, 0xf7, 0xb5, 0xe0, 0x20, 0x23, 0x4a, 0x24, 0x00, 0x4b, 0x00, 0x05, 0x04, 0x78, 
+	0x1b, 0x78, 0x11, 0x00, 0x78, 0x22, 0x4a, 0x1b, 0x02, 0x12, 0x78, 0x1b, 0x00, 0x19, 0x09, 0x04, 
+	0x21, 0x4f, 0x5b, 0x18, 0x12, 0x00, 0x06, 0x9b, 0x18, 0x3a, 0x78, 0x1f, 0x4e, 0x00, 0x00, 0x92, 
+	0x1f, 0x4d, 0x32, 0x78, 0x1f, 0x4c, 0x29, 0x00, 0x78, 0x8c, 0x46, 0x21, 0x78, 0x01, 0x91, 0x1e, 
+	0x00, 0x49, 0x59, 0x18, 0x01, 0x29, 0x26, 0xd8, 0x00, 0x00, 0x99, 0x12, 0x02, 0x52, 0x18, 0x61, 
+	0x46, 0x09, 0x00, 0x04, 0x8c, 0x46, 0x01, 0x99, 0x62, 0x44, 0x09, 0x00, 0x06, 0x51, 0x18, 0x8b, 
+	0x42, 0x1a, 0xd1, 0x0f, 0x08, 0x22, 0x5a, 0x40, 0x12, 0x02, 0x97, 0x02, 0x70, 0x3f, 0x00, 0x78, 
+	0x32, 0x78, 0x2d, 0x78, 0x12, 0x02, 0x21, 0x00, 0x78, 0xd2, 0x19, 0x2d, 0x04, 0x52, 0x19, 0x09, 
+	0x00, 0x06, 0x52, 0x18, 0x9b, 0x1a, 0x5a, 0x1e, 0x93, 0x00, 0x41, 0xe0, 0x22, 0x5b, 0x42, 0x12, 
+	0x02, 0xdb, 0x08, 0x03, 0x9b, 0x18, 0x0b, 0x09, 0xdf, 0xd7, 0x23, 0x03, 0x66, 0x70, 0x5f, 0xd3, 
+	0x04, 0x00, 0x0e, 0x01, 0x00, 0x03, 0x07, 0x9c, 0x0e, 0x3a, 0x00, 0x80, 0x00, 0x0b, 0x00, 0x03, 
+	0x04, 0x28, 0x0e, 0x09, 0x38, 0x0e, 0x0a, 0x29, 0xce, 0x58, 0xa8, 0x10, 0xbb, 0x11, 0x01, 0x3d, 
+	0x1c, 0x80, 0x06, 0xdd, 0x9f, 0xff, 0xe0, 0x21, 0x0f, 0x4b, 0x20, 0x00, 0x00, 0x1a, 0x68, 0x09, 
+	0x05, 0xff, 0xf7, 0x72, 0x00, 0xff, 0x23, 0x68, 0x0d, 0x4a, 0x9b, 0x18, 0x01, 0x02, 0x2b, 0x0b, 
+	0xd9, 0x0c, 0x4b, 0x23, 0x05, 0x21, 0xe0, 0x00, 0x20, 0x63, 0x60, 0x01, 0x3b, 0x0c, 0x22, 0x21, 
+	0x08, 0x00, 0xa3, 0x60, 0x00, 0x00, 0x21, 0x61, 0xff, 0x01, 0xaa, 0x13, 0x1b, 0x70, 0x5e, 0x9b, 
+	0xa4, 0x34, 0x6f, 0x02, 0x10, 0x57, 0xd7, 0x08, 0x31, 0xa7, 0x57, 0x32, 0x00, 0x0b, 0x10, 0xb5, 
+	0x02, 0x85, 0x1b, 0xff, 0xf8, 0x80, 0x22, 0x0d, 0x05, 0x31, 0x1a, 0x0b, 0x69, 0x00, 0xd2, 0xff, 
+	0x00, 0x22, 0x29, 0x20, 0x0a, 0x49, 0x00, 0xff, 0xf7, 0xa7, 0xf8, 0x00, 0x22, 0x2a, 0x20, 0x40, 
+	0x09, 0x00, 0x09, 0xa2, 0xf8, 0x5a, 0x24, 0x01, 0x3c, 0x00, 0x09, 0xf0, 0x38, 0xfa, 0x00, 0x2c, 
+	0xfa, 0xd1, 0x98, 0x10, 0x31, 0x5d, 0xf8, 0x41, 0x8b, 0x00, 0x43, 0xe3, 0xe4, 0x00, 0x31, 0x08, 
+	0xff, 0x00, 0x03, 0x18, 0x1f, 0x0a, 0x21, 0x06, 0x03, 0xbf, 0x00, 0x96, 0xfa, 0x03, 0x00, 0x30, 
+	0x33, 0x04, 0x00, 0x10, 0x2b, 0x70, 0x30, 0x00, 0x11, 0x09, 0xf0, 0x76, 0xfa, 0x06, 0x30, 0x31, 
+	0x20, 0x00, 0x69, 0x08, 0x99, 0x11, 0xe5, 0xf7, 0x82, 0x00, 0x27, 0x04, 0x00, 0x1a, 0x49, 0x16, 
+	0x0b, 0xcf, 0x09, 0x00, 0xf0, 0xb4, 0xf9, 0x28, 0x00, 0x18, 0x49, 0x09, 0xa0, 0x0c, 0x6f, 0x21, 
+	0x04, 0x81, 0xdd, 0xff, 0xe1, 0x21, 0x28, 0x22, 0x00, 0x09, 0x06, 0x95, 0x74, 0xfa, 0x3c, 0x00, 
+	0x39, 0x59, 0x02, 0xfa, 0xe7, 0x1c, 0x08, 0x00, 0x39, 0x00, 0x19, 0xd0, 0x14, 0xff, 0x28, 0x00, 
+	0x10, 0x11, 0x68, 0x20, 0x17, 0x4d, 0xfa, 0x20, 0xa7, 0x1d, 0x30, 0x17, 0xc4, 0xff, 0x20, 0x00, 
+	0x31, 0x00, 0x00, 0x0b, 0x30, 0x01, 0xf0, 0xff, 0xfc, 0x04, 0x20, 0x00, 0x06, 0x00, 0x49, 0x61, 
+	0xf9, 0x01, 0x99, 0xe0, 0x04, 0x1d, 0x01, 0xf0, 0xf7, 0xfc, 0x31, 0x65, 0x17, 0xe5, 0x0c, 0x00, 
+	0x08, 0xc0, 0x4b, 0x02, 0x4a, 0x00, 0x07, 0xf0, 0xb5, 0x04, 0x8d, 0xb0, 0x0b, 0x93, 0x62, 0x1d, 
+	0x3b, 0x93, 0x61, 0x00, 0x4b, 0x1e, 0x68, 0x03, 0x00, 0x02, 0x3b, 0x06, 0x00, 0x91, 0x59, 0x42, 
+	0x59, 0x41, 0x15, 0x68, 0x07, 0x00, 0x91, 0x06, 0x9b, 0x01, 0x99, 0x02, 0x90, 0x1b, 0x00, 0x68, 
+	0x04, 0x36, 0x49, 0x1b, 0x0b, 0x29, 0x09, 0x00, 0xdd, 0x0f, 0x2b, 0x07, 0xdd, 0x19, 0x00, 0x01, 
+	0x00, 0x9d, 0x0e, 0x39, 0x0b, 0x3d, 0xa9, 0x42, 0x01, 0x00, 0xdc, 0x0f, 0x3b, 0x1d, 0x00, 0x01, 
+	0x9b, 0x5b, 0x00, 0x1b, 0x02, 0x2b, 0x04, 0xdc, 0x01, 0x9b, 0xdd, 0x20, 0x1e, 0xeb, 0x04, 0xf5, 
+	0x1d, 0x40, 0x02, 0x20, 0x15, 0x04, 0x60, 0x43, 0x1b, 0x05, 0x93, 0x11, 0x3b, 0x08, 0x23, 0x00, 
+	0x00, 0x24, 0x22, 0x27, 0x04, 0x93, 0x33, 0x88, 0x01, 0x03, 0x93, 0x00, 0x2b, 0x39, 0xd1, 0x49, 
+	0x00, 0x63, 0x00, 0x04, 0x9b, 0xf6, 0x1a, 0x01, 0x9b, 0x48, 0x4f, 0x00, 0x9c, 0x42, 0x59, 0xd0, 
+	0x33, 0x00, 0x09, 0x9a, 0x20, 0x08, 0x99, 0x1c, 0xf1, 0x7c, 0xff, 0x39, 0x00, 0x32, 0x01, 0x20, 
+	0x03, 0x9a, 0xfe, 0xf7, 0xf3, 0xff, 0x1a, 0xbf, 0x00, 0x00, 0x22, 0x33, 0x20, 0x40, 0x49, 0xfe, 
+	0xf7, 0x40, 0xec, 0x16, 0x5b, 0x2b, 0x4a, 0xd1, 0x05, 0x9b, 0xe3, 0x08, 0x18, 0x10, 0x2b, 0x08, 
+	0x00, 0x67, 0x60, 0x1b, 0xe2, 0x80, 0x2d, 0xe1, 0x39, 0x49, 0x22, 0x30, 0xfe, 0xf7, 0xdc, 0x88, 
+	0x01, 0x9f, 0x20, 0x20, 0x37, 0x00, 0x29, 0xd7, 0xff, 0x01, 0x00, 0x34, 0x06, 0x9b, 0x04, 0x9a, 
+	0x1c, 0x60, 0x0a, 0x02, 0x98, 0x2e, 0x4b, 0x9a, 0x60, 0x0d, 0x4e, 0x3f, 0x73, 0x08, 0x88, 0x07, 
+	0x9a, 0x93, 0x0c, 0x0d, 0x02, 0x9a, 0x03, 0x01, 0x2a, 0x19, 0xd1, 0x02, 0x2b, 0x17, 0xd0, 0x10, 
+	0x4b, 0x01, 0x02, 0x3b, 0x0e, 0x2b, 0x09, 0xd8, 0x31, 0x00, 0xbf, 0x40, 0x78, 0x40, 0x4f, 0x00, 
+	0x19, 0x10, 0x31, 0xfe, 0xf7, 0x04, 0xb4, 0xff, 0x01, 0x9b, 0x9c, 0x03, 0x35, 0xb3, 0x68, 0x00, 
+	0x08, 0x93, 0x03, 0x9b, 0x0a, 0x96, 0x09, 0x93, 0x00, 0x01, 0x34, 0x03, 0x9a, 0x94, 0x46, 0x04, 
+	0x9b, 0x00, 0x63, 0x44, 0x04, 0x93, 0xb6, 0x18, 0x99, 0xe7, 0x00, 0x17, 0x4b, 0x59, 0x68, 0x33, 
+	0x00, 0x0a, 0x88, 0x02, 0x89, 0x68, 0xa2, 0xe7, 0x02, 0x9b, 0x08, 0x27, 0xd1, 0x40, 0x1a, 0x01, 
+	0xb1, 0x20, 0x20, 0xfe, 0xf7, 0x96, 0xff, 0x50, 0xbe, 0x00, 0x11, 0x02, 0x0e, 0x0b, 0x00, 0x22, 
+	0x15, 0x49, 0x40, 0xf5, 0x00, 0x0b, 0x03, 0x2b, 0xb5, 0xd1, 0x0b, 0x9b, 0x02, 0x98, 0x1b, 0x00, 
+	0x28, 0x0d, 0xdd, 0x01, 0xe4, 0x0c, 0x00, 0x01, 0xf0, 0x5b, 0xfc, 0x09, 0x4d, 0x02, 0x00, 0x00, 
+	0x0e, 0x49, 0x28, 0x00, 0x0e, 0x4b, 0x01, 0xf0, 0x40, 0x61, 0x02, 0x53, 0x29, 0x00, 0xe0, 0xe7, 
+	0x00, 0x22, 0x16, 0x0c, 0x49, 0xdd, 0x03, 0xeb, 0x8c, 0x02, 0x3f, 0x52, 0x97, 0xbc, 0xaa, 0x00, 
+	0x03, 0x2b, 0x01, 0xa3, 0x41, 0x00, 0x03, 0x47, 0x00, 0x03, 0x53, 0xaa, 0x00, 0x03, 0x5f, 0x00, 
+	0x03, 0x72, 0x00, 0x03, 0x6b, 0x00, 0x03, 0x82, 0x90, 0x00, 0x03, 0xf7, 0xb5, 0x0c, 0x2f, 0x90, 
+	0x01, 0x91, 0xff, 0x20, 0xf7, 0x74, 0x0e, 0x53, 0x40, 0x42, 0x08, 0x26, 0x01, 0x00, 0x00, 0x0e, 
+	0x4f, 0x3a, 0x68, 0x13, 0x1d, 0x92, 0x01, 0x88, 0x00, 0x2a, 0x03, 0xd1, 0xbe, 0x60, 0x36, 0x75, 
+	0x00, 0x5d, 0x88, 0xac, 0x46, 0x01, 0x9d, 0xac, 0x45, 0x00, 0x09, 0xd1, 0xdd, 0x68, 0xac, 0x46, 
+	0x00, 0x9d, 0x03, 0x01, 0x31, 0xac, 0x45, 0x03, 0xd1, 0x07, 0x68, 0x05, 0x63, 0x00, 0x23, 0x60, 
+	0x9b, 0x18, 0xb6, 0x18, 0x1a, 0x88, 0x60, 0xe6, 0x00, 0x7f, 0x10, 0x7b, 0x01, 0x4b, 0x98, 0x68, 
+	0x70, 0x80, 0x03, 0x1f, 0x08, 0xee, 0x03, 0x02, 0x07, 0xb5, 0x02, 0x04, 0x21, 0x00, 0x20, 0x01, 
+	0xaa, 0x07, 0xbb, 0xff, 0x00, 0x00, 0x28, 0x08, 0xdb, 0x05, 0x4b, 0x01, 0x9a, 0x1b, 0x00, 0x68, 
+	0xd3, 0x1a, 0x04, 0x4a, 0x53, 0x60, 0x03, 0x40, 0xb0, 0x12, 0x4d, 0x01, 0x23, 0x5b, 0x42, 0xf7, 
+	0xe7, 0x80, 0x50, 0xb3, 0xf0, 0xb5, 0x41, 0x4f, 0xbb, 0x68, 0x87, 0x08, 0xb0, 0xfd, 0x68, 0x3c, 
+	0x06, 0x1d, 0x7b, 0x68, 0x16, 0x02, 0x00, 0x04, 0x93, 0x05, 0x90, 0x02, 0x00, 0x9f, 0x24, 0x02, 
+	0xfe, 0x21, 0x00, 0x03, 0x9a, 0x28, 0x02, 0x72, 0xd9, 0x00, 0xfe, 0x2b, 0x1d, 0x01, 0x93, 0xab, 
+	0x88, 0x00, 0x00, 0x93, 0xeb, 0x88, 0x00, 0x22, 0x04, 0x34, 0xb3, 0x00, 0x42, 0x05, 0xd0, 0x72, 
+	0x1c, 0x40, 0xd1, 0x02, 0x40, 0x3b, 0x1e, 0x51, 0x5a, 0x42, 0x05, 0x9b, 0x9a, 0x42, 0x10, 0x02, 
+	0xda, 0x00, 0x01, 0x59, 0x39, 0xd1, 0x03, 0x9b, 0x08, 0x00, 0x9a, 0x9e, 0x1a, 0x11, 0x65, 0x0c, 
+	0xd1, 0x04, 0x08, 0x9b, 0x1d, 0x88, 0x2a, 0x02, 0xa9, 0x76, 0x19, 0x9e, 0x00, 0x42, 0x24, 0xd8, 
+	0x20, 0x00, 0x2a, 0x00, 0x04, 0x00, 0x99, 0x08, 0xf0, 0xb2, 0xfe, 0x64, 0x19, 0x00, 0xa0, 0x01, 
+	0x9f, 0x01, 0x01, 0x9f, 0x02, 0x93, 0x01, 0x9b, 0x9d, 0x00, 0x5a, 0x00, 0x2d, 0x30, 0xd1, 0x01, 
+	0x23, 0x32, 0x00, 0x00, 0x5b, 0x42, 0x63, 0x60, 0x1d, 0x4b, 0x08, 0x00, 0x32, 0x25, 0x60, 0x9a, 
+	0x60, 0x1c, 0x4b, 0xa4, 0x00, 0x1b, 0x19, 0x68, 0x91, 0x42, 0x2e, 0xd8, 0xe0, 0x14, 0x20, 0x39, 
+	0x68, 0x14, 0x0d, 0x5a, 0x0d, 0xa5, 0x90, 0xff, 0x03, 0x01, 0x23, 0x02, 0x93, 0x02, 0x98, 0x18, 
+	0xed, 0x2b, 0x27, 0x00, 0x22, 0x52, 0x42, 0xbf, 0xe7, 0x00, 0x99, 0x8c, 0x04, 0x46, 0x00, 0x9b, 
+	0xe4, 0x18, 0x10, 0x51, 0x01, 0x93, 0x60, 0x1b, 0x00, 0xa7, 0x02, 0xe3, 0x88, 0x9e, 0x42, 0x03, 
+	0xd0, 0x10, 0x71, 0x1c, 0xb0, 0x02, 0x3f, 0xae, 0xd0, 0x01, 0x32, 0x14, 0xac, 0xe7, 0x2a, 0x05, 
+	0x92, 0x02, 0x00, 0x7f, 0x72, 0xfe, 0x00, 0x02, 0x9b, 0x5b, 0x19, 0x64, 0x19, 0x02, 0x93, 0x00, 
+	0x1d, 0x88, 0xc1, 0xe7, 0xa5, 0x54, 0x01, 0x32, 0x70, 0xca, 0x41, 0x47, 0x11, 0x0f, 0x08, 0x4b, 
+	0x24, 0x01, 0x94, 0xff, 0x00, 0xf7, 0xa5, 0xfd, 0x1a, 0x4d, 0x23, 0x00, 0x69, 0x28, 0x46, 0x02, 
+	0x01, 0x4b, 0x2c, 0x09, 0x9f, 0x43, 0xfe, 0x00, 0x00, 0x9b, 0xa3, 0x42, 0x26, 0xd0, 0x20, 0x00, 
+	0x01, 0x00, 0xf0, 0x57, 0xf9, 0x04, 0x26, 0xf4, 0x27, 0x00, 0x00, 0x98, 0xfe, 0xf7, 0xfa, 0xfd, 
+	0x04, 0x00, 0x30, 0x02, 0x42, 0x0b, 0xd0, 0x01, 0x22, 0x28, 0x0f, 0x81, 0xff, 0x00, 0xf7, 0x58, 
+	0xff, 0x00, 0x9b, 0x29, 0x68, 0x5a, 0x08, 0x1e, 0x8a, 0x42, 0x01, 0x01, 0x1d, 0x2b, 0x60, 0x3c, 
+	0x91, 0x01, 0x29, 0x00, 0x23, 0x30, 0x45, 0xff, 0xf7, 0x21, 0x00, 0x43, 0x40, 0x00, 0x0e, 0xcb, 
+	0x04, 0x4b, 0x1c, 0x42, 0xdf, 0xd0, 0xb6, 0x02, 0x59, 0xf9, 0x33, 0xdf, 0x12, 0x43, 0x02, 0x05, 
+	0x40, 0x10, 0x7b, 0x05, 0x41, 0x00, 0x10, 0x7d, 0x66, 0xfd, 0x16, 0x4e, 0x2b, 0x00, 0x7d, 0x01, 
+	0x03, 0x20, 0x01, 0x27, 0x01, 0xaa, 0x34, 0x00, 0x7f, 0x08, 0x03, 0xfe, 0x7f, 0x42, 0x10, 0x71, 
+	0xc1, 0xfd, 0x04, 0x08, 0x23, 0x04, 0x00, 0x18, 0x00, 0x73, 0x3a, 0x00, 0x01, 0x2a, 0x21, 0x30, 
+	0x05, 0x55, 0x1e, 0x00, 0x73, 0x31, 0x60, 0x73, 0x33, 0x0e, 0x60, 0xf4, 0x23, 0x1c, 0x00, 0x75, 
+	0x40, 0x3d, 0x00, 0x75, 0xe6, 0x52, 0xfd, 0x10, 0x6f, 0xe0, 0x0e, 0x5f, 0x3b, 0xfd, 0xb0, 0x6f, 
+	0x3a, 0x80, 0x01, 0x9b, 0xf7, 0xb5, 0x1b, 0x01, 0x49, 0xd5, 0x0f, 0x08, 0x22, 0xff, 0x21, 0x38, 
+	0x08, 0xa3, 0x1a, 0x40, 0x37, 0x80, 0x00, 0x05, 0x37, 0x4c, 0x5b, 0x01, 0x0b, 0x40, 0x21, 0x02, 
+	0x79, 0x13, 0x43, 0x00, 0x22, 0x8b, 0x0f, 0x85, 0x23, 0x00, 0x71, 0x01, 0x32, 0x33, 0x4b, 0x19, 
+	0x78, 0x03, 0x02, 0x23, 0x60, 0x20, 0x19, 0x40, 0x32, 0x00, 0x21, 0x5b, 0x02, 0x01, 0x03, 0x40, 
+	0x19, 0x43, 0x30, 0x00, 0x09, 0x5f, 0x00, 0x38, 0x03, 0x40, 0x5d, 0x42, 0x6b, 0x41, 0x1b, 0x04, 
+	0x01, 0x0b, 0x43, 0x61, 0x79, 0x10, 0x2d, 0x02, 0x00, 0x00, 0x63, 0x71, 0x2b, 0x4e, 0xa1, 0x68, 
+	0x33, 0x69, 0x00, 0x99, 0x42, 0x1a, 0xd0, 0xa3, 0x60, 0x29, 0x4d, 0x00, 0x68, 0x68, 0x03, 0x28, 
+	0x1a, 0xdd, 0x2b, 0x68, 0x00, 0x98, 0x42, 0x17, 0xd2, 0xe0, 0x23, 0x1b, 0x05, 0x10, 0xc0, 0x18, 
+	0x30, 0x05, 0xe3, 0xff, 0xf7, 0x71, 0xfc, 0x50, 0x23, 0x00, 0x41, 0x01, 0x09, 0x17, 0x30, 0x68, 
+	0x6b, 0x68, 0x90, 0x10, 0x13, 0xc0, 0x18, 0x00, 0xfb, 0xfc, 0x01, 0xe0, 0x00, 0x18, 0x2a, 0xe3, 
+	0xd1, 0x30, 0xab, 0x52, 0xcd, 0x63, 0xfe, 0x00, 0x08, 0x28, 0x01, 0xda, 0x73, 0x04, 0xf5, 0x01, 
+	0x9b, 0x86, 0x10, 0xcc, 0x86, 0xc3, 0x90, 0x03, 0x00, 0x28, 0xe8, 0xda, 0x04, 0x00, 0x21, 0x02, 
+	0x22, 0x08, 0x00, 0x53, 0x97, 0xfe, 0x20, 0x01, 0xaa, 0x10, 0x33, 0xff, 0xf7, 0x4a, 0xfe, 0x33, 
+	0x00, 0x68, 0x01, 0x9a, 0xd3, 0x1a, 0x6b, 0x60, 0xd9, 0xa9, 0x01, 0xdf, 0x6c, 0x00, 0xf3, 0x49, 
+	0x09, 0x4f, 0xc6, 0x5e, 0x0a, 0x77, 0xab, 0x03, 0x27, 0xba, 0x00, 0x0f, 0xbb, 0x00, 0x03, 0x75, 
+	0x00, 0x13, 0x51, 0xfb, 0x80, 0x16, 0x4f, 0x00, 0x22, 0x10, 0xb5, 0x04, 0x4b, 0x1a, 0x00, 0x61, 
+	0xff, 0xf7, 0x70, 0xff, 0xff, 0xf7, 0x2a, 0x54, 0xfc, 0x96, 0x7b, 0x21, 0x01, 0x2f, 0x37, 0x01, 
+	0x2f, 0x2e, 0xd5, 0x80, 0x50, 0x95, 0x18, 0xfe, 0x1d, 0x49, 0x00, 0x28, 0x29, 0x00, 0xdb, 0x1d, 
+	0x4a, 0x01, 0x9b, 0x12, 0x68, 0x1c, 0x00, 0x48, 0x9a, 0x1a, 0x42, 0x60, 0x0f, 0x20, 0x1a, 0x00, 
+	0x79, 0x1b, 0x4c, 0x10, 0x40, 0x20, 0x70, 0x1a, 0x00, 0x48, 0x52, 0x11, 0x02, 0x70, 0x5a, 0x79, 
+	0x03, 0x00, 0x24, 0x15, 0x00, 0x18, 0x48, 0x25, 0x40, 0x05, 0x00, 0x70, 0x50, 0x11, 0x20, 0x40, 
+	0x17, 0x4c, 0x20, 0x00, 0x70, 0x01, 0x20, 0x12, 0x09, 0x90, 0x43, 0x02, 0x00, 0x00, 0x15, 0x48, 
+	0x02, 0x70, 0x0a, 0x00, 0x13, 0x15, 0xcb, 0x13, 0xc2, 0x90, 0x03, 0x37, 0x20, 0x73, 0x0a, 0x04, 
+	0x6f, 0x81, 0xd0, 0x19, 0xff, 0xf7, 0x25, 0xff, 0xef, 0xe7, 0x10, 0xcb, 0xf4, 0x10, 0xc3, 0x50, 
+	0xb7, 0x50, 0xd7, 0x90, 0xd3, 0x78, 0x0a, 0xaf, 0x15, 0x4b, 0x00, 0x70, 0xb5, 0x04, 0x00, 0x98, 
+	0x42, 0x10, 0xd9, 0x08, 0x43, 0x78, 0x05, 0x78, 0x05, 0xf4, 0x43, 0x85, 0x78, 0x00, 0x2d, 0x04, 
+	0x2b, 0x43, 0xc5, 0x78, 0x04, 0x22, 0x00, 0x2d, 0x06, 0x0f, 0x49, 0x04, 0x38, 0x1d, 0x43, 0x00, 
+	0x08, 0xf0, 0xc4, 0xfc, 0x00, 0x28, 0x11, 0xd0, 0x51, 0x80, 0x0d, 0x07, 0xdb, 0x0d, 0x05, 0x62, 
+	0x78, 0x23, 0x08, 0x01, 0x00, 0x1a, 0x43, 0xa3, 0x78, 0x1b, 0x04, 0x1a, 0x43, 0x00, 0xe3, 0x78, 
+	0x1b, 0x06, 0x13, 0x43, 0x80, 0x34, 0x01, 0xed, 0x18, 0x8c, 0x42, 0xf1, 0xd1, 0x28, 0x4f, 0x27, 
+	0x90, 0x02, 0x3a, 0x02, 0x9b, 0x04, 0xcb, 0x7f, 0xb5, 0x05, 0x00, 0x00, 0x16, 0x4c, 0x10, 0x00, 
+	0x62, 0x68, 0x0e, 0x00, 0x00, 0x00, 0x93, 0x29, 0x00, 0x30, 0x32, 0x03, 0xab, 0x00, 0xfd, 0xf7, 
+	0x14, 0xfe, 0x03, 0x22, 0x03, 0x9b, 0x00, 0x64, 0x68, 0x33, 0x33, 0x93, 0x43, 0x23, 0x80, 0x00, 
+	0x0f, 0x4b, 0x65, 0x60, 0x1b, 0x68, 0x0f, 0x4d, 0x00, 0xa3, 0x60, 0x66, 0x80, 0x28, 0x68, 0xfe, 
+	0xf7, 0x00, 0x9b, 0xfd, 0x40, 0x30, 0xff, 0xf7, 0xb2, 0xff, 0x80, 0x09, 0x01, 0x78, 0xe0, 0x60, 
+	0x0b, 0x49, 0x10, 0x34, 0x09, 0x00, 0x2b, 0x03, 0xd1, 0x10, 0x19, 0x8e, 0xfd, 0x0e, 0xa3, 0x8a, 
+	0x04, 0x6d, 0x0c, 0xfe, 0x7f, 0x81, 0x73, 0x60, 0x09, 0x8f, 0x44, 0xa8, 0x00, 0xcf, 0x44, 0x00, 
+	0x0b, 0x4c, 0x43, 0x9f, 0x1f, 0x4d, 0xe8, 0x40, 0x68, 0x13, 0x25, 0x03, 0xfa, 0x2b, 0x68, 0xea, 
+	0x68, 0xa4, 0x12, 0x49, 0xba, 0x01, 0xab, 0xcc, 0xfb, 0x33, 0xb1, 0x01, 0xaa, 0x24, 0x01, 0x20, 
+	0x13, 0xb1, 0x6a, 0xfc, 0x09, 0x32, 0xf0, 0x81, 0x0a, 0xff, 0x01, 0x26, 0x04, 0x23, 0xab, 0x24, 
+	0x07, 0x5d, 0x30, 0x33, 0x42, 0x08, 0x06, 0xa7, 0x33, 0xab, 0x82, 0xfd, 0x02, 0x51, 0x0b, 0xe9, 
+	0x10, 0xde, 0xfb, 0x3c, 0x06, 0x6b, 0x00, 0x22, 0x31, 0x00, 0x4c, 0x28, 0x03, 0x4d, 0x77, 0xfd, 
+	0x33, 0x3f, 0x13, 0xb5, 0x30, 0x00, 0x88, 0x11, 0xe3, 0x46, 0xfc, 0x05, 0x03, 0x3f, 0xdd, 0xd0, 
+	0x00, 0x1d, 0xf0, 0x83, 0xff, 0x32, 0x93, 0x10, 0x97, 0x13, 0x43, 0x03, 0x01, 0x08, 0x00, 0x70, 
+	0xb5, 0x80, 0x25, 0x0c, 0x4e, 0x0d, 0x4b, 0x00, 0x1c, 0x68, 0x33, 0x68, 0xad, 0x01, 0x1c, 0x19, 
+	0x30, 0x2a, 0x00, 0x10, 0xc5, 0x00, 0x9b, 0xfb, 0x28, 0x00, 0xf3, 0x20, 0x68, 0x22, 0x03, 0xa3, 
+	0xff, 0xf7, 0x6b, 0xff, 0x80, 0x00, 0x20, 0x01, 0x22, 0x00, 0x21, 0x40, 0x02, 0xff, 0x1a, 0xf7, 
+	0x47, 0xfd, 0x31, 0x43, 0x51, 0xbb, 0x06, 0x09, 0x1b, 0x18, 0xb0, 0x00, 0x77, 0x29, 0x07, 0x15, 
+	0x10, 0x95, 0xef, 0xfc, 0xc0, 0x43, 0x2a, 0xc0, 0x0f, 0x3a, 0x4d, 0x40, 0x00, 0xf7, 0x70, 0x01, 
+	0x63, 0x00, 0x20, 0x24, 0x0a, 0x02, 0x79, 0xa3, 0x42, 0x05, 0xdc, 0x01, 0x30, 0x24, 0x64, 0x0c, 
+	0x5f, 0x30, 0x41, 0x20, 0x00, 0xfe, 0xf7, 0x20, 0xf4, 0xfc, 0x11, 0x4d, 0x0b, 0xff, 0xa8, 0x42, 
+	0xf3, 0x0b, 0xd0, 0x01, 0x34, 0xeb, 0x02, 0xe7, 0x90, 0x25, 0xd3, 0x03, 0xcb, 0x00, 0x68, 0x05, 
+	0x00, 0x87, 0xb0, 0x01, 0x20, 0x1b, 0x00, 0x01, 0x35, 0xd5, 0x35, 0x4b, 0x9e, 0x68, 0x00, 0x24, 
+	0x2e, 0x01, 0x0a, 0xa5, 0x2f, 0xe0, 0x04, 0x33, 0x00, 0x04, 0x80, 0x00, 0xd5, 0xbb, 0xfc, 0x04, 
+	0x1e, 0x37, 0xdb, 0x30, 0x00, 0x4f, 0x30, 0x22, 0x04, 0x99, 0x78, 0x68, 0x08, 0x00, 0xf0, 0xe7, 
+	0xfb, 0x2e, 0x4b, 0x18, 0x68, 0xe0, 0x00, 0x23, 0x80, 0x26, 0x1b, 0x05, 0x7a, 0x68, 0xc0, 0x02, 
+	0x18, 0xfb, 0x68, 0xb6, 0x01, 0x31, 0x01, 0xd5, 0x30, 0x20, 0x32, 0x05, 0x01, 0xd3, 0x2a, 0xfd, 
+	0x03, 0x21, 0x05, 0x20, 0x9b, 0x7a, 0x01, 0xd3, 0x8b, 0x43, 0x04, 0x92, 0x20, 0x00, 0x00, 0x13, 
+	0x80, 0x56, 0x60, 0x00, 0x21, 0x01, 0x0a, 0x22, 0xff, 0xf7, 0xdf, 0x00, 0x47, 0x10, 0x01, 0x45, 
+	0x3b, 0x01, 0xfb, 0x00, 0x2d, 0x04, 0xd1, 0x00, 0x20, 0x55, 0x99, 0x00, 0x04, 0x9b, 0x18, 0x88, 
+	0xff, 0xf7, 0x96, 0xfd, 0x80, 0x11, 0x0b, 0xb7, 0xff, 0xf3, 0xe7, 0xff, 0xf7, 0x52, 0x08, 0xfe, 
+	0xbe, 0xe7, 0x30, 0x00, 0x0d, 0x96, 0xff, 0x04, 0x00, 0x1e, 0xb9, 0xdb, 0x13, 0x4f, 0x14, 0x4e, 
+	0x3b, 0x08, 0x68, 0x02, 0x93, 0x33, 0x06, 0x75, 0xfe, 0xf7, 0x90, 0x01, 0xfc, 0x0e, 0x4b, 0x40, 
+	0x30, 0x30, 0x60, 0x10, 0x81, 0xa8, 0x14, 0x1f, 0x3c, 0x01, 0xbf, 0x52, 0x08, 0x47, 0x3b, 0x60, 
+	0x03, 0x02, 0x9b, 0x04, 0x1e, 0x33, 0x60, 0xdf, 0x00, 0x61, 0x0a, 0x80, 0x00, 0x61, 0xce, 0xd0, 
+	0x03, 0x4b, 0x5b, 0x68, 0x04, 0x38, 0x93, 0xd0, 0xe3, 0x03, 0x12, 0x23, 0x11, 0x2f, 0x7f, 0xb5, 
+	0x1e, 0x80, 0x00, 0xfb, 0x1b, 0x01, 0x05, 0xd5, 0x1d, 0x4d, 0x2b, 0x03, 0x68, 0x00, 0x2b, 0x04, 
+	0xd1, 0x1c, 0x0a, 0xb1, 0x32, 0x51, 0x62, 0x1a, 0x00, 0xe1, 0x17, 0x77, 0x03, 0x21, 0x02, 0x01, 
+	0x01, 0x3a, 0x80, 0x02, 0xf7, 0x20, 0xdb, 0x00, 0x24, 0x02, 0x98, 0x15, 0x00, 0x4e, 0x01, 0x88, 
+	0x00, 0x94, 0x30, 0x39, 0xf2, 0x00, 0x68, 0x03, 0xab, 0x30, 0x30, 0x03, 0x91, 0xfd, 0x82, 0x06, 
+	0xfb, 0x01, 0x23, 0x03, 0x98, 0x03, 0x07, 0x9e, 0xd2, 0x00, 0x18, 0x23, 0x00, 0xf1, 0x68, 0x2d, 
+	0x68, 0x52, 0x00, 0x00, 0x9a, 0x42, 0x05, 0xd1, 0x12, 0x21, 0x08, 0x00, 0xf0, 0xa8, 0xfd, 0x07, 
+	0x4b, 0x18, 0x60, 0xd5, 0x00, 0xe7, 0xcc, 0x5a, 0xec, 0x52, 0x02, 0x33, 0xf3, 0xab, 0x08, 0x09, 
+	0x03, 0x0d, 0xbf, 0xcd, 0x44, 0x63, 0x2c, 0x00, 0x03, 0x0e, 0xfe, 0x6a, 0x02, 0x10, 0x8b, 0x10, 
+	0x9b, 0x1d, 0x00, 0x8d, 0x13, 0x04, 0x33, 0x2c, 0x20, 0xd5, 0x07, 0x08, 0x6f, 0xbc, 0xfb, 0x00, 
+	0x22, 0x1a, 0x22, 0x49, 0x29, 0x00, 0x09, 0x59, 0xfb, 0x19, 0x20, 0x8d, 0x2d, 0xc0, 0x00, 0x8d, 
+	0x12, 0x65, 0xf3, 0xfb, 0x04, 0x1e, 0x01, 0xda, 0x05, 0x80, 0x24, 0x64, 0x02, 0x14, 0x00, 0x31, 
+	0x00, 0x08, 0xf3, 0x00, 0x12, 0x20, 0x12, 0x4a, 0x58, 0x43, 0x12, 0x4b, 0x05, 0x03, 0x21, 0x12, 
+	0x68, 0xdb, 0x00, 0x29, 0x48, 0x03, 0x57, 0x2c, 0x00, 0x21, 0x11, 0x4f, 0x25, 0x00, 0xb9, 0x12, 
+	0xb9, 0x81, 0xfa, 0x44, 0x02, 0x00, 0x49, 0xf8, 0xfa, 0x13, 0x3a, 0xc9, 0x23, 0x5b, 0x02, 0x02, 
+	0x9c, 0x42, 0xf5, 0xda, 0x03, 0x0e, 0x99, 0xeb, 0xbe, 0x21, 0x1f, 0xa0, 0x03, 0xa3, 0x10, 0x87, 
+	0x10, 0x8f, 0x10, 0x97, 0x10, 0x8f, 0x19, 0x82, 0x24, 0xc3, 0x00, 0x24, 0x1b, 0x01, 0x24, 0x20, 
+	0x91, 0x73, 0x08, 0xfb, 0x22, 0x00, 0x15, 0x20, 0x91, 0x10, 0xfb, 0x14, 0xc0, 0x03, 0x57, 0x06, 
+	0xc3, 0xf8, 0x21, 0x00, 0xea, 0x68, 0x2b, 0x88, 0x00, 0x09, 0x0f, 0xfe, 0x11, 0x20, 0xa3, 0xdb, 
+	0xfd, 0x21, 0x84, 0x23, 0x09, 0xa1, 0xfb, 0xa0, 0x42, 0x00, 0xa3, 0x20, 0x40, 0xd4, 0x05, 0x25, 
+	0x12, 0xab, 0xe1, 0x00, 0xb3, 0x05, 0x00, 0x87, 0x3d, 0xfa, 0x18, 0x20, 0x00, 0x3e, 0x21, 0xf5, 
+	0x10, 0x8f, 0xb0, 0xfa, 0x01, 0x2e, 0x24, 0xf6, 0x20, 0x7f, 0xb5, 0x00, 0x7f, 0x10, 0x73, 0x10, 
+	0x83, 0x05, 0xab, 0x42, 0xe7, 0xb5, 0x06, 0x8d, 0x18, 0x05, 0x5d, 0xc1, 0x45, 0x59, 0x51, 0x27, 
+	0x11, 0x1f, 0xb5, 0x18, 0x21, 0xb7, 0x25, 0xd5, 0x17, 0x04, 0x19, 0x04, 0x9b, 0x07, 0x21, 0xd5, 
+	0x16, 0x20, 0x7b, 0x9d, 0xfd, 0x40, 0x01, 0x21, 0xad, 0x63, 0xfb, 0x13, 0x4c, 0x00, 0x28, 0x00, 
+	0x19, 0xdb, 0x00, 0x23, 0x02, 0x98, 0x01, 0x88, 0x54, 0x22, 0x12, 0x99, 0x39, 0x01, 0xab, 0xab, 
+	0x11, 0xad, 0x4d, 0xfd, 0x44, 0x0d, 0x32, 0xbb, 0x22, 0x1b, 0x05, 0x16, 0x43, 0x92, 0x01, 0x81, 
+	0x07, 0xaf, 0xf9, 0xff, 0xf7, 0xc5, 0xff, 0x1f, 0x20, 0x63, 0x8b, 0x11, 0x33, 0x2b, 0xfe, 0xec, 
+	0x20, 0x93, 0x64, 0x42, 0x27, 0x2d, 0x9b, 0x92, 0x2d, 0x57, 0x10, 0xb5, 0x06, 0x73, 0xfe, 0x0c, 
+	0x20, 0x75, 0x12, 0x02, 0xd5, 0xff, 0xf7, 0xfe, 0xfc, 0x0a, 0x60, 0x4d, 0xc0, 0x14, 0x18, 0x08, 
+	0x49, 0x10, 0x4d, 0x1c, 0x00, 0x4d, 0x9e, 0xff, 0x40, 0x01, 0x06, 0x55, 0x51, 0xfe, 0xff, 0xf7, 
+	0xa9, 0xff, 0xf0, 0x30, 0xbb, 0x10, 0x4b, 0x2d, 0xeb, 0x00, 0x4b, 0x7f, 0xb5, 0x0c, 0x00, 0x11, 
+	0x00, 0x23, 0x05, 0x03, 0xfb, 0x0c, 0x4e, 0x09, 0x08, 0x81, 0x02, 0x30, 0x39, 0x03, 0xab, 0xf2, 
+	0x68, 0x32, 0x4d, 0xfd, 0x34, 0xfc, 0x28, 0x02, 0x43, 0x1b, 0x29, 0x4c, 0x00, 0x3d, 0xae, 0xfe, 
+	0x33, 0xa2, 0x68, 0x06, 0x61, 0x02, 0xe1, 0xc1, 0xff, 0x32, 0x97, 0x54, 0xe7, 0x44, 0xf0, 0x01, 
+	0x97, 0x85, 0xb0, 0x02, 0x17, 0xff, 0xf9, 0x2e, 0x22, 0x4e, 0x23, 0x18, 0xaf, 0xaa, 0x03, 0xa9, 
+	0x17, 0xfd, 0x04, 0x00, 0xfa, 0x03, 0x9b, 0x05, 0x00, 0xa3, 0x42, 0x29, 0x80, 0x08, 0x7f, 0x00, 
+	0xf0, 0x17, 0xfd, 0x01, 0x27, 0x03, 0x88, 0x04, 0xd1, 0xbb, 0xf9, 0x02, 0x0a, 0xa2, 0x3a, 0x40, 
+	0x38, 0x00, 0x42, 0x36, 0xd0, 0x23, 0x4b, 0xe8, 0x68, 0x1b, 0x02, 0x68, 0x83, 0x42, 0x1c, 0xd1, 
+	0x22, 0x00, 0xbd, 0x00, 0x09, 0x28, 0x1b, 0xdb, 0x29, 0x00, 0xf5, 0xb4, 0xff, 0x14, 0xcd, 0x41, 
+	0x06, 0x04, 0xcd, 0x02, 0xaa, 0x18, 0x00, 0x03, 0x0f, 0x3f, 0x0d, 0xdf, 0xf9, 0x05, 0x00, 0x09, 
+	0xa3, 0x08, 0x85, 0x19, 0x04, 0xd5, 0x44, 0xdb, 0x04, 0xd5, 0x18, 0xfd, 0x05, 0x4f, 0xab, 0xff, 
+	0xf7, 0x09, 0xc8, 0xfd, 0xe1, 0xe7, 0x11, 0xc3, 0xce, 0xf9, 0x1d, 0x43, 0x40, 0x11, 0x0b, 0xa3, 
+	0x05, 0xfa, 0x3c, 0x23, 0x01, 0x93, 0x00, 0x08, 0xf0, 0x9b, 0xfb, 0x01, 0x9b, 0x01, 0x3b, 0x40, 
+	0x01, 0x0c, 0x13, 0xf8, 0xd1, 0xd4, 0xe7, 0x04, 0x23, 0x02, 0x18, 0x42, 0xd1, 0xd0, 0x39, 0x00, 
+	0x18, 0x7f, 0xde, 0xd2, 0x00, 0x9b, 0x38, 0x7f, 0xc8, 0x28, 0x7f, 0xc5, 0xe7, 0x15, 0x1b, 0x34, 
+	0xd9, 0x43, 0x93, 0x15, 0x23, 0xc8, 0x02, 0x07, 0x01, 0x5f, 0x68, 0x07, 0x03, 0x07, 0x02, 0x03, 
+	0xd4, 0x00, 0x20, 0x03, 0xb0, 0x12, 0x2b, 0x09, 0x98, 0x21, 0xdf, 0xad, 0xfc, 0x04, 0x47, 0x01, 
+	0xdf, 0x73, 0xfa, 0x00, 0x2b, 0x28, 0xf1, 0x1a, 0xad, 0x99, 0x10, 0x15, 0x58, 0x01, 0x6b, 0x32, 
+	0xc3, 0xd4, 0x11, 0xab, 0x10, 0x47, 0x02, 0x00, 0x2d, 0x80, 0x04, 0x1b, 0x18, 0x40, 0x20, 0x70, 
+	0x47, 0x10, 0x17, 0x10, 0xb5, 0x0f, 0x48, 0x0f, 0x00, 0x49, 0x03, 0x78, 0x0a, 0x68, 0x0f, 0x4c, 
+	0x01, 0x00, 0x33, 0x1b, 0x06, 0x1b, 0x0e, 0x14, 0x43, 0x03, 0x00, 0x70, 0x0c, 0x60, 0x01, 0x2b, 
+	0x07, 0xd1, 0x9a, 0x42, 0x43, 0x13, 0x0b, 0x1a, 0x43, 0x0a, 0x60, 0x31, 0xa7, 0x02, 0xc6, 0x06, 
+	0x61, 0x0e, 0x47, 0x40, 0x01, 0x23, 0x0f, 0x4b, 0x0e, 0xbb, 0xf3, 0xaa, 0x03, 0xab, 0xb8, 0x00, 
+	0x43, 0x24, 0x0f, 0xe7, 0x01, 0x05, 0xaf, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x10, 0xb5, 0x10, 0x48, 
+	0x10, 0x2a, 0x49, 0x43, 0x00, 0x4f, 0x10, 0x60, 0x4f, 0x43, 0x20, 0x4f, 0x08, 0x68, 0xd1, 0x0f, 
+	0xbb, 0x00, 0x51, 0x9b, 0xa0, 0x51, 0x04, 0xd1, 0x07, 0x00, 0x48, 0x02, 0x40, 0x13, 0x43, 0x0b, 
+	0x60, 0xf5, 0x8a, 0x00, 0x53, 0x43, 0x70, 0xf2, 0x80, 0x53, 0x02, 0x02, 0x12, 0xff, 0x01, 0xff, 
+	0xfd, 0xff, 0x0f, 0x4a, 0x93, 0x78, 0x30, 0x4b, 0x10, 0x93, 0x70, 0x01, 0x00, 0x83, 0x0c, 0x4b, 
+	0x0d, 0x4a, 0x10, 0x1a, 0x60, 0x70, 0x00, 0x3d, 0x02, 0xd1, 0x09, 0x4b, 0x05, 0x0b, 0x4a, 0xf8, 
+	0xe7, 0x03, 0x00, 0x15, 0xfe, 0x0e, 0xe3, 0x10, 0xd2, 0x05, 0xf2, 0x00, 0x0b, 0xf1, 0xd9, 0x04, 
+	0x4b, 0x13, 0x06, 0x49, 0x19, 0x0f, 0x09, 0x93, 0x70, 0x15, 0xcb, 0x10, 0x4f, 0x04, 0x60, 0x68, 
+	0x00, 0x03, 0xa0, 0x01, 0x50, 0xe0, 0xa5, 0x00, 0x01, 0x00, 0x50, 0x46, 0x00, 0x00, 0x05, 0x4a, 
+	0x40, 0x13, 0x40, 0x53, 0x02, 0x2b, 0x01, 0xd8, 0x13, 0x70, 0x05, 0x70, 0x47, 0x00, 0x23, 0xfb, 
+	0x00, 0x2b, 0xb2, 0x02, 0x3f, 0x82, 0x0b, 0x1b, 0x4a, 0x11, 0x78, 0x8b, 0x43, 0x10, 0x15, 0xc4, 
+	0x80, 0x08, 0x0f, 0x80, 0x23, 0x03, 0x4a, 0x11, 0x68, 0xdb, 0x09, 0x00, 0x4b, 0x40, 0x13, 0x00, 
+	0x75, 0xc0, 0x46, 0x10, 0x9b, 0x50, 0x07, 0x60, 0x3f, 0x01, 0x60, 0x3f, 0x13, 0x70, 0x01, 0x22, 
+	0x5b, 0x02, 0x0f, 0x67, 0xf8, 0x00, 0x47, 0x18, 0x3b, 0x74, 0x00, 0x03, 0x10, 0x4b, 0x06, 0xd1, 
+	0x78, 0x4b, 0x40, 0xd3, 0x00, 0x21, 0x10, 0x87, 0x02, 0xaa, 0xc0, 0x0f, 0x20, 0x10, 0x6b, 0x68, 
+	0x30, 0x59, 0x48, 0x00, 0x2f, 0x80, 0x20, 0x22, 0x08, 0x01, 0xe1, 0x92, 0x05, 0x98, 0x18, 0xe0, 
+	0x80, 0x09, 0x41, 0x12, 0x06, 0x90, 0x42, 0x02, 0xd3, 0xc0, 0x21, 0x22, 0xd2, 0x00, 0x0f, 0x08, 
+	0xf0, 0x17, 0xfb, 0x31, 0x35, 0x91, 0x10, 0x7f, 0x10, 0xb5, 0x70, 0x81, 0x04, 0x2b, 0x05, 0x00, 
+	0x81, 0x08, 0x08, 0xf0, 0x85, 0xfa, 0x30, 0x1f, 0x00, 0x23, 0xf7, 0x62, 0xe7, 0x18, 0xc7, 0x05, 
+	0x51, 0x21, 0x10, 0xb5, 0x1f, 0xf9, 0x06, 0x94, 0x20, 0x2b, 0x0b, 0x40, 0x10, 0x25, 0x7a, 0x40, 
+	0x25, 0xc0, 0x46, 0x61, 0xb3, 0x00, 0xeb, 0x18, 0xf3, 0x70, 0xb5, 0x08, 0x4c, 0x03, 0x71, 0x08, 
+	0x1d, 0x16, 0x00, 0x81, 0x0a, 0x77, 0x08, 0xf0, 0xef, 0x23, 0xf9, 0x31, 0x00, 0x0d, 0x08, 0xf0, 
+	0xc1, 0x0f, 0x91, 0x37, 0x23, 0xc0, 0x31, 0x43, 0x09, 0xd1, 0x00, 0x09, 0x4b, 0x1a, 0x68, 0x12, 
+	0x80, 0x2e, 0x35, 0x08, 0x4b, 0x19, 0x1d, 0x5b, 0x6a, 0xd8, 0x20, 0x0f, 0xc0, 0x05, 0xd9, 0x40, 
+	0x10, 0x0a, 0x33, 0x18, 0x01, 0x1a, 0xfe, 0xf7, 0x92, 0xf8, 0x60, 0x1c, 0x37, 0x73, 0xc5, 0x12, 
+	0xbb, 0x30, 0x33, 0xff, 0xf7, 0xcf, 0x08, 0x55, 0xe1, 0x03, 0xeb, 0xe2, 0x10, 0x17, 0x10, 0x43, 
+	0x00, 0x91, 0x68, 0x06, 0x49, 0x30, 0x45, 0x25, 0x2d, 0x30, 0x04, 0x0e, 0x7b, 0x76, 0xf0, 0x37, 
+	0x00, 0x37, 0xb3, 0x00, 0x37, 0x50, 0xe7, 0x40, 0x37, 0x06, 0x02, 0xb7, 0xc3, 0x06, 0x02, 0xd4, 
+	0x00, 0x40, 0x07, 0xc0, 0x0f, 0x70, 0x47, 0x08, 0x23, 0x00, 0x18, 0x40, 0x43, 0x42, 0x58, 0x41, 
+	0x02, 0x30, 0xc2, 0x11, 0x6b, 0x11, 0x37, 0x70, 0xb5, 0x01, 0x25, 0x13, 0x71, 0x15, 0x89, 0x0e, 
+	0x57, 0x20, 0x20, 0x22, 0x03, 0x71, 0x4c, 0xf8, 0x0a, 0x67, 0x00, 0x78, 0x21, 0x4c, 0x9b, 0x00, 
+	0x1a, 0x59, 0x21, 0x44, 0x49, 0x1a, 0xc9, 0xd5, 0xff, 0x20, 0x14, 0x9d, 0x00, 0xe3, 0x00, 0x18, 
+	0xda, 0x68, 0x1e, 0x49, 0xff, 0xf7, 0xcd, 0x42, 0xff, 0x16, 0xe3, 0x9b, 0x0a, 0x2b, 0x40, 0x30, 
+	0x13, 0x1b, 0x82, 0x00, 0x13, 0xc3, 0xff, 0x1b, 0x4e, 0xb3, 0x20, 0x23, 0x9a, 0x21, 0x69, 0x19, 
+	0x00, 0x0f, 0xbb, 0xff, 0xf3, 0x78, 0x50, 0x1f, 0x55, 0x16, 0x00, 0x0f, 0xb3, 0x10, 0x0f, 0x41, 
+	0x50, 0x11, 0x13, 0x00, 0x11, 0x10, 0xaa, 0xff, 0x05, 0x04, 0x21, 0xaf, 0xff, 0x80, 0x00, 0x01, 
+	0x24, 0x18, 0xa2, 0x6a, 0x28, 0x00, 0x0f, 0x00, 0x13, 0x16, 0xa0, 0xff, 0x70, 0x41, 0x63, 0xde, 
+	0x03, 0xb3, 0x12, 0x53, 0xa8, 0xb6, 0x0a, 0x47, 0xf4, 0x00, 0x0b, 0x12, 0x4f, 0xfc, 0x00, 0x07, 
+	0x11, 0xc3, 0x08, 0x15, 0xe6, 0x00, 0x08, 0x10, 0xeb, 0x13, 0x00, 0x07, 0x1f, 0x00, 0x03, 0x51, 
+	0x30, 0x00, 0x03, 0x41, 0x00, 0x03, 0x1c, 0x23, 0x0c, 0x02, 0x13, 0x00, 0x99, 0x43, 0x0b, 0x00, 
+	0x10, 0xb5, 0x02, 0x28, 0x10, 0x0c, 0xd0, 0x03, 0x00, 0x03, 0x01, 0x28, 0x05, 0xd0, 0x04, 0x13, 
+	0x60, 0x08, 0xf0, 0x05, 0x41, 0xbd, 0x0c, 0x21, 0x00, 0x0b, 0x43, 0xf6, 0xe7, 0x18, 0x21, 0xfb, 
+	0xe7, 0x18, 0x10, 0x21, 0xf9, 0x41, 0x03, 0x11, 0x33, 0x6b, 0xff, 0x03, 0x00, 0x23, 0x01, 0x30, 
+	0x18, 0x40, 0xff, 0xf7, 0xdc, 0xc8, 0x45, 0x5d, 0xb1, 0xb5, 0x07, 0x4b, 0xb1, 0xb3, 0xfd, 0xf7, 
+	0xb8, 0x44, 0xff, 0xf1, 0x7b, 0x04, 0x00, 0x05, 0x60, 0x31, 0x25, 0x30, 0x18, 0xfd, 0xf7, 0xa6, 
+	0xa0, 0x23, 0x1b, 0x0d, 0x15, 0x00, 0x88, 0x89, 0x22, 0x2b, 0xd9, 0xf8, 0x29, 0x2a, 0x6d, 0xab, 
+	0xf8, 0x30, 0xf1, 0x94, 0x01, 0x87, 0x20, 0xfd, 0x08, 0x73, 0x27, 0x01, 0x69, 0x27, 0x4c, 0x20, 
+	0x28, 0x4d, 0x11, 0x27, 0x2e, 0x1d, 0x9a, 0x6b, 0x30, 0x28, 0x00, 0x26, 0x01, 0x17, 0xe2, 0x09, 
+	0x9d, 0x31, 0x00, 0x13, 0x88, 0x00, 0x21, 0x7d, 0xff, 0x23, 0x21, 0x93, 0xb0, 0xff, 0x6b, 0xa2, 
+	0x41, 0x91, 0x20, 0x00, 0x1f, 0xe8, 0xfe, 0x2b, 0x40, 0x0d, 0x1d, 0x90, 0x00, 0x0d, 0xe1, 0xfe, 
+	0x17, 0xf5, 0x5b, 0x0f, 0x01, 0x3b, 0x92, 0x20, 0x13, 0x6c, 0x1a, 0x00, 0x13, 0xd7, 0xfe, 0x10, 
+	0x05, 0x95, 0x40, 0xff, 0x11, 0x9b, 0x92, 0xff, 0x6b, 0x6a, 0x18, 0x4e, 0x00, 0x19, 0x4d, 0x19, 
+	0x4c, 0x09, 0x2b, 0x0b, 0xd1, 0x49, 0x31, 0x01, 0x85, 0x89, 0xff, 0x15, 0xad, 0x86, 0xff, 0x1a, 
+	0xcb, 0x62, 0x83, 0x41, 0x83, 0x11, 0xa3, 0x7d, 0xff, 0x12, 0x00, 0x05, 0x7a, 0x8b, 0x20, 0x05, 
+	0x77, 0xff, 0xe9, 0x01, 0x2f, 0x3d, 0x00, 0xc7, 0x11, 0x93, 0xaa, 0x10, 0xef, 0x4a, 0x01, 0x73, 
+	0x63, 0x00, 0x03, 0x72, 0x00, 0x03, 0x7f, 0xd5, 0x00, 0x03, 0x11, 0x9b, 0x8c, 0x00, 0x07, 0x99, 
+	0x00, 0x03, 0xa3, 0x00, 0x03, 0x55, 0xb4, 0x00, 0x03, 0xba, 0x00, 0x03, 0xc2, 0x00, 0x03, 0xc7, 
+	0x00, 0x03, 0x58, 0xd4, 0x00, 0x03, 0xe1, 0x00, 0x03, 0x11, 0x07, 0x16, 0x00, 0x1d, 0x9a, 0x41, 
+	0x09, 0x54, 0xf8, 0x03, 0x35, 0x01, 0x09, 0x26, 0x41, 0x11, 0x22, 0xd4, 0x61, 0x11, 0x90, 0x25, 
+	0x41, 0x40, 0x25, 0x13, 0x40, 0x25, 0x0f, 0xf8, 0x50, 0x20, 0x2f, 0xcd, 0x0b, 0x60, 0x2d, 0x86, 
+	0xb0, 0x01, 0xad, 0x00, 0x0e, 0x00, 0x11, 0x22, 0x0d, 0x49, 0x04, 0x00, 0x00, 0x28, 0x00, 0x07, 
+	0xf0, 0xbe, 0xfe, 0x00, 0x22, 0x00, 0x08, 0x20, 0x0f, 0x21, 0x0a, 0x4b, 0x80, 0x1b, 0x00, 0x1a, 
+	0x72, 0x07, 0x32, 0x90, 0x42, 0x04, 0xdd, 0x08, 0x18, 0x18, 0x06, 0xb0, 0x33, 0x99, 0x26, 0x00, 
+	0x0e, 0x00, 0x40, 0xae, 0x5d, 0x24, 0x09, 0x9e, 0x54, 0x01, 0x28, 0x3a, 0xf1, 0x00, 0xd7, 0xef, 
+	0x00, 0x97, 0x94, 0x76, 0x00, 0x0a, 0x03, 0xf7, 0xb5, 0x02, 0x01, 0x65, 0x8e, 0x00, 0x3b, 0x20, 
+	0x02, 0x20, 0x21, 0x49, 0xfd, 0xf7, 0xc5, 0x08, 0xf5, 0x01, 0x00, 0x26, 0x20, 0x4d, 0x2b, 0x78, 
+	0x20, 0x4c, 0x13, 0x8b, 0x22, 0xbd, 0x5a, 0x6e, 0x1e, 0x21, 0x81, 0x4a, 0x11, 0x65, 0x21, 0x75, 
+	0x11, 0x5a, 0x6f, 0x1c, 0x01, 0x1f, 0x42, 0xfe, 0x1b, 0x20, 0x0f, 0x08, 0xe4, 0x18, 0xe2, 0x6f, 
+	0x11, 0x6b, 0x3a, 0xfe, 0x19, 0x00, 0x4f, 0x3b, 0x68, 0x5b, 0x09, 0x19, 0x4c, 0x33, 0x88, 0x20, 
+	0x37, 0x1a, 0x69, 0x17, 0x00, 0x15, 0x2f, 0xfe, 0x3b, 0x00, 0x68, 0x01, 0x90, 0x5b, 0x09, 0xa8, 
+	0x78, 0x1e, 0x00, 0x40, 0x6b, 0x78, 0x00, 0x02, 0x18, 0x43, 0xb6, 0x00, 0x00, 0x00, 0x04, 0x04, 
+	0x21, 0xa6, 0x19, 0x00, 0x00, 0x14, 0xb6, 0x69, 0xff, 0xf7, 0x9b, 0xff, 0x31, 0x86, 0x05, 0xbd, 
+	0x01, 0x98, 0xff, 0xf7, 0x04, 0x16, 0x43, 0x0b, 0x00, 0x1b, 0xe7, 0x00, 0x08, 0x14, 0x6f, 0x11, 
+	0x77, 0x17, 0x00, 0x0b, 0x15, 0x23, 0x6c, 0x21, 0x00, 0x07, 0x14, 0xab, 0x2b, 0x00, 0x07, 0x12, 
+	0xc3, 0x28, 0xe1, 0x11, 0x00, 0x08, 0x33, 0x00, 0x0b, 0x00, 0xb5, 0x16, 0x00, 0x85, 0x00, 0x89, 
+	0xb0, 0x00, 0x2b, 0x24, 0xd0, 0x14, 0x49, 0x00, 0x68, 0x46, 0x07, 0xf0, 0xa4, 0xff, 0x08, 0xf0, 
+	0x00, 0x32, 0xf8, 0x6a, 0x46, 0x83, 0x06, 0x9b, 0x0f, 0x01, 0x30, 0x33, 0x13, 0x75, 0x0f, 0x23, 
+	0x02, 0x0c, 0xa5, 0x00, 0x1a, 0x40, 0x30, 0x32, 0x4a, 0x75, 0x02, 0x13, 0x84, 0x10, 0x07, 0xca, 
+	0x75, 0x02, 0x12, 0x10, 0x07, 0x0a, 0x76, 0x20, 0x02, 0x15, 0x10, 0x07, 0x8a, 0x76, 0x00, 0x22, 
+	0x00, 0x20, 0x14, 0x18, 0x0b, 0x10, 0xc8, 0x76, 0x10, 0x00, 0xfd, 0x05, 0xf7, 0x43, 0xfe, 0x09, 
+	0xb0, 0x10, 0x89, 0x3e, 0x01, 0xf3, 0x44, 0x46, 0x00, 0x63, 0x80, 0x22, 0x58, 0x02, 0x5f, 0x12, 
+	0x05, 0x00, 0x93, 0x42, 0x9b, 0x41, 0x80, 0x22, 0xf0, 0xb5, 0x14, 0x5f, 0x42, 0x55, 0x00, 0x0f, 
+	0x52, 0x08, 0xcb, 0x1a, 0x40, 0x00, 0x51, 0x42, 0x4a, 0x41, 0x04, 0x00, 0x82, 0x40, 0x00, 0x51, 
+	0x49, 0x9c, 0x43, 0x22, 0x43, 0x0a, 0x70, 0x00, 0x5a, 0x08, 0x90, 0x43, 0x80, 0x22, 0x92, 0x02, 
+	0x00, 0x13, 0x40, 0x5a, 0x42, 0x53, 0x41, 0x00, 0x24, 0x00, 0x5b, 0x00, 0x03, 0x43, 0x4b, 0x70, 
+	0x4b, 0x4b, 0x00, 0x01, 0x33, 0xdb, 0x19, 0xdb, 0x7f, 0x4a, 0x4e, 0x00, 0x4b, 0x62, 0x4a, 0x4b, 
+	0x1c, 0x60, 0x33, 0x88, 0x00, 0x89, 0xb0, 0x02, 0x93, 0x48, 0x4d, 0x34, 0x80, 0x00, 0x2b, 0x88, 
+	0x03, 0x93, 0x47, 0x4b, 0x2c, 0x80, 0x40, 0x1c, 0x08, 0x75, 0x75, 0xfe, 0x05, 0x96, 0x06, 0x95, 
+	0x04, 0x07, 0xf0, 0x9d, 0xff, 0x20, 0x00, 0x85, 0x5e, 0xfe, 0x00, 0x63, 0x01, 0x42, 0x4d, 0x5b, 
+	0x42, 0xe0, 0x33, 0x00, 0x01, 0x34, 0x2b, 0x60, 0xfd, 0xf7, 0x1e, 0xfd, 0x10, 0x08, 0x2c, 0xf0, 
+	0x0c, 0x53, 0xff, 0xf7, 0xc7, 0xf9, 0x11, 0x04, 0x1e, 0x04, 0x0a, 0x07, 0x5d, 0xfe, 0x2c, 0x00, 
+	0x17, 0x00, 0x12, 0xfd, 0x39, 0x4a, 0x13, 0x88, 0xdb, 0x43, 0x04, 0x39, 0x49, 0x07, 0x92, 0x0b, 
+	0x00, 0x45, 0x76, 0xff, 0x00, 0x2f, 0x4d, 0x6b, 0x1c, 0xdb, 0x19, 0xd8, 0x7f, 0x08, 0xfd, 0xf7, 
+	0x62, 0xfd, 0x0b, 0x57, 0x40, 0x04, 0x93, 0x00, 0x01, 0x23, 0x04, 0x00, 0x18, 0x42, 0x18, 0xd0, 
+	0x20, 0x2d, 0x4e, 0x0f, 0xa3, 0x93, 0xbb, 0x00, 0x01, 0x9a, 0x00, 0xed, 0x18, 0xab, 0x6a, 0x92, 
+	0x00, 0xd3, 0x58, 0x00, 0x00, 0xf0, 0xb0, 0xfa, 0x80, 0x22, 0x01, 0x9b, 0x10, 0x33, 0x60, 0x1f, 
+	0x60, 0xe3, 0x5b, 0x42, 0xbb, 0x42, 0x41, 0x02, 0x08, 0xc3, 0x04, 0x9f, 0x33, 0x60, 0xf1, 0x08, 
+	0xcf, 0x01, 0x01, 0xd0, 0xff, 0xf7, 0x27, 0xfe, 0x22, 0x08, 0xbf, 0x02, 0xcf, 0xd0, 0xfe, 0xf7, 
+	0x80, 0xfe, 0x4d, 0xc7, 0xfa, 0x00, 0x01, 0x25, 0x08, 0x26, 0x07, 0xf0, 0x46, 0xff, 0x00, 0x70, 
+	0x1b, 0xfd, 0xf7, 0x07, 0xfe, 0x17, 0x4b, 0x04, 0x6a, 0x01, 0x01, 0x35, 0x1a, 0x00, 0x91, 0xc9, 
+	0xfc, 0x00, 0x09, 0x2d, 0xf2, 0xd1, 0x07, 0x3d, 0x2c, 0x42, 0x00, 0x0c, 0xd1, 0x05, 0x9b, 0x02, 
+	0x9a, 0x1a, 0x80, 0x00, 0x06, 0x9b, 0x03, 0x9a, 0x03, 0x20, 0x1a, 0x80, 0x04, 0xfd, 0xf7, 0x59, 
+	0xfd, 0x09, 0x48, 0xfd, 0x07, 0xf0, 0x00, 0x29, 0xff, 0x07, 0x9b, 0x1c, 0x88, 0xe4, 0x43, 0x7a, 
+	0xea, 0x4b, 0xcb, 0x13, 0x4f, 0x13, 0x67, 0x11, 0xdb, 0x80, 0x02, 0x25, 0x6c, 0x86, 0x05, 0x0f, 
+	0x02, 0x01, 0x00, 0x04, 0x14, 0x4b, 0x00, 0x0f, 0x02, 0x5d, 0x30, 0x00, 0x0b, 0x88, 0x17, 0x1b, 
+	0x08, 0xe3, 0x06, 0xd7, 0x24, 0x11, 0x25, 0x00, 0xcb, 0xfd, 0x07, 0xf0, 0x05, 0xff, 0x01, 0x3c, 
+	0x10, 0xf8, 0xd2, 0x00, 0x00, 0x0f, 0x01, 0x34, 0xfd, 0xf7, 0x40, 0xee, 0x00, 0x11, 0xfc, 0xfe, 
+	0x11, 0x2c, 0xf7, 0xd1, 0x8a, 0x54, 0xd7, 0x0c, 0x4b, 0xdb, 0x0a, 0x6b, 0x01, 0x0a, 0x6b, 0x38, 
+	0x50, 0xfa, 0x14, 0x5b, 0x80, 0x0a, 0x6b, 0x00, 0x24, 0xdb, 0x04, 0x18, 0x1a, 0x80, 0x07, 0x01, 
+	0x8b, 0x10, 0x03, 0xfd, 0xf7, 0x6f, 0x00, 0xfc, 0x06, 0x4b, 0x1c, 0x80, 0x07, 0xf0, 0xd7, 0x75, 
+	0xfe, 0x30, 0x35, 0x10, 0x87, 0x10, 0x73, 0x84, 0x00, 0x03, 0x50, 0x00, 0x8b, 0x80, 0x15, 0x33, 
+	0xc5, 0xff, 0x07, 0xf0, 0xbb, 0xfe, 0x07, 0x82, 0x03, 0x2f, 0x90, 0xfd, 0x05, 0x4b, 0x1b, 0x01, 
+	0x73, 0x9b, 0x20, 0x05, 0x02, 0x40, 0x65, 0x07, 0xf0, 0xc2, 0xfe, 0xf4, 0xe2, 0x00, 0xc7, 0x10, 
+	0xa3, 0x3e, 0x43, 0x00, 0x2d, 0x03, 0x0a, 0x3d, 0x08, 0x80, 0x05, 0x15, 0x79, 0xfd, 0x06, 0x4b, 
+	0x62, 0x01, 0x01, 0x40, 0x34, 0x11, 0x1b, 0x3b, 0xfc, 0x07, 0xf0, 0xad, 0xfe, 0x0c, 0x09, 0x2c, 
+	0xef, 0xd1, 0x33, 0xc7, 0x10, 0x63, 0x10, 0xb5, 0x08, 0xfe, 0xf7, 0xf1, 0xfe, 0x11, 0xd9, 0xe2, 
+	0xff, 0x03, 0x0c, 0x4b, 0x9d, 0x46, 0xfd, 0x0a, 0xb7, 0x57, 0x7b, 0x00, 0x7f, 0xe4, 0x15, 0xaf, 
+	0x0c, 0xa7, 0x03, 0xe1, 0x91, 0xfe, 0x10, 0xab, 0x20, 0x3c, 0x08, 0xfd, 0xf7, 0x18, 0xfc, 0x0a, 
+	0xad, 0x33, 0xf5, 0xd1, 0xa6, 0x13, 0xbb, 0xb0, 0x4b, 0xd9, 0xc0, 0x46, 0x10, 0x4b, 0x1a, 0xd3, 
+	0x21, 0x00, 0x4f, 0x83, 0x00, 0x21, 0x4e, 0xfb, 0x18, 0x1b, 0x04, 0x6c, 0x85, 0xb0, 0x34, 0x60, 
+	0x00, 0x8b, 0x93, 0x00, 0x13, 0xf0, 0xbd, 0xf9, 0x1b, 0x95, 0xb2, 0xff, 0x0d, 0x9d, 0x00, 0xb7, 
+	0x01, 0x1c, 0x49, 0x0b, 0x60, 0x7b, 0x1c, 0x5b, 0x02, 0x91, 0x02, 0x03, 0x92, 0x02, 0x93, 0x02, 
+	0x98, 0x0b, 0xd3, 0xfc, 0x94, 0x32, 0x23, 0x0b, 0xd0, 0x12, 0x21, 0xab, 0x02, 0x21, 0xfb, 0x18, 
+	0x4e, 0x9b, 0x42, 0x21, 0x9f, 0xf9, 0x12, 0x1f, 0x12, 0x09, 0x02, 0x15, 0x9b, 0x09, 0x00, 0xf0, 
+	0x97, 0xf9, 0x0f, 0x7f, 0x42, 0xe3, 0x02, 0x15, 0x00, 0xb2, 0xff, 0x02, 0x25, 0x2c, 0x42, 0x03, 
+	0xd1, 0x83, 0x5a, 0xd1, 0x07, 0xf0, 0x3f, 0xfe, 0x03, 0x21, 0xd3, 0x19, 0xf3, 0xea, 0x11, 0xc7, 
+	0x11, 0xbb, 0xb1, 0xb7, 0x02, 0x00, 0xe7, 0xac, 0x66, 0x73, 0x03, 0xb4, 0x00, 0x0d, 0xa5, 0x76, 
+	0x81, 0x00, 0x0d, 0x9e, 0x40, 0x0d, 0x02, 0x23, 0xfa, 0x00, 0x0f, 0x48, 0xf3, 0x10, 0xfb, 0x30, 
+	0x15, 0x13, 0xfb, 0x01, 0xa0, 0x19, 0x84, 0xc0, 0x61, 0x2b, 0x10, 0x1b, 0xf7, 0xb5, 0x1f, 0x24, 
+	0x16, 0x00, 0x00, 0x00, 0x25, 0x25, 0x30, 0x20, 0x40, 0x40, 0x01, 0x00, 0x4c, 0x1c, 0x04, 0x19, 
+	0x01, 0x93, 0x64, 0x00, 0x02, 0x70, 0x5d, 0x1f, 0x28, 0x02, 0xd8, 0x34, 0x5f, 0xfd, 0x00, 0xf7, 
+	0x2f, 0xfb, 0x0b, 0x4b, 0xe7, 0x18, 0x80, 0x00, 0x23, 0xdb, 0x01, 0xc0, 0x18, 0x01, 0x9b, 0x38, 
+	0x00, 0x80, 0x9d, 0x42, 0x09, 0xd1, 0x70, 0x5d, 0x20, 0x08, 0x28, 0x00, 0xd1, 0x3f, 0x01, 0xad, 
+	0x20, 0xfb, 0xa0, 0x80, 0x20, 0x19, 0x38, 0x80, 0x01, 0x35, 0x02, 0x34, 0xe1, 0xc0, 0x00, 0xc7, 
+	0x05, 0x80, 0x06, 0xf0, 0xb5, 0x1f, 0x00, 0x85, 0x00, 0xb0, 0x01, 0x3b, 0x00, 0x90, 0x01, 0x91, 
+	0x10, 0x20, 0x00, 0x39, 0x06, 0xd7, 0x03, 0x93, 0xff, 0xf7, 0x3c, 0x00, 0xfd, 0x01, 0x99, 0x02, 
+	0x00, 0x7b, 0x1e, 0x00, 0x88, 0x04, 0xbf, 0xc2, 0xff, 0x24, 0x21, 0x5b, 0x24, 0x49, 0x02, 0x80, 
+	0x03, 0x87, 0x7c, 0x1e, 0x07, 0xf0, 0xb9, 0xfd, 0x21, 0x00, 0x49, 0x02, 0x9b, 0x0a, 0x68, 0x1b, 
+	0x88, 0x1a, 0x20, 0x43, 0xdb, 0x0a, 0xb9, 0x10, 0x23, 0x93, 0x43, 0x59, 0x02, 0x1e, 0x8b, 0x41, 
+	0xe4, 0x18, 0x20, 0x00, 0x09, 0xd6, 0x00, 0x43, 0x5a, 0x1e, 0x93, 0x41, 0xe4, 0x1a, 0x20, 0x88, 
+	0x00, 0x4d, 0x07, 0xf0, 0x19, 0x01, 0x37, 0x5a, 0x1a, 0x01, 0x00, 0x23, 0x92, 0x00, 0x0c, 0x00, 
+	0x93, 0x40, 0x72, 0x02, 0x06, 0x00, 0xd5, 0xed, 0x18, 0x32, 0x10, 0x05, 0x1a, 0x05, 0xf0, 0x23, 
+	0x1e, 0x42, 0x09, 0x0b, 0xfb, 0x28, 0x01, 0xbf, 0x14, 0x04, 0xfd, 0x23, 0x15, 0x2d, 0x99, 0x10, 
+	0x6f, 0x8a, 0xff, 0x00, 0x0a, 0x4b, 0x1e, 0x42, 0xcb, 0xd0, 0x03, 0x24, 0x03, 0x26, 0x42, 0x04, 
+	0xd1, 0x28, 0x00, 0x11, 0x83, 0x15, 0xe9, 0x00, 0x07, 0xf0, 0x7d, 0xfd, 0x02, 0x9b, 0x1e, 0x88, 
+	0x3a, 0xf6, 0x43, 0x1b, 0x23, 0x51, 0x7b, 0x1c, 0x17, 0x70, 0x02, 0xc3, 0x07, 0xc0, 0x0d, 0xbb, 
+	0x08, 0xcb, 0x06, 0x0c, 0x4a, 0xdb, 0x0f, 0x9b, 0x00, 0x00, 0xd3, 0x18, 0x98, 0x69, 0x07, 0xf0, 
+	0x13, 0x00, 0xfd, 0x0a, 0x4c, 0xa2, 0x78, 0x63, 0x78, 0x12, 0x82, 0x0b, 0x71, 0x04, 0x23, 0x01, 
+	0x00, 0x18, 0x00, 0x69, 0x87, 0x00, 0xff, 0x03, 0x04, 0x1b, 0x0e, 0x60, 0x70, 0xa3, 0x72, 0x70, 
+	0x32, 0xa7, 0x55, 0x73, 0x15, 0x97, 0xf0, 0xb5, 0x0d, 0x35, 0x93, 0x00, 0x00, 0x23, 0x17, 0x00, 
+	0x01, 0x91, 0x00, 0x90, 0x04, 0xff, 0xf7, 0x45, 0xff, 0x2b, 0x20, 0xf9, 0x00, 0x24, 0x10, 0x2a, 
+	0x49, 0x03, 0x00, 0xfb, 0x07, 0xf0, 0x3c, 0xfd, 0x18, 0x27, 0x49, 0x03, 0xf0, 0xf9, 0x20, 0xf9, 
+	0xd6, 0x43, 0x93, 0x0c, 0x43, 0x02, 0xd0, 0x02, 0x0c, 0xdd, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x99, 
+	0x07, 0xf0, 0x9b, 0xfd, 0x0c, 0x00, 0x7d, 0x02, 0x18, 0x73, 0x06, 0x02, 0xd5, 0x2b, 0x0a, 0x7d, 
+	0x2b, 0x15, 0x70, 0xb3, 0x05, 0x10, 0x09, 0x0a, 0x00, 0x09, 0x33, 0x20, 0x13, 0x54, 0x5e, 0x00, 
+	0x09, 0xf3, 0x20, 0x13, 0x55, 0x00, 0x09, 0x28, 0x78, 0x00, 0x5f, 0x21, 0x20, 0x38, 0x07, 0xf0, 
+	0x64, 0xfd, 0x00, 0xfc, 0x23, 0x20, 0x31, 0x9b, 0x00, 0x29, 0x70, 0x01, 0x1e, 0x42, 0x05, 0xd0, 
+	0x23, 0x00, 0x3a, 0x41, 0x17, 0x11, 0xfe, 0xfe, 0x03, 0x01, 0x31, 0xbc, 0xd0, 0x1c, 0x01, 0x55, 
+	0x10, 0xf8, 0xfc, 0x22, 0x0d, 0x7d, 0x1b, 0x88, 0x9a, 0x43, 0x68, 0xf8, 0x62, 0xa3, 0x71, 0x13, 
+	0xf7, 0x0e, 0x43, 0x01, 0x90, 0x00, 0x00, 0x25, 0x08, 0x00, 0x0a, 0x27, 0x39, 0x00, 0x06, 0x00, 
+	0x00, 0x01, 0x35, 0x07, 0xf0, 0x71, 0xfd, 0x09, 0x00, 0x2e, 0xf8, 0xd8, 0x01, 0x9b, 0x5d, 0x19, 
+	0x00, 0x01, 0x23, 0x0a, 0x27, 0x2b, 0x70, 0x6e, 0x1e, 0x31, 0x9f, 0x00, 0x49, 0xfd, 0x01, 0x3e, 
+	0x30, 0x31, 0x20, 0x00, 0x00, 0x71, 0x70, 0x39, 0x00, 0x01, 0x94, 0x07, 0xf0, 0x08, 0x5d, 0xfd, 
+	0x01, 0x9b, 0x09, 0x2f, 0x2b, 0xef, 0xd8, 0x10, 0x28, 0x00, 0xfe, 0x5a, 0xb1, 0x4c, 0x09, 0x34, 
+	0x01, 0x8e, 0x02, 0x2c, 0xff, 0xf7, 0xd2, 0x05, 0xc1, 0x39, 0x07, 0x17, 0x63, 0x18, 0x80, 0x00, 
+	0x73, 0x01, 0x00, 0xd9, 0xe4, 0x00, 0x0c, 0x86, 0x00, 0xe0, 0x20, 0xcc, 0xdb, 0xe7, 0x01, 0x04, 
+	0x80, 0x10, 0xe2, 0x20, 0x1c, 0x00, 0x07, 0xc4, 0x8c, 0xe1, 0xac, 0x00, 0x16, 0xe0, 0xe1, 0x00, 
+	0xe0, 0x8f, 0xe2, 0x01, 0x00, 0xf1, 0x9a, 0xe7, 0x00, 0x5c, 0x85, 0xe1, 0x45, 0x01, 0x3c, 0xa0, 
+	0xe1, 0x12, 0x8c, 0x58, 0xe2, 0x00, 0x2f, 0x00, 0x54, 0x00, 0xf1, 0x9a, 0x57, 0x95, 0x1e, 0x00, 
+	0x61, 0xea, 0xf0, 0x3b, 0xf0, 0x3b, 0x00, 0x5c, 0x05, 0xe0, 0xd0, 0x3b, 0x75, 0x86, 0xf0, 0x3b, 
+	0xf0, 0x3b, 0x20, 0x3b, 0x25, 0xe0, 0x3b, 0x77, 0xf0, 0x3b, 0xc0, 0xf0, 0x3b, 0x00, 0x3b, 0xa8, 
+	0x10, 0xb0, 0xe1, 0x01, 0x0c, 0x04, 0x40, 0x22, 0x60, 0x54, 0xb5, 0x20, 0x43, 0x41, 0x80, 0x00, 
+	0x88, 0xe3, 0x40, 0x80, 0xc8, 0x73, 0x12, 0x8c, 0x5c, 0xd8, 0x60, 0x4b, 0x64, 0xf0, 0x4b, 0xf0, 
+	0x4b, 0x10, 0x87, 0x3c, 0x55, 0x2d, 0xe0, 0x43, 0x00, 0x43, 0x01, 0x00, 0x43, 0x90, 0x3f, 0x54, 
+	0xf0, 0x3f, 0xc0, 0xf0, 0x3f, 0x40, 0x8b, 0x00, 0x5c, 0xd5, 0xe0, 0xff, 0x54, 0x34, 0x05, 0xe2, 
+	0xf0, 0x8b, 0x30, 0x4b, 0x41, 0x00, 0x4b, 0x0b, 0xb0, 0x14, 0xa0, 0xe1, 0x06, 0x80, 0xeb, 0x3c, 
+	0x10, 0x5f, 0xc0, 0xd9, 0x00, 0xe4, 0x0c, 0x00, 0xdb, 0xe7, 0x00, 0x00, 0x80, 0x00, 0xe0, 0x00, 
+	0x5c, 0x95, 0xe1, 0x25, 0x3c, 0x85, 0x82, 0x20, 0x87, 0x0c, 0x00, 0xcb, 0xe7, 0x0f, 0x80, 0x3f, 
+	0x31, 0xf0, 0x40, 0x2b, 0x20, 0x8f, 0xd0, 0xbf, 0xb0, 0x3b, 0x23, 0x01, 0x80, 0xc8, 0x4a, 0x33, 
+	0x70, 0x1f, 0x94, 0xe7, 0x91, 0x5f, 0x1f, 0x50, 0x73, 0xcc, 0x08, 0x86, 0xe0, 0x2c, 0x0c, 0xf0, 
+	0x77, 0x2c, 0x0c, 0xcb, 0xd0, 0x00, 0x2f, 0x70, 0x77, 0x13, 0xc0, 0x77, 0x27, 0xcc, 0x8c, 0xe0, 
+	0xea, 0xf0, 0x7b, 0xf0, 0x7b, 0x50, 0x7b, 0x15, 0x80, 0x7b, 0x00, 0xc0, 0x4b, 0x26, 0xf2, 0xf0, 
+	0x4b, 0xf0, 0x4b, 0xf0, 0x4b, 0x20, 0x4b, 0xed, 0x1d, 0x00, 0x4b, 0x90, 0x2a, 0x89, 0xe2, 0x91, 
+	0x4f, 0xe8, 0x40, 0x13, 0x09, 0x80, 0x13, 0xe3, 0x95, 0x40, 0x13, 0x03, 0x8b, 0x70, 0x13, 0xde, 
+	0x00, 0x13, 0x02, 0xc0, 0x13, 0x60, 0xd9, 0x10, 0x13, 0x11, 0x17, 0x0c, 0x96, 0xe0, 0x03, 0x8c, 
+	0x2c, 0x48, 0x22, 0x90, 0x1b, 0xd2, 0x10, 0x43, 0x00, 0xb3, 0xff, 0x00, 0x02, 0x50, 0xe3, 0x0b, 
+	0xc0, 0xf0, 0xe7, 0x02, 0x77, 0x02, 0x01, 0x01, 0x10, 0xd0, 0xe5, 0x0c, 0x2c, 0x97, 0x20, 0x2b, 
+	0xc0, 0x12, 0x0f, 0xe1, 0x17, 0x3c, 0x80, 0xe1, 0x03, 0x5c, 0xa0, 0x02, 0xe1, 0x05, 0x60, 0xa0, 
+	0xe1, 0x0f, 0x80, 0x8f, 0xbf, 0x80, 0x00, 0x4b, 0x00, 0x00, 0xa0, 0xe1, 0x02, 0x19, 0x81, 0x80, 
+	0x10, 0x13, 0xe4, 0x06, 0x60, 0x05, 0xe0, 0x00, 0x6c, 0x15, 0x56, 0xe0, 0x46, 0x02, 0x37, 0x06, 
+	0x81, 0x77, 0xb5, 0x10, 0x73, 0x80, 0x81, 0x2b, 0x06, 0x00, 0x05, 0xe0, 0x20, 0x0c, 0xa0, 0x94, 
+	0x81, 0xf7, 0x94, 0xe7, 0x90, 0xa3, 0xa9, 0x00, 0x2f, 0x04, 0xe0, 0x00, 0x2d, 0xe5, 0x28, 0x05, 
+	0xda, 0xe5, 0x02, 0x00, 0x00, 0x10, 0xe3, 0x74, 0x10, 0x9f, 0x15, 0x54, 0x10, 0x00, 0x0a, 0x15, 
+	0x70, 0x00, 0x9f, 0xe5, 0x00, 0x00, 0x00, 0x90, 0xe5, 0x0e, 0x0a, 0x50, 0xe3, 0x7c, 0x00, 0x00, 
+	0x1f, 0x05, 0x84, 0x00, 0x1f, 0x15, 0x60, 0x10, 0x80, 0x10, 0x13, 0x81, 0xe5, 0x89, 0x0d, 0x00, 
+	0xeb, 0x2f, 0x00, 0x0c, 0x00, 0xeb, 0x00, 0x50, 0xa0, 0xe3, 0x00, 0x50, 0x60, 0x00, 0x03, 0x70, 
+	0x00, 0x03, 0x30, 0xa0, 0xe3, 0x44, 0x08, 0x40, 0x4a, 0xe2, 0x40, 0x00, 0x37, 0x1c, 0x04, 0x8a, 
+	0x00, 0xe5, 0x4d, 0x80, 0xc8, 0xe3, 0x24, 0x54, 0x8a, 0x86, 0x00, 0x2f, 0xa0, 0xe3, 0x30, 0x0b, 
+	0x00, 0x2b, 0x00, 0x07, 0xe1, 0x00, 0x0a, 0x00, 0xeb, 0x24, 0xc0, 0x9f, 0xe5, 0x0f, 0x00, 0xe0, 
+	0xa0, 0xe1, 0x20, 0xf0, 0x9f, 0xe5, 0x15, 0x00, 0x8c, 0x48, 0xe2, 0x01, 0x0b, 0x8a, 0xe2, 0xf8, 
+	0x00, 0x03, 0x80, 0xe8, 0x04, 0xf0, 0x9d, 0xe4, 0xf4, 0x65, 0x52, 0x0f, 0xdb, 0x04, 0xe7, 0x00, 
+	0x53, 0x00, 0x07, 0x01, 0x0e, 0x4f, 0x04, 0xff, 0x00, 0x00, 0xb8, 0x44, 0x05, 0xbf, 0x47, 0x2d, 
+	0x00, 0xe9, 0x01, 0x80, 0xd0, 0xe4, 0x01, 0x80, 0xc1, 0x00, 0xe4, 0x00, 0x30, 0x1f, 0xe5, 0x00, 
+	0xf0, 0x1f, 0x01, 0xe5, 0x01, 0x01, 0x01, 0x01, 0x30, 0x45, 0x10, 0x27, 0x00, 0x02, 0x03, 0x04, 
+	0x05, 0x07, 0x09, 0x0a, 0x0b, 0x00, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x00, 0x18, 
+	0x19, 0x1a, 0x20, 0x21, 0x22, 0x28, 0x2a, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 
+	0x00, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x00, 0x50, 0x55, 0x56, 0x57, 0x58, 0x5c, 
+	0x5d, 0x5e, 0x00, 0x61, 0x63, 0x69, 0x76, 0x77, 0x8c, 0x97, 0x98, 0x00, 0x9e, 0xa3, 0xb2, 0xb4, 
+	0xb8, 0xbb, 0xce, 0xe4, 0x00, 0xe8, 0xf5, 0xf9, 0xfc, 0xfe, 0x00, 0x50, 0x9b, 0x16, 0x00, 0x08, 
+	0xc8, 0x00, 0x03, 0x64, 0x00, 0x03, 0x0c, 0x24, 0x08, 0x2c, 0xe0, 0xae, 0x09, 0xd3, 0xb3, 0x08, 
+	0x0f, 0x00, 0x0b, 0xd8, 0xc7, 0x10, 0x00, 0x08, 0xfc, 0x00, 0x03, 0x70, 0x9d, 0x00, 0x08, 0x40, 
+	0xe4, 0x00, 0x03, 0xc8, 0x9f, 0x00, 0x08, 0x74, 0xa3, 0x80, 0x00, 0x03, 0xa4, 0x00, 0x08, 0x34, 
+	0xa7, 0x00, 0x08, 0x00, 0x60, 0xa9, 0x00, 0x08, 0x6c, 0xaa, 0x00, 0x08, 0x02, 0x9c, 0xab, 0x00, 
+	0x08, 0xd0, 0xac, 0x30, 0x0f, 0xe4, 0x9a, 0x00, 0x07, 0x84, 0xad, 0x00, 0x07, 0x00, 0x03, 0x84, 
+	0x00, 0x4b, 0x84, 0x60, 0xb2, 0x0f, 0x27, 0x00, 0x03, 0x14, 0xb9, 0x00, 0x08, 0xdc, 0x60, 0xbb, 
+	0x00, 0x0f, 0x00, 0x47, 0xb0, 0xbd, 0x00, 0x08, 0x58, 0x08, 0xbf, 0x00, 0x08, 0xbc, 0x10, 0x03, 
+	0xc1, 0x00, 0x08, 0x41, 0xa0, 0x00, 0x6b, 0x04, 0xc2, 0x00, 0x08, 0x40, 0x00, 0x03, 0xa6, 0x10, 
+	0x7f, 0xd4, 0x00, 0x07, 0x94, 0xc3, 0x00, 0x7b, 0x00, 0x03, 0x4c, 0x69, 0xc4, 0x00, 0x1f, 0x00, 
+	0x03, 0xf8, 0x00, 0x03, 0x6c, 0xc6, 0x00, 0x1f, 0xa9, 0x00, 0x03, 0x34, 0x00, 0x93, 0x54, 0x00, 
+	0x03, 0x94, 0xc8, 0x0d, 0x70, 0x9a, 0x00, 0x03, 0x28, 0xc9, 0x0c, 0x6b, 0x00, 0x03, 0x84, 0x00, 
+	0x03, 0x0c, 0x77, 0x9c, 0x30, 0x43, 0x10, 0x03, 0x10, 0x6b, 0x64, 0x00, 0xb3, 0x10, 0x63, 0x10, 
+	0x7f, 0x29, 0x80, 0xa1, 0x30, 0x17, 0xb4, 0x00, 0x6f, 0xe4, 0xa6, 0x30, 0x0b, 0x37, 0x5c, 0xaf, 
+	0x00, 0x43, 0x00, 0xc3, 0x6c, 0x00, 0xb7, 0x50, 0x37, 0x50, 0x03, 0x80, 0x11, 0x1b, 0x11, 0xff, 
+	0x2f, 0xe1, 0xf0, 0x4f, 0x2d, 0x01, 0xe9, 0x98, 0xa3, 0x9f, 0xe5, 0x98, 0xb3, 0x00, 0x03, 0x00, 
+	0x13, 0x9f, 0xe5, 0x7a, 0x24, 0xda, 0xe5, 0x7b, 0x40, 0x04, 0x22, 0x37, 0xe1, 0x8c, 0x13, 0x9f, 
+	0x15, 0x04, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x20, 0xb0, 0xe1, 0x02, 0x09, 0x00, 0x00, 0x0a, 0x80, 
+	0x00, 0x1f, 0x17, 0x20, 0x02, 0x17, 0x09, 0x00, 0x00, 0xea, 0xe7, 0x00, 0x07, 0x74, 0x03, 0x02, 
+	0x3b, 0x00, 0x20, 0xc0, 0xe5, 0x06, 0x0c, 0x8a, 0xe2, 0x20, 0x84, 0x00, 0x0f, 0x04, 0x03, 0x00, 
+	0xeb, 0x11, 0xfb, 0xd0, 0x00, 0x01, 0x80, 0xe2, 0x00, 0x10, 0xe0, 0xe3, 0x30, 0x00, 0x13, 0x05, 
+	0xff, 0x02, 0x00, 0xeb, 0x50, 0x10, 0x27, 0x05, 0x32, 0x37, 0x04, 0x34, 0x05, 0xca, 0xe5, 0x44, 
+	0x00, 0x47, 0x30, 0x15, 0x00, 0x8a, 0xe5, 0xc8, 0x44, 0x9a, 0xe5, 0xcc, 0x54, 0x00, 0x9a, 0xe5, 
+	0x1c, 0x25, 0x9a, 0xe5, 0x02, 0x01, 0x00, 0x12, 0xe3, 0x01, 0x00, 0x00, 0x5a, 0xd0, 0x44, 0x10, 
+	0x8a, 0xe5, 0xd4, 0x12, 0x63, 0x90, 0xa0, 0xe3, 0x28, 0x1c, 0x94, 0x8a, 0xe5, 0x12, 0x7f, 0x10, 
+	0x37, 0x12, 0x5f, 0x10, 0xf3, 0xaa, 0x12, 0xab, 0xe0, 0x20, 0x0b, 0x08, 0x00, 0x0b, 0x08, 0x00, 
+	0x57, 0x08, 0xd4, 0x00, 0x4b, 0x12, 0xbf, 0x04, 0x00, 0x07, 0x04, 0x10, 0x67, 0x10, 0x80, 0x30, 
+	0xe5, 0x00, 0x10, 0x13, 0x40, 0x0b, 0xfc, 0x12, 0x9f, 0xe5, 0x05, 0x0c, 0x10, 0x0a, 0xe5, 0xf8, 
+	0x00, 0x07, 0x10, 0x00, 0x07, 0x56, 0xf4, 0x00, 0x07, 0x50, 0x00, 0x07, 0xf0, 0x00, 0x07, 0x03, 
+	0x13, 0xe5, 0x55, 0xec, 0x00, 0x07, 0x38, 0x00, 0x07, 0xc9, 0x02, 0xfb, 0xfe, 0x00, 0x03, 0x41, 
+	0xe8, 0x00, 0xc3, 0x7f, 0x01, 0x00, 0xeb, 0xfa, 0x02, 0xd7, 0x60, 0x2a, 0x42, 0xe3, 0x10, 0x6f, 
+	0xc8, 0xf2, 0x9f, 0xe5, 0x2b, 0x80, 0x03, 0x4f, 0xa9, 0x1f, 0x4f, 0xe2, 0xc0, 0x52, 0x9f, 0x00, 
+	0xe5, 0x01, 0x20, 0xd1, 0xe4, 0x00, 0x00, 0x52, 0x40, 0xe1, 0x00, 0xb3, 0x0a, 0x05, 0x00, 0x51, 
+	0xe1, 0xfa, 0x02, 0xff, 0xff, 0x1a, 0x0b, 0x4d, 0x4f, 0x10, 0xab, 0xe1, 0x00, 0x04, 0x10, 0x41, 
+	0xe0, 0xa1, 0x5f, 0x4f, 0xe2, 0x04, 0x01, 0x11, 0x85, 0xe0, 0x20, 0x03, 0x9f, 0x58, 0x50, 0x00, 
+	0x4a, 0xe2, 0x04, 0x00, 0x11, 0xe5, 0x1e, 0x00, 0x00, 0xb0, 0xe8, 0x04, 0x10, 0x05, 0xe4, 0x04, 
+	0x20, 0xa2, 0x00, 0x03, 0x30, 0x00, 0x03, 0x40, 0x05, 0xe4, 0x20, 0xdf, 0xf0, 0x00, 0xa0, 0xe1, 
+	0x28, 0x15, 0xda, 0xe5, 0x01, 0x00, 0x50, 0x11, 0x20, 0x6b, 0x64, 0x00, 0x6b, 0x0e, 0xff, 0xff, 
+	0xeb, 0x04, 0xf0, 0x4f, 0xbd, 0xe8, 0x1e, 0x01, 0xa3, 0x58, 0xc2, 0x0a, 0x9f, 0xe5, 0x58, 0x02, 
+	0x33, 0xbb, 0x54, 0x00, 0xaf, 0x00, 0x22, 0x10, 0x91, 0x01, 0x77, 0xa0, 0xe3, 0x1c, 0x00, 0x1b, 
+	0x56, 0x00, 0x45, 0x52, 0x53, 0x43, 0x50, 0x55, 0x53, 0x47, 0x01, 0x46, 0x58, 0x53, 0x52, 0x41, 
+	0x4d, 0x20, 0x10, 0x04, 0x0a, 0x56, 0x52, 0x4d, 0x31, 0x00, 0x03, 0x32, 0x00, 0x03, 0x34, 0x00, 
+	0x4d, 0x41, 0x50, 0x52, 0x50, 0x41, 0x4c, 0x32, 0x04, 0x4d, 0x49, 0x52, 0x32, 0x4f, 0x10, 0x1f, 
+	0x4e, 0x44, 0x41, 0x30, 0x00, 0x03, 0x31, 0x54, 0x49, 0x4d, 0x45, 0x03, 0x3f, 0x10, 0x45, 0xff, 
+	0x5f, 0x01, 0xff, 0xa1, 0x9f, 0xe5, 0x5c, 0x12, 0x00, 0x00, 0xeb, 0x10, 0x7b, 0xf8, 0xf1, 0x01, 
+	0x27, 0x05, 0x02, 0x9a, 0xe5, 0x20, 0x17, 0xb0, 0xe1, 0x03, 0xb8, 0x1a, 0x00, 0x01, 0x0c, 0x10, 
+	0xe3, 0xe8, 0x01, 0x9f, 0x15, 0xb1, 0x00, 0x03, 0x05, 0x02, 0x0b, 0x04, 0xfb, 0x51, 0xe3, 0xe0, 
+	0x00, 0x0b, 0x5a, 0x02, 0x00, 0x07, 0xdc, 0x00, 0x07, 0x00, 0x03, 0xc5, 0x10, 0x37, 0xd8, 0xa1, 
+	0x00, 0x37, 0x5a, 0x02, 0x37, 0x00, 0x10, 0xa0, 0xe1, 0x10, 0x9b, 0xd4, 0x21, 0x33, 0x00, 0x13, 
+	0x58, 0x00, 0x13, 0x04, 0x04, 0x83, 0x01, 0x10, 0x00, 0xa0, 0x03, 0x20, 0x10, 0xa0, 0x13, 0x55, 
+	0x14, 0x08, 0xca, 0xe5, 0xb4, 0x01, 0x10, 0xc3, 0xc0, 0xe5, 0xb0, 0xa4, 0x40, 0x07, 0xac, 0x00, 
+	0x07, 0xac, 0x11, 0x31, 0xc7, 0x44, 0x04, 0x15, 0x9a, 0xe5, 0x60, 0x04, 0x6b, 0x48, 0x00, 0x07, 
+	0x68, 0x00, 0x07, 0x00, 0x01, 0x2b, 0x8a, 0xe2, 0xc8, 0x20, 0x82, 0xe2, 0x01, 0x03, 0x00, 0x92, 
+	0xe8, 0x6d, 0x2e, 0x8a, 0x20, 0x07, 0xb4, 0x10, 0x5b, 0x50, 0x00, 0x5b, 0x10, 0x07, 0x78, 0x00, 
+	0x07, 0xff, 0x5f, 0x80, 0x31, 0x27, 0x02, 0x0c, 0x00, 0x00, 0x8c, 0xe1, 0x03, 0x42, 0x02, 0x90, 
+	0x03, 0xb0, 0x5d, 0x00, 0x03, 0x90, 0x03, 0x02, 0x5b, 0x0d, 0x00, 0x23, 0xe5, 0x00, 0x1b, 0x80, 
+	0x03, 0xf0, 0x00, 0x17, 0x90, 0x03, 0x3f, 0x02, 0x4c, 0x40, 0x47, 0x10, 0x1f, 0x40, 0x07, 0x10, 
+	0x3b, 0x10, 0x1b, 0x50, 0x07, 0x7d, 0x02, 0x0c, 0x54, 0x60, 0x67, 0x40, 0x47, 0x50, 0x63, 0x60, 
+	0x47, 0xcc, 0x80, 0x47, 0x54, 0xb9, 0x00, 0x03, 0xbd, 0x70, 0x47, 0xfc, 0x00, 0x03, 0x08, 0x5e, 
+	0xc1, 0x15, 0x1b, 0x33, 0x13, 0xe0, 0x06, 0xca, 0xe5, 0x58, 0x03, 0x7b, 0x00, 0x10, 0x00, 0x12, 
+	0xe3, 0xc8, 0x04, 0x9a, 0x05, 0x06, 0xcc, 0x04, 0x9a, 0x15, 0x30, 0x03, 0x33, 0x10, 0xd7, 0x3c, 
+	0x4a, 0x6e, 0x25, 0x43, 0x03, 0xbc, 0x05, 0x4b, 0x84, 0x00, 0x37, 0x68, 0xa6, 0x00, 0x03, 0x67, 
+	0x00, 0x03, 0x0c, 0x08, 0x01, 0x91, 0x05, 0x2b, 0xd8, 0x00, 0x47, 0x00, 0x03, 0x24, 0x48, 0x00, 
+	0x03, 0x80, 0x00, 0x30, 0x00, 0x06, 0x18, 0x51, 0x00, 0x03, 0xc0, 0xa8, 0x00, 0x27, 0x20, 0x00, 
+	0x07, 0xb8, 0x00, 0x07, 0xac, 0x50, 0x00, 0x2a, 0x03, 0x88, 0x00, 0x03, 0xdc, 0x00, 0x0b, 0xb0, 
+	0x00, 0x07, 0xe8, 0x80, 0x15, 0x8f, 0xa8, 0xff, 0x02, 0xb4, 0x4a, 0x00, 0x03, 0x00, 0x44, 0x60, 
+	0x00, 0x08, 0xc4, 0x46, 0x00, 0x03, 0x06, 0xb5, 0x1a, 0x00, 0x08, 0x44, 0x0b, 0x53, 0x1b, 0x5f, 
+	0x48, 0x06, 0x4b, 0x00, 0x03, 0x58, 0x64, 0x04, 0x87, 0x00, 0x03, 0x7c, 0xaa, 0x00, 0x03, 0xa0, 
+	0x00, 0x03, 0xc4, 0x00, 0x03, 0xd4, 0x00, 0x27, 0x2c, 0x0a, 0x59, 0x00, 0x03, 0x50, 0x00, 0x77, 
+	0x18, 0x00, 0x03, 0xcc, 0x80, 0x00, 0x0b, 0x38, 0x58, 0x00, 0x03, 0x9c, 0x95, 0x00, 0x21, 0x08, 
+	0x01, 0x02, 0xf3, 0x01, 0x20, 0x42, 0xe0, 0x01, 0xfb, 0x02, 0xe3, 0x03, 0x02, 0x00, 0xea, 0xf0, 
+	0x02, 0x53, 0x7c, 0x8e, 0x02, 0x53, 0x01, 0x1b, 0x8a, 0x04, 0x07, 0x06, 0xdb, 0x01, 0xc3, 0x30, 
+	0xb5, 0x01, 0xc3, 0xf4, 0x02, 0xd3, 0x10, 0x13, 0x3c, 0x40, 0x13, 0x74, 0x00, 0x13, 0x55, 0xef, 
+	0x40, 0x13, 0x90, 0x40, 0x13, 0x9e, 0x00, 0x13, 0xea, 0x10, 0x13, 0x8a, 0x06, 0x7b, 0x55, 0x34, 
+	0xca, 0x20, 0x43, 0xa0, 0x00, 0x1b, 0x05, 0x0a, 0x2c, 0x8a, 0xe2, 0x38, 0x00, 0x1b, 0xe3, 0x00, 
+	0x1b, 0x05, 0x0d, 0x1c, 0x8a, 0xe2, 0x44, 0x40, 0x13, 0x12, 0x1b, 0xde, 0x40, 0x13, 0x55, 0xfc, 
+	0x00, 0x13, 0x06, 0x00, 0x13, 0x00, 0x00, 0x13, 0xd9, 0x00, 0x13, 0x55, 0x06, 0x00, 0x13, 0x40, 
+	0x40, 0x13, 0x60, 0x00, 0x13, 0xd4, 0x10, 0x13, 0xad, 0x04, 0xab, 0x80, 0x04, 0x9f, 0xe0, 0x06, 
+	0xf7, 0x14, 0xb3, 0xd7, 0x03, 0xeb, 0xaa, 0x10, 0x27, 0xf4, 0x40, 0x27, 0xf8, 0x00, 0x27, 0xca, 
+	0x00, 0x27, 0x07, 0xaa, 0x00, 0x13, 0x0c, 0x00, 0x13, 0x02, 0x00, 0x93, 0x14, 0x00, 0x13, 0xc5, 
+	0xce, 0x00, 0x13, 0x11, 0xab, 0xd0, 0x06, 0x04, 0x9f, 0x00, 0x03, 0x11, 0xaf, 0xe8, 0x80, 0x00, 
+	0x03, 0x11, 0x1d, 0xa0, 0xe3, 0xe4, 0x16, 0x8a, 0xdb, 0xf2, 0xe7, 0x02, 0xe7, 0x80, 0x17, 0x6f, 
+	0x02, 0xdf, 0x7c, 0x40, 0x07, 0x10, 0x3f, 0x05, 0xcc, 0x06, 0x00, 0xeb, 0xc4, 0x00, 0x03, 0xff, 
+	0x04, 0xc7, 0x55, 0xe8, 0x00, 0x47, 0x64, 0x02, 0xe3, 0x6c, 0x00, 0x03, 0xe0, 0x00, 0x0b, 0x40, 
+	0xf0, 0x42, 0xc7, 0x00, 0x44, 0x2d, 0xe9, 0x3c, 0xa0, 0x10, 0x9f, 0xe5, 0x48, 0x00, 0xa3, 0xbc, 
+	0x06, 0x9a, 0xe5, 0x05, 0x1e, 0x2e, 0xa0, 0xe3, 0xad, 0x00, 0xa7, 0xb8, 0x40, 0x0b, 0x6a, 0xaa, 
+	0x00, 0x0b, 0x11, 0x6b, 0xb4, 0x40, 0x0f, 0xa6, 0x00, 0x0f, 0xb0, 0xac, 0x40, 0x0b, 0xa3, 0x10, 
+	0x1b, 0x44, 0x30, 0x47, 0x12, 0x37, 0x0f, 0x0f, 0x20, 0x0f, 0x0f, 0x51, 0xb3, 0x40, 0x04, 0x40, 
+	0x04, 0xfe, 0x92, 0x07, 0x77, 0x78, 0x80, 0x00, 0x8f, 0x80, 0x98, 0x04, 0x6f, 0x58, 0x04, 0xe3, 
+	0x48, 0x80, 0x9f, 0x05, 0x00, 0x03, 0x15, 0x68, 0x44, 0x20, 0x10, 0x13, 0x82, 0xe5, 0x64, 0x30, 
+	0x1b, 0xe7, 0x60, 0xe9, 0x40, 0x0f, 0x10, 0xb3, 0x11, 0x8b, 0x54, 0x00, 0x0f, 0x54, 0x70, 0x00, 
+	0x13, 0x04, 0x70, 0x97, 0xe5, 0x50, 0x50, 0x00, 0x07, 0x50, 0x95, 0x04, 0xe5, 0x04, 0x50, 0x45, 
+	0xe2, 0x18, 0x2b, 0x44, 0x90, 0x84, 0x00, 0x0f, 0x90, 0xd9, 0xe5, 0x40, 0x07, 0xff, 0x0a, 0x00, 
+	0x1b, 0x58, 0xe1, 0x09, 0x00, 0x03, 0x02, 0xb0, 0x0a, 0x14, 0x3f, 0x00, 0x03, 0x55, 0xca, 0x00, 
+	0x03, 0xba, 0x00, 0x03, 0xaa, 0x00, 0x03, 0xda, 0x00, 0x03, 0x25, 0xea, 0x18, 0x08, 0x0f, 0x44, 
+	0x4f, 0x02, 0xa7, 0x67, 0x06, 0xdb, 0xd5, 0x00, 0x07, 0x12, 0xdb, 0x24, 0x00, 0x13, 0x20, 0x00, 
+	0x03, 0x1c, 0x00, 0x03, 0x40, 0x2c, 0x00, 0x13, 0x02, 0xcc, 0x80, 0xe2, 0xb2, 0x20, 0x1c, 0xcc, 
+	0xe1, 0xa8, 0x00, 0x2f, 0x1b, 0x2b, 0x21, 0x17, 0x00, 0xff, 0x71, 0xef, 0x30, 0x07, 0x00, 0x93, 
+	0x00, 0xff, 0x00, 0x00, 0x04, 0x20, 0x0f, 0x51, 0x44, 0x15, 0x1b, 0xc0, 0x10, 0x0f, 0x0d, 0xef, 
+	0x3c, 0x05, 0x1f, 0x00, 0x01, 0x00, 0x50, 0xe1, 0x01, 0xc0, 0xa0, 0x03, 0x55, 0x34, 0x40, 0x0b, 
+	0x02, 0x00, 0x0b, 0x2c, 0x40, 0x0b, 0x04, 0x00, 0x0b, 0x7a, 0x0c, 0x02, 0xaf, 0x30, 0x47, 0x00, 
+	0x01, 0x05, 0xc0, 0x00, 0x08, 0x93, 0x50, 0x88, 0x00, 0x07, 0xb6, 0xfe, 0x00, 0x0d, 0x81, 0x00, 
+	0x07, 0x06, 0x00, 0x02, 0x00, 0x07, 0x24, 0x60, 0x4f, 0xe2, 0x7f, 0x00, 0x00, 0x96, 0xe8, 0xb8, 
+	0x10, 0xc5, 0xe0, 0xb8, 0x55, 0x00, 0x40, 0x03, 0x3e, 0x00, 0x03, 0x20, 0xb0, 0x0f, 0xf6, 0x05, 
+	0xf7, 0x1a, 0xb8, 0x10, 0xc6, 0x00, 0x0f, 0x40, 0x03, 0x4e, 0x00, 0x03, 0x20, 0x8b, 0x70, 0x0f, 
+	0xb0, 0x40, 0xc6, 0x21, 0xcf, 0xb0, 0x03, 0x0f, 0x14, 0xef, 0x51, 0xb0, 0x44, 0xe7, 0x0d, 0x06, 
+	0x4b, 0xa8, 0x31, 0x9f, 0x07, 0x67, 0x00, 0x50, 0xe3, 0x07, 0x00, 0x00, 0x2a, 0x50, 0x30, 0x11, 
+	0x43, 0xe2, 0x4e, 0x02, 0x13, 0x01, 0x00, 0xc3, 0x09, 0xe7, 0x01, 0x80, 0xe2, 0x01, 0x0c, 0x50, 
+	0xe3, 0xfb, 0x00, 0x5b, 0x80, 0x51, 0xcb, 0x03, 0x05, 0xa0, 0xe3, 0xf3, 0x14, 0xa0, 0x01, 0xe3, 
+	0xef, 0x14, 0xa0, 0x83, 0x21, 0x2c, 0x13, 0x6f, 0x20, 0xc3, 0xe4, 0x03, 0x5b, 0xe0, 0xb4, 0x00, 
+	0x52, 0xe3, 0xc0, 0x16, 0x7b, 0x50, 0x27, 0x01, 0x33, 0xa0, 0xe3, 0xba, 0x3b, 0x00, 0xc3, 0xe1, 
+	0xb6, 0x3c, 0xc3, 0xe1, 0xbe, 0x3d, 0x14, 0xc3, 0xe1, 0x48, 0x00, 0x6f, 0x48, 0x00, 0x77, 0xb1, 
+	0x00, 0x00, 0x83, 0xe1, 0xb0, 0x18, 0xd3, 0xe1, 0xb0, 0x38, 0x02, 0xc3, 0xe1, 0xb0, 0x00, 0xd3, 
+	0xe1, 0x03, 0x03, 0xe3, 0x12, 0xb0, 0x00, 0xc3, 0x01, 0x03, 0x03, 0xef, 0x30, 0x0f, 0xc0, 0x8b, 
+	0x20, 0x0f, 0xb0, 0x18, 0xc3, 0x21, 0x1b, 0x18, 0x00, 0x9b, 0x11, 0x63, 0x05, 0xb4, 0x10, 0xc3, 
+	0xe1, 0x07, 0x00, 0x07, 0xb2, 0x00, 0x07, 0xaa, 0x10, 0x0f, 0xb0, 0x00, 0x07, 0x05, 0x40, 0x07, 
+	0x65, 0x03, 0x3f, 0x08, 0xa0, 0x01, 0x77, 0x02, 0x00, 0x0f, 0x22, 0x13, 0x01, 0xe0, 0x04, 0x26, 
+	0x10, 0x81, 0x20, 0x17, 0x22, 0x13, 0x0a, 0xeb, 0x40, 0x0b, 0x82, 0x43, 0x20, 0x00, 0xab, 0xc0, 
+	0x5c, 0xe2, 0xf5, 0x00, 0xa3, 0x10, 0x37, 0xd4, 0x10, 0x47, 0x16, 0x1f, 0x20, 0x00, 0x37, 0x04, 
+	0xc0, 0x4f, 0xb0, 0x10, 0x01, 0xd3, 0xe1, 0x02, 0x10, 0x01, 0xe2, 0xa2, 0x10, 0x33, 0x36, 0x2f, 
+	0x82, 0x60, 0x37, 0x11, 0xef, 0x18, 0xf0, 0x2f, 0x60, 0x2f, 0xa0, 0x9b, 0x14, 0x7f, 0x0b, 0x80, 
+	0x60, 0x2f, 0x21, 0x07, 0x13, 0x12, 0x0f, 0x01, 0x0b, 0x00, 0x0b, 0xc1, 0xe1, 0xb6, 0x0c, 0xc1, 
+	0xe1, 0xb2, 0x08, 0x0d, 0xc1, 0xe1, 0xbe, 0x00, 0x03, 0x02, 0x1c, 0x81, 0x2a, 0xe2, 0x08, 0x01, 
+	0x7f, 0x3c, 0x03, 0x93, 0x3c, 0x03, 0x5f, 0x3c, 0xe8, 0x02, 0xd7, 0x24, 0xbb, 0x06, 0x4b, 0xd6, 
+	0x02, 0x6b, 0x6e, 0x7a, 0xb0, 0x00, 0x5a, 0x7e, 0x68, 0xbe, 0xab, 0x7f, 0x18, 0xae, 0x30, 0xba, 
+	0x80, 0x00, 0x03, 0x13, 0x43, 0xef, 0xbe, 0xaf, 0xde, 0x21, 0x48, 0x7c, 0x03, 0x3f, 0x7b, 0x00, 
+	0x03, 0x32, 0x02, 0x27, 0x03, 0x0c, 0xc0, 0x00, 0x00, 0xc4, 0x00, 0x0a, 0x47, 0x05, 0xdb, 0x20, 
+	0x94, 0x99, 0x39, 0x4b, 0x00, 0x04, 0x2d, 0xe9, 0x00, 0xc6, 0x09, 0x47, 0x11, 0x7f, 0x01, 0x3c, 
+	0x83, 0x0b, 0x8b, 0x00, 0x07, 0x00, 0x10, 0x50, 0xe2, 0xfd, 0x00, 0x8f, 0x01, 0x0c, 0xa0, 0xe3, 
+	0x22, 0xb8, 0x12, 0x11, 0x63, 0x11, 0xe3, 0xf9, 0x00, 0x0f, 0x40, 0xc0, 0x00, 0x07, 0x06, 0x86, 
+	0x1a, 0x20, 0x00, 0x93, 0xe5, 0x24, 0x00, 0x10, 0x93, 0xe5, 0xff, 0x2c, 0x00, 0xe2, 0xaa, 0x0a, 
+	0x0c, 0x52, 0xe3, 0x0b, 0x03, 0x33, 0xd0, 0x09, 0x0b, 0x01, 0x08, 0x08, 0x12, 0xe3, 0x05, 0x00, 
+	0x0b, 0xd8, 0x05, 0x8a, 0x00, 0x15, 0xdc, 0x15, 0x8a, 0x15, 0x00, 0x20, 0x22, 0x02, 0xe0, 0xff, 
+	0x2c, 0x12, 0xe2, 0xe0, 0x00, 0x0f, 0xe4, 0x81, 0x00, 0x0f, 0xd2, 0x35, 0xca, 0xe5, 0x00, 0x04, 
+	0x31, 0xef, 0xa0, 0x15, 0x03, 0xd8, 0x04, 0x9f, 0xb0, 0x00, 0xc2, 0xe1, 0xe8, 0x80, 0x10, 0x3b, 
+	0x24, 0x82, 0xe3, 0x02, 0x23, 0xc2, 0xe3, 0x32, 0xe8, 0x25, 0x09, 0x43, 0x40, 0x23, 0xd0, 0x35, 
+	0x10, 0x53, 0x13, 0x44, 0xe3, 0x00, 0x0b, 0x11, 0x01, 0x53, 0x00, 0x97, 0x5c, 0x85, 0x08, 0xe2, 
+	0xb8, 0x12, 0xd5, 0x20, 0x8f, 0x0e, 0xf0, 0xa0, 0x00, 0x11, 0x24, 0x44, 0xda, 0xe5, 0x55, 0x40, 
+	0x24, 0x00, 0xe2, 0x80, 0x40, 0xc4, 0xe3, 0x04, 0x04, 0x80, 0x28, 0xe1, 0xd8, 0x00, 0x47, 0xdc, 
+	0x10, 0x33, 0x00, 0x72, 0xe3, 0x02, 0x0f, 0x2c, 0x22, 0x02, 0xf8, 0x45, 0x1a, 0x0f, 0x54, 0x28, 
+	0xe3, 0x11, 0x23, 0xd3, 0x54, 0x12, 0xaf, 0x0a, 0x23, 0x48, 0x88, 0x00, 0x93, 0x0c, 0x14, 0xe3, 
+	0x06, 0x81, 0x0a, 0xd4, 0x15, 0x04, 0x9a, 0xe5, 0x23, 0x48, 0x21, 0x20, 0x0f, 0xd0, 0x15, 0x12, 
+	0x8a, 0x05, 0x17, 0x01, 0x47, 0x03, 0x40, 0xb0, 0x1f, 0x03, 0x55, 0x40, 0x70, 0x1f, 0x0f, 0x00, 
+	0x1f, 0x22, 0xc0, 0x3f, 0x22, 0x80, 0x3f, 0x82, 0x00, 0x5f, 0xea, 0xd0, 0x45, 0x9a, 0xe5, 0x10, 
+	0x17, 0x01, 0x25, 0x40, 0x24, 0x50, 0x27, 0x1a, 0xd0, 0x00, 0x0f, 0xd0, 0x07, 0x13, 0x44, 0xd4, 
+	0x0a, 0x3b, 0x01, 0x40, 0x94, 0x2a, 0x87, 0x00, 0x40, 0x34, 0x14, 0xe2, 0x10, 0x17, 0x00, 0x13, 
+	0x05, 0x01, 0x73, 0x11, 0x01, 0x10, 0x08, 0x80, 0xe3, 0x10, 0x23, 0xba, 0x02, 0xc5, 0xe1, 0xf4, 
+	0x10, 0xe3, 0x09, 0x77, 0x20, 0x3b, 0x10, 0x0b, 0x08, 0x00, 0x0b, 0xfc, 0xff, 0x11, 0xff, 0x0a, 
+	0x80, 0x02, 0x9b, 0xb8, 0x12, 0xc5, 0x02, 0xfb, 0x54, 0x34, 0x11, 0x13, 0xe1, 0x11, 0xbb, 0x44, 
+	0x03, 0x9f, 0x0f, 0x04, 0x14, 0xc0, 0xe3, 0xe8, 0x00, 0x3b, 0x02, 0x02, 0x9f, 0xa0, 0x1e, 0xc2, 
+	0x0d, 0x83, 0x08, 0xe3, 0x04, 0x20, 0xa0, 0x03, 0x09, 0xdf, 0xe3, 0x4a, 0x03, 0x00, 0x07, 0xf8, 
+	0x25, 0x06, 0x8f, 0x23, 0x01, 0x3f, 0x2c, 0x62, 0x82, 0x06, 0xd7, 0x03, 0x1b, 0x13, 0xc2, 0xe1, 
+	0x0d, 0xfc, 0xe3, 0x00, 0x02, 0x1a, 0xa0, 0x03, 0x06, 0x1a, 0xa0, 0x13, 0x01, 0x02, 0x10, 0x81, 
+	0x12, 0xb8, 0x12, 0xc2, 0x00, 0x4f, 0x93, 0x48, 0x8f, 0x03, 0x12, 0x11, 0xe7, 0x0a, 0x9e, 0x16, 
+	0x77, 0x01, 0x67, 0x41, 0xec, 0x00, 0x3f, 0x22, 0x28, 0xa0, 0xe1, 0xed, 0x00, 0x07, 0xd1, 0x51, 
+	0x53, 0x15, 0x27, 0xee, 0x01, 0xcf, 0x23, 0x38, 0xa0, 0x05, 0x33, 0x00, 0x54, 0xe3, 0xef, 0x35, 
+	0xca, 0x15, 0x00, 0x00, 0x32, 0x10, 0xe2, 0x00, 0x2f, 0x0e, 0x17, 0xa0, 0xe3, 0x10, 0xeb, 0x03, 
+	0x0a, 0x04, 0x12, 0xe3, 0x1b, 0x00, 0x27, 0x02, 0x00, 0x07, 0x08, 0xad, 0x00, 0x07, 0x22, 0x02, 
+	0x4f, 0x89, 0x00, 0x53, 0x00, 0x1f, 0x03, 0x10, 0xf7, 0x80, 0x11, 0xf7, 0x03, 0x24, 0xc2, 0x03, 
+	0x02, 0x23, 0x82, 0x5a, 0x03, 0x11, 0xf7, 0x0e, 0x01, 0x17, 0x01, 0xab, 0xeb, 0x09, 0x0e, 0x1a, 
+	0x68, 0x02, 0x02, 0x0f, 0x10, 0x13, 0x08, 0x09, 0xd3, 0x04, 0x00, 0x14, 0x40, 0xe3, 0x1b, 0xc7, 
+	0xd8, 0x35, 0xda, 0xe5, 0x07, 0x10, 0x00, 0xc1, 0xe3, 0x03, 0x10, 0x81, 0xe1, 0x67, 0xfd, 0xe7, 
+	0x06, 0xd7, 0x00, 0xcb, 0x01, 0x77, 0xe5, 0xd8, 0x00, 0x03, 0x02, 0x6f, 0x01, 0xf7, 0x35, 0x90, 
+	0xe3, 0x10, 0x7f, 0x01, 0x5f, 0xeb, 0x04, 0x83, 0xea, 0x52, 0x33, 0x44, 0x0c, 0x01, 0x67, 0x07, 
+	0x00, 0x01, 0x02, 0xab, 0x80, 0xe3, 0x2c, 0xb8, 0x42, 0x12, 0x3f, 0x14, 0x22, 0x3f, 0x11, 0x6b, 
+	0x80, 0x40, 0x4c, 0x84, 0x00, 0x13, 0xc5, 0xe1, 0x00, 0x0f, 0x26, 0x77, 0x01, 0x14, 0x01, 0x81, 
+	0xe1, 0x01, 0x18, 0x81, 0xe1, 0x08, 0x06, 0x13, 0x56, 0x04, 0x80, 0x03, 0x24, 0x08, 0x97, 0x2c, 
+	0x18, 0xa3, 0x00, 0x03, 0x75, 0x00, 0x75, 0x75, 0x27, 0x1b, 0x8f, 0x00, 0x00, 0xab, 0x00, 0x47, 
+	0x00, 0x9f, 0x8f, 0x00, 0x77, 0xab, 0x00, 0x00, 0x13, 0xa7, 0x00, 0x00, 0x7f, 0x0b, 0x00, 0x43, 
+	0x00, 0x2f, 0x00, 0x00, 0x47, 0x00, 0x00, 0x51, 0x00, 0x03, 0x00, 0x3f, 0x17, 0x1b, 0x3f, 0x5f, 
+	0x25, 0xa6, 0x10, 0x01, 0x00, 0xbc, 0xbc, 0xbc, 0x00, 0x73, 0xef, 0x23, 0x3b, 0x00, 0xef, 0x83, 
+	0x00, 0xf3, 0xbf, 0x00, 0xbf, 0xe7, 0x00, 0x00, 0x5b, 0xdb, 0x2b, 0x00, 0xcb, 0x4f, 0x0f, 0x04, 
+	0x8b, 0x73, 0x00, 0x00, 0x97, 0x00, 0x46, 0x00, 0x00, 0x04, 0x93, 0x3b, 0x00, 0x83, 0x8b, 0x60, 
+	0x2f, 0xff, 0xff, 0x00, 0xff, 0x3f, 0xbf, 0xff, 0x5f, 0x97, 0xff, 0xa7, 0x00, 0x8b, 0xfd, 0xf7, 
+	0x7b, 0xff, 0xff, 0x77, 0xb7, 0x00, 0xff, 0x77, 0x63, 0xff, 0x9b, 0x3b, 0xf3, 0xbf, 0x00, 0x3f, 
+	0x83, 0xd3, 0x13, 0x4f, 0xdf, 0x4b, 0x58, 0x00, 0xf8, 0x98, 0x00, 0xeb, 0xdb, 0x66, 0x66, 0x66, 
+	0x80, 0x60, 0x2f, 0xab, 0xe7, 0xff, 0xc7, 0xd7, 0xff, 0xd7, 0x08, 0xcb, 0xff, 0xff, 0xc7, 0x00, 
+	0x02, 0xdb, 0xff, 0xbf, 0x00, 0xb3, 0xff, 0xdb, 0xab, 0xff, 0xe7, 0xa3, 0xe3, 0x08, 0xff, 0xa3, 
+	0xab, 0xf3, 0x00, 0x0c, 0xcf, 0x9f, 0xff, 0x08, 0xf3, 0xd1, 0xd1, 0xd1, 0x30, 0x2f, 0x35, 0x3f, 
+	0x16, 0x00, 0x22, 0x1c, 0x09, 0x30, 0x15, 0x30, 0x00, 0x27, 0x00, 0x05, 0x04, 0x28, 0x08, 0x30, 
+	0x21, 0x3f, 0x3f, 0x01, 0x3f, 0x3c, 0x32, 0x36, 0x12, 0x3f, 0x2b, 0x00, 0x08, 0x00, 0x3f, 0x24, 
+	0x01, 0x3f, 0x31, 0x3f, 0x2a, 0x2c, 0x00, 0x0c, 0x3f, 0x14, 0x3f, 0x07, 0x34, 0x06, 0x3f, 0x00, 
+	0x02, 0x26, 0x0f, 0x3f, 0x19, 0x10, 0x0a, 0x3f, 0x00, 0x3f, 0x37, 0x17, 0x3f, 0x11, 0x1a, 0x3f, 
+	0x3f, 0x02, 0x25, 0x18, 0x3f, 0x0f, 0x27, 0x18, 0x00, 0x07, 0x3f, 0x00, 0x34, 0x16, 0x13, 0x3f, 
+	0x34, 0x20, 0x23, 0x3f, 0x00, 0x0b, 0x3f, 0x23, 0x06, 0x3f, 0x1b, 0x27, 0x3f, 0x00, 0x22, 0x3f, 
+	0x24, 0x3f, 0x3f, 0x32, 0x08, 0x3f, 0x00, 0x03, 0x3f, 0x37, 0x26, 0x33, 0x11, 0x3f, 0x10, 0x00, 
+	0x22, 0x14, 0x3f, 0x00, 0x09, 0x12, 0x0f, 0x3f, 0x00, 0x30, 0x3f, 0x3f, 0x2a, 0x17, 0x0c, 0x01, 
+	0x15, 0x01, 0x19, 0x3f, 0x2c, 0x07, 0x37, 0x3f, 0x05, 0x10, 0x63, 0x00, 0x1c, 0x3f, 0x1a, 0x30, 
+	0x01, 0x07, 0x02, 0x3f, 0x80, 0x10, 0x1b, 0x3f, 0x30, 0x32, 0x1c, 0x11, 0x12, 0x3f, 0x00, 0x18, 
+	0x17, 0x26, 0x0c, 0x3f, 0x3f, 0x02, 0x16, 0x20, 0x3f, 0x3f, 0x00, 0x8e, 0x0f, 0x37, 0x3f, 0x28, 
+	0x27, 0x22, 0x3f, 0x29, 0x00, 0x0a, 0x11, 0x3f, 0x0f, 0x00, 0x8e, 0x3f, 0x10, 0x06, 0x0f, 0x2a, 
+	0x00, 0x2a, 0x28, 0x3f, 0x3f, 0x13, 0xa0, 0x00, 0x30, 0x18, 0x00, 0x3f, 0x3f, 0x3f, 0x01, 0x17, 
+	0x10, 0x00, 0x3f, 0x2a, 0x3f, 0x36, 0x37, 0x1a, 0x39, 0x25, 0x20, 0x3f, 0x12, 0x00, 0x25, 0x3f, 
+	0x26, 0x3f, 0x1b, 0x22, 0x00, 0x19, 0x04, 0x0f, 0x3a, 0x21, 0x3f, 0x0a, 0x07, 0x02, 0x06, 0x13, 
+	0x3f, 0x00, 0x15, 0x0c, 0x00, 0x3d, 0x3f, 0x40, 0x38, 0x10, 0x61, 0x07, 0x16, 0x3f, 0x3b, 0x30, 
+	0x3c, 0x00, 0x0f, 0x27, 0x3f, 0x31, 0x29, 0x3f, 0x11, 0x09, 0x80, 0x00, 0x2b, 0x10, 0x1a, 0x30, 
+	0x31, 0x3f, 0x01, 0x0f, 0x18, 0x36, 0x3f, 0x15, 0x00, 0xfa, 0x00, 0x21, 0x12, 0x19, 0x18, 0x18, 
+	0x17, 0x3f, 0x00, 0x30, 0x7f, 0x10, 0x01, 0x37, 0x3f, 0x27, 0x04, 0x26, 0x20, 0x3f, 0x04, 0x22, 
+	0x10, 0x41, 0x3f, 0x2c, 0x80, 0x00, 0x03, 0x07, 0x2a, 0x28, 0x3f, 0x0a, 0x3f, 0x32, 0x40, 0x38, 
+	0x00, 0x7f, 0x0c, 0x60, 0x54, 0x9f, 0xe5, 0x60, 0x06, 0x64, 0x9f, 0xe5, 0xc0, 0x70, 0x0d, 0xeb, 
+	0x07, 0x0f, 0x10, 0xc0, 0x09, 0x3f, 0x02, 0xbb, 0x0a, 0x28, 0x00, 0x1a, 0xe5, 0x4c, 0x41, 0x14, 
+	0x16, 0x7f, 0xf0, 0xe7, 0x01, 0x20, 0xf0, 0x03, 0xeb, 0x85, 0x00, 0x03, 0x00, 0xd0, 0xe5, 0x02, 
+	0x02, 0x53, 0x04, 0x02, 0x53, 0x01, 0x00, 0x1c, 0x81, 0xe1, 0x70, 0x20, 0x8f, 0x05, 0xc7, 0x4e, 
+	0x92, 0x07, 0x2b, 0x50, 0xe1, 0x15, 0x2b, 0x07, 0xc1, 0x27, 0x07, 0x06, 0xc9, 0x06, 0x0b, 0x06, 
+	0x1f, 0xe1, 0x07, 0x06, 0x43, 0x0c, 0xf4, 0x02, 0x73, 0x20, 0x10, 0x12, 0x2d, 0xab, 0x82, 0x20, 
+	0x82, 0xe0, 0x05, 0x00, 0x00, 0xf2, 0xe7, 0x01, 0xc0, 0xd2, 0xe5, 0x0c, 0xa2, 0x04, 0xe3, 0xb2, 
+	0x07, 0x9b, 0x02, 0x00, 0xd2, 0x70, 0x1b, 0xc0, 0x2a, 0xf2, 0xe7, 0x50, 0x17, 0x01, 0x00, 0x17, 
+	0x02, 0x80, 0x27, 0x06, 0x0c, 0x70, 0x57, 0xe2, 0xed, 0x00, 0x5b, 0x12, 0xdb, 0x18, 0xf3, 0x00, 
+	0xf3, 0xff, 0xa4, 0x6e, 0x00, 0x08, 0x92, 0xf4, 0x2c, 0x22, 0xf4, 0x10, 0x07, 0x9c, 0x07, 0x48, 
+	0x10, 0x07, 0x81, 0x82, 0x95, 0x30, 0x07, 0x92, 0xfd, 0x30, 0x1f, 0xce, 0x00, 0x17, 0xe4, 0x00, 
+	0x07, 0x42, 0x53, 0x40, 0x07, 0x62, 0xc0, 0x08, 0xc0, 0x10, 0x07, 0x2f, 0x20, 0x81, 0x50, 0x20, 
+	0x0f, 0x3f, 0x86, 0xaf, 0x85, 0x24, 0x02, 0x6f, 0x00, 0x08, 0x2a, 0x86, 0x9a, 0x20, 0x07, 0x0a, 
+	0x08, 0x81, 0x00, 0x80, 0x64, 0x00, 0x07, 0xde, 0xb5, 0x78, 0x42, 0xb5, 0x10, 0x07, 0x25, 0xc3, 
+	0x98, 0xc2, 0x10, 0x07, 0x36, 0x21, 0x83, 0x4c, 0x20, 0x17, 0x00, 0xd3, 0x70, 0xc0, 0x90, 0x17, 
+	0x61, 0xba, 0x10, 0x77, 0x00, 0x07, 0xa5, 0xf0, 0x07, 0xf0, 0x10, 0x07, 0x0e, 0x05, 0x80, 0x00, 
+	0xff, 0x10, 0x07, 0x12, 0x97, 0x10, 0x1f, 0xf0, 0xa8, 0x09, 0xe7, 0x10, 0x06, 0x8f, 0xa5, 0x04, 
+	0x27, 0xfc, 0x62, 0x9f, 0x18, 0xe5, 0x06, 0x70, 0x0e, 0x97, 0x1f, 0x17, 0x10, 0xd1, 0xe5, 0x24, 
+	0x40, 0x40, 0x16, 0x9b, 0xd6, 0xe4, 0x06, 0x6f, 0xeb, 0x00, 0x70, 0x50, 0x07, 0x3b, 0x00, 0x0b, 
+	0x00, 0x38, 0xeb, 0x80, 0x52, 0x85, 0xc0, 0x20, 0x0b, 0x01, 0x4f, 0xeb, 0x00, 0x55, 0x85, 0xe1, 
+	0xb2, 0x00, 0x50, 0xc7, 0xe0, 0x01, 0x40, 0x54, 0xe2, 0xf3, 0x90, 0x00, 0xfb, 0xf0, 0x47, 0x48, 
+	0x5f, 0x2c, 0x60, 0xe2, 0x92, 0x00, 0x02, 0x03, 0xe0, 0x01, 0x28, 0x73, 0xe2, 0x04, 0x08, 0x30, 
+	0x61, 0xe2, 0x00, 0x01, 0x23, 0x91, 0x02, 0x02, 0x01, 0xe0, 0x93, 0x20, 0x20, 0xe0, 0xa0, 0x06, 
+	0x39, 0x57, 0x4c, 0xff, 0x0f, 0xfb, 0x9c, 0x22, 0x18, 0xe7, 0x10, 0x67, 0x11, 0xe3, 0x04, 0x01, 
+	0x02, 0x80, 0x13, 0x02, 0x10, 0x07, 0x04, 0x80, 0x43, 0x13, 0x15, 0x8f, 0x01, 0x06, 0x80, 0x13, 
+	0x15, 0x8b, 0x05, 0xab, 0x21, 0x13, 0x10, 0x10, 0x07, 0x0a, 0x80, 0x13, 0x20, 0x10, 0x07, 0x10, 
+	0x0c, 0x80, 0x13, 0x17, 0x1b, 0x10, 0x00, 0x80, 0x13, 0xe0, 0x16, 0x9b, 0x09, 0x07, 0x00, 0x2f, 
+	0x82, 0xe4, 0x01, 0x10, 0x91, 0x2b, 0xe2, 0xeb, 0x00, 0x83, 0x4c, 0x2f, 0x03, 0x82, 0x2d, 0x13, 
+	0x19, 0x53, 0x22, 0x30, 0xa2, 0x30, 0x63, 0x58, 0x04, 0xca, 0x0e, 0x7b, 0xca, 0x20, 0xe5, 0xf5, 
+	0x0b, 0x8f, 0xc8, 0x07, 0x8a, 0xe5, 0xcc, 0xaa, 0x00, 0x03, 0xd0, 0x00, 0x03, 0xd4, 0x00, 0x03, 
+	0xd8, 0x00, 0x03, 0x18, 0x85, 0x1f, 0x33, 0x00, 0xc1, 0xe5, 0x14, 0x00, 0x93, 0x14, 0x10, 0x0b, 
+	0x00, 0x20, 0x81, 0xe5, 0xec, 0x26, 0x8a, 0xe5, 0x77, 0xd6, 0x00, 0x33, 0x17, 0xa7, 0xf4, 0x00, 
+	0x37, 0x00, 0x10, 0x17, 0x20, 0x5f, 0x81, 0x28, 0xe5, 0xfc, 0x09, 0x33, 0xfc, 0x09, 0x33, 0x04, 
+	0x00, 0x81, 0x3c, 0xe4, 0xf8, 0x40, 0x07, 0x5b, 0xe7, 0x14, 0xd3, 0x5b, 0x87, 0xc8, 0xfe, 0x2a, 
+	0xff, 0xeb, 0x5b, 0x9f, 0xc5, 0x00, 0x0b, 0xc4, 0x00, 0x0b, 0x05, 0x0d, 0x2d, 0xa0, 0xe3, 0xc2, 
+	0x00, 0x0b, 0x15, 0x53, 0xc0, 0x00, 0x3b, 0x05, 0x02, 0x2b, 0xa0, 0xe3, 0xbe, 0x00, 0x0f, 0xb8, 
+	0x00, 0x0b, 0x52, 0x22, 0x00, 0x27, 0xbb, 0x20, 0x1b, 0xe0, 0xe3, 0x1e, 0xf3, 0x2c, 0xaa, 0x06, 
+	0x67, 0xb7, 0x00, 0x0f, 0xa4, 0x40, 0x0b, 0xb4, 0x00, 0x0b, 0xe0, 0x9a, 0x00, 0x37, 0x07, 0x04, 
+	0x01, 0x37, 0x00, 0x37, 0xb0, 0x00, 0x0f, 0xf0, 0xa8, 0x00, 0x0f, 0x88, 0x00, 0x1f, 0xf0, 0x0c, 
+	0x1f, 0x01, 0x2c, 0xa0, 0x2a, 0xe3, 0xab, 0x00, 0x13, 0x7c, 0x00, 0x0f, 0xa8, 0x00, 0x0f, 0xac, 
+	0xb5, 0x40, 0x13, 0xa6, 0x10, 0x53, 0x0a, 0x3b, 0xc8, 0x0c, 0x47, 0xcc, 0x00, 0x03, 0x9c, 0x06, 
+	0x53, 0xeb, 0x7e, 0x1c, 0xaf, 0x4a, 0x13, 0x01, 0x23, 0xe1, 0x7b, 0x0c, 0x14, 0xda, 0xe5, 0x7a, 
+	0x0e, 0x5f, 0x01, 0x87, 0xe1, 0x40, 0xc8, 0x0f, 0xcf, 0x00, 0x03, 0x05, 0x40, 0x00, 0xe7, 0xb0, 
+	0x00, 0xc1, 0x32, 0xe1, 0x3c, 0x00, 0x0f, 0x00, 0x03, 0x05, 0xb4, 0x00, 0x0b, 0x38, 0xa8, 0x00, 
+	0x13, 0x2b, 0x03, 0x8b, 0x09, 0x03, 0x4f, 0x0a, 0x00, 0x50, 0x28, 0x13, 0xea, 0x00, 0x8b, 0x13, 
+	0x0a, 0x2b, 0x4c, 0x00, 0x1f, 0xaa, 0x06, 0x97, 0x81, 0x21, 0x7b, 0x18, 0x2a, 0xc3, 0xd1, 0x1b, 
+	0x4f, 0xe2, 0x0c, 0x3b, 0x00, 0xa0, 0x43, 0x11, 0x5b, 0x00, 0x17, 0x51, 0x04, 0xd9, 0x1f, 0xcf, 
+	0x03, 0xa7, 0x01, 0x03, 0xc7, 0x00, 0x0f, 0x01, 0x30, 0x0f, 0xc3, 0xe0, 0x13, 0x97, 0x10, 0x0b, 
+	0x11, 0x0f, 0x30, 0x14, 0x8a, 0xe5, 0xe4, 0x86, 0x1c, 0x57, 0x20, 0x92, 0xe5, 0x01, 0x08, 0xef, 
+	0x18, 0x8f, 0x64, 0x8a, 0x2b, 0xc7, 0x06, 0xef, 0x30, 0x0a, 0xf3, 0xcc, 0x10, 0x1b, 0x00, 0x4a, 
+	0xc2, 0x11, 0x93, 0xe1, 0x0a, 0x80, 0x17, 0xb8, 0x40, 0x17, 0x30, 0xa1, 0x0d, 0x8f, 0xb0, 0x10, 
+	0x0b, 0x10, 0xc2, 0xe5, 0xac, 0x09, 0xbf, 0x48, 0xac, 0x00, 0x0b, 0x41, 0xcc, 0x1c, 0x0b, 0xd0, 
+	0xe4, 0x20, 0x84, 0x07, 0xa3, 0x0a, 0x10, 0x81, 0x02, 0x0d, 0xb3, 0xe0, 0xb2, 0x0a, 0x10, 0xc2, 
+	0xe0, 0x0f, 0x0f, 0x47, 0xf8, 0x4a, 0x0b, 0xe4, 0x13, 0x6d, 0x00, 0x08, 0x09, 0xb2, 0x05, 0xfa, 
+	0x0b, 0xe7, 0x16, 0x77, 0xa4, 0x16, 0x9f, 0xc6, 0x0f, 0x7b, 0xec, 0x76, 0x19, 0xdb, 0xad, 0xde, 
+	0x55, 0xc4, 0x0e, 0xcb, 0xc0, 0x4e, 0xcf, 0x4c, 0x00, 0x03, 0x14, 0x0d, 0x2b, 0x50, 0x70, 0x00, 
+	0x07, 0xe8, 0x00, 0x13, 0x54, 0x5b, 0x00, 0x03, 0x83, 0x2f, 0xc3, 0xeb, 0x03, 0x02, 0xdc, 0xed, 
+	0x0f, 0xbf, 0x00, 0x03, 0x21, 0x00, 0xfe, 0x00, 0x03, 0xff, 0x03, 0x02, 0x29, 0x03, 0x6b, 0x81, 
+	0x03, 0x43, 0x00, 0x78, 0x5f, 0x00, 0x03, 0x30, 0x00, 0x07, 0x55, 0x13, 0x00, 0x03, 0xc0, 0x00, 
+	0x3b, 0xc5, 0x00, 0x5b, 0xc4, 0x00, 0x03, 0x55, 0x80, 0x0c, 0xcb, 0xc1, 0x00, 0x07, 0xc2, 0x00, 
+	0x03, 0xc3, 0x00, 0x03, 0x41, 0xbc, 0x1f, 0xef, 0x20, 0x00, 0x06, 0x02, 0x09, 0x01, 0xdb, 0x7a, 
+	0x00, 0x0c, 0x17, 0x02, 0x7b, 0x11, 0x17, 0x1b, 0x0f, 0x00, 0x0d, 0x63, 0x0f, 0x10, 0x00, 0xa8, 
+	0xe8, 0x10, 0x03, 0x00, 0x80, 0xbd, 0xe8, 0x20, 0xdc, 0x4a, 0x00, 0xe7, 0x40, 0x94, 0xe5, 0x04, 
+	0x40, 0x06, 0xb0, 0xe1, 0x02, 0x4b, 0xa0, 0x31, 0x43, 0x03, 0xb7, 0xc4, 0x43, 0x0a, 0x10, 0x17, 
+	0x80, 0xe5, 0xc0, 0xea, 0x05, 0x37, 0x00, 0x0b, 0x44, 0x10, 0x00, 0xdf, 0x0e, 0xc0, 0xa0, 0x08, 
+	0xdb, 0x54, 0xe3, 0x85, 0x0c, 0xbb, 0x0b, 0x08, 0x00, 0x55, 0x1b, 0x8f, 0x01, 0x02, 0x03, 0xa9, 
+	0x00, 0x0b, 0x56, 0x07, 0xe3, 0xa0, 0x1c, 0xe1, 0x0b, 0x1c, 0x23, 0x97, 0x16, 0x01, 0xe2, 0x01, 
+	0x01, 0x43, 0xf0, 0x01, 0x2b, 0x00, 0x4f, 0xa1, 0x01, 0xe8, 0x06, 0xda, 0xe5, 0xff, 0x40, 0xe0, 
+	0x09, 0x1f, 0x2a, 0x80, 0xe1, 0x1e, 0x8b, 0x59, 0x0e, 0xc3, 0x20, 0x01, 0xbb, 0x10, 0x01, 0x40, 
+	0xa0, 0x13, 0x08, 0x40, 0xa0, 0x03, 0x02, 0xf7, 0x21, 0xe0, 0xf0, 0x01, 0xbf, 0xf0, 0x40, 0x61, 
+	0xa2, 0x12, 0xf3, 0x8e, 0x04, 0xa2, 0xe0, 0x50, 0xfa, 0x10, 0x7f, 0x0a, 0xeb, 0x00, 0xbb, 0x90, 
+	0xa0, 0x02, 0x6b, 0x94, 0x00, 0x03, 0x17, 0x03, 0x00, 0xeb, 0x0f, 0xd2, 0x10, 0x03, 0x0b, 0x43, 
+	0x34, 0x00, 0x1f, 0x34, 0xca, 0x00, 0x03, 0x2a, 0xd5, 0x09, 0x4f, 0x00, 0x0f, 0x30, 0x00, 0x0f, 
+	0x30, 0x00, 0x0f, 0x30, 0x40, 0x0f, 0x50, 0x20, 0x00, 0x0f, 0x2e, 0x02, 0x5f, 0x00, 0x00, 0xb0, 
+	0xe1, 0xaa, 0x1a, 0x47, 0x1c, 0x00, 0x1b, 0x1c, 0x40, 0x1b, 0x04, 0x00, 0x1b, 0x14, 0xa4, 0x00, 
+	0x0f, 0x14, 0x40, 0x0f, 0xf4, 0xf9, 0x1e, 0x83, 0xbd, 0xe8, 0x48, 0x7b, 0x00, 0x97, 0xfe, 0x15, 
+	0x30, 0x33, 0x01, 0x10, 0xb0, 0x43, 0x11, 0x31, 0x0b, 0x2d, 0xe9, 0xf0, 0x69, 0x03, 0x9b, 0x0c, 
+	0x17, 0x20, 0xec, 0x59, 0x12, 0x1f, 0x96, 0xe5, 0x10, 0x10, 0x96, 0x80, 0x02, 0x1b, 0x31, 0xe0, 
+	0x04, 0x60, 0x86, 0x02, 0x02, 0x10, 0x5a, 0x85, 0x02, 0x00, 0x43, 0x11, 0xd4, 0xf9, 0x9f, 0x60, 
+	0x15, 0x1c, 0x17, 0x1d, 0xa7, 0x01, 0x9b, 0x8a, 0xe2, 0xe0, 0x01, 0x90, 0x89, 0xe2, 0x0f, 0x00, 
+	0x99, 0xe8, 0x10, 0x0b, 0x54, 0xf0, 0x00, 0x0b, 0xf0, 0x00, 0x0b, 0x04, 0x26, 0x43, 0x51, 0x01, 
+	0x00, 0x06, 0x00, 0x52, 0x01, 0x07, 0x00, 0x53, 0x01, 0x48, 0x10, 0x00, 0x97, 0x01, 0x6b, 0x00, 
+	0x2b, 0x60, 0x86, 0xe2, 0x80, 0xd0, 0x57, 0x01, 0x0b, 0x8a, 0x12, 0xe0, 0x00, 0x80, 0x00, 0x12, 
+	0x00, 0x00, 0x46, 0x10, 0x06, 0x54, 0xa0, 0x05, 0x13, 0x00, 0x56, 0x85, 0x10, 0x10, 0x67, 0x6c, 
+	0x10, 0x67, 0x60, 0x0b, 0x00, 0x53, 0x02, 0xaf, 0x00, 0x00, 0x56, 0xe1, 0xf0, 0xcc, 0x1c, 0xb7, 
+	0x00, 0xbb, 0x16, 0x08, 0x30, 0xb7, 0x02, 0x1b, 0x1a, 0x15, 0xc1, 0x00, 0x0b, 0x1d, 0xdb, 0x15, 
+	0x08, 0xca, 0xe5, 0xb4, 0x01, 0x57, 0xaa, 0x06, 0xeb, 0xba, 0x14, 0x7f, 0x16, 0x00, 0x0f, 0x0d, 
+	0x02, 0xf3, 0x00, 0x00, 0x20, 0x0f, 0xe1, 0xdf, 0x20, 0xc2, 0xe3, 0x92, 0x43, 0x20, 0x0b, 0xc3, 
+	0xf0, 0x29, 0xe1, 0x0d, 0x06, 0xc7, 0x50, 0x13, 0x42, 0x1f, 0x40, 0x13, 0x08, 0x29, 0x9f, 0xe5, 
+	0x1f, 0x0f, 0x12, 0xca, 0x13, 0xd7, 0x01, 0x03, 0xfc, 0x18, 0x04, 0xab, 0x28, 0x10, 0xff, 0x91, 
+	0xcb, 0x1e, 0x4b, 0x17, 0x0b, 0x1a, 0xf0, 0x00, 0x13, 0xf0, 0x80, 0x13, 0x02, 0x17, 0xc2, 0x20, 
+	0x8b, 0x10, 0x37, 0x0d, 0x00, 0x51, 0xe1, 0x07, 0x2c, 0xaa, 0x9e, 0x11, 0x5f, 0xd0, 0xf8, 0x1e, 
+	0x7f, 0x3f, 0x5f, 0x10, 0x17, 0x0b, 0x27, 0xaa, 0x35, 0xc0, 0x08, 0x33, 0xc3, 0x02, 0x3f, 0xe2, 
+	0x10, 0x23, 0xb4, 0x00, 0x23, 0xc0, 0x10, 0x3b, 0x15, 0x6f, 0x7e, 0xb4, 0xda, 0xe5, 0xa4, 0x76, 
+	0x00, 0x9a, 0xe5, 0xbc, 0x86, 0x9a, 0xe5, 0xb4, 0x96, 0x00, 0x9a, 0xe5, 0xc0, 0x46, 0x9a, 0xe5, 
+	0xc4, 0x56, 0x01, 0x9a, 0xe5, 0xc8, 0x66, 0x9a, 0xe5, 0x0b, 0x02, 0x83, 0x77, 0x78, 0x01, 0xa7, 
+	0x10, 0xdf, 0x10, 0x3b, 0x80, 0x00, 0x83, 0x14, 0x17, 0x10, 0x0f, 0x6a, 0x28, 0x00, 0x07, 0x10, 
+	0x13, 0x18, 0x00, 0x07, 0x38, 0x01, 0xfb, 0x01, 0x08, 0x00, 0x20, 0xe2, 0x39, 0x01, 0xcf, 0x01, 
+	0x10, 0x10, 0x00, 0xe0, 0x38, 0x05, 0xca, 0xe5, 0x0a, 0xad, 0x84, 0x00, 0xe2, 0x8b, 0x80, 0x88, 
+	0xe0, 0x8b, 0x90, 0x89, 0x04, 0xe0, 0x4c, 0xf8, 0x9f, 0x15, 0x00, 0x03, 0xe5, 0x51, 0xc1, 0x05, 
+	0x9b, 0x13, 0xbb, 0xa8, 0x16, 0x9a, 0xe5, 0x51, 0x24, 0xb7, 0x42, 0xc1, 0x08, 0x0b, 0x82, 0xe2, 
+	0x51, 0x24, 0x30, 0x17, 0xf4, 0xe2, 0x02, 0xbb, 0x11, 0x57, 0x20, 0xdb, 0x50, 0x2d, 0xe9, 0x10, 
+	0xab, 0x18, 0x88, 0x00, 0x37, 0x03, 0x01, 0x52, 0x1d, 0xf7, 0x33, 0xff, 0x00, 0x02, 0xa0, 0x83, 
+	0x00, 0x90, 0xbd, 0xe8, 0x70, 0x3f, 0xd1, 0x03, 0xe7, 0x03, 0x20, 0x02, 0xe2, 0x02, 0x0f, 0x2f, 
+	0x00, 0x20, 0x40, 0x02, 0x10, 0x43, 0x0c, 0x27, 0x9a, 0xe5, 0x48, 0x24, 0x0c, 0x42, 0xe0, 0x10, 
+	0x17, 0x0c, 0x67, 0x08, 0x03, 0x0d, 0x10, 0x00, 0x82, 0xe2, 0xd8, 0x07, 0x9f, 0xe5, 0x07, 0xcc, 
+	0x00, 0x8a, 0xe2, 0xb0, 0xc0, 0x8c, 0xe2, 0xd0, 0xf7, 0x0a, 0x9f, 0xe5, 0xd0, 0x17, 0x34, 0xeb, 
+	0x40, 0x34, 0xd3, 0x11, 0x42, 0xa8, 0x03, 0x07, 0x00, 0x10, 0xd0, 0xe5, 0x53, 0x43, 0x03, 0x0e, 
+	0x20, 0xd0, 0xe5, 0xff, 0x00, 0x53, 0x10, 0x0b, 0x0b, 0xff, 0xe2, 0x00, 0x08, 0xc8, 0x9a, 0xe5, 
+	0x9c, 0x01, 0x01, 0xe0, 0x00, 0xf6, 0xc6, 0xda, 0xe5, 0x92, 0x1c, 0x21, 0xe0, 0x00, 0xc0, 0x10, 
+	0x41, 0xe2, 0x14, 0x07, 0x9a, 0xe5, 0x08, 0x41, 0x12, 0x80, 0xe0, 0x60, 0x6f, 0xc7, 0x9a, 0xe5, 
+	0x5a, 0x0c, 0x00, 0x6f, 0x02, 0x01, 0x73, 0x00, 0x37, 0x41, 0x13, 0x4b, 0x74, 0xaa, 0x00, 0xef, 
+	0x68, 0x40, 0x7b, 0x5c, 0x00, 0x7b, 0x54, 0x00, 0x7b, 0x00, 0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0, 
+	0x60, 0xe0, 0x10, 0x00, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0, 0x08, 0x00, 0x88, 0x48, 0xc8, 
+	0x28, 0xa8, 0x68, 0xe8, 0x18, 0x00, 0x98, 0x58, 0xd8, 0x38, 0xb8, 0x78, 0xf8, 0x04, 0x00, 0x84, 
+	0x44, 0xc4, 0x24, 0xa4, 0x64, 0xe4, 0x14, 0x00, 0x94, 0x54, 0xd4, 0x34, 0xb4, 0x74, 0xf4, 0x0c, 
+	0x00, 0x8c, 0x4c, 0xcc, 0x2c, 0xac, 0x6c, 0xec, 0x1c, 0x00, 0x9c, 0x5c, 0xdc, 0x3c, 0xbc, 0x7c, 
+	0xfc, 0x02, 0x00, 0x82, 0x42, 0xc2, 0x22, 0xa2, 0x62, 0xe2, 0x12, 0x00, 0x92, 0x52, 0xd2, 0x32, 
+	0xb2, 0x72, 0xf2, 0x0a, 0x00, 0x8a, 0x4a, 0xca, 0x2a, 0xaa, 0x6a, 0xea, 0x1a, 0x00, 0x9a, 0x5a, 
+	0xda, 0x3a, 0xba, 0x7a, 0xfa, 0x06, 0x00, 0x86, 0x46, 0xc6, 0x26, 0xa6, 0x66, 0xe6, 0x16, 0x00, 
+	0x96, 0x56, 0xd6, 0x36, 0xb6, 0x76, 0xf6, 0x0e, 0x00, 0x8e, 0x4e, 0xce, 0x2e, 0xae, 0x6e, 0xee, 
+	0x1e, 0x00, 0x9e, 0x5e, 0xde, 0x3e, 0xbe, 0x7e, 0xfe, 0x01, 0x00, 0x81, 0x41, 0xc1, 0x21, 0xa1, 
+	0x61, 0xe1, 0x11, 0x00, 0x91, 0x51, 0xd1, 0x31, 0xb1, 0x71, 0xf1, 0x09, 0x00, 0x89, 0x49, 0xc9, 
+	0x29, 0xa9, 0x69, 0xe9, 0x19, 0x00, 0x99, 0x59, 0xd9, 0x39, 0xb9, 0x79, 0xf9, 0x05, 0x00, 0x85, 
+	0x45, 0xc5, 0x25, 0xa5, 0x65, 0xe5, 0x15, 0x00, 0x95, 0x55, 0xd5, 0x35, 0xb5, 0x75, 0xf5, 0x0d, 
+	0x00, 0x8d, 0x4d, 0xcd, 0x2d, 0xad, 0x6d, 0xed, 0x1d, 0x00, 0x9d, 0x5d, 0xdd, 0x3d, 0xbd, 0x7d, 
+	0xfd, 0x03, 0x00, 0x83, 0x43, 0xc3, 0x23, 0xa3, 0x63, 0xe3, 0x13, 0x00, 0x93, 0x53, 0xd3, 0x33, 
+	0xb3, 0x73, 0xf3, 0x0b, 0x00, 0x8b, 0x4b, 0xcb, 0x2b, 0xab, 0x6b, 0xeb, 0x1b, 0x00, 0x9b, 0x5b, 
+	0xdb, 0x3b, 0xbb, 0x7b, 0xfb, 0x07, 0x00, 0x87, 0x47, 0xc7, 0x27, 0xa7, 0x67, 0xe7, 0x17, 0x00, 
+	0x97, 0x57, 0xd7, 0x37, 0xb7, 0x77, 0xf7, 0x0f, 0x00, 0x8f, 0x4f, 0xcf, 0x2f, 0xaf, 0x6f, 0xef, 
+	0x1f, 0x00, 0x9f, 0x5f, 0xdf, 0x3f, 0xbf, 0x7f, 0xff, 0x40, 0x02, 0x00, 0x13, 0xe3, 0x58, 0x36, 
+	0x9f, 0x06, 0x77, 0xd3, 0x10, 0x17, 0xa8, 0xc6, 0x0c, 0xe3, 0x20, 0xdc, 0xe5, 0x5a, 0xbb, 0x06, 
+	0xc7, 0x06, 0x04, 0xc7, 0x2d, 0x9b, 0x03, 0xa7, 0x07, 0x01, 0x7b, 0x02, 0xc3, 0x20, 0xca, 0xff, 
+	0x05, 0x3f, 0x13, 0x02, 0xd0, 0xe1, 0x2c, 0x0d, 0xf6, 0x9f, 0x05, 0xf8, 0x00, 0x13, 0x02, 0x6f, 
+	0xba, 0x10, 0x13, 0x00, 0xff, 0x40, 0x62, 0xe2, 0x33, 0x04, 0xd0, 0xe1, 0x41, 0x14, 0x00, 0x17, 
+	0x60, 0x00, 0x2d, 0xe9, 0x60, 0x01, 0xeb, 0x90, 0x06, 0x23, 0xe2, 0x14, 0x11, 0x83, 0x10, 0x41, 
+	0xe0, 0xec, 0x81, 0x00, 0x07, 0x91, 0x2c, 0x84, 0xe0, 0x70, 0x14, 0x00, 0x07, 0x00, 0x3c, 0x85, 
+	0xe0, 0x05, 0x50, 0x44, 0xe0, 0xf0, 0x80, 0x12, 0x0f, 0x00, 0x53, 0xe1, 0x01, 0x50, 0x85, 0x32, 
+	0x04, 0x01, 0x50, 0x45, 0xe2, 0x4c, 0x00, 0x1b, 0xff, 0xc0, 0x41, 0x01, 0x03, 0xdb, 0x5c, 0xe3, 
+	0x05, 0xc0, 0x8c, 0x01, 0xb7, 0x21, 0x00, 0xaa, 0x10, 0x0b, 0x10, 0x10, 0x81, 0xa2, 0x05, 0x5c, 
+	0x00, 0xea, 0x01, 0x0c, 0x5c, 0xe3, 0x01, 0x1c, 0x81, 0x21, 0xa2, 0x05, 0x06, 0x7b, 0xfe, 0x1c, 
+	0xc1, 0xe3, 0x50, 0xab, 0x20, 0x5c, 0x34, 0x10, 0x07, 0x82, 0xe0, 0x08, 0x50, 0x82, 0x02, 0xe2, 
+	0x01, 0x0c, 0x12, 0xe3, 0xff, 0x12, 0x7f, 0x2a, 0x00, 0x82, 0x13, 0x01, 0x0c, 0x15, 0xe3, 0xff, 
+	0x50, 0x20, 0x05, 0xe2, 0x04, 0xa3, 0x13, 0xf8, 0x30, 0x01, 0xe2, 0x20, 0x03, 0x31, 0x09, 0x83, 
+	0x0c, 0x11, 0xe3, 0x02, 0x3b, 0x00, 0x83, 0x12, 0xa2, 0x41, 0x83, 0xe0, 0xa5, 0x51, 0x00, 0x83, 
+	0xe0, 0x66, 0xce, 0x8a, 0xe2, 0x24, 0x35, 0x82, 0x0e, 0x13, 0x31, 0x9c, 0xe7, 0x3f, 0x4b, 0x0f, 
+	0x97, 0x40, 0x10, 0xd3, 0xe7, 0x25, 0x50, 0x0f, 0x5b, 0xc5, 0xe3, 0x05, 0x04, 0x50, 0xd3, 0xe7, 
+	0x58, 0x34, 0x1b, 0x33, 0x13, 0xe3, 0x08, 0x01, 0x4c, 0x84, 0x12, 0x0d, 0x9f, 0x12, 0x19, 0xcd, 
+	0xa0, 0x00, 0x33, 0x33, 0x40, 0x23, 0x40, 0x04, 0xe2, 0x04, 0x42, 0x18, 0x83, 0xe0, 0x25, 0x50, 
+	0x0f, 0x00, 0x6f, 0x05, 0x52, 0x83, 0x20, 0xe0, 0x07, 0x16, 0x03, 0x30, 0xf4, 0xe7, 0x08, 0x40, 
+	0x40, 0xd4, 0x0f, 0x93, 0x84, 0xe1, 0x01, 0x30, 0xf5, 0xe7, 0x00, 0x08, 0x50, 0xd5, 0xe5, 0x03, 
+	0x50, 0x85, 0xe1, 0x10, 0x04, 0x44, 0x85, 0x0b, 0x37, 0x02, 0xe2, 0x08, 0x30, 0x00, 0x62, 0xe2, 
+	0x10, 0x03, 0x14, 0xe0, 0xe4, 0xf4, 0x20, 0x9f, 0x05, 0x16, 0x9f, 0x0f, 0x0a, 0x10, 0xe3, 0x00, 
+	0x09, 0x02, 0xa0, 0x01, 0x04, 0x07, 0x5f, 0x03, 0x09, 0x00, 0x0b, 0x13, 0x01, 0xa0, 0x01, 0x02, 
+	0xeb, 0x02, 0x02, 0x00, 0x0b, 0x06, 0x4f, 0x02, 0x02, 0x60, 0x00, 0xbd, 0xe8, 0x18, 0x00, 0x03, 
+	0x02, 0x0a, 0x10, 0x51, 0xe0, 0x1d, 0x01, 0x93, 0x60, 0x02, 0xef, 0x00, 0x82, 0x01, 0x0b, 0x68, 
+	0x00, 0x8f, 0xe2, 0xa4, 0x0b, 0x83, 0x07, 0xb4, 0x03, 0x9f, 0x00, 0x05, 0xa7, 0x0a, 0x63, 0xea, 
+	0x10, 0x0b, 0xfb, 0x56, 0x18, 0xca, 0xe5, 0xfa, 0x03, 0xbf, 0x05, 0x77, 0xe3, 0x07, 0x90, 0x2f, 
+	0xbd, 0xa8, 0x13, 0xbb, 0x5c, 0x00, 0x27, 0x11, 0x53, 0x10, 0x0f, 0x10, 0x1b, 0x03, 0x01, 0x10, 
+	0x80, 0xe2, 0xfa, 0x16, 0x09, 0x97, 0x01, 0x8b, 0x00, 0x80, 0x20, 0x81, 0xe2, 0x00, 0xc0, 0xe2, 
+	0xe7, 0x20, 0x5a, 0xc4, 0x00, 0x33, 0xc0, 0xc2, 0xe5, 0x80, 0x02, 0x01, 0x81, 0xe0, 0x1a, 0x1d, 
+	0x8a, 0xe2, 0x20, 0x07, 0x37, 0xb1, 0x10, 0x3b, 0x44, 0x10, 0x63, 0x03, 0xeb, 0x02, 0x80, 0xc8, 
+	0x0a, 0x33, 0x00, 0xa0, 0xe3, 0x3b, 0x16, 0x00, 0xeb, 0x18, 0x04, 0x88, 0x18, 0x27, 0xd0, 0xe5, 
+	0x40, 0x0f, 0xeb, 0x00, 0x10, 0xc0, 0x3b, 0xe5, 0x24, 0x00, 0x23, 0x54, 0x33, 0x56, 0x3f, 0xd0, 
+	0x10, 0xa7, 0x00, 0x0f, 0x0e, 0x00, 0xe0, 0x8f, 0x12, 0x07, 0x47, 0x0f, 0x32, 0x3a, 0x0b, 0xfc, 
+	0x95, 0x0b, 0x27, 0xfc, 0x03, 0x3a, 0x0b, 0xf8, 0x00, 0x0b, 0xf8, 0x00, 0x0b, 0xac, 0x1a, 0x03, 
+	0xf4, 0x40, 0x07, 0xfb, 0x40, 0x47, 0x0e, 0x25, 0x1b, 0x6c, 0x20, 0x10, 0x1a, 0x26, 0xab, 0xdc, 
+	0xf3, 0x9f, 0xe5, 0xf3, 0xd5, 0x09, 0x87, 0x10, 0x0b, 0xd4, 0x00, 0x0b, 0xd4, 0xd0, 0x5b, 0x40, 
+	0x39, 0x8b, 0xd8, 0x94, 0x73, 0x01, 0x43, 0xe0, 0xf2, 0x87, 0x12, 0x87, 0x80, 0xe0, 0x00, 0x40, 
+	0x00, 0x82, 0x87, 0x00, 0x80, 0x32, 0x01, 0x00, 0x52, 0x97, 0x00, 0x07, 0x40, 0x32, 0x92, 0x8b, 
+	0x00, 0xf2, 0x8b, 0x62, 0x8b, 0x11, 0x7f, 0xd8, 0x12, 0x8b, 0x10, 0x73, 0x38, 0x00, 0xeb, 0x10, 
+	0x97, 0xf8, 0xf2, 0x9f, 0x03, 0xe5, 0x0c, 0x40, 0xa0, 0xe1, 0x2e, 0x00, 0x27, 0x81, 0x0b, 0x5a, 
+	0x11, 0x10, 0x1f, 0xc8, 0xc0, 0xaf, 0x5b, 0x17, 0xf0, 0x0b, 0x17, 0x08, 0xb6, 0x41, 0x0b, 0xec, 
+	0x1b, 0x23, 0x41, 0x03, 0xfc, 0x0b, 0x2b, 0x10, 0x07, 0x79, 0xa0, 0x25, 0xf3, 0x50, 0x03, 0x83, 
+	0xa0, 0xe3, 0x79, 0x04, 0xca, 0x41, 0x05, 0x00, 0x67, 0x01, 0xe4, 0xf2, 0x9f, 0x05, 0x14, 0xc7, 
+	0x6e, 0x68, 0x04, 0xc7, 0x10, 0x77, 0xd8, 0x00, 0x77, 0x54, 0xd7, 0x10, 0x0f, 0xc8, 0xaa, 0x00, 
+	0x0f, 0xbc, 0x0a, 0x9f, 0x4c, 0x0a, 0x0f, 0x6c, 0x0d, 0xeb, 0x7b, 0x08, 0x00, 0xc0, 0xe3, 0xe0, 
+	0x00, 0x03, 0x01, 0xcc, 0x01, 0x02, 0xe2, 0x8c, 0x01, 0x80, 0xe1, 0x07, 0x00, 0xdf, 0x0c, 0x0c, 
+	0x06, 0x80, 0xe1, 0xf8, 0x10, 0x07, 0x00, 0x0f, 0x6c, 0x00, 0x08, 0x0a, 0xe5, 0x06, 0x02, 0x05, 
+	0xd7, 0x40, 0xd4, 0xe2, 0x90, 0x09, 0x03, 0x43, 0xf0, 0x08, 0xeb, 0xf0, 0x40, 0xa0, 0xa3, 0x7a, 
+	0xe4, 0x05, 0xdb, 0x18, 0xc3, 0x1a, 0x63, 0x00, 0x13, 0x03, 0x06, 0xd7, 0x1a, 0x52, 0xe9, 0x00, 
+	0xb3, 0xeb, 0x05, 0x7b, 0x0c, 0xc0, 0x36, 0x1b, 0xb8, 0xa0, 0x03, 0x8b, 0x80, 0x01, 0x27, 0xb0, 
+	0xc0, 0xdc, 0xe1, 0x0c, 0xc3, 0x05, 0x6f, 0x01, 0x23, 0x1a, 0xe8, 0x46, 0xca, 0x26, 0xf7, 0x08, 
+	0x3b, 0x55, 0xe1, 0x10, 0x8f, 0x3c, 0x00, 0x8f, 0x60, 0x0a, 0xab, 0x64, 0x04, 0x5b, 0x70, 0x00, 
+	0x04, 0x57, 0x10, 0x4b, 0x09, 0xd7, 0x1a, 0x65, 0x14, 0xca, 0x39, 0xe5, 0x67, 0x02, 0x73, 0x10, 
+	0x4b, 0x08, 0xab, 0x1a, 0xa0, 0x00, 0x4b, 0x20, 0x01, 0xc1, 0x30, 0x4b, 0x08, 0xc0, 0x4c, 0xe2, 
+	0x0c, 0xc8, 0x07, 0x5b, 0x10, 0x4f, 0x64, 0x44, 0xb0, 0x4f, 0xf0, 0xf1, 0x9f, 0x03, 0xe5, 0x68, 
+	0x24, 0x9a, 0xe5, 0x6c, 0x80, 0x4f, 0x10, 0x9b, 0x5d, 0x6d, 0x00, 0x4f, 0x6f, 0x40, 0x4f, 0x10, 
+	0x9b, 0x50, 0x4f, 0xb2, 0x20, 0x9b, 0x8a, 0x11, 0xdf, 0x00, 0x1a, 0x6c, 0xc0, 0x4b, 0xa8, 0x00, 
+	0x4b, 0x34, 0xc0, 0x28, 0xfb, 0x70, 0x97, 0x35, 0x15, 0xca, 0xe5, 0x37, 0xc5, 0xa9, 0x70, 0x97, 
+	0xb0, 0x00, 0x47, 0x81, 0x40, 0xe3, 0x30, 0x05, 0x02, 0x4f, 0x9d, 0x40, 0x97, 0x34, 0x45, 0x40, 
+	0x4b, 0x0f, 0x0b, 0x10, 0x4b, 0x60, 0x00, 0x4b, 0x10, 0x6d, 0x2e, 0x8a, 0x07, 0x8f, 0x92, 0xe8, 
+	0xe0, 0x16, 0xad, 0xb0, 0x53, 0xe1, 0x03, 0x6b, 0xe3, 0x41, 0x37, 0x10, 0x53, 0xd8, 0x10, 0x53, 
+	0x8d, 0x00, 0x9b, 0x03, 0x00, 0x9c, 0x69, 0x1f, 0x10, 0x53, 0xe0, 0x01, 0x3b, 0x96, 0x05, 0x5b, 
+	0xea, 0x04, 0x08, 0xaf, 0x03, 0x02, 0x4b, 0x10, 0x57, 0x0c, 0xad, 0x00, 0x57, 0xcc, 0xc2, 0x3f, 
+	0x38, 0x42, 0xef, 0x13, 0x53, 0xe8, 0x01, 0x93, 0x55, 0x34, 0x07, 0xe7, 0x64, 0x06, 0xe3, 0x6c, 
+	0x00, 0x03, 0xe0, 0x00, 0x0f, 0xa0, 0x10, 0x1b, 0x20, 0x0b, 0x63, 0x3c, 0x56, 0x00, 0x03, 0x21, 
+	0x00, 0x3d, 0x00, 0x08, 0x18, 0x65, 0x00, 0x03, 0x94, 0x44, 0x61, 0x0b, 0x1f, 0x60, 0x00, 0x06, 
+	0x1b, 0x6f, 0x18, 0x63, 0xaa, 0x00, 0x0b, 0x68, 0x00, 0x0b, 0xe5, 0x0b, 0x6b, 0x70, 0x00, 0x07, 
+	0xb9, 0xa0, 0x00, 0x07, 0x78, 0x00, 0x07, 0xbd, 0x03, 0x02, 0x48, 0xef, 0x80, 0x00, 0x0b, 0x40, 
+	0x01, 0x06, 0x2c, 0x4d, 0x00, 0x03, 0x02, 0x89, 0x0e, 0x00, 0x08, 0xec, 0x7a, 0x3b, 0xc7, 0x48, 
+	0x40, 0x7c, 0x10, 0x07, 0xaf, 0xde, 0xbc, 0x71, 0x00, 0x08, 0x00, 0x49, 0x73, 0x00, 0x03, 0xcc, 
+	0x68, 0x00, 0x08, 0x05, 0xfc, 0x53, 0x00, 0x03, 0x90, 0x00, 0x03, 0x48, 0x00, 0x03, 0x00, 0xac, 
+	0x67, 0x00, 0x03, 0x10, 0x95, 0x00, 0x08, 0x30, 0xa0, 0x66, 0x0b, 0x9f, 0x0b, 0xdb, 0xa0, 0x31, 
+	0x00, 0x06, 0x00, 0x04, 0x79, 0x00, 0x08, 0x30, 0x32, 0x00, 0x06, 0x59, 0x2c, 0x00, 0x03, 0x60, 
+	0x00, 0x03, 0x1c, 0x1f, 0x88, 0x44, 0x3c, 0x07, 0x08, 0x68, 0x81, 0x00, 0x08, 0x1c, 0x07, 0x34, 
+	0x5a, 0x00, 0x29, 0x03, 0x7c, 0x0c, 0x07, 0xec, 0x00, 0x03, 0x48, 0x4b, 0x3c, 0x1f, 0xaa, 0x5c, 
+	0x1b, 0x30, 0x00, 0x43, 0x2c, 0x00, 0x57, 0x94, 0x00, 0x0f, 0xcc, 0x90, 0x00, 0x27, 0x98, 0x5c, 
+	0x00, 0x63, 0x4c, 0x00, 0x03, 0x04, 0x10, 0x64, 0x00, 0x03, 0xd3, 0xeb, 0x74, 0x21, 0x9f, 0xe5, 
+	0x0a, 0x92, 0xc1, 0x81, 0xe0, 0x1f, 0x13, 0x6c, 0x0d, 0x43, 0x01, 0x00, 0x80, 0x48, 0xe0, 0x03, 
+	0x8c, 0x48, 0x02, 0x01, 0xa0, 0x05, 0x63, 0xfc, 0x01, 0xd3, 0xe0, 0x10, 0x00, 0xe2, 0xa1, 0x10, 
+	0xc1, 0x94, 0xe7, 0x0c, 0xa6, 0xe2, 0x00, 0x14, 0x8c, 0x3a, 0xe0, 0xf0, 0x08, 0x6b, 0x1d, 0xe7, 
+	0x1d, 0xe3, 0x51, 0x42, 0x37, 0x38, 0x00, 0xf1, 0x9f, 0x15, 0xf0, 0x14, 0x00, 0xea, 0x0c, 0x08, 
+	0x20, 0x42, 0xe0, 0x0c, 0x0b, 0x8f, 0x00, 0x10, 0x2d, 0x00, 0xe9, 0x01, 0xc0, 0xd1, 0xe4, 0x01, 
+	0xc0, 0xc0, 0x02, 0xe4, 0x01, 0x20, 0x52, 0xe2, 0xfb, 0x1a, 0x77, 0x10, 0x00, 0xbd, 0xe8, 0x01, 
+	0x0c, 0x40, 0xe2, 0x01, 0x20, 0xbd, 0x00, 0x17, 0x20, 0x00, 0x17, 0x0a, 0xff, 0x10, 0x17, 0x11, 
+	0x73, 0x05, 0x05, 0x7f, 0x00, 0xc0, 0xfd, 0xff, 0xeb, 0x05, 0x50, 0xbd, 0xe8, 0x05, 0xf0, 0xf0, 
+	0x9f, 0xe5, 0x18, 0x00, 0x0f, 0xd9, 0x04, 0xb7, 0x30, 0xff, 0x20, 0x3c, 0x1b, 0x18, 0xcb, 0x01, 
+	0x1c, 0x41, 0x02, 0x65, 0xef, 0x00, 0x07, 0x04, 0x53, 0x02, 0x02, 0x04, 0x43, 0x48, 0x03, 0xa7, 
+	0xb5, 0x11, 0xe7, 0xc4, 0x00, 0x2f, 0x11, 0xcf, 0x18, 0x05, 0x6b, 0x50, 0x02, 0xcb, 0x71, 0x1f, 
+	0x00, 0xa7, 0x15, 0x87, 0x09, 0x1f, 0xe7, 0x0e, 0xf0, 0x02, 0xab, 0x42, 0xc0, 0x0e, 0x4f, 0x20, 
+	0xdc, 0xe1, 0x01, 0x0a, 0xaf, 0xb0, 0x0b, 0x20, 0xcc, 0xe1, 0x98, 0x03, 0x53, 0x90, 0x04, 0xaf, 
+	0x04, 0x1f, 0xa8, 0x1a, 0x5b, 0x1a, 0x10, 0xe7, 0x9c, 0x00, 0x37, 0x0c, 0x10, 0x9f, 0x23, 0xe5, 
+	0x80, 0x0d, 0xbf, 0x00, 0x10, 0x80, 0x19, 0x77, 0x20, 0x2b, 0xd6, 0x22, 0x2b, 0x40, 0x1f, 0x08, 
+	0x00, 0x1f, 0x60, 0x40, 0x1f, 0x10, 0x17, 0x02, 0xaa, 0x02, 0xdb, 0x98, 0x0c, 0x67, 0x50, 0x00, 
+	0x17, 0x04, 0x0a, 0x43, 0x20, 0x64, 0x04, 0x0b, 0x17, 0x3e, 0x73, 0xe1, 0xfd, 0x03, 0xfb, 0x3c, 
+	0xf0, 0x00, 0x9f, 0xb5, 0x0f, 0x0d, 0x5c, 0xe3, 0x34, 0xf0, 0x2d, 0x9f, 0xa5, 0x10, 0xdf, 0x0c, 
+	0x00, 0x2f, 0x10, 0xaf, 0x28, 0x00, 0xaf, 0xa0, 0x10, 0xe7, 0x1c, 0x00, 0x07, 0x56, 0x55, 0x55, 
+	0x55, 0x00, 0x22, 0x03, 0x06, 0x0f, 0xfa, 0x00, 0x08, 0xa8, 0x01, 0xd3, 0x50, 0x82, 0x01, 0xa7, 
+	0x00, 0x02, 0x00, 0x04, 0xc4, 0x01, 0xcb, 0xe0, 0xc1, 0x00, 0x03, 0x10, 0x07, 0x5c, 0xc8, 0x00, 
+	0x08, 0x44, 0x0a, 0x9f, 0x04, 0x0f, 0x20, 0x00, 0xe2, 0x57, 0x2a, 0x9f, 0xb0, 0xe1, 0x80, 0x02, 
+	0xeb, 0x0a, 0x57, 0x55, 0xca, 0xe5, 0x65, 0x25, 0x15, 0xca, 0xe5, 0x0f, 0x00, 0x9f, 0x64, 0x01, 
+	0xa7, 0x65, 0x03, 0x7b, 0x80, 0x11, 0x53, 0x02, 0xc0, 0xa0, 0x41, 0x65, 0xc5, 0xca, 0x8a, 0x0f, 
+	0x2b, 0x00, 0x5a, 0x64, 0x00, 0x2f, 0x20, 0x00, 0x37, 0x01, 0x25, 0x20, 0x92, 0x1b, 0x83, 0x0a, 
+	0x01, 0x09, 0xf7, 0x0f, 0x07, 0x6b, 0xaa, 0x10, 0x2f, 0x10, 0x0a, 0x3b, 0x01, 0x07, 0x3f, 0xcc, 
+	0x0d, 0x87, 0x48, 0xaa, 0x40, 0x5f, 0x5b, 0x80, 0x5f, 0x5b, 0x00, 0x5f, 0x69, 0x40, 0x5f, 0x68, 
+	0xab, 0x00, 0x2f, 0x69, 0x80, 0x5f, 0x69, 0x40, 0x5f, 0x68, 0xf0, 0x5f, 0x20, 0x5f, 0xc1, 0x10, 
+	0x2f, 0x50, 0x5f, 0x06, 0x01, 0x00, 0x0b, 0x50, 0x40, 0x5f, 0x55, 0x63, 0x80, 0x5f, 0x63, 0x00, 
+	0x5f, 0x6d, 0x40, 0x5f, 0x6c, 0x00, 0x2f, 0x57, 0x6d, 0x80, 0x5f, 0x6d, 0x40, 0x5f, 0x6c, 0xf0, 
+	0x5f, 0x20, 0x5f, 0x10, 0x2f, 0xa0, 0x50, 0x5f, 0x58, 0x00, 0x5f, 0x4c, 0x25, 0xda, 0xe5, 0x5c, 
+	0xa8, 0x00, 0x63, 0x5f, 0x00, 0x2f, 0x80, 0x0f, 0x63, 0x5f, 0x55, 0xca, 0x43, 0x05, 0x10, 0x67, 
+	0x7f, 0x00, 0x02, 0x12, 0x06, 0xa7, 0x0d, 0x17, 0x86, 0x0d, 0xa3, 0x00, 0x50, 0x12, 0x5c, 0x03, 
+	0xef, 0x27, 0x0b, 0xfb, 0x1b, 0x9f, 0xe5, 0x54, 0x1b, 0xf3, 0x07, 0xcf, 0x54, 0x00, 0x4b, 0x1c, 
+	0x07, 0x08, 0x00, 0xf1, 0x9f, 0xe7, 0x02, 0x47, 0xe1, 0x10, 0x84, 0x01, 0x00, 0x08, 0x98, 0x85, 
+	0x00, 0x08, 0x1c, 0x00, 0x07, 0x05, 0xf4, 0x83, 0x00, 0x08, 0x58, 0x00, 0x27, 0x80, 0x00, 0x6b, 
+	0x05, 0xac, 0x25, 0x9a, 0xe5, 0x66, 0x00, 0x83, 0x02, 0x09, 0x3b, 0x06, 0x12, 0x20, 0x42, 0xe2, 
+	0x63, 0x04, 0x6f, 0x10, 0x1b, 0xc0, 0xbd, 0x00, 0x1b, 0x68, 0x01, 0x43, 0x11, 0xa3, 0x1e, 0xa7, 
+	0x12, 0x53, 0x55, 0x2c, 0x4f, 0x24, 0x50, 0xe2, 0x04, 0x9b, 0x4a, 0x55, 0x00, 0x73, 0x6e, 0x00, 
+	0x35, 0x00, 0xeb, 0x11, 0x63, 0x50, 0x1f, 0x59, 0x80, 0x1f, 0x59, 0x00, 0x1f, 0x5b, 0xb9, 0x00, 
+	0x1f, 0x4c, 0x40, 0x67, 0x1d, 0x2b, 0x5d, 0x40, 0x1f, 0x05, 0x27, 0x2e, 0x4a, 0x5d, 0x40, 0xb3, 
+	0x20, 0x00, 0xb3, 0x11, 0x47, 0x50, 0x43, 0x61, 0xb2, 0x80, 0x43, 0x61, 0x00, 0x23, 0x07, 0x1c, 
+	0xeb, 0x45, 0x00, 0xff, 0x66, 0xaa, 0x00, 0x17, 0x87, 0x03, 0x37, 0x00, 0x01, 0x33, 0x18, 0x00, 
+	0xaf, 0x56, 0xc0, 0x01, 0x1b, 0x10, 0xff, 0xff, 0x20, 0x32, 0x12, 0x21, 0x22, 0x20, 0xa0, 0x01, 
+	0x09, 0x4b, 0x02, 0x01, 0x20, 0x40, 0x12, 0x6d, 0x66, 0x01, 0x7b, 0x1f, 0xe3, 0x56, 0x10, 0x07, 
+	0x00, 0x1f, 0x0d, 0x00, 0x53, 0x00, 0x07, 0x00, 0x11, 0xe2, 0x80, 0x00, 0x11, 0x13, 0x96, 0x06, 
+	0x17, 0x0a, 0x70, 0x00, 0xef, 0x08, 0x03, 0x6f, 0x05, 0x77, 0xba, 0x50, 0x08, 0x04, 0x1b, 0x32, 
+	0x0d, 0xf7, 0x01, 0x10, 0xe0, 0x11, 0x98, 0x1c, 0x93, 0x02, 0x0b, 0x03, 0x8f, 0x07, 0xe3, 0x70, 
+	0x25, 0x8a, 0x2a, 0xe5, 0x5c, 0x00, 0xbb, 0x49, 0x00, 0x77, 0x6a, 0xc0, 0x77, 0x5a, 0xd6, 0xf0, 
+	0x77, 0x20, 0x77, 0x6a, 0x40, 0x77, 0x5a, 0xf0, 0x77, 0x20, 0x77, 0x74, 0xca, 0xf0, 0x77, 0x03, 
+	0x83, 0x61, 0x12, 0x90, 0x77, 0x74, 0x00, 0x77, 0x91, 0xf5, 0x00, 0x77, 0x11, 0x93, 0x18, 0x5f, 
+	0x10, 0x07, 0x06, 0x01, 0x93, 0xc0, 0x04, 0xd3, 0x0b, 0xcd, 0x0f, 0x4f, 0xe2, 0x17, 0xd7, 0xbc, 
+	0x07, 0xd7, 0x14, 0xdf, 0xbb, 0x11, 0x3b, 0xe8, 0x0f, 0xb3, 0x10, 0x03, 0x10, 0x17, 0x98, 0x00, 
+	0x17, 0x10, 0x27, 0xc5, 0x0c, 0xeb, 0x04, 0x23, 0x8f, 0xe2, 0xcc, 0x00, 0x17, 0x20, 0x08, 0x2f, 
+	0x05, 0x40, 0x00, 0x80, 0xe3, 0x20, 0x06, 0x07, 0xc4, 0x00, 0x0f, 0x41, 0x44, 0x01, 0x4f, 0x01, 
+	0x13, 0xa0, 0xe3, 0xc0, 0x02, 0x7b, 0x18, 0x62, 0x20, 0xc1, 0x00, 0x0f, 0x1a, 0xd3, 0x10, 0xe3, 
+	0x64, 0x12, 0x05, 0xda, 0x05, 0x0a, 0x73, 0xe1, 0xf0, 0x02, 0x2f, 0x55, 0xde, 0x42, 0xcb, 0x02, 
+	0x33, 0x03, 0x11, 0x2b, 0x11, 0x7b, 0x10, 0xaf, 0x0a, 0xcb, 0x02, 0x00, 0x32, 0x11, 0x82, 0x00, 
+	0x02, 0x10, 0xa0, 0x11, 0x16, 0x02, 0x0b, 0x51, 0x1d, 0xf7, 0xa3, 0x1c, 0x0f, 0x00, 0x07, 0xd3, 
+	0x83, 0x10, 0x53, 0x63, 0x20, 0xd1, 0xe5, 0x63, 0x04, 0x27, 0x1f, 0x03, 0xc0, 0x29, 0xf3, 0x01, 
+	0x03, 0x02, 0x20, 0xb0, 0x11, 0xe7, 0x13, 0x10, 0x00, 0x0a, 0x9c, 0x07, 0x27, 0x01, 0x05, 0x80, 
+	0xe3, 0x15, 0x08, 0x01, 0x81, 0x24, 0x47, 0x45, 0x00, 0x87, 0xff, 0x03, 0x1f, 0x6b, 0x56, 0x02, 
+	0xa3, 0x10, 0x0f, 0x46, 0x00, 0x0f, 0x70, 0x10, 0x03, 0x00, 0x6f, 0x00, 0x02, 0x11, 0xa0, 0xe3, 
+	0x02, 0x17, 0x81, 0xe2, 0x40, 0xa8, 0x00, 0x33, 0x90, 0x12, 0x32, 0xe0, 0x82, 0x10, 0x20, 0xb0, 
+	0x41, 0x01, 0x57, 0x43, 0x22, 0x2a, 0xa0, 0xe1, 0x90, 0x21, 0x27, 0x20, 0x42, 0x0b, 0x0b, 0x82, 
+	0xe2, 0x94, 0x05, 0x90, 0x05, 0x27, 0x0a, 0x82, 0x02, 0x4b, 0x80, 0xe0, 0x81, 0x08, 0x1e, 0x80, 
+	0xe2, 0x9c, 0x00, 0x0f, 0x10, 0x63, 0x10, 0x8b, 0x10, 0x67, 0xc7, 0x0d, 0xff, 0xff, 0xea, 0x47, 
+	0x10, 0x67, 0x01, 0x93, 0x57, 0x01, 0x93, 0x49, 0x60, 0x10, 0xd7, 0x20, 0x11, 0x0a, 0xc7, 0x8f, 
+	0x12, 0x15, 0xf3, 0x05, 0xa0, 0x21, 0xd2, 0x17, 0x55, 0x00, 0x17, 0x07, 0x01, 0x0b, 0x55, 0x71, 
+	0x00, 0x07, 0x0e, 0x08, 0x03, 0xde, 0x09, 0x27, 0x0c, 0x01, 0x57, 0x00, 0xba, 0x13, 0x00, 0xea, 
+	0x0a, 0xfe, 0x14, 0x02, 0x00, 0x28, 0x04, 0x50, 0x06, 0xa0, 0x08, 0x3c, 0x0a, 0x00, 0x0e, 0x0c, 
+	0x1a, 0x0e, 0x0c, 0x10, 0x18, 0x12, 0x00, 0x30, 0x14, 0x60, 0x16, 0xc0, 0x18, 0x48, 0x1a, 0x05, 
+	0x10, 0x1c, 0x20, 0x1e, 0x48, 0x81, 0x4b, 0x68, 0x01, 0x4b, 0xd7, 0x13, 0x07, 0x11, 0x4b, 0x68, 
+	0x41, 0x4b, 0x59, 0x81, 0x47, 0x11, 0xfb, 0x12, 0x4b, 0xd7, 0xf1, 0x47, 0xf1, 0x47, 0x69, 0x01, 
+	0x47, 0x69, 0x01, 0x47, 0x11, 0x8b, 0xd1, 0x4b, 0x55, 0x80, 0x01, 0x4b, 0xa0, 0x41, 0x4b, 0x0c, 
+	0x41, 0x4b, 0x49, 0x41, 0x4b, 0x57, 0x5a, 0x41, 0x4b, 0x4a, 0x00, 0x0f, 0x74, 0x10, 0x03, 0xf1, 
+	0x4b, 0xf1, 0x4b, 0xae, 0x41, 0x4b, 0x98, 0xc1, 0x4b, 0xa0, 0x81, 0x4b, 0x10, 0x67, 0x11, 0x4b, 
+	0x4b, 0xa8, 0x41, 0x4b, 0x5b, 0x41, 0x4b, 0x02, 0x01, 0x4b, 0x4b, 0x2f, 0x4f, 0xaa, 0x61, 0x4b, 
+	0x59, 0x41, 0x4b, 0x75, 0xc1, 0x4b, 0x53, 0x01, 0x4b, 0x4c, 0xd7, 0x00, 0x3b, 0x10, 0x9b, 0x4e, 
+	0x00, 0x07, 0x78, 0x10, 0x03, 0xf0, 0x9b, 0xf0, 0x9b, 0xc5, 0x00, 0x9b, 0x10, 0x7f, 0xb4, 0x27, 
+	0xc1, 0x26, 0xaf, 0x4f, 0x40, 0x7f, 0x55, 0x5f, 0x40, 0x7f, 0x04, 0x00, 0x7f, 0x6b, 0x80, 0x7f, 
+	0x5d, 0x40, 0x7f, 0x6d, 0x79, 0x40, 0x7f, 0x27, 0x43, 0xf6, 0x0b, 0x83, 0x00, 0x07, 0xe2, 0x00, 
+	0xbf, 0x75, 0x50, 0x00, 0x3f, 0x14, 0x67, 0x11, 0xa3, 0x6c, 0x82, 0xef, 0x61, 0x81, 0xa7, 0xaa, 
+	0x10, 0x6f, 0x79, 0x01, 0x7f, 0x79, 0x82, 0xc7, 0xa4, 0x00, 0x9f, 0x02, 0x0d, 0x09, 0x80, 0xe3, 
+	0x7c, 0x0b, 0x93, 0x10, 0x87, 0x52, 0x14, 0xb7, 0x89, 0x08, 0x3b, 0x18, 0x20, 0x8f, 0x05, 0xbf, 
+	0xd2, 0xe7, 0x14, 0xdb, 0x35, 0x08, 0x20, 0x0e, 0x67, 0x00, 0x3b, 0xa4, 0x03, 0xbf, 0xbc, 0x40, 
+	0xaf, 0x00, 0x00, 0x01, 0x05, 0x11, 0x15, 0x17, 0x25, 0x33, 0x00, 0x34, 0x35, 0x37, 0x45, 0x47, 
+	0x55, 0x65, 0x75, 0x55, 0x53, 0x40, 0xbf, 0x63, 0x40, 0xbf, 0x08, 0x00, 0xbf, 0x9b, 0x80, 0xbf, 
+	0x55, 0x61, 0x00, 0x17, 0xd6, 0x00, 0xa7, 0x7c, 0x04, 0x5f, 0x7c, 0x00, 0x2b, 0x80, 0x10, 0x57, 
+	0x20, 0x14, 0xda, 0x05, 0x80, 0x10, 0xc1, 0x00, 0x03, 0x20, 0x14, 0xca, 0x05, 0x00, 0x20, 0x22, 
+	0x34, 0xe0, 0x0f, 0x06, 0x03, 0x10, 0x93, 0x0f, 0x00, 0x33, 0x98, 0x10, 0x40, 0x8f, 0x03, 0xe7, 
+	0x80, 0xe0, 0xb0, 0x20, 0x91, 0xe1, 0x10, 0x01, 0x03, 0xa0, 0x08, 0x47, 0xa0, 0xe3, 0xb1, 0x20, 
+	0x36, 0x80, 0xe1, 0x1d, 0x6b, 0x2c, 0x07, 0xf5, 0x07, 0xd3, 0x0a, 0x17, 0x7c, 0xd5, 0x16, 0xa3, 
+	0x00, 0x2f, 0x88, 0x00, 0x2f, 0x0c, 0x00, 0x5b, 0x04, 0x00, 0x43, 0x50, 0x10, 0x06, 0x3b, 0x80, 
+	0x04, 0x43, 0xb0, 0x20, 0xd1, 0xe1, 0x50, 0xb8, 0x00, 0xb3, 0xac, 0x10, 0x4b, 0x21, 0x91, 0xe7, 
+	0xbc, 0xb4, 0x00, 0x0b, 0xa4, 0x10, 0x37, 0x00, 0x57, 0xfe, 0x00, 0x33, 0x80, 0x00, 0x1a, 0x40, 
+	0xe2, 0x88, 0x02, 0x0b, 0x18, 0x6f, 0x7e, 0x22, 0x67, 0x00, 0x10, 0xe2, 0x03, 0x09, 0x00, 0x6b, 
+	0x03, 0x80, 0xe1, 0x8c, 0xbc, 0x40, 0x17, 0x7f, 0x10, 0x17, 0x16, 0x67, 0x01, 0x4f, 0x06, 0x93, 
+	0xe2, 0x80, 0x80, 0x40, 0x17, 0x54, 0xf0, 0x16, 0xf2, 0x8d, 0xf3, 0x49, 0x00, 0xf4, 0x88, 0xf5, 
+	0xb4, 0xf6, 0xba, 0xf7, 0x2a, 0x00, 0xf8, 0x0b, 0xf9, 0x25, 0xfa, 0xcd, 0xfa, 0x51, 0x00, 0xfb, 
+	0x1f, 0xfc, 0xe4, 0xfc, 0x5e, 0xfd, 0x06, 0x00, 0xfe, 0x04, 0x05, 0x74, 0x04, 0xfc, 0x03, 0xc0, 
+	0x00, 0x03, 0x5a, 0x03, 0xfa, 0x02, 0xa6, 0x02, 0x82, 0x00, 0x02, 0x3a, 0x02, 0xe0, 0x01, 0xaa, 
+	0x01, 0x80, 0x00, 0x01, 0x3e, 0x01, 0xfc, 0x00, 0xd8, 0x00, 0xa2, 0x00, 0x00, 0xaa, 0x04, 0x26, 
+	0x04, 0xb4, 0x03, 0x7e, 0x00, 0x03, 0x3c, 0x03, 0xc4, 0x02, 0x76, 0x02, 0x52, 0x00, 0x02, 0x10, 
+	0x02, 0xbc, 0x01, 0x8c, 0x01, 0x62, 0x00, 0x01, 0x26, 0x01, 0xea, 0x00, 0xc6, 0x00, 0x96, 0x00, 
+	0x00, 0x5f, 0x0a, 0x33, 0x00, 0xdc, 0x7c, 0x39, 0x00, 0x00, 0x41, 0x40, 0x40, 0x00, 0x45, 0x44, 
+	0x44, 0x00, 0x00, 0xde, 0x61, 0x4c, 0x00, 0x59, 0x01, 0x56, 0x10, 0x00, 0x29, 0xa9, 0x0f, 0x21, 
+	0x14, 0x66, 0x00, 0xb7, 0x00, 0xf9, 0x72, 0x00, 0x89, 0x88, 0x88, 0x00, 0x23, 0x00, 0xd7, 0x99, 
+	0x00, 0xab, 0xaa, 0xaa, 0x00, 0x8b, 0x00, 0x16, 0xce, 0x00, 0x42, 0x10, 0x04, 0x01, 0x4c, 0x00, 
+	0x68, 0x2f, 0x01, 0x10, 0x8b, 0x94, 0x01, 0x46, 0x00, 0xe3, 0x36, 0x00, 0xc2, 0xb5, 0x3d, 0x00, 
+	0x7d, 0x00, 0x21, 0x45, 0x00, 0x76, 0x4e, 0x49, 0x00, 0x57, 0x00, 0x26, 0x4f, 0x00, 0xa2, 0x90, 
+	0x5c, 0x00, 0x81, 0x00, 0x06, 0x68, 0x00, 0x79, 0x54, 0x6e, 0x00, 0x08, 0x00, 0x1f, 0x7c, 0x00, 
+	0x86, 0x9a, 0x93, 0x00, 0xb6, 0x00, 0x7e, 0xa5, 0x00, 0x44, 0x21, 0xb9, 0x00, 0x5d, 0x00, 0xe9, 
+	0xde, 0x00, 0x82, 0x11, 0x18, 0x01, 0x6b, 0x00, 0xfd, 0x4a, 0x01, 0x1c, 0xe8, 0xb4, 0x01, 0x20, 
+	0x42, 0x24, 0x06, 0xd7, 0x20, 0xd2, 0xe3, 0x44, 0x05, 0xe7, 0x20, 0x68, 0x24, 0x31, 0xd3, 0x17, 
+	0xc3, 0xc0, 0x12, 0xdb, 0x20, 0xb0, 0xe1, 0x90, 0x09, 0xcf, 0x13, 0x60, 0x01, 0x1b, 0x00, 0xc0, 
+	0x31, 0xe0, 0x83, 0x5f, 0x03, 0x01, 0xc0, 0x1c, 0xe0, 0x0e, 0x06, 0x0b, 0x19, 0xd7, 0x00, 0x01, 
+	0x00, 0x1c, 0xe3, 0x55, 0x55, 0xca, 0x15, 0x0a, 0xa5, 0xfe, 0xff, 0x1b, 0x10, 0x0f, 0x02, 0x00, 
+	0x0f, 0x59, 0xca, 0x00, 0x0f, 0x0e, 0xd7, 0x1b, 0x04, 0x00, 0x0b, 0x5d, 0x00, 0x0b, 0x6f, 0x2a, 
+	0x12, 0x00, 0x20, 0x1b, 0x08, 0x00, 0x0f, 0x61, 0x00, 0x0f, 0x56, 0xad, 0x0f, 0x03, 0x60, 0x17, 
+	0x9b, 0x15, 0x04, 0x03, 0x02, 0xb3, 0x7d, 0x01, 0xcf, 0x04, 0x0f, 0x20, 0x02, 0xe2, 0x10, 0x02, 
+	0x7f, 0x00, 0x20, 0x17, 0x32, 0xe0, 0x7d, 0x00, 0x6f, 0x10, 0x12, 0x23, 0x00, 0x63, 0x12, 0xe7, 
+	0x80, 0x1c, 0xf7, 0x00, 0x10, 0xe0, 0x03, 0x84, 0x15, 0x8a, 0x9a, 0x1e, 0x2b, 0xe1, 0xc4, 0x0f, 
+	0x2b, 0x10, 0x4f, 0xc0, 0x01, 0xa3, 0x15, 0xd5, 0x06, 0x5f, 0x10, 0x13, 0xb0, 0x00, 0x13, 0x7e, 
+	0x00, 0x53, 0x86, 0x03, 0xaf, 0x55, 0x90, 0x00, 0x17, 0x7f, 0x00, 0x0b, 0x89, 0x00, 0x0b, 0x84, 
+	0x00, 0x0b, 0x40, 0x32, 0x09, 0xef, 0x98, 0x13, 0x9f, 0x55, 0x80, 0x20, 0x01, 0xa0, 0x53, 0xb2, 
+	0x20, 0xc1, 0x51, 0xc5, 0x43, 0x2b, 0x5b, 0x01, 0x02, 0xc7, 0xc5, 0x02, 0xaf, 0x00, 0xd4, 0x02, 
+	0x10, 0x4b, 0x1e, 0x87, 0x14, 0x74, 0xf3, 0x9f, 0x20, 0x63, 0x64, 0x10, 0x63, 0x80, 0xbd, 0x02, 
+	0xe8, 0x03, 0x10, 0x59, 0xe5, 0x9d, 0x0c, 0xf3, 0x99, 0x00, 0x00, 0x51, 0x13, 0x40, 0x20, 0xc2, 
+	0x03, 0xb5, 0xaa, 0x02, 0xdb, 0xc0, 0x02, 0x27, 0x58, 0x00, 0xa3, 0x40, 0x32, 0xdb, 0x15, 0x0b, 
+	0x40, 0x10, 0xc1, 0x13, 0x02, 0xdb, 0x15, 0x12, 0xeb, 0x0a, 0x8f, 0x54, 0x13, 0x0a, 0xb3, 0x03, 
+	0x18, 0xb7, 0x0c, 0x0c, 0xdf, 0x48, 0x04, 0x68, 0x40, 0x2b, 0xcb, 0x1f, 0x5b, 0xc0, 0x0b, 0xdb, 
+	0x01, 0x00, 0x42, 0x00, 0xe0, 0x14, 0x23, 0x9f, 0xe5, 0x90, 0x02, 0x02, 0x1a, 0xe0, 0x22, 0x28, 
+	0x02, 0x6b, 0x00, 0xf7, 0x82, 0x07, 0x3b, 0xac, 0x32, 0x05, 0x9a, 0x03, 0x1b, 0x15, 0x4f, 0x81, 
+	0xe0, 0x57, 0x1f, 0xf0, 0xb2, 0x0f, 0x2f, 0xf0, 0x0e, 0x67, 0x26, 0xff, 0x10, 0xc0, 0x00, 0x6b, 
+	0xca, 0xec, 0x08, 0xcf, 0x76, 0xdb, 0x02, 0xa7, 0x13, 0x55, 0x9f, 0x04, 0xf3, 0x13, 0x5d, 0xb7, 
+	0x40, 0x0b, 0x04, 0x00, 0x0b, 0x54, 0x0f, 0x08, 0x00, 0x0b, 0x51, 0x67, 0x03, 0x2f, 0x7d, 0x13, 
+	0x13, 0xd3, 0x1c, 0x63, 0x37, 0x5f, 0x0c, 0x13, 0xcc, 0x6f, 0xb0, 0x11, 0xf7, 0x20, 0x00, 0x51, 
+	0x11, 0xeb, 0x41, 0xb0, 0x15, 0x8a, 0xe5, 0x40, 0xb4, 0x00, 0x3b, 0x00, 0x20, 0x51, 0xe0, 0xb4, 
+	0x25, 0x29, 0x8a, 0xc5, 0x00, 0x13, 0xc1, 0x01, 0x2b, 0xe0, 0xbc, 0x00, 0x13, 0x04, 0x90, 0xc1, 
+	0x82, 0xe0, 0xb8, 0x00, 0x07, 0x92, 0x01, 0x51, 0x0c, 0x0c, 0x53, 0x50, 0x0c, 0x53, 0x41, 0xe0, 
+	0xb4, 0x00, 0x2f, 0x90, 0x08, 0x07, 0xe2, 0xc4, 0x01, 0x7b, 0x02, 0x10, 0x50, 0xe0, 0x14, 0xc4, 
+	0x15, 0xca, 0x20, 0x33, 0x00, 0x0c, 0x77, 0x07, 0x00, 0x04, 0x02, 0xe2, 0x08, 0x00, 0x60, 0x00, 
+	0x1b, 0xca, 0xe5, 0x23, 0xa2, 0x21, 0x10, 0xf7, 0x82, 0xe2, 0xc0, 0x04, 0x93, 0x31, 0x8b, 0x61, 
+	0x90, 0x32, 0x5b, 0x06, 0x1f, 0xc5, 0x05, 0xca, 0x05, 0x10, 0x0b, 0xc8, 0x10, 0x3f, 0x0a, 0x18, 
+	0xca, 0x7c, 0x0a, 0x77, 0xc0, 0xc0, 0x0c, 0x3e, 0xe2, 0x40, 0x02, 0x3b, 0x0a, 0x73, 0x0c, 0x0f, 
+	0x04, 0xe3, 0x06, 0x27, 0xc5, 0x11, 0x15, 0xca, 0x45, 0x12, 0xa3, 0x80, 0x00, 0x5c, 0x02, 0x57, 
+	0xe1, 0x02, 0xbb, 0x0c, 0xeb, 0x0f, 0xb3, 0xe3, 0x20, 0xc4, 0xca, 0x04, 0x1b, 0x0e, 0x00, 0xea, 
+	0x80, 0xc5, 0x00, 0xe3, 0x0c, 0xfb, 0x11, 0x8b, 0x0c, 0x00, 0x10, 0x91, 0xe0, 0xfd, 0xff, 0xff, 
+	0xda, 0xc0, 0xfe, 0x00, 0x9f, 0x10, 0xff, 0x10, 0x37, 0x1c, 0xf7, 0x10, 0xe3, 0x10, 0xab, 0x00, 
+	0xd3, 0xe2, 0x81, 0x08, 0xcf, 0xe2, 0x82, 0x01, 0x80, 0xe0, 0xb8, 0x00, 0x1b, 0x82, 0x10, 0xf3, 
+	0x90, 0x12, 0x2c, 0xe0, 0xb0, 0x00, 0x07, 0x0c, 0x80, 0x01, 0x13, 0x70, 0x01, 0x9f, 0xe5, 0x70, 
+	0xc1, 0x9f, 0x2b, 0xe5, 0x64, 0x0e, 0xb3, 0xb2, 0x02, 0x53, 0xee, 0x00, 0x03, 0x10, 0x0b, 0x80, 
+	0x15, 0x2b, 0xb8, 0x08, 0xd1, 0xe1, 0x03, 0x09, 0xc0, 0x41, 0xe3, 0x15, 0x5b, 0xb8, 0x08, 0xc1, 
+	0xe1, 0x80, 0x02, 0x97, 0x55, 0xb4, 0x00, 0x07, 0x48, 0x00, 0x33, 0x80, 0x05, 0x6b, 0x08, 0x00, 
+	0x0f, 0x55, 0x60, 0x00, 0x07, 0x68, 0x00, 0x03, 0x02, 0x04, 0x73, 0x64, 0x00, 0x07, 0x54, 0x6c, 
+	0x00, 0x03, 0x40, 0x00, 0x17, 0x70, 0x00, 0x07, 0x94, 0xc0, 0x14, 0x8f, 0xe2, 0x0f, 0x0f, 0x2f, 
+	0x1c, 0x00, 0x5f, 0x0f, 0x00, 0x3d, 0x8c, 0xe8, 0x10, 0x53, 0x10, 0x43, 0x10, 0x1b, 0x10, 0x2f, 
+	0x74, 0x00, 0x07, 0xb8, 0x12, 0xeb, 0x78, 0x40, 0x0f, 0x10, 0x07, 0x50, 0x0f, 0xb2, 0x1d, 0xc1, 
+	0x02, 0xe1, 0xa4, 0x00, 0x81, 0xe2, 0xcc, 0x00, 0x0b, 0xe0, 0xa8, 0x0c, 0xfb, 0xc8, 0x00, 0x07, 
+	0xdc, 0x00, 0x07, 0xb2, 0x0d, 0xc1, 0x0c, 0xe1, 0x01, 0x1c, 0x81, 0x01, 0xdf, 0x00, 0x8b, 0x00, 
+	0xc1, 0x03, 0xe0, 0x7f, 0x00, 0xe0, 0xe3, 0xb2, 0x00, 0x07, 0x10, 0x0f, 0x07, 0xb0, 0x00, 0xc1, 
+	0xe1, 0xc4, 0x00, 0x07, 0x10, 0x0f, 0x25, 0xdf, 0xed, 0x03, 0xcf, 0x10, 0xa3, 0x11, 0x97, 0x03, 
+	0x10, 0x2f, 0x03, 0x07, 0xa3, 0x0d, 0xdb, 0x80, 0x12, 0xfb, 0x76, 0x54, 0x32, 0x10, 0x01, 0x23, 
+	0x45, 0x00, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x01, 0x98, 0xf8, 0x5f, 0x2d, 0xe9, 
+	0x80, 0xa0, 0x19, 0x7f, 0x14, 0xda, 0xe5, 0x9d, 0x0e, 0x0f, 0xc4, 0x00, 0x03, 0xa1, 0x11, 0xaa, 
+	0x3b, 0x3b, 0xec, 0x00, 0x0b, 0x13, 0x00, 0x37, 0x89, 0x00, 0x0f, 0x38, 0xaa, 0x00, 0x07, 0x55, 
+	0x00, 0x03, 0x52, 0x00, 0x17, 0x64, 0x00, 0x07, 0x8f, 0x90, 0x00, 0x03, 0xf8, 0x5f, 0x3f, 0xdb, 
+	0xac, 0x38, 0x00, 0x06, 0x68, 0xac, 0x0f, 0x4b, 0x1f, 0x2f, 0x98, 0x00, 0x03, 0x28, 0x8d, 0x00, 
+	0x00, 0x08, 0x28, 0x8e, 0x00, 0x08, 0x00, 0x01, 0x00, 0x20, 0x04, 0x24, 0x00, 0x07, 0x56, 0x55, 
+	0x00, 0x00, 0x78, 0x53, 0x82, 0x3f, 0x6f, 0x64, 0x00, 0x0f, 0xc8, 0x75, 0x0f, 0x47, 0x00, 0x27, 
+	0x00, 0x77, 0xff, 0x0e, 0xb0, 0x90, 0x00, 0x00, 0x04, 0x00, 0x80, 0x02, 0x00, 0x05, 0x40, 0xb6, 
+	0x00, 0x00, 0x00, 0x3c, 0x6e, 0x00, 0x03, 0x80, 0x29, 0x00, 0x03, 0x02, 0x38, 0x2d, 0x00, 0x03, 
+	0xc0, 0x30, 0x00, 0x23, 0x34, 0x00, 0x00, 0x03, 0xdc, 0x37, 0x00, 0x03, 0x08, 0x3b, 0xa1, 0x0d, 
+	0x97, 0x3e, 0x00, 0x17, 0x42, 0x00, 0x03, 0x1c, 0x00, 0x17, 0x55, 0xb0, 0x00, 0x23, 0x68, 0x00, 
+	0x23, 0xf0, 0x00, 0x0b, 0xac, 0x00, 0x23, 0x35, 0x0c, 0x38, 0x00, 0x1b, 0x00, 0x23, 0xf4, 0x00, 
+	0x23, 0x68, 0x00, 0x23, 0x58, 0x10, 0x00, 0x17, 0x08, 0x01, 0x03, 0x12, 0x53, 0x18, 0x18, 0x8a, 
+	0x2a, 0xe5, 0x1c, 0x00, 0x03, 0x3c, 0x01, 0x43, 0x40, 0x04, 0x1b, 0x5d, 0x00, 0xf7, 0xff, 0xeb, 
+	0x6c, 0x20, 0x4f, 0xe2, 0x10, 0xa0, 0x01, 0x17, 0x2c, 0x0e, 0x47, 0x08, 0xc0, 0xa0, 0xe3, 0x04, 
+	0x00, 0x30, 0x92, 0xe4, 0x00, 0x31, 0x81, 0xe7, 0x20, 0xdb, 0x06, 0x23, 0x1d, 0x0f, 0xfa, 0x0f, 
+	0x23, 0x10, 0x13, 0x4c, 0x00, 0x23, 0x10, 0x17, 0x61, 0x08, 0x06, 0xab, 0x10, 0xe7, 0x60, 0xfa, 
+	0x03, 0x02, 0x10, 0xa3, 0x40, 0x01, 0x04, 0x13, 0xf8, 0x4f, 0x2d, 0x09, 0x84, 0xa4, 0x00, 0x9f, 
+	0xe5, 0x84, 0xb4, 0x9f, 0xe5, 0x14, 0x08, 0xa4, 0x07, 0x13, 0x24, 0x04, 0x5b, 0x20, 0xd2, 0x25, 
+	0x5f, 0x78, 0x14, 0x20, 0x9f, 0x15, 0x04, 0x6f, 0x11, 0x11, 0xff, 0x2f, 0x11, 0xa8, 0x10, 0x83, 
+	0x76, 0x03, 0xe3, 0x41, 0x02, 0xbf, 0x01, 0x2b, 0x8a, 0x02, 0xe2, 0xf8, 0x03, 0x82, 0xe8, 0x01, 
+	0x00, 0x57, 0x16, 0xd2, 0x00, 0x33, 0x11, 0xbb, 0x15, 0x00, 0x07, 0x4c, 0x14, 0x0f, 0x2f, 0x00, 
+	0x00, 0xd1, 0xe1, 0xff, 0x00, 0x20, 0xe2, 0x03, 0x0c, 0x11, 0x20, 0xe2, 0x34, 0x0f, 0x2b, 0x00, 
+	0x10, 0x21, 0x03, 0x7f, 0x12, 0x01, 0xe0, 0x34, 0x0e, 0xef, 0x0d, 0x35, 0x03, 0x7b, 0x00, 0x44, 
+	0x53, 0x13, 0x13, 0x2a, 0x77, 0x34, 0x02, 0xdb, 0x0c, 0x10, 0x02, 0xe3, 0x02, 0x30, 0x83, 0x12, 
+	0x50, 0x00, 0x13, 0x50, 0x08, 0x30, 0xa0, 0xc3, 0x02, 0x20, 0x0f, 0x53, 0x12, 0x00, 0x00, 0x30, 
+	0xa0, 0x43, 0x77, 0x34, 0xca, 0xe5, 0x14, 0x52, 0x28, 0x1c, 0x07, 0x52, 0x00, 0xa3, 0xbd, 0x08, 
+	0x13, 0x77, 0x01, 0x04, 0x23, 0xa0, 0xe3, 0x11, 0x3e, 0x02, 0x27, 0x35, 0xc2, 0x18, 0xe1, 0x01, 
+	0x3a, 0x02, 0x27, 0x00, 0x07, 0x74, 0xe0, 0x8f, 0x94, 0x00, 0x6b, 0x11, 0xe3, 0x00, 0x4b, 0x13, 
+	0x00, 0x3f, 0x13, 0xcc, 0x10, 0x13, 0x9f, 0x15, 0x10, 0xaf, 0x03, 0x3c, 0x10, 0xe2, 0x00, 0x03, 
+	0x3c, 0x33, 0x12, 0x0c, 0x00, 0xc0, 0x13, 0x5a, 0x38, 0x00, 0x7b, 0x13, 0x1d, 0x7f, 0x00, 0x5f, 
+	0x04, 0x0c, 0x2b, 0x78, 0x10, 0x24, 0xda, 0x15, 0x03, 0xe3, 0x12, 0x78, 0x24, 0xca, 0x66, 0x15, 
+	0x10, 0x13, 0x0a, 0x33, 0x13, 0x76, 0x06, 0x6b, 0x10, 0x13, 0x03, 0x87, 0x1a, 0x27, 0x20, 0xa0, 
+	0x03, 0x76, 0x06, 0x6f, 0x10, 0x9f, 0x10, 0x1b, 0x75, 0x7c, 0x40, 0x53, 0x10, 0x0f, 0x10, 0x3f, 
+	0x70, 0x40, 0x0f, 0x54, 0x05, 0x2b, 0xba, 0x51, 0x2b, 0x4c, 0x00, 0x13, 0x51, 0x2b, 0x15, 0xa3, 
+	0x50, 0x05, 0xa3, 0xba, 0x95, 0x01, 0x7f, 0x34, 0x04, 0x04, 0xc3, 0x13, 0x10, 0x27, 0x91, 0x00, 
+	0xcb, 0x05, 0x50, 0xe3, 0x04, 0x20, 0x91, 0x00, 0x7b, 0x52, 0x0c, 0xeb, 0x8d, 0x09, 0xf3, 0xf5, 
+	0xff, 0x0b, 0x11, 0x3b, 0x11, 0x43, 0x24, 0x00, 0x27, 0xb2, 0x17, 0xdb, 0x24, 0x00, 0xab, 0x11, 
+	0x57, 0xfb, 0x06, 0x31, 0x57, 0xf5, 0xb9, 0x00, 0x07, 0x0c, 0x10, 0x3f, 0x11, 0xc3, 0x09, 0x33, 
+	0xec, 0x06, 0x01, 0x53, 0x84, 0x20, 0x0f, 0x81, 0xe5, 0xfc, 0x12, 0x00, 0x07, 0x10, 0x91, 0x9a, 
+	0x45, 0x63, 0x00, 0x0a, 0x15, 0x93, 0x10, 0x7b, 0x10, 0x01, 0xe3, 0x30, 0xa8, 0x40, 0x4f, 0x30, 
+	0x10, 0x4f, 0x0b, 0x11, 0xaf, 0x90, 0xe8, 0x0c, 0xa0, 0x04, 0x33, 0x04, 0x0d, 0x67, 0x04, 0x20, 
+	0x32, 0xe2, 0x5a, 0x82, 0x00, 0xef, 0x18, 0x00, 0x12, 0x13, 0x24, 0x21, 0x0b, 0x02, 0x28, 0x12, 
+	0x18, 0x06, 0x0f, 0x02, 0x05, 0x3f, 0x14, 0x07, 0x8a, 0x80, 0x04, 0xa3, 0x11, 0xe3, 0x60, 0x20, 
+	0x40, 0x02, 0x5b, 0x80, 0x0d, 0x73, 0x04, 0x28, 0x8a, 0xe5, 0xf5, 0x20, 0x80, 0x02, 0x02, 0xe4, 
+	0x20, 0x80, 0x12, 0x0c, 0x00, 0x0b, 0x80, 0xab, 0x00, 0x0b, 0x78, 0x00, 0x0b, 0x10, 0x00, 0x0b, 
+	0xe4, 0x05, 0x97, 0x0f, 0x07, 0x08, 0xe0, 0x18, 0x17, 0x8a, 0x04, 0x8b, 0x41, 0xe2, 0x74, 0xda, 
+	0x00, 0x7f, 0x16, 0x1f, 0x2c, 0x06, 0x1f, 0x10, 0x87, 0x68, 0x06, 0x1f, 0x14, 0xaa, 0x00, 0x57, 
+	0xf4, 0x05, 0xc7, 0x02, 0x00, 0x27, 0x5c, 0x40, 0x1f, 0x50, 0xaa, 0x40, 0x1f, 0x48, 0x40, 0x1f, 
+	0xf8, 0x40, 0x1f, 0x40, 0x40, 0x1f, 0x44, 0xaa, 0x40, 0x1f, 0x28, 0x40, 0x1f, 0xfc, 0x40, 0x1f, 
+	0x24, 0x40, 0x1f, 0xa4, 0xa5, 0x40, 0x1f, 0x08, 0x40, 0x1f, 0x00, 0x28, 0x30, 0x1f, 0x08, 0x40, 
+	0x1f, 0x55, 0x38, 0x40, 0x1f, 0xe8, 0x05, 0x07, 0x5a, 0x06, 0x9f, 0x18, 0x02, 0xe7, 0x86, 0x11, 
+	0x9b, 0xec, 0xf1, 0x9f, 0x15, 0x00, 0x03, 0x04, 0xf7, 0x4f, 0x22, 0xe2, 0x24, 0x00, 0xbb, 0x07, 
+	0x16, 0x81, 0x2d, 0xef, 0x20, 0xad, 0x40, 0x2f, 0xb8, 0x00, 0x1b, 0xcc, 0x00, 0x03, 0x10, 0x0b, 
+	0xc8, 0x00, 0x07, 0x32, 0xf4, 0x06, 0x3e, 0x87, 0x0f, 0xe3, 0x1a, 0x40, 0x02, 0xcb, 0x6c, 0x2b, 
+	0x10, 0x0a, 0x20, 0x1b, 0xb0, 0x00, 0x1b, 0xa4, 0x15, 0x63, 0x01, 0x93, 0x55, 0x79, 0x0d, 0xf7, 
+	0x58, 0x00, 0x63, 0x59, 0x00, 0x07, 0x90, 0x40, 0x13, 0xe0, 0x11, 0xb3, 0x50, 0x77, 0x06, 0x38, 
+	0x0a, 0x57, 0xfa, 0xff, 0xeb, 0x54, 0x74, 0x00, 0x1b, 0x50, 0x00, 0x07, 0x6c, 0x00, 0x07, 0x57, 
+	0x54, 0xc0, 0x02, 0x5b, 0x03, 0x4f, 0xf7, 0x16, 0xca, 0xe5, 0x30, 0x11, 0xaa, 0x11, 0xcb, 0xd1, 
+	0x01, 0x57, 0xc0, 0x02, 0x77, 0xc1, 0x26, 0x03, 0x02, 0x08, 0x80, 0xc8, 0xe3, 0x51, 0x10, 0x23, 
+	0x20, 0x41, 0xe2, 0x4a, 0x54, 0x16, 0xfb, 0x00, 0x51, 0x06, 0x2b, 0x81, 0x00, 0x0b, 0x8a, 0x89, 
+	0x00, 0xbb, 0x00, 0x1a, 0x48, 0x00, 0xbf, 0xfc, 0xc0, 0x10, 0x37, 0x59, 0x8c, 0x08, 0x8b, 0x8f, 
+	0x20, 0xc3, 0x51, 0x53, 0xf4, 0xf0, 0x00, 0xdf, 0x99, 0x00, 0x63, 0xff, 0x1f, 0x04, 0x37, 0x24, 
+	0x1b, 0x00, 0xeb, 0x10, 0x17, 0x44, 0x00, 0x20, 0x13, 0xbd, 0xe8, 0xfc, 0x04, 0x3f, 0xc0, 0x20, 
+	0x8c, 0x10, 0x3b, 0x82, 0xe5, 0xf7, 0x40, 0xdf, 0x10, 0x27, 0xf7, 0x06, 0x25, 0xca, 0x15, 0x0f, 
+	0x7b, 0x1a, 0xa0, 0x20, 0x1b, 0xd2, 0x06, 0x1f, 0x57, 0x80, 0x02, 0x6f, 0xc2, 0x00, 0xc3, 0x8f, 
+	0x30, 0x83, 0x00, 0x7f, 0x90, 0x67, 0x5c, 0x8c, 0x00, 0x67, 0xa0, 0x00, 0x03, 0x10, 0xfb, 0x18, 
+	0x5b, 0x68, 0x10, 0x55, 0x9f, 0x08, 0xee, 0xd1, 0x18, 0x67, 0x13, 0x09, 0x13, 0x0a, 0x50, 0x37, 
+	0xd5, 0x06, 0xa3, 0x20, 0x37, 0xb0, 0x40, 0x37, 0x80, 0x00, 0x33, 0x68, 0x00, 0x03, 0xb4, 0x10, 
+	0xe3, 0x78, 0x00, 0xc3, 0x10, 0x13, 0x74, 0x00, 0x0f, 0x15, 0x8c, 0x1c, 0x48, 0xe2, 0x50, 0x00, 
+	0x07, 0x14, 0x97, 0x07, 0xfb, 0x03, 0x32, 0x00, 0x00, 0x00, 0x02, 0x7d, 0x1a, 0x00, 0x08, 0x30, 
+	0x80, 0x05, 0x7b, 0x11, 0x55, 0x00, 0x08, 0xc5, 0x4d, 0x00, 0x00, 0x08, 0x4d, 0x4b, 0x00, 0x08, 
+	0x20, 0x30, 0x00, 0x15, 0x06, 0x5c, 0x68, 0x05, 0x47, 0x59, 0x05, 0x2b, 0x58, 0x05, 0xa3, 0x80, 
+	0x00, 0x27, 0xab, 0x07, 0x00, 0x08, 0xcc, 0x90, 0x00, 0x40, 0x08, 0x15, 0xbb, 0x2c, 0x94, 0x00, 
+	0x08, 0xe8, 0x93, 0x14, 0x00, 0x08, 0xd4, 0x00, 0x03, 0xac, 0x00, 0x03, 0x54, 0x7c, 0x25, 0x00, 
+	0x08, 0x15, 0xcf, 0xc8, 0x7f, 0x05, 0xb7, 0x5b, 0x05, 0x4f, 0x0d, 0x35, 0x00, 0x06, 0xcc, 0x00, 
+	0x3b, 0x15, 0xc3, 0xfa, 0x0b, 0x54, 0x40, 0xb8, 0x00, 0x1b, 0x00, 0x44, 0x2d, 0xe9, 0x70, 0xa3, 
+	0xdd, 0x0c, 0xc7, 0x07, 0xf3, 0x04, 0x11, 0xb3, 0x03, 0xff, 0x04, 0x03, 0x13, 0x19, 0xdf, 0x50, 
+	0x02, 0x00, 0x07, 0x01, 0x04, 0x13, 0x54, 0x13, 0x9f, 0x05, 0xa4, 0x00, 0x03, 0xc5, 0x00, 0x03, 
+	0xb5, 0xe4, 0x01, 0x87, 0x50, 0x13, 0x26, 0x9f, 0xa5, 0x00, 0x03, 0xb5, 0xf0, 0x00, 0x0b, 0x03, 
+	0xfb, 0xa5, 0x90, 0x00, 0x03, 0xb5, 0xec, 0x00, 0x0b, 0x49, 0x1f, 0xa0, 0xa3, 0x56, 0x44, 0x00, 
+	0x0b, 0x00, 0x05, 0xab, 0x40, 0x00, 0x17, 0x00, 0x03, 0xb5, 0x59, 0xfc, 0x00, 0x17, 0x3c, 0x00, 
+	0x0b, 0x00, 0x03, 0xb5, 0xf8, 0x00, 0x0b, 0x69, 0x38, 0x00, 0x4b, 0x00, 0x03, 0xc5, 0x00, 0x03, 
+	0xb5, 0xf4, 0x00, 0x0f, 0x65, 0x34, 0x00, 0x1b, 0x00, 0x03, 0xb5, 0x08, 0x00, 0x33, 0x30, 0x00, 
+	0x0b, 0x96, 0x00, 0x03, 0xb5, 0xac, 0x08, 0x0f, 0x2c, 0x00, 0x0b, 0x00, 0x03, 0xb5, 0x40, 0xa8, 
+	0x00, 0x0b, 0x10, 0x10, 0xa0, 0xa3, 0x0f, 0x10, 0x1a, 0xa0, 0xb3, 0xf6, 0x02, 0x33, 0x15, 0x8b, 
+	0x75, 0x05, 0x8b, 0xd8, 0xdc, 0x23, 0x7f, 0x33, 0xfb, 0x04, 0x05, 0x07, 0x10, 0xa7, 0x04, 0x7f, 
+	0xe1, 0x00, 0x67, 0x44, 0x35, 0xe7, 0x17, 0x3f, 0xf0, 0x22, 0x09, 0xa7, 0x03, 0x17, 0x18, 0xe7, 
+	0x81, 0x0a, 0xa7, 0xe3, 0xcf, 0xf5, 0xff, 0xeb, 0xe0, 0x00, 0x0f, 0x54, 0x1c, 0x03, 0xe7, 0xdc, 
+	0x00, 0x07, 0x20, 0x00, 0x07, 0x07, 0x06, 0x14, 0xa0, 0xe3, 0x24, 0x00, 0x07, 0x0c, 0x00, 0x03, 
+	0x00, 0x84, 0xda, 0x02, 0xfb, 0x00, 0x17, 0x2c, 0x04, 0x37, 0x12, 0x17, 0x10, 0x00, 0x13, 0x28, 
+	0xdc, 0x00, 0x03, 0x14, 0x17, 0x18, 0x10, 0x23, 0x07, 0x37, 0x11, 0x23, 0x57, 0x0f, 0x03, 0xe0, 
+	0x03, 0xa4, 0x02, 0x9f, 0x15, 0x50, 0x17, 0x17, 0x93, 0x40, 0x38, 0x00, 0x6f, 0x84, 0x42, 0x9f, 
+	0xe5, 0x7c, 0x52, 0x80, 0x12, 0x43, 0x94, 0xe5, 0x43, 0x00, 0x00, 0xeb, 0x0c, 0x01, 0x00, 0x84, 
+	0xe4, 0x05, 0x00, 0x54, 0xe1, 0x06, 0x8b, 0x20, 0xba, 0x78, 0x00, 0x1b, 0x04, 0x10, 0xa0, 0xe1, 
+	0x5c, 0xfa, 0x40, 0x1f, 0x12, 0x7b, 0x13, 0x1f, 0x16, 0x87, 0x08, 0xe7, 0x00, 0x50, 0x2b, 0xf7, 
+	0xa4, 0x00, 0x2b, 0x50, 0x00, 0x2b, 0x05, 0x50, 0x14, 0xf3, 0x94, 0xe5, 0x51, 0x31, 0x00, 0x47, 
+	0x04, 0x00, 0x1b, 0x01, 0x50, 0x55, 0x26, 0xd3, 0x6a, 0x38, 0x46, 0xc7, 0x10, 0x6f, 0x14, 0x00, 
+	0x27, 0x0c, 0x00, 0x4f, 0x24, 0xda, 0x00, 0xe7, 0x10, 0x2b, 0x23, 0x05, 0x63, 0x00, 0x2f, 0xab, 
+	0x10, 0x07, 0x00, 0x10, 0x01, 0x92, 0xb7, 0x02, 0x4b, 0xba, 0x0b, 0xb0, 0xa0, 0x50, 0xe1, 0x50, 
+	0x5b, 0xf5, 0x00, 0x5b, 0xf0, 0x41, 0x9f, 0xe5, 0x3d, 0xd8, 0x51, 0x30, 0x8b, 0x50, 0x87, 0x12, 
+	0xb3, 0x30, 0x87, 0x80, 0x12, 0x80, 0x32, 0x1a, 0x01, 0x0e, 0x9b, 0x00, 0xff, 0x33, 0x05, 0x30, 
+	0x07, 0x83, 0xac, 0x50, 0x3f, 0xf2, 0x00, 0x3f, 0xb4, 0x00, 0x3f, 0x10, 0x9b, 0xb0, 0x21, 0xbe, 
+	0x70, 0x73, 0x14, 0xf0, 0x73, 0x0a, 0xeb, 0x30, 0xb3, 0x00, 0x73, 0x60, 0xb3, 0x7c, 0xe1, 0x09, 
+	0x4b, 0x01, 0xbf, 0x23, 0x73, 0x00, 0x21, 0x9c, 0xe7, 0x13, 0xdb, 0xef, 0x26, 0xdb, 0x05, 0xab, 
+	0x10, 0x3f, 0xf9, 0x00, 0x5f, 0x10, 0x3b, 0x04, 0x47, 0x2e, 0xe3, 0x04, 0x06, 0x50, 0x2d, 0xe9, 
+	0x4c, 0x00, 0x33, 0x04, 0x10, 0x06, 0x9c, 0xe4, 0x01, 0x00, 0x71, 0x06, 0x7f, 0x10, 0xa7, 0x50, 
+	0x45, 0xe1, 0x30, 0x0f, 0xa0, 0x01, 0xf8, 0x00, 0x5b, 0xe9, 0x09, 0xf3, 0x30, 0x06, 0x50, 0x41, 
+	0xf3, 0x00, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x8c, 0x02, 0xfb, 0x23, 0x13, 0x00, 0x07, 0x13, 
+	0x0f, 0x13, 0x17, 0x70, 0x00, 0x03, 0x41, 0xd8, 0x00, 0x03, 0xa0, 0x31, 0x00, 0x06, 0x34, 0x03, 
+	0x17, 0x32, 0xb4, 0x63, 0x38, 0xc7, 0x10, 0x33, 0xd8, 0x85, 0x33, 0x33, 0x10, 0x14, 0x95, 0x00, 
+	0x08, 0x18, 0xe3, 0x74, 0x03, 0x63, 0xf0, 0x9f, 0x82, 0x00, 0x0b, 0xa7, 0x00, 0x08, 0x0c, 0x6c, 
+	0x08, 0xcf, 0xb7, 0x10, 0x00, 0x08, 0x94, 0x00, 0x03, 0xf0, 0xbb, 0x00, 0x08, 0x00, 0xc4, 0xbd, 
+	0x00, 0x08, 0x90, 0x6d, 0x00, 0x03, 0x54, 0x58, 0x00, 0x1b, 0x18, 0x00, 0x1b, 0xf8, 0x00, 0x03, 
+	0xf4, 0xb0, 0x80, 0x00, 0x13, 0xa4, 0x00, 0x08, 0xd0, 0xbf, 0x00, 0x08, 0x00, 0x80, 0x3d, 0x00, 
+	0x06, 0xc0, 0xa2, 0x00, 0x08, 0x33, 0x64, 0x9b, 0x00, 0x03, 0x00, 0x5f, 0xbc, 0xa0, 0x30, 0x07, 
+	0x10, 0x17, 0xb8, 0x10, 0x03, 0x60, 0x40, 0x07, 0x10, 0xa7, 0x13, 0xef, 0xfe, 0x5c, 0x01, 0x00, 
+	0x00, 0x98, 0x9f, 0x01, 0x00, 0x9e, 0x85, 0x01, 0x00, 0x00, 0x36, 0xdb, 0x6c, 0xb3, 0x2b, 0x1b, 
+	0xd3, 0x00, 0xb2, 0x0d, 0x30, 0xc0, 0x00, 0x0d, 0x00, 0xcd, 0x20, 0x00, 0x11, 0x02, 0x20, 0xd8, 
+	0x9f, 0x00, 0x00, 0xda, 0x00, 0x95, 0x00, 0x00, 0x05, 0x41, 0x01, 0x00, 0xf5, 0x00, 0x2c, 0x01, 
+	0x00, 0x4d, 0x42, 0x01, 0x00, 0xe7, 0x06, 0x84, 0x01, 0x00, 0x27, 0x2e, 0x01, 0x09, 0x04, 0x75, 
+	0xfb, 0x81, 0x07, 0xdc, 0x66, 0x57, 0x00, 0x00, 0x6e, 0x61, 0x05, 0x11, 0x00, 0x40, 0xed, 0xff, 
+	0x75, 0xd1, 0xeb, 0xff, 0x04, 0x0d, 0x76, 0x00, 0x03, 0x5c, 0x09, 0x9f, 0x11, 0x07, 0x14, 0x00, 
+	0xcb, 0x06, 0xb9, 0xfe, 0xff, 0xff, 0x58, 0x00, 0x0f, 0x10, 0x17, 0x68, 0x08, 0x98, 0x00, 0x08, 
+	0xf4, 0x00, 0x03, 0xcc, 0x20, 0x8f, 0x16, 0xe2, 0x5e, 0x3f, 0x0f, 0x97, 0x40, 0x01, 0x8b, 0x01, 
+	0xcf, 0x9c, 0xab, 0x05, 0x8b, 0x27, 0x02, 0x6b, 0x1c, 0x03, 0x5f, 0x1f, 0x00, 0x07, 0x11, 0xa3, 
+	0x70, 0x8c, 0x00, 0x13, 0x1a, 0x97, 0x1a, 0x87, 0x00, 0x00, 0x01, 0xef, 0x82, 0x01, 0x2a, 0xef, 
+	0x04, 0x40, 0xb0, 0xe1, 0x0b, 0x93, 0x1a, 0x0c, 0x04, 0xc0, 0x92, 0xe4, 0x1b, 0xc7, 0x21, 0xbf, 
+	0x08, 0x5c, 0x46, 0xe3, 0x2c, 0x83, 0x40, 0x4c, 0xe2, 0x10, 0x17, 0x11, 0x8b, 0x04, 0x02, 0xc0, 
+	0x12, 0xe5, 0x01, 0x40, 0x44, 0x1b, 0xcb, 0xe1, 0x23, 0x05, 0x50, 0x30, 0x33, 0xb2, 0x00, 0xd3, 
+	0x0a, 0xeb, 0x30, 0x33, 0x11, 0x02, 0x0c, 0x50, 0x30, 0x33, 0x50, 0x40, 0xe2, 0x10, 0x17, 0x80, 
+	0x10, 0x27, 0xb2, 0x00, 0x53, 0xe1, 0x01, 0x50, 0x45, 0xd1, 0x20, 0x33, 0x13, 0xbf, 0xe3, 0x01, 
+	0xdb, 0xb0, 0x00, 0xdc, 0x05, 0xff, 0x1d, 0x51, 0xe2, 0xfb, 0x01, 0xeb, 0x13, 0x67, 0x10, 0x17, 
+	0xdd, 0x00, 0x17, 0x8e, 0x11, 0xf7, 0xb0, 0x00, 0xcc, 0x20, 0x1b, 0x13, 0x17, 0x20, 0x1b, 0x00, 
+	0x6a, 0xfe, 0x0c, 0x8a, 0x11, 0xd3, 0x02, 0x00, 0x03, 0x04, 0x00, 0x03, 0x88, 0x94, 0x00, 0x0f, 
+	0xfc, 0x09, 0x02, 0x37, 0x00, 0x01, 0x02, 0x09, 0xa8, 0x08, 0xec, 0x30, 0x09, 0xe9, 0x02, 0xe0, 
+	0x8a, 0x46, 0x02, 0x60, 0x08, 0x10, 0x0b, 0x10, 0x07, 0x00, 0xa8, 0xec, 0x08, 0xa0, 0x0c, 0x68, 
+	0x02, 0x08, 0xf4, 0x01, 0x6b, 0x50, 0x17, 0x2e, 0x59, 0x02, 0x6b, 0x09, 0x02, 0x00, 0xe0, 0x08, 
+	0x0f, 0x4b, 0x08, 0x00, 0xfc, 0x1f, 0x80, 0x08, 0x4a, 0x10, 0x00, 0x08, 0x10, 0x12, 0x06, 0x80, 
+	0x12, 0x2b, 0x08, 0x66, 0x1b, 0x80, 0x45, 0x08, 0x0d, 0xbb, 0x08, 0x0e, 0x08, 0x22, 0x3b, 0x08, 
+	0x02, 0x88, 0xb3, 0x20, 0x03, 0x88, 0x40, 0x03, 0x00, 0x13, 0x09, 0xe0, 0x00, 0x6b, 0x15, 0xc8, 
+	0x54, 0xec, 0x40, 0x07, 0xfc, 0x40, 0x07, 0x4a, 0x00, 0x07, 0x00, 0x00, 0x14, 0x20, 0x09, 0xf0, 
+	0x00, 0x07, 0xe8, 0x10, 0x0b, 0xd2, 0x00, 0x40, 0x15, 0x20, 0x03, 0x80, 0x00, 0x15, 0x5a, 0xa5, 
+	0x5a, 0x40, 0xa5, 0x12, 0x8b, 0x54, 0x53, 0xf4, 0x01, 0x34, 0x12, 0x80, 0x10, 0x05, 0x78, 0x56, 
+	0x54, 0x53, 0x54, 0x53, 0x78, 0x00, 0x56, 0x34, 0x12, 0xf4, 0x01, 0xcd, 0xab, 0x54, 0x00, 0x53, 
+	0x00, 0x00, 0xee, 0x05, 0x00, 0x00, 0xfa, 0x04, 0x7f, 0x00, 0x03, 0xbc, 0x52, 0xb0, 0x03, 0x0e, 
+	0xf0, 0x03, 0xa0, 0xe1, 0xd8, 0x47, 0x00, 0x03, 0x90, 0x03, 0x10, 0x13, 0x0c, 0xb4, 0x4a, 0x00, 
+	0x03, 0x90, 0x03, 0x10, 0x13, 0x98, 0x6a, 0xee, 0x0b, 0xdf, 0x80, 0x03, 0x10, 0x13, 0x90, 0x00, 
+	0x07, 0x10, 0x47, 0x90, 0x3b, 0x24, 0x1a, 0x48, 0x00, 0x03, 0x90, 0x03, 0x10, 0x13, 0xb8, 0x00, 
+	0x27, 0x24, 0x0a, 0x6b, 0x00, 0x03, 0x3c, 0x00, 0x03, 0x90, 0x00, 0x03, 0x0c, 0xb5, 0x02, 0x17, 
+	0xa0, 0x07, 0xfb, 0x1b, 0x87, 0xa1, 0x00, 0x07, 0xa2, 0x00, 0x03, 0xaa, 0x12, 0x37, 0xa4, 0x00, 
+	0x07, 0xa5, 0x00, 0x03, 0xa0, 0x07, 0x1f, 0x0c, 0xc1, 0x07, 0x4b, 0x10, 0x23, 0x04, 0xf0, 0x1f, 
+	0xe5, 0xb8, 0x00, 0x33, 0x06, 0x48, 0x9c, 0x00, 0x08, 0xc0, 0x00, 0x03, 0x10, 0x6f, 0xe0, 0xf5, 
+	0x00, 0x07, 0x10, 0x43, 0x10, 0x2f, 0x10, 0x37, 0xa8, 0x00, 0x07, 0xa9, 0x40, 0x0b, 0x77, 0x1c, 
+	0x07, 0xb3, 0x90, 0x13, 0x10, 0x7f, 0x30, 0x0d, 0x93, 0x17, 0x6f, 0x13, 0xf7, 0x48, 0xa9, 0x09, 
+	0xc3, 0xa8, 0x14, 0x1e, 0x23, 0x00, 0xe2, 0x10, 0x38, 0x02, 0x81, 0x04, 0x6f, 0x0a, 0xbb, 0x02, 
+	0xbb, 0x0c, 0xf0, 0xa0, 0x5d, 0x01, 0x1e, 0xc3, 0xa9, 0x0a, 0xc3, 0x10, 0x3b, 0x10, 0x37, 0xa8, 
+	0x06, 0x2f, 0x63, 0xa9, 0x00, 0x03, 0x10, 0x67, 0x0e, 0xc0, 0xa0, 0x06, 0x33, 0x1a, 0xcb, 0xca, 
+	0x14, 0xe7, 0x29, 0x1b, 0xe1, 0xb4, 0x07, 0x7b, 0x0c, 0x00, 0x07, 0x11, 0xd5, 0x1b, 0xdf, 0x40, 
+	0x13, 0xa4, 0x40, 0x13, 0x0c, 0x00, 0x13, 0x00, 0x00, 0x77, 0xb8, 0x01, 0xd3, 0xea, 0x50, 0x47, 
+	0x10, 0xdb, 0x17, 0x1f, 0xa0, 0x14, 0x8a, 0x6a, 0x15, 0x1e, 0xd3, 0x10, 0x1f, 0xd8, 0x80, 0x1f, 
+	0xa7, 0x20, 0xff, 0xda, 0x94, 0x08, 0xaf, 0x10, 0xe3, 0x1b, 0x7b, 0xa7, 0x20, 0x0b, 0x80, 0xe3, 
+	0x64, 0xa4, 0x00, 0xaf, 0x0b, 0x53, 0xe3, 0x0d, 0x26, 0xb3, 0x2d, 0xe5, 0x7b, 0x00, 0x00, 0x8b, 
+	0x1a, 0x6f, 0x14, 0xd7, 0x10, 0x73, 0x34, 0x00, 0x73, 0x0e, 0x6b, 0x03, 0xe3, 0x04, 0xe0, 0x9d, 
+	0xe4, 0x2c, 0x10, 0x0b, 0x00, 0x13, 0x45, 0x24, 0x18, 0xd3, 0x00, 0x0c, 0xe2, 0x10, 0x13, 0x14, 
+	0x00, 0x0b, 0x6c, 0x18, 0x00, 0x03, 0x1f, 0x13, 0x10, 0x18, 0x7f, 0x01, 0x97, 0xac, 0x46, 0x1d, 
+	0x00, 0x03, 0xb8, 0x00, 0x03, 0x11, 0xb7, 0x11, 0xa7, 0x54, 0x10, 0x13, 0x76, 0x9d, 0x04, 0xfb, 
+	0x80, 0x03, 0x11, 0x03, 0xc4, 0x00, 0x07, 0x90, 0x03, 0x18, 0x0a, 0x10, 0x1f, 0xe5, 0x54, 0x09, 
+	0xd3, 0x28, 0x2f, 0x67, 0x80, 0x36, 0xe3, 0x28, 0x0e, 0x67, 0x10, 0x27, 0x01, 0x03, 0x5f, 0x10, 
+	0x77, 0x20, 0xa1, 0x00, 0x5f, 0x01, 0x05, 0xb7, 0x20, 0x02, 0xa0, 0xe1, 0x10, 0x73, 0xbd, 0x50, 
+	0x17, 0x0c, 0x80, 0x17, 0x11, 0xd3, 0x10, 0x83, 0x12, 0x5b, 0xfc, 0x00, 0x53, 0xd0, 0x92, 0x93, 
+	0x11, 0xbb, 0x44, 0x01, 0xc3, 0x02, 0xc9, 0xcc, 0xe3, 0x0a, 0x03, 0x00, 0x5c, 0xe3, 0x00, 0x5b, 
+	0x81, 0x01, 0x5f, 0x1a, 0x6a, 0xa0, 0x07, 0x5b, 0x11, 0x83, 0x40, 0x41, 0x67, 0x24, 0x00, 0x23, 
+	0xa0, 0xeb, 0x0b, 0xaf, 0x11, 0xd7, 0x00, 0xd7, 0x0a, 0x0f, 0x63, 0xe1, 0x10, 0x23, 0x16, 0x13, 
+	0xfd, 0x2a, 0xe7, 0x00, 0x1f, 0x11, 0x87, 0x10, 0x23, 0x19, 0xc7, 0x10, 0x0b, 0xfc, 0x00, 0x83, 
+	0x5e, 0x00, 0x00, 0x53, 0x1d, 0x00, 0x4f, 0x10, 0x4b, 0x10, 0x2f, 0x50, 0x4f, 0xd4, 0xd3, 0x19, 
+	0x9b, 0x40, 0x4f, 0x0f, 0xf0, 0x4f, 0xe1, 0xc4, 0x40, 0x1f, 0x10, 0x0b, 0x57, 0xbc, 0x40, 0x0b, 
+	0x02, 0x40, 0x1b, 0x9c, 0x41, 0xf3, 0x10, 0x13, 0x10, 0x2f, 0x57, 0x90, 0x41, 0x83, 0x98, 0xc0, 
+	0x17, 0x7c, 0x11, 0x03, 0x00, 0x7f, 0x1a, 0x8f, 0xfb, 0x10, 0x7f, 0x59, 0xc7, 0x04, 0xdb, 0x20, 
+	0x83, 0x19, 0xcb, 0x00, 0x0f, 0xdb, 0x10, 0x33, 0xac, 0x10, 0x0b, 0x02, 0x30, 0xff, 0x11, 0x10, 
+	0x2b, 0x10, 0x8f, 0x20, 0x04, 0x3f, 0x80, 0xe0, 0x10, 0x93, 0x51, 0xf3, 0x50, 0x8f, 0x11, 0xf3, 
+	0x50, 0x0b, 0x11, 0xdf, 0xb5, 0x50, 0x73, 0x08, 0x41, 0xeb, 0x11, 0xe7, 0x94, 0x01, 0xe7, 0xb4, 
+	0x51, 0xeb, 0xaa, 0x00, 0x07, 0x74, 0x43, 0xb3, 0x84, 0x06, 0xaf, 0x8c, 0x00, 0x03, 0x94, 0xb4, 
+	0x00, 0x03, 0x9c, 0x00, 0x03, 0x11, 0xd7, 0x10, 0x81, 0xd7, 0x02, 0x09, 0x20, 0x5c, 0xe3, 0x01, 
+	0xd3, 0x05, 0x0a, 0x0a, 0x5c, 0xe3, 0x59, 0x1c, 0x00, 0x07, 0x03, 0x00, 0x0f, 0x01, 0xd7, 0x05, 
+	0x0e, 0x00, 0x0f, 0x9b, 0x02, 0x57, 0x05, 0x0f, 0x00, 0x07, 0x00, 0x73, 0x05, 0x10, 0x77, 0x50, 
+	0x57, 0xa6, 0x10, 0x6b, 0x6c, 0x01, 0xdb, 0x08, 0x4b, 0x0f, 0xcb, 0x01, 0xd3, 0xb4, 0xc8, 0x06, 
+	0xcb, 0x90, 0x03, 0x28, 0x15, 0x0e, 0xd3, 0x10, 0xc1, 0xe3, 0x3b, 0x28, 0x15, 0x0d, 0xc3, 0x42, 
+	0x4f, 0x10, 0x6b, 0x78, 0x09, 0x9b, 0x02, 0xd3, 0xa0, 0x2b, 0xef, 0x0c, 0x0c, 0xbf, 0x48, 0x24, 
+	0x42, 0xe0, 0x10, 0xa0, 0x3b, 0x47, 0xe0, 0x1b, 0x13, 0xac, 0x24, 0x9a, 0xe5, 0xac, 0x23, 0x14, 
+	0x8a, 0x0e, 0x3b, 0x41, 0xe0, 0xa8, 0x03, 0x1b, 0x13, 0x73, 0x80, 0x16, 0x13, 0x40, 0x01, 0x9f, 
+	0xe5, 0x90, 0xc2, 0x82, 0xcd, 0x01, 0x1b, 0x00, 0x2b, 0x08, 0x50, 0x21, 0x23, 0x03, 0x3f, 0x8a, 
+	0x1e, 0x63, 0x96, 0x02, 0x3b, 0x0a, 0x03, 0x02, 0x83, 0x20, 0x00, 0x23, 0x1b, 0x53, 0x80, 0xad, 
+	0x4b, 0x53, 0x14, 0x00, 0x63, 0x03, 0x02, 0x8f, 0x05, 0x58, 0xea, 0x90, 0x4b, 0xf2, 0xf0, 0x77, 
+	0x00, 0x77, 0x00, 0x73, 0x10, 0x5b, 0x20, 0x08, 0x11, 0x87, 0x90, 0x18, 0xe0, 0x03, 0x08, 0x0a, 
+	0xeb, 0x20, 0x1b, 0x41, 0xe2, 0xbc, 0xd4, 0x0c, 0x57, 0x10, 0x57, 0x74, 0x00, 0x57, 0xc0, 0x11, 
+	0xf7, 0xc0, 0x0c, 0x00, 0xe2, 0x08, 0x00, 0x1c, 0xe3, 0xb8, 0x10, 0x9f, 0x00, 0x05, 0x64, 0x10, 
+	0x8f, 0x12, 0x0c, 0xf1, 0x91, 0x37, 0xe7, 0x20, 0x03, 0xbf, 0x10, 0xef, 0x20, 0x03, 0xe3, 0x10, 
+	0x67, 0x05, 0x8e, 0x4d, 0x1a, 0x34, 0x83, 0x11, 0xe3, 0x1a, 0x87, 0x13, 0x23, 0xc2, 0x06, 0x97, 
+	0xdd, 0x13, 0x1f, 0x14, 0x7b, 0xdb, 0x24, 0x13, 0x30, 0x1f, 0x09, 0x63, 0x1a, 0x15, 0x1f, 0xdb, 
+	0x16, 0xdb, 0x90, 0x13, 0xa3, 0x40, 0x13, 0x10, 0x3b, 0xb3, 0x40, 0x3b, 0x10, 0x27, 0x6d, 0xcb, 
+	0x00, 0x3b, 0x10, 0x13, 0xae, 0x40, 0x13, 0x10, 0x27, 0xc6, 0x00, 0x13, 0xaa, 0x11, 0xeb, 0xa0, 
+	0x02, 0x07, 0xc8, 0x01, 0x7f, 0xfc, 0x00, 0x03, 0x10, 0x61, 0xa1, 0xb3, 0x77, 0x1b, 0xef, 0x56, 
+	0x55, 0x55, 0x55, 0x18, 0xa3, 0xb5, 0x1b, 0xe7, 0x9c, 0x02, 0x27, 0xd6, 0x2f, 0x1c, 0x0c, 0x9f, 
+	0xc8, 0x2d, 0x7b, 0x17, 0x81, 0xe5, 0xec, 0x00, 0x0b, 0xc0, 0x40, 0x0b, 0x1d, 0xbf, 0x50, 0x8f, 
+	0x60, 0x05, 0x02, 0x0f, 0x00, 0x07, 0xb1, 0x03, 0x1c, 0x0c, 0xe2, 0x09, 0x21, 0xf3, 0x9f, 0xe7, 
+	0x03, 0xcf, 0xe1, 0xd8, 0x00, 0x6b, 0x55, 0x30, 0x08, 0xdb, 0x48, 0x00, 0x03, 0x60, 0x00, 0x03, 
+	0xa1, 0x05, 0x83, 0x00, 0x80, 0x10, 0x00, 0xe2, 0x01, 0x20, 0x32, 0xe0, 0x05, 0xa1, 0x14, 0xca, 
+	0x15, 0xa0, 0x00, 0xd7, 0x0f, 0x01, 0x1f, 0x01, 0x0f, 0x20, 0x00, 0xe2, 0x02, 0x00, 0x81, 0x02, 
+	0xbb, 0x03, 0xca, 0xe5, 0xe3, 0x0c, 0x00, 0x0a, 0x17, 0xb3, 0x05, 0x48, 0x31, 0xeb, 0xa1, 0x3d, 
+	0x2f, 0x0b, 0xab, 0x00, 0x0a, 0x2b, 0x18, 0x63, 0x8a, 0x27, 0xb3, 0xa0, 0xe3, 0xa7, 0x00, 0x1b, 
+	0x40, 0x09, 0xe7, 0xd2, 0xf2, 0x00, 0x07, 0x2b, 0x4b, 0x00, 0x8f, 0x03, 0x5f, 0xe1, 0x0a, 0x00, 
+	0x27, 0x06, 0xc1, 0x0a, 0x17, 0x00, 0x87, 0x11, 0xb3, 0x0c, 0x00, 0xea, 0x10, 0x5f, 0x4d, 0xf0, 
+	0x00, 0x5f, 0x00, 0x22, 0x15, 0xc3, 0x30, 0x5f, 0xcb, 0x00, 0x17, 0xbe, 0x51, 0x57, 0xa3, 0x00, 
+	0x1f, 0x10, 0xbf, 0x1c, 0x17, 0x12, 0x03, 0x48, 0x6b, 0x11, 0x83, 0x15, 0x77, 0x01, 0x10, 0x21, 
+	0xe2, 0xa4, 0x01, 0xb7, 0x10, 0x27, 0x00, 0x51, 0x0c, 0x5c, 0xe3, 0xb9, 0x0c, 0x00, 0xba, 0x45, 
+	0x07, 0x00, 0xdb, 0x01, 0x0c, 0x51, 0x25, 0x7f, 0x05, 0x00, 0x07, 0x06, 0xb4, 0x0c, 0x00, 0x1a, 
+	0xa4, 0x00, 0xa3, 0x58, 0xa3, 0xa2, 0xcd, 0x00, 0x0b, 0x4a, 0x57, 0xeb, 0xd3, 0x00, 0x67, 0x10, 
+	0xc7, 0xc9, 0x00, 0xa3, 0x66, 0x80, 0x03, 0xcf, 0x0a, 0xf3, 0xba, 0xf0, 0x00, 0x07, 0x02, 0x77, 
+	0xaa, 0xb5, 0x11, 0x37, 0x8d, 0x00, 0x17, 0x10, 0x07, 0xd0, 0x00, 0x07, 0x14, 0x02, 0x73, 0x00, 
+	0x08, 0x08, 0x9a, 0xe5, 0xf1, 0x20, 0xa0, 0xe3, 0x00, 0x90, 0x02, 0x02, 0xe0, 0x22, 0x12, 0x81, 
+	0xe0, 0x7a, 0x10, 0x16, 0x27, 0x00, 0x1f, 0x0b, 0x4c, 0x29, 0x5b, 0xc6, 0x00, 0x07, 0x18, 0x83, 
+	0x40, 0x27, 0x80, 0x03, 0x80, 0xe0, 0x20, 0x00, 0x23, 0x04, 0xff, 0xad, 0x20, 0x23, 0x7a, 0x40, 
+	0x23, 0xbd, 0x80, 0x4b, 0x50, 0x23, 0x94, 0x02, 0xa7, 0x55, 0x14, 0x0e, 0x3b, 0x56, 0x41, 0x2b, 
+	0x08, 0x00, 0x0b, 0x84, 0x00, 0x9b, 0x21, 0x20, 0x51, 0x05, 0xf7, 0x50, 0x00, 0x03, 0xb0, 0x09, 
+	0xe7, 0x08, 0x01, 0x51, 0x00, 0x00, 0xd1, 0xf3, 0x08, 0x10, 0x8f, 0x2d, 0xe2, 0x50, 0x03, 0x9f, 
+	0xa4, 0x01, 0xef, 0x13, 0xa3, 0x41, 0x01, 0x03, 0x81, 0x05, 0x0b, 0x35, 0xff, 0x20, 0x0c, 0xe2, 
+	0xfe, 0x07, 0x3b, 0x50, 0x16, 0x01, 0x03, 0xff, 0x40, 0x07, 0x17, 0x20, 0x02, 0xe2, 0x00, 0x10, 
+	0x00, 0x12, 0xe3, 0x08, 0x20, 0x42, 0x12, 0x5a, 0x00, 0x00, 0x37, 0x02, 0x02, 0xfb, 0x10, 0x43, 
+	0x14, 0x0a, 0xe3, 0x20, 0xba, 0x00, 0x03, 0x28, 0x00, 0x03, 0x94, 0x23, 0x14, 0x8f, 0xbc, 0x02, 
+	0x67, 0xd8, 0xa6, 0x00, 0x03, 0xf4, 0x00, 0x03, 0x10, 0x49, 0x0e, 0x8b, 0x00, 0x03, 0x48, 0xad, 
+	0x00, 0x03, 0x64, 0x00, 0x03, 0x80, 0x00, 0x03, 0x17, 0x2f, 0x58, 0x03, 0x57, 0xa7, 0x10, 0x07, 
+	0x54, 0x25, 0x3f, 0x00, 0xe2, 0x27, 0x8f, 0x00, 0x8b, 0x11, 0xbf, 0xfd, 0x10, 0x07, 0x31, 0xbb, 
+	0x08, 0x0f, 0x01, 0xa7, 0x10, 0x0f, 0x31, 0x8b, 0x50, 0x06, 0x3f, 0x23, 0x00, 0x0a, 0x25, 0x7b, 
+	0x08, 0x90, 0xe2, 0x14, 0x13, 0x04, 0xb7, 0x08, 0x25, 0x00, 0x80, 0x58, 0x02, 0x47, 0xd9, 0x54, 
+	0x00, 0x0b, 0xf1, 0x9a, 0x57, 0x60, 0x00, 0xff, 0xb0, 0x00, 0xfb, 0x57, 0x0b, 0x42, 0x98, 0x03, 
+	0x03, 0xa4, 0xa5, 0x00, 0x08, 0x50, 0x03, 0xf8, 0xc0, 0x00, 0x03, 0x10, 0x4f, 0x10, 0x14, 0x18, 
+	0x18, 0x1c, 0x1c, 0x26, 0x1c, 0x1c, 0x54, 0x9f, 0x28, 0xf2, 0xf4, 0x9f, 0x14, 0x27, 0xb8, 0xac, 
+	0x04, 0x9f, 0xb8, 0x44, 0x9f, 0x08, 0x0e, 0x0f, 0x14, 0x93, 0xb4, 0xc4, 0xab, 0x13, 0xb3, 0x1c, 
+	0x24, 0x5b, 0xb0, 0x00, 0x8b, 0x0e, 0x00, 0x0b, 0x08, 0x1b, 0xf6, 0x0f, 0xa5, 0x02, 0x8b, 0x04, 
+	0xab, 0x14, 0x53, 0xb0, 0x00, 0x9b, 0x0b, 0x3b, 0x2a, 0xaa, 0x14, 0xa7, 0xd4, 0xc4, 0xa7, 0xc8, 
+	0x44, 0xa7, 0x17, 0x01, 0xe3, 0x90, 0x00, 0x10, 0x4f, 0xe2, 0xac, 0xc0, 0xd1, 0xe7, 0x10, 0x00, 
+	0x1c, 0xa0, 0xe1, 0x12, 0x1c, 0x51, 0xe0, 0x00, 0x00, 0x20, 0xe0, 0xe3, 0x32, 0x0c, 0xc0, 0xe1, 
+	0x31, 0x20, 0x0c, 0x80, 0x20, 0x43, 0xb8, 0x14, 0x9a, 0xe5, 0xed, 0x00, 0xff, 0xff, 0x3a, 0x32, 
+	0x0c, 0x00, 0xe0, 0x0b, 0xff, 0x00, 0x2f, 0x90, 0x7b, 0xf0, 0xaf, 0x00, 0xaf, 0x00, 0xab, 0x50, 
+	0x93, 0x1b, 0x67, 0x16, 0xa3, 0xd4, 0x14, 0xdf, 0x54, 0xdb, 0xf8, 0x84, 0xdb, 0x40, 0x00, 0x87, 
+	0x11, 0x2e, 0x92, 0x10, 0x7f, 0xd2, 0xe7, 0x30, 0x77, 0x00, 0xe0, 0x0d, 0xd7, 0xea, 0x00, 0x03, 
+	0x10, 0x0c, 0xe2, 0x07, 0xca, 0x0c, 0xe2, 0x04, 0x2c, 0x15, 0x81, 0xe1, 0xa1, 0x03, 0x3f, 0x01, 
+	0xcb, 0x18, 0x8a, 0xe2, 0xa0, 0x10, 0xbb, 0x01, 0xa7, 0x01, 0x20, 0xdc, 0x00, 0xe7, 0xf0, 0x20, 
+	0x02, 0x32, 0x00, 0x00, 0x82, 0x00, 0x31, 0x0f, 0x20, 0x02, 0x22, 0x00, 0x02, 0x82, 0x00, 0x21, 
+	0x01, 0x00, 0xcc, 0xe7, 0x04, 0x00, 0x51, 0x04, 0xe3, 0xf4, 0xc0, 0x9f, 0xa5, 0x08, 0xff, 0x32, 
+	0x01, 0x1c, 0xf1, 0x9c, 0xe7, 0x92, 0x13, 0x12, 0x2f, 0x10, 0x53, 0x01, 0x0a, 0x03, 0x1c, 0xe3, 
+	0x04, 0x10, 0x81, 0x13, 0x10, 0x47, 0x15, 0xf7, 0x62, 0x84, 0x09, 0x2b, 0x10, 0x2b, 0x0f, 0x20, 
+	0xc2, 0x0c, 0x53, 0x82, 0x35, 0xe1, 0xac, 0x18, 0x0f, 0x01, 0x9b, 0xf0, 0x10, 0x0f, 0x02, 0x70, 
+	0x0f, 0x2a, 0x0f, 0x2c, 0x00, 0x0f, 0x04, 0x80, 0x0f, 0x2a, 0x00, 0x0f, 0x06, 0x85, 0x70, 0x0f, 
+	0xb0, 0x24, 0x8a, 0xe5, 0x95, 0x8f, 0xb5, 0x00, 0xc3, 0x55, 0xb4, 0xc5, 0x8b, 0x87, 0x45, 0x3b, 
+	0xb4, 0x02, 0x57, 0xf3, 0x00, 0x1f, 0x23, 0x20, 0x11, 0x1f, 0x73, 0x10, 0xe3, 0x44, 0x02, 0xf7, 
+	0x00, 0x03, 0x02, 0x25, 0x14, 0xa6, 0x00, 0x08, 0x24, 0x00, 0x03, 0x34, 0xaa, 0x00, 0x03, 0x44, 
+	0x00, 0x03, 0x54, 0x00, 0x03, 0x68, 0x00, 0x03, 0x88, 0xe1, 0x00, 0x03, 0x28, 0xc3, 0x82, 0x63, 
+	0xc7, 0x0b, 0x00, 0xea, 0xd5, 0x5b, 0x5b, 0x8c, 0x02, 0xeb, 0xc4, 0x02, 0x6f, 0x12, 0x77, 0x00, 
+	0x0e, 0x0f, 0x90, 0x03, 0x49, 0x04, 0x03, 0x67, 0x54, 0x00, 0x37, 0x0f, 0x20, 0xc2, 0x0e, 0xf3, 
+	0xd6, 0x0e, 0xcb, 0x12, 0x07, 0x04, 0x49, 0x3f, 0x00, 0x09, 0x3b, 0x67, 0x5b, 0xa8, 0xe1, 0x0b, 
+	0x13, 0x00, 0x03, 0x10, 0x73, 0x04, 0xa9, 0x00, 0x08, 0x02, 0xef, 0x5a, 0xea, 0x50, 0x13, 0xcc, 
+	0x00, 0x03, 0x10, 0x13, 0xe0, 0x43, 0xbf, 0x49, 0x0f, 0x1f, 0x8f, 0xe2, 0x0c, 0x47, 0x67, 0x13, 
+	0x13, 0x15, 0xbb, 0x1f, 0x13, 0x06, 0xbc, 0xf1, 0x9f, 0x15, 0x20, 0x03, 0x2f, 0x08, 0xcb, 0xe3, 
+	0x5b, 0x20, 0x00, 0xef, 0xb0, 0x01, 0xe7, 0x52, 0xe7, 0xa0, 0xf7, 0x87, 0x22, 0x37, 0x5f, 0xb0, 
+	0x01, 0x8f, 0xb0, 0x02, 0x3b, 0x13, 0x67, 0x19, 0x2f, 0x2d, 0x97, 0x02, 0xf3, 0x40, 0x78, 0x97, 
+	0x87, 0x00, 0x80, 0xe0, 0x02, 0x09, 0x50, 0x93, 0x0b, 0xc3, 0x8a, 0xb5, 0x01, 0xc3, 0xba, 0x50, 
+	0x00, 0x1b, 0x13, 0x83, 0x6f, 0x84, 0x42, 0x53, 0x12, 0xdf, 0x4c, 0x00, 0x5f, 0x90, 0x43, 0xf0, 
+	0x6b, 0x00, 0x6b, 0x8a, 0x47, 0x7b, 0x02, 0x09, 0x60, 0xa2, 0x9b, 0xac, 0x82, 0x9b, 0x04, 0xe5, 
+	0x00, 0x47, 0x16, 0x77, 0x09, 0xe7, 0x35, 0x01, 0x01, 0x2f, 0xd1, 0x11, 0xbf, 0xc0, 0x0f, 0xdb, 
+	0x91, 0xe7, 0x1e, 0x1b, 0x0c, 0xe2, 0x05, 0x0a, 0x50, 0x51, 0x1c, 0x53, 0x05, 0x01, 0x03, 0x01, 
+	0x16, 0x0b, 0x51, 0xbd, 0x29, 0x5b, 0x7f, 0x06, 0x87, 0x06, 0x83, 0x00, 0x83, 0x34, 0x57, 0xda, 
+	0x01, 0xef, 0xb6, 0x10, 0x4b, 0xb8, 0x01, 0xeb, 0x10, 0x4b, 0xbe, 0xf0, 0x4b, 0x80, 0x4b, 0xda, 
+	0xf2, 0x60, 0x4b, 0x16, 0x2f, 0x16, 0xa7, 0x26, 0x33, 0x00, 0x80, 0x16, 0x07, 0xe1, 0x80, 0x10, 
+	0x27, 0x74, 0x20, 0x9f, 0xe5, 0xa1, 0xf4, 0x92, 0x10, 0xe7, 0x06, 0x2b, 0x02, 0xd3, 0x1b, 0x8a, 
+	0xe2, 0xa8, 0x82, 0x00, 0xd3, 0xa2, 0x05, 0xc1, 0xe7, 0xa8, 0x00, 0xd3, 0x5c, 0x4b, 0x10, 0x11, 
+	0x83, 0x10, 0xe0, 0x04, 0xdf, 0x05, 0x12, 0x5f, 0x09, 0xf3, 0x02, 0x15, 0x01, 0x0c, 0x10, 0xe3, 
+	0x4c, 0x10, 0x07, 0x08, 0x1a, 0x10, 0xe3, 0x48, 0x01, 0xf3, 0x10, 0x43, 0x06, 0x00, 0x6b, 0x40, 
+	0xaa, 0x00, 0x23, 0x1a, 0x00, 0x67, 0x3c, 0x00, 0x07, 0x07, 0x00, 0x0f, 0x38, 0xcf, 0x19, 0x83, 
+	0x01, 0xcb, 0xff, 0x7f, 0x0e, 0xad, 0x02, 0x5f, 0x14, 0xbb, 0x12, 0x63, 0xd8, 0x12, 0x5f, 0x14, 
+	0xd3, 0x88, 0x00, 0x03, 0x17, 0xc3, 0x01, 0x01, 0x01, 0x7a, 0x01, 0x12, 0x67, 0x12, 0x6f, 0x14, 
+	0xe3, 0x93, 0x6b, 0x74, 0x02, 0x1f, 0xd8, 0xc3, 0x12, 0x23, 0x00, 0x03, 0x20, 0xaa, 0x00, 0x08, 
+	0x28, 0x4f, 0x03, 0x77, 0xb0, 0x05, 0x63, 0x1a, 0x1c, 0xab, 0x08, 0xa7, 0xea, 0x2c, 0xc1, 0x8c, 
+	0x07, 0xe1, 0x03, 0xc0, 0x1c, 0xe2, 0x05, 0xf3, 0x00, 0xa3, 0x3a, 0x8f, 0xee, 0x5d, 0x0f, 0x11, 
+	0xbb, 0x1d, 0x13, 0x01, 0x0a, 0xb3, 0x1d, 0x17, 0x12, 0xa7, 0xa0, 0xfd, 0x4a, 0x7f, 0x1c, 0xc7, 
+	0x1a, 0xff, 0x10, 0x13, 0x1b, 0x0f, 0x50, 0x13, 0x80, 0x12, 0xc7, 0xc0, 0x00, 0x63, 0x00, 0x07, 
+	0x05, 0x0b, 0x2a, 0x4c, 0xe2, 0x03, 0x08, 0x2a, 0x02, 0xe2, 0x85, 0x04, 0x7f, 0x02, 0x2b, 0x82, 
+	0x21, 0x13, 0x4a, 0x00, 0x07, 0x01, 0x29, 0x82, 0x13, 0x51, 0x27, 0xc0, 0x13, 0xfb, 0x11, 0x2b, 
+	0x01, 0x29, 0xc2, 0xe3, 0xa2, 0x05, 0x00, 0xf1, 0xe7, 0x08, 0x10, 0xd1, 0xe5, 0x01, 0x02, 0x10, 
+	0x80, 0xe1, 0x48, 0x01, 0x37, 0xa2, 0xf4, 0x91, 0xe7, 0xd1, 0x1a, 0x7b, 0x04, 0xef, 0x4a, 0x10, 
+	0x3f, 0x01, 0xc0, 0x8c, 0x20, 0x3f, 0x55, 0x02, 0x00, 0x07, 0x03, 0x09, 0x83, 0x04, 0x02, 0xf7, 
+	0xa0, 0x08, 0x67, 0x9a, 0x19, 0x7f, 0xa4, 0x69, 0x08, 0xf7, 0x00, 0x03, 0xb8, 0x00, 0x03, 0x2c, 
+	0xfa, 0x0e, 0x8b, 0x19, 0x07, 0x10, 0xff, 0x51, 0x0b, 0x11, 0x27, 0x80, 0x00, 0xff, 0x8c, 0xaf, 
+	0x00, 0x03, 0x94, 0x00, 0x03, 0xd4, 0x00, 0x03, 0x2c, 0xd3, 0x00, 0xa7, 0x06, 0x73, 0x58, 0x05, 
+	0x00, 0x03, 0x15, 0x10, 0x0b, 0x01, 0x9f, 0x05, 0x0b, 0xca, 0x0e, 0x4c, 0xe2, 0xac, 0x15, 0x00, 
+	0x1b, 0x10, 0x73, 0x04, 0x9f, 0x02, 0xd0, 0x10, 0x07, 0x04, 0xf3, 0xa4, 0x84, 0xf3, 0x78, 0x20, 
+	0x02, 0x02, 0x00, 0xa0, 0x00, 0x82, 0x01, 0x07, 0x20, 0x02, 0x12, 0x0b, 0x80, 0x01, 0x82, 0x11, 
+	0x14, 0xf3, 0x18, 0x07, 0x6f, 0x24, 0xbf, 0xf9, 0x40, 0xb3, 0x10, 0x5f, 0x10, 0x7f, 0x10, 0x8b, 
+	0x50, 0x83, 0x18, 0xab, 0x0d, 0x5f, 0x90, 0x80, 0x03, 0x14, 0x05, 0x06, 0xbb, 0x07, 0x50, 0xe3, 
+	0x02, 0x02, 0x07, 0x80, 0x82, 0x14, 0x05, 0x8a, 0x2e, 0xd7, 0x6c, 0x88, 0x1b, 0xeb, 0xc4, 0x8a, 
+	0xe5, 0x03, 0xeb, 0xe2, 0x0c, 0x01, 0x3b, 0x80, 0xe1, 0x5c, 0x47, 0x17, 0x23, 0x23, 0x27, 0x0a, 
+	0x3c, 0xcf, 0x02, 0x43, 0xa1, 0x20, 0x0f, 0x01, 0x00, 0x0f, 0x02, 0x0b, 0xc0, 0x13, 0x1c, 0xe7, 
+	0x8e, 0x04, 0xdf, 0x1a, 0xa0, 0x03, 0x0d, 0x8b, 0x4e, 0x1f, 0x09, 0x83, 0xe0, 0x00, 0x21, 0x13, 
+	0xa0, 0xe1, 0xfe, 0x10, 0x81, 0xe3, 0x1f, 0x20, 0x03, 0x01, 0x6c, 0x5b, 0x1e, 0x2f, 0x10, 0x3b, 
+	0x2e, 0xc7, 0x4c, 0x43, 0xf5, 0x1d, 0xab, 0x12, 0x3f, 0x1c, 0x3f, 0x1a, 0x4b, 0xb0, 0x00, 0x9f, 
+	0xe0, 0x00, 0x03, 0x4b, 0xe8, 0x00, 0x03, 0x28, 0xac, 0x32, 0x3b, 0x09, 0x00, 0xdb, 0x00, 0x97, 
+	0x45, 0xaa, 0x13, 0x03, 0x02, 0x10, 0x11, 0x1d, 0x07, 0x05, 0x00, 0x03, 0x05, 0x15, 0x2c, 0xc2, 
+	0x8c, 0xe1, 0x52, 0x47, 0x84, 0x00, 0x13, 0xa1, 0x57, 0xbf, 0x0b, 0x00, 0x2f, 0x78, 0xf0, 0x9f, 
+	0x45, 0x11, 0x37, 0xb6, 0x52, 0x0b, 0x55, 0x11, 0x4f, 0x02, 0x0b, 0xaa, 0x42, 0x13, 0x12, 0x0b, 
+	0xa6, 0xa1, 0x02, 0x0b, 0x22, 0x12, 0x07, 0x2b, 0xc2, 0xe3, 0x22, 0x02, 0x07, 0x5f, 0x01, 0x42, 
+	0x07, 0x40, 0xc2, 0x07, 0x70, 0x67, 0xf1, 0xff, 0x11, 0xfb, 0x12, 0x03, 0xf5, 0x11, 0xff, 0x11, 
+	0x77, 0x11, 0xff, 0x91, 0x7b, 0x88, 0x00, 0xc3, 0x94, 0x80, 0x03, 0x77, 0x18, 0x01, 0x6b, 0x1a, 
+	0x27, 0x10, 0xa7, 0x18, 0x00, 0x9f, 0x10, 0x0b, 0x01, 0x3f, 0x5d, 0xea, 0x11, 0x77, 0xa1, 0x00, 
+	0x0b, 0x03, 0xfb, 0x23, 0x03, 0x03, 0x08, 0x77, 0x77, 0xa0, 0x0a, 0x53, 0x5d, 0x7b, 0x10, 0x17, 
+	0xa1, 0x00, 0xff, 0x10, 0x13, 0x11, 0x3f, 0xcd, 0x15, 0xaf, 0x51, 0x33, 0x00, 0xad, 0x0b, 0x77, 
+	0x00, 0x03, 0x2c, 0x00, 0x03, 0x77, 0x38, 0x00, 0x03, 0x2a, 0x23, 0xc0, 0x13, 0x02, 0x00, 0x77, 
+	0x11, 0x1f, 0x53, 0x8b, 0x97, 0x01, 0x33, 0x02, 0x64, 0x33, 0xeb, 0x11, 0x10, 0x0f, 0x14, 0x6f, 
+	0x10, 0xdf, 0x83, 0x4f, 0x1b, 0x11, 0x20, 0x01, 0xa0, 0xe1, 0x14, 0x27, 0x20, 0x2b, 0x17, 0x00, 
+	0x1c, 0x03, 0x14, 0x27, 0x0d, 0x11, 0x4b, 0x00, 0x23, 0x21, 0x87, 0x80, 0x06, 0xd7, 0x8c, 0x10, 
+	0x01, 0xe0, 0xac, 0xc0, 0x81, 0x02, 0x11, 0x22, 0x25, 0x8c, 0xe1, 0x08, 0x09, 0x9f, 0x20, 0x85, 
+	0x0c, 0x9b, 0x20, 0x10, 0x4f, 0x12, 0x19, 0x9f, 0x9c, 0x81, 0x17, 0xf5, 0x16, 0x47, 0x5c, 0x27, 
+	0x11, 0x1f, 0x11, 0x17, 0x98, 0x00, 0x93, 0xbc, 0x10, 0x03, 0xe7, 0x4a, 0x0f, 0x53, 0x17, 0x01, 
+	0x07, 0x1a, 0xa0, 0x08, 0x6f, 0x10, 0x5f, 0x1e, 0x1f, 0xae, 0x00, 0x03, 0x15, 0x3f, 0x2f, 0x10, 
+	0x1e, 0x1f, 0x20, 0x8f, 0x1e, 0x1f, 0x07, 0xbe, 0x00, 0x87, 0x10, 0x01, 0xa7, 0x11, 0x87, 0x51, 
+	0x77, 0x12, 0x47, 0x51, 0x77, 0xf8, 0xb7, 0x10, 0xf7, 0xae, 0x07, 0x47, 0x00, 0x03, 0x60, 0x00, 
+	0x03, 0x10, 0x5f, 0x10, 0xbb, 0x76, 0x24, 0x01, 0xbf, 0x21, 0xbb, 0x00, 0x63, 0xff, 0x00, 0x63, 
+	0x01, 0x03, 0x15, 0xfb, 0x17, 0x9b, 0x5f, 0xaf, 0x12, 0xef, 0x17, 0x0f, 0x12, 0xe7, 0x04, 0x00, 
+	0x37, 0x10, 0x4f, 0x5b, 0xa0, 0x0a, 0x2f, 0xd4, 0x00, 0x03, 0x10, 0x3f, 0x3c, 0x40, 0x73, 0x12, 
+	0x73, 0xfc, 0x14, 0xcf, 0x1a, 0x23, 0x20, 0xbb, 0x01, 0x37, 0x46, 0x03, 0x22, 0x8f, 0xfa, 0xff, 
+	0x3e, 0xff, 0x1a, 0x5a, 0x3b, 0x10, 0x5b, 0x11, 0xaf, 0x10, 0xa7, 0x10, 0xa3, 0xac, 0xfe, 0x00, 
+	0x9f, 0x12, 0xfb, 0x90, 0x03, 0x1b, 0x0f, 0x1e, 0xaf, 0x13, 0x8b, 0x13, 0x43, 0x24, 0x97, 0x25, 
+	0xc3, 0x5c, 0xe1, 0x11, 0x03, 0x01, 0x06, 0x97, 0x10, 0x0b, 0x1f, 0x1f, 0xde, 0x50, 0x0b, 0x00, 
+	0x4f, 0x05, 0x53, 0x43, 0x15, 0xab, 0x17, 0xb7, 0x17, 0xbf, 0xe8, 0x80, 0x1b, 0x5b, 0x3e, 0x00, 
+	0x06, 0x14, 0x3f, 0x00, 0x06, 0x55, 0x24, 0x00, 0x03, 0x50, 0x00, 0x03, 0x0c, 0x4d, 0x47, 0x4c, 
+	0x07, 0x2b, 0x05, 0xc8, 0x07, 0x8a, 0xe5, 0x48, 0x00, 0x07, 0xd0, 0x00, 0x07, 0x55, 0x44, 0x00, 
+	0x07, 0xcc, 0x00, 0x07, 0xd4, 0x00, 0x03, 0x3c, 0x00, 0x0b, 0x54, 0xd8, 0x00, 0x07, 0x2b, 0x0f, 
+	0xa7, 0x34, 0x07, 0xc3, 0x58, 0x20, 0x10, 0x1a, 0xe5, 0x76, 0x0a, 0xeb, 0x2c, 0x21, 0x9f, 0x05, 
+	0x44, 0xf5, 0x00, 0x07, 0x2d, 0x35, 0xda, 0x05, 0xb6, 0x53, 0x03, 0x50, 0x20, 0x00, 0x0f, 0xf9, 
+	0x00, 0x0f, 0x1c, 0x31, 0x9f, 0x05, 0x00, 0x1c, 0x01, 0x9f, 0x05, 0x00, 0x30, 0x80, 0x05, 0x4b, 
+	0x18, 0x00, 0x13, 0x58, 0x20, 0x38, 0x03, 0x04, 0x00, 0x7b, 0x9b, 0xe7, 0x53, 0x00, 0x00, 0x57, 
+	0x10, 0x08, 0x77, 0xfc, 0x00, 0x0f, 0xc7, 0x00, 0x07, 0x5f, 0xff, 0x00, 0x8b, 0xc3, 0x52, 0x87, 
+	0x03, 0x8b, 0x12, 0x4b, 0x15, 0xe3, 0x12, 0x9b, 0x05, 0x01, 0xc0, 0x20, 0xe0, 0x40, 0x00, 0x13, 
+	0x6e, 0x00, 0x0f, 0x8c, 0x10, 0x4b, 0x07, 0x10, 0x01, 0x09, 0x9b, 0x1d, 0xeb, 0x00, 0x00, 0x35, 
+	0x40, 0xb1, 0xbe, 0x57, 0x50, 0x03, 0x5c, 0x00, 0x17, 0x54, 0x00, 0x03, 0xbc, 0x10, 0x4b, 0x9c, 
+	0x01, 0x1f, 0x1e, 0xcb, 0x11, 0xd7, 0x13, 0x43, 0x00, 0x20, 0x2d, 0xa0, 0xe1, 0x01, 0x1a, 0x1b, 
+	0x13, 0x2f, 0x10, 0x67, 0x80, 0x00, 0x17, 0xb5, 0x10, 0x53, 0x08, 0x05, 0x5f, 0x50, 0x57, 0x9c, 
+	0x01, 0xd7, 0xd0, 0xfc, 0x1f, 0x02, 0x03, 0xcc, 0xb0, 0x00, 0x08, 0xb4, 0x00, 0x03, 0x04, 0xb9, 
+	0x01, 0x53, 0x38, 0x00, 0x03, 0xdc, 0x4f, 0x50, 0x1f, 0x18, 0x6c, 0x00, 0x2f, 0x0a, 0x3d, 0x00, 
+	0x06, 0xf8, 0x00, 0x07, 0xf4, 0x00, 0x0f, 0x48, 0xa1, 0x00, 0xff, 0x88, 0x10, 0x03, 0xaf, 0x00, 
+	0x08, 0xdc, 0x00, 0x97, 0xaa, 0x1d, 0x07, 0xd4, 0x00, 0x0b, 0xb8, 0x40, 0xaf, 0x10, 0x00, 0x1b, 
+	0xc8, 0xaa, 0x02, 0x7b, 0xcc, 0x08, 0xeb, 0xc8, 0x0a, 0x33, 0xcc, 0x08, 0x87, 0xf8, 0x80, 0x02, 
+	0x7f, 0x19, 0xed, 0x8a, 0xe2, 0xff, 0x00, 0x9e, 0x00, 0xe8, 0xf0, 0x00, 0xae, 0xe8, 0x0f, 0x00, 
+	0x8e, 0x6f, 0xe8, 0x12, 0x8b, 0x15, 0x93, 0xf8, 0x02, 0x8b, 0x11, 0x2b, 0x03, 0xbf, 0xa5, 0x93, 
+	0xfe, 0x10, 0xd3, 0x1c, 0xb7, 0x90, 0x17, 0x03, 0xa3, 0x20, 0x17, 0x10, 0x0b, 0x07, 0xcf, 0xe5, 
+	0xd0, 0x17, 0x17, 0x10, 0x0f, 0x34, 0x00, 0x0b, 0x5d, 0x1e, 0xa0, 0xa3, 0x0a, 0x30, 0x10, 0x9f, 
+	0xb5, 0x18, 0xf7, 0x1d, 0x00, 0x0b, 0x28, 0xb4, 0x00, 0x0b, 0xb4, 0x00, 0x0b, 0x02, 0x67, 0xa5, 
+	0x00, 0x03, 0xb5, 0xbc, 0xd3, 0x00, 0x0b, 0x10, 0x67, 0x48, 0x02, 0x47, 0x58, 0xb2, 0x32, 0xf7, 
+	0x53, 0x57, 0x50, 0x7f, 0x01, 0xf9, 0xbf, 0x02, 0xec, 0x01, 0x03, 0x0c, 0x00, 0x61, 0x01, 0x0e, 
+	0x50, 0x17, 0x9b, 0x00, 0x10, 0xa0, 0x03, 0x02, 0xdf, 0x36, 0x13, 0xa7, 0x02, 0xdf, 0x14, 0xbf, 
+	0xa6, 0x01, 0xbf, 0x01, 0x4e, 0xea, 0xd9, 0x17, 0xdf, 0x10, 0x8f, 0x3f, 0x1f, 0x47, 0x18, 0xb3, 
+	0x03, 0x80, 0x20, 0x8f, 0x5a, 0xf8, 0x00, 0x83, 0xa6, 0x00, 0x8f, 0x90, 0x13, 0xe8, 0x00, 0x13, 
+	0x3e, 0xd5, 0x80, 0x27, 0x11, 0xa3, 0x40, 0x01, 0xa3, 0x06, 0x47, 0xf3, 0xcc, 0x40, 0xc3, 0xd5, 
+	0x50, 0x1f, 0x10, 0xcb, 0xbc, 0x47, 0xfb, 0xb4, 0xf0, 0x1b, 0xe1, 0x01, 0xff, 0xe6, 0x29, 0xaf, 
+	0x14, 0xbf, 0x00, 0x93, 0xe2, 0xa8, 0x43, 0x9b, 0x0d, 0xec, 0xe2, 0x57, 0x04, 0x00, 0xb3, 0x20, 
+	0x01, 0xf7, 0x08, 0x00, 0x07, 0x1b, 0xff, 0x1d, 0xf7, 0x56, 0x40, 0x00, 0x07, 0x20, 0x00, 0x07, 
+	0x80, 0x00, 0x07, 0x13, 0xa3, 0x10, 0xff, 0x00, 0x07, 0x1a, 0x33, 0x22, 0x1f, 0x01, 0x57, 0x22, 
+	0xa3, 0x00, 0x3b, 0x10, 0xef, 0x10, 0x13, 0xfe, 0x10, 0x43, 0x10, 0x23, 0x90, 0x43, 0x0a, 0x4f, 
+	0x60, 0x2b, 0x52, 0x7b, 0x1a, 0x73, 0x20, 0x80, 0x03, 0x23, 0xef, 0xff, 0xff, 0xba, 0x20, 0x00, 
+	0x40, 0x3a, 0xe2, 0xde, 0x1c, 0x0b, 0x89, 0x1f, 0x11, 0x57, 0xc4, 0x01, 0x63, 0xd8, 0xf6, 0x00, 
+	0x03, 0x12, 0x13, 0x10, 0x13, 0x11, 0x33, 0x44, 0x03, 0x23, 0x13, 0x2b, 0x40, 0xea, 0x43, 0x2b, 
+	0x01, 0x76, 0x0f, 0x77, 0xe0, 0x24, 0x97, 0x30, 0x00, 0xdb, 0x06, 0xdf, 0x01, 0x2b, 0x10, 0xe7, 
+	0x28, 0x14, 0x1f, 0x26, 0x47, 0x37, 0xbb, 0x56, 0xf7, 0x1f, 0xef, 0x9d, 0x50, 0x0b, 0x0c, 0x53, 
+	0x0b, 0xc7, 0x00, 0x5b, 0x14, 0x1f, 0x34, 0x1f, 0x13, 0xcd, 0x12, 0xc3, 0x42, 0x83, 0x38, 0xb3, 
+	0x05, 0x0f, 0x00, 0x6f, 0x54, 0x04, 0x63, 0x5f, 0x10, 0x04, 0x73, 0x50, 0x00, 0x07, 0x34, 0x7b, 
+	0x30, 0x6b, 0x0c, 0x8b, 0x20, 0x57, 0xb7, 0x52, 0x47, 0x0c, 0x00, 0x4f, 0x0a, 0x17, 0xe5, 0x2d, 
+	0x3f, 0x03, 0x37, 0x10, 0x5f, 0xaf, 0x10, 0x53, 0x58, 0x00, 0x47, 0x40, 0x40, 0x03, 0x17, 0xdb, 
+	0x11, 0x17, 0x15, 0x9b, 0xf4, 0x10, 0x0b, 0xf0, 0x7f, 0x7a, 0x2b, 0xd3, 0xc3, 0x2c, 0x4c, 0x4b, 
+	0x0d, 0x1d, 0xbb, 0x3c, 0x4b, 0x03, 0x00, 0x7b, 0x1f, 0x83, 0x14, 0xb3, 0x7f, 0x40, 0xd3, 0x12, 
+	0x57, 0xb0, 0x12, 0x63, 0xa7, 0x40, 0xdf, 0x11, 0xe7, 0x80, 0xf4, 0x9f, 0x35, 0x00, 0x51, 0x0c, 
+	0x5c, 0xe3, 0xae, 0x00, 0x00, 0x3a, 0x50, 0x52, 0x00, 0x07, 0xad, 0x08, 0x23, 0xff, 0x20, 0x1c, 
+	0xe2, 0x44, 0x0e, 0x1d, 0x6f, 0x00, 0x52, 0xe3, 0x07, 0xff, 0x0a, 0x05, 0xac, 0x00, 0x07, 0x10, 
+	0x00, 0x07, 0x14, 0x00, 0x07, 0x00, 0x37, 0xb1, 0x17, 0xca, 0x00, 0x07, 0x07, 0x77, 0xda, 0x20, 
+	0x40, 0x0f, 0x27, 0x00, 0x07, 0x3e, 0xb7, 0x00, 0x0f, 0x2b, 0x00, 0x07, 0x04, 0x77, 0xda, 0x22, 
+	0x2f, 0x1a, 0x1f, 0x00, 0x67, 0x6a, 0x12, 0x47, 0x97, 0x10, 0x87, 0x6d, 0x00, 0x0b, 0xb8, 0x00, 
+	0x07, 0x55, 0x9a, 0x01, 0xd7, 0x0c, 0xf4, 0x04, 0xf7, 0x00, 0x07, 0x04, 0x00, 0x07, 0xe4, 0xa2, 
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x20, 0x12, 0x20, 0x0c, 0x3f, 0x11, 0x11, 0xe2, 0xf8, 0xf3, 0x11, 
+	0x3b, 0x50, 0xe3, 0xf4, 0x00, 0x07, 0x14, 0x14, 0x20, 0x42, 0x2b, 0x9b, 0xa4, 0x08, 0x67, 0x02, 
+	0x00, 0x17, 0xc1, 0xe7, 0xa2, 0x02, 0x1f, 0x00, 0x0e, 0xa3, 0x19, 0x2f, 0x12, 0xbb, 0xa2, 0x17, 
+	0x63, 0xd0, 0x00, 0x27, 0x04, 0xe0, 0x2d, 0x05, 0xeb, 0x51, 0x75, 0xe3, 0x00, 0x54, 0x20, 0x17, 
+	0x11, 0x77, 0xbc, 0x00, 0x17, 0xa7, 0x00, 0x0b, 0x05, 0x04, 0xe0, 0x9d, 0xe4, 0xb4, 0x00, 0x0b, 
+	0x02, 0x00, 0x1f, 0x5d, 0x08, 0x80, 0x1f, 0x9c, 0x00, 0x13, 0x13, 0x4f, 0x10, 0x0b, 0x98, 0x80, 
+	0x2b, 0x76, 0x90, 0x00, 0x0b, 0x1b, 0x3f, 0x10, 0x17, 0x88, 0x00, 0x0b, 0x50, 0x2f, 0x80, 0xad, 
+	0x80, 0x2f, 0x68, 0x80, 0x2f, 0x60, 0x10, 0xaf, 0x06, 0xa7, 0xb4, 0x03, 0xc7, 0xb6, 0x5b, 0x1f, 
+	0x20, 0x00, 0xb7, 0x10, 0xaf, 0xa3, 0x40, 0xaf, 0x16, 0xe7, 0xaf, 0xaa, 0x00, 0x2f, 0x40, 0xc0, 
+	0xab, 0xab, 0x40, 0x4f, 0x2c, 0x20, 0x17, 0x9d, 0x75, 0xe4, 0x10, 0x23, 0x11, 0x3f, 0x10, 0xab, 
+	0x09, 0x00, 0x1f, 0xa9, 0x40, 0x1f, 0x6b, 0x10, 0x00, 0x1f, 0x50, 0x2b, 0x08, 0x00, 0x0b, 0xad, 
+	0x40, 0x7b, 0x50, 0x2f, 0x42, 0xa8, 0x40, 0x1b, 0xf0, 0xf2, 0x9f, 0xe5, 0x50, 0x33, 0xe8, 0xad, 
+	0x00, 0x0b, 0xaa, 0x40, 0x0b, 0xe0, 0x00, 0x0b, 0x50, 0x3f, 0xd8, 0x00, 0x0b, 0x6f, 0xac, 0x00, 
+	0x0b, 0x10, 0x43, 0xae, 0xc0, 0x47, 0x17, 0x6f, 0xf0, 0xc7, 0x70, 0xc7, 0xab, 0x11, 0x77, 0xb3, 
+	0x00, 0x2b, 0xa0, 0x01, 0x77, 0x74, 0x00, 0x47, 0x90, 0xcb, 0xfe, 0x10, 0x17, 0x10, 0x4b, 0x10, 
+	0x07, 0x11, 0x97, 0x10, 0x1f, 0x50, 0xcb, 0x14, 0x8f, 0xb1, 0xb5, 0x40, 0x7f, 0x60, 0x20, 0x37, 
+	0x30, 0x27, 0x58, 0x40, 0x23, 0xb0, 0x00, 0x0b, 0xbf, 0x10, 0x1f, 0xb2, 0x00, 0x03, 0x10, 0x17, 
+	0x10, 0x0f, 0x23, 0x3b, 0x00, 0x1f, 0x50, 0x37, 0x7a, 0x34, 0x00, 0x0b, 0x10, 0x1f, 0x21, 0x2f, 
+	0x80, 0x43, 0x24, 0x40, 0x43, 0xff, 0x45, 0x20, 0x19, 0x7b, 0x52, 0xe3, 0x0d, 0x02, 0xab, 0x04, 
+	0x00, 0x07, 0xd5, 0x00, 0x93, 0x22, 0xbb, 0xb6, 0x4e, 0x57, 0x06, 0x00, 0x0b, 0xb7, 0x48, 0x5f, 
+	0xe0, 0x04, 0xa3, 0x2a, 0x2b, 0x0f, 0x5f, 0x05, 0x02, 0x00, 0xc0, 0x03, 0x9b, 0x0f, 0x5f, 0x05, 
+	0x44, 0x02, 0x9f, 0x1a, 0x4b, 0x42, 0x00, 0x07, 0x13, 0x0b, 0x76, 0xd0, 0x0e, 0xb3, 0x10, 0x53, 
+	0x90, 0x4b, 0x16, 0x00, 0x07, 0x10, 0x47, 0x19, 0xfb, 0x00, 0x07, 0x17, 0x87, 0x10, 0x4b, 0x3f, 
+	0xa3, 0x1b, 0xc3, 0xc0, 0x2f, 0xa7, 0x13, 0xf7, 0x0e, 0x80, 0x00, 0x80, 0x13, 0x1f, 0x2b, 0x5f, 
+	0x37, 0x1f, 0x33, 0x14, 0x80, 0x00, 0x0b, 0x02, 0x10, 0x41, 0xe0, 0xec, 0xc7, 0x9a, 0x00, 0xe5, 
+	0x91, 0x2c, 0x8c, 0xe0, 0x03, 0x01, 0x52, 0x02, 0xe3, 0x40, 0x00, 0x80, 0x33, 0xf1, 0x08, 0xf7, 
+	0x40, 0x15, 0x00, 0xc0, 0x83, 0x10, 0x4b, 0xb6, 0x01, 0x67, 0xb6, 0x0b, 0x1b, 0x06, 0x91, 0x02, 
+	0x00, 0xe0, 0xff, 0x03, 0x37, 0xd0, 0x13, 0x20, 0x79, 0x04, 0x06, 0xab, 0x60, 0x73, 0x30, 0x6f, 
+	0x00, 0x93, 0xeb, 0x28, 0x0f, 0x67, 0xc0, 0x1e, 0xe3, 0x15, 0x7b, 0x1c, 0xf1, 0x9f, 0x05, 0xf4, 
+	0x06, 0x8b, 0x11, 0xaf, 0xb0, 0xe1, 0xf7, 0x09, 0x43, 0x78, 0x10, 0x87, 0x01, 0xcb, 0x76, 0x08, 
+	0x08, 0x47, 0x5f, 0xdf, 0x11, 0x43, 0xfc, 0x04, 0x63, 0x10, 0x1b, 0x08, 0x00, 0x08, 0x9a, 0xe5, 
+	0x20, 0x12, 0x81, 0xe0, 0x5c, 0xd7, 0x8f, 0xb7, 0x10, 0x1f, 0xdc, 0x00, 0x1f, 0xd0, 0x00, 0x03, 
+	0x50, 0x57, 0x15, 0x93, 0xed, 0x1b, 0x43, 0x10, 0x57, 0x10, 0x0b, 0xf0, 0x03, 0xa3, 0x00, 0x07, 
+	0xa1, 0x0f, 0x53, 0x00, 0xe2, 0x08, 0x18, 0x9a, 0xe5, 0x90, 0x01, 0x01, 0x00, 0xe0, 0x14, 0x07, 
+	0x9a, 0xe5, 0x21, 0x12, 0x80, 0x88, 0x03, 0xc7, 0x41, 0xe2, 0x0c, 0x00, 0x0b, 0x48, 0x04, 0x40, 
+	0x21, 0xe0, 0x10, 0x00, 0xf7, 0x00, 0x20, 0x82, 0xe0, 0x02, 0x07, 0x00, 0xe1, 0xe4, 0x07, 0x9a, 
+	0x45, 0x00, 0x10, 0x81, 0x2c, 0x40, 0xb4, 0x80, 0x6b, 0x74, 0x00, 0x63, 0x1f, 0x17, 0x60, 0xb4, 
+	0x1d, 0x00, 0x08, 0xd0, 0x44, 0xdf, 0x1f, 0x17, 0x14, 0xf7, 0xd4, 0x04, 0xf7, 0x7f, 0x20, 0x00, 
+	0x07, 0x15, 0xdf, 0x15, 0xff, 0x5e, 0x17, 0x15, 0x0b, 0x19, 0xab, 0x5a, 0x57, 0xfc, 0xd8, 0x5b, 
+	0x19, 0xcb, 0x58, 0x77, 0xd8, 0x97, 0x1f, 0x7f, 0x1f, 0x97, 0x90, 0x6d, 0xcd, 0x00, 0x3f, 0x0f, 
+	0x93, 0xec, 0x02, 0x39, 0xd3, 0x19, 0xcf, 0xe4, 0x00, 0x0b, 0xa2, 0x59, 0xcf, 0x0c, 0x01, 0x1b, 
+	0x48, 0x14, 0x41, 0x20, 0xbf, 0x01, 0xbf, 0x00, 0xbf, 0xb8, 0x08, 0x6b, 0x2c, 0x17, 0x01, 0xdf, 
+	0x10, 0x2f, 0x10, 0x27, 0x10, 0x33, 0x82, 0x29, 0xfb, 0x07, 0x00, 0xea, 0x3c, 0xb9, 0x08, 0xbb, 
+	0xbb, 0x15, 0x00, 0x08, 0x58, 0x00, 0x03, 0x9c, 0x00, 0x03, 0x12, 0x4a, 0x33, 0x6f, 0x94, 0x00, 
+	0x53, 0x1a, 0x17, 0xe4, 0x06, 0xc3, 0x11, 0xbb, 0x17, 0xa3, 0x19, 0x6b, 0x00, 0x0f, 0x20, 0x01, 
+	0xe2, 0xa1, 0x12, 0xa0, 0xe1, 0x30, 0x81, 0xc1, 0x0c, 0x8f, 0x0b, 0x17, 0x02, 0xf1, 0x9f, 0x17, 
+	0x8d, 0x05, 0x6f, 0xea, 0x38, 0xba, 0x09, 0x8f, 0x00, 0x03, 0x70, 0x00, 0x03, 0x55, 0x8c, 0x00, 
+	0x03, 0xa8, 0x00, 0x03, 0xc4, 0x00, 0x03, 0x18, 0x00, 0x53, 0x57, 0x28, 0x00, 0x03, 0xe0, 0x00, 
+	0x0b, 0xfc, 0x00, 0x03, 0xf9, 0xcb, 0x00, 0xef, 0xc3, 0x00, 0x1f, 0x15, 0xeb, 0xa0, 0x22, 0x31, 
+	0xe0, 0x21, 0xaf, 0x80, 0x5f, 0x59, 0x00, 0x09, 0x23, 0x05, 0x0c, 0x63, 0x03, 0xc3, 0x1b, 0x02, 
+	0x00, 0x07, 0x82, 0x05, 0xe3, 0x1b, 0x00, 0x80, 0xbd, 0xe8, 0x09, 0xe3, 0xe3, 0x40, 0x04, 0x00, 
+	0x1b, 0x06, 0x10, 0x2d, 0xe9, 0x01, 0x0b, 0xc0, 0x03, 0xf7, 0x01, 0xcf, 0x02, 0x00, 0xd0, 0xe7, 
+	0xda, 0xff, 0x02, 0xff, 0xeb, 0x06, 0x10, 0xbd, 0xe8, 0x00, 0xfb, 0xe2, 0x82, 0x12, 0xf3, 0x02, 
+	0x20, 0x82, 0x02, 0x0a, 0x00, 0x07, 0xf4, 0xa4, 0x02, 0x53, 0x04, 0x00, 0x37, 0x02, 0x50, 0x00, 
+	0x33, 0x20, 0xb0, 0x52, 0xe3, 0x15, 0x1f, 0xcf, 0x00, 0x2b, 0x02, 0x50, 0x30, 0x13, 0x07, 0xd6, 
+	0x00, 0x13, 0x15, 0x27, 0xca, 0x40, 0x13, 0x0f, 0x00, 0x0f, 0x15, 0x2b, 0xc6, 0xfe, 0x00, 0xff, 
+	0x18, 0x4f, 0x0b, 0x73, 0x6a, 0x37, 0x11, 0xa3, 0x11, 0xbb, 0x11, 0xa3, 0xa9, 0xfb, 0x80, 0x1b, 
+	0x1a, 0x4f, 0x11, 0xbb, 0x11, 0xcf, 0x11, 0xb7, 0xaa, 0x80, 0x1b, 0x10, 0x2b, 0xde, 0x50, 0x33, 
+	0x10, 0x07, 0xab, 0x80, 0x1b, 0x11, 0xe7, 0x12, 0x07, 0x50, 0x07, 0xac, 0xf7, 0x80, 0x1b, 0x10, 
+	0x47, 0x50, 0x4f, 0x10, 0x07, 0xad, 0x80, 0x1b, 0x12, 0x17, 0x12, 0x37, 0xbb, 0x50, 0x07, 0xae, 
+	0x80, 0x1b, 0x51, 0x5b, 0x50, 0x57, 0xaf, 0xf0, 0x1b, 0x60, 0x3b, 0xdd, 0x17, 0x63, 0x1d, 0x77, 
+	0xa4, 0x1f, 0x4b, 0x29, 0xaf, 0x30, 0x0f, 0x98, 0x00, 0x0f, 0xf7, 0x00, 0x03, 0x27, 0x7b, 0x2d, 
+	0xf7, 0x00, 0x0f, 0x80, 0x1d, 0x27, 0x02, 0x07, 0x2e, 0x3f, 0xb7, 0x03, 0x5f, 0x7c, 0x40, 0x0f, 
+	0x04, 0x97, 0x05, 0x11, 0xbb, 0x1e, 0xab, 0x16, 0x57, 0x7d, 0xa0, 0x15, 0x8f, 0x00, 0x1f, 0x16, 
+	0xfb, 0x05, 0x8b, 0x01, 0xbf, 0x82, 0x09, 0x47, 0x70, 0x80, 0x27, 0xdf, 0x92, 0xa3, 0x12, 0x9f, 
+	0x3f, 0x06, 0x00, 0xea, 0xa2, 0x00, 0x43, 0xe2, 0x10, 0x2b, 0x01, 0x10, 0xc1, 0x0a, 0x63, 0x81, 
+	0x24, 0xe1, 0xa2, 0x00, 0x3f, 0x20, 0x14, 0x04, 0xe7, 0x10, 0xc1, 0x17, 0x03, 0x20, 0x14, 0x20, 
+	0x5b, 0xe1, 0x1b, 0x73, 0x5b, 0x6f, 0x53, 0x53, 0x80, 0x5d, 0xff, 0xb8, 0xbc, 0x00, 0x08, 0x68, 
+	0xbd, 0x00, 0x36, 0x08, 0x7c, 0x00, 0x03, 0x5e, 0x57, 0x78, 0x00, 0x5f, 0x0c, 0x63, 0xeb, 0x6a, 
+	0x88, 0x04, 0x67, 0xd3, 0x17, 0x0c, 0x02, 0x1f, 0xac, 0x0b, 0x8f, 0xac, 0x81, 0x00, 0x7f, 0x01, 
+	0x10, 0x42, 0xe0, 0xa8, 0xc4, 0x14, 0x2f, 0x50, 0x1c, 0x24, 0x2f, 0x5c, 0x04, 0x73, 0x90, 0xc1, 
+	0x81, 0xe0, 0x25, 0x01, 0x10, 0x34, 0x33, 0xa4, 0x04, 0x04, 0x0b, 0x08, 0x06, 0x67, 0x0a, 0x08, 
+	0x50, 0xe0, 0x20, 0x00, 0x07, 0xa4, 0x09, 0x7f, 0x11, 0x1c, 0x00, 0x00, 0x8a, 0x13, 0x53, 0x12, 
+	0x1b, 0x10, 0x0f, 0x02, 0x10, 0xdf, 0x09, 0x9f, 0x84, 0xab, 0x20, 0x00, 0x73, 0x90, 0x53, 0xf0, 
+	0x7f, 0x00, 0x7f, 0x00, 0x7b, 0x80, 0x10, 0x5b, 0x80, 0x00, 0x90, 0xe0, 0x03, 0x08, 0xa0, 0x1a, 
+	0x03, 0x00, 0x10, 0x00, 0x17, 0x04, 0x83, 0xc0, 0x84, 0x67, 0xd8, 0xab, 0x4e, 0xfb, 0xd4, 0x4e, 
+	0xfb, 0x7c, 0x4e, 0xc7, 0xa9, 0x46, 0xdb, 0x11, 0x87, 0xb6, 0x1a, 0xc3, 0xb8, 0x10, 0x27, 0x01, 
+	0x77, 0xa9, 0x01, 0x37, 0x14, 0xf7, 0xac, 0xe5, 0x00, 0x0f, 0x01, 0x3f, 0x00, 0x97, 0xc1, 0xe3, 
+	0x01, 0x3f, 0xe5, 0x1a, 0xa3, 0xd6, 0x1d, 0x07, 0x03, 0x47, 0x0a, 0x1e, 0xf7, 0xba, 0x02, 0xe7, 
+	0x1e, 0xef, 0x80, 0xb5, 0x4b, 0x2f, 0xd3, 0x02, 0xe7, 0x90, 0x2f, 0xa0, 0x0c, 0xa7, 0xa4, 0x00, 
+	0x9f, 0x7d, 0xcd, 0x00, 0x17, 0x16, 0x73, 0x11, 0x4f, 0x16, 0x67, 0x10, 0x07, 0xcc, 0x01, 0x6b, 
+	0x6a, 0xe0, 0x00, 0x03, 0x11, 0x67, 0xf0, 0x00, 0x07, 0x20, 0x01, 0x73, 0x38, 0xbd, 0x00, 0x03, 
+	0x40, 0x41, 0x7b, 0x10, 0xaf, 0x0a, 0xb7, 0x20, 0xaf, 0x2c, 0x5f, 0x37, 0x38, 0x09, 0x5c, 0x1e, 
+	0xdf, 0x26, 0xc7, 0x14, 0xc7, 0x56, 0x55, 0x55, 0x7c, 0x55, 0x54, 0xcb, 0x2b, 0x17, 0x45, 0x43, 
+	0x5f, 0xc7, 0x11, 0xd7, 0x7c, 0xbe, 0x14, 0x00, 0x08, 0x90, 0x00, 0x03, 0xa4, 0x00, 0x03, 0x1c, 
+	0xbf, 0xef, 0x3f, 0xcb, 0x15, 0xfb, 0x11, 0xd3, 0x5c, 0x11, 0xd3, 0x46, 0xa7, 0x16, 0xb3, 0x16, 
+	0xab, 0xa8, 0x16, 0x2f, 0xa8, 0x00, 0xb7, 0xa8, 0x0c, 0xd3, 0x02, 0x20, 0x41, 0x41, 0xe0, 0x1e, 
+	0xdb, 0x90, 0xc2, 0x82, 0xe0, 0xa4, 0x01, 0x87, 0x57, 0x10, 0x41, 0x87, 0xa0, 0x41, 0xcb, 0x02, 
+	0x41, 0xcb, 0x1b, 0x4b, 0x04, 0xbf, 0x57, 0x2a, 0x5b, 0x4f, 0x0c, 0x81, 0xc3, 0x04, 0x00, 0x63, 
+	0x90, 0x3b, 0xf0, 0x6f, 0xfe, 0x00, 0x6f, 0x00, 0x6b, 0x10, 0x53, 0x16, 0x4f, 0x11, 0xc7, 0x02, 
+	0xbb, 0x21, 0xc3, 0xb0, 0xca, 0x81, 0xc3, 0x1c, 0xbb, 0x02, 0x0b, 0x23, 0x33, 0x01, 0x11, 0x1b, 
+	0xb0, 0xfd, 0x01, 0x07, 0x00, 0x03, 0xa0, 0x13, 0x53, 0x7b, 0x10, 0x0b, 0x08, 0x77, 0x0a, 0x91, 
+	0x8b, 0xba, 0x13, 0x4f, 0xa5, 0x00, 0x07, 0x10, 0x9f, 0x04, 0xdf, 0xea, 0x15, 0x8b, 0x10, 0xb8, 
+	0x4d, 0x2f, 0xa5, 0x42, 0x07, 0x13, 0x7f, 0x01, 0x9f, 0x15, 0x01, 0x10, 0x3b, 0x21, 0xe2, 0x10, 
+	0x2b, 0x29, 0x17, 0x01, 0xe7, 0xb5, 0x41, 0xe7, 0x04, 0xff, 0x6c, 0xea, 0xf0, 0x2b, 0x30, 0x2b, 
+	0xc5, 0x00, 0x1b, 0x90, 0x8b, 0x20, 0xf0, 0x2d, 0x9f, 0x15, 0x00, 0x03, 0xe5, 0xd1, 0xa7, 0x56, 
+	0xb7, 0x08, 0x04, 0xe3, 0x55, 0x3c, 0x00, 0x03, 0xd8, 0x01, 0xa3, 0xa0, 0x01, 0xb3, 0x6c, 0x01, 
+	0x9b, 0x57, 0x78, 0x00, 0x03, 0x84, 0x00, 0x03, 0x88, 0x41, 0xa7, 0x10, 0x47, 0x0c, 0xaf, 0x75, 
+	0x15, 0x1c, 0xb3, 0x10, 0x0b, 0x01, 0xfb, 0x15, 0x00, 0x03, 0xe5, 0x10, 0x03, 0xe4, 0x50, 0x63, 
+	0x1d, 0x47, 0x04, 0x8e, 0x1a, 0x18, 0x2c, 0x6b, 0x9f, 0xe5, 0xfc, 0x10, 0x5b, 0x10, 0x63, 0x10, 
+	0x5b, 0x10, 0x63, 0x1c, 0x47, 0x50, 0x63, 0x98, 0xc0, 0xf6, 0x01, 0xb5, 0x00, 0x03, 0x54, 0xbb, 
+	0x92, 0x0b, 0xb0, 0xf2, 0x0b, 0xe2, 0x0b, 0x90, 0xe3, 0x82, 0x0b, 0x53, 0x93, 0xf2, 0x0b, 0x8a, 
+	0xe5, 0x13, 0x02, 0x0b, 0x14, 0xcf, 0x9d, 0x03, 0xdf, 0x0a, 0x03, 0x01, 0x3f, 0x14, 0x0b, 0x98, 
+	0x7f, 0x50, 0x00, 0x6b, 0x6f, 0x03, 0x01, 0x4f, 0x0a, 0xe7, 0xea, 0x90, 0x4b, 0xf0, 0x7f, 0xf2, 
+	0x1b, 0x52, 0x1b, 0xbd, 0x93, 0xdf, 0x00, 0x00, 0x4f, 0x2f, 0x3b, 0x00, 0xcf, 0x11, 0x9f, 0x08, 
+	0x01, 0xd7, 0x00, 0x07, 0x10, 0x01, 0xe2, 0xec, 0x20, 0x9f, 0x05, 0x00, 0xb8, 0x20, 0x8f, 0x12, 
+	0x01, 0xf1, 0x92, 0xe7, 0xdd, 0x11, 0xef, 0x93, 0xbb, 0xc3, 0x41, 0xd3, 0x12, 0x0f, 0x15, 0x63, 
+	0xdc, 0x06, 0xdb, 0xbf, 0x92, 0x2f, 0xd8, 0x42, 0x23, 0x10, 0x33, 0x1b, 0xc3, 0x13, 0xb7, 0x2e, 
+	0xd3, 0x00, 0x3b, 0x6e, 0xb4, 0x40, 0x3b, 0x10, 0x13, 0xce, 0xc0, 0x27, 0x13, 0xe7, 0x50, 0x27, 
+	0xaa, 0xd8, 0x40, 0x27, 0x10, 0x13, 0xc4, 0x00, 0x27, 0x14, 0x63, 0x5c, 0x10, 0x9f, 0x56, 0x05, 
+	0x00, 0x03, 0x15, 0x1e, 0x3b, 0x58, 0x00, 0x0b, 0x00, 0x03, 0x15, 0xb6, 0x1e, 0x3f, 0x54, 0x02, 
+	0xbb, 0x1e, 0x53, 0x38, 0x00, 0x0b, 0x1a, 0x5f, 0xc3, 0x9a, 0x40, 0xcf, 0x3c, 0xc1, 0xb5, 0xa7, 
+	0x11, 0xc7, 0xb8, 0x01, 0xc3, 0xec, 0xbd, 0x00, 0x03, 0x14, 0x00, 0x1b, 0xd2, 0x5f, 0x13, 0xf7, 
+	0x1e, 0x3f, 0xdc, 0x01, 0xdf, 0xb0, 0x11, 0xfb, 0xe8, 0x00, 0x03, 0x1e, 0x43, 0x00, 0xa8, 0xff, 
+	0x02, 0x62, 0xd4, 0x00, 0x2f, 0x90, 0x03, 0x01, 0x00, 0xb0, 0x12, 0x43, 0xe5, 0x07, 0x20, 0xc2, 
+	0xa0, 0xe1, 0x00, 0x07, 0xbf, 0x11, 0x9b, 0x3e, 0x8b, 0xdf, 0x08, 0xa3, 0x00, 0x0b, 0x04, 0x12, 
+	0x67, 0x00, 0xbf, 0x10, 0x07, 0x19, 0x97, 0x19, 0x7b, 0x9f, 0x12, 0x4b, 0x18, 0xc2, 0x08, 0x93, 
+	0x80, 0x03, 0x53, 0x27, 0x15, 0x33, 0x00, 0x37, 0x5d, 0x11, 0x02, 0x87, 0x15, 0x10, 0x37, 0x10, 
+	0xef, 0x00, 0x3b, 0x15, 0x10, 0x1f, 0xd5, 0x10, 0x37, 0x10, 0x3f, 0x54, 0x00, 0x2f, 0x84, 0x00, 
+	0x03, 0xb4, 0x00, 0x03, 0x76, 0xc4, 0x40, 0x3b, 0x15, 0x27, 0x04, 0x3f, 0xe2, 0x12, 0xd3, 0x0e, 
+	0x33, 0x1a, 0x01, 0x0f, 0x28, 0xc2, 0xe3, 0x00, 0x08, 0x82, 0x22, 0x4b, 0x96, 0x10, 0x1f, 0x0f, 
+	0x26, 0x00, 0x0f, 0x0a, 0x70, 0x0f, 0xe0, 0x2f, 0x24, 0xab, 0x00, 0x1f, 0x0c, 0x80, 0x2f, 0x22, 
+	0x00, 0x0f, 0x0e, 0x70, 0x0f, 0x10, 0x27, 0xb8, 0x01, 0xf7, 0x02, 0x01, 0xeb, 0x25, 0x3b, 0x10, 
+	0x0f, 0x00, 0xf0, 0x1f, 0xa0, 0x60, 0x97, 0xe8, 0x00, 0x87, 0x30, 0xc3, 0x00, 0x08, 0x3c, 0xb6, 
+	0x00, 0x03, 0x48, 0x00, 0x03, 0x50, 0x23, 0x88, 0x01, 0x93, 0x17, 0x6b, 0x00, 0xfa, 0x0f, 0xef, 
+	0x19, 0x43, 0x12, 0x27, 0x11, 0x17, 0x1a, 0xb7, 0xa0, 0x27, 0x93, 0x0c, 0x05, 0xe2, 0x80, 0x01, 
+	0x81, 0xe1, 0x10, 0x13, 0x64, 0x1f, 0xf7, 0xd7, 0x11, 0xeb, 0x00, 0x17, 0x04, 0x00, 0x17, 0x00, 
+	0x00, 0x17, 0x01, 0xd3, 0x23, 0xa7, 0x6f, 0x50, 0x45, 0xb3, 0x10, 0x0b, 0x48, 0x40, 0x0b, 0x10, 
+	0xbf, 0x27, 0xab, 0x40, 0xc3, 0xa1, 0x12, 0x4b, 0x02, 0x02, 0xb3, 0x81, 0x01, 0x80, 0xe1, 0x13, 
+	0xcb, 0xaf, 0x12, 0x33, 0x04, 0x00, 0x0f, 0x01, 0x00, 0x0f, 0x13, 0xd7, 0x10, 0x33, 0x12, 0x07, 
+	0xf5, 0x15, 0xdf, 0x1a, 0xff, 0x1a, 0xe7, 0x52, 0x13, 0xa8, 0x00, 0xb3, 0xe8, 0x00, 0x03, 0xfc, 
+	0x93, 0xd7, 0x13, 0x7f, 0x52, 0xb7, 0x21, 0x33, 0x00, 0x6b, 0x13, 0x13, 0x00, 0x20, 0x3e, 0x8f, 
+	0xe2, 0x13, 0x0f, 0x50, 0x2b, 0xd4, 0x8f, 0x52, 0x6b, 0x98, 0x9f, 0x04, 0x13, 0xf0, 0x1f, 0xe5, 
+	0x10, 0x77, 0x28, 0xc4, 0x0a, 0x87, 0x80, 0x03, 0xbb, 0x15, 0xef, 0x0e, 0x01, 0x1b, 0x10, 0xff, 
+	0x12, 0x47, 0x0c, 0x00, 0x07, 0x10, 0x13, 0xcf, 0x10, 0xbf, 0x12, 0x0f, 0x20, 0x02, 0x30, 0x1b, 
+	0x10, 0xbf, 0x12, 0x0f, 0x01, 0x73, 0x77, 0xe5, 0x12, 0x03, 0x1b, 0xdf, 0x10, 0x77, 0x60, 0x00, 
+	0x43, 0x90, 0x03, 0x52, 0x47, 0xc6, 0x10, 0x33, 0x24, 0xe3, 0x00, 0x9d, 0xe8, 0x50, 0x43, 0x30, 
+	0x53, 0xbd, 0x03, 0xe8, 0xfe, 0xcc, 0x0c, 0xe2, 0xfe, 0x0d, 0xa3, 0x15, 0x67, 0x5d, 0x08, 0x32, 
+	0x5f, 0xe5, 0x52, 0x5b, 0x52, 0xa3, 0x90, 0x03, 0x08, 0x07, 0xeb, 0x6c, 0x50, 0x43, 0x53, 0x15, 
+	0x47, 0x41, 0x00, 0x3b, 0x00, 0x5b, 0x35, 0xe1, 0x07, 0x1c, 0x0c, 0xe2, 0x41, 0x0c, 0x37, 0xfb, 
+	0x10, 0x73, 0x1e, 0xd7, 0xf9, 0xd2, 0xf3, 0x10, 0xa7, 0x1c, 0x9f, 0x10, 0x47, 0xdb, 0x6f, 0x28, 
+	0x15, 0x34, 0x2b, 0x00, 0x28, 0x15, 0xca, 0xe5, 0x18, 0x00, 0x8f, 0xe2, 0x02, 0x54, 0x00, 0x0a, 
+	0xe5, 0x14, 0x05, 0x04, 0xb7, 0x08, 0x52, 0x10, 0x01, 0x77, 0xa0, 0x05, 0x02, 0xa0, 0x03, 0x52, 
+	0x7f, 0x7f, 0x08, 0x1e, 0xa0, 0xe3, 0x01, 0x04, 0xb3, 0x2c, 0x02, 0x31, 0x97, 0x1d, 0xc3, 0x11, 
+	0x0f, 0x07, 0xd3, 0x54, 0x48, 0x83, 0x12, 0x5b, 0x50, 0xf3, 0xb6, 0x1a, 0x17, 0xa0, 0x09, 0x4f, 
+	0x4f, 0x6f, 0x0a, 0x15, 0x17, 0x10, 0x17, 0x6c, 0xf7, 0x40, 0x93, 0x15, 0x03, 0x12, 0x67, 0x50, 
+	0x2f, 0x5c, 0x80, 0x17, 0x22, 0x6b, 0x0e, 0xdb, 0x8e, 0x02, 0x6b, 0xe5, 0x50, 0xc5, 0x03, 0x63, 
+	0x00, 0x03, 0xdc, 0xff, 0x9c, 0xff, 0x00, 0x13, 0x90, 0xc3, 0x11, 0xeb, 0x51, 0xef, 0x52, 0x4b, 
+	0x10, 0x03, 0x1b, 0x5b, 0x11, 0x4b, 0xef, 0x9d, 0x57, 0x18, 0x5b, 0xd1, 0x03, 0x04, 0x00, 0xc3, 
+	0x14, 0xbb, 0xf2, 0x6f, 0xf2, 0x6f, 0xe1, 0xf2, 0x6f, 0xf2, 0x6f, 0xd2, 0x6f, 0x80, 0xc6, 0x00, 
+	0x08, 0x90, 0x03, 0x9c, 0x15, 0x57, 0xac, 0x15, 0x0f, 0x07, 0x00, 0x57, 0x14, 0xa3, 0x01, 0x10, 
+	0x32, 0x81, 0x13, 0x18, 0x57, 0x10, 0x07, 0x00, 0xc0, 0x10, 0x67, 0x9c, 0x5e, 0xe7, 0x95, 0x2b, 
+	0x7c, 0x00, 0x33, 0xde, 0x1f, 0xd1, 0x13, 0x15, 0x4f, 0x9c, 0x09, 0x69, 0x00, 0x03, 0xc8, 0x00, 
+	0x03, 0x2c, 0x6a, 0xf0, 0xe3, 0xf3, 0x12, 0x3f, 0x10, 0xe3, 0x12, 0xd7, 0x12, 0x3f, 0x06, 0x0a, 
+	0x22, 0x7b, 0x22, 0x33, 0xa1, 0x52, 0x9b, 0x10, 0x41, 0x87, 0x40, 0x10, 0x00, 0xe2, 0x03, 0xcb, 
+	0x07, 0xe2, 0x21, 0x02, 0x80, 0xe1, 0x12, 0xeb, 0x12, 0x3f, 0x12, 0x3b, 0x5c, 0xb0, 0xc0, 0x03, 
+	0x04, 0x05, 0xe7, 0x51, 0x37, 0x10, 0x0f, 0x68, 0xc7, 0xbd, 0x31, 0x97, 0xcc, 0x40, 0x07, 0x51, 
+	0x4f, 0x01, 0x4b, 0x14, 0x2b, 0x01, 0xb1, 0x4b, 0x1b, 0xb2, 0xe7, 0xbc, 0x10, 0x27, 0x00, 0x03, 
+	0xc4, 0xc0, 0x03, 0x50, 0xfb, 0xe8, 0x1d, 0x5f, 0x1d, 0x47, 0xd0, 0xeb, 0x3f, 0x00, 0x9b, 0x20, 
+	0xf0, 0x92, 0x37, 0xe5, 0x40, 0x0c, 0x43, 0x10, 0x07, 0x00, 0x41, 0x6b, 0x11, 0xeb, 0x16, 0x2b, 
+	0x34, 0x1c, 0xc8, 0x02, 0x33, 0x00, 0x03, 0x44, 0x00, 0x03, 0x28, 0x05, 0x84, 0x17, 0x47, 0xc0, 
+	0xe3, 0x28, 0x05, 0x04, 0xff, 0x00, 0xe0, 0x35, 0xe3, 0x78, 0x00, 0xe3, 0x10, 0x23, 0x10, 0x80, 
+	0x23, 0x68, 0x44, 0xdf, 0xaf, 0x02, 0x93, 0x05, 0x01, 0xfb, 0xea, 0x10, 0x0b, 0x02, 0x93, 0x19, 
+	0x17, 0x65, 0x77, 0xde, 0x57, 0x13, 0x04, 0xf7, 0xe5, 0x15, 0x4b, 0x90, 0x17, 0x1f, 0x23, 0x30, 
+	0xeb, 0x10, 0x22, 0xe3, 0x2c, 0x00, 0x1f, 0xff, 0x00, 0x50, 0x23, 0xd7, 0x24, 0x82, 0x01, 0x1f, 
+	0x3f, 0x20, 0x0c, 0xe2, 0x10, 0x0e, 0x73, 0x2c, 0x1b, 0x03, 0xc1, 0x37, 0x10, 0x23, 0x11, 0x4b, 
+	0xe8, 0x00, 0xe3, 0x13, 0xeb, 0xea, 0x10, 0xe7, 0x15, 0x03, 0x12, 0x23, 0xa8, 0x06, 0xf7, 0xa8, 
+	0x00, 0x8b, 0xcc, 0xea, 0x80, 0x03, 0x50, 0x63, 0x19, 0xdb, 0xff, 0x05, 0x8b, 0x20, 0x0f, 0x0b, 
+	0x0b, 0xde, 0x03, 0x53, 0x1b, 0x3b, 0x07, 0x00, 0x07, 0x04, 0xab, 0x25, 0x83, 0x50, 0x1b, 0x0d, 
+	0xbd, 0x00, 0x13, 0x08, 0x10, 0x13, 0x00, 0x07, 0x03, 0xf7, 0x20, 0x1b, 0x24, 0x41, 0xbb, 0x0f, 
+	0x04, 0xc9, 0x00, 0x08, 0x90, 0x03, 0x54, 0xa3, 0x56, 0x0b, 0x00, 0x37, 0xfd, 0x21, 0xfb, 0x12, 
+	0x0b, 0x11, 0xf3, 0x10, 0x93, 0x10, 0xa3, 0x92, 0x43, 0x3c, 0x40, 0x37, 0x77, 0x20, 0x04, 0x63, 
+	0x11, 0x6f, 0x10, 0x1f, 0x60, 0x00, 0x13, 0x90, 0x03, 0x11, 0x63, 0xff, 0x17, 0x7b, 0x53, 0xdb, 
+	0x55, 0x33, 0x47, 0x43, 0x20, 0x33, 0x10, 0x93, 0x10, 0x5f, 0x11, 0x87, 0xd9, 0x90, 0x03, 0x11, 
+	0xab, 0x10, 0x01, 0xd3, 0x11, 0xab, 0x20, 0x00, 0x07, 0xcf, 0x8f, 0x01, 0x3f, 0x00, 0x00, 0x81, 
+	0x6a, 0xbf, 0x10, 0x77, 0x90, 0x53, 0x10, 0xb3, 0x48, 0xb0, 0x00, 0x73, 0x18, 0x51, 0x30, 0xe3, 
+	0x80, 0x30, 0x00, 0x02, 0x06, 0x10, 0xdf, 0x70, 0x47, 0x11, 0x00, 0x03, 0x12, 0xaa, 0x00, 0x03, 
+	0x13, 0x00, 0x03, 0x14, 0x00, 0x03, 0x15, 0x00, 0x03, 0x16, 0xa8, 0x00, 0x03, 0x17, 0x00, 0x03, 
+	0x18, 0x00, 0x03, 0x03, 0xb4, 0x71, 0x00, 0x46, 0x49, 0x08, 0x40, 0x00, 0x49, 0x00, 0x09, 0x00, 
+	0x5e, 0x49, 0x00, 0x8e, 0x44, 0x03, 0xbc, 0x70, 0x04, 0x47, 0x01, 0x20, 0x51, 0xe2, 0x19, 0xbb, 
+	0x36, 0x00, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x50, 0xe1, 0x22, 0x00, 0x24, 0x00, 0x9a, 0x0e, 0xe7, 
+	0xe1, 0x23, 0x04, 0xbf, 0x0e, 0x02, 0x08, 0x11, 0xe3, 0x81, 0x11, 0x05, 0xa7, 0x30, 0xa0, 0x03, 
+	0x01, 0x01, 0x30, 0xa0, 0x13, 0x01, 0x02, 0x51, 0x0a, 0xab, 0x00, 0x51, 0x31, 0x01, 0x12, 0xa0, 
+	0x31, 0x03, 0x32, 0x00, 0xa0, 0x31, 0xfa, 0xff, 0xff, 0x3a, 0x02, 0x01, 0x81, 0x30, 0x13, 0x81, 
+	0x10, 0xa0, 0x31, 0x83, 0x30, 0x30, 0x13, 0x30, 0x00, 0x20, 0x05, 0x2f, 0x00, 0x4b, 0x01, 0x00, 
+	0x40, 0x20, 0x05, 0x03, 0x20, 0x82, 0x21, 0xa1, 0x00, 0x0b, 0xa1, 0x00, 0x0b, 0x40, 0xa3, 0x00, 
+	0x0b, 0x21, 0x01, 0x50, 0xe1, 0x21, 0x01, 0x0d, 0x40, 0x20, 0x23, 0x21, 0x00, 0x17, 0x00, 0x0b, 
+	0xa1, 0x00, 0x0b, 0x50, 0xa3, 0x00, 0x0b, 0x00, 0x02, 0x3b, 0x23, 0x32, 0xb0, 0x11, 0x04, 0x21, 
+	0x12, 0xa0, 0x11, 0xef, 0x09, 0xcb, 0x02, 0x00, 0x7c, 0xa0, 0x1e, 0x77, 0x00, 0x43, 0x0e, 0x13, 
+	0x05, 0x8f, 0x20, 0x0b, 0x08, 0x51, 0x00, 0xe3, 0x21, 0x18, 0xa0, 0x21, 0x10, 0x20, 0xa0, 0x48, 
+	0x23, 0x00, 0x63, 0x33, 0x01, 0x05, 0xff, 0x21, 0x14, 0xa0, 0x03, 0x21, 0x08, 0x20, 0x82, 0x22, 
+	0x10, 0x01, 0xfb, 0x00, 0x3b, 0x2c, 0x21, 0x04, 0x00, 0x0b, 0x04, 0x00, 0x0b, 0x00, 0x77, 0x82, 
+	0xa1, 0x0d, 0x20, 0x82, 0x90, 0x30, 0x01, 0xd7, 0x10, 0x3b, 0x1f, 0x00, 0x03, 0xd0, 0x00, 0x47, 
+	0x00, 0x03, 0x50, 0x00, 0xaf, 0xe0, 0x13, 0x5c, 0x02, 0x22, 0x00, 0xea, 0x15, 0xa7, 0xf8, 0xff, 
+	0xff, 0x2a, 0xe3, 0xbc, 0xa0, 0x09, 0xeb, 0x06, 0x01, 0x5b, 0x92, 0x00, 0x03, 0xe0, 0x03, 0x1a, 
+	0x10, 0x41, 0xe0, 0x10, 0x33, 0x10, 0x1f, 0x43, 0x1a, 0x6f, 0xc0, 0x4a, 0x20, 0x0a, 0xb7, 0x61, 
+	0x42, 0x11, 0x2b, 0x27, 0x00, 0x0f, 0x00, 0x00, 0x30, 0xb0, 0xe1, 0x00, 0x30, 0x60, 0x42, 0x01, 
+	0x0a, 0x00, 0x53, 0xe1, 0x26, 0x41, 0x2f, 0x28, 0x91, 0x2f, 0x20, 0xa9, 0x01, 0x2f, 0x20, 0x31, 
+	0x2f, 0x03, 0x41, 0x2f, 0x02, 0x22, 0x71, 0x2f, 0xce, 0x10, 0x13, 0x11, 0x2f, 0x82, 0x20, 0x41, 
+	0x2f, 0x04, 0x9b, 0x10, 0x4b, 0x01, 0x02, 0x30, 0x43, 0x20, 0x02, 0x00, 0x80, 0x01, 0x2f, 0x53, 
+	0x28, 0xe1, 0xa1, 0x00, 0x0b, 0xa2, 0x00, 0x0b, 0x21, 0x01, 0x53, 0x01, 0xe1, 0x21, 0x31, 0x43, 
+	0x20, 0x22, 0x01, 0x00, 0x17, 0xa8, 0x00, 0x0b, 0xa1, 0x00, 0x0b, 0xa2, 0x00, 0x0b, 0x00, 0x00, 
+	0x53, 0x11, 0xe3, 0x22, 0x22, 0x71, 0x2f, 0x00, 0x00, 0x5c, 0x00, 0xd7, 0x2c, 0x60, 0x42, 0x30, 
+	0xb7, 0x3c, 0x00, 0x03, 0x50, 0x0b, 0xa0, 0x33, 0x23, 0xcc, 0x0f, 0x0c, 0xd3, 0x00, 0x80, 0x03, 
+	0xf1, 0x43, 0xf1, 0x43, 0x97, 0xf1, 0x43, 0x82, 0x90, 0x10, 0x5b, 0x33, 0x13, 0x1f, 0x40, 0x53, 
+	0x91, 0x4b, 0x00, 0x02, 0x01, 0xe0, 0xc3, 0x02, 0x01, 0xa0, 0xb3, 0x54, 0x08, 0x41, 0x4f, 0xf7, 
+	0x41, 0x4f, 0xb1, 0xf1, 0x4f, 0xe1, 0x70, 0x10, 0x47, 0xc0, 0x46, 0x10, 0xb7, 0x00, 0x00, 0x52, 
+	0x03, 0x62, 0x07, 0x03, 0xdb, 0x27, 0x27, 0x11, 0xa0, 0xb3, 0x00, 0x4b, 0xb3, 0xa1, 0x07, 0x2f, 
+	0xba, 0x00, 0x4f, 0x03, 0x02, 0x11, 0xe0, 0x07, 0x7b, 0x10, 0xe0, 0x13, 0x26, 0x00, 0x4f, 0x08, 
+	0xd0, 0x4d, 0xe2, 0x0e, 0x00, 0x60, 0x2d, 0xe9, 0x10, 0x27, 0x04, 0x0b, 0x00, 0x1f, 0x53, 0x80, 
+	0x1c, 0x93, 0xba, 0x10, 0x02, 0x00, 0xeb, 0x04, 0xe0, 0x00, 0x9d, 0xe5, 0x08, 0xd0, 0x8d, 0xe2, 
+	0x0c, 0x00, 0x20, 0xbd, 0xe8, 0x30, 0xe7, 0x70, 0xe2, 0x81, 0x10, 0xc1, 0x58, 0xe0, 0x50, 0x23, 
+	0x07, 0xc0, 0x23, 0x60, 0x1f, 0x20, 0x72, 0xe2, 0x19, 0x83, 0x30, 0xc3, 0x31, 0xdf, 0x40, 0x0b, 
+	0xfc, 0x01, 0xf0, 0x2b, 0xdf, 0x10, 0x2b, 0x90, 0x23, 0xf3, 0xd0, 0x23, 0x90, 0x47, 0x40, 0xd3, 
+	0x0d, 0x87, 0x20, 0xd3, 0x92, 0x10, 0xc7, 0x00, 0x10, 0x30, 0xc7, 0xf4, 0x01, 0x70, 0xc7, 0xe2, 
+	0xd9, 0xc0, 0x43, 0x10, 0x3b, 0x10, 0x01, 0x2b, 0x48, 0x2f, 0x1a, 0x05, 0x0d, 0xc7, 0x79, 0x20, 
+	0x08, 0x0b, 0x25, 0x8b, 0x01, 0x5f, 0x00, 0x07, 0xeb, 0x10, 0x01, 0x43, 0xa1, 0x10, 0x27, 0x1c, 
+	0x0e, 0xff, 0x01, 0x08, 0x50, 0xe3, 0x0d, 0xa3, 0x01, 0x21, 0x10, 0x10, 0x41, 0x22, 0x01, 0x0c, 
+	0x00, 0x0b, 0x6c, 0x04, 0x01, 0xb7, 0x00, 0x0b, 0x10, 0x01, 0x87, 0x04, 0xbf, 0x21, 0x04, 0xa1, 
+	0x00, 0x0b, 0x08, 0x06, 0x63, 0x00, 0x00, 0xd2, 0xe7, 0x01, 0xef, 0x81, 0x20, 0x9b, 0x04, 0x03, 
+	0x02, 0x02, 0x01, 0x01, 0x01, 0xfe, 0xc0, 0x0e, 0x64, 0x10, 0x01, 0x10, 0xb5, 0x08, 0x4c, 0x23, 
+	0x78, 0x00, 0x00, 0x2b, 0x09, 0xd1, 0x00, 0xf0, 0x07, 0xf9, 0x00, 0x06, 0x4b, 0x00, 0x2b, 0x02, 
+	0xd0, 0x05, 0x48, 0x00, 0x00, 0xe0, 0x00, 0xbf, 0x01, 0x23, 0x23, 0x70, 0x00, 0x10, 0xbc, 0x01, 
+	0xbc, 0x00, 0x47, 0xe4, 0x76, 0xc0, 0x0c, 0x6f, 0x00, 0x2b, 0x6c, 0xe8, 0x00, 0x08, 0x70, 0xb5, 
+	0x00, 0x0e, 0x4d, 0x0e, 0x4e, 0x76, 0x1b, 0xb6, 0x10, 0x00, 0x06, 0xd0, 0x00, 0x24, 0x08, 0xcd, 
+	0x01, 0x34, 0x00, 0x00, 0xf0, 0x1b, 0xf8, 0xa6, 0x42, 0xf9, 0xd1, 0x01, 0xf3, 0xf7, 0xe5, 0xf9, 
+	0x09, 0x4d, 0x09, 0xc0, 0x1b, 0x56, 0x0d, 0x20, 0x1b, 0x70, 0x20, 0x47, 0x68, 0x00, 0x47, 0x50, 
+	0x03, 0x6c, 0xa0, 0x00, 0x03, 0x18, 0x01, 0xff, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0x00, 0x46, 0x45, 
+	0x46, 0xde, 0x46, 0xe0, 0xb5, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x92, 0x46, 0x99, 0x46, 0x83, 0x00, 
+	0xb0, 0x8b, 0x42, 0x30, 0xd8, 0x2d, 0xd0, 0x49, 0x00, 0x46, 0x50, 0x46, 0x00, 0xf0, 0x9a, 0xfb, 
+	0x29, 0x00, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0xf0, 0x95, 0x00, 0xfb, 0x33, 0x1a, 0x98, 0x46, 
+	0x20, 0x3b, 0x9b, 0x00, 0x46, 0x35, 0xd4, 0x5a, 0x46, 0x53, 0x46, 0x93, 0x04, 0x40, 0x42, 0x46, 
+	0x1f, 0x00, 0x10, 0x07, 0x1e, 0x00, 0x00, 0xaf, 0x42, 0x3c, 0xd8, 0xaf, 0x42, 0x00, 0xd1, 0x00, 
+	0x7a, 0xe0, 0x5b, 0x46, 0xa4, 0x1b, 0xbd, 0x41, 0x00, 0x00, 0x2b, 0x00, 0xda, 0x77, 0xe0, 0x00, 
+	0x22, 0x00, 0x00, 0x23, 0x00, 0x92, 0x01, 0x93, 0x01, 0x23, 0x68, 0x5a, 0x00, 0x25, 0x10, 0x07, 
+	0x42, 0x00, 0x07, 0x00, 0x93, 0x2a, 0x04, 0xe0, 0x82, 0x42, 0xcf, 0xd9, 0x50, 0x1d, 0x0c, 0x9b, 
+	0x00, 0x00, 0x2b, 0x01, 0xd0, 0x1c, 0x60, 0x5d, 0x60, 0x00, 0x00, 0x98, 0x01, 0x99, 0x03, 0xb0, 
+	0x3c, 0xbc, 0x40, 0x90, 0x00, 0x85, 0xa2, 0x46, 0xab, 0x46, 0xf0, 0xbc, 0x00, 0x04, 0xbc, 0x10, 
+	0x47, 0x42, 0x46, 0x20, 0x23, 0x00, 0x9b, 0x1a, 0x52, 0x46, 0xda, 0x40, 0x41, 0x46, 0x00, 0x13, 
+	0x00, 0x4a, 0x46, 0x8a, 0x40, 0x17, 0x00, 0xa8, 0x00, 0x79, 0x43, 0x50, 0x79, 0xc2, 0x60, 0x49, 
+	0x43, 0x46, 0x00, 0x00, 0x2b, 0xd7, 0xd0, 0xfb, 0x07, 0x72, 0x08, 0x1a, 0x00, 0x43, 0x46, 0x46, 
+	0x7b, 0x08, 0x0e, 0xe0, 0xab, 0x00, 0x42, 0x01, 0xd1, 0xa2, 0x42, 0x0c, 0xd8, 0xa4, 0x00, 0x1a, 
+	0x9d, 0x41, 0x01, 0x20, 0x24, 0x19, 0x6d, 0x00, 0x41, 0x00, 0x21, 0x01, 0x3e, 0x24, 0x18, 0x4d, 
+	0x00, 0x41, 0x00, 0x2e, 0x06, 0xd0, 0xab, 0x42, 0xee, 0x60, 0xd9, 0x00, 0x0d, 0x10, 0x15, 0x2e, 
+	0xf8, 0xd1, 0x5b, 0x46, 0x88, 0x10, 0x7f, 0x00, 0x19, 0x69, 0x00, 0xbd, 0x24, 0xdb, 0x2b, 0x00, 
+	0x00, 0x5a, 0x46, 0x44, 0x46, 0xd3, 0x40, 0x2a, 0x00, 0x00, 0xe2, 0x40, 0x1c, 0x00, 0x5b, 0x46, 
+	0x15, 0x00, 0x00, 0x00, 0x2b, 0x2a, 0xdb, 0x26, 0x00, 0x9e, 0x00, 0x40, 0x33, 0x00, 0x26, 0x00, 
+	0x47, 0x46, 0xbe, 0x00, 0x40, 0x32, 0x00, 0x80, 0x1a, 0x99, 0x41, 0x00, 0x00, 0x90, 0x01, 0x91, 
+	0x9d, 0xe7, 0xa3, 0x42, 0xbc, 0x10, 0xd8, 0x81, 0xe7, 0x10, 0xa9, 0x00, 0x21, 0x9b, 0x1a, 0x80, 
+	0x00, 0x8f, 0x91, 0x01, 0x92, 0x01, 0x22, 0xda, 0x40, 0x10, 0x01, 0x92, 0x84, 0x20, 0x15, 0x9b, 
+	0x1a, 0x2a, 0x00, 0x00, 0x46, 0x46, 0x9a, 0x40, 0x23, 0x00, 0xf3, 0x40, 0x08, 0x44, 0x46, 0x13, 
+	0x43, 0x90, 0x55, 0xd4, 0xda, 0x42, 0x00, 0x46, 0x2f, 0x00, 0x20, 0x23, 0x26, 0x00, 0x97, 0x00, 
+	0x40, 0x9b, 0x1a, 0xde, 0x40, 0x3b, 0x00, 0x33, 0x00, 0x43, 0xcd, 0xe7, 0xc0, 0x46, 0x06, 0x48, 
+	0x07, 0x01, 0x4b, 0x10, 0xb5, 0x83, 0x42, 0x04, 0xd0, 0x12, 0x17, 0x02, 0x01, 0xd0, 0x00, 0xf0, 
+	0x0a, 0xf8, 0x32, 0x11, 0xc0, 0x74, 0x46, 0x51, 0xc7, 0x12, 0x17, 0x11, 0xc7, 0x06, 0x00, 0x29, 
+	0x00, 0x2b, 0x04, 0x03, 0xd0, 0x05, 0x49, 0x06, 0x22, 0x3d, 0x00, 0xf0, 0x33, 0x70, 0xf9, 0x50, 
+	0x2b, 0x10, 0x23, 0x54, 0x7c, 0x01, 0xf3, 0x32, 0x3f, 0x00, 0x06, 0x34, 0x0e, 0x83, 0x07, 0x0f, 
+	0xd0, 0x53, 0x00, 0x1e, 0x00, 0x2a, 0x11, 0xd0, 0x03, 0x25, 0x04, 0x00, 0xe0, 0x01, 0x30, 0x28, 
+	0x42, 0x08, 0xd0, 0x01, 0x00, 0x3b, 0x0a, 0xd3, 0x02, 0x78, 0xa2, 0x42, 0xf7, 0x80, 0x02, 0x2d, 
+	0x02, 0xbc, 0x08, 0x47, 0x13, 0x00, 0x03, 0x10, 0x2b, 0x0c, 0xd8, 0x00, 0x77, 0xd1, 0x00, 0x20, 
+	0xf5, 0x08, 0xe7, 0xc3, 0x18, 0x02, 0x00, 0x27, 0x83, 0x42, 0xf8, 0x40, 0xd0, 0x10, 0x23, 0xf9, 
+	0xd1, 0xec, 0xe7, 0xff, 0x22, 0x00, 0x36, 0x0c, 0x11, 0x40, 0x0e, 0x43, 0x31, 0x04, 0x00, 0x06, 
+	0x4d, 0x0e, 0x43, 0x02, 0x68, 0x06, 0x49, 0x00, 0x72, 0x40, 0x51, 0x18, 0x91, 0x43, 0x29, 0x42, 
+	0x00, 0xe8, 0xd1, 0x04, 0x3b, 0x04, 0x30, 0x03, 0x2b, 0x00, 0xf4, 0xd8, 0xdf, 0xe7, 0x80, 0x80, 
+	0x80, 0x80, 0x00, 0xff, 0xfe, 0xfe, 0xfe, 0x30, 0xb5, 0x03, 0x2a, 0x00, 0x0c, 0xd9, 0x03, 0x00, 
+	0x0b, 0x43, 0x9b, 0x07, 0x00, 0x1b, 0xd1, 0x03, 0x68, 0x0c, 0x68, 0xa3, 0x42, 0x00, 0x17, 0xd1, 
+	0x04, 0x3a, 0x04, 0x30, 0x04, 0x31, 0x04, 0x03, 0x2a, 0xf6, 0xd8, 0x55, 0x00, 0x8d, 0x0b, 0xd0, 
+	0x00, 0x00, 0x23, 0x03, 0xe0, 0x5a, 0x1c, 0x9d, 0x42, 0x00, 0x06, 0xd0, 0x13, 0x00, 0xc2, 0x5c, 
+	0xcc, 0x5c, 0x89, 0x00, 0x8d, 0xd0, 0x10, 0x1b, 0x00, 0xcf, 0x20, 0x30, 0x20, 0x93, 0x10, 0x55, 
+	0x1e, 0xed, 0x01, 0x17, 0xf0, 0xb5, 0xc6, 0x46, 0x00, 0x00, 0xb5, 0x0f, 0x2a, 0x43, 0xd9, 0x03, 
+	0x27, 0x01, 0x0d, 0x00, 0x3e, 0x00, 0x05, 0x43, 0x0c, 0x01, 0x08, 0x00, 0x2e, 0x40, 0x2f, 0x42, 
+	0x3f, 0xd1, 0x15, 0x00, 0x00, 0x10, 0x3d, 0x2d, 0x09, 0xac, 0x46, 0x2d, 0x01, 0x00, 0xa8, 0x46, 
+	0x80, 0x44, 0x25, 0x68, 0x67, 0x68, 0x00, 0x1d, 0x60, 0x5f, 0x60, 0xa5, 0x68, 0xe7, 0x68, 0x00, 
+	0x9d, 0x60, 0xdf, 0x60, 0x10, 0x34, 0x1f, 0x00, 0x00, 0x10, 0x33, 0x47, 0x45, 0xf2, 0xd1, 0x65, 
+	0x46, 0x00, 0x0f, 0x23, 0x0c, 0x24, 0x01, 0x35, 0x2d, 0x01, 0x00, 0x49, 0x19, 0x13, 0x40, 0x45, 
+	0x19, 0x14, 0x42, 0x00, 0x24, 0xd0, 0x8c, 0x59, 0xac, 0x51, 0x04, 0x36, 0x00, 0x9c, 0x1b, 0x03, 
+	0x2c, 0xf9, 0xd8, 0x03, 0x24, 0x00, 0x04, 0x3b, 0x9b, 0x08, 0x01, 0x33, 0x9b, 0x00, 0x01, 0x22, 
+	0x40, 0xed, 0x18, 0xc9, 0x18, 0x56, 0x00, 0x9f, 0x80, 0x03, 0x55, 0x23, 0xcc, 0x5c, 0x1a, 0x00, 
+	0xec, 0x54, 0x15, 0x01, 0x33, 0x96, 0x01, 0x03, 0x04, 0x02, 0xa7, 0xf0, 0x20, 0x97, 0x21, 0x05, 
+	0x00, 0x10, 0x1f, 0xef, 0xd1, 0xf5, 0xe7, 0x10, 0x09, 0x04, 0xeb, 0xe7, 0x1a, 0x00, 0xf6, 0x20, 
+	0xa7, 0x88, 0x42, 0x00, 0x0c, 0xd9, 0x8b, 0x18, 0x98, 0x42, 0x09, 0xd2, 0x80, 0x11, 0x6d, 0x03, 
+	0xd0, 0xca, 0x5c, 0xc2, 0x54, 0x01, 0x10, 0x3b, 0xfb, 0xd2, 0x30, 0x35, 0x0f, 0x2a, 0x0b, 0xd8, 
+	0xa5, 0x30, 0x39, 0xf6, 0xc0, 0x59, 0xee, 0xe7, 0xd0, 0xd9, 0x2b, 0x80, 0xd9, 0x00, 0x2d, 0x18, 
+	0x27, 0x68, 0x1f, 0x60, 0x67, 0x68, 0x00, 0x5f, 0x60, 0xa7, 0x68, 0x9f, 0x60, 0xe7, 0x68, 0x09, 
+	0x10, 0x34, 0xdf, 0x60, 0x10, 0xd7, 0xaf, 0x42, 0xf0, 0xd7, 0x1c, 0x14, 0x42, 0x11, 0xf0, 0xd7, 
+	0x20, 0xd7, 0x10, 0xd5, 0x22, 0x40, 0x50, 0xbf, 0x20, 0xb1, 0xbf, 0x00, 0xb1, 0xba, 0xe7, 0xf0, 
+	0xb5, 0x01, 0x05, 0x00, 0x83, 0x07, 0x4e, 0xd0, 0x54, 0x00, 0x91, 0x00, 0x46, 0xd0, 0x0a, 0x06, 
+	0x03, 0x00, 0x03, 0x26, 0x20, 0x12, 0x0e, 0x01, 0xf7, 0x35, 0x01, 0x3c, 0x3e, 0xd3, 0x00, 0x01, 
+	0x33, 0x2a, 0x70, 0x33, 0x42, 0xf8, 0xd1, 0x00, 0x03, 0x2c, 0x2f, 0xd9, 0xff, 0x22, 0x0a, 0x40, 
+	0x00, 0x15, 0x02, 0x15, 0x43, 0x2a, 0x04, 0x15, 0x43, 0x00, 0x0f, 0x2c, 0x38, 0xd9, 0x27, 0x00, 
+	0x10, 0x3f, 0x01, 0x3f, 0x09, 0x3e, 0x01, 0xb4, 0x46, 0x1e, 0x05, 0x72, 0x00, 0x10, 0x36, 0x66, 
+	0x44, 0x15, 0x60, 0x55, 0x60, 0x01, 0x95, 0x60, 0xd5, 0x60, 0x10, 0x32, 0xb2, 0x00, 0x33, 0x00, 
+	0x0f, 0x26, 0x0c, 0x22, 0x01, 0x37, 0x3f, 0x01, 0x00, 0x26, 0x40, 0xdb, 0x19, 0x37, 0x00, 0x22, 
+	0x42, 0x00, 0x1a, 0xd0, 0x3e, 0x1f, 0xb6, 0x08, 0xb4, 0x00, 0x00, 0xa4, 0x46, 0x1a, 0x00, 0x1c, 
+	0x1d, 0x64, 0x44, 0x00, 0x20, 0xc2, 0xa2, 0x42, 0xfc, 0xd1, 0x03, 0x24, 0x00, 0x01, 0x36, 0xb6, 
+	0x00, 0x9b, 0x19, 0x3c, 0x40, 0x00, 0x00, 0x2c, 0x06, 0xd0, 0x09, 0x06, 0x1c, 0x19, 0x00, 0x09, 
+	0x0e, 0x19, 0x70, 0x01, 0x33, 0x9c, 0x42, 0x20, 0xfb, 0xd1, 0x31, 0x31, 0x34, 0x00, 0xf1, 0xe7, 
+	0x14, 0x80, 0x01, 0x11, 0xbc, 0xe7, 0x27, 0x00, 0xdd, 0xe7, 0x08, 0x00, 0x48, 0x09, 0x49, 0x09, 
+	0x1a, 0x8b, 0x10, 0xc9, 0x01, 0x0f, 0xc9, 0x18, 0x10, 0xb5, 0x49, 0x10, 0xf3, 0x27, 0x80, 0xf3, 
+	0x27, 0x0b, 0x48, 0x0c, 0x4a, 0x0c, 0x4b, 0x12, 0x00, 0x1a, 0x10, 0xb5, 0x9a, 0x63, 0x80, 0x22, 
+	0x0b, 0x00, 0x49, 0xd8, 0x60, 0x19, 0x63, 0x12, 0x05, 0x91, 0x00, 0x42, 0x04, 0xd2, 0x5a, 0x6b, 
+	0x00, 0x2a, 0x01, 0x00, 0xd0, 0x07, 0x4a, 0x1a, 0x63, 0xf4, 0xf7, 0x1c, 0x0c, 0xfd, 0x00, 0x20, 
+	0x10, 0x20, 0x71, 0x06, 0xc0, 0x02, 0x8c, 0x08, 0xb9, 0x03, 0x02, 0x3c, 0x00, 0x07, 0x78, 0x46, 
+	0x01, 0x48, 0x08, 0x00, 0x03, 0x0e, 0x70, 0x05, 0x29, 0x83, 0x07, 0x17, 0x00, 0xd1, 0x02, 0x68, 
+	0x10, 0x4b, 0xd3, 0x18, 0x93, 0x00, 0x43, 0x0f, 0x4a, 0x15, 0x00, 0x13, 0x42, 0x0f, 0x08, 0xd1, 
+	0x42, 0x68, 0x0c, 0x20, 0x0f, 0x04, 0x30, 0x2b, 0x28, 0x42, 0x08, 0x00, 0x0d, 0x08, 0x60, 0x0d, 
+	0xf1, 0xd0, 0x00, 0xa8, 0x03, 0x3d, 0x03, 0x05, 0xe7, 0xfb, 0x05, 0xe7, 0x09, 0xf8, 0x20, 0x4c, 
+	0x00, 0x33, 0x63, 0xc0, 0x46, 0x13, 0x1b, 0x13, 0x23, 0x03, 0x00, 0x04, 0x0a, 0x78, 0x01, 0x31, 
+	0x1a, 0x00, 0xed, 0x00, 0x2a, 0xa2, 0x05, 0xaf, 0x47, 0x03, 0xf7, 0x07, 0x0c, 0xd0, 0x01, 0x81, 
+	0x21, 0x80, 0x01, 0x7f, 0x33, 0x0b, 0x42, 0x07, 0xd0, 0x1a, 0x78, 0x90, 0x10, 0x19, 0x18, 0x1a, 
+	0x30, 0x97, 0x03, 0x00, 0x19, 0x68, 0x00, 0x0c, 0x4a, 0x0d, 0x4c, 0x8a, 0x18, 0x8a, 0x43, 0x42, 
+	0x22, 0x00, 0x7b, 0x59, 0x68, 0x09, 0x4a, 0x10, 0x0b, 0x04, 0x23, 0x33, 0x22, 0x00, 0x7b, 0x59, 
+	0x68, 0x05, 0x60, 0x0d, 0x20, 0x7b, 0x42, 0x33, 0x10, 0x3d, 0xfb, 0xd1, 0xdf, 0xe7, 0x50, 0x6f, 
+	0x78, 0x80, 0x00, 0x7b, 0x7b, 0xee, 0xff, 0xea, 0x00, 0xc0, 0x9f, 0x21, 0xe5, 0x1c, 0x06, 0x97, 
+	0x7d, 0xcc, 0x00, 0x08, 0x10, 0x13, 0x08, 0x93, 0xf0, 0xff, 0xea, 0x10, 0x07, 0x26, 0xe5, 0xff, 
+	0x42, 0xea, 0x1b, 0x5b, 0xf8, 0x6c, 0x00, 0x03, 0x10, 0x0f, 0x43, 0x52, 0xe4, 0x30, 0x17, 0x62, 
+	0x40, 0x17, 0xa0, 0x66, 0x30, 0x17, 0xd5, 0xfb, 0x00, 0x17, 0x10, 0x0f, 0x1a, 0xf7, 0x10, 0x0f, 
+	0x10, 0x0b, 0x24, 0x0b, 0x07, 0x50, 0x0b, 0x69, 0x6c, 0x1e, 0xd7, 0x00, 0x07, 0xc0, 0x40, 0x13, 
+	0x12, 0xe7, 0x30, 0x47, 0x52, 0x96, 0x40, 0x4f, 0xf1, 0x40, 0x07, 0x96, 0xe3, 0x70, 0x8b, 0x81, 
+	0x6e, 0xce, 0x0c, 0x1b, 0x00, 0x33, 0x54, 0x0b, 0x9f, 0x20, 0x43, 0x40, 0x5b, 0x13, 0x89, 0x50, 
+	0x93, 0x38, 0x00, 0x06, 0x10, 0x0f, 0xa7, 0xe2, 0x30, 0x3b, 0x6d, 0xb8, 0x00, 0x43, 0xd0, 0xc7, 
+	0x80, 0x00, 0xdb, 0x10, 0x2b, 0xd4, 0x40, 0x2b, 0x92, 0x10, 0x0b, 0x88, 0x39, 0x30, 0x0b, 0xb8, 
+	0xfd, 0x30, 0x1b, 0x2c, 0x77, 0x67, 0x30, 0x5f, 0x1c, 0x53, 0x10, 0x17, 0xf0, 0x40, 0x17, 0x1d, 
+	0x1b, 0x10, 0x0f, 0x5d, 0x56, 0x40, 0x9b, 0x60, 0x00, 0x17, 0x20, 0x0f, 0x40, 0x1f, 0x8c, 0x40, 
+	0x53, 0x69, 0x9d, 0x00, 0x63, 0x10, 0x07, 0xe7, 0x40, 0x87, 0xfa, 0xe6, 0x30, 0x07, 0x2a, 0xf0, 
+	0xef, 0x30, 0x07, 0xeb, 0x40, 0x37, 0x09, 0x40, 0x37, 0x14, 0x55, 0x68, 0x30, 0x57, 0x9c, 0x40, 
+	0xc7, 0xac, 0x40, 0x7f, 0x6c, 0x00, 0x4f, 0xa9, 0x10, 0x07, 0x18, 0x41, 0x6b, 0x9e, 0x40, 0xbb, 
+	0x88, 0x44, 0x71, 0x47, 0x59, 0x20, 0x40, 0xa3, 0x47, 0x01, 0x9f, 0x10, 0x0f, 0x08, 0x4b, 0x70, 
+	0x1b, 0xf6, 0x11, 0x5b, 0x58, 0x4f, 0xf0, 0x01, 0x48, 0x67, 0xc0, 0x0b, 0x26, 0x07, 0xc3, 0x01, 
+	0x10, 0xa0, 0x01, 0x60, 0x08, 0x7c, 0x40, 0x80, 0x30, 0x03, 0x00, 0x77, 0x77, 0x77, 0x14, 0x11, 
+	0x61, 0x0d, 0x11, 0x00, 0x11, 0x00, 0x50, 0x00, 0x0f, 0x10, 0x03, 0x10, 0x04, 0x00, 0x03, 0x82, 
+	0xa0, 0x2b, 0x0b, 0x3f, 0x70, 0x27, 0x00, 0x00, 0x17, 0x15, 0xb7, 0x00, 0x1f, 0x13, 0xe0, 0x00, 
+	0x1f, 0x20, 0x3f, 0x11, 0x00, 0x3f, 0xf0, 0x66, 0x00, 0xb0, 0x01, 0x4d, 0x50, 0x00, 0x3f, 0x40, 
+	0x14, 0x00, 0x00, 0x3f, 0x20, 0x2a, 0x88, 0x00, 0x7c, 0x40, 0x84, 0x00, 0xaf, 0x23, 0x00, 0x70, 
+	0x37, 0x00, 0x47, 0x66, 0x13, 0x00, 0x00, 0x50, 0x35, 0x01, 0x00, 0x55, 0x80, 0x50, 0x00, 0x5e, 
+	0x88, 0x18, 0x00, 0x80, 0x11, 0x88, 0x01, 0x00, 0x00, 0x88, 0x01, 0x81, 0x18, 0x77, 0x01, 0x70, 
+	0x00, 0x17, 0x00, 0x66, 0x01, 0x60, 0x16, 0x51, 0x15, 0x00, 0x50, 0x14, 0x30, 0x10, 0x55, 0x00, 
+	0x24, 0x10, 0x14, 0x6a, 0x60, 0x18, 0x09, 0x93, 0x86, 0x0d, 0x1d, 0x00, 0x03, 0x80, 0x00, 0x1c, 
+	0x0f, 0x16, 0xe0, 0x30, 0x5f, 0x10, 0x03, 0x00, 0x00, 0x5f, 0x80, 0x88, 0x68, 0x00, 0x48, 0x10, 
+	0x00, 0x11, 0x84, 0x16, 0x00, 0x09, 0x16, 0x00, 0x40, 0x00, 0x47, 0x01, 0x12, 0x40, 0x46, 0x12, 
+	0x01, 0x54, 0x00, 0x13, 0x00, 0x5f, 0x10, 0x55, 0x55, 0x15, 0x10, 0x00, 0xab, 0x80, 0x88, 0x88, 
+	0x16, 0x08, 0x10, 0x21, 0x02, 0x68, 0x01, 0x20, 0x3f, 0x77, 0x77, 0x00, 0x70, 0x10, 0x00, 0x62, 
+	0x12, 0x35, 0x00, 0x53, 0x14, 0x01, 0x51, 0x08, 0x55, 0x45, 0x12, 0x10, 0x00, 0xba, 0x81, 0x60, 
+	0x88, 0x20, 0x00, 0x1b, 0x0f, 0x96, 0x88, 0x01, 0x70, 0x13, 0x02, 0x00, 0x77, 0x01, 0x36, 0x01, 
+	0x66, 0x01, 0x30, 0x3b, 0x00, 0x55, 0x80, 0x00, 0x7c, 0x11, 0x01, 0x86, 0x88, 0x00, 0x88, 0x01, 
+	0x86, 0xa0, 0x00, 0x27, 0x88, 0x00, 0x00, 0x67, 0x47, 0x12, 0x73, 0x14, 0x11, 0x88, 0x00, 0x00, 
+	0x9f, 0x35, 0x00, 0x50, 0x70, 0x3f, 0x86, 0x88, 0x00, 0x01, 0x10, 0x80, 0x48, 0x11, 0x00, 0x06, 
+	0x68, 0x00, 0x00, 0x77, 0x13, 0x00, 0x72, 0x14, 0x46, 0x01, 0x00, 0x40, 0x16, 0x54, 0x03, 0x02, 
+	0x50, 0x14, 0x41, 0x00, 0x55, 0x45, 0x11, 0x10, 0x1f, 0x88, 0x02, 0x88, 0x00, 0x88, 0x18, 0x11, 
+	0x11, 0x82, 0x00, 0x7c, 0x88, 0x00, 0x1d, 0x14, 0x00, 0x40, 0x00, 0xff, 0x11, 0x63, 0x00, 0x80, 
+	0xbf, 0x60, 0x00, 0x37, 0x00, 0x86, 0x14, 0x04, 0x82, 0x06, 0x86, 0x02, 0x80, 0x00, 0xa5, 0x77, 
+	0x47, 0x00, 0x11, 0x66, 0x12, 0x61, 0x06, 0x01, 0x55, 0x03, 0x00, 0x50, 0x15, 0x51, 0x55, 0x55, 
+	0x20, 0x3f, 0x80, 0x00, 0x50, 0x1f, 0x68, 0x01, 0x60, 0x18, 0x74, 0x13, 0x00, 0x70, 0x00, 0x17, 
+	0x40, 0x66, 0x66, 0x14, 0x00, 0x00, 0x31, 0x55, 0x07, 0x13, 0x50, 0x55, 0x24, 0x01, 0x00, 0x00, 
+	0x1f, 0x31, 0x6f, 0x10, 0xdb, 0xfe, 0x11, 0x01, 0x17, 0x11, 0x6f, 0x10, 0x07, 0x71, 0x7b, 0x05, 
+	0x1c, 0x40, 0x9f, 0x0e, 0xab, 0x38, 0x16, 0x66, 0x11, 0x4f, 0xc1, 0x10, 0xf0, 0x21, 0x9e, 0x0c, 
+	0x5d, 0x30, 0x48, 0x01, 0x10, 0x00, 0x9e, 0x11, 0x9e, 0x10, 0x66, 0x02, 0x00, 0x17, 0x02, 0x00, 
+	0x51, 0x25, 0x00, 0x3f, 0x55, 0x07, 0xa4, 0x2f, 0x00, 0x00, 0xc7, 0x59, 0x16, 0x11, 0x4f, 0x66, 
+	0x00, 0x00, 0x7f, 0x92, 0x03, 0x80, 0x28, 0x00, 0x2a, 0x90, 0x00, 0x00, 0x42, 0x00, 0x81, 0x10, 
+	0x08, 0x77, 0x02, 0x00, 0x00, 0x60, 0x69, 0x36, 0x21, 0xdc, 0x11, 0xe3, 0x00, 0x20, 0x10, 0x25, 
+	0x88, 0x88, 0x00, 0x5e, 0x08, 0x00, 0x81, 0x08, 0x80, 0x18, 0x00, 0xa4, 0x11, 0x77, 0x08, 0x13, 
+	0xae, 0x20, 0x1f, 0x04, 0xe0, 0x50, 0x00, 0x63, 0x00, 0x10, 0x07, 0x10, 0x01, 0x18, 0x20, 0x80, 
+	0x01, 0x00, 0x01, 0xa7, 0x18, 0x10, 0x17, 0x71, 0x11, 0x04, 0x00, 0x00, 0x16, 0x60, 0x01, 0x50, 
+	0x01, 0x7f, 0x10, 0x00, 0x15, 0x00, 0x51, 0x11, 0x00, 0x11, 0x10, 0x01, 0x00, 0x40, 0x88, 0x00, 
+	0x48, 0x01, 0x80, 0x46, 0x86, 0x00, 0x01, 0x80, 0x14, 0x01, 0x84, 0x02, 0x74, 0x02, 0x00, 0x72, 
+	0x14, 0x64, 0x00, 0x7f, 0x00, 0x55, 0x11, 0x00, 0x51, 0x15, 0x45, 0x01, 0x40, 0x15, 0x6e, 0x11, 
+	0x00, 0x01, 0x01, 0x11, 0x97, 0x88, 0x01, 0xff, 0x10, 0x00, 0xe5, 0x02, 0x9f, 0x12, 0x00, 0x66, 
+	0x11, 0x61, 0x00, 0x16, 0x55, 0x01, 0x52, 0x14, 0x70, 0x55, 0x01, 0x00, 0x9f, 0x00, 0xa6, 0x00, 
+	0x3f, 0x88, 0x02, 0x84, 0x00, 0x28, 0x0e, 0x41, 0x28, 0x88, 0x12, 0x00, 0x9d, 0x00, 0x00, 0x79, 
+	0x10, 0xde, 0x53, 0x01, 0x15, 0x30, 0x00, 0x25, 0x31, 0x55, 0x55, 0x13, 0x31, 0x9f, 0x02, 0x00, 
+	0x46, 0x00, 0x88, 0x21, 0x88, 0x04, 0x92, 0x7f, 0x00, 0x55, 0x01, 0x21, 0x55, 0x13, 0x55, 0x55, 
+	0x34, 0x00, 0x01, 0x10, 0xe6, 0xb8, 0x11, 0xbf, 0x88, 0x00, 0x00, 0x08, 0x02, 0x21, 0x02, 0x3e, 
+	0x47, 0x01, 0x66, 0x00, 0xb7, 0x00, 0x33, 0x55, 0x00, 0x0b, 0x02, 0x23, 0x00, 0x05, 0x11, 0x07, 
+	0xf0, 0x1f, 0x40, 0x1f, 0xe0, 0x00, 0x10, 0xe5, 0x00, 0x03, 0xb0, 0x7f, 0x77, 0x17, 0x00, 0x66, 
+	0x02, 0x61, 0x07, 0x16, 0x53, 0x15, 0x50, 0x00, 0x15, 0x60, 0x7f, 0x21, 0x9d, 0x30, 0x03, 0xa0, 
+	0x00, 0x00, 0xbf, 0x17, 0x30, 0xbf, 0x50, 0x15, 0x55, 0x00, 0x01, 0x40, 0xfc, 0x02, 0x6b, 0x12, 
+	0xe0, 0x42, 0x00, 0xfb, 0xd2, 0xff, 0x61, 0xe3, 0x03, 0x40, 0x00, 0x00, 0x84, 0xcc, 0x60, 0x20, 
+	0x20, 0xbf, 0x04, 0x54, 0x00, 0x12, 0x9f, 0x32, 0x7f, 0x01, 0x80, 0x81, 0x00, 0x00, 0xdb, 0x68, 
+	0x01, 0x88, 0x81, 0x16, 0x00, 0x00, 0x48, 0x9e, 0x02, 0x84, 0x61, 0x24, 0x00, 0xc0, 0x45, 0x07, 
+	0x02, 0x00, 0x44, 0x01, 0x51, 0x24, 0x21, 0x3f, 0x33, 0x01, 0x00, 0x20, 0x03, 0xf0, 0x21, 0x1f, 
+	0x40, 0xbb, 0x00, 0x00, 0xdf, 0x21, 0xe7, 0x48, 0x01, 0x40, 0x18, 0x00, 0x02, 0x88, 0x14, 0x84, 
+	0x18, 0x88, 0x68, 0x02, 0xa0, 0x77, 0x00, 0x74, 0x74, 0x17, 0x46, 0x62, 0x42, 0x16, 0x1c, 0x00, 
+	0x45, 0x11, 0x41, 0x11, 0x7f, 0x20, 0x9f, 0x01, 0x00, 0xdd, 0x18, 0x88, 0x95, 0x01, 0xdd, 0x88, 
+	0x86, 0x00, 0x00, 0xbf, 0x42, 0x10, 0xbf, 0x64, 0x00, 0xbf, 0x00, 0x40, 0x51, 0x40, 0xbf, 0x00, 
+	0x11, 0x62, 0x88, 0x00, 0x68, 0x02, 0x18, 0x86, 0x12, 0x82, 0x01, 0x9f, 0x00, 0x71, 0x5f, 0x54, 
+	0x12, 0x52, 0x30, 0x14, 0x42, 0x00, 0x43, 0x3f, 0x01, 0x3f, 0x04, 0x88, 0x11, 0x81, 0x00, 0xb0, 
+	0x50, 0xff, 0x13, 0xd1, 0x3f, 0xe0, 0x3f, 0x00, 0x51, 0x62, 0x14, 0x54, 0x01, 0x12, 0x55, 0x12, 
+	0x00, 0x42, 0x55, 0x24, 0x15, 0xf0, 0x3f, 0xa6, 0x10, 0x00, 0x3f, 0x64, 0x00, 0x3f, 0x51, 0x14, 
+	0x01, 0x43, 0x00, 0x20, 0x9f, 0x84, 0x88, 0x02, 0x7f, 0x88, 0x12, 0x00, 0x41, 0x00, 0x1f, 0x00, 
+	0x11, 0x73, 0x00, 0x77, 0x00, 0x77, 0x03, 0x10, 0x11, 0x62, 0x16, 0x45, 0xcf, 0x08, 0x33, 0x5f, 
+	0x41, 0xff, 0x02, 0xe8, 0x3e, 0x31, 0x67, 0x00, 0xf4, 0x5f, 0x01, 0x17, 0x73, 0x60, 0x22, 0x5b, 
+	0x00, 0x20, 0x5f, 0x50, 0xbf, 0x13, 0x53, 0x13, 0xdf, 0x00, 0x20, 0xbf, 0x58, 0x48, 0x03, 0x97, 
+	0x68, 0x00, 0x00, 0x1b, 0x12, 0xa1, 0x71, 0x14, 0x77, 0x85, 0x03, 0x10, 0xfd, 0x36, 0x01, 0x03, 
+	0x2f, 0x3b, 0x54, 0x04, 0xe0, 0x00, 0xe0, 0x00, 0xc0, 0x13, 0xb7, 0x20, 0x03, 0x81, 0x00, 0x60, 
+	0x18, 0x47, 0x47, 0x08, 0x47, 0x17, 0x66, 0x00, 0x26, 0x01, 0x1f, 0x12, 0x41, 0x15, 0x08, 0x25, 
+	0x00, 0x01, 0x10, 0x14, 0x14, 0x60, 0x68, 0x00, 0x00, 0x00, 0x01, 0x68, 0x81, 0x06, 0x80, 0x16, 
+	0x10, 0x68, 0x00, 0x04, 0xa3, 0x48, 0x71, 0x01, 0xd3, 0x46, 0x46, 0x00, 0x14, 0x5d, 0x04, 0x45, 
+	0x01, 0x14, 0x10, 0x45, 0x00, 0x12, 0x00, 0x1f, 0x86, 0x01, 0xd8, 0x61, 0x08, 0x40, 0x00, 0x03, 
+	0x57, 0x86, 0x84, 0x14, 0x00, 0x71, 0xe8, 0x00, 0x14, 0x3f, 0xc0, 0x9f, 0x23, 0x97, 0x68, 0x14, 
+	0x00, 0xfe, 0x01, 0x00, 0x47, 0x86, 0x04, 0x4f, 0x14, 0x00, 0x01, 0x00, 0x45, 0x00, 0x58, 0x54, 
+	0xff, 0x00, 0x01, 0x52, 0x88, 0x00, 0x57, 0x68, 0x20, 0x88, 0x00, 0x4a, 0x00, 0xff, 0x00, 0x5f, 
+	0x46, 0x00, 0x03, 0x45, 0x11, 0x00, 0x60, 0x00, 0x04, 0x14, 0x0f, 0x06, 0x17, 0x03, 0x40, 0x7b, 
+	0x00, 0x3c, 0x81, 0x41, 0x18, 0x70, 0x74, 0x12, 0x00, 0x00, 0x11, 0x00, 0x62, 0x64, 0x00, 0x35, 
+	0x51, 0x00, 0x31, 0x8d, 0x11, 0x1f, 0x12, 0x10, 0x51, 0x00, 0x00, 0x1f, 0x10, 0x3f, 0x11, 0x10, 
+	0x3c, 0xd0, 0xc0, 0x00, 0x40, 0x50, 0x3f, 0x48, 0x00, 0xa0, 0x80, 0x14, 0x00, 0x00, 0x20, 0x80, 
+	0x05, 0x03, 0x70, 0x73, 0x01, 0x00, 0x27, 0x36, 0x01, 0x46, 0x00, 0x13, 0x15, 0x00, 0x00, 0x54, 
+	0x01, 0x51, 0x45, 0x13, 0x0f, 0x25, 0x10, 0x00, 0x11, 0x01, 0xf6, 0x2b, 0x40, 0x01, 0x52, 0x5f, 
+	0x08, 0x24, 0x7b, 0x7c, 0x00, 0x04, 0x9e, 0x43, 0xe6, 0x8f, 0x00, 0xa4, 0xa6, 0x01, 0x29, 0x10, 
+	0x81, 0x41, 0x04, 0x03, 0x03, 0x64, 0x14, 0x60, 0x14, 0x61, 0x03, 0x5a, 0x0a, 0xfc, 0x00, 0xff, 
+	0x11, 0x80, 0x08, 0x43, 0x1e, 0x00, 0xc3, 0x00, 0x70, 0x10, 0x17, 0x41, 0x07, 0x01, 0x1e, 0x16, 
+	0x00, 0x50, 0x15, 0x30, 0x50, 0x15, 0x04, 0x43, 0x13, 0x00, 0xa4, 0xef, 0x86, 0x88, 0x02, 0x40, 
+	0x10, 0x28, 0x00, 0x31, 0x18, 0x01, 0xe2, 0x11, 0x40, 0x26, 0x00, 0x00, 0x1c, 0x16, 0x10, 0x54, 
+	0x50, 0x1f, 0x43, 0x5c, 0x00, 0x03, 0xc7, 0x70, 0x14, 0x15, 0x71, 0x17, 0x60, 0x00, 0x01, 0xdf, 
+	0x50, 0x02, 0x1f, 0x20, 0x10, 0x5f, 0x00, 0x80, 0x96, 0xeb, 0x87, 0x78, 0x00, 0x40, 0x18, 0x00, 
+	0x11, 0x14, 0x53, 0x70, 0x03, 0xa3, 0x40, 0x01, 0x00, 0x71, 0x20, 0x54, 0x02, 0xa1, 0x10, 0x3f, 
+	0x19, 0x00, 0x20, 0x86, 0x16, 0x06, 0xa3, 0x36, 0x67, 0x71, 0x00, 0x17, 0x01, 0x80, 0xc0, 0xb1, 
+	0x9f, 0x80, 0xbf, 0x02, 0x01, 0x80, 0x13, 0x81, 0x14, 0x70, 0x14, 0x79, 0x10, 0x00, 0x66, 0x66, 
+	0x16, 0x00, 0x26, 0x11, 0x51, 0x00, 0x00, 0xc3, 0x45, 0x13, 0x63, 0xde, 0x30, 0xbf, 0x17, 0x00, 
+	0xae, 0x30, 0xbf, 0x00, 0x04, 0x21, 0x00, 0x02, 0x00, 0xdf, 0x05, 0x20, 0x10, 0x1c, 0x20, 0xfe, 
+	0x02, 0x00, 0x09, 0x12, 0x9b, 0xf2, 0x9f, 0x30, 0x3c, 0xf0, 0x00, 0x1f, 0x00, 0x03, 0x06, 0x6e, 
+	0x55, 0x40, 0x12, 0x00, 0x84, 0x3e, 0x80, 0x16, 0x70, 0x17, 0x47, 0x11, 0x00, 0x14, 0x60, 0x66, 
+	0x14, 0x04, 0x5d, 0x45, 0x00, 0x04, 0x22, 0x51, 0x04, 0x4e, 0x10, 0x00, 0x30, 0x88, 0x00, 0x00, 
+	0x2f, 0xf4, 0x5f, 0xe0, 0xbf, 0x80, 0x02, 0x84, 0x00, 0x82, 0x02, 0x80, 0x48, 0x48, 0x01, 0x23, 
+	0x17, 0x00, 0x00, 0x17, 0x60, 0x14, 0x16, 0x16, 0x50, 0x14, 0x00, 0x15, 0xd9, 0x13, 0x7f, 0x76, 
+	0x07, 0x86, 0x14, 0x00, 0x09, 0x02, 0x43, 0x14, 0x10, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0xc3, 0x14, 
+	0x40, 0xbf, 0x71, 0x7f, 0x00, 0x00, 0x40, 0x38, 0x31, 0x47, 0x17, 0x00, 0x62, 0x17, 0x00, 0x40, 
+	0x36, 0x91, 0x7f, 0x40, 0x3f, 0x03, 0xc7, 0x00, 0x20, 0x80, 0x18, 0x11, 0x9f, 0x30, 0x17, 0x60, 
+	0x00, 0x66, 0x66, 0x3d, 0x13, 0x50, 0x05, 0xdd, 0x10, 0x00, 0x82, 0x50, 0x01, 0x05, 0x47, 0x18, 
+	0x01, 0x3f, 0x00, 0x5d, 0x18, 0x11, 0x3f, 0x30, 0x31, 0x3f, 0x40, 0x00, 0xa4, 0x40, 0x01, 0x68, 
+	0x05, 0x03, 0x1f, 0x88, 0x00, 0x38, 0x11, 0x13, 0x03, 0x62, 0xe3, 0x96, 0xee, 0x00, 0x07, 0xa7, 
+	0x01, 0xbf, 0x00, 0x01, 0x00, 0x74, 0x40, 0x77, 0x0e, 0xcd, 0x61, 0x7d, 0x16, 0x12, 0x1f, 0x37, 
+	0x00, 0xff, 0x37, 0x3f, 0x26, 0x7f, 0x51, 0xbf, 0x40, 0x80, 0x09, 0xc2, 0x20, 0x54, 0x05, 0x00, 
+	0x40, 0x70, 0xdf, 0x00, 0x03, 0xe3, 0x10, 0x03, 0x70, 0x8b, 0x04, 0x03, 0x00, 0x60, 0x04, 0x60, 
+	0x08, 0x9f, 0x45, 0x10, 0xbf, 0x00, 0xa0, 0x1f, 0x02, 0x60, 0x04, 0x80, 0x14, 0x30, 0x00, 0x16, 
+	0x06, 0xe3, 0x25, 0x0d, 0x46, 0x11, 0x00, 0x00, 0x53, 0x07, 0x00, 0x91, 0x3f, 0x15, 0x06, 0xe5, 
+	0x00, 0x00, 0x16, 0x18, 0x18, 0x60, 0x17, 0x17, 0x17, 0x00, 0x30, 0x03, 0x36, 0x36, 0x16, 0x10, 
+	0x53, 0x53, 0x00, 0x01, 0x1d, 0x80, 0xff, 0x94, 0x00, 0x3b, 0x10, 0x00, 0x38, 0x03, 0x44, 0x71, 
+	0x03, 0xc0, 0x46, 0x36, 0x00, 0xb8, 0x09, 0x7e, 0x51, 0x04, 0xab, 0x70, 0x40, 0x00, 0x60, 0x7f, 
+	0x04, 0x70, 0x16, 0x85, 0x02, 0x3f, 0x00, 0x14, 0x00, 0x11, 0x54, 0x08, 0x03, 0x34, 0x70, 0x00, 
+	0x1f, 0xbe, 0x12, 0x7f, 0x11, 0x13, 0x84, 0x10, 0x00, 0x3f, 0x09, 0xe2, 0x17, 0x43, 0x53, 0x5f, 
+	0x78, 0x00, 0xfe, 0x03, 0x5b, 0xa3, 0xbe, 0x17, 0xe3, 0x20, 0x00, 0x9f, 0x39, 0x17, 0x09, 0x3a, 
+	0x20, 0x03, 0x70, 0x00, 0xe6, 0x19, 0x94, 0x17, 0x9b, 0x86, 0x5f, 0x88, 0x00, 0x04, 0x07, 0xdb, 
+	0x02, 0x17, 0x80, 0xf6, 0x12, 0x00, 0x5f, 0x00, 0x23, 0x01, 0xdc, 0x12, 0x5b, 0x00, 0x00, 0x24, 
+	0x9d, 0x61, 0x3e, 0x28, 0x2d, 0x60, 0x16, 0x00, 0x00, 0xbf, 0x11, 0x14, 0x9f, 0x00, 0x43, 0x35, 
+	0x00, 0x09, 0xc1, 0x0c, 0x13, 0x40, 0x14, 0x20, 0x26, 0x00, 0xbf, 0x00, 0x62, 0x81, 0x81, 0x0c, 
+	0x02, 0x10, 0x00, 0x68, 0x28, 0x04, 0xdf, 0x00, 0x33, 0x46, 0x26, 0x00, 0x06, 0x00, 0x50, 0x52, 
+	0x51, 0x02, 0x24, 0x5b, 0x34, 0x43, 0xef, 0x0f, 0x85, 0x00, 0x07, 0x80, 0x10, 0x08, 0x58, 0x00, 
+	0x00, 0x00, 0xef, 0x3d, 0x52, 0x4a, 0xd6, 0x5a, 0x39, 0x00, 0x67, 0x9c, 0x73, 0xde, 0x7b, 0xff, 
+	0x7f, 0xff, 0x60, 0x7f, 0xa6, 0xdc, 0x00, 0x1f, 0xea, 0x3d, 0x4c, 0x4a, 0xcf, 0x00, 0x5a, 0x31, 
+	0x67, 0x92, 0x73, 0xd4, 0x7b, 0xf7, 0x20, 0x7f, 0xfc, 0xa0, 0x1f, 0xf8, 0xb5, 0xc0, 0x46, 0xf8, 
+	0x00, 0xbc, 0x08, 0xbc, 0x9e, 0x46, 0x70, 0x47, 0xee, 0x0a, 0xe3, 0x00, 0x08, 0xf3, 0x00, 0x03, 
+	0xf8, 0x00, 0x03, 0xfd, 0x82, 0x00, 0x03, 0x02, 0xe4, 0x00, 0x08, 0x07, 0x00, 0x03, 0x09, 0x00, 
+	0x8a, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x2f, 0xaa, 0x00, 0x0b, 0x33, 0x00, 0x03, 0x37, 0x00, 
+	0x03, 0x3b, 0x00, 0x03, 0x3f, 0xaa, 0x00, 0x03, 0x43, 0x00, 0x03, 0x47, 0x00, 0x03, 0x4b, 0x00, 
+	0x03, 0x26, 0xaa, 0x00, 0x03, 0xce, 0x00, 0x37, 0x4f, 0x00, 0x07, 0x0c, 0x00, 0x03, 0xcd, 0xd5, 
+	0x00, 0x0b, 0x50, 0x03, 0x11, 0x00, 0x0f, 0x16, 0x00, 0x03, 0x1b, 0x00, 0x03, 0x54, 0x20, 0x00, 
+	0x03, 0x25, 0x00, 0x03, 0x2a, 0x00, 0x03, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x30, 0x37, 
+	0x00, 0xff, 0x00, 0xff, 0xff, 0x09, 0x07, 0x07, 0x07, 0x07, 0x08, 0x10, 0x08, 0x06, 0x06, 0x00, 
+	0x97, 0x74, 0xdf, 0x00, 0x08, 0x55, 0x6d, 0x00, 0x03, 0x66, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x58, 
+	0x00, 0x03, 0x55, 0x50, 0x00, 0x03, 0x48, 0x00, 0x03, 0x42, 0x00, 0x03, 0x3c, 0x00, 0x03, 0x00, 
+	0xa2, 0x00, 0x86, 0x90, 0xa0, 0x04, 0xb5, 0x80, 0x00, 0xc9, 0x04, 0xb0, 0x0a, 0xe8, 0xe8, 0xe8, 
+	0xe8, 0x00, 0x88, 0xd0, 0xf3, 0x13, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x11, 0x11, 0x0c, 0x0c, 0x00, 
+	0x4e, 0xff, 0xff, 0x21, 0x80, 0x00, 0x03, 0x22, 0x16, 0xff, 0xff, 0x33, 0xff, 0xff, 0x6f, 0x24, 
+	0x20, 0x10, 0xb0, 0x01, 0x21, 0x20, 0x1f, 0x00, 0x1e, 0xf0, 0x1f, 0xa0, 0x01, 0x7d, 0x35, 0x00, 
+	0x03, 0xf0, 0x1f, 0xb0, 0x01, 0xf0, 0x1f, 0x00, 0x01, 0xa1, 0x40, 0x07, 0x60, 0xb3, 0xf0, 0x1f, 
+	0x20, 0x7f, 0x61, 0x21, 0xff, 0x10, 0x62, 0x9c, 0x00, 0x7f, 0x73, 0x33, 0xf0, 0x1f, 0xf0, 0x9f, 
+	0xf0, 0x1f, 0xff, 0xe1, 0xa8, 0x00, 0x05, 0x10, 0x00, 0xde, 0xf3, 0xe0, 0x1f, 0xa5, 0x02, 0x65, 
+	0x13, 0x22, 0x85, 0x02, 0x20, 0x05, 0x22, 0xe6, 0x30, 0x07, 0x40, 0x05, 0xbb, 0x10, 0x0d, 0x38, 
+	0x10, 0x16, 0x30, 0x06, 0x00, 0x0d, 0x18, 0x70, 0x06, 0x00, 0x2b, 0x40, 0x18, 0x30, 0x26, 0x2a, 
+	0x7c, 0x3b, 0x40, 0x5c, 0x7e, 0x03, 0x5e, 0x60, 0x7b, 0x7d, 0x7f, 0x20, 0x01, 0x8f, 0x10, 0x03, 
+	0x7f, 0x28, 0x12, 0x30, 0x05, 0x3a, 0x20, 0x0c, 0x10, 0x03, 0x10, 0x0b, 0x00, 0x03, 0x09, 0x3b, 
+	0xba, 0x20, 0x0e, 0x04, 0x10, 0x1f, 0x08, 0x87, 0x10, 0x7f, 0x38, 0x00, 0x0a, 0xd0, 0xcb, 0x00, 
+	0x03, 0x10, 0x0b, 0x58, 0xe0, 0x01, 0xaf, 0x72, 0x09, 0x93, 0x00, 0x03, 0xa0, 0x00, 0x12, 0x03, 
+	0x00, 0x33, 0x03, 0x8c, 0xc1, 0x03, 0x02, 0x34, 0x8c, 0xe1, 0x00, 0x03, 0x0c, 0x3f, 0xdc, 0x00, 
+	0x17, 0xbc, 0x74, 0x01, 0x00, 0x03, 0x4c, 0x73, 0x00, 0x03, 0xe4, 0x00, 0x07, 0xa4, 0x10, 0x46, 
+	0x80, 0x00, 0x0b, 0x48, 0x75, 0x30, 0x0b, 0x49, 0x38, 0x10, 0x00, 0x08, 0xe5, 0x00, 0x03, 0x8f, 
+	0x36, 0x00, 0x08, 0x55, 0xc1, 0x00, 0x07, 0x9d, 0x00, 0x03, 0x79, 0x00, 0x03, 0xf9, 0x00, 0x03, 
+	0x31, 0x05, 0x39, 0x02, 0xa7, 0x10, 0x26, 0x04, 0x00, 0x05, 0x10, 0x7d, 0x97, 0x02, 0x3b, 0x07, 
+	0x9b, 0x00, 0x27, 0xfd, 0x00, 0x03, 0x10, 0x07, 0x10, 0x03, 0x55, 0xdd, 0x00, 0x03, 0xbd, 0x00, 
+	0x03, 0x89, 0x00, 0x03, 0xf3, 0x00, 0x33, 0x00, 0x50, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x4e, 0x45, 
+	0x00, 0x53, 0x20, 0x32, 0x30, 0x31, 0x33, 0x2d, 0x30, 0x00, 0x37, 0x2d, 0x30, 0x31, 0x20, 0x73, 
+	0x61, 0x76, 0x00, 0x65, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00, 0xff, 0x11, 0x30, 0x00, 0x02, 0xa3, 
+	0x42, 0x43, 0x46, 0x47, 0xfa, 0x34, 0x82, 0x80, 0x01, 0x5a, 0xe8, 0x00, 0x08, 0x56, 0x00, 0x03, 
+	0x5d, 0xd5, 0x40, 0x07, 0x10, 0x0f, 0x64, 0x00, 0x03, 0x45, 0x00, 0x03, 0x4a, 0x00, 0x03, 0x41, 
+	0x50, 0x40, 0x17, 0x88, 0xe7, 0x00, 0x08, 0x92, 0x00, 0x03, 0x55, 0x9f, 0x00, 0x03, 0xae, 0x00, 
+	0x03, 0x29, 0x00, 0x13, 0x2e, 0x00, 0x03, 0x55, 0x33, 0x00, 0x03, 0x37, 0x00, 0x03, 0x3b, 0x00, 
+	0x03, 0x0b, 0x00, 0x03, 0x55, 0x11, 0x00, 0x03, 0x0e, 0x00, 0x03, 0x14, 0x00, 0x03, 0x1b, 0x00, 
+	0x03, 0x55, 0x22, 0x00, 0x03, 0xca, 0x00, 0x2f, 0xd3, 0x00, 0x03, 0xe5, 0x00, 0x03, 0x55, 0xf9, 
+	0x00, 0x03, 0xbf, 0x00, 0x03, 0xc2, 0x00, 0x03, 0x43, 0x00, 0x1b, 0x55, 0x42, 0x00, 0x03, 0x41, 
+	0x00, 0x03, 0x40, 0x00, 0x03, 0x3f, 0x00, 0x03, 0x55, 0x7d, 0x00, 0x17, 0x84, 0x00, 0x03, 0x63, 
+	0x00, 0x03, 0x73, 0x00, 0x03, 0x00, 0x0c, 0x09, 0x07, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe0, 
+	0xe1, 0x00, 0x08, 0x10, 0xe2, 0x00, 0x08, 0x55, 0xc4, 0x00, 0x07, 0xb0, 0x00, 0x03, 0xac, 0x00, 
+	0x03, 0x80, 0x00, 0x03, 0x20, 0x65, 0x52, 0x30, 0x03, 0xdd, 0x50, 0x00, 0x08, 0xed, 0x40, 0x53, 
+	0x00, 0x4b, 0x10, 0x00, 0x08, 0x1d, 0x05, 0x00, 0x14, 0x08, 0x91, 0x0d, 0x03, 0x83, 0x0c, 0x04, 
+	0x03, 0x08, 0x00, 0x2a, 0x08, 0x15, 0x00, 0x03, 0x23, 0x00, 0x03, 0x31, 0x00, 0x03, 0x3f, 0xaa, 
+	0x00, 0x03, 0x4d, 0x00, 0x03, 0x5b, 0x00, 0x03, 0x75, 0x00, 0x03, 0xa1, 0xcd, 0x00, 0x03, 0x10, 
+	0x33, 0xf1, 0x4f, 0x00, 0x17, 0x00, 0x03, 0xcd, 0x00, 0x03, 0x41, 0x95, 0x00, 0x03, 0xd9, 0x59, 
+	0x00, 0x08, 0x0d, 0x00, 0x07, 0x53, 0x29, 0x00, 0x03, 0x39, 0x00, 0x03, 0xb9, 0x4e, 0x00, 0x2f, 
+	0x00, 0x07, 0x4d, 0x85, 0x00, 0x03, 0xe1, 0x51, 0x00, 0x1f, 0x00, 0x37, 0x65, 0x00, 0x13, 0x53, 
+	0x15, 0x00, 0x03, 0xa5, 0x00, 0x13, 0x6b, 0x58, 0x01, 0x43, 0x00, 0x03, 0x02, 0x0d, 0x48, 0x00, 
+	0x08, 0xe9, 0x4c, 0x00, 0x7b, 0x44, 0x84, 0x00, 0x1b, 0x57, 0x00, 0x08, 0x71, 0x00, 0x03, 0xcf, 
+	0x56, 0xe0, 0xf0, 0x2f, 0x50, 0x2f, 0x90, 0x23, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x00, 0x4e, 
+	0x65, 0x77, 0x00, 0x4f, 0x6c, 0x64, 0x02, 0x20, 0x2d, 0x20, 0x00, 0x20, 0x20, 0x20, 0x01, 0x43, 
+	0x00, 0x68, 0x65, 0x61, 0x74, 0x20, 0x46, 0x69, 0x6e, 0x00, 0x64, 0x65, 0x72, 0x00, 0x45, 0x64, 
+	0x69, 0x74, 0x80, 0x30, 0x11, 0x73, 0x2e, 0x2e, 0x2e, 0x00, 0x53, 0x65, 0x00, 0x61, 0x72, 0x63, 
+	0x68, 0x20, 0x52, 0x65, 0x73, 0x08, 0x75, 0x6c, 0x74, 0x73, 0x10, 0x34, 0x3d, 0x3d, 0x00, 0x00, 
+	0x21, 0x3d, 0x00, 0x20, 0x3e, 0x00, 0x20, 0x3c, 0x00, 0x00, 0x3e, 0x3d, 0x00, 0x3c, 0x3d, 0x00, 
+	0x4f, 0x00, 0x66, 0x66, 0x00, 0x43, 0x6f, 0x6d, 0x70, 0x61, 0x00, 0x72, 0x65, 0x20, 0x77, 0x69, 
+	0x74, 0x68, 0x20, 0x02, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x10, 0x2c, 0x55, 0x28, 0x70, 0x64, 
+	0x02, 0x36, 0x20, 0x20, 0x79, 0x73, 0x00, 0x4f, 0x10, 0x6e, 0x00, 0x4e, 0x30, 0x1a, 0x74, 0x6f, 
+	0x20, 0x63, 0x85, 0x40, 0x31, 0x74, 0x6f, 0x3a, 0x20, 0x10, 0x94, 0x20, 0x30, 0x6a, 0xe0, 0x20, 
+	0x94, 0x30, 0x91, 0xb0, 0x7b, 0x00, 0x50, 0x72, 0x65, 0x73, 0x10, 0x73, 0x20, 0x41, 0x10, 0x3b, 
+	0x61, 0x64, 0x64, 0x20, 0x41, 0x63, 0x10, 0x23, 0x00, 0x20, 0x77, 0x61, 0x73, 0x40, 0xc8, 0x82, 
+	0x30, 0x34, 0x4c, 0x69, 0x73, 0x74, 0x20, 0x10, 0xc4, 0x6f, 0x30, 0x72, 0x00, 0x20, 0x2b, 0x10, 
+	0x0b, 0x2c, 0x20, 0x53, 0x74, 0x10, 0x61, 0x72, 0x74, 0x10, 0x0e, 0x54, 0x6f, 0x67, 0x67, 0x22, 
+	0x6c, 0x65, 0x00, 0xd7, 0x6c, 0x65, 0x63, 0x20, 0x10, 0x64, 0xdc, 0x00, 0x09, 0x02, 0xd9, 0x41, 
+	0x00, 0x52, 0x10, 0x85, 0x20, 0x45, 0x00, 0x4f, 0x88, 0x00, 0xc4, 0x6f, 0x21, 0x20, 0x73, 0x0d, 
+	0x63, 0x72, 0x61, 0x04, 0x73, 0x68, 0x65, 0x64, 0x21, 0x40, 0x85, 0x53, 0x45, 0x08, 0x4c, 0x45, 
+	0x43, 0x54, 0x10, 0x3e, 0x72, 0x65, 0x62, 0x00, 0x6f, 0x6f, 0x74, 0x2e, 0x00, 0x52, 0x65, 0x67, 
+	0xc0, 0x00, 0x79, 0x00, 0xda, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x00, 0x74, 0x73, 0x3a, 0x00, 
+	0x28, 0x73, 0x65, 0x6e, 0x10, 0x64, 0x20, 0x6d, 0x00, 0xe2, 0x68, 0x65, 0x73, 0x65, 0x42, 0x29, 
+	0x60, 0xc0, 0x66, 0x6f, 0x72, 0x20, 0x03, 0x4e, 0x63, 0x01, 0x6b, 0x20, 0x74, 0x72, 0x61, 0x63, 
+	0x65, 0x30, 0xbd, 0x68, 0x00, 0x00, 0xa1, 0x50, 0x11, 0x2d, 0x90, 0x5e, 0x73, 0x65, 0x74, 0x12, 
+	0x00, 0x50, 0x43, 0x00, 0x20, 0x4c, 0x52, 0x00, 0x04, 0x52, 0x54, 0x30, 0x10, 0x04, 0x31, 0x10, 
+	0x04, 0x32, 0x20, 0x09, 0x32, 0x20, 0x01, 0x00, 0x43, 0x50, 0x53, 0x52, 0x00, 0x20, 0x00, 0x19, 
+	0xb1, 0x00, 0x04, 0x31, 0x10, 0x04, 0x00, 0x13, 0x20, 0x52, 0x33, 0x20, 0x0e, 0x11, 0x32, 0x00, 
+	0x20, 0x00, 0x3c, 0x00, 0x52, 0x34, 0x00, 0x03, 0x55, 0x35, 0x00, 0x03, 0x36, 0x00, 0x03, 0x37, 
+	0x00, 0x03, 0x38, 0x00, 0x03, 0x54, 0x39, 0x10, 0x3f, 0x30, 0x00, 0x03, 0x31, 0x10, 0x5b, 0x00, 
+	0x28, 0x08, 0x45, 0x29, 0x00, 0x28, 0x00, 0xa6, 0x4e, 0x6f, 0x20, 0x09, 0x52, 0x4f, 0x4d, 0x53, 
+	0x00, 0xa6, 0x75, 0x6e, 0x00, 0xf0, 0x10, 0x55, 0x73, 0x65, 0x81, 0x07, 0x4d, 0x65, 0x6e, 0x75, 
+	0x0c, 0x20, 0x4d, 0x61, 0x6b, 0x02, 0x29, 0x00, 0x9d, 0x62, 0x75, 0x50, 0x69, 0x02, 0x49, 0x61, 
+	0x21, 0xcb, 0x69, 0x6c, 0x61, 0x74, 0x12, 0x69, 0x6f, 0x6e, 0x10, 0x3b, 0x2c, 0x00, 0x00, 0xe1, 
+	0x75, 0x92, 0x20, 0x37, 0x67, 0x6f, 0x01, 0x36, 0x6c, 0x6c, 0x32, 0x17, 0x61, 0x00, 0x00, 0x73, 
+	0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x04, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x01, 0x50, 0x20, 0x63, 
+	0x81, 0x01, 0x95, 0x72, 0x69, 0x64, 0x67, 0x65, 0x2e, 0x36, 0xe9, 0x49, 0x4f, 0x01, 0x93, 0x31, 
+	0x38, 0x04, 0x7b, 0x30, 0x30, 0x01, 0x16, 0x10, 0x57, 0x72, 0x69, 0x02, 0x3c, 0x65, 0x72, 0x72, 
+	0x6f, 0x20, 0x72, 0x21, 0x00, 0x79, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x05, 0x66, 0x75, 0x6c, 0x6c, 
+	0x2e, 0x31, 0x32, 0x44, 0x21, 0xb9, 0x18, 0x20, 0x73, 0x6f, 0x01, 0x62, 0x24, 0xa2, 0x2e, 0x00, 
+	0x30, 0x30, 0x30, 0x3a, 0x20, 0x02, 0x12, 0x7b, 0x2c, 0x20, 0x66, 0x72, 0x03, 0x65, 0x65, 0x20, 
+	0x00, 0x50, 0x75, 0x00, 0x68, 0x71, 0x51, 0x80, 0x41, 0xef, 0x3c, 0x4e, 0x45, 0x57, 0x3e, 0x00, 
+	0x53, 0xc0, 0x00, 0x36, 0x11, 0x8b, 0x74, 0x65, 0x3a, 0x00, 0x4c, 0x6f, 0x28, 0x61, 0x64, 0x50, 
+	0x0b, 0x45, 0x01, 0xee, 0x65, 0x20, 0x53, 0x00, 0x52, 0x41, 0x4d, 0x3a, 0x00, 0x20, 0x62, 0x79, 
+	0x46, 0x74, 0x02, 0xbc, 0x50, 0x6c, 0x65, 0x10, 0x13, 0x20, 0x53, 0x75, 0x04, 0x70, 0x20, 0x00, 
+	0x57, 0x65, 0x02, 0x22, 0x77, 0x20, 0x40, 0x68, 0x10, 0x41, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 
+	0x10, 0x20, 0x73, 0x70, 0x11, 0xce, 0x41, 0x50, 0x33, 0x33, 0xc7, 0x53, 0x5a, 0x00, 0x5f, 0x69, 
+	0x6e, 0x67, 0x32, 0xab, 0x40, 0xb5, 0x90, 0x18, 0xed, 0x60, 0x12, 0x01, 0x34, 0x00, 0x4d, 0x74, 
+	0x31, 0x73, 0x60, 0x15, 0x4f, 0x02, 0x38, 0x48, 0x72, 0x03, 0x06, 0x74, 0x74, 0x00, 0x2b, 0x73, 
+	0x00, 0x56, 0x08, 0x53, 0x79, 0x6e, 0x63, 0x03, 0x2c, 0x46, 0x50, 0x53, 0x28, 0x2d, 0x4d, 0x00, 
+	0xc3, 0x72, 0x00, 0x0b, 0x53, 0x77, 0x61, 0x04, 0x70, 0x20, 0x41, 0x2d, 0x42, 0x00, 0x0a, 0x41, 
+	0x75, 0x01, 0x74, 0x6f, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x40, 0x0b, 0x7c, 0x6c, 0x70, 0xcf, 0x40, 
+	0x1c, 0x70, 0xec, 0x01, 0xf9, 0x02, 0xaf, 0x6f, 0x6e, 0xf4, 0x00, 0x08, 0xf5, 0xf1, 0x05, 0xf1, 
+	0x01, 0xc7, 0x00, 0x94, 0x16, 0x2d, 0x3e, 0x08, 0x00, 0x42, 0x20, 0x61, 0x00, 0x43, 0x66, 0x69, 
+	0x72, 0xd0, 0x20, 0x4e, 0x90, 0x0c, 0x43, 0x02, 0xf1, 0x72, 0x6f, 0x6c, 0x6c, 0x80, 0x20, 0x90, 
+	0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0xee, 0x00, 0x30, 0xb0, 0xbd, 0x00, 0x10, 0x53, 0x10, 
+	0x9c, 0x00, 0x78, 0x00, 0x82, 0x72, 0x03, 0x74, 0x00, 0x45, 0x78, 0x69, 0x74, 0x31, 0x7f, 0x02, 
+	0xf9, 0x38, 0x74, 0x65, 0x00, 0x1f, 0x21, 0x80, 0x50, 0x0c, 0x4d, 0x61, 0x6e, 0x30, 0x61, 0x67, 
+	0x31, 0x82, 0x00, 0x0d, 0x30, 0x31, 0x32, 0x33, 0x00, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x41, 
+	0x42, 0x0f, 0x43, 0x44, 0x45, 0x46, 0x41, 0x21, 0x40, 0x6c, 0x71, 0x22, 0x40, 0x10, 0x8c, 0x11, 
+	0x18, 0x63, 0x61, 0x6c, 0x00, 0x12, 0x00, 0x09, 0x47, 0x61, 0x15, 0x6d, 0x6d, 0x61, 0x10, 0x11, 
+	0x70, 0x22, 0x4e, 0x46, 0x00, 0xa9, 0xbf, 0x01, 0xb7, 0x62, 0x10, 0x24, 0x81, 0x90, 0x60, 0x01, 
+	0x52, 0x42, 0x50, 0x2f, 0x34, 0xb1, 0x9a, 0x10, 0xf3, 0x64, 0x64, 0x13, 0xc0, 0x60, 0x49, 0x00, 
+	0x00, 0x9a, 0x00, 0x00, 0x55, 0x53, 0x20, 0x28, 0x4e, 0x54, 0x53, 0x43, 0x00, 0x29, 0x00, 0x45, 
+	0x75, 0x72, 0x6f, 0x70, 0x65, 0x00, 0x20, 0x28, 0x50, 0x41, 0x4c, 0x29, 0x00, 0x44, 0x80, 0x03, 
+	0xf9, 0x79, 0x20, 0x28, 0x52, 0x75, 0x73, 0x73, 0x00, 0x69, 0x61, 0x29, 0x00, 0x4f, 0x76, 0x65, 
+	0x72, 0x3c, 0x63, 0x6c, 0x11, 0x68, 0x04, 0x64, 0x00, 0x2d, 0x13, 0x63, 0x46, 0x6c, 0x41, 0x69, 
+	0x00, 0x0f, 0x72, 0x00, 0x55, 0x6e, 0x73, 0x00, 0xaa, 0x25, 0x65, 0x64, 0x60, 0x08, 0x20, 0x28, 
+	0x30, 0xa2, 0x29, 0x20, 0xc3, 0x82, 0x00, 0x0f, 0x42, 0x47, 0x2c, 0x20, 0x46, 0x02, 0xf6, 0x20, 
+	0x13, 0x4f, 0x42, 0x4a, 0x70, 0x13, 0x20, 0x61, 0x04, 0x5c, 0x10, 0x11, 0x20, 0x31, 0x50, 0x00, 
+	0x02, 0x2b, 0x32, 0x50, 0x00, 0x4c, 0x14, 0x69, 0x6e, 0x6b, 0x40, 0x06, 0x33, 0x30, 0x06, 0x34, 
+	0x50, 0x04, 0x00, 0x43, 0x72, 0x61, 0x70, 0x04, 0x79, 0x6f, 0x74, 0x08, 0x00, 0x47, 0x42, 0x41, 
+	0x00, 0x03, 0x50, 0x00, 0x4e, 0x04, 0x44, 0x53, 0x00, 0x49, 0x49, 0x00, 0x01, 0x00, 0x35, 0x02, 
+	0x6d, 0x69, 0x6e, 0x00, 0x31, 0x30, 0x10, 0x05, 0x33, 0x80, 0x20, 0x05, 0x4f, 0x46, 0x46, 0x00, 
+	0x4f, 0x4e, 0x00, 0x0c, 0x53, 0x4c, 0x4f, 0x57, 0x06, 0xac, 0x23, 0xb3, 0x52, 0x00, 0x40, 0xff, 
+	0x17, 0xc7, 0x28, 0x04, 0x9a, 0xe5, 0x00, 0x10, 0x00, 0x49, 0xe0, 0x01, 0x00, 0x81, 0xe2, 0x20, 
+	0x14, 0x00, 0xa0, 0xe1, 0x1c, 0x24, 0x9a, 0xe5, 0x01, 0x10, 0x00, 0x42, 0xe4, 0x01, 0x2c, 0x82, 
+	0xe3, 0x01, 0x00, 0x00, 0x42, 0xe4, 0x1c, 0x24, 0xca, 0xe5, 0x4d, 0x00, 0x00, 0x08, 0xe2, 0x02, 
+	0x01, 0x13, 0xe3, 0x80, 0x00, 0x00, 0x80, 0x13, 0xff, 0x00, 0x13, 0xe3, 0x02, 0x00, 0x00, 0x80, 
+	0x03, 0x30, 0x00, 0x80, 0xe3, 0x10, 0xc0, 0x00, 0x9f, 0xe5, 0x2a, 0x07, 0x00, 0xeb, 0x15, 0x8c, 
+	0x00, 0x58, 0xe2, 0x01, 0x00, 0xd9, 0x54, 0x00, 0xf1, 0x01, 0x9a, 0x57, 0xef, 0x0f, 0x00, 0xea, 
+	0xfe, 0x00, 0x59, 0x00, 0x01, 0xc0, 0xd9, 0xe4, 0x0c, 0x00, 0xdb, 0xe7, 0x00, 0x00, 0x5c, 0x85, 
+	0xe1, 0x45, 0x3c, 0xa0, 0xe1, 0x58, 0x09, 0x80, 0x23, 0xe6, 0x00, 0x23, 0x60, 0x1f, 0x00, 0x80, 
+	0xe0, 0x00, 0x00, 0x3c, 0x90, 0xe1, 0x01, 0x80, 0x88, 0xe3, 0x01, 0x0c, 0x00, 0xcb, 0xe7, 0x0f, 
+	0x8c, 0xd8, 0x60, 0x27, 0x7e, 0xdc, 0x00, 0x27, 0xf0, 0x7b, 0x30, 0x7b, 0x20, 0xa7, 0x40, 0x9f, 
+	0x90, 0x5b, 0xcf, 0x8a, 0x10, 0x5b, 0x00, 0xd9, 0xe4, 0x50, 0x77, 0x06, 0x80, 0x1b, 0xc8, 0x86, 
+	0x00, 0x1b, 0x05, 0x50, 0x95, 0xe0, 0x10, 0x17, 0x10, 0x6f, 0x06, 0xb0, 0x80, 0x6b, 0xc1, 0x40, 
+	0x93, 0x20, 0x3b, 0xc4, 0x8c, 0xe1, 0xac, 0x40, 0x16, 0x08, 0x39, 0xe0, 0x8f, 0xe2, 0x01, 0xf1, 
+	0x9a, 0x97, 0x60, 0xc3, 0x03, 0x8b, 0x70, 0x4b, 0xb5, 0xf0, 0x2f, 0x70, 0x2f, 0x70, 0xd3, 0x04, 
+	0x23, 0x01, 0x80, 0xc8, 0x33, 0x70, 0x1b, 0x94, 0xe7, 0x58, 0x12, 0x80, 0x8f, 0xa4, 0x00, 0x43, 
+	0x10, 0xdb, 0x45, 0x06, 0x00, 0x00, 0x1a, 0xd1, 0x00, 0xd9, 0xe0, 0xff, 0x1c, 0x09, 0x00, 0xe2, 
+	0x00, 0x90, 0x89, 0xe0, 0xff, 0x2c, 0x09, 0x00, 0xe2, 0x02, 0x00, 0x51, 0xe1, 0x03, 0x8c, 0x48, 
+	0x54, 0x12, 0x90, 0xdb, 0x8a, 0x40, 0x2f, 0x39, 0x40, 0x2f, 0x04, 0x00, 0x03, 0x70, 0xe3, 0x41, 
+	0x06, 0x00, 0x0a, 0xf0, 0x37, 0xb0, 0x37, 0x40, 0x7c, 0x41, 0x13, 0xff, 0x00, 0x50, 0xe3, 0x0b, 
+	0xc0, 0x00, 0xf0, 0xe7, 0x01, 0x0c, 0x40, 0x02, 0x01, 0x10, 0x02, 0xd0, 0xe5, 0x0c, 0x2c, 0x97, 
+	0xe0, 0x00, 0x2b, 0x22, 0x42, 0x01, 0x00, 0xbf, 0x27, 0xcc, 0x8c, 0xe0, 0xf0, 0xf3, 0xa0, 0x28, 
+	0xe1, 0x0f, 0x80, 0x47, 0x78, 0x51, 0xb7, 0xcc, 0x86, 0xe0, 0x36, 0x2c, 0x0c, 0x71, 0xdb, 0x91, 
+	0x17, 0x6f, 0xd0, 0x23, 0x81, 0xdf, 0x2c, 0x34, 0x0c, 0xcb, 0x00, 0xff, 0x71, 0x73, 0x64, 0x10, 
+	0x2b, 0x80, 0xc8, 0xd7, 0x01, 0x87, 0x70, 0x3f, 0x5f, 0x50, 0x3f, 0x0c, 0x40, 0x9b, 0x41, 0x5f, 
+	0xf0, 0x9f, 0xab, 0xf0, 0x7b, 0x50, 0x60, 0x3b, 0x96, 0xa0, 0x3b, 0x26, 0xf0, 0x3b, 0xe0, 0x3b, 
+	0x7d, 0x41, 0xc1, 0xcf, 0xe0, 0x33, 0xf1, 0xd3, 0x61, 0xd3, 0x92, 0xff, 0x2f, 0x10, 0x47, 0x04, 
+	0x20, 0xd9, 0xe4, 0x28, 0x14, 0x12, 0x9f, 0x49, 0xe0, 0x00, 0x00, 0x10, 0xd9, 0xe5, 0x01, 0x94, 
+	0x82, 0xe1, 0xc0, 0xf3, 0x5b, 0x32, 0xbb, 0x0e, 0x1a, 0x09, 0xe2, 0xa1, 0x05, 0x03, 0x94, 0xe7, 
+	0x28, 0x04, 0x8a, 0xe5, 0x11, 0xc3, 0x92, 0x1f, 0x50, 0x1c, 0x83, 0x27, 0x40, 0x01, 0x27, 0x40, 
+	0x00, 0x10, 0xe3, 0x01, 0x40, 0x80, 0x88, 0x13, 0x25, 0x3c, 0x00, 0x00, 0x8b, 0x53, 0x83, 0xa3, 
+	0x53, 0x11, 0x93, 0x53, 0x5c, 0x05, 0x22, 0xe3, 0x90, 0x1f, 0x49, 0x09, 0x80, 0x1f, 0xa8, 0x80, 
+	0x0b, 0x09, 0x00, 0xa0, 0x20, 0xcf, 0x0c, 0x08, 0x80, 0xa8, 0xe0, 0x33, 0x77, 0x70, 0x2b, 0xfe, 
+	0x0e, 0x00, 0x00, 0xea, 0x1c, 0x24, 0xda, 0xe5, 0x01, 0x20, 0x30, 0x82, 0xe2, 0x10, 0xa3, 0x10, 
+	0xaf, 0xdb, 0x00, 0x92, 0xe1, 0x42, 0x4d, 0x00, 0x83, 0x4d, 0x10, 0x00, 0xe2, 0x01, 0x03, 0xe1, 
+	0x00, 0xfd, 0x30, 0xc0, 0xe3, 0x02, 0x30, 0x23, 0xe2, 0x03, 0x03, 0x8b, 0x48, 0xe2, 0x0c, 0x06, 
+	0x53, 0x73, 0x30, 0x77, 0xb0, 0x91, 0xcf, 0xeb, 0x00, 0x4b, 0x10, 0x6f, 0x02, 0x55, 0x85, 0x23, 
+	0xef, 0x53, 0x7b, 0x10, 0x73, 0x90, 0x23, 0xe2, 0x00, 0x23, 0xf3, 0x4b, 0x31, 0x77, 0xf0, 0xf7, 
+	0x5e, 0x83, 0xa1, 0xb7, 0xd3, 0xf0, 0x3b, 0x81, 0xe7, 0x30, 0x8f, 0x90, 0x2f, 0xc7, 0xfb, 0xf0, 
+	0x2f, 0x60, 0x2f, 0xd1, 0x17, 0xf3, 0xb7, 0x30, 0x43, 0xb6, 0x00, 0x43, 0x13, 0x87, 0x0d, 0x57, 
+	0x05, 0x00, 0x0a, 0xf3, 0xb7, 0xf3, 0x7f, 0x9c, 0x40, 0x2f, 0x6e, 0x4b, 0x40, 0x2f, 0x13, 0xb7, 
+	0x53, 0x00, 0x0b, 0xf0, 0x37, 0xb0, 0x37, 0x8e, 0xfb, 0x10, 0xab, 0xf3, 0xb7, 0xf3, 0xb7, 0xf0, 
+	0xf3, 0xa3, 0xb7, 0x8a, 0x40, 0xf3, 0x73, 0xb7, 0xbd, 0xf1, 0x17, 0x81, 0xc0, 0x23, 0xd1, 0x0b, 
+	0x33, 0xbb, 0x70, 0x2f, 0x75, 0x10, 0x2f, 0xde, 0x25, 0x43, 0x70, 0x13, 0x70, 0x50, 0x43, 0xf3, 
+	0xbb, 0xf0, 0xa3, 0xc0, 0x7f, 0x61, 0xf7, 0x60, 0x3b, 0xf3, 0xbb, 0xf0, 0x3b, 0xb0, 0x3b, 0x52, 
+	0xc1, 0xd3, 0xd0, 0x33, 0xf1, 0xd7, 0xde, 0xf3, 0xbb, 0x10, 0x47, 0x40, 0xf2, 0xf7, 0xf2, 0xf7, 
+	0x42, 0xf7, 0x13, 0xcb, 0x02, 0x85, 0x40, 0x27, 0x02, 0x2c, 0xc2, 0xe3, 0x33, 0xd3, 0x52, 0x23, 
+	0xdb, 0x00, 0x00, 0x90, 0xd2, 0xe5, 0x00, 0x94, 0x89, 0xe1, 0x85, 0xf3, 0xdb, 0x48, 0xe2, 0x41, 
+	0x05, 0x93, 0xa7, 0x25, 0xe3, 0xa7, 0x40, 0x1f, 0x51, 0x07, 0x30, 0xdb, 0xe7, 0xa3, 0x30, 0xb0, 
+	0xa9, 0x37, 0x17, 0x30, 0xb7, 0x17, 0x16, 0x00, 0x23, 0x25, 0x0c, 0x44, 0x4f, 0x9d, 0xf7, 0x03, 
+	0x57, 0x0e, 0x42, 0x37, 0x50, 0x5f, 0x91, 0xa3, 0x07, 0x00, 0x1b, 0x02, 0xa5, 0x3c, 0xb0, 0xe1, 
+	0x03, 0x5c, 0xf7, 0x03, 0x00, 0x90, 0x00, 0x1b, 0x18, 0x08, 0x08, 0x0f, 0x00, 0x59, 0xe1, 0x28, 
+	0x1b, 0xf0, 0x9f, 0x05, 0x20, 0x43, 0x24, 0xbf, 0x80, 0xe0, 0xcb, 0x90, 0x6f, 0x00, 0xf2, 0x0d, 
+	0x00, 0xea, 0x00, 0x3b, 0x00, 0x06, 0xf7, 0xf3, 0x57, 0x51, 0xb3, 0x30, 0x87, 0x91, 0xb3, 0xe5, 
+	0x00, 0x33, 0xf0, 0x2f, 0x30, 0x2f, 0x31, 0xa0, 0x00, 0x20, 0xf7, 0x25, 0x67, 0x00, 0x30, 0xa0, 
+	0x80, 0x1b, 0xa0, 0xb3, 0x87, 0xd4, 0x00, 0x43, 0x40, 0x00, 0x18, 0xe3, 0x75, 0x62, 0x04, 0xf7, 
+	0x3f, 0xf3, 0x4f, 0x9a, 0x57, 0xba, 0x40, 0x2f, 0x69, 0xcd, 0x40, 0x2f, 0x13, 0x87, 0x71, 0x04, 
+	0xf3, 0x87, 0xd0, 0x37, 0xac, 0x10, 0xab, 0xf7, 0xf3, 0x87, 0xf3, 0x87, 0xf0, 0xf3, 0xa3, 0x87, 
+	0xa8, 0x40, 0xf3, 0x73, 0x87, 0xf1, 0x17, 0x52, 0x9f, 0x90, 0x23, 0x3c, 0x72, 0x03, 0x2c, 0x3c, 
+	0xb7, 0x3b, 0x95, 0xa1, 0x00, 0x27, 0x04, 0x27, 0x3b, 0x48, 0xe2, 0xac, 0x04, 0xf3, 0x77, 0xef, 
+	0xf3, 0x77, 0xf1, 0x87, 0x10, 0x47, 0x83, 0x50, 0x6f, 0xf3, 0x77, 0xf0, 0x3b, 0xc0, 0x3b, 0x7d, 
+	0x74, 0xc1, 0xc3, 0xd0, 0x33, 0xf1, 0xc7, 0xf3, 0x77, 0x10, 0x47, 0x62, 0x00, 0x47, 0xc3, 0xf3, 
+	0x4f, 0xf3, 0x4f, 0x01, 0x90, 0x89, 0xe2, 0xf3, 0x53, 0x87, 0xff, 0xd0, 0x50, 0xcb, 0x16, 0xe3, 
+	0x10, 0x00, 0x7b, 0x0c, 0x40, 0x22, 0x60, 0x2c, 0x54, 0xb5, 0x20, 0xb7, 0x41, 0x01, 0x43, 0x06, 
+	0x4b, 0x73, 0x09, 0xb0, 0x81, 0x43, 0x44, 0x90, 0x2f, 0x04, 0x23, 0x01, 0x0c, 0x80, 0x23, 0x8d, 
+	0x10, 0xb3, 0x00, 0x3c, 0x80, 0xf7, 0x17, 0x00, 0x2f, 0x38, 0x20, 0xa7, 0x9b, 0xc4, 0x1f, 0x30, 
+	0x92, 0x23, 0x4b, 0x91, 0x17, 0x2e, 0x42, 0x2f, 0xf0, 0x83, 0xd8, 0x30, 0x83, 0x93, 0x73, 0x23, 
+	0x00, 0x2b, 0x10, 0x7b, 0x65, 0x50, 0xa0, 0x81, 0x08, 0x93, 0xb0, 0xe1, 0xff, 0x54, 0x05, 0xe2, 
+	0xd7, 0x1f, 0x40, 0x1a, 0xc1, 0x67, 0x0e, 0x2a, 0x0c, 0xe2, 0xa2, 0x15, 0x01, 0x94, 0xe7, 0x0c, 
+	0x90, 0xf1, 0xe7, 0x0c, 0x04, 0x07, 0x01, 0x01, 0x04, 0x90, 0xe2, 0x01, 0x1c, 0x41, 0x01, 0xbb, 
+	0x77, 0xd1, 0xf4, 0x77, 0x01, 0x23, 0x90, 0xc3, 0x07, 0xf3, 0x77, 0x75, 0x27, 0xf0, 0xaf, 0x93, 
+	0x20, 0xaf, 0x03, 0x8b, 0x70, 0xaf, 0xf7, 0x0c, 0xf0, 0x3f, 0x95, 0x67, 0xf9, 0xd1, 0x43, 0xf3, 
+	0xbb, 0x43, 0xff, 0x00, 0x47, 0x13, 0x8b, 0x86, 0x03, 0xf7, 0x43, 0x8b, 0xf3, 0x83, 0x9a, 0x57, 
+	0xcb, 0x40, 0x2f, 0x7a, 0x40, 0x2f, 0x13, 0xbb, 0x77, 0x82, 0x00, 0x0b, 0xf0, 0x37, 0xb0, 0x37, 
+	0xbd, 0x10, 0xaf, 0xf3, 0xbb, 0xf3, 0xbb, 0xef, 0xf1, 0x07, 0xe1, 0x07, 0x95, 0x83, 0xb5, 0x41, 
+	0x07, 0x67, 0x2f, 0xf0, 0x33, 0xe1, 0x3b, 0x75, 0xa8, 0xd0, 0x33, 0xf1, 0x2f, 0xe7, 0x67, 0x9b, 
+	0x00, 0x33, 0x04, 0xc7, 0x67, 0x7d, 0x96, 0x50, 0x47, 0xf3, 0xef, 0xf0, 0xc7, 0xf0, 0x93, 0xa0, 
+	0x93, 0x83, 0x60, 0x4b, 0xf7, 0xf3, 0xff, 0xf0, 0x4b, 0xf0, 0x4b, 0x90, 0x4b, 0x70, 0xc2, 0x1b, 
+	0xf7, 0x87, 0xf0, 0xef, 0xd0, 0xf4, 0x13, 0x30, 0x4b, 0x5d, 0x41, 0xb7, 0x00, 0x0c, 0x86, 0xe0, 
+	0x00, 0x20, 0xcc, 0xdb, 0xe7, 0x01, 0x04, 0x80, 0xe2, 0x3e, 0x20, 0x1c, 0x00, 0x07, 0x00, 0x57, 
+	0x16, 0xfb, 0xf2, 0x57, 0x30, 0x37, 0x4f, 0xbb, 0x40, 0x83, 0x27, 0x00, 0x23, 0x13, 0xbf, 0x92, 
+	0x0b, 0x48, 0x40, 0x1b, 0x10, 0x3f, 0xa9, 0xd0, 0x1b, 0x41, 0x40, 0x1b, 0x26, 0xf0, 0x1b, 0x57, 
+	0x3a, 0x10, 0x1b, 0x0a, 0x74, 0x47, 0xe2, 0x47, 0xc7, 0x4b, 0x34, 0x00, 0x17, 0x06, 0xaf, 0x03, 
+	0xb7, 0x46, 0xc0, 0x17, 0x2e, 0xc1, 0x07, 0x10, 0x8b, 0x90, 0xaf, 0x94, 0x2b, 0x77, 0x23, 0xc0, 
+	0x2b, 0xd0, 0xdb, 0x90, 0x2b, 0x18, 0xd1, 0x5f, 0xf0, 0x2b, 0x60, 0x2b, 0x43, 0x0d, 0x21, 0x3f, 
+	0x18, 0xe3, 0xae, 0x02, 0xf7, 0x1b, 0xf3, 0x27, 0x0b, 0x9a, 0x57, 0xf3, 0x0b, 0x30, 0x2f, 0xa2, 
+	0x40, 0x2f, 0x13, 0x5f, 0x37, 0xaa, 0x02, 0xf3, 0x5f, 0xd0, 0x37, 0xe5, 0x20, 0x37, 0xf3, 0x5f, 
+	0x53, 0x57, 0xdf, 0xf1, 0xab, 0x70, 0x3b, 0xe4, 0x10, 0x3b, 0x43, 0x0f, 0x11, 0x23, 0x12, 0xfb, 
+	0x90, 0xc3, 0x74, 0xdc, 0x80, 0x1f, 0x10, 0x47, 0xd0, 0x1f, 0xd4, 0x60, 0x1f, 0x87, 0xe0, 0xd6, 
+	0x11, 0x0b, 0xd0, 0x1f, 0xcc, 0x00, 0x1f, 0x07, 0x01, 0x9f, 0xd1, 0xb7, 0xc6, 0xf6, 0x40, 0x37, 
+	0x93, 0x37, 0xd0, 0xa7, 0x95, 0x33, 0xba, 0x00, 0x2f, 0x10, 0x5f, 0x1c, 0x17, 0x04, 0xca, 0xe5, 
+	0x90, 0x47, 0xb4, 0xc0, 0x47, 0x12, 0xef, 0xf0, 0x47, 0xc0, 0x87, 0xff, 0x00, 0x2f, 0xd1, 0x30, 
+	0xd9, 0xe0, 0x03, 0x7c, 0xbf, 0xb0, 0x8f, 0xa2, 0x41, 0x43, 0xf2, 0xeb, 0xc9, 0x47, 0x03, 0x33, 
+	0x16, 0x6b, 0x91, 0x43, 0x54, 0x93, 0x50, 0x53, 0x6c, 0xb0, 0x53, 0x8d, 0x40, 0x9b, 0xdc, 0x30, 
+	0x37, 0x9b, 0xe1, 0x10, 0x6f, 0x91, 0xb3, 0x86, 0x90, 0x1b, 0x00, 0x4f, 0x90, 0x1b, 0x74, 0x7f, 
+	0x90, 0x1b, 0x00, 0x53, 0x90, 0x1b, 0x78, 0x00, 0x1b, 0x05, 0x70, 0xba, 0xf1, 0x4f, 0x72, 0x50, 
+	0x83, 0x00, 0x4b, 0x90, 0x17, 0x6c, 0x10, 0x2f, 0x60, 0xbd, 0xf3, 0x1f, 0x66, 0xc1, 0x37, 0xe0, 
+	0xe3, 0x00, 0xaf, 0x91, 0xc7, 0x5a, 0xf0, 0x2f, 0xde, 0xe1, 0x13, 0x90, 0x2f, 0x4e, 0xf0, 0x2f, 
+	0xb0, 0x2f, 0x00, 0xd7, 0x90, 0x2f, 0x42, 0xf2, 0x42, 0xfb, 0x08, 0x70, 0xf6, 0x8b, 0xf2, 0xf3, 
+	0x57, 0x28, 0x40, 0x2f, 0xd7, 0xdd, 0x40, 0x2f, 0x13, 0x2b, 0xdf, 0x00, 0x0b, 0xf0, 0x37, 0xb0, 
+	0x37, 0x1a, 0xf3, 0x2b, 0xf6, 0xf6, 0x8b, 0xd9, 0x77, 0x40, 0xdf, 0x92, 0x47, 0x16, 0x40, 0xdf, 
+	0x12, 0x6f, 0xff, 0x1e, 0xc0, 0x0c, 0xe2, 0x51, 0xe3, 0xa3, 0xff, 0xf0, 0x23, 0xe1, 0x27, 0x04, 
+	0xf3, 0x40, 0x23, 0x10, 0x73, 0x60, 0x23, 0xc1, 0x1b, 0xfb, 0x0a, 0x07, 0x77, 0x2a, 0x67, 0xbc, 
+	0x70, 0x13, 0xf6, 0x00, 0x13, 0xf6, 0x7f, 0xf0, 0xbb, 0xf1, 0x9b, 0x9a, 0x57, 0x41, 0xe7, 0x00, 
+	0x3b, 0x1c, 0x64, 0xda, 0xe5, 0x06, 0x00, 0x67, 0xbd, 0xd2, 0x17, 0xe0, 0x60, 0x57, 0xf6, 0x8b, 
+	0xf2, 0x23, 0xb0, 0x57, 0xd1, 0xf0, 0x3b, 0xef, 0xf0, 0x3b, 0xf0, 0x93, 0x20, 0x3b, 0xc2, 0xf0, 
+	0xcf, 0xf0, 0xcf, 0xf2, 0x3b, 0x20, 0x3b, 0x61, 0xb3, 0x10, 0x3b, 0x10, 0x2f, 0x3c, 0x57, 0xe0, 
+	0x43, 0x00, 0xcf, 0xbd, 0xdd, 0x53, 0xab, 0x50, 0x5b, 0x1d, 0xef, 0x80, 0x23, 0x9a, 0x87, 0xa2, 
+	0xa0, 0x23, 0x68, 0x55, 0xf0, 0x23, 0x00, 0x23, 0x99, 0x80, 0x23, 0x01, 0x00, 0x40, 0x69, 0xe2, 
+	0x10, 0x8b, 0xda, 0x9f, 0x90, 0x10, 0x23, 0x74, 0x87, 0xe6, 0xa7, 0x74, 0x8a, 0x60, 0xa3, 0x70, 
+	0x5b, 0x90, 0xa3, 0x82, 0x10, 0x1f, 0x64, 0x46, 0x5f, 0xe2, 0xd1, 0x8f, 0x7c, 0x40, 0x73, 0xf3, 
+	0x47, 0x11, 0x0b, 0x70, 0xcb, 0x98, 0x03, 0x7b, 0x6f, 0xf0, 0x33, 0x80, 0x33, 0x70, 0x7f, 0x90, 
+	0x33, 0x62, 0xf0, 0x33, 0x60, 0x33, 0xe8, 0x50, 0xeb, 0xf6, 0x43, 0x30, 0x3b, 0x53, 0x00, 0x3b, 
+	0xff, 0x00, 0x13, 0x18, 0xe3, 0xf4, 0x00, 0xf3, 0xbb, 0xf3, 0x83, 0x9a, 0x57, 0x39, 0xb7, 0x40, 
+	0x2f, 0xe8, 0x40, 0x2f, 0x13, 0xbb, 0xea, 0x00, 0x0b, 0xf0, 0x37, 0xb0, 0x37, 0x79, 0x2b, 0x41, 
+	0x43, 0xf3, 0xbb, 0xf3, 0xbb, 0xf0, 0xef, 0x88, 0xe3, 0x9a, 0x3b, 0x7b, 0x26, 0x51, 0xcb, 0x5e, 
+	0x07, 0xf1, 0x17, 0x20, 0x27, 0x1c, 0xc0, 0x27, 0x51, 0x0b, 0xab, 0xda, 0x23, 0x12, 0x00, 0x27, 
+	0x08, 0xc3, 0xa3, 0x0d, 0xf2, 0xd3, 0xf2, 0xd3, 0xcf, 0xf1, 0x93, 0x60, 0x3f, 0xfd, 0x09, 0xf3, 
+	0x4f, 0xf3, 0x4f, 0xf0, 0x3f, 0x50, 0x3f, 0x78, 0xed, 0x40, 0x3f, 0xf0, 0x37, 0xf1, 0xd7, 0xf9, 
+	0xff, 0x9a, 0x57, 0xdd, 0xdb, 0x10, 0x3f, 0x22, 0xb3, 0x56, 0xf2, 0xb3, 0x00, 0x1f, 0xd5, 0x50, 
+	0x9f, 0x23, 0x33, 0xd8, 0x70, 0x23, 0x93, 0x33, 0xcc, 0x80, 0x23, 0x1a, 0xbf, 0x00, 0x5c, 0xd5, 
+	0x74, 0xe0, 0x1d, 0x5f, 0xfe, 0x0f, 0x30, 0x2f, 0xc0, 0x80, 0x2f, 0x01, 0x00, 0x69, 0x80, 0xf3, 
+	0x63, 0x00, 0x23, 0xb7, 0x10, 0x23, 0x64, 0x86, 0xe3, 0x2b, 0x77, 0xb1, 0x40, 0xaf, 0xf0, 0x67, 
+	0xfd, 0xf3, 0xa6, 0x00, 0x2b, 0xa7, 0xff, 0xc1, 0x2b, 0xef, 0xb1, 0x5f, 0x70, 0xdb, 0x91, 0x5f, 
+	0x95, 0xf0, 0x33, 0xab, 0xab, 0xf0, 0x83, 0xbb, 0xab, 0x7d, 0x85, 0xf0, 0x3f, 0x81, 0x9b, 0x30, 
+	0xfb, 0xf3, 0x73, 0x30, 0x3b, 0x76, 0x00, 0x3b, 0x98, 0x13, 0x43, 0x17, 0x00, 0xfa, 0x5b, 0xf3, 
+	0x3b, 0x9a, 0x57, 0x5c, 0xb6, 0x40, 0x2f, 0x0b, 0x40, 0x2f, 0x13, 0x73, 0x13, 0xf3, 0x73, 0xe0, 
+	0x37, 0x4e, 0xe8, 0x10, 0xa3, 0x0f, 0xf3, 0x91, 0x2b, 0x57, 0x00, 0x13, 0x18, 0x18, 0x9a, 0x00, 
+	0xe5, 0x01, 0x00, 0x59, 0xe1, 0x60, 0xf2, 0x9f, 0x28, 0x05, 0x03, 0x00, 0x4b, 0x5c, 0x00, 0x07, 
+	0xbd, 0xf9, 0xff, 0x80, 0x60, 0x17, 0xba, 0xf9, 0xff, 0x1a, 0x44, 0xf2, 0x9f, 0xfd, 0x00, 0x0b, 
+	0xf3, 0xaf, 0xf3, 0xaf, 0xf1, 0x37, 0xd1, 0x37, 0x93, 0xbb, 0x37, 0x52, 0x23, 0xee, 0x8d, 0xf7, 
+	0xf0, 0x33, 0xb1, 0x6b, 0x2a, 0xc0, 0x33, 0x51, 0x5f, 0xd3, 0xc7, 0x20, 0xaf, 0x00, 0x27, 0x08, 
+	0xcd, 0xeb, 0x1b, 0x63, 0x87, 0xf3, 0xc7, 0xf0, 0xbb, 0xf0, 0x87, 0xbe, 0x90, 0x87, 0x08, 0xf3, 
+	0xd3, 0xf3, 0x9b, 0xf0, 0x4b, 0xf0, 0x4b, 0x00, 0x4b, 0xf5, 0x7c, 0x08, 0xf3, 0xdf, 0xf2, 0x43, 
+	0xf3, 0xdf, 0x6c, 0x37, 0x00, 0x3f, 0x20, 0x04, 0x14, 0xda, 0xe5, 0x00, 0x0e, 0x0b, 0x03, 0x02, 
+	0x17, 0x00, 0x80, 0xa8, 0x70, 0x1b, 0xde, 0x00, 0x1b, 0x04, 0x09, 0x5f, 0xf9, 0xff, 0xff, 0x05, 
+	0x1a, 0x84, 0xc0, 0x9f, 0xe5, 0x00, 0x1f, 0xeb, 0x90, 0x3b, 0x44, 0xd6, 0x00, 0x1f, 0x28, 0x04, 
+	0x9a, 0x00, 0x3b, 0x49, 0xe0, 0x28, 0x20, 0x14, 0x0b, 0x97, 0x24, 0x01, 0xf7, 0x10, 0x42, 0xe4, 
+	0x10, 0x01, 0x2c, 0x82, 0x09, 0xc2, 0x42, 0xe4, 0x1c, 0x24, 0x00, 0xca, 0xe5, 0x4d, 0x00, 0x08, 
+	0xe2, 0x02, 0x01, 0x02, 0x13, 0xe3, 0x80, 0x00, 0x80, 0x13, 0x12, 0x7b, 0x02, 0x01, 0x00, 0x80, 
+	0x03, 0x20, 0x00, 0x80, 0xe3, 0x20, 0x2b, 0xc0, 0x40, 0x23, 0x1f, 0x57, 0x28, 0x00, 0x1a, 0xe5, 
+	0x0c, 0x90, 0x80, 0x02, 0x1f, 0x20, 0xd0, 0xe5, 0x02, 0x94, 0x89, 0xe1, 0x00, 0x0e, 0x1a, 0x09, 
+	0xe2, 0xa1, 0x05, 0x94, 0xe7, 0x08, 0x28, 0x04, 0x8a, 0xe5, 0x12, 0x9b, 0x1e, 0xff, 0x2f, 0x00, 
+	0xe1, 0x14, 0x3b, 0x00, 0x06, 0x38, 0x3a, 0x00, 0x00, 0x06, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x60, 
+	0xa0, 0x10, 0xe3, 0xe3, 0x30, 0x0e, 0xc7, 0x20, 0xd0, 0x24, 0x03, 0x08, 0x00, 0x12, 0xe1, 0x02, 
+	0x00, 0xbb, 0x01, 0x80, 0xd0, 0x00, 0xe4, 0x01, 0x80, 0xc1, 0xe4, 0xf7, 0xff, 0xff, 0x5c, 0xea, 
+	0x90, 0x1b, 0x26, 0x02, 0xe3, 0x90, 0x0f, 0x03, 0x2f, 0x0a, 0x00, 0x40, 0x40, 0xb0, 0x3f, 0x01, 
+	0x40, 0x84, 0x12, 0x84, 0x40, 0x38, 0xa0, 0xe1, 0xf0, 0x13, 0xf0, 0x13, 0xf0, 0x13, 0x84, 0x12, 
+	0x00, 0x00, 0x00, 0x54, 0xe3, 0x04, 0x40, 0x51, 0x17, 0x01, 0x08, 0x40, 0xc1, 0xe4, 0xd7, 0x00, 
+	0x7f, 0x01, 0x40, 0xd0, 0x02, 0xe4, 0xa4, 0x70, 0xb0, 0xe1, 0x2e, 0x00, 0x6b, 0x07, 0x15, 0x80, 
+	0x51, 0x27, 0x00, 0x97, 0x24, 0x00, 0x07, 0xe7, 0x10, 0x9f, 0xaa, 0x50, 0x07, 0x01, 0x00, 0xc3, 
+	0xcd, 0x00, 0x2b, 0x1a, 0x01, 0x57, 0x02, 0x00, 0x40, 0x44, 0xe2, 0x00, 0x00, 0x56, 0xe3, 0x09, 
+	0xed, 0x10, 0xc7, 0x00, 0x17, 0x10, 0x4f, 0x05, 0x00, 0x0b, 0x03, 0x9f, 0xeb, 0x60, 0x2f, 0x0a, 
+	0x40, 0x54, 0xe2, 0xfb, 0x01, 0x8b, 0xc0, 0x20, 0x5f, 0x44, 0x44, 0xe2, 0x10, 0xef, 0x04, 0x74, 
+	0x88, 0x09, 0xae, 0x00, 0xeb, 0x09, 0x7d, 0x0c, 0x57, 0xe3, 0x00, 0x87, 0xa2, 0x05, 0x40, 0x07, 
+	0x00, 0x80, 0x00, 0x57, 0xe3, 0x02, 0x40, 0x84, 0xb2, 0xa4, 0xd0, 0x3b, 0xb1, 0x20, 0x3b, 0xa0, 
+	0xe3, 0xf0, 0xc3, 0x84, 0x12, 0xb0, 0x90, 0x0f, 0xf6, 0x00, 0x2b, 0x11, 0x73, 0xf0, 0x47, 0xbd, 
+	0xe8, 0x92, 0x10, 0x07, 0x20, 0x11, 0x00, 0x1b, 0x00, 0x10, 0x01, 0xbf, 0x00, 0x04, 0x3a, 0x48, 
+	0x08, 0x9f, 0x15, 0x00, 0x03, 0x05, 0x06, 0x0d, 0x00, 0x00, 0xea, 0x44, 0x00, 0x07, 0x00, 0x03, 
+	0x15, 0x02, 0x1b, 0x2d, 0xea, 0x3c, 0x00, 0x0b, 0x34, 0x00, 0x0b, 0x01, 0x9d, 0xea, 0x00, 0x07, 
+	0x00, 0xe5, 0x28, 0x15, 0xda, 0xe5, 0x18, 0x00, 0x11, 0x20, 0xe3, 0x28, 0x00, 0x13, 0x39, 0x40, 
+	0x2d, 0xe9, 0x00, 0x00, 0x50, 0x2d, 0xe9, 0x2f, 0x08, 0x00, 0xeb, 0x0c, 0x00, 0x20, 0xa0, 0xe1, 
+	0x00, 0x50, 0xbd, 0xe8, 0xf0, 0x00, 0x00, 0x52, 0xe3, 0xf0, 0x20, 0xa0, 0x83, 0x30, 0x08, 0x05, 
+	0x9a, 0xe5, 0x34, 0x00, 0x2b, 0x2f, 0x01, 0x00, 0x00, 0xeb, 0x04, 0x00, 0x9d, 0xe4, 0x04, 0x30, 
+	0x90, 0x00, 0xe4, 0x10, 0x35, 0x8a, 0xe5, 0x66, 0x1e, 0x8a, 0x00, 0xe2, 0x3c, 0x00, 0xb0, 0xe8, 
+	0x3c, 0x00, 0x81, 0x22, 0xe8, 0x62, 0x60, 0x0b, 0xa1, 0xe8, 0x1c, 0x00, 0x0f, 0x38, 0x00, 0x80, 
+	0xbd, 0xe8, 0x14, 0x15, 0x9a, 0xe5, 0xa1, 0x0a, 0x06, 0x00, 0xe0, 0xc3, 0x0e, 0x0f, 0x20, 0x00, 
+	0x0b, 0x00, 0x00, 0x21, 0x91, 0xe7, 0x06, 0x2a, 0x52, 0xe2, 0x38, 0x0d, 0x20, 0x0a, 0xe5, 0x2b, 
+	0x00, 0x83, 0x50, 0x1f, 0xc4, 0x80, 0x1f, 0x05, 0x02, 0x29, 0x52, 0xe2, 0x34, 0x00, 0x1f, 0x23, 
+	0x80, 0x1f, 0x55, 0xc5, 0x80, 0x1f, 0x0a, 0x00, 0x3f, 0x30, 0x00, 0x1f, 0x1b, 0x80, 0x1f, 0x57, 
+	0xc6, 0x80, 0x1f, 0x03, 0x00, 0x3f, 0x2c, 0x00, 0x1f, 0x01, 0x97, 0x60, 0x1f, 0x56, 0xc7, 0x80, 
+	0x1f, 0x0e, 0x00, 0x3f, 0x28, 0x00, 0x1f, 0x05, 0x63, 0xea, 0x08, 0xa0, 0x00, 0xa0, 0xe1, 0x10, 
+	0x23, 0x21, 0x07, 0x00, 0x30, 0xe0, 0x80, 0x00, 0x0b, 0x10, 0x87, 0x01, 0x20, 0x80, 0xe2, 0x60, 
+	0xc5, 0x02, 0xf3, 0x20, 0x2f, 0x01, 0xb1, 0xe7, 0x02, 0x09, 0x01, 0x50, 0xe2, 0x34, 0x00, 0x0a, 
+	0xe5, 0x30, 0x00, 0x03, 0x22, 0x28, 0x14, 0x03, 0x13, 0x90, 0x49, 0xe0, 0xf2, 0xfb, 0x2f, 0x75, 
+	0xe1, 0xd0, 0x4b, 0x10, 0x93, 0x10, 0x4b, 0xc7, 0x80, 0x4b, 0x03, 0x00, 0x4b, 0x6d, 0x2c, 0x10, 
+	0x47, 0x00, 0x03, 0xeb, 0x01, 0xe7, 0x50, 0x33, 0xa1, 0x00, 0x33, 0x00, 0xa8, 0x16, 0x9f, 0xe5, 
+	0x00, 0x24, 0x80, 0xe1, 0x00, 0x02, 0x28, 0x82, 0xe1, 0x02, 0x21, 0x81, 0xe1, 0x14, 0xc4, 0x24, 
+	0x8a, 0x30, 0x37, 0x02, 0xb0, 0x83, 0x08, 0x00, 0x28, 0xb1, 0xe5, 0x90, 0x47, 0xd9, 0x00, 0x47, 
+	0xbc, 0x48, 0x00, 0x28, 0x03, 0xd8, 0x00, 0x03, 0xf4, 0x00, 0x03, 0x10, 0x49, 0x00, 0x2a, 0x03, 
+	0x2c, 0x00, 0x03, 0x48, 0x00, 0x03, 0x64, 0x00, 0x03, 0x80, 0x80, 0x00, 0x03, 0x1c, 0x25, 0x9a, 
+	0xe5, 0x22, 0x05, 0x00, 0x28, 0xe0, 0xc8, 0x00, 0x93, 0x24, 0x10, 0x53, 0x11, 0x91, 0xe7, 0x06, 
+	0x40, 0x16, 0x8a, 0xe5, 0x9b, 0x01, 0x03, 0x50, 0x1b, 0xc9, 0xaa, 0x80, 0x1b, 0x44, 0x00, 0x1b, 
+	0x94, 0x80, 0x1b, 0xca, 0x80, 0x1b, 0x48, 0xaa, 0x00, 0x1b, 0x8d, 0x80, 0x1b, 0xcb, 0x80, 0x1b, 
+	0x4c, 0x00, 0x1b, 0x86, 0xaa, 0x80, 0x1b, 0xcc, 0x80, 0x1b, 0x50, 0x00, 0x1b, 0x7f, 0x80, 0x1b, 
+	0xcd, 0xaa, 0x80, 0x1b, 0x54, 0x00, 0x1b, 0x78, 0x80, 0x1b, 0xce, 0x80, 0x1b, 0x58, 0xaa, 0x00, 
+	0x1b, 0x71, 0x80, 0x1b, 0xcf, 0x80, 0x1b, 0x5c, 0x00, 0x1b, 0x6a, 0xf3, 0x41, 0xc7, 0x11, 0x73, 
+	0x90, 0xe7, 0x01, 0x7b, 0xe3, 0xc9, 0x01, 0x7b, 0x90, 0xef, 0x0b, 0x01, 0x1b, 0x81, 0xe2, 0x10, 
+	0xdb, 0x5d, 0xf0, 0x33, 0x20, 0xe3, 0xbd, 0x10, 0x33, 0xcb, 0x80, 0x33, 0x10, 0xeb, 0x10, 0x33, 
+	0x10, 0xd7, 0x50, 0xf0, 0x33, 0xde, 0x20, 0xdf, 0x10, 0x33, 0xcd, 0x80, 0x33, 0x10, 0xe7, 0x10, 
+	0x33, 0x10, 0xd3, 0x43, 0xef, 0xf0, 0x33, 0x20, 0xdb, 0x10, 0x33, 0xcf, 0x80, 0x33, 0x10, 0xe3, 
+	0x10, 0x33, 0x10, 0xcf, 0x60, 0x36, 0x50, 0xeb, 0x02, 0xb7, 0x00, 0x14, 0x80, 0xe1, 0x01, 0x04, 
+	0x18, 0x81, 0xe1, 0x8c, 0x24, 0x07, 0xa3, 0x21, 0x82, 0x34, 0xe1, 0xc8, 0x02, 0x13, 0x20, 0x33, 
+	0x12, 0x03, 0x47, 0x0c, 0x8a, 0x20, 0xe2, 0x40, 0x06, 0x3b, 0x01, 0x2b, 0x81, 0xe2, 0x06, 0x02, 
+	0x00, 0xa0, 0xe8, 0x01, 0x1b, 0x82, 0x60, 0x0b, 0x25, 0xd5, 0x40, 0x77, 0x10, 0x47, 0xa2, 0x80, 
+	0x47, 0x44, 0x00, 0x47, 0x81, 0x40, 0x47, 0x57, 0x3c, 0x40, 0x0b, 0xcc, 0x40, 0x53, 0x80, 0xf0, 
+	0x53, 0xa0, 0x53, 0x10, 0x0b, 0xce, 0x04, 0xc7, 0xe0, 0x9b, 0xf0, 0x23, 0x30, 0x9b, 0x50, 0x47, 
+	0x50, 0x9b, 0x50, 0xd0, 0xf0, 0x47, 0x20, 0x0b, 0x38, 0x04, 0x63, 0x0f, 0xe0, 0xa0, 0xe1, 0x00, 
+	0xc0, 0xf3, 0x9f, 0xe5, 0x58, 0x24, 0xda, 0xe5, 0x00, 0x10, 0x00, 0x12, 0xe3, 0xc8, 0x14, 0x9a, 
+	0x05, 0x08, 0xcc, 0x14, 0x9a, 0x15, 0x14, 0x67, 0x30, 0x15, 0x8a, 0x16, 0xe5, 0x0e, 0x07, 0x34, 
+	0x83, 0x38, 0x84, 0x83, 0x14, 0x7f, 0x01, 0x20, 0x10, 0x52, 0x13, 0x6b, 0x01, 0x03, 0x00, 0x51, 
+	0xe3, 0x04, 0x0c, 0x00, 0x00, 0x5a, 0x04, 0x04, 0xb3, 0x01, 0x2b, 0x00, 0x8a, 0xe2, 0xd0, 0x20, 
+	0x82, 0xe2, 0x04, 0x10, 0x4a, 0x92, 0x07, 0x63, 0x50, 0xe1, 0x00, 0x07, 0x14, 0x00, 0x07, 0x11, 
+	0x80, 0xe0, 0x07, 0x80, 0xbd, 0x18, 0x04, 0x40, 0xbd, 0x08, 0x60, 0xfc, 0x00, 0x7f, 0x15, 0xb3, 
+	0x7c, 0x00, 0xbd, 0xe8, 0x00, 0xa0, 0x00, 0x53, 0x10, 0x00, 0x73, 0x00, 0x10, 0x81, 0xe1, 0x34, 
+	0x02, 0x05, 0xda, 0xe5, 0x34, 0x25, 0xca, 0x07, 0x2b, 0x52, 0x43, 0xe3, 0x05, 0x37, 0x0a, 0x00, 
+	0x20, 0x52, 0x09, 0x7f, 0x10, 0x07, 0x00, 0x82, 0xb0, 0x00, 0x00, 0xa0, 0xb3, 0xb0, 0x76, 0x84, 
+	0x01, 0x23, 0x00, 0x87, 0xe0, 0x47, 0x05, 0x03, 0x80, 0x90, 0x02, 0xbd, 0xe8, 0x0e, 0xc0, 0xa0, 
+	0xe1, 0x10, 0xaf, 0xea, 0x09, 0xff, 0xff, 0xeb, 0x1c, 0x03, 0xff, 0x01, 0x6b, 0x00, 0x87, 0x09, 
+	0x60, 0x86, 0xe2, 0x06, 0x15, 0x3b, 0x10, 0x92, 0x07, 0x3b, 0x9c, 0x10, 0x8b, 0xb2, 0x15, 0x30, 
+	0x83, 0xb0, 0x07, 0x06, 0x8c, 0x1a, 0x05, 0x00, 0x4c, 0x8a, 0xe2, 0x00, 0x40, 0x84, 0xe2, 0x06, 
+	0x09, 0x70, 0x42, 0xe0, 0x07, 0x10, 0x33, 0x00, 0xd4, 0x00, 0x7b, 0x01, 0x57, 0xe1, 0x62, 0x24, 
+	0x80, 0x11, 0x01, 0x80, 0x0b, 0x52, 0x02, 0x80, 0x0b, 0x03, 0x80, 0x0b, 0x62, 0x24, 0x00, 0x33, 
+	0x20, 0x2c, 0x84, 0xe5, 0x14, 0x7b, 0x00, 0x11, 0x93, 0x0f, 0xe7, 0x07, 0x10, 0x00, 0x96, 0xe7, 
+	0x07, 0x00, 0xa6, 0xe7, 0x62, 0x2c, 0x91, 0x00, 0x1b, 0x25, 0x8a, 0x20, 0x1b, 0x10, 0x70, 0xa0, 
+	0x06, 0x6f, 0x28, 0xd3, 0xe4, 0x06, 0xaf, 0xe1, 0x01, 0xbf, 0x0a, 0x01, 0x70, 0x12, 0x57, 0xe2, 
+	0xfa, 0x46, 0x3b, 0x40, 0x32, 0x04, 0x73, 0x70, 0x18, 0xd3, 0xe5, 0x07, 0x00, 0x1b, 0x00, 0x0f, 
+	0x11, 0x06, 0x00, 0x00, 0x2d, 0xe9, 0x30, 0x12, 0x9f, 0xe5, 0x84, 0x15, 0x30, 0x81, 0xe0, 0x16, 
+	0x3b, 0x10, 0x0f, 0x06, 0x14, 0xa0, 0xe3, 0x00, 0x10, 0x70, 0x67, 0xe2, 0x0c, 0x20, 0x07, 0xe2, 
+	0x04, 0x03, 0x70, 0x07, 0xe2, 0x87, 0x00, 0x1b, 0x02, 0x16, 0x01, 0x81, 0xe0, 0x0f, 0x00, 0xc6, 
+	0xe5, 0x05, 0x02, 0x63, 0x04, 0x02, 0x2b, 0xa0, 0xe3, 0x27, 0x01, 0x13, 0x02, 0x5b, 0x45, 0x85, 
+	0x01, 0xdf, 0xbd, 0xe8, 0x0d, 0x00, 0x37, 0x00, 0x01, 0x97, 0x04, 0xec, 0x21, 0x9f, 0xe5, 0xff, 
+	0x06, 0x5b, 0x01, 0x00, 0x1a, 0xd6, 0xe4, 0x21, 0x08, 0x7b, 0x00, 0x1f, 0x02, 0x11, 0x57, 0xd8, 
+	0x20, 0x31, 0x9f, 0x14, 0xb3, 0xeb, 0x40, 0x30, 0xa0, 0xe3, 0x91, 0x10, 0x43, 0x24, 0x45, 0x01, 
+	0x7f, 0x41, 0x94, 0xe7, 0x06, 0xb7, 0x02, 0xeb, 0x03, 0x00, 0x16, 0xe3, 0xf1, 0x00, 0x9b, 0x00, 
+	0x81, 0x06, 0x3b, 0x42, 0x54, 0x2d, 0xe9, 0xff, 0xe0, 0x07, 0x67, 0x00, 0x1e, 0xb4, 0xe8, 0x09, 
+	0x70, 0x1e, 0xe0, 0x07, 0x00, 0x71, 0x92, 0x17, 0x0b, 0x80, 0x1e, 0xe0, 0x08, 0x00, 0x81, 0x92, 
+	0x17, 0x88, 0x00, 0x87, 0xe1, 0x29, 0x4a, 0x74, 0x30, 0x13, 0x2b, 0x84, 0x40, 0x13, 0x10, 0x00, 
+	0x13, 0x78, 0xaa, 0x40, 0x13, 0x88, 0x40, 0x13, 0x60, 0x00, 0x13, 0x7c, 0x40, 0x13, 0x8c, 0x80, 
+	0x40, 0x13, 0x70, 0x87, 0xe1, 0xc3, 0x00, 0xa5, 0xe8, 0x55, 0x0a, 0x40, 0x53, 0x0c, 0x80, 0x53, 
+	0x2a, 0x40, 0x53, 0x2c, 0x80, 0x53, 0x55, 0x2a, 0x40, 0x53, 0x2c, 0x80, 0x53, 0x2a, 0x40, 0x53, 
+	0x2c, 0xc0, 0x53, 0x04, 0x01, 0x30, 0x53, 0xe2, 0xd2, 0x00, 0xbf, 0x42, 0x94, 0x0a, 0xbd, 0xe8, 
+	0x40, 0x42, 0x40, 0xbf, 0x0e, 0x00, 0xbf, 0x50, 0x08, 0x1e, 0xe0, 0x05, 0x51, 0x00, 0xbf, 0xc0, 
+	0x1e, 0xe0, 0x00, 0x0c, 0xc1, 0x92, 0x17, 0x8c, 0x00, 0x85, 0xe1, 0x25, 0x29, 0x54, 0x30, 0x13, 
+	0x2b, 0xc4, 0x40, 0x13, 0x10, 0x00, 0x13, 0x55, 0x58, 0x40, 0x13, 0xc8, 0x40, 0x13, 0x60, 0x00, 
+	0x13, 0x5c, 0x40, 0x13, 0x40, 0xcc, 0x40, 0x13, 0xc0, 0x85, 0xe1, 0x43, 0x10, 0xa7, 0x00, 0xe8, 
+	0x43, 0x10, 0xa8, 0xe8, 0x00, 0x02, 0xb4, 0x2a, 0xe8, 0x0a, 0x40, 0x5b, 0x09, 0x80, 0x5b, 0x2a, 
+	0x40, 0x5b, 0x29, 0xaa, 0x80, 0x5b, 0x2a, 0x40, 0x5b, 0x29, 0x80, 0x5b, 0x2a, 0x40, 0x5b, 0x29, 
+	0xd0, 0xf0, 0x5b, 0x20, 0xcb, 0xcf, 0x00, 0xcb, 0x40, 0x82, 0xbd, 0xe8, 0x05, 0x58, 0x64, 0x00, 
+	0x08, 0x34, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x50, 0xa0, 0x00, 0x03, 0xc4, 0x00, 0x03, 0x00, 0x01, 
+	0x02, 0x03, 0x00, 0x04, 0x05, 0x06, 0x07, 0xcc, 0x63, 0x00, 0x03, 0x10, 0x50, 0xef, 0x03, 0x01, 
+	0xbe, 0x01, 0x06, 0xec, 0x76, 0x88, 0x06, 0x7b, 0x73, 0x00, 0x03, 0x18, 0xa7, 0x04, 0x40, 0xb5, 
+	0x02, 0x25, 0x03, 0x00, 0x14, 0xe1, 0x08, 0x01, 0xf3, 0x06, 0x00, 0x80, 0xd2, 0xe7, 0x06, 0xa0, 
+	0xd7, 0xe7, 0x0a, 0x30, 0x00, 0x58, 0x1a, 0xc3, 0x02, 0x86, 0x51, 0xe3, 0x03, 0x40, 0x06, 0xc4, 
+	0x11, 0x00, 0x40, 0x85, 0x28, 0x8b, 0x1b, 0x03, 0x01, 0x82, 0x03, 0x3b, 0x0a, 0x0b, 0x56, 0xe3, 
+	0xef, 0x00, 0x73, 0xfe, 0x80, 0x48, 0xd3, 0x00, 0x12, 0x90, 0xe5, 0x21, 0x38, 0x11, 0x80, 0x23, 
+	0xf3, 0xb8, 0x20, 0x50, 0xe1, 0x03, 0x20, 0x82, 0x00, 0xe1, 0xb8, 0x20, 0x40, 0xe1, 0x80, 0x20, 
+	0x13, 0x00, 0xe2, 0xe4, 0xf0, 0x9f, 0x15, 0xff, 0x0c, 0x13, 0x00, 0xe3, 0x23, 0x34, 0xa0, 0x11, 
+	0x08, 0x20, 0x82, 0x20, 0x12, 0xf0, 0x0a, 0xbb, 0x23, 0x32, 0xa0, 0x11, 0x04, 0xa1, 0x00, 0x0b, 
+	0x0c, 0x10, 0x0b, 0x31, 0xa0, 0x11, 0x02, 0x00, 0x0b, 0x54, 0x02, 0x00, 0x0b, 0x01, 0x00, 0x07, 
+	0x01, 0x02, 0x6f, 0x13, 0x32, 0x80, 0x02, 0x87, 0xcc, 0x80, 0xe2, 0xb2, 0x30, 0xcc, 0xe1, 0x40, 
+	0xa8, 0x0b, 0x2f, 0x02, 0xc1, 0x9c, 0xe7, 0x0c, 0xc0, 0x00, 0xb0, 0xe1, 0xe4, 0xff, 0xff, 0x0a, 
+	0xe6, 0x0c, 0x24, 0x11, 0xe3, 0x03, 0xc7, 0x11, 0x08, 0x00, 0x73, 0x08, 0x02, 0x01, 0x80, 0xe5, 
+	0x00, 0x30, 0x4f, 0xe1, 0x0b, 0x19, 0x13, 0x00, 0x10, 0x0f, 0xe1, 0xdf, 0x10, 0xc1, 0xe3, 0x1f, 
+	0x01, 0x10, 0x81, 0xe3, 0x01, 0xf0, 0x29, 0xe1, 0x12, 0xdb, 0xcd, 0x1b, 0xa7, 0x13, 0xf3, 0x00, 
+	0x40, 0x04, 0x43, 0x40, 0x1f, 0x92, 0x40, 0x1f, 0x40, 0x0b, 0x00, 0x13, 0x08, 0x12, 0x80, 0xe5, 
+	0x03, 0xf0, 0x60, 0x69, 0x60, 0xbf, 0x11, 0x47, 0x04, 0x10, 0x90, 0xe5, 0x20, 0xc2, 0x03, 0x0f, 
+	0x10, 0xcb, 0x21, 0x28, 0xa0, 0xe1, 0x13, 0x13, 0xff, 0x0c, 0x10, 0x01, 0xe2, 0xa0, 0x01, 0x0b, 
+	0x00, 0x13, 0xa1, 0xa0, 0xc4, 0x04, 0x77, 0x10, 0x07, 0x01, 0x00, 0x52, 0x13, 0x8b, 0xb1, 0x0b, 
+	0x42, 0xb0, 0x00, 0xab, 0x20, 0xa0, 0xe3, 0xd4, 0x07, 0xdf, 0x00, 0x0a, 0x68, 0x00, 0x08, 0xac, 
+	0x01, 0x5b, 0x11, 0x14, 0x67, 0x29, 0x00, 0x4c, 0xe2, 0x15, 0x20, 0x52, 0xe2, 0x88, 0x00, 0x10, 
+	0x00, 0x4a, 0x03, 0x00, 0x33, 0x02, 0xf1, 0x9f, 0x47, 0x00, 0x08, 0xf0, 0x9f, 0xe5, 0xd8, 0x8c, 
+	0x00, 0x08, 0x00, 0xcc, 0x30, 0x00, 0x06, 0x04, 0x31, 0x00, 0x06, 0x0a, 0xb8, 0x52, 0x00, 0x03, 
+	0x10, 0x27, 0x18, 0x40, 0x1f, 0x5c, 0x80, 0x00, 0x1f, 0xe8, 0x85, 0x00, 0x08, 0x70, 0x86, 0x00, 
+	0x28, 0x08, 0x80, 0x00, 0x03, 0xd8, 0x00, 0x03, 0x34, 0x87, 0x00, 0x28, 0x08, 0xbc, 0x00, 0x03, 
+	0xcc, 0x00, 0x03, 0x24, 0x88, 0x00, 0x2a, 0x08, 0x60, 0x00, 0x03, 0xbc, 0x00, 0x37, 0x68, 0x00, 
+	0x07, 0xa4, 0xa0, 0x00, 0x03, 0xe4, 0x40, 0x0f, 0x2c, 0x89, 0x00, 0x08, 0x64, 0xa6, 0x00, 0x03, 
+	0x8c, 0x00, 0x03, 0x10, 0x8a, 0x00, 0x2b, 0x00, 0x03, 0x3c, 0x96, 0x00, 0x03, 0xc4, 0x80, 0x00, 
+	0x43, 0x8b, 0x00, 0x4f, 0x00, 0x73, 0x68, 0xae, 0x00, 0x7b, 0xc0, 0x00, 0x2b, 0xa2, 0x04, 0xc7, 
+	0x1a, 0x67, 0x16, 0x17, 0x02, 0x80, 0x0a, 0x8b, 0xb2, 0x10, 0xc0, 0x10, 0x01, 0x20, 0x42, 0x2a, 
+	0x12, 0x0c, 0x00, 0xaf, 0x18, 0x00, 0xaf, 0x38, 0x15, 0xaf, 0x30, 0xcd, 0x0f, 0xa3, 0x0a, 0xdb, 
+	0x01, 0x50, 0x00, 0x03, 0x05, 0x43, 0x01, 0x06, 0x0b, 0x0d, 0x3a, 0x50, 0xa0, 0xe8, 0x10, 0x23, 
+	0x02, 0x44, 0x4a, 0x50, 0x0b, 0x81, 0x0c, 0xd3, 0x5a, 0x0c, 0x20, 0x92, 0xe2, 0x38, 0x05, 0xb3, 
+	0xb0, 0x11, 0x33, 0x04, 0x00, 0x13, 0x0b, 0x6f, 0x4a, 0x02, 0x10, 0xa0, 0x78, 0xe8, 0x10, 0x0b, 
+	0x10, 0x2b, 0x50, 0x0b, 0x10, 0x2b, 0x08, 0x20, 0x42, 0xca, 0x10, 0x2b, 0x00, 0x3b, 0x92, 0xe2, 
+	0x00, 0x2f, 0xd1, 0x00, 0x7b, 0xe0, 0x43, 0x01, 0x00, 0x1b, 0xfc, 0xff, 0xff, 0xca, 0x2b, 0x1f, 
+	0x00, 0x0b, 0x80, 0x0b, 0xbb, 0xba, 0xf8, 0x07, 0x2d, 0xe9, 0xf8, 0x07, 0x03, 0xb1, 0xe8, 0xf8, 
+	0x07, 0xa0, 0xe8, 0x10, 0x13, 0x00, 0xaf, 0xe1, 0x00, 0x13, 0x70, 0x0f, 0x0c, 0x9b, 0xaa, 0xf8, 
+	0x07, 0xbd, 0x00, 0x0b, 0x80, 0x30, 0x47, 0x04, 0xc0, 0x91, 0xe4, 0x04, 0xc0, 0x80, 0x72, 0xe4, 
+	0x10, 0x67, 0x0b, 0x9f, 0x20, 0x4b, 0x01, 0xc0, 0x0c, 0xc7, 0xc0, 0xe1, 0x0b, 0xb3, 0x90, 0x13, 
+	0x05, 0xef, 0xe5, 0xff, 0xff, 0xda, 0x0d, 0x3f, 0x06, 0xe0, 0x02, 0x10, 0x81, 0xe0, 0x10, 0x4b, 
+	0x00, 0xaf, 0xba, 0x24, 0xf8, 0x03, 0x00, 0x6f, 0x13, 0x31, 0x00, 0x03, 0x20, 0xe9, 0xc4, 0x10, 
+	0x13, 0x00, 0x2f, 0xaa, 0xf8, 0x03, 0x90, 0x5f, 0x31, 0xe5, 0x0a, 0x04, 0xc0, 0x20, 0xe5, 0x90, 
+	0x5f, 0x10, 0x00, 0x0b, 0x07, 0x80, 0x40, 0x3b, 0x78, 0x00, 0x91, 0xe8, 0x80, 0x13, 0x90, 0x21, 
+	0xe8, 0x78, 0x07, 0x3b, 0x80, 0x13, 0xa1, 0xe8, 0x10, 0x1b, 0xd1, 0x00, 0xef, 0x20, 0x43, 0x10, 
+	0x40, 0x43, 0x00, 0xc0, 0x91, 0x02, 0xaf, 0x07, 0x90, 0xe5, 0x04, 0x30, 0x81, 0x60, 0xab, 0x00, 
+	0x23, 0x20, 0x4b, 0x02, 0x2c, 0x04, 0xa0, 0xe1, 0x0e, 0xf0, 0x30, 0x03, 0x7e, 0x25, 0xcb, 0xcc, 
+	0x07, 0x37, 0xdb, 0xe7, 0x70, 0x0b, 0xcb, 0x20, 0x0b, 0x18, 0x16, 0x1b, 0x4c, 0x0e, 0x33, 0x30, 
+	0x17, 0x16, 0xcb, 0x4c, 0x60, 0xe2, 0xb0, 0x17, 0x00, 0x0b, 0x14, 0x8c, 0xe3, 0x02, 0x19, 0x49, 
+	0x81, 0x0c, 0xff, 0xc1, 0xe5, 0x10, 0x17, 0x38, 0x10, 0x0e, 0x0b, 0x2a, 0x00, 0xd1, 0x20, 0x23, 
+	0x34, 0x80, 0x0b, 0x30, 0x80, 0x0b, 0x2c, 0xb0, 0x80, 0x0b, 0x28, 0x80, 0x0b, 0x08, 0x9b, 0xeb, 
+	0x05, 0x20, 0x62, 0x30, 0xe2, 0x04, 0x03, 0x8f, 0x02, 0xbf, 0xe1, 0x34, 0x00, 0x00, 0x00, 0x0b, 
+	0x0b, 0x01, 0x97, 0xe7, 0x0c, 0x08, 0x80, 0x80, 0x07, 0x6f, 0x84, 0xe4, 0xb2, 0x00, 0xd8, 0xe0, 
+	0xb2, 0x28, 0x00, 0xc5, 0x00, 0x03, 0xd9, 0x00, 0x03, 0xc6, 0xe0, 0x01, 0x15, 0xb0, 0x8b, 0xe2, 
+	0x14, 0x8b, 0xf3, 0x03, 0x43, 0x0a, 0x06, 0xa7, 0x01, 0xee, 0xff, 0xff, 0xba, 0x00, 0x84, 0xbd, 
+	0x04, 0x9f, 0x24, 0xe0, 0xe3, 0x07, 0x47, 0xeb, 0x04, 0x00, 0x4b, 0x08, 0x30, 0x40, 0x83, 0x00, 
+	0xa7, 0x13, 0xe3, 0x20, 0x00, 0x00, 0x1b, 0xd0, 0xf0, 0x4b, 0xb0, 0x4b, 0xc3, 0x00, 0x73, 0x01, 
+	0x30, 0x83, 0x03, 0x6a, 0x02, 0x00, 0x53, 0x06, 0x6b, 0x5a, 0x10, 0x53, 0xec, 0x00, 0x53, 0xe9, 
+	0xc7, 0x13, 0x67, 0x03, 0x6f, 0x0b, 0x10, 0x82, 0x02, 0x37, 0x08, 0xaf, 0x00, 0x47, 0x05, 0x20, 
+	0x18, 0x81, 0xe0, 0x03, 0x03, 0xa3, 0xff, 0x03, 0xa3, 0xfd, 0x1d, 0xeb, 0x20, 0x1b, 0xc0, 0x17, 
+	0x22, 0x9b, 0x18, 0xa3, 0x00, 0x43, 0xff, 0x00, 0x3f, 0x80, 0x22, 0x0b, 0x30, 0xc3, 0xe3, 0x01, 
+	0xc0, 0x8c, 0xe2, 0x00, 0x02, 0x80, 0x88, 0xe2, 0x02, 0x90, 0x89, 0xe2, 0x02, 0x1c, 0xf0, 0x8e, 
+	0xe2, 0xf0, 0x5f, 0x04, 0x37, 0xaa, 0x80, 0x09, 0x2b, 0x53, 0xa0, 0xe3, 0xba, 0x5b, 0xc5, 0xe1, 
+	0x00, 0xb6, 0x5c, 0xc5, 0xe1, 0xbe, 0x5d, 0xc5, 0xe1, 0x80, 0x19, 0x0b, 0xec, 0xf9, 0x9f, 0xe5, 
+	0xf8, 0x06, 0xda, 0x00, 0xe5, 0x02, 0x00, 0x50, 0xe3, 0x6e, 0x00, 0x00, 0x20, 0xaa, 0x01, 0x07, 
+	0x77, 0x02, 0x00, 0xa0, 0xe3, 0xf8, 0x50, 0x06, 0x0a, 0x2b, 0x03, 0x07, 0xbf, 0x10, 0xa0, 0xe3, 
+	0x08, 0x0b, 0x12, 0xc0, 0xe5, 0x0c, 0x08, 0x6f, 0x08, 0x03, 0x57, 0x18, 0x97, 0x36, 0x75, 0x04, 
+	0x09, 0x0f, 0x05, 0x37, 0x06, 0x00, 0x33, 0x08, 0x9f, 0x53, 0x6a, 0x75, 0x0a, 0x57, 0x10, 0x4b, 
+	0xa4, 0x00, 0x4b, 0xf9, 0x00, 0x4b, 0x00, 0x08, 0x00, 0xb0, 0xe1, 0x41, 0x00, 0x27, 0xc0, 0x26, 
+	0x9a, 0x00, 0xe5, 0x0a, 0x3d, 0x82, 0xe2, 0xa4, 0x16, 0x9a, 0x39, 0xe5, 0x0d, 0x08, 0xe3, 0x10, 
+	0x63, 0x01, 0x83, 0x2a, 0x77, 0x00, 0x3f, 0x00, 0x00, 0x11, 0x81, 0xe0, 0xf0, 0x00, 0xb1, 0xe8, 
+	0x00, 0x00, 0x48, 0x84, 0xe0, 0x00, 0x58, 0x85, 0xe0, 0x01, 0x00, 0x68, 0x86, 0xe0, 0x00, 0x78, 
+	0x87, 0x00, 0x13, 0x36, 0xa2, 0xe8, 0x11, 0x9b, 0x03, 0x0b, 0x4a, 0x1e, 0x53, 0x0d, 0x2b, 0x1a, 
+	0x50, 0x80, 0x03, 0xb7, 0xbc, 0x00, 0x43, 0xc4, 0x06, 0x9a, 0xe5, 0x35, 0x05, 0x2d, 0x01, 0xbb, 
+	0x02, 0xe3, 0x29, 0x07, 0xc7, 0xb4, 0x00, 0x13, 0x56, 0xc8, 0x80, 0x13, 0x24, 0x00, 0x13, 0x0f, 
+	0x04, 0x03, 0x10, 0x2b, 0xb4, 0xa0, 0x00, 0x7b, 0x80, 0x00, 0x13, 0x80, 0x20, 0x82, 0xe0, 0xc4, 
+	0x40, 0x36, 0x00, 0x27, 0x46, 0x9a, 0xe5, 0xa0, 0x50, 0xa0, 0x0a, 0xe3, 0xb2, 0x00, 0xd1, 0x01, 
+	0x8f, 0xc3, 0x00, 0x03, 0xd2, 0x82, 0x00, 0x03, 0xc4, 0xe0, 0x01, 0x50, 0x55, 0x12, 0xaf, 0x1a, 
+	0x64, 0x01, 0x00, 0x37, 0x10, 0xc3, 0xe4, 0xf8, 0x31, 0x27, 0xb0, 0x40, 0x18, 0x85, 0xe2, 0xc0, 
+	0x00, 0x5b, 0x05, 0x3b, 0xe4, 0x10, 0x20, 0x00, 0x85, 0xe2, 0x00, 0x10, 0x82, 0xe5, 0xcc, 0x38, 
+	0x02, 0x9f, 0xe5, 0x0d, 0x00, 0xa4, 0xe8, 0x10, 0x87, 0xb2, 0x08, 0x10, 0xd0, 0xe0, 0x00, 0x00, 
+	0x17, 0xb0, 0x10, 0xc2, 0x2e, 0xe1, 0xb8, 0x40, 0x17, 0x0c, 0x09, 0x53, 0x10, 0x8f, 0x10, 0x1b, 
+	0x08, 0xd9, 0x40, 0x1b, 0x10, 0x17, 0x01, 0x08, 0x9b, 0x03, 0xa3, 0xe3, 0x16, 0x21, 0x5f, 0xbe, 
+	0x31, 0x5b, 0xff, 0x01, 0x0f, 0x11, 0x27, 0x16, 0xa3, 0x12, 0x4b, 0x10, 0x7b, 0x74, 0xd5, 0x00, 
+	0x7b, 0x10, 0x07, 0x70, 0x40, 0x07, 0x6c, 0x40, 0x07, 0x68, 0x00, 0x07, 0x84, 0x01, 0x67, 0xe3, 
+	0xfe, 0x05, 0xca, 0x01, 0xab, 0xca, 0xe5, 0x44, 0x5c, 0x0f, 0x3f, 0x00, 0x00, 0x90, 0x20, 0x3f, 
+	0x04, 0xe0, 0x02, 0x8f, 0x12, 0x50, 0xc8, 0x9f, 0x15, 0x16, 0x3f, 0xf0, 0x78, 0x9f, 0x03, 0x97, 
+	0x06, 0xd4, 0x16, 0x27, 0x10, 0x67, 0xe0, 0x01, 0x8f, 0x02, 0xe5, 0x02, 0xbb, 0xa0, 0xe3, 0xa4, 
+	0x0a, 0x3f, 0x01, 0x00, 0x70, 0x87, 0xe2, 0xdc, 0x86, 0x9a, 0xe5, 0x28, 0x00, 0x98, 0x9f, 0xe5, 
+	0xac, 0xc6, 0x9a, 0xe5, 0x07, 0x08, 0x24, 0xa0, 0xe3, 0x0c, 0x0b, 0x33, 0x03, 0x5c, 0x01, 0x00, 
+	0xe2, 0x03, 0x0c, 0x55, 0xe3, 0x03, 0x6c, 0xa0, 0x03, 0x03, 0x00, 0x60, 0xa0, 0x13, 0x01, 0x00, 
+	0x0b, 0x09, 0x47, 0x10, 0x1a, 0x34, 0x34, 0x00, 0x1b, 0x3c, 0x13, 0xe2, 0x03, 0x10, 0x3c, 0x33, 
+	0x12, 0x04, 0xbb, 0x1a, 0x21, 0x38, 0xa0, 0x40, 0xe1, 0x16, 0x43, 0x03, 0x01, 0xdc, 0x07, 0xe8, 
+	0x07, 0x8c, 0x1f, 0xd3, 0xd0, 0x17, 0xef, 0x00, 0xd3, 0x05, 0x0b, 0x8a, 0x00, 0x00, 0x01, 0x80, 
+	0xe0, 0x20, 0x02, 0xa0, 0xe1, 0x77, 0xc8, 0x02, 0x07, 0x11, 0xdb, 0xcc, 0x57, 0x00, 0x9f, 0x50, 
+	0x45, 0xe0, 0x54, 0x59, 0x00, 0x0b, 0x20, 0x01, 0xc3, 0x29, 0x00, 0x3f, 0x04, 0x30, 0x02, 0x9c, 
+	0xe4, 0xff, 0x00, 0x03, 0xe2, 0x10, 0x33, 0x22, 0x80, 0x00, 0x33, 0xf8, 0x40, 0x00, 0xe2, 0x00, 
+	0x11, 0xd7, 0x20, 0xe7, 0x80, 0x02, 0xcb, 0xa1, 0x42, 0x84, 0xe0, 0x03, 0x00, 0x19, 0x03, 0xe2, 
+	0x21, 0x47, 0x84, 0xe0, 0x04, 0x00, 0x40, 0xd8, 0xe7, 0xd4, 0x40, 0x99, 0xe1, 0x02, 0x01, 0x01, 
+	0x14, 0xe3, 0x04, 0x43, 0x8b, 0xe0, 0x00, 0xff, 0x01, 0x11, 0x80, 0xf7, 0x9f, 0x15, 0x3f, 0x1c, 
+	0x00, 0x1f, 0x40, 0x44, 0x02, 0x2b, 0x00, 0xd5, 0xe7, 0x01, 0x1c, 0x16, 0x00, 0xe2, 0x02, 0x1c, 
+	0x81, 0xe2, 0x01, 0x05, 0x13, 0x00, 0x13, 0x40, 0x10, 0x81, 0x12, 0x01, 0x19, 0x53, 0x01, 0xe0, 
+	0xff, 0x14, 0x01, 0xe2, 0x21, 0x04, 0x0c, 0x17, 0x00, 0x04, 0x80, 0x33, 0x03, 0x15, 0x03, 0xe2, 
+	0x01, 0x48, 0x03, 0x0e, 0xcf, 0x16, 0x03, 0x0f, 0x2b, 0x80, 0xe1, 0x06, 0x00, 0x00, 0x80, 0xe1, 
+	0x04, 0x00, 0x82, 0xe4, 0x03, 0x00, 0x08, 0x03, 0xe2, 0x20, 0x02, 0x84, 0xe1, 0xb4, 0x01, 0x00, 
+	0xc2, 0xe0, 0xff, 0x00, 0x1c, 0xe3, 0x0a, 0x0b, 0x9c, 0x29, 0xef, 0x2a, 0x0e, 0x02, 0xe3, 0x00, 
+	0x1f, 0x02, 0x07, 0xea, 0x02, 0x15, 0x69, 0x86, 0xe3, 0x90, 0xab, 0x24, 0x40, 0xab, 0x01, 0x10, 
+	0x7f, 0x60, 0x43, 0xf0, 0xa7, 0x90, 0xa7, 0xd8, 0xf6, 0x9f, 0x15, 0x3e, 0x88, 0x40, 0xa7, 0x03, 
+	0x0c, 0x16, 0x03, 0xb7, 0x40, 0x12, 0xff, 0x3e, 0x00, 0x00, 0x01, 0xde, 0xf0, 0xb3, 0xf0, 0xb3, 
+	0xf0, 0xb3, 0xf0, 0xb3, 0x1c, 0x28, 0xe3, 0xd7, 0xf0, 0xb3, 0xea, 0x11, 0xf2, 0x07, 0x00, 0x0c, 
+	0x04, 0xe2, 0x00, 0xf1, 0x9f, 0xe7, 0x10, 0x0b, 0x7c, 0x58, 0x24, 0x00, 0x03, 0x10, 0x03, 0xc0, 
+	0x59, 0x30, 0x07, 0x20, 0x78, 0xc0, 0x09, 0x3f, 0x40, 0x13, 0x14, 0x5d, 0x00, 0x03, 0x07, 0x20, 
+	0x35, 0x0c, 0xe2, 0x07, 0x9b, 0x20, 0x2b, 0x84, 0x00, 0x13, 0x1c, 0x00, 0x27, 0xaa, 0x17, 0x6f, 
+	0x00, 0x00, 0x27, 0x08, 0x00, 0x03, 0xe8, 0x00, 0x0f, 0x54, 0x0e, 0x5b, 0x00, 0x03, 0x4c, 0x00, 
+	0x2b, 0x12, 0x77, 0x15, 0x3b, 0x58, 0x08, 0x14, 0xda, 0xe5, 0x58, 0x01, 0xdf, 0x00, 0x20, 0x21, 
+	0x21, 0xe0, 0x80, 0x0d, 0x37, 0x80, 0x00, 0x10, 0x13, 0x01, 0xfb, 0x08, 0x0a, 0x20, 0x11, 0xdf, 
+	0x0c, 0x9b, 0x11, 0xe3, 0xe0, 0x1a, 0xf5, 0x9f, 0x15, 0x1d, 0x4f, 0x10, 0x13, 0x05, 0x0c, 0xe7, 
+	0xa3, 0x0b, 0xfc, 0xff, 0x1b, 0x05, 0x0d, 0x43, 0x04, 0x00, 0x13, 0x04, 0xbf, 0x30, 0x0a, 0x04, 
+	0x02, 0x07, 0x04, 0x4b, 0x03, 0x20, 0x10, 0xa0, 0x00, 0x13, 0x55, 0x14, 0xca, 0xe5, 0x74, 0x14, 
+	0xcf, 0x24, 0xe5, 0x38, 0x00, 0x03, 0x40, 0x14, 0x02, 0x67, 0x1b, 0xc1, 0x00, 0xe3, 0x03, 0xc0, 
+	0x00, 0xe2, 0x0c, 0x15, 0x81, 0x1c, 0xe1, 0x40, 0x14, 0x0e, 0x8f, 0x00, 0x0b, 0x14, 0x6b, 0x80, 
+	0xc0, 0x11, 0x8c, 0x13, 0x45, 0x00, 0x77, 0x01, 0x00, 0x5c, 0x18, 0x97, 0x01, 0x01, 0x45, 0xc4, 
+	0xca, 0xe5, 0xf4, 0x16, 0x1d, 0x8b, 0x55, 0xb0, 0x2c, 0x33, 0x59, 0x03, 0xb3, 0x5a, 0x00, 0x1f, 
+	0x5a, 0x20, 0x97, 0x5c, 0x31, 0x29, 0xab, 0x01, 0x02, 0xfb, 0x08, 0xfc, 0x0b, 0xfb, 0x00, 0x0a, 
+	0x83, 0x13, 0x3b, 0x4c, 0xf5, 0x9f, 0xe5, 0x18, 0x00, 0x0f, 0x06, 0xd3, 0x16, 0x0a, 0xf5, 0x26, 
+	0x04, 0x83, 0x20, 0x03, 0x33, 0x02, 0x8f, 0x18, 0xa0, 0x00, 0x5f, 0x08, 0x09, 0x4b, 0x30, 0xf5, 
+	0x9f, 0x05, 0x18, 0xa6, 0x00, 0xbf, 0x2c, 0x00, 0x07, 0x8f, 0x03, 0x0c, 0x4b, 0x07, 0xc7, 0x11, 
+	0x61, 0x0d, 0x11, 0x5b, 0x0c, 0x3f, 0x0c, 0x80, 0x13, 0x10, 0x10, 0x07, 0x08, 0x0a, 0x80, 0x13, 
+	0xe4, 0x04, 0x53, 0xe4, 0x06, 0x8a, 0x00, 0xe5, 0xf0, 0x00, 0x5c, 0xe3, 0xf0, 0xc0, 0xa0, 0x25, 
+	0x83, 0xe8, 0x04, 0xe7, 0xe8, 0xc6, 0x1d, 0xb3, 0x5c, 0x25, 0x87, 0x1a, 0x00, 0x20, 0x5c, 0x20, 
+	0x7f, 0x5d, 0xb3, 0xb8, 0x03, 0x63, 0x80, 0x00, 0x00, 0x8c, 0xe0, 0xda, 0xfd, 0xff, 0xea, 0x57, 
+	0x7a, 0x54, 0x05, 0x4b, 0x01, 0x47, 0x15, 0x9f, 0x10, 0x0b, 0xec, 0x04, 0x23, 0xa4, 0x02, 0x01, 
+	0x0f, 0xe5, 0x1c, 0x00, 0x5f, 0x04, 0xa3, 0xc0, 0x0a, 0xe3, 0x24, 0x10, 0x4f, 0x2d, 0x2f, 0x57, 
+	0x10, 0xeb, 0x10, 0x1a, 0x31, 0xe2, 0x57, 0x01, 0x1f, 0x11, 0x33, 0x40, 0x00, 0x0f, 0x1f, 0x91, 
+	0x09, 0xdf, 0xa0, 0x11, 0x11, 0x17, 0xca, 0xe5, 0x44, 0x00, 0xe7, 0xc0, 0x2d, 0x3b, 0x01, 0x33, 
+	0x3e, 0x1e, 0xc1, 0xe3, 0x07, 0x1a, 0x01, 0xc1, 0xe3, 0xf8, 0x20, 0x00, 0xe2, 0x02, 0x00, 0x1f, 
+	0x5a, 0x07, 0x10, 0x07, 0x16, 0x31, 0x3f, 0xd0, 0x4b, 0x39, 0x10, 0x4b, 0xc4, 0x98, 0x00, 0x4b, 
+	0xc0, 0xcc, 0x00, 0x4b, 0x18, 0xfb, 0x8c, 0xe1, 0x40, 0xa7, 0x01, 0x4b, 0x5c, 0x00, 0x23, 0x07, 
+	0x20, 0x00, 0x47, 0x11, 0x7b, 0x0a, 0xdf, 0x40, 0x44, 0x00, 0x23, 0x02, 0x00, 0x51, 0xe1, 0x5c, 
+	0x24, 0x4a, 0xca, 0x0b, 0x1b, 0x5c, 0xe1, 0x00, 0x6f, 0x15, 0x00, 0x0f, 0x01, 0xa7, 0x10, 0xd7, 
+	0x44, 0x00, 0x73, 0x5c, 0x04, 0x04, 0x47, 0x08, 0x6b, 0x10, 0x9b, 0x68, 0xf4, 0x41, 0x4b, 0x01, 
+	0xef, 0x1a, 0x11, 0x73, 0x30, 0x02, 0x00, 0x36, 0xeb, 0x01, 0x1a, 0x93, 0x00, 0x0b, 0x3d, 0x01, 
+	0x47, 0x1a, 0x9f, 0x46, 0x01, 0x1e, 0x8a, 0xe2, 0x90, 0x00, 0x01, 0xe1, 0x51, 0x33, 0x59, 0x64, 
+	0x00, 0x6f, 0x64, 0x00, 0x77, 0x51, 0x33, 0x01, 0xc0, 0x31, 0x33, 0x81, 0x00, 0x8f, 0xb0, 0x00, 
+	0x10, 0xa0, 0xb3, 0x08, 0x06, 0x53, 0x40, 0xa0, 0x05, 0xb7, 0x01, 0x11, 0x82, 0xe0, 0x04, 0xc0, 
+	0x43, 0x5c, 0x28, 0xc3, 0xb4, 0x00, 0xc1, 0xe0, 0x90, 0x03, 0x10, 0x17, 0x8b, 0x18, 0x83, 0x04, 
+	0xc0, 0x9c, 0x18, 0x7f, 0x01, 0x10, 0x13, 0x00, 0x47, 0xb0, 0x69, 0x6b, 0x48, 0x01, 0x23, 0x11, 
+	0x1f, 0x73, 0x1c, 0xc1, 0xe3, 0x7b, 0xe0, 0x01, 0x3b, 0x11, 0x1f, 0x01, 0xfb, 0x21, 0x23, 0x00, 
+	0x41, 0x1f, 0x12, 0xcf, 0xad, 0x91, 0x1f, 0x3f, 0x03, 0xa3, 0x41, 0x00, 0xeb, 0x12, 0x53, 0x40, 
+	0x40, 0x3f, 0x1c, 0x6c, 0x10, 0x0a, 0xe1, 0x47, 0xf0, 0x27, 0x30, 0x27, 0x21, 0x06, 0x00, 0xa0, 
+	0xe1, 0x3e, 0x2e, 0x01, 0xe2, 0x22, 0x01, 0x84, 0x03, 0xbf, 0x2b, 0x01, 0xe2, 0xa2, 0x00, 0x07, 
+	0x48, 0x04, 0x40, 0x8a, 0x01, 0xaf, 0x9a, 0xe5, 0x7f, 0x0c, 0xc0, 0xe3, 0x00, 0xf8, 0x00, 0xc0, 
+	0xe3, 0x1f, 0x20, 0x01, 0xe2, 0x05, 0x01, 0xcb, 0x01, 0xe2, 0x82, 0x00, 0x1b, 0x2c, 0x00, 0x03, 
+	0x50, 0x44, 0x00, 0x1f, 0x5c, 0x00, 0x03, 0x04, 0xe0, 0x2d, 0xe5, 0x42, 0xb1, 0x06, 0xb7, 0x04, 
+	0xe0, 0x9d, 0xe4, 0x0a, 0xa7, 0xea, 0xf7, 0xf0, 0x4b, 0xf0, 0x4b, 0x10, 0x4b, 0x10, 0x47, 0x01, 
+	0x00, 0x1f, 0x10, 0x27, 0x10, 0x47, 0x2b, 0x40, 0xc4, 0x90, 0x1f, 0x0c, 0x40, 0x1f, 0x0c, 0x20, 
+	0x1f, 0x10, 0x6b, 0xab, 0x10, 0x67, 0x8d, 0x40, 0x67, 0x48, 0x00, 0x4b, 0x4c, 0x00, 0x13, 0x11, 
+	0xab, 0x58, 0xd2, 0x01, 0xb7, 0x70, 0x01, 0x13, 0x11, 0xaf, 0x06, 0x02, 0x52, 0x8f, 0x17, 0xdf, 
+	0x3a, 0xf0, 0x17, 0x11, 0xe7, 0x08, 0xab, 0x07, 0xab, 0x11, 0xab, 0x81, 0x07, 0xeb, 0x12, 0x68, 
+	0x24, 0x9a, 0xe5, 0x68, 0x00, 0x33, 0xad, 0x51, 0xcb, 0x6c, 0x01, 0x17, 0x6c, 0xf1, 0xcb, 0x21, 
+	0xcb, 0x18, 0x00, 0x57, 0x47, 0x02, 0x1b, 0x6b, 0x00, 0x43, 0xe0, 0x11, 0xd7, 0x51, 0xd3, 0x0a, 
+	0x9b, 0x09, 0xe2, 0xff, 0x20, 0x03, 0x12, 0x6b, 0xe0, 0xf0, 0x0a, 0x27, 0x94, 0x00, 0x5f, 0xca, 
+	0x84, 0x00, 0x93, 0x18, 0x04, 0xcf, 0x02, 0x40, 0x40, 0x5c, 0x1f, 0xf7, 0xda, 0x10, 0x30, 0x80, 
+	0xe2, 0x04, 0xad, 0x0b, 0x9b, 0x7e, 0x00, 0x17, 0x03, 0x1f, 0xe3, 0x00, 0x0b, 0x7b, 0x40, 0x23, 
+	0x54, 0xf0, 0x02, 0x1f, 0xf0, 0x09, 0x6f, 0xed, 0x04, 0xf3, 0x6c, 0x00, 0x00, 0x1a, 0xe5, 0xff, 
+	0x20, 0x80, 0xe2, 0xbc, 0x26, 0x00, 0x4a, 0xe1, 0x3f, 0x09, 0xc0, 0xe3, 0x0f, 0x1b, 0x00, 0x00, 
+	0xe2, 0x19, 0x2d, 0x8a, 0xe2, 0x21, 0x14, 0x00, 0x92, 0xe7, 0x3f, 0x2b, 0xc0, 0xe3, 0x02, 0x10, 
+	0x00, 0xd1, 0xe7, 0x3f, 0x0c, 0x50, 0xe3, 0x58, 0xf1, 0x16, 0x9f, 0x25, 0x50, 0x06, 0x87, 0x50, 
+	0x01, 0xbf, 0x11, 0xf7, 0x6c, 0x52, 0xc0, 0x10, 0x37, 0x8c, 0x30, 0x37, 0xc9, 0xcc, 0x00, 0x37, 
+	0x1c, 0x10, 0xe2, 0x06, 0x2c, 0x00, 0x37, 0xf4, 0x92, 0xe7, 0xcc, 0x80, 0x00, 0xa7, 0x0c, 0x00, 
+	0xc2, 0xe7, 0x2a, 0x2c, 0x82, 0x01, 0xe2, 0x2c, 0x22, 0xc2, 0xe7, 0x81, 0x2f, 0x00, 0x07, 0x10, 
+	0x24, 0xc2, 0xe7, 0x2a, 0xcb, 0x25, 0xa0, 0xe1, 0x19, 0x28, 0x1d, 0x8a, 0x02, 0x47, 0x91, 0x20, 
+	0x27, 0x02, 0x10, 0x51, 0x8b, 0x10, 0xef, 0xb1, 0x02, 0x0a, 0x3d, 0x43, 0x3f, 0x0a, 0xd3, 0x00, 
+	0xfb, 0x47, 0xe0, 0x0a, 0x23, 0xea, 0xe8, 0x10, 0x06, 0xff, 0x09, 0x8f, 0x10, 0x13, 0x18, 0x0c, 
+	0x00, 0xc1, 0x05, 0x67, 0x10, 0xc7, 0x8c, 0xe0, 0xd4, 0xa6, 0x00, 0x17, 0x90, 0x01, 0x47, 0xb2, 
+	0xc0, 0x0c, 0xa3, 0x09, 0xe7, 0x02, 0x00, 0x2c, 0xc2, 0xe3, 0x90, 0x24, 0x8a, 0xe5, 0xff, 0x29, 
+	0x2c, 0x42, 0x01, 0x17, 0x52, 0x12, 0xcf, 0x11, 0xb4, 0x0d, 0x2f, 0x42, 0xb4, 0x00, 0x27, 0x01, 
+	0x2b, 0xa0, 0xe3, 0x10, 0x4b, 0xac, 0xaa, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0xeb, 0x00, 0x0b, 0xa4, 
+	0x00, 0x0b, 0x03, 0xa8, 0x00, 0x0b, 0xe8, 0x00, 0x0b, 0x9c, 0x00, 0x27, 0x3f, 0x0c, 0x5c, 0x52, 
+	0xe3, 0x03, 0x0b, 0x4a, 0x19, 0xa3, 0xfb, 0x16, 0x22, 0x9f, 0xe2, 0x44, 0x1a, 0x00, 0xa3, 0x1f, 
+	0xc0, 0x0c, 0x0b, 0x47, 0xc1, 0xe7, 0x42, 0x03, 0x06, 0x2f, 0x10, 0xc0, 0x2c, 0x02, 0x00, 0x0b, 
+	0x07, 0x08, 0x10, 0xc0, 0xcc, 0x03, 0x10, 0xff, 0x3c, 0x6e, 0x00, 0x00, 0x03, 0xc8, 0x76, 0x00, 
+	0x08, 0x9c, 0x73, 0x00, 0x00, 0x08, 0x90, 0x77, 0x00, 0x08, 0x01, 0x00, 0x60, 0x02, 0xa6, 0x01, 
+	0x00, 0x40, 0xa2, 0x0c, 0x00, 0x13, 0x68, 0x00, 0x5f, 0x00, 0x03, 0xa0, 0x61, 0x00, 0x03, 0x74, 
+	0x00, 0x32, 0x00, 0x06, 0x94, 0x00, 0x00, 0x02, 0x79, 0x61, 0x35, 0x00, 0x13, 0x2f, 0x5f, 0x00, 
+	0x03, 0x40, 0x7b, 0x06, 0x0b, 0x05, 0x75, 0x00, 0x08, 0x58, 0x81, 0x0d, 0xc3, 0x7b, 0x0d, 0xb3, 
+	0x06, 0x7d, 0x00, 0x08, 0x54, 0x7c, 0x0f, 0x93, 0x00, 0x0f, 0x8c, 0x00, 0xe1, 0x03, 0x02, 0x8c, 
+	0xe9, 0x03, 0x02, 0xb4, 0xa8, 0x10, 0x0b, 0xe5, 0x00, 0x0b, 0xb9, 0x00, 0x03, 0xbd, 0x03, 0x02, 
+	0x00, 0x28, 0x82, 0x00, 0x08, 0x46, 0x50, 0x53, 0x3a, 0x18, 0x20, 0x20, 0x20, 0x0b, 0x1e, 0x00, 
+	0x50, 0x0c, 0x59, 0xe3, 0x01, 0x5c, 0xf6, 0x9f, 0xa5, 0x29, 0x02, 0x98, 0x01, 0x13, 0x4a, 0xb0, 
+	0x12, 0x5f, 0x1a, 0x40, 0x0a, 0xa3, 0xf8, 0x00, 0xcf, 0xff, 0x80, 0x05, 0x8f, 0x10, 0x90, 0x89, 
+	0x02, 0xff, 0x0c, 0x10, 0x51, 0x03, 0x20, 0x07, 0x08, 0x30, 0x07, 0x09, 0x00, 0xd7, 0x20, 0x2b, 
+	0xa2, 0x18, 0x83, 0x01, 0x00, 0x2b, 0x0f, 0x00, 0x19, 0x10, 0xf3, 0x1a, 0x51, 0x3f, 0x00, 0x07, 
+	0xea, 0x0f, 0x3b, 0x29, 0x02, 0xd8, 0x20, 0x1f, 0x75, 0xf4, 0x00, 0x13, 0x00, 0x2f, 0x20, 0x4b, 
+	0xcc, 0x09, 0xeb, 0x09, 0x08, 0x53, 0x10, 0x01, 0xb0, 0x5b, 0x00, 0x2f, 0x00, 0x4b, 0x0f, 0x00, 
+	0x00, 0xb4, 0xe8, 0x0f, 0x00, 0xa5, 0xe8, 0xb2, 0x90, 0x40, 0xc6, 0x08, 0x3f, 0xa0, 0xe3, 0x09, 
+	0x00, 0xc7, 0xe7, 0xf6, 0x10, 0x4b, 0x50, 0x5b, 0x10, 0x3b, 0x11, 0x53, 0xfc, 0x0a, 0xe3, 0x00, 
+	0x7f, 0xe3, 0xe4, 0x10, 0x7b, 0x12, 0xcb, 0x0a, 0x7b, 0xea, 0x13, 0x00, 0x03, 0x90, 0x43, 0x20, 
+	0x2d, 0xe9, 0x0d, 0x1f, 0xeb, 0x80, 0x54, 0x9a, 0xe5, 0x06, 0x88, 0x64, 0x9a, 0xe5, 0x60, 0x0b, 
+	0x23, 0x00, 0x67, 0xeb, 0x04, 0x13, 0xb0, 0xa0, 0xe3, 0x60, 0x09, 0xdb, 0x02, 0x09, 0x80, 0x0a, 
+	0x2f, 0x00, 0xc6, 0xe1, 0x90, 0x83, 0xbd, 0xe8, 0x05, 0x80, 0x25, 0x9f, 0xe5, 0x84, 0x00, 0x27, 
+	0x8c, 0x00, 0x27, 0x8a, 0x20, 0x17, 0x90, 0xd6, 0xe1, 0x1b, 0xff, 0x05, 0x0e, 0x77, 0x00, 0x1a, 
+	0x44, 0x2d, 0xe9, 0x1e, 0xa3, 0x50, 0x0b, 0x54, 0x00, 0x2b, 0xb2, 0x01, 0x90, 0xd6, 0xe0, 0x02, 
+	0x09, 0x19, 0xe3, 0x0c, 0x57, 0x20, 0x18, 0x09, 0x03, 0x33, 0x44, 0x75, 0x9f, 0xe5, 0x89, 0x00, 
+	0x72, 0x87, 0xe0, 0x05, 0x89, 0x87, 0xe2, 0x01, 0x00, 0x0c, 0x19, 0xe3, 0x02, 0x7a, 0x87, 0x12, 
+	0x01, 0x16, 0x00, 0x89, 0xe2, 0x10, 0x27, 0x01, 0x02, 0xcf, 0x16, 0xd7, 0x09, 0xc0, 0x05, 0x83, 
+	0x01, 0x03, 0x0a, 0x03, 0x30, 0x40, 0xe0, 0x44, 0x01, 0xe0, 0x4f, 0xe2, 0x82, 0xfb, 0xff, 0xea, 
+	0x50, 0x73, 0x67, 0x40, 0x03, 0x7b, 0x00, 0x63, 0xeb, 0x40, 0x03, 0xcf, 0x50, 0x97, 0x12, 0xbf, 
+	0xe0, 0x10, 0x87, 0x10, 0x67, 0x12, 0x63, 0x00, 0x5c, 0x2d, 0xe9, 0x38, 0x13, 0xd0, 0x4d, 0xe2, 
+	0x17, 0x1f, 0xd8, 0xf4, 0x02, 0x5f, 0x00, 0x17, 0x80, 0x00, 0xdf, 0x0a, 0x38, 0xd0, 0x8d, 0xe2, 
+	0x00, 0x5c, 0x20, 0xbd, 0xe8, 0x10, 0x2f, 0xc4, 0xa4, 0x9f, 0xe5, 0x7c, 0x40, 0xb4, 0x0a, 0xa3, 
+	0x80, 0xa0, 0xe3, 0x29, 0x03, 0xa0, 0x02, 0xe1, 0x7c, 0x00, 0xcf, 0xe5, 0x7d, 0x25, 0x0b, 0x80, 
+	0x00, 0xe0, 0xac, 0x24, 0x9f, 0xe5, 0xd1, 0x00, 0x92, 0x00, 0xe1, 0xa8, 0x74, 0x9f, 0xe5, 0x80, 
+	0x75, 0x97, 0x41, 0xe0, 0x14, 0x27, 0x08, 0x71, 0x8d, 0xe7, 0x01, 0x0c, 0x73, 0x44, 0x00, 0x0d, 
+	0x5b, 0x4f, 0x2e, 0x8a, 0x0e, 0xdb, 0xd2, 0xe7, 0xd1, 0x01, 0x3f, 0x00, 0x1b, 0x50, 0x08, 0xcb, 
+	0x00, 0x1a, 0x03, 0x09, 0x4f, 0x42, 0x68, 0x20, 0x2f, 0x87, 0xe0, 0x23, 0x01, 0x00, 0xff, 0x77, 
+	0x30, 0x87, 0xe0, 0x50, 0x33, 0x0d, 0x13, 0xe2, 0x10, 0x00, 0x53, 0x42, 0xe3, 0x0d, 0x13, 0xba, 
+	0x08, 0x80, 0xb0, 0x0a, 0x67, 0x00, 0x00, 0x0a, 0x70, 0x80, 0xcf, 0xe5, 0x01, 0x80, 0x58, 0x3b, 
+	0xe2, 0x44, 0x00, 0x07, 0x10, 0xbb, 0x10, 0x83, 0xff, 0x09, 0x8f, 0x10, 0xbf, 0x00, 0x02, 0x60, 
+	0x86, 0xe2, 0x3f, 0x90, 0x09, 0xe2, 0x14, 0x00, 0x70, 0x9d, 0x21, 0x2b, 0x0c, 0x00, 0x8f, 0x01, 
+	0x00, 0x00, 0xd5, 0xe4, 0x07, 0x10, 0xd5, 0xe5, 0x00, 0x01, 0x01, 0x92, 0xe7, 0x01, 0x11, 0x92, 
+	0xe7, 0x81, 0x29, 0x3f, 0x02, 0x87, 0xe4, 0x1f, 0x00, 0x17, 0xe3, 0x0c, 0x4b, 0x1a, 0x16, 0x08, 
+	0x50, 0x85, 0x0d, 0x33, 0xb0, 0x07, 0xd7, 0x08, 0xb3, 0x70, 0x01, 0x47, 0xe2, 0x1f, 0x1c, 0x97, 
+	0xe8, 0x01, 0x00, 0xdb, 0x08, 0x08, 0x71, 0x9d, 0xe7, 0x10, 0x43, 0x1f, 0x1c, 0x87, 0xa9, 0x00, 
+	0x0f, 0x88, 0x00, 0x23, 0x58, 0x12, 0x5f, 0xba, 0xe1, 0x02, 0x0f, 0x82, 0x10, 0x73, 0xb2, 0x90, 
+	0xf6, 0xe1, 0x10, 0x00, 0x3b, 0x29, 0x46, 0x15, 0x14, 0xcf, 0x50, 0xe1, 0xfa, 0x01, 0x27, 0x21, 
+	0x4f, 0x53, 0x05, 0x9f, 0xe5, 0xb0, 0x43, 0x9f, 0x26, 0x23, 0x9d, 0x1c, 0xcf, 0xea, 0x02, 0x47, 
+	0x27, 0xff, 0x02, 0x5f, 0x9d, 0x06, 0x1b, 0x9c, 0x40, 0x13, 0x90, 0x09, 0xf3, 0x9f, 0x15, 0x98, 
+	0x01, 0x97, 0x94, 0x74, 0x0b, 0x73, 0x38, 0x00, 0x56, 0x30, 0x23, 0x01, 0xfb, 0x03, 0xdb, 0xeb, 
+	0x78, 0x83, 0x0a, 0x9f, 0xe5, 0x78, 0xa3, 0x00, 0x03, 0xb3, 0x04, 0x2f, 0x90, 0x48, 0xe0, 0x08, 
+	0xa3, 0x56, 0xe1, 0x07, 0x78, 0x0a, 0xb6, 0x00, 0x20, 0x98, 0xe1, 0x10, 0xe3, 0x02, 0x6c, 0xc6, 
+	0xe3, 0x01, 0x31, 0x20, 0xc0, 0x02, 0xaf, 0x2d, 0x0f, 0x0a, 0x3f, 0x1b, 0x04, 0xe7, 0x11, 0x0d, 
+	0x51, 0xe3, 0x02, 0xd3, 0xaa, 0x02, 0x90, 0x04, 0x53, 0x08, 0x0b, 0x12, 0xe3, 0x0a, 0x04, 0x5b, 
+	0x03, 0x0a, 0x40, 0x02, 0x12, 0xb2, 0x00, 0x90, 0xe1, 0x00, 0x0a, 0x4b, 0xff, 0x80, 0x06, 0x03, 
+	0x82, 0x10, 0x9b, 0xe7, 0x05, 0x10, 0xc1, 0x81, 0x00, 0xaf, 0x80, 0xe1, 0x82, 0x00, 0x8b, 0xe7, 
+	0x10, 0x57, 0x8c, 0x0e, 0x63, 0x1a, 0x00, 0x44, 0x05, 0xe3, 0x00, 0x2f, 0x0c, 0xf3, 0xc0, 0x01, 
+	0xf3, 0x00, 0x3b, 0x07, 0x10, 0x00, 0xe2, 0x81, 0xc1, 0x10, 0x8b, 0xe0, 0x38, 0x10, 0x07, 0xc2, 
+	0x8c, 0xe0, 0x03, 0xa0, 0x05, 0x43, 0x81, 0x04, 0xa7, 0x00, 0x20, 0x8a, 0xe0, 0x03, 0x08, 0x2a, 
+	0x42, 0x12, 0x98, 0x02, 0x5b, 0x01, 0x00, 0xd2, 0x10, 0xe4, 0x00, 0x08, 0x01, 0x4b, 0x31, 0x00, 
+	0xe0, 0x04, 0x00, 0x10, 0x9c, 0xe5, 0x05, 0x10, 0x01, 0xe0, 0x03, 0x82, 0x09, 0xa7, 0x04, 0x10, 
+	0x8c, 0xe5, 0x44, 0x80, 0x0f, 0x44, 0x82, 0x00, 0x0f, 0x04, 0x32, 0x00, 0xe0, 0x80, 0x50, 0x13, 
+	0x14, 0x15, 0x81, 0xe1, 0x80, 0x00, 0x13, 0xc0, 0x80, 0x0f, 0xc0, 0x10, 0x23, 0x08, 0x33, 0x00, 
+	0xe0, 0x84, 0x50, 0x13, 0x13, 0x81, 0xe1, 0x54, 0x84, 0x00, 0x13, 0xc4, 0x80, 0x0f, 0xc4, 0x10, 
+	0x23, 0x30, 0x00, 0x3a, 0xe0, 0x40, 0x50, 0x13, 0x17, 0xb3, 0x00, 0x13, 0x00, 0x80, 0x0f, 0x08, 
+	0x18, 0x10, 0x8c, 0xe4, 0x11, 0x77, 0x16, 0xbf, 0x0f, 0x6d, 0x82, 0x78, 0xe2, 0x1d, 0xcb, 0x50, 
+	0xfb, 0x30, 0x27, 0x30, 0xfb, 0x04, 0x00, 0x8c, 0x28, 0xe4, 0x06, 0x01, 0x3b, 0xf6, 0x01, 0xcf, 
+	0x1e, 0xcd, 0x4c, 0x10, 0xe2, 0x08, 0x70, 0x01, 0xef, 0x60, 0xa0, 0xe3, 0xc9, 0x89, 0x01, 0x7b, 
+	0x01, 0x60, 0x56, 0x18, 0x33, 0x1a, 0xc0, 0x0f, 0x2b, 0x18, 0x01, 0x70, 0x57, 0x14, 0x37, 0x2b, 
+	0x57, 0x0c, 0x27, 0x9a, 0x03, 0xe5, 0x48, 0x24, 0x42, 0xe0, 0x10, 0x07, 0x03, 0x06, 0xaf, 0x10, 
+	0xe0, 0x04, 0x28, 0x10, 0x07, 0x41, 0xe0, 0xec, 0xc7, 0x01, 0x9a, 0xe5, 0x91, 0x2c, 0x8c, 0xe0, 
+	0x08, 0x00, 0x0f, 0x04, 0x92, 0x0c, 0x01, 0xe0, 0x0f, 0x06, 0xcb, 0x21, 0x12, 0xc0, 0x01, 0x4b, 
+	0x20, 0x1f, 0x81, 0xe0, 0x07, 0xcc, 0x8a, 0xe2, 0x41, 0x68, 0x00, 0x4b, 0x00, 0x00, 0x8f, 0xe2, 
+	0xba, 0x03, 0xe3, 0xa8, 0x17, 0xaf, 0x5c, 0x08, 0x1f, 0x00, 0x19, 0x4f, 0x04, 0x8a, 0x15, 0x00, 
+	0xb8, 0xfd, 0xff, 0x1b, 0x2e, 0xf8, 0xff, 0xea, 0x05, 0x01, 0x0b, 0x8a, 0xe2, 0xc8, 0x06, 0xc7, 
+	0x6d, 0x09, 0x1b, 0x01, 0x0c, 0x00, 0x90, 0xe8, 0x30, 0x00, 0x91, 0x0b, 0x23, 0x40, 0x52, 0x09, 
+	0x53, 0x53, 0x01, 0x0c, 0x00, 0x81, 0x18, 0xe7, 0x22, 0x1f, 0x10, 0xd7, 0x1d, 0xf7, 0xf1, 0x9f, 
+	0x06, 0x8f, 0x03, 0x2b, 0x03, 0xcb, 0x74, 0xec, 0x02, 0xfb, 0x03, 0xd7, 0x0e, 0x3f, 0x50, 0x00, 
+	0x63, 0xa0, 0xd3, 0x50, 0xa0, 0x03, 0x43, 0x1e, 0x13, 0x0f, 0x00, 0xa0, 0xa3, 0xe0, 0xab, 0x0b, 
+	0x13, 0xe0, 0x0e, 0x17, 0x00, 0x33, 0x1f, 0x01, 0x00, 0x23, 0x37, 0x8b, 0x2a, 0x00, 0x80, 0x29, 
+	0x57, 0xd8, 0x06, 0xaf, 0x81, 0x07, 0x7f, 0x03, 0x80, 0x00, 0x1f, 0x0e, 0x00, 0x00, 0x4a, 0x03, 
+	0x00, 0x40, 0x41, 0xe2, 0x14, 0x27, 0x04, 0x20, 0xa0, 0xe1, 0x05, 0x04, 0x73, 0x31, 0x04, 0x60, 
+	0x00, 0x07, 0x00, 0x6f, 0x7c, 0x40, 0xa1, 0x0f, 0x7b, 0x2c, 0x50, 0xe2, 0x05, 0xf0, 0x4a, 0x50, 
+	0x0b, 0x03, 0x0b, 0x5a, 0x03, 0x01, 0x00, 0x90, 0xe2, 0x40, 0x80, 0xbd, 0x08, 0x14, 0x53, 0x1a, 
+	0x30, 0x00, 0xa1, 0x1e, 0xcb, 0x69, 0x6f, 0xac, 0x0a, 0xcb, 0x00, 0x00, 0x20, 0xe0, 0xe3, 0x00, 
+	0x30, 0xe0, 0xe3, 0x01, 0x0c, 0x40, 0xa0, 0xe3, 0x00, 0x0f, 0x63, 0x0e, 0x47, 0xe3, 0x11, 0xc2, 
+	0x01, 0x6b, 0x1f, 0x3b, 0xff, 0x14, 0xc1, 0xe3, 0x11, 0x5f, 0xa0, 0x04, 0xf0, 0x9f, 0x05, 0x04, 
+	0x80, 0x00, 0x0f, 0x84, 0xc8, 0x81, 0x04, 0xc3, 0x58, 0xe1, 0x01, 0x40, 0x84, 0x02, 0x01, 0x73, 
+	0x21, 0x0a, 0x02, 0x10, 0x0b, 0x50, 0x85, 0x02, 0xf5, 0x00, 0x0b, 0x20, 0x05, 0x50, 0x06, 0x13, 
+	0x50, 0xa0, 0x03, 0x08, 0x20, 0x24, 0xa0, 0x01, 0x04, 0x0b, 0x0a, 0x03, 0x10, 0x1b, 0x60, 0x86, 
+	0x44, 0x02, 0x03, 0x2b, 0x0a, 0x06, 0x60, 0x3b, 0xf3, 0x01, 0x60, 0x88, 0x00, 0x1f, 0x30, 0xa0, 
+	0x01, 0x02, 0xcf, 0xea, 0xb0, 0x10, 0x10, 0xd0, 0xe1, 0x01, 0x0b, 0x03, 0xb2, 0x10, 0xc0, 0xe0, 
+	0x0a, 0x01, 0x40, 0x54, 0xe2, 0x03, 0x9b, 0x1a, 0x10, 0x93, 0xdc, 0x04, 0x74, 0x00, 0x08, 0xec, 
+	0x76, 0x1c, 0xbb, 0x00, 0x06, 0x0c, 0x74, 0x60, 0x00, 0x03, 0x16, 0xf3, 0x36, 0xc7, 0x01, 0x06, 
+	0x37, 0xff, 0x00, 0x0d, 0xd9, 0x00, 0x01, 0x9c, 0x06, 0xcb, 0x16, 0xb3, 0x16, 0xbb, 0x04, 0x00, 
+	0x60, 0x00, 0x06, 0x10, 0x06, 0xab, 0xac, 0x67, 0x14, 0x00, 0x03, 0x2c, 0x00, 0x17, 0xa2, 0x0a, 
+	0xd7, 0x03, 0x04, 0x00, 0x80, 0x22, 0x03, 0x04, 0x40, 0x32, 0x06, 0x02, 0x01, 0x50, 0xe3, 0x06, 
+	0x02, 0xa0, 0xc3, 0x0a, 0x00, 0x07, 0x0b, 0x0a, 0x02, 0xa0, 0xb3, 0x00, 0xdf, 0xe1, 0xf0, 0x1f, 
+	0x70, 0x1f, 0x1e, 0x25, 0x54, 0x80, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0x80, 0x1f, 0x04, 0x1f, 
+	0x50, 0x8c, 0xe4, 0xf0, 0x23, 0xf0, 0x83, 0xf0, 0x1f, 0xf0, 0x63, 0xf0, 0x1f, 0xe0, 0xf0, 0x1f, 
+	0xf0, 0x1f, 0x30, 0x83, 0x04, 0xf0, 0x1f, 0xe5, 0xf0, 0x02, 0x37, 0x00, 0x06, 0x04, 0x20, 0x9c, 
+	0x2c, 0x17, 0x00, 0x15, 0x00, 0x8c, 0x05, 0x12, 0x57, 0x03, 0x02, 0x3b, 0x27, 0x06, 0x63, 0x6b, 
+	0x03, 0x16, 0x63, 0x02, 0xeb, 0x08, 0x00, 0x1f, 0x01, 0x0d, 0x63, 0x07, 0x47, 0x8c, 0x01, 0xb3, 
+	0x8c, 0xe8, 0x10, 0x03, 0x43, 0x13, 0x33, 0x0c, 0x07, 0xe1, 0x02, 0x1b, 0x09, 0x27, 0x07, 0xbb, 
+	0xaa, 0x48, 0x04, 0x50, 0x04, 0x57, 0x00, 0x82, 0x10, 0x10, 0x27, 0x8a, 0x15, 0x48, 0x04, 0x61, 
+	0x81, 0x00, 0x1b, 0x0d, 0xe7, 0x84, 0x88, 0xe0, 0x1c, 0x00, 0x23, 0x02, 0x08, 0x00, 0x8c, 0xe5, 
+	0x1c, 0xc7, 0x3c, 0xb7, 0x00, 0xd1, 0x03, 0x4b, 0x10, 0x13, 0x18, 0x07, 0x63, 0x08, 0x40, 0x90, 
+	0x02, 0xd3, 0x40, 0x54, 0x3e, 0x3f, 0x30, 0x94, 0xe5, 0x02, 0x30, 0x43, 0xa6, 0x02, 0xc3, 0x51, 
+	0x18, 0x37, 0xba, 0x04, 0x03, 0x17, 0x03, 0xd7, 0xea, 0x01, 0x08, 0x40, 0x8c, 0xe5, 0x08, 0xc0, 
+	0x80, 0x00, 0x2f, 0xad, 0x36, 0xb7, 0x08, 0x03, 0xff, 0x01, 0x0d, 0xb3, 0x12, 0x2b, 0x1c, 0x03, 
+	0xc3, 0x5e, 0x0c, 0x00, 0x2f, 0x0a, 0x00, 0x3f, 0x0d, 0x7f, 0x00, 0xbf, 0x33, 0x1f, 0x08, 0x38, 
+	0x10, 0x90, 0x20, 0x17, 0x18, 0x47, 0x10, 0xbb, 0x08, 0x20, 0x80, 0x23, 0xe5, 0x01, 0x09, 0xaf, 
+	0x08, 0x20, 0x8c, 0x20, 0x83, 0x10, 0xb7, 0x0e, 0x48, 0x04, 0x40, 0xe0, 0x10, 0xc7, 0x00, 0xb3, 
+	0x00, 0x07, 0x8a, 0x8c, 0x00, 0xa3, 0x91, 0xe5, 0x1c, 0x10, 0xb3, 0x03, 0xbb, 0x08, 0x00, 0x34, 
+	0x81, 0xe5, 0x08, 0x9c, 0x30, 0xe3, 0x17, 0x09, 0xbf, 0x80, 0x08, 0x75, 0xe2, 0x10, 0xcb, 0x20, 
+	0x3b, 0xc4, 0x3f, 0x14, 0x04, 0x37, 0x0c, 0x64, 0x3f, 0x20, 0xcc, 0xe0, 0x1b, 0x63, 0x00, 0xc0, 
+	0xdc, 0xe2, 0x00, 0x1c, 0xc0, 0xa0, 0x43, 0x10, 0x2f, 0x11, 0x57, 0x07, 0x27, 0x1a, 0x03, 0x22, 
+	0x0c, 0x78, 0x05, 0xe7, 0x00, 0xba, 0x1c, 0x00, 0x27, 0x70, 0x40, 0x00, 0x13, 0xf7, 0x50, 0xe1, 
+	0x6c, 0x00, 0x9f, 0x15, 0x98, 0x00, 0x07, 0x11, 0x68, 0x40, 0x07, 0x2d, 0x6b, 0x00, 0xd9, 0xe4, 
+	0x0d, 0x00, 0xf1, 0x9a, 0xe7, 0x10, 0x27, 0x10, 0xeb, 0x1c, 0x00, 0x7f, 0x84, 0x50, 0xbb, 0x04, 
+	0x20, 0x91, 0xe5, 0x15, 0xa3, 0x01, 0x10, 0x03, 0x42, 0xe0, 0x00, 0xe0, 0x9c, 0xe5, 0x50, 0x8b, 
+	0x10, 0x9b, 0x3b, 0x48, 0x14, 0x04, 0xab, 0x00, 0x2b, 0x50, 0x97, 0x10, 0x00, 0x0b, 0x10, 0x7f, 
+	0x38, 0x50, 0x46, 0x01, 0x15, 0x00, 0x03, 0x10, 0x01, 0xec, 0x75, 0x00, 0x2b, 0x03, 0xbc, 0x00, 
+	0x03, 0xd4, 0x00, 0x03, 0x78, 0x00, 0x3b, 0x0c, 0x0b, 0x31, 0xeb, 0xf4, 0x14, 0x83, 0x00, 0x33, 
+	0x48, 0x14, 0x41, 0x21, 0x0f, 0x65, 0x01, 0x01, 0x0f, 0x0b, 0xbf, 0xe2, 0xb8, 0x04, 0xdb, 0xb8, 
+	0x0a, 0xbb, 0xac, 0x10, 0x6b, 0xa0, 0x04, 0xeb, 0x02, 0x09, 0x37, 0x24, 0x73, 0x07, 0x10, 0x44, 
+	0xe3, 0x09, 0x33, 0x1a, 0xc0, 0x01, 0x0a, 0xeb, 0xc1, 0x81, 0x3c, 0xe0, 0xbc, 0x00, 0x1b, 0x04, 
+	0xe7, 0x00, 0x07, 0x0c, 0x63, 0x10, 0xa1, 0x40, 0xe2, 0x10, 0x2b, 0x01, 0x0c, 0x90, 0xe0, 0x00, 
+	0x0c, 0x19, 0x80, 0x20, 0xa0, 0x00, 0x13, 0x00, 0x33, 0x31, 0x04, 0x1c, 0x2f, 0x0f, 0x10, 0xa0, 
+	0xe1, 0x90, 0x00, 0x33, 0x15, 0x47, 0x0f, 0xf7, 0x28, 0x9b, 0x73, 0x84, 0x00, 0x7b, 0x1f, 0x8f, 
+	0x07, 0xb3, 0xea, 0x7c, 0x40, 0x4f, 0x1b, 0x13, 0xac, 0xd1, 0x63, 0x0c, 0x05, 0x8b, 0xb8, 0x0c, 
+	0xc3, 0xd0, 0x87, 0x20, 0x0c, 0x85, 0x07, 0xb3, 0x0c, 0x60, 0xe2, 0x12, 0x00, 0x8f, 0xbc, 0x0b, 
+	0x77, 0x15, 0x03, 0x05, 0x52, 0x17, 0xff, 0x8a, 0x1b, 0x9b, 0xbc, 0x00, 0xbb, 0x01, 0x2c, 0x21, 
+	0x9f, 0xe5, 0x92, 0x10, 0x21, 0x00, 0x3f, 0x02, 0x41, 0xe2, 0xf8, 0x00, 0x4f, 0xe2, 0x10, 0x7b, 
+	0x74, 0xa4, 0x00, 0x7b, 0x0c, 0x00, 0x77, 0x10, 0xc1, 0x1b, 0xc3, 0x62, 0xe2, 0x11, 0x9c, 0x22, 
+	0x80, 0x0c, 0xc3, 0x81, 0xe0, 0xa3, 0x07, 0xcf, 0x08, 0xff, 0x00, 0x60, 0xe2, 0x04, 0x97, 0xea, 
+	0x80, 0x00, 0xac, 0x30, 0x13, 0xf0, 0x00, 0x0b, 0xa0, 0x07, 0xeb, 0x1b, 0x57, 0xf0, 0x20, 0x65, 
+	0x02, 0x1a, 0x6b, 0x05, 0x3b, 0x80, 0xe1, 0x50, 0x13, 0x0f, 0x00, 0x13, 0x14, 0x00, 0x02, 0x82, 
+	0x60, 0x0f, 0xa0, 0x01, 0x33, 0x02, 0x0c, 0x22, 0x11, 0xe3, 0x09, 0x0f, 0x0a, 0xa2, 0x24, 0x08, 
+	0x1f, 0x20, 0x4a, 0x22, 0x0c, 0xf3, 0x12, 0xe3, 0x01, 0xd7, 0x0a, 0x13, 0x53, 0xa4, 0xd0, 0x1c, 
+	0xf3, 0x00, 0xef, 0x20, 0x00, 0x1b, 0x02, 0x20, 0xc2, 0xe3, 0x00, 0x20, 0x24, 0xca, 0xe5, 0xff, 
+	0x18, 0xc1, 0xe3, 0x30, 0x00, 0x18, 0x0c, 0x2f, 0x0b, 0x1f, 0x02, 0x1c, 0x81, 0x13, 0x19, 0xa0, 
+	0x14, 0x8a, 0x23, 0x83, 0x25, 0x57, 0x1c, 0x81, 0x00, 0x53, 0xea, 0x11, 0x57, 0x00, 0xcf, 0x00, 
+	0x07, 0xb8, 0x00, 0x8f, 0x20, 0x00, 0xa7, 0x02, 0xbb, 0x0e, 0x03, 0x20, 0x00, 0x73, 0x51, 0x0f, 
+	0x0e, 0xff, 0x0a, 0x02, 0xf4, 0x39, 0xfb, 0xbb, 0x00, 0x67, 0x8a, 0x00, 0x67, 0x16, 0x53, 0x18, 
+	0xab, 0xa1, 0x00, 0x27, 0x12, 0x07, 0xac, 0x10, 0x1f, 0x02, 0x40, 0x0f, 0xa6, 0x00, 0x47, 0x10, 
+	0x13, 0x88, 0x44, 0x00, 0x00, 0x03, 0x0d, 0x30, 0xc0, 0x00, 0x90, 0x6d, 0x80, 0x0c, 0x17, 0x66, 
+	0x00, 0x03, 0x56, 0x55, 0x55, 0x55, 0x57, 0x55, 0x03, 0x7c, 0x10, 0x00, 0x8b, 0x14, 0x0c, 0x7f, 
+	0x1f, 0xf7, 0x10, 0x0b, 0xb8, 0x11, 0xab, 0x04, 0x20, 0x0f, 0x00, 0x53, 0x04, 0x33, 0xac, 0x46, 
+	0x00, 0x10, 0x03, 0x58, 0x48, 0x05, 0x4b, 0xc0, 0x8f, 0xe2, 0x80, 0x82, 0x00, 0x1f, 0x40, 0xf1, 
+	0x9f, 0x15, 0xa5, 0x00, 0xd3, 0xa4, 0xc8, 0x1a, 0x3f, 0x01, 0x23, 0x10, 0x02, 0x08, 0x3f, 0x00, 
+	0x52, 0xe3, 0x09, 0x0c, 0xf0, 0xa0, 0x01, 0x02, 0x4f, 0xe2, 0xa5, 0x00, 0xe7, 0x41, 0xa4, 0x41, 
+	0x23, 0xa4, 0x54, 0xca, 0xe5, 0xa5, 0x00, 0x03, 0xf8, 0x21, 0x33, 0x0d, 0xfb, 0x10, 0xf7, 0x05, 
+	0xc8, 0x02, 0xf7, 0x10, 0xe3, 0xe7, 0x0d, 0xf6, 0xff, 0xeb, 0x0c, 0x00, 0x6b, 0x06, 0xc3, 0xea, 
+	0x10, 0x0f, 0x65, 0xe6, 0x40, 0x0f, 0x03, 0xdf, 0xea, 0x00, 0x00, 0x6b, 0xe3, 0x1d, 0x23, 0xf5, 
+	0x40, 0x3f, 0x10, 0xc7, 0x02, 0xbf, 0x20, 0x17, 0xdd, 0x80, 0x17, 0xa2, 0x00, 0x17, 0x21, 0x1c, 
+	0x15, 0x01, 0x17, 0x01, 0x11, 0xe3, 0x16, 0x00, 0x57, 0x6b, 0xa1, 0x01, 0x2f, 0x10, 0x67, 0xa0, 
+	0x00, 0x9b, 0x10, 0x04, 0x37, 0x13, 0x63, 0x2a, 0xce, 0xf7, 0x70, 0x67, 0xba, 0x00, 0x0b, 0xa2, 
+	0x00, 0x23, 0xdf, 0xd0, 0x40, 0x13, 0x03, 0xa3, 0xea, 0x1b, 0x87, 0x03, 0x10, 0x59, 0x05, 0x00, 
+	0xee, 0x00, 0x51, 0x03, 0xff, 0x00, 0xa0, 0x03, 0xbb, 0x10, 0x63, 0xc4, 0x00, 0x63, 0x11, 0xff, 
+	0x50, 0x67, 0xa3, 0x00, 0x67, 0x10, 0x5b, 0x5d, 0xa3, 0x20, 0x57, 0x00, 0x09, 0x47, 0x02, 0x17, 
+	0x00, 0x0b, 0x08, 0x00, 0x63, 0xba, 0x03, 0xef, 0x0a, 0x1f, 0x8f, 0x04, 0x03, 0x01, 0x07, 0x11, 
+	0x10, 0xdf, 0x0a, 0x42, 0xfb, 0x00, 0xcb, 0x0f, 0x00, 0x8c, 0xe3, 0x1f, 0x9f, 0x0b, 0x08, 0xf7, 
+	0xff, 0xea, 0x0a, 0x00, 0x6f, 0x10, 0x00, 0x0c, 0x41, 0xe2, 0x10, 0x0f, 0xf4, 0xf6, 0xff, 0xea, 
+	0x12, 0x00, 0x13, 0x22, 0xec, 0x9b, 0x1d, 0xaf, 0x00, 0xeb, 0x38, 0x00, 0x03, 0x1b, 0xb9, 0x00, 
+	0x13, 0xb8, 0x0f, 0xf3, 0xd3, 0x9b, 0x13, 0x93, 0xf4, 0x06, 0x6a, 0x8f, 0x21, 0x11, 0x58, 0x00, 
+	0x83, 0x10, 0x10, 0x10, 0xe2, 0x0e, 0x23, 0x12, 0x13, 0x28, 0x00, 0x00, 0x07, 0x00, 0xa0, 0x03, 
+	0x9e, 0x51, 0xd0, 0x2a, 0x87, 0x11, 0x43, 0x14, 0x00, 0x3f, 0xb0, 0x04, 0x9a, 0x15, 0x00, 0xb4, 
+	0x04, 0x9a, 0x05, 0x01, 0x02, 0x40, 0xe0, 0x06, 0x0c, 0xc2, 0x80, 0xe0, 0x02, 0x02, 0xf3, 0x13, 
+	0xb7, 0x90, 0x04, 0x1c, 0x8c, 0xe0, 0x90, 0x12, 0x03, 0xef, 0x00, 0x52, 0xae, 0x28, 0x4f, 0xa2, 
+	0x00, 0xbf, 0xa0, 0x12, 0xb7, 0x01, 0xbb, 0x01, 0x1b, 0x0a, 0x00, 0x00, 0xc0, 0x52, 0xe0, 0xa0, 
+	0xc4, 0xca, 0xe5, 0xdf, 0x13, 0xef, 0x15, 0x73, 0x11, 0x00, 0x13, 0x53, 0xbf, 0x14, 0x1f, 0x13, 
+	0x33, 0x13, 0x27, 0x66, 0xd8, 0x04, 0xcf, 0x12, 0x77, 0x74, 0xfe, 0x32, 0x77, 0x02, 0x8f, 0xea, 
+	0x82, 0x10, 0xf7, 0x04, 0x10, 0xc1, 0xe3, 0xa2, 0x0f, 0x97, 0xa1, 0xcb, 0x00, 0x53, 0x00, 0xbb, 
+	0x12, 0xa0, 0x02, 0x07, 0x02, 0x06, 0x97, 0x0e, 0xeb, 0xdd, 0x2b, 0x63, 0x50, 0xc7, 0x1f, 0x00, 
+	0x5f, 0xf0, 0xc7, 0x30, 0xc7, 0x18, 0x00, 0x73, 0x85, 0x13, 0x57, 0xff, 0x14, 0xd1, 0xe3, 0x1b, 
+	0x3b, 0xb8, 0x03, 0xe7, 0x99, 0x10, 0xd3, 0x01, 0x20, 0x04, 0xf7, 0x00, 0xdf, 0xb0, 0x14, 0x00, 
+	0xdb, 0x04, 0x14, 0x9a, 0x05, 0x02, 0x22, 0x34, 0x8b, 0x90, 0xc2, 0x42, 0x82, 0x00, 0xb3, 0xda, 
+	0xe5, 0x0c, 0xc0, 0x08, 0x6b, 0xc0, 0x20, 0xa0, 0x03, 0x04, 0xcb, 0xe0, 0x08, 0xc8, 0x9a, 0xe5, 
+	0x0a, 0x9c, 0x02, 0x02, 0xe0, 0x10, 0x33, 0x14, 0x05, 0xfb, 0x22, 0x34, 0x12, 0x80, 0x29, 0xcf, 
+	0x14, 0x0b, 0x20, 0x00, 0xbb, 0x46, 0xfe, 0x2d, 0xff, 0xea, 0x50, 0x0f, 0x66, 0x00, 0x0b, 0x33, 
+	0x63, 0x80, 0x23, 0x63, 0x09, 0xbd, 0xf5, 0xff, 0xea, 0x13, 0x1f, 0x0c, 0x6c, 0x28, 0x6f, 0xcc, 
+	0xf0, 0x01, 0x80, 0x01, 0xff, 0xff, 0x30, 0x01, 0x10, 0x0b, 0xd0, 0x52, 0xd0, 0x05, 0x6b, 0xc0, 
+	0x03, 0xe8, 0x00, 0x03, 0xb0, 0x50, 0x00, 0x03, 0x0e, 0x50, 0x58, 0x00, 0x03, 0x10, 0x1f, 0x1f, 
+	0x77, 0x60, 0x03, 0xa8, 0x68, 0xff, 0x1f, 0x87, 0xa0, 0x01, 0xc4, 0x00, 0x23, 0x3c, 0x53, 0x00, 
+	0x2a, 0x03, 0x30, 0x00, 0x03, 0x24, 0x00, 0x03, 0x18, 0x00, 0x03, 0xdc, 0xac, 0x00, 0x13, 0x88, 
+	0x00, 0x43, 0x24, 0x00, 0x43, 0x10, 0x1f, 0x00, 0x28, 0x00, 0x00, 0x03, 0x54, 0x5b, 0x00, 0x08, 
+	0xe0, 0x5c, 0x9a, 0x30, 0x03, 0x44, 0x5e, 0x0f, 0xc3, 0x00, 0x13, 0x78, 0x00, 0x03, 0xf4, 0xab, 
+	0x00, 0x0f, 0xa0, 0x00, 0x07, 0xd4, 0x00, 0x03, 0xf0, 0x00, 0x03, 0x10, 0x1f, 0x4c, 0x6c, 0x00, 
+	0x1f, 0x0c, 0x29, 0x00, 0x57, 0x00, 0x03, 0x20, 0x5d, 0xda, 0x0b, 0xf9, 0x00, 0x07, 0xe8, 0x00, 
+	0x03, 0x50, 0x3f, 0x58, 0x00, 0x1f, 0x30, 0x6d, 0x2a, 0x00, 0x53, 0x00, 0x03, 0x68, 0x10, 0x1f, 
+	0x00, 0x07, 0x94, 0x00, 0x03, 0x06, 0x78, 0x41, 0x00, 0x03, 0x98, 0x10, 0x0f, 0x00, 0x1f, 0xd0, 
+	0x82, 0x00, 0x0f, 0x0c, 0x2b, 0x00, 0x03, 0xe4, 0x00, 0x0f, 0x54, 0xaa, 0x00, 0x07, 0x90, 0x80, 
+	0x7f, 0xa0, 0x00, 0x0f, 0xcc, 0x00, 0x03, 0xec, 0xc1, 0x00, 0x03, 0x10, 0x0f, 0x18, 0x2c, 0x00, 
+	0x03, 0x48, 0x00, 0x03, 0x6a, 0x64, 0x00, 0x03, 0x10, 0x0f, 0x88, 0x00, 0x07, 0xc4, 0x00, 0x03, 
+	0xf4, 0x9d, 0x40, 0x0f, 0x38, 0x2d, 0x04, 0x7b, 0x00, 0x03, 0x90, 0x7f, 0xe8, 0x00, 0x0f, 0x2b, 
+	0x0c, 0x2e, 0x30, 0x13, 0x3c, 0x00, 0x07, 0x50, 0x00, 0x03, 0x10, 0x7f, 0xd4, 0x10, 0x0f, 0x10, 
+	0x7f, 0x8c, 0x00, 0x0f, 0xc8, 0x40, 0x1f, 0x10, 0x2f, 0xd6, 0x00, 0x6f, 0xc0, 0xff, 0x74, 0x00, 
+	0x13, 0x94, 0x00, 0x03, 0x10, 0x0f, 0xb8, 0xa8, 0x00, 0x07, 0xd8, 0x00, 0x03, 0xf4, 0x40, 0x0f, 
+	0x1c, 0x30, 0x00, 0x2d, 0x03, 0x4c, 0x00, 0x03, 0x7c, 0x00, 0x03, 0x10, 0x0f, 0xc0, 0x00, 0x07, 
+	0x2a, 0x28, 0x31, 0xb0, 0x7f, 0x70, 0x00, 0x0f, 0x94, 0x40, 0x13, 0xbc, 0xb9, 0x00, 0x07, 0xc8, 
+	0x00, 0x03, 0x90, 0x7f, 0x0d, 0x07, 0x03, 0x40, 0x00, 0x03, 0xda, 0x20, 0xcf, 0x00, 0x07, 0x08, 
+	0x40, 0x3b, 0x50, 0x7f, 0xd0, 0x00, 0x13, 0x00, 0x55, 0x33, 0x30, 0x1f, 0x30, 0x00, 0x07, 0x58, 
+	0x00, 0x03, 0x84, 0x40, 0x0f, 0x52, 0xa8, 0x00, 0x07, 0xf4, 0x00, 0x03, 0x34, 0x34, 0x30, 0x0f, 
+	0x7c, 0xb0, 0x00, 0x07, 0xe4, 0x40, 0x0b, 0x50, 0x7f, 0x3c, 0x35, 0x00, 0x03, 0x6b, 0x70, 0x00, 
+	0x03, 0x10, 0x0f, 0xa4, 0x00, 0x07, 0xb8, 0x00, 0x03, 0xa0, 0x7f, 0x7b, 0x36, 0x01, 0x13, 0x00, 
+	0x03, 0x20, 0x5f, 0x00, 0x0f, 0x9c, 0x00, 0x0b, 0x10, 0x07, 0xa9, 0x10, 0x0f, 0xd4, 0x00, 0x0b, 
+	0xf0, 0x00, 0x03, 0x0c, 0x37, 0x30, 0x1f, 0x6a, 0x28, 0x00, 0x07, 0x10, 0x1b, 0x40, 0x40, 0x0f, 
+	0x58, 0x00, 0x07, 0x84, 0xa0, 0x00, 0x03, 0xb0, 0x00, 0x03, 0x10, 0x5f, 0x00, 0x08, 0xdc, 0x95, 
+	0x00, 0x07, 0x44, 0x38, 0x70, 0x7f, 0x80, 0x00, 0x0b, 0xa0, 0x00, 0x03, 0x69, 0xc0, 0x50, 0x13, 
+	0x00, 0x07, 0xf8, 0x00, 0x03, 0x28, 0x39, 0x70, 0x23, 0x55, 0x40, 0x80, 0x0b, 0x70, 0x00, 0x0b, 
+	0x88, 0x00, 0x03, 0xc4, 0x40, 0x13, 0x53, 0xdc, 0x00, 0x07, 0xf8, 0x00, 0x03, 0x14, 0x3a, 0x40, 
+	0x9f, 0x00, 0x07, 0x55, 0x48, 0x00, 0x03, 0x60, 0x40, 0x0f, 0x78, 0x00, 0x07, 0xa8, 0x00, 0x03, 
+	0x4e, 0xd8, 0x40, 0x0f, 0x08, 0x3b, 0x00, 0xeb, 0x00, 0x03, 0x10, 0x0b, 0x9c, 0xa9, 0x00, 0xa7, 
+	0xb8, 0x00, 0x0b, 0xdc, 0x00, 0x03, 0x00, 0x3c, 0x30, 0x13, 0x55, 0x24, 0x00, 0x07, 0x38, 0x00, 
+	0x03, 0x74, 0x40, 0x0f, 0x90, 0x00, 0x07, 0x4a, 0xcc, 0x00, 0x03, 0x08, 0x3d, 0x30, 0x0f, 0x44, 
+	0x00, 0x07, 0x54, 0xd5, 0x41, 0x07, 0x10, 0x0f, 0x64, 0x00, 0x0f, 0x88, 0x00, 0x03, 0xac, 0x40, 
+	0x1f, 0x53, 0xd0, 0x00, 0x07, 0xe8, 0x00, 0x03, 0x08, 0x3e, 0x01, 0x17, 0x00, 0x23, 0x56, 0x20, 
+	0x00, 0x07, 0x54, 0x00, 0x03, 0x88, 0x00, 0x03, 0x10, 0x1f, 0xc4, 0x95, 0x00, 0x07, 0x2c, 0x3f, 
+	0xb1, 0x7f, 0x78, 0x00, 0x0f, 0xa0, 0x40, 0x13, 0x58, 0xc8, 0x00, 0x07, 0xdc, 0x00, 0x03, 0x91, 
+	0x7f, 0x1c, 0x40, 0x00, 0x3a, 0x03, 0x5c, 0x00, 0x03, 0x20, 0xb3, 0x00, 0x07, 0x94, 0x80, 0x7f, 
+	0xbc, 0xd5, 0x10, 0x17, 0x00, 0x03, 0x10, 0x40, 0x2f, 0x34, 0x00, 0x07, 0x4c, 0x00, 0x03, 0xd5, 
+	0x10, 0x3f, 0x10, 0x07, 0x88, 0x00, 0x03, 0xbc, 0x00, 0x03, 0xfc, 0x40, 0x1f, 0x39, 0x38, 0x42, 
+	0x00, 0x5f, 0x00, 0x03, 0x90, 0x7f, 0x34, 0x43, 0x03, 0x7b, 0xed, 0x00, 0x03, 0x20, 0xef, 0x00, 
+	0x07, 0xa4, 0x00, 0x03, 0x90, 0x7f, 0xf0, 0x00, 0x0f, 0x7f, 0x3c, 0x07, 0xbb, 0x10, 0x0f, 0xf4, 
+	0x85, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xa0, 0x01, 0xf0, 0x06, 0x84, 0xf0, 0x01, 0xf0, 0x01, 
+	0x18, 0x29, 0xc0, 0xfc, 0x03, 0x02, 0x00, 0x80, 0xfb, 0x03, 0x02, 0xdc, 0xed, 0x03, 0x02, 0x7f, 
+	0xb0, 0x00, 0x03, 0xf0, 0x23, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xff, 
+	0xe0, 0x01, 0xf5, 0xa1, 0xf0, 0x01, 0xf0, 0xe3, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xfc, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0x00, 0x01, 0xff, 0x01, 0x39, 
+	0xff, 0x20, 0xf0, 0x15, 0xf0, 0x01, 0xd0, 0x01, 0xb0, 0x5d, 0x02, 0xf7, 0xa6, 0x00, 0x03, 0xfc, 
+	0x00, 0x03, 0x08, 0x5e, 0x03, 0xf7, 0x80, 0x0f, 0x18, 0xfb, 0x00, 0x0f, 0xf0, 0x31, 0xb0, 0x01, 
+	0x1f, 0x3f, 0x20, 0x03, 0xe5, 0x40, 0x03, 0xc0, 0x0f, 0xf8, 0xf0, 0x31, 0xf0, 0x01, 0x30, 0xc0, 
+	0x00, 0x2b, 0x00, 0x03, 0x08, 0xf6, 0x03, 0x12, 0x02, 0x28, 0xf4, 0x30, 0x37, 0x48, 0xf2, 0xb0, 
+	0x3f, 0x8c, 0x40, 0xc1, 0x70, 0x0f, 0x58, 0xf1, 0x03, 0x02, 0x68, 0xf0, 0xb6, 0x30, 0x0f, 0x40, 
+	0x09, 0xe8, 0x60, 0x01, 0xfe, 0x40, 0x23, 0x07, 0x65, 0x38, 0x0f, 0xee, 0x03, 0x02, 0xc0, 0x00, 
+	0x03, 0xf0, 0x6c, 0xf0, 0x01, 0xf0, 0x01, 0xff, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 
+	0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf8, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 
+	0x01, 0xf0, 0x01, 0xef, 0xbe, 0xad, 0x4a, 0xde, 0x10, 0x07, 0x49, 0xd0, 0x0a, 0x5f, 0xce, 0x04, 
+	0x33, 0xe0, 0x80, 0x38, 0xab, 0x00, 0x80, 0x40, 0xc0, 0x10, 0x90, 0x50, 0x00, 0xd0, 0x20, 0xa0, 
+	0x60, 0xe0, 0x30, 0xb0, 0x70, 0x00, 0xf0, 0x00, 0x02, 0x01, 0x03, 0x04, 0x06, 0x05, 0x00, 0x07, 
+	0x08, 0x0a, 0x09, 0x0b, 0x0c, 0xe0, 0xd0, 0x00, 0x0f, 0x0e, 0x60, 0xa0, 0xe1, 0x24, 0x44, 0x9a, 
+	0x02, 0xe5, 0x24, 0x01, 0xb0, 0xe1, 0x38, 0x09, 0x83, 0xf0, 0x04, 0x00, 0x01, 0xe2, 0xe8, 0x25, 
+	0x1d, 0x93, 0x01, 0x20, 0x00, 0xa1, 0xc4, 0xb0, 0x21, 0x22, 0x18, 0x01, 0x20, 0x00, 0x4c, 0xc0, 
+	0x4f, 0xe2, 0x20, 0x02, 0xdc, 0xe7, 0x00, 0x0f, 0x10, 0x01, 0xe2, 0x01, 0x0b, 0x12, 0xe3, 0x80, 
+	0x00, 0x0f, 0x12, 0x01, 0x10, 0xdc, 0x17, 0x00, 0x00, 0x80, 0x0c, 0xd3, 0x01, 0x12, 0xe3, 0xc0, 
+	0xf0, 0x9f, 0x15, 0x00, 0x02, 0x02, 0x12, 0xe3, 0xec, 0x05, 0xca, 0x15, 0x59, 0x01, 0x00, 0x0f, 
+	0xed, 0x00, 0x07, 0x04, 0x37, 0xe2, 0x06, 0x0c, 0x0b, 0x88, 0x09, 0xbf, 0xe2, 0xf9, 0x05, 0x2c, 
+	0x9f, 0x01, 0xf8, 0x25, 0x11, 0xda, 0xe5, 0x03, 0x0a, 0x77, 0x00, 0x20, 0xe0, 0x00, 0x2b, 0x08, 
+	0xda, 0xe5, 0xee, 0x15, 0x0a, 0x33, 0x04, 0x80, 0xe1, 0x00, 0x02, 0x04, 0x80, 0x41, 0x02, 0x07, 
+	0x80, 0x53, 0x05, 0xf0, 0x05, 0x8a, 0xe5, 0xed, 0x00, 0x17, 0xef, 0x80, 0x17, 0x58, 0x01, 0x00, 
+	0x17, 0xf4, 0x00, 0x17, 0x2d, 0x9f, 0x05, 0x9a, 0xe5, 0x6c, 0xc0, 0x0e, 0x63, 0x1c, 0x7f, 0xf9, 
+	0x00, 0x4b, 0x1a, 0x67, 0xf0, 0x15, 0x18, 0x8a, 0x05, 0x28, 0x00, 0x2f, 0x1b, 0xf7, 0x40, 0x00, 
+	0x80, 0x4e, 0x03, 0x00, 0x27, 0x01, 0xec, 0x00, 0x0f, 0x1b, 0xa3, 0x00, 0x0f, 0x13, 0xa5, 0x10, 
+	0x37, 0xf4, 0xf0, 0x37, 0xe1, 0xf4, 0x80, 0x37, 0xf8, 0x40, 0x27, 0x06, 0xc4, 0x6c, 0x00, 0x08, 
+	0x7a, 0x1a, 0xef, 0x3b, 0x77, 0x01, 0x08, 0xff, 0x5f, 0x2d, 0xe9, 0x01, 0x52, 0xeb, 0xff, 0x9f, 
+	0x04, 0xbd, 0xe8, 0xe0, 0x85, 0x9f, 0x0e, 0x3b, 0x98, 0xe8, 0xd5, 0x1c, 0x03, 0x1e, 0x1f, 0x03, 
+	0x00, 0x03, 0x04, 0x00, 0x03, 0x05, 0x00, 0x03, 0x46, 0x06, 0x00, 0x03, 0x07, 0x00, 0x90, 0x20, 
+	0x33, 0x1b, 0x23, 0xb8, 0x00, 0x75, 0x9f, 0xe5, 0x80, 0x54, 0x9a, 0xe5, 0x88, 0x41, 0x64, 0x0b, 
+	0x97, 0x00, 0xd6, 0xe1, 0x02, 0x09, 0x2d, 0x5f, 0x00, 0x01, 0xa4, 0xf5, 0x9f, 0x05, 0x14, 0xb0, 
+	0xa0, 0x10, 0xe3, 0xa0, 0x25, 0x0b, 0x4b, 0x90, 0xa0, 0xe3, 0x9c, 0x0a, 0xf5, 0x9f, 0xe5, 0x5a, 
+	0x0b, 0x37, 0x18, 0x0e, 0x63, 0x18, 0xca, 0x01, 0x17, 0x03, 0xfc, 0x1a, 0x58, 0x00, 0x0f, 0x74, 
+	0x0b, 0xa3, 0x20, 0x80, 0x3e, 0x53, 0x1a, 0x08, 0x00, 0x51, 0xe3, 0x1a, 0x00, 0x20, 0x00, 0x2a, 
+	0x10, 0x0f, 0x18, 0x00, 0x2d, 0xe9, 0xa8, 0x40, 0xc6, 0x0b, 0x17, 0x00, 0xdc, 0xe5, 0x02, 0x30, 
+	0xdc, 0x00, 0xe5, 0x01, 0xc0, 0x00, 0x12, 0x01, 0x00, 0xc0, 0x00, 0x13, 0x08, 0xc0, 0x02, 0x02, 
+	0xac, 0xc1, 0xa0, 0x00, 0x01, 0x0c, 0x04, 0x80, 0xe0, 0x20, 0x43, 0xa0, 0x00, 0xe1, 0x19, 0xcd, 
+	0x8a, 0xe2, 0x04, 0x41, 0x9c, 0x20, 0xe7, 0x3f, 0x00, 0xef, 0x00, 0x42, 0x84, 0xe0, 0x80, 0x30, 
+	0x00, 0x13, 0x2e, 0x9f, 0x10, 0x43, 0x07, 0x10, 0x61, 0x02, 0x10, 0x17, 0x10, 0x61, 0x00, 0x37, 
+	0xf4, 0xe7, 0x08, 0x40, 0x52, 0xd4, 0x0d, 0x5f, 0x90, 0x11, 0x17, 0x0a, 0x14, 0x00, 0x8b, 0x60, 
+	0x0d, 0x00, 0xbd, 0xe8, 0x18, 0x00, 0x03, 0x10, 0x7f, 0x01, 0x0f, 0x8f, 0x83, 0x10, 0x7b, 0x10, 
+	0x10, 0xa0, 0x03, 0x18, 0x00, 0x07, 0x06, 0x84, 0x28, 0x0a, 0x74, 0x0b, 0xe7, 0x60, 0x0b, 0x97, 
+	0x08, 0x08, 0x9a, 0x02, 0xe5, 0x20, 0x12, 0x81, 0xe0, 0xc4, 0x4f, 0x6f, 0x5c, 0x86, 0x4f, 0xeb, 
+	0xd4, 0xf4, 0x9f, 0xe5, 0x10, 0x03, 0x11, 0x03, 0xfc, 0x00, 0x16, 0x9a, 0xe5, 0x84, 0x20, 0x81, 
+	0xe2, 0x0d, 0x82, 0x01, 0xcf, 0x02, 0x00, 0x50, 0xe3, 0x04, 0x0e, 0x97, 0x00, 0x10, 0x40, 0xa0, 
+	0xe3, 0x0d, 0xe7, 0x3a, 0x01, 0x30, 0x72, 0x00, 0xe5, 0x83, 0x30, 0x83, 0xe0, 0x23, 0x31, 0xa0, 
+	0x00, 0xe1, 0x0d, 0x30, 0x53, 0xe2, 0x00, 0x30, 0xa0, 0x00, 0xd3, 0x9f, 0x00, 0x53, 0xe3, 0x9f, 
+	0x30, 0xa0, 0x08, 0xa3, 0x04, 0x44, 0x83, 0x00, 0x8f, 0x50, 0xe2, 0xf5, 0x12, 0xff, 0xff, 0xca, 
+	0x1d, 0xa7, 0x77, 0x54, 0x00, 0x8b, 0x50, 0x21, 0x85, 0xe2, 0x10, 0x33, 0x05, 0x30, 0x53, 0xe0, 
+	0xf0, 0x2b, 0x18, 0x50, 0xe2, 0xf7, 0x00, 0x2b, 0x1f, 0x07, 0x24, 0x44, 0xa0, 0x00, 0xe1, 0xff, 
+	0x44, 0x84, 0xe3, 0xff, 0x20, 0x14, 0x8c, 0x0f, 0xc3, 0x00, 0x1a, 0x44, 0x00, 0x0f, 0x01, 0xaf, 
+	0xe2, 0xfa, 0x88, 0x0d, 0xd7, 0x04, 0x47, 0x8a, 0x21, 0xf7, 0x9f, 0x00, 0x52, 0x10, 0x13, 0x34, 
+	0x34, 0x00, 0xa3, 0x50, 0xd3, 0xe5, 0x20, 0x00, 0x50, 0x85, 0xe3, 0x20, 0x50, 0xc5, 0xa3, 0x00, 
+	0x20, 0x50, 0xc3, 0x0c, 0x6b, 0xc3, 0xb5, 0x00, 0x70, 0xa0, 0xe0, 0x20, 0x3b, 0x00, 0x23, 0x11, 
+	0x2f, 0xaa, 0x01, 0x70, 0x87, 0xe2, 0xa0, 0x10, 0x43, 0xf9, 0x00, 0x3f, 0x84, 0x80, 0x81, 0xe2, 
+	0x00, 0x08, 0x80, 0x88, 0xe0, 0x80, 0x00, 0xf7, 0x01, 0x90, 0xd8, 0x01, 0xe4, 0x05, 0x04, 0xa0, 
+	0xe3, 0xf0, 0x23, 0x0f, 0x2f, 0x08, 0x00, 0x19, 0xe3, 0x7e, 0x00, 0xd7, 0x60, 0x40, 0xa0, 0x54, 
+	0x13, 0x0c, 0xc7, 0xeb, 0x0e, 0x8f, 0xeb, 0x02, 0xfc, 0xeb, 0x14, 0x85, 0x00, 0x03, 0x66, 0x0f, 
+	0x80, 0xe2, 0x0c, 0xe0, 0xeb, 0x0d, 0x53, 0xa0, 0x0e, 0x07, 0x00, 0x0e, 0x1b, 0x00, 0xeb, 0x01, 
+	0x70, 0x57, 0x00, 0xe2, 0x0c, 0x00, 0x00, 0xba, 0xb8, 0x03, 0x9f, 0x00, 0xe5, 0x40, 0x30, 0x40, 
+	0xe2, 0x08, 0x37, 0x8a, 0x60, 0xe5, 0x10, 0x4f, 0x90, 0x47, 0x08, 0xc0, 0xa0, 0xe3, 0x05, 0x87, 
+	0x10, 0x2b, 0xc0, 0x5c, 0xe2, 0xfc, 0x00, 0xdb, 0x10, 0x33, 0x01, 0x0f, 0x10, 0xaa, 0x00, 0x80, 
+	0x11, 0x9f, 0x80, 0xe2, 0x04, 0x30, 0x00, 0x91, 0xe4, 0x83, 0x60, 0x04, 0xe0, 0xb6, 0x60, 0x00, 
+	0x92, 0xe1, 0xa3, 0x53, 0x04, 0xe0, 0xb5, 0x50, 0x00, 0x92, 0xe1, 0x05, 0x58, 0x86, 0xe1, 0xa3, 
+	0x67, 0x80, 0x40, 0x13, 0x3b, 0x04, 0xe0, 0xb3, 0x30, 0x92, 0xe1, 0x00, 0x03, 0x68, 0x86, 0xe1, 
+	0x60, 0x00, 0xa0, 0xe8, 0x80, 0x1d, 0x87, 0x4c, 0xc3, 0x9f, 0xe5, 0x08, 0x27, 0x9c, 0x20, 0xe5, 
+	0x40, 0x0f, 0xab, 0x08, 0x27, 0x8c, 0xe5, 0x04, 0x81, 0x00, 0x0b, 0xff, 0x10, 0x02, 0xe2, 0x42, 
+	0x24, 0x0e, 0xbf, 0xac, 0x00, 0x0f, 0xff, 0x02, 0x83, 0x9f, 0x01, 0xe7, 0x00, 0x2b, 0xa1, 0x01, 
+	0x01, 0x00, 0x52, 0xe1, 0xf3, 0xff, 0xff, 0xda, 0x11, 0x07, 0x00, 0x04, 0x10, 0xd0, 0xe5, 0x30, 
+	0x10, 0x81, 0xe3, 0x01, 0x20, 0x10, 0xc1, 0xa3, 0x04, 0x10, 0xc0, 0x00, 0x27, 0x01, 0xa0, 0xa3, 
+	0x05, 0x20, 0xc0, 0xe5, 0x06, 0x00, 0x17, 0x50, 0x02, 0x0d, 0xbb, 0xe9, 0x10, 0x97, 0x12, 0x90, 
+	0xe5, 0x02, 0x10, 0x28, 0x11, 0xe2, 0x12, 0xff, 0x02, 0x1c, 0x80, 0xe2, 0x00, 0x02, 0x20, 0xa0, 
+	0xe3, 0x02, 0x20, 0xc1, 0xe5, 0xb4, 0x10, 0x3b, 0x10, 0x0e, 0x1f, 0x10, 0x37, 0x30, 0x02, 0x13, 
+	0xc8, 0x52, 0x80, 0x00, 0x83, 0x57, 0x95, 0xe5, 0x05, 0x14, 0xa0, 0xe3, 0x00, 0x1c, 0x10, 0xb5, 
+	0xe8, 0x0c, 0x00, 0x81, 0xe8, 0x4c, 0x20, 0x02, 0x67, 0x10, 0x10, 0x30, 0x07, 0xd0, 0x13, 0x1a, 
+	0x1e, 0xc4, 0xf0, 0x13, 0xf0, 0x27, 0x81, 0xe8, 0x05, 0x00, 0x67, 0x06, 0x20, 0x40, 0xd0, 0x01, 
+	0x8b, 0x52, 0xe1, 0x30, 0x80, 0xbd, 0xb8, 0x4a, 0x30, 0x0e, 0x9f, 0x04, 0x10, 0x00, 0x83, 0x2c, 
+	0x00, 0x8b, 0x10, 0x1c, 0xc2, 0xe5, 0xbf, 0x01, 0xbf, 0x12, 0x93, 0x12, 0xa3, 0x48, 0xf2, 0x12, 
+	0x9f, 0xe5, 0x79, 0x2d, 0xfb, 0x50, 0xe3, 0x12, 0x33, 0x79, 0xc0, 0x0d, 0xff, 0x00, 0x17, 0x11, 
+	0x34, 0xf2, 0x9f, 0x15, 0xff, 0x00, 0x1c, 0xa0, 0xe3, 0xe8, 0x06, 0x9a, 0xe5, 0x00, 0x18, 0x24, 
+	0x81, 0xe1, 0x06, 0x7a, 0x02, 0x43, 0x80, 0xe1, 0xe8, 0x0c, 0x06, 0x8a, 0xe5, 0x64, 0x0e, 0x73, 
+	0x90, 0x13, 0x64, 0x04, 0x15, 0x8a, 0xe5, 0x6c, 0xc0, 0x13, 0x6c, 0x00, 0x13, 0xe0, 0xc0, 0x3b, 
+	0x5a, 0xe0, 0x00, 0x3b, 0x34, 0x04, 0x7b, 0x90, 0x13, 0x34, 0x04, 0xcb, 0xfa, 0xc3, 0x4f, 0x13, 
+	0x14, 0x13, 0xc0, 0xf1, 0x9f, 0x05, 0x20, 0x0f, 0x03, 0x57, 0x74, 0x80, 0x00, 0xcf, 0x01, 0x5f, 
+	0x03, 0x2b, 0x50, 0x22, 0x7f, 0x00, 0x20, 0x30, 0xc1, 0xe7, 0x52, 0xbf, 0x10, 0xab, 0xfa, 0x06, 
+	0xca, 0xe5, 0x00, 0x94, 0xc1, 0x9f, 0xe5, 0xb0, 0x20, 0xdc, 0xe1, 0x00, 0x01, 0x20, 0xc2, 0xe3, 
+	0xb0, 0x20, 0xcc, 0xe1, 0x50, 0xa0, 0x00, 0x73, 0xa4, 0x03, 0x6b, 0xa0, 0x16, 0x8a, 0xe5, 0x55, 
+	0xa4, 0x00, 0x6f, 0xb0, 0x00, 0x0f, 0xb4, 0x00, 0x0f, 0xb0, 0x00, 0x0f, 0x55, 0xb4, 0x00, 0x0f, 
+	0xb8, 0x00, 0x0f, 0xbc, 0x00, 0x0f, 0xb8, 0x00, 0x0f, 0x54, 0xbc, 0x00, 0x0f, 0x80, 0x00, 0xb7, 
+	0x84, 0x05, 0xe7, 0x80, 0x14, 0x15, 0x8a, 0xe5, 0x84, 0x00, 0xb3, 0x88, 0x00, 0x0f, 0x8c, 0x00, 
+	0x0f, 0x55, 0x88, 0x00, 0x0f, 0x8c, 0x00, 0x0f, 0x90, 0x00, 0x0f, 0x94, 0x00, 0x07, 0x90, 0x0f, 
+	0x9b, 0xe3, 0x9d, 0x01, 0x1b, 0x28, 0x31, 0x9f, 0xe5, 0x20, 0x28, 0x11, 0x03, 0x2f, 0x30, 0x93, 
+	0xe5, 0x00, 0x10, 0x40, 0x91, 0x00, 0x17, 0x53, 0xe1, 0x9c, 0x04, 0xca, 0x05, 0x00, 0x06, 0x3c, 
+	0x8a, 0xe2, 0xd8, 0x30, 0x83, 0xe2, 0x01, 0x03, 0x00, 0x93, 0xe8, 0x00, 0x10, 0x83, 0x04, 0x47, 
+	0x1a, 0x83, 0xe5, 0x00, 0x0f, 0x77, 0x13, 0xf7, 0xfc, 0x00, 0x67, 0x00, 0x42, 0x17, 0x00, 0x43, 
+	0x0b, 0x8a, 0xe2, 0xd0, 0x00, 0xbf, 0x01, 0x08, 0x1b, 0x8a, 0xe2, 0xe0, 0x00, 0xdb, 0x78, 0x00, 
+	0x90, 0x2f, 0xe8, 0x78, 0x01, 0xb7, 0xfc, 0x04, 0x13, 0x10, 0xff, 0x02, 0xe3, 0x04, 0x0e, 0x15, 
+	0xa0, 0xe3, 0xfc, 0x06, 0x1f, 0xa8, 0x00, 0xa7, 0xac, 0x00, 0x3b, 0x53, 0xf0, 0x00, 0xa7, 0xac, 
+	0x00, 0x3f, 0xff, 0x06, 0x10, 0x17, 0x00, 0x43, 0x30, 0x20, 0x82, 0x20, 0xe7, 0x15, 0x4b, 0xf0, 
+	0x90, 0xd6, 0xe1, 0x2c, 0x09, 0x90, 0x20, 0x37, 0x4a, 0x15, 0x5f, 0x11, 0xcf, 0x90, 0xf0, 0x40, 
+	0x9f, 0x25, 0x67, 0x02, 0x09, 0xa0, 0xe3, 0xb0, 0x00, 0x44, 0xc6, 0x03, 0xef, 0xa0, 0xe3, 0xfd, 
+	0x00, 0x4f, 0x76, 0x44, 0x9a, 0x04, 0x37, 0x00, 0x34, 0x24, 0xb7, 0x10, 0x63, 0x01, 0x02, 0x0f, 
+	0x00, 0x0b, 0x00, 0x04, 0xef, 0x75, 0x01, 0xfb, 0x05, 0x01, 0x5f, 0x03, 0xd3, 0x32, 0x0a, 0x02, 
+	0x00, 0x1f, 0x04, 0x93, 0x03, 0xf6, 0x00, 0x0b, 0x00, 0xd2, 0x02, 0x33, 0x13, 0x27, 0x90, 0x0a, 
+	0xdf, 0x8c, 0xeb, 0x0a, 0xef, 0x5f, 0xb0, 0x0e, 0xdf, 0x76, 0x0e, 0x17, 0x09, 0x3f, 0x04, 0x7a, 
+	0x00, 0x08, 0x38, 0xac, 0x66, 0x0b, 0xd7, 0x0b, 0x8f, 0x08, 0xa6, 0x04, 0xc0, 0x00, 0x00, 0x00, 
+	0x05, 0x40, 0x01, 0x00, 0x05, 0x3c, 0x6e, 0x08, 0x00, 0x03, 0x9c, 0x64, 0x0d, 0x7b, 0x31, 0x00, 
+	0x06, 0x21, 0xcc, 0x7b, 0x07, 0x73, 0x02, 0x00, 0x04, 0xc4, 0x19, 0x7b, 0x60, 0x81, 0x0d, 0xf3, 
+	0x00, 0x3f, 0xb2, 0x0d, 0xc0, 0xe1, 0xb6, 0xa0, 0x02, 0x53, 0x40, 0x03, 0x3f, 0xb2, 0x1d, 0xc0, 
+	0xe1, 0x00, 0x62, 0x12, 0x02, 0xa3, 0x03, 0x0f, 0x00, 0x12, 0xc0, 0x00, 0x07, 0xa0, 0x20, 0xe3, 
+	0x08, 0x00, 0x07, 0xf0, 0x45, 0x2d, 0xe9, 0x3c, 0x00, 0xa1, 0x9f, 0xe5, 0x84, 0x35, 0x9a, 0xe5, 
+	0x38, 0x81, 0x01, 0xdb, 0x80, 0x40, 0x8c, 0xe2, 0x02, 0x01, 0x05, 0xaf, 0x11, 0x31, 0xa0, 0x13, 
+	0x04, 0x4b, 0x1a, 0x90, 0x15, 0x01, 0x9b, 0xa0, 0x12, 0x43, 0x0c, 0x04, 0xdb, 0x04, 0x11, 0xe3, 
+	0x44, 0x20, 0x00, 0x4a, 0x02, 0xa1, 0x56, 0xa0, 0x01, 0x05, 0x51, 0x01, 0x92, 0x07, 0x05, 0x10, 
+	0x81, 0x00, 0x01, 0x05, 0x3f, 0x41, 0x07, 0x01, 0x0f, 0x01, 0x20, 0xd1, 0xe4, 0xfc, 0x01, 0x0b, 
+	0x12, 0x04, 0x00, 0x5c, 0x14, 0xaf, 0x3a, 0x20, 0x00, 0x2f, 0x88, 0x82, 0x01, 0x3f, 0x90, 0x15, 
+	0x8a, 0xe5, 0x12, 0x05, 0x47, 0x7c, 0xa0, 0x06, 0xf7, 0x40, 0x05, 0xff, 0x80, 0x35, 0x9a, 0x15, 
+	0x8c, 0x00, 0x15, 0x9a, 0x15, 0xeb, 0xff, 0xff, 0x1a, 0x00, 0x91, 0x00, 0x83, 0x0c, 0x00, 0x03, 
+	0xff, 0x20, 0x5c, 0xe0, 0x01, 0x4b, 0x40, 0xc1, 0x07, 0xc7, 0xc5, 0x02, 0x01, 0x53, 0xe3, 0x06, 
+	0x96, 0x00, 0x77, 0x01, 0x13, 0x01, 0x33, 0x1c, 0x04, 0xf3, 0x01, 0x3b, 0xb2, 0x0d, 0x00, 0xc1, 
+	0xe1, 0x7d, 0x17, 0x97, 0x02, 0xc3, 0x7d, 0x01, 0x5b, 0x2d, 0x84, 0x35, 0x01, 0x97, 0x03, 0x01, 
+	0x4f, 0x20, 0xcf, 0x81, 0x20, 0xcf, 0x08, 0xf0, 0x85, 0xbd, 0xe8, 0x10, 0x13, 0x70, 0x10, 0x9f, 
+	0x00, 0xe5, 0x9c, 0x25, 0x91, 0xe5, 0x08, 0x01, 0x80, 0x02, 0xe5, 0x08, 0x21, 0x80, 0xe5, 0x94, 
+	0x00, 0x0b, 0x64, 0x2a, 0x20, 0x80, 0x17, 0xff, 0xe1, 0x10, 0x1f, 0x50, 0x00, 0x1f, 0xa0, 0xaa, 
+	0x00, 0x13, 0x0c, 0x00, 0x1f, 0x0c, 0x00, 0x1f, 0x98, 0x00, 0x0b, 0x6c, 0xac, 0x40, 0x1f, 0x5d, 
+	0x00, 0x63, 0x5c, 0x07, 0x93, 0x12, 0x1b, 0x01, 0x10, 0x28, 0xb0, 0x11, 0x01, 0x6b, 0x0a, 0x10, 
+	0x87, 0x73, 0x00, 0xd1, 0xad, 0x07, 0x0f, 0x80, 0x00, 0x07, 0xc1, 0x30, 0x47, 0x60, 0x13, 0xc0, 
+	0x60, 0x13, 0x80, 0x11, 0x8b, 0x80, 0x02, 0x00, 0x05, 0x70, 0x65, 0x00, 0x14, 0x03, 0x24, 0x51, 
+	0x0d, 0x87, 0xc4, 0x02, 0xb3, 0xc2, 0x8c, 0x11, 0xe0, 0x04, 0x10, 0x04, 0xe7, 0x0c, 0x11, 0xe3, 
+	0x01, 0x23, 0x01, 0x0a, 0xff, 0x18, 0xc1, 0xe3, 0xff, 0x1c, 0x14, 0x8f, 0x09, 0x8c, 0xe5, 0x30, 
+	0x04, 0x00, 0x1f, 0x00, 0xd0, 0x01, 0x13, 0x02, 0x00, 0xe2, 0x20, 0x03, 0xa0, 0xe1, 0x01, 0x6b, 
+	0xea, 0x41, 0x08, 0x04, 0x23, 0x00, 0x20, 0xa0, 0xe1, 0x09, 0x01, 0x13, 0x41, 0x28, 0x03, 0x13, 
+	0x04, 0xe0, 0x8f, 0xe2, 0x0c, 0x00, 0x47, 0x52, 0x1c, 0x00, 0x5f, 0x08, 0x05, 0x7b, 0x0c, 0xc0, 
+	0x38, 0x17, 0x00, 0x0a, 0x10, 0xdc, 0xe5, 0x4c, 0x27, 0x13, 0xa0, 0x12, 0x0f, 0x0a, 0x58, 0x1f, 
+	0x09, 0x33, 0x10, 0x02, 0x53, 0x0b, 0x68, 0x1a, 0x10, 0x00, 0x02, 0x41, 0xe2, 0xa0, 0x02, 0xa0, 
+	0xe1, 0x40, 0x2b, 0xe1, 0xc0, 0x00, 0xcb, 0x15, 0x53, 0xe1, 0x20, 0x08, 0xca, 0xe5, 0xb8, 0xd0, 
+	0x05, 0x83, 0x10, 0x93, 0x00, 0x00, 0x93, 0x1c, 0xc8, 0x9a, 0xe5, 0x61, 0x0c, 0x05, 0x3f, 0x58, 
+	0x33, 0xe7, 0xff, 0xff, 0xeb, 0x00, 0x3f, 0x20, 0x0a, 0xa0, 0x06, 0x53, 0x00, 0x01, 0x92, 0xe7, 
+	0x9c, 0x85, 0x16, 0x5b, 0x01, 0x82, 0xe7, 0x98, 0x06, 0x27, 0x98, 0x10, 0x13, 0x0a, 0x00, 0x82, 
+	0xe5, 0x03, 0x04, 0x1b, 0x0c, 0x05, 0x7b, 0x20, 0x0c, 0x08, 0xda, 0xe5, 0x6c, 0x60, 0x4b, 0x06, 
+	0x2b, 0x10, 0xcc, 0x08, 0xe5, 0x00, 0xc0, 0x9c, 0x00, 0x4f, 0xb0, 0xe1, 0x18, 0x00, 0x08, 0x8a, 
+	0x05, 0x1c, 0x08, 0x8a, 0xe5, 0xd3, 0xaa, 0x00, 0x4f, 0x0b, 0x00, 0x4f, 0x08, 0x00, 0x97, 0x5c, 
+	0x40, 0x53, 0x48, 0x88, 0x40, 0x53, 0x02, 0x10, 0x8c, 0x09, 0xbf, 0x8c, 0x02, 0x18, 0x70, 0x18, 
+	0x07, 0x13, 0x11, 0x63, 0x00, 0xcf, 0x01, 0x1c, 0x61, 0xe2, 0x60, 0x0c, 0x05, 0xa7, 0x53, 0x07, 
+	0x03, 0x00, 0x49, 0xe2, 0xff, 0x01, 0x0c, 0x00, 0xe2, 0xff, 0x1c, 0x09, 0xe2, 0x07, 0x63, 0x20, 
+	0xe1, 0x0f, 0x00, 0x7b, 0x12, 0x20, 0xa0, 0x13, 0x48, 0x01, 0x04, 0xa0, 0xe1, 0x10, 0x13, 0x9f, 
+	0x05, 0x00, 0x03, 0x00, 0x15, 0x90, 0xc1, 0x81, 0xe0, 0x03, 0x00, 0x59, 0x33, 0xe5, 0xca, 0x00, 
+	0x63, 0x08, 0xa3, 0x0a, 0x88, 0x00, 0x07, 0x06, 0xeb, 0x3a, 0x0a, 0xe8, 0x00, 0x07, 0x13, 0x77, 
+	0x10, 0x07, 0x27, 0x01, 0x13, 0xff, 0x0d, 0x04, 0x77, 0xe2, 0x25, 0x18, 0x7f, 0x02, 0x93, 0x00, 
+	0x00, 0xf3, 0x00, 0x00, 0x7c, 0x87, 0xa0, 0x01, 0x7c, 0x87, 0xb0, 0x81, 0x07, 0x1b, 0xea, 0xff, 
+	0x04, 0x76, 0xe2, 0x1e, 0x90, 0x1b, 0x01, 0x6c, 0x86, 0xa0, 0x01, 0x6c, 0x86, 0xb0, 0x07, 0x23, 
+	0x06, 0xea, 0x01, 0x04, 0x57, 0xe2, 0x0a, 0x64, 0x80, 0x37, 0x47, 0x9b, 0x00, 0x37, 0x47, 0xb0, 
+	0x03, 0xff, 0x00, 0x1b, 0x56, 0x01, 0x73, 0x90, 0x37, 0x44, 0x46, 0x00, 0x37, 0x46, 0xb0, 0x92, 
+	0x02, 0xb0, 0x92, 0x01, 0x02, 0x00, 0xb0, 0x00, 0x84, 0x48, 0xe0, 0x00, 0x83, 0xea, 0x01, 0x02, 
+	0x00, 0x18, 0xe3, 0x02, 0x80, 0x88, 0x03, 0xfb, 0x27, 0x00, 0x0a, 0x02, 0xd7, 0xeb, 0x5c, 0x05, 
+	0xff, 0x90, 0x13, 0x08, 0xfb, 0x08, 0xeb, 0xd1, 0x00, 0x59, 0x26, 0x17, 0x20, 0x28, 0xda, 0x18, 
+	0xe5, 0x14, 0xc2, 0x00, 0x1f, 0x12, 0x37, 0x50, 0x2d, 0xe9, 0x70, 0x08, 0x01, 0xa7, 0x10, 0xef, 
+	0x10, 0xff, 0x04, 0x90, 0xbd, 0xb8, 0x40, 0x0c, 0x01, 0x63, 0x9c, 0x20, 0x80, 0xe0, 0x90, 0x01, 
+	0x13, 0x01, 0xe0, 0x01, 0x00, 0x5f, 0x04, 0x50, 0x02, 0xf3, 0x41, 0x7f, 0x2a, 0xd4, 0x10, 0x05, 
+	0x93, 0x10, 0x32, 0x1f, 0x0e, 0x03, 0x8f, 0x08, 0xca, 0x09, 0xab, 0x08, 0xab, 0xe1, 0xf4, 0x03, 
+	0xd3, 0x82, 0x00, 0x4f, 0xb2, 0x00, 0x20, 0xdc, 0xe0, 0x0e, 0x0a, 0x02, 0xe2, 0xa0, 0x12, 0x05, 
+	0x94, 0xe7, 0x06, 0x07, 0xe0, 0x00, 0x06, 0xaf, 0x03, 0x33, 0x20, 0x82, 0x00, 0x07, 0x14, 0x0b, 
+	0x51, 0xe2, 0x04, 0x83, 0x09, 0xeb, 0xb9, 0x31, 0x7b, 0x7f, 0x0b, 0x67, 0x19, 0x7b, 0x00, 0x0b, 
+	0xc1, 0x05, 0x00, 0x07, 0x00, 0x58, 0x20, 0x8f, 0xe2, 0x01, 0x11, 0x92, 0xe7, 0x42, 0xd0, 0x02, 
+	0x27, 0x40, 0xd0, 0x4d, 0xe2, 0x09, 0x17, 0xba, 0x40, 0x0d, 0x02, 0xa7, 0xd0, 0x40, 0xb1, 0xe8, 
+	0xd0, 0x40, 0x75, 0xa2, 0x00, 0x03, 0xf0, 0x07, 0x10, 0x07, 0x0d, 0x0a, 0xf3, 0xa8, 0x08, 0xf3, 
+	0x01, 0x02, 0x60, 0x59, 0xe5, 0x04, 0x70, 0x59, 0x07, 0x23, 0x00, 0xdb, 0xe7, 0x07, 0xc0, 0xdb, 
+	0xe7, 0x02, 0x2c, 0xb4, 0x02, 0x9f, 0xcc, 0x0b, 0xf7, 0x02, 0xdf, 0x11, 0x00, 0x6f, 0x78, 0x3c, 
+	0x15, 0x00, 0x06, 0x90, 0x00, 0x03, 0x9c, 0x00, 0x03, 0xb8, 0x00, 0x03, 0x50, 0xac, 0x00, 0x03, 
+	0xd8, 0x00, 0x03, 0x04, 0x3d, 0x00, 0x06, 0x50, 0x24, 0x00, 0x03, 0x30, 0x00, 0x03, 0x42, 0x3c, 
+	0xa0, 0xe1, 0x01, 0x02, 0x50, 0xa0, 0xe1, 0x06, 0x30, 0xcb, 0x00, 0xbf, 0x8c, 0x01, 0x7f, 0x54, 
+	0x42, 0xe2, 0x10, 0x13, 0x10, 0x0f, 0x41, 0x80, 0x00, 0xc8, 0xe3, 0x01, 0x80, 0x88, 0x23, 0x40, 
+	0x80, 0x01, 0x88, 0x63, 0x40, 0xd0, 0x8d, 0xe2, 0xd0, 0x03, 0x2b, 0x80, 0x02, 0xd4, 0xe2, 0x01, 
+	0x14, 0x8c, 0xe2, 0x90, 0x21, 0x00, 0x22, 0xe0, 0x01, 0x24, 0x82, 0xe2, 0x0c, 0x20, 0x2f, 0x92, 
+	0xe0, 0x10, 0xdb, 0x07, 0x00, 0x87, 0x10, 0x83, 0x10, 0x7f, 0x10, 0x23, 0x0e, 0x90, 0x2c, 0x22, 
+	0xe0, 0xf0, 0x1b, 0x30, 0x1b, 0x50, 0x3f, 0x00, 0x90, 0x01, 0x7f, 0x2c, 0x1c, 0x00, 0x13, 0x1c, 
+	0x41, 0x22, 0x61, 0x2f, 0x24, 0xb2, 0x20, 0x2b, 0x06, 0x80, 0x2b, 0x90, 0x1b, 0x10, 0x6b, 0x10, 
+	0x3b, 0xa1, 0x14, 0x43, 0xf8, 0x01, 0x53, 0x10, 0xf0, 0x8e, 0xe2, 0x10, 0x13, 0xfc, 0xa0, 0x23, 
+	0x80, 0x1f, 0xf0, 0x4b, 0xf0, 0x27, 0x05, 0x4f, 0x20, 0x27, 0x60, 0xfa, 0x00, 0x03, 0x02, 0xc4, 
+	0x59, 0x00, 0x03, 0xc9, 0x2e, 0x02, 0x00, 0x08, 0xf0, 0x8f, 0x00, 0x08, 0x14, 0x73, 0xf4, 0x00, 
+	0x3e, 0x00, 0x03, 0x7c, 0x71, 0x00, 0x03, 0x14, 0x00, 0x90, 0x00, 0x08, 0x12, 0x11, 0x11, 0x11, 
+	0x8f, 0x00, 0xe3, 0x38, 0x0e, 0x1c, 0x30, 0x00, 0x03, 0xc4, 0x08, 0x29, 0x00, 0x03, 0xa0, 0x00, 
+	0x2f, 0x0c, 0x27, 0x9a, 0x02, 0xe5, 0x48, 0x24, 0x42, 0xe0, 0x10, 0x07, 0xdf, 0x02, 0x08, 0x10, 
+	0x81, 0xe0, 0xb8, 0x07, 0x67, 0x6c, 0x00, 0x1a, 0x09, 0xe5, 0x01, 0x0a, 0x10, 0x11, 0xdf, 0x11, 
+	0x58, 0x06, 0x8f, 0x05, 0x10, 0x20, 0x10, 0xe2, 0x01, 0x03, 0x5b, 0x28, 0x0d, 0x2b, 0xd2, 0x06, 
+	0xbf, 0x03, 0x16, 0x52, 0x22, 0x47, 0x14, 0xc7, 0x04, 0x23, 0x10, 0x10, 0x41, 0xe0, 0xec, 0x00, 
+	0x07, 0x91, 0x2c, 0xcc, 0xe0, 0x58, 0x00, 0x0a, 0x17, 0x20, 0x05, 0x3f, 0x18, 0xe7, 0x01, 0xc0, 
+	0xa0, 0x05, 0x23, 0x18, 0x10, 0x9f, 0x25, 0x00, 0x0b, 0x21, 0x00, 0x17, 0x3a, 0x23, 0x0c, 0x01, 
+	0x23, 0x10, 0x4f, 0x16, 0xff, 0x04, 0x06, 0x07, 0xa2, 0x00, 0x8b, 0x2e, 0xba, 0xa3, 0x8e, 0x3a, 
+	0xea, 0x88, 0x11, 0x6c, 0x00, 0x03, 0x1c, 0x07, 0x01, 0x00, 0x1c, 0x15, 0x03, 0x20, 0x1a, 0xa4, 
+	0x1b, 0xdb, 0xc0, 0x30, 0xe0, 0xa4, 0x04, 0x1a, 0xca, 0x15, 0xc0, 0x00, 0x13, 0x10, 0x67, 0x80, 
+	0x00, 0x07, 0x2f, 0x85, 0x03, 0x0b, 0x38, 0xf1, 0x9f, 0xe5, 0x10, 0x1f, 0x80, 0x0d, 0x13, 0x40, 
+	0x07, 0x12, 0x83, 0x10, 0x81, 0x13, 0x01, 0xf1, 0x9f, 0x41, 0xe7, 0x1e, 0x57, 0x9c, 0x49, 0x00, 
+	0x03, 0xd0, 0x00, 0x03, 0x55, 0x2c, 0x00, 0x03, 0x48, 0x00, 0x03, 0x64, 0x00, 0x03, 0x80, 0x00, 
+	0x03, 0x02, 0xe8, 0x3e, 0x00, 0x06, 0x74, 0x47, 0x07, 0x17, 0x4a, 0x10, 0x00, 0x03, 0x38, 0x00, 
+	0x03, 0xbc, 0x48, 0x00, 0x03, 0x56, 0xd8, 0x00, 0x03, 0xf4, 0x00, 0x03, 0x10, 0x80, 0x1f, 0x10, 
+	0x7f, 0xdf, 0xc1, 0x07, 0x67, 0x10, 0x5f, 0x07, 0x20, 0x01, 0xe2, 0x06, 0x0a, 0x5b, 0x76, 0xe3, 
+	0x0a, 0x3b, 0x10, 0x6b, 0x14, 0x83, 0x02, 0x00, 0x0f, 0x00, 0x1f, 0xba, 0xc5, 0x03, 0x8f, 0x03, 
+	0xb3, 0x52, 0xe3, 0xdc, 0x00, 0x1b, 0xa9, 0x00, 0x2b, 0x44, 0xa9, 0x08, 0x83, 0x01, 0x10, 0x20, 
+	0x0c, 0xc3, 0x11, 0xe3, 0x41, 0xd7, 0x00, 0x3f, 0x80, 0x00, 0x10, 0xe3, 0x01, 0x49, 0xcb, 0x55, 
+	0x8c, 0x00, 0xe7, 0x01, 0x04, 0xaf, 0xd1, 0x09, 0x1f, 0xa5, 0x10, 0x27, 0x14, 0x00, 0xe0, 0xe3, 
+	0x10, 0x5f, 0x40, 0x00, 0x2b, 0x0e, 0xc0, 0x1a, 0xa0, 0xe1, 0x70, 0x0e, 0x97, 0x10, 0x27, 0x6c, 
+	0x00, 0x27, 0xa5, 0xaf, 0x01, 0x67, 0x0c, 0x00, 0x0b, 0x64, 0x10, 0x33, 0x00, 0x8b, 0x0d, 0xef, 
+	0x01, 0x2b, 0x17, 0x10, 0xe3, 0x58, 0x40, 0x0f, 0xa1, 0x08, 0xd3, 0x25, 0x8b, 0x01, 0x7f, 0x50, 
+	0xa0, 0x01, 0x1b, 0x0c, 0x01, 0xaf, 0x48, 0x14, 0x41, 0xe0, 0x60, 0x10, 0x01, 0xbf, 0x08, 0x83, 
+	0xe0, 0xb8, 0x24, 0x8a, 0xe5, 0x4d, 0x30, 0x30, 0x2b, 0xe2, 0xa2, 0x00, 0x6b, 0x11, 0x6b, 0x20, 
+	0x2a, 0x47, 0x11, 0xc0, 0xe3, 0x20, 0x30, 0x0f, 0xe1, 0x80, 0xb0, 0x08, 0x27, 0x0a, 0x46, 0x00, 
+	0x03, 0xe0, 0x00, 0x07, 0x94, 0x00, 0xf3, 0x54, 0xa8, 0x00, 0x03, 0xb8, 0x00, 0x0f, 0xf8, 0x01, 
+	0x83, 0x64, 0x6b, 0x41, 0x20, 0x52, 0x4d, 0x01, 0x47, 0x53, 0x41, 0x56, 0x45, 0x00, 0x00, 0x74, 
+	0x4e, 0x45, 0x53, 0x20, 0x4d, 0x65, 0x6e, 0x00, 0x75, 0x20, 0x4d, 0x61, 0x6b, 0x65, 0x72, 0x20, 
+	0x00, 0x76, 0x31, 0x2e, 0x32, 0x61, 0x20, 0x2d, 0x20, 0x30, 0x42, 0x75, 0x05, 0xce, 0xbf, 0xd7, 
 };
 
-
 #endif /* SIMPLELIGHT_EMULATOR_POCKETNES_INCLUDED */
@@ -10,6 +10,8 @@
 #define MAX_NOR				0x40
 
 #define MAX_path_len 0x100
+#define MAX_name_len (FF_LFN_BUF + 1 + 4)	//a whole UTF-8 name, its NUL and room to append ".sav"
+#define MAX_name_pool 0x13000		//names of pFolder and pFilename_buffer, back to back
 
 #define FAT_table_size 0x400
 #define FAT_table_SAV_offset 0x200
@@ -19,7 +21,6 @@
 
 
 #define VideoBuffer    (u16*)0x6000000
-#define Vcache         (u16*)pReadCache
 #define RGB(r,g,b) ((r)+(g<<5)+(b<<10))
 
 #define PSRAMBase_S98			(void*)0x08800000
@@ -43,7 +44,7 @@
 int aP_depack(u8 *source,u8 *destination);
 
 typedef struct FM_NOR_FILE_SECT{////save to nor
-	unsigned char filename[100];	
+	unsigned char filename[100];	//UTF-8 cut at a code point, GBK before Upgrade_NOR_names
 	u16 rompage ;
 	u16 have_patch ;
 	u16	have_RTS;
@@ -54,11 +55,11 @@ typedef struct FM_NOR_FILE_SECT{////save to nor
 } FM_NOR_FS;
 
 typedef struct FM_Folder_SECT{
-	unsigned char filename[100];	
+	TCHAR *filename;	//whole name, in the name pool
 } FM_Folder_FS;
 
 typedef struct FM_FILE_SECT{
-	unsigned char filename[100];
+	TCHAR *filename;
 	u32 filesize;	
 } FM_FILE_FS;
 
@@ -98,8 +99,11 @@ u32 Setting_window(void);
 extern u16 gl_toggle_reset;
 extern u16 gl_toggle_backup;
 extern u16 gl_toggle_bold;
+extern u16 gl_toggle_verify;
+extern u16 gl_toggle_shard;
 
 u32 LoadRTSfile(TCHAR *filename);
+void Upgrade_NOR_names(void);
 void ShowTime(u32 page_num ,u32 page_mode);
 
 #endif /* SIMPLELIGHT_EZKERNEL_INCLUDED */
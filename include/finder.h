@@ -0,0 +1,22 @@
+#ifndef SIMPLELIGHT_FINDER_INCLUDED
+#define SIMPLELIGHT_FINDER_INCLUDED
+
+#include <gba_base.h>
+
+// Type-ahead over the SD listing (folders, then files, each in strcmp
+// order). The index is a second order of the same entries with ASCII case
+// folded, plus the first slot of every leading byte. A prefix is then one
+// bucket lookup and two binary searches inside it, so a key press costs a
+// few dozen compares however big the folder is. The index is built on
+// first use after the listing was read again.
+
+//listing changed, rebuild on next use
+void Find_drop(void);
+//entries starting with prefix (case folded) are index slots first..first+count-1, count
+u32 Find_match(const char *prefix, u32 *first);
+//listing position of an index slot
+u32 Find_entry(u32 slot);
+//listing position of the next (dir > 0) or previous letter from pos
+u32 Find_letter(u32 pos, int dir);
+
+#endif /* SIMPLELIGHT_FINDER_INCLUDED */
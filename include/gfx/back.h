@@ -0,0 +1,22 @@
+#ifndef SIMPLELIGHT_GFX_BACK_INCLUDED
+#define SIMPLELIGHT_GFX_BACK_INCLUDED
+
+#include <gba_base.h>
+
+// Tear free browser frames. The back buffer is a whole 240x160 frame kept
+// as a resident scratch claim, so anything that needs pReadCache still
+// gets it; the next frame finds the claim gone, keeps it again and copies
+// the screen in. Between Back_begin and Back_present the draw primitives
+// go to the back buffer, isDrawDirect or not, and mark the row spans they
+// touch. Back_present waits for VBlank and DMAs only those spans, top
+// down, which stays ahead of the beam. Drawing outside a frame goes to the
+// screen and marks its spans stale, to be copied back at the next begin.
+
+//where a primitive draws
+u16 *Back_target(u8 isDrawDirect);
+//x,y,w,h was drawn to Back_target
+void Back_touch(u16 x, u16 y, u16 w, u16 h);
+void Back_begin(void);
+void Back_present(void);
+
+#endif /* SIMPLELIGHT_GFX_BACK_INCLUDED */
@@ -0,0 +1,63 @@
+#ifndef SIMPLELIGHT_GFX_GLYPH_INCLUDED
+#define SIMPLELIGHT_GFX_GLYPH_INCLUDED
+
+#include <gba_base.h>
+
+#include "overlay.h"
+
+// Glyphs for file names, which FatFs hands out in UTF-8. ASCII comes from
+// ASC_DATA and Latin-1 letters fold to their ASCII base. Anything else goes
+// through the FatFs CP936 table (ff_uni2oem, a binary search in ROM) to a
+// GB2312 glyph of acHZK12, which holds Chinese and the Japanese kana. Wide
+// glyphs are kept in a small LRU cache keyed by code point, so a screen
+// costs one lookup per new character rather than one per character drawn.
+// Code points without a GB2312 glyph draw as a full width '?'.
+// Glyph_get is in the BROWSER overlay set: call it from BROWSER_CODE.
+
+//next code point of a UTF-8 string, *str moves past it; broken bytes read as '?'
+static inline u32 Glyph_next(const char **str)
+{
+	const u8 *s = (const u8*)*str;
+	u32 cp = s[0], n, i;
+
+	if (cp < 0x80) {
+		n = 0;
+	}
+	else if ((cp & 0xE0) == 0xC0) {
+		cp &= 0x1F;
+		n = 1;
+	}
+	else if ((cp & 0xF0) == 0xE0) {
+		cp &= 0x0F;
+		n = 2;
+	}
+	else if ((cp & 0xF8) == 0xF0) {
+		cp &= 0x07;
+		n = 3;
+	}
+	else {
+		*str += 1;
+		return '?';
+	}
+	for (i = 1; i <= n; i++) {
+		if ((s[i] & 0xC0) != 0x80) {
+			*str += i;
+			return '?';
+		}
+		cp = (cp << 6) | (s[i] & 0x3F);
+	}
+	*str += n + 1;
+	return cp;
+}
+
+//12 rows of a glyph, *bytes per row: 1 (6 pixel advance) or 2 (12 pixel advance)
+const u8 BROWSER_CODE *Glyph_get(u32 cp, u32 *bytes);
+//width of a UTF-8 string in 6 pixel columns, as drawn
+u32 Glyph_columns(const char *str);
+//src into size bytes, cut before a code point that would not fit
+void Glyph_copy(char *dst, const char *src, u32 size);
+//a name an older kernel saved in GBK turns into UTF-8 in place, cut like
+//Glyph_copy; 0 when it already is UTF-8
+u32 Glyph_from_gbk(char *name, u32 size);
+
+#endif /* SIMPLELIGHT_GFX_GLYPH_INCLUDED */
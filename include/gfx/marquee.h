@@ -0,0 +1,16 @@
+#ifndef SIMPLELIGHT_GFX_MARQUEE_INCLUDED
+#define SIMPLELIGHT_GFX_MARQUEE_INCLUDED
+
+#include <gba_base.h>
+
+// Marquee of the selected long name. The name, three spaces and the bar
+// colour behind them are drawn once into a strip; a step is twelve DMA
+// row copies of the visible window out of it, in two pieces where the
+// window wraps around the end.
+
+//draw name into the strip, returns the scroll period in pixels
+u32 Marquee_set(const char *name, u16 bg, u16 c);
+//w pixels of the strip from offset (below the period) to x,y on screen
+void Marquee_show(u32 offset, u16 x, u16 y, u16 w);
+
+#endif /* SIMPLELIGHT_GFX_MARQUEE_INCLUDED */
@@ -0,0 +1,13 @@
+#ifndef SIMPLELIGHT_GFX_PROGRESS_INCLUDED
+#define SIMPLELIGHT_GFX_PROGRESS_INCLUDED
+
+#include <gba_base.h>
+
+// Bytes done, the only thing an I/O loop touches. The VBlank handler
+// turns it into the bar and the MB/s readout.
+extern volatile u32 gl_progress_done;
+
+void Progress_start(u32 total, u16 y);//total 0: no known size, the bar just sweeps
+void Progress_stop(void);
+
+#endif /* SIMPLELIGHT_GFX_PROGRESS_INCLUDED */
@@ -0,0 +1,21 @@
+#ifndef SIMPLELIGHT_GFX_ROWS_INCLUDED
+#define SIMPLELIGHT_GFX_ROWS_INCLUDED
+
+#include <gba_base.h>
+
+// The ten name lines of the SD list as object rows over the MODE_3 bitmap.
+// A row is six 32x16 4bpp objects (192 pixels from x=19) with its own 48
+// tiles in the object VRAM mode 3 leaves free. A one line scroll renders
+// the line that comes in and moves the other rows by 14 pixels, where the
+// bitmap path blits the whole background and draws all ten names again.
+#define ROWS_LINES 10
+
+//row of a screen line, UTF-8 str in len columns (0: all), clipped to 192 pixels
+void Rows_set(u32 line, const char *str, u32 len);
+//dir > 0: lines move up and str comes in at the bottom, dir < 0: the other way
+void Rows_scroll(int dir, const char *str, u32 len);
+//object layer on or off, off whenever anything else draws over the list
+void Rows_show(u32 on);
+u32 Rows_shown(void);
+
+#endif /* SIMPLELIGHT_GFX_ROWS_INCLUDED */
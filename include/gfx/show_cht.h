@@ -8,6 +8,7 @@
 #define MAX_VAL_LEN 6000
 
 #define MAX_sectionVAL_LEN 300
+#define MAX_CHT_LINE 1920	//FM_CHT_LINE entries claimed from scratch while the cheat menu is open
 
 typedef struct CHT_LINE{
 	char LINEname[MAX_KEY_LEN];
@@ -16,6 +17,8 @@ typedef struct CHT_LINE{
 	u8 section_val_count ;
 	u8 len;
 	u8 select ;
+	u32 val_offset ;	//value position in the .cht, keys only
+	u16 val_len ;
 } FM_CHT_LINE;
 
 typedef struct ST_entry_{	
@@ -23,7 +26,31 @@ typedef struct ST_entry_{
 	u32  VAL;	
 } ST_entry;
 
-//int Get_KEY_val(FIL* file,char*KEY_section,char*KEY_secval,char getbuff[]);
+// compiled cheat database, built by tools/chtdb
+#define CHT_DB_MAGIC 0x42444843 //"CHDB"
+#define CHT_DB_VERSION 2
+#define CHT_GUARD 0x80000000	//ST_entry.VAL: op<<16 | compare value, op 0 ends the code
+#define CHT_IN_DB 0x0000FFFE	//Check_cheat_file: cheats come from CHEAT.DB
+
+typedef struct CHT_DB_HEAD_{
+	u32 magic;
+	u32 version;
+	u32 game_count;
+	u32 reserved;
+} CHT_DB_HEAD;
+
+typedef struct CHT_DB_GAME_{	//sorted by gameid
+	u32 gameid;
+	u32 offset;
+} CHT_DB_GAME;
+
+typedef struct CHT_DB_RECORD_{	//followed by FM_CHT_LINE[line_count], keys point at ST_entry[val_len]
+	char gamename[MAX_KEY_LEN];
+	u16 reserved;
+	u32 line_count;
+} CHT_DB_RECORD;
+
+u32 Index_cht_file(FIL* file,char*gamename);
 int Show_all_KEY_val(FIL* file);
 u32 Check_cht_file(TCHAR *gamefilename);
 void Open_cht_file(TCHAR *gamefilename,u32 havecht);
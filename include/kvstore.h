@@ -0,0 +1,33 @@
+#ifndef SIMPLELIGHT_KVSTORE_INCLUDED
+#define SIMPLELIGHT_KVSTORE_INCLUDED
+
+#include <gba_base.h>
+
+#include "ff.h"
+
+// Per-game metadata in one file instead of a tiny file per game per kind.
+// /SYSTEM/META.KV is a header sector, a hash index of bucket heads and an
+// append log of CRC'd records chained per bucket. A lookup reads the bucket
+// sector and then the record, which never spans more than two sectors.
+// Records are made durable before the index points at them; a put that
+// was cut off is rolled forward on the next open. Superseded records are
+// dropped by copying the live ones to META.NEW and renaming it over.
+#define KV_FILE "/SYSTEM/META.KV"
+#define KV_NEW "/SYSTEM/META.NEW"
+
+#define KV_KEY_MAX 128		//tag byte + name
+#define KV_VAL_MAX 768
+
+//key namespaces, one per kind of record
+enum {
+	KV_MDE = 1,		//save type override, 1 byte
+	KV_PAT = 2,		//patch plan, see Check_pat
+};
+
+//value length, 0 when the key is not stored
+u32 Kv_get(u8 tag, const TCHAR *key, void *val, u32 size);
+//1 once the value is on the card
+u32 Kv_put(u8 tag, const TCHAR *key, const void *val, u32 len);
+void Kv_close(void);
+
+#endif /* SIMPLELIGHT_KVSTORE_INCLUDED */
@@ -58,6 +58,11 @@ extern char* gl_make_pat;
 
 extern char* gl_loading_game;
 extern char* gl_copying_data;
+extern char* gl_find_title;
+extern char* gl_find_none;
+extern char* gl_cheat_full;
+extern char* gl_library_empty;
+extern char** gl_library_view;
 
 extern char* gl_engine;
 extern char* gl_use_engine;
@@ -84,6 +89,9 @@ extern char* gl_error_3;
 extern char* gl_error_4;
 extern char* gl_error_5;
 extern char* gl_error_6;
+extern char* gl_error_7;
+extern char* gl_error_8;
+extern char* gl_error_9;
 
 extern char**  	gl_rom_menu;
 extern char**  gl_more_options;
@@ -0,0 +1,58 @@
+#ifndef SIMPLELIGHT_LIBRARY_INCLUDED
+#define SIMPLELIGHT_LIBRARY_INCLUDED
+
+#include <gba_base.h>
+
+#include "ff.h"
+
+// Every launchable file on the card, for the flat "All GBA" style views.
+// /SYSTEM/LIBRARY.IDX holds a header, a folder table (path and timestamp),
+// the file records of each folder in walk order and, per view, the record
+// numbers sorted by name. A view reads one page of records and never lists
+// a folder.
+// The refresh runs in idle browser frames, a few directory entries at a
+// time, into LIBRARY.NEW. Records of a folder whose timestamp is unchanged
+// are reused in order, so only changed folders have their ROM headers read
+// again. When nothing changed the new file is dropped, otherwise it is
+// renamed over the index.
+#define LIB_FILE "/SYSTEM/LIBRARY.IDX"
+#define LIB_NEW "/SYSTEM/LIBRARY.NEW"
+
+#define LIB_MAX_DIRS 512
+#define LIB_MAX_FILES 4096
+#define LIB_DEPTH 8		//folder levels below the root that are walked
+
+//views, also the type of a record
+enum {
+	LIB_GBA = 0,	//.gba .agb .mb
+	LIB_GB,			//.gb .gbc
+	LIB_NES,		//.nes
+	LIB_PLUG,		//extensions with a plugin in /SYSTEM/PLUG
+	LIB_VIEWS
+};
+
+typedef struct {
+	u32 size;
+	u16 fdate;
+	u16 ftime;
+	u16 dir;		//folder table slot
+	u8 type;
+	u8 reserved;
+	char code[4];	//GBA game code (header 0xAC)
+	char name[112];
+} LIB_ENTRY;
+
+//records in a view, 0 while there is no index yet
+u32 Library_count(u32 view);
+//record n of a view in name order, 1 when read
+u32 Library_get(u32 view, u32 n, LIB_ENTRY *entry);
+//full path of a record, 1 when it fits
+u32 Library_path(const LIB_ENTRY *entry, TCHAR *path, u32 size);
+//done with the views for now
+void Library_close(void);
+//one slice of the refresh, 0 once it is finished
+u32 Library_step(void);
+//drops a refresh in progress and LIBRARY.NEW, before a launch
+void Library_abort(void);
+
+#endif /* SIMPLELIGHT_LIBRARY_INCLUDED */
@@ -0,0 +1,72 @@
+#ifndef SIMPLELIGHT_LOADER_INCLUDED
+#define SIMPLELIGHT_LOADER_INCLUDED
+
+#include <gba_base.h>
+
+#include "ff.h"
+
+// Every load path streams LOAD_BLOCK_SIZE blocks through pReadCache:
+// source -> transforms -> sink. Progress is only counted into
+// gl_progress_done, see gfx/progress.h.
+#define LOAD_BLOCK_SIZE 0x20000
+#define LOAD_MAX_TRANSFORM 4
+
+// per-stage time, timer 3 ticks of 256 cycles (~15.3us) with its overflows
+// counted, 0 with EMU
+#define LOAD_STAGE_READ 0
+#define LOAD_STAGE_TRANSFORM 1
+#define LOAD_STAGE_WRITE 2
+
+// Load_run result when a verified block reads back differently
+#define LOAD_VERIFY_ERROR 0x100
+// Load_run result when the block buffer can't be claimed
+#define LOAD_MEMORY_ERROR 0x101
+
+typedef struct LOAD_SOURCE {
+	u32 (*read)(struct LOAD_SOURCE *src, u8 *buf, u32 offset, u32 size);//bytes read
+	u32 size;
+	FIL *file;
+	const u8 *data;
+} LOAD_SOURCE;
+
+//buf is word aligned, offset is the block position in the image
+typedef void (*LOAD_TRANSFORM)(u8 *buf, u32 size, u32 offset);
+
+typedef struct LOAD_SINK {
+	u32 (*write)(struct LOAD_SINK *dst, u8 *buf, u32 offset, u32 size);//0 on success
+	u32 (*check)(struct LOAD_SINK *dst, u32 offset, u32 size);//CRC32 read back, NULL if it can't
+	void (*prepare)(struct LOAD_SINK *dst, u32 offset);//before the block is read, may be NULL
+	u32 base;
+	FIL *file;
+} LOAD_SINK;
+
+typedef struct {
+	LOAD_SOURCE *src;
+	LOAD_SINK *dst;
+	LOAD_TRANSFORM transform[LOAD_MAX_TRANSFORM];
+	u32 transform_count;
+	u32 ticks[3];
+	u32 verify;		//set before Load_run: read back every block
+	u32 crc_src;	//CRC32 of the source as read, with verify
+} LOAD_PIPE;
+
+// --------------------------------------------------------------------
+void Load_source_file(LOAD_SOURCE *src, FIL *file);
+void Load_source_mem(LOAD_SOURCE *src, const void *data, u32 size);
+
+void Load_sink_psram(LOAD_SINK *dst, u32 base);
+void Load_sink_nor(LOAD_SINK *dst, u32 base);
+void Load_sink_file(LOAD_SINK *dst, FIL *file);
+void Load_sink_null(LOAD_SINK *dst);
+
+void Load_pipe_init(LOAD_PIPE *pipe, LOAD_SOURCE *src, LOAD_SINK *dst);
+void Load_pipe_add(LOAD_PIPE *pipe, LOAD_TRANSFORM transform);
+u32 Load_run(LOAD_PIPE *pipe);
+
+void Load_patch_internal(u8 *buf, u32 size, u32 offset);
+void Load_patch_NOR(u8 *buf, u32 size, u32 offset);
+void Load_patch_cleanrom_NOR(u8 *buf, u32 size, u32 offset);
+
+u32 Load_dat_check(const TCHAR *filename, u32 crc);
+
+#endif /* SIMPLELIGHT_LOADER_INCLUDED */
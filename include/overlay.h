@@ -0,0 +1,34 @@
+#ifndef SIMPLELIGHT_OVERLAY_INCLUDED
+#define SIMPLELIGHT_OVERLAY_INCLUDED
+
+#include <gba_base.h>
+
+// Phase specific hot code shares one IWRAM window (the .iwram0-9 overlay
+// sections of the devkitARM linker script). Callers go through a ROM
+// wrapper that runs Overlay_use() first, so a set is copied in on demand.
+// Code inside a set may call its own set, IWRAM_CODE or ROM code, never a
+// wrapper of another set: that would overwrite it while it runs.
+#define OVERLAY_BROWSER 0	//text, blits, sort
+#define OVERLAY_LOADER 1	//ARM scan, SRAM transfer
+#define OVERLAY_NOR 2		//program, erase polling
+#define OVERLAY_COUNT 3
+#define OVERLAY_NONE 0xFF
+
+#ifdef NO_OVERLAY
+//benchmark baseline (make OVERLAY=0): everything stays in ROM
+#define BROWSER_CODE
+#define LOADER_CODE
+#define NOR_CODE
+#define Overlay_use(set)
+#else
+#define BROWSER_CODE __attribute__((section(".iwram0"), long_call, noinline))
+#define LOADER_CODE __attribute__((section(".iwram1"), long_call, noinline))
+#define NOR_CODE __attribute__((section(".iwram2"), long_call, noinline))
+#define Overlay_use(set) do { if (gl_overlay_current != (set)) Overlay_load(set); } while (0)
+#endif
+
+extern u32 gl_overlay_current;
+void Overlay_load(u32 set);
+void Overlay_bench(void);
+
+#endif /* SIMPLELIGHT_OVERLAY_INCLUDED */
@@ -55,7 +55,19 @@ extern void Fire_Emblem_iQue_patch_end(void);
 
 extern u32 gl_cheat_count;
 
+#define CHEAT_PATCH_SIZE 0x2000	//PATCH_LENGTH with cheats on
 
+//cheat guards, see Set_cheat_guard
+#define CHEAT_IF_EQ 1
+#define CHEAT_IF_GT 2
+#define CHEAT_IF_LT 3
+#define CHEAT_EVERY 4
+
+//Check_RTS and use_internal_engine when the scratch arena is full
+#define PATCH_NO_MEMORY 0xFFFFFFFF
+
+
+void GBA_patch_init(void);
 void GBApatch_Cleanrom(u32* address,int filesize);
 void GBApatch_PSRAM(u32* address,int filesize);
 
@@ -70,6 +82,12 @@ void Make_mde_file(TCHAR* gamefilename,u8 Save_num);
 void Patch_SpecialROM_sheepmode(void);
 u32 use_internal_engine(u8 gamecode[]);
 u32 Check_cheat_file(TCHAR *gamefilename);
+void Clear_cheat(void);
+u32 Add_cheat(u32 address,u32 VAL);
+void Set_cheat_guard(u32 op,u32 address,u32 VAL);
+void End_cheat_guard(void);
+void Begin_cheat(void);
+u32 End_cheat(void);
 void SetTrimSize(u8* buffer,u32 romsize,u32 iSize,u32 mode,BYTE saveMODE);
 u32 Find_spend_address_SpecialROM(u32* Data);
 
@@ -0,0 +1,19 @@
+#ifndef SIMPLELIGHT_PROVISION_INCLUDED
+#define SIMPLELIGHT_PROVISION_INCLUDED
+
+#include <gba_base.h>
+
+// Batch NOR writer for preparing many carts with the same game set. At
+// boot, /SYSTEM/NORLIST.TXT (one ROM path per line, '#' comments) is
+// compared with the NOR list: games already in place at the front are
+// kept, the rest is written back to back as clean ROMs with verification
+// on, and /SYSTEM/NORLIST.LOG gets the timings. A cart that already
+// matches boots normally, so the card can stay in for every cart.
+// Log errors are Writefile2NOR's: 2 NOR full, 3 verify, 4 DAT, 5 open,
+// 6 out of memory.
+#define PROVISION_LIST "/SYSTEM/NORLIST.TXT"
+#define PROVISION_LOG "/SYSTEM/NORLIST.LOG"
+
+u32 Provision_NOR(void);
+
+#endif /* SIMPLELIGHT_PROVISION_INCLUDED */
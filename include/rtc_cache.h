@@ -0,0 +1,10 @@
+#ifndef SIMPLELIGHT_RTC_CACHE_INCLUDED
+#define SIMPLELIGHT_RTC_CACHE_INCLUDED
+
+#include <gba_base.h>
+
+// --------------------------------------------------------------------
+void rtc_cache_sync(void);
+void rtc_cache_get(u8 *datetime);
+
+#endif /* SIMPLELIGHT_RTC_CACHE_INCLUDED */
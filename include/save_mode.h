@@ -5,6 +5,8 @@ typedef struct SAVE_MODE_SECT{
 	char gamecode[4];		
 	u8 savemode;	
 } SAVE_MODE_;
+//Check_saveMODE when the scratch arena is full, no table entry uses it
+#define SAVE_MODE_NO_MEMORY 0xFF
 const SAVE_MODE_  __attribute__((aligned(4))) saveMODE_table[] = { 
 {"AFZJ",0x11},//0001 - F-Zero(JP).zip
 {"AMAJ",0x21},//0002 - Super Mario Advance(JP).zip
@@ -0,0 +1,23 @@
+#ifndef SIMPLELIGHT_SAVER_INCLUDED
+#define SIMPLELIGHT_SAVER_INCLUDED
+
+#include <gba_base.h>
+
+#include "ff.h"
+
+// Save files live in /SYSTEM/SAVER. With the "Shard saves" option on they
+// go to /SYSTEM/SAVEHASH/XX instead, XX being a hash of the game name, so a
+// lookup only scans a few dozen entries however many games there are. The
+// shards get their own root because FatFs never compacts a folder: after
+// the move SAVER is mostly deleted entries that every scan still reads.
+// The first launch with the option on moves the flat saves over and
+// leaves SAVER_MARK behind; a save still found flat later is moved on
+// use, and with the option off saves already in a shard keep being used.
+#define SAVER_DIR "/SYSTEM/SAVER"
+#define SAVER_SHARDS "/SYSTEM/SAVEHASH"
+#define SAVER_MARK "/SYSTEM/SAVEHASH/MOVED"
+
+//change into the folder that holds (or will hold) savname, FR_ result
+u32 Saver_enter(const TCHAR *savname);
+
+#endif /* SIMPLELIGHT_SAVER_INCLUDED */
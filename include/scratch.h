@@ -0,0 +1,24 @@
+#ifndef SIMPLELIGHT_SCRATCH_INCLUDED
+#define SIMPLELIGHT_SCRATCH_INCLUDED
+
+#include <gba_base.h>
+
+//#define SCRATCH_DEBUG		//report overlapping claims and leaks with DEBUG_printf
+
+// pReadCache is the only large scratch area. Users claim a named range and
+// release it when done:
+//  - Scratch_alloc: stack from the bottom, word aligned
+//  - Scratch_alloc_at: fixed offset, for buffers the patcher addresses
+//    directly (the load block must sit at offset 0)
+//  - Scratch_keep: resident cache from the top, survives until an alloc
+//    needs the room; check Scratch_kept with the same name before using it
+//    again, another cache may have been kept at the same place since
+#define SCRATCH_MAX_CLAIM 8
+
+void *Scratch_alloc(u32 size, const char *name);
+void *Scratch_alloc_at(u32 offset, u32 size, const char *name);
+void *Scratch_keep(u32 size, const char *name);
+u32 Scratch_kept(const void *p, const char *name);
+void Scratch_release(const void *p);
+
+#endif /* SIMPLELIGHT_SCRATCH_INCLUDED */
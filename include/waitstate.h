@@ -0,0 +1,25 @@
+#ifndef SIMPLELIGHT_WAITSTATE_INCLUDED
+#define SIMPLELIGHT_WAITSTATE_INCLUDED
+
+#include <gba_base.h>
+
+#ifndef REG_WAITCNT
+#define REG_WAITCNT *(vu16 *)(REG_BASE + 0x204)
+#endif
+
+// The kernel runs from WS0 (0x08000000-0x09FFFFFF: kernel ROM, PSRAM,
+// NOR and the cart registers). Waitstate_calibrate picks the fastest WS0
+// setting that passes a read-back test; SRAM and WS1/WS2 stay at reset.
+// The test only reads ROM and NOR and reads/writes PSRAM, so everything
+// else on the cart drops back to WAITCNT_DEFAULT while it runs: SD and FAT
+// buffer transfers, the control registers behind 0x9FE0000 (SetRompage,
+// SetPSRampage, ...), NOR erase/program commands and their status polling
+// (nor_flash.c, Save_info).
+// Games expect the BIOS value, so SetRompageWithHardReset puts it back.
+#define WAITCNT_DEFAULT 0x0000	//WS0 4/2, prefetch off
+#define WAITCNT_PREFETCH 0x4000
+
+extern u16 gl_waitcnt;
+u16 Waitstate_calibrate(void);
+
+#endif /* SIMPLELIGHT_WAITSTATE_INCLUDED */
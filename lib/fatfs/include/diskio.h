@@ -32,6 +32,21 @@ DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
+/* EZFLASH: directory lookup cache kept by the glue for ff.c. Absolute paths
+   that were changed into map to their directory, and (directory, name) to
+   the entry offset it was found at. Entry hits are checked against the
+   directory as usual, path hits are dropped whenever an entry is added or
+   removed anywhere on the volume. */
+#define DCACHE_DIRS		8
+#define DCACHE_PATH		64
+#define DCACHE_NAMES	32
+
+int dcache_get_dir (FATFS* fs, const TCHAR* path, DWORD* sclust, void* xcwds);
+void dcache_put_dir (FATFS* fs, const TCHAR* path, DWORD sclust, const void* xcwds);
+int dcache_get_name (FATFS* fs, DWORD dir, const WCHAR* name, DWORD* ofs);
+void dcache_put_name (FATFS* fs, DWORD dir, const WCHAR* name, DWORD ofs);
+void dcache_flush (void);
+
 
 /* Disk Status Bits (DSTATUS) */
 
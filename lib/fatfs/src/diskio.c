@@ -11,6 +11,8 @@
 #include "diskio.h"		/* Declarations FatFs MAI */
 #include "driver/sd_card.h"  /* EZFLASH: include sd_card API */
 #include "driver/rtc.h"    /* EZFLASH: include rtc API for get_fattime */
+#include "rtc_cache.h"     /* EZFLASH: cached clock for get_fattime */
+#include <string.h>        /* EZFLASH: directory lookup cache */
 
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
@@ -95,14 +97,140 @@ DRESULT disk_ioctl (
 	return RES_OK;
 }
 
+/*-----------------------------------------------------------------------*/
+/* EZFLASH: Directory lookup cache                                       */
+/*-----------------------------------------------------------------------*/
+
+typedef struct {
+	TCHAR	path[DCACHE_PATH];
+	DWORD	sclust;
+#if FF_FS_EXFAT && FF_FS_RPATH
+	FFXCWDS	xcwds;		/* exFAT needs the whole chain to stand in a directory */
+#endif
+} DCACHE_DIR;
+
+typedef struct {
+	DWORD	dir;		/* Start cluster of the directory */
+	DWORD	hash;		/* Of the upper case name */
+	DWORD	ofs;		/* Entry offset in the directory */
+} DCACHE_NAME;
+
+static DCACHE_DIR dcache_dir[DCACHE_DIRS] EWRAM_BSS;
+static DCACHE_NAME dcache_name[DCACHE_NAMES] EWRAM_BSS;
+static UINT dcache_dirs, dcache_dir_next;
+static UINT dcache_names, dcache_name_next;
+static WORD dcache_id;		/* Mount the entries belong to */
+
+void dcache_flush (void)
+{
+	dcache_dirs = dcache_dir_next = 0;
+	dcache_names = dcache_name_next = 0;
+}
+
+static void dcache_check (FATFS* fs)
+{
+	if (fs->id != dcache_id) {	/* Remounted, nothing carries over */
+		dcache_flush();
+		dcache_id = fs->id;
+	}
+}
+
+static DWORD dcache_hash (const WCHAR* name)
+{
+	DWORD hash = 0x811C9DC5;
+
+	while (*name) hash = (hash ^ ff_wtoupper(*name++)) * 0x01000193;
+	return hash;
+}
+
+int dcache_get_dir (
+	FATFS* fs,
+	const TCHAR* path,	/* Only absolute paths are kept */
+	DWORD* sclust,		/* Directory cluster, may be null */
+	void* xcwds			/* exFAT directory chain, may be null */
+)
+{
+	UINT i;
+
+	dcache_check(fs);
+	if (path[0] != '/') return 0;
+	for (i = 0; i < dcache_dirs; i++) {
+		if (strcmp(dcache_dir[i].path, path) == 0) {
+			if (sclust) *sclust = dcache_dir[i].sclust;
+#if FF_FS_EXFAT && FF_FS_RPATH
+			if (xcwds) memcpy(xcwds, &dcache_dir[i].xcwds, sizeof (FFXCWDS));
+#endif
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void dcache_put_dir (
+	FATFS* fs,
+	const TCHAR* path,
+	DWORD sclust,
+	const void* xcwds
+)
+{
+	DCACHE_DIR *e;
+
+	if (path[0] != '/' || strlen(path) >= DCACHE_PATH || dcache_get_dir(fs, path, 0, 0)) return;
+	e = &dcache_dir[(dcache_dirs < DCACHE_DIRS) ? dcache_dirs++ : dcache_dir_next++ % DCACHE_DIRS];
+	strcpy(e->path, path);
+	e->sclust = sclust;
+#if FF_FS_EXFAT && FF_FS_RPATH
+	if (xcwds) memcpy(&e->xcwds, xcwds, sizeof (FFXCWDS));
+#endif
+}
+
+int dcache_get_name (
+	FATFS* fs,
+	DWORD dir,
+	const WCHAR* name,
+	DWORD* ofs
+)
+{
+	UINT i;
+	DWORD hash = dcache_hash(name);
+
+	dcache_check(fs);
+	for (i = 0; i < dcache_names; i++) {
+		if (dcache_name[i].dir == dir && dcache_name[i].hash == hash) {
+			*ofs = dcache_name[i].ofs;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void dcache_put_name (
+	FATFS* fs,
+	DWORD dir,
+	const WCHAR* name,
+	DWORD ofs
+)
+{
+	UINT i;
+	DWORD hash = dcache_hash(name);
+	DCACHE_NAME *e = 0;
+
+	dcache_check(fs);
+	for (i = 0; i < dcache_names; i++) {	/* Moved since, or a hash twin */
+		if (dcache_name[i].dir == dir && dcache_name[i].hash == hash) e = &dcache_name[i];
+	}
+	if (!e) e = &dcache_name[(dcache_names < DCACHE_NAMES) ? dcache_names++ : dcache_name_next++ % DCACHE_NAMES];
+	e->dir = dir;
+	e->hash = hash;
+	e->ofs = ofs;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Get omega card time Functions                                               */
 /*-----------------------------------------------------------------------*/
 DWORD get_fattime (void)
 {
 		u8 datetime[7];
-		rtc_enable();
-		rtc_get(datetime);
-		rtc_disenable();	
+		rtc_cache_get(datetime);
 		return ((DWORD)(UNBCD(datetime[0])+20) << 25 | (DWORD)UNBCD(datetime[1]) << 21 | (DWORD)UNBCD(datetime[2]&0x3F) << 16 | (DWORD)UNBCD(datetime[4]&0x3F) << 11 | (DWORD)UNBCD(datetime[5]) << 5  | (DWORD)UNBCD(datetime[6]) >> 1   );
 }
@@ -23,6 +23,13 @@
 #include "ff.h"			/* Basic definitions and declarations of API */
 #include "diskio.h"		/* Declarations of MAI */
 
+/* EZFLASH: exFAT keeps the chain of the current directory next to cdir */
+#if FF_FS_EXFAT && FF_FS_RPATH
+#define DCACHE_XCWDS(fs) (&(fs)->xcwds)
+#else
+#define DCACHE_XCWDS(fs) 0
+#endif
+
 /*--------------------------------------------------------------------------
 
    Module Private Definitions
@@ -2407,8 +2414,10 @@ static FRESULT dir_read (
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
-	DIR* dp					/* Pointer to the directory object with the file name */
+static FRESULT dir_scan (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp,				/* Pointer to the directory object with the file name */
+	DWORD ofs,				/* EZFLASH: Entry offset to start at */
+	int one					/* EZFLASH: Give up after the first object */
 )
 {
 	FRESULT res;
@@ -2418,15 +2427,16 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 	BYTE attr, ord, sum;
 #endif
 
-	res = dir_sdi(dp, 0);			/* Rewind directory object */
+	res = dir_sdi(dp, ofs);			/* Rewind directory object */
 	if (res != FR_OK) return res;
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
 		BYTE nc;
-		UINT di, ni;
+		UINT di, ni, seen = 0;
 		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
 
 		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
+			if (one && seen++) return FR_NO_FILE;
 #if FF_MAX_LFN < 255
 			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
 #endif
@@ -2468,6 +2478,7 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 			} else {					/* SFN entry */
 				if (ord == 0 && sum == sum_sfn(dp->dir)) break;	/* LFN matched? */
 				if (!(dp->fn[NSFLAG] & NS_LOSS) && !memcmp(dp->dir, dp->fn, 11)) break;	/* SFN matched? */
+				if (one) { res = FR_NO_FILE; break; }
 				ord = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Not matched, reset LFN sequence */
 			}
 		}
@@ -2482,6 +2493,32 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 }
 
 
+static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp					/* Pointer to the directory object with the file name */
+)
+{
+	FRESULT res;
+#if FF_USE_LFN
+	FATFS *fs = dp->obj.fs;
+	DWORD ofs;
+	int cache = !(dp->fn[NSFLAG] & NS_NOLFN);	/* Not the SFN collision probes of dir_register */
+
+	/* EZFLASH: Try where the name was found last time, the entry is matched as usual */
+	if (cache && dcache_get_name(fs, dp->obj.sclust, fs->lfnbuf, &ofs)) {
+		res = dir_scan(dp, ofs, 1);
+		if (res == FR_OK || res == FR_DISK_ERR) return res;
+	}
+	res = dir_scan(dp, 0, 0);
+	if (res == FR_OK && cache) {
+		dcache_put_name(fs, dp->obj.sclust, fs->lfnbuf, (dp->blk_ofs != 0xFFFFFFFF) ? dp->blk_ofs : dp->dptr);
+	}
+#else
+	res = dir_scan(dp, 0, 0);
+#endif
+	return res;
+}
+
+
 
 
 #if !FF_FS_READONLY
@@ -2499,6 +2536,7 @@ static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too
 	UINT n, len, n_ent;
 	BYTE sn[12];
 
+	dcache_flush();	/* EZFLASH: Directories may grow */
 
 	if (dp->fn[NSFLAG] & (NS_DOT | NS_NONAME)) return FR_INVALID_NAME;	/* Check name validity */
 	for (len = 0; fs->lfnbuf[len]; len++) ;	/* Get lfn length */
@@ -2611,6 +2649,7 @@ static FRESULT dir_remove (	/* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
 #if FF_USE_LFN		/* LFN configuration */
 	DWORD last = dp->dptr;
 
+	dcache_flush();	/* EZFLASH: Entries go away */
 	res = (dp->blk_ofs == 0xFFFFFFFF) ? FR_OK : dir_sdi(dp, dp->blk_ofs);	/* Goto top of the entry block if LFN is exist */
 	if (res == FR_OK) {
 		do {
@@ -4363,6 +4402,9 @@ FRESULT f_chdir (
 
 
 	res = mount_volume(&path, &fs, 0);	/* Get logical drive and mount the volume if needed */
+	if (res == FR_OK && dcache_get_dir(fs, path, &fs->cdir, DCACHE_XCWDS(fs))) {	/* EZFLASH: Been there */
+		LEAVE_FF(fs, FR_OK);
+	}
 	if (res == FR_OK) {
 		dj.obj.fs = fs;
 		INIT_NAMEBUFF(fs);
@@ -4390,6 +4432,7 @@ FRESULT f_chdir (
 					res = FR_NO_PATH;		/* Reached but a file */
 				}
 			}
+			if (res == FR_OK) dcache_put_dir(fs, path, fs->cdir, DCACHE_XCWDS(fs));	/* EZFLASH */
 		}
 		FREE_NAMEBUFF();
 		if (res == FR_NO_FILE) res = FR_NO_PATH;
@@ -5184,6 +5227,9 @@ FRESULT f_mkdir (
 
 
 	res = mount_volume(&path, &fs, FA_WRITE);	/* Get logical drive and mount the volume if needed */
+	if (res == FR_OK && dcache_get_dir(fs, path, 0, 0)) {	/* EZFLASH: Known to be there */
+		LEAVE_FF(fs, FR_EXIST);
+	}
 	if (res == FR_OK) {
 		dj.obj.fs = fs;
 		INIT_NAMEBUFF(fs);
@@ -10,13 +10,20 @@
 #include "driver/nor_flash.h"
 #include "driver/sd_card.h"
 #include "ezkernel.h"
+#include "gfx/glyph.h"
 #include "lang.h"
 #include "gfx/draw.h"
 #include "patch/gba_patch.h"
+#include "gfx/progress.h"
+#include "loader.h"
+#include "scratch.h"
+#include "overlay.h"
+#include "bgm.h"
+#include "waitstate.h"
 #define DEBUG
 
 extern void delay(u32 R0);
-extern void IWRAM_CODE PatchInternal(u32* Data,int iSize,u32 offset);
+extern void PatchInternal(u32* Data,int iSize,u32 offset);
 
 extern FM_NOR_FS pNorFS[MAX_NOR]EWRAM_BSS;
 extern u8 pReadCache [MAX_pReadCache_size]EWRAM_BSS;
@@ -29,10 +36,13 @@ extern u32 iTrimSize;
 //---------------------------------------------------------------
 void Chip_Reset()
 {
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
     *((vu16 *)(FlashBase_S98)) = 0xF0 ;
+    REG_WAITCNT = waitcnt;
 }
 //---------------------------------------------------------------
-void Block_Erase(u32 blockAdd) //0x20000 BYTE pre block
+static void NOR_CODE Block_Erase_ovl(u32 blockAdd) //0x20000 BYTE pre block
 {
     vu16 page,v1,v2;
     u32 Address;
@@ -84,8 +94,8 @@ void Block_Erase(u32 blockAdd) //0x20000 BYTE pre block
 //-----------------------------------------------------------
 void Chip_Erase()
 {
-    char msg[128];
-    u32 count=0;
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
     vu16 v1,v2=0 ;
     REG_IME = 0 ;
     *((vu16 *)(FlashBase_S98+0x555*2)) = 0xAA ;
@@ -95,19 +105,17 @@ void Chip_Erase()
     *((vu16 *)(FlashBase_S98+0x2AA*2)) = 0x55 ;
     *((vu16 *)(FlashBase_S98+0x555*2)) = 0x10 ;
 	DrawPic((u16*)gImage_MENU, 36, 25, 168, 110, 1, 0, 1);//show menu pic
+	DrawHZText12("Erasing NOR, please wait.",0,45,65,gl_color_text,1);
+    Progress_start(0,85);
     do {
-        VBlankIntrWait();
-        ShowTime(NOR_list,0);
-        itoa(count,msg,2);
-		DrawHZText12("Erasing NOR, please wait.",0,45,65,gl_color_text,1);
-        DrawHZText12(msg,0,75,80,gl_color_text,1);
-        count++;
         VBlankIntrWait();
         v1 = *((vu16 *)(FlashBase_S98)) ;
         v2 = *((vu16 *)(FlashBase_S98)) ;
     }
     while(v1!=v2);
+    Progress_stop();
     REG_IME = 1 ;
+    REG_WAITCNT = waitcnt;
 }
 
 //-----------------------------------------------------------
@@ -135,6 +143,8 @@ void FormatNor()
 //---------------------------------------------------------------
 void WriteFlash(u32 address,u8 *buffer,u32 size)
 {
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
     vu16 page,v1,v2;
     register u32 loopwrite ;
     vu16* buf = (vu16*)buffer ;
@@ -159,9 +169,79 @@ void WriteFlash(u32 address,u8 *buffer,u32 size)
         while(v1!=v2);
     }
     SetRompage(gl_currentpage);
+    REG_WAITCNT = waitcnt;
+}
+void Block_Erase(u32 blockAdd)
+{
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
+    Overlay_use(OVERLAY_NOR);
+    Block_Erase_ovl(blockAdd);
+    REG_WAITCNT = waitcnt;
 }
 //---------------------------------------------------------------
-void IWRAM_CODE WriteFlash_with32word(u32 address,u8 *buffer,u32 size)
+//split erase: the chip erases on its own after the command, so the caller
+//can read the next block from SD before Block_Erase_wait
+static void NOR_CODE Block_Erase_start_ovl(u32 blockAdd)
+{
+    vu16 page;
+    u32 Address;
+    page=gl_currentpage;
+    Address=blockAdd;
+    while(Address>=0x800000) {
+        Address-=0x800000;
+        page+=0x1000;
+    }
+    SetRompage(page);
+    Chip_Reset();
+    *((vu16 *)(FlashBase_S98+0x555*2)) = 0xAA ;
+    *((vu16 *)(FlashBase_S98+0x2AA*2)) = 0x55 ;
+    *((vu16 *)(FlashBase_S98+0x555*2)) = 0x80 ;
+    *((vu16 *)(FlashBase_S98+0x555*2)) = 0xAA ;
+    *((vu16 *)(FlashBase_S98+0x2AA*2)) = 0x55 ;
+    *((vu16 *)(FlashBase_S98+Address)) = 0x30 ;
+    SetRompage(gl_currentpage);
+}
+static void NOR_CODE Block_Erase_wait_ovl(u32 blockAdd)
+{
+    vu16 page,v1,v2;
+    u32 Address;
+    page=gl_currentpage;
+    Address=blockAdd;
+    while(Address>=0x800000) {
+        Address-=0x800000;
+        page+=0x1000;
+    }
+    SetRompage(page);
+    do {
+        v1 = *((vu16 *)(FlashBase_S98+Address)) ;
+        v2 = *((vu16 *)(FlashBase_S98+Address)) ;
+    }
+    while(v1!=v2);
+    SetRompage(gl_currentpage);
+}
+void Block_Erase_start(u32 blockAdd)
+{
+    if((blockAdd==0) || (blockAdd==0x3FE0000)) {
+        Block_Erase(blockAdd);//boot sectors: four erases, done in place
+        return;
+    }
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
+    Overlay_use(OVERLAY_NOR);
+    Block_Erase_start_ovl(blockAdd);
+    REG_WAITCNT = waitcnt;
+}
+void Block_Erase_wait(u32 blockAdd)
+{
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
+    Overlay_use(OVERLAY_NOR);
+    Block_Erase_wait_ovl(blockAdd);
+    REG_WAITCNT = waitcnt;
+}
+//---------------------------------------------------------------
+static void NOR_CODE WriteFlash_with32word_ovl(u32 address,u8 *buffer,u32 size)
 {
     vu16 page,v1,v2;
     register u32 loopwrite ;
@@ -193,94 +273,143 @@ void IWRAM_CODE WriteFlash_with32word(u32 address,u8 *buffer,u32 size)
     }
     SetRompage(gl_currentpage);
 }
+void WriteFlash_with32word(u32 address,u8 *buffer,u32 size)
+{
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
+    Overlay_use(OVERLAY_NOR);
+    WriteFlash_with32word_ovl(address,buffer,size);
+    REG_WAITCNT = waitcnt;
+}
 //-----------------------------------------------------------
-u32 Loadfile2NOR(TCHAR *filename, u32 NORaddress,u32 have_patch)
+//clears the persistent protection bits so every sector can be erased
+void PPB_Erase(void)
+{
+    u16 waitcnt = REG_WAITCNT;
+    REG_WAITCNT = WAITCNT_DEFAULT;
+    *((vu16 *)(FlashBase_S98)) = 0xF0 ;
+    *((vu16 *)(FlashBase_S98+0x555*2)) = 0xAA ;
+    *((vu16 *)(FlashBase_S98+0x2AA*2)) = 0x55 ;
+    *((vu16 *)(FlashBase_S98+0x555*2)) = 0xC0 ;
+    *((vu16 *)(FlashBase_S98+0x000*2)) = 0x80 ;
+    *((vu16 *)(FlashBase_S98+0x000*2)) = 0x30 ;
+    {
+        int polling_counter = 0x15000;
+        u32 v1;
+        do {
+            v1 = *((vu16 *)(FlashBase_S98+ 0x5C0000));
+            polling_counter--;
+        }
+        while (polling_counter);
+    }
+    *((vu16 *)(FlashBase_S98+0x000*2)) = 0x90 ;
+    *((vu16 *)(FlashBase_S98+0x000*2)) = 0x00 ;
+    REG_WAITCNT = waitcnt;
+}
+//-----------------------------------------------------------
+//writes one game at NORaddress into pNorFS[game_total_NOR] but neither
+//counts it nor saves the NOR info, Loadfile2NOR and the batch writer do.
+//ticks gets the loader stage times when not NULL.
+u32 Writefile2NOR(TCHAR *filename, u32 NORaddress,u32 have_patch,u32 *ticks)
 {
-u8 str_len;
     u32 res;
     u32 ret;
     u32 filesize;
     u32 fileneedsize;
     u32 blocknum;
-    char msg[128];
     FM_NOR_FS tmpNorFS ;
     char temp[50];
-    u16 readdata;
     u32 add_patch = 0;
-    u16 norid = Read_S98NOR_ID();
-    if(norid == 0x223D) { //S98
-        res = f_open(&gfile, filename, FA_READ);
-        if(res != FR_OK) {
-            return 0;
-        }
-        filesize = f_size(&gfile);
-        f_lseek(&gfile, 0xa0);
-        f_read(&gfile, temp, 0x10, (UINT*)&ret);//read game name
-        memcpy(tmpNorFS.gamename,temp,0x10);
-        tmpNorFS.rompage = NORaddress >> 17;
-        fileneedsize = ((((filesize+0x1FFFF)/0x20000)*0x20000));
-        if(have_patch) {
-            if(iTrimSize>=fileneedsize) {
-                fileneedsize = fileneedsize+0x20000;
-                add_patch = 1;
-            }
+    LOAD_SOURCE src;
+    LOAD_SINK dst;
+    LOAD_PIPE pipe;
+    res = f_open(&gfile, filename, FA_READ);
+    if(res != FR_OK) {
+        return 5;
+    }
+    filesize = f_size(&gfile);
+    f_lseek(&gfile, 0xa0);
+    f_read(&gfile, temp, 0x10, (UINT*)&ret);//read game name
+    memcpy(tmpNorFS.gamename,temp,0x10);
+    tmpNorFS.rompage = NORaddress >> 17;
+    fileneedsize = ((((filesize+0x1FFFF)/0x20000)*0x20000));
+    if(have_patch) {
+        if(iTrimSize>=fileneedsize) {
+            fileneedsize = fileneedsize+0x20000;
+            add_patch = 1;
         }
-        if(	fileneedsize > (0x4000000-NORaddress)) {
-            return 2; //Not enough NOR space
+    }
+    if(	fileneedsize > (0x4000000-NORaddress)) {
+        f_close(&gfile);
+        return 2; //Not enough NOR space
+    }
+    tmpNorFS.filesize = fileneedsize;
+    tmpNorFS.have_patch = have_patch;
+    tmpNorFS.have_RTS = gl_rts_on;
+    Glyph_copy((char*)tmpNorFS.filename,filename,sizeof(tmpNorFS.filename));
+    dmaCopy(&tmpNorFS,&pNorFS[game_total_NOR], sizeof(FM_NOR_FS));
+    Clear(0,160-15,240,15,gl_color_cheat_black,1);
+    ShowbootProgress(gl_copying_data);
+    Load_source_file(&src,&gfile);
+    Load_sink_nor(&dst,NORaddress);
+    Load_pipe_init(&pipe,&src,&dst);
+    if(have_patch) {
+        if((gl_reset_on==1) || (gl_rts_on==1) || (gl_sleep_on==1) || (gl_cheat_on==1)) {
+            Load_pipe_add(&pipe,Load_patch_internal);
+            Load_pipe_add(&pipe,Load_patch_NOR);//some nes need check
         }
-        ////////////////// erase all BBP
-        *((vu16 *)(FlashBase_S98)) = 0xF0 ;
-        *((vu16 *)(FlashBase_S98+0x555*2)) = 0xAA ;
-        *((vu16 *)(FlashBase_S98+0x2AA*2)) = 0x55 ;
-        *((vu16 *)(FlashBase_S98+0x555*2)) = 0xC0 ;
-        *((vu16 *)(FlashBase_S98+0x000*2)) = 0x80 ;
-        *((vu16 *)(FlashBase_S98+0x000*2)) = 0x30 ;
-        {
-            int polling_counter = 0x15000;
-            u32 v1;
-            do {
-                v1 = *((vu16 *)(FlashBase_S98+ 0x5C0000));
-                polling_counter--;
+    }
+    else {
+        Load_pipe_add(&pipe,Load_patch_cleanrom_NOR);
+    }
+    pipe.verify = gl_toggle_verify;
+    Progress_start(src.size,118);
+    res = Load_run(&pipe);
+    Progress_stop();
+    f_close(&gfile);
+    if(ticks) {
+        memcpy(ticks,pipe.ticks,sizeof(pipe.ticks));
+    }
+    if(res == LOAD_VERIFY_ERROR) {
+        return 3; //read back differs, not listed
+    }
+    if(res == LOAD_MEMORY_ERROR) {
+        return 6; //no scratch for the block buffer
+    }
+    if(pipe.verify && Load_dat_check(filename,pipe.crc_src)) {
+        return 4; //DAT knows this game with another CRC
+    }
+    if(have_patch) {
+        if(add_patch) {
+            u8 *block = Scratch_alloc_at(0,0x20000,"NOR patch block");
+            if(block == NULL) {
+                return 6;
             }
-            while (polling_counter);
-        }
-        *((vu16 *)(FlashBase_S98+0x000*2)) = 0x90 ;
-        *((vu16 *)(FlashBase_S98+0x000*2)) = 0x00 ;
-        /////////////////
-        tmpNorFS.filesize = fileneedsize;
-        tmpNorFS.have_patch = have_patch;
-        tmpNorFS.have_RTS = gl_rts_on;
-        sprintf(tmpNorFS.filename,"%s",filename);
-        dmaCopy(&tmpNorFS,&pNorFS[game_total_NOR], sizeof(FM_NOR_FS));
-        Clear(0,160-15,240,15,gl_color_cheat_black,1);
-        ShowbootProgress(gl_copying_data);
-        for(blocknum=0; blocknum<filesize; blocknum+=0x20000) {
-            sprintf(msg,"%luMbit",(blocknum)/0x20000);
-			str_len = strlen(msg);
-            Clear(0,130,240,15,gl_color_cheat_black,1);
-            DrawHZText12(msg,0,(240-str_len*6)/2,160-30,0x7fff,1);
+            blocknum = (filesize+0x1FFFF) & ~0x1FFFF;
+            memset(block,0,0x20000);
             Block_Erase(blocknum+NORaddress);
-            f_lseek(&gfile, blocknum);
-            f_read(&gfile, pReadCache, 0x20000, (UINT*)&ret);//pReadCache max 0x20000 Byte
-            if(have_patch) {
-                if((gl_reset_on==1) || (gl_rts_on==1) || (gl_sleep_on==1) || (gl_cheat_on==1)) {
-                    PatchInternal((u32*)pReadCache,0x20000,blocknum);
-                    GBApatch_NOR((u32*)pReadCache,0x20000,blocknum);//some nes need check
-                }
-            }
-            else {
-                GBApatch_Cleanrom_NOR((u32*)pReadCache,blocknum);
-            }
-            WriteFlash_with32word(blocknum+NORaddress,pReadCache,0x20000);
-            //WriteFlash(blocknum+NORaddress,pReadCache,0x20000);
+            GBApatch_NOR((u32*)block,0x20000,blocknum);
+            WriteFlash_with32word(blocknum+NORaddress,block,0x20000);
+            Scratch_release(block);
         }
-        f_close(&gfile);
-        if(have_patch) {
-            if(add_patch) {
-                Block_Erase(blocknum+NORaddress);
-                GBApatch_NOR((u32*)pReadCache,0x20000,blocknum);
-                WriteFlash_with32word(blocknum+NORaddress,pReadCache,0x20000);
-            }
+    }
+    return 0;
+}
+//-----------------------------------------------------------
+u32 Loadfile2NOR(TCHAR *filename, u32 NORaddress,u32 have_patch)
+{
+    u32 res;
+    u16 norid = Read_S98NOR_ID();
+    if(norid == 0x223D) { //S98
+        Bgm_pause();
+        PPB_Erase();
+        res = Writefile2NOR(filename,NORaddress,have_patch,NULL);
+        Bgm_resume();
+        if(res == 5) {
+            return 0; //could not open, nothing written
+        }
+        if(res) {
+            return res;
         }
         Save_NOR_info((u16*)pNorFS,sizeof(FM_NOR_FS)*0x40);
         return 0;
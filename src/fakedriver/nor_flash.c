@@ -16,6 +16,18 @@ void Block_Erase(u32 blockAdd)
 {
 }
 
+void Block_Erase_start(u32 blockAdd)
+{
+}
+
+void Block_Erase_wait(u32 blockAdd)
+{
+}
+
+void PPB_Erase(void)
+{
+}
+
 void Chip_Erase()
 {
 }
@@ -26,7 +38,7 @@ void WriteFlash(u32 address, u8 *buffer, u32 size)
 {
 }
 
-void IWRAM_CODE WriteFlash_with32word(u32 address, u8 *buffer, u32 size)
+void WriteFlash_with32word(u32 address, u8 *buffer, u32 size)
 {
 }
 
@@ -35,4 +47,9 @@ u32 Loadfile2NOR(TCHAR *filename, u32 NORaddress, u32 have_patch)
     return 0;
 }
 
+u32 Writefile2NOR(TCHAR *filename, u32 NORaddress, u32 have_patch, u32 *ticks)
+{
+    return 5;
+}
+
 u32 GetFileListFromNor(void) { return 0; }
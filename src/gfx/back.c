@@ -0,0 +1,103 @@
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+#include <gba_systemcalls.h>
+
+#include "ezkernel.h"
+#include "scratch.h"
+#include "gfx/back.h"
+
+#define BACK_SIZE (240 * 160 * 2)
+
+static u16 *back = NULL;
+static u32 back_frame = 0;
+//per line span x0..x1-1, x1 == 0 when the line is clean
+static u8 dirty_x0[160], dirty_x1[160];	//back is newer, to present
+static u8 stale_x0[160], stale_x1[160];	//screen is newer, to copy back
+
+//------------------------------------------------------------------
+u16 *Back_target(u8 isDrawDirect)
+{
+	if ((back_frame || !isDrawDirect) && back) {
+		return back;
+	}
+	return VideoBuffer;
+}
+//------------------------------------------------------------------
+void Back_touch(u16 x, u16 y, u16 w, u16 h)
+{
+	u8 *x0, *x1;
+	u32 end, yy;
+
+	if (back == NULL) {
+		return;
+	}
+	if (back_frame) {
+		x0 = dirty_x0;
+		x1 = dirty_x1;
+	}
+	else {
+		x0 = stale_x0;
+		x1 = stale_x1;
+	}
+	if ((x >= 240) || (y >= 160)) {
+		return;
+	}
+	end = (x + w > 240) ? 240 : x + w;
+	h = (y + h > 160) ? 160 - y : h;
+	for (yy = y; yy < y + h; yy++) {
+		if (x1[yy] == 0) {
+			x0[yy] = x;
+			x1[yy] = end;
+		}
+		else {
+			if (x < x0[yy]) {
+				x0[yy] = x;
+			}
+			if (end > x1[yy]) {
+				x1[yy] = end;
+			}
+		}
+	}
+}
+//------------------------------------------------------------------
+//spans of one table from src to dst, then the table is clean
+static void Back_copy(u8 *x0, u8 *x1, u16 *src, u16 *dst)
+{
+	u32 y, ofs;
+
+	for (y = 0; y < 160; y++) {
+		if (x1[y]) {
+			ofs = y * 240 + x0[y];
+			dmaCopy(src + ofs, dst + ofs, (x1[y] - x0[y]) * 2);
+			x1[y] = 0;
+		}
+	}
+}
+//------------------------------------------------------------------
+void Back_begin(void)
+{
+	if ((back == NULL) || !Scratch_kept(back, "back buffer")) {
+		back = Scratch_keep(BACK_SIZE, "back buffer");
+		if (back == NULL) {
+			return;//no room, this frame draws to the screen
+		}
+		dmaCopy(VideoBuffer, back, BACK_SIZE);
+		memset(stale_x1, 0, sizeof(stale_x1));
+		memset(dirty_x1, 0, sizeof(dirty_x1));
+	}
+	else {
+		Back_copy(stale_x0, stale_x1, VideoBuffer, back);
+	}
+	back_frame = 1;
+}
+//------------------------------------------------------------------
+void Back_present(void)
+{
+	if (!back_frame) {
+		return;
+	}
+	back_frame = 0;
+	VBlankIntrWait();
+	Back_copy(dirty_x0, dirty_x1, back, VideoBuffer);
+}
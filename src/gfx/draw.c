@@ -14,6 +14,9 @@
 
 
 #include "ezkernel.h"
+#include "overlay.h"
+#include "gfx/back.h"
+#include "gfx/glyph.h"
 
 extern void wait_btn();
 
@@ -24,50 +27,34 @@ void IWRAM_CODE Clear(u16 x, u16 y, u16 w, u16 h, u16 c, u8 isDrawDirect)
 {
     u16 *p;
     u16 yi,ww,hh;
-    if(isDrawDirect) {
-        p = VideoBuffer;
-    }
-    else {
-        p = Vcache;
-    }
+    p = Back_target(isDrawDirect);
     hh = (y+h>160)?160:(y+h);
     ww  = (x+w>240)?(240-x):w;
-    //u16 tmp[240];
-    for(u32 i=0; i<240; i++) {
-        ((u16*)pReadCache)[i] = c;
-    }
+    vu16 fill = c;//fixed-source DMA, keeps pReadCache untouched
     for(yi=y; yi < hh; yi++) {
-        dmaCopy(pReadCache,p+yi*240+x,ww*2);
+        DMA3COPY(&fill,p+yi*240+x,DMA_SRC_FIXED|DMA16|ww);
     }
+    Back_touch(x,y,ww,h);
 }
 //******************************************************************************
 void IWRAM_CODE ClearWithBG(u16* pbg,u16 x, u16 y, u16 w, u16 h, u8 isDrawDirect)
 {
     u16 *p;
     u16 yi,ww,hh;
-    if(isDrawDirect) {
-        p = VideoBuffer;
-    }
-    else {
-        p = Vcache;
-    }
+    p = Back_target(isDrawDirect);
     hh = (y+h>160)?160:(y+h);
     ww  = (x+w>240)?(240-x):w;
     for(yi=y; yi < hh; yi++) {
         dmaCopy(pbg+yi*240+x,p+yi*240+x,ww*2);
     }
+    Back_touch(x,y,ww,h);
 }
 //******************************************************************************
-void IWRAM_CODE DrawPic(u16 *GFX, u16 x, u16 y, u16 w, u16 h, u8 isTrans, u16 tcolor, u8 isDrawDirect)
+static void BROWSER_CODE DrawPic_ovl(u16 *GFX, u16 x, u16 y, u16 w, u16 h, u8 isTrans, u16 tcolor, u8 isDrawDirect)
 {
     u16 *p,c;
     u16 xi,yi,ww,hh;
-    if(isDrawDirect) {
-        p = VideoBuffer;
-    }
-    else {
-        p = Vcache;
-    }
+    p = Back_target(isDrawDirect);
     hh = (y+h>160)?160:(y+h);
     ww  = (x+w>240)?(240-x):w;
     if(isTrans) {
@@ -85,22 +72,20 @@ void IWRAM_CODE DrawPic(u16 *GFX, u16 x, u16 y, u16 w, u16 h, u8 isTrans, u16 tc
         }
     }
 }
+void DrawPic(u16 *GFX, u16 x, u16 y, u16 w, u16 h, u8 isTrans, u16 tcolor, u8 isDrawDirect)
+{
+    Overlay_use(OVERLAY_BROWSER);
+    DrawPic_ovl(GFX,x,y,w,h,isTrans,tcolor,isDrawDirect);
+    Back_touch(x,y,w,h);
+}
 //---------------------------------------------------------------------------------
-void DrawHZText12(char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
+static void BROWSER_CODE DrawHZText12_ovl(char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
 {
     u32 i,l,hi=0;
     u32 location;
     u8 cc,c1,c2;
-    u16 *v;
-    u16 *p1 = Vcache;
-    u16 *p2 = VideoBuffer;
+    u16 *v = Back_target(isDrawDirect);
     u16 yy;
-    if(isDrawDirect) {
-        v = p2;
-    }
-    else {
-        v = p1;
-    }
     if(len==0) {
         l=strlen(str);
     }
@@ -244,6 +229,54 @@ void DrawHZText12(char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
         }
     }
 }
+void DrawHZText12(char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
+{
+    u32 l = strlen(str);
+    Overlay_use(OVERLAY_BROWSER);
+    DrawHZText12_ovl(str,len,x,y,c,isDrawDirect);
+    if((len!=0) && (len<l)) {
+        l=len;
+    }
+    Back_touch(x,y,l*6+3,12);//last glyph is 8 wide, +1 bold
+}
+//---------------------------------------------------------------------------------
+//UTF-8 name, len in 6 pixel columns (0: all), returns the columns drawn
+static u32 BROWSER_CODE DrawName12_ovl(const char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
+{
+    u16 *v = Back_target(isDrawDirect) + y*240;
+    const u8 *glyph;
+    u32 cols = 0, bytes, i, bit, px;
+    u8 cc;
+    while(*str && (x+cols*6 < 240)) {
+        glyph = Glyph_get(Glyph_next(&str), &bytes);
+        if((len!=0) && (cols+bytes>len)) {
+            break;
+        }
+        for(i=0; i<12; i++) {
+            for(bit=0; bit<bytes*8; bit++) {
+                cc = glyph[i*bytes+(bit>>3)];
+                if(cc & (0x80>>(bit&7))) {
+                    px = x+cols*6+bit;
+                    if(px<240) {
+                        v[i*240+px]=c;
+                    }
+                    if(gl_toggle_bold && (bytes==1) && (px+1<240)) {
+                        v[i*240+px+1]=c;
+                    }
+                }
+            }
+        }
+        cols+=bytes;
+    }
+    return cols;
+}
+void DrawName12(const char *str, u16 len, u16 x, u16 y, u16 c, u8 isDrawDirect)
+{
+    u32 cols;
+    Overlay_use(OVERLAY_BROWSER);
+    cols = DrawName12_ovl(str,len,x,y,c,isDrawDirect);
+    Back_touch(x,y,cols*6+3,12);
+}
 //---------------------------------------------------------------------------------
 void DEBUG_printf(const char *format, ...)
 {
@@ -0,0 +1,187 @@
+#include <string.h>
+#include <gba_base.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "lang.h"
+#include "overlay.h"
+#include "gfx/glyph.h"
+
+#define GLYPH_SETS 16	//by the low bits of the code point
+#define GLYPH_WAYS 4	//least recently used way goes on a miss
+
+typedef struct {
+	u32 cp;			//0: empty
+	u32 used;
+	u8 rows[24];
+} GLYPH;
+
+extern const unsigned char acHZK12[];
+
+static GLYPH glyph_cache[GLYPH_SETS * GLYPH_WAYS]EWRAM_BSS;
+static u32 glyph_clock = 0;
+
+//U+00C0..U+00FF as ASCII, 0 for the two signs GB2312 has
+static const char glyph_latin[64] =
+	"AAAAAAACEEEEIIIIDNOOOOO\0OUUUUYPsaaaaaaaceeeeiiiidnooooo\0ouuuuypy";
+
+#define GLYPH_NARROW(cp) (((cp) < 0x80) || (((cp) >= 0xC0) && ((cp) <= 0xFF) && glyph_latin[(cp) - 0xC0]))
+
+//------------------------------------------------------------------
+const u8 BROWSER_CODE *Glyph_get(u32 cp, u32 *bytes)
+{
+	GLYPH *set, *slot;
+	u32 i, oem, c1, c2;
+
+	if (cp < 0x80) {
+		*bytes = 1;
+		return ASC_DATA + cp * 12;
+	}
+	if (GLYPH_NARROW(cp)) {
+		*bytes = 1;
+		return ASC_DATA + glyph_latin[cp - 0xC0] * 12;
+	}
+	*bytes = 2;
+	glyph_clock++;
+	set = &glyph_cache[(cp & (GLYPH_SETS - 1)) * GLYPH_WAYS];
+	slot = set;
+	for (i = 0; i < GLYPH_WAYS; i++) {
+		if (set[i].cp == cp) {
+			set[i].used = glyph_clock;
+			return set[i].rows;
+		}
+		if (set[i].used < slot->used) {
+			slot = &set[i];
+		}
+	}
+	oem = (cp < 0x10000) ? ff_uni2oem(cp, FF_CODE_PAGE) : 0;
+	c1 = oem >> 8;
+	c2 = oem & 0xFF;
+	if ((c1 < 0xa1) || ((c1 > 0xa9) && (c1 < 0xb0)) || (c1 > 0xf7) || (c2 < 0xa1) || (c2 > 0xfe)) {
+		c1 = 0xa3;	//no glyph in acHZK12: full width '?'
+		c2 = 0xbf;
+	}
+	if (c1 < 0xb0) {
+		i = ((c1 - 0xa1) * 94 + (c2 - 0xa1)) * 24;
+	}
+	else {
+		i = (9 * 94 + (c1 - 0xb0) * 94 + (c2 - 0xa1)) * 24;
+	}
+	memcpy(slot->rows, acHZK12 + i, 24);
+	slot->cp = cp;
+	slot->used = glyph_clock;
+	return slot->rows;
+}
+//------------------------------------------------------------------
+//bytes of the UTF-8 sequence at s, 0 when it is broken
+static u32 Glyph_length(const u8 *s)
+{
+	u32 n, i;
+
+	if (s[0] < 0x80) {
+		return 1;
+	}
+	else if ((s[0] & 0xE0) == 0xC0) {
+		n = 2;
+	}
+	else if ((s[0] & 0xF0) == 0xE0) {
+		n = 3;
+	}
+	else if ((s[0] & 0xF8) == 0xF0) {
+		n = 4;
+	}
+	else {
+		return 0;
+	}
+	for (i = 1; i < n; i++) {
+		if ((s[i] & 0xC0) != 0x80) {
+			return 0;
+		}
+	}
+	return n;
+}
+//------------------------------------------------------------------
+void Glyph_copy(char *dst, const char *src, u32 size)
+{
+	u32 len = 0, n;
+
+	while (src[len]) {
+		n = Glyph_length((const u8*)src + len);
+		if (n == 0) {
+			n = 1;	//broken bytes go through as they are
+		}
+		if (len + n >= size) {
+			break;
+		}
+		len += n;
+	}
+	memmove(dst, src, len);
+	dst[len] = 0;
+}
+//------------------------------------------------------------------
+u32 Glyph_from_gbk(char *name, u32 size)
+{
+	const u8 *s = (const u8*)name;
+	char out[128];
+	u32 i, n, cp, len = 0;
+
+	for (i = 0; s[i]; i += n) {
+		n = Glyph_length(s + i);
+		if (n == 0) {
+			break;
+		}
+	}
+	if (s[i] == 0) {
+		return 0;
+	}
+	if (size > sizeof(out)) {
+		size = sizeof(out);
+	}
+	for (i = 0; s[i]; ) {
+		if (s[i] < 0x80) {
+			cp = s[i++];
+		}
+		else if (s[i + 1]) {
+			cp = ff_oem2uni((s[i] << 8) | s[i + 1], FF_CODE_PAGE);
+			if (cp == 0) {
+				cp = '?';
+			}
+			i += 2;
+		}
+		else {
+			cp = '?';
+			i++;
+		}
+		n = (cp < 0x80) ? 1 : (cp < 0x800) ? 2 : 3;
+		if (len + n >= size) {
+			break;
+		}
+		if (n == 1) {
+			out[len] = cp;
+		}
+		else if (n == 2) {
+			out[len] = 0xC0 | (cp >> 6);
+			out[len + 1] = 0x80 | (cp & 0x3F);
+		}
+		else {
+			out[len] = 0xE0 | (cp >> 12);
+			out[len + 1] = 0x80 | ((cp >> 6) & 0x3F);
+			out[len + 2] = 0x80 | (cp & 0x3F);
+		}
+		len += n;
+	}
+	memcpy(name, out, len);
+	name[len] = 0;
+	return 1;
+}
+//------------------------------------------------------------------
+u32 Glyph_columns(const char *str)
+{
+	u32 cols = 0, cp;
+
+	while (*str) {
+		cp = Glyph_next(&str);
+		cols += GLYPH_NARROW(cp) ? 1 : 2;
+	}
+	return cols;
+}
@@ -0,0 +1,72 @@
+#include <gba_base.h>
+#include <gba_dma.h>
+
+#include "ezkernel.h"
+#include "lang.h"
+#include "overlay.h"
+#include "gfx/back.h"
+#include "gfx/glyph.h"
+#include "gfx/marquee.h"
+
+#define MARQUEE_GAP 18			//three spaces before the name comes round again
+#define MARQUEE_W (100 * 6 + MARQUEE_GAP)	//the first 100 columns of a name
+
+static u16 marquee_strip[12][MARQUEE_W]EWRAM_BSS;
+static u32 marquee_period;
+
+//------------------------------------------------------------------
+//same glyphs as DrawName12, returns the width drawn
+static u32 BROWSER_CODE Marquee_draw_ovl(const char *str, u16 c)
+{
+	const u8 *glyph;
+	u32 x = 0, i, bit, bytes, px;
+	u8 cc;
+
+	while (*str && (x < MARQUEE_W - MARQUEE_GAP)) {
+		glyph = Glyph_get(Glyph_next(&str), &bytes);
+		for (i = 0; i < 12; i++) {
+			for (bit = 0; bit < bytes * 8; bit++) {
+				cc = glyph[i * bytes + (bit >> 3)];
+				if (cc & (0x80 >> (bit & 7))) {
+					px = x + bit;
+					if (px < MARQUEE_W - MARQUEE_GAP) {
+						marquee_strip[i][px] = c;
+					}
+					if (gl_toggle_bold && (bytes == 1) && (px + 1 < MARQUEE_W - MARQUEE_GAP)) {
+						marquee_strip[i][px + 1] = c;
+					}
+				}
+			}
+		}
+		x += bytes * 6;
+	}
+	return (x < MARQUEE_W - MARQUEE_GAP) ? x : MARQUEE_W - MARQUEE_GAP;
+}
+//------------------------------------------------------------------
+u32 Marquee_set(const char *name, u16 bg, u16 c)
+{
+	vu16 fill = bg;
+
+	DMA3COPY(&fill, marquee_strip, DMA_SRC_FIXED | DMA16 | (sizeof(marquee_strip) / 2));
+	Overlay_use(OVERLAY_BROWSER);
+	marquee_period = Marquee_draw_ovl(name, c) + MARQUEE_GAP;
+	return marquee_period;
+}
+//------------------------------------------------------------------
+void Marquee_show(u32 offset, u16 x, u16 y, u16 w)
+{
+	u16 *v = VideoBuffer + y * 240 + x;
+	u32 i, first;
+
+	first = marquee_period - offset;
+	if (first > w) {
+		first = w;
+	}
+	for (i = 0; i < 12; i++, v += 240) {
+		dmaCopy(&marquee_strip[i][offset], v, first * 2);
+		if (first < w) {
+			dmaCopy(&marquee_strip[i][0], v + first, (w - first) * 2);
+		}
+	}
+	Back_touch(x, y, w, 12);//the screen is ahead of the back buffer here
+}
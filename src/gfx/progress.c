@@ -0,0 +1,169 @@
+#include <gba_base.h>
+#include <gba_video.h>
+#include <gba_interrupt.h>
+
+#include "ezkernel.h"
+#include "lang.h"
+#include "gfx/progress.h"
+#include "bgm.h"
+
+// Everything the VBlank handler touches lives in RAM: NOR writes remap the
+// cartridge while the handler may fire, so no ROM font reads and no libgcc
+// division in here.
+
+#define BAR_X 40
+#define BAR_W 160
+#define BAR_H 6
+#define SWEEP_W 20
+#define TEXT_LEN 10
+#define TEXT_X ((240 - TEXT_LEN * 6) / 2)
+#define TRACK_COLOR RGB(8, 8, 8)
+
+#define GLYPH_DOT 10
+#define GLYPH_SPACE 11
+#define GLYPH_M 12
+#define GLYPH_B 13
+#define GLYPH_SLASH 14
+#define GLYPH_S 15
+
+volatile u32 gl_progress_done;
+
+static u8 glyph[16][12];//"0123456789. MB/s" out of ASC_DATA
+static u16 bar_y;
+static u32 total_size;
+static u32 bar_step, bar_mark, bar_drawn;
+static u32 frames, second_done;
+
+//------------------------------------------------------------------
+static void IWRAM_CODE Progress_fill(u32 x, u32 y, u32 w, u32 h, u16 c)
+{
+	u16 *v = VideoBuffer + y * 240 + x;
+	u32 i, j;
+	for (j = 0; j < h; j++) {
+		for (i = 0; i < w; i++)
+			v[i] = c;
+		v += 240;
+	}
+}
+//------------------------------------------------------------------
+static void IWRAM_CODE Progress_text(u8 *text, u32 len)
+{
+	u16 *v;
+	u32 i, row, bit, x;
+	u8 cc;
+
+	Progress_fill(TEXT_X, bar_y + 10, TEXT_LEN * 6 + 1, 12, gl_color_cheat_black);
+	x = TEXT_X + (TEXT_LEN - len) * 3;
+	for (i = 0; i < len; i++, x += 6) {
+		v = VideoBuffer + (bar_y + 10) * 240 + x;
+		for (row = 0; row < 12; row++, v += 240) {
+			cc = glyph[text[i]][row];
+			for (bit = 0; bit < 8; bit++) {
+				if (cc & (0x80 >> bit)) {
+					v[bit] = 0x7FFF;
+					if (gl_toggle_bold)
+						v[bit + 1] = 0x7FFF;
+				}
+			}
+		}
+	}
+}
+//------------------------------------------------------------------
+// tenths of MB/s as "12.3 MB/s"
+static void IWRAM_CODE Progress_rate(u32 tenths)
+{
+	u8 digit[8];
+	u8 text[TEXT_LEN];
+	u32 count = 0, len = 0, quot;
+
+	do {
+		quot = 0;
+		while (tenths >= 10) {
+			tenths -= 10;
+			quot++;
+		}
+		digit[count++] = tenths;
+		tenths = quot;
+	} while (tenths && count < 4);
+	if (count == 1)
+		digit[count++] = 0;
+
+	while (count > 1)
+		text[len++] = digit[--count];
+	text[len++] = GLYPH_DOT;
+	text[len++] = digit[0];
+	text[len++] = GLYPH_SPACE;
+	text[len++] = GLYPH_M;
+	text[len++] = GLYPH_B;
+	text[len++] = GLYPH_SLASH;
+	text[len++] = GLYPH_S;
+	Progress_text(text, len);
+}
+//------------------------------------------------------------------
+static void IWRAM_CODE Progress_VBlank(void)
+{
+	u32 done = gl_progress_done;
+	u32 kb;
+
+	frames++;
+	if (total_size) {
+		while (bar_drawn < BAR_W && done >= bar_mark) {
+			Progress_fill(BAR_X + bar_drawn, bar_y, 1, BAR_H, gl_color_cheat_count);
+			bar_drawn++;
+			bar_mark += bar_step;
+		}
+		if (frames == 60) {
+			frames = 0;
+			kb = (done - second_done) >> 10;
+			second_done = done;
+			Progress_rate((kb * 10) >> 10);
+		}
+	}
+	else if (!(frames & 1)) {
+		//sweep a block across the track
+		Progress_fill(BAR_X + bar_drawn, bar_y, 1, BAR_H, TRACK_COLOR);
+		Progress_fill(BAR_X + bar_drawn + SWEEP_W, bar_y, 1, BAR_H, gl_color_cheat_count);
+		bar_drawn++;
+		if (bar_drawn + SWEEP_W >= BAR_W) {
+			Progress_fill(BAR_X + bar_drawn, bar_y, SWEEP_W, BAR_H, TRACK_COLOR);
+			bar_drawn = 0;
+			Progress_fill(BAR_X, bar_y, SWEEP_W, BAR_H, gl_color_cheat_count);
+		}
+	}
+}
+//------------------------------------------------------------------
+void Progress_start(u32 total, u16 y)
+{
+	const char *chars = "0123456789. MB/s";
+	u32 i, row;
+
+	for (i = 0; i < 16; i++) {
+		for (row = 0; row < 12; row++)
+			glyph[i][row] = ASC_DATA[chars[i] * 12 + row];
+	}
+	gl_progress_done = 0;
+	bar_y = y;
+	total_size = total;
+	bar_step = total / BAR_W;
+	if (bar_step == 0)
+		bar_step = 1;
+	bar_mark = bar_step;
+	bar_drawn = 0;
+	frames = 0;
+	second_done = 0;
+
+	Progress_fill(BAR_X, bar_y, BAR_W, BAR_H, TRACK_COLOR);
+	if (!total)
+		Progress_fill(BAR_X, bar_y, SWEEP_W, BAR_H, gl_color_cheat_count);
+	Bgm_pause();//the handler is ours until Progress_stop
+	irqSet(IRQ_VBLANK, Progress_VBlank);
+}
+//------------------------------------------------------------------
+void Progress_stop(void)
+{
+	irqSet(IRQ_VBLANK, 0);
+	if (total_size) {
+		Progress_fill(BAR_X, bar_y, BAR_W, BAR_H, gl_color_cheat_count);
+	}
+	Bgm_resume();
+}
@@ -0,0 +1,168 @@
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+#include <gba_video.h>
+#include <gba_sprites.h>
+
+#include "ezkernel.h"
+#include "lang.h"
+#include "overlay.h"
+#include "gfx/glyph.h"
+#include "gfx/rows.h"
+
+// Names are rasterized with the Glyph_get fonts into a RAM copy of the
+// row's tiles and copied over in one DMA, so a row is never seen half
+// drawn. Rows keep their tiles while they move: the screen line to row
+// table is rotated and only the objects' y changes.
+
+#define ROWS_X 19
+#define ROWS_Y 20
+#define ROWS_PITCH 14
+#define ROWS_OBJS 6				//32x16 objects per row
+#define ROWS_W (ROWS_OBJS * 32)
+#define ROWS_TILES (ROWS_OBJS * 8)
+#define ROWS_TILE_BASE 512		//object tiles below 512 are the mode 3 bitmap
+#define ROWS_VRAM ((u32*)0x06014000)
+
+static u32 rows_buf[ROWS_TILES * 8]EWRAM_BSS;	//4bpp, a tile row per word
+static u8 rows_slot[ROWS_LINES];	//row on each screen line
+static u32 rows_ready;
+static u32 rows_on;
+
+//set pixel x,y of the row: tile (x/32)*8 + (y/8)*4 + (x/8)%4, 1D mapping
+#define ROWS_DOT(x, y) do { \
+	u32 px_ = (x); \
+	if (px_ < ROWS_W) \
+		rows_buf[(((px_ >> 5) << 3) + (((y) >> 3) << 2) + ((px_ >> 3) & 3)) * 8 + ((y) & 7)] |= 1 << ((px_ & 7) * 4); \
+} while (0)
+
+//------------------------------------------------------------------
+static void BROWSER_CODE Rows_draw_ovl(const char *str, u32 len)
+{
+	const u8 *glyph;
+	u32 cols = 0, i, bit, bytes, x;
+	u8 cc;
+
+	memset(rows_buf, 0, sizeof(rows_buf));
+	while (*str && (cols * 6 < ROWS_W)) {
+		glyph = Glyph_get(Glyph_next(&str), &bytes);
+		if ((len != 0) && (cols + bytes > len)) {
+			break;
+		}
+		x = cols * 6;
+		for (i = 0; i < 12; i++) {
+			for (bit = 0; bit < bytes * 8; bit++) {
+				cc = glyph[i * bytes + (bit >> 3)];
+				if (cc & (0x80 >> (bit & 7))) {
+					ROWS_DOT(x + bit, i);
+					if (gl_toggle_bold && (bytes == 1)) {
+						ROWS_DOT(x + bit + 1, i);
+					}
+				}
+			}
+		}
+		cols += bytes;
+	}
+}
+//------------------------------------------------------------------
+static void Rows_draw(u32 slot, const char *str, u32 len)
+{
+	OBJATTR *obj = &OAM[slot * ROWS_OBJS];
+	u32 i;
+
+	for (i = 0; i < ROWS_OBJS; i++) {	//off until Rows_place, no old name at the new line
+		obj[i].attr0 = ATTR0_DISABLED;
+	}
+	Overlay_use(OVERLAY_BROWSER);
+	Rows_draw_ovl(str, len);
+	dmaCopy(rows_buf, ROWS_VRAM + slot * ROWS_TILES * 8, sizeof(rows_buf));
+}
+//------------------------------------------------------------------
+static void Rows_place(void)
+{
+	u32 line, i;
+	OBJATTR *obj;
+
+	for (line = 0; line < ROWS_LINES; line++) {
+		obj = &OAM[rows_slot[line] * ROWS_OBJS];
+		for (i = 0; i < ROWS_OBJS; i++) {
+			obj[i].attr0 = OBJ_Y(ROWS_Y + line * ROWS_PITCH) | ATTR0_WIDE | ATTR0_COLOR_16;
+		}
+	}
+}
+//------------------------------------------------------------------
+static void Rows_init(void)
+{
+	u32 slot, i;
+	OBJATTR *obj = OAM;
+	vu32 zero = 0;
+
+	DMA3COPY(&zero, ROWS_VRAM, DMA_SRC_FIXED | DMA32 | (ROWS_LINES * ROWS_TILES * 8));
+	for (slot = 0; slot < ROWS_LINES; slot++) {
+		rows_slot[slot] = slot;
+		for (i = 0; i < ROWS_OBJS; i++, obj++) {
+			obj->attr1 = OBJ_X(ROWS_X + i * 32) | ATTR1_SIZE_32;
+			obj->attr2 = OBJ_CHAR(ROWS_TILE_BASE + slot * ROWS_TILES + i * 8) | OBJ_PALETTE(0);
+		}
+	}
+	for (; obj < OAM + 128; obj++) {
+		obj->attr0 = ATTR0_DISABLED;
+	}
+	Rows_place();
+	rows_ready = 1;
+}
+//------------------------------------------------------------------
+void Rows_set(u32 line, const char *str, u32 len)
+{
+	if (!rows_ready) {
+		Rows_init();
+	}
+	Rows_draw(rows_slot[line], str, len);
+	Rows_place();
+}
+//------------------------------------------------------------------
+void Rows_scroll(int dir, const char *str, u32 len)
+{
+	u32 line, slot;
+
+	if (!rows_ready) {
+		Rows_init();
+	}
+	if (dir > 0) {
+		slot = rows_slot[0];
+		Rows_draw(slot, str, len);
+		for (line = 0; line < ROWS_LINES - 1; line++) {
+			rows_slot[line] = rows_slot[line + 1];
+		}
+		rows_slot[ROWS_LINES - 1] = slot;
+	}
+	else {
+		slot = rows_slot[ROWS_LINES - 1];
+		Rows_draw(slot, str, len);
+		for (line = ROWS_LINES - 1; line > 0; line--) {
+			rows_slot[line] = rows_slot[line - 1];
+		}
+		rows_slot[0] = slot;
+	}
+	Rows_place();
+}
+//------------------------------------------------------------------
+void Rows_show(u32 on)
+{
+	if (on) {
+		if (!rows_ready) {
+			Rows_init();
+		}
+		SPRITE_PALETTE[1] = gl_color_text;
+		REG_DISPCNT |= OBJ_1D_MAP | OBJ_ON;
+	}
+	else {
+		REG_DISPCNT &= ~OBJ_ON;
+	}
+	rows_on = on;
+}
+//------------------------------------------------------------------
+u32 Rows_shown(void)
+{
+	return rows_on;
+}
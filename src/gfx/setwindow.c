@@ -8,6 +8,7 @@
 #include "lang.h"
 #include "ezkernel.h"
 #include "driver/rtc.h"
+#include "rtc_cache.h"
 #include "gfx/draw.h"
 #include "driver/sd_card.h"
 
@@ -1114,6 +1115,7 @@ u32 Setting_window(void)
 							rtc_set(edit_datetime);
 							rtc_disenable();
 							delay(0x200);
+							rtc_cache_sync();
 							Set_OK = 0;//!Set_OK;
 						}
 						else if(select == 1) 
@@ -1221,6 +1223,9 @@ void save_set_info_setwindow(void) //DO NOT MAKE FUNCTIONS WITH THE SAME NAME IN
 	SET_info_buffer[13] = gl_ingame_RTC_open_status;
 	SET_info_buffer[14] = gl_toggle_reset;
 	SET_info_buffer[15] = gl_toggle_backup;
+	SET_info_buffer[16] = gl_toggle_bold;
+	SET_info_buffer[17] = gl_toggle_verify;
+	SET_info_buffer[18] = gl_toggle_shard;
 						
 	//save to nor 
 	Save_SET_info(SET_info_buffer,0x200);
@@ -9,15 +9,19 @@
 #include "ezkernel.h"
 #include "gfx/show_cht.h"
 #include "gfx/draw.h"
+#include "lang.h"
+#include "patch/gba_patch.h"
+#include "scratch.h"
 
 FM_CHT_LINE tmpCHTFS ;
 
-u8 *pCHTbuffer = (u8*)(pReadCache + 0x2000); //patchbuffer
+u8 *pCHTbuffer = NULL; //scratch claim, valid inside Open_cht_file
 
 extern void Draw_select_icon(u32 X,u32 Y,u32 mode);
+extern void wait_btn();
 
-ST_entry pCHEAT[3000]EWRAM_BSS;
 u32 gl_cheat_count;
+u32 gl_cht_db_offset;	//record of the current game in CHEAT.DB
 
 extern u16 gl_select_lang;
 
@@ -45,429 +49,205 @@ void Trim(char s[])
 	}
 }
 //------------------------------------------------------------------
-void Get_KEY_val(FIL* file,char*KEY_section,char*KEY_secval,char getbuff[])
+// f_gets without the UTF-8 decoding: .cht text is GBK and goes to
+// DrawHZText12 as it is
+static char *Read_cht_line(char *line, int len, FIL *file)
 {
-	int text_comment = 0;
-
-	int in_section=0;
-	int keyval_count=0;
+	int n = 0;
+	UINT rc;
 
-	char section[MAX_KEY_LEN] = {0};
-
-	f_lseek(&gfile, 0x0);
-	while(f_gets(buf, MAX_KEY_LEN, &gfile) != NULL)
+	while (n < len - 1) {
+		f_read(file, &line[n], 1, &rc);
+		if (rc != 1)
+			break;
+		if (line[n++] == '\n')
+			break;
+	}
+	line[n] = '\0';
+	return n ? line : NULL;
+}
+//------------------------------------------------------------------
+// lines that can't continue a multi-line cheat value
+static int Is_CHT_break(char *line,int line_len)
+{
+	if (line[0] != '#' && (line[0] != '/' || line[1] != '/'))
 	{
-		Trim(buf);
-    // to skip text comment with flags /* ...*/
-    if (buf[0] != '#' && (buf[0] != '/' || buf[1] != '/'))
-    {
-			if (strstr(buf, "/*") != NULL)
-			{
-				text_comment = 1;
-				continue;
-			}
-			else if (strstr(buf, "*/") != NULL)
-			{
-				text_comment = 0;
-				continue;
-			}
-    }
-    if (text_comment == 1)
-	  {
-			continue;
-    }
-
-		int buf_len = strlen(buf);
-          
-    // ignore and skip the line with first chracter '#', '=' or '/'
-    if (buf_len <= 1 || buf[0] == '#' || buf[0] == '=' || buf[0] == '/')
-    {
-    	in_section =0;
-        continue;
-    }
-
-		char _paramk[MAX_KEY_LEN] = {0}; 
-		char _paramv[/*MAX_VAL_LEN*/MAX_KEY_LEN] = {0};
-
-    int _kv=0, _klen=0, _vlen=0;
-    int i = 0;
-
-    int is_section=0;
-    int section_len=0;
-    int _val_len=0;
-
-    for (i=0; i<buf_len; ++i)
-    {
-      if (buf[i] == ' ')
-          continue;
-
-			if (buf[i] == '[')
-			{
-				is_section = 1;
-				in_section = 0;
-				
-				memset(section,0,MAX_KEY_LEN);
-				continue;
-			}
-
-			if(is_section == 1 && buf[i] != ']')
-			{
-				section[section_len++] = buf[i];
-				continue;
-			}
-      else if (buf[i] == ']')
-      {
-          is_section = 0;
-          in_section = 1;
-          _val_len = 0;
-          break;
-      }
-
-			if(in_section ==1)
-			{				
-				// scan param key name
-        if (_kv == 0 && buf[i] != '=')
-        {
-            if (_klen >= MAX_KEY_LEN)
-                break;
-            _paramk[_klen++] = buf[i];
-            continue;
-        }
-        else if (buf[i] == '=')
-        {
-            _kv = 1;
-            continue;
-        }
-	      	
-	      // scan param key value
-	      if (_vlen >= MAX_KEY_LEN || buf[i] == '#')
-					break;
-	                
-	      _paramv[_vlen++] = buf[i];
-	    }
-	          
-	  }
-     //DEBUG_printf("KEY_section %s, section %s",KEY_section,section);	     
-		if( strcmp(KEY_section,section)== 0)
-		{
-			if( strcmp(KEY_secval,_paramk) == 0)
-			{
-				strcpy(getbuff,_paramv); 
-
-				return;
-			}				
-		}
-		if (strcmp(_paramk, "")==0 || strcmp(_paramv, "")==0)
-			continue;
-
-		memset(buf,0,MAX_KEY_LEN) ;
-  }
+		if (strstr(line, "/*") != NULL || strstr(line, "*/") != NULL)
+			return 1;
+	}
+	if (line_len <= 1 || line[0] == '#' || line[0] == '=' || line[0] == '/' || line[0] == '[')
+		return 1;
+	if (strchr(line, '=') != NULL)
+		return 1;
+	return 0;
 }
 //------------------------------------------------------------------
-u32 Get_CHT_val(FIL* file,char*KEY_section,char*KEY_secval/*,char getbuff[]*/)
+// single pass over the .cht file: fills pCHTbuffer with the section/key
+// list, remembers where each key's value sits in the file and copies
+// [GameInfo] Name into gamename
+u32 Index_cht_file(FIL* file,char*gamename)
 {
+	char *line = (char*)buf;
 	int text_comment = 0;
-
 	int in_section=0;
-	int keyval_count=0;
+	int list_end=0;
+	u32 Line = 0;
+	u32 line_start;
+	u32 max_line = MAX_CHT_LINE;
+	FM_CHT_LINE *pValue = NULL; //key whose value may continue on the next line
 
 	char section[MAX_KEY_LEN] = {0};
 
-	f_lseek(&gfile, 0x0);
-	while(f_gets(buf, MAX_BUF_LEN, &gfile) != NULL)
+	f_lseek(file, 0x0);
+	while(1)
 	{
-		Trim(buf);
-    // to skip text comment with flags /* ...*/
-    if (buf[0] != '#' && (buf[0] != '/' || buf[1] != '/'))
-    {
-			if (strstr(buf, "/*") != NULL)
-			{
-				text_comment = 1;
-				continue;
-			}
-			else if (strstr(buf, "*/") != NULL)
+		line_start = f_tell(file);
+		if(Read_cht_line(line, MAX_BUF_LEN, file) == NULL)
+			break;
+		Trim(line);
+		int buf_len = strlen(line);
+
+		if(pValue != NULL)
+		{
+			if(text_comment == 0 && !Is_CHT_break(line, buf_len))
 			{
-				text_comment = 0;
+				pValue->val_len = f_tell(file) - pValue->val_offset;
 				continue;
 			}
-    }
-    if (text_comment == 1)
-	  {
-			continue;
-    }
-
-		int buf_len = strlen(buf);
-		//DEBUG_printf("cht buf_len %x",buf_len);	    
-          
-    // ignore and skip the line with first chracter '#', '=' or '/'
-    if (buf_len <= 1 || buf[0] == '#' || buf[0] == '=' || buf[0] == '/')
-    {
-    	in_section =0;
-        continue;
-    }
-
-		char _paramk[MAX_KEY_LEN] = {0}; 
-		//char _paramv[/*MAX_VAL_LEN*/MAX_KEY_LEN] = {0};
-
-    int _kv=0, _klen=0, _vlen=0;
-    int i = 0;
-
-    int is_section=0;
-    int section_len=0;
-    int _val_len=0;
-
-    for (i=0; i<buf_len; ++i)
-    {
-      if (buf[i] == ' ')
-          continue;
+			pValue = NULL;
+		}
 
-			if (buf[i] == '[')
+		if(line[0] == '-'  && line[1] == '-')
+			list_end = 1;
+		// to skip text comment with flags /* ...*/
+		if (line[0] != '#' && (line[0] != '/' || line[1] != '/'))
+		{
+			if (strstr(line, "/*") != NULL)
 			{
-				is_section = 1;
-				in_section = 0;
-				
-				memset(section,0,MAX_KEY_LEN);
+				text_comment = 1;
 				continue;
 			}
-
-			if(is_section == 1 && buf[i] != ']')
+			else if (strstr(line, "*/") != NULL)
 			{
-				section[section_len++] = buf[i];
+				text_comment = 0;
 				continue;
 			}
-      else if (buf[i] == ']')
-      {
-          is_section = 0;
-          in_section = 1;
-          _val_len = 0;
-          break;
-      }
-
-			if(in_section ==1)
-			{				
-				// scan param key name
-        if (_kv == 0 && buf[i] != '=')
-        {
-            if (_klen >= MAX_KEY_LEN)
-                break;
-            _paramk[_klen++] = buf[i];
-            continue;
-        }
-        else if (buf[i] == '=')
-        {
-            _kv = 1;
-            continue;
-        }	      	
-	      // scan param key value
-	      if (_vlen >= MAX_BUF_LEN || buf[i] == '#')
-					break;
-	                
-	      _paramv[_vlen++] = buf[i];
-	    }
-	          
-	  }
-	  _vlen--; //remove 0xd
-	    
-     //DEBUG_printf("KEY_section %s, section %s",KEY_section,section);	     
-		if( strcmp(KEY_section,section)== 0)
-		{
-			if( strcmp(KEY_secval,_paramk) == 0)
-			{
-			  //0111 Multi-line
-			  while(f_gets(buf, MAX_BUF_LEN, &gfile) != NULL)
-				{
-					Trim(buf);
-			    // to skip text comment with flags /* ...*/
-			    if (buf[0] != '#' && (buf[0] != '/' || buf[1] != '/'))
-			    {
-						if (strstr(buf, "/*") != NULL)
-						{
-							text_comment = 1;
-							break;
-						}
-						else if (strstr(buf, "*/") != NULL)
-						{
-							text_comment = 0;
-							break;
-						}
-			    }
-			    if (text_comment == 1)
-				  {
-						break;
-			    }
-
-					int buf_len = strlen(buf);
-					//DEBUG_printf("cht buf_len %x",buf_len);	    
-			          
-			    // ignore and skip the line with first chracter '#', '=' or '/'
-			    if (buf_len <= 1 || buf[0] == '#' || buf[0] == '=' || buf[0] == '/')
-			    {	    	
-			        break;
-			    }
-			    for (i=0; i<buf_len; ++i)
-		    	{
-		     	 	if (buf[i] == '=')
-		          goto endcht;
-		      }
-			    for (i=0; i<buf_len; ++i)
-		    	{
-						_paramv[_vlen++] = buf[i];
-		      }
-		       _vlen--; //remove 0xd
-		      //DEBUG_printf("%x %x %x %x %x %x %x %x", buf[0],buf[1], buf[2],buf[3], buf[4],buf[5], buf[6],buf[7]);	
-		      //wait_btn();
-			    
-			  }			  			  
-			  endcht:
-				return _vlen;	
-			}				
-		}
-		if (strcmp(_paramk, "")==0 || strcmp(_paramv, "")==0)
-			continue;
-
-		memset(buf,0,MAX_KEY_LEN) ;
-  }
-  return 0;
-}
-//------------------------------------------------------------------
-u32 Get_all_Section_val(FIL* file)
-{
-	char buf[MAX_sectionVAL_LEN];
-	int text_comment = 0;
-
-	int in_section=0;
-	//char keyval[10][25];
-	int keyval_count=0;
-	u32 Line = 0;
-
-
-	char section[MAX_KEY_LEN] = {0};
-
-	//fseek(file,0x0,SEEK_SET);
-	f_lseek(&gfile, 0x0);
-	while(f_gets(buf, MAX_sectionVAL_LEN, &gfile) != NULL)
-	{
-		memset(tmpCHTFS.LINEname,0x00,MAX_KEY_LEN);
-		Trim(buf);
-		// to skip text comment with flags /* ...*/
-		if(buf[0] == '-'  && buf[1] == '-')
-			break;
-		if (buf[0] != '#' && (buf[0] != '/' || buf[1] != '/'))
-		{
-		    if (strstr(buf, "/*") != NULL)
-		    {
-		        text_comment = 1;
-		        continue;
-		    }
-		    else if (strstr(buf, "*/") != NULL)
-		    {
-		        text_comment = 0;
-		        continue;
-		    }
 		}
 		if (text_comment == 1)
 		{
-		    continue;
+			continue;
 		}
 
-		int buf_len = strlen(buf);            
-		
 		// ignore and skip the line with first chracter '#', '=' or '/'
-		if (buf_len <= 1 || buf[0] == '#' || buf[0] == '=' || buf[0] == '/')
+		if (buf_len <= 1 || line[0] == '#' || line[0] == '=' || line[0] == '/')
 		{
 			in_section =0;
-		    continue;
+			continue;
 		}
-		char _paramk[MAX_KEY_LEN] = {0}; 
-		//char _paramv[MAX_sectionVAL_LEN] = {0};
-
-		int _kv=0, _klen=0, _vlen=0;
-		int i = 0;
 
+		char _paramk[MAX_KEY_LEN] = {0};
+		int _klen=0;
+		int i;
 		int is_section=0;
 		int section_len=0;
-		//int _val_len=0;
 
 		for (i=0; i<buf_len; ++i)
 		{
-			if (buf[i] == ' ')
+			if (line[i] == ' ')
 				continue;
 
-			if (buf[i] == '[')
+			if (line[i] == '[')
 			{
 				is_section = 1;
 				in_section = 0;
-				
+				section_len = 0;
 				memset(section,0,MAX_KEY_LEN);
 				continue;
 			}
 
-			if(is_section == 1 && buf[i] != ']')
+			if(is_section == 1 && line[i] != ']')
 			{
-				section[section_len++] = buf[i];
+				if (section_len < MAX_KEY_LEN-1)
+					section[section_len++] = line[i];
 				continue;
 			}
-      else if (buf[i] == ']')
-      {      	
-      	memcpy(tmpCHTFS.LINEname,section,section_len);      	
-      	tmpCHTFS.is_section = 1;
-      	tmpCHTFS.len = section_len;
-      	tmpCHTFS.select =0;
-      	
-      	dmaCopy(&tmpCHTFS,&((FM_CHT_LINE*)pCHTbuffer)[Line], sizeof(FM_CHT_LINE));
-      	
-      	Line++;
-      	//if(Line==10)return;
-        is_section = 0;
-        in_section = 1;
-        //_val_len = 0;
-        break;
-      }
-					
-			if(in_section ==1)
-			{								
-        // scan param key name
-        if (_kv == 0 && buf[i] != '=')
-        {
-            if (_klen >= MAX_KEY_LEN)
-                break;
-            _paramk[_klen++] = buf[i];
-            continue;
-        }
-        else if (buf[i] == '=')
-        {
-      		//DEBUG_printf(":%s ",_paramk);
-      		memcpy(tmpCHTFS.LINEname,_paramk,_klen);      		
-      		tmpCHTFS.is_section = 0; 
-      		
-      		tmpCHTFS.select =0;  
-      			     		        		
-          _kv = 1;
-          continue;
-        }
-        else{
-		      /*
-		      // scan param key value
-		      if (_vlen >= MAX_VAL_LEN || buf[i] == '#')
-		                break;
-		                
-		      _paramv[_vlen++] = buf[i];
-		      */
-	    	}
-      }
-            
-		}	
-		if(_kv ==1)
-		{	
-			tmpCHTFS.len = _vlen;
-			//memcpy(tmpCHTFS.KEY_val,_paramv,_vlen);    
-			dmaCopy(&tmpCHTFS,&((FM_CHT_LINE*)pCHTbuffer)[Line], sizeof(FM_CHT_LINE));
-			Line++;
+			else if (line[i] == ']')
+			{
+				if(!list_end && Line < max_line)
+				{
+					memset(&tmpCHTFS,0x00,sizeof(FM_CHT_LINE));
+					memcpy(tmpCHTFS.LINEname,section,section_len);
+					tmpCHTFS.is_section = 1;
+					tmpCHTFS.len = section_len;
+					dmaCopy(&tmpCHTFS,&((FM_CHT_LINE*)pCHTbuffer)[Line], sizeof(FM_CHT_LINE));
+					Line++;
+				}
+				is_section = 0;
+				in_section = 1;
+				break;
+			}
+
+			if(in_section == 1)
+			{
+				// scan param key name
+				if (line[i] != '=')
+				{
+					if (_klen >= MAX_KEY_LEN-1)
+						break;
+					_paramk[_klen++] = line[i];
+					continue;
+				}
+
+				if(strcmp(section,"GameInfo") == 0 && strcmp(_paramk,"Name") == 0)
+				{
+					strncpy(gamename, line+i+1, MAX_KEY_LEN-1);
+					gamename[MAX_KEY_LEN-1] = 0;
+				}
+				if(!list_end && Line < max_line)
+				{
+					memset(&tmpCHTFS,0x00,sizeof(FM_CHT_LINE));
+					memcpy(tmpCHTFS.LINEname,_paramk,_klen);
+					tmpCHTFS.val_offset = line_start + i + 1;
+					tmpCHTFS.val_len = f_tell(file) - tmpCHTFS.val_offset;
+					dmaCopy(&tmpCHTFS,&((FM_CHT_LINE*)pCHTbuffer)[Line], sizeof(FM_CHT_LINE));
+					pValue = &((FM_CHT_LINE*)pCHTbuffer)[Line];
+					Line++;
+				}
+				break;
+			}
 		}
-  }
+	}
 	return Line;
 }
 //------------------------------------------------------------------
+// fetch one indexed value into _paramv, without blanks, line breaks and '#' comments
+u32 Read_CHT_val(FIL* file,FM_CHT_LINE *pKey)
+{
+	UINT ret;
+	u32 i;
+	u32 vlen=0;
+	u32 comment=0;
+	u32 size = pKey->val_len;
+
+	if(size > MAX_BUF_LEN) size = MAX_BUF_LEN;
+	f_lseek(file, pKey->val_offset);
+	f_read(file, buf, size, &ret);
+
+	for(i=0;i<ret;i++)
+	{
+		if(buf[i] == '\n'){
+			comment = 0;
+			continue;
+		}
+		if(buf[i] == '#')
+			comment = 1;
+		if(comment || buf[i] == ' ' || buf[i] == '\t' || buf[i] == '\r')
+			continue;
+		_paramv[vlen++] = buf[i];
+	}
+	return vlen;
+}
+//------------------------------------------------------------------
 void Show_KEY_val(u32 total,u32 Select,u32 showoffset)
 {
 	u32 need_show;	
@@ -556,8 +336,37 @@ unsigned long str2hex(unsigned char*str)
 	return sum;
 }
 //------------------------------------------------------------------
-void Analyze_KEYVAL(FIL* file,u32 total)
+// "@N" every N VBlanks (N rounded down to a power of two),
+// "?addr,val[,eq|gt|lt]" only while the byte compares
+static void Parse_cheat_guard(char *mod)
 {
+	char *val,*op;
+	u32 type = CHEAT_IF_EQ;
+
+	if(mod[0] == '@'){
+		Set_cheat_guard(CHEAT_EVERY,atoi(mod+1),0);
+		return;
+	}
+	val = strchr(mod,',');
+	if(val == NULL)
+		return;
+	*val++ = 0;
+	op = strchr(val,',');
+	if(op != NULL)
+	{
+		*op++ = 0;
+		if(op[0] == 'g' || op[0] == 'G')
+			type = CHEAT_IF_GT;
+		else if(op[0] == 'l' || op[0] == 'L')
+			type = CHEAT_IF_LT;
+	}
+	Set_cheat_guard(type,str2hex((unsigned char*)mod+1),str2hex((unsigned char*)val));
+}
+//------------------------------------------------------------------
+// returns the selected cheats that did not fit into the patch
+u32 Analyze_KEYVAL(FIL* file,u32 total,u32 from_db)
+{
+	u32 dropped = 0;
 	u32 tol,i;
 	u32 buflen;
 	//u32 entry;
@@ -569,10 +378,13 @@ void Analyze_KEYVAL(FIL* file,u32 total)
 	u32 is_val;
 	u32 is_address;
 	u32 address_add;
+	char mod_buf[24];
+	u32 mod_len;
+	u32 in_mod;
 	//char BUF_val[256];
 	
 	//DEBUG_printf("total %x  ",total);
-	gl_cheat_count=0;
+	Clear_cheat();
 		
 	if(total)
 	{		
@@ -582,24 +394,68 @@ void Analyze_KEYVAL(FIL* file,u32 total)
 		
 		if( ((FM_CHT_LINE*)pCHTbuffer)[tol].select == 1)
 		{						
-			u32 current_select = tol-1;
-			while(((FM_CHT_LINE*)pCHTbuffer)[current_select].is_section != 1)						
+			Begin_cheat();
+			if(from_db)//already parsed by chtdb
 			{
-				current_select--;
+				UINT ret;
+				ST_entry entry[32];
+				u32 count = ((FM_CHT_LINE*)pCHTbuffer)[tol].val_len;
+				f_lseek(file, ((FM_CHT_LINE*)pCHTbuffer)[tol].val_offset);
+				while(count)
+				{
+					u32 n = (count > 32) ? 32 : count;
+					f_read(file, entry, n*sizeof(ST_entry), &ret);
+					if(ret != n*sizeof(ST_entry))
+						break;
+					for(i=0;i<n;i++)
+					{
+						if(entry[i].VAL & CHT_GUARD)
+						{
+							u32 op = (entry[i].VAL>>16)&0xFF;
+							if(op)
+								Set_cheat_guard(op,entry[i].address,entry[i].VAL&0xFFFF);
+							else
+								End_cheat_guard();
+						}
+						else
+							Add_cheat(entry[i].address,entry[i].VAL);
+					}
+					count -= n;
+				}
+				if(!End_cheat())
+					dropped++;
+				continue;
 			}
-			//DEBUG_printf("section %s  ", ((FM_CHT_LINE*)pCHTbuffer)[current_select].LINEname);										
-			buflen= Get_CHT_val(&gfile,((FM_CHT_LINE*)pCHTbuffer)[current_select].LINEname,((FM_CHT_LINE*)pCHTbuffer)[tol].LINEname);
+			buflen= Read_CHT_val(file,&((FM_CHT_LINE*)pCHTbuffer)[tol]);
 																																				
 			address_len=0;
 			is_val = 0;
 			is_address = 1;
 			address_add = 0;
+			in_mod = 0;
 			memset(address_buf,0x00,8);
 			for(i=0;i<buflen;i++)
 			{
 	      if (_paramv[i] == ' '){
 	          continue;
 				}
+				if(in_mod){
+					if(_paramv[i] == ':'){
+						mod_buf[mod_len] = 0;
+						Parse_cheat_guard(mod_buf);
+						in_mod = 0;
+					}
+					else if(mod_len < sizeof(mod_buf)-1){
+						mod_buf[mod_len++] = _paramv[i];
+					}
+					continue;
+				}
+				if(is_address==1 && address_len==0 && (_paramv[i] == '?' || _paramv[i] == '@')){
+					in_mod = 1;
+					mod_len = 0;
+					mod_buf[mod_len++] = _paramv[i];
+					continue;
+				}
 				else if (_paramv[i] == ','){						
 					if(is_address==1)	//first ','
 					{					
@@ -607,8 +463,7 @@ void Analyze_KEYVAL(FIL* file,u32 total)
 					}
 					else{	//next ','
 						//DEBUG_printf(",0x%x =%x", str2hex(address_buf)+address_add,str2hex(val_buf));
-						ST_entry cheat = { str2hex(address_buf)+address_add,str2hex(val_buf) };
-						pCHEAT[gl_cheat_count++] = cheat;
+						Add_cheat(str2hex(address_buf)+address_add,str2hex(val_buf));
 		
 						address_add++;
 					}
@@ -618,8 +473,8 @@ void Analyze_KEYVAL(FIL* file,u32 total)
 					continue;
 				}
 				else if(_paramv[i] == ';'){
-					ST_entry cheat = { str2hex(address_buf)+address_add,str2hex(val_buf) };
-					pCHEAT[gl_cheat_count++] = cheat;	
+					Add_cheat(str2hex(address_buf)+address_add,str2hex(val_buf));
+					End_cheat_guard();
 					
 					
 					is_val = 0;
@@ -637,11 +492,12 @@ void Analyze_KEYVAL(FIL* file,u32 total)
 					address_buf[address_len++] = _paramv[i];
 				}							
 			}
-			ST_entry cheat = { str2hex(address_buf)+address_add,str2hex(val_buf) };
-			pCHEAT[gl_cheat_count++] = cheat;
-						
+			Add_cheat(str2hex(address_buf)+address_add,str2hex(val_buf));
+			if(!End_cheat())
+				dropped++;
 		}
 	}
+	return dropped;
 }
 //------------------------------------------------------------------
 u32 Check_count(u32 all_count)
@@ -692,56 +548,15 @@ u32 Change2cht_folder(u32 chtname)
 	memset(chtnamebuf,0x00,100);
 	sprintf(chtnamebuf,"%d%d%d%d",HexToChar(((u8*)&chtname)[0]),HexToChar(((u8*)&chtname)[1]),HexToChar(((u8*)&chtname)[2]),HexToChar(  ((u8*)&chtname)[3] )  );
 	u32 num=atoi(chtnamebuf);
-	//DEBUG_printf("num =%d", num);					
-	if(num < 200){
-		folder_name = (TCHAR*)"0000";
-	}
-	else if(num < 400){
-		folder_name = (TCHAR*)"0200";
-	}
-	else if(num < 600){
-		folder_name = (TCHAR*)"0400";
-	}			
-	else if(num < 800){
-		folder_name = (TCHAR*)"0600";
+	char folder_num[5];
+	//folders hold 200 games each, 2800 only up to 2899
+	if(num < 2900){
+		sprintf(folder_num,"%04lu",num/200*200);
+		folder_name = (TCHAR*)folder_num;
 	}
-	else if(num < 1000){
-		folder_name = (TCHAR*)"0800";
-	}
-	else if(num < 1200){
-		folder_name = (TCHAR*)"1000";
-	}			
-	else if(num < 1400){
-		folder_name = (TCHAR*)"1200";
-	}	
-	else if(num < 1600){
-		folder_name = (TCHAR*)"1400";
-	}
-	else if(num < 1800){
-		folder_name = (TCHAR*)"1600";
-	}			
-	else if(num < 2000){
-		folder_name = (TCHAR*)"1800";
-	}				
-	else if(num < 2200){
-		folder_name = (TCHAR*)"2000";
-	}
-	else if(num < 2400){
-		folder_name = (TCHAR*)"2200";
-	}			
-	else if(num < 2600){
-		folder_name = (TCHAR*)"2400";
-	}	
-	else if(num < 2800){
-		folder_name = (TCHAR*)"2600";
-	}	
-	else if (num < 2900){
-		folder_name = (TCHAR*)"2800";
-	}						
 	else {
 		folder_name = (TCHAR*)"Homebrew";
-	}						
-	
+	}
 	
 	if(gl_select_lang == 0xE1E1)//english
 	{
@@ -754,11 +569,56 @@ u32 Change2cht_folder(u32 chtname)
 	return res;
 }
 //------------------------------------------------------------------
+static const TCHAR* CHT_db_name(void)
+{
+	if(gl_select_lang == 0xE1E1)//english
+		return "/SYSTEM/CHEAT/Eng/CHEAT.DB";
+	else
+		return "/SYSTEM/CHEAT/Chn/CHEAT.DB";
+}
+//------------------------------------------------------------------
+// binary search of the sorted game table, returns the record offset or 0
+u32 Find_cht_db(u32 GAMEID)
+{
+	UINT ret;
+	CHT_DB_HEAD head;
+	CHT_DB_GAME game;
+	u32 low,high,mid;
+	u32 offset=0;
+
+	if(f_open(&gfile, CHT_db_name(), FA_READ) != FR_OK)
+		return 0;
+	f_read(&gfile, &head, sizeof(CHT_DB_HEAD), &ret);
+	if(ret == sizeof(CHT_DB_HEAD) && head.magic == CHT_DB_MAGIC && head.version == CHT_DB_VERSION)
+	{
+		low = 0;
+		high = head.game_count;
+		while(low < high)
+		{
+			mid = (low + high) / 2;
+			f_lseek(&gfile, sizeof(CHT_DB_HEAD) + mid*sizeof(CHT_DB_GAME));
+			f_read(&gfile, &game, sizeof(CHT_DB_GAME), &ret);
+			if(ret != sizeof(CHT_DB_GAME))
+				break;
+			if(game.gameid == GAMEID){
+				offset = game.offset;
+				break;
+			}
+			if(game.gameid < GAMEID)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+	}
+	f_close(&gfile);
+	return offset;
+}
+//------------------------------------------------------------------
 u32 Check_cheat_file(TCHAR *gamefilename)
 {
 	u32 res;
 	UINT ret;
-	TCHAR chtnamebuf[100];	
+	TCHAR chtnamebuf[MAX_name_len];	
 	u32 filesize;
 	u32 GAMEID=0;
 	u32 i;
@@ -772,7 +632,7 @@ u32 Check_cheat_file(TCHAR *gamefilename)
 		if(GAMEID==0) return 0;
 	}
 	
-	memcpy(chtnamebuf,gamefilename,100);
+	snprintf(chtnamebuf,sizeof(chtnamebuf),"%s",gamefilename);
 	u32 len=strlen(chtnamebuf);
 	chtnamebuf[len-3] = 'c';
 	chtnamebuf[len-2] = 'h';
@@ -792,14 +652,23 @@ u32 Check_cheat_file(TCHAR *gamefilename)
 	}					
 	else
 	{			
+		gl_cht_db_offset = Find_cht_db(GAMEID);
+		if(gl_cht_db_offset)
+			return CHT_IN_DB;
+
 		res = f_open(&gfile,"GameID2cht.bin", FA_READ);
-		u32* tempbuff = (u32*)(pReadCache);
 		if(res == FR_OK)//have a file
 		{
+			u32* tempbuff = Scratch_alloc(0x10000,"GameID2cht");
+			if(tempbuff == NULL)
+			{
+				f_close(&gfile);
+				return 0;
+			}
 			filesize = f_size(&gfile);
 			if(filesize > 0x10000) filesize=0x10000;
 			f_lseek(&gfile, 0x0);
-			f_read(&gfile, tempbuff, filesize, &ret);//pReadCache max 0x20000 Byte
+			f_read(&gfile, tempbuff, filesize, &ret);
 
 			for(i=0;i<filesize/4;i+=2)
 			{
@@ -809,10 +678,11 @@ u32 Check_cheat_file(TCHAR *gamefilename)
 					f_close(&gfile); 
 					
 					u32 chtname= ((u32*)tempbuff)[i+1];
+					Scratch_release(tempbuff);
 
 					res=Change2cht_folder(chtname);
 					if(res!=0)return 0;
-					memset(chtnamebuf,0x00,100);
+					memset(chtnamebuf,0x00,sizeof(chtnamebuf));
 					sprintf(chtnamebuf,"%d%d%d%d.cht",HexToChar(((u8*)&chtname)[0]),HexToChar(((u8*)&chtname)[1]),HexToChar(((u8*)&chtname)[2]),HexToChar(  ((u8*)&chtname)[3] )  );			
 					res = f_open(&gfile,chtnamebuf, FA_OPEN_EXISTING);	
 
@@ -826,6 +696,7 @@ u32 Check_cheat_file(TCHAR *gamefilename)
 					}
 				}
 			}			
+			Scratch_release(tempbuff);
 		}
 		return 0;
 	}	
@@ -847,7 +718,7 @@ void Open_cht_file(TCHAR *gamefilename,u32 havecht)
 	DrawPic((u16*)gImage_RECENTLY, 0, 0, 240, 160, 0, 0, 1);
 	u32 res;
 	char msg[128];
-	TCHAR chtnamebuf[100];	
+	TCHAR chtnamebuf[MAX_name_len];	
 
 	char buffer[128]={0};
 		
@@ -857,12 +728,16 @@ void Open_cht_file(TCHAR *gamefilename,u32 havecht)
 		if(res != FR_OK){
 			return;
 		}	
-		memcpy(chtnamebuf,gamefilename,100);	
+		snprintf(chtnamebuf,sizeof(chtnamebuf),"%s",gamefilename);	
 		u32 len=strlen(chtnamebuf);
 		chtnamebuf[len-3] = 'c';
 		chtnamebuf[len-2] = 'h';
 		chtnamebuf[len-1] = 't';			
 	}
+	else if(havecht == CHT_IN_DB)
+	{
+		sprintf(chtnamebuf,"%s",CHT_db_name());
+	}
 	else
 	{
 		Change2cht_folder(havecht);
@@ -874,14 +749,36 @@ void Open_cht_file(TCHAR *gamefilename,u32 havecht)
 
 	if(res == FR_OK)//have a cht file
 	{		
+		pCHTbuffer = Scratch_alloc(MAX_CHT_LINE*sizeof(FM_CHT_LINE),"cht lines");
+		if(pCHTbuffer == NULL)
+		{
+			f_close(&gfile);
+			DrawHZText12(gl_error_9,0,2,24, gl_color_chtTXT,1);
+			wait_btn();
+			return;
+		}
 
-
-		Get_KEY_val(&gfile,"GameInfo","Name",buffer);
+		u32 all_count;
+		if(havecht == CHT_IN_DB)
+		{
+			CHT_DB_RECORD record;
+			UINT ret;
+			u32 max_line = MAX_CHT_LINE;
+			f_lseek(&gfile, gl_cht_db_offset);
+			f_read(&gfile, &record, sizeof(CHT_DB_RECORD), &ret);
+			memcpy(buffer, record.gamename, MAX_KEY_LEN);
+			buffer[MAX_KEY_LEN-1] = 0;
+			all_count = record.line_count;
+			if(all_count > max_line) all_count = max_line;
+			f_read(&gfile, pCHTbuffer, all_count*sizeof(FM_CHT_LINE), &ret);
+			all_count = ret/sizeof(FM_CHT_LINE);
+		}
+		else
+			all_count = Index_cht_file(&gfile,buffer);
 		sprintf(msg,"%s ",buffer);
 		
 		DrawHZText12(msg,30,2,4, gl_color_chtTXT,1);
 		
-		u32 all_count = Get_all_Section_val(&gfile);
 		u32 Select = 1;
 		u32 showoffset = 0;
 		u32 re_show = 2;
@@ -1034,11 +931,18 @@ void Open_cht_file(TCHAR *gamefilename,u32 havecht)
 				}
 				else if(keysup & KEY_B)
 				{
-					Analyze_KEYVAL(&gfile,all_count);
+					if(Analyze_KEYVAL(&gfile,all_count,(havecht == CHT_IN_DB)))
+					{
+						ClearWithBG((u16*)gImage_RECENTLY, 0, 19, 240, 160-19, 1);
+						DrawHZText12(gl_cheat_full,0,2,24, gl_color_chtTXT,1);
+						wait_btn();
+					}
 					break;
 				}				
 			}
 		}
+		Scratch_release(pCHTbuffer);
+		pCHTbuffer = NULL;
 	}					
 	f_close(&gfile);	
 }
@@ -0,0 +1,320 @@
+#include <stdio.h>
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+#include <gba_interrupt.h>
+#include <gba_sound.h>
+#include <gba_timers.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "bgm.h"
+
+// Timer 0 overflows every 924 cycles (18157 Hz) and each overflow plays a
+// sample from FIFO A, which DMA1 refills 16 bytes at a time. 924 cycles
+// divide a frame exactly, so a frame plays 304 samples and the VBlank
+// handler only points DMA1 at the next 304 byte frame of the ring, or at
+// silence when the browser has not kept up. The ring is refilled in
+// Bgm_service from the main loop; the handler never touches the card.
+// Like the progress handler it lives in IWRAM and DMA1 only reads RAM, NOR
+// writes remap the cartridge while they run.
+#ifdef BGM_STREAM
+
+#define BGM_TIMER (0x10000 - 924)
+#define BGM_RATE 18157
+#define BGM_FRAME 304			//samples per frame, 280896 / 924
+#define BGM_FRAMES 32			//about half a second
+#define BGM_RING (BGM_FRAME * BGM_FRAMES)
+#define BGM_BLOCK 512
+#define BGM_SLICE 2				//blocks per Bgm_service at most
+
+#define Bgm_clock_start() do { REG_TM3CNT_H = 0; REG_TM3CNT_L = 0; REG_TM3CNT_H = TIMER_START | 1; } while (0)
+#define Bgm_clock() REG_TM3CNT_L
+
+enum {
+	BGM_PCM,
+	BGM_ADPCM
+};
+
+static const u16 bgm_step[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+	253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+	1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+	3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+	11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+	32767
+};
+static const s8 bgm_index_step[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+static u32 bgm_silence = 0;
+
+static s8 bgm_ring[BGM_RING]EWRAM_BSS;
+static u8 bgm_block[BGM_BLOCK]EWRAM_BSS;
+static FIL bgm_file EWRAM_BSS;
+
+static vu32 bgm_played = 0;		//frames handed to DMA1
+static vu32 bgm_written = 0;	//samples put in the ring
+static u32 bgm_format;
+static u32 bgm_track;
+static u32 bgm_open = 0;		//bgm_file is a track
+static u32 bgm_on = 0;			//timer, DMA and handler running
+static u32 bgm_hold = 0;		//Bgm_pause depth
+
+// --------------------------------------------------------------------
+static void IWRAM_CODE Bgm_VBlank(void)
+{
+	u32 played = bgm_played;
+
+	REG_DMA1CNT = 0;
+	if (bgm_written - played * BGM_FRAME >= BGM_FRAME) {
+		REG_DMA1SAD = (u32)&bgm_ring[(played % BGM_FRAMES) * BGM_FRAME];
+		REG_DMA1CNT = DMA_DST_FIXED | DMA_REPEAT | DMA32 | DMA_SPECIAL | DMA_ENABLE | 4;
+		bgm_played = played + 1;
+	}
+	else {
+		REG_DMA1SAD = (u32)&bgm_silence;
+		REG_DMA1CNT = DMA_SRC_FIXED | DMA_DST_FIXED | DMA_REPEAT | DMA32 | DMA_SPECIAL | DMA_ENABLE | 4;
+	}
+}
+// --------------------------------------------------------------------
+static void Bgm_output(u32 on)
+{
+	if (on) {
+		REG_SOUNDCNT_X = SNDSTAT_ENABLE;
+		REG_SOUNDCNT_H = SNDA_VOL_100 | SNDA_R_ENABLE | SNDA_L_ENABLE | SNDA_RESET_FIFO;
+		REG_DMA1DAD = (u32)&REG_FIFO_A;
+		irqSet(IRQ_VBLANK, Bgm_VBlank);
+		REG_TM0CNT_L = BGM_TIMER;
+		REG_TM0CNT_H = TIMER_START;
+	}
+	else {
+		irqSet(IRQ_VBLANK, 0);
+		REG_TM0CNT_H = 0;
+		REG_DMA1CNT = 0;
+		REG_SOUNDCNT_H = 0;
+		REG_SOUNDCNT_X = 0;
+	}
+	bgm_on = on;
+}
+// --------------------------------------------------------------------
+//track n of the folder in directory order, from the first one past the
+//last; 0 when there is none
+static u32 Bgm_open(u32 n)
+{
+	DIR dir;
+	FILINFO info;
+	TCHAR path[MAX_path_len];
+	const char *ext;
+	u32 count = 0, format;
+
+	if (bgm_open) {
+		f_close(&bgm_file);
+		bgm_open = 0;
+	}
+	if (f_opendir(&dir, BGM_DIR) != FR_OK)
+		return 0;
+	while (f_readdir(&dir, &info) == FR_OK && info.fname[0]) {
+		if (info.fattrib & AM_DIR)
+			continue;
+		ext = strrchr(info.fname, '.');
+		if (ext == NULL)
+			continue;
+		if (!strcasecmp(ext, ".pcm"))
+			format = BGM_PCM;
+		else if (!strcasecmp(ext, ".adp"))
+			format = BGM_ADPCM;
+		else
+			continue;
+		if (count++ < n)
+			continue;
+		snprintf(path, sizeof(path), "%s/%s", BGM_DIR, info.fname);
+		if (f_open(&bgm_file, path, FA_READ) == FR_OK) {
+			bgm_format = format;
+			bgm_track = n;
+			bgm_open = 1;
+		}
+		break;
+	}
+	f_closedir(&dir);
+	if (!bgm_open && n && count)
+		return Bgm_open(0);
+	return bgm_open;
+}
+// --------------------------------------------------------------------
+//one IMA ADPCM block: 4 byte header, then two samples a byte, low nibble first
+static u32 Bgm_adpcm(u32 size)
+{
+	s32 pred, diff, step;
+	s32 index;
+	u32 w = bgm_written % BGM_RING;
+	u32 i, nib, n = 0;
+
+	if (size < 4)
+		return 0;
+	pred = (s16)(bgm_block[0] | (bgm_block[1] << 8));
+	index = bgm_block[2];
+	if (index > 88)
+		index = 88;
+	bgm_ring[w] = pred >> 8;
+	w = (w + 1 == BGM_RING) ? 0 : w + 1;
+	n++;
+	for (i = 8; i < size * 2; i++) {
+		nib = (bgm_block[i >> 1] >> ((i & 1) * 4)) & 0xF;
+		step = bgm_step[index];
+		diff = step >> 3;
+		if (nib & 1)
+			diff += step >> 2;
+		if (nib & 2)
+			diff += step >> 1;
+		if (nib & 4)
+			diff += step;
+		pred += (nib & 8) ? -diff : diff;
+		if (pred > 32767)
+			pred = 32767;
+		else if (pred < -32768)
+			pred = -32768;
+		index += bgm_index_step[nib & 7];
+		if (index < 0)
+			index = 0;
+		else if (index > 88)
+			index = 88;
+		bgm_ring[w] = pred >> 8;
+		w = (w + 1 == BGM_RING) ? 0 : w + 1;
+		n++;
+	}
+	return n;
+}
+// --------------------------------------------------------------------
+static u32 Bgm_pcm(u32 size)
+{
+	u32 w = bgm_written % BGM_RING;
+	u32 part = BGM_RING - w;
+
+	if (part > size)
+		part = size;
+	memcpy(&bgm_ring[w], bgm_block, part);
+	memcpy(bgm_ring, bgm_block + part, size - part);
+	return size;
+}
+// --------------------------------------------------------------------
+//next block of the track into the ring, the samples it made
+static u32 Bgm_block(void)
+{
+	UINT got;
+	u32 n;
+
+	if (f_read(&bgm_file, bgm_block, BGM_BLOCK, &got) != FR_OK || got == 0)
+		return 0;
+	n = (bgm_format == BGM_ADPCM) ? Bgm_adpcm(got) : Bgm_pcm(got);
+	__asm__ volatile ("" ::: "memory");	//samples are in before the handler can see them
+	bgm_written += n;
+	return n;
+}
+// --------------------------------------------------------------------
+void Bgm_start(void)
+{
+	u32 i;
+
+	if (bgm_open || !Bgm_open(0))
+		return;
+	bgm_played = 0;
+	bgm_written = 0;
+	for (i = 0; i < BGM_SLICE; i++)
+		Bgm_block();
+	if (!bgm_hold)
+		Bgm_output(1);
+}
+// --------------------------------------------------------------------
+void Bgm_stop(void)
+{
+	if (bgm_on)
+		Bgm_output(0);
+	if (bgm_open) {
+		f_close(&bgm_file);
+		bgm_open = 0;
+	}
+}
+// --------------------------------------------------------------------
+void Bgm_pause(void)
+{
+	if (bgm_hold++ == 0 && bgm_on)
+		Bgm_output(0);
+}
+// --------------------------------------------------------------------
+void Bgm_resume(void)
+{
+	if (bgm_hold && --bgm_hold == 0 && bgm_open)
+		Bgm_output(1);
+}
+// --------------------------------------------------------------------
+void Bgm_service(void)
+{
+	u32 i;
+	u32 need = (bgm_format == BGM_ADPCM) ? BGM_BLOCK * 2 - 7 : BGM_BLOCK;
+
+	if (!bgm_open || bgm_hold)
+		return;
+	for (i = 0; i < BGM_SLICE; i++) {
+		//one frame stays free for the one DMA1 is playing
+		if (bgm_written + need - bgm_played * BGM_FRAME > BGM_RING - BGM_FRAME)
+			break;
+		if (Bgm_block() == 0 && !Bgm_open(bgm_track + 1)) {
+			Bgm_stop();
+			break;
+		}
+	}
+}
+// --------------------------------------------------------------------
+u32 Bgm_bench(u32 *ticks_irq)
+{
+	u32 samples = 0, ticks = 0, n, i;
+
+	*ticks_irq = 0;
+	if (bgm_on || !Bgm_open(0))
+		return 0;
+	bgm_played = 0;
+	while (samples < BGM_RATE) {
+		bgm_written = 0;
+		Bgm_clock_start();
+		n = Bgm_block();
+		ticks += Bgm_clock();
+		if (n == 0)
+			break;
+		samples += n;
+	}
+	//timer 0 is stopped, DMA1 is armed but moves nothing
+	Bgm_clock_start();
+	for (i = 0; i < 60; i++) {
+		bgm_written = bgm_played * BGM_FRAME + BGM_FRAME;
+		Bgm_VBlank();
+	}
+	*ticks_irq = Bgm_clock();
+	REG_TM3CNT_H = 0;
+	REG_DMA1CNT = 0;
+	bgm_played = 0;
+	bgm_written = 0;
+	Bgm_stop();
+	return samples ? ticks * BGM_RATE / samples : 0;
+}
+#else
+void Bgm_start(void)
+{
+}
+void Bgm_stop(void)
+{
+}
+void Bgm_pause(void)
+{
+}
+void Bgm_resume(void)
+{
+}
+void Bgm_service(void)
+{
+}
+u32 Bgm_bench(u32 *ticks_irq)
+{
+	*ticks_irq = 0;
+	return 0;
+}
+#endif
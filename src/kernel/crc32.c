@@ -0,0 +1,74 @@
+#include <gba_base.h>
+
+#include "crc32.h"
+
+#ifndef ARM_CODE
+#define ARM_CODE __attribute__((target("arm")))
+#endif
+
+#define CRC32_POLY 0xEDB88320
+
+static u32 crc_table[8][256] EWRAM_BSS;
+static u32 crc_table_ready = 0;
+
+// --------------------------------------------------------------------
+static void Crc32_init(void)
+{
+	u32 i, j, c;
+	for (i = 0; i < 256; i++) {
+		c = i;
+		for (j = 0; j < 8; j++)
+			c = (c & 1) ? (c >> 1) ^ CRC32_POLY : c >> 1;
+		crc_table[0][i] = c;
+	}
+	//table k advances a byte k more positions through zeros
+	for (i = 0; i < 256; i++) {
+		c = crc_table[0][i];
+		for (j = 1; j < 8; j++) {
+			c = crc_table[0][c & 0xFF] ^ (c >> 8);
+			crc_table[j][i] = c;
+		}
+	}
+	crc_table_ready = 1;
+}
+// --------------------------------------------------------------------
+static u32 IWRAM_CODE ARM_CODE Crc32_run(u32 crc, const u8 *p, u32 size)
+{
+	const u32 *w;
+	u32 one, two;
+
+	while (size && ((u32)p & 3)) {
+		crc = crc_table[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+		size--;
+	}
+	w = (const u32 *)p;
+	while (size >= 8) {
+		one = *w++ ^ crc;
+		two = *w++;
+		crc = crc_table[7][one & 0xFF] ^
+			crc_table[6][(one >> 8) & 0xFF] ^
+			crc_table[5][(one >> 16) & 0xFF] ^
+			crc_table[4][one >> 24] ^
+			crc_table[3][two & 0xFF] ^
+			crc_table[2][(two >> 8) & 0xFF] ^
+			crc_table[1][(two >> 16) & 0xFF] ^
+			crc_table[0][two >> 24];
+		size -= 8;
+	}
+	p = (const u8 *)w;
+	while (size--)
+		crc = crc_table[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+	return crc;
+}
+// --------------------------------------------------------------------
+u32 Crc32_update(u32 crc, const void *buf, u32 size)
+{
+	if (!crc_table_ready)
+		Crc32_init();
+	return Crc32_run(crc ^ 0xFFFFFFFF, buf, size) ^ 0xFFFFFFFF;
+}
+// --------------------------------------------------------------------
+u32 crc32(unsigned char *buf, u32 size)
+{
+	return Crc32_update(0, buf, size);
+}
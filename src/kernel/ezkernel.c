@@ -17,9 +17,24 @@
 #include "driver/sd_card.h"
 #include "save_mode.h"
 #include "driver/rtc.h"
+#include "rtc_cache.h"
+#include "loader.h"
+#include "scratch.h"
+#include "overlay.h"
+#include "waitstate.h"
+#include "provision.h"
+#include "saver.h"
+#include "finder.h"
+#include "library.h"
 #include "driver/nor_flash.h"
 #include "patch/gba_patch.h"
 #include "gfx/show_cht.h"
+#include "gfx/progress.h"
+#include "gfx/rows.h"
+#include "gfx/marquee.h"
+#include "gfx/back.h"
+#include "gfx/glyph.h"
+#include "bgm.h"
 
 #include "images/splash.h"
 
@@ -76,7 +91,7 @@
 #include "emulator/goomba.h"
 #include "emulator/pocketnes.h"
 
-extern void IWRAM_CODE PatchInternal(u32* Data,int iSize,u32 offset);
+extern void PatchInternal(u32* Data,int iSize,u32 offset);
 extern void Patch_SpecialROM_sleepmode(void);
 extern void IWRAM_CODE SD_Disable(void);
 extern void IWRAM_CODE Set_RTC_status(u16  status);
@@ -90,6 +105,8 @@ u8 in_recently_play;
 FM_FILE_FS pFilename_buffer[MAX_files]EWRAM_BSS;
 FM_NOR_FS pNorFS[MAX_NOR]EWRAM_BSS;
 FM_Folder_FS pFolder[MAX_folder]EWRAM_BSS;
+static TCHAR name_pool[MAX_name_pool]EWRAM_BSS;
+static u32 name_pool_used;
 
 FM_FILE_FS pFilename_temp;
 
@@ -97,8 +114,11 @@ u32 FAT_table_buffer[FAT_table_size / 4]EWRAM_BSS;
 u8 pReadCache[MAX_pReadCache_size]EWRAM_BSS;
 
 u8 p_recently_play[10][512]EWRAM_BSS;
+#define PLAY_LIBRARY 0xAA	//play_re: path in p_library_play
+u8 p_library_play[MAX_path_len]EWRAM_BSS;//path picked in a library view
+LIB_ENTRY p_library_page[10]EWRAM_BSS;
 TCHAR currentpath_temp[MAX_path_len];
-TCHAR current_filename[200];
+TCHAR current_filename[MAX_name_len];
 
 TCHAR plugin[100];
 
@@ -121,6 +141,8 @@ u16 gl_show_Thumbnail;
 u16 gl_toggle_reset;
 u16 gl_toggle_backup;
 u16 gl_toggle_bold;
+u16 gl_toggle_verify;
+u16 gl_toggle_shard;
 u16 gl_ingame_RTC_open_status;
 
 
@@ -130,7 +152,6 @@ FATFS EZcardFs;
 FILINFO fileinfo;
 DIR dir;
 FIL gfile;
-u8 dwName;
 
 u16 gl_reset_on;
 u16 gl_rts_on;
@@ -220,6 +241,170 @@ void Get_file_size(u32 num, char* str)
 	}
 }
 //---------------------------------------------------------------------------------
+//name of a list line: an object row with LIST_ROWS, the bitmap otherwise
+void Show_list_name(u32 line, TCHAR* name, u32 char_num)
+{
+#ifdef LIST_ROWS
+	Rows_set(line, name, char_num);
+#else
+	DrawName12(name, char_num, 3 + 16, 20 + line * 14, gl_color_text, 1);
+#endif
+}
+//---------------------------------------------------------------------------------
+u16* Get_file_icon(TCHAR* pfilename)
+{
+	u32 strlen8 = strlen(pfilename);
+	u16* icon;
+	if (!strcasecmp(&(pfilename[strlen8 - 3]), "gba")) { //GBA
+		icon = (u16*)(gImage_icons + 1 * 16 * 14 * 2);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bin")) { //.bin file
+		icon = (u16*)(gImage_icon_EXE);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "mb")) { //PogoShell Plugin/Multiboot image
+		icon = (u16*)(gImage_icon_EXE);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mbz")) { //Compressed PogoShell Plugin
+		icon = (u16*)(gImage_icon_EXE);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 4]), "mbap")) { //Compressed PogoShell Plugin
+		icon = (u16*)(gImage_icon_EXE);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "agb")) { //GBA
+		icon = (u16*)(gImage_icons + 1 * 16 * 14 * 2);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "gbc")) { //GBC
+		icon = (u16*)(gImage_icon_GBC);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "gb")) { //GB
+		icon = (u16*)(gImage_icon_GB);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "nes")) { //NES
+		icon = (u16*)(gImage_icon_FC);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "sms")) { //Master System
+		icon = (u16*)(gImage_icon_SMS);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "gg")) { //Game Gear
+		icon = (u16*)(gImage_icon_GG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sg")) { //SG-1000
+		icon = (u16*)(gImage_icon_SG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "ngp")) { //Neo Geo Pocket
+		icon = (u16*)(gImage_icon_NG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 4]), "ngpc")) { //Neo Geo Pocket Color
+		icon = (u16*)(gImage_icon_NG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "jpg")) { //JPEG Image
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 4]), "jpeg")) { //JPEG Image
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bmp")) { //BMP Image
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "txt")) { //Text Document
+		icon = (u16*)(gImage_icon_TXT);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "esv")) { //Fixes the bug with esv files looking like watara supervision
+		icon = (u16*)(gImage_icons + 2 * 16 * 14 * 2);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sv")) { //Watara Supervision
+		icon = (u16*)(gImage_icon_SV);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "ws")) { //Wonderswan
+		icon = (u16*)(gImage_icon_WS);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "wsc")) { //Wonderswan Color
+		icon = (u16*)(gImage_icon_WS);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "col")) { //ColecoVision
+		icon = (u16*)(gImage_icon_CV);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "rom")) { //MSX-1
+		icon = (u16*)(gImage_icon_MSX);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "pce")) { //PC-Engine
+		icon = (u16*)(gImage_icon_PCE);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "z80")) { //Sinclair ZX-Spectrum (Z80)
+		icon = (u16*)(gImage_icon_ZX);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "o2")) { //Magnavox Odyssey2 (No emu yet, but I'm eventually going to have a finished one. :D)
+		icon = (u16*)(gImage_icon_o2);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "c8")) { //Chip-8
+		icon = (u16*)(gImage_icon_chip);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "ch8")) { //Chip-8
+		icon = (u16*)(gImage_icon_chip);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "min")) { //Pokemon Mini (No Emu yet)
+		icon = (u16*)(gImage_icon_pokem);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "dci")) { //Visual Memory Unit (No Emu yet, but I will make one at some point)
+		icon = (u16*)(gImage_icon_vmu);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "vmi")) { //Visual Memory Unit (No Emu yet, but I will make one at some point)
+		icon = (u16*)(gImage_icon_vmu);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mid")) { //MIDI Sequence
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "wav")) { //Wave Sound
+		icon = (u16*)(gImage_icon_wav);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "nsf")) { //NSF sound file
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "k3m")) { //Krawall Advance Module
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mod")) { //Protracker mod file
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "pcx")) { //ZSoft Paintbrush PCX image
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "vgm")) { //SMS/GG VGM Rip
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "cwz")) { //Unknown Music file, contained in a package for PogoShell 1.2
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sb")) { //MaxMod SoundBank
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "ap")) { //aPlib compressed Mode 3 Bitmap
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "lz")) { //LZ77 Compressed Mode 3 Bitmap
+		icon = (u16*)(gImage_icon_IMG);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bgf")) { //BoyScout module
+		icon = (u16*)(gImage_icon_mod);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "arc")) { //4kb Arcadia 2001 ROM File
+		icon = (u16*)(gImage_icon_arc);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "a26")) { //Atari 2600 ROM file (emu indev)
+		icon = (u16*)(gImage_icon_a26);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sc")) { //Sega SC-3000 ROM File
+		icon = (u16*)(gImage_icon_SC3000);
+	}
+	else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mda")) { //Sharp X68000 music
+		icon = (u16*)(gImage_icon_wav);
+	}
+	else {
+		icon = (u16*)(gImage_icons + 2 * 16 * 14 * 2);
+	}
+	return icon;
+}
+//---------------------------------------------------------------------------------
 void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 {
 	u32 need_show_game;
@@ -264,7 +449,7 @@ void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 			1,
 			0x0000,
 			1);
-		DrawHZText12(pFolder[show_offset + line].filename, char_num, 3 + 16, y_offset + line * 14, name_color, 1);
+		Show_list_name(line, pFolder[show_offset + line].filename, char_num);
 		if ((haveThumbnail == 1) && (line > 3))
 		{
 		}
@@ -275,7 +460,6 @@ void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 		}
 	}
 	u32 offset = 0;
-	u32 strlen8;
 	TCHAR* pfilename;
 	if (show_offset >= folder_total) {
 		offset = show_offset - folder_total;
@@ -297,155 +481,7 @@ void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 		}
 		u32 showy = y_offset + (line) * 14;
 		pfilename = pFilename_buffer[offset + line - need_show_folder].filename;
-		strlen8 = strlen(pfilename);
-		u16* icon;
-		if (!strcasecmp(&(pfilename[strlen8 - 3]), "gba")) { //GBA
-			icon = (u16*)(gImage_icons + 1 * 16 * 14 * 2);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bin")) { //.bin file
-			icon = (u16*)(gImage_icon_EXE);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "mb")) { //PogoShell Plugin/Multiboot image
-			icon = (u16*)(gImage_icon_EXE);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mbz")) { //Compressed PogoShell Plugin
-			icon = (u16*)(gImage_icon_EXE);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 4]), "mbap")) { //Compressed PogoShell Plugin
-			icon = (u16*)(gImage_icon_EXE);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "agb")) { //GBA
-			icon = (u16*)(gImage_icons + 1 * 16 * 14 * 2);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "gbc")) { //GBC
-			icon = (u16*)(gImage_icon_GBC);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "gb")) { //GB
-			icon = (u16*)(gImage_icon_GB);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "nes")) { //NES
-			icon = (u16*)(gImage_icon_FC);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "sms")) { //Master System
-			icon = (u16*)(gImage_icon_SMS);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "gg")) { //Game Gear
-			icon = (u16*)(gImage_icon_GG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sg")) { //SG-1000
-			icon = (u16*)(gImage_icon_SG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "ngp")) { //Neo Geo Pocket
-			icon = (u16*)(gImage_icon_NG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 4]), "ngpc")) { //Neo Geo Pocket Color
-			icon = (u16*)(gImage_icon_NG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "jpg")) { //JPEG Image
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 4]), "jpeg")) { //JPEG Image
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bmp")) { //BMP Image
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "txt")) { //Text Document
-			icon = (u16*)(gImage_icon_TXT);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "esv")) { //Fixes the bug with esv files looking like watara supervision
-			icon = (u16*)(gImage_icons + 2 * 16 * 14 * 2);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sv")) { //Watara Supervision
-			icon = (u16*)(gImage_icon_SV);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "ws")) { //Wonderswan
-			icon = (u16*)(gImage_icon_WS);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "wsc")) { //Wonderswan Color
-			icon = (u16*)(gImage_icon_WS);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "col")) { //ColecoVision
-			icon = (u16*)(gImage_icon_CV);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "rom")) { //MSX-1
-			icon = (u16*)(gImage_icon_MSX);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "pce")) { //PC-Engine
-			icon = (u16*)(gImage_icon_PCE);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "z80")) { //Sinclair ZX-Spectrum (Z80)
-			icon = (u16*)(gImage_icon_ZX);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "o2")) { //Magnavox Odyssey2 (No emu yet, but I'm eventually going to have a finished one. :D)
-			icon = (u16*)(gImage_icon_o2);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "c8")) { //Chip-8
-			icon = (u16*)(gImage_icon_chip);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "ch8")) { //Chip-8
-			icon = (u16*)(gImage_icon_chip);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "min")) { //Pokemon Mini (No Emu yet)
-			icon = (u16*)(gImage_icon_pokem);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "dci")) { //Visual Memory Unit (No Emu yet, but I will make one at some point)
-			icon = (u16*)(gImage_icon_vmu);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "vmi")) { //Visual Memory Unit (No Emu yet, but I will make one at some point)
-			icon = (u16*)(gImage_icon_vmu);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mid")) { //MIDI Sequence
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "wav")) { //Wave Sound
-			icon = (u16*)(gImage_icon_wav);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "nsf")) { //NSF sound file
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "k3m")) { //Krawall Advance Module
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mod")) { //Protracker mod file
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "pcx")) { //ZSoft Paintbrush PCX image
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "vgm")) { //SMS/GG VGM Rip
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "cwz")) { //Unknown Music file, contained in a package for PogoShell 1.2
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sb")) { //MaxMod SoundBank
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "ap")) { //aPlib compressed Mode 3 Bitmap
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "lz")) { //LZ77 Compressed Mode 3 Bitmap
-			icon = (u16*)(gImage_icon_IMG);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "bgf")) { //BoyScout module
-			icon = (u16*)(gImage_icon_mod);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "arc")) { //4kb Arcadia 2001 ROM File
-			icon = (u16*)(gImage_icon_arc);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "a26")) { //Atari 2600 ROM file (emu indev)
-			icon = (u16*)(gImage_icon_a26);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 2]), "sc")) { //Sega SC-3000 ROM File
-			icon = (u16*)(gImage_icon_SC3000);
-		}
-		else if (!strcasecmp(&(pfilename[strlen8 - 3]), "mda")) { //Sharp X68000 music
-			icon = (u16*)(gImage_icon_wav);
-		}
-		else {
-			icon = (u16*)(gImage_icons + 2 * 16 * 14 * 2);
-		}
+		u16* icon = Get_file_icon(pfilename);
 		DrawPic(icon,
 			1,
 			showy,
@@ -454,7 +490,7 @@ void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 			1,
 			0x0000,
 			1);
-		DrawHZText12(pFilename_buffer[offset + line - need_show_folder].filename, char_num, 3 + 16, showy, name_color, 1);
+		Show_list_name(line, pFilename_buffer[offset + line - need_show_folder].filename, char_num);
 		if ((haveThumbnail == 1) && (line > 3))
 		{
 		}
@@ -464,6 +500,12 @@ void Show_ICON_filename(u32 show_offset, u32 file_select, u32 haveThumbnail)
 			DrawHZText12(msg, 0, 209, showy, name_color, 1);
 		}
 	}
+#ifdef LIST_ROWS
+	for (line = need_show_folder + need_show_game; line < 10; line++) {
+		Rows_set(line, "", 0);
+	}
+	Rows_show(1);
+#endif
 }
 //---------------------------------------------------------------------------------
 void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u32 haveThumbnail)
@@ -586,8 +628,8 @@ void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u
 		ClearWithBG((u16*)gImage_SD,17, 20 + xx2*14,clean_len2, 13, 1);	
 	}
 	if ((file_select == (need_show_folder - 1)) && (updown == 3)) {
-		DrawHZText12(pFolder[show_offset + xx1].filename, char_num1, 3 + 16, showy1, name_color1, 1);
-		DrawHZText12(pFilename_buffer[0].filename, char_num2, 3 + 16, showy2, name_color1, 1);
+		Show_list_name(xx1, pFolder[show_offset + xx1].filename, char_num1);
+		Show_list_name(xx2, pFilename_buffer[0].filename, char_num2);
 		if (char_num1 == 32) {
 			sprintf(msg, "%s", "");
 			DrawHZText12(msg, 0, 221, showy1, name_color1, 1);
@@ -598,8 +640,8 @@ void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u
 		}
 	}
 	else if (file_select < need_show_folder) {
-		DrawHZText12(pFolder[show_offset + xx1].filename, char_num1, 3 + 16, showy1, name_color1, 1);
-		DrawHZText12(pFolder[show_offset + xx2].filename, char_num2, 3 + 16, showy2, name_color1, 1);
+		Show_list_name(xx1, pFolder[show_offset + xx1].filename, char_num1);
+		Show_list_name(xx2, pFolder[show_offset + xx2].filename, char_num2);
 		sprintf(msg, "%s", "");
 		if (char_num1 == 32) {
 			DrawHZText12(msg, 0, 221, showy1, name_color1, 1);
@@ -609,8 +651,8 @@ void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u
 		}
 	}
 	else if ((file_select == need_show_folder) && (updown == 2)) {
-		DrawHZText12(pFolder[show_offset + xx1].filename, char_num1, 3 + 16, showy1, name_color1, 1);
-		DrawHZText12(pFilename_buffer[0].filename, char_num2, 3 + 16, showy2, name_color1, 1);
+		Show_list_name(xx1, pFolder[show_offset + xx1].filename, char_num1);
+		Show_list_name(xx2, pFilename_buffer[0].filename, char_num2);
 		if (char_num1 == 32) {
 			sprintf(msg, "%s", "");
 			DrawHZText12(msg, 0, 221, showy1, name_color1, 1);
@@ -621,8 +663,8 @@ void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u
 		}
 	}
 	else {
-		DrawHZText12(pFilename_buffer[offset + xx1 - need_show_folder].filename, char_num1, 3 + 16, showy1, name_color1, 1);
-		DrawHZText12(pFilename_buffer[offset + xx2 - need_show_folder].filename, char_num2, 3 + 16, showy2, name_color1, 1);
+		Show_list_name(xx1, pFilename_buffer[offset + xx1 - need_show_folder].filename, char_num1);
+		Show_list_name(xx2, pFilename_buffer[offset + xx2 - need_show_folder].filename, char_num2);
 		if (char_num1 == 32) {
 			Get_file_size(offset + xx1 - need_show_folder, msg);
 			DrawHZText12(msg, 0, 209, showy1, name_color1, 1);
@@ -633,6 +675,46 @@ void IWRAM_CODE Refresh_filename(u32 show_offset, u32 file_select, u32 updown, u
 		}
 	}
 }
+#ifdef LIST_ROWS
+//---------------------------------------------------------------------------------
+//one line scroll of the SD list: the rows move and only the line coming in
+//is rendered, icons and sizes are bitmap art and drawn again in place
+void Scroll_filename(u32 show_offset, u32 file_select, int dir)
+{
+	u32 line;
+	u32 pos;
+	u32 showy;
+	char msg[20];
+	TCHAR* name;
+
+	pos = show_offset + ((dir > 0) ? 9 : 0);
+	name = (pos < folder_total) ? pFolder[pos].filename : pFilename_buffer[pos - folder_total].filename;
+	Rows_scroll(dir, name, 32);
+	line = (dir > 0) ? 8 : 1;//was selected, may be mid marquee
+	pos = show_offset + line;
+	name = (pos < folder_total) ? pFolder[pos].filename : pFilename_buffer[pos - folder_total].filename;
+	Show_list_name(line, name, 32);
+	for (line = 0; (line < 10) && (show_offset + line < folder_total + game_total_SD); line++) {
+		pos = show_offset + line;
+		showy = 20 + line * 14;
+		ClearWithBG((u16*)gImage_SD, 0, showy, 18, 14, 1);
+		if (line == file_select) { //whole bar, the marquee strip may be in it
+			Clear(18, showy, 240 - 17, 13, gl_color_selectBG_sd, 1);
+		}
+		else {
+			ClearWithBG((u16*)gImage_SD, 209, showy, 240 - 209, 13, 1);
+		}
+		if (pos < folder_total) {
+			DrawPic((u16*)(gImage_icons + 0 * 16 * 14 * 2), 2, showy, 16, 14, 1, 0x0000, 1);
+		}
+		else {
+			DrawPic(Get_file_icon(pFilename_buffer[pos - folder_total].filename), 1, showy, 16, 14, 1, 0x0000, 1);
+			Get_file_size(pos - folder_total, msg);
+			DrawHZText12(msg, 0, 209, showy, gl_color_text, 1);
+		}
+	}
+}
+#endif
 //---------------------------------------------------------------------------------
 void Show_ICON_filename_NOR(u32 show_offset, u32 file_select)
 {
@@ -660,7 +742,7 @@ void Show_ICON_filename_NOR(u32 show_offset, u32 file_select)
 			1,
 			0x0000,
 			1);
-		DrawHZText12(pNorFS[show_offset + line].filename, char_num, 3 + 16, y_offset + line * 14, name_color, 1);
+		DrawName12(pNorFS[show_offset + line].filename, char_num, 3 + 16, y_offset + line * 14, name_color, 1);
 		sprintf(msg, "%4luM", pNorFS[show_offset + line].filesize >> 20);
 		DrawHZText12(msg, 0, 209, y_offset + line * 14, name_color, 1);
 	}
@@ -702,8 +784,8 @@ void Refresh_filename_NOR(u32 show_offset, u32 file_select, u32 updown)
 		ClearWithBG((u16*)gImage_NOR,17, 20 + xx2*14,clean_len, 13, 1);
 	}
 
-	DrawHZText12(pNorFS[show_offset + xx1].filename, char_num, 3 + 16, showy1, name_color1, 1);
-	DrawHZText12(pNorFS[show_offset + xx2].filename, char_num, 3 + 16, showy2, name_color1, 1);
+	DrawName12(pNorFS[show_offset + xx1].filename, char_num, 3 + 16, showy1, name_color1, 1);
+	DrawName12(pNorFS[show_offset + xx2].filename, char_num, 3 + 16, showy2, name_color1, 1);
 
 	sprintf(msg, "%4luM", (pNorFS[show_offset + xx1].filesize) >> 20);
 	DrawHZText12(msg, 0, 208, showy1, name_color1, 1);
@@ -733,15 +815,12 @@ void Show_game_num(u32 count, u32 list)
 void Filename_loop(u32 shift, u32 show_offset, u32 file_select, u32 haveThumbnail)
 {
 	u32 need_show_folder;
-	//u32 line;
 	u32 char_num;
-	u32 y_offset = 20;
 	int namelen;
-	static u32 orgtt = 123455;
+	static u32 org_step = 0xFFFFFFFF;
+	static u32 period;
 	u32 timeout = 20;
-	//u8 dwName=0;
-	u8 msg[128];
-	u8 temp_filename[100];
+	TCHAR* pfilename;
 	if (shift > timeout) {
 		if (show_offset >= folder_total) {
 			need_show_folder = 0;
@@ -768,32 +847,25 @@ void Filename_loop(u32 shift, u32 show_offset, u32 file_select, u32 haveThumbnai
 			offset = show_offset - folder_total;
 		}
 		if (file_select < need_show_folder) {
-			strncpy(temp_filename, pFolder[show_offset + file_select].filename, 100);
+			pfilename = pFolder[show_offset + file_select].filename;
 		}
 		else {
-			strncpy(temp_filename, pFilename_buffer[offset + file_select - need_show_folder].filename, 100);
+			pfilename = pFilename_buffer[offset + file_select - need_show_folder].filename;
 		}
-		namelen = strlen(temp_filename);
+		namelen = Glyph_columns(pfilename);
 		if (namelen > (char_num - 1)) {
-			u32  tt = ((shift - timeout) / 8) % (namelen);
-			if (orgtt != tt) {
-				orgtt = tt;
-				sprintf(msg, "%s   ", temp_filename + tt);
-				strncpy(msg + strlen(msg), temp_filename, 128 - strlen(msg));
-				if (temp_filename[tt] > 0x80) {
-					if (dwName) {
-						msg[0] = 0x20;
-						dwName = 0;
-					}
-					else {
-						dwName = 1;
-					}
-				}
-				else {
-					dwName = 0;
-				}
+			if (shift == timeout + 1) { //new selection: draw the strip once
+				period = Marquee_set(pfilename, gl_color_selectBG_sd, gl_color_text);
+				org_step = 0xFFFFFFFF;
 				Clear(18, 20 + file_select * 14, ((char_num) * 6), 13, gl_color_selectBG_sd, 1);
-				DrawHZText12(msg, char_num - 1, 3 + 16, y_offset + file_select * 14, gl_color_text, 1);
+#ifdef LIST_ROWS
+				Rows_set(file_select, "", 0);//the strip is in the bitmap below it
+#endif
+			}
+			u32 step = ((shift - timeout) * 3 / 4) % period;//a character per 8 passes, as before
+			if (org_step != step) {
+				org_step = step;
+				Marquee_show(step, 3 + 16, 20 + file_select * 14, (char_num - 1) * 6);
 			}
 		}
 	}
@@ -883,7 +955,7 @@ void Show_Extra_Menu(u32 menu_select)
 	u16 name_color;
 	char msg[30];
 	u32 linemax;
-	linemax = 4;
+	linemax = 6;
 	for (line = 0; line < linemax; line++) {
 		if (line == menu_select) {
 			name_color = gl_color_selected;
@@ -920,7 +992,7 @@ void Show_game_name(u32 total, u32 Select)
 			name_color = gl_color_text;
 		}
 		sprintf(msg, "%s", &(p_recently_play[line]));
-		DrawHZText12(msg, 39, X_offset, Y_offset + line * line_x, name_color, 1);
+		DrawName12(msg, 39, X_offset, Y_offset + line * line_x, name_color, 1);
 	}
 }
 //---------------------------------------------------------------------------------
@@ -952,6 +1024,126 @@ u32  get_count(void)
 	return count;
 }
 //---------------------------------------------------------------------------------
+void Show_library_line(u32 line, u16 name_color)
+{
+	DrawName12(p_library_page[line].name, 39, 1, 20 + line * 14, name_color, 1);
+}
+//---------------------------------------------------------------------------------
+void Show_library_page(u32 view, u32 total, u32 offset, u32 Select)
+{
+	char msg[64];
+	u32 line;
+#ifdef DARK
+	u16 rcolor = 0x7F00;
+#else
+	u16 rcolor = 0x7C00;
+#endif
+	DrawPic((u16*)gImage_RECENTLY, 0, 0, 240, 160, 0, 0, 1);
+	sprintf(msg, "%s [%lu]", gl_library_view[view], total);
+	DrawHZText12(msg, 0, (240 - strlen(msg) * 6) / 2, 4, rcolor, 1);//TITLE
+	if (total == 0) {
+		DrawHZText12(gl_library_empty, 0, 3, 22, gl_color_text, 1);
+		return;
+	}
+	for (line = 0; (line < 10) && (offset + line < total); line++) {
+		if (!Library_get(view, offset + line, &p_library_page[line])) {
+			p_library_page[line].name[0] = 0;
+		}
+		Show_library_line(line, (line == Select) ? gl_color_selected : gl_color_text);
+	}
+}
+//---------------------------------------------------------------------------------
+//R on the recently played list: L/R change the view, 0xAA with the pick in path
+u32 show_library(u8* path)
+{
+	u32 view = 0;
+	u32 total = 0;
+	u32 offset = 0;
+	u32 Select = 0;
+	u32 old_Select;
+	u32 re_show = 1;
+	setRepeat(15, 1);
+	while (1) {
+		if (re_show) {
+			total = Library_count(view);
+			Show_library_page(view, total, offset, Select);
+			re_show = 0;
+		}
+		VBlankIntrWait();
+		scanKeys();
+		u16 keysdown = keysDown();
+		u16 keysrepeat = keysDownRepeat();
+		u16 keysup = keysUp();
+		old_Select = Select;
+		if (keysrepeat & KEY_DOWN) {
+			if (offset + Select + 1 < total) {
+				if (Select < 9) {
+					Select++;
+				}
+				else {
+					offset++;
+					re_show = 1;
+				}
+			}
+		}
+		else if (keysrepeat & KEY_UP) {
+			if (Select) {
+				Select--;
+			}
+			else if (offset) {
+				offset--;
+				re_show = 1;
+			}
+		}
+		else if (keysrepeat & KEY_RIGHT) {
+			if (offset + 10 < total) {
+				offset += 10;
+				if (offset + Select >= total) {
+					Select = total - 1 - offset;
+				}
+				re_show = 1;
+			}
+		}
+		else if (keysrepeat & KEY_LEFT) {
+			if (offset) {
+				offset = (offset > 10) ? offset - 10 : 0;
+				re_show = 1;
+			}
+			else {
+				Select = 0;
+			}
+		}
+		else if (keysdown & (KEY_L | KEY_R)) {
+			if ((keysdown & KEY_R) && (view + 1 < LIB_VIEWS)) {
+				view++;
+			}
+			else if ((keysdown & KEY_L) && view) {
+				view--;
+			}
+			else {
+				continue;
+			}
+			offset = 0;
+			Select = 0;
+			re_show = 1;
+		}
+		else if (keysup & KEY_B) {
+			Library_close();
+			return 0xBB;
+		}
+		else if (keysup & KEY_A) {
+			if (total && Library_path(&p_library_page[Select], path, MAX_path_len)) {
+				Library_close();
+				return PLAY_LIBRARY;
+			}
+		}
+		if (!re_show && (Select != old_Select)) {
+			Show_library_line(old_Select, gl_color_text);
+			Show_library_line(Select, gl_color_selected);
+		}
+	}
+}
+//---------------------------------------------------------------------------------
 u32 show_recently_play(void)
 {
 	in_recently_play = 1;
@@ -966,11 +1158,13 @@ u32 show_recently_play(void)
 #else
 	u16 rcolor = 0x7C00;
 #endif
+re_list:
 	DrawPic((u16*)gImage_RECENTLY, 0, 0, 240, 160, 0, 0, 1);
 	DrawHZText12(gl_recently_play,0,(240-strlen(gl_recently_play)*6)/2,4, rcolor,1);//TITLE
 	all_count = get_count();
 	if (all_count) {
 		setRepeat(15, 1);
+		re_show = 1;
 		while (1) {
 			VBlankIntrWait();
 			VBlankIntrWait();
@@ -979,6 +1173,7 @@ u32 show_recently_play(void)
 				re_show = 0;
 			}
 			scanKeys();
+			u16 keysdown = keysDown();
 			u16 keysrepeat = keysDownRepeat();
 			u16 keysup = keysUp();
 			if (keysrepeat & KEY_DOWN) {
@@ -1002,6 +1197,13 @@ u32 show_recently_play(void)
 				return_val = Select;
 				break;
 			}
+			else if (keysdown & KEY_R) { //library views
+				return_val = show_library(p_library_play);
+				if (return_val == PLAY_LIBRARY) {
+					break;
+				}
+				goto re_list;
+			}
 		}
 	}
 	else {
@@ -1009,11 +1211,19 @@ u32 show_recently_play(void)
 		while (1) {
 			VBlankIntrWait();
 			scanKeys();
+			u16 keysdown = keysDown();
 			u16 keysup = keysUp();
 			if (keysup & KEY_B) {
 				return_val = 0xBB;
 				break;
 			}
+			else if (keysdown & KEY_R) {
+				return_val = show_library(p_library_play);
+				if (return_val == PLAY_LIBRARY) {
+					break;
+				}
+				goto re_list;
+			}
 		}
 	}
 	return return_val;
@@ -1151,20 +1361,26 @@ u32 IWRAM_CODE Loadsavefile(TCHAR* filename)
 		if (filesize > 128 * 1024) {
 			filesize = 128 * 1024;
 		}
+		u8 *buffer = Scratch_alloc(64 * 1024, "save");
+		if (buffer == NULL) {
+			f_close(&file);
+			return false;
+		}
 		SetRampage(0x0);
 		if (filesize > 64 * 1024) {
-			f_read(&file, pReadCache, 64 * 1024, (UINT*)&ret);
-			WriteSram(SRAMSaver, pReadCache, 64 * 1024);
+			f_read(&file, buffer, 64 * 1024, (UINT*)&ret);
+			WriteSram(SRAMSaver, buffer, 64 * 1024);
 			SetRampage(0x10);
 			left = filesize - 64 * 1024;
-			f_read(&file, pReadCache, left, (UINT*)&ret);
-			WriteSram(SRAMSaver, pReadCache, left);
+			f_read(&file, buffer, left, (UINT*)&ret);
+			WriteSram(SRAMSaver, buffer, left);
 		}
 		else {
-			f_read(&file, pReadCache, filesize, (UINT*)&ret);
-			WriteSram(SRAMSaver, pReadCache, filesize);
+			f_read(&file, buffer, filesize, (UINT*)&ret);
+			WriteSram(SRAMSaver, buffer, filesize);
 		}
 		f_close(&file);
+		Scratch_release(buffer);
 		SetRampage(0x0);
 		return 1;
 	}
@@ -1185,12 +1401,18 @@ u32 IWRAM_CODE LoadRTSfile(TCHAR* filename)
 		if (filesize > 0x70000) {
 			filesize = 0x70000;
 		}
+		u8 *buffer = Scratch_alloc(64 * 1024, "rts");
+		if (buffer == NULL) {
+			f_close(&file);
+			return false;
+		}
 		for (page = 0x40; page < 0xB0; page += 0x10) {
 			SetRampage(page);
-			f_read(&file, pReadCache, 64 * 1024, (UINT*)&ret);
-			WriteSram(SRAMSaver, pReadCache, 64 * 1024);
+			f_read(&file, buffer, 64 * 1024, (UINT*)&ret);
+			WriteSram(SRAMSaver, buffer, 64 * 1024);
 		}
 		f_close(&file);
+		Scratch_release(buffer);
 		SetRampage(0x0);
 		return 1;
 	}
@@ -1210,10 +1432,16 @@ u32 SavefileWrite(TCHAR* filename, u32 savesize)
 	case FR_OK: {
 		int i;
 		unsigned int written;
-		memset(pReadCache, 0xFF, 0x200 * 4);
+		u8 *blank = Scratch_alloc(0x200 * 4, "blank save");
+		if (blank == NULL) {
+			f_close(&file);
+			f_unlink(filename);//an empty save would pass as an old one
+			return 2;
+		}
+		memset(blank, 0xFF, 0x200 * 4);
 		if (savesize < 0x800) {
 			for (i = 0; i < (savesize + 0x1FF) / 0x200; i++) {
-				f_write(&file, pReadCache, 0x200, &written);
+				f_write(&file, blank, 0x200, &written);
 				if (written != 0x200) {
 					break;
 				}
@@ -1221,13 +1449,14 @@ u32 SavefileWrite(TCHAR* filename, u32 savesize)
 		}
 		else {
 			for (i = 0; i < (savesize + 0x1FF) / 0x800; i++) {
-				f_write(&file, pReadCache, 0x200 * 4, &written);
+				f_write(&file, blank, 0x200 * 4, &written);
 				if (written != 0x200 * 4) {
 					break;
 				}
 			}
 		}
 		f_close(&file);
+		Scratch_release(blank);
 		return 1;
 	}
 			  break;
@@ -1240,56 +1469,58 @@ u8 Check_saveMODE(u8 gamecode[])
 {
 	u32 i;
 	BYTE savemode = 0x10;
-	dmaCopy((void*)saveMODE_table, (void*)pReadCache, sizeof(saveMODE_table));
+	SAVE_MODE_ *table = Scratch_alloc(sizeof(saveMODE_table), "save mode table");
+	if (table == NULL) {
+		return SAVE_MODE_NO_MEMORY;
+	}
+	dmaCopy((void*)saveMODE_table, (void*)table, sizeof(saveMODE_table));
 	for (i = 0; i < 3000; i++) {
-		if (memcmp(((SAVE_MODE_*)pReadCache)[i].gamecode, "FFFF", 4) == 0) {
+		if (memcmp(table[i].gamecode, "FFFF", 4) == 0) {
 			break;
 		}
-		else if (memcmp(((SAVE_MODE_*)pReadCache)[i].gamecode, gamecode, 4) == 0) {
-			savemode = ((SAVE_MODE_*)pReadCache)[i].savemode;
+		else if (memcmp(table[i].gamecode, gamecode, 4) == 0) {
+			savemode = table[i].savemode;
 			break;
 		}
 	}
+	Scratch_release(table);
 	return savemode;
 }
 //---------------------------------------------------------------
 u32 IWRAM_CODE Loadfile2PSRAM(TCHAR* filename)
 {
-	u8 str_len;
-	UINT  ret;
-	u32 filesize;
 	u32 res;
-	u32 blocknum;
-	char msg[20];
-	u32 Address;
-	vu16 page = 0;
-	SetPSRampage(page);
+	LOAD_SOURCE src;
+	LOAD_SINK dst;
+	LOAD_PIPE pipe;
+	SetPSRampage(0);
 	res = f_open(&gfile, filename, FA_READ);
 	if (res == FR_OK) {
-		filesize = f_size(&gfile);
+		Bgm_pause();
 		Clear(0, 160 - 15, 240, 15, gl_color_cheat_black, 1);
 		ShowbootProgress(gl_copying_data);
-		f_lseek(&gfile, 0x0000);
-		for (blocknum = 0x0000; blocknum < filesize; blocknum += 0x20000) {
-			sprintf(msg, "%luMbit", (blocknum) / 0x20000);
-			str_len = strlen(msg);
-			Clear(0, 130, 240, 15, gl_color_cheat_black, 1);
-			DrawHZText12(msg, 0, (240 - str_len * 6) / 2, 160 - 30, 0x7fff, 1);
-			f_read(&gfile, pReadCache, 0x20000, (UINT*)&ret);//pReadCache max 0x20000 Byte
-			if ((gl_reset_on == 1) || (gl_rts_on == 1) || (gl_sleep_on == 1) || (gl_cheat_on == 1)) {
-				PatchInternal((u32*)pReadCache, 0x20000, blocknum);
-			}
-			Address = blocknum;
-			while (Address >= 0x800000) {
-				Address -= 0x800000;
-				page += 0x1000;
-			}
-			SetPSRampage(page);
-			dmaCopy((void*)pReadCache, PSRAMBase_S98 + Address, 0x20000);
-			page = 0;
-		}
+		Load_source_file(&src, &gfile);
+		Load_sink_psram(&dst, 0);
+		Load_pipe_init(&pipe, &src, &dst);
+		if ((gl_reset_on == 1) || (gl_rts_on == 1) || (gl_sleep_on == 1) || (gl_cheat_on == 1)) {
+			Load_pipe_add(&pipe, Load_patch_internal);
+		}
+		pipe.verify = gl_toggle_verify;
+		Progress_start(src.size, 118);
+		res = Load_run(&pipe);
+		Progress_stop();
 		f_close(&gfile);
 		SetPSRampage(0);
+		Bgm_resume();
+		if (res == LOAD_VERIFY_ERROR) {
+			return 2;
+		}
+		if (res == LOAD_MEMORY_ERROR) {
+			return 4;
+		}
+		if (pipe.verify && Load_dat_check(filename, pipe.crc_src)) {
+			return 3;
+		}
 		return 0;
 	}
 	else {
@@ -1351,21 +1582,30 @@ void CheckSwitch(void)
 	if ((gl_toggle_bold != 0x0) && (gl_toggle_bold != 0x1)) {
 		gl_toggle_bold = 0x0;
 	}
+	gl_toggle_verify = Read_SET_info(17);
+	if ((gl_toggle_verify != 0x0) && (gl_toggle_verify != 0x1)) {
+		gl_toggle_verify = 0x0;
+	}
+	gl_toggle_shard = Read_SET_info(18);
+	if ((gl_toggle_shard != 0x0) && (gl_toggle_shard != 0x1)) {
+		gl_toggle_shard = 0x0;
+	}
 	gl_ingame_RTC_open_status = Read_SET_info(13);
 	if ((gl_ingame_RTC_open_status != 0x0) && (gl_ingame_RTC_open_status != 0x1)) {
 		gl_ingame_RTC_open_status = 0x1;
 	}
 }
 //---------------------------------------------------------------------------------
+u8 time_shown_SS = 0xFF;//second on screen, 0xFF after the clock area was repainted
 void ShowTime(u32 page_num, u32 page_mode)
 {
-	u8 datetime[3];
+	u8 datetime[7];
 	char msgtime[50];
 	//get time
-	rtc_enable();
-	rtc_gettime(datetime);
-	rtc_disenable();
-	delay(5);
+	rtc_cache_get(datetime);
+	if((datetime[6] == time_shown_SS) || in_recently_play)
+		return;
+	time_shown_SS = datetime[6];
 	if(page_mode==0x1)
 		//ClearWithBG((u16*)gImage_RECENTLY,80, 3, 80, 13, 1);
 		asm("nop");
@@ -1373,9 +1613,9 @@ void ShowTime(u32 page_num, u32 page_mode)
 		ClearWithBG((u16*)gImage_SD,100, 3, 50, 13, 1);
 	else if (page_num==NOR_list)
 		ClearWithBG((u16*)gImage_NOR,100, 3, 50, 13, 1);
-	u8 HH = UNBCD(datetime[0] & 0x3F);
-	u8 MM = UNBCD(datetime[1] & 0x7F);
-	u8 SS = UNBCD(datetime[2] & 0x7F);
+	u8 HH = UNBCD(datetime[4] & 0x3F);
+	u8 MM = UNBCD(datetime[5] & 0x7F);
+	u8 SS = UNBCD(datetime[6] & 0x7F);
 	if (HH > 23) {
 		HH = 0;
 	}
@@ -1385,16 +1625,14 @@ void ShowTime(u32 page_num, u32 page_mode)
 	if (SS > 59) {
 		SS = 0;
 	}
-	if(!in_recently_play)
-	{
-		sprintf(msgtime, "%02u:%02u:%02u", HH, MM, SS);
-		DrawHZText12(msgtime,0,100,3,gl_color_text,1);
-	}
+	sprintf(msgtime, "%02u:%02u:%02u", HH, MM, SS);
+	DrawHZText12(msgtime,0,100,3,gl_color_text,1);
 }
 
-void IWRAM_CODE make_pogoshell_arguments(TCHAR* cmdname, TCHAR* filename, u32 cmdsize, u32 filesize, u32 Address, u32 offset)
+u32 IWRAM_CODE make_pogoshell_arguments(TCHAR* cmdname, TCHAR* filename, u32 cmdsize, u32 filesize, u32 Address, u32 offset)
 {
 	u32* p, addr;
+	u32* header;
 	char* ptr, * cmdptr, * fileptr;
 	int i = 0;
 
@@ -1469,7 +1707,11 @@ void IWRAM_CODE make_pogoshell_arguments(TCHAR* cmdname, TCHAR* filename, u32 cm
 	// Passed in 32KB aligned
 	offset = offset + 0x08000000 + 8;
 
-	p = (u32*)pReadCache;
+	header = Scratch_alloc(0x58, "pogoshell header");
+	if (header == NULL) {
+		return 1;
+	}
+	p = header;
 
 	// Magic value in ROM address space
 	*p++ = 0xFAB0BABE;
@@ -1486,7 +1728,9 @@ void IWRAM_CODE make_pogoshell_arguments(TCHAR* cmdname, TCHAR* filename, u32 cm
 	*p++ = filesize;
 	*p++ = addr - offset;
 
-	dmaCopy((void*)pReadCache, PSRAMBase_S98 + Address, 0x58);
+	dmaCopy((void*)header, PSRAMBase_S98 + Address, 0x58);
+	Scratch_release(header);
+	return 0;
 }
 
 
@@ -1494,26 +1738,23 @@ void IWRAM_CODE make_pogoshell_arguments(TCHAR* cmdname, TCHAR* filename, u32 cm
 //---------------------------------------------------------------
 u32 IWRAM_CODE LoadEMU2PSRAM(TCHAR* filename, u32 is_EMU)
 {
-	u8 str_len;
-	UINT  ret;
 	u32 filesize;
 	u32 res;
-	u32 blocknum, blockoffset = 0;
-	char msg[20];
 	u32 Address;
 	vu16 page = 0;
+	LOAD_SOURCE src;
+	LOAD_SINK dst;
+	LOAD_PIPE pipe;
 	SetPSRampage(0);
 	u32 rom_start_address = 0;
 	switch (is_EMU) {
 	case 1://gbc
 	case 2://gb
-		dmaCopy((void*)goomba_gba, pReadCache, goomba_gba_size);
-		dmaCopy((void*)pReadCache, PSRAMBase_S98, goomba_gba_size);
+		LZ77UnCompVram((void*)goomba_gba_lz, PSRAMBase_S98);//16bit writes, PSRAM takes no byte stores
 		rom_start_address = goomba_gba_size;
 		break;
 	case 3://nes
-		dmaCopy((void*)pocketnes_gba, pReadCache, pocketnes_gba_size);
-		dmaCopy((void*)pReadCache, PSRAMBase_S98, pocketnes_gba_size);
+		LZ77UnCompVram((void*)pocketnes_gba_lz, PSRAMBase_S98);
 		rom_start_address = pocketnes_gba_size;
 		break;
 	default:
@@ -1521,69 +1762,39 @@ u32 IWRAM_CODE LoadEMU2PSRAM(TCHAR* filename, u32 is_EMU)
 		if (res != FR_OK)
 			return 1;
 
-		filesize = f_size(&gfile);
-
-		f_lseek(&gfile, 0x0000);
 		ShowbootProgress(gl_generating_emu);
-		for (blocknum = 0x0000; blocknum < filesize; blocknum += 0x20000)
-		{
-			sprintf(msg, "%luMb", (blocknum + blockoffset) / 0x20000);
-			str_len = strlen(msg);
-			Clear(0, 130, 240, 15, gl_color_cheat_black, 1);
-			DrawHZText12(msg, 0, (240 - str_len * 6) / 2, 160 - 30, 0x7fff, 1);
-
-			//f_lseek(&gfile, blocknum);
-			if (filesize - blocknum * 0x20000 < 0x20000)
-				memset(pReadCache, 0, 0x20000);
-			f_read(&gfile, pReadCache, 0x20000, (UINT*)&ret);//pReadCache max 0x20000 Byte
-			page = 0;
-
-			Address = blocknum;
-			while (Address >= 0x400000)
-			{
-				Address -= 0x400000;
-				page += 0x800;
-			}
-			SetPSRampage(page);
-			dmaCopy((void*)pReadCache, PSRAMBase_S98 + Address, 0x20000);
-
-		}
+		Load_source_file(&src, &gfile);
+		Load_sink_psram(&dst, 0);
+		Load_pipe_init(&pipe, &src, &dst);
+		Progress_start(src.size, 118);
+		res = Load_run(&pipe);
+		Progress_stop();
 		f_close(&gfile);
 		SetPSRampage(0);
-		blockoffset = blocknum;
+		if (res == LOAD_MEMORY_ERROR)
+			return 2;
 
 		// Guarantee word alignment
-		rom_start_address = (filesize + 3) & ~3;
+		rom_start_address = (src.size + 3) & ~3;
 
 		break;
 	}
 	res = f_open(&gfile, filename, FA_READ);
 	if (res == FR_OK) {
-		filesize = f_size(&gfile);
 		Clear(60, 160 - 15, 120, 15, gl_color_cheat_black, 1);
 		ShowbootProgress(gl_generating_emu);
-		f_lseek(&gfile, 0x0000);
-		u8 str_len;
-		for (blocknum = 0x0000; blocknum < filesize; blocknum += 0x20000) {
-			sprintf(msg, "%luMb", (blocknum + blockoffset) / 0x20000);
-			str_len = strlen(msg);
-			Clear(0, 130, 240, 15, gl_color_cheat_black, 1);
-			DrawHZText12(msg, 0, (240 - str_len * 6) / 2, 160 - 30, 0x7fff, 1);
-			//f_lseek(&gfile, blocknum);
-			if (filesize - blocknum * 0x20000 < 0x20000)
-				memset(pReadCache, 0, 0x20000);
-			f_read(&gfile, pReadCache, 0x20000, (UINT*)&ret);//pReadCache max 0x20000 Byte
-			page = 0;
-			Address = blocknum;
-			while (Address >= 0x400000) {
-				Address -= 0x400000;
-				page += 0x800;
-			}
-			SetPSRampage(page);
-			dmaCopy((void*)pReadCache, PSRAMBase_S98 + rom_start_address + Address, 0x20000);
-			page = 0;
-		}
+		Load_source_file(&src, &gfile);
+		Load_sink_psram(&dst, rom_start_address);
+		Load_pipe_init(&pipe, &src, &dst);
+		Progress_start(src.size, 118);
+		res = Load_run(&pipe);
+		Progress_stop();
 		f_close(&gfile);
+		if (res == LOAD_MEMORY_ERROR) {
+			SetPSRampage(0);
+			return 2;
+		}
+		filesize = src.size;
 		Clear(105, 160 - 30, 110, 15, gl_color_cheat_count, 1);
 
 		if ((is_EMU > 3) && (is_EMU < 9)) {
@@ -1596,7 +1807,11 @@ u32 IWRAM_CODE LoadEMU2PSRAM(TCHAR* filename, u32 is_EMU)
 				page += 0x800;
 			}
 			SetPSRampage(page);
-			make_pogoshell_arguments(plugin + 9, filename, rom_start_address, filesize, Address, offset);
+			res = make_pogoshell_arguments(plugin + 9, filename, rom_start_address, filesize, Address, offset);
+			if (res) {
+				SetPSRampage(0);
+				return 2;
+			}
 		}
 		SetPSRampage(0);
 		//Clear(78+54,160-15,110,15,gl_color_text,1);
@@ -1616,12 +1831,41 @@ void save_set_info_SELECT(void)
 	SET_info_buffer[14] = gl_toggle_reset;
 	SET_info_buffer[15] = gl_toggle_backup;
 	SET_info_buffer[16] = gl_toggle_bold;
+	SET_info_buffer[17] = gl_toggle_verify;
+	SET_info_buffer[18] = gl_toggle_shard;
 	//save to nor
 	Save_SET_info(SET_info_buffer, 0x200);
 }
 //---------------------------------------------------------------------------------
+//copy of a directory entry name in the name pool, NULL once it is full
+static TCHAR* Name_keep(const TCHAR* name)
+{
+	u32 len = strlen(name) + 1;
+	TCHAR* p;
+	if (name_pool_used + len > MAX_name_pool) {
+		return NULL;
+	}
+	p = &name_pool[name_pool_used];
+	memcpy(p, name, len);
+	name_pool_used += len;
+	return p;
+}
+//---------------------------------------------------------------------------------
+//NOR info written before names were UTF-8 holds GBK names: convert them
+//once and save the NOR info again, the save names are made from them
+void Upgrade_NOR_names(void)
+{
+	u32 i, changed = 0;
+	for (i = 0; i < game_total_NOR; i++) {
+		changed |= Glyph_from_gbk((char*)pNorFS[i].filename, sizeof(pNorFS[i].filename));
+	}
+	if (changed) {
+		Save_NOR_info((u16*)pNorFS, sizeof(FM_NOR_FS) * MAX_NOR);
+	}
+}
+//---------------------------------------------------------------------------------
 //Sort folder
-void Sort_folder(u32 folder_total) // originally had no type. don't do this
+static void BROWSER_CODE Sort_folder_ovl(u32 folder_total)
 {
 	u32 ret;
 	u32 i;
@@ -1639,9 +1883,14 @@ void Sort_folder(u32 folder_total) // originally had no type. don't do this
 		}
 	}
 }
+void Sort_folder(u32 folder_total) // originally had no type. don't do this
+{
+	Overlay_use(OVERLAY_BROWSER);
+	Sort_folder_ovl(folder_total);
+}
 //---------------------------------------------------------------------------------
 //Sort file
-void Sort_file(u32 game_total_SD)
+static void BROWSER_CODE Sort_file_ovl(u32 game_total_SD)
 {
 	u32 ret;
 	u32 i;
@@ -1659,7 +1908,13 @@ void Sort_file(u32 game_total_SD)
 		}
 	}
 }
+void Sort_file(u32 game_total_SD)
+{
+	Overlay_use(OVERLAY_BROWSER);
+	Sort_file_ovl(game_total_SD);
+}
 //---------------------------------------------------------------------------------
+u8* pThumbnail = NULL;//resident scratch, may be dropped by a bigger claim
 u32 Load_Thumbnail(TCHAR* pfilename_pic)
 {
 	u32 rett;
@@ -1674,9 +1929,14 @@ u32 Load_Thumbnail(TCHAR* pfilename_pic)
 		sprintf(picpath, "/SYSTEM/IMGS/%c/%c/%c%c%c%c.bmp", GAMECODE[0], GAMECODE[1], GAMECODE[0], GAMECODE[1], GAMECODE[2], GAMECODE[3]);
 		res = f_open(&gfile, picpath, FA_READ);
 		if (res == FR_OK) {
-			f_read(&gfile, pReadCache + 0x10000, 0x4B38, (UINT*)&rett);
+			if (!Scratch_kept(pThumbnail, "thumbnail"))
+				pThumbnail = Scratch_keep(0x4B38, "thumbnail");
+			if (pThumbnail) {
+				f_read(&gfile, pThumbnail, 0x4B38, (UINT*)&rett);
+				f_close(&gfile);
+				return 1;
+			}
 			f_close(&gfile);
-			return 1;
 		}
 	}
 	return 0;
@@ -1689,7 +1949,7 @@ void SD_list_L_START(u32 show_offset, u32 file_select, u32 folder_total)
 	DrawPic((u16*)gImage_MENU, 36, 25, 168, 110, 1, 0, 1);//show menu pic
 	Show_MENU_btn();
 	DrawHZText12(gl_LSTART_help, 0, 60, 60, gl_color_text, 1);//use sure?gl_LSTART_help
-	DrawHZText12(pFilename_buffer[show_offset + file_select - folder_total].filename, 20, 60, 75, 0x001F, 1);//file name
+	DrawName12(pFilename_buffer[show_offset + file_select - folder_total].filename, 20, 60, 75, 0x001F, 1);//file name
 	DrawHZText12(temp, 5, 60, 90, gl_color_text, 1);//use sure?
 	while (1) {
 		VBlankIntrWait();
@@ -1717,7 +1977,7 @@ void SD_list_L_SELECT(u32 show_offset, u32 file_select, u32 folder_total)
 	DrawPic((u16*)gImage_MENU, 36, 25, 168, 110, 1, 0, 1);//show menu pic
 	Show_MENU_btn();
 	DrawHZText12(gl_LSELECT_help, 0, 60, 60, gl_color_text, 1);//use sure?gl_LSTART_help
-	DrawHZText12(pFilename_buffer[show_offset + file_select - folder_total].filename, 20, 60, 75, 0x001F, 1);//file name
+	DrawName12(pFilename_buffer[show_offset + file_select - folder_total].filename, 20, 60, 75, 0x001F, 1);//file name
 	DrawHZText12(temp, 5, 60, 90, gl_color_text, 1);//use sure?
 			strlen8 = strlen(pfilename);
 	while (1) {
@@ -1736,6 +1996,134 @@ void SD_list_L_SELECT(u32 show_offset, u32 file_select, u32 folder_total)
 	}
 }
 
+//---------------------------------------------------------------------------------
+//window and cursor that show listing position pos, at the top when it can
+void Set_list_position(u32 pos, u32 total, u32* show_offset, u32* file_select)
+{
+	if (total <= 10) {
+		*show_offset = 0;
+	}
+	else if (pos + 10 > total) {
+		*show_offset = total - 10;
+	}
+	else {
+		*show_offset = pos;
+	}
+	*file_select = pos - *show_offset;
+}
+//---------------------------------------------------------------------------------
+//Find, L + SELECT: a keyboard on the menu panel, matches narrow per key
+#define FIND_COLS	10
+#define FIND_KEYS	40
+#define FIND_MAX	16
+const char find_keys[FIND_KEYS + 1] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_. ";
+
+void Show_find_key(u32 key, u16 color)
+{
+	char cell[3] = { find_keys[key], 0, 0 };
+	if (cell[0] == ' ') {
+		cell[0] = 'S';
+		cell[1] = 'P';
+	}
+	DrawHZText12(cell, 0, 60 + (key % FIND_COLS) * 12, 72 + (key / FIND_COLS) * 13, color, 1);
+}
+//only the rows above the keys, the panel image is stored row by row
+void Show_find(char* query, u32 count, u32 first, u32 match)
+{
+	char msg[40];
+	u32 pos;
+	DrawPic((u16*)gImage_MENU, 36, 25, 168, 46, 1, 0, 1);
+	sprintf(msg, "%s: %s_", gl_find_title, query);
+	DrawHZText12(msg, 0, 47, 30, gl_color_text, 1);
+	if (count == 0) {
+		DrawHZText12(gl_find_none, 0, 47, 44, gl_color_text, 1);
+		return;
+	}
+	sprintf(msg, "[%lu/%lu]", match + 1, count);
+	DrawHZText12(msg, 0, 47, 44, gl_color_text, 1);
+	pos = Find_entry(first + match);
+	DrawName12((pos < folder_total) ? pFolder[pos].filename : pFilename_buffer[pos - folder_total].filename, 25, 47, 58, gl_color_selected, 1);
+}
+//returns the listing position to show, pos when cancelled
+u32 SD_list_find(u32 pos)
+{
+	char query[FIND_MAX + 1];
+	u32 len = 0;
+	u32 key = 0;
+	u32 old_key;
+	u32 first;
+	u32 match = 0;
+	u32 count;
+	u32 re_show = 1;
+	u32 i;
+	query[0] = 0;
+	count = Find_match(query, &first);
+	DrawPic((u16*)gImage_MENU, 36, 25, 168, 110, 1, 0, 1);
+	for (i = 0; i < FIND_KEYS; i++) {
+		Show_find_key(i, (i == key) ? gl_color_selected : gl_color_text);
+	}
+	while (1) {
+		if (re_show) {
+			Show_find(query, count, first, match);
+			re_show = 0;
+		}
+		VBlankIntrWait();
+		scanKeys();
+		u16 keysdown = keysDown();
+		u16 keysrepeat = keysDownRepeat();
+		old_key = key;
+		if (keysrepeat & KEY_RIGHT) {
+			key = (key % FIND_COLS == FIND_COLS - 1) ? key + 1 - FIND_COLS : key + 1;
+		}
+		else if (keysrepeat & KEY_LEFT) {
+			key = (key % FIND_COLS == 0) ? key + FIND_COLS - 1 : key - 1;
+		}
+		else if (keysrepeat & KEY_DOWN) {
+			key = (key + FIND_COLS) % FIND_KEYS;
+		}
+		else if (keysrepeat & KEY_UP) {
+			key = (key + FIND_KEYS - FIND_COLS) % FIND_KEYS;
+		}
+		else if (keysrepeat & KEY_A) { //type
+			if (len < FIND_MAX) {
+				query[len++] = find_keys[key];
+				query[len] = 0;
+				count = Find_match(query, &first);
+				match = 0;
+				re_show = 1;
+			}
+		}
+		else if (keysrepeat & KEY_B) { //erase, leave when empty
+			if (len == 0) {
+				return pos;
+			}
+			query[--len] = 0;
+			count = Find_match(query, &first);
+			match = 0;
+			re_show = 1;
+		}
+		else if (keysrepeat & KEY_R) { //next match
+			if (match + 1 < count) {
+				match++;
+				re_show = 1;
+			}
+		}
+		else if (keysrepeat & KEY_L) {
+			if (match) {
+				match--;
+				re_show = 1;
+			}
+		}
+		else if (keysdown & KEY_START) { //go to the match
+			return count ? Find_entry(first + match) : pos;
+		}
+		if (key != old_key) {
+			Show_find_key(old_key, gl_color_text);
+			Show_find_key(key, gl_color_selected);
+		}
+	}
+}
+
 //---------------------------------------------------------------------------------
 u32 Check_file_type(TCHAR* pfilename)
 {
@@ -1824,6 +2212,15 @@ void Show_error_num(u8 error_num)
 	case 0x6:
 		sprintf(msg, "%s", gl_error_6);
 		break;
+	case 0x7:
+		sprintf(msg, "%s", gl_error_7);
+		break;
+	case 0x8:
+		sprintf(msg, "%s", gl_error_8);
+		break;
+	case 0x9:
+		sprintf(msg, "%s", gl_error_9);
+		break;
 	default:
 		sprintf(msg, "%s", "error?");
 		break;
@@ -1852,15 +2249,19 @@ u32 Copy_file(const char* src, const char* dst)
 			filesize = f_size(&gfile);
 			f_lseek(&gfile, 0x0000);
 
+			u8* buffer = Scratch_alloc(0x20000, "copy");
+			if (buffer == NULL)
+				filesize = 0;//no copy, ret stays 0
 			for (blocknum = 0x0000; blocknum < filesize; blocknum += 0x20000)
 			{
-				f_read(&gfile, pReadCache, 0x20000, &read_ret);
-				f_write(&dst_file, pReadCache, read_ret, &write_ret);
+				f_read(&gfile, buffer, 0x20000, &read_ret);
+				f_write(&dst_file, buffer, read_ret, &write_ret);
 				if (write_ret != read_ret)
 					break;
 				else
 					ret = 1;
 			}
+			Scratch_release(buffer);
 
 			f_close(&dst_file);
 
@@ -1902,12 +2303,69 @@ void Backup_savefile(const char* filename)
 	Copy_file(filename, temp_filename);
 }
 //---------------------------------------------------------------------------------
+//boot milestones for make BOOTTIME=1, timer 3 at 1/16384s from main()
+#if defined(BOOT_TIME) && !defined(EMU)
+enum { BOOT_MOUNT, BOOT_LIST, BOOT_FRAME, BOOT_NOR, BOOT_MARKS };
+static u16 boot_mark[BOOT_MARKS];
+static void Boot_mark(u32 mark)
+{
+	if (boot_mark[mark] == 0) {
+		boot_mark[mark] = REG_TM3CNT_L;
+	}
+}
+static void Boot_time_show(void)
+{
+	char msg[40];
+	u32 i;
+	u32 ms[BOOT_MARKS];
+	for (i = 0; i < BOOT_MARKS; i++) {
+		ms[i] = (boot_mark[i] * 1000) >> 14;
+	}
+	sprintf(msg, "mnt %lu lst %lu frm %lu nor %lums", ms[BOOT_MOUNT], ms[BOOT_LIST], ms[BOOT_FRAME], ms[BOOT_NOR]);
+	DrawHZText12(msg, 0, 2, 160 - 13, gl_color_text, 1);
+	REG_TM3CNT_H = 0;
+}
+#else
+#define Boot_mark(mark)
+#define Boot_time_show()
+#endif
+//---------------------------------------------------------------------------------
+//NOR directory, read lazily: only the NOR page and NOR writes need it, and
+//both call this first. The browser runs it on its first idle frame. Writes,
+//deletes and formats drop it with Nor_changed so the next call reads again.
+static u32 nor_scanned = 0;
+static void Nor_changed(void)
+{
+	nor_scanned = 0;
+}
+static void Boot_nor_scan(void)
+{
+	if (nor_scanned) {
+		return;
+	}
+	Read_NOR_info();
+	gl_norOffset = 0x000000;
+	game_total_NOR = GetFileListFromNor();
+	Upgrade_NOR_names();
+	if (game_total_NOR == 0) {
+		memset(pNorFS, 00, sizeof(FM_NOR_FS) * MAX_NOR);
+		Save_NOR_info((u16*)pNorFS, sizeof(FM_NOR_FS) * MAX_NOR);
+	}
+	nor_scanned = 1;
+	Boot_mark(BOOT_NOR);
+}
+//---------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------
 // Program entry point
 //---------------------------------------------------------------------------------
 int main(void)
 {
+#if defined(BOOT_TIME) && !defined(EMU)
+	REG_TM3CNT_H = 0;
+	REG_TM3CNT_L = 0;
+	REG_TM3CNT_H = TIMER_START | 3;
+#endif
 	irqInit();
 	irqEnable(IRQ_VBLANK);
 	REG_IME = 1;
@@ -1926,6 +2384,8 @@ int main(void)
 	gl_toggle_reset = Read_SET_info(14);
 	gl_toggle_backup = Read_SET_info(15);
 	gl_toggle_bold = Read_SET_info(16);
+	gl_toggle_verify = Read_SET_info(17);
+	gl_toggle_shard = Read_SET_info(18);
 	gl_currentpage = 0x8002;//kernel mode
 	SetMode(MODE_3 | BG2_ENABLE);
 	SD_Disable();
@@ -1936,6 +2396,7 @@ int main(void)
 	if ((Current_FW_ver < Built_in_ver) || (Current_FW_ver == 99)) { //99 is test ver
 		Check_FW_update(Current_FW_ver, Built_in_ver);
 	}
+	Waitstate_calibrate();
 	//REG_BLDCNT = 0x0084;
 	//REG_BLDY = 0x0010;
 	DrawPic((u16*)gImage_splash, 0, 0, 240, 160, 0, 0, 1);
@@ -1963,6 +2424,10 @@ int main(void)
 		DrawHZText12(gl_init_ok, 0, 2, 20, 0x0000, 1);
 		DrawHZText12(gl_Loading, 0, 2, 33, 0x0000, 1);
 	}
+	Boot_mark(BOOT_MOUNT);
+	Provision_NOR();
+	Overlay_bench();
+	Bgm_start();
 	/*
 	for(i = 0; i < 16; i++) {
 		VBlankIntrWait();
@@ -1987,18 +2452,13 @@ int main(void)
 	memset(p_folder_select_show_offset, 0x00, 100);
 	memset(p_folder_select_file_select, 0x00, 100);
 	res = f_getcwd(currentpath, sizeof currentpath / sizeof * currentpath);
-	Read_NOR_info();
-	gl_norOffset = 0x000000;
-	game_total_NOR = GetFileListFromNor();//initialize to prevent direct writes to NOR without page turning
-	if (game_total_NOR == 0) {
-		memset(pNorFS, 00, sizeof(FM_NOR_FS) * MAX_NOR);
-		Save_NOR_info((u16*)pNorFS, sizeof(FM_NOR_FS) * MAX_NOR);
-	}
-	else {
-		VBlankIntrWait();
-		scanKeys();
-		if (keysDownRepeat() & KEY_L || keysDown() & KEY_L)
-		{
+	VBlankIntrWait();
+	scanKeys();
+	if (keysDownRepeat() & KEY_L || keysDown() & KEY_L)
+	{
+		//L held at boot starts the last NOR game, that needs the NOR list now
+		Boot_nor_scan();
+		if (game_total_NOR) {
 			page_num = NOR_list;
 			goto load_file;
 		}
@@ -2008,6 +2468,7 @@ refind_file:
 	if (page_num == SD_list) {
 		folder_total = 0;
 		game_total_SD = 0;
+		name_pool_used = 0;
 		res = f_opendir(&dir, currentpath);
 		if (res == FR_OK) {
 			while (1) {
@@ -2018,17 +2479,21 @@ refind_file:
 					break;
 				}
 				if ((fileinfo.fattrib == AM_DIR) || (fileinfo.fattrib == 0x30)) { //DIR and exFAT dir
-					memcpy(pFolder[folder_total].filename, fileinfo.fname, 100);
-					pFolder[folder_total++].filename[99] = 0;
-					if (folder_total > MAX_folder) { //cut
+					pFolder[folder_total].filename = Name_keep(fileinfo.fname);
+					if (pFolder[folder_total].filename == NULL) { //pool full
+						break;
+					}
+					if (++folder_total == MAX_folder) { //cut
 						break;
 					}
 				}
 				else if (fileinfo.fattrib == AM_ARC) {
-					memcpy(pFilename_buffer[game_total_SD].filename, fileinfo.fname, 100);
-					pFilename_buffer[game_total_SD].filename[99] = 0;
+					pFilename_buffer[game_total_SD].filename = Name_keep(fileinfo.fname);
+					if (pFilename_buffer[game_total_SD].filename == NULL) { //pool full
+						break;
+					}
 					pFilename_buffer[game_total_SD++].filesize = fileinfo.fsize;
-					if (game_total_SD > MAX_files) { //cut
+					if (game_total_SD == MAX_files) { //cut
 						break;
 					}
 				}
@@ -2038,11 +2503,11 @@ refind_file:
 		game_folder_total = folder_total + game_total_SD;
 		Sort_folder(folder_total);//folder
 		Sort_file(game_total_SD);//file
+		Find_drop();
+		Boot_mark(BOOT_LIST);
 	}
 	else {
-		Read_NOR_info();
-		gl_norOffset = 0x000000;
-		game_total_NOR = GetFileListFromNor();
+		Boot_nor_scan();
 	}
 	if (folder_select) {
 		file_select = p_folder_select_file_select[folder_select];
@@ -2072,12 +2537,14 @@ re_showfile:
 			if ((shift == 0) || (gl_show_Thumbnail == 0)) {
 				short_filename = 0;
 			}
-			if (shift == 0) {
-				dwName = 0;
-			}
 			shift++;
 			haveThumbnail = 0;
 			is_GBA = 0;
+#ifdef LIST_ROWS
+			if ((page_num == SD_list) && !Rows_shown()) {
+				updata = 1;//drawn over while the rows were off
+			}
+#endif
 			if (updata && gl_show_Thumbnail) {
 				u32 rett;
 				TCHAR picpath[30];
@@ -2101,7 +2568,11 @@ re_showfile:
 				}
 				is_GBA_old = is_GBA;
 			}
+			if (updata && (page_num <= NOR_list)) {
+				Back_begin();//list frames are composed off screen, see Back_present
+			}
 			if (updata == 1) { //reshow all
+				time_shown_SS = 0xFF;
 				if (page_num == SD_list) {
 					in_recently_play = 0;
 					DrawPic((u16*)gImage_SD, 0, 0, 240, 160, 0, 0, 1);	
@@ -2139,6 +2610,13 @@ re_showfile:
 				}
 				Show_game_num(file_select+show_offset+1,page_num);
 			}
+#ifdef LIST_ROWS
+			else if (updata > 3) { //SD list, one line scrolled
+				Scroll_filename(show_offset, file_select, (updata == 4) ? 1 : -1);
+				ClearWithBG((u16*)gImage_SD, 185, 0, 30, 18, 1);
+				Show_game_num(file_select + show_offset + 1, page_num);
+			}
+#endif
 			else if (updata > 1) {
 				if (page_num == NOR_list) {
 					Refresh_filename_NOR(show_offset, file_select, updata);
@@ -2151,14 +2629,15 @@ re_showfile:
 				Show_game_num(file_select + show_offset + 1, page_num);
 			}
 			if (updata && gl_show_Thumbnail && is_GBA && (page_num == SD_list)) {
-				if (haveThumbnail) {
-					DrawPic((u16*)(pReadCache + 0x10036), 120, 80, 120, 80, 0, 0, 1);//show game pic
+				if (haveThumbnail && Scratch_kept(pThumbnail, "thumbnail")) {
+					DrawPic((u16*)(pThumbnail + 0x36), 120, 80, 120, 80, 0, 0, 1);//show game pic
 				}
 				else {
 					DrawPic((u16*)(gImage_NOTFOUND), 120, 80, 120, 80, 0, 0, 1);//show game pic
 				}
 				ClearWithBG((u16*)gImage_SD, 118, 80, 2, 78, 1);
 			}
+			Back_present();
 			if (continue_MENU) {
 				break;
 			}
@@ -2168,10 +2647,24 @@ re_showfile:
 				}
 			}
 			updata = 0;
+			Boot_mark(BOOT_FRAME);
+			Bgm_service();
 			scanKeys();
 			u16 keysdown = keysDown();
 			u16 keys_released = keysUp();
 			u16 keysrepeat = keysDownRepeat();
+#ifdef LIST_ROWS
+			if (keysdown & ~(KEY_UP | KEY_DOWN | KEY_LEFT | KEY_RIGHT | KEY_L)) {
+				Rows_show(0);//whatever it opens draws over the list in the bitmap
+			}
+#endif
+			if (!nor_scanned && !keysdown && !keysrepeat) {
+				Boot_nor_scan();
+				Boot_time_show();
+			}
+			else if ((page_num == SD_list) && !keysHeld()) {
+				Library_step();//background refresh of the library index
+			}
 			u32 list_game_total;
 			if (page_num == NOR_list) {
 				list_game_total = game_total_NOR;
@@ -2185,6 +2678,11 @@ re_showfile:
 						if (file_select == 9) {
 							show_offset++;
 							updata = 1;
+#ifdef LIST_ROWS
+							if ((page_num == SD_list) && !gl_show_Thumbnail) {
+								updata = 4;//Scroll_filename
+							}
+#endif
 						}
 					}
 					else {
@@ -2203,6 +2701,21 @@ re_showfile:
 					if (show_offset) {
 						show_offset--;
 						updata = 1;
+#ifdef LIST_ROWS
+						if ((page_num == SD_list) && !gl_show_Thumbnail) {
+							updata = 5;//Scroll_filename
+						}
+#endif
+					}
+				}
+				shift = 0;
+			}
+			else if ((keysrepeat & (KEY_LEFT | KEY_RIGHT)) && key_L && (page_num == SD_list)) { //letter jump
+				if (list_game_total) {
+					u32 pos = Find_letter(show_offset + file_select, (keysrepeat & KEY_RIGHT) ? 1 : -1);
+					if (pos != show_offset + file_select) {
+						Set_list_position(pos, list_game_total, &show_offset, &file_select);
+						updata = 1;
 					}
 				}
 				shift = 0;
@@ -2291,6 +2804,14 @@ re_showfile:
 					}
 				}
 			}
+			else if ((keysdown & KEY_SELECT) && key_L && (page_num == SD_list)) { //find
+				if (list_game_total) {
+					Set_list_position(SD_list_find(show_offset + file_select), list_game_total, &show_offset, &file_select);
+					updata = 1;
+				}
+				key_L = (keysHeld() & KEY_L) ? 1 : 0;
+				shift = 0;
+			}
 			else if (keysdown & KEY_SELECT) {
 				/*
 					if (key_L) {
@@ -2305,7 +2826,7 @@ re_showfile:
 				Show_MENU_btn();
 				u8 MENU_line = 0;
 				u8 re_menu = 1;
-				u8 MENU_max = 3;
+				u8 MENU_max = 5;
 				u16 name_color = 0;
 				while (1)
 				{
@@ -2328,7 +2849,15 @@ re_showfile:
 							DrawHZText12("(ON)", 32, 47 + (6 * 20), 72, gl_color_text, 1);
 						else
 							DrawHZText12("(OFF)", 32, 47 + (6 * 20), 72, gl_color_text, 1);
-						if (MENU_line == 1 || MENU_line == 2 || MENU_line == 3) {
+						if (gl_toggle_verify)
+							DrawHZText12("(ON)", 32, 47 + (6 * 20), 86, gl_color_text, 1);
+						else
+							DrawHZText12("(OFF)", 32, 47 + (6 * 20), 86, gl_color_text, 1);
+						if (gl_toggle_shard)
+							DrawHZText12("(ON)", 32, 47 + (6 * 20), 100, gl_color_text, 1);
+						else
+							DrawHZText12("(OFF)", 32, 47 + (6 * 20), 100, gl_color_text, 1);
+						if (MENU_line == 1 || MENU_line == 2 || MENU_line == 3 || MENU_line == 4 || MENU_line == 5) {
 							name_color = gl_color_selected;
 						}
 						else {
@@ -2362,6 +2891,20 @@ re_showfile:
 							else
 								DrawHZText12("(OFF)", 32, 47 + (6 * 20), 72, name_color, 1);
 						}
+						if (MENU_line == 4)
+						{
+							if (gl_toggle_verify)
+								DrawHZText12("(ON)", 32, 47 + (6 * 20), 86, name_color, 1);
+							else
+								DrawHZText12("(OFF)", 32, 47 + (6 * 20), 86, name_color, 1);
+						}
+						if (MENU_line == 5)
+						{
+							if (gl_toggle_shard)
+								DrawHZText12("(ON)", 32, 47 + (6 * 20), 100, name_color, 1);
+							else
+								DrawHZText12("(OFF)", 32, 47 + (6 * 20), 100, name_color, 1);
+						}
 						re_menu = 0;
 					}
 					re_menu = 0;
@@ -2421,6 +2964,20 @@ re_showfile:
 							Refresh_filename(show_offset, file_select, updata, gl_show_Thumbnail && is_GBA);
 							goto refind_file;
 						}
+						else if (MENU_line == 4) {
+							gl_toggle_verify = !gl_toggle_verify;
+							save_set_info_SELECT();
+							updata = 1;
+							Refresh_filename(show_offset, file_select, updata, gl_show_Thumbnail && is_GBA);
+							goto refind_file;
+						}
+						else if (MENU_line == 5) {
+							gl_toggle_shard = !gl_toggle_shard;
+							save_set_info_SELECT();
+							updata = 1;
+							Refresh_filename(show_offset, file_select, updata, gl_show_Thumbnail && is_GBA);
+							goto refind_file;
+						}
 					}
 				}
 			//}
@@ -2429,6 +2986,11 @@ re_showfile:
 				if (page_num == SD_list) {
 					//res = f_getcwd(currentpath, sizeof currentpath / sizeof *currentpath);
 					if (show_offset + file_select < folder_total) {
+						if (strlen(currentpath) + 1 + strlen(pFolder[show_offset + file_select].filename) >= MAX_path_len) {
+							error_num = 0;
+							Show_error_num(error_num);
+							goto re_showfile;
+						}
 						if (strcmp(currentpath, "/") != 0) {
 							sprintf(currentpath, "%s%s", currentpath, "/");
 						}
@@ -2489,15 +3051,16 @@ re_showfile:
 			}
 		}
 		else {
-			u8* p = strrchr(p_recently_play[play_re], '/');
+			u8* play_path = (play_re == PLAY_LIBRARY) ? p_library_play : p_recently_play[play_re];
+			u8* p = strrchr(play_path, '/');
 			strncpy(currentpath_temp, currentpath, 256);//old
 			memset(currentpath, 00, 256);
-			strncpy(currentpath, p_recently_play[play_re], p - p_recently_play[play_re]);
+			strncpy(currentpath, play_path, p - play_path);
 			if (currentpath[0] == 0) {
 				currentpath[0] = '/';
 			}
-			memset(current_filename, 00, 200);
-			strncpy(current_filename, p + 1, 100);//remove directory path
+			memset(current_filename, 00, sizeof(current_filename));
+			strncpy(current_filename, p + 1, sizeof(current_filename) - 1);//remove directory path
 			pfilename = current_filename;
 		}
 		u8 Save_num = 0;//save tpye: auto
@@ -2599,6 +3162,7 @@ re_showfile:
 						//delete lastest geme
 						if (show_offset + file_select + 1 == game_total_NOR) {
 							Block_Erase(gl_norOffset - pNorFS[show_offset + file_select].filesize);
+							Nor_changed();
 						}
 						else {
 							DrawHZText12(gl_lastest_game, 0, 66, 118 - 15, gl_color_text, 1);
@@ -2610,6 +3174,7 @@ re_showfile:
 					else { //MENU_line==2
 						//format all
 						FormatNor();
+						Nor_changed();
 						page_num = NOR_list;
 						goto refind_file;
 					}
@@ -2640,7 +3205,7 @@ re_showfile:
 		u32 gamefilesize = 0;
 		u32 savefilesize = 0;
 		u32 ret;
-		TCHAR savfilename[100];
+		TCHAR savfilename[MAX_name_len];
 		BYTE saveMODE;
 		u32 have_pat = 0;
 		init_FAT_table();
@@ -2676,7 +3241,7 @@ re_showfile:
 			memcpy(GAMECODE, &pNorFS[show_offset + file_select].gamename[0xC], 4);
 		}
 		ShowbootProgress(gl_check_sav);
-		memcpy(savfilename, pfilename, 100);
+		snprintf(savfilename, sizeof(savfilename) - 4, "%s", pfilename);
 		TCHAR* saveext = strrchr(savfilename, '.');
 		if (saveext == NULL)
 			saveext = savfilename + strlen(savfilename);
@@ -2692,8 +3257,7 @@ re_showfile:
 				Make_mde_file(pfilename, Save_num);
 			}
 		}
-		res = f_mkdir("/SYSTEM/SAVER");
-		res = f_chdir("/SYSTEM/SAVER");
+		res = Saver_enter(savfilename);
 		if (res != FR_OK) {
 			error_num = 2;
 			Show_error_num(error_num);
@@ -2703,11 +3267,15 @@ re_showfile:
 			if (MENU_line < 2) { //PSRAM DirectPSRAM or soft reset
 				res = f_chdir("/SYSTEM");
 				Make_recently_play_file(currentpath, pfilename);
-				res = f_chdir("/SYSTEM/SAVER");
+				res = Saver_enter(savfilename);
 			}
 		}
 		if (Save_num == 0) { //auto
 			saveMODE = Check_saveMODE(GAMECODE);
+			if (saveMODE == SAVE_MODE_NO_MEMORY) {
+				Show_error_num(9);
+				goto re_showfile;
+			}
 		}
 		else {
 			switch (Save_num) {
@@ -2782,8 +3350,8 @@ re_showfile:
 			//new_save:
 			ShowbootProgress(gl_make_sav);
 			res = SavefileWrite(savfilename, savefilesize);
-			if (res == 0) {
-				error_num = 5;
+			if ((res == 0) || (res == 2)) {
+				error_num = (res == 2) ? 9 : 5;
 				Show_error_num(error_num);
 				goto re_showfile;
 			}
@@ -2826,6 +3394,10 @@ re_showfile:
 			FAT_table_buffer[0x1F4 / 4] = 0x2;  	//copy mode
 			Send_FATbuffer(FAT_table_buffer, 1); //only save FAT
 			res = LoadEMU2PSRAM(pfilename, is_EMU);
+			if (res == 2) {
+				Show_error_num(9);
+				goto re_showfile;
+			}
 			int bootmode = ((is_EMU > 3) && (is_EMU < 9)) ?
 				((is_EMU == 6) ? 2
 					: (is_EMU == 7) ? 4
@@ -2839,8 +3411,8 @@ re_showfile:
 			if (pNorFS[show_offset + file_select].have_patch && pNorFS[show_offset + file_select].have_RTS) {
 				ShowbootProgress(gl_check_RTS);
 				u32 size = Check_RTS(pfilename);
-				if (size == 0) {
-					error_num = 6;
+				if ((size == 0) || (size == PATCH_NO_MEMORY)) {
+					error_num = size ? 9 : 6;
 					Show_error_num(error_num);
 					goto re_showfile;
 				}
@@ -2870,8 +3442,8 @@ re_showfile:
 				if (gl_rts_on == 1) {
 					ShowbootProgress(gl_check_RTS);
 					u32 size = Check_RTS(pfilename);
-					if (size == 0) {
-						error_num = 6;
+					if ((size == 0) || (size == PATCH_NO_MEMORY)) {
+						error_num = size ? 9 : 6;
 						Show_error_num(error_num);
 						goto re_showfile;
 					}
@@ -2886,19 +3458,33 @@ re_showfile:
 				}
 				else { //(have_pat==0)
 					//get the location of the patch
+					u8* block = Scratch_alloc(0x20000, "trim block");
+					if (block == NULL) {
+						Show_error_num(9);
+						goto re_showfile;
+					}
 					res = f_open(&gfile, pfilename, FA_READ);
 					f_lseek(&gfile, (gamefilesize - 1) & 0xFFFE0000);
-					f_read(&gfile, pReadCache, 0x20000, (UINT*)&ret);
+					f_read(&gfile, block, 0x20000, (UINT*)&ret);
 					f_close(&gfile);
-					SetTrimSize(pReadCache, gamefilesize, 0x20000, 0x0, saveMODE);
+					SetTrimSize(block, gamefilesize, 0x20000, 0x0, saveMODE);
+					Scratch_release(block);
 					if ((gl_engine_sel == 0) || (gl_select_lang == 0xE2E2)) {
 						FAT_table_buffer[0x1F4 / 4] = 0x2;  // copy mode
 						Send_FATbuffer(FAT_table_buffer, 1); //only save FAT
 						res = Loadfile2PSRAM(pfilename);
+						if (res >= 2) {
+							error_num = (res == 2) ? 7 : (res == 4) ? 9 : 8;
+							Show_error_num(error_num);
+							goto re_showfile;
+						}
 						make_pat = 1;
 					}
 					else {
-						use_internal_engine(GAMECODE);
+						if (use_internal_engine(GAMECODE) == PATCH_NO_MEMORY) {
+							Show_error_num(9);
+							goto re_showfile;
+						}
 						Send_FATbuffer(FAT_table_buffer, 0);//Loading rom
 					}
 				}
@@ -2916,7 +3502,9 @@ re_showfile:
 				break;
 			case 2://WRITE TO NOR CLEAN
 				f_chdir(currentpath);//return to game folder
+				Boot_nor_scan();
 				res = Loadfile2NOR(pfilename, gl_norOffset, 0x0);
+				Nor_changed();
 				if (res == 0) {
 					page_num = NOR_list;
 					goto refind_file;
@@ -2926,6 +3514,11 @@ re_showfile:
 					wait_btn();
 					goto refind_file;
 				}
+				else if (res >= 3) {
+					error_num = (res == 3) ? 7 : (res == 6) ? 9 : 8;
+					Show_error_num(error_num);
+					goto refind_file;
+				}
 				break;
 			case 3://WRITE TO NOR ADDON
 				gl_reset_on = Read_SET_info(1);
@@ -2939,14 +3532,23 @@ re_showfile:
 					//get the location of the patch
 					res = f_open(&gfile, pfilename, FA_READ);
 					if (res == FR_OK) {
+						u8* block = Scratch_alloc(0x20000, "trim block");
+						if (block == NULL) {
+							f_close(&gfile);
+							Show_error_num(9);
+							goto refind_file;
+						}
 						f_lseek(&gfile, (gamefilesize - 1) & 0xFFFE0000);
-						f_read(&gfile, pReadCache, 0x20000, (unsigned int*)&ret);
+						f_read(&gfile, block, 0x20000, (unsigned int*)&ret);
 						f_close(&gfile);
-						SetTrimSize(pReadCache, gamefilesize, 0x20000, 0x1, saveMODE);
+						SetTrimSize(block, gamefilesize, 0x20000, 0x1, saveMODE);
+						Scratch_release(block);
 					}
 					needpatch = 1;
 				}
+				Boot_nor_scan();
 				res = Loadfile2NOR(pfilename, gl_norOffset, needpatch);
+				Nor_changed();
 				//wait_btn();
 				if (res == 0) {
 					page_num = NOR_list;
@@ -2958,6 +3560,11 @@ re_showfile:
 					wait_btn();
 					goto refind_file;
 				}
+				else if (res >= 3) {
+					error_num = (res == 3) ? 7 : (res == 6) ? 9 : 8;
+					Show_error_num(error_num);
+					goto refind_file;
+				}
 				break;
 			default:
 				break;
@@ -0,0 +1,146 @@
+#include <string.h>
+#include <gba_base.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "overlay.h"
+#include "finder.h"
+
+extern FM_Folder_FS pFolder[MAX_folder]EWRAM_BSS;
+extern FM_FILE_FS pFilename_buffer[MAX_files]EWRAM_BSS;
+extern u32 folder_total;
+extern u32 game_total_SD;
+
+//macros rather than helpers so the overlay sort stays call free
+#define FIND_FOLD(c) (((c) >= 'a' && (c) <= 'z') ? (c) - ('a' - 'A') : (c))
+#define FIND_NAME(pos) ((const u8*)((pos) < folder_total ? pFolder[pos].filename : pFilename_buffer[(pos) - folder_total].filename))
+
+static u16 find_order[MAX_folder + MAX_files + 2]EWRAM_BSS;	//listing positions by folded name
+static u16 find_first[257]EWRAM_BSS;	//first slot per folded leading byte, [256] is the total
+static u32 find_total;
+static u32 find_ready;
+
+// --------------------------------------------------------------------
+void Find_drop(void)
+{
+	find_ready = 0;
+}
+// --------------------------------------------------------------------
+//shell sort of the positions, equal folded names keep listing order
+static void BROWSER_CODE Find_build_ovl(u32 total)
+{
+	static const u16 gaps[] = { 364, 121, 40, 13, 4, 1 };
+	u32 g, i, j, k;
+	int d;
+
+	for (i = 0; i < total; i++)
+		find_order[i] = i;
+	for (g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+		u32 gap = gaps[g];
+		for (i = gap; i < total; i++) {
+			u32 pos = find_order[i];
+			const u8 *name = FIND_NAME(pos);
+			for (j = i; j >= gap; j -= gap) {
+				u32 other = find_order[j - gap];
+				const u8 *prev = FIND_NAME(other);
+				for (k = 0; (d = FIND_FOLD(prev[k]) - FIND_FOLD(name[k])) == 0 && name[k]; k++)
+					;
+				if (d < 0 || (d == 0 && other < pos))
+					break;
+				find_order[j] = other;
+			}
+			find_order[j] = pos;
+		}
+	}
+	memset(find_first, 0, sizeof(find_first));
+	for (i = 0; i < total; i++)
+		find_first[FIND_FOLD(FIND_NAME(i)[0]) + 1]++;
+	for (i = 1; i < 257; i++)
+		find_first[i] += find_first[i - 1];
+}
+// --------------------------------------------------------------------
+static void Find_build(void)
+{
+	if (find_ready)
+		return;
+	find_total = folder_total + game_total_SD;
+	if (find_total > sizeof(find_order) / sizeof(find_order[0]))
+		find_total = sizeof(find_order) / sizeof(find_order[0]);
+	Overlay_use(OVERLAY_BROWSER);
+	Find_build_ovl(find_total);
+	find_ready = 1;
+}
+// --------------------------------------------------------------------
+//folded name of a slot against the prefix: <0 sorts before the matches, 0 matches
+static int Find_cmp(u32 slot, const u8 *prefix)
+{
+	const u8 *name = FIND_NAME(find_order[slot]);
+	int d;
+
+	for (; *prefix; name++, prefix++) {
+		d = FIND_FOLD(*name) - FIND_FOLD(*prefix);
+		if (d)
+			return d;
+	}
+	return 0;
+}
+// --------------------------------------------------------------------
+u32 Find_match(const char *prefix, u32 *first)
+{
+	const u8 *p = (const u8*)prefix;
+	u32 lo, hi, mid, end;
+
+	Find_build();
+	if (p[0] == 0) {
+		*first = 0;
+		return find_total;
+	}
+	lo = find_first[FIND_FOLD(p[0])];
+	end = find_first[FIND_FOLD(p[0]) + 1];
+	hi = end;
+	while (lo < hi) {	//first slot not before the prefix
+		mid = (lo + hi) >> 1;
+		if (Find_cmp(mid, p) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*first = lo;
+	hi = end;
+	while (lo < hi) {	//first slot after it
+		mid = (lo + hi) >> 1;
+		if (Find_cmp(mid, p) <= 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo - *first;
+}
+// --------------------------------------------------------------------
+u32 Find_entry(u32 slot)
+{
+	Find_build();
+	return (slot < find_total) ? find_order[slot] : 0;
+}
+// --------------------------------------------------------------------
+//backwards the first stop is the top of the current letter
+u32 Find_letter(u32 pos, int dir)
+{
+	u32 c, slot;
+
+	Find_build();
+	if (pos >= find_total)
+		return pos;
+	c = FIND_FOLD(FIND_NAME(pos)[0]);
+	if (dir > 0) {
+		slot = find_first[c + 1];
+		return (slot < find_total) ? find_order[slot] : pos;
+	}
+	slot = find_first[c];
+	if (find_order[slot] != pos)
+		return find_order[slot];
+	if (slot == 0)
+		return pos;
+	c = FIND_FOLD(FIND_NAME(find_order[slot - 1])[0]);
+	return find_order[find_first[c]];
+}
@@ -0,0 +1,361 @@
+#include <string.h>
+#include <gba_base.h>
+
+#include "ff.h"
+#include "crc32.h"
+#include "kvstore.h"
+
+#define KV_MAGIC 0x3153564B		//"KVS1"
+#define KV_REC_MAGIC 0x4345524B	//"KREC"
+#define KV_SECTOR 512
+#define KV_BUCKETS 1024
+#define KV_INDEX KV_SECTOR
+#define KV_LOG (KV_INDEX + KV_BUCKETS * 4)
+//compact once the log is this big and mostly superseded records
+#define KV_COMPACT_MIN 0x40000
+
+typedef struct {
+	u32 magic;
+	u32 gen;		//bumped by compaction, stale clusters never match
+	u32 log_end;
+	u32 records;
+	u32 keys;
+} KV_HEAD;
+
+typedef struct {
+	u32 magic;
+	u32 pos;		//own offset
+	u32 gen;
+	u32 prev;		//older record of the same bucket, 0 at the end
+	u32 hash;
+	u16 key_len;
+	u16 val_len;
+	u32 crc;		//header with crc 0, key and value
+} KV_REC;
+
+typedef struct {
+	FIL file;
+	KV_HEAD head;
+} KV;
+
+static KV kv EWRAM_BSS;
+static KV kv_new EWRAM_BSS;
+static u8 kv_buf[sizeof(KV_REC) + KV_KEY_MAX + KV_VAL_MAX] EWRAM_BSS;
+static u32 kv_mounted = 0;
+
+// --------------------------------------------------------------------
+static u32 Kv_hash(const u8 *key, u32 len)
+{
+	u32 hash = 0x811C9DC5;
+	while (len--)
+		hash = (hash ^ *key++) * 0x01000193;
+	return hash;
+}
+// --------------------------------------------------------------------
+static u32 Kv_key(u8 *out, u8 tag, const TCHAR *name)
+{
+	u32 len = strlen(name) + 1;
+	if (len > KV_KEY_MAX)
+		return 0;
+	out[0] = tag;
+	memcpy(out + 1, name, len - 1);
+	return len;
+}
+// --------------------------------------------------------------------
+static u32 Kv_size(u32 key_len, u32 val_len)
+{
+	return (sizeof(KV_REC) + key_len + val_len + 3) & ~3;
+}
+// --------------------------------------------------------------------
+//small records stay inside one sector, big ones start on a sector
+static u32 Kv_place(u32 pos, u32 size)
+{
+	u32 next = (pos + KV_SECTOR - 1) & ~(KV_SECTOR - 1);
+	if (size > KV_SECTOR || (pos / KV_SECTOR) != ((pos + size - 1) / KV_SECTOR))
+		return next;
+	return pos;
+}
+// --------------------------------------------------------------------
+static u32 Kv_rw(KV *s, u32 pos, void *buf, u32 len, u32 write)
+{
+	UINT done;
+	//a read past the end would grow the file, it is opened for writing
+	if (!write && pos + len > f_size(&s->file))
+		return 0;
+	if (f_lseek(&s->file, pos) != FR_OK)
+		return 0;
+	if (write)
+		return f_write(&s->file, buf, len, &done) == FR_OK && done == len;
+	return f_read(&s->file, buf, len, &done) == FR_OK && done == len;
+}
+// --------------------------------------------------------------------
+static u32 Kv_slot(u32 hash)
+{
+	return KV_INDEX + (hash & (KV_BUCKETS - 1)) * 4;
+}
+// --------------------------------------------------------------------
+static u32 Kv_crc(KV_REC *rec)
+{
+	u32 crc = rec->crc, sum;
+	rec->crc = 0;
+	sum = Crc32_update(0, rec, sizeof(KV_REC) + rec->key_len + rec->val_len);
+	rec->crc = crc;
+	return sum;
+}
+// --------------------------------------------------------------------
+//record header at pos, 0 when there is no record of this store there
+static u32 Kv_probe(KV *s, u32 pos, KV_REC *rec)
+{
+	if (pos < KV_LOG || !Kv_rw(s, pos, rec, sizeof(KV_REC), 0))
+		return 0;
+	return rec->magic == KV_REC_MAGIC && rec->pos == pos && rec->gen == s->head.gen
+	       && rec->key_len <= KV_KEY_MAX && rec->val_len <= KV_VAL_MAX;
+}
+// --------------------------------------------------------------------
+//whole record at pos into buf, its size or 0 when it does not check out
+static u32 Kv_read(KV *s, u32 pos, u8 *buf)
+{
+	KV_REC *rec = (KV_REC *)buf;
+	if (!Kv_probe(s, pos, rec))
+		return 0;
+	if (!Kv_rw(s, pos + sizeof(KV_REC), buf + sizeof(KV_REC), rec->key_len + rec->val_len, 0))
+		return 0;
+	if (Kv_crc(rec) != rec->crc)
+		return 0;
+	return Kv_size(rec->key_len, rec->val_len);
+}
+// --------------------------------------------------------------------
+//newest record of key in the chain from pos, 0 when there is none
+static u32 Kv_chain(KV *s, u32 pos, const u8 *key, u32 key_len, u32 hash)
+{
+	struct {
+		KV_REC rec;
+		u8 key[KV_KEY_MAX];
+	} probe;
+
+	while (pos && Kv_probe(s, pos, &probe.rec)) {
+		if (probe.rec.hash == hash && probe.rec.key_len == key_len) {
+			if (!Kv_rw(s, pos + sizeof(KV_REC), probe.key, key_len, 0))
+				return 0;
+			if (memcmp(probe.key, key, key_len) == 0)
+				return pos;
+		}
+		//chains only run backwards
+		if (probe.rec.prev >= pos)
+			return 0;
+		pos = probe.rec.prev;
+	}
+	return 0;
+}
+// --------------------------------------------------------------------
+//newest record of key, 0 when there is none
+static u32 Kv_find(KV *s, const u8 *key, u32 key_len, u32 hash)
+{
+	u32 pos;
+
+	if (!Kv_rw(s, Kv_slot(hash), &pos, 4, 0))
+		return 0;
+	return Kv_chain(s, pos, key, key_len, hash);
+}
+// --------------------------------------------------------------------
+//buf holds hash, lengths, key and value; the rest is filled in here.
+//Without sync the caller writes the header and syncs when it is done.
+static u32 Kv_append(KV *s, u8 *buf, u32 sync)
+{
+	KV_REC *rec = (KV_REC *)buf;
+	u32 size = Kv_size(rec->key_len, rec->val_len);
+	u32 pos = Kv_place(s->head.log_end, size);
+	u32 slot = Kv_slot(rec->hash);
+
+	rec->magic = KV_REC_MAGIC;
+	rec->pos = pos;
+	rec->gen = s->head.gen;
+	if (!Kv_rw(s, slot, &rec->prev, 4, 0))
+		return 0;
+	rec->crc = Kv_crc(rec);
+	if (!Kv_rw(s, pos, buf, size, 1))
+		return 0;
+	if (sync && f_sync(&s->file) != FR_OK)
+		return 0;
+	//the record is on the card, now let the index point at it
+	if (!Kv_rw(s, slot, &pos, 4, 1))
+		return 0;
+	s->head.log_end = pos + size;
+	s->head.records++;
+	if (!sync)
+		return 1;
+	if (!Kv_rw(s, 0, &s->head, sizeof(KV_HEAD), 1))
+		return 0;
+	return f_sync(&s->file) == FR_OK;
+}
+// --------------------------------------------------------------------
+static u32 Kv_create(KV *s, const char *path, u32 gen)
+{
+	u32 pos;
+	if (f_open(&s->file, path, FA_READ | FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+		return 0;
+	memset(kv_buf, 0, KV_SECTOR);
+	for (pos = 0; pos < KV_LOG; pos += KV_SECTOR) {
+		if (!Kv_rw(s, pos, kv_buf, KV_SECTOR, 1))
+			goto fail;
+	}
+	s->head.magic = KV_MAGIC;
+	s->head.gen = gen;
+	s->head.log_end = KV_LOG;
+	s->head.records = 0;
+	s->head.keys = 0;
+	if (Kv_rw(s, 0, &s->head, sizeof(KV_HEAD), 1) && f_sync(&s->file) == FR_OK)
+		return 1;
+fail:
+	f_close(&s->file);
+	return 0;
+}
+// --------------------------------------------------------------------
+//roll forward records a cut off put left behind the header; a record is a
+//new key when the chain it was put in front of doesn't have it yet, the
+//index may already point at the record itself
+static void Kv_recover(KV *s)
+{
+	KV_REC *rec = (KV_REC *)kv_buf;
+	u32 pos, size, dirty = 0;
+
+	while (1) {
+		pos = s->head.log_end;
+		size = Kv_read(s, pos, kv_buf);
+		if (!size && (pos & (KV_SECTOR - 1))) {
+			pos = (pos + KV_SECTOR - 1) & ~(KV_SECTOR - 1);
+			size = Kv_read(s, pos, kv_buf);
+		}
+		if (!size || !Kv_rw(s, Kv_slot(rec->hash), &pos, 4, 1))
+			break;
+		if (!Kv_chain(s, rec->prev, kv_buf + sizeof(KV_REC), rec->key_len, rec->hash))
+			s->head.keys++;
+		s->head.log_end = pos + size;
+		s->head.records++;
+		dirty = 1;
+	}
+	if (dirty && Kv_rw(s, 0, &s->head, sizeof(KV_HEAD), 1))
+		f_sync(&s->file);
+}
+// --------------------------------------------------------------------
+static u32 Kv_mount(void)
+{
+	FILINFO info;
+
+	if (kv_mounted)
+		return 1;
+	//a compaction that got as far as removing the old store
+	if (f_stat(KV_FILE, &info) != FR_OK && f_stat(KV_NEW, &info) == FR_OK)
+		f_rename(KV_NEW, KV_FILE);
+	else
+		f_unlink(KV_NEW);
+
+	if (f_open(&kv.file, KV_FILE, FA_READ | FA_WRITE | FA_OPEN_EXISTING) == FR_OK) {
+		if (Kv_rw(&kv, 0, &kv.head, sizeof(KV_HEAD), 0) && kv.head.magic == KV_MAGIC
+		    && kv.head.log_end >= KV_LOG) {
+			Kv_recover(&kv);
+			kv_mounted = 1;
+			return 1;
+		}
+		f_close(&kv.file);
+	}
+	//missing or unreadable: start over, every record can be made again
+	f_mkdir("/SYSTEM");
+	kv_mounted = Kv_create(&kv, KV_FILE, 1);
+	return kv_mounted;
+}
+// --------------------------------------------------------------------
+//copy the newest record of every key to a fresh store and swap it in
+static void Kv_compact(void)
+{
+	KV_REC *rec = (KV_REC *)kv_buf;
+	u32 bucket, pos, prev;
+
+	if (!Kv_create(&kv_new, KV_NEW, kv.head.gen + 1))
+		return;
+	for (bucket = 0; bucket < KV_BUCKETS; bucket++) {
+		if (!Kv_rw(&kv, Kv_slot(bucket), &pos, 4, 0))
+			goto fail;
+		//newest first, so the first record of a key is the one to keep
+		while (pos && Kv_read(&kv, pos, kv_buf)) {
+			prev = rec->prev;
+			if (!Kv_find(&kv_new, kv_buf + sizeof(KV_REC), rec->key_len, rec->hash)) {
+				kv_new.head.keys++;
+				if (!Kv_append(&kv_new, kv_buf, 0))
+					goto fail;
+			}
+			if (prev >= pos)
+				break;
+			pos = prev;
+		}
+	}
+	if (!Kv_rw(&kv_new, 0, &kv_new.head, sizeof(KV_HEAD), 1) || f_sync(&kv_new.file) != FR_OK)
+		goto fail;
+	f_close(&kv_new.file);
+	Kv_close();
+	if (f_unlink(KV_FILE) == FR_OK)
+		f_rename(KV_NEW, KV_FILE);
+	Kv_mount();
+	return;
+fail:
+	f_close(&kv_new.file);
+	f_unlink(KV_NEW);
+}
+// --------------------------------------------------------------------
+u32 Kv_get(u8 tag, const TCHAR *key, void *val, u32 size)
+{
+	KV_REC *rec = (KV_REC *)kv_buf;
+	u8 name[KV_KEY_MAX];
+	u32 len, pos;
+
+	len = Kv_key(name, tag, key);
+	if (!len || !Kv_mount())
+		return 0;
+	pos = Kv_find(&kv, name, len, Kv_hash(name, len));
+	if (!pos || !Kv_read(&kv, pos, kv_buf))
+		return 0;
+	if (size > rec->val_len)
+		size = rec->val_len;
+	memcpy(val, kv_buf + sizeof(KV_REC) + len, size);
+	return rec->val_len;
+}
+// --------------------------------------------------------------------
+u32 Kv_put(u8 tag, const TCHAR *key, const void *val, u32 len)
+{
+	KV_REC *rec = (KV_REC *)kv_buf;
+	u8 *data = kv_buf + sizeof(KV_REC);
+	u32 key_len, hash, pos;
+
+	//mounting may use kv_buf, so build the key after it
+	if (len > KV_VAL_MAX || !Kv_mount())
+		return 0;
+	key_len = Kv_key(data, tag, key);
+	if (!key_len)
+		return 0;
+	hash = Kv_hash(data, key_len);
+	pos = Kv_find(&kv, data, key_len, hash);
+	//an unchanged value costs no write
+	if (pos && Kv_read(&kv, pos, kv_buf) && rec->val_len == len
+	    && memcmp(data + key_len, val, len) == 0)
+		return 1;
+
+	Kv_key(data, tag, key);
+	memcpy(data + key_len, val, len);
+	rec->hash = hash;
+	rec->key_len = key_len;
+	rec->val_len = len;
+	if (!pos)
+		kv.head.keys++;
+	if (!Kv_append(&kv, kv_buf, 1))
+		return 0;
+	if (kv.head.log_end > KV_COMPACT_MIN && kv.head.records > 2 * kv.head.keys)
+		Kv_compact();
+	return 1;
+}
+// --------------------------------------------------------------------
+void Kv_close(void)
+{
+	if (kv_mounted)
+		f_close(&kv.file);
+	kv_mounted = 0;
+}
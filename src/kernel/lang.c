@@ -84,12 +84,20 @@ char* gl_error_3;
 char* gl_error_4;
 char* gl_error_5;
 char* gl_error_6;
+char* gl_error_7;
+char* gl_error_8;
+char* gl_error_9;
 //--
 char**  gl_rom_menu;
 char**  gl_more_options;
 char**  gl_nor_op;
 
 char* gl_copying_data;
+char* gl_find_title;
+char* gl_find_none;
+char* gl_cheat_full;
+char* gl_library_empty;
+char** gl_library_view;
 
 unsigned char* ASC_DATA;
 
@@ -171,8 +179,21 @@ const char zh_error_3[]="�浵����";
 const char zh_error_4[]="��ȡ�浵����";
 const char zh_error_5[]="�����浵����";
 const char zh_error_6[]="RTS�ļ�����";
+const char zh_error_7[]="У";
+const char zh_error_8[]="CRC";
+const char zh_error_9[]="ڴ治";
 
 const char zh_copying_data[]="����ROM...";
+const char zh_find_title[]="";
+const char zh_find_none[]="ƥ";
+const char zh_cheat_full[]="ָռ䲻,δ";
+const char zh_library_empty[]="Ϸ⽨,Ժٿ";
+const char *zh_library_view[4]={
+	"ȫGBA",
+	"ȫGB/GBC",
+	"ȫNES",
+	"ȫϷ",
+};
 const char zh_generating_emu[]="����ģ����...";
 
 const char *zh_rom_menu[]={
@@ -189,11 +210,13 @@ const char *zh_nor_op[3]={
 	"ȫ����ʽ��",
 };
 
-const char *zh_more_options[4]={
+const char *zh_more_options[6]={
 	"�л�����ͼ",
 	"ʹ��BIOS��?",
 	"�л�����",
 	"�л�����",
+	"У",
+	"浵Ŀ¼",
 };
 
 //English
@@ -275,8 +298,21 @@ const char en_error_3[]="Save error";
 const char en_error_4[]="Read save error";
 const char en_error_5[]="Make save error";
 const char en_error_6[]="RTS file error";
+const char en_error_7[]="Verify error";
+const char en_error_8[]="Bad dump (DAT)";
+const char en_error_9[]="Out of memory";
 
 const char en_copying_data[]="Copying ROM...";
+const char en_find_title[]="Find";
+const char en_find_none[]="No match";
+const char en_cheat_full[]="Out of cheat space, some cheats are off";
+const char en_library_empty[]="Library is still being built...";
+const char *en_library_view[4]={
+	"All GBA",
+	"All GB/GBC",
+	"All NES",
+	"All plugin games",
+};
 const char en_generating_emu[]="Generating Emulator...";
 
 const char *en_rom_menu[] = {
@@ -292,11 +328,13 @@ const char *en_nor_op[3]={
 	"Delete",
 	"Format all",
 };	
-const char *en_more_options[4]={
+const char *en_more_options[6]={
 	"Toggle thumbnail",
 	"Use BIOS intro",
 	"Backup saves",
 	"Toggle bold",
+	"Verify after load",
+	"Shard saves",
 	//Start Random Game
 };
 
@@ -380,12 +418,20 @@ void LoadChinese(void)
 	gl_error_4 = (char*)zh_error_4;
 	gl_error_5 = (char*)zh_error_5;
 	gl_error_6 = (char*)zh_error_6;
+	gl_error_7 = (char*)zh_error_7;
+	gl_error_8 = (char*)zh_error_8;
+	gl_error_9 = (char*)zh_error_9;
 	//
 	gl_rom_menu = (char**)zh_rom_menu;
 	gl_more_options = (char**)zh_more_options;
 	gl_nor_op = (char**)zh_nor_op;
 	
 	gl_copying_data = (char*)zh_copying_data;
+	gl_find_title = (char*)zh_find_title;
+	gl_find_none = (char*)zh_find_none;
+	gl_cheat_full = (char*)zh_cheat_full;
+	gl_library_empty = (char*)zh_library_empty;
+	gl_library_view = (char**)zh_library_view;
 
 	gl_generating_emu = (char*)zh_generating_emu;
 
@@ -471,12 +517,20 @@ void LoadEnglish(void)
 	gl_error_4 = (char*)en_error_4;
 	gl_error_5 = (char*)en_error_5;
 	gl_error_6 = (char*)en_error_6;
+	gl_error_7 = (char*)en_error_7;
+	gl_error_8 = (char*)en_error_8;
+	gl_error_9 = (char*)en_error_9;
 	//
 	gl_rom_menu = (char**)en_rom_menu;
 	gl_nor_op = (char**)en_nor_op;
 	gl_more_options = (char**)en_more_options;
 	
 	gl_copying_data = (char*)en_copying_data;
+	gl_find_title = (char*)en_find_title;
+	gl_find_none = (char*)en_find_none;
+	gl_cheat_full = (char*)en_cheat_full;
+	gl_library_empty = (char*)en_library_empty;
+	gl_library_view = (char**)en_library_view;
 	
 	gl_generating_emu = (char*)en_generating_emu;
 
@@ -0,0 +1,525 @@
+#include <stdio.h>
+#include <string.h>
+#include <gba_base.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "scratch.h"
+#include "library.h"
+
+#define LIB_MAGIC 0x3242494C	//"LIB2", UTF-8 names
+#define LIB_SLICE 16			//directory entries per step
+#define LIB_PLUGS 32
+#define LIB_NONE 0xFF
+
+typedef struct {
+	u32 magic;
+	u32 dirs;
+	u32 files;
+	u32 view_ofs;		//file offset of the sorted record numbers
+	u32 view_first[LIB_VIEWS];
+	u32 view_count[LIB_VIEWS];
+} LIB_HEAD;
+
+typedef struct {
+	u16 fdate;			//0 for the root, which has no entry of its own
+	u16 ftime;
+	u16 first;			//its records
+	u16 count;
+	char path[248];
+} LIB_DIR;
+
+//header sector, path hashes, folder table, records, view tables
+#define LIB_HASH_OFS 0x200
+#define LIB_DIR_OFS (LIB_HASH_OFS + LIB_MAX_DIRS * 4)
+#define LIB_FILE_OFS (LIB_DIR_OFS + LIB_MAX_DIRS * sizeof(LIB_DIR))
+
+#define LIB_FOLD(c) (((c) >= 'a' && (c) <= 'z') ? (c) - ('a' - 'A') : (c))
+
+typedef struct {
+	DIR dir;
+	u16 id;
+	u16 len;			//length of its path
+	u16 fdate;
+	u16 ftime;
+	u16 first;
+	u16 old_next;		//old records still to match, in order
+	u16 old_end;
+	u8 pass;			//0 files, 1 subfolders
+} LIB_LEVEL;
+
+enum {
+	LIB_START = 0,
+	LIB_WALK,
+	LIB_FINISH,
+	LIB_DONE
+};
+
+static struct {
+	u32 state;
+	u32 changed;
+	u32 depth;
+	u32 dirs;
+	u32 files;
+	u32 count[LIB_VIEWS];
+	u32 plugs;
+	char plug[LIB_PLUGS][8];
+	TCHAR path[MAX_path_len];
+	LIB_LEVEL level[LIB_DEPTH + 1];
+	LIB_HEAD old_head;
+	u32 old_hash[LIB_MAX_DIRS];
+	u32 hash[LIB_MAX_DIRS];
+	FILINFO info;
+	FIL old;
+	FIL new;
+	FIL rom;
+} lib EWRAM_BSS;
+
+static FIL lib_view EWRAM_BSS;
+static LIB_HEAD lib_head;
+static u32 lib_opened = 0;
+
+// --------------------------------------------------------------------
+static u32 Library_read(FIL *file, u32 ofs, void *buf, u32 len)
+{
+	UINT done;
+	return f_lseek(file, ofs) == FR_OK && f_read(file, buf, len, &done) == FR_OK && done == len;
+}
+// --------------------------------------------------------------------
+static u32 Library_write(FIL *file, u32 ofs, const void *buf, u32 len)
+{
+	UINT done;
+	return f_lseek(file, ofs) == FR_OK && f_write(file, buf, len, &done) == FR_OK && done == len;
+}
+// --------------------------------------------------------------------
+static u32 Library_hash(const TCHAR *path)
+{
+	u32 hash = 0x811C9DC5;
+	while (*path)
+		hash = (hash ^ (u8)*path++) * 0x01000193;
+	return hash;
+}
+// --------------------------------------------------------------------
+//view of a file name, LIB_NONE when it is not launchable
+static u32 Library_type(const TCHAR *name)
+{
+	const TCHAR *ext = strrchr(name, '.');
+	u32 i;
+
+	if (ext == NULL)
+		return LIB_NONE;
+	ext++;
+	if (!strcasecmp(ext, "gba") || !strcasecmp(ext, "agb") || !strcasecmp(ext, "mb"))
+		return LIB_GBA;
+	if (!strcasecmp(ext, "gb") || !strcasecmp(ext, "gbc"))
+		return LIB_GB;
+	if (!strcasecmp(ext, "nes"))
+		return LIB_NES;
+	for (i = 0; i < lib.plugs; i++) {
+		if (!strcasecmp(ext, lib.plug[i]))
+			return LIB_PLUG;
+	}
+	return LIB_NONE;
+}
+// --------------------------------------------------------------------
+//extensions that have a plugin, from the names in /SYSTEM/PLUG
+static void Library_plugins(void)
+{
+	DIR dir;
+	u32 len, i;
+
+	lib.plugs = 0;
+	if (f_opendir(&dir, "/SYSTEM/PLUG") != FR_OK)
+		return;
+	while (lib.plugs < LIB_PLUGS && f_readdir(&dir, &lib.info) == FR_OK && lib.info.fname[0]) {
+		TCHAR *dot = strrchr(lib.info.fname, '.');
+		if (dot == NULL || (lib.info.fattrib & AM_DIR))
+			continue;
+		len = dot - lib.info.fname;
+		if (len == 0 || len >= sizeof(lib.plug[0]))
+			continue;
+		memcpy(lib.plug[lib.plugs], lib.info.fname, len);
+		lib.plug[lib.plugs][len] = 0;
+		for (i = 0; i < lib.plugs; i++) {
+			if (!strcasecmp(lib.plug[i], lib.plug[lib.plugs]))
+				break;
+		}
+		if (i == lib.plugs)
+			lib.plugs++;
+	}
+	f_closedir(&dir);
+}
+// --------------------------------------------------------------------
+//descends into lib.path, the caller restores the path when it fails
+static u32 Library_push(u16 fdate, u16 ftime)
+{
+	LIB_LEVEL *level = &lib.level[lib.depth];
+	u32 hash = Library_hash(lib.path);
+	LIB_DIR old;
+	u32 i;
+
+	if (lib.dirs >= LIB_MAX_DIRS || f_opendir(&level->dir, lib.path) != FR_OK) {
+		lib.changed = 1;
+		return 0;
+	}
+	level->id = lib.dirs;
+	level->len = strlen(lib.path);
+	level->fdate = fdate;
+	level->ftime = ftime;
+	level->first = lib.files;
+	level->old_next = 0;
+	level->old_end = 0;
+	level->pass = 0;
+	lib.hash[lib.dirs++] = hash;
+	lib.depth++;
+	for (i = 0; i < lib.old_head.dirs; i++) {
+		if (lib.old_hash[i] == hash && Library_read(&lib.old, LIB_DIR_OFS + i * sizeof(LIB_DIR), &old, sizeof(old)) && !strcmp(old.path, lib.path))
+			break;
+	}
+	if (i < lib.old_head.dirs && old.fdate == fdate && old.ftime == ftime) {
+		level->old_next = old.first;
+		level->old_end = old.first + old.count;
+	}
+	else {
+		lib.changed = 1;	//new or touched
+	}
+	return 1;
+}
+// --------------------------------------------------------------------
+//folder record, once its files are in
+static void Library_put_dir(LIB_LEVEL *level)
+{
+	LIB_DIR dir;
+
+	memset(&dir, 0, sizeof(dir));
+	dir.fdate = level->fdate;
+	dir.ftime = level->ftime;
+	dir.first = level->first;
+	dir.count = lib.files - level->first;
+	strcpy(dir.path, lib.path);
+	if (level->old_next != level->old_end)
+		lib.changed = 1;	//files gone
+	if (!Library_write(&lib.new, LIB_DIR_OFS + level->id * sizeof(LIB_DIR), &dir, sizeof(dir)))
+		lib.state = LIB_DONE;
+}
+// --------------------------------------------------------------------
+static void Library_code(const TCHAR *name, char *code)
+{
+	TCHAR rom[MAX_path_len + 8];
+	UINT done;
+
+	sprintf(rom, "%s/%s", (lib.path[1] == 0) ? "" : lib.path, name);
+	memset(code, 0, 4);
+	if (f_open(&lib.rom, rom, FA_READ) == FR_OK) {
+		if (f_lseek(&lib.rom, 0xAC) != FR_OK || f_read(&lib.rom, code, 4, &done) != FR_OK || done != 4)
+			memset(code, 0, 4);
+		f_close(&lib.rom);
+	}
+}
+// --------------------------------------------------------------------
+//file record, 1 when a ROM header had to be read
+static u32 Library_put_file(LIB_LEVEL *level, const FILINFO *info)
+{
+	LIB_ENTRY entry, old;
+	u32 type = Library_type(info->fname);
+	u32 heavy = 0;
+
+	if (type == LIB_NONE || strlen(info->fname) >= sizeof(entry.name) || lib.files >= LIB_MAX_FILES)
+		return 0;
+	memset(&entry, 0, sizeof(entry));
+	entry.size = info->fsize;
+	entry.fdate = info->fdate;
+	entry.ftime = info->ftime;
+	entry.dir = level->id;
+	entry.type = type;
+	strcpy(entry.name, info->fname);
+	//an unchanged folder lists its files in the same order; on a miss
+	//the old record waits for the next file, so an added file costs one read
+	if (level->old_next < level->old_end
+		&& Library_read(&lib.old, LIB_FILE_OFS + level->old_next * sizeof(LIB_ENTRY), &old, sizeof(old))
+		&& old.size == entry.size && old.fdate == entry.fdate && old.ftime == entry.ftime && !strcmp(old.name, entry.name)) {
+		memcpy(entry.code, old.code, 4);
+		level->old_next++;
+	}
+	else {
+		lib.changed = 1;
+		if (type == LIB_GBA) {
+			Library_code(entry.name, entry.code);
+			heavy = 1;
+		}
+	}
+	if (!Library_write(&lib.new, LIB_FILE_OFS + lib.files * sizeof(LIB_ENTRY), &entry, sizeof(entry))) {
+		lib.state = LIB_DONE;
+		return 1;
+	}
+	//the first record allocates everything below LIB_FILE_OFS, commit that
+	//chain now instead of leaving it dirty across the idle frames
+	if (lib.files == 0 && f_sync(&lib.new) != FR_OK) {
+		lib.state = LIB_DONE;
+		return 1;
+	}
+	lib.count[type]++;
+	lib.files++;
+	return heavy;
+}
+// --------------------------------------------------------------------
+static void Library_start(void)
+{
+	lib.state = LIB_DONE;
+	lib.changed = 0;
+	lib.depth = 0;
+	lib.dirs = 0;
+	lib.files = 0;
+	memset(lib.count, 0, sizeof(lib.count));
+	memset(&lib.old_head, 0, sizeof(lib.old_head));
+	Library_plugins();
+	if (f_open(&lib.old, LIB_FILE, FA_READ) == FR_OK) {
+		if (!Library_read(&lib.old, 0, &lib.old_head, sizeof(lib.old_head)) || lib.old_head.magic != LIB_MAGIC
+			|| lib.old_head.dirs > LIB_MAX_DIRS || !Library_read(&lib.old, LIB_HASH_OFS, lib.old_hash, lib.old_head.dirs * 4))
+			memset(&lib.old_head, 0, sizeof(lib.old_head));
+	}
+	if (lib.old_head.magic != LIB_MAGIC)
+		lib.changed = 1;
+	f_mkdir("/SYSTEM");
+	if (f_open(&lib.new, LIB_NEW, FA_CREATE_ALWAYS | FA_READ | FA_WRITE) != FR_OK) {
+		f_close(&lib.old);
+		return;
+	}
+	strcpy(lib.path, "/");
+	Library_push(0, 0);
+	lib.state = LIB_WALK;
+}
+// --------------------------------------------------------------------
+static void Library_walk(void)
+{
+	u32 n, len;
+
+	for (n = 0; n < LIB_SLICE && lib.state == LIB_WALK; n++) {
+		LIB_LEVEL *level = &lib.level[lib.depth - 1];
+		FILINFO *info = &lib.info;
+		if (f_readdir(&level->dir, info) != FR_OK || info->fname[0] == 0) {
+			if (level->pass == 0) {
+				Library_put_dir(level);
+				f_readdir(&level->dir, NULL);	//rewind for the subfolders
+				level->pass = 1;
+				continue;
+			}
+			f_closedir(&level->dir);
+			if (--lib.depth == 0) {
+				lib.state = LIB_FINISH;
+				return;
+			}
+			lib.path[lib.level[lib.depth - 1].len] = 0;
+			continue;
+		}
+		if (level->pass == 0) {
+			if (info->fattrib == AM_ARC && Library_put_file(level, info))
+				return;
+			continue;
+		}
+		if (!(info->fattrib & AM_DIR) || (info->fattrib & (AM_HID | AM_SYS)) || info->fname[0] == '.')
+			continue;
+		if (lib.depth > LIB_DEPTH || (lib.depth == 1 && !strcasecmp(info->fname, "SYSTEM")))
+			continue;
+		len = level->len;
+		if (len + 1 + strlen(info->fname) >= sizeof(((LIB_DIR*)0)->path))
+			continue;
+		if (len > 1)
+			lib.path[len++] = '/';
+		strcpy(lib.path + len, info->fname);
+		if (!Library_push(info->fdate, info->ftime))
+			lib.path[level->len] = 0;
+	}
+}
+// --------------------------------------------------------------------
+//record numbers of each view by name; names that do not fit in the
+//scratch area keep walk order after the sorted ones
+static u32 Library_sort(LIB_HEAD *head)
+{
+	static const u16 gaps[] = { 1093, 364, 121, 40, 13, 4, 1 };
+	u16 *id;
+	u32 *ofs;
+	u8 *pool;
+	u32 fill[LIB_VIEWS];
+	u32 used, i, j, k, g, v;
+	LIB_ENTRY entry;
+	int d;
+
+	pool = Scratch_alloc(MAX_pReadCache_size, "library");
+	if (pool == NULL)
+		return 0;
+	id = (u16*)pool;
+	ofs = (u32*)(pool + LIB_MAX_FILES * 2);
+	used = LIB_MAX_FILES * 6;
+	for (v = 0, j = 0; v < LIB_VIEWS; v++) {
+		head->view_first[v] = j;
+		head->view_count[v] = lib.count[v];
+		fill[v] = j;
+		j += lib.count[v];
+	}
+	for (i = 0; i < lib.files; i++) {
+		if (!Library_read(&lib.new, LIB_FILE_OFS + i * sizeof(LIB_ENTRY), &entry, sizeof(entry)) || entry.type >= LIB_VIEWS) {
+			Scratch_release(pool);
+			return 0;
+		}
+		k = fill[entry.type]++;
+		id[k] = i;
+		ofs[k] = 0;
+		j = strlen(entry.name) + 1;
+		if (used + j <= MAX_pReadCache_size) {
+			memcpy(pool + used, entry.name, j);
+			ofs[k] = used;
+			used += j;
+		}
+	}
+	for (v = 0; v < LIB_VIEWS; v++) {
+		u16 *vid = id + head->view_first[v];
+		u32 *vofs = ofs + head->view_first[v];
+		u32 total = head->view_count[v];
+		for (g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+			u32 gap = gaps[g];
+			for (i = gap; i < total; i++) {
+				u16 cur_id = vid[i];
+				u32 cur = vofs[i];
+				for (j = i; j >= gap; j -= gap) {
+					u32 prev = vofs[j - gap];
+					if (prev == 0 || cur == 0) {
+						if (prev != 0 || (cur == 0 && vid[j - gap] < cur_id))
+							break;
+					}
+					else {
+						const u8 *a = pool + prev, *b = pool + cur;
+						for (k = 0; (d = LIB_FOLD(a[k]) - LIB_FOLD(b[k])) == 0 && b[k]; k++)
+							;
+						if (d < 0 || (d == 0 && vid[j - gap] < cur_id))
+							break;
+					}
+					vid[j] = vid[j - gap];
+					vofs[j] = prev;
+				}
+				vid[j] = cur_id;
+				vofs[j] = cur;
+			}
+		}
+	}
+	head->view_ofs = LIB_FILE_OFS + lib.files * sizeof(LIB_ENTRY);
+	i = Library_write(&lib.new, head->view_ofs, id, lib.files * 2);
+	Scratch_release(pool);
+	return i;
+}
+// --------------------------------------------------------------------
+static void Library_finish(void)
+{
+	LIB_HEAD head;
+
+	if (lib.dirs != lib.old_head.dirs || lib.files != lib.old_head.files)
+		lib.changed = 1;
+	f_close(&lib.old);
+	memset(&head, 0, sizeof(head));
+	if (lib.changed && Library_sort(&head) && Library_write(&lib.new, LIB_HASH_OFS, lib.hash, lib.dirs * 4)) {
+		head.magic = LIB_MAGIC;
+		head.dirs = lib.dirs;
+		head.files = lib.files;
+		if (Library_write(&lib.new, 0, &head, sizeof(head)) && f_close(&lib.new) == FR_OK) {
+			Library_close();
+			f_unlink(LIB_FILE);
+			f_rename(LIB_NEW, LIB_FILE);
+			return;
+		}
+	}
+	f_close(&lib.new);
+	f_unlink(LIB_NEW);
+}
+// --------------------------------------------------------------------
+u32 Library_step(void)
+{
+	switch (lib.state) {
+	case LIB_START:
+		Library_start();
+		break;
+	case LIB_WALK:
+		Library_walk();
+		if (lib.state == LIB_DONE) {	//write failed
+			f_close(&lib.old);
+			f_close(&lib.new);
+			f_unlink(LIB_NEW);
+		}
+		break;
+	case LIB_FINISH:
+		Library_finish();
+		lib.state = LIB_DONE;
+		break;
+	default:
+		return 0;
+	}
+	return 1;
+}
+// --------------------------------------------------------------------
+void Library_abort(void)
+{
+	u32 i;
+
+	if (lib.state == LIB_WALK || lib.state == LIB_FINISH) {
+		for (i = 0; i < lib.depth; i++)
+			f_closedir(&lib.level[i].dir);
+		f_close(&lib.old);
+		f_close(&lib.new);
+		lib.state = LIB_START;	//a launch that comes back walks again
+	}
+	f_unlink(LIB_NEW);
+}
+// --------------------------------------------------------------------
+static u32 Library_open(void)
+{
+	if (lib_opened)
+		return 1;
+	if (f_open(&lib_view, LIB_FILE, FA_READ) != FR_OK)
+		return 0;
+	if (!Library_read(&lib_view, 0, &lib_head, sizeof(lib_head)) || lib_head.magic != LIB_MAGIC) {
+		f_close(&lib_view);
+		return 0;
+	}
+	lib_opened = 1;
+	return 1;
+}
+// --------------------------------------------------------------------
+void Library_close(void)
+{
+	if (lib_opened) {
+		f_close(&lib_view);
+		lib_opened = 0;
+	}
+}
+// --------------------------------------------------------------------
+u32 Library_count(u32 view)
+{
+	if (view >= LIB_VIEWS || !Library_open())
+		return 0;
+	return lib_head.view_count[view];
+}
+// --------------------------------------------------------------------
+u32 Library_get(u32 view, u32 n, LIB_ENTRY *entry)
+{
+	u16 id;
+
+	if (n >= Library_count(view))
+		return 0;
+	if (!Library_read(&lib_view, lib_head.view_ofs + (lib_head.view_first[view] + n) * 2, &id, 2) || id >= lib_head.files)
+		return 0;
+	return Library_read(&lib_view, LIB_FILE_OFS + id * sizeof(LIB_ENTRY), entry, sizeof(LIB_ENTRY));
+}
+// --------------------------------------------------------------------
+u32 Library_path(const LIB_ENTRY *entry, TCHAR *path, u32 size)
+{
+	LIB_DIR dir;
+
+	if (!Library_open() || entry->dir >= lib_head.dirs)
+		return 0;
+	if (!Library_read(&lib_view, LIB_DIR_OFS + entry->dir * sizeof(LIB_DIR), &dir, sizeof(dir)))
+		return 0;
+	dir.path[sizeof(dir.path) - 1] = 0;
+	if (strlen(dir.path) + strlen(entry->name) + 2 > size)
+		return 0;
+	sprintf(path, "%s/%s", (dir.path[1] == 0) ? "" : dir.path, entry->name);
+	return 1;
+}
@@ -0,0 +1,485 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+#include <gba_timers.h>
+#include <gba_interrupt.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "gfx/progress.h"
+#include "driver/sd_card.h"
+#include "driver/nor_flash.h"
+#include "patch/gba_patch.h"
+#include "scratch.h"
+#include "crc32.h"
+#include "loader.h"
+
+extern void PatchInternal(u32* Data,int iSize,u32 offset);
+extern u32 gl_currentpage;
+
+// --------------------------------------------------------------------
+// sources
+
+static u32 Load_file_read(LOAD_SOURCE *src, u8 *buf, u32 offset, u32 size)
+{
+	UINT ret = 0;
+	if (f_tell(src->file) != offset)
+		f_lseek(src->file, offset);
+	f_read(src->file, buf, size, &ret);
+	return ret;
+}
+
+void Load_source_file(LOAD_SOURCE *src, FIL *file)
+{
+	src->read = Load_file_read;
+	src->size = f_size(file);
+	src->file = file;
+	src->data = NULL;
+}
+
+static u32 Load_mem_read(LOAD_SOURCE *src, u8 *buf, u32 offset, u32 size)
+{
+	if (offset + size > src->size)
+		size = src->size - offset;
+	dmaCopy(src->data + offset, buf, (size + 3) & ~3);
+	return size;
+}
+
+void Load_source_mem(LOAD_SOURCE *src, const void *data, u32 size)
+{
+	src->read = Load_mem_read;
+	src->size = size;
+	src->file = NULL;
+	src->data = data;
+}
+
+// --------------------------------------------------------------------
+// sinks
+
+//page the 8MB PSRAM window in 4MB steps so an unaligned base never runs off the end
+static u32 IWRAM_CODE Load_psram_write(LOAD_SINK *dst, u8 *buf, u32 offset, u32 size)
+{
+	u32 Address = dst->base + offset;
+	u16 page = 0;
+	while (Address >= 0x400000) {
+		Address -= 0x400000;
+		page += 0x800;
+	}
+	SetPSRampage(page);
+	dmaCopy(buf, PSRAMBase_S98 + Address, size);
+	return 0;
+}
+
+//runs right after the write, the page is still mapped
+static u32 Load_psram_check(LOAD_SINK *dst, u32 offset, u32 size)
+{
+	return Crc32_update(0, PSRAMBase_S98 + ((dst->base + offset) & 0x3FFFFF), size);
+}
+
+void Load_sink_psram(LOAD_SINK *dst, u32 base)
+{
+	dst->write = Load_psram_write;
+	dst->check = Load_psram_check;
+	dst->prepare = NULL;
+	dst->base = base;
+	dst->file = NULL;
+}
+
+//the block erase is started before the source reads the block and runs
+//in the chip meanwhile
+static void Load_nor_prepare(LOAD_SINK *dst, u32 offset)
+{
+	Block_Erase_start(dst->base + offset);
+}
+
+static u32 Load_nor_write(LOAD_SINK *dst, u8 *buf, u32 offset, u32 size)
+{
+	Block_Erase_wait(dst->base + offset);
+	WriteFlash_with32word(dst->base + offset, buf, size);
+	return 0;
+}
+
+static u32 Load_nor_check(LOAD_SINK *dst, u32 offset, u32 size)
+{
+	u32 Address = dst->base + offset;
+	u16 page = gl_currentpage;
+	u32 crc;
+	while (Address >= 0x800000) {
+		Address -= 0x800000;
+		page += 0x1000;
+	}
+	SetRompage(page);
+	crc = Crc32_update(0, (void *)(FlashBase_S98 + Address), size);
+	SetRompage(gl_currentpage);
+	return crc;
+}
+
+void Load_sink_nor(LOAD_SINK *dst, u32 base)
+{
+	dst->write = Load_nor_write;
+	dst->check = Load_nor_check;
+	dst->prepare = Load_nor_prepare;
+	dst->base = base;
+	dst->file = NULL;
+}
+
+static u32 Load_file_write(LOAD_SINK *dst, u8 *buf, u32 offset, u32 size)
+{
+	UINT written;
+	if (f_tell(dst->file) != dst->base + offset)
+		f_lseek(dst->file, dst->base + offset);
+	if (f_write(dst->file, buf, size, &written) != FR_OK || written != size)
+		return 1;
+	return 0;
+}
+
+void Load_sink_file(LOAD_SINK *dst, FIL *file)
+{
+	dst->write = Load_file_write;
+	dst->check = NULL;
+	dst->prepare = NULL;
+	dst->base = 0;
+	dst->file = file;
+}
+
+static u32 Load_null_write(LOAD_SINK *dst, u8 *buf, u32 offset, u32 size)
+{
+	return 0;
+}
+
+//discards the data, for timing a source or transform on its own
+void Load_sink_null(LOAD_SINK *dst)
+{
+	dst->write = Load_null_write;
+	dst->check = NULL;
+	dst->prepare = NULL;
+	dst->base = 0;
+	dst->file = NULL;
+}
+
+// --------------------------------------------------------------------
+// transforms
+
+void Load_patch_internal(u8 *buf, u32 size, u32 offset)
+{
+	PatchInternal((u32*)buf, size, offset);
+}
+
+void Load_patch_NOR(u8 *buf, u32 size, u32 offset)
+{
+	GBApatch_NOR((u32*)buf, size, offset);
+}
+
+void Load_patch_cleanrom_NOR(u8 *buf, u32 size, u32 offset)
+{
+	GBApatch_Cleanrom_NOR((u32*)buf, offset);
+}
+
+// --------------------------------------------------------------------
+void Load_pipe_init(LOAD_PIPE *pipe, LOAD_SOURCE *src, LOAD_SINK *dst)
+{
+	memset(pipe, 0, sizeof(LOAD_PIPE));
+	pipe->src = src;
+	pipe->dst = dst;
+}
+
+void Load_pipe_add(LOAD_PIPE *pipe, LOAD_TRANSFORM transform)
+{
+	if (pipe->transform_count < LOAD_MAX_TRANSFORM)
+		pipe->transform[pipe->transform_count++] = transform;
+}
+
+#ifdef EMU
+//timer 3 belongs to the fake RTC
+#define Load_clock_start()
+#define Load_clock_stop()
+#define Load_clock() 0
+#else
+//16 bits of 256 cycles wrap after a second, a NOR block erase and write
+//can take longer: the overflow IRQ keeps the upper half
+static vu32 load_clock_high;
+
+static void IWRAM_CODE Load_clock_wrap(void)
+{
+	load_clock_high += 0x10000;
+}
+
+static void Load_clock_start(void)
+{
+	REG_TM3CNT_H = 0;
+	REG_TM3CNT_L = 0;
+	load_clock_high = 0;
+	irqSet(IRQ_TIMER3, Load_clock_wrap);
+	irqEnable(IRQ_TIMER3);
+	REG_TM3CNT_H = TIMER_START | TIMER_IRQ | 2;
+}
+
+static void Load_clock_stop(void)
+{
+	REG_TM3CNT_H = 0;
+	irqDisable(IRQ_TIMER3);
+}
+
+static u32 IWRAM_CODE Load_clock(void)
+{
+	u32 high, low;
+
+	do {
+		high = load_clock_high;
+		low = REG_TM3CNT_L;
+	} while (high != load_clock_high);
+	return high | low;
+}
+#endif
+
+// --------------------------------------------------------------------
+// Streams the whole source in LOAD_BLOCK_SIZE blocks. A short last block is
+// zero filled so no stale cache data reaches the sink.
+u32 IWRAM_CODE Load_run(LOAD_PIPE *pipe)
+{
+	u32 blocknum;
+	u32 ret = 0;
+	u32 i;
+	u32 clock, now;
+	u8 *block = Scratch_alloc_at(0, LOAD_BLOCK_SIZE, "load block");//patch code writes through pReadCache
+	if (block == NULL)
+		return LOAD_MEMORY_ERROR;
+
+	Load_clock_start();
+	for (blocknum = 0; blocknum < pipe->src->size; blocknum += LOAD_BLOCK_SIZE) {
+		if (pipe->dst->prepare)
+			pipe->dst->prepare(pipe->dst, blocknum);
+		clock = Load_clock();
+		ret = pipe->src->read(pipe->src, block, blocknum, LOAD_BLOCK_SIZE);
+		if (pipe->verify)
+			pipe->crc_src = Crc32_update(pipe->crc_src, block, ret);
+		if (ret < LOAD_BLOCK_SIZE)
+			memset(block + ret, 0, LOAD_BLOCK_SIZE - ret);
+		now = Load_clock();
+		pipe->ticks[LOAD_STAGE_READ] += now - clock;
+
+		clock = now;
+		for (i = 0; i < pipe->transform_count; i++)
+			pipe->transform[i](block, LOAD_BLOCK_SIZE, blocknum);
+		now = Load_clock();
+		pipe->ticks[LOAD_STAGE_TRANSFORM] += now - clock;
+
+		clock = now;
+		ret = pipe->dst->write(pipe->dst, block, blocknum, LOAD_BLOCK_SIZE);
+		if (!ret && pipe->verify && pipe->dst->check &&
+				pipe->dst->check(pipe->dst, blocknum, LOAD_BLOCK_SIZE) != Crc32_update(0, block, LOAD_BLOCK_SIZE))
+			ret = LOAD_VERIFY_ERROR;
+		now = Load_clock();
+		pipe->ticks[LOAD_STAGE_WRITE] += now - clock;
+		if (ret)
+			break;
+		gl_progress_done += LOAD_BLOCK_SIZE;
+	}
+	Load_clock_stop();
+	Scratch_release(block);
+	return ret;
+}
+
+// --------------------------------------------------------------------
+// No-Intro DAT on the card: 1 when it lists this file name with another
+// CRC. Names it doesn't know (hacks, translations, renamed dumps) pass.
+// The DAT runs to several MB, so it is read once into /SYSTEM/GBA.IDX: the
+// (name hash, CRC) pairs of its roms sorted by hash, behind the size and
+// date of the DAT they came from. A check is a binary search of 8 byte
+// reads; a new DAT builds a new index on the next verified load.
+#define LOAD_DAT_PATH "/SYSTEM/GBA.DAT"
+#define LOAD_DAT_INDEX "/SYSTEM/GBA.IDX"
+#define LOAD_DAT_MAGIC 0x31584449	//"IDX1"
+#define LOAD_DAT_MAX 0x2000			//roms indexed, 64KB of scratch while building
+
+typedef struct {
+	u32 magic;
+	u32 size;		//of the DAT
+	u32 date;		//fdate << 16 | ftime of the DAT
+	u32 count;
+} LOAD_DAT_HEAD;
+
+typedef struct {
+	u32 hash;
+	u32 crc;
+} LOAD_DAT_ROM;
+
+static u32 Load_dat_hash(const char *s)
+{
+	u32 hash = 0x811C9DC5;
+	while (*s)
+		hash = (hash ^ (u8)*s++) * 0x01000193;
+	return hash;
+}
+
+//value of name="..." with the XML entities undone, 0 when it doesn't fit
+static u32 Load_dat_name(const char *p, char *name, u32 size)
+{
+	static const char *const entity[] = { "&amp;", "&apos;", "&quot;", "&lt;", "&gt;" };
+	static const char plain[] = "&'\"<>";
+	char *end;
+	u32 len = 0, i, n;
+	char c;
+
+	while (*p && *p != '"') {
+		c = *p++;
+		if (c == '&' && *p == '#') {
+			n = strtoul(p + 1 + (p[1] == 'x'), &end, (p[1] == 'x') ? 16 : 10);
+			if (*end == ';' && n && n < 0x80) {
+				c = n;
+				p = end + 1;
+			}
+		}
+		else if (c == '&') {
+			for (i = 0; i < 5; i++) {
+				n = strlen(entity[i]);
+				if (!strncmp(p - 1, entity[i], n)) {
+					c = plain[i];
+					p += n - 1;
+					break;
+				}
+			}
+		}
+		if (len + 1 >= size)
+			return 0;
+		name[len++] = c;
+	}
+	name[len] = 0;
+	return *p == '"';
+}
+
+//one DAT line, a <rom> element adds its name hash and CRC
+static void Load_dat_line(const char *line, LOAD_DAT_ROM *rom, u32 *count)
+{
+	char name[FF_MAX_LFN + 1];
+	const char *p, *crc;
+
+	if (*count == LOAD_DAT_MAX || (line = strstr(line, "<rom ")) == NULL)
+		return;
+	p = strstr(line, "name=\"");
+	crc = strstr(line, "crc=\"");
+	if (p == NULL || crc == NULL || !Load_dat_name(p + 6, name, sizeof(name)))
+		return;
+	rom[*count].hash = Load_dat_hash(name);
+	rom[*count].crc = strtoul(crc + 5, NULL, 16);
+	(*count)++;
+}
+
+static u32 Load_dat_build(const FILINFO *info)
+{
+	static const u16 gaps[] = { 1750, 701, 301, 132, 57, 23, 10, 4, 1 };
+	FIL dat, idx;
+	LOAD_DAT_HEAD head;
+	LOAD_DAT_ROM *rom, cur;
+	char block[0x200], line[512];
+	UINT got, done;
+	u32 i, j, g, len = 0, count = 0, ok = 0;
+
+	if (f_open(&dat, LOAD_DAT_PATH, FA_READ) != FR_OK)
+		return 0;
+	rom = Scratch_alloc(LOAD_DAT_MAX * sizeof(LOAD_DAT_ROM), "dat index");
+	if (rom == NULL) {
+		f_close(&dat);
+		return 0;
+	}
+	while (f_read(&dat, block, sizeof(block), &got) == FR_OK && got) {
+		for (i = 0; i < got; i++) {
+			if (block[i] == '\n') {
+				line[len] = 0;
+				Load_dat_line(line, rom, &count);
+				len = 0;
+			}
+			else if (len < sizeof(line) - 1) {
+				line[len++] = block[i];
+			}
+		}
+	}
+	line[len] = 0;
+	Load_dat_line(line, rom, &count);
+	f_close(&dat);
+
+	for (g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+		for (i = gaps[g]; i < count; i++) {
+			cur = rom[i];
+			for (j = i; j >= gaps[g] && rom[j - gaps[g]].hash > cur.hash; j -= gaps[g])
+				rom[j] = rom[j - gaps[g]];
+			rom[j] = cur;
+		}
+	}
+
+	//the header goes last, a cut off build never looks valid
+	memset(&head, 0, sizeof(head));
+	if (f_open(&idx, LOAD_DAT_INDEX, FA_READ | FA_WRITE | FA_CREATE_ALWAYS) == FR_OK) {
+		ok = f_write(&idx, &head, sizeof(head), &done) == FR_OK && done == sizeof(head)
+		     && f_write(&idx, rom, count * sizeof(LOAD_DAT_ROM), &done) == FR_OK
+		     && done == count * sizeof(LOAD_DAT_ROM) && f_sync(&idx) == FR_OK;
+		head.magic = LOAD_DAT_MAGIC;
+		head.size = info->fsize;
+		head.date = (info->fdate << 16) | info->ftime;
+		head.count = count;
+		ok = ok && f_lseek(&idx, 0) == FR_OK && f_write(&idx, &head, sizeof(head), &done) == FR_OK
+		     && done == sizeof(head);
+		f_close(&idx);
+		if (!ok)
+			f_unlink(LOAD_DAT_INDEX);
+	}
+	Scratch_release(rom);
+	return ok;
+}
+
+//index of the DAT as it is now, 0 when there is none
+static u32 Load_dat_open(FIL *idx, const FILINFO *info, LOAD_DAT_HEAD *head)
+{
+	UINT got;
+
+	if (f_open(idx, LOAD_DAT_INDEX, FA_READ) != FR_OK)
+		return 0;
+	if (f_read(idx, head, sizeof(*head), &got) == FR_OK && got == sizeof(*head)
+	    && head->magic == LOAD_DAT_MAGIC && head->size == info->fsize
+	    && head->date == (((u32)info->fdate << 16) | info->ftime))
+		return 1;
+	f_close(idx);
+	return 0;
+}
+
+u32 Load_dat_check(const TCHAR *filename, u32 crc)
+{
+	FIL idx;
+	FILINFO info;
+	LOAD_DAT_HEAD head;
+	LOAD_DAT_ROM rom;
+	UINT got;
+	u32 hash = Load_dat_hash(filename);
+	u32 lo = 0, hi, mid, ret = 0;
+
+	if (f_stat(LOAD_DAT_PATH, &info) != FR_OK)
+		return 0;
+	if (!Load_dat_open(&idx, &info, &head) && (!Load_dat_build(&info) || !Load_dat_open(&idx, &info, &head)))
+		return 0;
+	//first entry with this hash, then all of them: a name can be listed twice
+	hi = head.count;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (f_lseek(&idx, sizeof(head) + mid * sizeof(rom)) != FR_OK
+		    || f_read(&idx, &rom, sizeof(rom), &got) != FR_OK || got != sizeof(rom))
+			break;
+		if (rom.hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	f_lseek(&idx, sizeof(head) + lo * sizeof(rom));
+	for (; lo < head.count; lo++) {
+		if (f_read(&idx, &rom, sizeof(rom), &got) != FR_OK || got != sizeof(rom) || rom.hash != hash)
+			break;
+		if (rom.crc == crc) {
+			ret = 0;
+			break;
+		}
+		ret = 1;
+	}
+	f_close(&idx);
+	return ret;
+}
@@ -0,0 +1,164 @@
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+#include <gba_timers.h>
+
+#include "ezkernel.h"
+#include "gfx/draw.h"
+#include "gfx/rows.h"
+#include "driver/sd_card.h"
+#include "patch/gba_patch.h"
+#include "bgm.h"
+#include "scratch.h"
+#include "overlay.h"
+#include "waitstate.h"
+
+extern void PatchInternal(u32* Data,int iSize,u32 offset);
+extern void wait_btn();
+extern const unsigned char gImage_splash[];
+
+u32 gl_overlay_current = OVERLAY_NONE;
+
+#ifndef NO_OVERLAY
+//generated by the OVERLAY statement of gba_cart.ld
+extern u8 __iwram_overlay_start[];
+extern u8 __load_start_iwram0[], __load_stop_iwram0[];
+extern u8 __load_start_iwram1[], __load_stop_iwram1[];
+extern u8 __load_start_iwram2[], __load_stop_iwram2[];
+#endif
+
+// --------------------------------------------------------------------
+void Overlay_load(u32 set)
+{
+#ifndef NO_OVERLAY
+	u8 *start, *stop;
+	switch (set) {
+	case OVERLAY_BROWSER:
+		start = __load_start_iwram0;
+		stop = __load_stop_iwram0;
+		break;
+	case OVERLAY_LOADER:
+		start = __load_start_iwram1;
+		stop = __load_stop_iwram1;
+		break;
+	case OVERLAY_NOR:
+		start = __load_start_iwram2;
+		stop = __load_stop_iwram2;
+		break;
+	default:
+		gl_overlay_current = OVERLAY_NONE;
+		return;
+	}
+	dmaCopy(start, __iwram_overlay_start, (stop - start + 3) & ~3);
+#endif
+	gl_overlay_current = set;
+}
+
+// --------------------------------------------------------------------
+// make BENCH=1 runs this at boot; build once more with OVERLAY=0 for the
+// ROM baseline. Times are timer 3 ticks of 64 cycles (~3.8us); the wait
+// state lines are reset timing first, then the calibrated setting.
+#ifdef OVERLAY_BENCH
+#define Bench_start() do { REG_TM3CNT_H = 0; REG_TM3CNT_L = 0; REG_TM3CNT_H = TIMER_START | 1; } while (0)
+#define Bench_ticks() REG_TM3CNT_L
+
+void Overlay_bench(void)
+{
+	u32 set, i;
+	u32 ticks_load[OVERLAY_COUNT];
+	u32 ticks_text, ticks_pic, ticks_scan, ticks_sram;
+	u32 ticks_scroll[2];
+	u32 ticks_bgm[2];
+	u32 ticks_ws[2][3];
+	u8 *block;
+
+	for (set = 0; set < OVERLAY_COUNT; set++) {
+		gl_overlay_current = OVERLAY_NONE;
+		Bench_start();
+		Overlay_use(set);
+		ticks_load[set] = Bench_ticks();
+	}
+
+	//browser: 10 text lines, one full screen transparent blit
+	Bench_start();
+	for (i = 0; i < 10; i++)
+		DrawHZText12("The quick brown fox jumps over the lazy", 0, 0, i * 12, 0x7FFF, 1);
+	ticks_text = Bench_ticks();
+	Bench_start();
+	DrawPic(VideoBuffer, 0, 0, 240, 160, 1, 0, 1);
+	ticks_pic = Bench_ticks();
+
+	//one line list scroll: bitmap redraw vs object rows plus icon and size cells
+	Bench_start();
+	DrawPic((u16*)gImage_splash, 0, 0, 240, 160, 0, 0, 1);
+	for (i = 0; i < 10; i++) {
+		DrawPic((u16*)gImage_splash, 1, 20 + i * 14, 16, 14, 1, 0, 1);
+		DrawHZText12("The quick brown fox jumps over the lazy", 32, 19, 20 + i * 14, 0x7FFF, 1);
+		DrawHZText12(" 16M", 0, 209, 20 + i * 14, 0x7FFF, 1);
+	}
+	ticks_scroll[0] = Bench_ticks();
+	Rows_set(0, "", 0);
+	Bench_start();
+	Rows_scroll(1, "The quick brown fox jumps over the lazy", 32);
+	for (i = 0; i < 10; i++) {
+		ClearWithBG((u16*)gImage_splash, 0, 20 + i * 14, 18, 14, 1);
+		ClearWithBG((u16*)gImage_splash, 209, 20 + i * 14, 31, 13, 1);
+		DrawPic((u16*)gImage_splash, 1, 20 + i * 14, 16, 14, 1, 0, 1);
+		DrawHZText12(" 16M", 0, 209, 20 + i * 14, 0x7FFF, 1);
+	}
+	ticks_scroll[1] = Bench_ticks();
+	Rows_show(0);
+
+	//loader: IRQ vector scan of one block, 32KB SRAM read
+	block = Scratch_alloc_at(0, 0x20000, "bench block");
+	memset(block, 0, 0x20000);
+	Bench_start();
+	PatchInternal((u32*)block, 0x20000, 0);
+	ticks_scan = Bench_ticks();
+	GBA_patch_init();
+	Bench_start();
+	ReadSram(SAVE_sram_base, block, 0x8000);
+	ticks_sram = Bench_ticks();
+
+	//wait states: splash, browser and a 128KB ROM read, reset vs calibrated
+	for (set = 0; set < 2; set++) {
+		REG_WAITCNT = set ? gl_waitcnt : WAITCNT_DEFAULT;
+		Bench_start();
+		DrawPic((u16*)gImage_splash, 0, 0, 240, 160, 0, 0, 1);
+		ticks_ws[set][0] = Bench_ticks();
+		Bench_start();
+		for (i = 0; i < 10; i++)
+			DrawHZText12("The quick brown fox jumps over the lazy", 0, 0, i * 12, 0x7FFF, 1);
+		ticks_ws[set][1] = Bench_ticks();
+		Bench_start();
+		dmaCopy((void*)0x08000000, block, 0x20000);
+		ticks_ws[set][2] = Bench_ticks();
+	}
+	REG_WAITCNT = gl_waitcnt;
+	Scratch_release(block);
+
+	//background music: read and decode one second, VBlank handler for one second
+	ticks_bgm[0] = Bgm_bench(&ticks_bgm[1]);
+
+	DEBUG_printf("overlay load %lu %lu %lu", ticks_load[0], ticks_load[1], ticks_load[2]);
+	DEBUG_printf("text x10 %lu", ticks_text);
+	DEBUG_printf("blit 240x160 %lu", ticks_pic);
+	DEBUG_printf("scroll bitmap %lu rows %lu", ticks_scroll[0], ticks_scroll[1]);
+	DEBUG_printf("scan 128KB %lu", ticks_scan);
+	DEBUG_printf("sram 32KB %lu", ticks_sram);
+	DEBUG_printf("waitcnt %04x", gl_waitcnt);
+	if (ticks_bgm[0]) {
+		i = (ticks_bgm[0] + ticks_bgm[1]) * 1000 / (16777216 / 64);	//tenths of a percent
+		DEBUG_printf("bgm 1s fill %lu irq %lu, %lu.%lu%% cpu", ticks_bgm[0], ticks_bgm[1], i / 10, i % 10);
+	}
+	for (set = 0; set < 2; set++)
+		DEBUG_printf("splash %lu text %lu rom %lu", ticks_ws[set][0], ticks_ws[set][1], ticks_ws[set][2]);
+	DEBUG_printf("(x64 cycles)");
+	wait_btn();
+	REG_TM3CNT_H = 0;
+}
+#else
+void Overlay_bench(void)
+{
+}
+#endif
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <string.h>
+#include <gba_base.h>
+#include <gba_systemcalls.h>
+#include <gba_timers.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "lang.h"
+#include "gfx/draw.h"
+#include "gfx/glyph.h"
+#include "gfx/show_cht.h"
+#include "driver/sd_card.h"
+#include "driver/nor_flash.h"
+#include "loader.h"
+#include "rtc_cache.h"
+#include "provision.h"
+
+extern FM_NOR_FS pNorFS[MAX_NOR]EWRAM_BSS;
+extern u32 game_total_NOR;
+extern u32 gl_norOffset;
+extern FIL gfile;
+
+//loader stage ticks (256 cycles) to ms, 64 bit so a long run can't wrap
+#define TICKS_MS(t) ((u32)(((u64)(t) * 125) >> 13))
+
+// --------------------------------------------------------------------
+//wall clock of the whole run: timer 1 ticks at 16384 Hz and timer 2 counts
+//its overflows, the pair rtc_cache uses, which is resynced afterwards
+static void Provision_clock_start(void)
+{
+	REG_TM1CNT_H = 0;
+	REG_TM2CNT_H = 0;
+	REG_TM1CNT_L = 0;
+	REG_TM2CNT_L = 0;
+	REG_TM2CNT_H = TIMER_COUNT | TIMER_START;
+	REG_TM1CNT_H = TIMER_START | 3;
+}
+// --------------------------------------------------------------------
+static u32 Provision_clock_ms(void)
+{
+	u32 high, low;
+
+	do {
+		high = REG_TM2CNT_L;
+		low = REG_TM1CNT_L;
+	} while (high != REG_TM2CNT_L);
+	return (u32)((((u64)high << 16 | low) * 1000) >> 14);
+}
+
+// --------------------------------------------------------------------
+//next ROM path of the manifest, 0 at the end
+static u32 Provision_next(FIL *list, char *line, u32 size)
+{
+	while (f_gets(line, size, list) != NULL) {
+		Trim(line);
+		if (line[0] != 0 && line[0] != '#')
+			return 1;
+	}
+	return 0;
+}
+// --------------------------------------------------------------------
+//splits "/dir/name.gba" into the folder (changed to) and the file name
+static char *Provision_enter(char *path)
+{
+	char *name = strrchr(path, '/');
+	if (name == NULL)
+		return path;
+	*name = 0;
+	f_chdir(name == path ? "/" : path);
+	return name + 1;
+}
+// --------------------------------------------------------------------
+//1 when it wrote anything, the caller rescans the NOR list
+u32 Provision_NOR(void)
+{
+	FIL list, log;
+	FILINFO info;
+	char line[256];
+	char msg[64];
+	char kept[sizeof(pNorFS[0].filename)];
+	char *name;
+	u32 total = 0, keep = 0, match = 1;
+	u32 ticks[3], sum[3] = {0, 0, 0};
+	u32 i, res = 0, done = 0, bytes = 0;
+	u16 rts_on, verify;
+
+	if (f_open(&list, PROVISION_LIST, FA_READ) != FR_OK)
+		return 0;
+	if (Read_S98NOR_ID() != 0x223D) {
+		f_close(&list);
+		return 0;
+	}
+	Read_NOR_info();
+	gl_norOffset = 0;
+	game_total_NOR = GetFileListFromNor();
+	Upgrade_NOR_names();
+
+	//the games already on NOR in manifest order stay
+	while (Provision_next(&list, line, sizeof(line))) {
+		if (match && keep < game_total_NOR && f_stat(line, &info) == FR_OK) {
+			name = strrchr(line, '/');
+			name = name ? name + 1 : line;
+			Glyph_copy(kept, name, sizeof(kept));//as Writefile2NOR stored it
+			if (!strcmp((char*)pNorFS[keep].filename, kept) && !pNorFS[keep].have_patch &&
+					pNorFS[keep].filesize == ((info.fsize + 0x1FFFF) & ~0x1FFFF))
+				keep++;
+			else
+				match = 0;
+		}
+		else {
+			match = 0;
+		}
+		total++;
+	}
+	if (keep == total && game_total_NOR == total) {
+		f_close(&list);
+		return 0;
+	}
+
+	Clear(0, 0, 240, 160, gl_color_cheat_black, 1);
+	DrawHZText12("NOR provisioning", 0, 2, 2, gl_color_text, 1);
+	game_total_NOR = keep;
+	gl_norOffset = 0;
+	for (i = 0; i < keep; i++)
+		gl_norOffset += pNorFS[i].filesize;
+	memset(&pNorFS[keep], 0, sizeof(FM_NOR_FS) * (MAX_NOR - keep));
+
+	f_open(&log, PROVISION_LOG, FA_CREATE_ALWAYS | FA_WRITE);
+	f_printf(&log, "kept %lu of %lu\n", keep, total);
+	rts_on = gl_rts_on;
+	verify = gl_toggle_verify;
+	gl_rts_on = 0;
+	gl_toggle_verify = 1;
+	Provision_clock_start();
+	PPB_Erase();
+	f_lseek(&list, 0);
+	for (i = 0; Provision_next(&list, line, sizeof(line)); i++) {
+		if (i < keep)
+			continue;
+		if (game_total_NOR == MAX_NOR) {
+			name = line;
+			res = 2;
+			break;
+		}
+		sprintf(msg, "%lu/%lu", i + 1, total);
+		Clear(0, 20, 240, 26, gl_color_cheat_black, 1);
+		DrawHZText12(msg, 0, 2, 20, gl_color_text, 1);
+		DrawName12(line, 38, 2, 33, gl_color_text, 1);
+		name = Provision_enter(line);
+		memset(ticks, 0, sizeof(ticks));
+		res = Writefile2NOR(name, gl_norOffset, 0, ticks);
+		f_chdir("/");
+		if (res)
+			break;
+		bytes += pNorFS[game_total_NOR].filesize;
+		gl_norOffset += pNorFS[game_total_NOR].filesize;
+		game_total_NOR++;
+		done++;
+		sum[0] += ticks[LOAD_STAGE_READ];
+		sum[1] += ticks[LOAD_STAGE_TRANSFORM];
+		sum[2] += ticks[LOAD_STAGE_WRITE];
+		f_printf(&log, "%s %lu read %lu patch %lu write %lu ms\n", name, pNorFS[game_total_NOR - 1].filesize,
+			TICKS_MS(ticks[0]), TICKS_MS(ticks[1]), TICKS_MS(ticks[2]));
+	}
+	gl_rts_on = rts_on;
+	gl_toggle_verify = verify;
+	f_close(&list);
+	//a failed game left its entry behind, it must not be saved
+	if (game_total_NOR < MAX_NOR)
+		memset(&pNorFS[game_total_NOR], 0, sizeof(FM_NOR_FS));
+	Save_NOR_info((u16*)pNorFS, sizeof(FM_NOR_FS) * MAX_NOR);
+
+	i = Provision_clock_ms();
+	rtc_cache_sync();
+	if (res)
+		f_printf(&log, "stopped at %s, error %lu\n", name, res);
+	f_printf(&log, "read %lu patch %lu write %lu ms\n", TICKS_MS(sum[0]), TICKS_MS(sum[1]), TICKS_MS(sum[2]));
+	f_printf(&log, "wrote %lu games, %lu KB in %lu ms, %lu KB/s\n", done, bytes >> 10, i,
+		i ? (bytes >> 10) * 1000 / i : 0);
+	f_close(&log);
+
+	Clear(0, 20, 240, 26, gl_color_cheat_black, 1);
+	sprintf(msg, res ? "Stopped, error %lu, see NORLIST.LOG" : "Done, %lu games", res ? res : game_total_NOR);
+	DrawHZText12(msg, 0, 2, 20, res ? RGB(31, 0, 0) : gl_color_text, 1);
+	for (i = 0; i < 120; i++)
+		VBlankIntrWait();
+	return 1;
+}
@@ -0,0 +1,75 @@
+#include <gba_base.h>
+#include <gba_timers.h>
+
+#include "driver/rtc.h"
+#include "rtc_cache.h"
+
+// The RTC is only read through the GPIO port once a minute; in between
+// timer 1 overflows every second (prescaler 1024, 16384 ticks) and timer 2
+// counts the overflows.
+#define RTC_CACHE_RESYNC 60
+
+static u8 rtc_base[7];		//last chip read, BCD YY MM DD WD HH MM SS
+static u8 base_HH, base_MM, base_SS;
+static u32 rtc_cached = 0;
+
+// --------------------------------------------------------------------
+void rtc_cache_sync(void)
+{
+	REG_TM1CNT_H = 0;
+	REG_TM2CNT_H = 0;
+
+	rtc_enable();
+	rtc_get(rtc_base);
+	rtc_disenable();
+
+	base_HH = UNBCD(rtc_base[4] & 0x3F);
+	base_MM = UNBCD(rtc_base[5] & 0x7F);
+	base_SS = UNBCD(rtc_base[6] & 0x7F);
+	if (base_HH > 23) base_HH = 0;
+	if (base_MM > 59) base_MM = 0;
+	if (base_SS > 59) base_SS = 0;
+
+	REG_TM1CNT_L = 0x10000 - 16384;
+	REG_TM2CNT_L = 0;
+	REG_TM2CNT_H = TIMER_COUNT | TIMER_START;
+	REG_TM1CNT_H = TIMER_START | 3;
+	rtc_cached = 1;
+}
+// --------------------------------------------------------------------
+// same 7 BCD bytes as rtc_get()
+void rtc_cache_get(u8 *datetime)
+{
+	u32 elapsed;
+	u32 HH, MM, SS;
+	int i;
+
+	if (!rtc_cached || REG_TM2CNT_L >= RTC_CACHE_RESYNC)
+		rtc_cache_sync();
+
+	elapsed = REG_TM2CNT_L;
+	SS = base_SS + elapsed;
+	MM = base_MM;
+	HH = base_HH;
+	if (SS > 59) {
+		SS -= 60;
+		MM++;
+		if (MM > 59) {
+			MM = 0;
+			HH++;
+			if (HH > 23) {
+				//date changes, let the chip do the calendar
+				rtc_cache_sync();
+				SS = base_SS;
+				MM = base_MM;
+				HH = base_HH;
+			}
+		}
+	}
+
+	for (i = 0; i < 4; i++)
+		datetime[i] = rtc_base[i];
+	datetime[4] = _BCD(HH);
+	datetime[5] = _BCD(MM);
+	datetime[6] = _BCD(SS);
+}
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <gba_base.h>
+
+#include "ff.h"
+#include "ezkernel.h"
+#include "gfx/draw.h"
+#include "scratch.h"
+#include "saver.h"
+
+#define SAVER_BATCH 0x8000	//names collected per pass of the flat folder
+
+// --------------------------------------------------------------------
+//"/SYSTEM/SAVEHASH/XX" for a save name; .sav and .esv of a game share it
+static void Saver_shard(char *shard, const TCHAR *name)
+{
+	const TCHAR *ext = strrchr(name, '.');
+	u32 hash = 0x811C9DC5;
+
+	while (*name && name != ext)
+		hash = (hash ^ (u8)toupper((u8)*name++)) * 0x01000193;
+	sprintf(shard, "%s/%02X", SAVER_SHARDS, (unsigned)((hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24)) & 0xFF));
+}
+// --------------------------------------------------------------------
+static u32 Saver_is_save(const TCHAR *name)
+{
+	const TCHAR *ext = strrchr(name, '.');
+	return ext && (strcasecmp(ext, ".sav") == 0 || strcasecmp(ext, ".esv") == 0);
+}
+// --------------------------------------------------------------------
+//flat SAVER/name into its shard, FR_ result
+static u32 Saver_move(const TCHAR *name)
+{
+	char src[MAX_path_len], dst[MAX_path_len];
+
+	Saver_shard(dst, name);
+	f_mkdir(SAVER_SHARDS);
+	f_mkdir(dst);
+	if (strlen(dst) + strlen(name) + 2 > sizeof(dst))
+		return FR_INVALID_NAME;
+	sprintf(src, "%s/%s", SAVER_DIR, name);
+	sprintf(dst + strlen(dst), "/%s", name);
+	return f_rename(src, dst);
+}
+// --------------------------------------------------------------------
+//one time move of the flat layout; names are collected first because
+//renaming while reading the folder would skip entries
+static void Saver_migrate(void)
+{
+	static u32 checked = 0;
+	FILINFO info;
+	DIR dir;
+	FIL mark;
+	char msg[32];
+	char *names, *name;
+	u32 used, more, moved, total = 0;
+
+	if (checked || f_stat(SAVER_MARK, &info) == FR_OK) {
+		checked = 1;
+		return;
+	}
+	names = Scratch_alloc(SAVER_BATCH, "saver names");
+	if (names == NULL)
+		return;
+	do {
+		used = more = moved = 0;
+		if (f_opendir(&dir, SAVER_DIR) != FR_OK)
+			break;
+		while (f_readdir(&dir, &info) == FR_OK && info.fname[0]) {
+			u32 len = strlen(info.fname) + 1;
+			if ((info.fattrib & AM_DIR) || !Saver_is_save(info.fname))
+				continue;
+			if (used + len > SAVER_BATCH) {
+				more = 1;
+				break;
+			}
+			memcpy(names + used, info.fname, len);
+			used += len;
+		}
+		f_closedir(&dir);
+		for (name = names; name < names + used; name += strlen(name) + 1) {
+			if (Saver_move(name) == FR_OK)
+				moved++;
+			if ((++total & 15) == 0) {
+				sprintf(msg, "Sharding saves %lu", total);
+				ShowbootProgress(msg);
+			}
+		}
+	} while (more && moved);
+	Scratch_release(names);
+
+	if (f_open(&mark, SAVER_MARK, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK)
+		f_close(&mark);
+	checked = 1;
+}
+// --------------------------------------------------------------------
+u32 Saver_enter(const TCHAR *savname)
+{
+	char shard[24];
+	FILINFO info;
+	u32 res;
+
+	f_mkdir("/SYSTEM");
+	f_mkdir(SAVER_DIR);
+	res = f_chdir(SAVER_DIR);
+	if (res != FR_OK)
+		return res;
+	Saver_shard(shard, savname);
+	if (gl_toggle_shard) {
+		Saver_migrate();
+		if (f_chdir(shard) == FR_OK && f_stat(savname, &info) == FR_OK)
+			return FR_OK;
+		//new game, or a save copied in flat after the move
+		f_chdir(SAVER_DIR);
+		if (f_stat(savname, &info) == FR_OK)
+			Saver_move(savname);
+		f_mkdir(SAVER_SHARDS);
+		f_mkdir(shard);
+		res = f_chdir(shard);
+		return (res == FR_OK) ? res : f_chdir(SAVER_DIR);
+	}
+	//flat layout, but keep using a save that already went to a shard
+	if (f_stat(savname, &info) != FR_OK && f_chdir(shard) == FR_OK) {
+		if (f_stat(savname, &info) == FR_OK)
+			return FR_OK;
+		return f_chdir(SAVER_DIR);
+	}
+	return FR_OK;
+}
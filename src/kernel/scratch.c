@@ -0,0 +1,130 @@
+#include <string.h>
+#include <gba_base.h>
+
+#include "ezkernel.h"
+#include "gfx/draw.h"
+#include "scratch.h"
+
+typedef struct {
+	const char *name;
+	u32 start;
+	u32 end;
+	u32 resident;
+} SCRATCH_CLAIM;
+
+static SCRATCH_CLAIM claim[SCRATCH_MAX_CLAIM];
+static u32 claim_count = 0;
+
+// --------------------------------------------------------------------
+//end of the highest stack claim
+static u32 Scratch_top(void)
+{
+	u32 i, top = 0;
+	for (i = 0; i < claim_count; i++) {
+		if (!claim[i].resident && claim[i].end > top)
+			top = claim[i].end;
+	}
+	return top;
+}
+// --------------------------------------------------------------------
+//start of the lowest resident claim
+static u32 Scratch_floor(void)
+{
+	u32 i, floor = MAX_pReadCache_size;
+	for (i = 0; i < claim_count; i++) {
+		if (claim[i].resident && claim[i].start < floor)
+			floor = claim[i].start;
+	}
+	return floor;
+}
+// --------------------------------------------------------------------
+//resident caches give way to anything that needs their room
+static void Scratch_evict(u32 start, u32 end)
+{
+	u32 i = 0;
+	while (i < claim_count) {
+		if (claim[i].resident && claim[i].start < end && start < claim[i].end)
+			claim[i] = claim[--claim_count];
+		else
+			i++;
+	}
+}
+// --------------------------------------------------------------------
+static void *Scratch_add(u32 start, u32 end, const char *name, u32 resident)
+{
+	if (claim_count == SCRATCH_MAX_CLAIM) {
+#ifdef SCRATCH_DEBUG
+		DEBUG_printf("scratch: no slot for %s", name);
+#endif
+		return NULL;
+	}
+	claim[claim_count].name = name;
+	claim[claim_count].start = start;
+	claim[claim_count].end = end;
+	claim[claim_count].resident = resident;
+	claim_count++;
+	return pReadCache + start;
+}
+// --------------------------------------------------------------------
+void *Scratch_alloc(u32 size, const char *name)
+{
+	u32 start = Scratch_top();
+	u32 end = start + ((size + 3) & ~3);
+	if (end > MAX_pReadCache_size) {
+#ifdef SCRATCH_DEBUG
+		DEBUG_printf("scratch: %s %lx too big", name, size);
+#endif
+		return NULL;
+	}
+	Scratch_evict(start, end);
+	return Scratch_add(start, end, name, 0);
+}
+// --------------------------------------------------------------------
+void *Scratch_alloc_at(u32 offset, u32 size, const char *name)
+{
+	u32 end = offset + size;
+#ifdef SCRATCH_DEBUG
+	u32 i;
+	for (i = 0; i < claim_count; i++) {
+		if (!claim[i].resident && claim[i].start < end && offset < claim[i].end)
+			DEBUG_printf("scratch: %s overlaps %s", name, claim[i].name);
+	}
+#endif
+	Scratch_evict(offset, end);
+	return Scratch_add(offset, end, name, 0);
+}
+// --------------------------------------------------------------------
+void *Scratch_keep(u32 size, const char *name)
+{
+	u32 floor = Scratch_floor();
+	size = (size + 3) & ~3;
+	if (floor < Scratch_top() + size)
+		return NULL;
+	return Scratch_add(floor - size, floor, name, 1);
+}
+// --------------------------------------------------------------------
+u32 Scratch_kept(const void *p, const char *name)
+{
+	u32 i;
+	for (i = 0; i < claim_count; i++) {
+		if (claim[i].resident && pReadCache + claim[i].start == p && !strcmp(claim[i].name, name))
+			return 1;
+	}
+	return 0;
+}
+// --------------------------------------------------------------------
+void Scratch_release(const void *p)
+{
+	u32 i;
+	if (p == NULL)
+		return;
+	for (i = claim_count; i > 0; i--) {
+		if (pReadCache + claim[i - 1].start == p) {
+			claim[i - 1] = claim[--claim_count];
+			return;
+		}
+	}
+#ifdef SCRATCH_DEBUG
+	DEBUG_printf("scratch: release of unclaimed %lx", (u32)p);
+#endif
+}
@@ -0,0 +1,85 @@
+#include <string.h>
+#include <gba_base.h>
+#include <gba_dma.h>
+
+#include "ezkernel.h"
+#include "driver/sd_card.h"
+#include "scratch.h"
+#include "waitstate.h"
+
+#define TEST_SIZE 0x1000
+#define TEST_PSRAM (PSRAMBase_S98 + 0x800000 - TEST_SIZE)
+
+u16 gl_waitcnt = WAITCNT_DEFAULT;
+
+#ifndef EMU
+// fastest first: WS0 first/second access 2/1, 3/1, 3/2, 4/2, prefetch on
+static const u16 waitcnt_candidate[] = {
+	WAITCNT_PREFETCH | 0x0018,
+	WAITCNT_PREFETCH | 0x0014,
+	WAITCNT_PREFETCH | 0x0004,
+	WAITCNT_PREFETCH | 0x0000,
+};
+
+// --------------------------------------------------------------------
+//runs from IWRAM and calls nothing in ROM: a bad setting can't break its
+//own fetches. ref holds kernel ROM and NOR read at reset timing, buf is
+//the same size and gets trashed.
+static u32 IWRAM_CODE Waitstate_test(u16 waitcnt, u32 *ref, u32 *buf)
+{
+	vu32 *psram = (vu32 *)TEST_PSRAM;
+	u32 i, ok = 1;
+
+	REG_WAITCNT = waitcnt;
+	//sequential bursts
+	dmaCopy((void *)0x08000000, buf, TEST_SIZE);
+	dmaCopy((void *)FlashBase_S98, buf + TEST_SIZE / 4, TEST_SIZE);
+	for (i = 0; i < TEST_SIZE / 2; i++) {
+		if (buf[i] != ref[i])
+			ok = 0;
+	}
+	//single accesses, both directions
+	for (i = 0; i < TEST_SIZE / 4; i++)
+		psram[i] = (i & 1) ? ~(i * 0x01010101) : (i * 0x01010101) ^ 0x5555AAAA;
+	for (i = 0; i < TEST_SIZE / 4; i++) {
+		if (psram[i] != ((i & 1) ? ~(i * 0x01010101) : (i * 0x01010101) ^ 0x5555AAAA))
+			ok = 0;
+	}
+	REG_WAITCNT = WAITCNT_DEFAULT;
+	return ok;
+}
+#endif
+// --------------------------------------------------------------------
+u16 Waitstate_calibrate(void)
+{
+	REG_WAITCNT = WAITCNT_DEFAULT;
+	gl_waitcnt = WAITCNT_DEFAULT;
+#ifndef EMU //the fake cart has no writable PSRAM, keep reset timing
+	u32 *ref, *buf, *keep;
+	u32 i;
+
+	ref = Scratch_alloc(TEST_SIZE * 2, "waitcnt ref");
+	buf = Scratch_alloc(TEST_SIZE * 2, "waitcnt buf");
+	keep = Scratch_alloc(TEST_SIZE, "waitcnt psram");
+	if (ref && buf && keep) {
+		SetPSRampage(0);
+		dmaCopy((void *)0x08000000, ref, TEST_SIZE);
+		dmaCopy((void *)FlashBase_S98, ref + TEST_SIZE / 4, TEST_SIZE);
+		dmaCopy((void *)TEST_PSRAM, keep, TEST_SIZE);
+		for (i = 0; i < sizeof(waitcnt_candidate) / sizeof(waitcnt_candidate[0]); i++) {
+			//a setting has to pass twice in a row
+			if (Waitstate_test(waitcnt_candidate[i], ref, buf) &&
+					Waitstate_test(waitcnt_candidate[i], ref, buf)) {
+				gl_waitcnt = waitcnt_candidate[i];
+				break;
+			}
+		}
+		dmaCopy(keep, (void *)TEST_PSRAM, TEST_SIZE);
+	}
+	Scratch_release(keep);
+	Scratch_release(buf);
+	Scratch_release(ref);
+#endif
+	REG_WAITCNT = gl_waitcnt;
+	return gl_waitcnt;
+}
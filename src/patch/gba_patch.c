@@ -13,6 +13,9 @@
 #include "gfx/show_cht.h"
 
 #include "driver/sd_card.h"
+#include "scratch.h"
+#include "overlay.h"
+#include "kvstore.h"
 
 #define	_UnusedVram 		0x06012c00
 
@@ -37,7 +40,23 @@ u32 w_cheat_on;
 
 SPatchInfo2 iPatchInfo2[EMax];
 u32 iCount2;
-extern ST_entry pCHEAT[256];
+//cheat records, word header: offset | region<<18 | op<<19 | arg<<24
+//  op 0    : run of arg+1 bytes follows, word padded
+//  op 1..3 : guard, next record only if [address] ==, >, < arg
+//  op 4    : guard, next record only when the VBlank counter & arg is 0,
+//            arg+1 a power of two (every arg+1 VBlanks)
+u8 pCHEAT[CHEAT_PATCH_SIZE] EWRAM_BSS;
+u32 gl_cheat_records;
+u32 gl_cheat_size;
+u32 cheat_run_head;
+u32 cheat_run_address;
+u32 cheat_run_open;
+u32 cheat_guard[4];
+u32 cheat_guard_count;
+u32 cheat_failed;		//the current menu entry did not fit, see End_cheat
+u32 cheat_mark_size;
+u32 cheat_mark_records;
+u32 cheat_mark_count;
 
 #define sizeofa(array) (sizeof(array)/sizeof(array[0]))
 
@@ -51,7 +70,7 @@ void Write(u32 romaddress, const u8* buffer, u32 size)
 		if((romaddress >= windows_offset) && (romaddress < windows_offset+0x20000))
 		{
 			for(x=0;x<size/2;x++){
-				((vu16*)(pReadCache+romaddress-windows_offset))[x] = ((vu16*)buffer)[x];
+				((vu16*)(pReadCache+romaddress-windows_offset))[x] = ((vu16*)buffer)[x];//load block, claimed at offset 0
 			}					
 			//DEBUG_printf("NORaddress{%x}:%x %x", romaddress,size ,((vu32*)buffer)[0]);			
 		}
@@ -243,7 +262,7 @@ void Add2(u32 anOffset, u32 aValue)
 	} 
 }
 //------------------------------------------------------------------
-void IWRAM_CODE PatchInternal(u32* Data,int iSize,u32 offset)
+static void LOADER_CODE PatchInternal_ovl(u32* Data,int iSize,u32 offset)
 {
   u32 search_size=iSize/4;
   g_Offset = offset/4;
@@ -269,6 +288,11 @@ void IWRAM_CODE PatchInternal(u32* Data,int iSize,u32 offset)
     }
   }
 }
+void PatchInternal(u32* Data,int iSize,u32 offset)
+{
+  Overlay_use(OVERLAY_LOADER);
+  PatchInternal_ovl(Data,iSize,offset);
+}
 //------------------------------------------------------------------
 void SetTrimSize(u8* buffer,u32 romsize,u32 iSize,u32 mode,BYTE saveMODE)
 {
@@ -474,26 +498,14 @@ void Patch_RTS_Cheat(u32 *Data)
 	u8*p_no_cheat_end =  (u8*)no_CHEAT_end;
 	
 	u32 cheat_count_offset = (u8*)Cheat_count - p_patch_start;		
-	*(vu32*)(patchbuffer+cheat_count_offset) = gl_cheat_count;	
+	*(vu32*)(patchbuffer+cheat_count_offset) = gl_cheat_records;	
 	
 	u32 cheat_offset = (u8*)CHEAT - p_patch_start;
-
-	for (u32 ii = 0; ii<gl_cheat_count; ii++)
-	{
-		if(pCHEAT[ii].address >= 0x40000)
-		{
-			*(vu32*)(patchbuffer+cheat_offset+8*ii) = ((pCHEAT[ii].address)&0x7FFF) + 0x3000000;	
-		}
-		else
-		{
-			*(vu32*)(patchbuffer+cheat_offset+8*ii) = ((pCHEAT[ii].address)&0x3FFFF) + 0x2000000;	
-		}
-		*(vu32*)(patchbuffer+cheat_offset+8*ii+4) = pCHEAT[ii].VAL;	
-		//DEBUG_printf("%x=%x", *(vu32*)(patchbuffer+cheat_offset+8*ii),*(vu32*)(patchbuffer+cheat_offset+8*ii+4));
-	}
+	if(gl_cheat_size)
+		dmaCopy(pCHEAT,patchbuffer+cheat_offset,gl_cheat_size);
 
 	u32 copysize = p_no_cheat_end-p_patch_start ;
-	copysize = copysize +  gl_cheat_count*8;
+	copysize = copysize +  gl_cheat_size;
 	
 	if(	iTrimSize+copysize > 0x2000000){
 		copysize = 0x2000000 - iTrimSize;
@@ -503,6 +515,141 @@ void Patch_RTS_Cheat(u32 *Data)
 	Write(iTrimSize, patchbuffer,copysize);
 }
 //------------------------------------------------------------------
+void Clear_cheat(void)
+{
+	gl_cheat_count = 0;
+	gl_cheat_records = 0;
+	gl_cheat_size = 0;
+	cheat_run_open = 0;
+	cheat_guard_count = 0;
+}
+//------------------------------------------------------------------
+static u32 Cheat_address(u32 address)
+{
+	if(address >= 0x40000)
+	{
+		address = (address&0x7FFF) + 0x3000000;
+	}
+	else
+	{
+		address = (address&0x3FFFF) + 0x2000000;
+	}
+	return (address&0x3FFFF) | ((address>>24)&1)<<18;
+}
+//------------------------------------------------------------------
+// guards apply to every run of the current code until End_cheat_guard.
+// @N has no divide in the IRQ handler: N is rounded down to a power of two
+// (max 256), @60 runs every 32 VBlanks. A fifth guard fails the whole
+// cheat, see End_cheat, rather than letting the code run unguarded.
+void Set_cheat_guard(u32 op,u32 address,u32 VAL)
+{
+	u32 mask;
+
+	if(cheat_guard_count >= sizeofa(cheat_guard))
+	{
+		cheat_failed = 1;
+		return;
+	}
+	if(op == CHEAT_EVERY)
+	{
+		if(address <= 1)
+			return;
+		for(mask=1; (mask<<1) <= address && mask < 0x100; mask<<=1);
+		cheat_guard[cheat_guard_count++] = (CHEAT_EVERY<<19) | (mask-1)<<24;
+	}
+	else
+	{
+		cheat_guard[cheat_guard_count++] = Cheat_address(address) | op<<19 | (VAL&0xFF)<<24;
+	}
+	cheat_run_open = 0;
+}
+//------------------------------------------------------------------
+void End_cheat_guard(void)
+{
+	if(cheat_guard_count)
+	{
+		cheat_guard_count = 0;
+		cheat_run_open = 0;
+	}
+}
+//------------------------------------------------------------------
+// a cheat menu entry goes in whole or not at all: Begin_cheat marks where
+// it starts, End_cheat takes it out again when any of its codes failed
+void Begin_cheat(void)
+{
+	End_cheat_guard();
+	cheat_run_open = 0;
+	cheat_failed = 0;
+	cheat_mark_size = gl_cheat_size;
+	cheat_mark_records = gl_cheat_records;
+	cheat_mark_count = gl_cheat_count;
+}
+//------------------------------------------------------------------
+// 0 when the entry was dropped
+u32 End_cheat(void)
+{
+	End_cheat_guard();
+	if(!cheat_failed)
+		return 1;
+	gl_cheat_size = cheat_mark_size;
+	gl_cheat_records = cheat_mark_records;
+	gl_cheat_count = cheat_mark_count;
+	cheat_run_open = 0;
+	cheat_failed = 0;
+	return 0;
+}
+//------------------------------------------------------------------
+// append one byte code, extending the open run when the address follows it
+// returns 0 once the RTS/cheat patch has no room left
+u32 Add_cheat(u32 address,u32 VAL)
+{
+	u32 cheat_space = CHEAT_PATCH_SIZE - ((u8*)no_CHEAT_end - (u8*)RTS_ReplaceIRQ_start);
+	u32 head,count,i;
+
+	address = Cheat_address(address);
+
+	if(cheat_run_open)
+	{
+		head = *(u32*)(pCHEAT+cheat_run_head);
+		count = (head>>24) + 1;
+		if((count < 0x100) && (cheat_run_address + count == address))
+		{
+			u32 size = (cheat_run_head+4+count+1+3)&~3;
+			if(size > cheat_space)
+			{
+				cheat_failed = 1;
+				return 0;
+			}
+			*(u32*)(pCHEAT+cheat_run_head) = head + (1<<24);
+			pCHEAT[cheat_run_head+4+count] = VAL;
+			gl_cheat_size = size;
+			gl_cheat_count++;
+			return 1;
+		}
+	}
+
+	if(gl_cheat_size + cheat_guard_count*4 + 8 > cheat_space)
+	{
+		cheat_failed = 1;
+		return 0;
+	}
+	for(i=0;i<cheat_guard_count;i++)
+	{
+		*(u32*)(pCHEAT+gl_cheat_size) = cheat_guard[i];
+		gl_cheat_size += 4;
+		gl_cheat_records++;
+	}
+	cheat_run_head = gl_cheat_size;
+	cheat_run_address = address;
+	cheat_run_open = 1;
+	*(u32*)(pCHEAT+cheat_run_head) = address;
+	*(u32*)(pCHEAT+cheat_run_head+4) = VAL&0xFF;
+	gl_cheat_size += 8;
+	gl_cheat_records++;
+	gl_cheat_count++;
+	return 1;
+}
+//------------------------------------------------------------------
 
 void Patch_RTS_only(u32 *Data)
 {
@@ -670,7 +817,7 @@ void GBApatch_NOR(u32* address,int filesize,u32 offset)
 //------------------------------------------------------------------
 void make_pat_name(TCHAR*patnamebuf,TCHAR* gamefilename)
 {
-	memcpy(patnamebuf,gamefilename,100);
+	snprintf(patnamebuf,MAX_name_len,"%s",gamefilename);
 	u32 len=strlen(patnamebuf);
 	patnamebuf[len-3] = 'p';
 	patnamebuf[len-2] = 'a';
@@ -717,42 +864,60 @@ void GBA_patch_init_buffer(u32* buffer)
 	w_cheat_on = buffer[start+11];
 }
 //------------------------------------------------------------------
-u32 Check_pat(TCHAR* gamefilename)
+//patch table followed by the 16 settings words of Make_pat_file
+#define PAT_SIZE (sizeof(iPatchInfo2) + 16*4)
+//------------------------------------------------------------------
+//moves a .pat or .mde left in /SYSTEM by older kernels into the store
+static u32 Import_meta(const TCHAR* folder,TCHAR* name,u8 tag,void* buffer,u32 size)
 {
 	UINT  ret;
-	u32 find_the_patfile;
-	u32 patfilesize;
 	u32 res;
-	
-	TCHAR patnamebuf[100];	
-	make_pat_name(patnamebuf,gamefilename);
-	res=f_chdir("/SYSTEM/PATCH");
+	TCHAR currentpath[256];
+
+	memset(currentpath,00,256);
+	f_getcwd(currentpath, sizeof currentpath / sizeof *currentpath);
+	res=f_chdir(folder);
 	if(res == FR_OK)
 	{
-		res = f_open(&gfile,patnamebuf, FA_READ);
-		
-		if(res == FR_OK)//have a old file
+		res = f_open(&gfile,name, FA_READ);
+		if(res == FR_OK)
 		{
-			patfilesize = f_size(&gfile);
-			f_read(&gfile, pReadCache, patfilesize, &ret);
+			memset(buffer, 0x00, size);
+			f_read(&gfile, buffer, size, &ret);
 			f_close(&gfile);
-			find_the_patfile = 1;
-		}					
-		else
-		{
-			find_the_patfile = 0;
+			if(Kv_put(tag, name, buffer, size))
+				f_unlink(name);
 		}
-		//res=f_chdir("/");
 	}
-	else//no PATCH folder
+	f_chdir(currentpath);
+	return (res == FR_OK);
+}
+//------------------------------------------------------------------
+u32 Check_pat(TCHAR* gamefilename)
+{
+	u32 find_the_patfile;
+	u32 *patbuffer = Scratch_alloc(PAT_SIZE, "pat");
+	
+	TCHAR patnamebuf[MAX_name_len];	
+	make_pat_name(patnamebuf,gamefilename);
+	if(patbuffer == NULL)
 	{
 		find_the_patfile = 0;
 	}
+	else if(Kv_get(KV_PAT, patnamebuf, patbuffer, PAT_SIZE) == PAT_SIZE)
+	{
+		find_the_patfile = 1;
+	}
+	else
+	{
+		find_the_patfile = Import_meta("/SYSTEM/PATCH", patnamebuf, KV_PAT, patbuffer, PAT_SIZE);
+	}
 
 	if(find_the_patfile)
 	{
 		//read patch information
-		GBA_patch_init_buffer((u32*)pReadCache);
+		GBA_patch_init_buffer(patbuffer);
+		Scratch_release(patbuffer);
 		
 		if( (w_reset_on !=gl_reset_on)  || (w_rts_on !=gl_rts_on)  || (w_sleep_on !=gl_sleep_on) || (w_cheat_on !=gl_cheat_on))
 		{
@@ -762,6 +927,8 @@ u32 Check_pat(TCHAR* gamefilename)
 	}
 	else
 	{
+		if(patbuffer)
+			Scratch_release(patbuffer);
 		GBA_patch_init();
 	}	
 	return find_the_patfile;
@@ -769,48 +936,37 @@ u32 Check_pat(TCHAR* gamefilename)
 //------------------------------------------------------------------
 void Make_pat_file(TCHAR* gamefilename)
 {
-	u32 res;
-	u32 written;
-	u32 w_buffer[16];
+	u32 *w_buffer = Scratch_alloc(PAT_SIZE, "pat");
 	
-	res = f_mkdir("/SYSTEM/PATCH");
-	res=f_chdir("/SYSTEM/PATCH");
-	
-	memset(w_buffer, 0x00, sizeof(w_buffer));
+	if(w_buffer == NULL)
+		return;
+	memset(w_buffer, 0x00, PAT_SIZE);
+	memcpy(w_buffer, (void*)iPatchInfo2, sizeof(iPatchInfo2));
 
-	if(res == FR_OK){
-		TCHAR patnamebuf[100];	
-		make_pat_name(patnamebuf,gamefilename);
+	u32 start = sizeof(iPatchInfo2)/4;
+	w_buffer[start+0] = is_NORpatch;
+	w_buffer[start+1] = windows_offset;
+	w_buffer[start+2] = is_Nes;
+	w_buffer[start+3] = Nes_index;
+	w_buffer[start+4] = g_Offset;
+	w_buffer[start+5] = iCount2;
+	w_buffer[start+6] = iTrimSize;
+	w_buffer[start+7] = EA_offset;
 
-		res = f_open(&gfile,patnamebuf, FA_WRITE | FA_OPEN_ALWAYS);
-		if(res == FR_OK)
-		{	
-			f_lseek(&gfile, 0x0000);
-			res=f_write(&gfile, (void*)iPatchInfo2, sizeof(iPatchInfo2), (UINT*)&written);
-			w_buffer[0] = is_NORpatch;
-			w_buffer[1] = windows_offset;
-			w_buffer[2] = is_Nes;
-			w_buffer[3] = Nes_index;
-			w_buffer[4] = g_Offset;
-			w_buffer[5] = iCount2;
-			w_buffer[6] = iTrimSize;
-			w_buffer[7] = EA_offset;
+	w_buffer[start+8] = gl_reset_on;
+	w_buffer[start+9] = gl_rts_on;
+	w_buffer[start+10] = gl_sleep_on;
+	w_buffer[start+11] = gl_cheat_on;
 
-			w_buffer[8] = gl_reset_on;
-			w_buffer[9] = gl_rts_on;
-			w_buffer[10] = gl_sleep_on;
-			w_buffer[11] = gl_cheat_on;
-					
-			res=f_write(&gfile, (void*)w_buffer, sizeof(w_buffer), (UINT*)&written);
-			f_close(&gfile);
-		}
-	}
-	res=f_chdir("/");
+	TCHAR patnamebuf[MAX_name_len];	
+	make_pat_name(patnamebuf,gamefilename);
+	Kv_put(KV_PAT, patnamebuf, w_buffer, PAT_SIZE);
+	Scratch_release(w_buffer);
 }
 //------------------------------------------------------------------
 void make_mde_name(TCHAR*mdenamebuf,TCHAR* gamefilename)
 {
-	memcpy(mdenamebuf,gamefilename,100);
+	snprintf(mdenamebuf,MAX_name_len,"%s",gamefilename);
 	u32 len=strlen(mdenamebuf);
 	mdenamebuf[len-3] = 'm';
 	mdenamebuf[len-2] = 'd';
@@ -819,79 +975,24 @@ void make_mde_name(TCHAR*mdenamebuf,TCHAR* gamefilename)
 //------------------------------------------------------------------
 u8 Check_mde_file(TCHAR* gamefilename)
 {
-	UINT  ret;
-	u32 find_the_mdefile;
-	u32 mdefilesize;
-	u32 res;
+	u8 mde[16];
 	
-	TCHAR mdenamebuf[100];	
+	TCHAR mdenamebuf[MAX_name_len];	
 	make_mde_name(mdenamebuf,gamefilename);
 	
-	res=f_chdir("/SYSTEM/SAVER");
-	if(res == FR_OK)
+	mde[0] = 0;
+	if(Kv_get(KV_MDE, mdenamebuf, mde, 1) == 0)
 	{
-		res = f_open(&gfile,mdenamebuf, FA_OPEN_EXISTING);
-		
-		if(res == FR_OK)//have a old file
-		{
-			f_open(&gfile,mdenamebuf, FA_READ);
-			mdefilesize = f_size(&gfile);
-			f_read(&gfile, pReadCache, mdefilesize, &ret);
-			f_close(&gfile);
-			find_the_mdefile = 1;
-		}					
-		else
-		{
-			find_the_mdefile = 0;
-		}
-	}
-	else//cant fine folder
-	{
-		find_the_mdefile = 0;
+		Import_meta("/SYSTEM/SAVER", mdenamebuf, KV_MDE, mde, 1);
 	}
-
-	if(find_the_mdefile)
-	{
-		//read
-		return (pReadCache[0]);
-	}
-	else
-	{
-		return 0;
-	}	
+	return (mde[0]);
 }
 //------------------------------------------------------------------
 void Make_mde_file(TCHAR* gamefilename,u8 Save_num)
 {
-	u32 res;
-	u32 written;
-	u8 w_buffer[16];
-
-	TCHAR currentpath[256];
-	memset(currentpath,00,256);
-	res = f_getcwd(currentpath, sizeof currentpath / sizeof *currentpath);
-	
-	res = f_mkdir("/SYSTEM/SAVER");
-	res=f_chdir("/SYSTEM/SAVER");
-	
-	memset(w_buffer, 0x00, sizeof(w_buffer));
-
-	if(res == FR_OK){
-		TCHAR mdenamebuf[100];	
-		make_mde_name(mdenamebuf,gamefilename);
-
-		res = f_open(&gfile,mdenamebuf, FA_WRITE | FA_OPEN_ALWAYS);
-		if(res == FR_OK)
-		{	
-			f_lseek(&gfile, 0x0000);
-			
-			w_buffer[0] = Save_num;
-			res=f_write(&gfile, (void*)w_buffer, sizeof(w_buffer), (UINT*)&written);
-
-			f_close(&gfile);
-		}
-	}
-	res=f_chdir(currentpath);
+	TCHAR mdenamebuf[MAX_name_len];	
+	make_mde_name(mdenamebuf,gamefilename);
+	Kv_put(KV_MDE, mdenamebuf, &Save_num, 1);
 }
 //------------------------------------------------------------------
 u32 Check_RTS(TCHAR* gamefilename)
@@ -901,8 +1002,8 @@ u32 Check_RTS(TCHAR* gamefilename)
 	u32 rtsfilesize;
 	u32 res;
 	
-	TCHAR rtsnamebuf[100];
-	memcpy(rtsnamebuf,gamefilename,100);
+	TCHAR rtsnamebuf[MAX_name_len];
+	snprintf(rtsnamebuf,sizeof(rtsnamebuf),"%s",gamefilename);
 	u32 len=strlen(rtsnamebuf);
 	rtsnamebuf[len-3] = 'r';
 	rtsnamebuf[len-2] = 't';
@@ -929,13 +1030,20 @@ u32 Check_RTS(TCHAR* gamefilename)
 		{
 			int i;
 			unsigned int written;
-			memset(pReadCache,0xFF,0x200*4);
+			u8 *blank = Scratch_alloc(0x200*4,"blank rts");
+			if(blank == NULL) {
+				f_close(&gfile);
+				f_unlink(rtsnamebuf);//an empty rts would pass as an old one
+				return PATCH_NO_MEMORY;
+			}
+			memset(blank,0xFF,0x200*4);
 			for(i=0;i<(0x70000)/0x800 ;i++)
 			{
-	      f_write(&gfile, pReadCache, 0x200*4, &written);
+	      f_write(&gfile, blank, 0x200*4, &written);
 	      if(written != 0x200*4) break;
 	    }
 	    f_close(&gfile);
+	    Scratch_release(blank);
 
 	    rtsfilesize = 0x70000;
 		}
@@ -962,30 +1070,37 @@ u32 use_internal_engine(u8 gamecode[])
 
 	g_Offset = 0;
 	
-	dmaCopy((void*)reset_table, (void*)pReadCache, sizeof(reset_table));
+	vu32 *table = Scratch_alloc(sizeof(reset_table),"reset table");
+	if(table == NULL)
+		return PATCH_NO_MEMORY;
+	dmaCopy((void*)reset_table, (void*)table, sizeof(reset_table));
 	for(i=0;i<sizeof(reset_table)/4;i++)
 	{
-		count0x3007FFC = ((vu32*)pReadCache)[i+1];				
+		count0x3007FFC = table[i+1];				
 
-		if( ((vu32*)pReadCache)[i] == *(vu32*)gamecode )
+		if( table[i] == *(vu32*)gamecode )
 		{				
 			result = 1;
 			break;
 		}
 		i += (count0x3007FFC+1);
 	}	
-	if(result==0)	return 0;
+	if(result==0) {
+		Scratch_release((void*)table);
+		return 0;
+	}
 		
 	#ifdef DEBUG
-		//DEBUG_printf("%d: %X VS %X %x",i,((vu32*)pReadCache)[i],*(vu32*)gamecode,count0x3007FFC);
+		//DEBUG_printf("%d: %X VS %X %x",i,table[i],*(vu32*)gamecode,count0x3007FFC);
 		//wait_btn();	
 	#endif
 	i += 2;
 	iCount2 = 0;
   for(u32 ii=0;ii<count0x3007FFC;ii++)
   {
-      Add2(((vu32*)pReadCache)[i+ii], 0x3007FF4);//0x3007FFC offset
+      Add2(table[i+ii], 0x3007FF4);//0x3007FFC offset
   }
+	Scratch_release((void*)table);
 	return result;
 }
 //------------------------------------------------------------------
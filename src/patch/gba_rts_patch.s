@@ -132,22 +132,69 @@ check_sleep:
 	@;check cheat
 	adrl 		r2,CheatONOFF
 	ldr 		r2,[r2]
-	ldr 		r2,[r2] @	
-	cmp 		r2,#1
+	ldr 		r3,[r2],#4 @;
+	cmp 		r3,#1
 	bne 		nocheat
-	stmfd   SP!, {r4-r6}	
+	stmfd   SP!, {r4-r7}	
+	ldr			r7,[r2]
+	add			r7,r7,#1
+	str			r7,[r2]					@;VBlank counter for every-N codes
 	adrl 		r5,CHEAT
 	adrl		r6,Cheat_count
 	ldr			r2,[r6]
 cheat_loop:
-	cmp			r2,#0
-	beq			cheat_loop_end	
-	ldmia   r5!,{r3-r4}
-	strb		r4,[r3]
-	sub 		r2,#0x01
+	subs		r2,r2,#0x01
+	bmi			cheat_loop_end	
+	ldr			r3,[r5],#4			@;offset | region<<18 | op<<19 | arg<<24
+	mov			r4,r3,lsr#24
+	bic			r1,r3,#0xFF000000
+	bic			r1,r1,#0x00FC0000
+	tst			r3,#0x00040000
+	addne		r1,r1,#0x01000000
+	add			r1,r1,#0x02000000
+	ands		r6,r3,#0x00380000
+	beq			cheat_run
+	cmp			r6,#0x00200000
+	beq			cheat_every
+	ldrb		r1,[r1]
+	cmp			r6,#0x00080000
+	beq			cheat_if_eq
+	cmp			r6,#0x00100000
+	beq			cheat_if_gt
+	cmp			r1,r4						@;if less
+	blo			cheat_loop
+	b				cheat_skip
+cheat_if_gt:
+	cmp			r1,r4
+	bhi			cheat_loop
+	b				cheat_skip
+cheat_if_eq:
+	cmp			r1,r4
+	beq			cheat_loop
+	b				cheat_skip
+cheat_every:
+	tst			r7,r4
+	beq			cheat_loop
+cheat_skip:									@;guard failed, drop the rest of this code
+	subs		r2,r2,#0x01
+	bmi			cheat_loop_end
+	ldr			r3,[r5],#4
+	tst			r3,#0x00380000
+	bne			cheat_skip
+	add			r5,r5,r3,lsr#24
+	add			r5,r5,#4
+	bic			r5,r5,#3
+	b				cheat_loop
+cheat_run:
+	ldrb		r6,[r5],#1
+	strb		r6,[r1],#1
+	subs		r4,r4,#0x01
+	bpl			cheat_run
+	add			r5,r5,#3
+	bic			r5,r5,#3				@;next record is word aligned
 	b				cheat_loop
 cheat_loop_end:
-	ldmfd   SP!, {r4-r6}
+	ldmfd   SP!, {r4-r7}
 nocheat:
 	ldr 		pc,[r0,#-(0x04000000-0x03FFFFF4)] @;to normal IRQ routine									
 @;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
@@ -1140,7 +1187,7 @@ s_badRTS:
 RTS_switch: 
 	.word 0x00000000
 Cheat_count:
-	.word 0x00000000	
+	.word 0x00000000	@;number of records
 no_CHEAT_end:
 CHEAT:
 	.space 0x400
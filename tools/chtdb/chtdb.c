@@ -0,0 +1,515 @@
+// chtdb - compile the text cheat corpus into one indexed CHEAT.DB
+//
+// build : cc -O2 -o chtdb chtdb.c
+// usage : chtdb <GameID2cht.bin> <cheat folder> <CHEAT.DB>
+//         e.g. chtdb SYSTEM/CHEAT/GameID2cht.bin SYSTEM/CHEAT/Eng SYSTEM/CHEAT/Eng/CHEAT.DB
+//
+// Layout (little endian host assumed, see include/gfx/show_cht.h):
+//   CHT_DB_HEAD
+//   CHT_DB_GAME[game_count]          sorted by game id
+//   per game: CHT_DB_RECORD, FM_CHT_LINE[line_count], ST_entry[]
+// Keys point at their pre-parsed address/value pairs through val_offset
+// (absolute file offset) and val_len (number of ST_entry).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+// must match include/gfx/show_cht.h
+#define MAX_KEY_LEN 50
+#define CHT_DB_MAGIC 0x42444843
+#define CHT_DB_VERSION 2
+#define CHT_GUARD 0x80000000
+#define CHEAT_IF_EQ 1
+#define CHEAT_IF_GT 2
+#define CHEAT_IF_LT 3
+#define CHEAT_EVERY 4
+#define MAX_CHT_LINE 1920	//FM_CHT_LINE entries the kernel claims for the cheat menu
+
+typedef struct CHT_LINE{
+	char LINEname[MAX_KEY_LEN];
+	u8 is_section ;
+	u8 section_val_count ;
+	u8 len;
+	u8 select ;
+	u32 val_offset ;
+	u16 val_len ;
+} FM_CHT_LINE;
+
+typedef struct ST_entry_{
+	u32  address;
+	u32  VAL;
+} ST_entry;
+
+typedef struct CHT_DB_HEAD_{
+	u32 magic;
+	u32 version;
+	u32 game_count;
+	u32 reserved;
+} CHT_DB_HEAD;
+
+typedef struct CHT_DB_GAME_{
+	u32 gameid;
+	u32 offset;
+} CHT_DB_GAME;
+
+typedef struct CHT_DB_RECORD_{
+	char gamename[MAX_KEY_LEN];
+	u16 reserved;
+	u32 line_count;
+} CHT_DB_RECORD;
+
+typedef char check_line_size[(sizeof(FM_CHT_LINE) == 64) ? 1 : -1];
+typedef char check_record_size[(sizeof(CHT_DB_RECORD) == 56) ? 1 : -1];
+
+#define MAX_LINES MAX_CHT_LINE
+#define MAX_KEY_ENTRY 256
+
+typedef struct {
+	u32 gameid;
+	u32 index;		//position in GameID2cht.bin, the sort tiebreak
+	char chtname[5];
+} GAME_MAP;
+
+static FM_CHT_LINE lines[MAX_LINES];
+static ST_entry entry[MAX_LINES][MAX_KEY_ENTRY];
+
+//------------------------------------------------------------------
+static void Trim(char s[])
+{
+	int n;
+	for(n = strlen(s) - 1; n >= 0; n--)
+	{
+		if(s[n]!=' ' && s[n]!='\t' && s[n]!='\n' && s[n]!='\r')
+			break;
+		s[n] = '\0';
+	}
+}
+//------------------------------------------------------------------
+static int Is_CHT_break(char *line,int line_len)
+{
+	if (line[0] != '#' && (line[0] != '/' || line[1] != '/'))
+	{
+		if (strstr(line, "/*") != NULL || strstr(line, "*/") != NULL)
+			return 1;
+	}
+	if (line_len < 1 || line[0] == '#' || line[0] == '=' || line[0] == '/' || line[0] == '[')
+		return 1;
+	if (strchr(line, '=') != NULL)
+		return 1;
+	return 0;
+}
+//------------------------------------------------------------------
+static u32 str2hex(const char*str)
+{
+	u32 sum=0;
+	int i;
+	int len = strlen(str);
+
+	if(len >8) return 0;
+	for(i=0;i<len;i++)
+	{
+		if(str[i] >= '0' && str[i] <= '9')
+			sum = sum*16 + str[i]-'0';
+		else if(str[i] >= 'a' && str[i] <= 'f')
+			sum = sum*16 + str[i]-0x57;
+		else if(str[i] >= 'A' && str[i] <= 'F')
+			sum = sum*16 + str[i]-0x37;
+	}
+	return sum;
+}
+//------------------------------------------------------------------
+static void Put_entry(ST_entry *out,u32 max,u32 *count,u32 address,u32 VAL)
+{
+	if(*count<max){
+		out[*count].address = address;
+		out[*count].VAL = VAL;
+	}
+	(*count)++;
+}
+//------------------------------------------------------------------
+// "@N" / "?addr,val[,eq|gt|lt]" prefix of a code, see Parse_cheat_guard
+static void Put_guard(char *mod,ST_entry *out,u32 max,u32 *count)
+{
+	char *val,*op;
+	u32 type = CHEAT_IF_EQ;
+
+	if(mod[0] == '@'){
+		Put_entry(out,max,count,atoi(mod+1),CHT_GUARD | CHEAT_EVERY<<16);
+		return;
+	}
+	val = strchr(mod,',');
+	if(val == NULL)
+		return;
+	*val++ = 0;
+	op = strchr(val,',');
+	if(op != NULL)
+	{
+		*op++ = 0;
+		if(op[0] == 'g' || op[0] == 'G')
+			type = CHEAT_IF_GT;
+		else if(op[0] == 'l' || op[0] == 'L')
+			type = CHEAT_IF_LT;
+	}
+	Put_entry(out,max,count,str2hex(mod+1),CHT_GUARD | type<<16 | (str2hex(val)&0xFFFF));
+}
+//------------------------------------------------------------------
+// same "addr,val,val;addr,val" split as Analyze_KEYVAL in show_cht.c
+static u32 Parse_value(const char *value,ST_entry *out,u32 max)
+{
+	char address_buf[9];
+	char val_buf[4];
+	u32 address_len=0,val_len=0;
+	u32 is_val=0,is_address=1,address_add=0;
+	u32 count=0;
+	u32 i,buflen=strlen(value);
+	char mod_buf[24];
+	u32 mod_len=0,in_mod=0,guarded=0;
+
+	memset(address_buf,0,sizeof(address_buf));
+	memset(val_buf,0,sizeof(val_buf));
+	for(i=0;i<buflen;i++)
+	{
+		char c = value[i];
+		if(c==' ' || c=='\t' || c=='\r' || c=='\n')
+			continue;
+		if(in_mod){
+			if(c == ':'){
+				mod_buf[mod_len] = 0;
+				Put_guard(mod_buf,out,max,&count);
+				guarded = 1;
+				in_mod = 0;
+			}
+			else if(mod_len < sizeof(mod_buf)-1)
+				mod_buf[mod_len++] = c;
+			continue;
+		}
+		if(is_address==1 && address_len==0 && (c == '?' || c == '@')){
+			in_mod = 1;
+			mod_len = 0;
+			mod_buf[mod_len++] = c;
+			continue;
+		}
+		if(c == ','){
+			if(is_address==1)
+				is_address = 0;
+			else{
+				Put_entry(out,max,&count,str2hex(address_buf)+address_add,str2hex(val_buf));
+				address_add++;
+			}
+			val_len=0;
+			memset(val_buf,0,sizeof(val_buf));
+			is_val = 1;
+			continue;
+		}
+		else if(c == ';'){
+			Put_entry(out,max,&count,str2hex(address_buf)+address_add,str2hex(val_buf));
+			if(guarded)
+				Put_entry(out,max,&count,0,CHT_GUARD);
+			guarded = 0;
+			is_val = 0;
+			is_address = 1;
+			address_add=0;
+			memset(address_buf,0,sizeof(address_buf));
+			address_len=0;
+			continue;
+		}
+		if(is_val){
+			if(val_len<3) val_buf[val_len++] = c;
+		}
+		else{
+			if(address_len<8) address_buf[address_len++] = c;
+		}
+	}
+	Put_entry(out,max,&count,str2hex(address_buf)+address_add,str2hex(val_buf));
+	if(guarded)
+		Put_entry(out,max,&count,0,CHT_GUARD);
+	return count;	//more than max when codes were dropped
+}
+//------------------------------------------------------------------
+// parse one .cht the way Index_cht_file does, returns the line count
+// (cut at [GameInfo] like Check_count) or 0 when unreadable
+static u32 Parse_cht(const char *path,char *gamename,u32 *entry_count)
+{
+	FILE *fp = fopen(path,"rb");
+	static char line[6000];
+	static char value[6000];
+	int text_comment=0,in_section=0,list_end=0,cut=0;
+	int in_value=0;
+	u32 Line=0;
+	u32 dropped=0;
+	char section[MAX_KEY_LEN] = {0};
+
+	*entry_count = 0;
+	gamename[0] = 0;
+	if(fp==NULL)
+		return 0;
+
+	memset(lines,0,sizeof(lines));
+	while(1)
+	{
+		int eof = (fgets(line,sizeof(line),fp) == NULL);
+		int buf_len;
+
+		if(!eof)
+		{
+			Trim(line);
+			buf_len = strlen(line);
+		}
+		if(in_value)
+		{
+			if(!eof && text_comment==0 && !Is_CHT_break(line,buf_len))
+			{
+				char *hash = strchr(line,'#');
+				if(hash) *hash = 0;
+				strncat(value,line,sizeof(value)-strlen(value)-1);
+				continue;
+			}
+			u32 count = Parse_value(value,entry[Line-1],MAX_KEY_ENTRY);
+			if(count > MAX_KEY_ENTRY)
+			{
+				fprintf(stderr,"%s: %s has %u entries, kept %u\n",path,lines[Line-1].LINEname,count,MAX_KEY_ENTRY);
+				count = MAX_KEY_ENTRY;
+			}
+			lines[Line-1].val_len = count;
+			in_value = 0;
+		}
+		if(eof)
+			break;
+
+		if(line[0] == '-' && line[1] == '-')
+			list_end = 1;
+		if (line[0] != '#' && (line[0] != '/' || line[1] != '/'))
+		{
+			if (strstr(line, "/*") != NULL)
+			{
+				text_comment = 1;
+				continue;
+			}
+			else if (strstr(line, "*/") != NULL)
+			{
+				text_comment = 0;
+				continue;
+			}
+		}
+		if (text_comment == 1)
+			continue;
+		if (buf_len < 1 || line[0] == '#' || line[0] == '=' || line[0] == '/')
+		{
+			in_section = 0;
+			continue;
+		}
+
+		char _paramk[MAX_KEY_LEN] = {0};
+		int _klen=0,section_len=0,is_section=0,i;
+
+		for (i=0; i<buf_len; ++i)
+		{
+			if (line[i] == ' ')
+				continue;
+			if (line[i] == '[')
+			{
+				is_section = 1;
+				in_section = 0;
+				section_len = 0;
+				memset(section,0,MAX_KEY_LEN);
+				continue;
+			}
+			if(is_section == 1 && line[i] != ']')
+			{
+				if (section_len < MAX_KEY_LEN-1)
+					section[section_len++] = line[i];
+				continue;
+			}
+			else if (line[i] == ']')
+			{
+				if(strcmp(section,"GameInfo") == 0)
+					cut = 1;
+				if(!list_end && !cut && Line < MAX_LINES)
+				{
+					memcpy(lines[Line].LINEname,section,section_len);
+					lines[Line].is_section = 1;
+					lines[Line].len = section_len;
+					Line++;
+				}
+				else if(!list_end && !cut)
+					dropped++;
+				in_section = 1;
+				break;
+			}
+			if(in_section == 1)
+			{
+				if (line[i] != '=')
+				{
+					if (_klen >= MAX_KEY_LEN-1)
+						break;
+					_paramk[_klen++] = line[i];
+					continue;
+				}
+				if(strcmp(section,"GameInfo") == 0 && strcmp(_paramk,"Name") == 0)
+				{
+					strncpy(gamename, line+i+1, MAX_KEY_LEN-1);
+					gamename[MAX_KEY_LEN-1] = 0;
+				}
+				if(!list_end && !cut && Line < MAX_LINES)
+				{
+					char *hash;
+					memcpy(lines[Line].LINEname,_paramk,_klen);
+					Line++;
+					strncpy(value,line+i+1,sizeof(value)-1);
+					value[sizeof(value)-1] = 0;
+					hash = strchr(value,'#');
+					if(hash) *hash = 0;
+					in_value = 1;
+				}
+				else if(!list_end && !cut)
+					dropped++;
+				break;
+			}
+		}
+	}
+	fclose(fp);
+	if(dropped)
+		fprintf(stderr,"%s: more than %u lines, dropped %u\n",path,MAX_LINES,dropped);
+
+	for(u32 i=0;i<Line;i++)
+		*entry_count += lines[i].val_len;
+	return Line;
+}
+//------------------------------------------------------------------
+static int cmp_game(const void *a,const void *b)
+{
+	const GAME_MAP *ga = a;
+	const GAME_MAP *gb = b;
+	if(ga->gameid != gb->gameid)
+		return (ga->gameid > gb->gameid) - (ga->gameid < gb->gameid);
+	return (ga->index > gb->index) - (ga->index < gb->index);
+}
+//------------------------------------------------------------------
+// bucket folder of the text corpus, see Change2cht_folder
+static void cht_path(char *path,const char *root,const char *chtname)
+{
+	u32 num = atoi(chtname);
+	if(num >= 2900)
+		sprintf(path,"%s/Homebrew/%s.cht",root,chtname);
+	else
+		sprintf(path,"%s/%04u/%s.cht",root,num/200*200,chtname);
+}
+//------------------------------------------------------------------
+static void put32(u8 *p,u32 v)
+{
+	p[0]=v; p[1]=v>>8; p[2]=v>>16; p[3]=v>>24;
+}
+//------------------------------------------------------------------
+int main(int argc,char **argv)
+{
+	FILE *fmap,*fout;
+	GAME_MAP *map;
+	CHT_DB_GAME *table;
+	u32 map_count,game_count=0;
+	long size;
+	u32 i,k;
+
+	if(argc != 4)
+	{
+		fprintf(stderr,"usage: %s <GameID2cht.bin> <cheat folder> <CHEAT.DB>\n",argv[0]);
+		return 1;
+	}
+
+	fmap = fopen(argv[1],"rb");
+	if(fmap == NULL)
+	{
+		fprintf(stderr,"can't open %s\n",argv[1]);
+		return 1;
+	}
+	fseek(fmap,0,SEEK_END);
+	size = ftell(fmap);
+	fseek(fmap,0,SEEK_SET);
+	map_count = size / 8;
+	map = calloc(map_count ? map_count : 1,sizeof(GAME_MAP));
+	for(i=0;i<map_count;i++)
+	{
+		u8 pair[8];
+		if(fread(pair,1,8,fmap) != 8)
+			break;
+		map[i].gameid = pair[0] | pair[1]<<8 | pair[2]<<16 | (u32)pair[3]<<24;
+		map[i].index = i;
+		for(k=0;k<4;k++)		//ascii digits, HexToChar in show_cht.c
+			map[i].chtname[k] = pair[4+k];
+		map[i].chtname[4] = 0;
+	}
+	fclose(fmap);
+	qsort(map,map_count,sizeof(GAME_MAP),cmp_game);
+
+	fout = fopen(argv[3],"wb");
+	if(fout == NULL)
+	{
+		fprintf(stderr,"can't create %s\n",argv[3]);
+		return 1;
+	}
+	table = calloc(map_count ? map_count : 1,sizeof(CHT_DB_GAME));
+
+	// header and table are rewritten once the record offsets are known
+	u32 table_offset = sizeof(CHT_DB_HEAD);
+	u32 offset = table_offset + map_count*sizeof(CHT_DB_GAME);
+	fseek(fout,offset,SEEK_SET);
+
+	for(i=0;i<map_count;i++)
+	{
+		char path[1024];
+		CHT_DB_RECORD record;
+		u32 entry_count;
+		u32 line_count;
+
+		if(game_count && table[game_count-1].gameid == map[i].gameid)
+			continue;	//first mapping wins, like the linear scan did
+		cht_path(path,argv[2],map[i].chtname);
+		memset(&record,0,sizeof(record));
+		line_count = Parse_cht(path,record.gamename,&entry_count);
+		if(line_count == 0)
+			continue;
+
+		record.line_count = line_count;
+		table[game_count].gameid = map[i].gameid;
+		table[game_count].offset = offset;
+		game_count++;
+
+		u32 values = offset + sizeof(record) + line_count*sizeof(FM_CHT_LINE);
+		for(k=0;k<line_count;k++)
+		{
+			if(!lines[k].is_section)
+			{
+				lines[k].val_offset = values;
+				values += lines[k].val_len*sizeof(ST_entry);
+			}
+		}
+		fwrite(&record,sizeof(record),1,fout);
+		fwrite(lines,sizeof(FM_CHT_LINE),line_count,fout);
+		for(k=0;k<line_count;k++)
+		{
+			if(!lines[k].is_section)
+				fwrite(entry[k],sizeof(ST_entry),lines[k].val_len,fout);
+		}
+		offset = values;
+	}
+
+	u8 head[sizeof(CHT_DB_HEAD)];
+	memset(head,0,sizeof(head));
+	put32(head,CHT_DB_MAGIC);
+	put32(head+4,CHT_DB_VERSION);
+	put32(head+8,game_count);
+	fseek(fout,0,SEEK_SET);
+	fwrite(head,sizeof(head),1,fout);
+	fwrite(table,sizeof(CHT_DB_GAME),game_count,fout);
+	fclose(fout);
+
+	printf("%u games, %lu bytes\n",game_count,(unsigned long)offset);
+	free(table);
+	free(map);
+	return 0;
+}
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+# bin2lzh - LZ77 compress a binary into a C header for the kernel ROM
+#
+# usage : bin2lzh.py <input.bin> <name> <GUARD> > header.h
+#         e.g. bin2lzh.py goomba.gba goomba_gba SIMPLELIGHT_EMULATOR_GOOMBA_INCLUDED
+#
+# Output is the GBA BIOS LZ77 format (type 0x10), VRAM safe (no distance 1
+# back-references) so LZ77UnCompVram can decode it straight into PSRAM.
+# <name>_size is the decoded size, <name>_lz the compressed stream.
+
+import sys
+
+MIN_LEN = 3
+MAX_LEN = 18
+MAX_DISP = 0x1000
+MIN_DISP = 2	# 16-bit writes, the previous byte is not in memory yet
+MAX_CHAIN = 256
+
+
+def compress(data):
+	out = bytearray()
+	size = len(data)
+	out += bytes([0x10, size & 0xFF, (size >> 8) & 0xFF, (size >> 16) & 0xFF])
+	chains = {}
+	pos = 0
+	while pos < size:
+		flag_index = len(out)
+		out.append(0)
+		flags = 0
+		for bit in range(8):
+			if pos >= size:
+				break
+			best_len = 0
+			best_disp = 0
+			if pos + MIN_LEN <= size:
+				key = data[pos:pos + MIN_LEN]
+				for cand in reversed(chains.get(key, [])[-MAX_CHAIN:]):
+					disp = pos - cand
+					if disp > MAX_DISP:
+						break
+					if disp < MIN_DISP:
+						continue
+					length = 0
+					limit = min(MAX_LEN, size - pos)
+					while length < limit and data[cand + length] == data[pos + length]:
+						length += 1
+					if length > best_len:
+						best_len = length
+						best_disp = disp
+						if length == MAX_LEN:
+							break
+			if best_len >= MIN_LEN:
+				flags |= 0x80 >> bit
+				d = best_disp - 1
+				out.append(((best_len - MIN_LEN) << 4) | (d >> 8))
+				out.append(d & 0xFF)
+				step = best_len
+			else:
+				out.append(data[pos])
+				step = 1
+			for p in range(pos, pos + step):
+				if p + MIN_LEN <= size:
+					chains.setdefault(data[p:p + MIN_LEN], []).append(p)
+			pos += step
+		out[flag_index] = flags
+	while len(out) & 3:
+		out.append(0)
+	return bytes(out)
+
+
+def decompress(comp):
+	size = comp[1] | comp[2] << 8 | comp[3] << 16
+	out = bytearray()
+	i = 4
+	while len(out) < size:
+		flags = comp[i]
+		i += 1
+		for bit in range(8):
+			if len(out) >= size:
+				break
+			if flags & (0x80 >> bit):
+				length = (comp[i] >> 4) + MIN_LEN
+				disp = ((comp[i] & 0xF) << 8 | comp[i + 1]) + 1
+				i += 2
+				for _ in range(length):
+					out.append(out[-disp])
+			else:
+				out.append(comp[i])
+				i += 1
+	return bytes(out[:size])
+
+
+def main():
+	if len(sys.argv) != 4:
+		sys.stderr.write("usage: bin2lzh.py <input.bin> <name> <GUARD>\n")
+		return 1
+	data = open(sys.argv[1], "rb").read()
+	name = sys.argv[2]
+	guard = sys.argv[3]
+	comp = compress(data)
+	if decompress(comp) != data:
+		sys.stderr.write("bin2lzh: round trip failed\n")
+		return 1
+
+	w = sys.stdout.write
+	w("/* Generated by tools/lz77/bin2lzh.py, do not edit manually */\n\n")
+	w("#ifndef %s\n#define %s\n\n" % (guard, guard))
+	w("/* LZ77 (BIOS type 0x10) of %s, %d -> %d bytes */\n" % (sys.argv[1].split("/")[-1], len(data), len(comp)))
+	w("const long int %s_size = %d;\n" % (name, len(data)))
+	w("const unsigned char %s_lz[%d] __attribute__((aligned(4))) = {\n" % (name, len(comp)))
+	for i in range(0, len(comp), 16):
+		w("\t" + " ".join("0x%02x," % b for b in comp[i:i + 16]) + " \n")
+	w("};\n\n")
+	w("#endif /* %s */\n" % guard)
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())